@@ -1,8 +1,12 @@
 import os
 import sys
 import argparse
+import json
+import math
 import re
 
+from runBenchmarks import getTimesFromFile, getRegionTimesFromFile
+
 
 class style():
     RED = '\033[31m'
@@ -10,80 +14,280 @@ class style():
     RESET = '\033[0m'
 
 
-resultRegex = r"init time = (.*)s, run time = (.*)s"
+# The suffix of the output directories of the repeated runs of a benchmark written by runBenchmarks.py.
+REPETITION_REGEX = r"_rep[0-9]+$"
 
 
-def getTimesFromFile( filePath ):
+def addSample( samples, key, initTime, runTime, regions ):
     """
-    Return the init time and run time from a GEOSX standard output file.
+    Add the results of a run to the samples of its benchmark.
 
     Arguments:
-        filePath: The path of the output file to parse.
+        samples: The dictionary of the samples of each benchmark.
+        key: The key of the benchmark, a tuple of the XML name and the problem name.
+        initTime: The init time of the run.
+        runTime: The run time of the run.
+        regions: A dictionary of the time of each Caliper region of the run, may be None.
     """
-    with open( filePath, "r" ) as file:
-        for line in file:
-            matches = re.search( resultRegex, line )
-            if matches is not None:
-                return float( matches.groups()[ 0 ] ), float( matches.groups()[ 1 ] )
-    
-    raise Exception( "Could not get times from {}".format( filePath ) )
+    sample = samples.setdefault( key, { "init": [], "run": [], "regions": {} } )
+    sample[ "init" ].append( initTime )
+    sample[ "run" ].append( runTime )
+    for region, regionTime in ( regions or {} ).items():
+        sample[ "regions" ].setdefault( region, [] ).append( regionTime )
 
 
-def getTimesFromFolder( folder ):
+def getSamplesFromFolder( folder ):
     """
-    Return a dictionary containing the init and run times of each run in the benchmark folder.
+    Return a dictionary containing the init times, run times and region times of the runs of each benchmark in the
+    benchmark folder, the repeated runs of a benchmark are gathered.
 
     Arguments:
         folder: The top level directory the benchmarks were run in.
     """
-    results = {}
+    samples = {}
     for outerFile in os.listdir( folder ):
         xmlName = outerFile
         outerFile = os.path.join( folder, outerFile )
 
         if os.path.isdir( outerFile ):
-            for innerFile in os.listdir( outerFile ):
-                problemName = innerFile
+            for innerFile in sorted( os.listdir( outerFile ) ):
+                problemName = re.sub( REPETITION_REGEX, "", innerFile )
                 innerFile = os.path.join( outerFile, innerFile )
 
                 if os.path.isdir( innerFile ):
-                    outputFile = os.path.join( innerFile, "output.txt" );
+                    outputFile = os.path.join( innerFile, "output.txt" )
                     if not os.path.exists( outputFile ) or not os.path.isfile( outputFile ):
                         raise ValueError( "{} does not exist or is not a file.".format( outputFile ) )
 
-                    init, run = getTimesFromFile( outputFile )
-                    results[ ( xmlName, problemName ) ] = init, run
-    
-    return results
+                    times = getTimesFromFile( outputFile )
+                    if times is None:
+                        raise Exception( "Could not get times from {}".format( outputFile ) )
+
+                    addSample( samples, ( xmlName, problemName ), times[ 0 ], times[ 1 ], getRegionTimesFromFile( outputFile ) )
 
+    return samples
 
-def joinResults( results, baselineResults ):
+
+def getSamplesFromHistory( filePath, index ):
     """
-    Return a dictionary containing both the results and baseline results.
-    
+    Return a dictionary containing the init times, run times and region times of the runs of each benchmark of a
+    record of a JSON history file written by runBenchmarks.py, with the same keys as getSamplesFromFolder, and the
+    metadata of the record.
+
     Arguments:
-        results: The dictionary of benchmark results.
-        baselineResults: The dictionary of baseline benchmark results.
+        filePath: The path of the history file.
+        index: The index of the record in the history, negative indices count from the last record.
+    """
+    with open( filePath, "r" ) as file:
+        history = json.load( file )
+
+    record = history[ index ]
+    samples = {}
+    for benchmark in record[ "benchmarks" ]:
+        key = ( benchmark[ "xml" ], "{}_{}".format( benchmark[ "name" ], benchmark[ "nodes" ] ) )
+
+        # the records written before the repeated runs only have the times of a single run
+        runs = benchmark.get( "runs", [ benchmark ] )
+        for run in runs:
+            addSample( samples, key, run[ "initTime" ], run[ "runTime" ], run.get( "regions" ) )
+
+    metadata = dict( record.get( "metadata", {} ) )
+    metadata[ "date" ] = record.get( "date" )
+    metadata[ "machine" ] = record.get( "machine" )
+    return samples, metadata
+
+
+def getSamples( path, index ):
     """
-    joined = {}
-    for key in results:
-        joined[ key ] = [ results[ key ][ 0 ], results[ key ][ 1 ], float( "nan" ), float( "nan" ) ]
-    
-    for key in baselineResults:
-        if key in joined:
-            joined[ key ][ 2 ] = baselineResults[ key ][ 0 ]
-            joined[ key ][ 3 ] = baselineResults[ key ][ 1 ]
+    Return a dictionary containing the samples of each benchmark of a benchmark folder or of a JSON history file, and
+    the metadata of the runs, None for a folder.
+
+    Arguments:
+        path: The top level directory the benchmarks were run in, or the path of a history file.
+        index: The index of the record if path is a history file.
+    """
+    if os.path.isdir( path ):
+        return getSamplesFromFolder( path ), None
+    elif os.path.isfile( path ) and path.endswith( ".json" ):
+        return getSamplesFromHistory( path, index )
+
+    raise ValueError( "{} is neither a directory nor a JSON history file!".format( path ) )
+
+
+def mean( values ):
+    """
+    Return the mean of a list of values.
+
+    Arguments:
+        values: The values, at least one.
+    """
+    return sum( values ) / float( len( values ) )
+
+
+def variance( values ):
+    """
+    Return the unbiased sample variance of a list of values.
+
+    Arguments:
+        values: The values, at least two.
+    """
+    m = mean( values )
+    return sum( ( x - m ) ** 2 for x in values ) / float( len( values ) - 1 )
+
+
+def incompleteBetaFraction( a, b, x ):
+    """
+    Return the continued fraction of the regularized incomplete beta function, evaluated with the modified Lentz method.
+
+    Arguments:
+        a: The first parameter of the function.
+        b: The second parameter of the function.
+        x: The argument of the function, in [0, 1].
+    """
+    tiny = 1e-300
+    c = 1.0
+    d = 1.0 - ( a + b ) * x / ( a + 1.0 )
+    d = 1.0 / ( d if abs( d ) > tiny else tiny )
+    result = d
+    for m in range( 1, 300 ):
+        for numerator in ( m * ( b - m ) * x / ( ( a + 2 * m - 1 ) * ( a + 2 * m ) ),
+                           -( a + m ) * ( a + b + m ) * x / ( ( a + 2 * m ) * ( a + 2 * m + 1 ) ) ):
+            d = 1.0 + numerator * d
+            d = 1.0 / ( d if abs( d ) > tiny else tiny )
+            c = 1.0 + numerator / c
+            c = c if abs( c ) > tiny else tiny
+            result *= c * d
+        if abs( c * d - 1.0 ) < 1e-12:
+            break
+
+    return result
+
+
+def incompleteBeta( a, b, x ):
+    """
+    Return the regularized incomplete beta function I_x( a, b ).
+
+    Arguments:
+        a: The first parameter of the function.
+        b: The second parameter of the function.
+        x: The argument of the function, in [0, 1].
+    """
+    if x <= 0.0:
+        return 0.0
+    if x >= 1.0:
+        return 1.0
+
+    logFront = math.lgamma( a + b ) - math.lgamma( a ) - math.lgamma( b ) + a * math.log( x ) + b * math.log( 1.0 - x )
+    if x < ( a + 1.0 ) / ( a + b + 2.0 ):
+        return math.exp( logFront ) * incompleteBetaFraction( a, b, x ) / a
+
+    return 1.0 - math.exp( logFront ) * incompleteBetaFraction( b, a, 1.0 - x ) / b
+
+
+def studentTwoSidedPValue( t, dof ):
+    """
+    Return the probability that the absolute value of a Student t variable exceeds |t|.
+
+    Arguments:
+        t: The value of the statistic.
+        dof: The number of degrees of freedom, may be fractional.
+    """
+    return incompleteBeta( 0.5 * dof, 0.5, dof / ( dof + t * t ) )
+
+
+def studentQuantile( alpha, dof ):
+    """
+    Return the value t such that the probability that the absolute value of a Student t variable exceeds t is alpha.
+
+    Arguments:
+        alpha: The probability, in ]0, 1[.
+        dof: The number of degrees of freedom, may be fractional.
+    """
+    low = 0.0
+    high = 1.0
+    while studentTwoSidedPValue( high, dof ) > alpha:
+        high *= 2.0
+
+    for _ in range( 100 ):
+        middle = 0.5 * ( low + high )
+        if studentTwoSidedPValue( middle, dof ) > alpha:
+            low = middle
         else:
-            joined[ key ] = [ float( "nan" ), float( "nan" ), baselineResults[ key ][ 0 ], baselineResults[ key ][ 1 ] ]
-    
-    joinedList = []
-    for key in joined:
-        item = []
-        item += key
-        item += joined[ key ]
-        joinedList.append( item )
-    
-    return sorted( joinedList, lambda x, y: cmp( x, y ) )
+            high = middle
+
+    return 0.5 * ( low + high )
+
+
+def compareSamples( values, baselineValues, alpha ):
+    """
+    Return the relative change of the mean of the values over the mean of the baseline values, the half width of its
+    confidence interval and the p-value of Welch's t-test that the means are equal. The interval and the p-value are
+    None when one of the samples has a single value, since the variance is unknown.
+
+    Arguments:
+        values: The new values.
+        baselineValues: The baseline values.
+        alpha: One minus the confidence level of the interval.
+    """
+    baseMean = mean( baselineValues )
+    delta = ( mean( values ) - baseMean ) / baseMean
+    if len( values ) < 2 or len( baselineValues ) < 2:
+        return delta, None, None
+
+    v0 = variance( values ) / len( values )
+    v1 = variance( baselineValues ) / len( baselineValues )
+    if v0 + v1 == 0.0:
+        return delta, 0.0, 0.0 if delta != 0.0 else 1.0
+
+    # the Welch-Satterthwaite approximation of the degrees of freedom
+    dof = ( v0 + v1 ) ** 2 / ( v0 ** 2 / ( len( values ) - 1 ) + v1 ** 2 / ( len( baselineValues ) - 1 ) )
+    standardError = math.sqrt( v0 + v1 )
+    pValue = studentTwoSidedPValue( ( mean( values ) - baseMean ) / standardError, dof )
+    halfWidth = studentQuantile( alpha, dof ) * standardError / baseMean
+
+    return delta, halfWidth, pValue
+
+
+def classify( delta, pValue, threshold, alpha ):
+    """
+    Return "regression" if a change is a significant slowdown greater than the threshold, "improvement" if it is a
+    significant speed up greater than the threshold, and None otherwise. Without a p-value, which needs repeated runs,
+    the changes greater than the threshold are reported as suspected regressions and improvements.
+
+    Arguments:
+        delta: The relative change of the time.
+        pValue: The p-value of the change, may be None.
+        threshold: The smallest relative change that matters.
+        alpha: The significance level.
+    """
+    if abs( delta ) < threshold or ( pValue is not None and pValue >= alpha ):
+        return None
+
+    change = "regression" if delta > 0.0 else "improvement"
+    return change if pValue is not None else "suspected " + change
+
+
+def formatChange( delta, halfWidth, pValue, change ):
+    """
+    Return the relative change, its confidence interval and its p-value formatted for a table, with the color of the
+    change.
+
+    Arguments:
+        delta: The relative change of the time.
+        halfWidth: The half width of the confidence interval of the change, may be None.
+        pValue: The p-value of the change, may be None.
+        change: The classification of the change, see classify.
+    """
+    text = "{:+.1%}".format( delta )
+    if halfWidth is not None:
+        text += " +/- {:.1%} (p={:.3f})".format( halfWidth, pValue )
+
+    if change is None:
+        return text
+    elif change.endswith( "regression" ):
+        return ( text, style.RED )
+    else:
+        return ( text, style.GREEN )
 
 
 def getValue( x ):
@@ -131,53 +335,117 @@ def printTable( table ):
     print( "|" + "|".join( "-" * width + "--" for width in col_width ) + "|" )
 
 
-def generateTable( results, baselineResults ):
+def printMetadata( metadata, baselineMetadata ):
     """
-    Print a table containing the speed up of the results over the baseline results.
-    
+    Print the metadata of the two records that are compared, when they come from history files.
+
     Arguments:
-        results: The dictionary of benchmark results.
-        baselineResults: The dictionary of baseline benchmark results.
+        metadata: The metadata of the new runs, may be None.
+        baselineMetadata: The metadata of the baseline runs, may be None.
     """
-    lines = [ ( "XML Name", "Problem Name", "init speed up", "run speed up" ) ]
-    
-    joined = joinResults( results, baselineResults )
-    for result in joined:
-        xmlName = result[ 0 ]
-        problemName = result[ 1 ]
-        initTime = result[ 2 ]
-        runTime = result[ 3 ]
-        baseInitTime = result[ 4 ]
-        baseRunTime = result[ 5 ]
+    if metadata is None and baselineMetadata is None:
+        return
+
+    metadata = metadata or {}
+    baselineMetadata = baselineMetadata or {}
+    keys = sorted( set( metadata ) | set( baselineMetadata ) )
+    lines = [ ( "", "new", "baseline" ) ]
+    for key in keys:
+        lines.append( ( key, str( metadata.get( key ) ), str( baselineMetadata.get( key ) ) ) )
 
-        lines.append( ( xmlName, problemName,
-                        "{:.2f}x".format( baseInitTime / initTime ),
-                        "{:.2f}x".format( baseRunTime / runTime ) ) )
+    printTable( lines )
+    print( "" )
+
+
+def generateTables( samples, baselineSamples, threshold, alpha, minRegionFraction, allRegions ):
+    """
+    Print a table with the change of the init and run times of each benchmark found in both sets of samples, then a
+    table with the change of the time of the Caliper regions of each benchmark. Return the number of regressions.
 
+    Arguments:
+        samples: The dictionary of the samples of each benchmark.
+        baselineSamples: The dictionary of the samples of each baseline benchmark.
+        threshold: The smallest relative change that is reported.
+        alpha: The significance level of the changes.
+        minRegionFraction: The regions taking less than this fraction of the baseline run time are not compared.
+        allRegions: If True the change of all the regions is printed, not only the one of the reported changes.
+    """
+    numRegressions = 0
+    keys = sorted( set( samples ) & set( baselineSamples ) )
+    for key in sorted( set( samples ) ^ set( baselineSamples ) ):
+        print( "{}/{} is only found in one of the runs.".format( key[ 0 ], key[ 1 ] ) )
+
+    lines = [ ( "XML Name", "Problem Name", "runs", "baseline runs", "init change", "run change" ) ]
+    for key in keys:
+        sample = samples[ key ]
+        baseline = baselineSamples[ key ]
+
+        changes = []
+        for time in ( "init", "run" ):
+            delta, halfWidth, pValue = compareSamples( sample[ time ], baseline[ time ], alpha )
+            change = classify( delta, pValue, threshold, alpha )
+            numRegressions += change == "regression"
+            changes.append( formatChange( delta, halfWidth, pValue, change ) )
+
+        lines.append( ( key[ 0 ], key[ 1 ], str( len( sample[ "run" ] ) ), str( len( baseline[ "run" ] ) ) ) + tuple( changes ) )
+
+    print( "Change of the mean times relative to the baseline, with the {:.0%} confidence interval and the p-value when the runs are repeated:".format( 1.0 - alpha ) )
     printTable( lines )
+    print( "" )
+
+    lines = [ ( "XML Name", "Problem Name", "Region", "baseline (s)", "new (s)", "change" ) ]
+    for key in keys:
+        sample = samples[ key ]
+        baseline = baselineSamples[ key ]
+        minRegionTime = minRegionFraction * mean( baseline[ "run" ] )
+
+        for region in sorted( set( sample[ "regions" ] ) & set( baseline[ "regions" ] ) ):
+            regionTimes = sample[ "regions" ][ region ]
+            baselineTimes = baseline[ "regions" ][ region ]
+            if mean( baselineTimes ) < minRegionTime:
+                continue
+
+            delta, halfWidth, pValue = compareSamples( regionTimes, baselineTimes, alpha )
+            change = classify( delta, pValue, threshold, alpha )
+            numRegressions += change == "regression"
+            if change is not None or allRegions:
+                lines.append( ( key[ 0 ], key[ 1 ], region,
+                                "{:.3f}".format( mean( baselineTimes ) ),
+                                "{:.3f}".format( mean( regionTimes ) ),
+                                formatChange( delta, halfWidth, pValue, change ) ) )
+
+    if len( lines ) > 1:
+        print( "Change of the time of the Caliper regions, maximum over the ranks:" )
+        printTable( lines )
+        print( "" )
+
+    return numRegressions
 
 
 def main():
-    """ Parse the command line arguments and compare the benchmarks. """
+    """ Parse the command line arguments and compare the benchmarks, the exit code is 1 if regressions are found. """
 
     parser = argparse.ArgumentParser()
-    parser.add_argument( "toCompareDir", help="The directory where the new benchmarks were run." )
-    parser.add_argument( "baselineDir", help="The directory where the baseline benchmarks were run." )
+    parser.add_argument( "toCompareDir", help="The directory where the new benchmarks were run, or a JSON history file." )
+    parser.add_argument( "baselineDir", help="The directory where the baseline benchmarks were run, or a JSON history file." )
+    parser.add_argument( "--toCompareIndex", type=int, default=-1, help="The record of the toCompareDir history file, the default is the last one." )
+    parser.add_argument( "--baselineIndex", type=int, default=-1, help="The record of the baselineDir history file, the default is the last one." )
+    parser.add_argument( "--threshold", type=float, default=0.02, help="The smallest relative change of a time that is reported, the default is 0.02." )
+    parser.add_argument( "--alpha", type=float, default=0.05, help="The significance level of the changes, the default is 0.05." )
+    parser.add_argument( "--minRegionFraction", type=float, default=0.01,
+                         help="The regions taking less than this fraction of the run time are not compared, the default is 0.01." )
+    parser.add_argument( "--allRegions", action="store_true", help="Print the change of all the regions, not only the significant ones." )
     args = parser.parse_args()
 
-    toCompareDir = os.path.abspath( args.toCompareDir )
-    if not os.path.isdir( toCompareDir ):
-        raise ValueError( "toCompareDir is not a directory!" )
-    
-    baselineDir = os.path.abspath( args.baselineDir )
-    if not os.path.isdir( baselineDir ):
-        raise ValueError( "baselineDir is not a directory!" )
+    samples, metadata = getSamples( os.path.abspath( args.toCompareDir ), args.toCompareIndex )
+    baselineSamples, baselineMetadata = getSamples( os.path.abspath( args.baselineDir ), args.baselineIndex )
 
-    results = getTimesFromFolder( toCompareDir )
-    baselineResults = getTimesFromFolder( baselineDir )
+    printMetadata( metadata, baselineMetadata )
+    numRegressions = generateTables( samples, baselineSamples, args.threshold, args.alpha, args.minRegionFraction, args.allRegions )
+    if numRegressions > 0:
+        print( "{}Found {} significant regressions.{}".format( style.RED, numRegressions, style.RESET ) )
 
-    generateTable( results, baselineResults )
-    return 0
+    return 1 if numRegressions > 0 else 0
 
 
 if __name__ == "__main__" and not sys.flags.interactive:
@@ -1,4 +1,5 @@
 import os
+import re
 import glob
 import xml.etree.ElementTree as ElementTree
 import time
@@ -8,6 +9,7 @@ import shutil
 import subprocess
 import sys
 import argparse
+import json
 
 
 class Status:
@@ -49,6 +51,288 @@ def getMostCubeLikeRepresentation( n ):
     return minTriple
 
 
+# The phases reported by the benchmarks, with the Caliper regions that belong to them. A region matches if its name
+# is the given name or ends with "::" followed by it, and the time of a region is given to the innermost phase it
+# is nested in, so that the nested phases are not counted twice.
+# The first phase matching a region wins, so the well regions are listed before the generic flux assembly.
+PHASES = [ ( "separation", [ "SurfaceGenerator::SeparationDriver", "EmbeddedSurfaceGenerator::InitializePostSubGroups" ] ),
+           ( "topology sync", [ "SynchronizeTopologyChange", "SurfaceGenerator::SynchronizeRuptureState" ] ),
+           ( "stencil and DOF rebuild", [ "addToFractureStencil", "SetupDofs", "SetupSystem", "DofManager::reorderByRank" ] ),
+           ( "property update", [ "UpdateState", "UpdateFluidModel", "UpdateComponentFraction", "UpdatePhaseVolumeFraction" ] ),
+           ( "well assembly", [ "CompositionalMultiphaseWell::AssembleFluxTerms", "CompositionalMultiphaseWell::AssembleVolumeBalanceTerms",
+                                "CompositionalMultiphaseWell::ComputePerforationRates", "CompositionalMultiphaseWell::FormPressureRelations",
+                                "SinglePhaseWell::AssembleFluxTerms", "SinglePhaseWell::ComputePerforationRates",
+                                "SinglePhaseWell::FormPressureRelations" ] ),
+           ( "flux assembly", [ "AssembleFluxTerms" ] ),
+           ( "assembly", [ "AssembleSystem" ] ),
+           ( "operator apply", [ "LaplaceFEMMatrixFreeOperator::apply", "SolidMechanicsMatrixFreeOperator::apply", "HypreMatrix::apply",
+                                 "EpetraMatrix::apply", "PetscMatrix::apply" ] ),
+           ( "linear setup", [ "linearSetup" ] ),
+           ( "linear solve", [ "linearSolve" ] ),
+           ( "solve", [ "SolveSystem" ] ) ]
+
+# The directories searched for benchmark definitions, relative to this script.
+BENCHMARK_DIRECTORIES = [ ".",
+                          "../src/coreComponents/physicsSolvers/fluidFlow/benchmarks/Egg",
+                          "../src/coreComponents/physicsSolvers/fluidFlow/benchmarks/SPE10" ]
+
+# The line of the GEOSX standard output giving the initialization and run times.
+RESULT_REGEX = r"init time = (.*)s, run time = (.*)s"
+
+# The line of the solver summary giving the number of time steps, Newton iterations, linear solves and iterations.
+SOLVER_SUMMARY_REGEX = r"(\S+): (\d+) time steps, (\d+) time step cuts, (\d+) Newton iterations, (\d+) linear solves, (\d+) linear iterations"
+
+# The number of degrees of freedom per mesh node of the nodal solvers whose throughput is reported.
+DOFS_PER_NODE = { "LaplaceFEM": 1, "SolidMechanics_LagrangianFEM": 3 }
+
+# The bytes read and written per degree of freedom by one application of the operator of a scalar trilinear hexahedral
+# discretization, used for the bandwidth roofline. An assembled CSR matrix moves its 27 nonzeros per row (8 bytes of
+# value and 4 of column index) and the input and output vectors (24 bytes with the row offsets). The matrix-free
+# operator moves per node the element to node map (64 bytes), the coordinates (24 bytes), the field it applies to and
+# its result (24 bytes) and the copies from and to the Krylov vectors (32 bytes).
+BYTES_PER_DOF = { "assembled": 27 * 12 + 24, "matrixFree": 64 + 24 + 24 + 32 }
+
+
+def getPhase( regionName ):
+    """
+    Return the name of the phase a Caliper region belongs to, or None if it does not belong to any.
+
+    Args:
+        regionName: The name of the region.
+    """
+    for phase, regions in PHASES:
+        for region in regions:
+            if regionName == region or regionName.endswith( "::" + region ):
+                return phase
+
+    return None
+
+
+def readRuntimeReport( filePath ):
+    """
+    Return the regions of the Caliper runtime report of a GEOSX standard output file as a list of tuples of the
+    indentation of the region name, the region name and its time, or None if the file has no report. The time is
+    the maximum over the ranks when the report has one.
+
+    Args:
+        filePath: The path of the output file to parse.
+    """
+    regions = None
+    timeColumn = 0
+    with open( filePath, "r" ) as file:
+        for line in file:
+            if regions is None:
+                if line.startswith( "Path" ):
+                    regions = []
+                    if "Max time/rank" in line:
+                        timeColumn = 1
+                continue
+
+            tokens = line.split()
+            numbers = []
+            while tokens:
+                try:
+                    numbers.insert( 0, float( tokens[ -1 ] ) )
+                    tokens.pop()
+                except ValueError:
+                    break
+
+            if not tokens or len( numbers ) <= timeColumn:
+                break
+
+            regions.append( ( len( line ) - len( line.lstrip() ), " ".join( tokens ), numbers[ timeColumn ] ) )
+
+    return regions
+
+
+def getPhaseTimesFromFile( filePath ):
+    """
+    Return a dictionary containing the time spent in each phase, as found in the Caliper runtime report of a GEOSX
+    standard output file, or None if the file has no report. The times are the maximum over the ranks, and the time
+    of the regions outside of all the phases is given to the phase "other".
+
+    Args:
+        filePath: The path of the output file to parse.
+    """
+    regions = readRuntimeReport( filePath )
+    if regions is None:
+        return None
+
+    times = dict( ( phase, 0.0 ) for phase, _ in PHASES )
+    times[ "other" ] = 0.0
+    stack = []
+    for indent, regionName, regionTime in regions:
+        # the tree is given by the indentation of the region names
+        while stack and stack[ -1 ][ 0 ] >= indent:
+            stack.pop()
+
+        phase = getPhase( regionName )
+        if phase is None:
+            phase = stack[ -1 ][ 1 ] if stack else "other"
+        stack.append( ( indent, phase ) )
+
+        times[ phase ] += regionTime
+
+    return times
+
+
+def getRegionTimesFromFile( filePath ):
+    """
+    Return a dictionary containing the time of each region of the Caliper runtime report of a GEOSX standard output
+    file, indexed by the path of the region ("outer/inner"), or None if the file has no report.
+
+    Args:
+        filePath: The path of the output file to parse.
+    """
+    regions = readRuntimeReport( filePath )
+    if regions is None:
+        return None
+
+    times = {}
+    stack = []
+    for indent, regionName, regionTime in regions:
+        while stack and stack[ -1 ][ 0 ] >= indent:
+            stack.pop()
+        stack.append( ( indent, regionName ) )
+
+        path = "/".join( name for _, name in stack )
+        times[ path ] = times.get( path, 0.0 ) + regionTime
+
+    return times
+
+
+def getTimesFromFile( filePath ):
+    """
+    Return the init time and run time from a GEOSX standard output file, or None if the file has no times.
+
+    Args:
+        filePath: The path of the output file to parse.
+    """
+    with open( filePath, "r" ) as file:
+        for line in file:
+            matches = re.search( RESULT_REGEX, line )
+            if matches is not None:
+                return float( matches.groups()[ 0 ] ), float( matches.groups()[ 1 ] )
+
+    return None
+
+
+def getSolverSummaryFromFile( filePath ):
+    """
+    Return a dictionary containing the number of time steps, Newton iterations, linear solves and linear iterations
+    summed over the solvers of a GEOSX standard output file, or None if the file has no solver summary.
+
+    Args:
+        filePath: The path of the output file to parse.
+    """
+    summary = None
+    with open( filePath, "r" ) as file:
+        for line in file:
+            matches = re.search( SOLVER_SUMMARY_REGEX, line )
+            if matches is not None:
+                if summary is None:
+                    summary = { "timeSteps": 0, "newtonIterations": 0, "linearSolves": 0, "linearIterations": 0 }
+                counts = [ int( x ) for x in matches.groups()[ 1: ] ]
+                summary[ "timeSteps" ] += counts[ 0 ]
+                summary[ "newtonIterations" ] += counts[ 2 ]
+                summary[ "linearSolves" ] += counts[ 3 ]
+                summary[ "linearIterations" ] += counts[ 4 ]
+
+    return summary
+
+
+def getNodalDofsFromDeck( xmlPath ):
+    """
+    Return the number of degrees of freedom of the nodal solvers of an XML file and whether they are matrix-free, or
+    None if the file has no such solver or no internal mesh.
+
+    The number of nodes is computed from the elements of the internal meshes, so the other meshes are not supported.
+
+    Args:
+        xmlPath: The path to the XML file that is run.
+    """
+    tree = ElementTree.parse( xmlPath )
+
+    dofsPerNode = 0
+    matrixFree = False
+    for solver in tree.findall( "./Solvers/*" ):
+        if solver.tag in DOFS_PER_NODE:
+            dofsPerNode += DOFS_PER_NODE[ solver.tag ]
+            matrixFree = matrixFree or int( solver.get( "matrixFree", "0" ) ) != 0
+
+    numNodes = 0
+    for mesh in tree.findall( "./Mesh/InternalMesh" ):
+        nodesPerAxis = [ sum( int( x ) for x in parseListFromString( mesh.get( key ) ) ) + 1 for key in ( "nx", "ny", "nz" ) ]
+        numNodes += nodesPerAxis[ 0 ] * nodesPerAxis[ 1 ] * nodesPerAxis[ 2 ]
+
+    if dofsPerNode == 0 or numNodes == 0:
+        return None
+
+    return numNodes * dofsPerNode, matrixFree
+
+
+def getWeakScalingDeck( xmlPath, outputPath, scale ):
+    """
+    Write a copy of an XML file where the number of elements of the internal meshes is scaled.
+
+    The elements are refined along the three axes by the dimensions of the most cube-like box of volume scale, so that
+    the geometric objects and the boundary conditions are unchanged.
+
+    Args:
+        xmlPath: The path to the XML file to copy.
+        outputPath: The path to the scaled copy.
+        scale: The factor of the number of elements.
+    """
+    factors = getMostCubeLikeRepresentation( scale )
+
+    tree = ElementTree.parse( xmlPath )
+    for mesh in tree.findall( "./Mesh/InternalMesh" ):
+        for key, factor in zip( ( "nx", "ny", "nz" ), factors ):
+            numElems = [ int( x ) * factor for x in parseListFromString( mesh.get( key ) ) ]
+            mesh.set( key, "{ " + ", ".join( str( x ) for x in numElems ) + " }" )
+
+    tree.write( outputPath )
+
+
+def getBuildMetadata( geosxPath, scriptDir ):
+    """
+    Return a dictionary describing the GEOSX build that is benchmarked: the host, the commit of the source tree and
+    whether it has local changes, and the compiler and build type found in the CMake cache of the build directory.
+    The entries that cannot be found are None.
+
+    Args:
+        geosxPath: The path to the GEOSX executable, in the bin directory of the build.
+        scriptDir: A directory of the source tree.
+    """
+    metadata = { "host": os.environ.get( "HOSTNAME" ), "commit": None, "localChanges": None, "compiler": None,
+                 "compilerVersion": None, "buildType": None }
+
+    try:
+        metadata[ "commit" ] = subprocess.check_output( [ "git", "rev-parse", "HEAD" ], cwd=scriptDir ).decode().strip()
+        status = subprocess.check_output( [ "git", "status", "--porcelain", "--untracked-files=no" ], cwd=scriptDir )
+        metadata[ "localChanges" ] = len( status.strip() ) > 0
+    except ( OSError, subprocess.CalledProcessError ):
+        pass
+
+    cachePath = os.path.join( os.path.dirname( os.path.dirname( geosxPath ) ), "CMakeCache.txt" )
+    if os.path.isfile( cachePath ):
+        with open( cachePath, "r" ) as file:
+            for line in file:
+                if line.startswith( "CMAKE_CXX_COMPILER:" ):
+                    metadata[ "compiler" ] = line.split( "=", 1 )[ 1 ].strip()
+                elif line.startswith( "CMAKE_BUILD_TYPE:" ):
+                    metadata[ "buildType" ] = line.split( "=", 1 )[ 1 ].strip()
+
+    if metadata[ "compiler" ] is not None:
+        try:
+            versionOutput = subprocess.check_output( [ metadata[ "compiler" ], "--version" ], stderr=subprocess.STDOUT )
+            metadata[ "compilerVersion" ] = versionOutput.decode().splitlines()[ 0 ].strip()
+        except ( OSError, subprocess.CalledProcessError, IndexError ):
+            pass
+
+    return metadata
+
+
 def parseListFromString( listString ):
     """
     Given a comma separated string construct a list. The list may optionally be enclosed in {}. 
@@ -239,13 +523,19 @@ class Benchmark:
         outputDir: The directory where the benchmark is run.
         outputFile: The path to the file containing the standard output and
             standard error from the benchmark.
+        meshScale: The factor of the number of elements of the internal meshes, or None to run the XML file
+            unchanged.
+        scaling: "strong" or "weak" if the benchmark belongs to a scaling study, None otherwise.
+        repetition: The index of the run among the repeated runs of the same configuration, None if it is not repeated.
+        runXmlPath: The path to the XML file that is run, the scaled copy for a weak scaling run.
         runCommand: A list of arguments which appended to the submission command provides
             the full command for running this benchmark.
         process: The subproccess associated with the benchmark.
         status: The status of the benchmark.
     """
 
-    def __init__( self, outputDir, geosxPath, xmlPath, name, nodes, tasks, threadsPerTask, timeLimit, args, autoPartition ):
+    def __init__( self, outputDir, geosxPath, xmlPath, name, nodes, tasks, threadsPerTask, timeLimit, args, autoPartition, meshScale=None, scaling=None,
+                  repetition=None ):
         """
         Initialize a Benchmark.
 
@@ -262,6 +552,11 @@ class Benchmark:
             timeLimit: The time limit to give the scheduler in minutes, or None if if not specified.
             args: List of extra arguments to pass to GEOSX.
             autoPartition: If true then partition arguments are generated and passed to GEOSX.
+            meshScale: The factor of the number of elements of the internal meshes, used for the weak scaling.
+                May be None to run the XML file unchanged.
+            scaling: "strong" or "weak" if the benchmark belongs to a scaling study, None otherwise.
+            repetition: The index of the run among the repeated runs of the same configuration, None if it is not
+                repeated.
         """
         self.geosxPath = os.path.abspath( geosxPath )
         self.xmlPath = os.path.abspath( xmlPath )
@@ -272,11 +567,22 @@ class Benchmark:
         self.timeLimit = timeLimit
 
         xmlName = os.path.splitext( os.path.basename( self.xmlPath ) )[ 0 ]
-        self.outputDir = os.path.abspath( os.path.join( outputDir, xmlName, "{}_{}".format( self.name, self.nodes ) ) )
+        runName = "{}_{}".format( self.name, self.nodes )
+        if repetition is not None:
+            runName += "_rep{}".format( repetition )
+        self.outputDir = os.path.abspath( os.path.join( outputDir, xmlName, runName ) )
+        self.repetition = repetition
 
         self.outputFile = os.path.join( self.outputDir, "output.txt" )
 
-        self.runCommand = [self.geosxPath, "-n", "{}/{}".format( xmlName, self.name ), "-i", self.xmlPath]
+        self.meshScale = meshScale
+        self.scaling = scaling
+        runXmlPath = self.xmlPath
+        if self.meshScale is not None:
+            runXmlPath = os.path.join( self.outputDir, os.path.basename( self.xmlPath ) )
+
+        self.runXmlPath = runXmlPath
+        self.runCommand = [self.geosxPath, "-n", "{}/{}".format( xmlName, self.name ), "-i", runXmlPath]
 
         self.runCommand += args
 
@@ -297,14 +603,17 @@ class Benchmark:
         """
         createDirectory( self.outputDir, True )
 
+        if self.meshScale is not None:
+            getWeakScalingDeck( self.xmlPath, os.path.join( self.outputDir, os.path.basename( self.xmlPath ) ), self.meshScale )
+
         submissionCommand = machine.getSumbissionCommand( self.nodes, self.tasks, self.threadsPerTask, self.timeLimit )
 
         submissionCommand += self.runCommand
 
         if machine.hasCudaGPU():
-            submissionCommand += ["-t", "spot,profile.mpi,profile.cuda"]
+            submissionCommand += ["-t", "spot,runtime-report,profile.mpi,profile.cuda"]
         else:
-            submissionCommand += ["-t", "spot,profile.mpi"]
+            submissionCommand += ["-t", "spot,runtime-report,profile.mpi"]
         
         submissionCommand = map( str, submissionCommand )
         with open( self.outputFile, "w" ) as outputFile:
@@ -339,6 +648,89 @@ class Benchmark:
         else:
             return None
 
+    def getPhaseTimes( self ):
+        """
+        Return a dictionary containing the time spent in each phase of the Benchmark, or None if not available.
+
+        Arguments:
+            self: The Benchmark to get the phase times of.
+        """
+        if not os.path.isfile( self.outputFile ):
+            return None
+
+        return getPhaseTimesFromFile( self.outputFile )
+
+    def getRegionTimes( self ):
+        """
+        Return a dictionary containing the time of each Caliper region of the Benchmark, or None if not available.
+
+        Arguments:
+            self: The Benchmark to get the region times of.
+        """
+        if not os.path.isfile( self.outputFile ):
+            return None
+
+        return getRegionTimesFromFile( self.outputFile )
+
+    def getTimes( self ):
+        """
+        Return the init time and run time of the Benchmark, or None if not available.
+
+        Arguments:
+            self: The Benchmark to get the times of.
+        """
+        if not os.path.isfile( self.outputFile ):
+            return None
+
+        return getTimesFromFile( self.outputFile )
+
+    def getThroughputs( self ):
+        """
+        Return a dictionary containing the number of degrees of freedom of the Benchmark and the degrees of freedom
+        processed per second by the assembly, the operator applications and the linear solves, or None if the
+        Benchmark has no nodal solver, no solver summary or no runtime report. A rate is None if its phase took no
+        time.
+
+        The assembly rate counts one assembly per linear solve, the apply rate one application per linear iteration
+        plus one per solve for the initial residual, and the solve rate the iterations over the whole solve phase.
+
+        Arguments:
+            self: The Benchmark to get the throughputs of.
+        """
+        if not os.path.isfile( self.outputFile ) or not os.path.isfile( self.runXmlPath ):
+            return None
+
+        dofs = getNodalDofsFromDeck( self.runXmlPath )
+        summary = getSolverSummaryFromFile( self.outputFile )
+        times = self.getPhaseTimes()
+        if dofs is None or summary is None or times is None:
+            return None
+
+        numDofs, matrixFree = dofs
+        solves = summary[ "linearSolves" ]
+        iterations = summary[ "linearIterations" ]
+        solveTime = sum( times[ phase ] for phase in ( "operator apply", "linear setup", "linear solve", "solve" ) )
+
+        def rate( count, phaseTime ):
+            return numDofs * count / phaseTime if phaseTime > 0.0 else None
+
+        return { "dofs": numDofs,
+                 "matrixFree": matrixFree,
+                 "linearSolves": solves,
+                 "linearIterations": iterations,
+                 "assembly": rate( solves, times[ "assembly" ] ),
+                 "apply": rate( iterations + solves, times[ "operator apply" ] ),
+                 "solve": rate( iterations, solveTime ) }
+
+    def getXmlName( self ):
+        """
+        Return the name of the XML file of the Benchmark, without the extension.
+
+        Arguments:
+            self: The Benchmark to get the XML name of.
+        """
+        return os.path.basename( os.path.dirname( self.outputDir ) )
+
     def hasCompleted( self ):
         """
         Return True iff the Benchmark has completed.
@@ -441,7 +833,204 @@ def submitAllAndWait( machine, benchmarks, timeLimit ):
                 benchmark.kill()
 
 
-def getBenchmarksFromXML( xmlFilePath, machine, outputDir, geosxPath ):
+def printPhaseTimes( benchmarks ):
+    """
+    Print a table containing the time spent in each phase of the successful benchmarks.
+
+    Arguments:
+        benchmarks: A list of the Benchmarks.
+    """
+    names = []
+    timesList = []
+    for benchmark in benchmarks:
+        times = benchmark.getPhaseTimes() if benchmark.status == Status.SUCCESS else None
+        if times is not None:
+            names.append( os.path.relpath( benchmark.outputDir, os.path.dirname( os.path.dirname( benchmark.outputDir ) ) ) )
+            timesList.append( times )
+
+    if not timesList:
+        return
+
+    # only the phases found in one of the benchmarks are printed
+    phases = [ phase for phase, _ in PHASES if any( times[ phase ] > 0.0 for times in timesList ) ] + [ "other" ]
+    table = [ [ "Benchmark" ] + phases ]
+    for name, times in zip( names, timesList ):
+        table.append( [ name ] + [ "{:.3f}".format( times[ phase ] ) for phase in phases ] )
+
+    print( "Time per phase in seconds, maximum over the ranks:" )
+    widths = [ max( len( row[ i ] ) for row in table ) for i in range( len( table[ 0 ] ) ) ]
+    for row in table:
+        print( "| " + " | ".join( "{:{}}".format( x, widths[ i ] ) for i, x in enumerate( row ) ) + " |" )
+    print( "" )
+
+
+def printScalingTables( benchmarks ):
+    """
+    Print a table for each scaling study of the successful benchmarks, with the run time, the speed up and the
+    parallel efficiency relative to the run with the fewest nodes.
+
+    The efficiency of a strong scaling run on N times more nodes is its speed up divided by N, the efficiency of a
+    weak scaling run is its speed up.
+
+    Arguments:
+        benchmarks: A list of the Benchmarks.
+    """
+    studies = {}
+    for benchmark in benchmarks:
+        times = benchmark.getTimes() if benchmark.status == Status.SUCCESS and benchmark.scaling is not None else None
+        if times is not None:
+            key = ( benchmark.getXmlName(), benchmark.name, benchmark.scaling )
+            studies.setdefault( key, [] ).append( ( benchmark.nodes, benchmark.tasks, times[ 1 ] ) )
+
+    for ( xmlName, name, scaling ), runs in sorted( studies.items() ):
+        runs.sort()
+        baseNodes, _, baseTime = runs[ 0 ]
+
+        table = [ [ "nodes", "tasks", "run time", "speed up", "efficiency" ] ]
+        for nodes, tasks, runTime in runs:
+            speedUp = baseTime / runTime
+            efficiency = speedUp * baseNodes / nodes if scaling == "strong" else speedUp
+            table.append( [ str( nodes ), str( tasks ), "{:.3f}".format( runTime ), "{:.2f}x".format( speedUp ), "{:.0%}".format( efficiency ) ] )
+
+        print( "{} scaling of {}/{}:".format( scaling.capitalize(), xmlName, name ) )
+        widths = [ max( len( row[ i ] ) for row in table ) for i in range( len( table[ 0 ] ) ) ]
+        for row in table:
+            print( "| " + " | ".join( "{:{}}".format( x, widths[ i ] ) for i, x in enumerate( row ) ) + " |" )
+        print( "" )
+
+
+def printThroughputTables( benchmarks, streamBandwidth=None ):
+    """
+    Print a table containing the degrees of freedom processed per second by the assembly, the operator applications
+    and the linear solves of the successful benchmarks that report them, see Benchmark.getThroughputs.
+
+    When the STREAM bandwidth of a node is given the apply rate is compared with the roofline of the operator, the
+    bandwidth of the nodes of the run divided by the bytes moved per degree of freedom given by BYTES_PER_DOF.
+
+    Arguments:
+        benchmarks: A list of the Benchmarks.
+        streamBandwidth: The STREAM bandwidth of one node in GB/s, or None.
+    """
+    def formatRate( value ):
+        return "{:.3e}".format( value ) if value is not None else "-"
+
+    header = [ "Benchmark", "nodes", "DOFs", "operator", "iterations", "assembly DOFs/s", "apply DOFs/s", "solve DOFs/s" ]
+    if streamBandwidth is not None:
+        header += [ "roofline DOFs/s", "of roofline" ]
+
+    table = [ header ]
+    for benchmark in benchmarks:
+        throughputs = benchmark.getThroughputs() if benchmark.status == Status.SUCCESS else None
+        if throughputs is None:
+            continue
+
+        operator = "matrixFree" if throughputs[ "matrixFree" ] else "assembled"
+        row = [ os.path.relpath( benchmark.outputDir, os.path.dirname( os.path.dirname( benchmark.outputDir ) ) ),
+                str( benchmark.nodes ),
+                str( throughputs[ "dofs" ] ),
+                operator,
+                str( throughputs[ "linearIterations" ] ),
+                formatRate( throughputs[ "assembly" ] ),
+                formatRate( throughputs[ "apply" ] ),
+                formatRate( throughputs[ "solve" ] ) ]
+
+        if streamBandwidth is not None:
+            roofline = benchmark.nodes * streamBandwidth * 1e9 / BYTES_PER_DOF[ operator ]
+            fraction = "{:.0%}".format( throughputs[ "apply" ] / roofline ) if throughputs[ "apply" ] is not None else "-"
+            row += [ formatRate( roofline ), fraction ]
+
+        table.append( row )
+
+    if len( table ) == 1:
+        return
+
+    print( "Degrees of freedom processed per second:" )
+    widths = [ max( len( row[ i ] ) for row in table ) for i in range( len( table[ 0 ] ) ) ]
+    for row in table:
+        print( "| " + " | ".join( "{:{}}".format( x, widths[ i ] ) for i, x in enumerate( row ) ) + " |" )
+    print( "" )
+
+
+def appendToHistory( benchmarks, machine, geosxPath, metadata, filePath ):
+    """
+    Append the results of the successful benchmarks to a JSON history file, created if it does not exist.
+
+    The file holds a list of records, one per call, each with the date, the machine, the GEOSX executable, the
+    metadata of the build and for each benchmark configuration its number of nodes and tasks and the results of each
+    of its repeated runs: the init and run times, the time spent in each phase and in each Caliper region, the
+    throughputs of the nodal solvers and the Caliper file. The init and run times of the configuration are the mean
+    over the runs.
+
+    Arguments:
+        benchmarks: A list of the Benchmarks.
+        machine: The Machine the benchmarks were run on.
+        geosxPath: The path to the GEOSX executable that was run.
+        metadata: The dictionary describing the build, see getBuildMetadata.
+        filePath: The path of the history file.
+    """
+    history = []
+    if os.path.isfile( filePath ):
+        with open( filePath, "r" ) as file:
+            history = json.load( file )
+
+    results = {}
+    for benchmark in benchmarks:
+        times = benchmark.getTimes() if benchmark.status == Status.SUCCESS else None
+        if times is None:
+            continue
+
+        key = ( benchmark.getXmlName(), benchmark.name, benchmark.nodes )
+        if key not in results:
+            results[ key ] = { "xml": benchmark.getXmlName(),
+                               "name": benchmark.name,
+                               "nodes": benchmark.nodes,
+                               "tasks": benchmark.tasks,
+                               "threadsPerTask": benchmark.threadsPerTask,
+                               "scaling": benchmark.scaling,
+                               "runs": [] }
+
+        results[ key ][ "runs" ].append( { "initTime": times[ 0 ],
+                                           "runTime": times[ 1 ],
+                                           "phases": benchmark.getPhaseTimes(),
+                                           "regions": benchmark.getRegionTimes(),
+                                           "throughputs": benchmark.getThroughputs(),
+                                           "timingFile": benchmark.getTimingFile() } )
+
+    for result in results.values():
+        runs = result[ "runs" ]
+        result[ "initTime" ] = sum( run[ "initTime" ] for run in runs ) / len( runs )
+        result[ "runTime" ] = sum( run[ "runTime" ] for run in runs ) / len( runs )
+
+    history.append( { "date": datetime.datetime.now().isoformat(),
+                      "machine": machine.name,
+                      "geosx": geosxPath,
+                      "metadata": metadata,
+                      "benchmarks": [ results[ key ] for key in sorted( results ) ] } )
+
+    with open( filePath, "w" ) as file:
+        json.dump( history, file, indent=2, sort_keys=True )
+
+
+def writePhaseTimes( benchmarks, filePath ):
+    """
+    Write the time spent in each phase of the successful benchmarks to a CSV file.
+
+    Arguments:
+        benchmarks: A list of the Benchmarks.
+        filePath: The path of the file to write.
+    """
+    phases = [ phase for phase, _ in PHASES ] + [ "other" ]
+    with open( filePath, "w" ) as file:
+        file.write( ",".join( [ "benchmark", "nodes", "tasks" ] + phases ) + "\n" )
+        for benchmark in benchmarks:
+            times = benchmark.getPhaseTimes() if benchmark.status == Status.SUCCESS else None
+            if times is not None:
+                xmlName = os.path.basename( os.path.dirname( benchmark.outputDir ) )
+                row = [ "{}/{}".format( xmlName, benchmark.name ), str( benchmark.nodes ), str( benchmark.tasks ) ]
+                file.write( ",".join( row + [ repr( times[ phase ] ) for phase in phases ] ) + "\n" )
+
+
+def getBenchmarksFromXML( xmlFilePath, machine, outputDir, geosxPath, repetitions=1 ):
     """
     Return a list of benchmarks created for the current Machine from the given XML file.
 
@@ -450,9 +1039,16 @@ def getBenchmarksFromXML( xmlFilePath, machine, outputDir, geosxPath ):
         machine: The Machine to run the benchmarks on.
         outputDir: The top level directory all the benchmarks are to be run in.
         geosxPath: The path to the GEOSX executable to run.
+        repetitions: The number of times each configuration is run.
     """
     benchmarks = []
 
+    def addBenchmark( *args, **kwargs ):
+        """ Add the repeated runs of a configuration, the arguments are those of the Benchmark constructor. """
+        for repetition in range( repetitions ):
+            kwargs[ "repetition" ] = repetition if repetitions > 1 else None
+            benchmarks.append( Benchmark( *args, **kwargs ) )
+
     tree = ElementTree.parse( xmlFilePath )
     matchingElements = tree.findall( "./Benchmarks/{}/Run".format( machine.name ) )
 
@@ -494,19 +1090,35 @@ def getBenchmarksFromXML( xmlFilePath, machine, outputDir, geosxPath ):
             raise Exception( "Option for autoPartition not recognized: {}. Valid options are 'On' and 'Off'.".format( autoPartition ) )
 
         strongScaling = elem.get( "strongScaling" )
-        if strongScaling is None:
-            benchmarks.append( Benchmark( outputDir, geosxPath, xmlFilePath, name, nodes, nodes * tasksPerNode, threadsPerTask, timeLimit, args, autoPartition ) )
-        else:
+        weakScaling = elem.get( "weakScaling" )
+        if strongScaling is not None and weakScaling is not None:
+            raise Exception( "The benchmark {} cannot have both 'strongScaling' and 'weakScaling'.".format( name ) )
+
+        if strongScaling is None and weakScaling is None:
+            addBenchmark( outputDir, geosxPath, xmlFilePath, name, nodes, nodes * tasksPerNode, threadsPerTask, timeLimit, args, autoPartition )
+        elif strongScaling is not None:
             strongScaling = parseListFromString( strongScaling )
             for scale in strongScaling:
                 totalNodes = nodes * int( scale )
                 totalTasks = totalNodes * tasksPerNode
-                benchmarks.append( Benchmark( outputDir, geosxPath, xmlFilePath, name, totalNodes, totalTasks, threadsPerTask, timeLimit, args, autoPartition ) )
+                addBenchmark( outputDir, geosxPath, xmlFilePath, name, totalNodes, totalTasks, threadsPerTask, timeLimit, args, autoPartition,
+                              scaling="strong" )
+        else:
+            # the number of elements grows with the number of nodes, which needs an internal mesh
+            if tree.find( "./Mesh/InternalMesh" ) is None:
+                raise Exception( "The benchmark {} of {} has 'weakScaling' but no InternalMesh to refine.".format( name, xmlFilePath ) )
+
+            weakScaling = parseListFromString( weakScaling )
+            for scale in weakScaling:
+                totalNodes = nodes * int( scale )
+                totalTasks = totalNodes * tasksPerNode
+                addBenchmark( outputDir, geosxPath, xmlFilePath, name, totalNodes, totalTasks, threadsPerTask, timeLimit, args, autoPartition,
+                              int( scale ), "weak" )
 
     return benchmarks
 
 
-def getBenchmarksFromDirectory( benchmarkDir, machine, outputDir, geosxPath ):
+def getBenchmarksFromDirectory( benchmarkDir, machine, outputDir, geosxPath, repetitions=1 ):
     """
     Return a list of benchmarks created for the current Machine from the XML files in the given directory.
 
@@ -515,11 +1127,12 @@ def getBenchmarksFromDirectory( benchmarkDir, machine, outputDir, geosxPath ):
         machine: The Machine to run the benchmarks on.
         outputDir: The top level directory all the benchmarks are to be run in.
         geosxPath: The path to the GEOSX executable to run.
+        repetitions: The number of times each configuration is run.
     """
     benchmarks = []
     for fileName in os.listdir( benchmarkDir ):
         if fileName.endswith( ".xml" ):
-            benchmarks += getBenchmarksFromXML( os.path.join( benchmarkDir, fileName ), machine, outputDir, geosxPath )
+            benchmarks += getBenchmarksFromXML( os.path.join( benchmarkDir, fileName ), machine, outputDir, geosxPath, repetitions )
 
     return benchmarks
 
@@ -527,7 +1140,7 @@ def getBenchmarksFromDirectory( benchmarkDir, machine, outputDir, geosxPath ):
 def main():
     """ Parse the command line arguments, submit all found benchmarks and wait for them to finish. """
 
-    benchmarkDir = os.path.dirname( os.path.realpath( __file__ ) )
+    scriptDir = os.path.dirname( os.path.realpath( __file__ ) )
 
     timeLimit = 60
     parser = argparse.ArgumentParser()
@@ -536,6 +1149,13 @@ def main():
     parser.add_argument( "-t", "--timeLimit", type=int, help="Time limit for the entire script in minutes, the default is {}.". format( timeLimit ), default=timeLimit )
     parser.add_argument( "-o", "--timingCollectionDir", help="Directory to copy the timing files to." )
     parser.add_argument( "-e", "--errorCollectionDir", help="Directory to copy the output from any failed runs to." )
+    parser.add_argument( "-j", "--history", help="JSON file the results are appended to, created if it does not exist." )
+    parser.add_argument( "-b", "--benchmarkDir", action="append", default=[],
+                         help="Additional directory containing benchmark XML files, may be repeated." )
+    parser.add_argument( "-r", "--repetitions", type=int, default=1,
+                         help="Number of runs of each benchmark, to measure the run-to-run variance, the default is 1." )
+    parser.add_argument( "-s", "--streamBandwidth", type=float,
+                         help="STREAM bandwidth of one node in GB/s, the operator throughputs are compared with the roofline it gives." )
     args = parser.parse_args()
 
     geosxPath = os.path.abspath( args.geosxPath )
@@ -554,14 +1174,28 @@ def main():
     if errorCollectionDir is not None:
         errorCollectionDir = os.path.abspath( errorCollectionDir )
 
+    historyPath = args.history
+    if historyPath is not None:
+        historyPath = os.path.abspath( historyPath )
+
+    if args.repetitions < 1:
+        raise ValueError( "The number of repetitions must be at least 1!" )
+
     machine = getMachine()
 
-    benchmarks = getBenchmarksFromDirectory( benchmarkDir, machine, outputDir, geosxPath )
+    benchmarkDirs = [ os.path.join( scriptDir, directory ) for directory in BENCHMARK_DIRECTORIES ]
+    benchmarkDirs += [ os.path.abspath( directory ) for directory in args.benchmarkDir ]
+
+    benchmarks = []
+    for benchmarkDir in benchmarkDirs:
+        benchmarks += getBenchmarksFromDirectory( benchmarkDir, machine, outputDir, geosxPath, args.repetitions )
 
     print( "Benchmarking GEOSX found at {}".format( geosxPath ) )
     print( "Results will be written to {}".format( outputDir ) )
     if timingCollectionDir is not None:
         print( "Timing files will be added to {}".format( timingCollectionDir ) )
+    if historyPath is not None:
+        print( "The results will be appended to {}".format( historyPath ) )
     if errorCollectionDir is not None:
         print( "Output from failed benchmarks will be put in {}".format( errorCollectionDir ) )
     print( "The time limit is {} minutes.".format( timeLimit) )
@@ -570,12 +1204,20 @@ def main():
 
     submitAllAndWait( machine, benchmarks, timeLimit )
 
+    printPhaseTimes( benchmarks )
+    printScalingTables( benchmarks )
+    printThroughputTables( benchmarks, args.streamBandwidth )
+
+    if historyPath is not None:
+        appendToHistory( benchmarks, machine, geosxPath, getBuildMetadata( geosxPath, scriptDir ), historyPath )
+
     # Copy the timing files from successful benchmarks to a new directory if asked.
     if timingCollectionDir is not None:
         createDirectory( timingCollectionDir )
         for benchmark in benchmarks:
             if benchmark.status == Status.SUCCESS:
                 shutil.copy2( benchmark.getTimingFile(), timingCollectionDir )
+        writePhaseTimes( benchmarks, os.path.join( timingCollectionDir, "phaseTimings.csv" ) )
 
     # Copy the output from the failed benchmarks to a new directory if asked.
     if errorCollectionDir is not None:
@@ -17,6 +17,7 @@ set( PREPROCESSOR_DEFINES ARRAY_BOUNDS_CHECK
                           CUDA
                           FORTRAN_MANGLE_NO_UNDERSCORE
                           FPE
+                          HIP
                           HYPRE
                           MATHPRESSO
                           METIS
@@ -35,6 +36,7 @@ set( PREPROCESSOR_DEFINES ARRAY_BOUNDS_CHECK
                           MKL
                           GEOSX_PTP
                           SEPARATION_COEFFICIENT
+                          SINGLE_PRECISION_SOLID_STATE
                           ${externalComponentsList} )
 
 foreach( DEP in ${PREPROCESSOR_DEFINES})
@@ -44,6 +46,28 @@ foreach( DEP in ${PREPROCESSOR_DEFINES})
     endif()
 endforeach()
 
+# Define GEOSX_DISPATCH_<ENTRY> for each entry of the kernel dispatch lists, and the X-macros
+# applying a macro to the classes of the lists. The variants with precomputed gradients derive
+# from the base formulations and come first, so that a dynamic_cast chain finds them.
+macro( set_dispatch_config FE_LIST SOLID_LIST )
+    set( GEOSX_FOR_EACH_FE_3D_TYPE_BODY "" )
+    foreach( fe ${FE_LIST} )
+        string( TOUPPER ${fe} upper_fe )
+        set( GEOSX_DISPATCH_${upper_fe} TRUE )
+        set( feClass "${GEOSX_FE_CLASS_${fe}}" )
+        string( APPEND GEOSX_FOR_EACH_FE_3D_TYPE_BODY " FUNC( ARG, finiteElement::PrecomputedShapeGradients< ${feClass} > ) FUNC( ARG, ${feClass} )" )
+    endforeach()
+
+    set( GEOSX_FOR_EACH_SOLID_TYPE_BODY "" )
+    foreach( solid ${SOLID_LIST} )
+        string( TOUPPER ${solid} upper_solid )
+        set( GEOSX_DISPATCH_${upper_solid} TRUE )
+        string( APPEND GEOSX_FOR_EACH_SOLID_TYPE_BODY " FUNC( ${GEOSX_SOLID_CLASS_${solid}} )" )
+    endforeach()
+endmacro()
+
+set_dispatch_config( "${GEOSX_FE_DISPATCH}" "${GEOSX_SOLID_DISPATCH}" )
+
 set( GEOSX_CMAKE_BUILD_TYPE "\"${CMAKE_BUILD_TYPE}\"" )
 
 configure_file( ${CMAKE_SOURCE_DIR}/coreComponents/common/GeosxConfig.hpp.in
@@ -60,6 +84,7 @@ function( make_full_config_file
         set( GEOSX_USE_${DEP} TRUE )
         set( ${DEP} TRUE )
     endforeach()
+    set_dispatch_config( "${supported_FE_DISPATCH}" "${supported_SOLID_DISPATCH}" )
     set( GEOSX_CMAKE_BUILD_TYPE "\"Release\"" )
 
     configure_file( ${CMAKE_SOURCE_DIR}/coreComponents/common/GeosxConfig.hpp.in
@@ -6,6 +6,8 @@ message("CMAKE_HOST_APPLE = ${CMAKE_HOST_APPLE}")
 ### OPTIONS ###
 option( GEOSX_ENABLE_FPE "" ON)
 
+option( GEOSX_ENABLE_SINGLE_PRECISION_SOLID_STATE "Stores the quadrature point state of the solid models in single precision" OFF )
+
 option( ENABLE_CALIPER "" OFF )
 
 option( ENABLE_MATHPRESSO "" ON )
@@ -18,6 +20,7 @@ option( BUILD_LOCAL_RAJA "Use the local mirrored RAJA" OFF )
 option( RAJA_ENABLE_TBB "" OFF)
 option( RAJA_ENABLE_OPENMP "" OFF )
 option( RAJA_ENABLE_CUDA "" OFF )
+option( RAJA_ENABLE_HIP "" OFF )
 option( RAJA_ENABLE_TESTS "" OFF )
 
 option( ENABLE_GEOSX_PTP "" ON)
@@ -35,6 +38,10 @@ option( ENABLE_PARMETIS "Enables PARMETIS" ON )
 
 option( ENABLE_VTK "Enables VTK" ON )
 
+option( ENABLE_ADIOS2 "Enables the ADIOS2 output" OFF )
+
+option( ENABLE_ASCENT "Enables the Ascent in-situ output" OFF )
+
 option( ENABLE_TOTALVIEW_OUTPUT "Enables Totalview custom view" OFF )
 
 option( ENABLE_SUPERLU_DIST "Enables SUPERLU_DIST" ON )
@@ -65,6 +72,42 @@ if( NOT ENABLE_${upper_LAI} )
 endif()
 option( GEOSX_LA_INTERFACE_${upper_LAI} "${upper_LAI} LA interface is selected" ON )
 
+### KERNEL DISPATCH SETUP ###
+
+# The 3D element formulations and the solid models instantiated by the finite element kernels.
+# Trimming the lists shortens the build and shrinks the binary; a mesh or a model left out of
+# the lists is reported at runtime by the dispatch.
+set( supported_FE_DISPATCH Hexahedron Wedge Tetrahedron Pyramid )
+set( GEOSX_FE_DISPATCH "${supported_FE_DISPATCH}" CACHE STRING "3D element formulations instantiated by the finite element kernels" )
+message( STATUS "GEOSX_FE_DISPATCH = ${GEOSX_FE_DISPATCH}" )
+
+set( supported_SOLID_DISPATCH LinearElasticIsotropic LinearElasticTransverseIsotropic LinearElasticAnisotropic Damage )
+set( GEOSX_SOLID_DISPATCH "${supported_SOLID_DISPATCH}" CACHE STRING "Solid models instantiated by the finite element kernels" )
+message( STATUS "GEOSX_SOLID_DISPATCH = ${GEOSX_SOLID_DISPATCH}" )
+
+foreach( fe ${GEOSX_FE_DISPATCH} )
+  if( NOT ( fe IN_LIST supported_FE_DISPATCH ) )
+    message( FATAL_ERROR "GEOSX_FE_DISPATCH entries must be among: ${supported_FE_DISPATCH}" )
+  endif()
+endforeach()
+
+foreach( solid ${GEOSX_SOLID_DISPATCH} )
+  if( NOT ( solid IN_LIST supported_SOLID_DISPATCH ) )
+    message( FATAL_ERROR "GEOSX_SOLID_DISPATCH entries must be among: ${supported_SOLID_DISPATCH}" )
+  endif()
+endforeach()
+
+# The classes of the dispatch entries, relative to the geosx namespace.
+set( GEOSX_FE_CLASS_Hexahedron  "finiteElement::H1_Hexahedron_Lagrange1_GaussLegendre2" )
+set( GEOSX_FE_CLASS_Wedge       "finiteElement::H1_Wedge_Lagrange1_Gauss6" )
+set( GEOSX_FE_CLASS_Tetrahedron "finiteElement::H1_Tetrahedron_Lagrange1_Gauss1" )
+set( GEOSX_FE_CLASS_Pyramid     "finiteElement::H1_Pyramid_Lagrange1_Gauss5" )
+
+set( GEOSX_SOLID_CLASS_LinearElasticIsotropic           "constitutive::LinearElasticIsotropic" )
+set( GEOSX_SOLID_CLASS_LinearElasticTransverseIsotropic "constitutive::LinearElasticTransverseIsotropic" )
+set( GEOSX_SOLID_CLASS_LinearElasticAnisotropic         "constitutive::LinearElasticAnisotropic" )
+set( GEOSX_SOLID_CLASS_Damage                           "constitutive::Damage< constitutive::LinearElasticIsotropic >" )
+
 ### MPI/OMP/CUDA SETUP ###
 
 option( ENABLE_MPI "" ON )
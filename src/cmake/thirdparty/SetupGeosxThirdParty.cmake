@@ -650,6 +650,54 @@ if( ENABLE_VTK )
   set( thirdPartyLibs ${thirdPartyLibs} vtk )  
 endif()
 
+################################
+# ADIOS2
+################################
+if( ENABLE_ADIOS2 )
+  if( NOT EXISTS ${ADIOS2_DIR} )
+    set( ADIOS2_DIR ${GEOSX_TPL_DIR}/adios2 )
+  endif()
+
+  find_package( ADIOS2 REQUIRED PATHS ${ADIOS2_DIR} NO_DEFAULT_PATH )
+
+  message( STATUS "ADIOS2_DIR = ${ADIOS2_DIR}" )
+
+  if( ENABLE_MPI )
+    set( ADIOS2_TARGET adios2::cxx11_mpi )
+  else()
+    set( ADIOS2_TARGET adios2::cxx11 )
+  endif()
+
+  blt_register_library( NAME adios2
+                        LIBRARIES ${ADIOS2_TARGET}
+                        TREAT_INCLUDES_AS_SYSTEM ON )
+  set( thirdPartyLibs ${thirdPartyLibs} adios2 )
+endif()
+
+################################
+# ASCENT
+################################
+if( ENABLE_ASCENT )
+  if( NOT EXISTS ${ASCENT_DIR} )
+    set( ASCENT_DIR ${GEOSX_TPL_DIR}/ascent )
+  endif()
+
+  find_package( Ascent REQUIRED PATHS ${ASCENT_DIR} NO_DEFAULT_PATH )
+
+  message( STATUS "ASCENT_DIR = ${ASCENT_DIR}" )
+
+  if( ENABLE_MPI )
+    set( ASCENT_TARGET ascent::ascent_mpi )
+  else()
+    set( ASCENT_TARGET ascent::ascent )
+  endif()
+
+  blt_register_library( NAME ascent
+                        LIBRARIES ${ASCENT_TARGET}
+                        TREAT_INCLUDES_AS_SYSTEM ON )
+  set( thirdPartyLibs ${thirdPartyLibs} ascent )
+endif()
+
 ################################
 # SUITESPARSE
 ################################
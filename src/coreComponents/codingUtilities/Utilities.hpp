@@ -20,6 +20,7 @@
 #define GEOSX_CODINGUTILITIES_UTILITIES_H_
 
 #include "common/DataTypes.hpp"
+#include "common/FlatContainers.hpp"
 
 namespace geosx
 {
@@ -96,6 +97,20 @@ const T2 & stlMapLookup( const mapBase< T1, T2, SORTED > & Map, const T1 & key )
   return (stlMapLookup( const_cast< mapBase< T1, T2, SORTED > & >(Map), key ));
 }
 
+template< typename T1, typename T2 >
+T2 & stlMapLookup( FlatMap< T1, T2 > & Map, const T1 & key )
+{
+  typename FlatMap< T1, T2 >::iterator MapIter = Map.find( key );
+  GEOSX_ERROR_IF( MapIter==Map.end(), "Key not found: " << key );
+  return MapIter->second;
+}
+
+template< typename T1, typename T2 >
+const T2 & stlMapLookup( const FlatMap< T1, T2 > & Map, const T1 & key )
+{
+  return (stlMapLookup( const_cast< FlatMap< T1, T2 > & >(Map), key ));
+}
+
 template< typename T1, typename T2, typename SORTED, typename LAMBDA >
 bool executeOnMapValue( mapBase< T1, T2, SORTED > const & Map, const T1 & key, LAMBDA && lambda )
 {
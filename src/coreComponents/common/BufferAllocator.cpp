@@ -2,11 +2,15 @@
 #include "common/DataTypes.hpp"
 
 #ifdef GEOSX_USE_CHAI
+#include <umpire/strategy/DynamicPool.hpp>
+
 namespace geosx
 {
 
 bool prefer_pinned_buffer = true;
 
+bool use_gpu_aware_mpi = false;
+
 void setPreferPinned( bool p )
 {
   prefer_pinned_buffer = p;
@@ -17,6 +21,27 @@ bool getPreferPinned( )
   return prefer_pinned_buffer;
 }
 
+void setUseGpuAwareMPI( bool p )
+{
+  use_gpu_aware_mpi = p;
+}
+
+bool getUseGpuAwareMPI( )
+{
+  return use_gpu_aware_mpi;
+}
+
+umpire::Allocator getBufferPool( std::string const & resourceName )
+{
+  umpire::ResourceManager & rm = umpire::ResourceManager::getInstance();
+  std::string const poolName = "BUFFER_" + resourceName + "_POOL";
+  if( !rm.isAllocator( poolName ) )
+  {
+    rm.makeAllocator< umpire::strategy::DynamicPool >( poolName, rm.getAllocator( resourceName ) );
+  }
+  return rm.getAllocator( poolName );
+}
+
 }
 
 #endif
@@ -25,6 +25,8 @@
 #include <umpire/ResourceManager.hpp>
 #include <umpire/TypedAllocator.hpp>
 
+#include <string>
+
 namespace geosx
 {
 /**
@@ -41,6 +43,30 @@ void setPreferPinned( bool p );
  */
 bool getPreferPinned( );
 
+/**
+ * @brief Set whether the MPI implementation can access device memory directly.
+ * @param p Whether or not buffers used for device synchronization should be
+ *          allocated in device-accessible memory and handed directly to MPI.
+ */
+void setUseGpuAwareMPI( bool p );
+
+/**
+ * @brief Get whether the MPI implementation can access device memory directly.
+ * @return Whether or not buffers used for device synchronization should be
+ *         allocated in device-accessible memory and handed directly to MPI.
+ */
+bool getUseGpuAwareMPI( );
+
+/**
+ * @brief Get the pool of the communication buffers allocated from an umpire memory resource.
+ * @param resourceName the name of the umpire allocator of the resource, such as "PINNED" or "UM"
+ * @return the pool, created on first use and shared by all the BufferAllocators of the resource
+ * @note The pinned and unified allocations register the memory with the driver, which costs much more than
+ *       a host allocation: the pool keeps the released blocks and hands them back to the next buffers, so
+ *       that the buffers resized at each synchronization do not register memory again.
+ */
+umpire::Allocator getBufferPool( std::string const & resourceName );
+
 /**
  * @brief Wrapper class for umpire allocator, only used to determine which umpire allocator to use based on
  * availability.
@@ -65,19 +91,38 @@ private:
   // An umpire allocator allocating the type for which this class is instantiated.
   umpire::TypedAllocator< value_type > m_alloc;
   bool m_prefer_pinned_l;
+  // The id of the underlying umpire allocator, used to compare BufferAllocators.
+  int m_alloc_id;
 public:
   /**
    * @brief Default behavior is to allocate host memory, if there is a pinned memory allocator
    *        provided by umpire for the target platform, and getPreferPinned returns true,
-   *        use that instead.
+   *        use a pool of pinned memory instead.
    */
   BufferAllocator()
     : m_alloc( umpire::TypedAllocator< T >( umpire::ResourceManager::getInstance().getAllocator( umpire::resource::Host )))
     , m_prefer_pinned_l( getPreferPinned( ) )
+    , m_alloc_id( umpire::ResourceManager::getInstance().getAllocator( umpire::resource::Host ).getId() )
   {
     auto & rm = umpire::ResourceManager::getInstance();
     if( rm.isAllocator( "PINNED" ) && m_prefer_pinned_l )
-      m_alloc = umpire::TypedAllocator< T >( rm.getAllocator( umpire::resource::Pinned ));
+      setAllocator( getBufferPool( "PINNED" ) );
+  }
+  /**
+   * @brief Construct an allocator for buffers that are packed and unpacked on the device.
+   * @param deviceResident If true and a unified memory allocator is provided by umpire
+   *        for the target platform, allocate from a pool of it so that the device kernels write the
+   *        buffer in device memory and a GPU-aware MPI can send it without staging it
+   *        through the host. Otherwise this behaves like the default constructor.
+   * @note Device-only memory can not be used since the buffer headers (names, sizes and
+   *       strides) are written from the host.
+   */
+  explicit BufferAllocator( bool deviceResident )
+    : BufferAllocator()
+  {
+    auto & rm = umpire::ResourceManager::getInstance();
+    if( deviceResident && rm.isAllocator( "UM" ) )
+      setAllocator( getBufferPool( "UM" ) );
   }
   /**
    * @brief Allocate a buffer.
@@ -100,24 +145,34 @@ public:
   }
   /**
    * @brief Inequality operator.
-   * @param The other BufferAllocator to test against this buffer allocator for inequality.
-   * @return Always false. Since the actual umpire allocator is a singleton, so any properly-typed
-   *         buffer can be deallocated from any properly-typed BufferAllocator.
+   * @param other The other BufferAllocator to test against this buffer allocator for inequality.
+   * @return True if the underlying umpire allocators differ. Since the actual umpire allocators are
+   *         singletons, any properly-typed buffer can be deallocated from any BufferAllocator using
+   *         the same memory resource.
    */
-  bool operator!=( const BufferAllocator & )
+  bool operator!=( const BufferAllocator & other ) const
   {
-    return false;
+    return m_alloc_id != other.m_alloc_id;
   }
   /**
    * @brief Equality operator.
    * @param other The other BufferAllocator to test against this buffer allocator for equality.
-   * return Always true. Since the actual umpire allocator is a singleton, so any properly-typed
-   *        buffer can be deallocated from any properly-typed BufferAllocator.
+   * @return True if the underlying umpire allocators are the same.
    */
-  bool operator==( const BufferAllocator & other )
+  bool operator==( const BufferAllocator & other ) const
   {
     return !operator!=( other );
   }
+private:
+  /**
+   * @brief Change the underlying umpire allocator.
+   * @param alloc The umpire allocator to use.
+   */
+  void setAllocator( umpire::Allocator alloc )
+  {
+    m_alloc_id = alloc.getId();
+    m_alloc = umpire::TypedAllocator< T >( alloc );
+  }
 };
 
 }
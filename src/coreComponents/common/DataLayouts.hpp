@@ -28,38 +28,38 @@ namespace geosx
 namespace nodes
 {
 
-#if defined( GEOSX_USE_CUDA )
+#if defined( GEOSX_USE_DEVICE )
 
-/// Node reference position permutation when using cuda.
+/// Node reference position permutation on device.
 using REFERENCE_POSITION_PERM = RAJA::PERM_JI;
 
-/// Node total displacement permutation when using cuda.
+/// Node total displacement permutation on device.
 using TOTAL_DISPLACEMENT_PERM = RAJA::PERM_JI;
 
-/// Node incremental displacement permutation when using cuda.
+/// Node incremental displacement permutation on device.
 using INCR_DISPLACEMENT_PERM = RAJA::PERM_JI;
 
-/// Node velocity permutation when using cuda.
+/// Node velocity permutation on device.
 using VELOCITY_PERM = RAJA::PERM_JI;
 
-/// Node acceleration permutation when using cuda.
+/// Node acceleration permutation on device.
 using ACCELERATION_PERM = RAJA::PERM_JI;
 
 #else
 
-/// Node reference position permutation when not using cuda.
+/// Node reference position permutation on host.
 using REFERENCE_POSITION_PERM = RAJA::PERM_IJ;
 
-/// Node total displacement permutation when not using cuda.
+/// Node total displacement permutation on host.
 using TOTAL_DISPLACEMENT_PERM = RAJA::PERM_IJ;
 
-/// Node incremental displacement permutation when not using cuda.
+/// Node incremental displacement permutation on host.
 using INCR_DISPLACEMENT_PERM = RAJA::PERM_IJ;
 
-/// Node velocity permutation when not using cuda.
+/// Node velocity permutation on host.
 using VELOCITY_PERM = RAJA::PERM_IJ;
 
-/// Node acceleration permutation when not using cuda.
+/// Node acceleration permutation on host.
 using ACCELERATION_PERM = RAJA::PERM_IJ;
 
 #endif
@@ -84,14 +84,14 @@ static constexpr int ACCELERATION_USD = LvArray::typeManipulation::getStrideOneD
 namespace cells
 {
 
-#if defined( GEOSX_USE_CUDA )
+#if defined( GEOSX_USE_DEVICE )
 
-/// Cell node map permutation when using cuda.
+/// Cell node map permutation on device.
 using NODE_MAP_PERMUTATION = RAJA::PERM_JI;
 
 #else
 
-/// Cell node map permutation when not using cuda.
+/// Cell node map permutation on host.
 using NODE_MAP_PERMUTATION = RAJA::PERM_IJ;
 
 #endif
@@ -104,20 +104,20 @@ static constexpr int NODE_MAP_USD = LvArray::typeManipulation::getStrideOneDimen
 namespace solid
 {
 
-#if defined( GEOSX_USE_CUDA )
+#if defined( GEOSX_USE_DEVICE )
 
-/// Constitutive model stress permutation when using cuda.
+/// Constitutive model stress permutation on device.
 using STRESS_PERMUTATION = RAJA::PERM_KJI;
 
-/// Constitutive model stiffness permutation when using cuda.
+/// Constitutive model stiffness permutation on device.
 using STIFFNESS_PERMUTATION = RAJA::PERM_KJI;
 
 #else
 
-/// Constitutive model stress permutation when not using cuda.
+/// Constitutive model stress permutation on host.
 using STRESS_PERMUTATION = RAJA::PERM_IJK;
 
-/// Constitutive model stiffness permutation when not using cuda.
+/// Constitutive model stiffness permutation on host.
 using STIFFNESS_PERMUTATION = RAJA::PERM_IJK;
 
 #endif
@@ -128,6 +128,18 @@ static constexpr int STRESS_USD = LvArray::typeManipulation::getStrideOneDimensi
 /// Constitutive model stiffness unit stride dimension.
 static constexpr int STIFFNESS_USD = LvArray::typeManipulation::getStrideOneDimension( STIFFNESS_PERMUTATION {} );
 
+#if defined( GEOSX_USE_SINGLE_PRECISION_SOLID_STATE )
+
+/// Constitutive model quadrature point state type, the state is updated in double precision.
+using STATE_TYPE = float;
+
+#else
+
+/// Constitutive model quadrature point state type.
+using STATE_TYPE = double;
+
+#endif
+
 } // namespace solid
 
 } // namespace geosx
@@ -0,0 +1,353 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file FlatContainers.hpp
+ */
+
+#ifndef GEOSX_COMMON_FLATCONTAINERS_HPP_
+#define GEOSX_COMMON_FLATCONTAINERS_HPP_
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace geosx
+{
+
+/**
+ * @class FlatSet
+ * @brief Host set stored as a sorted vector of unique values.
+ * @tparam T the type of the values
+ * @tparam COMPARE the strict weak ordering of the values
+ *
+ * The interface is the subset of std::set used by the topology algorithms. The values are contiguous,
+ * so that the small sets are searched and iterated without any pointer chasing, and clear() keeps the
+ * capacity, so that a set reused as scratch memory does not allocate once it has grown. The insertion and
+ * the removal of a value shift the following ones, and invalidate the iterators and references.
+ */
+template< typename T, typename COMPARE = std::less< T > >
+class FlatSet
+{
+public:
+
+  /// Type of the values
+  using value_type = T;
+  /// Type of the sizes
+  using size_type = typename std::vector< T >::size_type;
+  /// Type of the iterators, the values are never modified in place
+  using const_iterator = typename std::vector< T >::const_iterator;
+  /// Type of the iterators
+  using iterator = const_iterator;
+
+  /**
+   * @brief Get an iterator to the smallest value.
+   * @return the iterator
+   */
+  const_iterator begin() const
+  { return m_values.begin(); }
+
+  /**
+   * @brief Get an iterator past the largest value.
+   * @return the iterator
+   */
+  const_iterator end() const
+  { return m_values.end(); }
+
+  /**
+   * @brief Get the number of values.
+   * @return the number of values
+   */
+  size_type size() const
+  { return m_values.size(); }
+
+  /**
+   * @brief Check if the set is empty.
+   * @return true if the set has no value
+   */
+  bool empty() const
+  { return m_values.empty(); }
+
+  /**
+   * @brief Remove all the values, keeping the capacity.
+   */
+  void clear()
+  { m_values.clear(); }
+
+  /**
+   * @brief Reserve the memory for a number of values.
+   * @param[in] capacity the number of values
+   */
+  void reserve( size_type const capacity )
+  { m_values.reserve( capacity ); }
+
+  /**
+   * @brief Find a value.
+   * @param[in] value the value
+   * @return an iterator to the value, or end() if the set does not have it
+   */
+  const_iterator find( T const & value ) const
+  {
+    const_iterator const iter = lowerBound( value );
+    return ( iter != end() && !COMPARE()( value, *iter ) ) ? iter : end();
+  }
+
+  /**
+   * @brief Count the occurrences of a value.
+   * @param[in] value the value
+   * @return 1 if the set has the value, 0 otherwise
+   */
+  size_type count( T const & value ) const
+  { return find( value ) != end() ? 1 : 0; }
+
+  /**
+   * @brief Insert a value.
+   * @param[in] value the value
+   * @return an iterator to the value, and true if it was not in the set yet
+   */
+  std::pair< const_iterator, bool > insert( T const & value )
+  {
+    // the values inserted in increasing order are appended without a search
+    if( m_values.empty() || COMPARE()( m_values.back(), value ) )
+    {
+      m_values.push_back( value );
+      return { end() - 1, true };
+    }
+
+    const_iterator const iter = lowerBound( value );
+    if( !COMPARE()( value, *iter ) )
+    {
+      return { iter, false };
+    }
+    return { m_values.insert( iter, value ), true };
+  }
+
+  /**
+   * @brief Insert a range of values.
+   * @tparam ITER the type of the iterators
+   * @param[in] first an iterator to the first value
+   * @param[in] last an iterator past the last value
+   *
+   * The values are appended then merged in a single pass, instead of being inserted one by one.
+   */
+  template< typename ITER >
+  void insert( ITER const first, ITER const last )
+  {
+    size_type const oldSize = m_values.size();
+    m_values.insert( m_values.end(), first, last );
+
+    typename std::vector< T >::iterator const middle = m_values.begin() + oldSize;
+    if( !std::is_sorted( middle, m_values.end(), COMPARE() ) )
+    {
+      std::sort( middle, m_values.end(), COMPARE() );
+    }
+    std::inplace_merge( m_values.begin(), middle, m_values.end(), COMPARE() );
+    m_values.erase( std::unique( m_values.begin(), m_values.end(),
+                                 []( T const & a, T const & b ){ return !COMPARE()( a, b ) && !COMPARE()( b, a ); } ),
+                    m_values.end() );
+  }
+
+  /**
+   * @brief Remove a value.
+   * @param[in] value the value
+   * @return the number of removed values, 1 if the set had the value, 0 otherwise
+   */
+  size_type erase( T const & value )
+  {
+    const_iterator const iter = find( value );
+    if( iter == end() )
+    {
+      return 0;
+    }
+    m_values.erase( iter );
+    return 1;
+  }
+
+private:
+
+  /**
+   * @brief Get the first value not smaller than a value.
+   * @param[in] value the value
+   * @return an iterator to the first value not smaller than @p value
+   */
+  const_iterator lowerBound( T const & value ) const
+  { return std::lower_bound( m_values.begin(), m_values.end(), value, COMPARE() ); }
+
+  /// Sorted unique values
+  std::vector< T > m_values;
+};
+
+/**
+ * @class FlatMap
+ * @brief Host map stored as a vector of (key, value) pairs sorted by key.
+ * @tparam KEY the type of the keys
+ * @tparam VALUE the type of the values
+ *
+ * The interface is the subset of std::map used by the topology algorithms, with the same trade-offs as FlatSet:
+ * the lookups and iterations do not chase pointers and clear() keeps the capacity, but inserting or removing a key
+ * invalidates the iterators and the references to the values. The keys must not be modified through the iterators.
+ */
+template< typename KEY, typename VALUE >
+class FlatMap
+{
+public:
+
+  /// Type of the keys
+  using key_type = KEY;
+  /// Type of the values
+  using mapped_type = VALUE;
+  /// Type of the entries
+  using value_type = std::pair< KEY, VALUE >;
+  /// Type of the sizes
+  using size_type = typename std::vector< value_type >::size_type;
+  /// Type of the iterators
+  using iterator = typename std::vector< value_type >::iterator;
+  /// Type of the constant iterators
+  using const_iterator = typename std::vector< value_type >::const_iterator;
+
+  /**
+   * @brief Get an iterator to the entry of the smallest key.
+   * @return the iterator
+   */
+  iterator begin()
+  { return m_entries.begin(); }
+
+  /**
+   * @copydoc begin()
+   */
+  const_iterator begin() const
+  { return m_entries.begin(); }
+
+  /**
+   * @brief Get an iterator past the entry of the largest key.
+   * @return the iterator
+   */
+  iterator end()
+  { return m_entries.end(); }
+
+  /**
+   * @copydoc end()
+   */
+  const_iterator end() const
+  { return m_entries.end(); }
+
+  /**
+   * @brief Get the number of entries.
+   * @return the number of entries
+   */
+  size_type size() const
+  { return m_entries.size(); }
+
+  /**
+   * @brief Check if the map is empty.
+   * @return true if the map has no entry
+   */
+  bool empty() const
+  { return m_entries.empty(); }
+
+  /**
+   * @brief Remove all the entries, keeping the capacity.
+   */
+  void clear()
+  { m_entries.clear(); }
+
+  /**
+   * @brief Find the entry of a key.
+   * @param[in] key the key
+   * @return an iterator to the entry, or end() if the map does not have the key
+   */
+  iterator find( KEY const & key )
+  {
+    iterator const iter = lowerBound( m_entries, key );
+    return ( iter != end() && !( key < iter->first ) ) ? iter : end();
+  }
+
+  /**
+   * @copydoc find( KEY const & )
+   */
+  const_iterator find( KEY const & key ) const
+  {
+    const_iterator const iter = lowerBound( m_entries, key );
+    return ( iter != end() && !( key < iter->first ) ) ? iter : end();
+  }
+
+  /**
+   * @brief Count the entries of a key.
+   * @param[in] key the key
+   * @return 1 if the map has the key, 0 otherwise
+   */
+  size_type count( KEY const & key ) const
+  { return find( key ) != end() ? 1 : 0; }
+
+  /**
+   * @brief Get the value of a key, inserting a default value if the map does not have the key.
+   * @param[in] key the key
+   * @return a reference to the value, valid until the next insertion or removal
+   */
+  VALUE & operator[]( KEY const & key )
+  {
+    if( m_entries.empty() || m_entries.back().first < key )
+    {
+      m_entries.emplace_back( key, VALUE() );
+      return m_entries.back().second;
+    }
+
+    iterator const iter = lowerBound( m_entries, key );
+    if( key < iter->first )
+    {
+      return m_entries.emplace( iter, key, VALUE() )->second;
+    }
+    return iter->second;
+  }
+
+  /**
+   * @brief Remove the entry of a key.
+   * @param[in] key the key
+   * @return the number of removed entries, 1 if the map had the key, 0 otherwise
+   */
+  size_type erase( KEY const & key )
+  {
+    iterator const iter = find( key );
+    if( iter == end() )
+    {
+      return 0;
+    }
+    m_entries.erase( iter );
+    return 1;
+  }
+
+private:
+
+  /**
+   * @brief Get the first entry whose key is not smaller than a key.
+   * @tparam ENTRIES the type of the entries, constant or not
+   * @param[in] entries the entries
+   * @param[in] key the key
+   * @return an iterator to the first entry whose key is not smaller than @p key
+   */
+  template< typename ENTRIES >
+  static auto lowerBound( ENTRIES & entries, KEY const & key ) -> decltype( entries.begin() )
+  {
+    return std::lower_bound( entries.begin(), entries.end(), key,
+                             []( value_type const & entry, KEY const & k ){ return entry.first < k; } );
+  }
+
+  /// Entries sorted by key
+  std::vector< value_type > m_entries;
+};
+
+} // namespace geosx
+
+#endif /* GEOSX_COMMON_FLATCONTAINERS_HPP_ */
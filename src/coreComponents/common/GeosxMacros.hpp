@@ -33,7 +33,7 @@
  */
 ///@{
 
-#if defined(__CUDACC__)
+#if defined(__CUDACC__) || defined(__HIPCC__)
 #define GEOSX_HOST __host__
 #define GEOSX_DEVICE __device__
 #define GEOSX_HOST_DEVICE __host__ __device__
@@ -52,6 +52,11 @@
 #define PRAGMA_UNROLL
 #endif
 
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+/// Defined in the device compilation pass of CUDA or HIP sources.
+#define GEOSX_DEVICE_COMPILE
+#endif
+
 ///@}
 
 /**
@@ -0,0 +1,222 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file HugePageAllocator.cpp
+ */
+
+#include "HugePageAllocator.hpp"
+
+#include "common/GeosxMacros.hpp"
+#include "common/Logger.hpp"
+
+#if defined( GEOSX_USE_CHAI ) && defined( __linux__ )
+#include <chai/ArrayManager.hpp>
+#include <umpire/ResourceManager.hpp>
+#include <umpire/strategy/AllocationStrategy.hpp>
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+#endif
+
+namespace geosx
+{
+
+#if defined( GEOSX_USE_CHAI ) && defined( __linux__ )
+
+namespace
+{
+
+/// The size of a huge page
+constexpr std::size_t hugePageSize = 2 * 1024 * 1024;
+
+/**
+ * @class HugePageStrategy
+ * @brief Umpire strategy allocating the large blocks on huge pages and forwarding the others.
+ */
+class HugePageStrategy : public umpire::strategy::AllocationStrategy
+{
+public:
+
+  /**
+   * @brief Constructor, called by umpire::ResourceManager::makeAllocator.
+   * @param name the name of the allocator
+   * @param id the id of the allocator
+   * @param allocator the allocator of the small blocks
+   * @param useExplicit whether the huge pages are mapped from the reserved ones
+   * @param minBytes the size from which a block uses huge pages
+   */
+  HugePageStrategy( std::string const & name,
+                    int const id,
+                    umpire::Allocator allocator,
+                    bool const useExplicit,
+                    std::size_t const minBytes ):
+    umpire::strategy::AllocationStrategy( name, id ),
+    m_allocator( allocator.getAllocationStrategy() ),
+    m_useExplicit( useExplicit ),
+    m_minBytes( minBytes )
+  {}
+
+  void * allocate( std::size_t const bytes ) override
+  {
+    if( bytes < m_minBytes )
+    {
+      return m_allocator->allocate( bytes );
+    }
+
+    std::size_t const mappedBytes = ( bytes + hugePageSize - 1 ) / hugePageSize * hugePageSize;
+    void * ptr = nullptr;
+    bool mapped = false;
+    if( m_useExplicit )
+    {
+      ptr = mmap( nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+      mapped = ( ptr != MAP_FAILED );
+      GEOSX_WARNING_IF( !mapped && !m_warnedFallback.exchange( true ),
+                        "No huge page left for an allocation of " << mappedBytes << " bytes, using transparent huge pages" );
+    }
+    if( !mapped )
+    {
+      ptr = nullptr;
+      GEOSX_ERROR_IF_NE_MSG( posix_memalign( &ptr, hugePageSize, mappedBytes ), 0,
+                             "Could not allocate " << mappedBytes << " bytes aligned on huge pages" );
+      // only a hint, the kernel may not grant it
+      madvise( ptr, mappedBytes, MADV_HUGEPAGE );
+    }
+
+    std::lock_guard< std::mutex > lock( m_mutex );
+    m_blocks[ ptr ] = { mappedBytes, mapped };
+    m_currentSize += mappedBytes;
+    m_highWatermark = std::max( m_highWatermark, m_currentSize );
+    return ptr;
+  }
+
+  void deallocate( void * const ptr ) override
+  {
+    Block block;
+    {
+      std::lock_guard< std::mutex > lock( m_mutex );
+      auto const it = m_blocks.find( ptr );
+      if( it == m_blocks.end() )
+      {
+        m_allocator->deallocate( ptr );
+        return;
+      }
+      block = it->second;
+      m_blocks.erase( it );
+      m_currentSize -= block.bytes;
+    }
+
+    if( block.mapped )
+    {
+      munmap( ptr, block.bytes );
+    }
+    else
+    {
+      std::free( ptr );
+    }
+  }
+
+  std::size_t getCurrentSize() const noexcept override
+  {
+    std::lock_guard< std::mutex > lock( m_mutex );
+    return m_currentSize + m_allocator->getCurrentSize();
+  }
+
+  std::size_t getHighWatermark() const noexcept override
+  {
+    std::lock_guard< std::mutex > lock( m_mutex );
+    return m_highWatermark + m_allocator->getHighWatermark();
+  }
+
+  umpire::Platform getPlatform() noexcept override
+  {
+    return m_allocator->getPlatform();
+  }
+
+  umpire::MemoryResourceTraits getTraits() const noexcept override
+  {
+    return m_allocator->getTraits();
+  }
+
+private:
+
+  /// A block on huge pages
+  struct Block
+  {
+    /// The size of the block, a whole number of huge pages
+    std::size_t bytes;
+    /// Whether the block is mapped from the reserved huge pages or aligned on the heap
+    bool mapped;
+  };
+
+  /// The strategy of the small blocks
+  umpire::strategy::AllocationStrategy * const m_allocator;
+
+  /// Whether the huge pages are mapped from the reserved ones
+  bool const m_useExplicit;
+
+  /// The size from which a block uses huge pages
+  std::size_t const m_minBytes;
+
+  /// Whether the fall back to transparent huge pages has been reported
+  std::atomic< bool > m_warnedFallback{ false };
+
+  /// Protects the blocks, the allocations may come from several threads
+  mutable std::mutex m_mutex;
+
+  /// The blocks on huge pages
+  std::unordered_map< void *, Block > m_blocks;
+
+  /// The size of the blocks on huge pages
+  std::size_t m_currentSize = 0;
+
+  /// The largest size of the blocks on huge pages
+  std::size_t m_highWatermark = 0;
+};
+
+} // namespace
+
+void setupHugePageAllocator( std::string const & mode, std::size_t const minBytes )
+{
+  GEOSX_ERROR_IF( mode != "transparent" && mode != "explicit",
+                  "Unknown huge page mode " << mode << ", expected transparent or explicit" );
+
+  chai::ArrayManager & arrayManager = *chai::ArrayManager::getInstance();
+  umpire::ResourceManager & rm = umpire::ResourceManager::getInstance();
+
+  std::string const name = "HOST_HUGE_PAGES";
+  if( !rm.isAllocator( name ) )
+  {
+    rm.makeAllocator< HugePageStrategy >( name, arrayManager.getAllocator( chai::CPU ), mode == "explicit", minBytes );
+  }
+  arrayManager.setAllocator( chai::CPU, rm.getAllocator( name ) );
+
+  GEOSX_LOG_RANK_0( "Host allocations of at least " << minBytes << " bytes on " << mode << " huge pages" );
+}
+
+#else
+
+void setupHugePageAllocator( std::string const & mode, std::size_t const GEOSX_UNUSED_PARAM( minBytes ) )
+{
+  GEOSX_WARNING( "The " << mode << " huge pages need CHAI on Linux, the default host allocator is kept" );
+}
+
+#endif
+
+}
@@ -0,0 +1,47 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file HugePageAllocator.hpp
+ */
+
+#ifndef GEOSX_COMMON_HUGEPAGEALLOCATOR_HPP
+#define GEOSX_COMMON_HUGEPAGEALLOCATOR_HPP
+
+#include "common/GeosxConfig.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace geosx
+{
+
+/**
+ * @brief Back the large host allocations of the arrays with 2 MB huge pages.
+ * @param mode @c transparent to align the allocations and advise the kernel to use transparent
+ *             huge pages, @c explicit to map them from the huge pages reserved on the node
+ * @param minBytes the size from which an allocation uses huge pages, the smaller ones keep
+ *                 the default host allocator
+ *
+ * The CHAI host allocator is replaced by an Umpire strategy routing the allocations
+ * of at least @p minBytes to huge pages, so that the arrays created afterwards, their
+ * reallocations and the memory pools built on top of the host allocator use it.
+ * The explicit mode falls back to transparent huge pages when no huge page is left.
+ * This has no effect without CHAI or outside of Linux.
+ */
+void setupHugePageAllocator( std::string const & mode, std::size_t const minBytes );
+
+}
+
+#endif
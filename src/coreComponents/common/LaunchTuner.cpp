@@ -0,0 +1,233 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file LaunchTuner.cpp
+ */
+
+#include "common/LaunchTuner.hpp"
+
+#include "common/Logger.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace geosx
+{
+
+namespace
+{
+
+/// The tuning of one tag and size
+struct Entry
+{
+  /// The chosen candidate, negative while tuning
+  integer winner = -1;
+
+  /// The number of timed launches
+  integer numLaunches = 0;
+
+  /// The fastest launch of each candidate
+  real64 bestTime[ LaunchTuner::numCandidates ] = { std::numeric_limits< real64 >::max(),
+                                                    std::numeric_limits< real64 >::max(),
+                                                    std::numeric_limits< real64 >::max(),
+                                                    std::numeric_limits< real64 >::max() };
+};
+
+/// An entry is identified by its tag and the order of magnitude of its size
+using EntryKey = std::pair< string, integer >;
+
+struct Tuning
+{
+  bool enabled = false;
+  string cacheFile;
+  std::map< EntryKey, Entry > entries;
+
+  /// The lines of the cache file for the other devices, written back unchanged
+  std::vector< string > otherDevices;
+};
+
+Tuning & getTuning()
+{
+  static Tuning tuning;
+  return tuning;
+}
+
+/**
+ * @brief Get the order of magnitude of a launch size.
+ * @param size the number of elements
+ * @return the base 2 logarithm of the size
+ */
+integer sizeBucket( localIndex const size )
+{
+  integer bucket = 0;
+  for( localIndex s = size; s > 1; s >>= 1 )
+  {
+    ++bucket;
+  }
+  return bucket;
+}
+
+/**
+ * @brief Get the candidate of a block size.
+ * @param blockSize the block size
+ * @return the candidate index, negative if the block size is not a candidate
+ */
+integer blockSizeCandidate( unsigned long const blockSize )
+{
+  for( integer c = 0; c < LaunchTuner::numCandidates; ++c )
+  {
+    if( LaunchTuner::candidateBlockSize( c ) == blockSize )
+    {
+      return c;
+    }
+  }
+  return -1;
+}
+
+} // namespace
+
+void LaunchTuner::setCacheFile( string const & fileName )
+{
+  Tuning & tuning = getTuning();
+  tuning.enabled = !fileName.empty();
+  tuning.cacheFile = fileName;
+  tuning.entries.clear();
+  tuning.otherDevices.clear();
+  if( !tuning.enabled )
+  {
+    return;
+  }
+
+  // Each line holds the device name, size bucket, block size and tag separated by tabs
+  std::ifstream file( fileName );
+  string line;
+  integer numCached = 0;
+  while( std::getline( file, line ) )
+  {
+    std::istringstream fields( line );
+    string device, bucket, blockSize, tag;
+    if( !std::getline( fields, device, '\t' ) || !std::getline( fields, bucket, '\t' ) ||
+        !std::getline( fields, blockSize, '\t' ) || !std::getline( fields, tag ) )
+    {
+      continue;
+    }
+
+    if( device != deviceName() )
+    {
+      tuning.otherDevices.push_back( line );
+      continue;
+    }
+
+    integer const candidate = blockSizeCandidate( std::stoul( blockSize ) );
+    if( candidate >= 0 )
+    {
+      tuning.entries[ EntryKey( tag, std::stoi( bucket ) ) ].winner = candidate;
+      ++numCached;
+    }
+  }
+
+  GEOSX_LOG_RANK_0( "Launch tuning: " << numCached << " cached launch configurations for device " << deviceName()
+                                      << " in " << fileName );
+}
+
+bool LaunchTuner::isEnabled()
+{
+  return getTuning().enabled;
+}
+
+void LaunchTuner::writeCache()
+{
+  Tuning const & tuning = getTuning();
+  if( !tuning.enabled || logger::internal::rank != 0 )
+  {
+    return;
+  }
+
+  std::ofstream file( tuning.cacheFile );
+  GEOSX_WARNING_IF( !file, "Launch tuning: could not write the cache file " << tuning.cacheFile );
+  for( string const & line : tuning.otherDevices )
+  {
+    file << line << '\n';
+  }
+  for( std::pair< EntryKey const, Entry > const & entry : tuning.entries )
+  {
+    if( entry.second.winner >= 0 )
+    {
+      file << deviceName() << '\t' << entry.first.second << '\t'
+           << candidateBlockSize( entry.second.winner ) << '\t' << entry.first.first << '\n';
+    }
+  }
+}
+
+string const & LaunchTuner::deviceName()
+{
+  static string const name = []()
+  {
+#if defined( GEOSX_USE_CUDA )
+    int device = 0;
+    cudaDeviceProp properties;
+    GEOSX_ERROR_IF_NE( cudaSuccess, cudaGetDevice( &device ) );
+    GEOSX_ERROR_IF_NE( cudaSuccess, cudaGetDeviceProperties( &properties, device ) );
+    return string( properties.name );
+#elif defined( GEOSX_USE_HIP )
+    int device = 0;
+    hipDeviceProp_t properties;
+    GEOSX_ERROR_IF_NE( hipSuccess, hipGetDevice( &device ) );
+    GEOSX_ERROR_IF_NE( hipSuccess, hipGetDeviceProperties( &properties, device ) );
+    return string( properties.name );
+#else
+    return string( "host" );
+#endif
+  }();
+  return name;
+}
+
+integer LaunchTuner::selectCandidate( string const & tag, localIndex const size, bool & timed )
+{
+  Entry & entry = getTuning().entries[ EntryKey( tag, sizeBucket( size ) ) ];
+  timed = entry.winner < 0;
+  return timed ? entry.numLaunches % numCandidates : entry.winner;
+}
+
+void LaunchTuner::recordTiming( string const & tag, localIndex const size, integer const candidate, real64 const seconds )
+{
+  integer const bucket = sizeBucket( size );
+  Entry & entry = getTuning().entries[ EntryKey( tag, bucket ) ];
+  entry.bestTime[ candidate ] = std::min( entry.bestTime[ candidate ], seconds );
+  ++entry.numLaunches;
+
+  if( entry.numLaunches == numCandidates * numTrialsPerCandidate )
+  {
+    entry.winner = LvArray::integerConversion< integer >( std::min_element( entry.bestTime, entry.bestTime + numCandidates ) - entry.bestTime );
+    GEOSX_LOG_RANK_0( "Launch tuning: block size " << candidateBlockSize( entry.winner ) << " for 2^" << bucket
+                                                   << " elements of " << tag );
+  }
+}
+
+void LaunchTuner::synchronizeDevice()
+{
+#if defined( GEOSX_USE_CUDA )
+  GEOSX_ERROR_IF_NE( cudaSuccess, cudaDeviceSynchronize() );
+#elif defined( GEOSX_USE_HIP )
+  GEOSX_ERROR_IF_NE( hipSuccess, hipDeviceSynchronize() );
+#endif
+}
+
+} // namespace geosx
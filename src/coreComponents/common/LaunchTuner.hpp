@@ -0,0 +1,195 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file LaunchTuner.hpp
+ */
+
+#ifndef GEOSX_COMMON_LAUNCHTUNER_HPP_
+#define GEOSX_COMMON_LAUNCHTUNER_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/Stopwatch.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+namespace geosx
+{
+
+/**
+ * @class LaunchTuner
+ *
+ * Chooses the block size of device kernel launches at run time. Each launch is identified by a tag (the kernel
+ * type) and the order of magnitude of its number of elements. The first launches of a tag and size are spread
+ * over the candidate block sizes and timed, after which the fastest candidate is used for all the subsequent
+ * launches.
+ *
+ * The winners are persisted to a cache file keyed by the name of the device, read at startup so that later runs
+ * on the same device skip the tuning. Nothing is tuned unless a cache file is given (--launch-tuning), and
+ * host policies are always launched as requested.
+ */
+class LaunchTuner
+{
+public:
+
+  /// The number of candidate block sizes
+  static constexpr integer numCandidates = 4;
+
+  /// The number of timed launches of each candidate before choosing the fastest one
+  static constexpr integer numTrialsPerCandidate = 3;
+
+  /**
+   * @brief Get the block size of a candidate.
+   * @param candidate the candidate index
+   * @return the block size, from 1 to 8 warps (32 to 256 threads with CUDA, 64 to 512 with HIP):
+   *         larger blocks may exceed the register file with the heaviest kernels
+   */
+  static constexpr unsigned long candidateBlockSize( integer const candidate )
+  {
+    return deviceWarpSize << candidate;
+  }
+
+  /**
+   * @brief Enable the tuning, and read the winners of previous runs on this device from a cache file.
+   * @param fileName the name of the cache file, the tuning is disabled if empty
+   */
+  static void setCacheFile( string const & fileName );
+
+  /**
+   * @brief Get whether the launches are tuned.
+   * @return true if the launches are tuned
+   */
+  static bool isEnabled();
+
+  /**
+   * @brief Write the winners of the run to the cache file on rank 0, keeping the entries of the other devices.
+   */
+  static void writeCache();
+
+  /**
+   * @brief Get the name of the device the launches are tuned for.
+   * @return the device name, "host" if the launches run on the host
+   */
+  static string const & deviceName();
+
+  /**
+   * @brief Choose the candidate of a launch.
+   * @param tag the tag of the launch
+   * @param size the number of elements of the launch
+   * @param timed set to true if the launch is part of the tuning and must be timed
+   * @return the candidate index
+   */
+  static integer selectCandidate( string const & tag, localIndex const size, bool & timed );
+
+  /**
+   * @brief Record the duration of a timed launch.
+   * @param tag the tag of the launch
+   * @param size the number of elements of the launch
+   * @param candidate the candidate index of the launch
+   * @param seconds the duration of the launch
+   */
+  static void recordTiming( string const & tag, localIndex const size, integer const candidate, real64 const seconds );
+
+  /**
+   * @brief Launch a kernel with the policy chosen for its tag and size.
+   * @tparam POLICY the policy requested by the caller, used as is if it is not a device policy or if the tuning
+   *   is disabled
+   * @tparam LAMBDA the type of the launch
+   * @param tag the tag of the launch
+   * @param size the number of elements of the launch
+   * @param lambda the launch, called with a default constructed policy object, which must return a value
+   * @return the value returned by @p lambda
+   */
+  template< typename POLICY, typename LAMBDA >
+  static auto launch( string const & tag, localIndex const size, LAMBDA && lambda )
+  {
+    return launchImpl< POLICY >( std::integral_constant< bool, isDevicePolicy< POLICY > >{}, tag, size, lambda );
+  }
+
+private:
+
+  /**
+   * @brief Wait for the completion of the device kernels.
+   */
+  static void synchronizeDevice();
+
+  /**
+   * @brief Launch a kernel with a host policy, which is not tuned.
+   * @tparam POLICY the policy requested by the caller
+   * @tparam LAMBDA the type of the launch
+   * @param lambda the launch
+   * @return the value returned by @p lambda
+   */
+  template< typename POLICY, typename LAMBDA >
+  static auto launchImpl( std::false_type, string const &, localIndex const, LAMBDA && lambda )
+  {
+    return lambda( POLICY{} );
+  }
+
+  /**
+   * @brief Launch a kernel with a device policy, tuning its block size if enabled.
+   * @tparam POLICY the policy requested by the caller
+   * @tparam LAMBDA the type of the launch
+   * @param tag the tag of the launch
+   * @param size the number of elements of the launch
+   * @param lambda the launch
+   * @return the value returned by @p lambda
+   */
+  template< typename POLICY, typename LAMBDA >
+  static auto launchImpl( std::true_type, string const & tag, localIndex const size, LAMBDA && lambda )
+  {
+    if( !isEnabled() )
+    {
+      return lambda( POLICY{} );
+    }
+
+    bool timed = false;
+    integer const candidate = selectCandidate( tag, size, timed );
+    if( timed )
+    {
+      synchronizeDevice();
+    }
+
+    Stopwatch watch;
+    auto result = launchCandidate( candidate, lambda );
+    if( timed )
+    {
+      synchronizeDevice();
+      recordTiming( tag, size, candidate, watch.elapsedTime() );
+    }
+    return result;
+  }
+
+  /**
+   * @brief Launch a kernel with the device policy of a candidate.
+   * @tparam LAMBDA the type of the launch
+   * @param candidate the candidate index
+   * @param lambda the launch
+   * @return the value returned by @p lambda
+   */
+  template< typename LAMBDA >
+  static auto launchCandidate( integer const candidate, LAMBDA && lambda )
+  {
+    switch( candidate )
+    {
+      case 0: return lambda( parallelDevicePolicy< candidateBlockSize( 0 ) >{} );
+      case 1: return lambda( parallelDevicePolicy< candidateBlockSize( 1 ) >{} );
+      case 2: return lambda( parallelDevicePolicy< candidateBlockSize( 2 ) >{} );
+      default: return lambda( parallelDevicePolicy< candidateBlockSize( 3 ) >{} );
+    }
+  }
+};
+
+} // namespace geosx
+
+#endif //GEOSX_COMMON_LAUNCHTUNER_HPP_
@@ -18,14 +18,230 @@
 
 // Source includes
 #include "common/Logger.hpp"
+#include "common/MessageQueue.hpp"
 #include "common/Path.hpp"
 
+// System includes
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 namespace geosx
 {
 
 namespace logger
 {
 
+namespace
+{
+
+/// How the rank messages are written
+enum class RankOutput
+{
+  /// Immediately, on the rank stream
+  Direct,
+  /// By a background thread, on the rank file
+  Files,
+  /// By rank 0, once for the identical messages of all ranks, on FlushRankMessages()
+  Aggregated
+};
+
+/// Maximum number of rank ranges listed in front of an aggregated message
+constexpr std::size_t maxListedRankRanges = 8;
+
+/// Current output of the rank messages
+RankOutput rankOutput = RankOutput::Direct;
+
+/// Messages logged but not written yet, unless the output is direct
+std::unique_ptr< MessageQueue > rankMessages;
+
+/// Aggregated messages moved out of the full queue, kept until the next flush
+std::vector< std::string > overflowMessages;
+
+/// Protects overflowMessages
+std::mutex overflowMutex;
+
+/// Protects the rank file, written by the background thread and by FlushLocalRankMessages()
+std::mutex rankFileMutex;
+
+/// Thread writing the rank file
+std::thread rankFileWriter;
+
+/// Whether the writer has to stop once the queue is drained
+std::atomic< bool > stopRankFileWriter{ false };
+
+/// Protects the wait of the writer
+std::mutex rankFileWriterMutex;
+
+/// Signaled to wake the writer up when the queue fills up or the writer stops
+std::condition_variable wakeRankFileWriter;
+
+/**
+ * @brief Write the queued messages to the rank stream.
+ */
+void writeQueuedMessages()
+{
+  std::lock_guard< std::mutex > lock( rankFileMutex );
+  std::string message;
+  bool wrote = false;
+  while( rankMessages->pop( message ) )
+  {
+    *internal::rankStream << message << '\n';
+    wrote = true;
+  }
+
+  if( wrote )
+  {
+    internal::rankStream->flush();
+  }
+}
+
+/**
+ * @brief Write the rank file until the logger is finalized, waking up regularly or when the queue fills up.
+ */
+void runRankFileWriter()
+{
+  while( true )
+  {
+    // read the flag first, so that the messages queued before the stop are written
+    bool const stop = stopRankFileWriter.load( std::memory_order_acquire );
+    writeQueuedMessages();
+    if( stop )
+    {
+      return;
+    }
+
+    std::unique_lock< std::mutex > lock( rankFileWriterMutex );
+    wakeRankFileWriter.wait_for( lock, std::chrono::milliseconds( 50 ) );
+  }
+}
+
+/**
+ * @brief Move the queued aggregated messages to overflowMessages, to make room in the queue.
+ */
+void moveQueuedMessages()
+{
+  std::lock_guard< std::mutex > lock( overflowMutex );
+  std::string message;
+  while( rankMessages->pop( message ) )
+  {
+    overflowMessages.emplace_back( std::move( message ) );
+  }
+}
+
+/**
+ * @brief Take the aggregated messages logged on this rank since the last flush, in order.
+ * @return the messages
+ */
+std::vector< std::string > takeAggregatedMessages()
+{
+  moveQueuedMessages();
+  std::lock_guard< std::mutex > lock( overflowMutex );
+  std::vector< std::string > messages;
+  messages.swap( overflowMessages );
+  return messages;
+}
+
+/**
+ * @brief Print the distinct messages of all the ranks, each with the ranks that logged it.
+ * @param buffer the messages of all the ranks, each terminated by a null character
+ * @param offsets the offset of the messages of each rank in @p buffer, plus the size of @p buffer
+ */
+void printAggregatedMessages( std::string const & buffer, std::vector< int > const & offsets )
+{
+  // a message logged several times by a rank is a distinct message for each occurrence
+  std::vector< std::pair< std::string, std::vector< int > > > messages;
+  std::unordered_map< std::string, std::size_t > messageIndices;
+  for( std::size_t rank = 0; rank + 1 < offsets.size(); ++rank )
+  {
+    std::unordered_map< std::string, int > occurrences;
+    std::size_t begin = offsets[ rank ];
+    while( begin < static_cast< std::size_t >( offsets[ rank + 1 ] ) )
+    {
+      std::size_t const end = buffer.find( '\0', begin );
+      std::string message = buffer.substr( begin, end - begin );
+      begin = end + 1;
+
+      std::string key = std::to_string( occurrences[ message ]++ ) + '\0' + message;
+      auto const inserted = messageIndices.emplace( std::move( key ), messages.size() );
+      if( inserted.second )
+      {
+        messages.emplace_back( std::move( message ), std::vector< int >() );
+      }
+      messages[ inserted.first->second ].second.push_back( static_cast< int >( rank ) );
+    }
+  }
+
+  std::ostringstream oss;
+  for( auto const & message : messages )
+  {
+    oss << "Rank " << internal::formatRankRanges( message.second ) << ": " << message.first << '\n';
+  }
+  std::cout << oss.str() << std::flush;
+}
+
+/**
+ * @brief Stop the writer, write the queued messages of this rank directly and restore the direct output.
+ */
+void resetRankOutput()
+{
+  if( rankFileWriter.joinable() )
+  {
+    stopRankFileWriter.store( true, std::memory_order_release );
+    wakeRankFileWriter.notify_one();
+    rankFileWriter.join();
+    stopRankFileWriter.store( false, std::memory_order_relaxed );
+  }
+
+  FlushLocalRankMessages();
+
+  if( internal::rankStream != nullptr && internal::rankStream != &std::cout )
+  {
+    delete internal::rankStream;
+  }
+
+  internal::rankStream = nullptr;
+  rankMessages.reset();
+  rankOutput = RankOutput::Direct;
+}
+
+/**
+ * @brief Set up the output of the rank messages, once the rank is known.
+ * @param rankOutputDir output directory for rank log files, the file name uses @p fileRank
+ * @param aggregateRanks whether the rank messages are aggregated
+ * @param fileRank the rank in the name of the rank file, unique over all the processes
+ */
+void setupRankOutput( std::string const & rankOutputDir, bool const aggregateRanks, int const fileRank )
+{
+  GEOSX_ERROR_IF( aggregateRanks && rankOutputDir != "", "The rank messages are either aggregated or written to rank files" );
+
+  if( rankOutputDir != "" )
+  {
+    std::string outputFilePath = rankOutputDir + "/rank_" + std::to_string( fileRank ) + ".out";
+    internal::rankStream = new std::ofstream( outputFilePath );
+    rankMessages.reset( new MessageQueue() );
+    rankOutput = RankOutput::Files;
+    rankFileWriter = std::thread( runRankFileWriter );
+  }
+  else
+  {
+    internal::rankStream = &std::cout;
+    if( aggregateRanks )
+    {
+      rankMessages.reset( new MessageQueue() );
+      rankOutput = RankOutput::Aggregated;
+    }
+  }
+}
+
+} // namespace
+
 namespace internal
 {
 
@@ -40,12 +256,75 @@ std::ostream * rankStream = nullptr;
 MPI_Comm comm;
 #endif
 
+void logRankMessage( std::string message )
+{
+  switch( rankOutput )
+  {
+    case RankOutput::Direct:
+    {
+      *rankStream << "Rank " << rankString << ": " << message << std::endl;
+    }
+    break;
+    case RankOutput::Files:
+    {
+      message = "Rank " + rankString + ": " + message;
+      while( !rankMessages->push( message ) )
+      {
+        wakeRankFileWriter.notify_one();
+        std::this_thread::yield();
+      }
+    }
+    break;
+    case RankOutput::Aggregated:
+    {
+      while( !rankMessages->push( message ) )
+      {
+        moveQueuedMessages();
+      }
+    }
+    break;
+  }
+}
+
+std::string formatRankRanges( std::vector< int > const & ranks )
+{
+  std::ostringstream oss;
+  std::size_t numRanges = 0;
+  for( std::size_t i = 0; i < ranks.size(); )
+  {
+    std::size_t j = i + 1;
+    while( j < ranks.size() && ranks[ j ] == ranks[ j - 1 ] + 1 )
+    {
+      ++j;
+    }
+
+    if( numRanges == maxListedRankRanges )
+    {
+      oss << " and " << ranks.size() - i << " more";
+      break;
+    }
+
+    oss << ( numRanges > 0 ? ", " : "" ) << ranks[ i ];
+    if( j - i > 1 )
+    {
+      oss << "-" << ranks[ j - 1 ];
+    }
+
+    ++numRanges;
+    i = j;
+  }
+
+  return oss.str();
+}
+
 } // namespace internal
 
 #ifdef GEOSX_USE_MPI
 
-void InitializeLogger( MPI_Comm mpi_comm, const std::string & rankOutputDir )
+void InitializeLogger( MPI_Comm mpi_comm, const std::string & rankOutputDir, bool const aggregateRanks )
 {
+  resetRankOutput();
+
   internal::comm = mpi_comm;
   MPI_Comm_rank( mpi_comm, &internal::rank );
   MPI_Comm_size( mpi_comm, &internal::n_ranks );
@@ -60,40 +339,97 @@ void InitializeLogger( MPI_Comm mpi_comm, const std::string & rankOutputDir )
     }
 
     MPI_Barrier( mpi_comm );
-    std::string outputFilePath = rankOutputDir + "/rank_" + internal::rankString + ".out";
-    internal::rankStream = new std::ofstream( outputFilePath );
-  }
-  else
-  {
-    internal::rankStream = &std::cout;
   }
+
+  // the communicator may be a subset of the processes, the files are named after the global rank
+  int worldRank = 0;
+  MPI_Comm_rank( MPI_COMM_WORLD, &worldRank );
+  setupRankOutput( rankOutputDir, aggregateRanks, worldRank );
 }
 
 #endif
 
-void InitializeLogger( const std::string & rankOutputDir )
+void InitializeLogger( const std::string & rankOutputDir, bool const aggregateRanks )
 {
+  resetRankOutput();
+
   if( rankOutputDir != "" )
   {
     makeDirsForPath( rankOutputDir );
+  }
 
-    std::string outputFilePath = rankOutputDir + "/rank_" + internal::rankString + ".out";
-    internal::rankStream = new std::ofstream( outputFilePath );
+  setupRankOutput( rankOutputDir, aggregateRanks, internal::rank );
+}
+
+void FlushRankMessages()
+{
+  if( rankOutput != RankOutput::Aggregated )
+  {
+    return;
   }
-  else
+
+  std::string buffer;
+  for( std::string const & message : takeAggregatedMessages() )
   {
-    internal::rankStream = &std::cout;
+    buffer += message;
+    buffer += '\0';
+  }
+
+#ifdef GEOSX_USE_MPI
+  // skip the gather when no rank logged anything, which is the common case
+  int const hasMessages = !buffer.empty();
+  int anyMessages = 0;
+  MPI_Allreduce( &hasMessages, &anyMessages, 1, MPI_INT, MPI_MAX, internal::comm );
+  if( anyMessages == 0 )
+  {
+    return;
   }
+
+  int const size = static_cast< int >( buffer.size() );
+  std::vector< int > sizes( internal::rank == 0 ? internal::n_ranks : 0 );
+  MPI_Gather( &size, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0, internal::comm );
+
+  std::vector< int > offsets( internal::rank == 0 ? internal::n_ranks + 1 : 0, 0 );
+  for( std::size_t i = 0; i < sizes.size(); ++i )
+  {
+    offsets[ i + 1 ] = offsets[ i ] + sizes[ i ];
+  }
+
+  std::string allMessages( internal::rank == 0 ? offsets.back() : 0, '\0' );
+  MPI_Gatherv( &buffer[ 0 ], size, MPI_CHAR, &allMessages[ 0 ], sizes.data(), offsets.data(), MPI_CHAR, 0, internal::comm );
+
+  if( internal::rank == 0 )
+  {
+    printAggregatedMessages( allMessages, offsets );
+  }
+#else
+  if( !buffer.empty() )
+  {
+    printAggregatedMessages( buffer, { 0, static_cast< int >( buffer.size() ) } );
+  }
+#endif
 }
 
-void FinalizeLogger()
+void FlushLocalRankMessages()
 {
-  if( internal::rankStream != &std::cout )
+  if( rankOutput == RankOutput::Files )
   {
-    delete internal::rankStream;
+    writeQueuedMessages();
+  }
+  else if( rankOutput == RankOutput::Aggregated )
+  {
+    for( std::string const & message : takeAggregatedMessages() )
+    {
+      *internal::rankStream << "Rank " << internal::rankString << ": " << message << '\n';
+    }
+    internal::rankStream->flush();
   }
+}
 
-  internal::rankStream = nullptr;
+void FinalizeLogger()
+{
+  FlushRankMessages();
+  resetRankOutput();
 }
 
 } // namespace logger
@@ -28,6 +28,10 @@
   #include <mpi.h>
 #endif
 
+#include <sstream>
+#include <string>
+#include <vector>
+
 /**
  * @brief Log a message on screen.
  * @details The expression to log must evaluate something that can be stream inserted.
@@ -63,6 +67,8 @@
 
 /**
  * @brief Conditionally log a message to the rank output stream.
+ * @details Depending on how the logger was initialized the message is written immediately, queued for the
+ *          thread writing the rank file, or queued until the next call to FlushRankMessages().
  * @param EXP an expression that will be evaluated as a predicate
  * @param msg a message to log (any expression that can be stream inserted)
  */
@@ -71,8 +77,8 @@
     if( EXP ) \
     { \
       std::ostringstream oss; \
-      oss << "Rank " << ::geosx::logger::internal::rankString << ": " << msg; \
-      *logger::internal::rankStream << oss.str() << std::endl; \
+      oss << msg; \
+      ::geosx::logger::internal::logRankMessage( oss.str() ); \
     } \
   } while( false )
 
@@ -345,25 +351,55 @@ extern std::ostream * rankStream;
 #if defined(GEOSX_USE_MPI)
 extern MPI_Comm comm;
 #endif
+
+/**
+ * @brief Write or queue a message of this rank, see GEOSX_LOG_RANK_IF.
+ * @param message the message, without the rank prefix
+ */
+void logRankMessage( std::string message );
+
+/**
+ * @brief Format a list of ranks as ranges, for instance "0-3, 8, 10-11".
+ * @param ranks the ranks, sorted in increasing order
+ * @return the formatted ranks, the ranges after the first few are only counted
+ */
+std::string formatRankRanges( std::vector< int > const & ranks );
+
 } // namespace internal
 
 #if defined(GEOSX_USE_MPI)
 /**
  * @brief Initialize the logger in a parallel build.
  * @param comm global MPI communicator
- * @param rank_output_dir output directory for rank log files
+ * @param rank_output_dir output directory for rank log files, written by a background thread
+ * @param aggregateRanks if true, the rank messages are queued and the identical messages of
+ *        all the ranks are printed once by rank 0 on each call to FlushRankMessages()
  */
-void InitializeLogger( MPI_Comm comm, const std::string & rank_output_dir="" );
+void InitializeLogger( MPI_Comm comm, const std::string & rank_output_dir="", bool aggregateRanks=false );
 #endif
 
 /**
  * @brief Initialize the logger in a serial build.
- * @param rank_output_dir output directory for rank log files
+ * @param rank_output_dir output directory for rank log files, written by a background thread
+ * @param aggregateRanks if true, the rank messages are queued until the next call to FlushRankMessages()
+ */
+void InitializeLogger( const std::string & rank_output_dir="", bool aggregateRanks=false );
+
+/**
+ * @brief Print the rank messages queued since the last call, each distinct message once with the list of
+ *        the ranks that logged it. Does nothing unless the rank messages are aggregated.
+ * @note This is collective over the communicator of the logger.
+ */
+void FlushRankMessages();
+
+/**
+ * @brief Write the rank messages queued on this rank without waiting for the other ranks, before an abort.
  */
-void InitializeLogger( const std::string & rank_output_dir="" );
+void FlushLocalRankMessages();
 
 /**
- * @brief Finalize the logger and close the rank streams.
+ * @brief Finalize the logger, print the queued rank messages and close the rank streams.
+ * @note This is collective over the communicator of the logger when the rank messages are aggregated.
  */
 void FinalizeLogger();
 
@@ -0,0 +1,184 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MessageQueue.hpp
+ */
+
+#ifndef GEOSX_COMMON_MESSAGEQUEUE_HPP_
+#define GEOSX_COMMON_MESSAGEQUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace geosx
+{
+
+/**
+ * @class MessageQueue
+ * @brief Bounded lock-free queue of strings, for any number of producer and consumer threads.
+ *
+ * The queue is a ring buffer in which each slot holds a sequence number telling whether it is free for the
+ * producer or full for the consumer of a given position, so that a thread only claims a position with a
+ * compare-and-swap and never waits on another one. push() and pop() fail instead of blocking when the queue
+ * is full or empty, the caller decides whether to drain the queue, wait or give up.
+ */
+class MessageQueue
+{
+public:
+
+  /**
+   * @brief Construct an empty queue.
+   * @param capacity the maximum number of messages, rounded up to a power of two
+   */
+  explicit MessageQueue( std::size_t const capacity = 1024 ):
+    m_mask( roundUpToPowerOfTwo( capacity ) - 1 ),
+    m_slots( new Slot[ m_mask + 1 ] )
+  {
+    for( std::size_t i = 0; i <= m_mask; ++i )
+    {
+      m_slots[ i ].sequence.store( i, std::memory_order_relaxed );
+    }
+  }
+
+  MessageQueue( MessageQueue const & ) = delete;
+  MessageQueue & operator=( MessageQueue const & ) = delete;
+
+  /**
+   * @brief Get the maximum number of messages.
+   * @return the capacity
+   */
+  std::size_t capacity() const
+  { return m_mask + 1; }
+
+  /**
+   * @brief Append a message, unless the queue is full.
+   * @param message the message, moved from on success only
+   * @return true if the message was queued
+   */
+  bool push( std::string & message )
+  {
+    std::size_t position = m_pushPosition.load( std::memory_order_relaxed );
+    Slot * slot;
+    while( true )
+    {
+      slot = &m_slots[ position & m_mask ];
+      std::size_t const sequence = slot->sequence.load( std::memory_order_acquire );
+      std::ptrdiff_t const difference = static_cast< std::ptrdiff_t >( sequence - position );
+      if( difference == 0 )
+      {
+        if( m_pushPosition.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+        {
+          break;
+        }
+      }
+      else if( difference < 0 )
+      {
+        // the slot still holds the message of the previous lap
+        return false;
+      }
+      else
+      {
+        position = m_pushPosition.load( std::memory_order_relaxed );
+      }
+    }
+
+    slot->message = std::move( message );
+    slot->sequence.store( position + 1, std::memory_order_release );
+    return true;
+  }
+
+  /**
+   * @brief Remove the oldest message, unless the queue is empty.
+   * @param message set to the message on success
+   * @return true if a message was removed
+   */
+  bool pop( std::string & message )
+  {
+    std::size_t position = m_popPosition.load( std::memory_order_relaxed );
+    Slot * slot;
+    while( true )
+    {
+      slot = &m_slots[ position & m_mask ];
+      std::size_t const sequence = slot->sequence.load( std::memory_order_acquire );
+      std::ptrdiff_t const difference = static_cast< std::ptrdiff_t >( sequence - ( position + 1 ) );
+      if( difference == 0 )
+      {
+        if( m_popPosition.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+        {
+          break;
+        }
+      }
+      else if( difference < 0 )
+      {
+        return false;
+      }
+      else
+      {
+        position = m_popPosition.load( std::memory_order_relaxed );
+      }
+    }
+
+    message = std::move( slot->message );
+    slot->message.clear();
+    slot->sequence.store( position + m_mask + 1, std::memory_order_release );
+    return true;
+  }
+
+private:
+
+  /**
+   * @brief A slot of the ring buffer.
+   */
+  struct Slot
+  {
+    /// Position the slot can be pushed at, or position plus one once it is full
+    std::atomic< std::size_t > sequence;
+    /// The message
+    std::string message;
+  };
+
+  /**
+   * @brief Round a capacity up to a power of two.
+   * @param capacity the capacity
+   * @return the smallest power of two not less than @p capacity, at least 2
+   */
+  static std::size_t roundUpToPowerOfTwo( std::size_t const capacity )
+  {
+    std::size_t result = 2;
+    while( result < capacity )
+    {
+      result *= 2;
+    }
+    return result;
+  }
+
+  /// Capacity minus one, to wrap the positions
+  std::size_t const m_mask;
+
+  /// The slots
+  std::unique_ptr< Slot[] > m_slots;
+
+  /// Next position to push at
+  std::atomic< std::size_t > m_pushPosition{ 0 };
+
+  /// Next position to pop from
+  std::atomic< std::size_t > m_popPosition{ 0 };
+};
+
+} // namespace geosx
+
+#endif /* GEOSX_COMMON_MESSAGEQUEUE_HPP_ */
@@ -0,0 +1,192 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file TaskGraph.cpp
+ */
+
+#include "common/TaskGraph.hpp"
+
+#include "common/Logger.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#if defined( GEOSX_USE_OPENMP )
+#include <omp.h>
+#endif
+
+namespace geosx
+{
+
+namespace
+{
+
+bool & concurrent()
+{
+  static bool value = false;
+  return value;
+}
+
+}
+
+void TaskGraph::setConcurrent( bool const value )
+{
+  concurrent() = value;
+}
+
+bool TaskGraph::isConcurrent()
+{
+#if defined( GEOSX_USE_OPENMP ) && !defined( GEOSX_USE_CUDA ) && !defined( GEOSX_USE_HIP )
+  return concurrent();
+#else
+  // the moves of the arrays between the memory spaces are not thread safe
+  return false;
+#endif
+}
+
+TaskGraph::TaskId TaskGraph::addTask( real64 const weight,
+                                      std::function< void() > task,
+                                      std::vector< TaskId > const & dependencies )
+{
+  TaskId const id = LvArray::integerConversion< TaskId >( m_tasks.size() );
+  for( TaskId const dependency : dependencies )
+  {
+    GEOSX_ERROR_IF( dependency < 0 || dependency >= id,
+                    "Task " << id << " depends on task " << dependency << ", which must be added before it" );
+  }
+  m_tasks.push_back( { std::max( weight, 0.0 ), std::move( task ), dependencies } );
+  return id;
+}
+
+void TaskGraph::execute()
+{
+  TaskId const numTasks = LvArray::integerConversion< TaskId >( m_tasks.size() );
+  std::vector< bool > done( numTasks, false );
+  TaskId numDone = 0;
+
+  std::vector< TaskId > wave;
+  while( numDone < numTasks )
+  {
+    // the dependencies come first, so the first task not done always starts a wave
+    wave.clear();
+    for( TaskId id = 0; id < numTasks; ++id )
+    {
+      if( !done[id] && std::all_of( m_tasks[id].dependencies.begin(),
+                                    m_tasks[id].dependencies.end(),
+                                    [&]( TaskId const dependency ) { return done[dependency]; } ) )
+      {
+        wave.push_back( id );
+      }
+    }
+
+    executeWave( wave );
+
+    for( TaskId const id : wave )
+    {
+      done[id] = true;
+    }
+    numDone += LvArray::integerConversion< TaskId >( wave.size() );
+  }
+
+  m_tasks.clear();
+}
+
+std::vector< integer > TaskGraph::splitThreads( std::vector< real64 > const & weights, integer const numThreads )
+{
+  integer const numTasks = LvArray::integerConversion< integer >( weights.size() );
+  std::vector< integer > shares( numTasks, 1 );
+  if( numTasks == 0 || numThreads <= numTasks )
+  {
+    return shares;
+  }
+
+  // the threads go to the tasks by largest remainder of their fraction, with at least one thread each
+  real64 const totalWeight = std::accumulate( weights.begin(), weights.end(), 0.0 );
+  std::vector< real64 > remainders( numTasks );
+  integer numGiven = 0;
+  for( integer i = 0; i < numTasks; ++i )
+  {
+    real64 const fraction = totalWeight > 0.0 ? numThreads * weights[i] / totalWeight : real64( numThreads ) / numTasks;
+    shares[i] = std::max( static_cast< integer >( fraction ), 1 );
+    remainders[i] = fraction - shares[i];
+    numGiven += shares[i];
+  }
+
+  std::vector< integer > order( numTasks );
+  std::iota( order.begin(), order.end(), 0 );
+  std::stable_sort( order.begin(), order.end(), [&]( integer const a, integer const b )
+  {
+    return remainders[a] > remainders[b];
+  } );
+  for( integer i = 0; numGiven < numThreads; ++i, ++numGiven )
+  {
+    ++shares[order[i]];
+  }
+
+  // the threads of the tasks raised to one thread are taken back from the largest shares
+  while( numGiven > numThreads )
+  {
+    --*std::max_element( shares.begin(), shares.end() );
+    --numGiven;
+  }
+
+  return shares;
+}
+
+void TaskGraph::executeWave( std::vector< TaskId > const & wave )
+{
+#if defined( GEOSX_USE_OPENMP )
+  integer const numThreads = omp_get_max_threads();
+  if( isConcurrent() && wave.size() > 1 && numThreads > 1 && !omp_in_parallel() )
+  {
+    // the heaviest tasks are started first
+    std::vector< TaskId > order( wave );
+    std::stable_sort( order.begin(), order.end(), [&]( TaskId const a, TaskId const b )
+    {
+      return m_tasks[a].weight > m_tasks[b].weight;
+    } );
+
+    std::vector< real64 > weights( order.size() );
+    for( std::size_t i = 0; i < order.size(); ++i )
+    {
+      weights[i] = m_tasks[order[i]].weight;
+    }
+    std::vector< integer > const shares = splitThreads( weights, numThreads );
+
+    // the host kernels of the tasks run on nested teams
+    int const maxActiveLevels = omp_get_max_active_levels();
+    omp_set_max_active_levels( std::max( maxActiveLevels, 2 ) );
+
+    int const numTasks = LvArray::integerConversion< int >( order.size() );
+    int const numConcurrent = std::min( numTasks, numThreads );
+    #pragma omp parallel for schedule( dynamic, 1 ) num_threads( numConcurrent )
+    for( int i = 0; i < numTasks; ++i )
+    {
+      omp_set_num_threads( shares[i] );
+      m_tasks[order[i]].run();
+    }
+
+    omp_set_max_active_levels( maxActiveLevels );
+    return;
+  }
+#endif
+
+  for( TaskId const id : wave )
+  {
+    m_tasks[id].run();
+  }
+}
+
+} // namespace geosx
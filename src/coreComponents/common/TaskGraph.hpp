@@ -0,0 +1,113 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file TaskGraph.hpp
+ */
+
+#ifndef GEOSX_COMMON_TASKGRAPH_HPP_
+#define GEOSX_COMMON_TASKGRAPH_HPP_
+
+#include "common/DataTypes.hpp"
+
+#include <functional>
+#include <vector>
+
+namespace geosx
+{
+
+/**
+ * @class TaskGraph
+ *
+ * Runs the independent phases of a step concurrently on the threads of the rank. Each task lists the tasks it
+ * depends on, which must have been added before it, and the tasks are run by waves: a wave holds the tasks whose
+ * dependencies all ran in the previous waves. The tasks of a wave run at the same time, each on its own share of
+ * the OpenMP threads, proportional to its weight, so that the host kernels launched by a task run on a nested
+ * team of that size.
+ *
+ * The tasks of a wave must not write to the same data, e.g. the assembly phases of a coupled solver writing to
+ * the rows of different fields. Without OpenMP, on device builds, or unless enabled (--concurrent-assembly), the
+ * tasks run one after another in the order they were added.
+ */
+class TaskGraph
+{
+public:
+
+  /// The identifier of a task, its index in the order the tasks were added
+  using TaskId = localIndex;
+
+  /**
+   * @brief Enable or disable the concurrent execution of the tasks.
+   * @param concurrent if true, the tasks of a wave run concurrently
+   */
+  static void setConcurrent( bool const concurrent );
+
+  /**
+   * @brief Get whether the tasks of a wave run concurrently.
+   * @return true if enabled on a host build with OpenMP
+   */
+  static bool isConcurrent();
+
+  /**
+   * @brief Add a task.
+   * @param weight the estimated cost of the task, e.g. the number of rows it assembles
+   * @param task the task
+   * @param dependencies the tasks that must run before
+   * @return the identifier of the task
+   */
+  TaskId addTask( real64 const weight,
+                  std::function< void() > task,
+                  std::vector< TaskId > const & dependencies = {} );
+
+  /**
+   * @brief Run all the tasks and clear the graph.
+   */
+  void execute();
+
+  /**
+   * @brief Split the threads between the tasks of a wave.
+   * @param weights the weights of the tasks
+   * @param numThreads the number of threads
+   * @return the number of threads of each task, at least one
+   */
+  static std::vector< integer > splitThreads( std::vector< real64 > const & weights, integer const numThreads );
+
+private:
+
+  /// A task and its dependencies
+  struct Task
+  {
+    /// The estimated cost of the task
+    real64 weight;
+
+    /// The task
+    std::function< void() > run;
+
+    /// The tasks that must run before
+    std::vector< TaskId > dependencies;
+  };
+
+  /**
+   * @brief Run the tasks of a wave.
+   * @param wave the identifiers of the tasks
+   */
+  void executeWave( std::vector< TaskId > const & wave );
+
+  /// The tasks in the order they were added
+  std::vector< Task > m_tasks;
+};
+
+} // namespace geosx
+
+#endif //GEOSX_COMMON_TASKGRAPH_HPP_
@@ -29,10 +29,14 @@
 #include "common/GeosxMacros.hpp"
 
 #ifdef GEOSX_USE_CALIPER
+#include "LvArray/src/system.hpp"
+
 #include <caliper/cali.h>
+#include <caliper/Annotation.h>
 #include <sys/time.h>
 #include <string>
 #include <iostream>
+#include <type_traits>
 
 namespace timingHelpers
 {
@@ -43,6 +47,119 @@ namespace timingHelpers
     std::string::size_type const beg = input.find_last_of( ' ', end)+1;
     return input.substr( beg, end-beg );
   }
+
+  /**
+   * @brief Get a short and stable name of a kernel from its demangled type.
+   * @param typeName the demangled type of the kernel, or of the lambda of a loop
+   * @return the type without the argument lists and the geosx namespace qualifiers,
+   *   "CompositionalMultiphaseFlow::UpdateState::{lambda#1}" for the first lambda of a function
+   */
+  inline std::string kernelName( std::string const & typeName )
+  {
+    std::string name;
+    int depth = 0;
+    for( char const c : typeName )
+    {
+      depth += ( c == '(' );
+      if( depth == 0 )
+      {
+        name += c;
+      }
+      depth -= ( c == ')' && depth > 0 );
+    }
+
+    std::string const qualifier = "geosx::";
+    for( std::string::size_type pos = name.find( qualifier ); pos != std::string::npos; pos = name.find( qualifier, pos ) )
+    {
+      name.erase( pos, qualifier.size() );
+    }
+    return name;
+  }
+
+  /**
+   * @class KernelRegion
+   * @brief A Caliper region of a kernel launch, with the number of elements and the estimated bytes and flops.
+   *
+   * The regions are nested in the function regions under the "kernel" attribute, and the metrics are
+   * set without triggering snapshots, so that only the snapshot closing the region carries them. The loops
+   * launched within a kernel region (the element loop of a finite element kernel) are not marked again,
+   * hence the kernel regions are never nested and their metrics are counted once.
+   */
+  class KernelRegion
+  {
+  public:
+    /**
+     * @brief Begin the region of a kernel launch.
+     * @param name the name of the kernel, nothing is marked if nullptr
+     * @param numElems the number of elements (or iterations) of the launch
+     * @param bytes the estimated number of bytes moved to and from memory by the launch, 0 if unknown
+     * @param flops the estimated number of floating point operations of the launch, 0 if unknown
+     */
+    KernelRegion( char const * const name, double const numElems, double const bytes, double const flops ):
+      m_active( name != nullptr && depth() == 0 )
+    {
+      if( !m_active )
+      {
+        return;
+      }
+      ++depth();
+      kernelAttribute().begin( name );
+      elementsAttribute().set( numElems );
+      bytesAttribute().set( bytes );
+      flopsAttribute().set( flops );
+    }
+
+    /// End the region, the snapshot of the end carries the metrics.
+    ~KernelRegion()
+    {
+      if( !m_active )
+      {
+        return;
+      }
+      kernelAttribute().end();
+      elementsAttribute().end();
+      bytesAttribute().end();
+      flopsAttribute().end();
+      --depth();
+    }
+
+    KernelRegion( KernelRegion const & ) = delete;
+    KernelRegion & operator=( KernelRegion const & ) = delete;
+
+  private:
+    static int & depth()
+    {
+      static thread_local int kernelDepth = 0;
+      return kernelDepth;
+    }
+
+    static cali::Annotation & kernelAttribute()
+    {
+      static cali::Annotation attribute( "kernel", CALI_ATTR_NESTED );
+      return attribute;
+    }
+
+    static cali::Annotation & elementsAttribute()
+    {
+      static cali::Annotation attribute( "kernel.elements", CALI_ATTR_ASVALUE | CALI_ATTR_AGGREGATABLE | CALI_ATTR_SKIP_EVENTS );
+      return attribute;
+    }
+
+    static cali::Annotation & bytesAttribute()
+    {
+      static cali::Annotation attribute( "kernel.bytes", CALI_ATTR_ASVALUE | CALI_ATTR_AGGREGATABLE | CALI_ATTR_SKIP_EVENTS );
+      return attribute;
+    }
+
+    static cali::Annotation & flopsAttribute()
+    {
+      static cali::Annotation attribute( "kernel.flops", CALI_ATTR_ASVALUE | CALI_ATTR_AGGREGATABLE | CALI_ATTR_SKIP_EVENTS );
+      return attribute;
+    }
+
+    /// Whether this region is marked
+    bool const m_active;
+  };
 }
 
 /// Mark a function or scope for timing with a given name
@@ -63,6 +180,27 @@ namespace timingHelpers
 /// Mark the end of function, only useful when you don't want to or can't mark the whole function.
 #define GEOSX_MARK_FUNCTION_END CALI_MARK_FUNCTION_END
 
+/**
+ * @brief Mark the scope of a kernel launch.
+ * @param name the name of the kernel, a char const *
+ * @param numElems the number of elements of the launch
+ * @param bytes the estimated number of bytes moved to and from memory, 0 if unknown
+ * @param flops the estimated number of floating point operations, 0 if unknown
+ */
+#define GEOSX_MARK_KERNEL(name, numElems, bytes, flops) \
+  timingHelpers::KernelRegion geosxKernelRegion( name, static_cast< double >( numElems ), \
+                                                 static_cast< double >( bytes ), static_cast< double >( flops ) )
+
+/**
+ * @brief Mark the scope of a loop, named after the function defining its lambda.
+ * @param LAMBDA_TYPE the type of the lambda of the loop body
+ * @param numIterations the number of iterations of the loop
+ */
+#define GEOSX_MARK_LOOP(LAMBDA_TYPE, numIterations) \
+  static std::string const geosxLoopName = \
+    timingHelpers::kernelName( LvArray::system::demangleType< std::decay_t< LAMBDA_TYPE > >() ); \
+  GEOSX_MARK_KERNEL( geosxLoopName.c_str(), numIterations, 0, 0 )
+
 #else // GEOSX_USE_CALIPER
 
 /// @cond DO_NOT_DOCUMENT
@@ -75,6 +213,9 @@ namespace timingHelpers
 
 #define GEOSX_MARK_FUNCTION_BEGIN
 #define GEOSX_MARK_FUNCTION_END
+
+#define GEOSX_MARK_KERNEL(name, numElems, bytes, flops)
+#define GEOSX_MARK_LOOP(LAMBDA_TYPE, numIterations)
 /// @endcond
 
 #endif // GEOSX_USE_CALIPER
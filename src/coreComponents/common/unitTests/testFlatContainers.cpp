@@ -0,0 +1,105 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/DataTypes.hpp"
+#include "common/FlatContainers.hpp"
+
+#include <map>
+#include <random>
+#include <set>
+
+using namespace geosx;
+
+TEST( FlatContainers, flatSetMatchesStdSet )
+{
+  std::mt19937 gen( 2020 );
+  std::uniform_int_distribution< localIndex > value( 0, 200 );
+
+  FlatSet< localIndex > flatSet;
+  std::set< localIndex > stdSet;
+  for( int i = 0; i < 5000; ++i )
+  {
+    localIndex const v = value( gen );
+    switch( gen() % 3 )
+    {
+      case 0:
+      {
+        EXPECT_EQ( flatSet.insert( v ).second, stdSet.insert( v ).second );
+        break;
+      }
+      case 1:
+      {
+        EXPECT_EQ( flatSet.erase( v ), stdSet.erase( v ) );
+        break;
+      }
+      default:
+      {
+        localIndex const values[4] = { v, value( gen ), value( gen ), v };
+        flatSet.insert( values, values + 4 );
+        stdSet.insert( values, values + 4 );
+      }
+    }
+
+    EXPECT_EQ( flatSet.count( v ), stdSet.count( v ) );
+    ASSERT_EQ( flatSet.size(), stdSet.size() );
+    EXPECT_TRUE( std::equal( flatSet.begin(), flatSet.end(), stdSet.begin() ) );
+  }
+}
+
+TEST( FlatContainers, flatMapMatchesStdMap )
+{
+  std::mt19937 gen( 2020 );
+  std::uniform_int_distribution< localIndex > key( 0, 200 );
+
+  FlatMap< localIndex, int > flatMap;
+  std::map< localIndex, int > stdMap;
+  for( int i = 0; i < 5000; ++i )
+  {
+    localIndex const k = key( gen );
+    if( gen() % 2 == 0 )
+    {
+      flatMap[k] += i;
+      stdMap[k] += i;
+    }
+    else
+    {
+      EXPECT_EQ( flatMap.erase( k ), stdMap.erase( k ) );
+    }
+
+    EXPECT_EQ( flatMap.count( k ), stdMap.count( k ) );
+    ASSERT_EQ( flatMap.size(), stdMap.size() );
+    EXPECT_TRUE( std::equal( flatMap.begin(), flatMap.end(), stdMap.begin(),
+                             []( std::pair< localIndex, int > const & a, std::pair< localIndex const, int > const & b )
+    { return a.first == b.first && a.second == b.second; } ) );
+  }
+}
+
+TEST( FlatContainers, clearKeepsTheOrderOfTheNextInsertions )
+{
+  FlatMap< localIndex, FlatSet< localIndex > > flatMap;
+  flatMap[3].insert( 1 );
+  flatMap[1].insert( 2 );
+  flatMap.clear();
+  EXPECT_TRUE( flatMap.empty() );
+
+  flatMap[5].insert( 4 );
+  flatMap[2].insert( 7 );
+  flatMap[2].insert( 6 );
+  ASSERT_EQ( flatMap.size(), 2u );
+  EXPECT_EQ( flatMap.begin()->first, 2 );
+  EXPECT_EQ( *flatMap.find( 2 )->second.begin(), 6 );
+  EXPECT_TRUE( flatMap.find( 3 ) == flatMap.end() );
+}
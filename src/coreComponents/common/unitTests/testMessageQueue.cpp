@@ -0,0 +1,105 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/Logger.hpp"
+#include "common/MessageQueue.hpp"
+
+#include <vector>
+#include <thread>
+
+using namespace geosx;
+
+TEST( MessageQueue, keepsOrderUntilFull )
+{
+  MessageQueue queue( 5 );
+  EXPECT_EQ( queue.capacity(), std::size_t( 8 ) );
+
+  for( int lap = 0; lap < 3; ++lap )
+  {
+    for( std::size_t i = 0; i < queue.capacity(); ++i )
+    {
+      std::string message = std::to_string( i );
+      EXPECT_TRUE( queue.push( message ) );
+    }
+
+    std::string message = "overflow";
+    EXPECT_FALSE( queue.push( message ) );
+    EXPECT_EQ( message, "overflow" );
+
+    for( std::size_t i = 0; i < queue.capacity(); ++i )
+    {
+      EXPECT_TRUE( queue.pop( message ) );
+      EXPECT_EQ( message, std::to_string( i ) );
+    }
+    EXPECT_FALSE( queue.pop( message ) );
+  }
+}
+
+TEST( MessageQueue, concurrentProducers )
+{
+  int const numProducers = 4;
+  int const numMessages = 10000;
+  MessageQueue queue( 64 );
+
+  std::vector< std::thread > producers;
+  for( int p = 0; p < numProducers; ++p )
+  {
+    producers.emplace_back( [&queue, p]()
+    {
+      for( int i = 0; i < numMessages; ++i )
+      {
+        std::string message = std::to_string( p ) + " " + std::to_string( i );
+        while( !queue.push( message ) )
+        {
+          std::this_thread::yield();
+        }
+      }
+    } );
+  }
+
+  // the messages of each producer come out in the order it pushed them
+  std::vector< int > next( numProducers, 0 );
+  std::string message;
+  for( int received = 0; received < numProducers * numMessages; )
+  {
+    if( queue.pop( message ) )
+    {
+      std::size_t const space = message.find( ' ' );
+      int const p = std::stoi( message.substr( 0, space ) );
+      EXPECT_EQ( std::stoi( message.substr( space + 1 ) ), next[ p ]++ );
+      ++received;
+    }
+  }
+
+  for( std::thread & producer : producers )
+  {
+    producer.join();
+  }
+  EXPECT_FALSE( queue.pop( message ) );
+}
+
+TEST( Logger, formatRankRanges )
+{
+  EXPECT_EQ( logger::internal::formatRankRanges( { 0 } ), "0" );
+  EXPECT_EQ( logger::internal::formatRankRanges( { 0, 1, 2, 3, 8, 10, 11 } ), "0-3, 8, 10-11" );
+
+  std::vector< int > evenRanks;
+  for( int rank = 0; rank < 40; rank += 2 )
+  {
+    evenRanks.push_back( rank );
+  }
+  EXPECT_EQ( logger::internal::formatRankRanges( evenRanks ), "0, 2, 4, 6, 8, 10, 12, 14 and 12 more" );
+}
@@ -0,0 +1,73 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/TaskGraph.hpp"
+
+#include <atomic>
+#include <numeric>
+
+using namespace geosx;
+
+TEST( TaskGraph, splitThreads )
+{
+  // one thread each when there are not enough threads
+  EXPECT_EQ( TaskGraph::splitThreads( { 1.0, 2.0, 3.0 }, 2 ), std::vector< integer >( { 1, 1, 1 } ) );
+
+  // proportional to the weights, all the threads used
+  EXPECT_EQ( TaskGraph::splitThreads( { 900.0, 100.0 }, 10 ), std::vector< integer >( { 9, 1 } ) );
+  EXPECT_EQ( TaskGraph::splitThreads( { 1.0, 1.0, 1.0 }, 8 ), std::vector< integer >( { 3, 3, 2 } ) );
+  EXPECT_EQ( TaskGraph::splitThreads( { 0.0, 0.0 }, 5 ), std::vector< integer >( { 3, 2 } ) );
+
+  std::vector< integer > const shares = TaskGraph::splitThreads( { 5.0, 1.0, 0.0, 2.0 }, 16 );
+  EXPECT_EQ( std::accumulate( shares.begin(), shares.end(), 0 ), 16 );
+  for( integer const share : shares )
+  {
+    EXPECT_GE( share, 1 );
+  }
+}
+
+TEST( TaskGraph, runsAfterDependencies )
+{
+  for( bool const concurrent : { false, true } )
+  {
+    TaskGraph::setConcurrent( concurrent );
+
+    // two independent chains joined by a last task
+    std::atomic< int > counter( 0 );
+    std::vector< int > order( 5, -1 );
+    auto const record = [&]( int const task ) { return [&, task] { order[task] = counter++; }; };
+
+    TaskGraph graph;
+    TaskGraph::TaskId const a = graph.addTask( 100.0, record( 0 ) );
+    TaskGraph::TaskId const b = graph.addTask( 10.0, record( 1 ) );
+    TaskGraph::TaskId const c = graph.addTask( 1.0, record( 2 ), { a } );
+    TaskGraph::TaskId const d = graph.addTask( 1.0, record( 3 ), { b } );
+    graph.addTask( 1.0, record( 4 ), { c, d } );
+    graph.execute();
+
+    EXPECT_EQ( counter, 5 );
+    EXPECT_LT( order[0], order[2] );
+    EXPECT_LT( order[1], order[3] );
+    EXPECT_LT( order[2], order[4] );
+    EXPECT_LT( order[3], order[4] );
+
+    // the graph is cleared
+    graph.execute();
+    EXPECT_EQ( counter, 5 );
+  }
+
+  TaskGraph::setConcurrent( false );
+}
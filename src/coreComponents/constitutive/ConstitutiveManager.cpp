@@ -18,6 +18,12 @@
 
 #include "ConstitutiveManager.hpp"
 
+#ifdef GEOSX_USE_CHAI
+#include <chai/ArrayManager.hpp>
+#include <umpire/ResourceManager.hpp>
+#include <umpire/strategy/DynamicPool.hpp>
+#endif
+
 namespace geosx
 {
 
@@ -26,12 +32,105 @@ using namespace dataRepository;
 namespace constitutive
 {
 
+namespace
+{
+
+/**
+ * @class ScopedPooledAllocation
+ * @brief Directs the allocations of the arrays created during its lifetime to memory pools.
+ *
+ * The CHAI allocator of each memory space is replaced by a pool built on top of it, and restored on destruction.
+ * The arrays remember the allocator they were created with, so that their later moves, reallocations and
+ * deallocation keep using the pools.
+ */
+class ScopedPooledAllocation
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param enabled whether the allocations are directed to the pools
+   */
+  explicit ScopedPooledAllocation( bool const enabled ):
+    m_enabled( enabled )
+  {
+#ifdef GEOSX_USE_CHAI
+    if( !m_enabled )
+    {
+      return;
+    }
+
+    chai::ArrayManager & arrayManager = *chai::ArrayManager::getInstance();
+    umpire::ResourceManager & rm = umpire::ResourceManager::getInstance();
+    for( chai::ExecutionSpace const space : spaces() )
+    {
+      m_allocators.emplace_back( arrayManager.getAllocator( space ) );
+
+      string const poolName = "CONSTITUTIVE_" + m_allocators.back().getName() + "_POOL";
+      if( !rm.isAllocator( poolName ) )
+      {
+        rm.makeAllocator< umpire::strategy::DynamicPool >( poolName, m_allocators.back() );
+      }
+      umpire::Allocator pool = rm.getAllocator( poolName );
+      arrayManager.setAllocator( space, pool );
+    }
+#endif
+  }
+
+  /// Destructor, restores the allocators.
+  ~ScopedPooledAllocation()
+  {
+#ifdef GEOSX_USE_CHAI
+    if( !m_enabled )
+    {
+      return;
+    }
+
+    chai::ArrayManager & arrayManager = *chai::ArrayManager::getInstance();
+    std::vector< chai::ExecutionSpace > const pooledSpaces = spaces();
+    for( std::size_t i = 0; i < pooledSpaces.size(); ++i )
+    {
+      arrayManager.setAllocator( pooledSpaces[i], m_allocators[i] );
+    }
+#endif
+  }
+
+private:
+
+#ifdef GEOSX_USE_CHAI
+  /// @return the memory spaces the data is pooled in
+  static std::vector< chai::ExecutionSpace > spaces()
+  {
+#if defined( GEOSX_USE_DEVICE )
+    return { chai::CPU, chai::GPU };
+#else
+    return { chai::CPU };
+#endif
+  }
+
+  /// The allocators replaced by the pools
+  std::vector< umpire::Allocator > m_allocators;
+#endif
+
+  /// Whether the allocations are directed to the pools
+  bool const m_enabled;
+};
+
+}
 
 ConstitutiveManager::ConstitutiveManager( string const & name,
                                           Group * const parent ):
-  Group( name, parent )
+  Group( name, parent ),
+  m_pooledAllocation( 0 )
 {
   setInputFlags( InputFlags::OPTIONAL );
+
+  registerWrapper( viewKeyStruct::pooledAllocationString, &m_pooledAllocation )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to allocate the constitutive data of all the regions from memory pools, one per memory "
+                    "space, instead of allocating each array on its own. This reduces the setup time of the meshes "
+                    "with many regions and of the models with many fields." );
 }
 
 ConstitutiveManager::~ConstitutiveManager()
@@ -60,6 +159,9 @@ ConstitutiveManager::HangConstitutiveRelation( string const & constitutiveRelati
                                                dataRepository::Group * const parent,
                                                localIndex const numConstitutivePointsPerParentIndex ) const
 {
+  // the clone registers its arrays and allocateConstitutiveData sizes them, both in the pools
+  ScopedPooledAllocation const pooledAllocation( m_pooledAllocation );
+
   ConstitutiveBase const * const
   constitutiveRelation = GetConstitutiveRelation( constitutiveRelationInstanceName );
 
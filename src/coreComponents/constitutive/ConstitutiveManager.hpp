@@ -99,6 +99,15 @@ public:
     static constexpr auto constitutiveModelsString = "ConstitutiveModels";
   } m_ConstitutiveManagerGroupKeys;
 
+  struct viewKeyStruct
+  {
+    static constexpr auto pooledAllocationString = "pooledAllocation";
+  };
+
+private:
+
+  /// Flag to allocate the constitutive data of all the regions from one memory pool per memory space
+  integer m_pooledAllocation;
 
 };
 
@@ -20,6 +20,7 @@
 #ifndef GEOSX_CONSTITUTIVE_CONSTITUTIVEPASSTHRU_HPP_
 #define GEOSX_CONSTITUTIVE_CONSTITUTIVEPASSTHRU_HPP_
 
+#include "common/GeosxConfig.hpp"
 #include "NullModel.hpp"
 #include "solid/Damage.hpp"
 #include "solid/LinearElasticIsotropic.hpp"
@@ -40,6 +41,9 @@ namespace constitutive
  * This struct works by implementing an if-else or switch-case block for a
  * specific constitutive base type, and executing the lambda passing it a
  * casted pointer to the constitutive relation.
+ *
+ * The solid models are only dispatched if they are in the GEOSX_SOLID_DISPATCH
+ * CMake option, the others are reported as unknown models.
  */
 template< typename BASETYPE >
 struct ConstitutivePassThru;
@@ -58,33 +62,50 @@ struct ConstitutivePassThru< SolidBase >
   {
     GEOSX_ERROR_IF( constitutiveRelation == nullptr, "ConstitutiveBase* == nullptr" );
 
+#if defined( GEOSX_DISPATCH_DAMAGE )
     if( dynamic_cast< Damage< LinearElasticIsotropic > * >( constitutiveRelation ) )
     {
       lambda( static_cast< Damage< LinearElasticIsotropic > * >( constitutiveRelation) );
+      return;
     }
-    else if( dynamic_cast< LinearElasticIsotropic * >( constitutiveRelation ) )
+#else
+    // Damage derives from its elastic model, which must not be dispatched in its place
+    GEOSX_ERROR_IF( dynamic_cast< DamageBase * >( constitutiveRelation ),
+                    "The Damage model of " << constitutiveRelation->getName() << " is not in the GEOSX_SOLID_DISPATCH CMake option" );
+#endif
+
+#if defined( GEOSX_DISPATCH_LINEARELASTICISOTROPIC )
+    if( dynamic_cast< LinearElasticIsotropic * >( constitutiveRelation ) )
     {
       lambda( static_cast< LinearElasticIsotropic * >( constitutiveRelation) );
+      return;
     }
-    else if( dynamic_cast< LinearElasticTransverseIsotropic * >( constitutiveRelation ) )
+#endif
+
+#if defined( GEOSX_DISPATCH_LINEARELASTICTRANSVERSEISOTROPIC )
+    if( dynamic_cast< LinearElasticTransverseIsotropic * >( constitutiveRelation ) )
     {
       lambda( static_cast< LinearElasticTransverseIsotropic * >( constitutiveRelation) );
+      return;
     }
-    else if( dynamic_cast< LinearElasticAnisotropic * >( constitutiveRelation ) )
+#endif
+
+#if defined( GEOSX_DISPATCH_LINEARELASTICANISOTROPIC )
+    if( dynamic_cast< LinearElasticAnisotropic * >( constitutiveRelation ) )
     {
       lambda( static_cast< LinearElasticAnisotropic * >( constitutiveRelation) );
+      return;
     }
-    else
+#endif
+
+    string name;
+    if( constitutiveRelation !=nullptr )
     {
-      string name;
-      if( constitutiveRelation !=nullptr )
-      {
-        name = constitutiveRelation->getName();
-      }
-      GEOSX_ERROR( "ConstitutivePassThru<SolidBase>::Execute( "<<
-                   constitutiveRelation<<" ) failed. ( "<<
-                   constitutiveRelation<<" ) is named "<<name );
+      name = constitutiveRelation->getName();
     }
+    GEOSX_ERROR( "ConstitutivePassThru<SolidBase>::Execute( "<<
+                 constitutiveRelation<<" ) failed. ( "<<
+                 constitutiveRelation<<" ) is named "<<name );
   }
 };
 
@@ -135,29 +156,38 @@ struct ConstitutivePassThru< PoroElasticBase >
   {
     GEOSX_ERROR_IF( constitutiveRelation == nullptr, "ConstitutiveBase* == nullptr" );
 
+#if defined( GEOSX_DISPATCH_LINEARELASTICISOTROPIC )
     if( dynamic_cast< PoroElastic< LinearElasticIsotropic > * >( constitutiveRelation ) )
     {
       lambda( static_cast< PoroElastic< LinearElasticIsotropic > * >( constitutiveRelation) );
+      return;
     }
-    else if( dynamic_cast< PoroElastic< LinearElasticTransverseIsotropic > * >( constitutiveRelation ) )
+#endif
+
+#if defined( GEOSX_DISPATCH_LINEARELASTICTRANSVERSEISOTROPIC )
+    if( dynamic_cast< PoroElastic< LinearElasticTransverseIsotropic > * >( constitutiveRelation ) )
     {
       lambda( static_cast< PoroElastic< LinearElasticTransverseIsotropic > * >( constitutiveRelation) );
+      return;
     }
-    else if( dynamic_cast< PoroElastic< LinearElasticAnisotropic > * >( constitutiveRelation ) )
+#endif
+
+#if defined( GEOSX_DISPATCH_LINEARELASTICANISOTROPIC )
+    if( dynamic_cast< PoroElastic< LinearElasticAnisotropic > * >( constitutiveRelation ) )
     {
       lambda( static_cast< PoroElastic< LinearElasticAnisotropic > * >( constitutiveRelation) );
+      return;
     }
-    else
+#endif
+
+    string name;
+    if( constitutiveRelation !=nullptr )
     {
-      string name;
-      if( constitutiveRelation !=nullptr )
-      {
-        name = constitutiveRelation->getName();
-      }
-      GEOSX_ERROR( "ConstitutivePassThru<SolidBase>::Execute( "<<
-                   constitutiveRelation<<" ) failed. ( "<<
-                   constitutiveRelation<<" ) is named "<<name );
+      name = constitutiveRelation->getName();
     }
+    GEOSX_ERROR( "ConstitutivePassThru<SolidBase>::Execute( "<<
+                 constitutiveRelation<<" ) failed. ( "<<
+                 constitutiveRelation<<" ) is named "<<name );
   }
 };
 
@@ -174,21 +204,22 @@ struct ConstitutivePassThru< DamageBase >
   {
     GEOSX_ERROR_IF( constitutiveRelation == nullptr, "ConstitutiveBase* == nullptr" );
 
+#if defined( GEOSX_DISPATCH_DAMAGE )
     if( dynamic_cast< Damage< LinearElasticIsotropic > * >( constitutiveRelation ) )
     {
       lambda( static_cast< Damage< LinearElasticIsotropic > * >( constitutiveRelation) );
+      return;
     }
-    else
+#endif
+
+    string name;
+    if( constitutiveRelation !=nullptr )
     {
-      string name;
-      if( constitutiveRelation !=nullptr )
-      {
-        name = constitutiveRelation->getName();
-      }
-      GEOSX_ERROR( "ConstitutivePassThru<DamgeBase>::Execute( "<<
-                   constitutiveRelation<<" ) failed. ( "<<
-                   constitutiveRelation<<" ) is named "<<name );
+      name = constitutiveRelation->getName();
     }
+    GEOSX_ERROR( "ConstitutivePassThru<DamgeBase>::Execute( "<<
+                 constitutiveRelation<<" ) failed. ( "<<
+                 constitutiveRelation<<" ) is named "<<name );
   }
 };
 
@@ -0,0 +1,95 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MaterialParameterView.hpp
+ */
+
+#ifndef GEOSX_CONSTITUTIVE_MATERIALPARAMETERVIEW_HPP_
+#define GEOSX_CONSTITUTIVE_MATERIALPARAMETERVIEW_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+namespace constitutive
+{
+
+/**
+ * @class MaterialParameterView
+ *
+ * A view of a parameter of a constitutive model, to be read per element in the kernels. The parameter is
+ * either stored per element, or in a small table of materials, indexed by a compact per-element material
+ * index unless the table holds a single material.
+ */
+class MaterialParameterView
+{
+public:
+
+  /**
+   * @brief Constructor of a parameter stored per element.
+   * @param values the values of the parameter, per element
+   */
+  MaterialParameterView( arrayView1d< real64 const > const & values ):
+    m_values( values ),
+    m_materialIndex(),
+    m_stride( 1 ),
+    m_indexed( false )
+  {}
+
+  /**
+   * @brief Constructor of a parameter stored per material.
+   * @param values the values of the parameter, per material
+   * @param materialIndex the material of each element, unused if @p values holds a single material
+   */
+  MaterialParameterView( arrayView1d< real64 const > const & values,
+                         arrayView1d< integer const > const & materialIndex ):
+    m_values( values ),
+    m_materialIndex( materialIndex ),
+    m_stride( 0 ),
+    m_indexed( values.size() > 1 )
+  {}
+
+  /**
+   * @brief Get the value of the parameter in an element.
+   * @param k the element
+   * @return the value
+   */
+  GEOSX_HOST_DEVICE GEOSX_FORCE_INLINE
+  real64 operator[]( localIndex const k ) const
+  {
+    return m_indexed ? m_values[ m_materialIndex[ k ] ] : m_values[ k * m_stride ];
+  }
+
+private:
+
+  /// The values, per element or per material
+  arrayView1d< real64 const > m_values;
+
+  /// The material of each element, empty unless the values are indexed
+  arrayView1d< integer const > m_materialIndex;
+
+  /// The stride of the values in the elements: 1 per element, 0 for a single material
+  localIndex m_stride;
+
+  /// Whether the values are read through the material index
+  bool m_indexed;
+};
+
+} // namespace constitutive
+
+} // namespace geosx
+
+#endif //GEOSX_CONSTITUTIVE_MATERIALPARAMETERVIEW_HPP_
@@ -0,0 +1,66 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PowerFunction.hpp
+ */
+
+#ifndef GEOSX_CONSTITUTIVE_POWERFUNCTION_HPP_
+#define GEOSX_CONSTITUTIVE_POWERFUNCTION_HPP_
+
+#include "common/DataTypes.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace geosx
+{
+
+namespace constitutive
+{
+
+/**
+ * @brief Compute a power of a positive value as 2^(y log2(x)).
+ * @param x the value, must be positive
+ * @param y the exponent
+ * @return x^y
+ *
+ * Unlike std::pow, the power has no special cases (negative or zero values, integer exponents, overflows),
+ * which makes it a short branch-free sequence of exp2 and log2 on the host and on the device. The price is
+ * the rounding error of log2(x), amplified by the exponent: the relative error against std::pow is bounded
+ * by fastPowTolerance( x, y ), about 2 (1 + |y log2(x)|) machine epsilons.
+ */
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+real64 fastPow( real64 const x, real64 const y )
+{
+  return exp2( y * log2( x ) );
+}
+
+/**
+ * @brief Get the bound of the error of fastPow.
+ * @param x the value
+ * @param y the exponent
+ * @return the bound of the relative error of fastPow( @p x, @p y ) against std::pow
+ */
+inline real64 fastPowTolerance( real64 const x, real64 const y )
+{
+  return 2.0 * ( 1.0 + std::fabs( y * std::log2( x ) ) ) * std::numeric_limits< real64 >::epsilon();
+}
+
+} // namespace constitutive
+
+} // namespace geosx
+
+#endif //GEOSX_CONSTITUTIVE_POWERFUNCTION_HPP_
@@ -19,6 +19,7 @@
 #ifndef GEOSX_CONSTITUTIVE_CAPILLARYPRESSURE_BROOKSCOREYCAPILLARYPRESSURE_HPP
 #define GEOSX_CONSTITUTIVE_CAPILLARYPRESSURE_BROOKSCOREYCAPILLARYPRESSURE_HPP
 
+#include "constitutive/PowerFunction.hpp"
 #include "constitutive/capillaryPressure/CapillaryPressureBase.hpp"
 
 namespace geosx
@@ -229,24 +230,16 @@ BrooksCoreyCapillaryPressureUpdate::
 {
   real64 const exponent = 1.0 / exponentInv; // div by 0 taken care of by initialization check
 
-  phaseCapPressure           = 0.0;
-  dPhaseCapPressure_dVolFrac = 0.0;
+  // clamping the volume fraction to [eps,1] enforces a constant and bounded capillary pressure outside of this range,
+  // where the derivative is zero: the result is selected without branching
+  real64 const clampedVolFrac = fmin( fmax( scaledWettingVolFrac, eps ), 1.0 );
+  bool const isInRange = scaledWettingVolFrac >= eps && scaledWettingVolFrac < 1.0;
 
-  if( scaledWettingVolFrac >= eps && scaledWettingVolFrac < 1.0 )
-  {
-    // intermediate value
-    real64 const val = entryPressure / pow( scaledWettingVolFrac, exponent + 1 );
-
-    phaseCapPressure           = val * scaledWettingVolFrac; // entryPressure * (S_w)^( - 1 / exponentInv )
-    dPhaseCapPressure_dVolFrac = -dScaledWettingPhaseVolFrac_dVolFrac * val * exponent;
-  }
-  else // enforce a constant and bounded capillary pressure
-  {
-    phaseCapPressure = (scaledWettingVolFrac < eps)
-                     ? entryPressure / pow( eps, exponent ) // div by 0 taken care of by initialization check
-                     : entryPressure;
-  }
+  // intermediate value
+  real64 const val = entryPressure / fastPow( clampedVolFrac, exponent + 1 );
 
+  phaseCapPressure           = val * clampedVolFrac; // entryPressure * (S_w)^( - 1 / exponentInv )
+  dPhaseCapPressure_dVolFrac = isInRange ? -dScaledWettingPhaseVolFrac_dVolFrac * val * exponent : 0.0;
 }
 
 
@@ -20,6 +20,7 @@
 #define GEOSX_CONSTITUTIVE_FLUID_MULTIFLUIDBASE_HPP_
 
 #include "constitutive/ConstitutiveBase.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
 
 namespace geosx
 {
@@ -27,6 +28,12 @@ namespace geosx
 namespace constitutive
 {
 
+/**
+ * @brief Base class for multiphase fluid model kernel wrappers.
+ *
+ * The derived wrappers provide non-virtual Compute and Update functions, called on the wrapper type selected by
+ * constitutiveUpdatePassThru, so that the wrappers can be captured in device kernels.
+ */
 class MultiFluidBaseUpdate
 {
 public:
@@ -147,48 +154,6 @@ protected:
   arrayView2d< real64 > m_dTotalDensity_dPressure;
   arrayView2d< real64 > m_dTotalDensity_dTemperature;
   arrayView3d< real64 > m_dTotalDensity_dGlobalCompFraction;
-
-private:
-
-  virtual void Compute( real64 const pressure,
-                        real64 const temperature,
-                        arraySlice1d< real64 const > const & composition,
-                        arraySlice1d< real64 > const & phaseFraction,
-                        arraySlice1d< real64 > const & phaseDensity,
-                        arraySlice1d< real64 > const & phaseViscosity,
-                        arraySlice2d< real64 > const & phaseCompFraction,
-                        real64 & totalDensity ) const = 0;
-
-  virtual void Compute( real64 const pressure,
-                        real64 const temperature,
-                        arraySlice1d< real64 const > const & composition,
-                        arraySlice1d< real64 > const & phaseFraction,
-                        arraySlice1d< real64 > const & dPhaseFraction_dPressure,
-                        arraySlice1d< real64 > const & dPhaseFraction_dTemperature,
-                        arraySlice2d< real64 > const & dPhaseFraction_dGlobalCompFraction,
-                        arraySlice1d< real64 > const & phaseDensity,
-                        arraySlice1d< real64 > const & dPhaseDensity_dPressure,
-                        arraySlice1d< real64 > const & dPhaseDensity_dTemperature,
-                        arraySlice2d< real64 > const & dPhaseDensity_dGlobalCompFraction,
-                        arraySlice1d< real64 > const & phaseViscosity,
-                        arraySlice1d< real64 > const & dPhaseViscosity_dPressure,
-                        arraySlice1d< real64 > const & dPhaseViscosity_dTemperature,
-                        arraySlice2d< real64 > const & dPhaseViscosity_dGlobalCompFraction,
-                        arraySlice2d< real64 > const & phaseCompFraction,
-                        arraySlice2d< real64 > const & dPhaseCompFraction_dPressure,
-                        arraySlice2d< real64 > const & dPhaseCompFraction_dTemperature,
-                        arraySlice3d< real64 > const & dPhaseCompFraction_dGlobalCompFraction,
-                        real64 & totalDensity,
-                        real64 & dTotalDensity_dPressure,
-                        real64 & dTotalDensity_dTemperature,
-                        arraySlice1d< real64 > const & dTotalDensity_dGlobalCompFraction ) const = 0;
-
-  virtual void Update( localIndex const k,
-                       localIndex const q,
-                       real64 const pressure,
-                       real64 const temperature,
-                       arraySlice1d< real64 const > const & composition ) const = 0;
-
 };
 
 class MultiFluidBase : public ConstitutiveBase
@@ -218,6 +183,9 @@ public:
    */
   static constexpr localIndex MAX_NUM_PHASES = 4;
 
+  /// Launch policy of the kernel wrapper updates, serial for the models that are not thread-safe or device-capable
+  using UpdatePolicy = serialPolicy;
+
   /**
    * @return number of fluid components (species) in the model
    */
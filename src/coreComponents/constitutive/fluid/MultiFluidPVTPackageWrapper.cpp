@@ -23,6 +23,7 @@
 // PVTPackage includes
 #include "MultiphaseSystem/MultiphaseSystem.hpp"
 
+#include <limits>
 #include <map>
 
 namespace geosx
@@ -36,7 +37,10 @@ namespace constitutive
 MultiFluidPVTPackageWrapper::MultiFluidPVTPackageWrapper( std::string const & name, Group * const parent )
   : MultiFluidBase( name, parent ),
   m_fluid( nullptr )
-{}
+{
+  registerWrapper( viewKeyStruct::flashInputString, &m_flashInput )->
+    setRestartFlags( RestartFlags::NO_WRITE );
+}
 
 MultiFluidPVTPackageWrapper::~MultiFluidPVTPackageWrapper()
 {}
@@ -68,6 +72,16 @@ void MultiFluidPVTPackageWrapper::PostProcessInput()
                   []( string const & name ){ return getPVTPackagePhaseType( name ); } );
 }
 
+void MultiFluidPVTPackageWrapper::allocateConstitutiveData( dataRepository::Group * const parent,
+                                                            localIndex const numConstitutivePointsPerParentIndex )
+{
+  MultiFluidBase::allocateConstitutiveData( parent, numConstitutivePointsPerParentIndex );
+
+  // No point has been flashed yet
+  m_flashInput.resize( parent->size(), numConstitutivePointsPerParentIndex, numFluidComponents() + 2 );
+  m_flashInput.setValues< serialPolicy >( std::numeric_limits< real64 >::quiet_NaN() );
+}
+
 void MultiFluidPVTPackageWrapper::InitializePostSubGroups( Group * const group )
 {
   MultiFluidBase::InitializePostSubGroups( group );
@@ -99,7 +113,7 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
   localIndex const NP = m_phaseTypes.size();
 
   // 1. Convert input mass fractions to mole fractions and keep derivatives
-  std::vector< double > compMoleFrac( NC );
+  std::vector< double > & compMoleFrac = m_compMoleFrac;
 
   if( m_useMass )
   {
@@ -270,7 +284,7 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
 
   // 1. Convert input mass fractions to mole fractions and keep derivatives
 
-  std::vector< double > compMoleFrac( NC );
+  std::vector< double > & compMoleFrac = m_compMoleFrac;
   stackArray2d< real64, maxNumComp * maxNumComp > dCompMoleFrac_dCompMassFrac( NC, NC );
 
   if( m_useMass )
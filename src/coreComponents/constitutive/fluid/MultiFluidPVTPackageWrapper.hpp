@@ -21,6 +21,7 @@
 
 #include "constitutive/fluid/MultiFluidBase.hpp"
 
+#include <limits>
 #include <memory>
 
 namespace PVTPackage
@@ -37,6 +38,10 @@ namespace constitutive
 
 /**
  * @brief Kernel wrapper class for MultiFluidPVTPackage.
+ *
+ * The flash of a point is skipped when its pressure, temperature and composition are the same as in its previous
+ * update, whose results are still stored, which is the case of the repeated updates of an unchanged state.
+ *
  * @note Not thread-safe, do not use with any parallel launch policy.
  */
 class MultiFluidPVTPackageWrapperUpdate final : public MultiFluidBaseUpdate
@@ -45,6 +50,7 @@ public:
 
   MultiFluidPVTPackageWrapperUpdate( PVTPackage::MultiphaseSystem & fluid,
                                      arrayView1d< PVTPackage::PHASE_TYPE > const & phaseTypes,
+                                     arrayView3d< real64 > const & flashInput,
                                      arrayView1d< real64 const > const & componentMolarWeight,
                                      bool useMass,
                                      arrayView3d< real64 > const & phaseFraction,
@@ -90,7 +96,9 @@ public:
                             dTotalDensity_dTemperature,
                             dTotalDensity_dGlobalCompFraction ),
     m_fluid( fluid ),
-    m_phaseTypes( phaseTypes )
+    m_phaseTypes( phaseTypes ),
+    m_flashInput( flashInput ),
+    m_compMoleFrac( componentMolarWeight.size() )
   {}
 
   /// Default copy constructor
@@ -105,46 +113,51 @@ public:
   /// Deleted move assignment operator
   MultiFluidPVTPackageWrapperUpdate & operator=( MultiFluidPVTPackageWrapperUpdate && ) = delete;
 
-  virtual void Compute( real64 const pressure,
-                        real64 const temperature,
-                        arraySlice1d< real64 const > const & composition,
-                        arraySlice1d< real64 > const & phaseFraction,
-                        arraySlice1d< real64 > const & phaseDensity,
-                        arraySlice1d< real64 > const & phaseViscosity,
-                        arraySlice2d< real64 > const & phaseCompFraction,
-                        real64 & totalDensity ) const override;
-
-  virtual void Compute( real64 const pressure,
-                        real64 const temperature,
-                        arraySlice1d< real64 const > const & composition,
-                        arraySlice1d< real64 > const & phaseFraction,
-                        arraySlice1d< real64 > const & dPhaseFraction_dPressure,
-                        arraySlice1d< real64 > const & dPhaseFraction_dTemperature,
-                        arraySlice2d< real64 > const & dPhaseFraction_dGlobalCompFraction,
-                        arraySlice1d< real64 > const & phaseDensity,
-                        arraySlice1d< real64 > const & dPhaseDensity_dPressure,
-                        arraySlice1d< real64 > const & dPhaseDensity_dTemperature,
-                        arraySlice2d< real64 > const & dPhaseDensity_dGlobalCompFraction,
-                        arraySlice1d< real64 > const & phaseViscosity,
-                        arraySlice1d< real64 > const & dPhaseViscosity_dPressure,
-                        arraySlice1d< real64 > const & dPhaseViscosity_dTemperature,
-                        arraySlice2d< real64 > const & dPhaseViscosity_dGlobalCompFraction,
-                        arraySlice2d< real64 > const & phaseCompFraction,
-                        arraySlice2d< real64 > const & dPhaseCompFraction_dPressure,
-                        arraySlice2d< real64 > const & dPhaseCompFraction_dTemperature,
-                        arraySlice3d< real64 > const & dPhaseCompFraction_dGlobalCompFraction,
-                        real64 & totalDensity,
-                        real64 & dTotalDensity_dPressure,
-                        real64 & dTotalDensity_dTemperature,
-                        arraySlice1d< real64 > const & dTotalDensity_dGlobalCompFraction ) const override;
+  void Compute( real64 const pressure,
+                real64 const temperature,
+                arraySlice1d< real64 const > const & composition,
+                arraySlice1d< real64 > const & phaseFraction,
+                arraySlice1d< real64 > const & phaseDensity,
+                arraySlice1d< real64 > const & phaseViscosity,
+                arraySlice2d< real64 > const & phaseCompFraction,
+                real64 & totalDensity ) const;
+
+  void Compute( real64 const pressure,
+                real64 const temperature,
+                arraySlice1d< real64 const > const & composition,
+                arraySlice1d< real64 > const & phaseFraction,
+                arraySlice1d< real64 > const & dPhaseFraction_dPressure,
+                arraySlice1d< real64 > const & dPhaseFraction_dTemperature,
+                arraySlice2d< real64 > const & dPhaseFraction_dGlobalCompFraction,
+                arraySlice1d< real64 > const & phaseDensity,
+                arraySlice1d< real64 > const & dPhaseDensity_dPressure,
+                arraySlice1d< real64 > const & dPhaseDensity_dTemperature,
+                arraySlice2d< real64 > const & dPhaseDensity_dGlobalCompFraction,
+                arraySlice1d< real64 > const & phaseViscosity,
+                arraySlice1d< real64 > const & dPhaseViscosity_dPressure,
+                arraySlice1d< real64 > const & dPhaseViscosity_dTemperature,
+                arraySlice2d< real64 > const & dPhaseViscosity_dGlobalCompFraction,
+                arraySlice2d< real64 > const & phaseCompFraction,
+                arraySlice2d< real64 > const & dPhaseCompFraction_dPressure,
+                arraySlice2d< real64 > const & dPhaseCompFraction_dTemperature,
+                arraySlice3d< real64 > const & dPhaseCompFraction_dGlobalCompFraction,
+                real64 & totalDensity,
+                real64 & dTotalDensity_dPressure,
+                real64 & dTotalDensity_dTemperature,
+                arraySlice1d< real64 > const & dTotalDensity_dGlobalCompFraction ) const;
 
   GEOSX_FORCE_INLINE
-  virtual void Update( localIndex const k,
-                       localIndex const q,
-                       real64 const pressure,
-                       real64 const temperature,
-                       arraySlice1d< real64 const > const & composition ) const override
+  void Update( localIndex const k,
+               localIndex const q,
+               real64 const pressure,
+               real64 const temperature,
+               arraySlice1d< real64 const > const & composition ) const
   {
+    if( !updateFlashInput( m_flashInput[k][q], pressure, temperature, composition ) )
+    {
+      return;
+    }
+
     Compute( pressure,
              temperature,
              composition,
@@ -170,12 +183,84 @@ public:
              m_dTotalDensity_dGlobalCompFraction[k][q] );
   }
 
+  /**
+   * @brief Update the property values of a point, keeping the derivatives of its previous update.
+   * @param k the element index
+   * @param q the point index
+   * @param pressure the pressure
+   * @param temperature the temperature
+   * @param composition the global component fractions
+   */
+  GEOSX_FORCE_INLINE
+  void UpdateValues( localIndex const k,
+                     localIndex const q,
+                     real64 const pressure,
+                     real64 const temperature,
+                     arraySlice1d< real64 const > const & composition ) const
+  {
+    arraySlice1d< real64 > const flashInput = m_flashInput[k][q];
+    if( !updateFlashInput( flashInput, pressure, temperature, composition ) )
+    {
+      return;
+    }
+
+    Compute( pressure,
+             temperature,
+             composition,
+             m_phaseFraction[k][q],
+             m_phaseDensity[k][q],
+             m_phaseViscosity[k][q],
+             m_phaseCompFraction[k][q],
+             m_totalDensity[k][q] );
+
+    // the derivatives are not those of this input, which a later exact update must flash again
+    flashInput[0] = std::numeric_limits< real64 >::quiet_NaN();
+  }
+
 private:
 
+  /**
+   * @brief Store the flash input of a point.
+   * @param[inout] flashInput the pressure, temperature and composition of the previous flash of the point
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @param[in] composition the composition
+   * @return true if the input changed and the point must be flashed
+   */
+  static bool updateFlashInput( arraySlice1d< real64 > const & flashInput,
+                                real64 const pressure,
+                                real64 const temperature,
+                                arraySlice1d< real64 const > const & composition )
+  {
+    localIndex const NC = composition.size();
+    bool changed = flashInput[0] != pressure || flashInput[1] != temperature;
+    for( localIndex ic = 0; ic < NC && !changed; ++ic )
+    {
+      changed = flashInput[ic+2] != composition[ic];
+    }
+
+    if( changed )
+    {
+      flashInput[0] = pressure;
+      flashInput[1] = temperature;
+      for( localIndex ic = 0; ic < NC; ++ic )
+      {
+        flashInput[ic+2] = composition[ic];
+      }
+    }
+    return changed;
+  }
+
   PVTPackage::MultiphaseSystem & m_fluid;
 
   arrayView1d< PVTPackage::PHASE_TYPE > m_phaseTypes;
 
+  /// The pressure, temperature and composition of the previous flash of each point
+  arrayView3d< real64 > m_flashInput;
+
+  /// The component mole fractions passed to PVTPackage, kept to avoid an allocation per flash
+  mutable std::vector< double > m_compMoleFrac;
+
 };
 
 class MultiFluidPVTPackageWrapper : public MultiFluidBase
@@ -201,6 +286,7 @@ public:
   {
     return KernelWrapper( *m_fluid,
                           m_phaseTypes,
+                          m_flashInput,
                           m_componentMolarWeight,
                           m_useMass,
                           m_phaseFraction,
@@ -225,6 +311,14 @@ public:
                           m_dTotalDensity_dGlobalCompFraction );
   }
 
+  virtual void allocateConstitutiveData( dataRepository::Group * const parent,
+                                         localIndex const numConstitutivePointsPerParentIndex ) override;
+
+  struct viewKeyStruct : MultiFluidBase::viewKeyStruct
+  {
+    static constexpr auto flashInputString = "flashInput";
+  };
+
 protected:
 
   virtual void PostProcessInput() override;
@@ -239,6 +333,9 @@ protected:
 
   /// PVTPackage phase labels
   array1d< PVTPackage::PHASE_TYPE > m_phaseTypes;
+
+  /// The pressure, temperature and composition of the previous flash of each point
+  array3d< real64 > m_flashInput;
 };
 
 } //namespace constitutive
@@ -134,51 +134,28 @@ void BrineCO2DensityFunction::MakeTable( string_array const & inputPara )
 
   CalculateBrineDensity( pressures, temperatures, m, densities );
 
-  m_BrineDensityTable = std::make_shared< XYTable >( "BrineDensityTable", pressures, temperatures, densities );
+  m_BrineDensityTable = UniformXYTable( "BrineDensityTable", pressures, temperatures, densities );
 }
 
 
-void BrineCO2DensityFunction::Evaluation( EvalVarArgs const & pressure, EvalVarArgs const & temperature,
-                                          arraySlice1d< EvalVarArgs const > const & phaseComposition, EvalVarArgs & value, bool useMass ) const
+void BrineCO2DensityFunction::Evaluation( EvalVarArgs const & pressure,
+                                          EvalVarArgs const & temperature,
+                                          arraySlice1d< EvalVarArgs const > const & phaseComposition,
+                                          EvalVarArgs & value,
+                                          bool useMass ) const
 {
-  EvalArgs2D P, T, density;
-  P.m_var = pressure.m_var;
-  P.m_der[0] = 1.0;
-
-  T.m_var = temperature.m_var;
-  T.m_der[1] = 1.0;
-
-  density = m_BrineDensityTable->Value( P, T );
-
-  constexpr real64 a = 37.51;
-  constexpr real64 b = -9.585e-2;
-  constexpr real64 c = 8.740e-4;
-  constexpr real64 d = -5.044e-7;
-
-  real64 temp = T.m_var;
-
-  real64 const V = (a + b * temp + c * temp * temp + d * temp * temp * temp) * 1e-6;
-
-  real64 const CO2MW = m_componentMolarWeight[m_CO2Index];
-  real64 const waterMW = m_componentMolarWeight[m_waterIndex];
-
-  EvalVarArgs den, C, X;
-
-  den.m_var = density.m_var;
-  den.m_der[0] = density.m_der[0];
-
-  X = phaseComposition[m_CO2Index];
-
-  C = X * den / (waterMW * (1.0 - X));
+  createKernelWrapper().Compute( pressure, temperature, phaseComposition, value, useMass );
+}
 
-  if( useMass )
-  {
-    value = den + CO2MW * C - C * den * V;
-  }
-  else
-  {
-    value = den / waterMW + C - C * den * V / waterMW;
-  }
+PVTFunctionKernelWrapper BrineCO2DensityFunction::createKernelWrapper() const
+{
+  PVTFunctionKernelWrapper wrapper;
+  wrapper.m_type = PVTFunctionKernelWrapper::Type::BRINE_CO2_DENSITY;
+  wrapper.m_table = m_BrineDensityTable.createView();
+  wrapper.m_CO2MW = m_componentMolarWeight[m_CO2Index];
+  wrapper.m_waterMW = m_componentMolarWeight[m_waterIndex];
+  wrapper.m_CO2Index = m_CO2Index;
+  return wrapper;
 }
 
 void BrineCO2DensityFunction::CalculateBrineDensity( real64_array const & pressure, real64_array const & temperature, real64 const & salinity,
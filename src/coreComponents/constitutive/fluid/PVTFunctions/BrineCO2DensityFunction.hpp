@@ -55,13 +55,15 @@ public:
                            bool useMass = 0 ) const override;
 
 
+  virtual PVTFunctionKernelWrapper createKernelWrapper() const override;
+
 private:
 
   void MakeTable( string_array const & inputPara );
 
   void CalculateBrineDensity( real64_array const & pressure, real64_array const & temperature, real64 const & salinity, real64_array2d const & density );
 
-  TableFunctionPtr m_BrineDensityTable;
+  UniformXYTable m_BrineDensityTable;
   localIndex m_CO2Index;
   localIndex m_waterIndex;
 
@@ -73,13 +73,22 @@ void BrineViscosityFunction::MakeCoef( string_array const & inputPara )
 }
 
 
-void BrineViscosityFunction::Evaluation( EvalVarArgs const & GEOSX_UNUSED_PARAM(
-                                           pressure ), EvalVarArgs const & temperature, arraySlice1d< EvalVarArgs const > const & GEOSX_UNUSED_PARAM(
-                                           phaseComposition ), EvalVarArgs & value, bool GEOSX_UNUSED_PARAM( useMass )) const
+void BrineViscosityFunction::Evaluation( EvalVarArgs const & pressure,
+                                         EvalVarArgs const & temperature,
+                                         arraySlice1d< EvalVarArgs const > const & phaseComposition,
+                                         EvalVarArgs & value,
+                                         bool useMass ) const
 {
+  createKernelWrapper().Compute( pressure, temperature, phaseComposition, value, useMass );
+}
 
-  value = m_coef0 + m_coef1 * temperature;
-
+PVTFunctionKernelWrapper BrineViscosityFunction::createKernelWrapper() const
+{
+  PVTFunctionKernelWrapper wrapper;
+  wrapper.m_type = PVTFunctionKernelWrapper::Type::BRINE_VISCOSITY;
+  wrapper.m_coef0 = m_coef0;
+  wrapper.m_coef1 = m_coef1;
+  return wrapper;
 }
 
 REGISTER_CATALOG_ENTRY( PVTFunction,
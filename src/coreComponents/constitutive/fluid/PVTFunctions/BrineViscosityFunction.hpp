@@ -53,6 +53,8 @@ public:
                            arraySlice1d< EvalVarArgs const > const & phaseComposition,
                            EvalVarArgs & value, bool useMass = 0 ) const override;
 
+  virtual PVTFunctionKernelWrapper createKernelWrapper() const override;
+
 private:
 
   void MakeCoef( string_array const & inputPara );
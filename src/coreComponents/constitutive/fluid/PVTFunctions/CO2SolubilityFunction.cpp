@@ -19,6 +19,11 @@
 
 #include "constitutive/fluid/PVTFunctions/CO2SolubilityFunction.hpp"
 
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <algorithm>
+#include <fstream>
+
 namespace geosx
 {
 
@@ -28,8 +33,6 @@ using namespace stringutilities;
 namespace PVTProps
 {
 
-constexpr real64 minForDivision = 1e-10;
-
 constexpr real64 T_K_f = 273.15;
 constexpr real64 P_Pa_f = 1e+5;
 constexpr real64 P_c = 73.773 * P_Pa_f;
@@ -129,7 +132,17 @@ void CO2Solubility( real64 const & T, real64 const & P, real64 & V_r, real64 (*f
   }
 }
 
-void CalculateCO2Solubility( real64_array const & pressure, real64_array const & temperature, real64 const & salinity, real64_array2d const & solubiltiy )
+/**
+ * @brief Compute the CO2 solubility table.
+ * @param[in] pressure the pressures of the table
+ * @param[in] temperature the temperatures of the table
+ * @param[in] salinity the salinity
+ * @param[out] solubiltiy the solubilities at each pressure and temperature
+ *
+ * The pressure rows of the table are split among the ranks, each rank solving the fugacity equations of its rows
+ * only, and the rows are then summed over the ranks so that every rank holds the whole table.
+ */
+void CalculateCO2Solubility( real64_array const & pressure, real64_array const & temperature, real64 const & salinity, real64_array2d & solubiltiy )
 {
 
   real64 T, P, V_r, m, logK, y_CO2;
@@ -143,7 +156,14 @@ void CalculateCO2Solubility( real64_array const & pressure, real64_array const &
 
   m = salinity;
 
-  for( localIndex i = 0; i < pressure.size(); ++i )
+  localIndex const rank = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
+  localIndex const numRanks = MpiWrapper::Comm_size( MPI_COMM_GEOSX );
+  localIndex const firstRow = rank * pressure.size() / numRanks;
+  localIndex const lastRow = ( rank + 1 ) * pressure.size() / numRanks;
+
+  solubiltiy.setValues< serialPolicy >( 0.0 );
+
+  for( localIndex i = firstRow; i < lastRow; ++i )
   {
 
     P = pressure[i] / P_Pa_f;
@@ -165,6 +185,83 @@ void CalculateCO2Solubility( real64_array const & pressure, real64_array const &
 
   }
 
+  // the rows of the other ranks are zero, so the sum gathers the table exactly
+  real64_array2d localSolubility( solubiltiy );
+  MpiWrapper::allReduce( localSolubility.data(),
+                         solubiltiy.data(),
+                         LvArray::integerConversion< int >( solubiltiy.size() ),
+                         MPI_SUM,
+                         MPI_COMM_GEOSX );
+
+}
+
+/// The tag at the beginning of the CO2 solubility cache files
+constexpr char cacheFileTag[] = "GEOSX CO2 solubility table v1";
+
+/**
+ * @brief Read the CO2 solubility table from a cache file.
+ * @param[in] fileName the name of the cache file
+ * @param[in] parameters the parameters of the table: pressure and temperature ranges and salinity
+ * @param[out] solubility the solubilities, already sized
+ * @return whether the file exists and holds the table of the same parameters
+ *
+ * The file is read by the first rank and the table is broadcast to the others.
+ */
+bool ReadCO2SolubilityCache( string const & fileName, real64 const ( &parameters )[7], real64_array2d & solubility )
+{
+  integer found = 0;
+  if( MpiWrapper::Comm_rank( MPI_COMM_GEOSX ) == 0 )
+  {
+    std::ifstream file( fileName, std::ios::binary );
+    if( file )
+    {
+      char tag[ sizeof( cacheFileTag ) ];
+      localIndex size[2];
+      real64 fileParameters[7];
+      file.read( tag, sizeof( tag ) );
+      file.read( reinterpret_cast< char * >( size ), sizeof( size ) );
+      file.read( reinterpret_cast< char * >( fileParameters ), sizeof( fileParameters ) );
+
+      found = file && std::equal( tag, tag + sizeof( tag ), cacheFileTag ) &&
+              size[0] == solubility.size( 0 ) && size[1] == solubility.size( 1 ) &&
+              std::equal( parameters, parameters + 7, fileParameters );
+      if( found )
+      {
+        file.read( reinterpret_cast< char * >( solubility.data() ), solubility.size() * sizeof( real64 ) );
+        found = static_cast< bool >( file );
+      }
+      GEOSX_LOG_RANK_0_IF( !found, "The CO2 solubility cache file " << fileName << " does not match the table, it is recomputed" );
+    }
+  }
+
+  MpiWrapper::Broadcast( found, 0, MPI_COMM_GEOSX );
+  if( found )
+  {
+    MpiWrapper::bcast( solubility.data(), LvArray::integerConversion< int >( solubility.size() ), 0, MPI_COMM_GEOSX );
+  }
+  return found;
+}
+
+/**
+ * @brief Write the CO2 solubility table to a cache file from the first rank.
+ * @param[in] fileName the name of the cache file
+ * @param[in] parameters the parameters of the table: pressure and temperature ranges and salinity
+ * @param[in] solubility the solubilities
+ */
+void WriteCO2SolubilityCache( string const & fileName, real64 const ( &parameters )[7], real64_array2d const & solubility )
+{
+  if( MpiWrapper::Comm_rank( MPI_COMM_GEOSX ) != 0 )
+  {
+    return;
+  }
+
+  std::ofstream file( fileName, std::ios::binary );
+  localIndex const size[2] = { solubility.size( 0 ), solubility.size( 1 ) };
+  file.write( cacheFileTag, sizeof( cacheFileTag ) );
+  file.write( reinterpret_cast< char const * >( size ), sizeof( size ) );
+  file.write( reinterpret_cast< char const * >( parameters ), sizeof( parameters ) );
+  file.write( reinterpret_cast< char const * >( solubility.data() ), solubility.size() * sizeof( real64 ) );
+  GEOSX_WARNING_IF( !file, "Could not write the CO2 solubility cache file " << fileName );
 }
 
 
@@ -253,6 +350,8 @@ void CO2SolubilityFunction::MakeTable( string_array const & inputPara )
   real64 PStart, PEnd, dP;
   real64 TStart, TEnd, dT;
   real64 P, T, m;
+  bool cubic = false;
+  string cacheFileName;
 
   dT = -1.0;
   dP = -1.0;
@@ -284,6 +383,18 @@ void CO2SolubilityFunction::MakeTable( string_array const & inputPara )
 
   }
 
+  // optional interpolation of the table and name of its cache file
+  if( inputPara.size() > 9 )
+  {
+    GEOSX_ERROR_IF( inputPara[9] != "linear" && inputPara[9] != "cubic",
+                    "Invalid CO2Solubility interpolation " << inputPara[9] << ", expected linear or cubic" );
+    cubic = inputPara[9] == "cubic";
+  }
+  if( inputPara.size() > 10 )
+  {
+    cacheFileName = inputPara[10];
+  }
+
   P = PStart;
 
   while( P <= PEnd )
@@ -309,79 +420,39 @@ void CO2SolubilityFunction::MakeTable( string_array const & inputPara )
 
   real64_array2d solubilities( nP, nT );
 
-  CalculateCO2Solubility( pressures, temperatures, m, solubilities );
-
-  m_CO2SolubilityTable = std::make_shared< XYTable >( "CO2SolubilityTable", pressures, temperatures, solubilities );
-
-
-}
-
-void CO2SolubilityFunction::Partition( EvalVarArgs const & pressure, EvalVarArgs const & temperature, arraySlice1d< EvalVarArgs const > const & compFraction,
-                                       arraySlice1d< EvalVarArgs > const & phaseFraction, arraySlice2d< EvalVarArgs > const & phaseCompFraction ) const
-{
-
-  EvalArgs2D P, T, solubility;
-  P.m_var = pressure.m_var;
-  P.m_der[0] = 1.0;
-
-  T.m_var = temperature.m_var;
-  T.m_der[1] = 1.0;
-
-  //solubiltiy mol/kg(water)  X = Csat/W
-  solubility = m_CO2SolubilityTable->Value( P, T );
-
-  real64 const waterMW = m_componentMolarWeight[m_waterIndex];
-
-  solubility *= waterMW;
-
-  EvalVarArgs X, Y;
-
-  X.m_var = solubility.m_var;
-  X.m_der[0] = solubility.m_der[0];
-
-  //Y = C/W = z/(1-z)
-
-  if( compFraction[m_CO2Index].m_var > 1.0 - minForDivision )
+  real64 const parameters[7] = { PStart, PEnd, dP, TStart, TEnd, dT, m };
+  if( cacheFileName.empty() || !ReadCO2SolubilityCache( cacheFileName, parameters, solubilities ) )
   {
-    Y = compFraction[m_CO2Index] / minForDivision;
-  }
-  else
-  {
-    Y = compFraction[m_CO2Index] / (1.0 - compFraction[m_CO2Index]);
-  }
-
-  if( Y < X )
-  {
-    //liquid phase only
-
-    phaseFraction[m_phaseLiquidIndex] = 1.0;
-    phaseFraction[m_phaseGasIndex] = 0.0;
-
-    for( localIndex c = 0; c < m_componentNames.size(); ++c )
+    CalculateCO2Solubility( pressures, temperatures, m, solubilities );
+    if( !cacheFileName.empty() )
     {
-      phaseCompFraction[m_phaseLiquidIndex][c] = compFraction[c];
+      WriteCO2SolubilityCache( cacheFileName, parameters, solubilities );
     }
-
   }
-  else
-  {
-    // two-phase
-    // liquid phase fraction = (Csat + W) / (C + W) = (Csat/W + 1) / (C/W + 1)
 
-    phaseFraction[m_phaseLiquidIndex] = (X + 1.0)/ (Y + 1.0);
-    phaseFraction[m_phaseGasIndex] = 1.0 - phaseFraction[m_phaseLiquidIndex];
+  m_CO2SolubilityTable = UniformXYTable( "CO2SolubilityTable", pressures, temperatures, solubilities, cubic );
 
-    //liquid phase composition  CO2 = Csat / (Csat + W) = (Csat/W) / (Csat/W + 1)
 
-    phaseCompFraction[m_phaseLiquidIndex][m_CO2Index] = X / (X + 1.0);
-    phaseCompFraction[m_phaseLiquidIndex][m_waterIndex] = 1.0 - phaseCompFraction[m_phaseLiquidIndex][m_CO2Index];
-
-    //gas phase composition  CO2 = 1.0
+}
 
-    phaseCompFraction[m_phaseGasIndex][m_CO2Index] = 1.0;
-    phaseCompFraction[m_phaseGasIndex][m_waterIndex] = 0.0;
+void CO2SolubilityFunction::Partition( EvalVarArgs const & pressure, EvalVarArgs const & temperature, arraySlice1d< EvalVarArgs const > const & compFraction,
+                                       arraySlice1d< EvalVarArgs > const & phaseFraction, arraySlice2d< EvalVarArgs > const & phaseCompFraction ) const
+{
+  createKernelWrapper().Partition( pressure, temperature, compFraction, phaseFraction, phaseCompFraction );
+}
 
-  }
+FlashModelKernelWrapper CO2SolubilityFunction::createKernelWrapper() const
+{
+  FlashModelKernelWrapper wrapper;
+  wrapper.m_type = FlashModelKernelWrapper::Type::CO2_SOLUBILITY;
+  wrapper.m_table = m_CO2SolubilityTable.createView();
+  wrapper.m_waterMW = m_componentMolarWeight[m_waterIndex];
+  wrapper.m_numComponents = m_componentNames.size();
+  wrapper.m_CO2Index = m_CO2Index;
+  wrapper.m_waterIndex = m_waterIndex;
+  wrapper.m_phaseGasIndex = m_phaseGasIndex;
+  wrapper.m_phaseLiquidIndex = m_phaseLiquidIndex;
+  return wrapper;
 }
 
 
@@ -49,11 +49,13 @@ public:
                           arraySlice1d< EvalVarArgs > const & phaseFraction,
                           arraySlice2d< EvalVarArgs > const & phaseCompFraction ) const override;
 
+  virtual FlashModelKernelWrapper createKernelWrapper() const override;
+
 private:
 
   void MakeTable( const string_array & inputPara );
 
-  TableFunctionPtr m_CO2SolubilityTable;
+  UniformXYTable m_CO2SolubilityTable;
   localIndex m_CO2Index;
   localIndex m_waterIndex;
   localIndex m_phaseGasIndex;
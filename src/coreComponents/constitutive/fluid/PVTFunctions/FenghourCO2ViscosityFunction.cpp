@@ -100,24 +100,25 @@ void FenghourCO2ViscosityFunction::MakeTable( string_array const & inputPara )
 
   CalculateCO2Viscosity( pressures, temperatures, densities, viscosities );
 
-  m_CO2ViscosityTable = std::make_shared< XYTable >( "FenghourCO2ViscosityTable", pressures, temperatures, viscosities );
+  m_CO2ViscosityTable = UniformXYTable( "FenghourCO2ViscosityTable", pressures, temperatures, viscosities );
 
 }
 
-void FenghourCO2ViscosityFunction::Evaluation( EvalVarArgs const & pressure, EvalVarArgs const & temperature, arraySlice1d< EvalVarArgs const > const & GEOSX_UNUSED_PARAM(
-                                                 phaseComposition ), EvalVarArgs & value, bool GEOSX_UNUSED_PARAM( useMass )) const
+void FenghourCO2ViscosityFunction::Evaluation( EvalVarArgs const & pressure,
+                                               EvalVarArgs const & temperature,
+                                               arraySlice1d< EvalVarArgs const > const & phaseComposition,
+                                               EvalVarArgs & value,
+                                               bool useMass ) const
 {
-  EvalArgs2D P, T, viscosity;
-  P.m_var = pressure.m_var;
-  P.m_der[0] = 1.0;
-
-  T.m_var = temperature.m_var;
-  T.m_der[1] = 1.0;
-
-  viscosity = m_CO2ViscosityTable->Value( P, T );
+  createKernelWrapper().Compute( pressure, temperature, phaseComposition, value, useMass );
+}
 
-  value.m_var = viscosity.m_var;
-  value.m_der[0] = viscosity.m_der[0];
+PVTFunctionKernelWrapper FenghourCO2ViscosityFunction::createKernelWrapper() const
+{
+  PVTFunctionKernelWrapper wrapper;
+  wrapper.m_type = PVTFunctionKernelWrapper::Type::FENGHOUR_CO2_VISCOSITY;
+  wrapper.m_table = m_CO2ViscosityTable.createView();
+  return wrapper;
 }
 
 void FenghourCO2ViscosityFunction::FenghourCO2Viscosity( real64 const & Tcent, real64 const & den, real64 & vis )
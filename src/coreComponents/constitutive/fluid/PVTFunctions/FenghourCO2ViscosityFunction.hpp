@@ -53,6 +53,8 @@ public:
                            EvalVarArgs & value, bool useMass = 0 ) const override;
 
 
+  virtual PVTFunctionKernelWrapper createKernelWrapper() const override;
+
 private:
 
   void MakeTable( string_array const & inputPara );
@@ -62,7 +64,7 @@ private:
 
   void FenghourCO2Viscosity( real64 const & Tcent, real64 const & den, real64 & vis );
 
-  TableFunctionPtr m_CO2ViscosityTable;
+  UniformXYTable m_CO2ViscosityTable;
 };
 
 }
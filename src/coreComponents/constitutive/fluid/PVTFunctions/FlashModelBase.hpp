@@ -28,6 +28,105 @@ namespace geosx
 namespace PVTProps
 {
 
+/**
+ * @class FlashModelKernelWrapper
+ *
+ * Flat phase partition of a flash model, usable in device kernels. The model is selected by its type instead of
+ * through a virtual call, and each flash model fills the parameters it uses in FlashModel::createKernelWrapper.
+ */
+struct FlashModelKernelWrapper
+{
+  /// The flash models that can be evaluated
+  enum class Type : integer
+  {
+    UNKNOWN,
+    CO2_SOLUBILITY
+  };
+
+  /**
+   * @brief Compute the phase fractions and compositions.
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature in Celsius
+   * @param[in] compFraction the global component fractions
+   * @param[out] phaseFraction the phase fractions
+   * @param[out] phaseCompFraction the phase component fractions
+   */
+  GEOSX_HOST_DEVICE
+  inline void Partition( EvalVarArgs const & pressure,
+                         EvalVarArgs const & temperature,
+                         arraySlice1d< EvalVarArgs const > const & compFraction,
+                         arraySlice1d< EvalVarArgs > const & phaseFraction,
+                         arraySlice2d< EvalVarArgs > const & phaseCompFraction ) const
+  {
+    GEOSX_ERROR_IF( m_type != Type::CO2_SOLUBILITY, "Unknown flash model" );
+
+    //solubility mol/kg(water)  X = Csat/W
+    real64 solubility, dSolubility_dPres, dSolubility_dTemp;
+    m_table.Compute( pressure.m_var, temperature.m_var, solubility, dSolubility_dPres, dSolubility_dTemp );
+
+    EvalVarArgs X = solubility * m_waterMW;
+    X.m_der[0] = dSolubility_dPres * m_waterMW;
+
+    //Y = C/W = z/(1-z)
+    constexpr real64 minForDivision = 1e-10;
+    EvalVarArgs Y;
+    if( compFraction[m_CO2Index].m_var > 1.0 - minForDivision )
+    {
+      Y = compFraction[m_CO2Index] / minForDivision;
+    }
+    else
+    {
+      Y = compFraction[m_CO2Index] / (1.0 - compFraction[m_CO2Index]);
+    }
+
+    if( Y < X )
+    {
+      //liquid phase only
+      phaseFraction[m_phaseLiquidIndex] = 1.0;
+      phaseFraction[m_phaseGasIndex] = 0.0;
+
+      for( localIndex c = 0; c < m_numComponents; ++c )
+      {
+        phaseCompFraction[m_phaseLiquidIndex][c] = compFraction[c];
+      }
+    }
+    else
+    {
+      // two-phase
+      // liquid phase fraction = (Csat + W) / (C + W) = (Csat/W + 1) / (C/W + 1)
+      phaseFraction[m_phaseLiquidIndex] = (X + 1.0)/ (Y + 1.0);
+      phaseFraction[m_phaseGasIndex] = 1.0 - phaseFraction[m_phaseLiquidIndex];
+
+      //liquid phase composition  CO2 = Csat / (Csat + W) = (Csat/W) / (Csat/W + 1)
+      phaseCompFraction[m_phaseLiquidIndex][m_CO2Index] = X / (X + 1.0);
+      phaseCompFraction[m_phaseLiquidIndex][m_waterIndex] = 1.0 - phaseCompFraction[m_phaseLiquidIndex][m_CO2Index];
+
+      //gas phase composition  CO2 = 1.0
+      phaseCompFraction[m_phaseGasIndex][m_CO2Index] = 1.0;
+      phaseCompFraction[m_phaseGasIndex][m_waterIndex] = 0.0;
+    }
+  }
+
+  /// The type of the model
+  Type m_type = Type::UNKNOWN;
+
+  /// The pressure-temperature solubility table
+  UniformXYTableView m_table{};
+
+  /// The molar weight of water
+  real64 m_waterMW = 0.0;
+
+  /// The number of components
+  localIndex m_numComponents = 0;
+
+  /// The indices of the CO2 and water components
+  localIndex m_CO2Index = 0;
+  localIndex m_waterIndex = 0;
+
+  /// The indices of the gas and liquid phases
+  localIndex m_phaseGasIndex = 0;
+  localIndex m_phaseLiquidIndex = 0;
+};
 
 class FlashModel
 {
@@ -70,6 +169,12 @@ public:
                           arraySlice1d< EvalVarArgs > const & phaseFraction,
                           arraySlice2d< EvalVarArgs > const & phaseCompFraction ) const = 0;
 
+  /**
+   * @brief Create a kernel wrapper partitioning the phases in device kernels.
+   * @return the wrapper, valid as long as the model is alive
+   */
+  virtual FlashModelKernelWrapper createKernelWrapper() const = 0;
+
 protected:
   string m_modelName;
   string_array m_componentNames;
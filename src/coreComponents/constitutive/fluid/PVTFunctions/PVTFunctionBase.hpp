@@ -30,6 +30,111 @@ namespace PVTProps
 
 enum class PVTFuncType {UNKNOWN, DENSITY, VISCOSITY};
 
+/**
+ * @class PVTFunctionKernelWrapper
+ *
+ * Flat evaluation of a PVT function, usable in device kernels. The function is selected by its type instead of
+ * through a virtual call, and each PVT function fills the parameters it uses in PVTFunction::createKernelWrapper.
+ */
+struct PVTFunctionKernelWrapper
+{
+  /// The PVT functions that can be evaluated
+  enum class Type : integer
+  {
+    UNKNOWN,
+    SPAN_WAGNER_CO2_DENSITY,
+    BRINE_CO2_DENSITY,
+    FENGHOUR_CO2_VISCOSITY,
+    BRINE_VISCOSITY
+  };
+
+  /**
+   * @brief Evaluate the phase density or viscosity.
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature in Celsius
+   * @param[in] phaseComposition the phase component fractions
+   * @param[out] value the phase density or viscosity
+   * @param[in] useMass true for a mass density, false for a molar density
+   */
+  GEOSX_HOST_DEVICE
+  inline void Compute( EvalVarArgs const & pressure,
+                       EvalVarArgs const & temperature,
+                       arraySlice1d< EvalVarArgs const > const & phaseComposition,
+                       EvalVarArgs & value,
+                       bool const useMass ) const
+  {
+    real64 tableValue = 0.0, dTableValue_dPres = 0.0, dTableValue_dTemp = 0.0;
+    if( m_type != Type::BRINE_VISCOSITY )
+    {
+      m_table.Compute( pressure.m_var, temperature.m_var, tableValue, dTableValue_dPres, dTableValue_dTemp );
+    }
+
+    switch( m_type )
+    {
+      case Type::SPAN_WAGNER_CO2_DENSITY:
+      case Type::FENGHOUR_CO2_VISCOSITY:
+      {
+        real64 const scaling = ( m_type == Type::SPAN_WAGNER_CO2_DENSITY && !useMass ) ? 1.0 / m_CO2MW : 1.0;
+        value = tableValue * scaling;
+        value.m_der[0] = dTableValue_dPres * scaling;
+        break;
+      }
+      case Type::BRINE_CO2_DENSITY:
+      {
+        constexpr real64 a = 37.51;
+        constexpr real64 b = -9.585e-2;
+        constexpr real64 c = 8.740e-4;
+        constexpr real64 d = -5.044e-7;
+
+        real64 const temp = temperature.m_var;
+        real64 const V = (a + b * temp + c * temp * temp + d * temp * temp * temp) * 1e-6;
+
+        EvalVarArgs den = tableValue;
+        den.m_der[0] = dTableValue_dPres;
+
+        EvalVarArgs const & X = phaseComposition[m_CO2Index];
+        EvalVarArgs const C = X * den / (m_waterMW * (1.0 - X));
+
+        if( useMass )
+        {
+          value = den + m_CO2MW * C - C * den * V;
+        }
+        else
+        {
+          value = den / m_waterMW + C - C * den * V / m_waterMW;
+        }
+        break;
+      }
+      case Type::BRINE_VISCOSITY:
+      {
+        value = m_coef0 + m_coef1 * temperature;
+        break;
+      }
+      default:
+      {
+        GEOSX_ERROR( "Unknown PVT function" );
+      }
+    }
+  }
+
+  /// The type of the function
+  Type m_type = Type::UNKNOWN;
+
+  /// The pressure-temperature table of the function, if any
+  UniformXYTableView m_table{};
+
+  /// The constant and temperature coefficients of the brine viscosity
+  real64 m_coef0 = 0.0;
+  real64 m_coef1 = 0.0;
+
+  /// The molar weights of CO2 and water
+  real64 m_CO2MW = 0.0;
+  real64 m_waterMW = 0.0;
+
+  /// The index of the CO2 component
+  localIndex m_CO2Index = 0;
+};
+
 class PVTFunction
 {
 public:
@@ -68,6 +173,12 @@ public:
   virtual void Evaluation( EvalVarArgs const & pressure, EvalVarArgs const & temperature, arraySlice1d< EvalVarArgs const > const & phaseComposition,
                            EvalVarArgs & value, bool useMass = 0 ) const = 0;
 
+  /**
+   * @brief Create a kernel wrapper evaluating the function in device kernels.
+   * @return the wrapper, valid as long as the function is alive
+   */
+  virtual PVTFunctionKernelWrapper createKernelWrapper() const = 0;
+
 protected:
 
   string m_functionName;
@@ -214,37 +214,29 @@ void SpanWagnerCO2DensityFunction::MakeTable( string_array const & inputPara )
 
   CalculateCO2Density( pressures, temperatures, densities );
 
-  m_CO2DensityTable = std::make_shared< XYTable >( "SpanWagnerCO2DensityTable", pressures, temperatures, densities );
+  m_CO2DensityTable = UniformXYTable( "SpanWagnerCO2DensityTable", pressures, temperatures, densities );
 
 
 }
 
 
-void SpanWagnerCO2DensityFunction::Evaluation( EvalVarArgs const & pressure, EvalVarArgs const & temperature, arraySlice1d< EvalVarArgs const > const & GEOSX_UNUSED_PARAM(
-                                                 phaseComposition ), EvalVarArgs & value, bool useMass ) const
+void SpanWagnerCO2DensityFunction::Evaluation( EvalVarArgs const & pressure,
+                                               EvalVarArgs const & temperature,
+                                               arraySlice1d< EvalVarArgs const > const & phaseComposition,
+                                               EvalVarArgs & value,
+                                               bool useMass ) const
 {
+  createKernelWrapper().Compute( pressure, temperature, phaseComposition, value, useMass );
+}
 
-  EvalArgs2D P, T, density;
-  P.m_var = pressure.m_var;
-  P.m_der[0] = 1.0;
-
-  T.m_var = temperature.m_var;
-  T.m_der[1] = 1.0;
-
-  density = m_CO2DensityTable->Value( P, T );
-
-  real64 CO2MW = m_componentMolarWeight[m_CO2Index];
-
-  if( !useMass )
-  {
-
-    density /= CO2MW;
-
-  }
-
-  value.m_var = density.m_var;
-  value.m_der[0] = density.m_der[0];
-
+PVTFunctionKernelWrapper SpanWagnerCO2DensityFunction::createKernelWrapper() const
+{
+  PVTFunctionKernelWrapper wrapper;
+  wrapper.m_type = PVTFunctionKernelWrapper::Type::SPAN_WAGNER_CO2_DENSITY;
+  wrapper.m_table = m_CO2DensityTable.createView();
+  wrapper.m_CO2MW = m_componentMolarWeight[m_CO2Index];
+  wrapper.m_CO2Index = m_CO2Index;
+  return wrapper;
 }
 
 void SpanWagnerCO2DensityFunction::CalculateCO2Density( real64_array const & pressure, real64_array const & temperature, real64_array2d const & density )
@@ -54,6 +54,8 @@ public:
 
   static void CalculateCO2Density( real64_array const & pressure, real64_array const & temperature, real64_array2d const & density );
 
+  virtual PVTFunctionKernelWrapper createKernelWrapper() const override;
+
 private:
 
   void MakeTable( string_array const & inputPara );
@@ -61,7 +63,7 @@ private:
   static void SpanWagnerCO2Density( real64 const & T, real64 const & P, real64 & rho, real64 (*f)( real64 const & x1, real64 const & x2, real64 const & x3 ));
 
 
-  TableFunctionPtr m_CO2DensityTable;
+  UniformXYTable m_CO2DensityTable;
   localIndex m_CO2Index;
 
 };
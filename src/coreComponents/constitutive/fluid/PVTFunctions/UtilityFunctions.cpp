@@ -19,6 +19,8 @@
 
 #include "constitutive/fluid/PVTFunctions/UtilityFunctions.hpp"
 
+#include <cmath>
+
 namespace geosx
 {
 
@@ -89,6 +91,52 @@ EvalArgs2D XYTable::Value( EvalArgs2D const & x, EvalArgs2D const & y ) const
 }
 
 
+namespace
+{
+
+/**
+ * @brief Check that coordinates are uniformly spaced.
+ * @param[in] tableName the name of the table
+ * @param[in] coords the coordinates
+ * @return the inverse of the spacing
+ */
+real64 uniformInverseSpacing( string const & tableName, real64_array const & coords )
+{
+  localIndex const size = coords.size();
+  GEOSX_ERROR_IF( size < 2, "Table " << tableName << " needs at least two points along each coordinate" );
+
+  real64 const delta = ( coords[size-1] - coords[0] ) / ( size - 1 );
+  GEOSX_ERROR_IF( delta <= 0.0, "The coordinates of table " << tableName << " must be increasing" );
+  for( localIndex i = 1; i < size; ++i )
+  {
+    GEOSX_ERROR_IF( std::fabs( coords[i] - coords[0] - i * delta ) > 1e-6 * delta,
+                    "The coordinates of table " << tableName << " are not uniformly spaced" );
+  }
+  return 1.0 / delta;
+}
+
+} // namespace
+
+UniformXYTable::UniformXYTable( string const & tableName,
+                                real64_array const & x,
+                                real64_array const & y,
+                                real64_array2d const & value,
+                                bool const cubic ):
+  m_tableName( tableName ),
+  m_value( value )
+{
+  GEOSX_ERROR_IF( value.size( 0 ) != x.size() || value.size( 1 ) != y.size(),
+                  "The values of table " << tableName << " do not match its coordinates" );
+
+  m_grid.m_xMin = x[0];
+  m_grid.m_xInvDelta = uniformInverseSpacing( tableName, x );
+  m_grid.m_xSize = x.size();
+  m_grid.m_yMin = y[0];
+  m_grid.m_yInvDelta = uniformInverseSpacing( tableName, y );
+  m_grid.m_ySize = y.size();
+  m_grid.m_cubic = cubic;
+}
+
 template< class T >
 T XTable::GetValue( T const & x ) const
 {
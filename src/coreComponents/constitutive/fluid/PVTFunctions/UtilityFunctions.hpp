@@ -35,6 +35,7 @@ class EvalArgs
 {
 public:
 
+  GEOSX_HOST_DEVICE
   EvalArgs()
   {
     m_var = 0.0;
@@ -46,6 +47,7 @@ public:
 
   ~EvalArgs() = default;
 
+  GEOSX_HOST_DEVICE
   EvalArgs( const EvalArgs & arg )
   {
     m_var = arg.m_var;
@@ -55,6 +57,7 @@ public:
     }
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs( const T & var )
   {
     m_var = var;
@@ -64,6 +67,7 @@ public:
     }
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs & operator+=( const EvalArgs & arg )
   {
     this->m_var += arg.m_var;
@@ -76,6 +80,7 @@ public:
   }
 
 
+  GEOSX_HOST_DEVICE
   EvalArgs & operator-=( const EvalArgs & arg )
   {
     this->m_var -= arg.m_var;
@@ -87,6 +92,7 @@ public:
     return *this;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs & operator*=( const EvalArgs & arg )
   {
     const T & u = this->m_var;
@@ -104,6 +110,7 @@ public:
   }
 
 
+  GEOSX_HOST_DEVICE
   EvalArgs & operator/=( const EvalArgs & arg )
   {
     const T & u = this->m_var;
@@ -120,6 +127,7 @@ public:
     return *this;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs & Exponent( const EvalArgs & arg )
   {
     const T & v = arg.m_var;
@@ -133,6 +141,7 @@ public:
     return *this;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs operator+( const EvalArgs & arg ) const
   {
     EvalArgs result( *this );
@@ -140,6 +149,7 @@ public:
     return result;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs operator-( const EvalArgs & arg ) const
   {
     EvalArgs result( *this );
@@ -147,6 +157,7 @@ public:
     return result;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs operator-() const
   {
     EvalArgs result;
@@ -159,6 +170,7 @@ public:
     return result;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs operator*( const EvalArgs & arg ) const
   {
     EvalArgs result( *this );
@@ -166,6 +178,7 @@ public:
     return result;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs operator/( const EvalArgs & arg ) const
   {
     EvalArgs result( *this );
@@ -173,6 +186,7 @@ public:
     return result;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs & operator=( const EvalArgs & arg )
   {
     this->m_var = arg.m_var;
@@ -184,9 +198,10 @@ public:
     return *this;
   }
 
+  GEOSX_HOST_DEVICE
   bool operator==( const EvalArgs & arg ) const
   {
-    if( this->m_var != arg._m_var ) return false;
+    if( this->m_var != arg.m_var ) return false;
 
     for( localIndex i = 0; i < Dim; ++i )
     {
@@ -196,43 +211,51 @@ public:
     return true;
   }
 
+  GEOSX_HOST_DEVICE
   bool operator!=( const EvalArgs & arg ) const
   {
     return !(*this == arg);
   }
 
+  GEOSX_HOST_DEVICE
   bool operator>( const EvalArgs & arg ) const
   {
     return this->m_var > arg.m_var;
   }
 
+  GEOSX_HOST_DEVICE
   bool operator<( const EvalArgs & arg ) const
   {
     return this->m_var < arg.m_var;
   }
 
+  GEOSX_HOST_DEVICE
   bool operator>=( const EvalArgs & arg ) const
   {
     return this->m_var >= arg.m_var;
   }
 
+  GEOSX_HOST_DEVICE
   bool operator<=( const EvalArgs & arg ) const
   {
     return this->m_var <= arg.m_var;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs & operator+=( const T & arg )
   {
     this->m_var += arg;
     return *this;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs & operator-=( const T & arg )
   {
     this->m_var -= arg;
     return *this;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs & operator*=( const T & arg )
   {
     for( localIndex i = 0; i < Dim; ++i )
@@ -244,6 +267,7 @@ public:
     return *this;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs & operator/=( const T & arg )
   {
     for( localIndex i = 0; i < Dim; ++i )
@@ -255,6 +279,7 @@ public:
     return *this;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs operator+( const T & arg ) const
   {
     EvalArgs result( *this );
@@ -262,6 +287,7 @@ public:
     return result;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs operator-( const T & arg ) const
   {
     EvalArgs result( *this );
@@ -269,6 +295,7 @@ public:
     return result;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs operator*( const T & arg ) const
   {
     EvalArgs result( *this );
@@ -276,6 +303,7 @@ public:
     return result;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs operator/( const T & arg ) const
   {
     EvalArgs result( *this );
@@ -283,6 +311,7 @@ public:
     return result;
   }
 
+  GEOSX_HOST_DEVICE
   EvalArgs & operator=( const T & arg )
   {
     m_var = arg;
@@ -293,30 +322,36 @@ public:
     return *this;
   }
 
+  GEOSX_HOST_DEVICE
   bool operator==( const T & arg ) const
   {
     return this->m_var == arg;
   }
 
+  GEOSX_HOST_DEVICE
   bool operator!=( const T & arg ) const
   {
     return !(*this == arg);
   }
 
+  GEOSX_HOST_DEVICE
   bool operator>( const T & arg ) const
   {
     return this->m_var > arg;
   }
 
+  GEOSX_HOST_DEVICE
   bool operator<( const T & arg ) const
   {
     return this->m_var < arg;
   }
 
+  GEOSX_HOST_DEVICE
   bool operator>=( const T & arg ) const
   {
     return this->m_var >= arg;
   }
+  GEOSX_HOST_DEVICE
   bool operator<=( const T & arg ) const
   {
     return this->m_var <= arg;
@@ -327,6 +362,7 @@ public:
 };
 
 template< class T, int Dim >
+GEOSX_HOST_DEVICE
 inline EvalArgs< T, Dim > operator+( const T & arg1, const EvalArgs< T, Dim > & arg2 )
 {
   EvalArgs< T, Dim > result( arg2 );
@@ -335,6 +371,7 @@ inline EvalArgs< T, Dim > operator+( const T & arg1, const EvalArgs< T, Dim > &
 }
 
 template< class T, int Dim >
+GEOSX_HOST_DEVICE
 inline EvalArgs< T, Dim > operator-( const T & arg1, const EvalArgs< T, Dim > & arg2 )
 {
   EvalArgs< T, Dim > result( arg2 );
@@ -349,6 +386,7 @@ inline EvalArgs< T, Dim > operator-( const T & arg1, const EvalArgs< T, Dim > &
 }
 
 template< class T, int Dim >
+GEOSX_HOST_DEVICE
 inline EvalArgs< T, Dim > operator*( const T & arg1, const EvalArgs< T, Dim > & arg2 )
 {
   EvalArgs< T, Dim > result( arg2 );
@@ -357,6 +395,7 @@ inline EvalArgs< T, Dim > operator*( const T & arg1, const EvalArgs< T, Dim > &
 }
 
 template< class T, int Dim >
+GEOSX_HOST_DEVICE
 inline EvalArgs< T, Dim > operator/( const T & arg1, const EvalArgs< T, Dim > & arg2 )
 {
   EvalArgs< T, Dim > result( arg2 );
@@ -374,30 +413,35 @@ inline EvalArgs< T, Dim > operator/( const T & arg1, const EvalArgs< T, Dim > &
 
 
 template< class T, int Dim >
+GEOSX_HOST_DEVICE
 inline bool operator==( const T & arg1, const EvalArgs< T, Dim > & arg2 )
 {
   return (arg2 == arg1);
 }
 
 template< class T, int Dim >
+GEOSX_HOST_DEVICE
 inline bool operator!=( const T & arg1, const EvalArgs< T, Dim > & arg2 )
 {
   return (arg2 != arg1);
 }
 
 template< class T, int Dim >
+GEOSX_HOST_DEVICE
 inline bool operator>( const T & arg1, const EvalArgs< T, Dim > & arg2 )
 {
   return arg1 > arg2.m_var;
 }
 
 template< class T, int Dim >
+GEOSX_HOST_DEVICE
 inline bool operator<( const T & arg1, const EvalArgs< T, Dim > & arg2 )
 {
   return arg1 < arg2.m_var;
 }
 
 template< class T, int Dim >
+GEOSX_HOST_DEVICE
 inline bool operator>=( const T & arg1, const EvalArgs< T, Dim > & arg2 )
 {
   return arg1 >= arg2.m_var;
@@ -405,6 +449,7 @@ inline bool operator>=( const T & arg1, const EvalArgs< T, Dim > & arg2 )
 
 
 template< class T, int Dim >
+GEOSX_HOST_DEVICE
 inline bool operator<=( const T & arg1, const EvalArgs< T, Dim > & arg2 )
 {
   return arg1 <= arg2.m_var;
@@ -543,6 +588,237 @@ private:
 
 };
 
+/**
+ * @class UniformXYTableView
+ *
+ * Flat view of a bilinear or bicubic table on a uniform grid, cheap to copy and usable in device kernels. The cell of
+ * a point is computed directly from the precomputed inverse spacings, and the points outside of the grid are linearly
+ * extrapolated from the boundary cells as with XYTable.
+ *
+ * The bicubic interpolation is the tensor product of Catmull-Rom splines, whose nodal slopes are the centered
+ * differences of the values. It is exact for quadratic functions, continuously differentiable across the cells,
+ * and the values beyond the boundaries of the grid are linearly extrapolated to close the stencils of the boundary
+ * cells.
+ */
+struct UniformXYTableView
+{
+  /**
+   * @brief Interpolate the table at a point.
+   * @param[in] x the first coordinate
+   * @param[in] y the second coordinate
+   * @param[out] value the interpolated value
+   * @param[out] dValue_dX the derivative of the value with respect to @p x
+   * @param[out] dValue_dY the derivative of the value with respect to @p y
+   */
+  GEOSX_HOST_DEVICE
+  inline void Compute( real64 const x, real64 const y, real64 & value, real64 & dValue_dX, real64 & dValue_dY ) const
+  {
+    real64 const xCoord = ( x - m_xMin ) * m_xInvDelta;
+    real64 const yCoord = ( y - m_yMin ) * m_yInvDelta;
+    localIndex const i = static_cast< localIndex >( LvArray::math::min( LvArray::math::max( xCoord, 0.0 ), m_xSize - 2.0 ) );
+    localIndex const j = static_cast< localIndex >( LvArray::math::min( LvArray::math::max( yCoord, 0.0 ), m_ySize - 2.0 ) );
+    real64 const xWeight = xCoord - i;
+    real64 const yWeight = yCoord - j;
+
+    if( m_cubic && xWeight >= 0.0 && xWeight <= 1.0 && yWeight >= 0.0 && yWeight <= 1.0 )
+    {
+      localIndex xIndex[4], yIndex[4];
+      real64 xW[4], dxW[4], yW[4], dyW[4];
+      cubicWeights( xWeight, i, m_xSize, xIndex, xW, dxW );
+      cubicWeights( yWeight, j, m_ySize, yIndex, yW, dyW );
+
+      value = 0.0;
+      dValue_dX = 0.0;
+      dValue_dY = 0.0;
+      for( int a = 0; a < 4; ++a )
+      {
+        for( int b = 0; b < 4; ++b )
+        {
+          real64 const v = m_value[xIndex[a]][yIndex[b]];
+          value += xW[a] * yW[b] * v;
+          dValue_dX += dxW[a] * yW[b] * v;
+          dValue_dY += xW[a] * dyW[b] * v;
+        }
+      }
+      dValue_dX *= m_xInvDelta;
+      dValue_dY *= m_yInvDelta;
+      return;
+    }
+
+    real64 const v00 = m_value[i][j];
+    real64 const v01 = m_value[i][j+1];
+    real64 const v10 = m_value[i+1][j];
+    real64 const v11 = m_value[i+1][j+1];
+
+    value = v00 * ( 1.0 - xWeight ) * ( 1.0 - yWeight ) + v01 * ( 1.0 - xWeight ) * yWeight
+            + v11 * xWeight * yWeight + v10 * xWeight * ( 1.0 - yWeight );
+    dValue_dX = ( ( v10 - v00 ) * ( 1.0 - yWeight ) + ( v11 - v01 ) * yWeight ) * m_xInvDelta;
+    dValue_dY = ( ( v01 - v00 ) * ( 1.0 - xWeight ) + ( v11 - v10 ) * xWeight ) * m_yInvDelta;
+  }
+
+  /// The first coordinate of the first grid point
+  real64 m_xMin;
+
+  /// The inverse of the grid spacing along the first coordinate
+  real64 m_xInvDelta;
+
+  /// The number of grid points along the first coordinate
+  localIndex m_xSize;
+
+  /// The second coordinate of the first grid point
+  real64 m_yMin;
+
+  /// The inverse of the grid spacing along the second coordinate
+  real64 m_yInvDelta;
+
+  /// The number of grid points along the second coordinate
+  localIndex m_ySize;
+
+  /// The values at the grid points
+  arrayView2d< real64 const > m_value;
+
+  /// Whether the interpolation inside of the grid is bicubic instead of bilinear
+  bool m_cubic;
+
+private:
+
+  /**
+   * @brief Compute the Catmull-Rom weights of the four points of the stencil of a cell along a coordinate.
+   * @param[in] t the position in the cell, between 0 and 1
+   * @param[in] i the index of the first point of the cell
+   * @param[in] size the number of grid points along the coordinate
+   * @param[out] index the indices of the points of the stencil
+   * @param[out] weight the weights of the points
+   * @param[out] dWeight the derivatives of the weights with respect to @p t
+   *
+   * The extrapolated points beyond the boundaries of the grid are folded into the weights of the boundary points.
+   */
+  GEOSX_HOST_DEVICE
+  static inline void cubicWeights( real64 const t,
+                                   localIndex const i,
+                                   localIndex const size,
+                                   localIndex ( &index )[4],
+                                   real64 ( &weight )[4],
+                                   real64 ( &dWeight )[4] )
+  {
+    real64 const t2 = t * t;
+    real64 const t3 = t2 * t;
+
+    weight[0] = 0.5 * ( -t3 + 2.0 * t2 - t );
+    weight[1] = 0.5 * ( 3.0 * t3 - 5.0 * t2 + 2.0 );
+    weight[2] = 0.5 * ( -3.0 * t3 + 4.0 * t2 + t );
+    weight[3] = 0.5 * ( t3 - t2 );
+
+    dWeight[0] = 0.5 * ( -3.0 * t2 + 4.0 * t - 1.0 );
+    dWeight[1] = 0.5 * ( 9.0 * t2 - 10.0 * t );
+    dWeight[2] = 0.5 * ( -9.0 * t2 + 8.0 * t + 1.0 );
+    dWeight[3] = 0.5 * ( 3.0 * t2 - 2.0 * t );
+
+    for( int a = 0; a < 4; ++a )
+    {
+      index[a] = i - 1 + a;
+    }
+
+    // v[-1] = 2 v[0] - v[1]
+    if( index[0] < 0 )
+    {
+      weight[1] += 2.0 * weight[0];
+      weight[2] -= weight[0];
+      dWeight[1] += 2.0 * dWeight[0];
+      dWeight[2] -= dWeight[0];
+      weight[0] = 0.0;
+      dWeight[0] = 0.0;
+      index[0] = 0;
+    }
+
+    // v[size] = 2 v[size-1] - v[size-2]
+    if( index[3] > size - 1 )
+    {
+      weight[2] += 2.0 * weight[3];
+      weight[1] -= weight[3];
+      dWeight[2] += 2.0 * dWeight[3];
+      dWeight[1] -= dWeight[3];
+      weight[3] = 0.0;
+      dWeight[3] = 0.0;
+      index[3] = size - 1;
+    }
+  }
+};
+
+/**
+ * @class UniformXYTable
+ *
+ * Bilinear table on a uniform grid, such as the pressure-temperature tables built by the PVT functions. It owns
+ * the values and evaluates them without virtual dispatch or search through its UniformXYTableView.
+ */
+class UniformXYTable
+{
+public:
+
+  UniformXYTable() = default;
+
+  /**
+   * @brief Constructor.
+   * @param[in] tableName the name of the table
+   * @param[in] x the first coordinates of the grid points, which must be uniformly spaced
+   * @param[in] y the second coordinates of the grid points, which must be uniformly spaced
+   * @param[in] value the values at the grid points
+   * @param[in] cubic whether the interpolation inside of the grid is bicubic instead of bilinear
+   */
+  UniformXYTable( string const & tableName,
+                  real64_array const & x,
+                  real64_array const & y,
+                  real64_array2d const & value,
+                  bool const cubic = false );
+
+  /**
+   * @brief Get the name of the table.
+   * @return the name of the table
+   */
+  string const & TableName() const
+  {
+    return m_tableName;
+  }
+
+  /**
+   * @brief Interpolate the table at a point, with the derivatives of the coordinates propagated to the value.
+   * @param[in] x the first coordinate
+   * @param[in] y the second coordinate
+   * @return the interpolated value
+   */
+  EvalArgs2D Value( EvalArgs2D const & x, EvalArgs2D const & y ) const
+  {
+    EvalArgs2D out;
+    real64 dValue_dX, dValue_dY;
+    createView().Compute( x.m_var, y.m_var, out.m_var, dValue_dX, dValue_dY );
+    for( int i = 0; i < 2; ++i )
+    {
+      out.m_der[i] = dValue_dX * x.m_der[i] + dValue_dY * y.m_der[i];
+    }
+    return out;
+  }
+
+  /**
+   * @brief Create a view of the table to be captured in kernels.
+   * @return the view, valid as long as the table is alive
+   */
+  UniformXYTableView createView() const
+  {
+    UniformXYTableView view = m_grid;
+    view.m_value = m_value.toViewConst();
+    return view;
+  }
+
+private:
+
+  string m_tableName;
+  real64_array2d m_value;
+
+  /// The grid of the table, its values are set when a view is created
+  UniformXYTableView m_grid{};
+
+};
+
 } // namespace PVTProps
 } // namespace geosx
 
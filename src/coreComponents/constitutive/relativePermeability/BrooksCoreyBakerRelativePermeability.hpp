@@ -19,6 +19,7 @@
 #ifndef GEOSX_CONSTITUTIVE_RELPERM_BROOKSCOREYBAKERRELATIVEPERMEABILITY_HPP
 #define GEOSX_CONSTITUTIVE_RELPERM_BROOKSCOREYBAKERRELATIVEPERMEABILITY_HPP
 
+#include "constitutive/PowerFunction.hpp"
 #include "constitutive/relativePermeability/RelativePermeabilityBase.hpp"
 
 namespace geosx
@@ -326,21 +327,16 @@ BrooksCoreyBakerRelativePermeabilityUpdate::
                                real64 & relPerm,
                                real64 & dRelPerm_dVolFrac )
 {
-  relPerm           = 0.0;
-  dRelPerm_dVolFrac = 0.0;
+  // the power is evaluated in all cases, on a volume fraction kept in its domain, and the result is selected
+  // without branching
+  bool const isMobile = scaledVolFrac > 0.0 && scaledVolFrac < 1.0;
+  real64 const mobileVolFrac = isMobile ? scaledVolFrac : 1.0;
 
-  if( scaledVolFrac > 0.0 && scaledVolFrac < 1.0 )
-  {
-    // intermediate value
-    real64 const v = maxValue * std::pow( scaledVolFrac, exponent - 1.0 );
+  // intermediate value
+  real64 const v = maxValue * fastPow( mobileVolFrac, exponent - 1.0 );
 
-    relPerm = v * scaledVolFrac;
-    dRelPerm_dVolFrac = v * exponent * dScaledVolFrac_dVolFrac;
-  }
-  else
-  {
-    relPerm = (scaledVolFrac <= 0.0) ? 0.0 : maxValue;
-  }
+  relPerm = isMobile ? v * scaledVolFrac : ( (scaledVolFrac <= 0.0) ? 0.0 : maxValue );
+  dRelPerm_dVolFrac = isMobile ? v * exponent * dScaledVolFrac_dVolFrac : 0.0;
 }
 
 GEOSX_HOST_DEVICE
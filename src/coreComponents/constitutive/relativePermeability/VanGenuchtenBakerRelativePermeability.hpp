@@ -19,6 +19,7 @@
 #ifndef GEOSX_CONSTITUTIVE_VANGENUCHTENBAKERRELATIVEPERMEABILITY_HPP
 #define GEOSX_CONSTITUTIVE_VANGENUCHTENBAKERRELATIVEPERMEABILITY_HPP
 
+#include "constitutive/PowerFunction.hpp"
 #include "constitutive/relativePermeability/RelativePermeabilityBase.hpp"
 
 namespace geosx
@@ -332,26 +333,20 @@ VanGenuchtenBakerRelativePermeabilityUpdate::
 {
   real64 const exponent = 1.0 / exponentInv;
 
-  relPerm           = 0.0;
-  dRelPerm_dVolFrac = 0.0;
+  // the powers are evaluated in all cases, on a volume fraction kept in their domain, and the result is selected
+  // without branching
+  bool const isMobile = scaledVolFrac > 0.0 && scaledVolFrac < 1.0;
+  real64 const mobileVolFrac = isMobile ? scaledVolFrac : 0.5;
 
-  if( scaledVolFrac > 0.0 && scaledVolFrac < 1.0 )
-  {
-    // intermediate values
-    real64 const a = pow( scaledVolFrac, exponent-1 );
-    real64 const b = pow( 1 - a * scaledVolFrac, exponentInv-1 );
-    real64 const c = ( 1 - b * ( 1 - a * scaledVolFrac ) );
-    real64 const volFracSquared = scaledVolFrac * scaledVolFrac;
-    real64 const dVolFracSquared_dVolFrac = 2 * dScaledVolFrac_dVolFrac * scaledVolFrac;
-
-    relPerm = maxValue * volFracSquared * c;
-    dRelPerm_dVolFrac = dVolFracSquared_dVolFrac * c + volFracSquared * dScaledVolFrac_dVolFrac * a * b;
-    dRelPerm_dVolFrac *= maxValue;
-  }
-  else
-  {
-    relPerm = (scaledVolFrac <= 0.0) ? 0.0 : maxValue;
-  }
+  // intermediate values
+  real64 const a = fastPow( mobileVolFrac, exponent-1 );
+  real64 const b = fastPow( 1 - a * mobileVolFrac, exponentInv-1 );
+  real64 const c = ( 1 - b * ( 1 - a * mobileVolFrac ) );
+  real64 const volFracSquared = mobileVolFrac * mobileVolFrac;
+  real64 const dVolFracSquared_dVolFrac = 2 * dScaledVolFrac_dVolFrac * mobileVolFrac;
+
+  relPerm = isMobile ? maxValue * volFracSquared * c : ( (scaledVolFrac <= 0.0) ? 0.0 : maxValue );
+  dRelPerm_dVolFrac = isMobile ? maxValue * ( dVolFracSquared_dVolFrac * c + volFracSquared * dScaledVolFrac_dVolFrac * a * b ) : 0.0;
 }
 
 GEOSX_HOST_DEVICE
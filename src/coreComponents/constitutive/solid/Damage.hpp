@@ -32,8 +32,8 @@ class DamageUpdates : public UPDATE_BASE
 {
 public:
   template< typename ... PARAMS >
-  DamageUpdates( arrayView2d< real64 > const & inputDamage,
-                 arrayView2d< real64 > const & inputStrainEnergyDensity,
+  DamageUpdates( arrayView2d< solid::STATE_TYPE > const & inputDamage,
+                 arrayView2d< solid::STATE_TYPE > const & inputStrainEnergyDensity,
                  PARAMS && ... baseParams ):
     UPDATE_BASE( std::forward< PARAMS >( baseParams )... ),
     m_damage( inputDamage ),
@@ -104,8 +104,8 @@ public:
   }
 
 
-  arrayView2d< real64 > const m_damage;
-  arrayView2d< real64 > const m_strainEnergyDensity;
+  arrayView2d< solid::STATE_TYPE > const m_damage;
+  arrayView2d< solid::STATE_TYPE > const m_strainEnergyDensity;
 
 };
 
@@ -150,8 +150,8 @@ public:
 
 
 protected:
-  array2d< real64 > m_damage;
-  array2d< real64 > m_strainEnergyDensity;
+  array2d< solid::STATE_TYPE > m_damage;
+  array2d< solid::STATE_TYPE > m_strainEnergyDensity;
 };
 
 }
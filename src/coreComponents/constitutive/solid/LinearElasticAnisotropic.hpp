@@ -50,7 +50,7 @@ public:
    *                   point.
    */
   LinearElasticAnisotropicUpdates( arrayView3d< real64 const, solid::STIFFNESS_USD > const & C,
-                                   arrayView3d< real64, solid::STRESS_USD > const & stress ):
+                                   arrayView3d< solid::STATE_TYPE, solid::STRESS_USD > const & stress ):
     SolidBaseUpdates( stress ),
     m_stiffnessView( C )
   {}
@@ -81,6 +81,12 @@ public:
                             localIndex const q,
                             real64 const ( &voigtStrainInc )[ 6 ] ) const override final;
 
+  GEOSX_HOST_DEVICE
+  virtual void SmallStrain( localIndex const k,
+                            localIndex const q,
+                            real64 const ( &voigtStrainInc )[ 6 ],
+                            real64 ( &stress )[ 6 ] ) const override final;
+
   GEOSX_HOST_DEVICE
   virtual void HypoElastic( localIndex const k,
                             localIndex const q,
@@ -165,6 +171,20 @@ LinearElasticAnisotropicUpdates::
   LvArray::tensorOps::Ri_add_AijBj< 6, 6 >( m_stress[ k ][ q ], m_stiffnessView[ k ], voigtStrainInc );
 }
 
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void
+LinearElasticAnisotropicUpdates::
+  SmallStrain( localIndex const k,
+               localIndex const q,
+               real64 const ( &voigtStrainInc )[ 6 ],
+               real64 ( & stress )[ 6 ] ) const
+{
+  LvArray::tensorOps::copy< 6 >( stress, m_stress[ k ][ q ] );
+  LvArray::tensorOps::Ri_add_AijBj< 6, 6 >( stress, m_stiffnessView[ k ], voigtStrainInc );
+  LvArray::tensorOps::copy< 6 >( m_stress[ k ][ q ], stress );
+}
+
 GEOSX_HOST_DEVICE
 GEOSX_FORCE_INLINE
 void
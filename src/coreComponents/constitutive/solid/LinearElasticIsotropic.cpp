@@ -29,7 +29,10 @@ LinearElasticIsotropic::LinearElasticIsotropic( std::string const & name, Group
   m_defaultBulkModulus(),
   m_defaultShearModulus(),
   m_bulkModulus(),
-  m_shearModulus()
+  m_shearModulus(),
+  m_materialBulkModulus(),
+  m_materialShearModulus(),
+  m_materialIndex()
 {
   registerWrapper( viewKeyStruct::defaultBulkModulusString, &m_defaultBulkModulus )->
     setApplyDefaultValue( -1 )->
@@ -58,6 +61,20 @@ LinearElasticIsotropic::LinearElasticIsotropic( std::string const & name, Group
   registerWrapper( viewKeyStruct::shearModulusString, &m_shearModulus )->
     setApplyDefaultValue( -1 )->
     setDescription( "Elastic Shear Modulus" );
+
+  registerWrapper( viewKeyStruct::materialBulkModulusString, &m_materialBulkModulus )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Elastic Bulk Modulus of each material. If set, the moduli are read from this table "
+                    "(and materialShearModulus) instead of per-element fields, which are then not allocated" );
+
+  registerWrapper( viewKeyStruct::materialShearModulusString, &m_materialShearModulus )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Elastic Shear Modulus of each material" );
+
+  registerWrapper( viewKeyStruct::materialIndexString, &m_materialIndex )->
+    setApplyDefaultValue( 0 )->
+    setSizedFromParent( 0 )->
+    setDescription( "Material index Field, allocated when several materials are listed" );
 }
 
 
@@ -80,11 +97,52 @@ void LinearElasticIsotropic::setDefaultShearModulus( real64 const shearModulus )
 }
 
 
+void LinearElasticIsotropic::allocateConstitutiveData( dataRepository::Group * const parent,
+                                                       localIndex const numConstitutivePointsPerParentIndex )
+{
+  // the per-element fields are only allocated for the storage in use
+  bool const perMaterial = hasMaterialTable();
+  getWrapperBase( viewKeyStruct::bulkModulusString )->setSizedFromParent( perMaterial ? 0 : 1 );
+  getWrapperBase( viewKeyStruct::shearModulusString )->setSizedFromParent( perMaterial ? 0 : 1 );
+  getWrapperBase( viewKeyStruct::materialIndexString )->setSizedFromParent( m_materialBulkModulus.size() > 1 ? 1 : 0 );
+
+  SolidBase::allocateConstitutiveData( parent, numConstitutivePointsPerParentIndex );
+}
+
+
 void LinearElasticIsotropic::PostProcessInput()
 {
 
   SolidBase::PostProcessInput();
 
+  if( hasMaterialTable() )
+  {
+    GEOSX_ERROR_IF( m_materialShearModulus.size() != m_materialBulkModulus.size(),
+                    getName() << ": " << viewKeyStruct::materialBulkModulusString << " and " <<
+                    viewKeyStruct::materialShearModulusString << " must list the same number of materials" );
+    for( localIndex m = 0; m < m_materialBulkModulus.size(); ++m )
+    {
+      GEOSX_ERROR_IF( m_materialBulkModulus[m] <= 0.0 || m_materialShearModulus[m] <= 0.0,
+                      getName() << ": the moduli of the material " << m << " must be positive" );
+    }
+    GEOSX_ERROR_IF( getReference< real64 >( viewKeyStruct::defaultPoissonRatioString ) >= 0.0 ||
+                    getReference< real64 >( viewKeyStruct::defaultYoungsModulusString ) >= 0.0 ||
+                    m_defaultBulkModulus >= 0.0 || m_defaultShearModulus >= 0.0,
+                    getName() << ": the default elastic constants cannot be combined with a table of materials" );
+
+    // the defaults are those of the first material
+    m_defaultBulkModulus = m_materialBulkModulus[0];
+    m_defaultShearModulus = m_materialShearModulus[0];
+    real64 const K = m_defaultBulkModulus;
+    real64 const G = m_defaultShearModulus;
+    getReference< real64 >( viewKeyStruct::defaultYoungsModulusString ) = 9 * K * G / ( 3 * K + G );
+    getReference< real64 >( viewKeyStruct::defaultPoissonRatioString ) = ( 3 * K - 2 * G ) / ( 2 * ( 3 * K + G ) );
+    return;
+  }
+  GEOSX_ERROR_IF( m_materialShearModulus.size() > 0,
+                  getName() << ": " << viewKeyStruct::materialShearModulusString << " requires " <<
+                  viewKeyStruct::materialBulkModulusString );
+
   real64 & nu = getReference< real64 >( viewKeyStruct::defaultPoissonRatioString );
   real64 & E  = getReference< real64 >( viewKeyStruct::defaultYoungsModulusString );
   real64 & K  = m_defaultBulkModulus;
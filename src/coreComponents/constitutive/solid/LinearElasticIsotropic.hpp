@@ -20,6 +20,7 @@
 #define GEOSX_CONSTITUTIVE_SOLID_LINEARELASTICISOTROPIC_HPP_
 #include "SolidBase.hpp"
 #include "constitutive/ExponentialRelation.hpp"
+#include "constitutive/MaterialParameterView.hpp"
 #include "LvArray/src/tensorOps.hpp"
 #include "SolidModelDiscretizationOpsIsotropic.hpp"
 
@@ -42,16 +43,16 @@ public:
 
   /**
    * @brief Constructor
-   * @param[in] bulkModulus The ArrayView holding the bulk modulus data for each
-   *                        element.
-   * @param[in] shearModulus The ArrayView holding the shear modulus data for each
-   *                         element.
+   * @param[in] bulkModulus The view of the bulk modulus, stored per element or
+   *                        per material.
+   * @param[in] shearModulus The view of the shear modulus, stored per element or
+   *                         per material.
    * @param[in] stress The ArrayView holding the stress data for each quadrature
    *                   point.
    */
-  LinearElasticIsotropicUpdates( arrayView1d< real64 const > const & bulkModulus,
-                                 arrayView1d< real64 const > const & shearModulus,
-                                 arrayView3d< real64, solid::STRESS_USD > const & stress ):
+  LinearElasticIsotropicUpdates( MaterialParameterView const & bulkModulus,
+                                 MaterialParameterView const & shearModulus,
+                                 arrayView3d< solid::STATE_TYPE, solid::STRESS_USD > const & stress ):
     SolidBaseUpdates( stress ),
     m_bulkModulus( bulkModulus ),
     m_shearModulus( shearModulus )
@@ -153,6 +154,12 @@ public:
                             localIndex const q,
                             real64 const ( &voigtStrainInc )[ 6 ] ) const override final;
 
+  GEOSX_HOST_DEVICE
+  virtual void SmallStrain( localIndex const k,
+                            localIndex const q,
+                            real64 const ( &voigtStrainInc )[ 6 ],
+                            real64 ( &stress )[ 6 ] ) const override final;
+
   GEOSX_HOST_DEVICE
   virtual void HypoElastic( localIndex const k,
                             localIndex const q,
@@ -174,11 +181,11 @@ public:
                                                localIndex const q ) const override;
 
 private:
-  /// A reference to the ArrayView holding the bulk modulus for each element.
-  arrayView1d< real64 const > const m_bulkModulus;
+  /// The view of the bulk modulus of each element.
+  MaterialParameterView const m_bulkModulus;
 
-  /// A reference to the ArrayView holding the shear modulus for each element.
-  arrayView1d< real64 const > const m_shearModulus;
+  /// The view of the shear modulus of each element.
+  MaterialParameterView const m_shearModulus;
 
 };
 
@@ -222,6 +229,27 @@ void LinearElasticIsotropicUpdates::SmallStrain( localIndex const k,
 
 }
 
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void LinearElasticIsotropicUpdates::SmallStrain( localIndex const k,
+                                                 localIndex const q,
+                                                 real64 const ( &voigtStrainInc )[ 6 ],
+                                                 real64 ( & stress )[ 6 ] ) const
+{
+  real64 const lambda = m_bulkModulus[k] - 2.0/3.0 * m_shearModulus[k];
+  real64 const volStrain = ( voigtStrainInc[0] + voigtStrainInc[1] + voigtStrainInc[2] );
+  real64 const TwoG = 2.0 * m_shearModulus[k];
+
+  stress[0] = m_stress( k, q, 0 ) + TwoG * voigtStrainInc[0] + lambda * volStrain;
+  stress[1] = m_stress( k, q, 1 ) + TwoG * voigtStrainInc[1] + lambda * volStrain;
+  stress[2] = m_stress( k, q, 2 ) + TwoG * voigtStrainInc[2] + lambda * volStrain;
+  stress[3] = m_stress( k, q, 3 ) + m_shearModulus[k] * voigtStrainInc[3];
+  stress[4] = m_stress( k, q, 4 ) + m_shearModulus[k] * voigtStrainInc[4];
+  stress[5] = m_stress( k, q, 5 ) + m_shearModulus[k] * voigtStrainInc[5];
+
+  LvArray::tensorOps::copy< 6 >( m_stress[ k ][ q ], stress );
+}
+
 GEOSX_HOST_DEVICE
 GEOSX_FORCE_INLINE
 void LinearElasticIsotropicUpdates::HypoElastic( localIndex const k,
@@ -233,15 +261,17 @@ void LinearElasticIsotropicUpdates::HypoElastic( localIndex const k,
   real64 const volStrain = ( Ddt[ 0 ] + Ddt[ 1 ] + Ddt[ 2 ] );
   real64 const TwoG = 2.0 * m_shearModulus[ k ];
 
-  m_stress( k, q, 0 ) =  m_stress( k, q, 0 ) + TwoG * Ddt[ 0 ] + lambda * volStrain;
-  m_stress( k, q, 1 ) =  m_stress( k, q, 1 ) + TwoG * Ddt[ 1 ] + lambda * volStrain;
-  m_stress( k, q, 2 ) =  m_stress( k, q, 2 ) + TwoG * Ddt[ 2 ] + lambda * volStrain;
-  m_stress( k, q, 3 ) =  m_stress( k, q, 3 ) + TwoG * Ddt[ 3 ];
-  m_stress( k, q, 4 ) =  m_stress( k, q, 4 ) + TwoG * Ddt[ 4 ];
-  m_stress( k, q, 5 ) =  m_stress( k, q, 5 ) + TwoG * Ddt[ 5 ];
-
-  real64 temp[ 6 ] = { 0 };
-  LvArray::tensorOps::Rij_eq_AikSymBklAjl< 3 >( temp, Rot, m_stress[ k ][ q ] );
+  // the stress is read and written once, the increment and the rotation are applied in registers
+  real64 stress[ 6 ];
+  stress[ 0 ] = m_stress( k, q, 0 ) + TwoG * Ddt[ 0 ] + lambda * volStrain;
+  stress[ 1 ] = m_stress( k, q, 1 ) + TwoG * Ddt[ 1 ] + lambda * volStrain;
+  stress[ 2 ] = m_stress( k, q, 2 ) + TwoG * Ddt[ 2 ] + lambda * volStrain;
+  stress[ 3 ] = m_stress( k, q, 3 ) + TwoG * Ddt[ 3 ];
+  stress[ 4 ] = m_stress( k, q, 4 ) + TwoG * Ddt[ 4 ];
+  stress[ 5 ] = m_stress( k, q, 5 ) + TwoG * Ddt[ 5 ];
+
+  real64 temp[ 6 ];
+  LvArray::tensorOps::Rij_eq_AikSymBklAjl< 3 >( temp, Rot, stress );
   LvArray::tensorOps::copy< 6 >( m_stress[ k ][ q ], temp );
 }
 
@@ -379,6 +409,13 @@ public:
     static constexpr auto bulkModulusString  = "BulkModulus";
     /// string/key for shear modulus
     static constexpr auto shearModulusString = "ShearModulus";
+
+    /// string/key for the bulk modulus of each material
+    static constexpr auto materialBulkModulusString = "materialBulkModulus";
+    /// string/key for the shear modulus of each material
+    static constexpr auto materialShearModulusString = "materialShearModulus";
+    /// string/key for the material index of each element
+    static constexpr auto materialIndexString = "materialIndex";
   };
 
   /**
@@ -421,6 +458,42 @@ public:
    */
   arrayView1d< real64 const > shearModulus() const { return m_shearModulus; }
 
+  /**
+   * @brief Check whether the moduli are stored in a table of materials.
+   * @return @p true if the moduli are stored per material, in which case the
+   *         per-element arrays are not allocated
+   */
+  bool hasMaterialTable() const { return m_materialBulkModulus.size() > 0; }
+
+  /**
+   * @brief Accessor for the material index of each element.
+   * @return The material index, empty unless the table holds several materials.
+   */
+  arrayView1d< integer const > materialIndex() const { return m_materialIndex; }
+
+  /**
+   * @brief Accessor for the bulk modulus, stored per element or per material.
+   * @return The view of the bulk modulus of each element.
+   */
+  MaterialParameterView bulkModulusParameter() const
+  {
+    return hasMaterialTable() ? MaterialParameterView( m_materialBulkModulus, m_materialIndex )
+                              : MaterialParameterView( m_bulkModulus );
+  }
+
+  /**
+   * @brief Accessor for the shear modulus, stored per element or per material.
+   * @return The view of the shear modulus of each element.
+   */
+  MaterialParameterView shearModulusParameter() const
+  {
+    return hasMaterialTable() ? MaterialParameterView( m_materialShearModulus, m_materialIndex )
+                              : MaterialParameterView( m_shearModulus );
+  }
+
+  virtual void allocateConstitutiveData( dataRepository::Group * const parent,
+                                         localIndex const numConstitutivePointsPerParentIndex ) override;
+
   /**
    * @brief Create a instantiation of the LinearElasticIsotropicUpdate class
    *        that refers to the data in this.
@@ -430,13 +503,13 @@ public:
   {
     if( includeState )
     {
-      return LinearElasticIsotropicUpdates( m_bulkModulus, m_shearModulus, m_stress );
+      return LinearElasticIsotropicUpdates( bulkModulusParameter(), shearModulusParameter(), m_stress );
     }
     else
     {
-      return LinearElasticIsotropicUpdates( m_bulkModulus,
-                                            m_shearModulus,
-                                            arrayView3d< real64, solid::STRESS_USD >() );
+      return LinearElasticIsotropicUpdates( bulkModulusParameter(),
+                                            shearModulusParameter(),
+                                            arrayView3d< solid::STATE_TYPE, solid::STRESS_USD >() );
     }
   }
 
@@ -452,8 +525,8 @@ public:
   UPDATE_KERNEL createDerivedKernelUpdates( PARAMS && ... constructorParams )
   {
     return UPDATE_KERNEL( std::forward< PARAMS >( constructorParams )...,
-                          m_bulkModulus,
-                          m_shearModulus,
+                          bulkModulusParameter(),
+                          shearModulusParameter(),
                           m_stress );
   }
 
@@ -475,6 +548,15 @@ private:
   /// The shear modulus for each upper level dimension (i.e. cell) of *this
   array1d< real64 > m_shearModulus;
 
+  /// The bulk modulus of each material, empty if the moduli are stored per element
+  array1d< real64 > m_materialBulkModulus;
+
+  /// The shear modulus of each material, empty if the moduli are stored per element
+  array1d< real64 > m_materialShearModulus;
+
+  /// The material index for each upper level dimension (i.e. cell) of *this, if there are several materials
+  array1d< integer > m_materialIndex;
+
 };
 
 }
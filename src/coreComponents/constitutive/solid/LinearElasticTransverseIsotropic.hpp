@@ -57,7 +57,7 @@ public:
                                            arrayView1d< real64 const > const & c33,
                                            arrayView1d< real64 const > const & c44,
                                            arrayView1d< real64 const > const & c66,
-                                           arrayView3d< real64, solid::STRESS_USD > const & stress ):
+                                           arrayView3d< solid::STATE_TYPE, solid::STRESS_USD > const & stress ):
     SolidBaseUpdates( stress ),
     m_c11( c11 ),
     m_c13( c13 ),
@@ -92,6 +92,12 @@ public:
                             localIndex const q,
                             real64 const ( &voigtStrainInc )[ 6 ] ) const override final;
 
+  GEOSX_HOST_DEVICE
+  virtual void SmallStrain( localIndex const k,
+                            localIndex const q,
+                            real64 const ( &voigtStrainInc )[ 6 ],
+                            real64 ( &stress )[ 6 ] ) const override final;
+
   GEOSX_HOST_DEVICE
   virtual void HypoElastic( localIndex const k,
                             localIndex const q,
@@ -208,6 +214,26 @@ LinearElasticTransverseIsotropicUpdates::
   m_stress( k, q, 5 ) = m_stress( k, q, 5 ) + m_c66[ k ] * voigtStrainInc[ 5 ];
 }
 
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void
+LinearElasticTransverseIsotropicUpdates::
+  SmallStrain( localIndex const k,
+               localIndex const q,
+               real64 const ( &voigtStrainInc )[ 6 ],
+               real64 ( & stress )[ 6 ] ) const
+{
+  real64 const temp = m_c11[ k ] * ( voigtStrainInc[ 0 ] + voigtStrainInc[ 1 ] ) + m_c13[ k ] * voigtStrainInc[ 2 ];
+  stress[ 0 ] = m_stress( k, q, 0 ) - 2.0 * m_c66[ k ] * voigtStrainInc[ 1 ] + temp;
+  stress[ 1 ] = m_stress( k, q, 1 ) - 2.0 * m_c66[ k ] * voigtStrainInc[ 0 ] + temp;
+  stress[ 2 ] = m_stress( k, q, 2 ) + m_c13[ k ] * ( voigtStrainInc[ 0 ] + voigtStrainInc[ 1 ] ) + m_c33[ k ] * voigtStrainInc[ 2 ];
+  stress[ 3 ] = m_stress( k, q, 3 ) + m_c44[ k ] * voigtStrainInc[ 3 ];
+  stress[ 4 ] = m_stress( k, q, 4 ) + m_c44[ k ] * voigtStrainInc[ 4 ];
+  stress[ 5 ] = m_stress( k, q, 5 ) + m_c66[ k ] * voigtStrainInc[ 5 ];
+
+  LvArray::tensorOps::copy< 6 >( m_stress[ k ][ q ], stress );
+}
+
 GEOSX_HOST_DEVICE
 GEOSX_FORCE_INLINE
 void
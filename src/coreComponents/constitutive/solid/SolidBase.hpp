@@ -53,7 +53,7 @@ protected:
    * @brief constructor
    * @param[in] stress The stress data from the constitutive model class.
    */
-  SolidBaseUpdates( arrayView3d< real64, solid::STRESS_USD > const & stress ):
+  SolidBaseUpdates( arrayView3d< solid::STATE_TYPE, solid::STRESS_USD > const & stress ):
     m_stress( stress )
   {}
 
@@ -95,7 +95,7 @@ public:
   }
 
   /// A reference the material stress at quadrature points.
-  arrayView3d< real64, solid::STRESS_USD > const m_stress;
+  arrayView3d< solid::STATE_TYPE, solid::STRESS_USD > const m_stress;
 
 private:
   /**
@@ -134,6 +134,24 @@ private:
                             localIndex const q,
                             real64 const ( &voigtStrainInc )[ 6 ] ) const = 0;
 
+  /**
+   * @brief Update the constitutive state using input generated under small
+   *        strain assumptions, and return the updated stress.
+   * @param[in] k The element index.
+   * @param[in] q The quadrature point index.
+   * @param[in] voigtStrainIncrement The increment in strain expressed in Voigt
+   *                                 notation.
+   * @param[out] stress The updated stress in Voigt notation.
+   *
+   * The stress state is read and written once, the updated stress is kept on the
+   * stack so that the caller does not have to reload it from the state array.
+   */
+  GEOSX_HOST_DEVICE
+  virtual void SmallStrain( localIndex const k,
+                            localIndex const q,
+                            real64 const ( &voigtStrainInc )[ 6 ],
+                            real64 ( &stress )[ 6 ] ) const = 0;
+
   /**
    * @brief Hypoelastic update to the constitutive state using input generated
    *        under finite strain assumptions.
@@ -240,10 +258,10 @@ public:
   arrayView2d< real64 const > getDensity() const { return m_density; }
 
   /// Non-const/mutable accessor for stress
-  arrayView3d< real64, solid::STRESS_USD > getStress() { return m_stress; }
+  arrayView3d< solid::STATE_TYPE, solid::STRESS_USD > getStress() { return m_stress; }
 
   /// Const/non-mutable accessor for stress
-  arrayView3d< real64 const, solid::STRESS_USD > getStress() const { return m_stress; }
+  arrayView3d< solid::STATE_TYPE const, solid::STRESS_USD > getStress() const { return m_stress; }
 
   ///@}
 
@@ -258,7 +276,7 @@ protected:
 
   /// The material stress at a quadrature point.
 
-  array3d< real64, solid::STRESS_PERMUTATION > m_stress;
+  array3d< solid::STATE_TYPE, solid::STRESS_PERMUTATION > m_stress;
 };
 
 } // namespace constitutive
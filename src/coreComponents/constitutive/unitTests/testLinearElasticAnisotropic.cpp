@@ -20,6 +20,15 @@
 #include "constitutive/solid/LinearElasticAnisotropic.hpp"
 
 #include "dataRepository/xmlWrapper.hpp"
+
+#if defined( GEOSX_USE_SINGLE_PRECISION_SOLID_STATE )
+/// The stress state is rounded to single precision after each update.
+#define EXPECT_STATE_EQ( state, expected ) EXPECT_FLOAT_EQ( state, expected )
+#else
+/// The stress state is stored in double precision.
+#define EXPECT_STATE_EQ( state, expected ) EXPECT_DOUBLE_EQ( state, expected )
+#endif
+
 using namespace geosx;
 using namespace ::geosx::constitutive;
 
@@ -40,7 +49,7 @@ TEST( LinearElasticAnisotropicTests, testAllocation )
 //  arrayView1d<LinearElasticAnisotropic::StiffnessTensor const> const &
 //  stiffness = cm.stiffness() ;
 
-  arrayView3d< real64 const, solid::STRESS_USD > const & stress = cm.getStress().toViewConst();
+  arrayView3d< solid::STATE_TYPE const, solid::STRESS_USD > const & stress = cm.getStress().toViewConst();
 
 //  EXPECT_EQ( stiffness.size(), numElems );
   EXPECT_EQ( stress.size( 0 ), numElems );
@@ -72,14 +81,14 @@ void voigtStrain( real64 strainVoigt[6], real64 const Ddt[ 6 ] )
   strainVoigt[5] = Ddt[ 5 ] * 2;
 }
 
-void stressSliceCheck( arrayView3d< real64 const, solid::STRESS_USD > const & stress, real64 const stressV[6] )
+void stressSliceCheck( arrayView3d< solid::STATE_TYPE const, solid::STRESS_USD > const & stress, real64 const stressV[6] )
 {
-  ASSERT_DOUBLE_EQ( stress( 0, 0, 0 ), stressV[0] );
-  ASSERT_DOUBLE_EQ( stress( 0, 0, 1 ), stressV[1] );
-  ASSERT_DOUBLE_EQ( stress( 0, 0, 2 ), stressV[2] );
-  ASSERT_DOUBLE_EQ( stress( 0, 0, 3 ), stressV[3] );
-  ASSERT_DOUBLE_EQ( stress( 0, 0, 4 ), stressV[4] );
-  ASSERT_DOUBLE_EQ( stress( 0, 0, 5 ), stressV[5] );
+  EXPECT_STATE_EQ( stress( 0, 0, 0 ), stressV[0] );
+  EXPECT_STATE_EQ( stress( 0, 0, 1 ), stressV[1] );
+  EXPECT_STATE_EQ( stress( 0, 0, 2 ), stressV[2] );
+  EXPECT_STATE_EQ( stress( 0, 0, 3 ), stressV[3] );
+  EXPECT_STATE_EQ( stress( 0, 0, 4 ), stressV[4] );
+  EXPECT_STATE_EQ( stress( 0, 0, 5 ), stressV[5] );
 }
 
 void stressCheck( real64 const stressV[6], real64 const stressV2[6] )
@@ -143,6 +152,13 @@ TEST( LinearElasticAnisotropicTests, testStateUpdatePoint )
     stressSliceCheck( stateStress, stressV );
 
     stateStress.setValues< serialPolicy >( 0 );
+    LvArray::tensorOps::fill< 6 >( stressV2, 0 );
+    cw.SmallStrain( 0, 0, strainV, stressV2 );
+    stressSliceCheck( stateStress, stressV );
+    stressCheck( stressV, stressV2 );
+
+    stateStress.setValues< serialPolicy >( 0 );
+    LvArray::tensorOps::fill< 6 >( stressV2, 0 );
     cw.SmallStrainNoState( 0, strainV, stressV2 );
     stressCheck( stressV, stressV2 );
 
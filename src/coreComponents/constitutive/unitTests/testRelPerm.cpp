@@ -16,6 +16,7 @@
 #include "managers/initialization.hpp"
 #include "common/DataTypes.hpp"
 #include "common/TimingMacros.hpp"
+#include "constitutive/PowerFunction.hpp"
 #include "constitutive/relativePermeability/relativePermeabilitySelector.hpp"
 #include "physicsSolvers/fluidFlow/unitTests/testCompFlowUtils.hpp"
 
@@ -368,6 +369,22 @@ TEST( testRelPerm, numericalDerivatives_VanGenuchtenBakerRelPermThreePhase )
   }
 }
 
+TEST( testRelPerm, fastPowAccuracy )
+{
+  // the exponents and volume fractions of the relperm and capillary pressure models
+  real64 const exponents[] = { -4.5, -2.0, -1.0, -0.5, 0.25, 0.5, 1.0, 1.5, 2.0, 3.0, 7.0 };
+
+  for( real64 const y : exponents )
+  {
+    for( integer i = 1; i < 1000; ++i )
+    {
+      real64 const x = i * 1e-3;
+      real64 const expected = std::pow( x, y );
+      EXPECT_LE( std::fabs( fastPow( x, y ) - expected ), fastPowTolerance( x, y ) * expected ) << "x = " << x << ", y = " << y;
+    }
+  }
+}
+
 
 int main( int argc, char * * argv )
 {
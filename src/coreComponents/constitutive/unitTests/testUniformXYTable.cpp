@@ -0,0 +1,122 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "constitutive/fluid/PVTFunctions/UtilityFunctions.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::PVTProps;
+
+namespace
+{
+
+/// Build a table of @p f on a 5 x 7 grid, x in [0,4] and y in [0,3].
+template< typename FUNC >
+UniformXYTable makeTable( FUNC && f, bool const cubic )
+{
+  real64_array x( 5 );
+  real64_array y( 7 );
+  for( localIndex i = 0; i < x.size(); ++i )
+  {
+    x[i] = i;
+  }
+  for( localIndex j = 0; j < y.size(); ++j )
+  {
+    y[j] = 0.5 * j;
+  }
+
+  real64_array2d value( x.size(), y.size() );
+  for( localIndex i = 0; i < x.size(); ++i )
+  {
+    for( localIndex j = 0; j < y.size(); ++j )
+    {
+      value[i][j] = f( x[i], y[j] );
+    }
+  }
+  return UniformXYTable( "table", x, y, value, cubic );
+}
+
+}
+
+TEST( UniformXYTable, bilinearIsExactForBilinearFunctions )
+{
+  auto const f = []( real64 const x, real64 const y ) { return 1.0 + 2.0 * x - y + 0.25 * x * y; };
+  UniformXYTableView const table = makeTable( f, false ).createView();
+
+  // inside of the grid and extrapolated
+  for( real64 const x : { -0.5, 0.3, 1.0, 2.7, 4.0, 4.6 } )
+  {
+    for( real64 const y : { -0.2, 0.1, 1.25, 3.0, 3.4 } )
+    {
+      real64 value, dValue_dX, dValue_dY;
+      table.Compute( x, y, value, dValue_dX, dValue_dY );
+      EXPECT_NEAR( value, f( x, y ), 1e-12 );
+      EXPECT_NEAR( dValue_dX, 2.0 + 0.25 * y, 1e-12 );
+      EXPECT_NEAR( dValue_dY, -1.0 + 0.25 * x, 1e-12 );
+    }
+  }
+}
+
+TEST( UniformXYTable, bicubicIsExactForQuadraticFunctions )
+{
+  auto const f = []( real64 const x, real64 const y )
+  { return 1.0 + 2.0 * x - y + 0.5 * x * x + 0.25 * x * y - 0.75 * y * y; };
+  UniformXYTableView const table = makeTable( f, true ).createView();
+
+  // the cells away from the boundaries have their whole stencil in the grid
+  for( real64 const x : { 1.0, 1.3, 2.0, 2.5, 3.0 } )
+  {
+    for( real64 const y : { 0.5, 0.8, 1.25, 2.0, 2.5 } )
+    {
+      real64 value, dValue_dX, dValue_dY;
+      table.Compute( x, y, value, dValue_dX, dValue_dY );
+      EXPECT_NEAR( value, f( x, y ), 1e-12 );
+      EXPECT_NEAR( dValue_dX, 2.0 + x + 0.25 * y, 1e-12 );
+      EXPECT_NEAR( dValue_dY, -1.0 + 0.25 * x - 1.5 * y, 1e-12 );
+    }
+  }
+}
+
+TEST( UniformXYTable, bicubicInterpolatesTheGridPoints )
+{
+  auto const f = []( real64 const x, real64 const y ) { return std::exp( 0.3 * x ) * std::cos( y ); };
+  UniformXYTableView const table = makeTable( f, true ).createView();
+
+  for( localIndex i = 0; i < 5; ++i )
+  {
+    for( localIndex j = 0; j < 7; ++j )
+    {
+      real64 value, dValue_dX, dValue_dY;
+      table.Compute( i, 0.5 * j, value, dValue_dX, dValue_dY );
+      EXPECT_NEAR( value, f( i, 0.5 * j ), 1e-12 );
+    }
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+
+  geosx::basicSetup( argc, argv );
+
+  int const result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+
+  return result;
+}
@@ -106,6 +106,16 @@ constexpr bool can_memcpy_helper = std::is_arithmetic< T >::value ||
 template< typename T >
 constexpr bool can_memcpy = can_memcpy_helper< std::remove_const_t< std::remove_pointer_t< T > > >;
 
+/// True if T is packed and unpacked by the kernels of BufferOpsDevice.hpp
+template< typename >
+constexpr bool is_device_packable = false;
+
+template< typename T, int NDIM, typename PERMUTATION >
+constexpr bool is_device_packable< Array< T, NDIM, PERMUTATION > > = can_memcpy< T >;
+
+template< typename T, int NDIM, int USD >
+constexpr bool is_device_packable< ArrayView< T, NDIM, USD > > = can_memcpy< T >;
+
 //------------------------------------------------------------------------------
 // Pack(buffer,var)
 //------------------------------------------------------------------------------
@@ -390,6 +400,44 @@ localIndex Unpack( buffer_unit_type const * & buffer,
                    arraySlice1d< INDEX_TYPE const > const & indices,
                    INDEX_TYPE & length );
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Select the encoding of the global indices in the packed maps, relations and sets.
+ * @param compact if true, each global index is packed as the variable-length (7 bits per byte) zigzag encoding
+ *        of its difference with the previous index of the same list, otherwise as a full globalIndex
+ *
+ * The indices of a list are usually sorted or close to each other, so most of them take one or two bytes
+ * instead of eight. All the ranks must use the same encoding.
+ */
+inline void setCompactGlobalIndices( bool const compact );
+
+/**
+ * @brief Get the encoding of the global indices in the packed maps, relations and sets.
+ * @return true if the global indices are delta encoded with a variable length
+ */
+inline bool getCompactGlobalIndices();
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Pack a global index of a list.
+ * @tparam DO_PACKING whether to pack or only compute the packed size
+ * @param buffer the buffer to pack into
+ * @param value the global index
+ * @param previous the previous index of the list, 0 for the first index, updated to @p value
+ * @return the packed size
+ */
+template< bool DO_PACKING >
+inline localIndex PackGlobalIndex( buffer_unit_type * & buffer, globalIndex const value, globalIndex & previous );
+
+/**
+ * @brief Unpack a global index of a list packed with PackGlobalIndex().
+ * @param buffer the buffer to unpack from
+ * @param value the global index
+ * @param previous the previous index of the list, 0 for the first index, updated to @p value
+ * @return the unpacked size
+ */
+inline localIndex UnpackGlobalIndex( buffer_unit_type const * & buffer, globalIndex & value, globalIndex & previous );
+
 //------------------------------------------------------------------------------
 template< bool DO_PACKING, int USD >
 localIndex Pack( buffer_unit_type * & buffer,
@@ -262,13 +262,86 @@ PackArray( buffer_unit_type * & buffer,
 //------------------------------------------------------------------------------
 // PackByIndex(buffer,var,indices)
 //------------------------------------------------------------------------------
+namespace internal
+{
+
+/// Minimum number of values packed by index for the slices to be copied by several threads
+constexpr localIndex minParallelPackByIndexSize = 1 << 14;
+
+/**
+ * @brief Get the size of the slices of an array if they are stored contiguously in their iteration order.
+ * @tparam T the type of the values
+ * @tparam NDIM the number of dimensions
+ * @tparam USD the unit stride dimension
+ * @param var the array
+ * @return the number of values of a slice var[ i ], or -1 if the slices are not contiguous
+ *
+ * This is the case of the arrays with the default permutation, where var[ i ] is packed value by value
+ * in the same order as it is stored, so that the slices can be copied as a whole.
+ */
+template< typename T, int NDIM, int USD >
+localIndex contiguousSliceSize( ArrayView< T, NDIM, USD > const & var )
+{
+  if( USD != NDIM - 1 )
+  {
+    return -1;
+  }
+
+  localIndex sliceSize = 1;
+  for( int d = NDIM - 1; d > 0; --d )
+  {
+    if( var.strides()[ d ] != sliceSize )
+    {
+      return -1;
+    }
+    sliceSize *= var.size( d );
+  }
+  return var.strides()[ 0 ] == sliceSize ? sliceSize : -1;
+}
+
+/**
+ * @brief Apply a function to the runs of consecutive indices.
+ * @tparam T_indices the type of the indices
+ * @tparam LAMBDA the type of the function
+ * @param indices the indices
+ * @param sliceSize the number of values copied per index
+ * @param lambda the function called as lambda( a, n ) for the n indices indices[ a ], ..., indices[ a ] + n - 1
+ *
+ * A large list of indices is split between the threads, one run per index, which lets the copies
+ * of the large ghost sets run in parallel while the small ones are merged into a few copies.
+ */
+template< typename T_indices, typename LAMBDA >
+void forConsecutiveIndices( T_indices const & indices, localIndex const sliceSize, LAMBDA && lambda )
+{
+  localIndex const numIndices = indices.size();
+  if( numIndices * sliceSize >= minParallelPackByIndexSize )
+  {
+    forAll< parallelHostPolicy >( numIndices, [&]( localIndex const a )
+    {
+      lambda( a, 1 );
+    } );
+    return;
+  }
+
+  localIndex a = 0;
+  while( a < numIndices )
+  {
+    localIndex b = a + 1;
+    while( b < numIndices && indices[ b ] == indices[ b - 1 ] + 1 )
+    {
+      ++b;
+    }
+    lambda( a, b - a );
+    a = b;
+  }
+}
+
 template< bool DO_PACKING, typename T, int NDIM, int USD, typename T_indices >
-typename std::enable_if< is_packable< T >, localIndex >::type
-PackByIndex( buffer_unit_type * & buffer,
-             ArrayView< T, NDIM, USD > const & var,
-             const T_indices & indices )
+localIndex PackValuesByIndex( buffer_unit_type * & buffer,
+                              ArrayView< T, NDIM, USD > const & var,
+                              const T_indices & indices )
 {
-  localIndex sizeOfPackedChars = PackPointer< DO_PACKING >( buffer, var.strides(), NDIM );
+  localIndex sizeOfPackedChars = 0;
   for( localIndex a = 0; a < indices.size(); ++a )
   {
     LvArray::forValuesInSlice( var[ indices[ a ] ],
@@ -281,6 +354,105 @@ PackByIndex( buffer_unit_type * & buffer,
   return sizeOfPackedChars;
 }
 
+template< bool DO_PACKING, typename T, int NDIM, int USD, typename T_indices >
+typename std::enable_if< !std::is_trivial< T >::value, localIndex >::type
+PackSlicesByIndex( buffer_unit_type * & buffer,
+                   ArrayView< T, NDIM, USD > const & var,
+                   const T_indices & indices )
+{ return PackValuesByIndex< DO_PACKING >( buffer, var, indices ); }
+
+template< bool DO_PACKING, typename T, int NDIM, int USD, typename T_indices >
+typename std::enable_if< std::is_trivial< T >::value, localIndex >::type
+PackSlicesByIndex( buffer_unit_type * & buffer,
+                   ArrayView< T, NDIM, USD > const & var,
+                   const T_indices & indices )
+{
+  localIndex const sliceSize = contiguousSliceSize( var );
+  if( sliceSize < 0 )
+  {
+    return PackValuesByIndex< DO_PACKING >( buffer, var, indices );
+  }
+
+  // the trivial values are packed as raw bytes, so that whole slices are copied at once
+  localIndex const sliceBytes = sliceSize * sizeof( T );
+  localIndex const sizeOfPackedChars = indices.size() * sliceBytes;
+  static_if( DO_PACKING )
+  {
+    buffer_unit_type * const GEOSX_RESTRICT packed = buffer;
+    buffer_unit_type const * const GEOSX_RESTRICT data = reinterpret_cast< buffer_unit_type const * >( var.data() );
+    forConsecutiveIndices( indices, sliceSize, [&]( localIndex const a, localIndex const n )
+    {
+      memcpy( packed + a * sliceBytes, data + indices[ a ] * sliceBytes, n * sliceBytes );
+    } );
+    buffer += sizeOfPackedChars;
+  }
+  end_static_if
+  return sizeOfPackedChars;
+}
+
+template< typename T, int NDIM, int USD, typename T_indices >
+localIndex UnpackValuesByIndex( buffer_unit_type const * & buffer,
+                                ArrayView< T, NDIM, USD > & var,
+                                const T_indices & indices )
+{
+  localIndex sizeOfUnpackedChars = 0;
+  for( localIndex a=0; a<indices.size(); ++a )
+  {
+    LvArray::forValuesInSlice( var[ indices[ a ] ],
+                               [&sizeOfUnpackedChars, &buffer] ( T & value )
+    {
+      sizeOfUnpackedChars += Unpack( buffer, value );
+    }
+                               );
+  }
+  return sizeOfUnpackedChars;
+}
+
+template< typename T, int NDIM, int USD, typename T_indices >
+typename std::enable_if< !std::is_trivial< T >::value, localIndex >::type
+UnpackSlicesByIndex( buffer_unit_type const * & buffer,
+                     ArrayView< T, NDIM, USD > & var,
+                     const T_indices & indices )
+{ return UnpackValuesByIndex( buffer, var, indices ); }
+
+template< typename T, int NDIM, int USD, typename T_indices >
+typename std::enable_if< std::is_trivial< T >::value, localIndex >::type
+UnpackSlicesByIndex( buffer_unit_type const * & buffer,
+                     ArrayView< T, NDIM, USD > & var,
+                     const T_indices & indices )
+{
+  localIndex const sliceSize = contiguousSliceSize( var );
+  if( sliceSize < 0 )
+  {
+    return UnpackValuesByIndex( buffer, var, indices );
+  }
+
+  localIndex const sliceBytes = sliceSize * sizeof( T );
+  buffer_unit_type const * const GEOSX_RESTRICT packed = buffer;
+  buffer_unit_type * const GEOSX_RESTRICT data = reinterpret_cast< buffer_unit_type * >( var.data() );
+  forConsecutiveIndices( indices, sliceSize, [&]( localIndex const a, localIndex const n )
+  {
+    memcpy( data + indices[ a ] * sliceBytes, packed + a * sliceBytes, n * sliceBytes );
+  } );
+
+  localIndex const sizeOfUnpackedChars = indices.size() * sliceBytes;
+  buffer += sizeOfUnpackedChars;
+  return sizeOfUnpackedChars;
+}
+
+}
+
+template< bool DO_PACKING, typename T, int NDIM, int USD, typename T_indices >
+typename std::enable_if< is_packable< T >, localIndex >::type
+PackByIndex( buffer_unit_type * & buffer,
+             ArrayView< T, NDIM, USD > const & var,
+             const T_indices & indices )
+{
+  localIndex sizeOfPackedChars = PackPointer< DO_PACKING >( buffer, var.strides(), NDIM );
+  sizeOfPackedChars += internal::PackSlicesByIndex< DO_PACKING >( buffer, var, indices );
+  return sizeOfPackedChars;
+}
+
 template< bool DO_PACKING, typename T, typename T_indices >
 localIndex PackByIndex( buffer_unit_type * & buffer,
                         ArrayOfArrays< T > const & var,
@@ -545,16 +717,7 @@ UnpackByIndex( buffer_unit_type const * & buffer,
 {
   localIndex strides[NDIM];
   localIndex sizeOfUnpackedChars = UnpackPointer( buffer, strides, NDIM );
-
-  for( localIndex a=0; a<indices.size(); ++a )
-  {
-    LvArray::forValuesInSlice( var[ indices[ a ] ],
-                               [&sizeOfUnpackedChars, &buffer] ( T & value )
-    {
-      sizeOfUnpackedChars += Unpack( buffer, value );
-    }
-                               );
-  }
+  sizeOfUnpackedChars += internal::UnpackSlicesByIndex( buffer, var, indices );
   return sizeOfUnpackedChars;
 }
 
@@ -731,6 +894,87 @@ Unpack( buffer_unit_type const * & buffer,
 
 #endif /* GEOSX_USE_ARRAY_BOUNDS_CHECK */
 
+namespace internal
+{
+
+/// The encoding of the global indices, shared by all the pack and unpack functions
+inline bool & compactGlobalIndices()
+{
+  static bool compact = false;
+  return compact;
+}
+
+}
+
+inline void setCompactGlobalIndices( bool const compact )
+{
+  internal::compactGlobalIndices() = compact;
+}
+
+inline bool getCompactGlobalIndices()
+{
+  return internal::compactGlobalIndices();
+}
+
+template< bool DO_PACKING >
+inline localIndex PackGlobalIndex( buffer_unit_type * & buffer, globalIndex const value, globalIndex & previous )
+{
+  if( !internal::compactGlobalIndices() )
+  {
+    return Pack< DO_PACKING >( buffer, value );
+  }
+
+  // Zigzag encoding of the difference, so that the small negative differences also take few bytes
+  unsigned long long const delta = static_cast< unsigned long long >( value ) - static_cast< unsigned long long >( previous );
+  unsigned long long encoded = ( delta << 1 ) ^ ( value < previous ? ~0ULL : 0ULL );
+  previous = value;
+
+  localIndex sizeOfPackedChars = 1;
+  while( encoded >= 0x80 )
+  {
+    static_if( DO_PACKING )
+    {
+      *buffer++ = static_cast< buffer_unit_type >( ( encoded & 0x7F ) | 0x80 );
+    }
+    end_static_if
+    encoded >>= 7;
+    ++sizeOfPackedChars;
+  }
+  static_if( DO_PACKING )
+  {
+    *buffer++ = static_cast< buffer_unit_type >( encoded );
+  }
+  end_static_if
+
+  return sizeOfPackedChars;
+}
+
+inline localIndex UnpackGlobalIndex( buffer_unit_type const * & buffer, globalIndex & value, globalIndex & previous )
+{
+  if( !internal::compactGlobalIndices() )
+  {
+    return Unpack( buffer, value );
+  }
+
+  unsigned long long encoded = 0;
+  localIndex sizeOfUnpackedChars = 0;
+  int shift = 0;
+  unsigned char byte;
+  do
+  {
+    byte = static_cast< unsigned char >( *buffer++ );
+    encoded |= static_cast< unsigned long long >( byte & 0x7F ) << shift;
+    shift += 7;
+    ++sizeOfUnpackedChars;
+  } while( byte & 0x80 );
+
+  unsigned long long const delta = ( encoded >> 1 ) ^ ( ~( encoded & 1 ) + 1 );
+  value = static_cast< globalIndex >( static_cast< unsigned long long >( previous ) + delta );
+  previous = value;
+
+  return sizeOfUnpackedChars;
+}
+
 template< bool DO_PACKING, int USD >
 localIndex Pack( buffer_unit_type * & buffer,
                  SortedArray< localIndex > const & var,
@@ -740,14 +984,15 @@ localIndex Pack( buffer_unit_type * & buffer,
   const localIndex length = LvArray::integerConversion< localIndex >( var.size()+unmappedGlobalIndices.size());
   localIndex sizeOfPackedChars = Pack< DO_PACKING >( buffer, length );
 
+  globalIndex previous = 0;
   for( localIndex const lid : var )
   {
-    sizeOfPackedChars += Pack< DO_PACKING >( buffer, localToGlobal[ lid ] );
+    sizeOfPackedChars += PackGlobalIndex< DO_PACKING >( buffer, localToGlobal[ lid ], previous );
   }
 
   for( globalIndex const gid : unmappedGlobalIndices )
   {
-    sizeOfPackedChars += Pack< DO_PACKING >( buffer, gid );
+    sizeOfPackedChars += PackGlobalIndex< DO_PACKING >( buffer, gid, previous );
   }
 
 
@@ -769,10 +1014,11 @@ localIndex Unpack( buffer_unit_type const * & buffer,
   localIndex set_length;
   localIndex sizeOfUnpackedChars = Unpack( buffer, set_length );
 
+  globalIndex previous = 0;
   for( localIndex a=0; a<set_length; ++a )
   {
     globalIndex temp;
-    sizeOfUnpackedChars += Unpack( buffer, temp );
+    sizeOfUnpackedChars += UnpackGlobalIndex( buffer, temp, previous );
     typename mapBase< globalIndex, localIndex, SORTED >::const_iterator iter = globalToLocalMap.find( temp );
     if( iter==globalToLocalMap.end() )
     {
@@ -809,15 +1055,15 @@ localIndex Pack( buffer_unit_type * & buffer,
   temp.resize( length );
   localIndex sizeOfPackedChars = Pack< DO_PACKING >( buffer, length );
 
-
+  globalIndex previous = 0;
   for( localIndex a=0; a<length; ++a )
   {
-    sizeOfPackedChars += Pack< DO_PACKING >( buffer, localToGlobal[temp[a]] );
+    sizeOfPackedChars += PackGlobalIndex< DO_PACKING >( buffer, localToGlobal[temp[a]], previous );
   }
 
   for( globalIndex const gid : unmappedGlobalIndices )
   {
-    sizeOfPackedChars += Pack< DO_PACKING >( buffer, gid );
+    sizeOfPackedChars += PackGlobalIndex< DO_PACKING >( buffer, gid, previous );
   }
 
   return sizeOfPackedChars;
@@ -874,6 +1120,18 @@ localIndex Pack( buffer_unit_type * & buffer,
                  arraySlice1d< globalIndex const > const & localToGlobalMap )
 {
   localIndex sizeOfPackedChars = Pack< DO_PACKING >( buffer, length );
+
+  if( getCompactGlobalIndices() )
+  {
+    globalIndex previous = 0;
+    for( localIndex a=0; a<length; ++a )
+    {
+      globalIndex const gi = var[a] != unmappedLocalIndexValue ? localToGlobalMap[var[a]] : unmappedGlobalIndices[a];
+      sizeOfPackedChars += PackGlobalIndex< DO_PACKING >( buffer, gi, previous );
+    }
+    return sizeOfPackedChars;
+  }
+
   sizeOfPackedChars += length*sizeof(globalIndex);
 
   static_if( DO_PACKING )
@@ -913,10 +1171,11 @@ Unpack( buffer_unit_type const * & buffer,
   unmappedGlobalIndices.setValues< serialPolicy >( unmappedLocalIndexValue );
 
   bool unpackedGlobalFlag = false;
+  globalIndex previous = 0;
   for( localIndex a=0; a<length; ++a )
   {
     globalIndex unpackedGlobalIndex;
-    sizeOfUnpackedChars += Unpack( buffer, unpackedGlobalIndex );
+    sizeOfUnpackedChars += UnpackGlobalIndex( buffer, unpackedGlobalIndex, previous );
 
     typename mapBase< globalIndex, localIndex, SORTED >::const_iterator
       iter = globalToLocalMap.find( unpackedGlobalIndex );
@@ -976,10 +1235,11 @@ Unpack( buffer_unit_type const * & buffer,
   unmappedGlobalIndices.setValues< serialPolicy >( unmappedLocalIndexValue );
 
   bool unpackedGlobalFlag = false;
+  globalIndex previous = 0;
   for( localIndex a=0; a<length; ++a )
   {
     globalIndex unpackedGlobalIndex;
-    sizeOfUnpackedChars += Unpack( buffer, unpackedGlobalIndex );
+    sizeOfUnpackedChars += UnpackGlobalIndex( buffer, unpackedGlobalIndex, previous );
 
     typename mapBase< globalIndex, localIndex, SORTED >::const_iterator
       iter = globalToLocalMap.find( unpackedGlobalIndex );
@@ -1023,10 +1283,11 @@ Unpack( buffer_unit_type const * & buffer,
   unmappedGlobalIndices.setValues< serialPolicy >( unmappedLocalIndexValue );
 
   bool unpackedGlobalFlag = false;
+  globalIndex previous = 0;
   for( localIndex a=0; a<length; ++a )
   {
     globalIndex unpackedGlobalIndex;
-    sizeOfUnpackedChars += Unpack( buffer, unpackedGlobalIndex );
+    sizeOfUnpackedChars += UnpackGlobalIndex( buffer, unpackedGlobalIndex, previous );
 
     typename mapBase< globalIndex, localIndex, SORTED >::const_iterator
       iter = globalToLocalMap.find( unpackedGlobalIndex );
@@ -1061,19 +1322,23 @@ Pack( buffer_unit_type * & buffer,
   localIndex sizeOfPackedChars=0;
 
   sizeOfPackedChars += Pack< DO_PACKING >( buffer, indices.size() );
+  globalIndex previousGlobalIndex = 0;
+  globalIndex previousRelatedGlobalIndex = 0;
   for( localIndex a=0; a<indices.size(); ++a )
   {
     localIndex const li = indices[a];
-    sizeOfPackedChars += Pack< DO_PACKING >( buffer, localToGlobalMap[li] );
+    sizeOfPackedChars += PackGlobalIndex< DO_PACKING >( buffer, localToGlobalMap[li], previousGlobalIndex );
     if( var[li] != -1 )
     {
-      sizeOfPackedChars += Pack< DO_PACKING >( buffer,
-                                               relatedObjectLocalToGlobalMap[var[li]] );
+      sizeOfPackedChars += PackGlobalIndex< DO_PACKING >( buffer,
+                                                          relatedObjectLocalToGlobalMap[var[li]],
+                                                          previousRelatedGlobalIndex );
     }
     else
     {
-      sizeOfPackedChars += Pack< DO_PACKING >( buffer,
-                                               localIndex( -1 ) );
+      sizeOfPackedChars += PackGlobalIndex< DO_PACKING >( buffer,
+                                                          globalIndex( -1 ),
+                                                          previousRelatedGlobalIndex );
     }
   }
 
@@ -1098,10 +1363,12 @@ Unpack( buffer_unit_type const * & buffer,
                   "number of unpacked indices("<<numIndicesUnpacked<<") does not equal size of "
                                                                      "indices passed into Unpack function("<<sizeOfIndicesPassedIn );
 
+  globalIndex previousGlobalIndex = 0;
+  globalIndex previousRelatedGlobalIndex = 0;
   for( localIndex a=0; a<indices.size(); ++a )
   {
     globalIndex gi;
-    sizeOfUnpackedChars += Unpack( buffer, gi );
+    sizeOfUnpackedChars += UnpackGlobalIndex( buffer, gi, previousGlobalIndex );
     localIndex & li = indices[a];
     if( sizeOfIndicesPassedIn > 0 )
     {
@@ -1115,7 +1382,7 @@ Unpack( buffer_unit_type const * & buffer,
     }
 
     globalIndex mappedGlobalIndex;
-    sizeOfUnpackedChars += Unpack( buffer, mappedGlobalIndex );
+    sizeOfUnpackedChars += UnpackGlobalIndex( buffer, mappedGlobalIndex, previousRelatedGlobalIndex );
     if( mappedGlobalIndex != -1 )
     {
       var[li] = relatedObjectGlobalToLocalMap.at( mappedGlobalIndex );
@@ -1141,10 +1408,11 @@ Pack( buffer_unit_type * & buffer,
   localIndex sizeOfPackedChars=0;
 
   sizeOfPackedChars += Pack< DO_PACKING >( buffer, indices.size() );
+  globalIndex previousGlobalIndex = 0;
   for( localIndex a=0; a<indices.size(); ++a )
   {
     localIndex const li = indices[a];
-    sizeOfPackedChars += Pack< DO_PACKING >( buffer, localToGlobalMap[li] );
+    sizeOfPackedChars += PackGlobalIndex< DO_PACKING >( buffer, localToGlobalMap[li], previousGlobalIndex );
 
     typename mapBase< localIndex, array1d< globalIndex >, SORTED >::const_iterator
       iterUnmappedGI = unmappedGlobalIndices.find( li );
@@ -1185,10 +1453,11 @@ Unpack( buffer_unit_type const * & buffer,
 
   indices.resize( numIndicesUnpacked );
 
+  globalIndex previousGlobalIndex = 0;
   for( localIndex a=0; a<indices.size(); ++a )
   {
     globalIndex gi;
-    sizeOfUnpackedChars += Unpack( buffer, gi );
+    sizeOfUnpackedChars += UnpackGlobalIndex( buffer, gi, previousGlobalIndex );
 
     localIndex & li = indices[a];
     if( sizeOfIndicesPassedIn > 0 )
@@ -1228,10 +1497,11 @@ Pack( buffer_unit_type * & buffer,
   localIndex sizeOfPackedChars=0;
 
   sizeOfPackedChars += Pack< DO_PACKING >( buffer, indices.size() );
+  globalIndex previousGlobalIndex = 0;
   for( localIndex a=0; a<indices.size(); ++a )
   {
     localIndex const li = indices[a];
-    sizeOfPackedChars += Pack< DO_PACKING >( buffer, localToGlobalMap[li] );
+    sizeOfPackedChars += PackGlobalIndex< DO_PACKING >( buffer, localToGlobalMap[li], previousGlobalIndex );
 
     typename mapBase< localIndex, array1d< globalIndex >, SORTED >::const_iterator
       iterUnmappedGI = unmappedGlobalIndices.find( li );
@@ -1263,10 +1533,11 @@ Pack( buffer_unit_type * & buffer,
   localIndex sizeOfPackedChars=0;
 
   sizeOfPackedChars += Pack< DO_PACKING >( buffer, indices.size() );
+  globalIndex previousGlobalIndex = 0;
   for( localIndex a=0; a<indices.size(); ++a )
   {
     localIndex const li = indices[a];
-    sizeOfPackedChars += Pack< DO_PACKING >( buffer, localToGlobalMap[li] );
+    sizeOfPackedChars += PackGlobalIndex< DO_PACKING >( buffer, localToGlobalMap[li], previousGlobalIndex );
 
     typename mapBase< localIndex, SortedArray< globalIndex >, SORTED >::const_iterator
       iterUnmappedGI = unmappedGlobalIndices.find( li );
@@ -1307,10 +1578,11 @@ Unpack( buffer_unit_type const * & buffer,
 
   indices.resize( numIndicesUnpacked );
 
+  globalIndex previousGlobalIndex = 0;
   for( localIndex a=0; a<indices.size(); ++a )
   {
     globalIndex gi;
-    sizeOfUnpackedChars += Unpack( buffer, gi );
+    sizeOfUnpackedChars += UnpackGlobalIndex( buffer, gi, previousGlobalIndex );
 
     localIndex & li = indices[a];
     if( sizeOfIndicesPassedIn > 0 )
@@ -1350,10 +1622,11 @@ Pack( buffer_unit_type * & buffer,
 {
   localIndex sizeOfPackedChars = Pack< DO_PACKING >( buffer, indices.size() );
 
+  globalIndex previousGlobalIndex = 0;
   for( localIndex a=0; a<indices.size(); ++a )
   {
     localIndex li = indices[a];
-    sizeOfPackedChars += Pack< DO_PACKING >( buffer, localToGlobalMap[li] );
+    sizeOfPackedChars += PackGlobalIndex< DO_PACKING >( buffer, localToGlobalMap[li], previousGlobalIndex );
 
     typename mapBase< localIndex, SortedArray< globalIndex >, SORTED >::const_iterator
       iterUnmappedGI = unmappedGlobalIndices.find( li );
@@ -1395,11 +1668,12 @@ Unpack( buffer_unit_type const * & buffer,
 
   indices.resize( numIndicesUnpacked );
 
+  globalIndex previousGlobalIndex = 0;
   for( localIndex a=0; a<numIndicesUnpacked; ++a )
   {
 
     globalIndex gi;
-    sizeOfUnpackedChars += Unpack( buffer, gi );
+    sizeOfUnpackedChars += UnpackGlobalIndex( buffer, gi, previousGlobalIndex );
 
     localIndex & li = indices[a];
     if( sizeOfIndicesPassedIn > 0 )
@@ -1454,10 +1728,11 @@ Unpack( buffer_unit_type const * & buffer,
   // local indices of known global indices
   std::vector< localIndex > mapped;
 
+  globalIndex previousGlobalIndex = 0;
   for( localIndex a=0; a<numIndicesUnpacked; ++a )
   {
     globalIndex gi;
-    sizeOfUnpackedChars += Unpack( buffer, gi );
+    sizeOfUnpackedChars += UnpackGlobalIndex( buffer, gi, previousGlobalIndex );
 
     localIndex & li = indices[a];
     if( sizeOfIndicesPassedIn > 0 )
@@ -1485,10 +1760,11 @@ Unpack( buffer_unit_type const * & buffer,
     // again, the global indices being unpacked here are for
     //  objects related to the global index recvd and
     //  mapped to a local index above (e.g. up/down maps)
+    globalIndex previous = 0;
     for( localIndex b = 0; b < set_length; ++b )
     {
       globalIndex temp;
-      sizeOfUnpackedChars += Unpack( buffer, temp );
+      sizeOfUnpackedChars += UnpackGlobalIndex( buffer, temp, previous );
       auto iter = relatedObjectGlobalToLocalMap.find( temp );
       // if we have no existing global-to-local information
       //  for the recv'd global index
@@ -1526,10 +1802,11 @@ Pack( buffer_unit_type * & buffer,
       arraySlice1d< globalIndex const, USD1 > const & localToGlobalMap )
 {
   localIndex sizeOfPackedChars = Pack< DO_PACKING >( buffer, indices.size() );
+  globalIndex previousGlobalIndex = 0;
   for( localIndex a=0; a<indices.size(); ++a )
   {
     localIndex li = indices[a];
-    sizeOfPackedChars += Pack< DO_PACKING >( buffer, localToGlobalMap[li] );
+    sizeOfPackedChars += PackGlobalIndex< DO_PACKING >( buffer, localToGlobalMap[li], previousGlobalIndex );
 
     sizeOfPackedChars += PackArray< DO_PACKING >( buffer, var[li], var.size( 1 ) );
   }
@@ -1557,10 +1834,11 @@ Unpack( buffer_unit_type const * & buffer,
 
   indices.resize( numIndicesUnpacked );
 
+  globalIndex previousGlobalIndex = 0;
   for( localIndex a=0; a<numIndicesUnpacked; ++a )
   {
     globalIndex gi;
-    sizeOfUnpackedChars += Unpack( buffer, gi );
+    sizeOfUnpackedChars += UnpackGlobalIndex( buffer, gi, previousGlobalIndex );
 
     localIndex & li = indices[a];
     if( sizeOfIndicesPassedIn > 0 )
@@ -1594,10 +1872,11 @@ Pack( buffer_unit_type * & buffer,
   localIndex sizeOfPackedChars = 0;
 
   sizeOfPackedChars += Pack< DO_PACKING >( buffer, indices.size() );
+  globalIndex previousGlobalIndex = 0;
   for( localIndex a=0; a<indices.size(); ++a )
   {
     localIndex li = indices[a];
-    sizeOfPackedChars += Pack< DO_PACKING >( buffer, localToGlobalMap[li] );
+    sizeOfPackedChars += PackGlobalIndex< DO_PACKING >( buffer, localToGlobalMap[li], previousGlobalIndex );
 
     typename mapBase< localIndex, array1d< globalIndex >, SORTED >::const_iterator
       iterUnmappedGI = unmappedGlobalIndices.find( li );
@@ -1639,10 +1918,11 @@ Unpack( buffer_unit_type const * & buffer,
 
   indices.resize( numIndicesUnpacked );
 
+  globalIndex previousGlobalIndex = 0;
   for( localIndex a=0; a<numIndicesUnpacked; ++a )
   {
     globalIndex gi;
-    sizeOfUnpackedChars += Unpack( buffer, gi );
+    sizeOfUnpackedChars += UnpackGlobalIndex( buffer, gi, previousGlobalIndex );
 
     localIndex & li = indices[a];
     if( sizeOfIndicesPassedIn > 0 )
@@ -24,6 +24,13 @@
 
 // TPL includes
 #include <conduit_relay.hpp>
+#include <conduit_relay_io_hdf5.hpp>
+#include <hdf5.h>
+
+// System includes
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 namespace geosx
 {
@@ -33,80 +40,454 @@ namespace dataRepository
 conduit::Node rootConduitNode;
 
 
-std::string writeRootFile( conduit::Node & root, std::string const & rootPath )
+namespace
+{
+
+/// Tag of the messages passing the write token between the ranks sharing a restart file.
+constexpr int restartTokenTag = 5291;
+
+/// The restart file the values of the arrays are read from when they are pulled, negative if there is none.
+hid_t lazyFileId = -1;
+
+/// The path of the tree of this rank inside of the lazily read restart file, empty for the root of the file.
+std::string lazyTreeName;
+
+/// Name of the child of a wrapper node recording the size of values left in the restart file.
+constexpr char const lazyValuesKey[] = "__lazyValues__";
+
+/**
+ * @brief Format a pattern holding a single integer conversion.
+ * @param pattern the printf-style pattern
+ * @param value the value to format
+ * @return the formatted string
+ */
+std::string formatPattern( std::string const & pattern, int const value )
+{
+  char buffer[ 1024 ];
+  GEOSX_ERROR_IF_GE( std::snprintf( buffer, 1024, pattern.data(), value ), 1024 );
+  return buffer;
+}
+
+/**
+ * @brief Get the name of the tree of a rank inside of an aggregated restart file.
+ * @param rank the rank
+ * @return the name of the tree
+ */
+std::string rankTreeName( int const rank )
+{
+  return formatPattern( "rank_%07d", rank );
+}
+
+/**
+ * @brief Call a function on all the leaves of a tree.
+ * @tparam LAMBDA type of the function
+ * @param node the root of the tree
+ * @param lambda the function, called with the leaf node
+ */
+template< typename LAMBDA >
+void forEachLeaf( conduit::Node const & node, LAMBDA && lambda )
+{
+  if( node.number_of_children() == 0 )
+  {
+    lambda( node );
+    return;
+  }
+  for( conduit::index_t i = 0; i < node.number_of_children(); ++i )
+  {
+    forEachLeaf( node.child( i ), lambda );
+  }
+}
+
+/**
+ * @brief Compute the 64-bit FNV-1a hash of the type and the data of a leaf.
+ * @param leaf the leaf node
+ * @return the hash
+ */
+std::uint64_t hashLeaf( conduit::Node const & leaf )
+{
+  std::uint64_t hash = 14695981039346656037ULL;
+  auto const hashBytes = [&hash]( unsigned char const * const bytes, std::size_t const numBytes )
+  {
+    for( std::size_t i = 0; i < numBytes; ++i )
+    {
+      hash = ( hash ^ bytes[ i ] ) * 1099511628211ULL;
+    }
+  };
+
+  conduit::index_t const typeId = leaf.dtype().id();
+  conduit::index_t const numElements = leaf.dtype().number_of_elements();
+  hashBytes( reinterpret_cast< unsigned char const * >( &typeId ), sizeof( typeId ) );
+  hashBytes( reinterpret_cast< unsigned char const * >( &numElements ), sizeof( numElements ) );
+
+  if( leaf.is_compact() )
+  {
+    hashBytes( static_cast< unsigned char const * >( leaf.data_ptr() ), leaf.total_bytes_compact() );
+  }
+  else
+  {
+    conduit::Node compactLeaf;
+    leaf.compact_to( compactLeaf );
+    hashBytes( static_cast< unsigned char const * >( compactLeaf.data_ptr() ), compactLeaf.total_bytes_compact() );
+  }
+  return hash;
+}
+
+/**
+ * @brief Read the structure of a restart tree, leaving the values of the arrays in the file.
+ * @param groupId the HDF5 group to read
+ * @param node the node to read the group into
+ *
+ * Every dataset but "__values__" is read into @p node. A "__values__" dataset is replaced by a
+ * "__lazyValues__" leaf holding its size in bytes, the values are read by readRestartValues()
+ * straight into the buffer of the wrapper.
+ */
+void loadTreeStructure( hid_t const groupId, conduit::Node & node )
+{
+  H5G_info_t groupInfo;
+  GEOSX_ERROR_IF_LT( H5Gget_info( groupId, &groupInfo ), 0 );
+
+  for( hsize_t i = 0; i < groupInfo.nlinks; ++i )
+  {
+    ssize_t const nameLength = H5Lget_name_by_idx( groupId, ".", H5_INDEX_NAME, H5_ITER_INC, i, nullptr, 0, H5P_DEFAULT );
+    GEOSX_ERROR_IF_LT( nameLength, 0 );
+    std::vector< char > nameBuffer( nameLength + 1 );
+    H5Lget_name_by_idx( groupId, ".", H5_INDEX_NAME, H5_ITER_INC, i, nameBuffer.data(), nameBuffer.size(), H5P_DEFAULT );
+    std::string const name( nameBuffer.data() );
+
+    hid_t const objectId = H5Oopen( groupId, name.c_str(), H5P_DEFAULT );
+    GEOSX_ERROR_IF_LT( objectId, 0 );
+
+    if( H5Iget_type( objectId ) == H5I_GROUP )
+    {
+      loadTreeStructure( objectId, node[ name ] );
+    }
+    else if( name == "__values__" )
+    {
+      hid_t const spaceId = H5Dget_space( objectId );
+      hid_t const typeId = H5Dget_type( objectId );
+      hssize_t const numValues = H5Sget_simple_extent_npoints( spaceId );
+      node[ lazyValuesKey ].set( conduit::int64( numValues * H5Tget_size( typeId ) ) );
+      H5Tclose( typeId );
+      H5Sclose( spaceId );
+    }
+    else
+    {
+      conduit::relay::io::hdf5_read( groupId, name, node[ name ] );
+    }
+
+    H5Oclose( objectId );
+  }
+}
+
+}
+
+std::mutex & hdf5WriteMutex()
 {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::string writeRootFile( conduit::Node & root,
+                           std::string const & rootPath,
+                           int const ranksPerFile,
+                           std::string const & basePath )
+{
+  GEOSX_ERROR_IF_LT_MSG( ranksPerFile, 1, "The number of ranks per restart file must be positive." );
+
   std::string rootDirName, rootFileName;
   splitPath( rootPath, rootDirName, rootFileName );
 
+  int const size = MpiWrapper::Comm_size();
+  int const numFiles = ( size + ranksPerFile - 1 ) / ranksPerFile;
+
   if( MpiWrapper::Comm_rank() == 0 )
   {
     makeDirsForPath( rootPath );
 
     root[ "protocol/name" ] = "hdf5";
     root[ "protocol/version" ] = CONDUIT_VERSION;
+    root[ "number_of_ranks" ] = size;
+
+    if( ranksPerFile == 1 )
+    {
+      root[ "number_of_files" ] = size;
+      root[ "file_pattern" ] = rootFileName + "/rank_%07d.hdf5";
 
-    root[ "number_of_files" ] = MpiWrapper::Comm_size();
-    root[ "file_pattern" ] = rootFileName + "/rank_%07d.hdf5";
+      root[ "number_of_trees" ] = 1;
+      root[ "tree_pattern" ] = "/";
+    }
+    else
+    {
+      // Each file holds the trees of ranksPerFile consecutive ranks, the trees are indexed by rank.
+      root[ "number_of_files" ] = numFiles;
+      root[ "file_pattern" ] = rootFileName + "/file_%07d.hdf5";
 
-    root[ "number_of_trees" ] = 1;
-    root[ "tree_pattern" ] = "/";
+      root[ "number_of_trees" ] = size;
+      root[ "tree_pattern" ] = "rank_%07d";
+      root[ "ranks_per_file" ] = ranksPerFile;
+    }
 
+    if( !basePath.empty() )
+    {
+      // The arrays missing from this restart are read from the base restart, in the same directory.
+      std::string baseDirName, baseFileName;
+      splitPath( basePath, baseDirName, baseFileName );
+      root[ "base_restart" ] = baseFileName;
+    }
+
+    std::lock_guard< std::mutex > const lock( hdf5WriteMutex() );
     conduit::relay::io::save( root, rootPath + ".root", "hdf5" );
   }
 
   MpiWrapper::Barrier( MPI_COMM_GEOSX );
 
-  std::vector< char > buffer( rootPath.size() + 64 );
-  GEOSX_ERROR_IF_GE( std::snprintf( buffer.data(), buffer.size(), "%s/rank_%07d.hdf5", rootPath.data(), MpiWrapper::Comm_rank() ), 1024 );
-  return buffer.data();
+  int const rank = MpiWrapper::Comm_rank();
+  if( ranksPerFile == 1 )
+  {
+    return formatPattern( rootPath + "/rank_%07d.hdf5", rank );
+  }
+  return formatPattern( rootPath + "/file_%07d.hdf5", rank / ranksPerFile );
 }
 
 
-std::string readRootNode( std::string const & rootPath )
+std::string readRootNode( std::string const & rootPath, std::string & treeName, std::string & basePath )
 {
-  std::string rankFilePattern;
+  std::string filePattern;
+  basePath.clear();
+  int ranksPerFile = 1;
   if( MpiWrapper::Comm_rank() == 0 )
   {
     conduit::Node node;
     conduit::relay::io::load( rootPath + ".root", "hdf5", node );
 
-    int const nFiles = node.fetch_child( "number_of_files" ).value();
-    GEOSX_ERROR_IF_NE( nFiles, MpiWrapper::Comm_size() );
-
-    std::string const filePattern = node.fetch_child( "file_pattern" ).as_string();
+    // Each rank reads back the tree of the same rank: the decomposition of the restart must be the one of the run.
+    int numRanks;
+    if( node.has_child( "ranks_per_file" ) )
+    {
+      ranksPerFile = node.fetch_child( "ranks_per_file" ).value();
+      numRanks = node.fetch_child( "number_of_trees" ).value();
+    }
+    else
+    {
+      numRanks = node.fetch_child( "number_of_files" ).value();
+    }
+    GEOSX_ERROR_IF_NE_MSG( numRanks, MpiWrapper::Comm_size(),
+                           "The restart " << rootPath << " was written with " << numRanks << " ranks, "
+                           "it can only be read back with the same number of ranks and the same partition." );
 
     std::string rootDirName, rootFileName;
     splitPath( rootPath, rootDirName, rootFileName );
 
-    rankFilePattern = rootDirName + "/" + filePattern;
-    GEOSX_LOG_RANK_VAR( rankFilePattern );
+    filePattern = rootDirName + "/" + node.fetch_child( "file_pattern" ).as_string();
+    GEOSX_LOG_RANK_VAR( filePattern );
+
+    if( node.has_child( "base_restart" ) )
+    {
+      basePath = rootDirName + "/" + node.fetch_child( "base_restart" ).as_string();
+    }
   }
 
-  MpiWrapper::Broadcast( rankFilePattern, 0 );
+  MpiWrapper::Broadcast( filePattern, 0 );
+  MpiWrapper::Broadcast( basePath, 0 );
+  MpiWrapper::Broadcast( ranksPerFile, 0 );
 
-  char buffer[ 1024 ];
-  GEOSX_ERROR_IF_GE( std::snprintf( buffer, 1024, rankFilePattern.data(), MpiWrapper::Comm_rank() ), 1024 );
-  return buffer;
+  int const rank = MpiWrapper::Comm_rank();
+  if( ranksPerFile == 1 )
+  {
+    treeName.clear();
+    return formatPattern( filePattern, rank );
+  }
+
+  treeName = rankTreeName( rank );
+  return formatPattern( filePattern, rank / ranksPerFile );
 }
 
 /* Write out a restart file. */
-void writeTree( std::string const & path )
+void writeTree( std::string const & path, int const ranksPerFile )
+{
+  writeTree( path, rootConduitNode, ranksPerFile, "" );
+}
+
+
+void writeTree( std::string const & path,
+                conduit::Node const & tree,
+                int const ranksPerFile,
+                std::string const & basePath )
 {
   GEOSX_MARK_FUNCTION;
 
   conduit::Node root;
-  std::string const filePathForRank = writeRootFile( root, path );
-  GEOSX_LOG_RANK( "Writing out restart file at " << filePathForRank );
-  conduit::relay::io::save( rootConduitNode, filePathForRank, "hdf5" );
+  std::string const filePath = writeRootFile( root, path, ranksPerFile, basePath );
+  GEOSX_LOG_RANK( "Writing out restart file at " << filePath );
+
+  if( ranksPerFile == 1 )
+  {
+    std::lock_guard< std::mutex > const lock( hdf5WriteMutex() );
+    conduit::relay::io::save( tree, filePath, "hdf5" );
+    return;
+  }
+
+  // The ranks sharing a file write their tree one after the other: each rank waits for the token of
+  // the previous rank of its group, appends its tree to the file and hands the token over to the next rank.
+  int const rank = MpiWrapper::Comm_rank();
+  int const size = MpiWrapper::Comm_size();
+  int const firstRank = rank - rank % ranksPerFile;
+  int const lastRank = std::min( firstRank + ranksPerFile, size ) - 1;
+
+  int token = 0;
+  if( rank != firstRank )
+  {
+    MPI_Request request;
+    MpiWrapper::iRecv( &token, 1, rank - 1, restartTokenTag, MPI_COMM_GEOSX, &request );
+    MpiWrapper::Wait( &request, MPI_STATUS_IGNORE );
+  }
+
+  conduit::Node rankNode;
+  rankNode[ rankTreeName( rank ) ].set_external( const_cast< conduit::Node & >( tree ) );
+  std::unique_lock< std::mutex > lock( hdf5WriteMutex() );
+  if( rank == firstRank )
+  {
+    conduit::relay::io::save( rankNode, filePath, "hdf5" );
+  }
+  else
+  {
+    conduit::relay::io::save_merged( rankNode, filePath, "hdf5" );
+  }
+  lock.unlock();
+
+  if( rank != lastRank )
+  {
+    MPI_Request request;
+    MpiWrapper::iSend( &token, 1, rank + 1, restartTokenTag, MPI_COMM_GEOSX, &request );
+    MpiWrapper::Wait( &request, MPI_STATUS_IGNORE );
+  }
 }
 
 
 void loadTree( std::string const & path )
 {
   GEOSX_MARK_FUNCTION;
-  std::string const filePathForRank = readRootNode( path );
-  GEOSX_LOG_RANK( "Reading in restart file at " << filePathForRank );
-  conduit::relay::io::load( filePathForRank, "hdf5", rootConduitNode );
+  std::string treeName, basePath;
+  std::string const filePath = readRootNode( path, treeName, basePath );
+
+  // An incremental restart only holds the arrays changed since its base: read the base first and
+  // overwrite the arrays it holds with the ones of this restart.
+  if( !basePath.empty() )
+  {
+    loadTree( basePath );
+  }
+
+  GEOSX_LOG_RANK( "Reading in restart file at " << filePath );
+  if( !basePath.empty() )
+  {
+    // The incremental arrays are read in full, they take precedence over the values left in the base file.
+    conduit::Node incrementalNode;
+    if( treeName.empty() )
+    {
+      conduit::relay::io::load( filePath, "hdf5", incrementalNode );
+    }
+    else
+    {
+      // Only read the tree of this rank out of the shared file.
+      conduit::relay::io::load( filePath + ":" + treeName, "hdf5", incrementalNode );
+    }
+    rootConduitNode.update( incrementalNode );
+    return;
+  }
+
+  // Read the structure of the tree of this rank now and leave the file open for the values.
+  finishLoadingTree();
+  lazyFileId = H5Fopen( filePath.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+  GEOSX_ERROR_IF_LT_MSG( lazyFileId, 0, "Could not open the restart file " << filePath );
+  lazyTreeName = treeName;
+
+  hid_t const treeId = H5Gopen( lazyFileId, treeName.empty() ? "/" : treeName.c_str(), H5P_DEFAULT );
+  GEOSX_ERROR_IF_LT_MSG( treeId, 0, "Could not find the tree " << treeName << " in the restart file " << filePath );
+  loadTreeStructure( treeId, rootConduitNode );
+  H5Gclose( treeId );
+}
+
+
+void finishLoadingTree()
+{
+  if( lazyFileId >= 0 )
+  {
+    H5Fclose( lazyFileId );
+    lazyFileId = -1;
+    lazyTreeName.clear();
+  }
+}
+
+
+localIndex restartValuesByteSize( conduit::Node const & node )
+{
+  if( node.has_child( "__values__" ) )
+  {
+    return LvArray::integerConversion< localIndex >( node.fetch_child( "__values__" ).dtype().strided_bytes() );
+  }
+
+  GEOSX_ERROR_IF( !node.has_child( lazyValuesKey ), "No values to read for " << node.path() );
+  return LvArray::integerConversion< localIndex >( node.fetch_child( lazyValuesKey ).as_int64() );
+}
+
+
+void readRestartValues( conduit::Node const & node, void * const dst, localIndex const numBytes )
+{
+  GEOSX_ERROR_IF_NE( numBytes, restartValuesByteSize( node ) );
+  if( numBytes == 0 )
+  {
+    return;
+  }
+
+  if( node.has_child( "__values__" ) )
+  {
+    std::memcpy( dst, node.fetch_child( "__values__" ).data_ptr(), numBytes );
+    return;
+  }
+
+  GEOSX_ERROR_IF_LT_MSG( lazyFileId, 0, "The restart file was closed before reading " << node.path() );
+  std::string const datasetPath = ( lazyTreeName.empty() ? "" : lazyTreeName + "/" ) + node.path() + "/__values__";
+
+  hid_t const datasetId = H5Dopen( lazyFileId, datasetPath.c_str(), H5P_DEFAULT );
+  GEOSX_ERROR_IF_LT_MSG( datasetId, 0, "Could not find " << datasetPath << " in the restart file" );
+  hid_t const fileTypeId = H5Dget_type( datasetId );
+  hid_t const memoryTypeId = H5Tget_native_type( fileTypeId, H5T_DIR_DEFAULT );
+
+  GEOSX_ERROR_IF_LT( H5Dread( datasetId, memoryTypeId, H5S_ALL, H5S_ALL, H5P_DEFAULT, dst ), 0 );
+
+  H5Tclose( memoryTypeId );
+  H5Tclose( fileTypeId );
+  H5Dclose( datasetId );
+}
+
+
+void hashTree( conduit::Node const & tree, std::map< std::string, std::uint64_t > & hashes )
+{
+  GEOSX_MARK_FUNCTION;
+  forEachLeaf( tree, [&]( conduit::Node const & leaf )
+  {
+    hashes[ leaf.path() ] = hashLeaf( leaf );
+  } );
+}
+
+
+void extractChangedTree( conduit::Node const & tree,
+                         std::map< std::string, std::uint64_t > const & baseHashes,
+                         conduit::Node & changed )
+{
+  GEOSX_MARK_FUNCTION;
+  changed.reset();
+  forEachLeaf( tree, [&]( conduit::Node const & leaf )
+  {
+    std::string const leafPath = leaf.path();
+    auto const it = baseHashes.find( leafPath );
+    if( it == baseHashes.end() || it->second != hashLeaf( leaf ) )
+    {
+      // Paths are relative to the root of the tree, strip the name of the root itself.
+      std::string const relativePath = tree.path().empty() ? leafPath : leafPath.substr( tree.path().size() + 1 );
+      changed[ relativePath ].set_external( const_cast< conduit::Node & >( leaf ) );
+    }
+  } );
 }
 
 } /* end namespace dataRepository */
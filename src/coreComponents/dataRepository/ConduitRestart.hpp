@@ -27,6 +27,9 @@
 #include <conduit.hpp>
 
 // System includes
+#include <cstdint>
+#include <map>
+#include <mutex>
 #include <string>
 
 /// @cond DO_NOT_DOCUMENT
@@ -88,12 +91,85 @@ using conduitTypeInfo = internal::conduitTypeInfo< std::remove_const_t< std::rem
 
 extern conduit::Node rootConduitNode;
 
-std::string writeRootFile( conduit::Node & root, std::string const & rootPath );
+/**
+ * @brief Get the lock serializing the Conduit HDF5 writes of the main thread and of the background writers.
+ * @return the mutex
+ *
+ * HDF5 is not assumed to be thread safe.
+ */
+std::mutex & hdf5WriteMutex();
+
+std::string writeRootFile( conduit::Node & root,
+                           std::string const & rootPath,
+                           int const ranksPerFile = 1,
+                           std::string const & basePath = "" );
+
+/**
+ * @brief Write out the restart tree.
+ * @param path the path of the restart, without extension
+ * @param ranksPerFile the number of consecutive ranks writing their tree into the same file
+ */
+void writeTree( std::string const & path, int const ranksPerFile = 1 );
 
-void writeTree( std::string const & path );
+/**
+ * @brief Write out a restart tree.
+ * @param path the path of the restart, without extension
+ * @param tree the tree to write
+ * @param ranksPerFile the number of consecutive ranks writing their tree into the same file
+ * @param basePath the path of the restart providing the arrays missing from @p tree, empty for a full restart
+ */
+void writeTree( std::string const & path,
+                conduit::Node const & tree,
+                int const ranksPerFile,
+                std::string const & basePath );
 
+/**
+ * @brief Read in the restart tree into rootConduitNode.
+ * @param path the path of the restart, without extension
+ *
+ * Only the structure of the tree is read: the values of the arrays of a full restart are left in the
+ * file, which stays open until finishLoadingTree(), and are read by readRestartValues() straight into
+ * the buffers of the wrappers.
+ */
 void loadTree( std::string const & path );
 
+/**
+ * @brief Close the restart file opened by loadTree(), once all the wrappers have been loaded.
+ */
+void finishLoadingTree();
+
+/**
+ * @brief Get the size of the values of a wrapper of the restart tree.
+ * @param node the node of the wrapper
+ * @return the size in bytes of the values, read or left in the restart file
+ */
+localIndex restartValuesByteSize( conduit::Node const & node );
+
+/**
+ * @brief Copy the values of a wrapper of the restart tree into a buffer.
+ * @param node the node of the wrapper
+ * @param dst the buffer, of at least @p numBytes bytes
+ * @param numBytes the size of the values, must be restartValuesByteSize( @p node )
+ */
+void readRestartValues( conduit::Node const & node, void * const dst, localIndex const numBytes );
+
+/**
+ * @brief Compute the hashes of the leaves of a tree.
+ * @param tree the tree
+ * @param hashes the hash of each leaf, indexed by its path
+ */
+void hashTree( conduit::Node const & tree, std::map< std::string, std::uint64_t > & hashes );
+
+/**
+ * @brief Gather the leaves of a tree which differ from a base tree.
+ * @param tree the tree
+ * @param baseHashes the hashes of the leaves of the base tree, as computed by hashTree()
+ * @param changed the tree referencing the leaves of @p tree absent from the base tree or with a different hash
+ */
+void extractChangedTree( conduit::Node const & tree,
+                         std::map< std::string, std::uint64_t > const & baseHashes,
+                         conduit::Node & changed );
+
 } // namespace dataRepository
 } // namespace geosx
 
@@ -22,6 +22,8 @@
 #include "common/DataTypes.hpp"
 #include "Group.hpp"
 
+#include <functional>
+
 
 namespace geosx
 {
@@ -57,6 +59,37 @@ public:
                         real64 const eventProgress,
                         dataRepository::Group * domain ) = 0;
 
+  /**
+   * @brief Check if the target can split its execution with DeferExecution().
+   * @return true if the target supports a deferred execution
+   */
+  virtual bool CanDeferExecution() const
+  { return false; }
+
+  /**
+   * @brief Execute the part of the target reading the state, and return the rest of its execution.
+   * @param[in] time_n        current time level
+   * @param[in] dt            time step to be taken
+   * @param[in] cycleNumber   global cycle number
+   * @param[in] eventCounter  index of event that triggered execution
+   * @param[in] eventProgress fractional progress in current cycle
+   * @param[in,out] domain    the physical domain up-casted to a Group.
+   * @return the rest of the execution, which only reads copies owned by the function
+   *
+   * This replaces Execute() for the events executing their target concurrently. The returned function runs
+   * on a background thread while the next events execute: it must not call MPI, nor access the data repository.
+   */
+  virtual std::function< void() > DeferExecution( real64 const time_n,
+                                                  real64 const dt,
+                                                  integer const cycleNumber,
+                                                  integer const eventCounter,
+                                                  real64 const eventProgress,
+                                                  dataRepository::Group * domain )
+  {
+    Execute( time_n, dt, cycleNumber, eventCounter, eventProgress, domain );
+    return {};
+  }
+
   /**
    * @brief Inform the object that it expects to execute during the next timestep.
    * @param[in] time_n        current time level
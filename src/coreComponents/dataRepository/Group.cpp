@@ -15,6 +15,7 @@
 // Source includes
 #include "Group.hpp"
 #include "ConduitRestart.hpp"
+#include "SetupProfiler.hpp"
 #include "codingUtilities/StringUtilities.hpp"
 #include "common/TimingMacros.hpp"
 
@@ -129,6 +130,14 @@ void Group::ProcessInputFileRecursive( xmlWrapper::xmlNode & targetNode )
 {
   xmlWrapper::addIncludedXML( targetNode );
 
+  // the decks may have thousands of children under a node, reserve the room for all of them at once
+  localIndex numChildNodes = 0;
+  for( xmlWrapper::xmlNode childNode=targetNode.first_child(); childNode; childNode=childNode.next_sibling())
+  {
+    ++numChildNodes;
+  }
+  m_subGroups.reserve( m_subGroups.size() + numChildNodes );
+
   // loop over the child nodes of the targetNode
   for( xmlWrapper::xmlNode childNode=targetNode.first_child(); childNode; childNode=childNode.next_sibling())
   {
@@ -260,7 +269,11 @@ void Group::Initialize( Group * const group )
 {
   static localIndex indent = 0;
 
-  InitializePreSubGroups( group );
+  string const typeName = LvArray::system::demangleType( *this );
+  {
+    SetupProfiler::ScopedPhase const phase( typeName + "::InitializePreSubGroups" );
+    InitializePreSubGroups( group );
+  }
 
   string_array initOrder;
   InitializationOrder( initOrder );
@@ -272,13 +285,18 @@ void Group::Initialize( Group * const group )
     --indent;
   }
 
+  SetupProfiler::ScopedPhase const phase( typeName + "::InitializePostSubGroups" );
   InitializePostSubGroups( group );
 }
 
 
 void Group::InitializePostInitialConditions( Group * const rootGroup )
 {
-  InitializePostInitialConditions_PreSubGroups( rootGroup );
+  string const typeName = LvArray::system::demangleType( *this );
+  {
+    SetupProfiler::ScopedPhase const phase( typeName + "::InitializePostInitialConditions_PreSubGroups" );
+    InitializePostInitialConditions_PreSubGroups( rootGroup );
+  }
 
   string_array initOrder;
   InitializationOrder( initOrder );
@@ -288,6 +306,7 @@ void Group::InitializePostInitialConditions( Group * const rootGroup )
     this->GetGroup( groupName )->InitializePostInitialConditions( rootGroup );
   }
 
+  SetupProfiler::ScopedPhase const phase( typeName + "::InitializePostInitialConditions_PostSubGroups" );
   InitializePostInitialConditions_PostSubGroups( rootGroup );
 }
 
@@ -251,7 +251,7 @@ public:
   T * RegisterGroup( subGroupMap::KeyIndex const & keyIndex )
   {
     T * rval = RegisterGroup< T >( keyIndex.Key(), std::move( std::make_unique< T >( keyIndex.Key(), this )) );
-    keyIndex.setIndex( this->m_subGroups.getIndex( keyIndex.Key()) );
+    this->m_subGroups.resolve( keyIndex );
     return rval;
   }
 
@@ -353,9 +353,9 @@ public:
    * This collection of functions are used to get a sub-Group from the current group. Various methods
    * for performing the lookup are provided (localIndex, string, KeyIndex), and each have their
    * advantages and costs. The lowest cost lookup is the "localIndex" lookup. The KeyIndex lookup
-   * will add a cost for checking to make sure the index stored in KeyIndex is valid (a string
-   * compare, and a hash if it is incorrect). The string lookup is the full cost hash lookup every
-   * time that it is called.
+   * will add a cost for checking to make sure the index stored in KeyIndex is valid (an integer
+   * compare of the layout stamps, and a hash if it is incorrect). The string lookup is the full cost
+   * hash lookup every time that it is called.
    *
    * The template parameter specifies the "type" that the caller expects to lookup, and thus attempts
    * to cast the pointer that is stored in m_subGroups to a pointer of the desired type. If this
@@ -1590,9 +1590,8 @@ Wrapper< TBASE > * Group::registerWrapper( std::string const & name,
 template< typename T, typename TBASE >
 Wrapper< TBASE > * Group::registerWrapper( ViewKey const & viewKey )
 {
-  ViewKey::index_type index;
-  Wrapper< TBASE > * const rval = registerWrapper< T, TBASE >( viewKey.Key(), &index );
-  viewKey.setIndex( index );
+  Wrapper< TBASE > * const rval = registerWrapper< T, TBASE >( viewKey.Key() );
+  m_wrappers.resolve( viewKey );
 
   return rval;
 }
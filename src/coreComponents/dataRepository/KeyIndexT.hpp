@@ -19,6 +19,7 @@
 #ifndef GEOSX_DATAREPOSITORY_KEYINDEXT_HPP_
 #define GEOSX_DATAREPOSITORY_KEYINDEXT_HPP_
 
+#include <cstdint>
 #include <string>
 #include <ostream>
 
@@ -33,6 +34,12 @@
  * INDEX_TYPE that defaults to an int. The key is const, while the index is set
  * upon first use. The intent is to use the index for lookups, and check the
  * key to confirm the key is correct.
+ *
+ * Along with the index, the KeyIndex keeps the layout stamp of the MappedVector
+ * that resolved it. The stamps are unique across the containers and change when
+ * the indices of a container are shifted, so that a cached index is validated by
+ * a single integer comparison, and a KeyIndex used on another container, or after
+ * an erase, is resolved again by key instead of returning the wrong value.
  */
 template< typename KEY_TYPE = std::string,
           typename INDEX_TYPE = int,
@@ -60,7 +67,8 @@ public:
    */
   KeyIndexT( KEY_TYPE const & key ):
     m_key( key ),
-    m_index( INVALID_INDEX )
+    m_index( INVALID_INDEX ),
+    m_stamp( 0 )
   {}
 
   /**
@@ -112,6 +120,13 @@ public:
   INDEX_TYPE const & Index() const
   { return m_index; }
 
+  /**
+   * @brief Access for the layout stamp of the container that set the index.
+   * @return the stamp, zero if the index was not set by a container
+   */
+  std::uint64_t Stamp() const
+  { return m_stamp; }
+
   /**
    * @brief Check to see of the index has been set.
    * @return true if the index has been set
@@ -128,6 +143,18 @@ public:
   void setIndex( INDEX_TYPE const & index ) const
   {
     m_index = index;
+    m_stamp = 0;
+  }
+
+  /**
+   * @brief Set the index along with the layout stamp of the container it is valid for.
+   * @param[in] index new value of the index
+   * @param[in] stamp the layout stamp of the container
+   */
+  void setIndex( INDEX_TYPE const & index, std::uint64_t const stamp ) const
+  {
+    m_index = index;
+    m_stamp = stamp;
   }
 
 private:
@@ -136,6 +163,9 @@ private:
 
   /// index value
   INDEX_TYPE mutable m_index;
+
+  /// layout stamp of the container the index is valid for
+  std::uint64_t mutable m_stamp;
 };
 
 /**
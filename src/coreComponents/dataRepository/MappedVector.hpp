@@ -26,10 +26,27 @@
 #include "LvArray/src/limits.hpp"
 
 // System includes
+#include <atomic>
 #include <vector>
 
 namespace geosx
 {
+
+namespace internal
+{
+
+/**
+ * @brief Get a new layout stamp for a MappedVector.
+ * @return a stamp that was never returned before, never zero
+ */
+inline std::uint64_t newMappedVectorStamp()
+{
+  static std::atomic< std::uint64_t > lastStamp( 0 );
+  return ++lastStamp;
+}
+
+}
+
 /**
  * @class MappedVector
  *
@@ -39,7 +56,9 @@ namespace geosx
  * of a mapped key lookup O(n) if only the key is known.
  *
  * In addition, a keyIndex can be used for lookup, which will give similar
- * performance to an index lookup after the first use of a keyIndex.
+ * performance to an index lookup after the first use of a keyIndex. The index
+ * cached in the keyIndex is checked against the layout stamp of the container,
+ * which changes whenever the indices are shifted by an erase or a clear.
  */
 template< typename T,
           typename T_PTR=T *,
@@ -109,8 +128,10 @@ public:
   using KeyIndex = KeyIndexT< KEY_TYPE const, INDEX_TYPE >;
 
 
-  /// deleted default constructor
-  MappedVector() = default;
+  /// default constructor
+  MappedVector():
+    m_stamp( internal::newMappedVectorStamp() )
+  {}
 
   /// default destructor
   ~MappedVector()
@@ -193,24 +214,7 @@ public:
    * @return pointer to const T
    */
   inline T const * operator[]( KeyIndex const & keyIndex ) const
-  {
-    INDEX_TYPE index = keyIndex.Index();
-
-    if( index==KeyIndex::invalid_index )
-    {
-      index = getIndex( keyIndex.Key() );
-      keyIndex.setIndex( index );
-    }
-#ifdef MAPPED_VECTOR_RANGE_CHECKING
-    else if( m_values[index].first!=keyIndex.Key() )
-    {
-      index = getIndex( keyIndex.Key() );
-      keyIndex.setIndex( index );
-    }
-#endif
-
-    return this->operator[]( index );
-  }
+  { return this->operator[]( resolve( keyIndex ) ); }
 
   /**
    *
@@ -283,6 +287,37 @@ public:
     return ( iter!=m_keyLookup.end() ? iter->second : KeyIndex::invalid_index );
   }
 
+  /**
+   * @brief Get the index of a keyIndex, using its cached index if it is valid for this container.
+   * @param keyIndex the keyIndex, its index is updated if it was resolved by key
+   * @return index associated with the key, invalid_index if the key is not found
+   *
+   * The cached index is valid if it was set by a container with the same layout stamp, which
+   * costs one integer comparison instead of the hash of the key. The failed lookups are not
+   * cached, so that a key inserted later is found.
+   */
+  inline INDEX_TYPE resolve( KeyIndex const & keyIndex ) const
+  {
+    if( keyIndex.Stamp() == m_stamp )
+    {
+      return keyIndex.Index();
+    }
+
+    INDEX_TYPE const index = getIndex( keyIndex.Key() );
+    if( index != KeyIndex::invalid_index )
+    {
+      keyIndex.setIndex( index, m_stamp );
+    }
+    return index;
+  }
+
+  /**
+   * @brief Get the layout stamp of the container.
+   * @return the stamp, it changes when the indices of the values are shifted
+   */
+  inline std::uint64_t stamp() const
+  { return m_stamp; }
+
 
   /**
    * @name modifier functions
@@ -319,8 +354,9 @@ public:
     // delete lookup entry
     m_keyLookup.erase( m_values[index].first );
 
-    // delete and shift vector entries
+    // delete and shift vector entries, the cached indices are no longer valid
     m_values.erase( m_values.begin() + index );
+    m_stamp = internal::newMappedVectorStamp();
     m_ownsValues.erase( m_ownsValues.begin() + index );
 
     // rebuild parts of const key vectors after deleted entry
@@ -362,14 +398,11 @@ public:
    */
   void erase( KeyIndex & keyIndex )
   {
-    INDEX_TYPE index = keyIndex.Index();
-
-    if( (index==KeyIndex::invalid_index) || (m_values[index].first!=keyIndex.Key()) )
+    INDEX_TYPE const index = resolve( keyIndex );
+    if( index != KeyIndex::invalid_index )
     {
-      index = getIndex( keyIndex.Key() );
-      keyIndex.setIndex( index );
+      erase( index );
     }
-    erase( index );
   }
 
   /**
@@ -386,9 +419,25 @@ public:
     m_values.clear();
     m_ownsValues.clear();
     m_keyLookup.clear();
+    m_stamp = internal::newMappedVectorStamp();
   }
 
 
+  /**
+   * @brief function to reserve the memory for a number of entries
+   * @param newCapacity the number of entries
+   *
+   * Inserting up to @p newCapacity entries then neither reallocates the containers nor rehashes the lookup map.
+   */
+  void reserve( INDEX_TYPE const newCapacity )
+  {
+    m_values.reserve( newCapacity );
+    m_ownsValues.reserve( newCapacity );
+    m_constKeyValues.reserve( newCapacity );
+    m_constValues.reserve( newCapacity );
+    m_keyLookup.reserve( newCapacity );
+  }
+
   ///@}
 
   /**
@@ -458,6 +507,9 @@ private:
 
   /// flag to indicate whether or not the values in m_values are owned by the container.
   std::vector< int > m_ownsValues;
+
+  /// layout stamp, unique across the containers and renewed when the indices are shifted
+  std::uint64_t m_stamp;
 };
 
 template< typename T, typename T_PTR, typename KEY_TYPE, typename INDEX_TYPE >
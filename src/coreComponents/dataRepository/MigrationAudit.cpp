@@ -0,0 +1,185 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MigrationAudit.cpp
+ */
+
+#include "MigrationAudit.hpp"
+
+#include "common/Logger.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <vector>
+
+namespace geosx
+{
+
+namespace dataRepository
+{
+
+namespace
+{
+
+/// What was moved for one wrapper or one call site
+struct MoveRecord
+{
+  globalIndex movesToHost = 0;
+  globalIndex movesToDevice = 0;
+  globalIndex touchingMovesToHost = 0;
+  globalIndex bytesToHost = 0;
+  globalIndex bytesToDevice = 0;
+};
+
+struct Records
+{
+  bool enabled = false;
+  std::vector< string > sites;
+  std::map< string, MoveRecord > wrappers;
+  std::map< string, MoveRecord > callSites;
+};
+
+Records & records()
+{
+  static Records rec;
+  return rec;
+}
+
+void addMove( MoveRecord & record, globalIndex const bytes, bool const toHost, bool const touch )
+{
+  if( toHost )
+  {
+    ++record.movesToHost;
+    record.bytesToHost += bytes;
+    record.touchingMovesToHost += touch;
+  }
+  else
+  {
+    ++record.movesToDevice;
+    record.bytesToDevice += bytes;
+  }
+}
+
+void printTable( string const & title, std::map< string, MoveRecord > const & table )
+{
+  // the heaviest entries first
+  std::vector< std::pair< string, MoveRecord > > entries( table.begin(), table.end() );
+  std::sort( entries.begin(), entries.end(), []( std::pair< string, MoveRecord > const & a, std::pair< string, MoveRecord > const & b )
+  {
+    return a.second.bytesToHost + a.second.bytesToDevice > b.second.bytesToHost + b.second.bytesToDevice;
+  } );
+
+  GEOSX_LOG_RANK( std::setw( 12 ) << "to host" << " | " <<
+                  std::setw( 14 ) << "bytes to host" << " | " <<
+                  std::setw( 14 ) << "touching host" << " | " <<
+                  std::setw( 12 ) << "to device" << " | " <<
+                  std::setw( 16 ) << "bytes to device" << " | " << title );
+  for( std::pair< string, MoveRecord > const & entry : entries )
+  {
+    GEOSX_LOG_RANK( std::setw( 12 ) << entry.second.movesToHost << " | " <<
+                    std::setw( 14 ) << entry.second.bytesToHost << " | " <<
+                    std::setw( 14 ) << entry.second.touchingMovesToHost << " | " <<
+                    std::setw( 12 ) << entry.second.movesToDevice << " | " <<
+                    std::setw( 16 ) << entry.second.bytesToDevice << " | " << entry.first );
+  }
+}
+
+}
+
+void MigrationAudit::setEnabled( bool const enabled )
+{
+  records().enabled = enabled;
+}
+
+bool MigrationAudit::isEnabled()
+{
+  return records().enabled;
+}
+
+void MigrationAudit::recordMove( string const & name,
+                                 localIndex const bytes,
+                                 LvArray::MemorySpace const space,
+                                 bool const touch )
+{
+  if( !isEnabled() )
+  {
+    return;
+  }
+
+  bool const toHost = ( space == LvArray::MemorySpace::CPU );
+  string const site = currentSite();
+
+  GEOSX_LOG_RANK( "Move of " << name << " (" << bytes << " bytes) to the " << ( toHost ? "host" : "device" ) <<
+                  ( touch ? ", touched" : "" ) << ", from " << site );
+
+  Records & rec = records();
+  globalIndex const numBytes = LvArray::integerConversion< globalIndex >( bytes );
+  addMove( rec.wrappers[ name ], numBytes, toHost, touch );
+  addMove( rec.callSites[ site ], numBytes, toHost, touch );
+}
+
+string MigrationAudit::currentSite()
+{
+  std::vector< string > const & sites = records().sites;
+  if( sites.empty() )
+  {
+    return "unknown";
+  }
+
+  string site = sites.front();
+  for( std::size_t i = 1; i < sites.size(); ++i )
+  {
+    site += "/" + sites[i];
+  }
+  return site;
+}
+
+void MigrationAudit::printSummary()
+{
+  if( !isEnabled() )
+  {
+    return;
+  }
+
+  Records const & rec = records();
+  GEOSX_LOG_RANK( "\nHost/device moves by wrapper:" );
+  printTable( "wrapper", rec.wrappers );
+  GEOSX_LOG_RANK( "\nHost/device moves by call site:" );
+  printTable( "call site", rec.callSites );
+}
+
+MigrationAudit::ScopedSite::ScopedSite( string const & name ):
+  m_pushed( false )
+{
+  Records & rec = records();
+  if( rec.enabled )
+  {
+    m_pushed = true;
+    rec.sites.emplace_back( name );
+  }
+}
+
+MigrationAudit::ScopedSite::~ScopedSite()
+{
+  if( m_pushed )
+  {
+    records().sites.pop_back();
+  }
+}
+
+} /* namespace dataRepository */
+
+} /* namespace geosx */
@@ -0,0 +1,117 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MigrationAudit.hpp
+ */
+
+#ifndef GEOSX_DATAREPOSITORY_MIGRATIONAUDIT_HPP_
+#define GEOSX_DATAREPOSITORY_MIGRATIONAUDIT_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+namespace dataRepository
+{
+
+/**
+ * @class MigrationAudit
+ *
+ * Records the explicit host/device moves of the wrappers (Wrapper::move, and the host moves done before a resize):
+ * the wrapper, the size of its allocation, the destination, whether the move marks the data as modified in the
+ * destination, and the call site, given by the nested ScopedSite regions. The moves to the host that touch the data
+ * make the device copy stale, so that the next device kernel copies the data back, and are counted apart: a
+ * wrapper that is only read on the host (output, norms) should be moved without touch.
+ *
+ * The moves done when a view is captured by a device kernel do not go through the wrappers, and are logged by
+ * the array callbacks instead (see --suppress-move-logging). Nothing is recorded unless the audit is enabled
+ * (--migration-audit), in which case every move is logged and the summary of the rank is printed at the end of the
+ * run.
+ */
+class MigrationAudit
+{
+public:
+
+  /**
+   * @brief Enable or disable the recording.
+   * @param enabled whether to record the moves
+   */
+  static void setEnabled( bool const enabled );
+
+  /**
+   * @brief Get whether the moves are recorded.
+   * @return true if the moves are recorded
+   */
+  static bool isEnabled();
+
+  /**
+   * @brief Record a move of a wrapper.
+   * @param name the path of the wrapper
+   * @param bytes the size of the allocation of the wrapper
+   * @param space the destination of the move
+   * @param touch whether the move marks the data as modified in @p space
+   */
+  static void recordMove( string const & name,
+                          localIndex const bytes,
+                          LvArray::MemorySpace const space,
+                          bool const touch );
+
+  /**
+   * @brief Get the call site of the moves currently taking place.
+   * @return the names of the nested sites separated by '/', or "unknown" outside of any site
+   */
+  static string currentSite();
+
+  /**
+   * @brief Print the summary of the rank.
+   */
+  static void printSummary();
+
+  /**
+   * @class ScopedSite
+   * Names the call site of the moves for its lifetime. The nested sites are appended to the enclosing ones.
+   */
+  class ScopedSite
+  {
+public:
+
+    /**
+     * @brief Constructor.
+     * @param name the name of the site
+     */
+    explicit ScopedSite( string const & name );
+
+    /**
+     * @brief Destructor, restores the enclosing site.
+     */
+    ~ScopedSite();
+
+    ScopedSite( ScopedSite const & ) = delete;
+    ScopedSite( ScopedSite && ) = delete;
+    ScopedSite & operator=( ScopedSite const & ) = delete;
+    ScopedSite & operator=( ScopedSite && ) = delete;
+
+private:
+    /// Whether this scope pushed a site
+    bool m_pushed;
+  };
+};
+
+} /* namespace dataRepository */
+
+} /* namespace geosx */
+
+#endif /* GEOSX_DATAREPOSITORY_MIGRATIONAUDIT_HPP_ */
@@ -0,0 +1,149 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SetupProfiler.cpp
+ */
+
+#include "SetupProfiler.hpp"
+
+#include "common/Logger.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+namespace geosx
+{
+
+namespace dataRepository
+{
+
+namespace
+{
+
+/// The time and the number of calls of one phase
+struct PhaseRecord
+{
+  string name;
+  real64 seconds = 0.0;
+  globalIndex calls = 0;
+};
+
+struct Records
+{
+  /// The phases in the order they were first timed
+  std::vector< PhaseRecord > phases;
+  std::unordered_map< string, std::size_t > index;
+};
+
+Records & records()
+{
+  static Records rec;
+  return rec;
+}
+
+PhaseRecord const * findPhase( string const & name )
+{
+  Records const & rec = records();
+  std::unordered_map< string, std::size_t >::const_iterator const iter = rec.index.find( name );
+  return iter == rec.index.end() ? nullptr : &rec.phases[ iter->second ];
+}
+
+}
+
+void SetupProfiler::record( string const & name, real64 const seconds )
+{
+  Records & rec = records();
+  std::unordered_map< string, std::size_t >::const_iterator const iter = rec.index.find( name );
+  std::size_t i;
+  if( iter == rec.index.end() )
+  {
+    i = rec.phases.size();
+    rec.index.emplace( name, i );
+    rec.phases.emplace_back();
+    rec.phases.back().name = name;
+  }
+  else
+  {
+    i = iter->second;
+  }
+  rec.phases[i].seconds += seconds;
+  ++rec.phases[i].calls;
+}
+
+real64 SetupProfiler::elapsedTime( string const & name )
+{
+  PhaseRecord const * const phase = findPhase( name );
+  return phase == nullptr ? 0.0 : phase->seconds;
+}
+
+void SetupProfiler::printSummary()
+{
+  Records & rec = records();
+
+  // the ranks may not have timed the same phases, the ones of rank 0 are reported
+  std::ostringstream namesStream;
+  for( PhaseRecord const & phase : rec.phases )
+  {
+    namesStream << phase.name << '\n';
+  }
+  string names = namesStream.str();
+  MpiWrapper::Broadcast( names, 0 );
+
+  std::vector< string > phaseNames;
+  std::istringstream namesInput( names );
+  for( string name; std::getline( namesInput, name ); )
+  {
+    phaseNames.emplace_back( name );
+  }
+
+  int const numPhases = LvArray::integerConversion< int >( phaseNames.size() );
+  std::vector< real64 > seconds( numPhases );
+  for( int p = 0; p < numPhases; ++p )
+  {
+    seconds[p] = elapsedTime( phaseNames[p] );
+  }
+
+  std::vector< real64 > minSeconds( numPhases );
+  std::vector< real64 > maxSeconds( numPhases );
+  std::vector< real64 > sumSeconds( numPhases );
+  MpiWrapper::allReduce( seconds.data(), minSeconds.data(), numPhases, MPI_MIN, MPI_COMM_GEOSX );
+  MpiWrapper::allReduce( seconds.data(), maxSeconds.data(), numPhases, MPI_MAX, MPI_COMM_GEOSX );
+  MpiWrapper::allReduce( seconds.data(), sumSeconds.data(), numPhases, MPI_SUM, MPI_COMM_GEOSX );
+
+  int const numRanks = MpiWrapper::Comm_size();
+  GEOSX_LOG_RANK_0( "\nSetup phases over " << numRanks << " ranks:" );
+  GEOSX_LOG_RANK_0( std::setw( 10 ) << "calls" << " | " <<
+                    std::setw( 12 ) << "min (s)" << " | " <<
+                    std::setw( 12 ) << "avg (s)" << " | " <<
+                    std::setw( 12 ) << "max (s)" << " | phase" );
+  for( int p = 0; p < numPhases; ++p )
+  {
+    PhaseRecord const * const phase = findPhase( phaseNames[p] );
+    GEOSX_LOG_RANK_0( std::setw( 10 ) << ( phase == nullptr ? 0 : phase->calls ) << " | " <<
+                      std::setw( 12 ) << minSeconds[p] << " | " <<
+                      std::setw( 12 ) << sumSeconds[p] / numRanks << " | " <<
+                      std::setw( 12 ) << maxSeconds[p] << " | " << phaseNames[p] );
+  }
+
+  rec.phases.clear();
+  rec.index.clear();
+}
+
+} /* namespace dataRepository */
+
+} /* namespace geosx */
@@ -0,0 +1,104 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SetupProfiler.hpp
+ */
+
+#ifndef GEOSX_DATAREPOSITORY_SETUPPROFILER_HPP_
+#define GEOSX_DATAREPOSITORY_SETUPPROFILER_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/Stopwatch.hpp"
+
+namespace geosx
+{
+
+namespace dataRepository
+{
+
+/**
+ * @class SetupProfiler
+ *
+ * Times the phases of the problem setup (input parsing, mesh generation, numerical methods, initialization
+ * passes, initial conditions) and the Initialize* callbacks of each type of Group, whether or not Caliper is
+ * enabled. A phase is timed by a ScopedPhase, the time of a phase includes the phases nested in it, and the
+ * repeated phases (the callbacks of the groups of a type) are summed. The timers only read a steady clock, so
+ * they are always on, and printSummary() prints the min/avg/max over the ranks at the end of the setup.
+ */
+class SetupProfiler
+{
+public:
+
+  /**
+   * @brief Add the time spent in a phase.
+   * @param name the name of the phase
+   * @param seconds the time spent in the phase
+   */
+  static void record( string const & name, real64 const seconds );
+
+  /**
+   * @brief Get the time spent in a phase so far.
+   * @param name the name of the phase
+   * @return the time in seconds, 0 if the phase was never timed
+   */
+  static real64 elapsedTime( string const & name );
+
+  /**
+   * @brief Print the time of each phase timed on rank 0, as min/avg/max over the ranks, and reset the timers.
+   *        Collective over MPI_COMM_GEOSX.
+   */
+  static void printSummary();
+
+  /**
+   * @class ScopedPhase
+   * Adds its lifetime to the time of a phase.
+   */
+  class ScopedPhase
+  {
+public:
+
+    /**
+     * @brief Constructor, starts the timer.
+     * @param name the name of the phase
+     */
+    explicit ScopedPhase( string name ):
+      m_name( std::move( name ) ),
+      m_stopwatch()
+    {}
+
+    /**
+     * @brief Destructor, records the elapsed time.
+     */
+    ~ScopedPhase()
+    { record( m_name, m_stopwatch.elapsedTime() ); }
+
+    ScopedPhase( ScopedPhase const & ) = delete;
+    ScopedPhase( ScopedPhase && ) = delete;
+    ScopedPhase & operator=( ScopedPhase const & ) = delete;
+    ScopedPhase & operator=( ScopedPhase && ) = delete;
+
+private:
+    /// The name of the phase
+    string const m_name;
+    /// The timer started at construction
+    Stopwatch m_stopwatch;
+  };
+};
+
+} /* namespace dataRepository */
+
+} /* namespace geosx */
+
+#endif /* GEOSX_DATAREPOSITORY_SETUPPROFILER_HPP_ */
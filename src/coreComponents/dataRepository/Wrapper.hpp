@@ -33,6 +33,7 @@
 #include "common/GeosxConfig.hpp"
 #include "DefaultValue.hpp"
 #include "LvArray/src/system.hpp"
+#include "MigrationAudit.hpp"
 #include "WrapperBase.hpp"
 
 // System includes
@@ -283,8 +284,7 @@ public:
   {
     if( onDevice )
     {
-      // this isn't accurate if array/arraview return false for this, which I think they do
-      return bufferOps::can_memcpy< T >;
+      return bufferOps::is_device_packable< T >;
     }
     else
     {
@@ -488,14 +488,14 @@ public:
   ///////////////////////////////////////////////////////////////////////////////////////////////////
   virtual void resize( int ndims, localIndex const * const dims ) override
   {
-    wrapperHelpers::move( *m_data, LvArray::MemorySpace::CPU, true );
+    move( LvArray::MemorySpace::CPU, true );
     wrapperHelpers::resizeDimensions( *m_data, ndims, dims );
   }
 
   ///////////////////////////////////////////////////////////////////////////////////////////////////
   virtual void reserve( localIndex const newCapacity ) override
   {
-    wrapperHelpers::move( *m_data, LvArray::MemorySpace::CPU, true );
+    move( LvArray::MemorySpace::CPU, true );
     wrapperHelpers::reserve( reference(), newCapacity );
   }
 
@@ -506,10 +506,14 @@ public:
     return wrapperHelpers::capacity( *m_data );
   }
 
+  ///////////////////////////////////////////////////////////////////////////////////////////////////
+  virtual localIndex bytesAllocated() const override
+  { return wrapperHelpers::bytesAllocated( *m_data ); }
+
   ///////////////////////////////////////////////////////////////////////////////////////////////////
   virtual void resize( localIndex const newSize ) override
   {
-    wrapperHelpers::move( *m_data, LvArray::MemorySpace::CPU, true );
+    move( LvArray::MemorySpace::CPU, true );
     wrapperHelpers::resizeDefault( reference(), newSize, m_default );
   }
 
@@ -568,7 +572,23 @@ public:
 
   ///////////////////////////////////////////////////////////////////////////////////////////////////
   virtual void move( LvArray::MemorySpace const space, bool const touch ) const override
-  { return wrapperHelpers::move( *m_data, space, touch ); }
+  {
+    if( traits::HasMemberFunction_move< T > && MigrationAudit::isEnabled() )
+    {
+      MigrationAudit::recordMove( m_conduitNode.path(), bytesAllocated(), space, touch );
+    }
+    wrapperHelpers::move( *m_data, space, touch );
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////
+  virtual BufferDescription describeBuffer( LvArray::MemorySpace const space, bool const touch ) const override
+  {
+    if( traits::HasMemberFunction_move< T > && MigrationAudit::isEnabled() )
+    {
+      MigrationAudit::recordMove( m_conduitNode.path(), bytesAllocated(), space, touch );
+    }
+    return wrapperHelpers::describeBuffer( *m_data, space, touch );
+  }
 
   ///////////////////////////////////////////////////////////////////////////////////////////////////
   virtual string typeRegex() const override
@@ -41,6 +41,44 @@ namespace dataRepository
 
 class Group;
 
+/**
+ * @struct BufferDescription
+ * @brief Description of the values of a wrapped array, enough to expose them without a copy
+ *        (Python buffer protocol, NumPy, DLPack).
+ */
+struct BufferDescription
+{
+  /// The maximum number of dimensions described
+  static constexpr int maxDims = 6;
+
+  /**
+   * @enum Kind
+   * The kind of the values, following the DLPack type codes.
+   */
+  enum class Kind : integer
+  {
+    None,  ///< The wrapped type is not an array of numbers
+    Int,   ///< Signed integers
+    UInt,  ///< Unsigned integers
+    Float  ///< Floating point numbers
+  };
+
+  /// The first value, in the memory space @p space, nullptr if @p kind is None
+  void * data = nullptr;
+  /// The kind of the values
+  Kind kind = Kind::None;
+  /// The size of a value in bytes
+  integer itemSize = 0;
+  /// The number of dimensions
+  integer numDims = 0;
+  /// The size of each dimension
+  localIndex dims[ maxDims ] = {};
+  /// The stride of each dimension, in number of values
+  localIndex strides[ maxDims ] = {};
+  /// The memory space holding @p data
+  LvArray::MemorySpace space = LvArray::MemorySpace::CPU;
+};
+
 /**
  * @class WrapperBase
  * @brief Base class for all wrappers containing common operations
@@ -120,6 +158,12 @@ public:
    */
   virtual localIndex capacity() const = 0;
 
+  /**
+   * @brief @return the number of bytes allocated by T, including its spare capacity.
+   *        For the types that do not own a buffer it is sizeof( T ).
+   */
+  virtual localIndex bytesAllocated() const = 0;
+
   /**
    * @brief Calls T::resize(newsize) if it exists.
    * @param[in] newsize parameter to pass to T::resize(newsize)
@@ -145,6 +189,16 @@ public:
    */
   virtual void move( LvArray::MemorySpace const space, bool const touch ) const = 0;
 
+  /**
+   * @brief Move the data into a memory space and describe its values there.
+   * @param[in] space the memory space in which the values are accessed
+   * @param[in] touch whether the values will be modified in @p space
+   * @return the description of the values, of kind None if T is not an array of numbers
+   *
+   * The description stays valid until the data is moved with touch to another space, or reallocated.
+   */
+  virtual BufferDescription describeBuffer( LvArray::MemorySpace const space, bool const touch ) const = 0;
+
   /**
    * @brief Calls TypeRegex< T >::get().
    * @return regex used to validate inputs of wrapped type
@@ -0,0 +1,145 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file WrapperSnapshot.cpp
+ */
+
+#include "WrapperSnapshot.hpp"
+
+#include "Group.hpp"
+#include "WrapperBase.hpp"
+
+#ifdef GEOSX_USE_CHAI
+#include <umpire/ResourceManager.hpp>
+#endif
+
+#include <cstring>
+
+namespace geosx
+{
+
+namespace dataRepository
+{
+
+namespace
+{
+
+/// The memory space of the copies, where the kernels leave the values
+#if defined(GEOSX_USE_DEVICE)
+constexpr LvArray::MemorySpace snapshotSpace = LvArray::MemorySpace::GPU;
+#else
+constexpr LvArray::MemorySpace snapshotSpace = LvArray::MemorySpace::CPU;
+#endif
+
+std::size_t numBufferBytes( BufferDescription const & description )
+{
+  std::size_t numBytes = description.itemSize;
+  for( integer d = 0; d < description.numDims; ++d )
+  {
+    numBytes *= description.dims[ d ];
+  }
+  return numBytes;
+}
+
+void copyBytes( void * const dst, void * const src, std::size_t const numBytes )
+{
+  if( numBytes == 0 )
+  {
+    return;
+  }
+#ifdef GEOSX_USE_CHAI
+  // the arrays are allocated by umpire, which copies within and between the memory spaces
+  umpire::ResourceManager::getInstance().copy( dst, src, numBytes );
+#else
+  std::memcpy( dst, src, numBytes );
+#endif
+}
+
+}
+
+void WrapperSnapshot::registerWrapper( WrapperBase & wrapper )
+{
+  m_wrappers.emplace_back( &wrapper );
+  m_recorded = false;
+}
+
+void WrapperSnapshot::registerGroup( Group & group )
+{
+  group.forWrappers( [&]( WrapperBase & wrapper )
+  {
+    registerWrapper( wrapper );
+  } );
+}
+
+void WrapperSnapshot::clear()
+{
+  m_wrappers.clear();
+  m_recorded = false;
+}
+
+void WrapperSnapshot::record()
+{
+  if( m_copies.size() < m_wrappers.size() )
+  {
+    m_copies.resize( m_wrappers.size() );
+  }
+
+  for( std::size_t i = 0; i < m_wrappers.size(); ++i )
+  {
+    BufferDescription const description = m_wrappers[ i ]->describeBuffer( snapshotSpace, false );
+    std::size_t const numBytes = numBufferBytes( description );
+
+    array1d< buffer_unit_type > & copy = m_copies[ i ];
+    if( copy.size() != LvArray::integerConversion< localIndex >( numBytes ) )
+    {
+      copy.resize( numBytes );
+    }
+    copy.move( snapshotSpace, true );
+    copyBytes( copy.data(), description.data, numBytes );
+  }
+
+  m_recorded = true;
+}
+
+void WrapperSnapshot::restore()
+{
+  GEOSX_ERROR_IF( !m_recorded, "The snapshot is restored before being recorded" );
+
+  for( std::size_t i = 0; i < m_wrappers.size(); ++i )
+  {
+    BufferDescription const description = m_wrappers[ i ]->describeBuffer( snapshotSpace, true );
+    std::size_t const numBytes = numBufferBytes( description );
+
+    array1d< buffer_unit_type > & copy = m_copies[ i ];
+    GEOSX_ERROR_IF_NE_MSG( copy.size(), LvArray::integerConversion< localIndex >( numBytes ),
+                           "The wrapper " << m_wrappers[ i ]->getName() << " was resized since the snapshot was recorded" );
+    copy.move( snapshotSpace, false );
+    copyBytes( description.data, copy.data(), numBytes );
+  }
+}
+
+std::size_t WrapperSnapshot::numBytes() const
+{
+  std::size_t numBytes = 0;
+  for( std::size_t i = 0; i < m_wrappers.size() && i < m_copies.size(); ++i )
+  {
+    numBytes += m_copies[ i ].size();
+  }
+  return m_recorded ? numBytes : 0;
+}
+
+} // namespace dataRepository
+
+} // namespace geosx
@@ -0,0 +1,111 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file WrapperSnapshot.hpp
+ */
+
+#ifndef GEOSX_DATAREPOSITORY_WRAPPERSNAPSHOT_HPP_
+#define GEOSX_DATAREPOSITORY_WRAPPERSNAPSHOT_HPP_
+
+#include "common/DataTypes.hpp"
+
+#include <vector>
+
+namespace geosx
+{
+
+namespace dataRepository
+{
+
+class Group;
+class WrapperBase;
+
+/**
+ * @class WrapperSnapshot
+ * @brief Copy of the values of a set of wrapped arrays, to restore them without recomputing them.
+ *
+ * The values of each registered array are copied with a single memcpy in the memory space of the kernels
+ * (the device if there is one), and copied back on restore. The wrappers without values to describe (see
+ * WrapperBase::describeBuffer) are skipped. The copies are kept when the wrappers are cleared, so that a
+ * snapshot registering the same wrappers in the same order before each record does not allocate.
+ */
+class WrapperSnapshot
+{
+public:
+
+  /**
+   * @brief Construct an empty snapshot.
+   */
+  WrapperSnapshot() = default;
+
+  /**
+   * @brief Register a wrapper.
+   * @param wrapper the wrapper, it must outlive its registration
+   */
+  void registerWrapper( WrapperBase & wrapper );
+
+  /**
+   * @brief Register all the wrappers of a group.
+   * @param group the group, its wrappers must outlive their registration
+   */
+  void registerGroup( Group & group );
+
+  /**
+   * @brief Forget the registered wrappers and the recorded values, keeping the memory of the copies.
+   */
+  void clear();
+
+  /**
+   * @brief Copy the values of the registered wrappers.
+   */
+  void record();
+
+  /**
+   * @brief Copy the recorded values back to the registered wrappers.
+   *
+   * The wrappers must not have been resized since the record.
+   */
+  void restore();
+
+  /**
+   * @brief Check if the values have been recorded since the last clear().
+   * @return true if restore() can be called
+   */
+  bool isRecorded() const
+  { return m_recorded; }
+
+  /**
+   * @brief Get the number of bytes recorded.
+   * @return the number of bytes
+   */
+  std::size_t numBytes() const;
+
+private:
+
+  /// Registered wrappers
+  std::vector< WrapperBase * > m_wrappers;
+
+  /// Copy of the values of each registered wrapper, kept from a record to the next one
+  std::vector< array1d< buffer_unit_type > > m_copies;
+
+  /// Whether the values have been recorded since the last clear()
+  bool m_recorded = false;
+};
+
+} // namespace dataRepository
+
+} // namespace geosx
+
+#endif /* GEOSX_DATAREPOSITORY_WRAPPERSNAPSHOT_HPP_ */
@@ -0,0 +1,88 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+#include "dataRepository/Group.hpp"
+#include "dataRepository/Wrapper.hpp"
+
+using namespace geosx;
+using namespace dataRepository;
+
+TEST( KeyIndex, cachedIndexIsReusedOnTheSameGroup )
+{
+  Group group( "group", nullptr );
+  group.registerWrapper< integer >( "a" );
+  group.registerWrapper< real64 >( "b" );
+
+  ViewKey const key = { "b" };
+  EXPECT_FALSE( key.isIndexSet() );
+
+  group.getReference< real64 >( key ) = 2.0;
+  EXPECT_EQ( key.Index(), 1 );
+  EXPECT_EQ( key.Stamp(), group.wrappers().stamp() );
+  EXPECT_EQ( group.getReference< real64 >( "b" ), 2.0 );
+
+  // appending a wrapper does not move the others
+  group.registerWrapper< real64 >( "c" );
+  EXPECT_EQ( key.Stamp(), group.wrappers().stamp() );
+  EXPECT_EQ( group.getReference< real64 >( key ), 2.0 );
+}
+
+TEST( KeyIndex, cachedIndexIsNotUsedOnAnotherGroup )
+{
+  Group group0( "group0", nullptr );
+  group0.registerWrapper< real64 >( "a" );
+  group0.registerWrapper< real64 >( "b" );
+  Group group1( "group1", nullptr );
+  group1.registerWrapper< real64 >( "b" );
+  group1.registerWrapper< real64 >( "a" );
+
+  group0.getReference< real64 >( "a" ) = 1.0;
+  group1.getReference< real64 >( "a" ) = 2.0;
+
+  // the same index refers to another wrapper in the other group
+  ViewKey const key = { "a" };
+  EXPECT_EQ( group0.getReference< real64 >( key ), 1.0 );
+  EXPECT_EQ( group1.getReference< real64 >( key ), 2.0 );
+  EXPECT_EQ( key.Index(), 1 );
+  EXPECT_EQ( group0.getReference< real64 >( key ), 1.0 );
+}
+
+TEST( KeyIndex, cachedIndexIsResolvedAgainAfterErase )
+{
+  Group group( "group", nullptr );
+  group.registerWrapper< real64 >( "a" );
+  group.registerWrapper< real64 >( "b" );
+  group.getReference< real64 >( "b" ) = 2.0;
+
+  ViewKey const key = { "b" };
+  EXPECT_EQ( group.getReference< real64 >( key ), 2.0 );
+
+  group.deregisterWrapper( "a" );
+  EXPECT_NE( key.Stamp(), group.wrappers().stamp() );
+  EXPECT_EQ( group.getReference< real64 >( key ), 2.0 );
+  EXPECT_EQ( key.Index(), 0 );
+
+  group.deregisterWrapper( "b" );
+  EXPECT_EQ( group.getWrapperBase( key ), nullptr );
+}
+
+TEST( KeyIndex, subGroupLookup )
+{
+  Group group( "group", nullptr );
+  GroupKey const key = { "child" };
+  Group * const child = group.RegisterGroup( key );
+  EXPECT_EQ( key.Stamp(), group.GetSubGroups().stamp() );
+  EXPECT_EQ( group.GetGroup( key ), child );
+}
@@ -120,6 +120,90 @@ TEST( testPacking, testPackByIndex )
   }
 }
 
+TEST( testPacking, testPackByIndexContiguousSlices )
+{
+  constexpr localIndex size = 50000;
+  constexpr localIndex numComponents = 3;
+  array2d< real64 > values( size, numComponents );
+  for( localIndex ii = 0; ii < size; ++ii )
+    for( localIndex jj = 0; jj < numComponents; ++jj )
+      values[ii][jj] = ii * numComponents + jj;
+
+  // runs of consecutive indices, a small list packed by runs and a large one packed by several threads
+  for( localIndex const packCount : { localIndex( 100 ), localIndex( 20000 ) } )
+  {
+    array1d< localIndex > indices( packCount );
+    for( localIndex ii = 0; ii < packCount; ++ii )
+      indices[ii] = ( ii % 7 == 0 ) ? ( 2 * ii + 1 ) % size : ( 2 * ii ) % size;
+
+    buffer_unit_type * null_buf = NULL;
+    localIndex const calc_size = bufferOps::PackByIndex< false >( null_buf, values.toViewConst(), indices );
+    buffer_type buf( calc_size );
+    buffer_unit_type * buffer = &buf[0];
+    localIndex const packed_size = bufferOps::PackByIndex< true >( buffer, values.toViewConst(), indices );
+    EXPECT_EQ( calc_size, packed_size );
+    EXPECT_EQ( buffer - &buf[0], calc_size );
+
+    // the values follow the strides in the order of the indices
+    real64 const * const packed = reinterpret_cast< real64 const * >( &buf[ calc_size - packCount * numComponents * sizeof( real64 ) ] );
+    for( localIndex ii = 0; ii < packCount; ++ii )
+      for( localIndex jj = 0; jj < numComponents; ++jj )
+        EXPECT_EQ( packed[ ii * numComponents + jj ], values[indices[ii]][jj] );
+
+    array2d< real64 > unpacked( size, numComponents );
+    arrayView2d< real64 > unpackedView = unpacked.toView();
+    buffer_unit_type const * cbuffer = &buf[0];
+    localIndex const unpacked_size = bufferOps::UnpackByIndex( cbuffer, unpackedView, indices );
+    EXPECT_EQ( calc_size, unpacked_size );
+    for( localIndex ii = 0; ii < packCount; ++ii )
+      for( localIndex jj = 0; jj < numComponents; ++jj )
+        EXPECT_EQ( unpacked[indices[ii]][jj], values[indices[ii]][jj] );
+  }
+}
+
+TEST( testPacking, testCompactGlobalIndices )
+{
+  // sorted runs, a jump back, the unmapped marker and a large index
+  std::vector< globalIndex > const values = { 0, 1, 2, 5, 1000, 999, -1, 3, globalIndex( 1 ) << 40, 7 };
+
+  for( bool const compact : { false, true } )
+  {
+    bufferOps::setCompactGlobalIndices( compact );
+
+    buffer_unit_type * null_buf = NULL;
+    globalIndex previous = 0;
+    localIndex calc_size = 0;
+    for( globalIndex const value : values )
+      calc_size += bufferOps::PackGlobalIndex< false >( null_buf, value, previous );
+
+    buffer_type buf( calc_size );
+    buffer_unit_type * buffer = &buf[0];
+    previous = 0;
+    localIndex packed_size = 0;
+    for( globalIndex const value : values )
+      packed_size += bufferOps::PackGlobalIndex< true >( buffer, value, previous );
+    EXPECT_EQ( calc_size, packed_size );
+    EXPECT_EQ( buffer - &buf[0], calc_size );
+    if( compact )
+      EXPECT_LT( calc_size, localIndex( values.size() * sizeof( globalIndex ) ) );
+    else
+      EXPECT_EQ( calc_size, localIndex( values.size() * sizeof( globalIndex ) ) );
+
+    buffer_unit_type const * cbuffer = &buf[0];
+    previous = 0;
+    localIndex unpacked_size = 0;
+    for( globalIndex const value : values )
+    {
+      globalIndex unpacked;
+      unpacked_size += bufferOps::UnpackGlobalIndex( cbuffer, unpacked, previous );
+      EXPECT_EQ( unpacked, value );
+    }
+    EXPECT_EQ( unpacked_size, packed_size );
+  }
+
+  bufferOps::setCompactGlobalIndices( false );
+}
+
 TEST( testPacking, testTensorPacking )
 {
   std::srand( std::time( nullptr ));
@@ -141,6 +225,17 @@ TEST( testPacking, testTensorPacking )
     EXPECT_TRUE( tns[0][ii] = unp[0][ii] );
 }
 
+TEST( testPacking, testDevicePackableTypes )
+{
+  EXPECT_TRUE( bufferOps::is_device_packable< array1d< integer > > );
+  EXPECT_TRUE( bufferOps::is_device_packable< array2d< real64 > > );
+  EXPECT_TRUE( ( bufferOps::is_device_packable< array2d< real64, RAJA::PERM_JI > > ) );
+  EXPECT_TRUE( bufferOps::is_device_packable< arrayView1d< R1Tensor const > > );
+  EXPECT_FALSE( bufferOps::is_device_packable< array1d< string > > );
+  EXPECT_FALSE( bufferOps::is_device_packable< ArrayOfArrays< localIndex > > );
+  EXPECT_FALSE( bufferOps::is_device_packable< real64 > );
+}
+
 TEST( testPacking, testPackingDevice )
 {
   std::srand( std::time( nullptr ));
@@ -76,7 +76,11 @@ public:
     loadTree( m_fileName );
     m_group = new Group( m_groupName, nullptr );
     m_wrapper = m_group->registerWrapper< T >( m_wrapperName );
+
+    // The values are left in the file until the wrapper is loaded
+    EXPECT_FALSE( rootConduitNode.has_path( m_groupName + "/" + m_wrapperName + "/__values__" ) );
     m_group->loadFromConduit();
+    finishLoadingTree();
 
     // Compare metadata
     EXPECT_EQ( m_group->size(), m_groupSize );
@@ -132,6 +136,53 @@ TYPED_TEST( SingleWrapperTest, WriteAndRead )
   this->test();
 }
 
+TEST( IncrementalRestart, WriteAndRead )
+{
+  std::string const baseFileName = "testRestartBasic_IncrementalBase";
+  std::string const fileName = "testRestartBasic_Incremental";
+
+  Group * group = new Group( "root", nullptr );
+  array1d< double > & constant = group->registerWrapper< array1d< double > >( "constant" )->reference();
+  array1d< double > & changing = group->registerWrapper< array1d< double > >( "changing" )->reference();
+  fill( constant, 100 );
+  fill( changing, 100 );
+  array1d< double > const constantValue = constant;
+
+  // Write out the base restart and hash it
+  std::map< std::string, std::uint64_t > baseHashes;
+  group->prepareToWrite();
+  hashTree( rootConduitNode, baseHashes );
+  writeTree( baseFileName );
+  group->finishWriting();
+
+  // Only the changed array is written out to the incremental restart
+  changing[ 0 ] += 1.0;
+  array1d< double > const changingValue = changing;
+  group->prepareToWrite();
+  conduit::Node changedTree;
+  extractChangedTree( rootConduitNode, baseHashes, changedTree );
+  EXPECT_FALSE( changedTree.has_path( "constant/__values__" ) );
+  EXPECT_TRUE( changedTree.has_path( "changing/__values__" ) );
+  writeTree( fileName, changedTree, 1, baseFileName );
+  group->finishWriting();
+
+  delete group;
+  rootConduitNode.reset();
+
+  // The incremental restart is read on top of its base
+  loadTree( fileName );
+  group = new Group( "root", nullptr );
+  Wrapper< array1d< double > > * const constantWrapper = group->registerWrapper< array1d< double > >( "constant" );
+  Wrapper< array1d< double > > * const changingWrapper = group->registerWrapper< array1d< double > >( "changing" );
+  group->loadFromConduit();
+  finishLoadingTree();
+
+  compare( constantValue, constantWrapper->reference() );
+  compare( changingValue, changingWrapper->reference() );
+
+  delete group;
+}
+
 } // namespace testing
 } // namespace dataRepository
 } // namespace geosx
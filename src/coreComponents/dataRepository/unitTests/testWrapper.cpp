@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 #include "dataRepository/Group.hpp"
 #include "dataRepository/Wrapper.hpp"
+#include "dataRepository/WrapperSnapshot.hpp"
 
 using namespace geosx;
 using namespace dataRepository;
@@ -143,3 +144,74 @@ TYPED_TEST( WrapperSetGet, Description )
   this->testDescription( "First description." );
   this->testDescription( "Second description." );
 }
+
+TEST( WrapperBufferDescription, array2d )
+{
+  Group group( "root", nullptr );
+  Wrapper< array2d< real64 > > wrapper( "wrapper", &group );
+  wrapper.reference().resize( 3, 4 );
+
+  WrapperBase const & wrapperBase = wrapper;
+  BufferDescription const description = wrapperBase.describeBuffer( LvArray::MemorySpace::CPU, false );
+
+  EXPECT_EQ( description.data, wrapper.reference().data() );
+  EXPECT_EQ( description.kind, BufferDescription::Kind::Float );
+  EXPECT_EQ( description.itemSize, sizeof( real64 ) );
+  ASSERT_EQ( description.numDims, 2 );
+  EXPECT_EQ( description.dims[ 0 ], 3 );
+  EXPECT_EQ( description.dims[ 1 ], 4 );
+  EXPECT_EQ( description.strides[ 0 ], 4 );
+  EXPECT_EQ( description.strides[ 1 ], 1 );
+}
+
+TEST( WrapperBufferDescription, notAnArrayOfNumbers )
+{
+  Group group( "root", nullptr );
+  Wrapper< string > wrapper( "wrapper", &group );
+
+  BufferDescription const description = wrapper.describeBuffer( LvArray::MemorySpace::CPU, false );
+  EXPECT_EQ( description.data, nullptr );
+  EXPECT_EQ( description.kind, BufferDescription::Kind::None );
+}
+
+TEST( WrapperSnapshot, restoresTheRecordedValues )
+{
+  Group group( "root", nullptr );
+  array2d< real64 > & values = group.registerWrapper< array2d< real64 > >( "values" )->reference();
+  array1d< integer > & flags = group.registerWrapper< array1d< integer > >( "flags" )->reference();
+  group.registerWrapper< string >( "name" );
+  values.resize( 3, 2 );
+  flags.resize( 4 );
+  for( localIndex i = 0; i < 3; ++i )
+  {
+    values( i, 0 ) = i;
+    values( i, 1 ) = -i;
+  }
+  flags.setValues< serialPolicy >( 1 );
+
+  WrapperSnapshot snapshot;
+  snapshot.registerGroup( group );
+  EXPECT_FALSE( snapshot.isRecorded() );
+  snapshot.record();
+  EXPECT_TRUE( snapshot.isRecorded() );
+  EXPECT_EQ( snapshot.numBytes(), 6 * sizeof( real64 ) + 4 * sizeof( integer ) );
+
+  values.setValues< serialPolicy >( 7.0 );
+  flags.setValues< serialPolicy >( 0 );
+  snapshot.restore();
+
+  values.move( LvArray::MemorySpace::CPU, false );
+  flags.move( LvArray::MemorySpace::CPU, false );
+  for( localIndex i = 0; i < 3; ++i )
+  {
+    EXPECT_EQ( values( i, 0 ), i );
+    EXPECT_EQ( values( i, 1 ), -i );
+  }
+  for( localIndex i = 0; i < 4; ++i )
+  {
+    EXPECT_EQ( flags( i ), 1 );
+  }
+
+  snapshot.clear();
+  EXPECT_FALSE( snapshot.isRecorded() );
+}
@@ -138,6 +138,46 @@ TEST( testXmlWrapper, array3d )
   }
 }
 
+TEST( testXmlWrapper, array1d )
+{
+  {
+    array1d< real64 > array;
+    xmlWrapper::StringToInputVariable( array, " { 1.5, -2e3 ,0.25,\n 4 } " );
+    ASSERT_EQ( array.size(), 4 );
+    EXPECT_EQ( array[0], 1.5 );
+    EXPECT_EQ( array[1], -2e3 );
+    EXPECT_EQ( array[2], 0.25 );
+    EXPECT_EQ( array[3], 4.0 );
+  }
+  {
+    array1d< localIndex > array;
+    xmlWrapper::StringToInputVariable( array, "{ 3, -1, 12 }" );
+    ASSERT_EQ( array.size(), 3 );
+    EXPECT_EQ( array[0], 3 );
+    EXPECT_EQ( array[1], -1 );
+    EXPECT_EQ( array[2], 12 );
+  }
+  {
+    array1d< real64 > array( 3 );
+    xmlWrapper::StringToInputVariable( array, "{ }" );
+    EXPECT_EQ( array.size(), 0 );
+  }
+}
+
+TEST( testXmlWrapper, array1d_errors )
+{
+  for( string const input : { "1, 2", "{ 1, 2", "{ 1, , 2 }", "{ 1, 2, }", "{ 1 2 }", "{ {1}, 2 }", "{ 1, a }", "{ 1, 2 } 3" } )
+  {
+    array1d< real64 > array;
+    EXPECT_DEATH_IF_SUPPORTED( xmlWrapper::StringToInputVariable( array, input ), IGNORE_OUTPUT );
+  }
+  for( string const input : { "{ 1.5 }", "{ 1e3 }", "{ 4000000000 }" } )
+  {
+    array1d< int > array;
+    EXPECT_DEATH_IF_SUPPORTED( xmlWrapper::StringToInputVariable( array, input ), IGNORE_OUTPUT );
+  }
+}
+
 int main( int argc, char * argv[] )
 {
   logger::InitializeLogger();
@@ -28,15 +28,18 @@
 #include "BufferOpsDevice.hpp"
 #include "DefaultValue.hpp"
 #include "ConduitRestart.hpp"
+#include "WrapperBase.hpp"
 #include "common/DataTypes.hpp"
 #include "common/GeosxMacros.hpp"
 #include "codingUtilities/traits.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
 
 // TPL includes
 #include <conduit.hpp>
 
 // System includes
 #include <cstring>
+#include <vector>
 
 #if RESTART_TYPE_LOGGING
 #include <unordered_set>
@@ -143,12 +146,67 @@ resize( T & GEOSX_UNUSED_PARAM( value ),
 {}
 
 
+/// The number of values from which a new allocation is first touched by the host threads.
+constexpr localIndex firstTouchMinValues = 1 << 16;
+
+/**
+ * @brief Allocate and touch the storage of an empty array in parallel before it is resized.
+ * @tparam T the type of the values
+ * @tparam NDIM the number of dimensions
+ * @tparam PERMUTATION the permutation of the array
+ * @param value the array
+ * @param newSize the new size of the first dimension
+ * @param defaultValue the value written in the new storage
+ *
+ * The pages of a new allocation are placed on the NUMA domain of the thread writing them first.
+ * The serial fill of the resize would place them all next to the master thread, so the storage is
+ * reserved and written with the static schedule of the host kernels beforehand: each thread touches
+ * the entries it later works on. The resize then fills pages that are already placed.
+ */
+template< typename T, int NDIM, typename PERMUTATION >
+inline void
+firstTouch( Array< T, NDIM, PERMUTATION > & value,
+            localIndex const newSize,
+            T const & defaultValue )
+{
+#if defined(GEOSX_USE_OPENMP)
+  localIndex valuesPerEntry = 1;
+  for( int dim = 1; dim < NDIM; ++dim )
+  {
+    valuesPerEntry *= value.size( dim );
+  }
+
+  localIndex const numValues = newSize * valuesPerEntry;
+  if( !std::is_arithmetic< T >::value || value.size() != 0 ||
+      numValues < firstTouchMinValues || value.capacity() >= numValues )
+  {
+    return;
+  }
+
+  value.reserve( numValues );
+  // the values are trivial, they may be written before the resize constructs them
+  T * const data = value.data();
+  forAll< parallelHostPolicy >( newSize, [=]( localIndex const i )
+  {
+    for( localIndex j = i * valuesPerEntry; j < ( i + 1 ) * valuesPerEntry; ++j )
+    {
+      data[ j ] = defaultValue;
+    }
+  } );
+#else
+  GEOSX_UNUSED_VAR( value, newSize, defaultValue );
+#endif
+}
+
 template< typename T, int NDIM, typename PERMUTATION >
 inline std::enable_if_t< DefaultValue< Array< T, NDIM, PERMUTATION > >::has_default_value >
 resizeDefault( Array< T, NDIM, PERMUTATION > & value,
                localIndex const newSize,
                DefaultValue< Array< T, NDIM, PERMUTATION > > const & defaultValue )
-{ value.resizeDefault( newSize, defaultValue.value ); }
+{
+  firstTouch( value, newSize, defaultValue.value );
+  value.resizeDefault( newSize, defaultValue.value );
+}
 
 template< typename T >
 inline void
@@ -217,6 +275,28 @@ capacity( T const & value )
 { return size( value ); }
 
 
+template< typename T >
+std::enable_if_t< traits::HasMemberFunction_data< T >, localIndex >
+bytesAllocated( T const & value )
+{ return capacity( value ) * byteSizeOfElement< T >(); }
+
+template< typename T >
+std::enable_if_t< !traits::HasMemberFunction_data< T >, localIndex >
+bytesAllocated( T const & GEOSX_UNUSED_PARAM( value ) )
+{ return sizeof( T ); }
+
+// the values, the offsets and the sizes of the inner arrays
+template< typename T >
+localIndex
+bytesAllocated( ArrayOfArrays< T > const & value )
+{ return value.valueCapacity() * sizeof( T ) + ( 2 * value.size() + 1 ) * sizeof( localIndex ); }
+
+template< typename T >
+localIndex
+bytesAllocated( ArrayOfSets< T > const & value )
+{ return value.valueCapacity() * sizeof( T ) + ( 2 * value.size() + 1 ) * sizeof( localIndex ); }
+
+
 
 template< typename T >
 std::enable_if_t< traits::HasMemberFunction_setName< T > >
@@ -240,6 +320,34 @@ move( T & GEOSX_UNUSED_PARAM( value ),
       bool const GEOSX_UNUSED_PARAM( touch ) )
 {}
 
+template< typename T, int NDIM, typename PERMUTATION >
+std::enable_if_t< std::is_arithmetic< T >::value && !std::is_same< T, bool >::value && NDIM <= BufferDescription::maxDims, BufferDescription >
+describeBuffer( Array< T, NDIM, PERMUTATION > & var, LvArray::MemorySpace const space, bool const touch )
+{
+  var.move( space, touch );
+
+  BufferDescription description;
+  description.data = var.data();
+  description.kind = std::is_floating_point< T >::value ? BufferDescription::Kind::Float :
+                     ( std::is_signed< T >::value ? BufferDescription::Kind::Int : BufferDescription::Kind::UInt );
+  description.itemSize = sizeof( T );
+  description.numDims = NDIM;
+  for( int d = 0; d < NDIM; ++d )
+  {
+    description.dims[ d ] = var.dims()[ d ];
+    description.strides[ d ] = var.strides()[ d ];
+  }
+  description.space = space;
+  return description;
+}
+
+template< typename T >
+BufferDescription
+describeBuffer( T & GEOSX_UNUSED_PARAM( value ),
+                LvArray::MemorySpace const GEOSX_UNUSED_PARAM( space ),
+                bool const GEOSX_UNUSED_PARAM( touch ) )
+{ return BufferDescription(); }
+
 // This is for an object that needs to be packed.
 template< typename T >
 std::enable_if_t< !bufferOps::can_memcpy< typename traits::Pointer< T > > >
@@ -267,13 +375,13 @@ template< typename T >
 std::enable_if_t< !bufferOps::can_memcpy< typename traits::Pointer< T > > >
 pullDataFromConduitNode( T & var, conduit::Node const & node )
 {
-  conduit::Node const & valuesNode = node.fetch_child( "__values__" );
-
-  // Get the number of bytes in the array and a pointer to the array.
-  localIndex const byteSize = valuesNode.dtype().number_of_elements();
-  buffer_unit_type const * buffer = valuesNode.value();
+  // Get the number of bytes in the array and read in the array.
+  localIndex const byteSize = restartValuesByteSize( node );
+  std::vector< buffer_unit_type > values( byteSize );
+  readRestartValues( node, values.data(), byteSize );
 
   // Unpack the object from the array.
+  buffer_unit_type const * buffer = values.data();
   localIndex const bytesRead = bufferOps::Unpack( buffer, var );
   GEOSX_ERROR_IF_NE( bytesRead, byteSize );
 }
@@ -321,14 +429,12 @@ template< typename T >
 std::enable_if_t< bufferOps::can_memcpy< typename traits::Pointer< T > > >
 pullDataFromConduitNode( T & var, conduit::Node const & node )
 {
-  conduit::Node const & valuesNode = node.fetch_child( "__values__" );
-
-  localIndex const byteSize = LvArray::integerConversion< localIndex >( valuesNode.dtype().strided_bytes() );
+  localIndex const byteSize = restartValuesByteSize( node );
   localIndex const numElements = numElementsFromByteSize< T >( byteSize );
 
   resize( var, numElements );
 
-  std::memcpy( dataPtr( var ), valuesNode.data_ptr(), byteSize );
+  readRestartValues( node, dataPtr( var ), byteSize );
 }
 
 // This is for a SortedArray that doesn't need to be packed.
@@ -336,13 +442,12 @@ template< typename T >
 std::enable_if_t< bufferOps::can_memcpy< T > >
 pullDataFromConduitNode( SortedArray< T > & var, conduit::Node const & node )
 {
-  conduit::Node const & valuesNode = node.fetch_child( "__values__" );
-
-  localIndex const byteSize = LvArray::integerConversion< localIndex >( valuesNode.dtype().strided_bytes() );
+  localIndex const byteSize = restartValuesByteSize( node );
   localIndex const numElements = numElementsFromByteSize< T >( byteSize );
 
-  T const * const values = reinterpret_cast< T const * >( valuesNode.data_ptr() );
-  var.insert( values, values + numElements );
+  std::vector< T > values( numElements );
+  readRestartValues( node, values.data(), byteSize );
+  var.insert( values.data(), values.data() + numElements );
 }
 
 
@@ -437,11 +542,10 @@ pullDataFromConduitNode( Array< T, NDIM, PERMUTATION > & var,
 
   var.resize( NDIM, dims );
 
-  // Finally memcpy
-  conduit::Node const & valuesNode = node.fetch_child( "__values__" );
+  // Finally read the values straight into the array.
   localIndex numBytesFromArray =  var.size() * sizeof( T );
-  GEOSX_ERROR_IF_NE( numBytesFromArray, valuesNode.dtype().strided_bytes() );
-  std::memcpy( var.data(), valuesNode.data_ptr(), numBytesFromArray );
+  GEOSX_ERROR_IF_NE( numBytesFromArray, restartValuesByteSize( node ) );
+  readRestartValues( node, var.data(), numBytesFromArray );
 }
 
 template< typename T >
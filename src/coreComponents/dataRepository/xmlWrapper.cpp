@@ -18,6 +18,13 @@
 
 #include "xmlWrapper.hpp"
 
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+
 namespace geosx
 {
 using namespace dataRepository;
@@ -43,6 +50,74 @@ void xmlWrapper::StringToInputVariable( R1Tensor & target, string const & inputV
   GEOSX_ERROR_IF( count!=3, "incorrect number of components specified for R1Tensor" );
 }
 
+localIndex xmlWrapper::countListValues( string const & value, char const * & begin )
+{
+  std::size_t const first = value.find_first_not_of( " \t\n\r" );
+  std::size_t const last = value.find_last_not_of( " \t\n\r" );
+  GEOSX_ERROR_IF( first == string::npos || value[first] != '{' || value[last] != '}',
+                  "A list must be enclosed in braces: \"" << value << "\"" );
+  GEOSX_ERROR_IF( value.find_first_of( "{}", first + 1 ) != last,
+                  "A one-dimensional list cannot have nested braces: \"" << value << "\"" );
+
+  begin = value.c_str() + first + 1;
+  if( value.find_first_not_of( " \t\n\r", first + 1 ) == last )
+  {
+    return 0;
+  }
+  return std::count( value.begin() + first, value.begin() + last, ',' ) + 1;
+}
+
+char const * xmlWrapper::parseListValue( char const * const ptr, double & target, string const & value )
+{
+  char * end;
+  target = std::strtod( ptr, &end );
+  GEOSX_ERROR_IF( end == ptr, "Invalid real value at \"" << ptr << "\" in \"" << value << "\"" );
+  return end;
+}
+
+char const * xmlWrapper::parseListValue( char const * const ptr, long long & target, string const & value )
+{
+  char * end;
+  target = std::strtoll( ptr, &end, 10 );
+  GEOSX_ERROR_IF( end == ptr, "Invalid integer value at \"" << ptr << "\" in \"" << value << "\"" );
+  return end;
+}
+
+char const * xmlWrapper::skipListSeparator( char const * ptr, char const separator, string const & value )
+{
+  while( std::isspace( static_cast< unsigned char >( *ptr ) ) )
+  {
+    ++ptr;
+  }
+  GEOSX_ERROR_IF( *ptr != separator, "Expected '" << separator << "' at \"" << ptr << "\" in \"" << value << "\"" );
+  return ptr + 1;
+}
+
+xmlWrapper::xmlResult xmlWrapper::loadFile( xmlDocument & document, string const & fileName )
+{
+  string content;
+  int readOnRoot = 0;
+  if( MpiWrapper::Comm_rank() == 0 )
+  {
+    std::ifstream file( fileName, std::ios::in | std::ios::binary );
+    if( file )
+    {
+      content.assign( std::istreambuf_iterator< char >( file ), std::istreambuf_iterator< char >() );
+      readOnRoot = !file.bad();
+    }
+  }
+
+  MpiWrapper::Broadcast( readOnRoot, 0 );
+  if( !readOnRoot )
+  {
+    // let pugixml report why the file cannot be read
+    return document.load_file( fileName.c_str() );
+  }
+
+  MpiWrapper::Broadcast( content, 0 );
+  return document.load_buffer( content.data(), content.size() );
+}
+
 void xmlWrapper::addIncludedXML( xmlNode & targetNode )
 {
 
@@ -64,7 +139,7 @@ void xmlWrapper::addIncludedXML( xmlNode & targetNode )
     }
     xmlDocument includedXmlDocument;
     xmlResult result;
-    result = includedXmlDocument.load_file( filePathName.c_str());
+    result = loadFile( includedXmlDocument, filePathName );
     GEOSX_ERROR_IF( !result, "Attempt to include file ("<<filePathName.c_str()<<") failed\n" );
 
     // To validate correctly, included files should contain the root Problem node
@@ -91,6 +91,17 @@ public:
 
   ///@}
 
+  /**
+   * @brief Load an xml file read by rank 0 only.
+   * @param[out] document the document to load the file into
+   * @param[in]  fileName the name of the file
+   * @return the result of the parse
+   *
+   * The content of the file is broadcast to the other ranks, which parse it from memory, so that a
+   * large deck is read once instead of by every rank at the same time. Collective over MPI_COMM_GEOSX.
+   */
+  static xmlResult loadFile( xmlDocument & document, string const & fileName );
+
   /**
    * @brief Function to add xml nodes from included files.
    * @param targetNode the node for which to look for included children specifications
@@ -146,6 +157,30 @@ public:
   StringToInputVariable( Array< T, NDIM, PERMUTATION > & array, string const & value )
   { LvArray::input::stringToArray( array, value ); }
 
+  /**
+   * @brief Parse a string and fill a one-dimensional Array of numbers with the values in the string.
+   * @tparam T data type of the array
+   * @tparam PERMUTATION the permutation of the array
+   * @param[out] array the array to read values into
+   * @param[in]  value the string that contains the data to be parsed into target, as "{ v0, v1, ... }"
+   *
+   * The large lists of the decks (table values and coordinates) are parsed in a single pass over
+   * the string, converting each value in place instead of extracting it from a stream.
+   */
+  template< typename T, typename PERMUTATION >
+  static std::enable_if_t< std::is_arithmetic< T >::value && !std::is_same< T, bool >::value >
+  StringToInputVariable( Array< T, 1, PERMUTATION > & array, string const & value )
+  {
+    char const * ptr = nullptr;
+    localIndex const numValues = countListValues( value, ptr );
+    array.resize( numValues );
+    for( localIndex i = 0; i < numValues; ++i )
+    {
+      ptr = parseListValue( ptr, array[i], value );
+      ptr = skipListSeparator( ptr, i + 1 < numValues ? ',' : '}', value );
+    }
+  }
+
   ///@}
 
   /// Defines a static constexpr bool canParseVariable that is true iff the template parameter T
@@ -265,6 +300,61 @@ public:
 
 private:
 
+  /**
+   * @brief Check the braces of a one-dimensional list and count its values.
+   * @param[in]  value the string holding the list
+   * @param[out] begin the character following the opening brace
+   * @return the number of values of the list
+   */
+  static localIndex countListValues( string const & value, char const * & begin );
+
+  /**
+   * @brief Parse a real value of a list.
+   * @param[in]  ptr   the first character of the value, leading spaces are skipped
+   * @param[out] target the value
+   * @param[in]  value the whole string, for the error messages
+   * @return the character following the value
+   */
+  static char const * parseListValue( char const * ptr, double & target, string const & value );
+
+  /**
+   * @brief Parse an integer value of a list.
+   * @param[in]  ptr   the first character of the value, leading spaces are skipped
+   * @param[out] target the value
+   * @param[in]  value the whole string, for the error messages
+   * @return the character following the value
+   */
+  static char const * parseListValue( char const * ptr, long long & target, string const & value );
+
+  /**
+   * @brief Parse a value of a list and convert it to the type of the array.
+   * @tparam T the type of the value
+   * @param[in]  ptr   the first character of the value, leading spaces are skipped
+   * @param[out] target the value
+   * @param[in]  value the whole string, for the error messages
+   * @return the character following the value
+   */
+  template< typename T >
+  static char const * parseListValue( char const * ptr, T & target, string const & value )
+  {
+    using ParsedType = std::conditional_t< std::is_floating_point< T >::value, double, long long >;
+    ParsedType parsed;
+    char const * const end = parseListValue( ptr, parsed, value );
+    target = static_cast< T >( parsed );
+    GEOSX_ERROR_IF( std::is_integral< T >::value && static_cast< ParsedType >( target ) != parsed,
+                    "Value out of range for " << LvArray::system::demangleType< T >() << " in \"" << value << "\"" );
+    return end;
+  }
+
+  /**
+   * @brief Skip the separator following a value of a list.
+   * @param[in] ptr       the character following the value
+   * @param[in] separator the expected separator, ',' or the closing brace
+   * @param[in] value     the whole string, for the error messages
+   * @return the character following the separator
+   */
+  static char const * skipListSeparator( char const * ptr, char const separator, string const & value );
+
   /**
    * @brief Set @p lhs equal to @p rhs.
    * @tparam T The type of @p lhs and @p rhs.
@@ -0,0 +1,254 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ADIOS2WriterInterface.cpp
+ */
+
+#include "ADIOS2WriterInterface.hpp"
+
+#include "mpiCommunications/MpiWrapper.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace adios2io
+{
+
+namespace
+{
+
+/**
+ * @brief Append a value to a list of real values.
+ * @tparam T the type of the value
+ * @param values the list of values
+ * @param value the value
+ */
+template< typename T >
+void appendValue( std::vector< real64 > & values, T const & value )
+{
+  values.push_back( static_cast< real64 >( value ) );
+}
+
+/**
+ * @brief Append the components of a vector to a list of real values.
+ * @param values the list of values
+ * @param value the vector
+ */
+void appendValue( std::vector< real64 > & values, R1Tensor const & value )
+{
+  for( localIndex j = 0; j < 3; ++j )
+  {
+    values.push_back( value[j] );
+  }
+}
+
+}
+
+ADIOS2WriterInterface::ADIOS2WriterInterface( string const & outputName,
+                                              string const & engineType,
+                                              string_array const & engineParameters,
+                                              string const & operatorType ):
+#ifdef GEOSX_USE_MPI
+  m_adios( MPI_COMM_GEOSX ),
+#else
+  m_adios(),
+#endif
+  m_io( m_adios.DeclareIO( outputName ) ),
+  m_engine(),
+  m_operator(),
+  m_plotLevel(),
+  m_numNodesWritten( -1 ),
+  m_numElementsWritten( -1 ),
+  m_realBuffers(),
+  m_indexBuffers()
+{
+  m_io.SetEngine( engineType );
+  for( string const & parameter : engineParameters )
+  {
+    std::size_t const separator = parameter.find( '=' );
+    GEOSX_ERROR_IF( separator == string::npos,
+                    "The ADIOS2 engine parameter " << parameter << " of " << outputName << " is not of the form key=value" );
+    m_io.SetParameter( parameter.substr( 0, separator ), parameter.substr( separator + 1 ) );
+  }
+
+  if( !operatorType.empty() )
+  {
+    m_operator = m_adios.DefineOperator( outputName + "_operator", operatorType );
+  }
+
+  m_engine = m_io.Open( outputName + ".bp", adios2::Mode::Write );
+}
+
+ADIOS2WriterInterface::~ADIOS2WriterInterface()
+{
+  if( m_engine )
+  {
+    m_engine.Close();
+  }
+}
+
+template< typename T >
+void ADIOS2WriterInterface::PutArray( string const & name, std::vector< T > && values, std::size_t const numComponents )
+{
+  std::size_t const numObjects = numComponents > 0 ? values.size() / numComponents : 0;
+  adios2::Dims const count = { numObjects, numComponents };
+
+  adios2::Variable< T > variable = m_io.InquireVariable< T >( name );
+  if( !variable )
+  {
+    // Local array: each rank writes its own block, no global shape
+    variable = m_io.DefineVariable< T >( name, {}, {}, count );
+    if( m_operator && std::is_floating_point< T >::value )
+    {
+      variable.AddOperation( m_operator );
+    }
+  }
+  else
+  {
+    variable.SetSelection( { {}, count } );
+  }
+
+  std::vector< T > const & stagedValues = Stage( std::move( values ) );
+  m_engine.Put( variable, stagedValues.data() );
+}
+
+std::vector< real64 > const & ADIOS2WriterInterface::Stage( std::vector< real64 > && values )
+{
+  m_realBuffers.emplace_back( std::move( values ) );
+  return m_realBuffers.back();
+}
+
+std::vector< int64_t > const & ADIOS2WriterInterface::Stage( std::vector< int64_t > && values )
+{
+  m_indexBuffers.emplace_back( std::move( values ) );
+  return m_indexBuffers.back();
+}
+
+void ADIOS2WriterInterface::PutField( string const & name, WrapperBase const & wrapper, localIndex const size )
+{
+  std::type_info const & typeID = wrapper.get_typeid();
+  rtTypes::ApplyArrayTypeLambda2( rtTypes::typeID( typeID ),
+                                  false,
+                                  [&]( auto array, auto GEOSX_UNUSED_PARAM( Type ) )->void
+  {
+    typedef decltype( array ) arrayType;
+    Wrapper< arrayType > const & wrapperT = Wrapper< arrayType >::cast( wrapper );
+    traits::ViewTypeConst< arrayType > const sourceArray = wrapperT.reference().toViewConst();
+
+    std::vector< real64 > values;
+    values.reserve( sourceArray.size() );
+    for( localIndex i = 0; i < size; ++i )
+    {
+      LvArray::forValuesInSlice( sourceArray[i], [&]( auto const & value )
+      {
+        appendValue( values, value );
+      } );
+    }
+    std::size_t const numComponents = size > 0 ? values.size() / size : 1;
+    PutArray( name, std::move( values ), numComponents );
+  } );
+}
+
+void ADIOS2WriterInterface::Write( real64 const time, DomainPartition const & domain )
+{
+  ElementRegionManager const & elemManager = *domain.getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
+  NodeManager const & nodeManager = *domain.getMeshBody( 0 )->getMeshLevel( 0 )->getNodeManager();
+
+  m_engine.BeginStep();
+
+  if( MpiWrapper::Comm_rank() == 0 )
+  {
+    adios2::Variable< real64 > timeVariable = m_io.InquireVariable< real64 >( "time" );
+    if( !timeVariable )
+    {
+      timeVariable = m_io.DefineVariable< real64 >( "time" );
+    }
+    m_engine.Put( timeVariable, time, adios2::Mode::Sync );
+  }
+
+  // The mesh is only written again when its topology changes, the readers take it from the last step holding it.
+  localIndex const numElements = elemManager.getNumberOfElements();
+  bool const writeMesh = nodeManager.size() != m_numNodesWritten || numElements != m_numElementsWritten;
+  if( writeMesh )
+  {
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager.referencePosition();
+    std::vector< real64 > positions;
+    positions.reserve( 3 * nodeManager.size() );
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      for( localIndex j = 0; j < 3; ++j )
+      {
+        positions.push_back( X( a, j ) );
+      }
+    }
+    PutArray( "nodes/referencePosition", std::move( positions ), 3 );
+    m_numNodesWritten = nodeManager.size();
+    m_numElementsWritten = numElements;
+  }
+
+  for( auto const & wrapperIter : nodeManager.wrappers() )
+  {
+    WrapperBase const & wrapper = *wrapperIter.second;
+    if( wrapper.getPlotLevel() <= m_plotLevel )
+    {
+      PutField( "nodes/" + wrapper.getName(), wrapper, nodeManager.size() );
+    }
+  }
+
+  elemManager.forElementRegions( [&]( ElementRegionBase const & region )
+  {
+    region.forElementSubRegions( [&]( ElementSubRegionBase const & subRegion )
+    {
+      string const prefix = "elements/" + region.getName() + "/" + subRegion.getName() + "/";
+
+      CellElementSubRegion const * const cellSubRegion = dynamic_cast< CellElementSubRegion const * >( &subRegion );
+      if( writeMesh && cellSubRegion != nullptr )
+      {
+        CellElementSubRegion::NodeMapType const & elemsToNodes = cellSubRegion->nodeList();
+        localIndex const numNodesPerElement = cellSubRegion->numNodesPerElement();
+        std::vector< int64_t > connectivity;
+        connectivity.reserve( cellSubRegion->size() * numNodesPerElement );
+        for( localIndex k = 0; k < cellSubRegion->size(); ++k )
+        {
+          for( localIndex a = 0; a < numNodesPerElement; ++a )
+          {
+            connectivity.push_back( elemsToNodes( k, a ) );
+          }
+        }
+        PutArray( prefix + "elementsToNodes", std::move( connectivity ), numNodesPerElement );
+      }
+
+      for( auto const & wrapperIter : subRegion.wrappers() )
+      {
+        WrapperBase const & wrapper = *wrapperIter.second;
+        if( wrapper.getPlotLevel() <= m_plotLevel )
+        {
+          PutField( prefix + wrapper.getName(), wrapper, subRegion.size() );
+        }
+      }
+    } );
+  } );
+
+  m_engine.EndStep();
+  m_realBuffers.clear();
+  m_indexBuffers.clear();
+}
+
+} // namespace adios2io
+
+} // namespace geosx
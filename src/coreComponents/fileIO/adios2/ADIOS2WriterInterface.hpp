@@ -0,0 +1,152 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ADIOS2WriterInterface.hpp
+ */
+
+#ifndef GEOSX_FILEIO_ADIOS2_ADIOS2WRITERINTERFACE_HPP_
+#define GEOSX_FILEIO_ADIOS2_ADIOS2WRITERINTERFACE_HPP_
+
+#include "common/DataTypes.hpp"
+#include "dataRepository/WrapperBase.hpp"
+#include "managers/DomainPartition.hpp"
+
+#include <adios2.h>
+
+#include <cstdint>
+#include <list>
+
+namespace geosx
+{
+
+namespace adios2io
+{
+
+/**
+ * @class ADIOS2WriterInterface
+ * @brief Write the mesh and the plotted fields of a domain through an ADIOS2 engine.
+ * @details Each call to Write() is one ADIOS2 step. The fields are written as local arrays (one block per
+ * rank, no global shape), named after their position in the mesh:
+ *  - time: the time of the step, written by rank 0
+ *  - nodes/referencePosition: the node coordinates, written when the topology changes
+ *  - nodes/<field>: the plotted node fields
+ *  - elements/<region>/<subregion>/elementsToNodes: the local node indices of the cells, written when the topology changes
+ *  - elements/<region>/<subregion>/<field>: the plotted element fields
+ *
+ * The engine does the aggregation, the asynchronous drain and the compression according to its parameters,
+ * e.g. BP5 with NumAggregators or AsyncWrite, or SST to stream the steps to an analysis code.
+ */
+class ADIOS2WriterInterface
+{
+public:
+
+  /**
+   * @brief Constructor
+   * @param[in] outputName the name of the output, the engine opens <outputName>.bp
+   * @param[in] engineType the ADIOS2 engine, e.g. BP5 or SST
+   * @param[in] engineParameters the engine parameters, as key=value strings
+   * @param[in] operatorType the ADIOS2 operator applied to the fields, e.g. blosc, empty for none
+   */
+  ADIOS2WriterInterface( string const & outputName,
+                         string const & engineType,
+                         string_array const & engineParameters,
+                         string const & operatorType );
+
+  /**
+   * @brief Destructor, closes the engine
+   */
+  ~ADIOS2WriterInterface();
+
+  /**
+   * @brief Sets the plot level
+   * @details All fields have an associated plot level. If it is <= to \p plotLevel,
+   * the field will be output.
+   * @param[in] plotLevel the limit plotlevel
+   */
+  void SetPlotLevel( integer plotLevel )
+  {
+    m_plotLevel = dataRepository::toPlotLevel( plotLevel );
+  }
+
+  /**
+   * @brief Write one step: the mesh if its topology changed, and the plotted fields.
+   * @param[in] time the time of the step
+   * @param[in] domain the computation domain of this rank
+   */
+  void Write( real64 time, DomainPartition const & domain );
+
+private:
+
+  /**
+   * @brief Put the values of a field.
+   * @param[in] name the name of the variable
+   * @param[in] wrapper the wrapper of the field
+   * @param[in] size the number of objects of the field
+   */
+  void PutField( string const & name, dataRepository::WrapperBase const & wrapper, localIndex size );
+
+  /**
+   * @brief Put a local array of values.
+   * @tparam T the type of the values
+   * @param[in] name the name of the variable
+   * @param[in] values the values, kept alive until the end of the step
+   * @param[in] numComponents the number of values per object
+   */
+  template< typename T >
+  void PutArray( string const & name, std::vector< T > && values, std::size_t numComponents );
+
+  /**
+   * @brief Keep values alive until the end of the step.
+   * @param[in] values the values
+   * @return the kept values
+   */
+  std::vector< real64 > const & Stage( std::vector< real64 > && values );
+
+  /// @copydoc Stage( std::vector< real64 > && )
+  std::vector< int64_t > const & Stage( std::vector< int64_t > && values );
+
+  /// The ADIOS2 instance
+  adios2::ADIOS m_adios;
+
+  /// The IO holding the variables of the output
+  adios2::IO m_io;
+
+  /// The engine writing the steps
+  adios2::Engine m_engine;
+
+  /// The operator applied to the fields, if any
+  adios2::Operator m_operator;
+
+  /// Maximum plot level to be written.
+  dataRepository::PlotLevel m_plotLevel;
+
+  /// Number of nodes when the mesh was last written, -1 before the first step
+  localIndex m_numNodesWritten;
+
+  /// Number of elements when the mesh was last written
+  localIndex m_numElementsWritten;
+
+  /// Values put during the current step, deferred puts read them at the end of the step
+  std::list< std::vector< real64 > > m_realBuffers;
+
+  /// Indices put during the current step
+  std::list< std::vector< int64_t > > m_indexBuffers;
+};
+
+} // namespace adios2io
+
+} // namespace geosx
+
+#endif /* GEOSX_FILEIO_ADIOS2_ADIOS2WRITERINTERFACE_HPP_ */
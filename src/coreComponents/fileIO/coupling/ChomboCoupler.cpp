@@ -17,6 +17,7 @@
 #include "mesh/ElementRegionManager.hpp"
 #include "mesh/FaceManager.hpp"
 #include "mesh/ExtrinsicMeshData.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
 
 #include <cstdint>
 #include <tuple>
@@ -34,34 +35,52 @@ ChomboCoupler::ChomboCoupler( MPI_Comm const comm, const std::string & outputPat
   m_node_offset( -1 ),
   m_n_nodes_written( -1 ),
   m_mesh( mesh ),
-  m_counter( 0 )
+  m_counter( 0 ),
+  m_intercomm( MPI_COMM_NULL ),
+  m_remoteRank( -1 ),
+  m_sendRequests{ MPI_REQUEST_NULL, MPI_REQUEST_NULL, MPI_REQUEST_NULL },
+  m_recvRequest( MPI_REQUEST_NULL )
 {
   m_mesh.getFaceManager()->registerWrapper< array1d< real64 > >( "ChomboPressure" );
 }
 
-void ChomboCoupler::write( double dt )
+ChomboCoupler::ChomboCoupler( MPI_Comm const comm, int const remoteLeader, MeshLevel & mesh ):
+  ChomboCoupler( comm, "", "", mesh )
 {
-  ++m_counter;
-  FaceManager const * const faces = m_mesh.getFaceManager();
-  ElementRegionManager const * const elemRegionManager = m_mesh.getElemManager();
+  MPI_CHECK_ERROR( MPI_Intercomm_create( m_comm, 0, MPI_COMM_WORLD, remoteLeader, Tag::HEADER, &m_intercomm ) );
 
+  int remoteSize;
+  MPI_CHECK_ERROR( MPI_Comm_remote_size( m_intercomm, &remoteSize ) );
+  std::int64_t const rank = MpiWrapper::Comm_rank( m_comm );
+  std::int64_t const size = MpiWrapper::Comm_size( m_comm );
+  m_remoteRank = static_cast< int >( rank * remoteSize / size );
 
-  ArrayOfArraysView< localIndex const > const & face_connectivity = faces->nodeList().toViewConst();
-  FaceManager::ElemMapType const & toElementRelation = faces->toElementRelation();
-  arrayView2d< localIndex const > const & faceToElementRegionIndex = toElementRelation.m_toElementRegion.toViewConst();
+  m_headerBuffer.resize( 4 );
+}
 
-  localIndex const n_faces = face_connectivity.size();
+ChomboCoupler::~ChomboCoupler()
+{
+  if( m_intercomm == MPI_COMM_NULL )
+  {
+    return;
+  }
 
-  /* Copy the face connectivity into a contiguous array. */
-  std::int64_t * connectivity_array = new std::int64_t[4 * n_faces];
-  for( localIndex i = 0; i < n_faces; ++i )
+  waitForSends();
+  if( m_recvRequest != MPI_REQUEST_NULL )
   {
-    for( localIndex j = 0; j < 4; ++j )
-    {
-      connectivity_array[4 * i + j] = face_connectivity( i, j );
-    }
+    MPI_Cancel( &m_recvRequest );
+    MpiWrapper::Wait( &m_recvRequest, MPI_STATUS_IGNORE );
   }
+  MpiWrapper::Comm_free( m_intercomm );
+}
 
+void ChomboCoupler::computeFaceMask( array1d< bool > & faceMask ) const
+{
+  FaceManager const * const faces = m_mesh.getFaceManager();
+  ElementRegionManager const * const elemRegionManager = m_mesh.getElemManager();
+
+  FaceManager::ElemMapType const & toElementRelation = faces->toElementRelation();
+  arrayView2d< localIndex const > const & faceToElementRegionIndex = toElementRelation.m_toElementRegion.toViewConst();
   arrayView1d< integer const > const & ruptureState = faces->getExtrinsicData< extrinsicMeshData::RuptureState >();
   arrayView1d< integer const > const & ghostRank = faces->ghostRank();
 
@@ -75,16 +94,43 @@ void ChomboCoupler::write( double dt )
     }
   } );
 
-  bool * faceMask = new bool[n_faces];
-  for( localIndex i = 0; i < n_faces; ++i )
+  faceMask.resize( faces->size() );
+  for( localIndex i = 0; i < faces->size(); ++i )
   {
     bool isVoid = (faceToElementRegionIndex[i][0] == voidRegionIndex) ||
                   (faceToElementRegionIndex[i][1] == voidRegionIndex);
-    //std::cout<<"face "<<i<<" is attached to a void cell"<<std::endl;
     faceMask[i] = (ruptureState[i] > 1) && (ghostRank[i] < 0) && (!isVoid);
   }
+}
+
+void ChomboCoupler::write( double dt )
+{
+  ++m_counter;
+
+  if( m_intercomm != MPI_COMM_NULL )
+  {
+    send( dt );
+    return;
+  }
+
+  FaceManager const * const faces = m_mesh.getFaceManager();
+
+  ArrayOfArraysView< localIndex const > const & face_connectivity = faces->nodeList().toViewConst();
+
+  localIndex const n_faces = face_connectivity.size();
 
+  /* Copy the face connectivity into a contiguous array. */
+  std::int64_t * connectivity_array = new std::int64_t[4 * n_faces];
+  for( localIndex i = 0; i < n_faces; ++i )
+  {
+    for( localIndex j = 0; j < 4; ++j )
+    {
+      connectivity_array[4 * i + j] = face_connectivity( i, j );
+    }
+  }
 
+  array1d< bool > faceMask;
+  computeFaceMask( faceMask );
 
   /* Build the face FieldMap. */
   FieldMap_in face_fields;
@@ -99,16 +145,141 @@ void ChomboCoupler::write( double dt )
   node_fields["displacement"] = std::make_tuple( H5T_NATIVE_DOUBLE, 3, m_displacementCopy.data() );
   node_fields["velocity"] = std::make_tuple( H5T_NATIVE_DOUBLE, 3, m_velocityCopy.data() );
 
-  writeBoundaryFile( m_comm, m_outputPath.data(), dt, faceMask,
+  writeBoundaryFile( m_comm, m_outputPath.data(), dt, faceMask.data(),
                      m_face_offset, m_n_faces_written, n_faces, connectivity_array, face_fields,
                      m_node_offset, m_n_nodes_written, m_referencePositionCopy.size( 0 ), node_fields );
 
   delete[] connectivity_array;
-  delete[] faceMask;
+}
+
+void ChomboCoupler::waitForSends()
+{
+  MpiWrapper::Waitall( 3, m_sendRequests, MPI_STATUSES_IGNORE );
+}
+
+void ChomboCoupler::send( double dt )
+{
+  // the buffers of the previous step are reused once its sends complete, while both codes compute
+  waitForSends();
+
+  FaceManager const * const faces = m_mesh.getFaceManager();
+  NodeManager const * const nodes = m_mesh.getNodeManager();
+
+  array1d< bool > faceMask;
+  computeFaceMask( faceMask );
+  m_sentFaces.clear();
+  for( localIndex i = 0; i < faceMask.size(); ++i )
+  {
+    if( faceMask[i] )
+    {
+      m_sentFaces.emplace_back( i );
+    }
+  }
+
+  /* The faces and nodes of the ranks follow each other, as in the boundary files. */
+  std::int64_t const numFaces = m_sentFaces.size();
+  std::int64_t const numNodes = nodes->size();
+  MPI_CHECK_ERROR( MPI_Exscan( &numFaces, &m_face_offset, 1, MpiWrapper::getMpiType< std::int64_t >(), MPI_SUM, m_comm ) );
+  MPI_CHECK_ERROR( MPI_Exscan( &numNodes, &m_node_offset, 1, MpiWrapper::getMpiType< std::int64_t >(), MPI_SUM, m_comm ) );
+  if( MpiWrapper::Comm_rank( m_comm ) == 0 )
+  {
+    m_face_offset = 0;
+    m_node_offset = 0;
+  }
+  m_n_faces_written = numFaces;
+  m_n_nodes_written = numNodes;
+
+  m_headerBuffer[0] = m_face_offset;
+  m_headerBuffer[1] = numFaces;
+  m_headerBuffer[2] = m_node_offset;
+  m_headerBuffer[3] = numNodes;
+
+  ArrayOfArraysView< localIndex const > const & faceToNodes = faces->nodeList().toViewConst();
+  m_connectivityBuffer.resize( 4 * numFaces );
+  for( localIndex k = 0; k < m_sentFaces.size(); ++k )
+  {
+    for( localIndex j = 0; j < 4; ++j )
+    {
+      m_connectivityBuffer[4 * k + j] = m_node_offset + faceToNodes( m_sentFaces[k], j );
+    }
+  }
+
+  /* Pack the time step, the pressures of the faces and the nodal fields, without the copies of the file path. */
+  arrayView1d< real64 const > const & pressure = faces->getReference< real64_array >( "ChomboPressure" );
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & referencePos = nodes->referencePosition();
+  arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const & displacement = nodes->totalDisplacement();
+  arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const & velocity = nodes->velocity();
+
+  m_sendBuffer.resize( 1 + numFaces + 9 * numNodes );
+  m_sendBuffer[0] = dt;
+  for( localIndex k = 0; k < m_sentFaces.size(); ++k )
+  {
+    m_sendBuffer[1 + k] = pressure[m_sentFaces[k]];
+  }
+  localIndex const nodeOffset = 1 + numFaces;
+  for( localIndex i = 0; i < numNodes; ++i )
+  {
+    for( localIndex j = 0; j < 3; ++j )
+    {
+      m_sendBuffer[nodeOffset + 3 * i + j] = referencePos( i, j );
+      m_sendBuffer[nodeOffset + 3 * ( numNodes + i ) + j] = displacement( i, j );
+      m_sendBuffer[nodeOffset + 3 * ( 2 * numNodes + i ) + j] = velocity( i, j );
+    }
+  }
+
+  MpiWrapper::iSend( m_headerBuffer.data(), 4, m_remoteRank, Tag::HEADER, m_intercomm, &m_sendRequests[0] );
+  MpiWrapper::iSend( m_connectivityBuffer.data(), LvArray::integerConversion< int >( m_connectivityBuffer.size() ),
+                     m_remoteRank, Tag::CONNECTIVITY, m_intercomm, &m_sendRequests[1] );
+  MpiWrapper::iSend( m_sendBuffer.data(), LvArray::integerConversion< int >( m_sendBuffer.size() ),
+                     m_remoteRank, Tag::DATA, m_intercomm, &m_sendRequests[2] );
+}
+
+void ChomboCoupler::postRead()
+{
+  if( m_intercomm == MPI_COMM_NULL || m_recvRequest != MPI_REQUEST_NULL )
+  {
+    return;
+  }
+
+  // the reply holds the pressures of the faces sent and the positions of the nodes sent
+  m_recvBuffer.resize( m_n_faces_written + 3 * m_n_nodes_written );
+  MpiWrapper::iRecv( m_recvBuffer.data(), LvArray::integerConversion< int >( m_recvBuffer.size() ),
+                     m_remoteRank, Tag::REPLY, m_intercomm, &m_recvRequest );
 }
 
 void ChomboCoupler::read( bool usePressures )
 {
+  if( m_intercomm != MPI_COMM_NULL )
+  {
+    GEOSX_ERROR_IF( m_n_faces_written < 0, "Nothing was sent to CHOMBO before reading its reply" );
+    postRead();
+    MpiWrapper::Wait( &m_recvRequest, MPI_STATUS_IGNORE );
+
+    if( usePressures )
+    {
+      FaceManager * const faces = m_mesh.getFaceManager();
+      NodeManager * const nodes = m_mesh.getNodeManager();
+      GEOSX_ERROR_IF_NE( nodes->size(), m_n_nodes_written );
+
+      arrayView1d< real64 > const & pressure = faces->getReference< real64_array >( "ChomboPressure" );
+      for( localIndex k = 0; k < m_sentFaces.size(); ++k )
+      {
+        pressure[m_sentFaces[k]] = m_recvBuffer[k];
+      }
+
+      arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const & reference_pos = nodes->referencePosition();
+      localIndex const nodeOffset = m_sentFaces.size();
+      for( localIndex i = 0; i < nodes->size(); ++i )
+      {
+        for( localIndex j = 0; j < 3; ++j )
+        {
+          reference_pos( i, j ) = m_recvBuffer[nodeOffset + 3 * i + j];
+        }
+      }
+    }
+    return;
+  }
+
   GEOSX_LOG_RANK_0( "Waiting for file existence: " << m_inputPath );
   waitForFileExistence( m_comm, m_inputPath.data() );
 
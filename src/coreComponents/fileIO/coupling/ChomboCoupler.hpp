@@ -42,17 +42,50 @@ public:
   ChomboCoupler( MPI_Comm const comm, const std::string & outputPath, const std::string & inputPath, MeshLevel & mesh );
 
   /**
-   * @brief Write data to file.
+   * @brief Construct a new ChomboCoupler exchanging the data in memory with CHOMBO.
+   * @param comm Communicator of the GEOSX ranks.
+   * @param remoteLeader The rank in MPI_COMM_WORLD of the first CHOMBO rank.
+   * @param mesh The mesh to communicate.
+   * @details The intercommunicator with CHOMBO is created over MPI_COMM_WORLD, collectively with CHOMBO.
+   *   Each GEOSX rank exchanges with a single CHOMBO rank, the ranks being distributed in contiguous blocks.
+   */
+  ChomboCoupler( MPI_Comm const comm, int const remoteLeader, MeshLevel & mesh );
+
+  /**
+   * @brief Destructor, completes the pending exchanges and frees the intercommunicator.
+   */
+  ~ChomboCoupler();
+
+  ChomboCoupler( ChomboCoupler const & ) = delete;
+  ChomboCoupler & operator=( ChomboCoupler const & ) = delete;
+
+  /**
+   * @brief Write data to file, or send it to CHOMBO without waiting for the send to complete.
    * @param dt the current time step.
    */
   void write( double dt );
 
   /**
-   * @brief Read data from file.
+   * @brief Post the receive of the reply of CHOMBO to the last data sent, in memory only.
+   * @details The reply may then arrive while GEOSX computes, read() waits for it.
+   */
+  void postRead();
+
+  /**
+   * @brief Read data from file, or wait for the reply of CHOMBO to the last data sent.
    * @param usePressures If true, pressure are read in from file
    */
   void read( bool usePressures );
 
+  /**
+   * @brief Check whether the receive of a reply of CHOMBO is pending.
+   * @return true if postRead() was called since the last read()
+   */
+  bool readPosted() const
+  {
+    return m_recvRequest != MPI_REQUEST_NULL;
+  }
+
 private:
   /**
    * @brief Copy nodal data into local arrays.
@@ -62,6 +95,32 @@ private:
    */
   void copyNodalData();
 
+  /**
+   * @brief Compute the face mask, the faces written being the ruptured, owned and non-void faces.
+   * @param faceMask the mask of the faces written, resized to the number of faces
+   */
+  void computeFaceMask( array1d< bool > & faceMask ) const;
+
+  /**
+   * @brief Pack the coupling data in the persistent buffers and send them to CHOMBO.
+   * @param dt the current time step.
+   */
+  void send( double dt );
+
+  /**
+   * @brief Wait for the completion of the sends of the previous coupling step.
+   */
+  void waitForSends();
+
+  /// Tags of the messages exchanged in memory
+  enum Tag : int
+  {
+    HEADER = 4040,       ///< face offset, number of faces, node offset and number of nodes
+    CONNECTIVITY = 4041, ///< nodes of the faces written, in the global numbering of the nodes written
+    DATA = 4042,         ///< time step, face pressures and nodal positions, displacements and velocities
+    REPLY = 4043         ///< face pressures and nodal positions computed by CHOMBO
+  };
+
   /// The MPI communicator used to read and write the file.
   MPI_Comm const m_comm;
   /// The path to write the file to.
@@ -86,6 +145,24 @@ private:
   array2d< real64 > m_displacementCopy;
   /// A copy of the nodal velocity.
   array2d< real64 > m_velocityCopy;
+  /// The intercommunicator with CHOMBO, MPI_COMM_NULL when coupling through files.
+  MPI_Comm m_intercomm;
+  /// The CHOMBO rank this rank exchanges with.
+  int m_remoteRank;
+  /// The faces written by the last send.
+  array1d< localIndex > m_sentFaces;
+  /// Persistent buffer of the sent offsets and sizes.
+  array1d< std::int64_t > m_headerBuffer;
+  /// Persistent buffer of the sent face connectivity.
+  array1d< std::int64_t > m_connectivityBuffer;
+  /// Persistent buffer of the sent face and nodal data.
+  array1d< real64 > m_sendBuffer;
+  /// Persistent buffer of the reply of CHOMBO.
+  array1d< real64 > m_recvBuffer;
+  /// The requests of the pending sends.
+  MPI_Request m_sendRequests[3];
+  /// The request of the pending receive.
+  MPI_Request m_recvRequest;
 };
 
 } /* namespace geosx */
@@ -163,6 +163,8 @@ HDFHistIO::HDFHistIO( string const & filename,
   m_rank( LvArray::integerConversion< hsize_t >( rank )),
   m_dims( rank ),
   m_name( name ),
+  m_chunkSize( 1 ),
+  m_compressionLevel( 0 ),
   m_comm( comm ),
   m_subcomm( MPI_COMM_NULL )
 {
@@ -217,7 +219,7 @@ void HDFHistIO::init( bool exists_okay )
     historyFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
 
     std::vector< hsize_t > dimChunks( m_rank+1 );
-    dimChunks[0] = 1;
+    dimChunks[0] = LvArray::integerConversion< hsize_t >( m_chunkSize );
 
     for( hsize_t dd = 1; dd < m_rank+1; ++dd )
     {
@@ -238,11 +240,18 @@ void HDFHistIO::init( bool exists_okay )
       // chunking is required to create an extensible dataset
       dcplId = H5Pcreate( H5P_DATASET_CREATE );
       H5Pset_chunk( dcplId, m_rank+1, &dimChunks[0] );
+      if( m_compressionLevel > 0 )
+      {
+        // the chunks are compressed as they are written, parallel writes to filtered data sets must be collective
+        H5Pset_shuffle( dcplId );
+        H5Pset_deflate( dcplId, LvArray::integerConversion< unsigned >( m_compressionLevel ) );
+      }
       maxFileDims[0] = H5S_UNLIMITED;
       hid_t space = H5Screate_simple( m_rank+1, &historyFileDims[0], &maxFileDims[0] );
       hid_t dataset = H5Dcreate( target, m_name.c_str(), m_hdfType, space, H5P_DEFAULT, dcplId, H5P_DEFAULT );
       H5Dclose( dataset );
       H5Sclose( space );
+      H5Pclose( dcplId );
     }
     else if( exists_okay )
     {
@@ -291,7 +300,16 @@ void HDFHistIO::write( )
       {
         dataBuffer = &m_dataBuffer[0];
       }
-      H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, H5P_DEFAULT, dataBuffer );
+      // a collective transfer lets MPI-IO aggregate the rows of all the ranks into few large writes
+      hid_t dxplId = H5P_DEFAULT;
+#ifdef GEOSX_USE_MPI
+      dxplId = H5Pcreate( H5P_DATASET_XFER );
+      H5Pset_dxpl_mpio( dxplId, H5FD_MPIO_COLLECTIVE );
+#endif
+      H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, dxplId, dataBuffer );
+#ifdef GEOSX_USE_MPI
+      H5Pclose( dxplId );
+#endif
 
       H5Sclose( memspace );
       H5Sclose( filespace );
@@ -381,6 +399,8 @@ HDFSerialHistIO::HDFSerialHistIO( string const & filename,
   m_rank( LvArray::integerConversion< hsize_t >( rank )),
   m_dims( rank ),
   m_name( name ),
+  m_chunkSize( 1 ),
+  m_compressionLevel( 0 ),
   m_comm( comm )
 {
   for( hsize_t dd = 0; dd < m_rank; ++dd )
@@ -400,7 +420,7 @@ void HDFSerialHistIO::init( bool exists_okay )
     historyFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
 
     std::vector< hsize_t > dimChunks( m_rank+1 );
-    dimChunks[0] = 1;
+    dimChunks[0] = LvArray::integerConversion< hsize_t >( m_chunkSize );
 
     for( hsize_t dd = 1; dd < m_rank+1; ++dd )
     {
@@ -420,11 +440,18 @@ void HDFSerialHistIO::init( bool exists_okay )
       // chunking is required to create an extensible dataset
       dcplId = H5Pcreate( H5P_DATASET_CREATE );
       H5Pset_chunk( dcplId, m_rank+1, &dimChunks[0] );
+      if( m_compressionLevel > 0 )
+      {
+        // the chunks are compressed as they are written, parallel writes to filtered data sets must be collective
+        H5Pset_shuffle( dcplId );
+        H5Pset_deflate( dcplId, LvArray::integerConversion< unsigned >( m_compressionLevel ) );
+      }
       maxFileDims[0] = H5S_UNLIMITED;
       hid_t space = H5Screate_simple( m_rank+1, &historyFileDims[0], &maxFileDims[0] );
       hid_t dataset = H5Dcreate( target, m_name.c_str(), m_hdfType, space, H5P_DEFAULT, dcplId, H5P_DEFAULT );
       H5Dclose( dataset );
       H5Sclose( space );
+      H5Pclose( dcplId );
     }
     else if( exists_okay )
     {
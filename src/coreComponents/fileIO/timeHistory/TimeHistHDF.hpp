@@ -158,6 +158,20 @@ public:
   /// Destructor
   virtual ~HDFHistIO() { }
 
+  /**
+   * @brief Set the number of history records per chunk of the data set in the file.
+   * @param chunkSize The number of records per chunk, should match the number of records buffered between writes.
+   * @note Only has an effect when called before init().
+   */
+  void setChunkSize( localIndex chunkSize ) { m_chunkSize = chunkSize; }
+
+  /**
+   * @brief Set the level of the deflate compression of the data set in the file.
+   * @param compressionLevel The compression level, from 0 (no compression) to 9.
+   * @note Only has an effect when called before init().
+   */
+  void setCompressionLevel( integer compressionLevel ) { m_compressionLevel = compressionLevel; }
+
   /// @copydoc geosx::BufferedHistoryIO::init
   virtual void init( bool existsOkay ) override;
 
@@ -203,6 +217,10 @@ private:
   std::vector< hsize_t > m_dims;
   /// The name of the data set
   string m_name;
+  /// The number of history records per chunk in the file
+  localIndex m_chunkSize;
+  /// The level of the deflate compression in the file
+  integer m_compressionLevel;
   /// The communicator across which the data set is distributed
   MPI_Comm m_comm;
   /// The communicator with only members of the m_comm comm which have nonzero ammounts of local data (required for chunking output ->
@@ -269,6 +287,20 @@ public:
   /// Destructor
   virtual ~HDFSerialHistIO() { }
 
+  /**
+   * @brief Set the number of history records per chunk of the data set in the file.
+   * @param chunkSize The number of records per chunk, should match the number of records buffered between writes.
+   * @note Only has an effect when called before init().
+   */
+  void setChunkSize( localIndex chunkSize ) { m_chunkSize = chunkSize; }
+
+  /**
+   * @brief Set the level of the deflate compression of the data set in the file.
+   * @param compressionLevel The compression level, from 0 (no compression) to 9.
+   * @note Only has an effect when called before init().
+   */
+  void setCompressionLevel( integer compressionLevel ) { m_compressionLevel = compressionLevel; }
+
   /// @copydoc geosx::BufferedHistoryIO::init
   virtual void init( bool existsOkay ) override;
 
@@ -310,6 +342,10 @@ private:
   std::vector< hsize_t > m_dims;
   /// The name of the data set
   string m_name;
+  /// The number of history records per chunk in the file
+  localIndex m_chunkSize;
+  /// The level of the deflate compression in the file
+  integer m_compressionLevel;
   /// The communicator across which the data set is distributed
   MPI_Comm m_comm;
 };
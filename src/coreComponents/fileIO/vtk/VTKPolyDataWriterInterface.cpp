@@ -85,7 +85,14 @@ void VTKPolyDataWriterInterface::gatherNbElementsInRegion( ElementRegionBase con
 VTKPolyDataWriterInterface::VTKPolyDataWriterInterface( string const & outputName ):
   m_outputFolder( outputName ),
   m_pvd( outputName + ".pvd" ),
-  m_previousCycle( -1 )
+  m_previousCycle( -1 ),
+  m_outputMode( VTKOutputMode::BINARY ),
+  m_compression( VTKCompression::ZLIB ),
+  m_asynchronous( false ),
+  m_cacheGeometry( false ),
+  m_cachedGeometry(),
+  m_stagedWriters(),
+  m_pendingWrite()
 {
   int const mpiRank = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
   if( mpiRank == 0 )
@@ -107,6 +114,14 @@ VTKPolyDataWriterInterface::VTKPolyDataWriterInterface( string const & outputNam
   MpiWrapper::Barrier();
 }
 
+VTKPolyDataWriterInterface::~VTKPolyDataWriterInterface()
+{
+  if( m_pendingWrite.valid() )
+  {
+    m_pendingWrite.get();
+  }
+}
+
 vtkSmartPointer< vtkPoints >  VTKPolyDataWriterInterface::GetVTKPoints( NodeManager const & nodeManager ) const
 {
   vtkSmartPointer< vtkPoints > points = vtkPoints::New();
@@ -277,6 +292,8 @@ void VTKPolyDataWriterInterface::WriteField( WrapperBase const & wrapperBase,
   {
     typedef decltype( array ) arrayType;
     Wrapper< arrayType > const & wrapperT = Wrapper< arrayType >::cast( wrapperBase );
+    // the field is only read, the device copy stays valid
+    wrapperT.move( LvArray::MemorySpace::CPU, false );
     traits::ViewTypeConst< arrayType > const sourceArray = wrapperT.reference().toViewConst();
     if( typeID!=typeid(r1_array) )
     {
@@ -350,17 +367,32 @@ void VTKPolyDataWriterInterface::WriteElementFields( vtkSmartPointer< vtkCellDat
 }
 void VTKPolyDataWriterInterface::WriteCellElementRegions( real64 time,
                                                           ElementRegionManager const & elemManager,
-                                                          NodeManager const & nodeManager ) const
+                                                          NodeManager const & nodeManager )
 {
   elemManager.forElementRegions< CellElementRegion >( [&]( CellElementRegion const & er )->void
   {
     if( er.getNumberOfElements< CellElementSubRegion >() != 0 )
     {
       vtkSmartPointer< vtkUnstructuredGrid > ug = vtkUnstructuredGrid::New();
-      auto VTKPoints = GetVTKPoints( nodeManager );
-      ug->SetPoints( VTKPoints );
-      auto VTKCells = GetVTKCells( er );
-      ug->SetCells( VTKCells.first.data(), VTKCells.second );
+      localIndex const numElements = er.getNumberOfElements< CellElementSubRegion >();
+      auto const cached = m_cachedGeometry.find( er.getName() );
+      CachedGeometry geometry;
+      if( m_cacheGeometry && cached != m_cachedGeometry.end() &&
+          cached->second.numNodes == nodeManager.size() && cached->second.numElements == numElements )
+      {
+        geometry = cached->second;
+      }
+      else
+      {
+        // The points are the reference positions: the geometry only changes with the topology.
+        geometry = CachedGeometry{ nodeManager.size(), numElements, GetVTKPoints( nodeManager ), GetVTKCells( er ) };
+        if( m_cacheGeometry )
+        {
+          m_cachedGeometry[ er.getName() ] = geometry;
+        }
+      }
+      ug->SetPoints( geometry.points );
+      ug->SetCells( geometry.cells.first.data(), geometry.cells.second );
       WriteElementFields< CellElementSubRegion >( ug->GetCellData(), er );
       WriteNodeFields( ug->GetPointData(), nodeManager );
       WriteUnstructuredGrid( ug, time, er.getName() );
@@ -369,7 +401,7 @@ void VTKPolyDataWriterInterface::WriteCellElementRegions( real64 time,
 }
 
 void VTKPolyDataWriterInterface::WriteWellElementRegions( real64 time, ElementRegionManager const & elemManager,
-                                                          NodeManager const & nodeManager ) const
+                                                          NodeManager const & nodeManager )
 {
   elemManager.forElementRegions< WellElementRegion >( [&]( WellElementRegion const & er )->void
   {
@@ -385,7 +417,7 @@ void VTKPolyDataWriterInterface::WriteWellElementRegions( real64 time, ElementRe
 
 void VTKPolyDataWriterInterface::WriteSurfaceElementRegions( real64 time,
                                                              ElementRegionManager const & elemManager,
-                                                             NodeManager const & nodeManager ) const
+                                                             NodeManager const & nodeManager )
 {
   elemManager.forElementRegions< SurfaceElementRegion >( [&]( SurfaceElementRegion const & er )->void
   {
@@ -491,7 +523,7 @@ void VTKPolyDataWriterInterface::CreateTimeStepSubFolder( real64 time ) const
 
 void VTKPolyDataWriterInterface::WriteUnstructuredGrid( vtkSmartPointer< vtkUnstructuredGrid > ug,
                                                         double time,
-                                                        string const & name ) const
+                                                        string const & name )
 {
   string timeStepSubFolder = VTKPolyDataWriterInterface::GetTimeStepSubFolder( time );
   vtkSmartPointer< vtkXMLUnstructuredGridWriter > vtuWriter =vtkXMLUnstructuredGridWriter::New();
@@ -501,13 +533,43 @@ void VTKPolyDataWriterInterface::WriteUnstructuredGrid( vtkSmartPointer< vtkUnst
   vtuWriter->SetFileName( vtuFilePath.c_str() );
   if( m_outputMode == VTKOutputMode::BINARY )
   {
-    vtuWriter->SetDataModeToBinary();
+    // Raw binary data appended at the end of the file, without base64 encoding.
+    vtuWriter->SetDataModeToAppended();
+    vtuWriter->EncodeAppendedDataOff();
   }
   else if( m_outputMode == VTKOutputMode::ASCII )
   {
     vtuWriter->SetDataModeToAscii();
   }
-  vtuWriter->Write();
+
+  switch( m_compression )
+  {
+    case VTKCompression::NONE:
+    {
+      vtuWriter->SetCompressorTypeToNone();
+      break;
+    }
+    case VTKCompression::ZLIB:
+    {
+      vtuWriter->SetCompressorTypeToZLib();
+      break;
+    }
+    case VTKCompression::LZ4:
+    {
+      vtuWriter->SetCompressorTypeToLZ4();
+      break;
+    }
+  }
+
+  if( m_asynchronous )
+  {
+    // The grid holds copies of the fields, it can be written out while the simulation goes on.
+    m_stagedWriters.push_back( vtuWriter );
+  }
+  else
+  {
+    vtuWriter->Write();
+  }
 }
 
 string VTKPolyDataWriterInterface::GetTimeStepSubFolder( real64 time ) const
@@ -523,6 +585,23 @@ void VTKPolyDataWriterInterface::Write( real64 time, integer cycle, DomainPartit
   WriteCellElementRegions( time, elemManager, nodeManager );
   WriteWellElementRegions( time, elemManager, nodeManager );
   WriteSurfaceElementRegions( time, elemManager, nodeManager );
+  if( m_asynchronous )
+  {
+    // At most one time step in flight: bound the memory held by the staged grids.
+    if( m_pendingWrite.valid() )
+    {
+      m_pendingWrite.get();
+    }
+    std::vector< vtkSmartPointer< vtkXMLUnstructuredGridWriter > > writers;
+    writers.swap( m_stagedWriters );
+    m_pendingWrite = std::async( std::launch::async, [writers]()
+    {
+      for( vtkSmartPointer< vtkXMLUnstructuredGridWriter > const & writer : writers )
+      {
+        writer->Write();
+      }
+    } );
+  }
   string vtmPath = GetTimeStepSubFolder( time ) + ".vtm";
   VTKVTMWriter vtmWriter( vtmPath );
   WriteVTMFile( time, elemManager, vtmWriter );
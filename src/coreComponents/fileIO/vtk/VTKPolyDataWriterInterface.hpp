@@ -33,6 +33,10 @@
 #include <vtkSmartPointer.h>
 #include <vtkPoints.h>
 
+#include <future>
+#include <map>
+#include <vector>
+
 namespace geosx
 {
 using namespace dataRepository;
@@ -45,6 +49,14 @@ enum struct VTKOutputMode
   ASCII
 };
 
+/// Compression of the binary data of the VTK files
+enum struct VTKCompression
+{
+  NONE,
+  ZLIB,
+  LZ4
+};
+
 /*!
  * @brief Encapsulate output methods for vtk
  */
@@ -57,6 +69,11 @@ public:
    */
   VTKPolyDataWriterInterface( string const & outputName );
 
+  /*!
+   * @brief Destructor, waits for the asynchronous writes in flight
+   */
+  ~VTKPolyDataWriterInterface();
+
   /*!
    * @brief Sets the plot level
    * @details All fields have an associated plot level. If it is <= to \p plotLevel,
@@ -77,6 +94,37 @@ public:
     m_outputMode = mode;
   }
 
+  /*!
+   * @brief Set the compression of the binary data
+   * @param[in] compression the compression to be used
+   */
+  void SetCompression( VTKCompression compression )
+  {
+    m_compression = compression;
+  }
+
+  /*!
+   * @brief Set the caching of the geometry of the cell element regions
+   * @details When enabled, the points and the cells of a cell element region are built once and reused by
+   * the following time steps as long as the numbers of nodes and elements do not change.
+   * @param[in] cacheGeometry true to reuse the geometry
+   */
+  void SetCacheGeometry( bool cacheGeometry )
+  {
+    m_cacheGeometry = cacheGeometry;
+  }
+
+  /*!
+   * @brief Set the asynchronous mode
+   * @details In asynchronous mode, Write() only copies the fields into VTK objects and returns,
+   * the .vtu files are written out by a background task while the simulation continues.
+   * @param[in] asynchronous true to write the .vtu files in the background
+   */
+  void SetAsynchronous( bool asynchronous )
+  {
+    m_asynchronous = asynchronous;
+  }
+
   /*!
    * @brief Main method of this class. Write all the files for one time step.
    * @details This method writes a .pvd file (if a previous one was created from a precedent time step,
@@ -146,7 +194,7 @@ private:
    * @param[in] elemManager the ElementRegionManager containing the CellElementRegions to be output
    * @param[in] nodeManager the NodeManager containing the nodes of the domain to be output
    */
-  void WriteCellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager ) const;
+  void WriteCellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager );
 
   /*!
    * @brief Gets the cell connectivities as
@@ -172,7 +220,7 @@ private:
    * @param[in] elemManager the ElementRegionManager containing the WellElementRegions to be output
    * @param[in] nodeManager the NodeManager containing the nodes of the domain to be output
    */
-  void WriteWellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager ) const;
+  void WriteWellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager );
 
   /*!
    * @brief Gets the cell connectivities and the vertices coordinates
@@ -217,7 +265,7 @@ private:
    */
   void WriteSurfaceElementRegions( real64 time,
                                    ElementRegionManager const & elemManager,
-                                   NodeManager const & nodeManager ) const;
+                                   NodeManager const & nodeManager );
 
   /*!
    * @brief Writes a VTM file for the time-step \p time.
@@ -264,7 +312,7 @@ private:
    * @param[in] time the current time-step
    * @param[in] name the name of the ElementRegionBase to be written
    */
-  void WriteUnstructuredGrid( vtkSmartPointer< vtkUnstructuredGrid > ug, double time, string const & name ) const;
+  void WriteUnstructuredGrid( vtkSmartPointer< vtkUnstructuredGrid > ug, double time, string const & name );
 
 private:
 
@@ -283,6 +331,37 @@ private:
 
   /// Output mode, could be ASCII or BINARAY
   VTKOutputMode m_outputMode;
+
+  /// Compression of the binary data
+  VTKCompression m_compression;
+
+  /// Flag to write the .vtu files in a background task
+  bool m_asynchronous;
+
+  /// Flag to reuse the geometry of the cell element regions between time steps
+  bool m_cacheGeometry;
+
+  /// Geometry of a cell element region kept between time steps
+  struct CachedGeometry
+  {
+    /// Number of nodes of the mesh when the geometry was built
+    localIndex numNodes;
+    /// Number of elements of the region when the geometry was built
+    localIndex numElements;
+    /// Points of the region
+    vtkSmartPointer< vtkPoints > points;
+    /// Cell types and cells of the region
+    std::pair< std::vector< int >, vtkSmartPointer< vtkCellArray > > cells;
+  };
+
+  /// Cached geometry of the cell element regions, indexed by region name
+  std::map< string, CachedGeometry > m_cachedGeometry;
+
+  /// Writers of the .vtu files of the time step being written, waiting to be handed to the background task
+  std::vector< vtkSmartPointer< vtkXMLUnstructuredGridWriter > > m_stagedWriters;
+
+  /// Background task writing the .vtu files of the previous time step
+  std::future< void > m_pendingWrite;
 };
 
 } // namespace vtk
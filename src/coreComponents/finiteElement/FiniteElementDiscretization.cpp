@@ -50,6 +50,14 @@ FiniteElementDiscretization::FiniteElementDiscretization( std::string const & na
                     "For instance, one of the many enhanced assumed strain "
                     "methods of the Hexahedron parent shape would be indicated "
                     "here" );
+
+  registerWrapper( viewKeyStruct::shapeGradientStorageString, &m_shapeGradientStorage )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( m_shapeGradientStorage )->
+    setDescription( "How the kernels get the shape function gradients: computed at each quadrature point, "
+                    "or precomputed and stored for each element and quadrature point (faster on the host, "
+                    "see the memory estimate in the log). Available options are:\n* " +
+                    EnumStrings< ShapeGradientStorage >::concat( "\n* " ) );
 }
 
 FiniteElementDiscretization::~FiniteElementDiscretization()
@@ -70,19 +78,19 @@ FiniteElementDiscretization::factory( string const & parentElementShape ) const
   {
     if( parentElementShape ==  finiteElement::ParentElementTypeStrings::Hexahedron )
     {
-      rval = std::make_unique< H1_Hexahedron_Lagrange1_GaussLegendre2 >();
+      rval = create3DFormulation< H1_Hexahedron_Lagrange1_GaussLegendre2 >();
     }
     else if( parentElementShape == finiteElement::ParentElementTypeStrings::Tetrahedon )
     {
-      rval = std::make_unique< H1_Tetrahedron_Lagrange1_Gauss1 >();
+      rval = create3DFormulation< H1_Tetrahedron_Lagrange1_Gauss1 >();
     }
     else if( parentElementShape == finiteElement::ParentElementTypeStrings::Prism )
     {
-      rval = std::make_unique< H1_Wedge_Lagrange1_Gauss6 >();
+      rval = create3DFormulation< H1_Wedge_Lagrange1_Gauss6 >();
     }
     else if( parentElementShape == finiteElement::ParentElementTypeStrings::Pyramid )
     {
-      rval = std::make_unique< H1_Pyramid_Lagrange1_Gauss5 >();
+      rval = create3DFormulation< H1_Pyramid_Lagrange1_Gauss5 >();
     }
     else if( parentElementShape == finiteElement::ParentElementTypeStrings::Quadralateral )
     {
@@ -66,6 +66,25 @@ public:
 
   ///@}
 
+  /**
+   * @brief Get the storage of the shape function gradients used by the kernels.
+   * @return the storage policy
+   */
+  finiteElement::ShapeGradientStorage getShapeGradientStorage() const
+  { return m_shapeGradientStorage; }
+
+  /**
+   * @brief Memory used by the precomputed shape function gradients and Jacobian determinants.
+   * @tparam FE_TYPE The finite element formulation.
+   * @param numElems The number of elements.
+   * @return The size in bytes.
+   */
+  template< typename FE_TYPE >
+  static localIndex shapeGradientStorageSize( localIndex const numElems )
+  {
+    return numElems * FE_TYPE::numQuadraturePoints * ( FE_TYPE::numNodes * 3 + 1 ) * sizeof( real64 );
+  }
+
   template< typename SUBREGION_TYPE,
             typename FE_TYPE >
   void CalculateShapeFunctionGradients( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X,
@@ -79,6 +98,9 @@ public:
    *   element/basis/formulation that should be instantiated.
    * @return A unique_ptr< FinteElementBase > which contains the new
    *   instantiation.
+   *
+   * 3D formulations are wrapped in finiteElement::PrecomputedShapeGradients
+   * when the kernels read precomputed shape function gradients.
    */
   std::unique_ptr< finiteElement::FiniteElementBase >
   factory( string const & parentElementShape ) const;
@@ -89,14 +111,37 @@ private:
   {
     static constexpr auto orderString = "order";
     static constexpr auto formulationString = "formulation";
+    static constexpr auto shapeGradientStorageString = "shapeGradientStorage";
   };
 
+  /**
+   * @brief Create a 3D finite element formulation for the selected shape gradient storage.
+   * @tparam FE_TYPE The finite element formulation.
+   * @return The new formulation.
+   */
+  template< typename FE_TYPE >
+  std::unique_ptr< finiteElement::FiniteElementBase > create3DFormulation() const
+  {
+    if( m_shapeGradientStorage == finiteElement::ShapeGradientStorage::precomputed )
+    {
+      return std::make_unique< finiteElement::PrecomputedShapeGradients< FE_TYPE > >();
+    }
+    return std::make_unique< FE_TYPE >();
+  }
+
   /// The order of the finite element basis
   int m_order;
 
   /// Optional string indicating any specialized formulation type.
   string m_formulation;
 
+  /// Storage of the shape function gradients used by the kernels
+#if defined(GEOSX_USE_DEVICE)
+  finiteElement::ShapeGradientStorage m_shapeGradientStorage = finiteElement::ShapeGradientStorage::onTheFly;
+#else
+  finiteElement::ShapeGradientStorage m_shapeGradientStorage = finiteElement::ShapeGradientStorage::precomputed;
+#endif
+
   void PostProcessInput() override final;
 
 };
@@ -20,12 +20,14 @@
 #define GEOSX_FINITEELEMENT_FINITEELEMENTDISPATCH_HPP_
 
 
+#include "common/GeosxConfig.hpp"
 #include "elementFormulations/H1_Hexahedron_Lagrange1_GaussLegendre2.hpp"
 #include "elementFormulations/H1_Pyramid_Lagrange1_Gauss5.hpp"
 #include "elementFormulations/H1_QuadrilateralFace_Lagrange1_GaussLegendre2.hpp"
 #include "elementFormulations/H1_Tetrahedron_Lagrange1_Gauss1.hpp"
 #include "elementFormulations/H1_TriangleFace_Lagrange1_Gauss1.hpp"
 #include "elementFormulations/H1_Wedge_Lagrange1_Gauss6.hpp"
+#include "elementFormulations/PrecomputedShapeGradients.hpp"
 #include "LvArray/src/system.hpp"
 
 
@@ -47,61 +49,54 @@ struct ParentElementTypeStrings
   static constexpr auto Polytope      = "POLYTOPE";
 };
 
+/**
+ * @brief Call the lambda with the input cast to its formulation, and return from the enclosing function.
+ * @param QUALIFIER the cv-qualifier of the input
+ * @param FE_TYPE the formulation to try
+ */
+#define GEOSX_DISPATCH3D_CASE( QUALIFIER, FE_TYPE ) \
+  if( auto QUALIFIER * const ptr = dynamic_cast< FE_TYPE QUALIFIER * >( &input ) ) \
+  { \
+    lambda( *ptr ); \
+    return; \
+  }
+
+/**
+ * @brief Call a lambda with a 3D formulation cast to its type.
+ * @tparam LAMBDA the type of the lambda
+ * @param input the formulation
+ * @param lambda the lambda
+ *
+ * Only the formulations of the GEOSX_FE_DISPATCH CMake option are dispatched, the
+ * variants with their precomputed gradients first as they derive from them.
+ */
 template< typename LAMBDA >
 void
 dispatch3D( FiniteElementBase const & input,
             LAMBDA && lambda )
 {
-  if( auto const * const ptr1 = dynamic_cast< H1_Hexahedron_Lagrange1_GaussLegendre2 const * >(&input) )
-  {
-    lambda( *ptr1 );
-  }
-  else if( auto const * const ptr2 = dynamic_cast< H1_Wedge_Lagrange1_Gauss6 const * >(&input) )
-  {
-    lambda( *ptr2 );
-  }
-  else if( auto const * const ptr3 = dynamic_cast< H1_Tetrahedron_Lagrange1_Gauss1 const * >(&input) )
-  {
-    lambda( *ptr3 );
-  }
-  else if( auto const * const ptr4 = dynamic_cast< H1_Pyramid_Lagrange1_Gauss5 const * >(&input) )
-  {
-    lambda( *ptr4 );
-  }
-  else
-  {
-    GEOSX_ERROR( "finiteElement::dispatch3D() is not implemented for input of "<<typeid(input).name() );
-  }
-}
+  GEOSX_FOR_EACH_FE_3D_TYPE( GEOSX_DISPATCH3D_CASE, const )
 
+  GEOSX_ERROR( "finiteElement::dispatch3D() is not implemented for input of " << LvArray::system::demangleType( &input ) <<
+               ", check the GEOSX_FE_DISPATCH CMake option" );
+}
 
+/**
+ * @copydoc dispatch3D( FiniteElementBase const &, LAMBDA && )
+ */
 template< typename LAMBDA >
 void
 dispatch3D( FiniteElementBase & input,
             LAMBDA && lambda )
 {
-  if( auto * const ptr1 = dynamic_cast< H1_Hexahedron_Lagrange1_GaussLegendre2 * >(&input) )
-  {
-    lambda( *ptr1 );
-  }
-  else if( auto * const ptr2 = dynamic_cast< H1_Wedge_Lagrange1_Gauss6 * >(&input) )
-  {
-    lambda( *ptr2 );
-  }
-  else if( auto * const ptr3 = dynamic_cast< H1_Tetrahedron_Lagrange1_Gauss1 * >(&input) )
-  {
-    lambda( *ptr3 );
-  }
-  else if( auto * const ptr4 = dynamic_cast< H1_Pyramid_Lagrange1_Gauss5 * >(&input) )
-  {
-    lambda( *ptr4 );
-  }
-  else
-  {
-    GEOSX_ERROR( "finiteElement::dispatch3D() is not implemented for input of "<<LvArray::system::demangleType( &input ) );
-  }
+  GEOSX_FOR_EACH_FE_3D_TYPE( GEOSX_DISPATCH3D_CASE, )
+
+  GEOSX_ERROR( "finiteElement::dispatch3D() is not implemented for input of " << LvArray::system::demangleType( &input ) <<
+               ", check the GEOSX_FE_DISPATCH CMake option" );
 }
 
+#undef GEOSX_DISPATCH3D_CASE
+
 template< typename LAMBDA >
 void
 dispatch2D( FiniteElementBase const & input,
@@ -83,6 +83,50 @@ void HughesWinget( real64 ( & Rot )[ 3 ][ 3 ], real64 ( & Dadt )[ 6 ], real64 co
   Rot[ 2 ][ 1 ] = (-w23 - w12w13div2 ) * invDetIplusOmega;
   Rot[ 2 ][ 2 ] = ( 1.0 + ( w12w12div4 - w13w13div4 - w23w23div4) ) * invDetIplusOmega;
 }
+
+/**
+ * @brief Compute the kinematic increments of a hypo-elastic finite strain step with the Hughes-Winget algorithm.
+ * @param[out] Rot the incremental rotation
+ * @param[out] Dadt the incremental rate of deformation, in Voigt notation
+ * @param[out] fInv the inverse of the deformation gradient at the end of the step
+ * @param[in] dUhatdX the gradient of the displacement increment of the step
+ * @param[in] dUdX the gradient of the displacement at the beginning of the step
+ * @return the determinant of the deformation gradient at the end of the step
+ *
+ * The deformation gradients at the middle and at the end of the step are built in a single pass, and
+ * inverted in closed form, so that the rotation needs neither a polar decomposition nor a general solve.
+ */
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+real64 HughesWingetIncrements( real64 ( & Rot )[ 3 ][ 3 ],
+                               real64 ( & Dadt )[ 6 ],
+                               real64 ( & fInv )[ 3 ][ 3 ],
+                               real64 const ( &dUhatdX )[ 3 ][ 3 ],
+                               real64 const ( &dUdX )[ 3 ][ 3 ] )
+{
+  real64 fMid[ 3 ][ 3 ];
+  real64 fEnd[ 3 ][ 3 ];
+  for( int i = 0; i < 3; ++i )
+  {
+    for( int j = 0; j < 3; ++j )
+    {
+      real64 const fMidMinusI = dUdX[ i ][ j ] + 0.5 * dUhatdX[ i ][ j ];
+      fMid[ i ][ j ] = fMidMinusI;
+      fEnd[ i ][ j ] = fMidMinusI + 0.5 * dUhatdX[ i ][ j ];
+    }
+    fMid[ i ][ i ] += 1.0;
+    fEnd[ i ][ i ] += 1.0;
+  }
+
+  // chain rule: calculate dv/dx^(n+1/2) = dv/dX * dX/dx^(n+1/2)
+  LvArray::tensorOps::invert< 3 >( fMid );
+  real64 Ldt[ 3 ][ 3 ];
+  LvArray::tensorOps::Rij_eq_AikBkj< 3, 3, 3 >( Ldt, dUhatdX, fMid );
+
+  HughesWinget( Rot, Dadt, Ldt );
+
+  return LvArray::tensorOps::invert< 3 >( fInv, fEnd );
+}
 }
 
 
@@ -16,16 +16,11 @@
  * @file FiniteElementBase.hpp
  */
 
-#if defined(GEOSX_USE_CUDA)
-#define CALC_FEM_SHAPE_IN_KERNEL
-#endif
-
-
-
 #ifndef GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_FINITEELEMENTBASE_HPP_
 #define GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_FINITEELEMENTBASE_HPP_
 
 #include "common/DataTypes.hpp"
+#include "common/EnumStrings.hpp"
 #include "common/GeosxMacros.hpp"
 #include "LvArray/src/tensorOps.hpp"
 
@@ -35,6 +30,20 @@ namespace geosx
 namespace finiteElement
 {
 
+/**
+ * @brief Where the finite element kernels get the shape function gradients from.
+ */
+enum class ShapeGradientStorage : integer
+{
+  onTheFly,   ///< Computed from the element nodal coordinates at each quadrature point
+  precomputed ///< Read from arrays computed once per element and quadrature point
+};
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( ShapeGradientStorage,
+              "onTheFly",
+              "precomputed" )
+
 /**
  * @brief Base class for FEM element implementations.
  */
@@ -42,21 +51,22 @@ class FiniteElementBase
 {
 public:
 
+  /// The shape function gradients are computed in the kernels, see PrecomputedShapeGradients.
+  static constexpr ShapeGradientStorage shapeGradientStorage = ShapeGradientStorage::onTheFly;
+
   /// Default Constructor
   FiniteElementBase() = default;
 
   /**
    * @brief Copy Constructor
    * @param source The object to copy.
+   *
+   * The views of the precomputed gradients are only copied (and hence captured by the kernels)
+   * if the gradients are precomputed, see setGradNView().
    */
   FiniteElementBase( FiniteElementBase const & source ):
-#ifdef CALC_FEM_SHAPE_IN_KERNEL
-    m_viewGradN(),
-    m_viewDetJ()
-#else
     m_viewGradN( source.m_viewGradN ),
     m_viewDetJ( source.m_viewDetJ )
-#endif
   {}
 
   /// Default Move constructor
@@ -100,7 +110,8 @@ public:
    * @param gradN Return array of the shape function gradients.
    * @return The determinant of the Jacobian transformation matrix.
    *
-   * This function calls the function to calculate shape function gradients.
+   * Depending on LEAF::shapeGradientStorage, this function either calculates the shape
+   * function gradients from @p X, or returns the pre-calculated ones (@p X is then unused).
    */
   template< typename LEAF >
   GEOSX_HOST_DEVICE
@@ -109,25 +120,6 @@ public:
                    real64 const (&X)[LEAF::numNodes][3],
                    real64 ( &gradN )[LEAF::numNodes][3] ) const;
 
-
-  /**
-   * @brief Get the shape function gradients.
-   * @tparam LEAF Type of the derived finite element implementation.
-   * @param k The element index.
-   * @param q The quadrature point index.
-   * @param X dummy variable.
-   * @param gradN Return array of the shape function gradients.
-   * @return The determinant of the Jacobian transformation matrix.
-   *
-   * This function returns pre-calculated shape function gradients.
-   */
-  template< typename LEAF >
-  GEOSX_HOST_DEVICE
-  real64 getGradN( localIndex const k,
-                   localIndex const q,
-                   int const X,
-                   real64 ( &gradN )[LEAF::numNodes][3] ) const;
-
   /**
    * @name Value Operator Functions
    */
@@ -450,25 +442,15 @@ real64 FiniteElementBase::getGradN( localIndex const k,
                                     real64 const (&X)[LEAF::numNodes][3],
                                     real64 (& gradN)[LEAF::numNodes][3] ) const
 {
-  GEOSX_UNUSED_VAR( k );
+  // Compile time constant, only one branch remains in the kernels
+  if( LEAF::shapeGradientStorage == ShapeGradientStorage::precomputed )
+  {
+    LvArray::tensorOps::copy< LEAF::numNodes, 3 >( gradN, m_viewGradN[ k ][ q ] );
+    return m_viewDetJ( k, q );
+  }
   return LEAF::calcGradN( q, X, gradN );
 }
 
-template< typename LEAF >
-GEOSX_HOST_DEVICE
-GEOSX_FORCE_INLINE
-real64 FiniteElementBase::getGradN( localIndex const k,
-                                    localIndex const q,
-                                    int const X,
-                                    real64 (& gradN)[LEAF::numNodes][3] ) const
-{
-  GEOSX_UNUSED_VAR( X );
-
-  LvArray::tensorOps::copy< LEAF::numNodes, 3 >( gradN, m_viewGradN[ k ][ q ] );
-
-  return m_viewDetJ( k, q );
-}
-
 //*************************************************************************************************
 //***** Interpolated Value Functions **************************************************************
 //*************************************************************************************************
@@ -0,0 +1,780 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file H1_Hexahedron_Lagrange2_GaussLegendre3.hpp
+ */
+
+#ifndef GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_TRIQUADRATICHEXAHEDRON
+#define GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_TRIQUADRATICHEXAHEDRON
+
+#include "FiniteElementBase.hpp"
+#include "LagrangeBasis2.hpp"
+
+#include <utility>
+
+
+namespace geosx
+{
+namespace finiteElement
+{
+
+/**
+ * This class contains the kernel accessible functions specific to the
+ * Triquadratic Hexahedron finite element with a 3x3x3 Gauss-Legendre
+ * quadrature rule. As for the trilinear hexahedron, the support points and
+ * the quadrature points use a Cartesian aligned numbering (see
+ * LagrangeBasis2::TensorProduct3D), with the quadrature points located at
+ * (-sqrt(3/5), 0, sqrt(3/5)) in each direction of the parent space.
+ *
+ * Besides the quadrature point operators of the other formulations, which
+ * cost O(p^3) per quadrature point and thus O(p^6) per element, this class
+ * provides the sum factorized element operators parentGradients() and
+ * plusParentGradientTranspose(), which apply the gradient of the basis,
+ * and its transpose, at all the quadrature points of an element in O(p^4)
+ * by contracting the 1d basis one direction at a time. A kernel gathers the
+ * nodal fields in setup(), calls parentGradients() on the coordinates and on
+ * the primary field, and accumulates the parent space fluxes of all the
+ * quadrature points before scattering them with plusParentGradientTranspose()
+ * in complete().
+ */
+class H1_Hexahedron_Lagrange2_GaussLegendre3 : public FiniteElementBase
+{
+public:
+  /// The number of nodes/support points per element.
+  constexpr static localIndex numNodes = LagrangeBasis2::TensorProduct3D::numSupportPoints;
+
+  /// The number of quadrature points per element.
+  constexpr static localIndex numQuadraturePoints = 27;
+
+  /// The number of support points, and of quadrature points, in each direction.
+  constexpr static int num1dPoints = 3;
+
+  /** @cond Doxygen_Suppress */
+  USING_FINITEELEMENTBASE
+  /** @endcond Doxygen_Suppress */
+
+  virtual ~H1_Hexahedron_Lagrange2_GaussLegendre3() override
+  {}
+
+  virtual localIndex getNumQuadraturePoints() const override
+  {
+    return numQuadraturePoints;
+  }
+
+  virtual localIndex getNumSupportPoints() const override
+  {
+    return numNodes;
+  }
+
+  /**
+   * @brief Calculate shape functions values for each support point at a
+   *   quadrature point.
+   * @param q Index of the quadrature point.
+   * @param N An array to pass back the shape function values for each support
+   *   point.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  static void calcN( localIndex const q,
+                     real64 (& N)[numNodes] )
+  {
+    int qa, qb, qc;
+    LagrangeBasis2::TensorProduct3D::multiIndex( q, qa, qb, qc );
+    real64 const qCoords[3] = { quadratureCoord( qa ),
+                                quadratureCoord( qb ),
+                                quadratureCoord( qc ) };
+
+    LagrangeBasis2::TensorProduct3D::value( qCoords, N );
+  }
+
+  /**
+   * @brief Calculate the shape functions derivatives wrt the physical
+   *   coordinates.
+   * @param q Index of the quadrature point.
+   * @param X Array containing the coordinates of the support points.
+   * @param gradN Array to contain the shape function derivatives for all
+   *   support points at the coordinates of the quadrature point @p q.
+   * @return The determinant of the parent/physical transformation matrix
+   *   multiplied by the weight of the quadrature point.
+   */
+  GEOSX_HOST_DEVICE
+  static real64 calcGradN( localIndex const q,
+                           real64 const (&X)[numNodes][3],
+                           real64 ( &gradN )[numNodes][3] );
+
+  /**
+   * @brief Calculate the integration weights for a quadrature point.
+   * @param q Index of the quadrature point.
+   * @param X Array containing the coordinates of the support points.
+   * @return The product of the quadrature rule weight and the determinate of
+   *   the parent/physical transformation matrix.
+   */
+  GEOSX_HOST_DEVICE
+  static real64 transformedQuadratureWeight( localIndex const q,
+                                             real64 const (&X)[numNodes][3] );
+
+  /**
+   * @brief Get the weight of a quadrature point in the parent space.
+   * @param q Index of the quadrature point.
+   * @return The product of the 1d Gauss-Legendre weights of the quadrature point.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  static real64 quadratureWeight( localIndex const q )
+  {
+    int qa, qb, qc;
+    LagrangeBasis2::TensorProduct3D::multiIndex( q, qa, qb, qc );
+    return weight1d( qa ) * weight1d( qb ) * weight1d( qc );
+  }
+
+  /**
+   * @brief Calculates the isoparametric "Jacobian" transformation
+   *   matrix/mapping from the parent space to the physical space.
+   * @param q The quadrature point index in 3d space.
+   * @param X Array containing the coordinates of the support points.
+   * @param J Array to store the Jacobian transformation.
+   * @return The determinant of the Jacobian transformation matrix.
+   */
+  GEOSX_HOST_DEVICE
+  static real64 invJacobianTransformation( int const q,
+                                           real64 const (&X)[numNodes][3],
+                                           real64 ( & J )[3][3] )
+  {
+    int qa, qb, qc;
+    LagrangeBasis2::TensorProduct3D::multiIndex( q, qa, qb, qc );
+    jacobianTransformation( qa, qb, qc, X, J );
+    return LvArray::tensorOps::invert< 3 >( J );
+  }
+
+  /**
+   * @brief Calculate the symmetric gradient of a vector valued support field
+   *   at a quadrature point using the stored inverse of the Jacobian
+   *   transformation matrix.
+   * @param q The linear index of the quadrature point.
+   * @param invJ The inverse of the Jacobian transformation matrix.
+   * @param var The vector valued support field to apply the gradient
+   *   operator on.
+   * @param grad The symmetric gradient in Voigt notation.
+   */
+  GEOSX_HOST_DEVICE
+  static void symmetricGradient( int const q,
+                                 real64 const (&invJ)[3][3],
+                                 real64 const (&var)[numNodes][3],
+                                 real64 ( &grad )[6] );
+
+  /**
+   * @brief Calculate the gradient of a vector valued support field at a point
+   *   using the stored inverse of the Jacobian transformation matrix.
+   * @param q The linear index of the quadrature point.
+   * @param invJ The inverse of the Jacobian transformation matrix.
+   * @param var The vector valued support field to apply the gradient
+   *   operator on.
+   * @param grad The gradient.
+   *
+   * More precisely, the operator is defined as:
+   * \f[
+   * grad_{ij}  = \sum_a^{nSupport} \left ( \frac{\partial N_a}{\partial X_j} var_{ai}\right ),
+   * \f]
+   *
+   */
+  GEOSX_HOST_DEVICE
+  static void gradient( int const q,
+                        real64 const (&invJ)[3][3],
+                        real64 const (&var)[numNodes][3],
+                        real64 ( &grad )[3][3] );
+
+  /**
+   * @brief Inner product of all basis function gradients and a rank-2
+   *   symmetric tensor evaluated at a quadrature point.
+   * @param q The linear index of the quadrature point.
+   * @param invJ The inverse of the Jacobian transformation matrix.
+   * @param var The rank-2 symmetric tensor at @p q.
+   * @param R The vector resulting from the tensor contraction.
+   *
+   * More precisely, the operator is defined as:
+   * \f[
+   * R_i = \sum_a^{nSupport} \left( \frac{\partial N_a}{\partial X_j} var_{ij} \right),
+   * \f]
+   * where \f$\frac{\partial N_a}{\partial X_j}\f$ is the basis function gradient,
+   *   \f$var_{ij}\f$ is the rank-2 symmetric tensor.
+   */
+  GEOSX_HOST_DEVICE
+  static void plus_gradNajAij( int const q,
+                               real64 const (&invJ)[3][3],
+                               real64 const (&var)[6],
+                               real64 ( &R )[numNodes][3] );
+
+  /**
+   * @brief Calculates the isoparametric "Jacobian" transformation
+   *   matrix/mapping from the parent space to the physical space.
+   * @param qa The 1d quadrature point index in xi0 direction (0,1,2)
+   * @param qb The 1d quadrature point index in xi1 direction (0,1,2)
+   * @param qc The 1d quadrature point index in xi2 direction (0,1,2)
+   * @param X Array containing the coordinates of the support points.
+   * @param J Array to store the Jacobian transformation.
+   */
+  GEOSX_HOST_DEVICE
+  static void jacobianTransformation( int const qa,
+                                      int const qb,
+                                      int const qc,
+                                      real64 const (&X)[numNodes][3],
+                                      real64 ( &J )[3][3] );
+
+  /**
+   * @brief Apply a Jacobian transformation matrix from the parent space to the
+   *   physical space on the parent shape function derivatives, producing the
+   *   shape function derivatives in the physical space.
+   * @param qa The 1d quadrature point index in xi0 direction (0,1,2)
+   * @param qb The 1d quadrature point index in xi1 direction (0,1,2)
+   * @param qc The 1d quadrature point index in xi2 direction (0,1,2)
+   * @param invJ The Jacobian transformation from parent->physical space.
+   * @param gradN Array to contain the shape function derivatives for all
+   *   support points at the coordinates of the quadrature point @p q.
+   */
+  GEOSX_HOST_DEVICE
+  static void
+    applyTransformationToParentGradients( int const qa,
+                                          int const qb,
+                                          int const qc,
+                                          real64 const ( &invJ )[3][3],
+                                          real64 ( &gradN )[numNodes][3] );
+
+  /**
+   * @name Sum Factorized Element Operators
+   */
+  ///@{
+
+  /**
+   * @brief Calculate the parent space gradient of a vector valued support
+   *   field at all the quadrature points by sum factorization.
+   * @param var The vector valued support field.
+   * @param grad The gradients, such that grad[q][i][j] is the derivative of
+   *   the component i of @p var with respect to xi_j at the quadrature point q.
+   *
+   * Applied to the nodal coordinates, this gives the Jacobian transformation
+   * of all the quadrature points. The physical gradient of a field at a
+   * quadrature point is the product of its parent gradient with the inverse
+   * of this Jacobian transformation.
+   */
+  GEOSX_HOST_DEVICE
+  static void parentGradients( real64 const (&var)[numNodes][3],
+                               real64 ( &grad )[numQuadraturePoints][3][3] );
+
+  /**
+   * @brief Add the contraction of the parent space gradients of the basis
+   *   functions with a tensor given at all the quadrature points, by sum
+   *   factorization.
+   * @param flux The tensor at each quadrature point, expressed in the parent
+   *   space and already multiplied by the quadrature weights.
+   * @param R The vector resulting from the tensor contraction.
+   *
+   * This is the transpose of parentGradients():
+   * \f[
+   * R_{ai} = R_{ai} + \sum_q \sum_j \frac{\partial N_a}{\partial \xi_j} flux_{qij}.
+   * \f]
+   * For a stress \f$\sigma\f$ at a quadrature point, the flux is
+   * \f$ flux_{ij} = \sum_k \sigma_{ik} J^{-1}_{jk} \det(J) w_q \f$.
+   */
+  GEOSX_HOST_DEVICE
+  static void plusParentGradientTranspose( real64 const (&flux)[numQuadraturePoints][3][3],
+                                           real64 ( &R )[numNodes][3] );
+
+  ///@}
+
+private:
+  /// The scaling factor specifying the location of the quadrature points
+  /// relative to the origin and the outer extent of the element in the
+  /// parent space (sqrt(3/5)).
+  constexpr static real64 quadratureFactor = 0.7745966692414833770359;
+
+  /**
+   * @brief The parent coordinate of a 1d quadrature point.
+   * @param q The 1d quadrature point index (0,1,2)
+   * @return The coordinate of the quadrature point.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 quadratureCoord( int const q )
+  {
+    return quadratureFactor * ( q - 1 );
+  }
+
+  /**
+   * @brief The weight of a 1d quadrature point.
+   * @param q The 1d quadrature point index (0,1,2)
+   * @return The weight: 5/9 at the outer points, 8/9 at the center.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 weight1d( int const q )
+  {
+    return q == 1 ? 8.0 / 9.0 : 5.0 / 9.0;
+  }
+
+  /**
+   * @brief The value of a 1d basis function at a 1d quadrature point.
+   * @param q The 1d quadrature point index (0,1,2)
+   * @param a The 1d support point index (0,1,2)
+   * @return The value of the basis function.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 basis1d( int const q, int const a )
+  {
+    return LagrangeBasis2::value( a, quadratureCoord( q ) );
+  }
+
+  /**
+   * @brief The derivative of a 1d basis function at a 1d quadrature point.
+   * @param q The 1d quadrature point index (0,1,2)
+   * @param a The 1d support point index (0,1,2)
+   * @return The derivative of the basis function.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 basisGradient1d( int const q, int const a )
+  {
+    return LagrangeBasis2::gradient( a, quadratureCoord( q ) );
+  }
+
+  /**
+   * @brief Applies a function inside a generic loop in over the tensor product
+   *   indices.
+   * @tparam FUNC The type of function to call within the support loop.
+   * @tparam PARAMS The parameter pack types to pass through to @p FUNC.
+   * @param qa The 1d quadrature point index in xi0 direction (0,1,2)
+   * @param qb The 1d quadrature point index in xi1 direction (0,1,2)
+   * @param qc The 1d quadrature point index in xi2 direction (0,1,2)
+   * @param func The function to call within the support loop.
+   * @param params The parameters to pass to @p func.
+   */
+  template< typename FUNC, typename ... PARAMS >
+  GEOSX_HOST_DEVICE
+  static void supportLoop( int const qa,
+                           int const qb,
+                           int const qc,
+                           FUNC && func,
+                           PARAMS &&... params );
+
+};
+
+/// @cond Doxygen_Suppress
+
+template< typename FUNC, typename ... PARAMS >
+GEOSX_HOST_DEVICE GEOSX_FORCE_INLINE void
+H1_Hexahedron_Lagrange2_GaussLegendre3::supportLoop( int const qa,
+                                                     int const qb,
+                                                     int const qc,
+                                                     FUNC && func,
+                                                     PARAMS &&... params )
+{
+  real64 const N0[3] = { basis1d( qa, 0 ), basis1d( qa, 1 ), basis1d( qa, 2 ) };
+  real64 const N1[3] = { basis1d( qb, 0 ), basis1d( qb, 1 ), basis1d( qb, 2 ) };
+  real64 const N2[3] = { basis1d( qc, 0 ), basis1d( qc, 1 ), basis1d( qc, 2 ) };
+  real64 const dN0[3] = { basisGradient1d( qa, 0 ), basisGradient1d( qa, 1 ), basisGradient1d( qa, 2 ) };
+  real64 const dN1[3] = { basisGradient1d( qb, 0 ), basisGradient1d( qb, 1 ), basisGradient1d( qb, 2 ) };
+  real64 const dN2[3] = { basisGradient1d( qc, 0 ), basisGradient1d( qc, 1 ), basisGradient1d( qc, 2 ) };
+
+  // Loop over the quadratic basis indices in each direction.
+  for( int a=0; a<3; ++a )
+  {
+    for( int b=0; b<3; ++b )
+    {
+      for( int c=0; c<3; ++c )
+      {
+        real64 const dNdXi[3] = { dN0[a] * N1[b] * N2[c],
+                                  N0[a] * dN1[b] * N2[c],
+                                  N0[a] * N1[b] * dN2[c] };
+
+        localIndex const nodeIndex = LagrangeBasis2::TensorProduct3D::linearIndex( a, b, c );
+
+        func( dNdXi, nodeIndex, std::forward< PARAMS >( params )... );
+      }
+    }
+  }
+}
+
+//*************************************************************************************************
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+real64
+H1_Hexahedron_Lagrange2_GaussLegendre3::calcGradN( localIndex const q,
+                                                   real64 const (&X)[numNodes][3],
+                                                   real64 (& gradN)[numNodes][3] )
+{
+  real64 J[3][3] = {{0}};
+
+  int qa, qb, qc;
+  LagrangeBasis2::TensorProduct3D::multiIndex( q, qa, qb, qc );
+
+  jacobianTransformation( qa, qb, qc, X, J );
+
+  real64 const detJ = LvArray::tensorOps::invert< 3 >( J );
+
+  applyTransformationToParentGradients( qa, qb, qc, J, gradN );
+
+  return detJ * weight1d( qa ) * weight1d( qb ) * weight1d( qc );
+}
+
+//*************************************************************************************************
+#if __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+#endif
+
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void
+H1_Hexahedron_Lagrange2_GaussLegendre3::
+  jacobianTransformation( int const qa,
+                          int const qb,
+                          int const qc,
+                          real64 const (&X)[numNodes][3],
+                          real64 ( & J )[3][3] )
+{
+  supportLoop( qa, qb, qc, [] GEOSX_HOST_DEVICE ( real64 const (&dNdXi)[3],
+                                                  int const nodeIndex,
+                                                  real64 const (&X)[numNodes][3],
+                                                  real64 (& J)[3][3] )
+  {
+    real64 const * const GEOSX_RESTRICT Xnode = X[nodeIndex];
+    for( int i = 0; i < 3; ++i )
+    {
+      for( int j = 0; j < 3; ++j )
+      {
+        J[i][j] = J[i][j] + dNdXi[ j ] * Xnode[i];
+      }
+    }
+  }, X, J );
+}
+
+//*************************************************************************************************
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void
+H1_Hexahedron_Lagrange2_GaussLegendre3::
+  applyTransformationToParentGradients( int const qa,
+                                        int const qb,
+                                        int const qc,
+                                        real64 const ( &invJ )[3][3],
+                                        real64 (& gradN)[numNodes][3] )
+{
+  supportLoop( qa, qb, qc, [] GEOSX_HOST_DEVICE ( real64 const (&dNdXi)[3],
+                                                  int const nodeIndex,
+                                                  real64 const (&invJ)[3][3],
+                                                  real64 (& gradN)[numNodes][3] )
+  {
+    gradN[nodeIndex][0] = dNdXi[0] * invJ[0][0] + dNdXi[1] * invJ[1][0] + dNdXi[2] * invJ[2][0];
+    gradN[nodeIndex][1] = dNdXi[0] * invJ[0][1] + dNdXi[1] * invJ[1][1] + dNdXi[2] * invJ[2][1];
+    gradN[nodeIndex][2] = dNdXi[0] * invJ[0][2] + dNdXi[1] * invJ[1][2] + dNdXi[2] * invJ[2][2];
+  }, invJ, gradN );
+}
+
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+real64
+H1_Hexahedron_Lagrange2_GaussLegendre3::
+  transformedQuadratureWeight( localIndex const q,
+                               real64 const (&X)[numNodes][3] )
+{
+  real64 J[3][3] = {{0}};
+
+  int qa, qb, qc;
+  LagrangeBasis2::TensorProduct3D::multiIndex( q, qa, qb, qc );
+
+  jacobianTransformation( qa, qb, qc, X, J );
+
+  return LvArray::tensorOps::determinant< 3 >( J ) * weight1d( qa ) * weight1d( qb ) * weight1d( qc );
+}
+
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void H1_Hexahedron_Lagrange2_GaussLegendre3::symmetricGradient( int const q,
+                                                                real64 const (&invJ)[3][3],
+                                                                real64 const (&var)[numNodes][3],
+                                                                real64 (& grad)[6] )
+{
+  int qa, qb, qc;
+  LagrangeBasis2::TensorProduct3D::multiIndex( q, qa, qb, qc );
+
+  supportLoop( qa, qb, qc, [] GEOSX_HOST_DEVICE ( real64 const (&dNdXi)[3],
+                                                  int const nodeIndex,
+                                                  real64 const (&invJ)[3][3],
+                                                  real64 const (&var)[numNodes][3],
+                                                  real64 (& grad)[6] )
+  {
+    real64 gradN[3] = {0, 0, 0};
+    for( int i = 0; i < 3; ++i )
+    {
+      for( int j = 0; j < 3; ++j )
+      {
+        gradN[i] = gradN[i] + dNdXi[ j ] * invJ[j][i];
+      }
+    }
+
+    grad[0] = grad[0] + gradN[0] * var[ nodeIndex ][0];
+    grad[1] = grad[1] + gradN[1] * var[ nodeIndex ][1];
+    grad[2] = grad[2] + gradN[2] * var[ nodeIndex ][2];
+    grad[3] = grad[3] + gradN[2] * var[ nodeIndex ][1] + gradN[1] * var[ nodeIndex ][2];
+    grad[4] = grad[4] + gradN[2] * var[ nodeIndex ][0] + gradN[0] * var[ nodeIndex ][2];
+    grad[5] = grad[5] + gradN[1] * var[ nodeIndex ][0] + gradN[0] * var[ nodeIndex ][1];
+  }, invJ, var, grad );
+}
+
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void H1_Hexahedron_Lagrange2_GaussLegendre3::plus_gradNajAij( int const q,
+                                                              real64 const (&invJ)[3][3],
+                                                              real64 const (&var)[6],
+                                                              real64 (& R)[numNodes][3] )
+{
+  int qa, qb, qc;
+  LagrangeBasis2::TensorProduct3D::multiIndex( q, qa, qb, qc );
+
+  supportLoop( qa, qb, qc,
+               [] GEOSX_HOST_DEVICE
+                 ( real64 const (&dNdXi)[3],
+                 int const nodeIndex,
+                 real64 const (&invJ)[3][3],
+                 real64 const (&var)[6],
+                 real64 (& R)[numNodes][3] )
+  {
+    real64 gradN[3] = {0, 0, 0};
+    for( int i = 0; i < 3; ++i )
+    {
+      for( int j = 0; j < 3; ++j )
+      {
+        gradN[i] = gradN[i] + dNdXi[ j ] * invJ[j][i];
+      }
+    }
+    R[ nodeIndex ][ 0 ] = R[ nodeIndex ][ 0 ] - var[ 0 ] * gradN[ 0 ] - var[ 5 ] * gradN[ 1 ] - var[ 4 ] * gradN[ 2 ];
+    R[ nodeIndex ][ 1 ] = R[ nodeIndex ][ 1 ] - var[ 5 ] * gradN[ 0 ] - var[ 1 ] * gradN[ 1 ] - var[ 3 ] * gradN[ 2 ];
+    R[ nodeIndex ][ 2 ] = R[ nodeIndex ][ 2 ] - var[ 4 ] * gradN[ 0 ] - var[ 3 ] * gradN[ 1 ] - var[ 2 ] * gradN[ 2 ];
+  }, invJ, var, R );
+}
+
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void H1_Hexahedron_Lagrange2_GaussLegendre3::gradient( int const q,
+                                                       real64 const (&invJ)[3][3],
+                                                       real64 const (&var)[numNodes][3],
+                                                       real64 (& grad)[3][3] )
+{
+  int qa, qb, qc;
+  LagrangeBasis2::TensorProduct3D::multiIndex( q, qa, qb, qc );
+
+  supportLoop( qa, qb, qc, [] GEOSX_HOST_DEVICE ( real64 const (&dNdXi)[3],
+                                                  int const nodeIndex,
+                                                  real64 const (&invJ)[3][3],
+                                                  real64 const (&var)[numNodes][3],
+                                                  real64 (& grad)[3][3] )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      real64 gradN=0.0;
+      for( int j = 0; j < 3; ++j )
+      {
+        gradN = gradN + dNdXi[ j ] * invJ[j][i];
+      }
+      for( int k = 0; k < 3; ++k )
+      {
+        grad[k][i] = grad[k][i] + gradN * var[ nodeIndex ][k];
+      }
+    }
+  }, invJ, var, grad );
+}
+
+#if __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+//*************************************************************************************************
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void H1_Hexahedron_Lagrange2_GaussLegendre3::parentGradients( real64 const (&var)[numNodes][3],
+                                                              real64 (& grad)[numQuadraturePoints][3][3] )
+{
+  // Contract the xi0 direction: values and derivatives at (qa, b, c).
+  real64 val0[3][3][3][3];
+  real64 der0[3][3][3][3];
+  for( int c = 0; c < 3; ++c )
+  {
+    for( int b = 0; b < 3; ++b )
+    {
+      for( int qa = 0; qa < 3; ++qa )
+      {
+        for( int i = 0; i < 3; ++i )
+        {
+          real64 v = 0.0;
+          real64 d = 0.0;
+          for( int a = 0; a < 3; ++a )
+          {
+            real64 const varNode = var[ LagrangeBasis2::TensorProduct3D::linearIndex( a, b, c ) ][ i ];
+            v = v + basis1d( qa, a ) * varNode;
+            d = d + basisGradient1d( qa, a ) * varNode;
+          }
+          val0[c][b][qa][i] = v;
+          der0[c][b][qa][i] = d;
+        }
+      }
+    }
+  }
+
+  // Contract the xi1 direction: value, xi0 and xi1 derivatives at (qa, qb, c).
+  real64 val01[3][3][3][3];
+  real64 der0_01[3][3][3][3];
+  real64 der1_01[3][3][3][3];
+  for( int c = 0; c < 3; ++c )
+  {
+    for( int qb = 0; qb < 3; ++qb )
+    {
+      for( int qa = 0; qa < 3; ++qa )
+      {
+        for( int i = 0; i < 3; ++i )
+        {
+          real64 v = 0.0;
+          real64 d0 = 0.0;
+          real64 d1 = 0.0;
+          for( int b = 0; b < 3; ++b )
+          {
+            v = v + basis1d( qb, b ) * val0[c][b][qa][i];
+            d0 = d0 + basis1d( qb, b ) * der0[c][b][qa][i];
+            d1 = d1 + basisGradient1d( qb, b ) * val0[c][b][qa][i];
+          }
+          val01[c][qb][qa][i] = v;
+          der0_01[c][qb][qa][i] = d0;
+          der1_01[c][qb][qa][i] = d1;
+        }
+      }
+    }
+  }
+
+  // Contract the xi2 direction.
+  for( int qc = 0; qc < 3; ++qc )
+  {
+    for( int qb = 0; qb < 3; ++qb )
+    {
+      for( int qa = 0; qa < 3; ++qa )
+      {
+        int const q = LagrangeBasis2::TensorProduct3D::linearIndex( qa, qb, qc );
+        for( int i = 0; i < 3; ++i )
+        {
+          real64 d0 = 0.0;
+          real64 d1 = 0.0;
+          real64 d2 = 0.0;
+          for( int c = 0; c < 3; ++c )
+          {
+            d0 = d0 + basis1d( qc, c ) * der0_01[c][qb][qa][i];
+            d1 = d1 + basis1d( qc, c ) * der1_01[c][qb][qa][i];
+            d2 = d2 + basisGradient1d( qc, c ) * val01[c][qb][qa][i];
+          }
+          grad[q][i][0] = d0;
+          grad[q][i][1] = d1;
+          grad[q][i][2] = d2;
+        }
+      }
+    }
+  }
+}
+
+//*************************************************************************************************
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void H1_Hexahedron_Lagrange2_GaussLegendre3::plusParentGradientTranspose( real64 const (&flux)[numQuadraturePoints][3][3],
+                                                                          real64 (& R)[numNodes][3] )
+{
+  // Transpose of the xi2 contraction of parentGradients(): back to (qa, qb, c).
+  real64 val01[3][3][3][3];
+  real64 der0_01[3][3][3][3];
+  real64 der1_01[3][3][3][3];
+  for( int c = 0; c < 3; ++c )
+  {
+    for( int qb = 0; qb < 3; ++qb )
+    {
+      for( int qa = 0; qa < 3; ++qa )
+      {
+        for( int i = 0; i < 3; ++i )
+        {
+          real64 v = 0.0;
+          real64 d0 = 0.0;
+          real64 d1 = 0.0;
+          for( int qc = 0; qc < 3; ++qc )
+          {
+            real64 const (&fluxQ)[3][3] = flux[ LagrangeBasis2::TensorProduct3D::linearIndex( qa, qb, qc ) ];
+            d0 = d0 + basis1d( qc, c ) * fluxQ[i][0];
+            d1 = d1 + basis1d( qc, c ) * fluxQ[i][1];
+            v = v + basisGradient1d( qc, c ) * fluxQ[i][2];
+          }
+          val01[c][qb][qa][i] = v;
+          der0_01[c][qb][qa][i] = d0;
+          der1_01[c][qb][qa][i] = d1;
+        }
+      }
+    }
+  }
+
+  // Transpose of the xi1 contraction: back to (qa, b, c).
+  real64 val0[3][3][3][3];
+  real64 der0[3][3][3][3];
+  for( int c = 0; c < 3; ++c )
+  {
+    for( int b = 0; b < 3; ++b )
+    {
+      for( int qa = 0; qa < 3; ++qa )
+      {
+        for( int i = 0; i < 3; ++i )
+        {
+          real64 v = 0.0;
+          real64 d = 0.0;
+          for( int qb = 0; qb < 3; ++qb )
+          {
+            v = v + basis1d( qb, b ) * val01[c][qb][qa][i] + basisGradient1d( qb, b ) * der1_01[c][qb][qa][i];
+            d = d + basis1d( qb, b ) * der0_01[c][qb][qa][i];
+          }
+          val0[c][b][qa][i] = v;
+          der0[c][b][qa][i] = d;
+        }
+      }
+    }
+  }
+
+  // Transpose of the xi0 contraction: back to the support points.
+  for( int c = 0; c < 3; ++c )
+  {
+    for( int b = 0; b < 3; ++b )
+    {
+      for( int a = 0; a < 3; ++a )
+      {
+        localIndex const nodeIndex = LagrangeBasis2::TensorProduct3D::linearIndex( a, b, c );
+        for( int i = 0; i < 3; ++i )
+        {
+          real64 r = 0.0;
+          for( int qa = 0; qa < 3; ++qa )
+          {
+            r = r + basis1d( qa, a ) * val0[c][b][qa][i] + basisGradient1d( qa, a ) * der0[c][b][qa][i];
+          }
+          R[nodeIndex][i] = R[nodeIndex][i] + r;
+        }
+      }
+    }
+  }
+}
+
+/// @endcond
+
+}
+}
+
+#endif //GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_TRIQUADRATICHEXAHEDRON
@@ -53,7 +53,7 @@ namespace finiteElement
  *
  *
  */
-class H1_Pyramid_Lagrange1_Gauss5 final : public FiniteElementBase
+class H1_Pyramid_Lagrange1_Gauss5 : public FiniteElementBase
 {
 public:
   /// The number of nodes/support points per element.
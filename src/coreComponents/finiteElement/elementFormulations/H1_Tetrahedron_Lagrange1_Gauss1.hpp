@@ -44,7 +44,7 @@ namespace finiteElement
  *          0              1
  *
  */
-class H1_Tetrahedron_Lagrange1_Gauss1 final : public FiniteElementBase
+class H1_Tetrahedron_Lagrange1_Gauss1 : public FiniteElementBase
 {
 public:
   /// The number of nodes/support points per element.
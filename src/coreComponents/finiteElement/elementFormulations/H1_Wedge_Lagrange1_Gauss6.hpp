@@ -50,7 +50,7 @@ namespace finiteElement
  *             0       2          |/____ r
  *
  */
-class H1_Wedge_Lagrange1_Gauss6 final : public FiniteElementBase
+class H1_Wedge_Lagrange1_Gauss6 : public FiniteElementBase
 {
 public:
   /// The number of nodes/support points per element.
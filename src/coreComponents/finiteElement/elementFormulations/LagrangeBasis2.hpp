@@ -20,6 +20,10 @@
 
 #include "common/DataTypes.hpp"
 
+namespace geosx
+{
+namespace finiteElement
+{
 
 /**
  * This class contains the implementation for a second order (quadratic) Lagrange
@@ -32,6 +36,37 @@
  */
 class LagrangeBasis2
 {
+public:
+  /// The number of support points for the basis
+  constexpr static localIndex numSupportPoints = 3;
+
+  /**
+   * @brief Calculate the parent coordinates for the xi0 direction, given the
+   *   linear index of a support point.
+   * @param supportPointIndex The linear index of support point
+   * @return parent coordinate in the xi0 direction.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 parentSupportCoord( const localIndex supportPointIndex )
+  {
+    return -1.0 + supportPointIndex;
+  }
+
+  /**
+   * @brief The value of the basis function for a support point evaluated at a
+   *   point along the axes.
+   * @param index The index of the support point.
+   * @param xi The coordinate at which to evaluate the basis.
+   * @return The value of basis function.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 value( const int index,
+                                 const real64 xi )
+  {
+    return index == 0 ? value0( xi ) : ( index == 1 ? value1( xi ) : value2( xi ) );
+  }
 
   /**
    * @brief The value of the basis function for support point 0.
@@ -40,10 +75,9 @@ class LagrangeBasis2
    */
   GEOSX_HOST_DEVICE
   GEOSX_FORCE_INLINE
-  constexpr static real64 value0( constexpr real64 xi )
+  constexpr static real64 value0( const real64 xi )
   {
-    constexpr real64 xi_div2 = 0.5 * xi;
-    return -xi_div2 + xi_div2 * xi;
+    return -0.5 * xi + 0.5 * xi * xi;
   }
 
   /**
@@ -53,7 +87,7 @@ class LagrangeBasis2
    */
   GEOSX_HOST_DEVICE
   GEOSX_FORCE_INLINE
-  constexpr static real64 value1( constexpr real64 xi )
+  constexpr static real64 value1( const real64 xi )
   {
     return 1.0 - xi * xi;
   }
@@ -65,10 +99,25 @@ class LagrangeBasis2
    */
   GEOSX_HOST_DEVICE
   GEOSX_FORCE_INLINE
-  constexpr static real64 value2( constexpr real64 xi )
+  constexpr static real64 value2( const real64 xi )
+  {
+    return 0.5 * xi + 0.5 * xi * xi;
+  }
+
+  /**
+   * @brief The gradient of the basis function for a support point evaluated at
+   *   a point along the axes.
+   * @param index The index of the support point associated with the basis
+   *   function.
+   * @param xi The coordinate at which to evaluate the gradient.
+   * @return The gradient of basis function.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 gradient( const int index,
+                                    const real64 xi )
   {
-    constexpr real64 xi_div2 = 0.5 * xi;
-    return xi_div2 + xi_div2 * xi;
+    return index == 0 ? gradient0( xi ) : ( index == 1 ? gradient1( xi ) : gradient2( xi ) );
   }
 
   /**
@@ -79,7 +128,7 @@ class LagrangeBasis2
    */
   GEOSX_HOST_DEVICE
   GEOSX_FORCE_INLINE
-  constexpr static real64 gradient0( constexpr real64 xi )
+  constexpr static real64 gradient0( const real64 xi )
   {
     return -0.5 + xi;
   }
@@ -92,26 +141,28 @@ class LagrangeBasis2
    */
   GEOSX_HOST_DEVICE
   GEOSX_FORCE_INLINE
-  constexpr static real64 gradient1( constexpr real64 xi )
+  constexpr static real64 gradient1( const real64 xi )
   {
-    return -2 * xi;
+    return -2.0 * xi;
   }
 
   /**
-   * @brief The gradient of the basis function for support point 1 evaluated at
+   * @brief The gradient of the basis function for support point 2 evaluated at
    *   a point along the axes.
    * @param xi The coordinate at which to evaluate the gradient.
    * @return The gradient of basis function
    */
   GEOSX_HOST_DEVICE
   GEOSX_FORCE_INLINE
-  constexpr static real64 gradient2( constexpr real64 xi )
+  constexpr static real64 gradient2( const real64 xi )
   {
     return 0.5 + xi;
   }
 
   /**
-   * @class TensorProduct3D
+   * @struct TensorProduct3D
+   *
+   * A 3-dimensional basis formed from the tensor product of the 1d basis.
    *
    *                                                                  ____________________
    *                                                                 |Node   xi0  xi1  xi2|
@@ -148,38 +199,37 @@ class LagrangeBasis2
    */
   struct TensorProduct3D
   {
+    /// The number of support points in the basis.
+    constexpr static localIndex numSupportPoints = 27;
 
     /**
      * @brief Calculates the linear index for support/quadrature points from ijk
      *   coordinates.
-     * @param i The index in the xi0 direction (0,1)
-     * @param j The index in the xi1 direction (0,1)
-     * @param k The index in the xi2 direction (0,1)
-     * @return The linear index of the support/quadrature point (0-7)
+     * @param i The index in the xi0 direction (0,1,2)
+     * @param j The index in the xi1 direction (0,1,2)
+     * @param k The index in the xi2 direction (0,1,2)
+     * @return The linear index of the support/quadrature point (0-26)
      */
     GEOSX_HOST_DEVICE
     GEOSX_FORCE_INLINE
-    constexpr static int linearIndex( constexpr int i,
-                                      constexpr int j,
-                                      constexpr int k )
+    constexpr static int linearIndex( const int i,
+                                      const int j,
+                                      const int k )
     {
       return i + 3 * j + 9 * k;
     }
 
-
-
     /**
      * @brief Calculate the Cartesian/TensorProduct index given the linear index
      *   of a support point.
-     * @param a The linear index of support point
+     * @param linearIndex The linear index of support point
      * @param i0 The Cartesian index of the support point in the xi0 direction.
      * @param i1 The Cartesian index of the support point in the xi1 direction.
      * @param i2 The Cartesian index of the support point in the xi2 direction.
-     * @return
      */
     GEOSX_HOST_DEVICE
     GEOSX_FORCE_INLINE
-    constexpr static void multiIndex( constexpr int linearIndex,
+    constexpr static void multiIndex( const int linearIndex,
                                       int & i0,
                                       int & i1,
                                       int & i2 )
@@ -192,10 +242,38 @@ class LagrangeBasis2
 
       i0 = linearIndex - i1 * 3 - i2 * 9;
     }
-  };
 
+    /**
+     * @brief The value of the basis function for a support point evaluated at a
+     *   point along the axes.
+     *
+     * @param coords The coordinates (in the parent frame) at which to evaluate the basis
+     * @param N Array to hold the value of the basis functions at each support point.
+     */
+    GEOSX_HOST_DEVICE
+    GEOSX_FORCE_INLINE
+    static void value( const real64 (& coords)[3],
+                       real64 (& N)[numSupportPoints] )
+    {
+      for( int a=0; a<3; ++a )
+      {
+        for( int b=0; b<3; ++b )
+        {
+          for( int c=0; c<3; ++c )
+          {
+            const int lindex = LagrangeBasis2::TensorProduct3D::linearIndex( a, b, c );
+            N[ lindex ] = LagrangeBasis2::value( a, coords[0] ) *
+                          LagrangeBasis2::value( b, coords[1] ) *
+                          LagrangeBasis2::value( c, coords[2] );
+          }
+        }
+      }
+    }
+  };
 
 };
 
+}
+}
 
 #endif /* GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_ELEMENTFORMULATIONS_LAGRANGEBASIS2_HPP_ */
@@ -0,0 +1,49 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PrecomputedShapeGradients.hpp
+ */
+
+#ifndef GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_PRECOMPUTEDSHAPEGRADIENTS_HPP_
+#define GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_PRECOMPUTEDSHAPEGRADIENTS_HPP_
+
+#include "FiniteElementBase.hpp"
+
+namespace geosx
+{
+namespace finiteElement
+{
+
+/**
+ * @brief Finite element formulation whose kernels read precomputed shape function gradients.
+ * @tparam FE_TYPE The finite element formulation.
+ *
+ * Kernels instantiated with this type read the gradients and Jacobian determinants computed once by
+ * FiniteElementDiscretization::CalculateShapeFunctionGradients(), instead of computing them from the
+ * nodal coordinates at each quadrature point (see FiniteElementBase::getGradN()).
+ */
+template< typename FE_TYPE >
+class PrecomputedShapeGradients final : public FE_TYPE
+{
+public:
+
+  /// The shape function gradients are read from the precomputed arrays.
+  static constexpr ShapeGradientStorage shapeGradientStorage = ShapeGradientStorage::precomputed;
+};
+
+} // namespace finiteElement
+} // namespace geosx
+
+#endif //GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_PRECOMPUTEDSHAPEGRADIENTS_HPP_
@@ -67,6 +67,30 @@ public:
   using Base::numDofPerTrialSupportPoint;
   using Base::m_elemsToNodes;
 
+  /**
+   * @copybrief finiteElement::KernelBase::estimatedBytesPerElem
+   * @return The estimate of the base kernel, with the dof numbers and the read and written entries of the
+   *         local Jacobian.
+   */
+  static constexpr localIndex estimatedBytesPerElem()
+  {
+    return Base::estimatedBytesPerElem()
+           + numTrialSupportPointsPerElem * numDofPerTrialSupportPoint * sizeof( globalIndex )
+           + 2 * numTestSupportPointsPerElem * numDofPerTestSupportPoint *
+           numTrialSupportPointsPerElem * numDofPerTrialSupportPoint * sizeof( real64 );
+  }
+
+  /**
+   * @copybrief finiteElement::KernelBase::estimatedFlopsPerElem
+   * @return The estimate of the base kernel, with the multiply-adds of the local Jacobian at each quadrature point.
+   */
+  static constexpr localIndex estimatedFlopsPerElem()
+  {
+    return Base::estimatedFlopsPerElem()
+           + Base::numQuadraturePointsPerElem * 2 * 3 * numTestSupportPointsPerElem * numDofPerTestSupportPoint *
+           numTrialSupportPointsPerElem * numDofPerTrialSupportPoint;
+  }
+
 
   /**
    * @brief Constructor
@@ -0,0 +1,45 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file KernelBase.cpp
+ */
+
+#include "KernelBase.hpp"
+
+namespace geosx
+{
+namespace finiteElement
+{
+
+namespace
+{
+
+/// Whether the subregion launches are fused
+bool s_fuseSubRegionLaunches = false;
+
+} // namespace
+
+void setFuseSubRegionLaunches( bool const fuse )
+{
+  s_fuseSubRegionLaunches = fuse;
+}
+
+bool fuseSubRegionLaunches()
+{
+  return s_fuseSubRegionLaunches;
+}
+
+} // namespace finiteElement
+} // namespace geosx
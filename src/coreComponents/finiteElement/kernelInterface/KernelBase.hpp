@@ -21,12 +21,17 @@
 #define GEOSX_FINITEELEMENT_KERNELBASE_HPP_
 
 #include "common/DataTypes.hpp"
+#include "common/LaunchTuner.hpp"
 #include "common/TimingMacros.hpp"
 #include "constitutive/ConstitutivePassThru.hpp"
 #include "finiteElement/FiniteElementDispatch.hpp"
 #include "mesh/ElementRegionManager.hpp"
 #include "rajaInterface/GEOS_RAJA_Interface.hpp"
 
+#include <algorithm>
+#include <deque>
+#include <memory>
+
 
 
 #if defined(__APPLE__)
@@ -91,6 +96,454 @@ namespace geosx
 namespace finiteElement
 {
 
+/**
+ * @brief Number of elements processed together by the kernel launch on the host.
+ *
+ * Defaults to the number of real64 lanes of the widest enabled SIMD instruction set, and
+ * may be overridden at compile time by defining GEOSX_FE_HOST_TILE_SIZE.
+ */
+#if defined(GEOSX_FE_HOST_TILE_SIZE)
+constexpr int hostTileSize = GEOSX_FE_HOST_TILE_SIZE;
+#elif defined(__AVX512F__)
+constexpr int hostTileSize = 8;
+#elif defined(__AVX__)
+constexpr int hostTileSize = 4;
+#else
+constexpr int hostTileSize = 2;
+#endif
+
+/**
+ * @brief Set whether the device launches of the subregions sharing a kernel type are fused.
+ * @param fuse true to group the subregions with the same element type and constitutive model
+ *   in a single launch over their concatenated elements
+ */
+void setFuseSubRegionLaunches( bool const fuse );
+
+/**
+ * @brief Get whether the device launches of the subregions sharing a kernel type are fused.
+ * @return true if the launches are fused
+ */
+bool fuseSubRegionLaunches();
+
+/// Maximum number of subregions fused in a single launch.
+constexpr localIndex maxFusedSubRegions = 16;
+
+/// Maximum size in bytes of the kernel components of a fused launch, which are passed
+/// as kernel parameters (limited to 4KB by CUDA).
+constexpr std::size_t maxFusedLaunchBytes = 3072;
+
+namespace internalKernelLaunch
+{
+
+/**
+ * @brief Loop applying a kernel to a list of elements.
+ * @tparam TILED whether elements are processed by tiles of hostTileSize elements
+ *
+ * The default loop processes one element per iteration, as expected by device policies.
+ */
+template< bool TILED >
+struct ElementLoop
+{
+  /**
+   * @brief Launch the kernel.
+   * @tparam POLICY The RAJA policy to use for the launch.
+   * @tparam KERNEL_TYPE The type of Kernel to execute.
+   * @tparam ELEM_INDEX The type of the function mapping a loop index to an element index.
+   * @param numElems The number of elements to process in this launch.
+   * @param kernelComponent The instantiation of KERNEL_TYPE to execute.
+   * @param elemIndex The function mapping a loop index to an element index.
+   * @return The maximum residual contribution.
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE,
+            typename ELEM_INDEX >
+  static real64 launch( localIndex const numElems,
+                        KERNEL_TYPE const & kernelComponent,
+                        ELEM_INDEX const elemIndex )
+  {
+    // Define a RAJA reduction variable to get the maximum residual contribution.
+    RAJA::ReduceMax< ReducePolicy< POLICY >, real64 > maxResidual( 0 );
+
+    forAll< POLICY >( numElems,
+                      [=] GEOSX_HOST_DEVICE ( localIndex const i )
+    {
+      localIndex const k = elemIndex( i );
+      typename KERNEL_TYPE::StackVariables stack;
+
+      kernelComponent.setup( k, stack );
+      for( integer q=0; q<KERNEL_TYPE::numQuadraturePointsPerElem; ++q )
+      {
+        kernelComponent.quadraturePointKernel( k, q, stack );
+      }
+      maxResidual.max( kernelComponent.complete( k, stack ) );
+    } );
+    return maxResidual.get();
+  }
+};
+
+/**
+ * @brief Loop processing tiles of hostTileSize elements (host policies).
+ *
+ * The phases of the kernel are applied to all the elements of a tile in turn, the loop over
+ * the elements of the tile being the innermost one: setup() gathers the nodal data of the tile,
+ * quadraturePointKernel() runs on independent elements that the compiler may process on SIMD lanes,
+ * and complete() scatters the contributions one element at a time, since elements of a tile may
+ * share nodes.
+ */
+template<>
+struct ElementLoop< true >
+{
+  /**
+   * @copydoc ElementLoop::launch
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE,
+            typename ELEM_INDEX >
+  static real64 launch( localIndex const numElems,
+                        KERNEL_TYPE const & kernelComponent,
+                        ELEM_INDEX const elemIndex )
+  {
+    // Define a RAJA reduction variable to get the maximum residual contribution.
+    RAJA::ReduceMax< ReducePolicy< POLICY >, real64 > maxResidual( 0 );
+
+    localIndex const numTiles = ( numElems + hostTileSize - 1 ) / hostTileSize;
+    forAll< POLICY >( numTiles,
+                      [=] ( localIndex const tile )
+    {
+      localIndex const first = tile * hostTileSize;
+      int const tileSize = numElems - first < hostTileSize ? LvArray::integerConversion< int >( numElems - first ) : hostTileSize;
+      RAJA::TypedRangeSegment< int > const lanes( 0, tileSize );
+
+      localIndex k[ hostTileSize ];
+      typename KERNEL_TYPE::StackVariables stack[ hostTileSize ];
+
+      RAJA::forall< RAJA::simd_exec >( lanes, [&] ( int const e )
+      {
+        k[ e ] = elemIndex( first + e );
+        kernelComponent.setup( k[ e ], stack[ e ] );
+      } );
+      for( integer q=0; q<KERNEL_TYPE::numQuadraturePointsPerElem; ++q )
+      {
+        RAJA::forall< RAJA::simd_exec >( lanes, [&] ( int const e )
+        {
+          kernelComponent.quadraturePointKernel( k[ e ], q, stack[ e ] );
+        } );
+      }
+      for( int e = 0; e < tileSize; ++e )
+      {
+        maxResidual.max( kernelComponent.complete( k[ e ], stack[ e ] ) );
+      }
+    } );
+    return maxResidual.get();
+  }
+};
+
+/**
+ * @class KernelBatch
+ * @brief The kernel components of several subregions, launched together over their concatenated elements.
+ * @tparam KERNEL_TYPE The type of Kernel to execute.
+ *
+ * The components are stored inline so that copying the batch into the launch copies their views, which
+ * moves their data to the device like the capture of a single component does.
+ */
+template< typename KERNEL_TYPE >
+class KernelBatch
+{
+public:
+
+  /// The number of kernel components a batch can hold.
+  static constexpr localIndex capacity =
+    std::max< localIndex >( 1, std::min< localIndex >( maxFusedSubRegions, maxFusedLaunchBytes / sizeof( KERNEL_TYPE ) ) );
+
+  /// Constructor of an empty batch.
+  KernelBatch():
+    m_size( 0 )
+  {
+    m_offsets[ 0 ] = 0;
+  }
+
+  /**
+   * @brief Copy constructor, copying the kernel components.
+   * @param source the batch to copy
+   */
+  GEOSX_HOST_DEVICE
+  KernelBatch( KernelBatch const & source ):
+    m_size( source.m_size )
+  {
+    m_offsets[ 0 ] = 0;
+    for( localIndex c = 0; c < m_size; ++c )
+    {
+      m_offsets[ c + 1 ] = source.m_offsets[ c + 1 ];
+      new ( &m_components[ c ] ) KERNEL_TYPE( source.component( c ) );
+    }
+  }
+
+  /// Destructor.
+  GEOSX_HOST_DEVICE
+  ~KernelBatch()
+  {
+    clear();
+  }
+
+  /// Deleted copy assignment operator
+  KernelBatch & operator=( KernelBatch const & ) = delete;
+
+  /**
+   * @brief Add the kernel component of a subregion.
+   * @param kernelComponent the kernel component
+   * @param numElems the number of elements of the subregion
+   */
+  void push( KERNEL_TYPE const & kernelComponent, localIndex const numElems )
+  {
+    GEOSX_ASSERT( !full() );
+    new ( &m_components[ m_size ] ) KERNEL_TYPE( kernelComponent );
+    m_offsets[ m_size + 1 ] = m_offsets[ m_size ] + numElems;
+    ++m_size;
+  }
+
+  /// Remove all the kernel components.
+  GEOSX_HOST_DEVICE
+  void clear()
+  {
+    for( localIndex c = 0; c < m_size; ++c )
+    {
+      component( c ).~KERNEL_TYPE();
+    }
+    m_size = 0;
+  }
+
+  /**
+   * @brief Get the number of kernel components.
+   * @return the number of kernel components
+   */
+  localIndex size() const
+  { return m_size; }
+
+  /**
+   * @brief Get whether no more kernel components can be added.
+   * @return true if the batch is full
+   */
+  bool full() const
+  { return m_size == capacity; }
+
+  /**
+   * @brief Get the total number of elements.
+   * @return the number of elements of all the subregions
+   */
+  localIndex numElems() const
+  { return m_offsets[ m_size ]; }
+
+  /**
+   * @brief Get the kernel component processing an element of the concatenated index space.
+   * @param index the index of the element in the concatenated index space
+   * @return the index of the kernel component
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  localIndex find( localIndex const index ) const
+  {
+    localIndex c = 0;
+    while( index >= m_offsets[ c + 1 ] )
+    {
+      ++c;
+    }
+    return c;
+  }
+
+  /**
+   * @brief Get the offset of the elements of a kernel component in the concatenated index space.
+   * @param c the index of the kernel component
+   * @return the offset
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  localIndex offset( localIndex const c ) const
+  { return m_offsets[ c ]; }
+
+  /**
+   * @brief Get a kernel component.
+   * @param c the index of the kernel component
+   * @return the kernel component
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  KERNEL_TYPE const & component( localIndex const c ) const
+  { return reinterpret_cast< KERNEL_TYPE const & >( m_components[ c ] ); }
+
+private:
+
+  /// The number of kernel components.
+  localIndex m_size;
+
+  /// The offsets of the elements of each component in the concatenated index space.
+  localIndex m_offsets[ capacity + 1 ];
+
+  /// The storage of the kernel components.
+  typename std::aligned_storage< sizeof( KERNEL_TYPE ), alignof( KERNEL_TYPE ) >::type m_components[ capacity ];
+};
+
+/**
+ * @brief Launch a kernel on the concatenated elements of the subregions of a batch, one element per thread.
+ * @tparam POLICY The RAJA policy to use for the launch.
+ * @tparam KERNEL_TYPE The type of Kernel to execute.
+ * @param batch The kernel components of the subregions.
+ * @return The maximum residual contribution.
+ */
+template< typename POLICY,
+          typename KERNEL_TYPE >
+real64 launchKernelBatch( KernelBatch< KERNEL_TYPE > const & batch )
+{
+  GEOSX_MARK_FUNCTION;
+
+  // Define a RAJA reduction variable to get the maximum residual contribution.
+  RAJA::ReduceMax< ReducePolicy< POLICY >, real64 > maxResidual( 0 );
+
+  forAll< POLICY >( batch.numElems(),
+                    [=] GEOSX_HOST_DEVICE ( localIndex const i )
+  {
+    localIndex const c = batch.find( i );
+    KERNEL_TYPE const & kernelComponent = batch.component( c );
+    localIndex const k = i - batch.offset( c );
+    typename KERNEL_TYPE::StackVariables stack;
+
+    kernelComponent.setup( k, stack );
+    for( integer q=0; q<KERNEL_TYPE::numQuadraturePointsPerElem; ++q )
+    {
+      kernelComponent.quadraturePointKernel( k, q, stack );
+    }
+    maxResidual.max( kernelComponent.complete( k, stack ) );
+  } );
+  return maxResidual.get();
+}
+
+/**
+ * @brief Get the name of the Caliper region of the launches of a kernel type.
+ * @tparam KERNEL_TYPE The type of Kernel.
+ * @return The name, the kernel type without the geosx namespace qualifiers.
+ */
+template< typename KERNEL_TYPE >
+char const * kernelMarkName()
+{
+#ifdef GEOSX_USE_CALIPER
+  static string const name = timingHelpers::kernelName( LvArray::system::demangleType< KERNEL_TYPE >() );
+  return name.c_str();
+#else
+  return nullptr;
+#endif
+}
+
+/**
+ * @class FusedLaunchBase
+ * @brief Type erased pending fused launch of regionBasedKernelApplication().
+ */
+class FusedLaunchBase
+{
+public:
+  /// Destructor.
+  virtual ~FusedLaunchBase() = default;
+
+  /**
+   * @brief Launch the pending kernel components.
+   * @return The maximum residual contribution.
+   */
+  virtual real64 flush() = 0;
+};
+
+/**
+ * @class FusedLaunch
+ * @brief The pending fused launch of the subregions sharing a kernel type.
+ * @tparam POLICY The RAJA policy to use for the launch.
+ * @tparam KERNEL_TYPE The type of Kernel to execute.
+ * @tparam FE_TYPE The type of finite element of the kernel.
+ *
+ * The launch is made when the batch is full or when flushed. The finite elements the kernel
+ * components refer to are kept until then.
+ */
+template< typename POLICY,
+          typename KERNEL_TYPE,
+          typename FE_TYPE >
+class FusedLaunch : public FusedLaunchBase
+{
+public:
+
+  /**
+   * @brief Keep a copy of the finite element of a subregion until the launch.
+   * @param finiteElement the finite element
+   * @return the copy, to construct the kernel component with
+   */
+  FE_TYPE const & store( FE_TYPE const & finiteElement )
+  {
+    m_finiteElements.push_back( finiteElement );
+    return m_finiteElements.back();
+  }
+
+  /**
+   * @brief Add the kernel component of a subregion, launching the pending ones if the batch is full.
+   * @param kernelComponent the kernel component
+   * @param numElems the number of elements of the subregion
+   * @return The maximum residual contribution of the launch, if one was made.
+   */
+  real64 push( KERNEL_TYPE const & kernelComponent, localIndex const numElems )
+  {
+    real64 const maxResidual = m_batch.full() ? flush() : 0.0;
+    m_batch.push( kernelComponent, numElems );
+    return maxResidual;
+  }
+
+  virtual real64 flush() override
+  {
+    if( m_batch.size() == 0 )
+    {
+      return 0.0;
+    }
+
+    static string const kernelTag = LvArray::system::demangleType< KERNEL_TYPE >();
+    GEOSX_MARK_KERNEL( kernelMarkName< KERNEL_TYPE >(),
+                       m_batch.numElems(),
+                       m_batch.numElems() * KERNEL_TYPE::estimatedBytesPerElem(),
+                       m_batch.numElems() * KERNEL_TYPE::estimatedFlopsPerElem() );
+    real64 const maxResidual = LaunchTuner::launch< POLICY >( kernelTag, m_batch.numElems(), [&]( auto policy )
+    {
+      return launchKernelBatch< decltype( policy ) >( m_batch );
+    } );
+    m_batch.clear();
+    return maxResidual;
+  }
+
+private:
+  /// The pending kernel components.
+  KernelBatch< KERNEL_TYPE > m_batch;
+
+  /// The finite elements of the kernel components, whose addresses are stable.
+  std::deque< FE_TYPE > m_finiteElements;
+};
+
+} // namespace internalKernelLaunch
+
+/**
+ * @brief Launch a kernel following the KernelBase interface on a list of elements.
+ * @tparam POLICY The RAJA policy to use for the launch.
+ * @tparam KERNEL_TYPE The type of Kernel to execute.
+ * @tparam ELEM_INDEX The type of the function mapping a loop index to an element index.
+ * @param numElems The number of elements to process in this launch.
+ * @param kernelComponent The instantiation of KERNEL_TYPE to execute.
+ * @param elemIndex The function mapping a loop index to an element index.
+ * @return The maximum residual contribution.
+ *
+ * Host policies process the elements by tiles of #hostTileSize elements, device policies
+ * process one element per thread.
+ */
+template< typename POLICY,
+          typename KERNEL_TYPE,
+          typename ELEM_INDEX >
+real64 launchElementLoop( localIndex const numElems,
+                          KERNEL_TYPE const & kernelComponent,
+                          ELEM_INDEX const elemIndex )
+{
+  constexpr bool tiled = !isDevicePolicy< POLICY > && hostTileSize > 1;
+  return internalKernelLaunch::ElementLoop< tiled >::template launch< POLICY >( numElems, kernelComponent, elemIndex );
+}
+
 /**
  * @class KernelBase
  * @brief Define the base interface for finite element kernels.
@@ -151,6 +604,42 @@ public:
   /// Compile time value for the number of quadrature points per element.
   static constexpr int numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
 
+  /// Compile time value indicating whether the shape function gradients are
+  /// computed from the nodal coordinates, which must then be gathered in setup().
+  static constexpr bool calcShapeGradientsInKernel =
+    FE_TYPE::shapeGradientStorage == ShapeGradientStorage::onTheFly;
+
+  /// Compile time value indicating whether kernelLaunch() is the element loop
+  /// of KernelBase, so that the launches of several subregions may be fused.
+  /// Kernels providing their own kernelLaunch() must set it to false.
+  static constexpr bool fusibleLaunch = true;
+
+  /**
+   * @brief Estimate the number of bytes moved to and from memory per element, for the roofline reports.
+   * @return The bytes of the connectivity, of the nodal coordinates or of the stored shape function
+   *         gradients, of the nodal primary field and of the read and written residual. The constitutive
+   *         data are not counted, kernels reading or writing many of them should provide their own estimate.
+   */
+  static constexpr localIndex estimatedBytesPerElem()
+  {
+    return numTestSupportPointsPerElem * sizeof( localIndex )
+           + ( calcShapeGradientsInKernel ? numTrialSupportPointsPerElem * 3 * sizeof( real64 )
+                                          : numQuadraturePointsPerElem * ( numTrialSupportPointsPerElem * 3 + 1 ) * sizeof( real64 ) )
+           + numTrialSupportPointsPerElem * numDofPerTrialSupportPoint * sizeof( real64 )
+           + 2 * numTestSupportPointsPerElem * numDofPerTestSupportPoint * sizeof( real64 );
+  }
+
+  /**
+   * @brief Estimate the number of floating point operations per element, for the roofline reports.
+   * @return The multiply-adds of the gradient of the trial field and of its product with the gradient of
+   *         the test functions at each quadrature point.
+   */
+  static constexpr localIndex estimatedFlopsPerElem()
+  {
+    return numQuadraturePointsPerElem * 2 * 3 * ( numTrialSupportPointsPerElem * numDofPerTrialSupportPoint +
+                                                  numTestSupportPointsPerElem * numDofPerTestSupportPoint );
+  }
+
   /**
    * @brief Constructor
    * @param elementSubRegion Reference to the SUBREGION_TYPE(class template
@@ -266,7 +755,7 @@ public:
    * @return The maximum residual contribution.
    *
    * This is a generic launching function for all of the finite element kernels
-   * that follow the interface set by KernelBase.
+   * that follow the interface set by KernelBase, see launchElementLoop().
    */
   //START_kernelLauncher
   template< typename POLICY,
@@ -278,22 +767,10 @@ public:
   {
     GEOSX_MARK_FUNCTION;
 
-    // Define a RAJA reduction variable to get the maximum residual contribution.
-    RAJA::ReduceMax< ReducePolicy< POLICY >, real64 > maxResidual( 0 );
-
-    forAll< POLICY >( numElems,
-                      [=] GEOSX_HOST_DEVICE ( localIndex const k )
-    {
-      typename KERNEL_TYPE::StackVariables stack;
-
-      kernelComponent.setup( k, stack );
-      for( integer q=0; q<numQuadraturePointsPerElem; ++q )
-      {
-        kernelComponent.quadraturePointKernel( k, q, stack );
-      }
-      maxResidual.max( kernelComponent.complete( k, stack ) );
-    } );
-    return maxResidual.get();
+    // On the host, elements are processed by tiles to vectorize across elements.
+    return launchElementLoop< POLICY >( numElems,
+                                        kernelComponent,
+                                        [] GEOSX_HOST_DEVICE ( localIndex const k ) { return k; } );
   }
   //END_kernelLauncher
 
@@ -356,6 +833,10 @@ protected:
  *
  * Loops over all regions Applies/Launches a kernel specified by the @p KERNEL_TEMPLATE through
  * #::geosx::finiteElement::KernelBase::kernelLaunch().
+ *
+ * When fuseSubRegionLaunches() is set, the device launches of the subregions sharing an element type
+ * and a constitutive model are grouped in launches over their concatenated elements, of at most
+ * #maxFusedSubRegions subregions, for the kernels whose KERNEL_TYPE::fusibleLaunch is true.
  */
 template< typename POLICY,
           typename CONSTITUTIVE_BASE,
@@ -390,10 +871,14 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
 #endif
 
 
+  // The pending launches of each kernel type when the subregion launches are fused.
+  std::vector< std::unique_ptr< internalKernelLaunch::FusedLaunchBase > > fusedLaunches;
+
   // Loop over all sub-regions in regiongs of type REGION_TYPE, that are listed in the targetRegions array.
   elementRegionManager.forElementSubRegions< REGION_TYPE >( targetRegions,
                                                             [&constitutiveNames,
                                                              &maxResidualContribution,
+                                                             &fusedLaunches,
                                                              &nodeManager,
                                                              &edgeManager,
                                                              &faceManager,
@@ -422,6 +907,7 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
     // Call the constitutive dispatch which converts the type of constitutive model into a compile time constant.
     constitutive::ConstitutivePassThru< CONSTITUTIVE_BASE >::Execute( constitutiveRelation,
                                                                       [&maxResidualContribution,
+                                                                       &fusedLaunches,
                                                                        &nodeManager,
                                                                        &edgeManager,
                                                                        &faceManager,
@@ -442,6 +928,7 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
 
       finiteElement::dispatch3D( subRegionFE,
                                  [&maxResidualContribution,
+                                  &fusedLaunches,
                                   &nodeManager,
                                   &edgeManager,
                                   &faceManager,
@@ -457,6 +944,28 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
                                              CONSTITUTIVE_TYPE,
                                              FE_TYPE >;
 
+        // When fusing, the kernel component is added to the pending launch of its type, which
+        // keeps the finite element it refers to until the launch.
+        using FUSED_LAUNCH_TYPE = internalKernelLaunch::FusedLaunch< POLICY, KERNEL_TYPE, FE_TYPE >;
+        FUSED_LAUNCH_TYPE * fusedLaunch = nullptr;
+        if( isDevicePolicy< POLICY > && KERNEL_TYPE::fusibleLaunch && fuseSubRegionLaunches() )
+        {
+          for( std::unique_ptr< internalKernelLaunch::FusedLaunchBase > const & pending : fusedLaunches )
+          {
+            fusedLaunch = dynamic_cast< FUSED_LAUNCH_TYPE * >( pending.get() );
+            if( fusedLaunch )
+            {
+              break;
+            }
+          }
+          if( fusedLaunch == nullptr )
+          {
+            fusedLaunches.emplace_back( std::make_unique< FUSED_LAUNCH_TYPE >() );
+            fusedLaunch = static_cast< FUSED_LAUNCH_TYPE * >( fusedLaunches.back().get() );
+          }
+        }
+        FE_TYPE const & kernelFiniteElement = fusedLaunch ? fusedLaunch->store( finiteElement ) : finiteElement;
+
         // 1) Combine the tuple containing the physics kernel specific constructor parameters with
         // the parameters common to all phsyics kernels that use this interface,
         // 2) Instantiate the kernel.
@@ -468,7 +977,7 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
                                            edgeManager,
                                            faceManager,
                                            elementSubRegion,
-                                           finiteElement,
+                                           kernelFiniteElement,
                                            castedConstitutiveRelation );
 
         auto fullKernelComponentConstructorArgs = std::tuple_cat( temp,
@@ -481,7 +990,7 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
                                             edgeManager,
                                             faceManager,
                                             elementSubRegion,
-                                            finiteElement,
+                                            kernelFiniteElement,
                                             castedConstitutiveRelation );
         auto fullKernelComponentConstructorArgs = camp::tuple_cat_pair( temp,
                                                                         kernelConstructorParamsTuple );
@@ -489,12 +998,28 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
 
 #endif
 
+        if( fusedLaunch )
+        {
+          maxResidualContribution = std::max( maxResidualContribution,
+                                              fusedLaunch->push( kernelComponent, numElems ) );
+          return;
+        }
+
         // Call the kernelLaunch function, and store the maximum contribution to the residual.
+        // The device block size is chosen by the launch tuner when it is enabled.
+        static string const kernelTag = LvArray::system::demangleType< KERNEL_TYPE >();
+        GEOSX_MARK_KERNEL( internalKernelLaunch::kernelMarkName< KERNEL_TYPE >(),
+                           numElems,
+                           numElems * KERNEL_TYPE::estimatedBytesPerElem(),
+                           numElems * KERNEL_TYPE::estimatedFlopsPerElem() );
         maxResidualContribution =
           std::max( maxResidualContribution,
-                    KERNEL_TYPE::template kernelLaunch< POLICY,
-                                                        KERNEL_TYPE >( numElems,
-                                                                       kernelComponent ) );
+                    LaunchTuner::launch< POLICY >( kernelTag, numElems, [&]( auto policy )
+          {
+            return KERNEL_TYPE::template kernelLaunch< decltype( policy ),
+                                                       KERNEL_TYPE >( numElems,
+                                                                      kernelComponent );
+          } ) );
       } );
     } );
 
@@ -506,6 +1031,12 @@ real64 regionBasedKernelApplication( MeshLevel & mesh,
 
   } );
 
+  // Launch the subregions still pending in the fused launches.
+  for( std::unique_ptr< internalKernelLaunch::FusedLaunchBase > const & pending : fusedLaunches )
+  {
+    maxResidualContribution = std::max( maxResidualContribution, pending->flush() );
+  }
+
   return maxResidualContribution;
 }
 //END_regionBasedKernelApplication
@@ -65,6 +65,9 @@ public:
 
   using Base::setup;
 
+  /// The sparsity pattern is filled by a host launch skipping the quadrature points.
+  static constexpr bool fusibleLaunch = false;
+
   /**
    * @brief Constructor
    * @param nodeManager Reference to the NodeManager object.
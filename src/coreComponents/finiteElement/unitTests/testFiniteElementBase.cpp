@@ -93,39 +93,6 @@ TEST( FiniteElementBase, test_capture )
   arrayView1d< localIndex > gradNDimsView = gradNDims.toView();
   arrayView1d< localIndex > detJDimsView = detJDims.toView();
 
-#if defined(CALC_FEM_SHAPE_IN_KERNEL)
-
-  forAll< parallelDevicePolicy<> >( 1, [ feBase, gradNDimsView, detJDimsView ]( int const i )
-  {
-    gradNDimsView[0] = feBase.getGradNView().size( 0 );
-    gradNDimsView[1] = feBase.getGradNView().size( 1 );
-    gradNDimsView[2] = feBase.getGradNView().size( 2 );
-    gradNDimsView[3] = feBase.getGradNView().size( 3 );
-    detJDimsView[0] = feBase.getDetJView().size( 0 );
-    detJDimsView[1] = feBase.getDetJView().size( 1 );
-
-    printf( "gradNDimsView = { %ld, %ld, %ld, %ld }\n",
-            gradNDimsView[0],
-            gradNDimsView[1],
-            gradNDimsView[2],
-            gradNDimsView[3] );
-
-    printf( "detJDimsView = { %ld, %ld }\n",
-            detJDimsView[0],
-            detJDimsView[1] );
-  } );
-
-  forAll< serialPolicy >( 1, [ feBase, gradNDimsView, detJDimsView ]( int const i )
-  {} );
-
-  EXPECT_EQ( gradNDimsView[0], 0 );
-  EXPECT_EQ( gradNDimsView[1], 0 );
-  EXPECT_EQ( gradNDimsView[2], 0 );
-  EXPECT_EQ( gradNDimsView[3], 0 );
-
-  EXPECT_EQ( detJDimsView[0], 0 );
-  EXPECT_EQ( detJDimsView[1], 0 );
-#endif
 
 
   forAll< serialPolicy >( 1, [ feBase, gradNDimsView, detJDimsView ]( int const )
@@ -0,0 +1,208 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testH1_Hexahedron_Lagrange2_GaussLegendre3
+ */
+
+#include "managers/initialization.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+#include "gtest/gtest.h"
+
+#include "finiteElement/elementFormulations/H1_Hexahedron_Lagrange2_GaussLegendre3.hpp"
+
+using namespace geosx;
+using namespace finiteElement;
+
+template< typename POLICY >
+void testKernelDriver()
+{
+  using FE = H1_Hexahedron_Lagrange2_GaussLegendre3;
+  constexpr int numNodes = FE::numNodes;
+  constexpr int numQuadraturePoints = FE::numQuadraturePoints;
+
+  array2d< real64 > arrN( numQuadraturePoints, numNodes );
+  array1d< real64 > arrDetJxW( numQuadraturePoints );
+  array1d< real64 > arrSumFactorizedDetJxW( numQuadraturePoints );
+  array3d< real64 > arrGrad( numQuadraturePoints, 3, 3 );
+  array3d< real64 > arrSumFactorizedGrad( numQuadraturePoints, 3, 3 );
+  array2d< real64 > arrR( numNodes, 3 );
+  array2d< real64 > arrSumFactorizedR( numNodes, 3 );
+
+  arrayView2d< real64 > const & viewN = arrN;
+  arrayView1d< real64 > const & viewDetJxW = arrDetJxW;
+  arrayView1d< real64 > const & viewSumFactorizedDetJxW = arrSumFactorizedDetJxW;
+  arrayView3d< real64 > const & viewGrad = arrGrad;
+  arrayView3d< real64 > const & viewSumFactorizedGrad = arrSumFactorizedGrad;
+  arrayView2d< real64 > const & viewR = arrR;
+  arrayView2d< real64 > const & viewSumFactorizedR = arrSumFactorizedR;
+
+  forAll< POLICY >( 1,
+                    [=] GEOSX_HOST_DEVICE ( localIndex const )
+  {
+    // A distorted element, and a smooth vector field on its nodes.
+    real64 X[numNodes][3];
+    real64 u[numNodes][3];
+    for( int a = 0; a < numNodes; ++a )
+    {
+      int i0, i1, i2;
+      LagrangeBasis2::TensorProduct3D::multiIndex( a, i0, i1, i2 );
+      X[a][0] = LagrangeBasis2::parentSupportCoord( i0 ) + 0.1 * sin( 1.0 * a );
+      X[a][1] = LagrangeBasis2::parentSupportCoord( i1 ) + 0.1 * cos( 1.0 * a );
+      X[a][2] = 1.5 * LagrangeBasis2::parentSupportCoord( i2 ) + 0.05 * a / numNodes;
+      for( int i = 0; i < 3; ++i )
+      {
+        u[a][i] = sin( 3.0 * a + i );
+      }
+    }
+
+    real64 J[numQuadraturePoints][3][3];
+    real64 parentGrad[numQuadraturePoints][3][3];
+    FE::parentGradients( X, J );
+    FE::parentGradients( u, parentGrad );
+
+    real64 R[numNodes][3] = {{0}};
+    real64 flux[numQuadraturePoints][3][3];
+    for( int q = 0; q < numQuadraturePoints; ++q )
+    {
+      real64 N[numNodes];
+      FE::calcN( q, N );
+      for( int a = 0; a < numNodes; ++a )
+      {
+        viewN( q, a ) = N[a];
+      }
+
+      real64 gradN[numNodes][3];
+      real64 const detJxW = FE::calcGradN( q, X, gradN );
+      viewDetJxW[q] = detJxW;
+      viewSumFactorizedDetJxW[q] = LvArray::tensorOps::determinant< 3 >( J[q] ) * FE::quadratureWeight( q );
+
+      real64 invJ[3][3];
+      FE::invJacobianTransformation( q, X, invJ );
+
+      real64 grad[3][3] = {{0}};
+      FE::gradient( q, invJ, u, grad );
+
+      real64 stress[6];
+      for( int i = 0; i < 6; ++i )
+      {
+        stress[i] = cos( 1.0 * q + i ) * detJxW;
+      }
+      FE::plus_gradNajAij( q, invJ, stress, R );
+
+      real64 const stressTensor[3][3] = { { stress[0], stress[5], stress[4] },
+                                          { stress[5], stress[1], stress[3] },
+                                          { stress[4], stress[3], stress[2] } };
+      for( int i = 0; i < 3; ++i )
+      {
+        for( int j = 0; j < 3; ++j )
+        {
+          real64 sumFactorizedGrad = 0.0;
+          real64 f = 0.0;
+          for( int k = 0; k < 3; ++k )
+          {
+            sumFactorizedGrad += parentGrad[q][i][k] * invJ[k][j];
+            f -= stressTensor[i][k] * invJ[j][k];
+          }
+          viewGrad( q, i, j ) = grad[i][j];
+          viewSumFactorizedGrad( q, i, j ) = sumFactorizedGrad;
+          flux[q][i][j] = f;
+        }
+      }
+    }
+
+    real64 sumFactorizedR[numNodes][3] = {{0}};
+    FE::plusParentGradientTranspose( flux, sumFactorizedR );
+    for( int a = 0; a < numNodes; ++a )
+    {
+      for( int i = 0; i < 3; ++i )
+      {
+        viewR( a, i ) = R[a][i];
+        viewSumFactorizedR( a, i ) = sumFactorizedR[a][i];
+      }
+    }
+  } );
+
+  forAll< serialPolicy >( 1,
+                          [=] ( localIndex const )
+  {
+    constexpr real64 qCoords[3] = { -0.7745966692414833770359, 0.0, 0.7745966692414833770359 };
+    real64 volume = 0.0;
+    for( localIndex q=0; q<numQuadraturePoints; ++q )
+    {
+      int qa, qb, qc;
+      LagrangeBasis2::TensorProduct3D::multiIndex( q, qa, qb, qc );
+      real64 sumN = 0.0;
+      for( localIndex a=0; a<numNodes; ++a )
+      {
+        int i0, i1, i2;
+        LagrangeBasis2::TensorProduct3D::multiIndex( a, i0, i1, i2 );
+        real64 const N = LagrangeBasis2::value( i0, qCoords[qa] ) *
+                         LagrangeBasis2::value( i1, qCoords[qb] ) *
+                         LagrangeBasis2::value( i2, qCoords[qc] );
+        EXPECT_NEAR( N, viewN[q][a], 1.0e-14 );
+        sumN += viewN[q][a];
+      }
+      EXPECT_NEAR( sumN, 1.0, 1.0e-14 );
+      volume += viewDetJxW[q];
+      EXPECT_NEAR( viewDetJxW[q], viewSumFactorizedDetJxW[q], 1.0e-12 );
+
+      for( int i = 0; i < 3; ++i )
+      {
+        for( int j = 0; j < 3; ++j )
+        {
+          EXPECT_NEAR( viewGrad[q][i][j], viewSumFactorizedGrad[q][i][j], 1.0e-12 );
+        }
+      }
+    }
+    EXPECT_GT( volume, 0.0 );
+
+    for( localIndex a=0; a<numNodes; ++a )
+    {
+      for( int i = 0; i < 3; ++i )
+      {
+        EXPECT_NEAR( viewR[a][i], viewSumFactorizedR[a][i], 1.0e-12 );
+      }
+    }
+  } );
+}
+
+
+#ifdef USE_CUDA
+TEST( FiniteElementShapeFunctions, testKernelCuda )
+{
+  testKernelDriver< geosx::parallelDevicePolicy< 32 > >();
+}
+#endif
+TEST( FiniteElementShapeFunctions, testKernelHost )
+{
+  testKernelDriver< serialPolicy >();
+}
+
+
+
+using namespace geosx;
+int main( int argc, char * argv[] )
+{
+  testing::InitGoogleTest();
+
+  basicSetup( argc, argv, false );
+
+  int const result = RUN_ALL_TESTS();
+
+  basicCleanup();
+
+  return result;
+}
@@ -0,0 +1,98 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+#include "finiteElement/Kinematics.h"
+#include "gtest/gtest.h"
+
+
+using namespace geosx;
+
+namespace
+{
+
+// the gradients of a large finite strain step
+real64 const dUhatdX[ 3 ][ 3 ] = { { 0.02, -0.15, 0.04 }, { 0.11, -0.03, 0.07 }, { -0.06, 0.09, 0.01 } };
+real64 const dUdX[ 3 ][ 3 ] = { { 0.10, 0.05, -0.20 }, { -0.08, 0.03, 0.12 }, { 0.25, -0.04, -0.07 } };
+
+}
+
+TEST( Kinematics, HughesWingetRotation )
+{
+  real64 Rot[ 3 ][ 3 ];
+  real64 Dadt[ 6 ];
+  HughesWinget( Rot, Dadt, dUhatdX );
+
+  // the rotation is orthogonal, with a unit determinant
+  real64 RRt[ 3 ][ 3 ];
+  LvArray::tensorOps::Rij_eq_AikBjk< 3, 3, 3 >( RRt, Rot, Rot );
+  for( int i = 0; i < 3; ++i )
+  {
+    for( int j = 0; j < 3; ++j )
+    {
+      EXPECT_NEAR( RRt[ i ][ j ], i == j ? 1.0 : 0.0, 1e-14 );
+    }
+  }
+  EXPECT_NEAR( LvArray::tensorOps::determinant< 3 >( Rot ), 1.0, 1e-14 );
+
+  EXPECT_DOUBLE_EQ( Dadt[ 0 ], dUhatdX[ 0 ][ 0 ] );
+  EXPECT_DOUBLE_EQ( Dadt[ 3 ], 0.5 * ( dUhatdX[ 1 ][ 2 ] + dUhatdX[ 2 ][ 1 ] ) );
+}
+
+TEST( Kinematics, HughesWingetIncrements )
+{
+  real64 Rot[ 3 ][ 3 ];
+  real64 Dadt[ 6 ];
+  real64 fInv[ 3 ][ 3 ];
+  real64 const detF = HughesWingetIncrements( Rot, Dadt, fInv, dUhatdX, dUdX );
+
+  // the increments computed step by step with the general tensor routines
+  real64 F[ 3 ][ 3 ];
+  real64 fInvRef[ 3 ][ 3 ];
+  real64 Ldt[ 3 ][ 3 ];
+  LvArray::tensorOps::scaledCopy< 3, 3 >( F, dUhatdX, 0.5 );
+  LvArray::tensorOps::add< 3, 3 >( F, dUdX );
+  LvArray::tensorOps::addIdentity< 3 >( F, 1.0 );
+  LvArray::tensorOps::invert< 3 >( fInvRef, F );
+  LvArray::tensorOps::Rij_eq_AikBkj< 3, 3, 3 >( Ldt, dUhatdX, fInvRef );
+
+  LvArray::tensorOps::copy< 3, 3 >( F, dUhatdX );
+  LvArray::tensorOps::add< 3, 3 >( F, dUdX );
+  LvArray::tensorOps::addIdentity< 3 >( F, 1.0 );
+  real64 const detFRef = LvArray::tensorOps::invert< 3 >( fInvRef, F );
+
+  real64 RotRef[ 3 ][ 3 ];
+  real64 DadtRef[ 6 ];
+  HughesWinget( RotRef, DadtRef, Ldt );
+
+  EXPECT_NEAR( detF, detFRef, 1e-14 );
+  for( int i = 0; i < 3; ++i )
+  {
+    for( int j = 0; j < 3; ++j )
+    {
+      EXPECT_NEAR( Rot[ i ][ j ], RotRef[ i ][ j ], 1e-14 );
+      EXPECT_NEAR( fInv[ i ][ j ], fInvRef[ i ][ j ], 1e-14 );
+    }
+  }
+  for( int i = 0; i < 6; ++i )
+  {
+    EXPECT_NEAR( Dadt[ i ], DadtRef[ i ], 1e-14 );
+  }
+}
+
+int main( int argc, char * argv[] )
+{
+  testing::InitGoogleTest( &argc, argv );
+  return RUN_ALL_TESTS();
+}
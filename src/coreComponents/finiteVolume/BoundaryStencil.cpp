@@ -49,7 +49,7 @@ void BoundaryStencil::add( localIndex const numPts,
     m_elementIndices( oldSize, a ) = elementIndices[a];
     m_weights( oldSize, a ) = weights[a];
   }
-  m_connectorIndices[connectorIndex] = oldSize;
+  setConnectorEntry( connectorIndex, oldSize );
 }
 
 } // namespace geosx
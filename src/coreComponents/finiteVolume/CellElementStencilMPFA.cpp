@@ -49,7 +49,54 @@ void CellElementStencilMPFA::add( localIndex const numPts,
   m_elementIndices.appendArray( elementIndices, elementIndices + numPts );
   m_weights.appendArray( weights, weights + numPts );
 
-  m_connectorIndices[connectorIndex] = m_elementRegionIndices.size()-1;
+  setConnectorEntry( connectorIndex, m_elementRegionIndices.size()-1 );
+}
+
+void CellElementStencilMPFA::move( LvArray::MemorySpace const space )
+{
+  StencilBase< CellElementStencilMPFA_Traits, CellElementStencilMPFA >::move( space );
+  m_sizeBinnedConnections.move( space, true );
+}
+
+localIndex CellElementStencilMPFA::sizeBin( localIndex const numPts )
+{
+  for( localIndex bin = 0; bin < NUM_SIZE_BINS - 1; ++bin )
+  {
+    if( numPts <= binStencilSize( bin ) )
+    {
+      return bin;
+    }
+  }
+  return NUM_SIZE_BINS - 1;
+}
+
+void CellElementStencilMPFA::groupBySize()
+{
+  localIndex const numConnections = size();
+
+  // Counting sort of the entries by size bin, keeping their order within a bin
+  m_sizeBinOffsets.resize( NUM_SIZE_BINS + 1 );
+  m_sizeBinOffsets.setValues< serialPolicy >( 0 );
+  for( localIndex iconn = 0; iconn < numConnections; ++iconn )
+  {
+    ++m_sizeBinOffsets[ sizeBin( stencilSize( iconn ) ) + 1 ];
+  }
+  for( localIndex bin = 0; bin < NUM_SIZE_BINS; ++bin )
+  {
+    m_sizeBinOffsets[bin + 1] += m_sizeBinOffsets[bin];
+  }
+
+  array1d< localIndex > position( NUM_SIZE_BINS );
+  for( localIndex bin = 0; bin < NUM_SIZE_BINS; ++bin )
+  {
+    position[bin] = m_sizeBinOffsets[bin];
+  }
+
+  m_sizeBinnedConnections.resize( numConnections );
+  for( localIndex iconn = 0; iconn < numConnections; ++iconn )
+  {
+    m_sizeBinnedConnections[ position[ sizeBin( stencilSize( iconn ) ) ]++ ] = iconn;
+  }
 }
 
 } /* namespace geosx */
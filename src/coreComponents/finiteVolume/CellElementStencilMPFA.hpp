@@ -56,12 +56,18 @@ struct CellElementStencilMPFA_Traits
   /// Maximum number of points in a stencil
   static localIndex constexpr MAX_STENCIL_SIZE = 18;
 
+  /// Number of stencil size bins, see CellElementStencilMPFA::binStencilSize
+  static localIndex constexpr NUM_SIZE_BINS = 4;
+
 };
 
 /**
  * @class CellElementStencilMPFA
  *
  * Provides management of the interior stencil points when using a Multi-point flux approximation.
+ *
+ * The entries can be binned by stencil size with groupBySize, so that a flux kernel can be instantiated for the
+ * largest size of each bin and work on statically sized local arrays.
  */
 class CellElementStencilMPFA : public StencilBase< CellElementStencilMPFA_Traits, CellElementStencilMPFA >,
   public CellElementStencilMPFA_Traits
@@ -97,6 +103,86 @@ public:
   localIndex stencilSize( localIndex index ) const
   { return m_elementRegionIndices.sizeOfArray( index ); }
 
+  virtual void move( LvArray::MemorySpace const space ) override final;
+
+  /**
+   * @brief Get the largest stencil size of a bin.
+   * @param[in] bin the bin
+   * @return the stencil size: the hexahedral meshes mostly give 6, 8, 12 and 18 points
+   */
+  GEOSX_HOST_DEVICE
+  static constexpr localIndex binStencilSize( localIndex const bin )
+  {
+    return bin == 0 ? 6 : ( bin == 1 ? 8 : ( bin == 2 ? 12 : MAX_STENCIL_SIZE ) );
+  }
+
+  /**
+   * @brief Get the bin of a stencil size.
+   * @param[in] numPts the stencil size
+   * @return the smallest bin whose stencil size is at least @p numPts
+   */
+  static localIndex sizeBin( localIndex const numPts );
+
+  /**
+   * @brief Bin the stencil entries by stencil size, to be called once all the entries are added.
+   */
+  void groupBySize();
+
+  /**
+   * @brief Get the stencil entries sorted by size bin.
+   * @return the indices of the entries, empty before groupBySize
+   */
+  arrayView1d< localIndex const > getSizeBinnedConnections() const { return m_sizeBinnedConnections.toViewConst(); }
+
+  /**
+   * @brief Get the offsets of the size bins in the binned entries.
+   * @return the NUM_SIZE_BINS + 1 offsets, empty before groupBySize
+   */
+  arrayView1d< localIndex const > getSizeBinOffsets() const { return m_sizeBinOffsets.toViewConst(); }
+
+  /**
+   * @brief Call a function for each non-empty size bin.
+   * @tparam LAMBDA the type of the function
+   * @param[in] lambda the function, called with a std::integral_constant holding the stencil size of the bin,
+   *   the binned entries and the range [begin, end) of the bin in them
+   */
+  template< typename LAMBDA >
+  void forSizeBins( LAMBDA && lambda ) const
+  {
+    forSizeBin< 0 >( lambda );
+    forSizeBin< 1 >( lambda );
+    forSizeBin< 2 >( lambda );
+    forSizeBin< 3 >( lambda );
+  }
+
+private:
+
+  /**
+   * @brief Call a function for a size bin if it is not empty.
+   * @tparam BIN the bin
+   * @tparam LAMBDA the type of the function
+   * @param[in] lambda the function
+   */
+  template< localIndex BIN, typename LAMBDA >
+  void forSizeBin( LAMBDA && lambda ) const
+  {
+    static_assert( BIN < NUM_SIZE_BINS, "Invalid size bin" );
+    GEOSX_ERROR_IF( m_sizeBinOffsets.empty(), "The stencil entries have not been binned by size" );
+    localIndex const begin = m_sizeBinOffsets[BIN];
+    localIndex const end = m_sizeBinOffsets[BIN + 1];
+    if( end > begin )
+    {
+      lambda( std::integral_constant< localIndex, binStencilSize( BIN ) >{},
+              m_sizeBinnedConnections.toViewConst(), begin, end );
+    }
+  }
+
+  /// The stencil entries sorted by size bin
+  array1d< localIndex > m_sizeBinnedConnections;
+
+  /// The offset of each size bin in m_sizeBinnedConnections
+  array1d< localIndex > m_sizeBinOffsets;
+
 };
 
 } /* namespace geosx */
@@ -19,6 +19,7 @@
 
 #include "CellElementStencilTPFA.hpp"
 #include "codingUtilities/Utilities.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
 
 namespace geosx
 {
@@ -51,7 +52,242 @@ void CellElementStencilTPFA::add( localIndex const numPts,
     m_elementIndices( oldSize, a ) = elementIndices[a];
     m_weights( oldSize, a ) = weights[a];
   }
-  m_connectorIndices[connectorIndex] = oldSize;
+  setConnectorEntry( connectorIndex, oldSize );
+
+  // The new connection is not colored
+  m_connectionColors.clear();
+  m_coloredConnections.clear();
+  m_colorOffsets.clear();
+  m_crossSubRegionColorOffsets.clear();
+  for( SubRegionConnections & connections : m_subRegionConnections )
+  {
+    connections.colorOffsets.clear();
+  }
+
+  m_connectionGroup.resize( newSize );
+  m_connectionIndexInGroup.resize( newSize );
+  if( elementRegionIndices[0] != elementRegionIndices[1] || elementSubRegionIndices[0] != elementSubRegionIndices[1] )
+  {
+    m_connectionGroup[oldSize] = -1;
+    m_connectionIndexInGroup[oldSize] = m_crossSubRegionConnections.size();
+    m_crossSubRegionConnections.emplace_back( oldSize );
+    return;
+  }
+
+  // There are few subregions for many connections, a linear search is enough
+  localIndex group = 0;
+  while( group < LvArray::integerConversion< localIndex >( m_subRegionConnections.size() ) &&
+         ( m_subRegionConnections[group].regionIndex != elementRegionIndices[0] ||
+           m_subRegionConnections[group].subRegionIndex != elementSubRegionIndices[0] ) )
+  {
+    ++group;
+  }
+  if( group == LvArray::integerConversion< localIndex >( m_subRegionConnections.size() ) )
+  {
+    m_subRegionConnections.emplace_back();
+    m_subRegionConnections.back().regionIndex = elementRegionIndices[0];
+    m_subRegionConnections.back().subRegionIndex = elementSubRegionIndices[0];
+  }
+
+  SubRegionConnections & connections = m_subRegionConnections[group];
+  localIndex const index = connections.elementIndices.size( 0 );
+  connections.elementIndices.resize( index + 1, numPts );
+  connections.weights.resize( index + 1, numPts );
+  for( localIndex a=0; a<numPts; ++a )
+  {
+    connections.elementIndices( index, a ) = elementIndices[a];
+    connections.weights( index, a ) = weights[a];
+  }
+  m_connectionGroup[oldSize] = group;
+  m_connectionIndexInGroup[oldSize] = index;
+}
+
+void CellElementStencilTPFA::move( LvArray::MemorySpace const space )
+{
+  StencilBase< CellElementStencilTPFA_Traits, CellElementStencilTPFA >::move( space );
+  for( SubRegionConnections & connections : m_subRegionConnections )
+  {
+    connections.elementIndices.move( space, true );
+    connections.weights.move( space, true );
+  }
+  m_crossSubRegionConnections.move( space, true );
+}
+
+bool CellElementStencilTPFA::zero( localIndex const connectorIndex )
+{
+  localIndex const connectionListIndex = getConnectorEntry( connectorIndex );
+  if( connectionListIndex < 0 )
+  {
+    return false;
+  }
+
+  for( localIndex i = 0; i < stencilSize( connectionListIndex ); ++i )
+  {
+    m_weights[connectionListIndex][i] = 0;
+  }
+
+  localIndex const group = m_connectionGroup[connectionListIndex];
+  if( group >= 0 )
+  {
+    for( localIndex i = 0; i < stencilSize( connectionListIndex ); ++i )
+    {
+      m_subRegionConnections[group].weights[m_connectionIndexInGroup[connectionListIndex]][i] = 0;
+    }
+  }
+  return true;
+}
+
+void CellElementStencilTPFA::resize( localIndex const numConnections, localIndex const numConnectors )
+{
+  m_elementRegionIndices.resize( numConnections, MAX_STENCIL_SIZE );
+  m_elementSubRegionIndices.resize( numConnections, MAX_STENCIL_SIZE );
+  m_elementIndices.resize( numConnections, MAX_STENCIL_SIZE );
+  m_weights.resize( numConnections, MAX_STENCIL_SIZE );
+
+  m_connectorIndices.clear();
+  m_connectorIndices.resizeDefault( numConnectors, -1 );
+
+  m_connectionColors.clear();
+  m_coloredConnections.clear();
+  m_colorOffsets.clear();
+  m_subRegionConnections.clear();
+  m_crossSubRegionConnections.clear();
+  m_crossSubRegionColorOffsets.clear();
+  m_connectionGroup.resize( numConnections );
+  m_connectionIndexInGroup.resize( numConnections );
+}
+
+void CellElementStencilTPFA::set( localIndex const index,
+                                  localIndex const * const elementRegionIndices,
+                                  localIndex const * const elementSubRegionIndices,
+                                  localIndex const * const elementIndices,
+                                  real64 const * const weights,
+                                  localIndex const connectorIndex )
+{
+  for( localIndex a = 0; a < MAX_STENCIL_SIZE; ++a )
+  {
+    m_elementRegionIndices( index, a ) = elementRegionIndices[a];
+    m_elementSubRegionIndices( index, a ) = elementSubRegionIndices[a];
+    m_elementIndices( index, a ) = elementIndices[a];
+    m_weights( index, a ) = weights[a];
+  }
+  m_connectorIndices[connectorIndex] = index;
+}
+
+void CellElementStencilTPFA::groupBySubRegion()
+{
+  localIndex const numConnections = size();
+
+  // Assign the groups and the index in each group, there are few subregions for many connections
+  array1d< localIndex > groupSizes;
+  localIndex numCross = 0;
+  for( localIndex iconn = 0; iconn < numConnections; ++iconn )
+  {
+    localIndex const er = m_elementRegionIndices( iconn, 0 );
+    localIndex const esr = m_elementSubRegionIndices( iconn, 0 );
+    if( er != m_elementRegionIndices( iconn, 1 ) || esr != m_elementSubRegionIndices( iconn, 1 ) )
+    {
+      m_connectionGroup[iconn] = -1;
+      m_connectionIndexInGroup[iconn] = numCross++;
+      continue;
+    }
+
+    localIndex group = 0;
+    while( group < groupSizes.size() &&
+           ( m_subRegionConnections[group].regionIndex != er || m_subRegionConnections[group].subRegionIndex != esr ) )
+    {
+      ++group;
+    }
+    if( group == groupSizes.size() )
+    {
+      m_subRegionConnections.emplace_back();
+      m_subRegionConnections.back().regionIndex = er;
+      m_subRegionConnections.back().subRegionIndex = esr;
+      groupSizes.emplace_back( 0 );
+    }
+    m_connectionGroup[iconn] = group;
+    m_connectionIndexInGroup[iconn] = groupSizes[group]++;
+  }
+
+  // The groups are allocated once and filled in parallel
+  for( localIndex group = 0; group < groupSizes.size(); ++group )
+  {
+    m_subRegionConnections[group].elementIndices.resize( groupSizes[group], MAX_STENCIL_SIZE );
+    m_subRegionConnections[group].weights.resize( groupSizes[group], MAX_STENCIL_SIZE );
+  }
+  m_crossSubRegionConnections.resize( numCross );
+
+  forAll< parallelHostPolicy >( numConnections, [&]( localIndex const iconn )
+  {
+    localIndex const group = m_connectionGroup[iconn];
+    localIndex const index = m_connectionIndexInGroup[iconn];
+    if( group < 0 )
+    {
+      m_crossSubRegionConnections[index] = iconn;
+      return;
+    }
+
+    for( localIndex a = 0; a < MAX_STENCIL_SIZE; ++a )
+    {
+      m_subRegionConnections[group].elementIndices( index, a ) = m_elementIndices( iconn, a );
+      m_subRegionConnections[group].weights( index, a ) = m_weights( iconn, a );
+    }
+  } );
+}
+
+void CellElementStencilTPFA::computeColoring()
+{
+  StencilBase< CellElementStencilTPFA_Traits, CellElementStencilTPFA >::computeColoring();
+  localIndex const numColors = m_colorOffsets.size() - 1;
+
+  // Rebuild each group in the color order, which keeps the index order within a color
+  std::vector< SubRegionConnections > coloredGroups( m_subRegionConnections.size() );
+  for( std::size_t group = 0; group < m_subRegionConnections.size(); ++group )
+  {
+    coloredGroups[group].regionIndex = m_subRegionConnections[group].regionIndex;
+    coloredGroups[group].subRegionIndex = m_subRegionConnections[group].subRegionIndex;
+    coloredGroups[group].elementIndices.resize( m_subRegionConnections[group].elementIndices.size( 0 ), 2 );
+    coloredGroups[group].weights.resize( m_subRegionConnections[group].weights.size( 0 ), 2 );
+    coloredGroups[group].colorOffsets.resize( numColors + 1 );
+  }
+  m_crossSubRegionColorOffsets.resize( numColors + 1 );
+  m_crossSubRegionColorOffsets.setValues< serialPolicy >( 0 );
+
+  localIndex numCross = 0;
+  for( localIndex color = 0; color < numColors; ++color )
+  {
+    for( localIndex i = m_colorOffsets[color]; i < m_colorOffsets[color + 1]; ++i )
+    {
+      localIndex const iconn = m_coloredConnections[i];
+      localIndex const group = m_connectionGroup[iconn];
+      if( group < 0 )
+      {
+        m_crossSubRegionConnections[numCross] = iconn;
+        m_connectionIndexInGroup[iconn] = numCross++;
+        continue;
+      }
+
+      SubRegionConnections & colored = coloredGroups[group];
+      localIndex const index = colored.colorOffsets[color + 1]++;
+      for( localIndex a = 0; a < 2; ++a )
+      {
+        colored.elementIndices( index, a ) = m_subRegionConnections[group].elementIndices( m_connectionIndexInGroup[iconn], a );
+        colored.weights( index, a ) = m_subRegionConnections[group].weights( m_connectionIndexInGroup[iconn], a );
+      }
+      m_connectionIndexInGroup[iconn] = index;
+    }
+
+    m_crossSubRegionColorOffsets[color + 1] = numCross;
+    for( SubRegionConnections & colored : coloredGroups )
+    {
+      if( color + 1 < numColors )
+      {
+        colored.colorOffsets[color + 2] = colored.colorOffsets[color + 1];
+      }
+    }
+  }
+
+  m_subRegionConnections = std::move( coloredGroups );
 }
 
 } /* namespace geosx */
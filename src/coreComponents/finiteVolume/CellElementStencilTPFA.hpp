@@ -21,6 +21,8 @@
 
 #include "StencilBase.hpp"
 
+#include <vector>
+
 namespace geosx
 {
 
@@ -67,11 +69,45 @@ class CellElementStencilTPFA : public StencilBase< CellElementStencilTPFA_Traits
 {
 public:
 
+  /**
+   * @struct SubRegionConnections
+   * The connections between two elements of the same subregion, stored flat so that
+   * the flux kernels index the subregion views directly.
+   */
+  struct SubRegionConnections
+  {
+    /// The region index of the elements
+    localIndex regionIndex;
+
+    /// The subregion index of the elements
+    localIndex subRegionIndex;
+
+    /// The indices of the two elements of each connection
+    array2d< localIndex > elementIndices;
+
+    /// The weights of the two elements of each connection
+    array2d< real64 > weights;
+
+    /// The offset of each color in the connections, which are sorted by color, empty if the stencil is not colored
+    array1d< localIndex > colorOffsets;
+  };
+
   /**
    * @brief Default constructor.
    */
   CellElementStencilTPFA();
 
+  virtual void move( LvArray::MemorySpace const space ) override final;
+
+  virtual bool zero( localIndex const connectorIndex ) override final;
+
+  /**
+   * @copydoc StencilBase::computeColoring
+   *
+   * The connections within a subregion and the connections between two subregions are also sorted by color.
+   */
+  virtual void computeColoring() override final;
+
   virtual void add( localIndex const numPts,
                     localIndex const * const elementRegionIndices,
                     localIndex const * const elementSubRegionIndices,
@@ -79,6 +115,39 @@ public:
                     real64 const * const weights,
                     localIndex const connectorIndex ) override final;
 
+  /**
+   * @brief Resize the stencil to a known number of entries, discarding the current entries.
+   * @param[in] numConnections the number of stencil entries
+   * @param[in] numConnectors the number of connectors the entries act across
+   *
+   * The entries are then filled with set(), concurrently if needed, and grouped with groupBySubRegion().
+   * This avoids growing the stencil one entry at a time with add() when the entries can be counted first.
+   */
+  void resize( localIndex const numConnections, localIndex const numConnectors );
+
+  /**
+   * @brief Set an entry of a stencil sized with resize().
+   * @param[in] index the index of the stencil entry
+   * @param[in] elementRegionIndices The element region indices for each point in the stencil entry
+   * @param[in] elementSubRegionIndices The element sub-region indices for each point in the stencil entry
+   * @param[in] elementIndices The element indices for each point in the stencil entry
+   * @param[in] weights The weights each point in the stencil entry
+   * @param[in] connectorIndex The index of the connector element that the stencil acts across
+   *
+   * Setting different entries is thread-safe.
+   */
+  void set( localIndex const index,
+            localIndex const * const elementRegionIndices,
+            localIndex const * const elementSubRegionIndices,
+            localIndex const * const elementIndices,
+            real64 const * const weights,
+            localIndex const connectorIndex );
+
+  /**
+   * @brief Group the entries set with set() by subregion, once they are all set.
+   */
+  void groupBySubRegion();
+
   /**
    * @brief Return the stencil size.
    * @return the stencil size
@@ -97,6 +166,44 @@ public:
     return MAX_STENCIL_SIZE;
   }
 
+  /**
+   * @brief Const access to the connections within a subregion, grouped by subregion.
+   * @return the connections of each subregion with connections
+   */
+  std::vector< SubRegionConnections > const & getSubRegionConnections() const
+  { return m_subRegionConnections; }
+
+  /**
+   * @brief Const access to the connections between two subregions.
+   * @return a view to const of the stencil indices of the connections
+   */
+  arrayView1d< localIndex const > getCrossSubRegionConnections() const
+  { return m_crossSubRegionConnections.toViewConst(); }
+
+  /**
+   * @brief Const access to the offset of each color in the connections between two subregions.
+   * @return a view to const of the offsets, empty if the stencil is not colored
+   */
+  arrayView1d< localIndex const > getCrossSubRegionColorOffsets() const
+  { return m_crossSubRegionColorOffsets.toViewConst(); }
+
+private:
+
+  /// The connections within a subregion, grouped by subregion
+  std::vector< SubRegionConnections > m_subRegionConnections;
+
+  /// The stencil indices of the connections between two subregions
+  array1d< localIndex > m_crossSubRegionConnections;
+
+  /// The offset of each color in m_crossSubRegionConnections, empty if the stencil is not colored
+  array1d< localIndex > m_crossSubRegionColorOffsets;
+
+  /// The group of m_subRegionConnections holding each stencil entry, -1 for the connections between two subregions
+  array1d< localIndex > m_connectionGroup;
+
+  /// The index of each stencil entry in its group
+  array1d< localIndex > m_connectionIndexInGroup;
+
 };
 
 } /* namespace geosx */
@@ -22,7 +22,10 @@ namespace geosx
 {
 
 FaceElementStencil::FaceElementStencil():
-  StencilBase< FaceElementStencil_Traits, FaceElementStencil >()
+  StencilBase< FaceElementStencil_Traits, FaceElementStencil >(),
+  m_cellCenterToEdgeCenters(),
+  m_revision( 0 ),
+  m_connectionRevisions()
 {}
 
 void FaceElementStencil::move( LvArray::MemorySpace const space )
@@ -40,19 +43,20 @@ void FaceElementStencil::add( localIndex const numPts,
 {
   GEOSX_ERROR_IF( numPts >= MAX_STENCIL_SIZE, "Maximum stencil size exceeded" );
 
-  typename decltype( m_connectorIndices )::iterator iter = m_connectorIndices.find( connectorIndex );
-  if( iter==m_connectorIndices.end() )
+  localIndex const stencilIndex = getConnectorEntry( connectorIndex );
+  if( stencilIndex < 0 )
   {
     m_elementRegionIndices.appendArray( elementRegionIndices, elementRegionIndices + numPts );
     m_elementSubRegionIndices.appendArray( elementSubRegionIndices, elementSubRegionIndices + numPts );
     m_elementIndices.appendArray( elementIndices, elementIndices + numPts );
     m_weights.appendArray( weights, weights + numPts );
 
-    m_connectorIndices[connectorIndex] = m_weights.size() - 1;
+    setConnectorEntry( connectorIndex, m_weights.size() - 1 );
+    m_connectionRevisions.emplace_back( ++m_revision );
   }
   else
   {
-    localIndex const stencilIndex = iter->second;
+    m_connectionRevisions[stencilIndex] = ++m_revision;
     m_elementRegionIndices.clearArray( stencilIndex );
     m_elementSubRegionIndices.clearArray( stencilIndex );
     m_elementIndices.clearArray( stencilIndex );
@@ -71,14 +75,13 @@ void FaceElementStencil::add( localIndex const numPts,
 {
   GEOSX_ERROR_IF( numPts >= MAX_STENCIL_SIZE, "Maximum stencil size exceeded" );
 
-  typename decltype( m_connectorIndices )::iterator iter = m_connectorIndices.find( connectorIndex );
-  if( iter==m_connectorIndices.end() )
+  localIndex const stencilIndex = getConnectorEntry( connectorIndex );
+  if( stencilIndex < 0 )
   {
     GEOSX_ERROR( "Wrong connectorIndex" );
   }
   else
   {
-    localIndex const stencilIndex = iter->second;
     if( stencilIndex < m_cellCenterToEdgeCenters.size())
     {
       m_cellCenterToEdgeCenters.clearArray( stencilIndex );
@@ -91,5 +94,17 @@ void FaceElementStencil::add( localIndex const numPts,
   }
 }
 
+array1d< localIndex > FaceElementStencil::getModifiedConnections( localIndex const sinceRevision ) const
+{
+  array1d< localIndex > modifiedConnections;
+  for( localIndex iconn = 0; iconn < m_connectionRevisions.size(); ++iconn )
+  {
+    if( m_connectionRevisions[iconn] > sinceRevision )
+    {
+      modifiedConnections.emplace_back( iconn );
+    }
+  }
+  return modifiedConnections;
+}
 
 } /* namespace geosx */
@@ -131,10 +131,33 @@ public:
   ArrayOfArraysView< R1Tensor const > getCellCenterToEdgeCenters() const
   { return m_cellCenterToEdgeCenters.toViewConst(); }
 
+  /**
+   * @brief Give the revision of the stencil, incremented each time an entry is added or overwritten.
+   * @return the revision of the stencil
+   */
+  localIndex revision() const
+  { return m_revision; }
+
+  /**
+   * @brief Give the entries added or overwritten after a revision of the stencil.
+   * @param[in] sinceRevision the revision after which the entries were modified, -1 for all the entries
+   * @return the indices of the modified entries
+   *
+   * The users of the stencil keep the revision they were set up for and only revisit the entries modified
+   * since then, that is the connections of the face elements created by the last fracture steps.
+   */
+  array1d< localIndex > getModifiedConnections( localIndex const sinceRevision ) const;
+
 private:
 
   ArrayOfArrays< R1Tensor > m_cellCenterToEdgeCenters;
 
+  /// The revision of the stencil
+  localIndex m_revision;
+
+  /// The revision at which each entry was last modified
+  array1d< localIndex > m_connectionRevisions;
+
 };
 
 } /* namespace geosx */
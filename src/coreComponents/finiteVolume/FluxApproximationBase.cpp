@@ -29,6 +29,7 @@ using namespace dataRepository;
 
 FluxApproximationBase::FluxApproximationBase( string const & name, Group * const parent )
   : Group( name, parent ),
+  m_coloredAssembly( 0 ),
   m_lengthScale( 1.0 )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
@@ -49,6 +50,12 @@ FluxApproximationBase::FluxApproximationBase( string const & name, Group * const
     setInputFlag( InputFlags::OPTIONAL )->
     setApplyDefaultValue( 1.0e-8 )->
     setDescription( "Relative tolerance for area calculations." );
+
+  registerWrapper( viewKeyStruct::coloredAssemblyString, &m_coloredAssembly )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Flag to assemble the fluxes color by color, the connections of a color sharing no cell, "
+                    "instead of with atomic additions. The residual is then reproducible from run to run." );
 }
 
 FluxApproximationBase::CatalogInterface::CatalogType &
@@ -135,4 +142,18 @@ void FluxApproximationBase::InitializePostInitialConditions_PreSubGroups( Group
   } );
 }
 
+void FluxApproximationBase::postRestartInitialization( Group * const domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  // the boundary stencils are not computed again, their entries would be added to the existing ones
+  domain->group_cast< DomainPartition * >()->getMeshBodies()->forSubGroups< MeshBody >( [&]( MeshBody & meshBody )
+  {
+    meshBody.forSubGroups< MeshLevel >( [&]( MeshLevel & mesh )
+    {
+      computeCellStencil( mesh );
+    } );
+  } );
+}
+
 } //namespace geosx
@@ -179,6 +179,8 @@ public:
     static constexpr auto targetRegionsString         = "targetRegions";
     /// The key for areaRelTol
     static constexpr auto areaRelativeToleranceString = "areaRelTol";
+    /// The key for coloredAssembly
+    static constexpr auto coloredAssemblyString       = "coloredAssembly";
     /// The key for transMultiplier
     static constexpr auto transMultiplierString       = "TransMultiplier";
 
@@ -215,6 +217,14 @@ protected:
 
   virtual void InitializePostInitialConditions_PreSubGroups( Group * const rootGroup ) override;
 
+  /**
+   * @brief Compute the cell stencils again, from the coefficients loaded from a restart file.
+   * @param domain the domain partition
+   *
+   * The coefficients may also have been given new initial conditions, see ProblemManager::RunEnsemble.
+   */
+  virtual void postRestartInitialization( Group * const domain ) override;
+
   /**
    * @brief Register the wrapper for cell stencil on a mesh.
    * @param stencilGroup the group holding the stencil objects
@@ -263,6 +273,9 @@ protected:
   /// relative tolerance
   real64 m_areaRelTol;
 
+  /// flag to color the cell stencil, so that the fluxes are assembled color by color instead of with atomics
+  integer m_coloredAssembly;
+
   /// length scale of the mesh body
   real64 m_lengthScale;
 
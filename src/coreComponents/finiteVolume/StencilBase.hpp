@@ -22,6 +22,10 @@
 #include "common/DataTypes.hpp"
 #include "codingUtilities/Utilities.hpp"
 
+#include <cstdint>
+#include <map>
+#include <vector>
+
 namespace geosx
 {
 
@@ -40,7 +44,10 @@ public:
     m_elementSubRegionIndices(),
     m_elementIndices(),
     m_weights(),
-    m_connectorIndices()
+    m_connectorIndices(),
+    m_connectionColors(),
+    m_coloredConnections(),
+    m_colorOffsets()
   {}
 
   /**
@@ -105,6 +112,28 @@ public:
    */
   virtual localIndex size() const = 0;
 
+  /**
+   * @brief Color the stencil entries such that two entries sharing an element never have the same color.
+   *
+   * The flux kernels then assemble the entries color by color without atomics, and the residual
+   * is summed in the same order from run to run. Adding entries discards the coloring.
+   */
+  virtual void computeColoring();
+
+  /**
+   * @brief Const access to the stencil entries sorted by color.
+   * @return A view to const of the entry indices, empty if the stencil is not colored
+   */
+  arrayView1d< localIndex const > getColoredConnections() const { return m_coloredConnections.toViewConst(); }
+
+  /**
+   * @brief Const access to the offset of each color in the entries sorted by color.
+   * @return A view to const of the offsets, of size the number of colors + 1, empty if the stencil is not colored
+   *
+   * The offsets are only accessed on the host, to launch the colors one by one.
+   */
+  arrayView1d< localIndex const > getColorOffsets() const { return m_colorOffsets.toViewConst(); }
+
   /**
    * @brief Set the name used in data movement logging callbacks.
    * @param name the name prefix for the stencil's data arrays
@@ -136,6 +165,31 @@ public:
   typename LEAFCLASSTRAITS::WeightContainerViewConstType getWeights() const { return m_weights.toViewConst(); }
 
 protected:
+
+  /**
+   * @brief Record the stencil entry acting across a connector.
+   * @param[in] connectorIndex the index of the connector
+   * @param[in] entryIndex the index of the stencil entry
+   */
+  void setConnectorEntry( localIndex const connectorIndex, localIndex const entryIndex )
+  {
+    if( connectorIndex >= m_connectorIndices.size() )
+    {
+      m_connectorIndices.resizeDefault( connectorIndex + 1, -1 );
+    }
+    m_connectorIndices[connectorIndex] = entryIndex;
+  }
+
+  /**
+   * @brief Get the stencil entry acting across a connector.
+   * @param[in] connectorIndex the index of the connector
+   * @return the index of the stencil entry, -1 if no entry acts across the connector
+   */
+  localIndex getConnectorEntry( localIndex const connectorIndex ) const
+  {
+    return connectorIndex < m_connectorIndices.size() ? m_connectorIndices[connectorIndex] : -1;
+  }
+
   /// The container for the element region indices for each point in each stencil
   typename LEAFCLASSTRAITS::IndexContainerType m_elementRegionIndices;
 
@@ -148,8 +202,17 @@ protected:
   /// The container for the weights for each point in each stencil
   typename LEAFCLASSTRAITS::WeightContainerType m_weights;
 
-  /// The map that provides the stencil index given the index of the underlying connector object.
-  map< localIndex, localIndex > m_connectorIndices;
+  /// The stencil index of each underlying connector object, -1 for the connectors without an entry.
+  array1d< localIndex > m_connectorIndices;
+
+  /// The color of each stencil entry, empty if the stencil is not colored
+  array1d< integer > m_connectionColors;
+
+  /// The stencil entries sorted by color
+  array1d< localIndex > m_coloredConnections;
+
+  /// The offset of each color in m_coloredConnections
+  array1d< localIndex > m_colorOffsets;
 
 };
 
@@ -168,14 +231,80 @@ void StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::reserve( localIndex const size )
 template< typename LEAFCLASSTRAITS, typename LEAFCLASS >
 bool StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::zero( localIndex const connectorIndex )
 {
-  return
-    executeOnMapValue( m_connectorIndices, connectorIndex, [&]( localIndex const connectionListIndex )
+  localIndex const connectionListIndex = getConnectorEntry( connectorIndex );
+  if( connectionListIndex < 0 )
+  {
+    return false;
+  }
+
+  for( localIndex i = 0; i < static_cast< LEAFCLASS * >(this)->stencilSize( connectionListIndex ); ++i )
+  {
+    m_weights[connectionListIndex][i] = 0;
+  }
+  return true;
+}
+
+template< typename LEAFCLASSTRAITS, typename LEAFCLASS >
+void StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::computeColoring()
+{
+  localIndex const numConnections = size();
+
+  // Greedy coloring: each entry takes the smallest color not used by an entry sharing one of its elements.
+  // The colors used by the entries of an element are flagged in a mask, the elements of a subregion
+  // being indexed by their element index.
+  std::map< std::pair< localIndex, localIndex >, std::vector< std::uint64_t > > usedColors;
+  m_connectionColors.resize( numConnections );
+  integer numColors = 0;
+  for( localIndex iconn = 0; iconn < numConnections; ++iconn )
   {
-    for( localIndex i = 0; i < static_cast< LEAFCLASS * >(this)->stencilSize( connectorIndex ); ++i )
+    localIndex const numPts = static_cast< LEAFCLASS * >(this)->stencilSize( iconn );
+    std::uint64_t used = 0;
+    for( localIndex a = 0; a < numPts; ++a )
     {
-      m_weights[connectionListIndex][i] = 0;
+      std::vector< std::uint64_t > & masks = usedColors[ { m_elementRegionIndices[iconn][a], m_elementSubRegionIndices[iconn][a] } ];
+      localIndex const ei = m_elementIndices[iconn][a];
+      if( ei >= LvArray::integerConversion< localIndex >( masks.size() ) )
+      {
+        masks.resize( ei + 1, 0 );
+      }
+      used |= masks[ei];
     }
-  } );
+
+    integer color = 0;
+    while( color < 64 && ( used & ( std::uint64_t( 1 ) << color ) ) )
+    {
+      ++color;
+    }
+    GEOSX_ERROR_IF_GE_MSG( color, 64, "Too many stencil entries share an element to color the stencil" );
+
+    for( localIndex a = 0; a < numPts; ++a )
+    {
+      usedColors[ { m_elementRegionIndices[iconn][a], m_elementSubRegionIndices[iconn][a] } ][ m_elementIndices[iconn][a] ] |=
+        std::uint64_t( 1 ) << color;
+    }
+    m_connectionColors[iconn] = color;
+    numColors = std::max( numColors, color + 1 );
+  }
+
+  // Counting sort, stable so that the entries of a color keep their index order
+  m_colorOffsets.resize( numColors + 1 );
+  m_colorOffsets.setValues< serialPolicy >( 0 );
+  for( localIndex iconn = 0; iconn < numConnections; ++iconn )
+  {
+    ++m_colorOffsets[ m_connectionColors[iconn] + 1 ];
+  }
+  for( integer c = 0; c < numColors; ++c )
+  {
+    m_colorOffsets[ c + 1 ] += m_colorOffsets[ c ];
+  }
+
+  array1d< localIndex > colorFill( numColors );
+  m_coloredConnections.resize( numConnections );
+  for( localIndex iconn = 0; iconn < numConnections; ++iconn )
+  {
+    integer const color = m_connectionColors[iconn];
+    m_coloredConnections[ m_colorOffsets[ color ] + colorFill[ color ]++ ] = iconn;
+  }
 }
 
 template< typename LEAFCLASSTRAITS, typename LEAFCLASS >
@@ -185,6 +314,7 @@ void StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::setName( string const & name )
   m_elementSubRegionIndices.setName( name + "/elementSubRegionIndices" );
   m_elementIndices.setName( name + "/elementIndices" );
   m_weights.setName( name + "/weights" );
+  m_coloredConnections.setName( name + "/coloredConnections" );
 }
 
 template< typename LEAFCLASSTRAITS, typename LEAFCLASS >
@@ -194,6 +324,7 @@ void StencilBase< LEAFCLASSTRAITS, LEAFCLASS >::move( LvArray::MemorySpace const
   m_elementSubRegionIndices.move( space, true );
   m_elementIndices.move( space, true );
   m_weights.move( space, true );
+  m_coloredConnections.move( space, true );
 }
 
 
@@ -19,6 +19,7 @@
 #include "TwoPointFluxApproximation.hpp"
 
 #include "codingUtilities/Utilities.hpp"
+#include "common/TimingMacros.hpp"
 #include "finiteVolume/BoundaryStencil.hpp"
 #include "finiteVolume/CellElementStencilTPFA.hpp"
 #include "finiteVolume/FaceElementStencil.hpp"
@@ -90,14 +91,22 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
     regionFilter.insert( elemManager.GetRegions().getIndex( regionName ) );
   }
 
-  stencil.reserve( faceManager.size() );
-
   real64 const lengthTolerance = m_lengthScale * m_areaRelTol;
   real64 const areaTolerance = lengthTolerance * lengthTolerance;
   real64 const weightTolerance = 1e-30 * lengthTolerance; // TODO: choice of constant based on physics?
 
-  forAll< serialPolicy >( faceManager.size(), [=, &stencil]( localIndex const kf )
+  localIndex const numFaces = faceManager.size();
+
+  // The stencil is built in two passes over the faces. The first one computes the weight of each face
+  // and flags the faces with a connection, whose offsets in the stencil are then given by a prefix sum.
+  // The second one fills the exactly allocated stencil.
+  array1d< real64 > faceWeights( numFaces );
+  array1d< localIndex > connectionOffsets( numFaces + 1 );
+
+  forAll< parallelHostPolicy >( numFaces, [=, &faceWeights, &connectionOffsets]( localIndex const kf )
   {
+    connectionOffsets[kf + 1] = 0;
+
     // Filter out boundary faces
     if( elemList[kf][0] < 0 || elemList[kf][1] < 0 || isZero( transMultiplier[kf] ) )
     {
@@ -125,12 +134,6 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
       return;
     }
 
-    stackArray1d< localIndex, 2 > regionIndex( 2 );
-    stackArray1d< localIndex, 2 > subRegionIndex( 2 );
-    stackArray1d< localIndex, 2 > elementIndex( 2 );
-    stackArray1d< real64, 2 > stencilWeights( 2 );
-    stackArray1d< globalIndex, 2 > stencilCellsGlobalIndex( 2 );
-
     real64 faceWeight = 0.0;
 
     for( localIndex ke = 0; ke < 2; ++ke )
@@ -139,11 +142,6 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
       localIndex const esr = elemSubRegionList[kf][ke];
       localIndex const ei  = elemList[kf][ke];
 
-      regionIndex[ke] = er;
-      subRegionIndex[ke] = esr;
-      elementIndex[ke] = ei;
-      stencilCellsGlobalIndex[ke] = elemGlobalIndex[er][esr][ei];
-
       LvArray::tensorOps::copy< 3 >( cellToFaceVec, faceCenter );
       LvArray::tensorOps::subtract< 3 >( cellToFaceVec, elemCenter[er][esr][ei] );
 
@@ -171,11 +169,33 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
     }
 
     GEOSX_ASSERT( faceWeight > 0.0 );
-    faceWeight = 1.0 / faceWeight;
+    faceWeights[kf] = transMultiplier[kf] / faceWeight;
+    connectionOffsets[kf + 1] = 1;
+  } );
+
+  connectionOffsets[0] = 0;
+  RAJA::inclusive_scan_inplace< parallelHostPolicy >( connectionOffsets.begin(), connectionOffsets.end() );
+
+  stencil.resize( connectionOffsets[numFaces], numFaces );
+
+  forAll< parallelHostPolicy >( numFaces, [=, &stencil, &faceWeights, &connectionOffsets]( localIndex const kf )
+  {
+    if( connectionOffsets[kf + 1] == connectionOffsets[kf] )
+    {
+      return;
+    }
+
+    localIndex regionIndex[ 2 ], subRegionIndex[ 2 ], elementIndex[ 2 ];
+    real64 stencilWeights[ 2 ];
+    globalIndex stencilCellsGlobalIndex[ 2 ];
 
     for( localIndex ke = 0; ke < 2; ++ke )
     {
-      stencilWeights[ke] = transMultiplier[kf] * faceWeight * (ke == 0 ? 1 : -1);
+      regionIndex[ke] = elemRegionList[kf][ke];
+      subRegionIndex[ke] = elemSubRegionList[kf][ke];
+      elementIndex[ke] = elemList[kf][ke];
+      stencilCellsGlobalIndex[ke] = elemGlobalIndex[regionIndex[ke]][subRegionIndex[ke]][elementIndex[ke]];
+      stencilWeights[ke] = faceWeights[kf] * (ke == 0 ? 1 : -1);
     }
 
     // Ensure elements are added to stencil in order of global indices
@@ -186,13 +206,20 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
       std::swap( elementIndex[0], elementIndex[1] );
     }
 
-    stencil.add( 2,
-                 regionIndex.data(),
-                 subRegionIndex.data(),
-                 elementIndex.data(),
-                 stencilWeights.data(),
+    stencil.set( connectionOffsets[kf],
+                 regionIndex,
+                 subRegionIndex,
+                 elementIndex,
+                 stencilWeights,
                  kf );
   } );
+
+  stencil.groupBySubRegion();
+
+  if( m_coloredAssembly )
+  {
+    stencil.computeColoring();
+  }
 }
 
 void TwoPointFluxApproximation::registerFractureStencil( Group & stencilGroup ) const
@@ -205,6 +232,8 @@ void TwoPointFluxApproximation::addToFractureStencil( MeshLevel & mesh,
                                                       string const & faceElementRegionName,
                                                       bool const initFlag ) const
 {
+  GEOSX_MARK_FUNCTION;
+
   NodeManager * const nodeManager = mesh.getNodeManager();
   EdgeManager const * const edgeManager = mesh.getEdgeManager();
   FaceManager const * const faceManager = mesh.getFaceManager();
@@ -608,6 +637,11 @@ void TwoPointFluxApproximation::addToFractureStencil( MeshLevel & mesh,
       }
     } );
   }
+
+  if( m_coloredAssembly )
+  {
+    cellStencil.computeColoring();
+  }
 }
 
 void TwoPointFluxApproximation::addEDFracToFractureStencil( MeshLevel & mesh,
@@ -756,6 +790,11 @@ void TwoPointFluxApproximation::addEDFracToFractureStencil( MeshLevel & mesh,
       connectorIndex++;
     }
   }
+
+  if( m_coloredAssembly )
+  {
+    cellStencil.computeColoring();
+  }
 }
 
 void TwoPointFluxApproximation::registerBoundaryStencil( Group & stencilGroup, string const & setName ) const
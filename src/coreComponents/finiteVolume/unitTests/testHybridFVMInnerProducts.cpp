@@ -55,16 +55,17 @@ void computeVolumeAndCenter( array2d< real64, nodes::REFERENCE_POSITION_PERM > c
                              real64 & elemVolume )
 {
   localIndex const numNodes = toNodes.size();
-  R1Tensor Xlocal[10];
+  real64 Xlocal[10][3];
   elemCenter( 0 ) = 0;
   elemCenter( 1 ) = 0;
   elemCenter( 2 ) = 0;
   for( localIndex a = 0; a < numNodes; ++a )
   {
-    Xlocal[a][0] = nodePosition( toNodes( a ), 0 );
-    Xlocal[a][1] = nodePosition( toNodes( a ), 1 );
-    Xlocal[a][2] = nodePosition( toNodes( a ), 2 );
-    elemCenter += Xlocal[a];
+    for( localIndex d = 0; d < 3; ++d )
+    {
+      Xlocal[a][d] = nodePosition( toNodes( a ), d );
+      elemCenter( d ) += Xlocal[a][d];
+    }
   }
   elemCenter /= numNodes;
 
@@ -14,6 +14,8 @@
 
 // Source includes
 #include "managers/initialization.hpp"
+#include "finiteVolume/CellElementStencilMPFA.hpp"
+#include "finiteVolume/CellElementStencilTPFA.hpp"
 #include "finiteVolume/FluxStencil.hpp"
 #include "rajaInterface/GEOS_RAJA_Interface.hpp"
 
@@ -23,6 +25,7 @@
 // System includes
 #include <chrono>
 #include <iostream>
+#include <set>
 
 #define TEST_SIZE 1000000
 
@@ -103,6 +106,180 @@ TEST( testStencilCollection, noAcessorIterationTPFA )
   } );
 }
 
+TEST( testStencilCollection, cellStencilTPFASubRegionConnections )
+{
+  CellElementStencilTPFA stencil;
+
+  // Connections within subregion (0,0), within subregion (1,0), and between the two
+  localIndex const regions[4][2] = { { 0, 0 }, { 1, 1 }, { 0, 1 }, { 0, 0 } };
+  localIndex const elements[4][2] = { { 0, 1 }, { 2, 3 }, { 1, 2 }, { 1, 4 } };
+  for( localIndex iconn = 0; iconn < 4; ++iconn )
+  {
+    localIndex const subRegions[2] = { 0, 0 };
+    real64 const weights[2] = { 1.0 + iconn, -1.0 - iconn };
+    stencil.add( 2, regions[iconn], subRegions, elements[iconn], weights, 10 + iconn );
+  }
+
+  ASSERT_EQ( stencil.size(), 4 );
+  std::vector< CellElementStencilTPFA::SubRegionConnections > const & connections = stencil.getSubRegionConnections();
+  ASSERT_EQ( connections.size(), 2 );
+
+  EXPECT_EQ( connections[0].regionIndex, 0 );
+  ASSERT_EQ( connections[0].elementIndices.size( 0 ), 2 );
+  EXPECT_EQ( connections[0].elementIndices( 1, 0 ), 1 );
+  EXPECT_EQ( connections[0].elementIndices( 1, 1 ), 4 );
+  EXPECT_EQ( connections[0].weights( 1, 0 ), 4.0 );
+
+  EXPECT_EQ( connections[1].regionIndex, 1 );
+  ASSERT_EQ( connections[1].elementIndices.size( 0 ), 1 );
+  EXPECT_EQ( connections[1].elementIndices( 0, 0 ), 2 );
+
+  arrayView1d< localIndex const > const crossConnections = stencil.getCrossSubRegionConnections();
+  ASSERT_EQ( crossConnections.size(), 1 );
+  EXPECT_EQ( crossConnections[0], 2 );
+
+  // Zeroing a connection zeroes its copy in the subregion connections
+  EXPECT_TRUE( stencil.zero( 13 ) );
+  EXPECT_EQ( stencil.getWeights()( 3, 0 ), 0.0 );
+  EXPECT_EQ( connections[0].weights( 1, 0 ), 0.0 );
+  EXPECT_EQ( connections[0].weights( 1, 1 ), 0.0 );
+  EXPECT_EQ( connections[0].weights( 0, 0 ), 1.0 );
+}
+
+TEST( testStencilCollection, cellStencilTPFAPreallocated )
+{
+  // The same connections as above, set out of order in a preallocated stencil
+  CellElementStencilTPFA stencil;
+  stencil.resize( 4, 20 );
+
+  localIndex const regions[4][2] = { { 0, 0 }, { 1, 1 }, { 0, 1 }, { 0, 0 } };
+  localIndex const elements[4][2] = { { 0, 1 }, { 2, 3 }, { 1, 2 }, { 1, 4 } };
+  for( localIndex iconn = 3; iconn >= 0; --iconn )
+  {
+    localIndex const subRegions[2] = { 0, 0 };
+    real64 const weights[2] = { 1.0 + iconn, -1.0 - iconn };
+    stencil.set( iconn, regions[iconn], subRegions, elements[iconn], weights, 10 + iconn );
+  }
+  stencil.groupBySubRegion();
+
+  ASSERT_EQ( stencil.size(), 4 );
+  std::vector< CellElementStencilTPFA::SubRegionConnections > const & connections = stencil.getSubRegionConnections();
+  ASSERT_EQ( connections.size(), 2 );
+  ASSERT_EQ( connections[0].elementIndices.size( 0 ), 2 );
+  EXPECT_EQ( connections[0].elementIndices( 1, 1 ), 4 );
+  EXPECT_EQ( connections[0].weights( 1, 0 ), 4.0 );
+  ASSERT_EQ( connections[1].elementIndices.size( 0 ), 1 );
+  ASSERT_EQ( stencil.getCrossSubRegionConnections().size(), 1 );
+  EXPECT_EQ( stencil.getCrossSubRegionConnections()[0], 2 );
+
+  // Only the connectors that were set have an entry
+  EXPECT_FALSE( stencil.zero( 5 ) );
+  EXPECT_FALSE( stencil.zero( 25 ) );
+  EXPECT_TRUE( stencil.zero( 13 ) );
+  EXPECT_EQ( connections[0].weights( 1, 0 ), 0.0 );
+}
+
+TEST( testStencilCollection, cellStencilTPFAColoring )
+{
+  // A chain of cells in subregion (0,0), each also connected to a cell of subregion (1,0)
+  CellElementStencilTPFA stencil;
+  localIndex constexpr numCells = 10;
+  for( localIndex iconn = 0; iconn < 2 * numCells - 1; ++iconn )
+  {
+    bool const cross = iconn >= numCells - 1;
+    localIndex const regions[2] = { 0, cross ? 1 : 0 };
+    localIndex const subRegions[2] = { 0, 0 };
+    localIndex const elements[2] = { cross ? iconn - numCells + 1 : iconn, cross ? iconn : iconn + 1 };
+    real64 const weights[2] = { 1.0, -1.0 };
+    stencil.add( 2, regions, subRegions, elements, weights, iconn );
+  }
+  EXPECT_TRUE( stencil.getColorOffsets().empty() );
+
+  stencil.computeColoring();
+
+  arrayView1d< localIndex const > const colorOffsets = stencil.getColorOffsets();
+  arrayView1d< localIndex const > const coloredConnections = stencil.getColoredConnections();
+  ASSERT_GE( colorOffsets.size(), 2 );
+  EXPECT_EQ( colorOffsets[colorOffsets.size() - 1], stencil.size() );
+
+  // The connections of a color share no cell
+  arrayView2d< localIndex const > const seri = stencil.getElementRegionIndices();
+  arrayView2d< localIndex const > const sei = stencil.getElementIndices();
+  for( localIndex color = 0; color < colorOffsets.size() - 1; ++color )
+  {
+    std::set< std::pair< localIndex, localIndex > > cells;
+    for( localIndex i = colorOffsets[color]; i < colorOffsets[color + 1]; ++i )
+    {
+      for( localIndex a = 0; a < 2; ++a )
+      {
+        EXPECT_TRUE( cells.insert( { seri( coloredConnections[i], a ), sei( coloredConnections[i], a ) } ).second );
+      }
+    }
+  }
+
+  // The connections within the subregion are sorted by color
+  CellElementStencilTPFA::SubRegionConnections const & connections = stencil.getSubRegionConnections()[0];
+  ASSERT_EQ( connections.colorOffsets.size(), colorOffsets.size() );
+  EXPECT_EQ( connections.colorOffsets[connections.colorOffsets.size() - 1], numCells - 1 );
+  for( localIndex color = 0; color < connections.colorOffsets.size() - 1; ++color )
+  {
+    for( localIndex i = connections.colorOffsets[color] + 1; i < connections.colorOffsets[color + 1]; ++i )
+    {
+      EXPECT_NE( connections.elementIndices( i, 0 ), connections.elementIndices( i - 1, 1 ) );
+    }
+  }
+  EXPECT_EQ( stencil.getCrossSubRegionColorOffsets()[colorOffsets.size() - 1], numCells );
+}
+
+TEST( testStencilCollection, cellStencilMPFASizeBins )
+{
+  CellElementStencilMPFA stencil;
+
+  // Entries of 7, 4, 17 and 6 points, binned as 8, 6, 18 and 6
+  localIndex const numPts[4] = { 7, 4, 17, 6 };
+  localIndex indices[CellElementStencilMPFA::MAX_STENCIL_SIZE];
+  real64 weights[CellElementStencilMPFA::MAX_STENCIL_SIZE];
+  for( localIndex i = 0; i < CellElementStencilMPFA::MAX_STENCIL_SIZE; ++i )
+  {
+    indices[i] = i;
+    weights[i] = 1.0;
+  }
+  localIndex const zeros[CellElementStencilMPFA::MAX_STENCIL_SIZE] = {};
+  for( localIndex iconn = 0; iconn < 4; ++iconn )
+  {
+    stencil.add( numPts[iconn], zeros, zeros, indices, weights, iconn );
+  }
+  stencil.groupBySize();
+
+  arrayView1d< localIndex const > const offsets = stencil.getSizeBinOffsets();
+  ASSERT_EQ( offsets.size(), CellElementStencilMPFA::NUM_SIZE_BINS + 1 );
+  EXPECT_EQ( offsets[1], 2 );
+  EXPECT_EQ( offsets[2], 3 );
+  EXPECT_EQ( offsets[3], 3 );
+  EXPECT_EQ( offsets[4], 4 );
+
+  // Each bin is visited once with its stencil size, and holds entries no larger than it
+  std::set< localIndex > visited;
+  stencil.forSizeBins( [&]( auto const binSize, arrayView1d< localIndex const > const & connections,
+                            localIndex const begin, localIndex const end )
+  {
+    localIndex constexpr STENCIL_SIZE = decltype( binSize )::value;
+    stackArray1d< real64, STENCIL_SIZE > localWeights( STENCIL_SIZE );
+    EXPECT_TRUE( visited.insert( STENCIL_SIZE ).second );
+    for( localIndex i = begin; i < end; ++i )
+    {
+      EXPECT_LE( stencil.stencilSize( connections[i] ), localWeights.size() );
+    }
+  } );
+  EXPECT_EQ( visited, ( std::set< localIndex >{ 6, 8, 18 } ) );
+
+  arrayView1d< localIndex const > const binned = stencil.getSizeBinnedConnections();
+  EXPECT_EQ( binned[0], 1 );
+  EXPECT_EQ( binned[1], 3 );
+  EXPECT_EQ( binned[2], 0 );
+  EXPECT_EQ( binned[3], 2 );
+}
+
 int main( int argc, char * argv[] )
 {
   geosx::basicSetup( argc, argv );
@@ -27,6 +27,8 @@
 
 #include "DofManagerHelpers.hpp"
 
+#include <algorithm>
+#include <functional>
 #include <numeric>
 
 namespace geosx
@@ -38,7 +40,11 @@ DofManager::DofManager( string name )
   : m_name( std::move( name ) ),
   m_domain( nullptr ),
   m_mesh( nullptr ),
-  m_reordered( false )
+  m_reordered( false ),
+  m_ordering( LinearSolverParameters::DofOrdering::fieldWise ),
+  m_contiguousFields( true ),
+  m_layoutFingerprint( 0 ),
+  m_layoutChanged( true )
 {
   initializeDataStructure();
 }
@@ -66,6 +72,8 @@ void DofManager::clear()
   initializeDataStructure();
 
   m_reordered = false;
+  m_ordering = LinearSolverParameters::DofOrdering::fieldWise;
+  m_contiguousFields = true;
 }
 
 void DofManager::setMesh( DomainPartition & domain,
@@ -144,37 +152,31 @@ array1d< localIndex > DofManager::numLocalDofsPerField() const
 
 array1d< localIndex > DofManager::getLocalDofComponentLabels() const
 {
-  array1d< localIndex > ret;
-  if( m_fields.size() > 0 )
+  GEOSX_ERROR_IF( !m_reordered, "Cannot label the DOF components before reorderByRank() has been called." );
+
+  // the labels follow the index arrays, so that they hold for any local ordering
+  array1d< localIndex > ret( numLocalDofs() );
+  globalIndex const rankDofOffset = rankOffset();
+  localIndex firstLabel = 0;
+  for( FieldDescription const & field : m_fields )
   {
-    localIndex numTotalLocalDof = std::accumulate( m_fields.begin(), m_fields.end(), 0,
-                                                   []( localIndex const & n, FieldDescription const & f ) { return n + f.numLocalDof; } );
+    LocationSwitch( field.location, [&]( auto const loc )
+    {
+      Location constexpr LOC = decltype(loc)::value;
+      using ArrayHelper = IndexArrayHelper< globalIndex, LOC >;
 
-    ret.resize( numTotalLocalDof );
+      typename ArrayHelper::Accessor indexArray = ArrayHelper::get( m_mesh, field.key );
 
-    localIndex firstLabel = 0;
-    localIndex istr= 0;
-    localIndex iend;
-    localIndex numComp;
-    for( const auto & field : m_fields )
-    {
-      numComp = field.numComponents;
-      array1d< localIndex > vectorLabels( numComp );
-      for( localIndex k = 0; k < numComp; ++k )
-      {
-        vectorLabels[k] = k + firstLabel;
-      }
-      iend = istr + field.numLocalDof;
-      for( localIndex i = istr; i < iend; i += numComp )
+      forMeshLocation< LOC, false >( m_mesh, field.regions, [&]( auto const locIdx )
       {
-        for( localIndex k = 0; k < numComp; ++k )
+        globalIndex const dof = ArrayHelper::reference( indexArray, locIdx );
+        for( localIndex c = 0; c < field.numComponents; ++c )
         {
-          ret[i+k] = vectorLabels[k];
+          ret[dof - rankDofOffset + c] = firstLabel + c;
         }
-      }
-      istr += iend;
-      firstLabel += numComp;
-    }
+      } );
+    } );
+    firstLabel += field.numComponents;
   }
   return ret;
 }
@@ -220,6 +222,21 @@ array1d< localIndex > DofManager::numComponentsPerField() const
   return ret;
 }
 
+localIndex DofManager::blockSize() const
+{
+  return ( m_fields.size() == 1 ) ? m_fields[0].numComponents : 1;
+}
+
+array1d< string > DofManager::fieldNames() const
+{
+  array1d< string > ret;
+  for( const auto & field : m_fields )
+  {
+    ret.emplace_back( field.name );
+  }
+  return ret;
+}
+
 localIndex DofManager::numLocalSupport( string const & fieldName ) const
 {
   FieldDescription const & field = m_fields[getFieldIndex( fieldName )];
@@ -737,9 +754,92 @@ void DofManager::setSparsityPattern( MATRIX & matrix,
   }
 }
 
+namespace
+{
+
+/**
+ * @brief Insert the couplings of a list of connectors into a sparsity pattern.
+ * @tparam POLICY the execution policy of the kernels
+ * @param connRowDofs the sorted row DOF indices of each connector
+ * @param connColDofs the sorted column DOF indices of each connector
+ * @param rankDofOffset the global index of the first local row
+ * @param pattern the pattern, with enough capacity in each local row
+ *
+ * The connectors are first inverted into the connectors of each local row, by counting them and then
+ * filling the lists, so that each row is then filled by a single thread without any atomic update of
+ * the pattern. The pattern is moved back to the host once filled.
+ */
+template< typename POLICY >
+void insertConnectorCouplings( SparsityPatternView< globalIndex const > const & connRowDofs,
+                               SparsityPatternView< globalIndex const > const & connColDofs,
+                               globalIndex const rankDofOffset,
+                               SparsityPatternView< globalIndex > const & pattern )
+{
+  GEOSX_MARK_FUNCTION;
+  GEOSX_ASSERT_EQ( connRowDofs.numRows(), connColDofs.numRows() );
+
+  localIndex const numConnectors = connRowDofs.numRows();
+  localIndex const numLocalRows = pattern.numRows();
+
+  // 1. Count the connectors of each local row
+  array1d< localIndex > rowNumConnectors( numLocalRows );
+  {
+    arrayView1d< localIndex > const numConnectorsView = rowNumConnectors.toView();
+    forAll< POLICY >( numConnectors, [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+    {
+      for( globalIndex const dof : connRowDofs.getColumns( iconn ) )
+      {
+        localIndex const localRow = LvArray::integerConversion< localIndex >( dof - rankDofOffset );
+        if( localRow >= 0 && localRow < numLocalRows )
+        {
+          RAJA::atomicAdd( AtomicPolicy< POLICY >{}, &numConnectorsView[localRow], localIndex( 1 ) );
+        }
+      }
+    } );
+  }
+
+  // 2. List the connectors of each local row
+  rowNumConnectors.move( LvArray::MemorySpace::CPU, false );
+  ArrayOfArrays< localIndex > rowConnectors;
+  rowConnectors.resizeFromCapacities< parallelHostPolicy >( numLocalRows, rowNumConnectors.data() );
+  {
+    ArrayOfArraysView< localIndex > const rowConnectorsView = rowConnectors.toView();
+    forAll< POLICY >( numConnectors, [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+    {
+      for( globalIndex const dof : connRowDofs.getColumns( iconn ) )
+      {
+        localIndex const localRow = LvArray::integerConversion< localIndex >( dof - rankDofOffset );
+        if( localRow >= 0 && localRow < numLocalRows )
+        {
+          rowConnectorsView.emplaceBackAtomic< AtomicPolicy< POLICY > >( localRow, iconn );
+        }
+      }
+    } );
+  }
+
+  // 3. Fill each row with the sorted columns of its connectors
+  {
+    ArrayOfArraysView< localIndex const > const rowConnectorsView = rowConnectors.toViewConst();
+    forAll< POLICY >( numLocalRows, [=] GEOSX_HOST_DEVICE ( localIndex const localRow )
+    {
+      for( localIndex const iconn : rowConnectorsView[localRow] )
+      {
+        globalIndex const * const cols = connColDofs.getColumns( iconn ).dataIfContiguous();
+        pattern.insertNonZeros( localRow, cols, cols + connColDofs.numNonZeros( iconn ) );
+      }
+    } );
+  }
+
+  pattern.move( LvArray::MemorySpace::CPU, true );
+}
+
+} // namespace
+
 void DofManager::setSparsityPatternFromStencil( SparsityPattern< globalIndex > & pattern,
                                                 localIndex const fieldIndex ) const
 {
+  GEOSX_MARK_FUNCTION;
+
   FieldDescription const & field = m_fields[fieldIndex];
   CouplingDescription const & coupling = m_coupling[fieldIndex][fieldIndex];
   localIndex const NC = field.numComponents;
@@ -747,60 +847,47 @@ void DofManager::setSparsityPatternFromStencil( SparsityPattern< globalIndex > &
 
   ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > dofNumber =
     m_mesh->getElemManager()->ConstructViewAccessor< array1d< globalIndex >, arrayView1d< globalIndex const > >( field.key );
-
-  array1d< globalIndex > rowDofIndices( NC );
-  array1d< globalIndex > colDofIndices( NC );
+  ElementRegionManager::ElementViewConst< arrayView1d< globalIndex const > > const dofNumberView = dofNumber.toNestedViewConst();
 
   // 1. Assemble diagonal and off-diagonal blocks for elements in stencil
   coupling.stencils->forAllStencils( *m_mesh, [&]( auto const & stencil )
   {
     using StenciType = typename std::decay< decltype( stencil ) >::type;
-    constexpr localIndex maxNumFluxElems = StenciType::NUM_POINT_IN_FLUX;
-    constexpr localIndex maxStencilSize = StenciType::MAX_STENCIL_SIZE;
 
     typename StenciType::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
     typename StenciType::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
     typename StenciType::IndexContainerViewConstType const & sei = stencil.getElementIndices();
 
-    rowDofIndices.reserve( maxNumFluxElems );
-    colDofIndices.reserve( maxStencilSize * NC );
-
-    forAll< serialPolicy >( stencil.size(), [&]( localIndex const iconn )
+    // Build the stencil-to-DOF map, every DOF of a connection couples with all the others
+    // This weirdness is because of fracture stencils, which don't have separate
+    // getters for num flux elems vs stencil size... it won't work for MPFA though
+    localIndex const numConnections = stencil.size();
+    array1d< localIndex > connNumDofs( numConnections );
+    forAll< parallelHostPolicy >( numConnections, [&]( localIndex const iconn )
     {
-      // This weirdness is because of fracture stencils, which don't have separate
-      // getters for num flux elems vs stencil size... it won't work for MPFA though
-      localIndex const numFluxElems = stencil.stencilSize( iconn );
-      localIndex const stencilSize = numFluxElems;
-
-      rowDofIndices.resize( numFluxElems );
-      for( localIndex i = 0; i < numFluxElems; ++i )
-      {
-        rowDofIndices[i] = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
-      }
+      connNumDofs[iconn] = stencil.stencilSize( iconn ) * NC;
+    } );
 
-      colDofIndices.resize( stencilSize * NC );
-      for( localIndex i = 0; i < stencilSize; ++i )
+    SparsityPattern< globalIndex > connDofs;
+    connDofs.resizeFromRowCapacities< parallelHostPolicy >( numConnections, numGlobalDofs(), connNumDofs.data() );
+    SparsityPatternView< globalIndex > const connDofsView = connDofs.toView();
+    arrayView1d< localIndex const > const connNumDofsView = connNumDofs.toViewConst();
+    forAll< parallelHostPolicy >( numConnections, [=]( localIndex const iconn )
+    {
+      for( localIndex i = 0; i < connNumDofsView[iconn] / NC; ++i )
       {
+        globalIndex const elemDof = dofNumberView[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
         for( localIndex c = 0; c < NC; ++c )
         {
-          colDofIndices[i * NC + c] = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] + c;
-        }
-      }
-
-      std::sort( colDofIndices.begin(), colDofIndices.end() );
-
-      for( localIndex i = 0; i < numFluxElems; ++i )
-      {
-        localIndex const localDofNumber = rowDofIndices[i] - rankDofOffset;
-        if( localDofNumber >= 0 && localDofNumber < pattern.numRows() )
-        {
-          for( localIndex c = 0; c < NC; ++c )
-          {
-            pattern.insertNonZeros( localDofNumber + c, colDofIndices.begin(), colDofIndices.end() );
-          }
+          connDofsView.insertNonZero( iconn, elemDof + c );
         }
       }
     } );
+
+    insertConnectorCouplings< parallelDevicePolicy<> >( connDofs.toViewConst(),
+                                                        connDofs.toViewConst(),
+                                                        rankDofOffset,
+                                                        pattern.toView() );
   } );
 
   // 2. Insert diagonal blocks, in case there are elements not included in stencil
@@ -1013,7 +1100,6 @@ void DofManager::setSparsityPatternOneBlock( SparsityPattern< globalIndex > & pa
 
   SparsityPattern< globalIndex > connLocRow( 0, 0, 0 ), connLocCol( 0, 0, 0 );
 
-  localIndex maxDofRow = 0;
   LocationSwitch( rowField.location, static_cast< Location >( conn ),
                   [&]( auto const locType, auto const connType )
   {
@@ -1024,17 +1110,9 @@ void DofManager::setSparsityPatternOneBlock( SparsityPattern< globalIndex > & pa
                                      rowField,
                                      m_coupling[rowFieldIndex][colFieldIndex].regions,
                                      connLocRow );
-
-    maxDofRow = MeshIncidence< CONN, LOC >::max * rowField.numComponents;
   } );
 
-  localIndex maxDofCol = 0;
-  if( colFieldIndex == rowFieldIndex )
-  {
-    connLocCol = connLocRow; // TODO avoid copying
-    maxDofCol = maxDofRow;
-  }
-  else
+  if( colFieldIndex != rowFieldIndex )
   {
     LocationSwitch( colField.location, static_cast< Location >( conn ),
                     [&]( auto const locType, auto const connType )
@@ -1046,43 +1124,16 @@ void DofManager::setSparsityPatternOneBlock( SparsityPattern< globalIndex > & pa
                                        colField,
                                        m_coupling[rowFieldIndex][colFieldIndex].regions,
                                        connLocCol );
-
-      maxDofCol = MeshIncidence< CONN, LOC >::max * colField.numComponents;
     } );
   }
-  GEOSX_ASSERT_EQ( connLocRow.numRows(), connLocCol.numRows() );
-
-  globalIndex const globalDofOffset = rankOffset();
-
-  array1d< globalIndex > dofIndicesRow( maxDofRow );
-  array1d< globalIndex > dofIndicesCol( maxDofCol );
+  SparsityPattern< globalIndex > const & connLocColRef = colFieldIndex == rowFieldIndex ? connLocRow : connLocCol;
+  GEOSX_ASSERT_EQ( connLocRow.numRows(), connLocColRef.numRows() );
 
   // Perform assembly/multiply patterns
-  for( localIndex irow = 0; irow < connLocRow.numRows(); ++irow )
-  {
-    localIndex const numDofRow = connLocRow.numNonZeros( irow );
-    dofIndicesRow.resize( numDofRow );
-    for( localIndex j = 0; j < numDofRow; ++j )
-    {
-      dofIndicesRow[j] = connLocRow.getColumns( irow )[j];
-    }
-
-    localIndex const numDofCol = connLocCol.numNonZeros( irow );
-    dofIndicesCol.resize( numDofCol );
-    for( localIndex j = 0; j < numDofCol; ++j )
-    {
-      dofIndicesCol[j] = connLocCol.getColumns( irow )[j];
-    }
-
-    for( localIndex j = 0; j < numDofRow; ++j )
-    {
-      localIndex const localRow = dofIndicesRow[j] - globalDofOffset;
-      if( localRow >= 0 && localRow < pattern.numRows() )
-      {
-        pattern.insertNonZeros( localRow, dofIndicesCol.begin(), dofIndicesCol.end() );
-      }
-    }
-  }
+  insertConnectorCouplings< parallelDevicePolicy<> >( connLocRow.toViewConst(),
+                                                      connLocColRef.toViewConst(),
+                                                      rankOffset(),
+                                                      pattern.toView() );
 }
 
 void DofManager::countRowLengthsFromStencil( arrayView1d< localIndex > const & rowLengths,
@@ -1218,14 +1269,28 @@ void DofManager::countRowLengthsOneBlock( arrayView1d< localIndex > const & rowL
 
 // Create the sparsity pattern (location-location). Low level interface
 void DofManager::setSparsityPattern( SparsityPattern< globalIndex > & pattern ) const
+{
+  setSparsityPattern( pattern, array1d< localIndex >( numLocalDofs() ).toViewConst() );
+
+  // Compress to remove unused space between rows
+  pattern.compress();
+}
+
+void DofManager::setSparsityPattern( SparsityPattern< globalIndex > & pattern,
+                                     arrayView1d< localIndex const > const & extraRowCapacities ) const
 {
   GEOSX_ERROR_IF( !m_reordered, "Cannot set monolithic sparsity pattern before reorderByRank() has been called." );
 
   localIndex const numLocalRows = numLocalDofs();
   localIndex const numFields = LvArray::integerConversion< localIndex >( m_fields.size() );
+  GEOSX_ERROR_IF_NE( extraRowCapacities.size(), numLocalRows );
 
   // Step 1. Do a dry run of sparsity construction to get the total number of nonzeros in each row
   array1d< localIndex > rowSizes( numLocalRows );
+  for( localIndex localRow = 0; localRow < numLocalRows; ++localRow )
+  {
+    rowSizes[localRow] = extraRowCapacities[localRow];
+  }
   for( localIndex blockRow = 0; blockRow < numFields; ++blockRow )
   {
     for( localIndex blockCol = 0; blockCol < numFields; ++blockCol )
@@ -1245,9 +1310,6 @@ void DofManager::setSparsityPattern( SparsityPattern< globalIndex > & pattern )
       setSparsityPatternOneBlock( pattern, blockRow, blockCol );
     }
   }
-
-  // Step 4. Compress to remove unused space between rows
-  pattern.compress();
 }
 
 // Create the sparsity pattern (location-location). High level interface
@@ -1457,12 +1519,12 @@ void DofManager::copyVectorToField( arrayView1d< real64 const > const & localVec
                                     localIndex const loCompIndex,
                                     localIndex const hiCompIndex ) const
 {
-  vectorToField< FieldSpecificationEqual, parallelDevicePolicy<> >( localVector,
-                                                                    srcFieldName,
-                                                                    dstFieldName,
-                                                                    scalingFactor,
-                                                                    loCompIndex,
-                                                                    hiCompIndex );
+  vectorToField< FieldSpecificationEqual, parallelDeviceAsyncPolicy<> >( localVector,
+                                                                         srcFieldName,
+                                                                         dstFieldName,
+                                                                         scalingFactor,
+                                                                         loCompIndex,
+                                                                         hiCompIndex );
 }
 
 // Copy values from DOFs to nodes
@@ -1489,12 +1551,12 @@ void DofManager::addVectorToField( arrayView1d< real64 const > const & localVect
                                    localIndex const loCompIndex,
                                    localIndex const hiCompIndex ) const
 {
-  vectorToField< FieldSpecificationAdd, parallelDevicePolicy<> >( localVector,
-                                                                  srcFieldName,
-                                                                  dstFieldName,
-                                                                  scalingFactor,
-                                                                  loCompIndex,
-                                                                  hiCompIndex );
+  vectorToField< FieldSpecificationAdd, parallelDeviceAsyncPolicy<> >( localVector,
+                                                                       srcFieldName,
+                                                                       dstFieldName,
+                                                                       scalingFactor,
+                                                                       loCompIndex,
+                                                                       hiCompIndex );
 }
 
 template< typename FIELD_OP, typename POLICY, typename LOCAL_VECTOR >
@@ -1709,8 +1771,10 @@ void DofManager::addCoupling( string const & fieldName,
   coupling.stencils = &stencils;
 }
 
-void DofManager::reorderByRank()
+void DofManager::reorderByRank( LinearSolverParameters::DofOrdering const ordering )
 {
+  GEOSX_MARK_FUNCTION;
+
   GEOSX_LAI_ASSERT( !m_reordered );
 
   // update field offsets to account for renumbering
@@ -1750,6 +1814,311 @@ void DofManager::reorderByRank()
                        m_domain->getNeighbors() );
 
   m_reordered = true;
+  m_ordering = ordering;
+  m_contiguousFields = true;
+
+  // optionally, renumber the local DOFs within the rank
+  if( ordering != LinearSolverParameters::DofOrdering::fieldWise )
+  {
+    array1d< localIndex > pointOffsets;
+    interleaveFields( pointOffsets );
+    if( ordering == LinearSolverParameters::DofOrdering::rcm )
+    {
+      permutePoints( pointOffsets.toViewConst() );
+    }
+  }
+
+  // a change on any rank shifts the global numbering or the ghost columns, so all ranks must rebuild
+  std::size_t const fingerprint = computeLayoutFingerprint();
+  int const changed = ( fingerprint != m_layoutFingerprint ) ? 1 : 0;
+  m_layoutChanged = MpiWrapper::Max( changed ) > 0;
+  m_layoutFingerprint = fingerprint;
+}
+
+void DofManager::renumberLocalDofs( arrayView1d< localIndex const > const & newLocalDofs )
+{
+  globalIndex const rankDofOffset = rankOffset();
+  std::map< string, string_array > fieldToSync;
+
+  // the components of a field stay consecutive, moving the first one of each object is enough
+  for( FieldDescription const & field : m_fields )
+  {
+    LocationSwitch( field.location, [&]( auto const loc )
+    {
+      Location constexpr LOC = decltype(loc)::value;
+      using ArrayHelper = IndexArrayHelper< globalIndex, LOC >;
+
+      typename ArrayHelper::Accessor indexArray = ArrayHelper::get( m_mesh, field.key );
+
+      forMeshLocation< LOC, false >( m_mesh, field.regions, [&]( auto const locIdx )
+      {
+        globalIndex & dof = ArrayHelper::reference( indexArray, locIdx );
+        dof = rankDofOffset + newLocalDofs[dof - rankDofOffset];
+      } );
+
+      fieldToSync[MeshHelper< LOC >::syncObjName].emplace_back( field.key );
+    } );
+  }
+
+  CommunicationTools::
+    SynchronizeFields( fieldToSync, m_mesh,
+                       m_domain->getNeighbors() );
+}
+
+void DofManager::interleaveFields( array1d< localIndex > & pointOffsets )
+{
+  // fields on the same location and regions have the same objects, enumerated in the same order
+  std::vector< std::vector< localIndex > > groups;
+  for( localIndex k = 0; k < LvArray::integerConversion< localIndex >( m_fields.size() ); ++k )
+  {
+    auto const it = std::find_if( groups.begin(), groups.end(), [&]( std::vector< localIndex > const & group )
+    {
+      FieldDescription const & first = m_fields[group[0]];
+      return first.location == m_fields[k].location && first.regions == m_fields[k].regions;
+    } );
+    if( it != groups.end() )
+    {
+      it->emplace_back( k );
+    }
+    else
+    {
+      groups.push_back( { k } );
+    }
+  }
+
+  // the groups stay one after the other, each one made of a block of all its fields' components per object
+  globalIndex const rankDofOffset = rankOffset();
+  array1d< localIndex > newLocalDofs( numLocalDofs() );
+  pointOffsets.clear();
+  localIndex groupOffset = 0;
+  for( std::vector< localIndex > const & group : groups )
+  {
+    localIndex const numObjects = m_fields[group[0]].numLocalDof / m_fields[group[0]].numComponents;
+    localIndex const blockSize = std::accumulate( group.begin(), group.end(), localIndex( 0 ),
+                                                  [&]( localIndex const n, localIndex const k ) { return n + m_fields[k].numComponents; } );
+
+    localIndex compOffset = 0;
+    for( localIndex const k : group )
+    {
+      FieldDescription const & field = m_fields[k];
+      localIndex const fieldOffset = LvArray::integerConversion< localIndex >( field.globalOffset - rankDofOffset );
+      for( localIndex i = 0; i < numObjects; ++i )
+      {
+        for( localIndex c = 0; c < field.numComponents; ++c )
+        {
+          newLocalDofs[fieldOffset + i * field.numComponents + c] = groupOffset + i * blockSize + compOffset + c;
+        }
+      }
+      compOffset += field.numComponents;
+    }
+
+    for( localIndex i = 0; i < numObjects; ++i )
+    {
+      pointOffsets.emplace_back( groupOffset + i * blockSize );
+    }
+    groupOffset += numObjects * blockSize;
+  }
+  pointOffsets.emplace_back( groupOffset );
+
+  renumberLocalDofs( newLocalDofs.toViewConst() );
+
+  m_contiguousFields = std::all_of( groups.begin(), groups.end(),
+                                    []( std::vector< localIndex > const & group ) { return group.size() == 1; } );
+}
+
+namespace
+{
+
+/**
+ * @brief Compute the reverse Cuthill-McKee ordering of a symmetric graph.
+ * @param graph the adjacency of each vertex, without the vertex itself
+ * @param order the vertices in the new order
+ *
+ * Each connected component starts from its unvisited vertex of lowest degree.
+ */
+void reverseCuthillMcKee( SparsityPatternView< localIndex const > const & graph,
+                          array1d< localIndex > & order )
+{
+  localIndex const numVertices = graph.numRows();
+
+  array1d< localIndex > byDegree( numVertices );
+  std::iota( byDegree.begin(), byDegree.end(), 0 );
+  std::stable_sort( byDegree.begin(), byDegree.end(), [&]( localIndex const a, localIndex const b )
+  {
+    return graph.numNonZeros( a ) < graph.numNonZeros( b );
+  } );
+
+  array1d< integer > visited( numVertices );
+  array1d< localIndex > neighbors;
+  order.clear();
+  order.reserve( numVertices );
+  for( localIndex const start : byDegree )
+  {
+    if( visited[start] )
+    {
+      continue;
+    }
+    visited[start] = 1;
+    order.emplace_back( start );
+
+    // breadth-first search, the neighbors of each vertex by increasing degree
+    for( localIndex head = order.size() - 1; head < order.size(); ++head )
+    {
+      neighbors.clear();
+      arraySlice1d< localIndex const > const adjacent = graph.getColumns( order[head] );
+      for( localIndex k = 0; k < adjacent.size(); ++k )
+      {
+        localIndex const v = adjacent[k];
+        if( !visited[v] )
+        {
+          visited[v] = 1;
+          neighbors.emplace_back( v );
+        }
+      }
+      std::stable_sort( neighbors.begin(), neighbors.end(), [&]( localIndex const a, localIndex const b )
+      {
+        return graph.numNonZeros( a ) < graph.numNonZeros( b );
+      } );
+      order.insert( order.size(), neighbors.begin(), neighbors.end() );
+    }
+  }
+
+  std::reverse( order.begin(), order.end() );
+}
+
+} // namespace
+
+void DofManager::permutePoints( arrayView1d< localIndex const > const & pointOffsets )
+{
+  localIndex const numPoints = pointOffsets.size() - 1;
+  localIndex const numLocalRows = numLocalDofs();
+  globalIndex const rankDofOffset = rankOffset();
+
+  SparsityPattern< globalIndex > pattern;
+  setSparsityPattern( pattern );
+
+  // collapse the local part of the pattern to the points
+  array1d< localIndex > rowPoints( numLocalRows );
+  array1d< localIndex > pointCapacities( numPoints );
+  for( localIndex p = 0; p < numPoints; ++p )
+  {
+    for( localIndex localRow = pointOffsets[p]; localRow < pointOffsets[p + 1]; ++localRow )
+    {
+      rowPoints[localRow] = p;
+      pointCapacities[p] += pattern.numNonZeros( localRow );
+    }
+  }
+
+  SparsityPattern< localIndex > graph;
+  graph.resizeFromRowCapacities< serialPolicy >( numPoints, numPoints, pointCapacities.data() );
+  for( localIndex localRow = 0; localRow < numLocalRows; ++localRow )
+  {
+    arraySlice1d< globalIndex const > const columns = pattern.getColumns( localRow );
+    for( localIndex k = 0; k < columns.size(); ++k )
+    {
+      globalIndex const localCol = columns[k] - rankDofOffset;
+      if( localCol >= 0 && localCol < numLocalRows && rowPoints[localCol] != rowPoints[localRow] )
+      {
+        graph.insertNonZero( rowPoints[localRow], rowPoints[localCol] );
+      }
+    }
+  }
+
+  array1d< localIndex > order;
+  reverseCuthillMcKee( graph.toViewConst(), order );
+
+  // the points keep their DOFs consecutive
+  array1d< localIndex > newLocalDofs( numLocalRows );
+  localIndex offset = 0;
+  for( localIndex const p : order )
+  {
+    for( localIndex localRow = pointOffsets[p]; localRow < pointOffsets[p + 1]; ++localRow )
+    {
+      newLocalDofs[localRow] = offset++;
+    }
+  }
+
+  renumberLocalDofs( newLocalDofs.toViewConst() );
+
+  m_contiguousFields = m_contiguousFields && m_fields.size() <= 1;
+}
+
+namespace
+{
+
+template< typename T >
+void hashCombine( std::size_t & seed, T const & value )
+{
+  seed ^= std::hash< T >{}( value ) + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 );
+}
+
+void hashCombine( std::size_t & seed, std::vector< string > const & values )
+{
+  hashCombine( seed, values.size() );
+  for( string const & value : values )
+  {
+    hashCombine( seed, value );
+  }
+}
+
+} // namespace
+
+std::size_t DofManager::computeLayoutFingerprint() const
+{
+  std::size_t seed = 0;
+
+  // mesh topology
+  hashCombine( seed, m_mesh );
+  hashCombine( seed, m_mesh->getTopologyVersion() );
+  hashCombine( seed, m_mesh->getNodeManager()->size() );
+  hashCombine( seed, m_mesh->getEdgeManager()->size() );
+  hashCombine( seed, m_mesh->getFaceManager()->size() );
+  m_mesh->getElemManager()->forElementSubRegions( [&]( ElementSubRegionBase const & subRegion )
+  {
+    hashCombine( seed, subRegion.size() );
+  } );
+
+  // fields and their numbering
+  hashCombine( seed, static_cast< int >( m_ordering ) );
+  hashCombine( seed, m_fields.size() );
+  for( FieldDescription const & field : m_fields )
+  {
+    hashCombine( seed, field.name );
+    hashCombine( seed, static_cast< int >( field.location ) );
+    hashCombine( seed, field.regions );
+    hashCombine( seed, field.numComponents );
+    hashCombine( seed, field.numLocalDof );
+    hashCombine( seed, field.numGlobalDof );
+    hashCombine( seed, field.globalOffset );
+  }
+
+  // couplings, including the connections of stencil-based ones
+  for( std::size_t i = 0; i < m_fields.size(); ++i )
+  {
+    for( std::size_t j = 0; j < m_fields.size(); ++j )
+    {
+      CouplingDescription const & coupling = m_coupling[i][j];
+      hashCombine( seed, static_cast< int >( coupling.connector ) );
+      hashCombine( seed, coupling.regions );
+      if( coupling.stencils != nullptr )
+      {
+        coupling.stencils->forAllStencils( *m_mesh, [&]( auto const & stencil )
+        {
+          hashCombine( seed, stencil.size() );
+        } );
+      }
+    }
+  }
+
+  return seed;
+}
+
+bool DofManager::canReuseSparsityPattern( CRSMatrix< real64, globalIndex > const & localMatrix ) const
+{
+  GEOSX_ERROR_IF( !m_reordered, "Cannot check the sparsity pattern before reorderByRank() has been called." );
+  return !m_layoutChanged &&
+         localMatrix.numRows() == numLocalDofs() &&
+         localMatrix.numColumns() == numGlobalDofs();
 }
 
 std::vector< DofManager::SubComponent >
@@ -1788,6 +2157,7 @@ void DofManager::makeRestrictor( std::vector< SubComponent > const & selection,
                                  MATRIX & restrictor ) const
 {
   GEOSX_ERROR_IF( !m_reordered, "Cannot make restrictors before reorderByRank() has been called." );
+  GEOSX_ERROR_IF( !m_contiguousFields, "Cannot make restrictors when the local DOF ordering mixes the fields." );
 
   // 1. Populate selected fields and compute some basic dimensions
   array1d< FieldDescription > fieldsSelected( selection.size() );
@@ -22,6 +22,7 @@
 #include "LvArray/src/SparsityPattern.hpp"
 #include "common/DataTypes.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
 #include "mesh/ElementRegionManager.hpp"
 #include "mesh/NodeManager.hpp"
 
@@ -301,8 +302,35 @@ public:
    *       "global offset of field's block on current processor in a rank-wise ordered system".
    *       This meaning is consistent with its use throughout. For example, this is the row/col
    *       global offset used to insert the field's sparsity block into a global coupled system.
+   *
+   * @param ordering ordering of the DoFs within the rank. With the interleaved and rcm orderings, the fields
+   *                 supported by the same objects share one block of DoFs per object, the components of a
+   *                 field staying consecutive, and rcm further permutes these blocks by reverse Cuthill-McKee
+   *                 on the local graph of all the couplings: the couplings must be added beforehand.
+   *
+   * @note When the fields are no longer contiguous ranges of DoFs (see fieldsContiguous()), the field offsets
+   *       are meaningless and the restrictors cannot be created.
+   */
+  void reorderByRank( LinearSolverParameters::DofOrdering const ordering = LinearSolverParameters::DofOrdering::fieldWise );
+
+  /**
+   * @brief Check whether the local DoFs of each field form a contiguous range.
+   * @return @p true unless the local ordering mixes the DoFs of several fields
    */
-  void reorderByRank();
+  bool fieldsContiguous() const
+  { return m_contiguousFields; }
+
+  /**
+   * @brief Check whether a local matrix assembled for the previous DOF layout can keep its sparsity pattern.
+   * @param localMatrix the local matrix, whose sparsity pattern was set for the previous layout
+   * @return @p true if neither the fields, their couplings nor the mesh topology changed on any rank
+   *         since the previous call to reorderByRank(), and the matrix has the dimensions of the system
+   *
+   * The layout is fingerprinted by reorderByRank(). The fingerprint survives clear(), so that a solver
+   * that recreates its DOFs every time step only needs to zero the values of its matrix
+   * instead of rebuilding its sparsity pattern, as long as the topology of the mesh is unchanged.
+   */
+  bool canReuseSparsityPattern( CRSMatrix< real64, globalIndex > const & localMatrix ) const;
 
   /**
    * @brief Check if string key is already being used
@@ -381,6 +409,22 @@ public:
    */
   array1d< localIndex > numComponentsPerField() const;
 
+  /**
+   * @brief Get the size of the square blocks of the system, i.e. the number of consecutive
+   * dofs of a support point shared by all rows: the number of components of the field if there
+   * is only one, 1 otherwise.
+   *
+   * @return     the block size
+   */
+  localIndex blockSize() const;
+
+  /**
+   * @brief Return an array of field names, sorted by field registration order.
+   *
+   * @return     array of field names
+   */
+  array1d< string > fieldNames() const;
+
   /**
    * @brief Get the local number of support points on this processor.
    * @param [in] fieldName the name of the field
@@ -439,6 +483,17 @@ public:
    */
   void setSparsityPattern( SparsityPattern< globalIndex > & pattern ) const;
 
+  /**
+   * @brief Populate sparsity pattern of the entire system matrix, with room for more nonzeros.
+   * @param [out] pattern the target sparsity pattern
+   * @param [in]  extraRowCapacities number of nonzeros reserved in each local row on top of the ones of the couplings
+   *
+   * This lets a solver insert the nonzeros of couplings unknown to the DofManager directly in the pattern,
+   * instead of copying it into a larger one. The pattern is not compressed.
+   */
+  void setSparsityPattern( SparsityPattern< globalIndex > & pattern,
+                           arrayView1d< localIndex const > const & extraRowCapacities ) const;
+
   /**
    * @brief Populate sparsity pattern for one block of the system matrix.
    * @param [out] pattern the target sparsity pattern
@@ -483,6 +538,7 @@ public:
    *
    * @note [@p loCompIndex , @p hiCompIndex) form a half-open interval.
    *       Negative value of @p hiCompIndex means use full number of field components
+   * @note The kernel is launched on the device stream and the host does not wait for it.
    */
   void copyVectorToField( arrayView1d< real64 const > const & localVector,
                           string const & srcFieldName,
@@ -525,6 +581,7 @@ public:
    *
    * @note [@p loCompIndex , @p hiCompIndex) form a half-open interval.
    *       Negative value of @p hiCompIndex means use full number of field components
+   * @note The kernel is launched on the device stream and the host does not wait for it.
    */
   void addVectorToField( arrayView1d< real64 const > const & localVector,
                          string const & srcFieldName,
@@ -675,11 +732,35 @@ private:
    */
   void initializeDataStructure();
 
+  /**
+   * @brief Compute a fingerprint of the local DOF layout, of the couplings and of the mesh topology.
+   * @return the fingerprint
+   */
+  std::size_t computeLayoutFingerprint() const;
+
   /**
    * @brief Get field index from string key
    */
   localIndex getFieldIndex( string const & name ) const;
 
+  /**
+   * @brief Group the DoFs of the fields supported by the same objects, object by object.
+   * @param pointOffsets the first local DoF of each object block (point) in the new ordering, plus the end
+   */
+  void interleaveFields( array1d< localIndex > & pointOffsets );
+
+  /**
+   * @brief Permute the points by reverse Cuthill-McKee on the local graph of the couplings.
+   * @param pointOffsets the first local DoF of each point, plus the end
+   */
+  void permutePoints( arrayView1d< localIndex const > const & pointOffsets );
+
+  /**
+   * @brief Renumber the local DoFs of all the fields and synchronize the ghosts.
+   * @param newLocalDofs the new local index of each local DoF
+   */
+  void renumberLocalDofs( arrayView1d< localIndex const > const & newLocalDofs );
+
   /**
    * @brief Create index array for the field
    */
@@ -802,6 +883,18 @@ private:
 
   /// Flag indicating that DOFs have been reordered rank-wise.
   bool m_reordered;
+
+  /// Ordering of the DoFs within the rank at the last call to reorderByRank()
+  LinearSolverParameters::DofOrdering m_ordering;
+
+  /// Flag indicating that the local DoFs of each field form a contiguous range
+  bool m_contiguousFields;
+
+  /// Fingerprint of the DOF layout and mesh topology at the last call to reorderByRank()
+  std::size_t m_layoutFingerprint;
+
+  /// Flag indicating that the layout changed on some rank at the last call to reorderByRank()
+  bool m_layoutChanged;
 };
 
 } /* namespace geosx */
@@ -0,0 +1,155 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file replayLinearSystem.cpp
+ *
+ * Offline replay of a linear system written by a physics solver (see the captureSystems
+ * linear solver parameter). The system is read on any number of ranks and solved with each
+ * requested solver/preconditioner combination:
+ *
+ *   replayLinearSystem <prefix> [solver:preconditioner ...]
+ *
+ * reporting the setup time, solve time and number of iterations of each combination.
+ */
+
+#include "common/DataTypes.hpp"
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+#include "linearAlgebra/solvers/SeparateComponentPreconditioner.hpp"
+#include "linearAlgebra/utilities/LAIHelperFunctions.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+#include "managers/initialization.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <iomanip>
+
+using namespace geosx;
+
+namespace
+{
+
+/**
+ * @brief Solve the system with the solver/preconditioner combination of @p params.
+ * @param params the linear solver parameters
+ * @param matrix the system matrix
+ * @param rhs the right-hand side
+ * @return the statistics of the solve
+ */
+LinearSolverResult replay( LinearSolverParameters const & params,
+                           ParallelMatrix & matrix,
+                           ParallelVector & rhs )
+{
+  ParallelVector solution;
+  solution.createWithLocalSize( matrix.numLocalCols(), matrix.getComm() );
+  solution.zero();
+
+  bool const nativeOnly = params.solverType == LinearSolverParameters::SolverType::pipecg ||
+                          params.solverType == LinearSolverParameters::SolverType::cagmres ||
+                          params.solverType == LinearSolverParameters::SolverType::gcrodr;
+
+  if( !nativeOnly )
+  {
+    LinearSolver solver( params );
+    solver.solve( matrix, solution, rhs );
+    return solver.result();
+  }
+
+  std::unique_ptr< PreconditionerBase< LAInterface > > precond = LAInterface::createPreconditioner( params );
+  if( params.amg.separateComponents && params.preconditionerType == LinearSolverParameters::PreconditionerType::amg )
+  {
+    precond = std::make_unique< SeparateComponentPreconditioner< LAInterface > >( params.dofsPerNode, std::move( precond ) );
+  }
+
+  Stopwatch watch;
+  precond->compute( matrix );
+  real64 const setupTime = watch.elapsedTime();
+
+  std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::Create( params, matrix, *precond );
+  solver->solve( rhs, solution );
+
+  LinearSolverResult result = solver->result();
+  result.setupTime = setupTime;
+  return result;
+}
+
+} // namespace
+
+int main( int argc, char * * argv )
+{
+  basicSetup( argc, argv );
+
+  GEOSX_ERROR_IF( argc < 2, "Usage: " << argv[0] << " <prefix> [solver:preconditioner ...]" );
+  string const prefix = argv[1];
+
+  std::vector< string > combinations( argv + 2, argv + argc );
+  if( combinations.empty() )
+  {
+    combinations = { "direct:none", "gmres:iluk", "gmres:amg", "bicgstab:iluk" };
+  }
+
+  {
+    ParallelMatrix matrix;
+    ParallelVector rhs;
+    LAIHelperFunctions::LinearSystemLayout layout;
+    LAIHelperFunctions::ReadLinearSystem( prefix, MPI_COMM_GEOSX, matrix, rhs, layout );
+
+    GEOSX_LOG_RANK_0( prefix << ": " << matrix.numGlobalRows() << " rows, " << matrix.numGlobalNonzeros() << " nonzeros, "
+                             << MpiWrapper::Comm_size( MPI_COMM_GEOSX ) << " ranks" );
+    for( localIndex f = 0; f < layout.fieldNames.size(); ++f )
+    {
+      GEOSX_LOG_RANK_0( "  field " << layout.fieldNames[f] << " (" << layout.numComponents[f] << " components)" );
+    }
+
+    LinearSolverParameters baseParams;
+    baseParams.stopIfError = 0;
+    // Only a single field provides a uniform number of dofs per support point
+    baseParams.dofsPerNode = layout.numComponents.size() == 1 ? LvArray::integerConversion< integer >( layout.numComponents[0] ) : 1;
+
+    GEOSX_LOG_RANK_0( std::setw( 10 ) << "solver" << std::setw( 16 ) << "preconditioner" << std::setw( 14 ) << "status"
+                                      << std::setw( 12 ) << "iterations" << std::setw( 14 ) << "setup [s]" << std::setw( 14 ) << "solve [s]"
+                                      << std::setw( 14 ) << "reduction" );
+
+    for( string const & combination : combinations )
+    {
+      size_t const sep = combination.find( ':' );
+      GEOSX_ERROR_IF( sep == string::npos, "Invalid combination " << combination << ", expected solver:preconditioner" );
+
+      LinearSolverParameters params = baseParams;
+      params.solverType = EnumStrings< LinearSolverParameters::SolverType >::fromString( combination.substr( 0, sep ) );
+      params.preconditionerType = EnumStrings< LinearSolverParameters::PreconditionerType >::fromString( combination.substr( sep + 1 ) );
+
+      // These preconditioners are built from the DoF manager or the mesh, which are not available offline
+      if( params.preconditionerType == LinearSolverParameters::PreconditionerType::mgr ||
+          params.preconditionerType == LinearSolverParameters::PreconditionerType::block ||
+          params.preconditionerType == LinearSolverParameters::PreconditionerType::cpr ||
+          params.preconditionerType == LinearSolverParameters::PreconditionerType::gmg )
+      {
+        GEOSX_LOG_RANK_0( "Skipping " << combination << ": preconditioner requires a DofManager" );
+        continue;
+      }
+
+      LinearSolverResult const result = replay( params, matrix, rhs );
+
+      GEOSX_LOG_RANK_0( std::setw( 10 ) << combination.substr( 0, sep ) << std::setw( 16 ) << combination.substr( sep + 1 )
+                                        << std::setw( 14 ) << ( result.success() ? "converged" : ( result.breakdown() ? "breakdown" : "failed" ) )
+                                        << std::setw( 12 ) << result.numIterations << std::setw( 14 ) << result.setupTime
+                                        << std::setw( 14 ) << result.solveTime << std::setw( 14 ) << result.residualReduction );
+    }
+  }
+
+  basicCleanup();
+  return 0;
+}
@@ -135,6 +135,25 @@ void GEOSX_dgesvd( char const * JOBU,
                    int const * LWORK,
                    int * INFO );
 
+#define GEOSX_dggev FORTRAN_MANGLE( dggev )
+void GEOSX_dggev( char const * JOBVL,
+                  char const * JOBVR,
+                  int const * N,
+                  double * A,
+                  int const * LDA,
+                  double * B,
+                  int const * LDB,
+                  double * ALPHAR,
+                  double * ALPHAI,
+                  double * BETA,
+                  double * VL,
+                  int const * LDVL,
+                  double * VR,
+                  int const * LDVR,
+                  double * WORK,
+                  int const * LWORK,
+                  int * INFO );
+
 }
 #endif
 
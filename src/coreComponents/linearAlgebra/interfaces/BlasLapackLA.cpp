@@ -789,4 +789,100 @@ void BlasLapackLA::matrixSVD( arraySlice2d< real64 const, MatrixLayout::ROW_MAJO
   }
 }
 
+void BlasLapackLA::matrixGeneralizedEigen( arraySlice2d< real64 const, MatrixLayout::COL_MAJOR > const & A,
+                                           arraySlice2d< real64 const, MatrixLayout::COL_MAJOR > const & B,
+                                           arraySlice1d< real64 > const & alphaR,
+                                           arraySlice1d< real64 > const & alphaI,
+                                           arraySlice1d< real64 > const & beta,
+                                           arraySlice2d< real64, MatrixLayout::COL_MAJOR > const & V )
+{
+  GEOSX_ASSERT_MSG( A.size( 0 ) == A.size( 1 ),
+                    "The matrix A must be square" );
+
+  GEOSX_ASSERT_MSG( A.size( 0 ) == B.size( 0 ) && A.size( 1 ) == B.size( 1 ),
+                    "The matrices A and B have an incompatible size" );
+
+  GEOSX_ASSERT_MSG( A.size( 0 ) == V.size( 0 ) && A.size( 1 ) == V.size( 1 ),
+                    "The matrices A and V have an incompatible size" );
+
+  GEOSX_ASSERT_MSG( alphaR.size() == A.size( 0 ) && alphaI.size() == A.size( 0 ) && beta.size() == A.size( 0 ),
+                    "The matrix A and vectors alphaR, alphaI and beta have an incompatible size" );
+
+  // make copies of A and B, since dggev destroys contents
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > ACOPY( A.size( 0 ), A.size( 1 ) );
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > BCOPY( B.size( 0 ), B.size( 1 ) );
+  for( int i = 0; i < A.size( 0 ); ++i )
+  {
+    for( int j = 0; j < A.size( 1 ); ++j )
+    {
+      ACOPY( i, j ) = A( i, j );
+      BCOPY( i, j ) = B( i, j );
+    }
+  }
+
+  // define the arguments of dggev
+  int const N    = LvArray::integerConversion< int >( A.size( 0 ) );
+  int const LDA  = N;
+  int const LDB  = N;
+  int const LDVL = 1;
+  int const LDVR = N;
+  int LWORK = 0;
+  int INFO  = 0;
+  double WKOPT = 0.0;
+  double VL = 0.0;
+
+  // 1) query and allocate the optimal workspace
+  LWORK = -1;
+  GEOSX_dggev( "N", "V",
+               &N, ACOPY.data(), &LDA, BCOPY.data(), &LDB,
+               alphaR.dataIfContiguous(), alphaI.dataIfContiguous(), beta.dataIfContiguous(),
+               &VL, &LDVL, V.dataIfContiguous(), &LDVR,
+               &WKOPT, &LWORK, &INFO );
+
+  LWORK = static_cast< int >( WKOPT );
+  array1d< real64 > WORK( LWORK );
+
+  // 2) compute the eigenpairs
+  GEOSX_dggev( "N", "V",
+               &N, ACOPY.data(), &LDA, BCOPY.data(), &LDB,
+               alphaR.dataIfContiguous(), alphaI.dataIfContiguous(), beta.dataIfContiguous(),
+               &VL, &LDVL, V.dataIfContiguous(), &LDVR,
+               WORK.data(), &LWORK, &INFO );
+
+  GEOSX_ASSERT_MSG( INFO == 0, "The algorithm computing the generalized eigenpairs failed to converge." );
+}
+
+void BlasLapackLA::matrixGeneralizedEigen( arraySlice2d< real64 const, MatrixLayout::ROW_MAJOR > const & A,
+                                           arraySlice2d< real64 const, MatrixLayout::ROW_MAJOR > const & B,
+                                           arraySlice1d< real64 > const & alphaR,
+                                           arraySlice1d< real64 > const & alphaI,
+                                           arraySlice1d< real64 > const & beta,
+                                           arraySlice2d< real64, MatrixLayout::ROW_MAJOR > const & V )
+{
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > AT( A.size( 0 ), A.size( 1 ) );
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > BT( B.size( 0 ), B.size( 1 ) );
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > VT( V.size( 0 ), V.size( 1 ) );
+
+  // convert A and B to a column major format
+  for( int i = 0; i < A.size( 0 ); ++i )
+  {
+    for( int j = 0; j < A.size( 1 ); ++j )
+    {
+      AT( i, j ) = A( i, j );
+      BT( i, j ) = B( i, j );
+    }
+  }
+
+  matrixGeneralizedEigen( AT.toSliceConst(), BT.toSliceConst(), alphaR, alphaI, beta, VT.toSlice() );
+
+  // convert V back to row-major format
+  for( int i = 0; i < V.size( 0 ); ++i )
+  {
+    for( int j = 0; j < V.size( 1 ); ++j )
+    {
+      V( i, j ) = VT( i, j );
+    }
+  }
+}
+
 } // end geosx namespace
@@ -552,6 +552,43 @@ struct BlasLapackLA
                          Vec< real64 > const & S,
                          MatColMajor< real64 > const & VT );
 
+  /**
+   * @brief Computes the generalized eigenvalues and the right generalized eigenvectors
+   *        of a square matrix pencil (A,B), such that A*v = lambda*B*v.
+   *
+   * If size(A) = (N,N), this function expects:
+   * size(B) = (N,N),
+   * size(alphaR) = size(alphaI) = size(beta) = N, and
+   * size(V) = (N,N)
+   * On exit, the j-th eigenvalue is ( alphaR(j) + i*alphaI(j) ) / beta(j), where beta(j) may be zero.
+   * The complex conjugate eigenvalues are stored consecutively, the one with a positive imaginary
+   * part first: if alphaI(j) > 0, the eigenvectors of the pair are V(:,j) +/- i*V(:,j+1),
+   * otherwise V(:,j) is the (real) eigenvector of the j-th eigenvalue.
+   *
+   * @param [in]  A GEOSX array2d.
+   * @param [in]  B GEOSX array2d.
+   * @param [out] alphaR GEOSX array1d.
+   * @param [out] alphaI GEOSX array1d.
+   * @param [out] beta GEOSX array1d.
+   * @param [out] V GEOSX array2d.
+   */
+  static void matrixGeneralizedEigen( MatRowMajor< real64 const > const & A,
+                                      MatRowMajor< real64 const > const & B,
+                                      Vec< real64 > const & alphaR,
+                                      Vec< real64 > const & alphaI,
+                                      Vec< real64 > const & beta,
+                                      MatRowMajor< real64 > const & V );
+
+  /**
+   * @copydoc matrixGeneralizedEigen
+   */
+  static void matrixGeneralizedEigen( MatColMajor< real64 const > const & A,
+                                      MatColMajor< real64 const > const & B,
+                                      Vec< real64 > const & alphaR,
+                                      Vec< real64 > const & alphaI,
+                                      Vec< real64 > const & beta,
+                                      MatColMajor< real64 > const & V );
+
 };
 
 }
@@ -220,7 +220,10 @@ protected:
    * @param comm The MPI communicator to use.
    *
    * @note Copies values, so that @p localMatrix does not need to retain its values after the call.
-   * @todo Replace generic implementation with more efficient ones in each package.
+   *
+   * The generic implementation below inserts row by row into a matrix preallocated with the
+   * maximum row length; each package overrides it to preallocate the exact diagonal/off-diagonal
+   * row lengths and hand the CRS arrays over in bulk.
    */
   virtual void create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
                        MPI_Comm const & comm )
@@ -248,6 +251,23 @@ protected:
     close();
   }
 
+  /**
+   * @brief Create parallel matrix from a local CRS matrix, stored by square blocks if supported.
+   * @param localMatrix The input local matrix.
+   * @param blockSize The number of consecutive rows (and columns) of a block, i.e. the dofs of a support point.
+   * @param comm The MPI communicator to use.
+   *
+   * The generic implementation ignores @p blockSize and falls back to the scalar storage;
+   * packages with a block sparse format (PETSc BAIJ) override it.
+   */
+  virtual void create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                       localIndex const blockSize,
+                       MPI_Comm const & comm )
+  {
+    GEOSX_LAI_ASSERT_GT( blockSize, 0 );
+    create( localMatrix, comm );
+  }
+
   ///@}
 
   /**
@@ -20,6 +20,7 @@
 #define GEOSX_LINEARALGEBRA_INTERFACES_VECTORBASE_HPP_
 
 #include "linearAlgebra/common.hpp"
+#include "mpiCommunications/DeterministicReduction.hpp"
 #include "mpiCommunications/MpiWrapper.hpp"
 #include "rajaInterface/GEOS_RAJA_Interface.hpp"
 
@@ -293,6 +294,63 @@ protected:
    */
   virtual real64 dot( Vector const & vec ) const = 0;
 
+  /**
+   * @brief Dot products with several vectors, computed with a single global reduction.
+   * @param vecs the vectors to dot-product with
+   * @param result the dot products (must be sized as @p vecs)
+   *
+   * This avoids the latency of one reduction per dot product, e.g. when
+   * orthogonalizing a vector against a Krylov basis.
+   */
+  virtual void multiDot( arrayView1d< Vector const * const > const & vecs,
+                         arrayView1d< real64 > const & result ) const
+  {
+    array1d< real64 > localResult( result.size() );
+    localMultiDot( vecs, localResult );
+    if( DeterministicReduction::isEnabled() )
+    {
+      DeterministicReduction::sum( localResult.data(),
+                                   result.data(),
+                                   LvArray::integerConversion< int >( result.size() ),
+                                   getComm() );
+      return;
+    }
+    MpiWrapper::allReduce( localResult.data(),
+                           result.data(),
+                           LvArray::integerConversion< int >( result.size() ),
+                           MPI_SUM,
+                           getComm() );
+  }
+
+  /**
+   * @brief Contributions of the locally owned entries to dot products with several vectors.
+   * @param vecs the vectors to dot-product with
+   * @param result the local parts of the dot products (must be sized as @p vecs),
+   *               to be summed over the communicator of the vector
+   */
+  void localMultiDot( arrayView1d< Vector const * const > const & vecs,
+                      arrayView1d< real64 > const & result ) const
+  {
+    GEOSX_LAI_ASSERT_EQ( vecs.size(), result.size() );
+    real64 const * const values = extractLocalVector();
+    for( localIndex i = 0; i < vecs.size(); ++i )
+    {
+      GEOSX_LAI_ASSERT_EQ( vecs[i]->localSize(), localSize() );
+      real64 const * const otherValues = vecs[i]->extractLocalVector();
+      if( DeterministicReduction::isEnabled() )
+      {
+        result[i] = DeterministicReduction::localDot( values, otherValues, localSize() );
+        continue;
+      }
+      RAJA::ReduceSum< parallelHostReduce, real64 > sum( 0.0 );
+      forAll< parallelHostPolicy >( localSize(), [=] ( localIndex const k )
+      {
+        sum += values[k] * otherValues[k];
+      } );
+      result[i] = sum.get();
+    }
+  }
+
   /**
    * @brief Update vector <tt>y</tt> as <tt>y</tt> = <tt>x</tt>.
    * @param x vector to copy
@@ -462,6 +520,30 @@ protected:
     return os;
   }
 
+  /**
+   * @brief Check whether the vector is already created with a given local size on all the ranks.
+   * @param localSize the local size of the vector to create
+   * @param comm the communicator of the vector to create
+   * @return true if the vector can be refilled instead of being created again
+   *
+   * The solvers recreate their rhs and solution vectors at each Newton iteration with the same layout:
+   * keeping the vector avoids the (device) reallocations. Collective over @p comm.
+   */
+  bool hasLocalSize( localIndex const localSize, MPI_Comm const & comm ) const
+  {
+    int sameLayout = created() && this->localSize() == localSize;
+#ifdef GEOSX_USE_MPI
+    if( sameLayout )
+    {
+      // the packages may keep a duplicate of the communicator
+      int result;
+      MPI_Comm_compare( getComm(), comm, &result );
+      sameLayout = ( result == MPI_IDENT || result == MPI_CONGRUENT );
+    }
+#endif
+    return MpiWrapper::Min( sameLayout, comm ) == 1;
+  }
+
   /// Flag indicating whether the vector is closed
   bool m_closed;
 };
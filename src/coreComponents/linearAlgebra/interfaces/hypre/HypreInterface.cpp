@@ -35,4 +35,10 @@ geosx::HypreInterface::createPreconditioner( LinearSolverParameters params )
   return std::make_unique< HyprePreconditioner >( params );
 }
 
+std::unique_ptr< PreconditionerBase< HypreInterface > >
+geosx::HypreInterface::createPreconditioner( LinearSolverParameters params, DofManager const & dofManager )
+{
+  return std::make_unique< HyprePreconditioner >( params, &dofManager );
+}
+
 }
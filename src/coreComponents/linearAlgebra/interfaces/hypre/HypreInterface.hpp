@@ -56,6 +56,15 @@ struct HypreInterface
   static std::unique_ptr< PreconditionerBase< HypreInterface > >
   createPreconditioner( LinearSolverParameters params );
 
+  /**
+   * @brief Create a hypre-based preconditioner object that may use the degree-of-freedom layout.
+   * @param params the preconditioner parameters
+   * @param dofManager the DofManager of the system, required by some preconditioners (e.g. MGR)
+   * @return owning pointer to the newly created preconditioner
+   */
+  static std::unique_ptr< PreconditionerBase< HypreInterface > >
+  createPreconditioner( LinearSolverParameters params, DofManager const & dofManager );
+
   /// Alias for HypreMatrix
   using ParallelMatrix = HypreMatrix;
   /// Alias for HypreVector
@@ -20,66 +20,277 @@
 #define GEOSX_LINEARALGEBRA_INTERFACES_HYPREMGRSTRATEGIES_HPP_
 
 #include "common/DataTypes.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
 
 #include <_hypre_utilities.h>
 
+#include <algorithm>
+#include <map>
+#include <vector>
+
 namespace geosx
 {
 
+namespace mgr
+{
+
+/**
+ * @brief Description of an MGR reduction, in terms of the DoF component labels.
+ *
+ * The labels are the ones of DofManager::getLocalDofComponentLabels(), numbered consecutively over the components
+ * of the fields in the order of the fields in the DofManager. Each level keeps its C-point labels and
+ * eliminates the other labels that were kept by the previous level, the last C-points form the coarse grid.
+ */
+struct Strategy
+{
+  /// Coarse grid solvers
+  enum class CoarseSolver
+  {
+    amg, ///< BoomerAMG V-cycle
+    ilu  ///< ILU(0)
+  };
+
+  HYPRE_Int blockSize = 0;                        ///< Number of labels
+  std::vector< std::vector< HYPRE_Int > > cpoints; ///< C-point labels of each level
+  std::vector< HYPRE_Int > levelFRelaxMethod;     ///< F-relaxation of each level, hypre default if empty
+  std::vector< HYPRE_Int > levelInterpType;       ///< Interpolation of each level, hypre default if empty
+  std::vector< HYPRE_Int > coarseGridMethod;      ///< Coarse grid computation of each level, hypre default if empty
+  HYPRE_Int globalSmoothType = 16;                ///< Global smoother, ILU(0) by default
+  HYPRE_Int numGlobalSmoothSweeps = 0;            ///< Global smoother sweeps, 0 for none
+  HYPRE_Int pMaxElmts = -1;                       ///< Interpolation truncation, hypre default if negative
+  CoarseSolver coarseSolver = CoarseSolver::ilu;  ///< Coarse grid solver
+
+  /**
+   * @brief Get the number of levels.
+   * @return the number of levels
+   */
+  HYPRE_Int numLevels() const
+  { return LvArray::integerConversion< HYPRE_Int >( cpoints.size() ); }
+
+  /**
+   * @brief Keep the C-points of the last level except the eliminated labels at a new level.
+   * @param[in] eliminated the labels eliminated at the new level
+   */
+  void addLevel( std::vector< HYPRE_Int > const & eliminated )
+  {
+    std::vector< HYPRE_Int > kept;
+    for( HYPRE_Int const label : cpoints.empty() ? allLabels() : cpoints.back() )
+    {
+      if( std::find( eliminated.begin(), eliminated.end(), label ) == eliminated.end() )
+      {
+        kept.push_back( label );
+      }
+    }
+    cpoints.push_back( kept );
+  }
+
+private:
+
+  std::vector< HYPRE_Int > allLabels() const
+  {
+    std::vector< HYPRE_Int > labels( blockSize );
+    for( HYPRE_Int k = 0; k < blockSize; ++k )
+    {
+      labels[k] = k;
+    }
+    return labels;
+  }
+};
+
+/// Type of the functions building a strategy from the number of components of each DoF field
+using StrategyBuilder = Strategy (*)( arraySlice1d< localIndex const > const & numComponentsPerField,
+                                      LinearSolverParameters::MGR const & params );
+
+/**
+ * @brief Single-phase poroelasticity, with or without fractures.
+ *
+ * Labels: 0, 1, 2 = displacement components, 3 = pressure.
+ * One level eliminating the displacement with an AMG V-cycle, the pressure Schur complement is solved with AMG.
+ * @param numComponentsPerField number of components of each field
+ * @param params the MGR parameters
+ * @return the strategy
+ */
+inline Strategy poroelastic( arraySlice1d< localIndex const > const & GEOSX_UNUSED_PARAM( numComponentsPerField ),
+                             LinearSolverParameters::MGR const & params )
+{
+  Strategy strategy;
+  strategy.blockSize = 4;
+  strategy.addLevel( { 0, 1, 2 } );
+
+  strategy.levelFRelaxMethod = { 2 };  // AMG V-cycle
+  strategy.levelInterpType = { 2 };    // diagonal scaling (Jacobi)
+  // diagonal sparsification, or Galerkin coarse grid computation using RAP for the fractures
+  strategy.coarseGridMethod = { params.strategy == "Poroelastic" ? 1 : 0 };
+  strategy.pMaxElmts = 0;
+  strategy.coarseSolver = Strategy::CoarseSolver::amg;
+  return strategy;
+}
+
 /**
- * @todo Add a detailed description with an example
+ * @brief Compositional multiphase flow.
  *
- * @brief Compute an array of unique component labels.
+ * Labels: 0 = pressure, 1 ... numLabels - 1 = densities, the last one carrying the volume constraint.
+ * 1st level eliminates the last density, 2nd level eliminates the pressure, the coarse grid is solved with ILU(0).
+ * @param numComponentsPerField number of components of each field
+ * @param params the MGR parameters
+ * @return the strategy
+ */
+inline Strategy compositionalMultiphaseFlow( arraySlice1d< localIndex const > const & numComponentsPerField,
+                                             LinearSolverParameters::MGR const & GEOSX_UNUSED_PARAM( params ) )
+{
+  HYPRE_Int const numLabels = LvArray::integerConversion< HYPRE_Int >( numComponentsPerField[0] );
+
+  Strategy strategy;
+  strategy.blockSize = numLabels;
+  strategy.addLevel( { numLabels - 1 } );
+  strategy.addLevel( { 0 } );
+
+  strategy.levelFRelaxMethod = { 0, 2 }; // Jacobi, AMG V-cycle
+  strategy.numGlobalSmoothSweeps = 1;
+  return strategy;
+}
+
+/**
+ * @brief Compositional multiphase flow with wells.
  *
- * @details
+ * Labels: 0 ... numResLabels - 1 = reservoir pressure and densities, followed by the well pressure,
+ * densities and rate. 1st level eliminates the reservoir density of the volume constraint, 2nd level the
+ * other reservoir densities, 3rd level the reservoir pressure, and the well block is solved with ILU(0).
+ * The capillary pressure only changes the coefficients of the reservoir equations, not the reduction.
+ * @param numComponentsPerField number of components of each field
+ * @param params the MGR parameters
+ * @return the strategy
+ */
+inline Strategy compositionalMultiphaseReservoir( arraySlice1d< localIndex const > const & numComponentsPerField,
+                                                  LinearSolverParameters::MGR const & GEOSX_UNUSED_PARAM( params ) )
+{
+  HYPRE_Int const numResLabels = LvArray::integerConversion< HYPRE_Int >( numComponentsPerField[0] );
+  HYPRE_Int const numWellLabels = LvArray::integerConversion< HYPRE_Int >( numComponentsPerField[1] );
+
+  Strategy strategy;
+  strategy.blockSize = numResLabels + numWellLabels;
+  strategy.addLevel( { numResLabels - 1 } );
+  std::vector< HYPRE_Int > resDensities;
+  for( HYPRE_Int k = 1; k < numResLabels - 1; ++k )
+  {
+    resDensities.push_back( k );
+  }
+  strategy.addLevel( resDensities );
+  strategy.addLevel( { 0 } );
+
+  strategy.levelFRelaxMethod = { 0, 0, 2 }; // Jacobi, Jacobi, AMG V-cycle
+  strategy.levelInterpType = { 2, 2, 2 };
+  strategy.numGlobalSmoothSweeps = 1;
+  return strategy;
+}
+
+/**
+ * @brief Single-phase flow with wells.
  *
- * @param numComponentsPerField array of number of components per field
- * @param numLocalDofsPerField array of local number of dofs per field
- * @return array1d of HYPRE_Int labels
+ * Labels: 0 = reservoir pressure, 1 = well pressure, 2 = well rate.
+ * One level eliminating the reservoir pressure with an AMG V-cycle, the well block is solved with ILU(0).
+ * @param numComponentsPerField number of components of each field
+ * @param params the MGR parameters
+ * @return the strategy
  */
-inline array1d< HYPRE_Int > computeLocalDofComponentLabels( arraySlice1d< localIndex const > const & numComponentsPerField,
-                                                            arraySlice1d< localIndex const > const & numLocalDofsPerField )
+inline Strategy singlePhaseReservoir( arraySlice1d< localIndex const > const & numComponentsPerField,
+                                      LinearSolverParameters::MGR const & GEOSX_UNUSED_PARAM( params ) )
 {
-  array1d< HYPRE_Int > ret;
-  HYPRE_Int numFields = LvArray::integerConversion< HYPRE_Int >( numLocalDofsPerField.size() );
+  Strategy strategy;
+  strategy.blockSize = LvArray::integerConversion< HYPRE_Int >( numComponentsPerField[0] + numComponentsPerField[1] );
+  strategy.addLevel( { 0 } );
+
+  strategy.levelFRelaxMethod = { 2 }; // AMG V-cycle
+  strategy.levelInterpType = { 2 };
+  strategy.numGlobalSmoothSweeps = 1;
+  return strategy;
+}
+
+/**
+ * @brief Strategy given level by level in the input, see LinearSolverParameters::MGR.
+ * @param numComponentsPerField number of components of each field
+ * @param params the MGR parameters
+ * @return the strategy
+ */
+inline Strategy custom( arraySlice1d< localIndex const > const & numComponentsPerField,
+                        LinearSolverParameters::MGR const & params )
+{
+  Strategy strategy;
+  for( localIndex i = 0; i < numComponentsPerField.size(); ++i )
+  {
+    strategy.blockSize += LvArray::integerConversion< HYPRE_Int >( numComponentsPerField[i] );
+  }
+
+  GEOSX_ERROR_IF( params.numFpointsPerLevel.empty(), "The custom MGR strategy needs at least one level" );
 
-  if( numFields > 0 )
+  localIndex first = 0;
+  for( localIndex level = 0; level < params.numFpointsPerLevel.size(); ++level )
   {
-    HYPRE_Int numTotalLocalDof = 0;
-    for( HYPRE_Int i = 0; i < numFields; ++i )
+    std::vector< HYPRE_Int > eliminated;
+    for( localIndex k = first; k < first + params.numFpointsPerLevel[level]; ++k )
     {
-      numTotalLocalDof += LvArray::integerConversion< HYPRE_Int >( numLocalDofsPerField[i] );
+      GEOSX_ERROR_IF( params.fpointLabels[k] < 0 || params.fpointLabels[k] >= strategy.blockSize,
+                      "Invalid MGR label " << params.fpointLabels[k] << ", the labels are in [0," << strategy.blockSize << ")" );
+      eliminated.push_back( params.fpointLabels[k] );
     }
+    first += params.numFpointsPerLevel[level];
 
-    ret.resize( numTotalLocalDof );
+    strategy.addLevel( eliminated );
+    GEOSX_ERROR_IF( strategy.cpoints.back().empty(), "The custom MGR strategy eliminates all the labels at level " << level );
 
-    HYPRE_Int firstLabel = 0;
-    HYPRE_Int istr= 0;
-    HYPRE_Int iend;
-    HYPRE_Int numComp;
-    for( HYPRE_Int iFld = 0; iFld < numFields; ++iFld )
+    // Jacobi on the intermediate levels, AMG V-cycle on the last one
+    strategy.levelFRelaxMethod.push_back( level + 1 < params.numFpointsPerLevel.size() ? 0 : 2 );
+    strategy.levelInterpType.push_back( 2 );
+  }
+
+  strategy.numGlobalSmoothSweeps = 1;
+  strategy.coarseSolver = params.coarseSolver == "amg" ? Strategy::CoarseSolver::amg : Strategy::CoarseSolver::ilu;
+  return strategy;
+}
+
+/**
+ * @brief Get the registered strategies.
+ * @return the map from the strategy names to their builders
+ */
+inline std::map< string, StrategyBuilder > const & getStrategies()
+{
+  static std::map< string, StrategyBuilder > const strategies =
+  {
+    { "Poroelastic", poroelastic },
+    { "Hydrofracture", poroelastic },
+    { "CompositionalMultiphaseFlow", compositionalMultiphaseFlow },
+    { "CompositionalMultiphaseReservoir", compositionalMultiphaseReservoir },
+    { "SinglePhaseReservoir", singlePhaseReservoir },
+    { "Custom", custom }
+  };
+  return strategies;
+}
+
+/**
+ * @brief Build a registered strategy.
+ * @param numComponentsPerField number of components of each field
+ * @param params the MGR parameters, with the name of the strategy
+ * @return the strategy
+ */
+inline Strategy createStrategy( arraySlice1d< localIndex const > const & numComponentsPerField,
+                                LinearSolverParameters::MGR const & params )
+{
+  std::map< string, StrategyBuilder > const & strategies = getStrategies();
+  auto const iter = strategies.find( params.strategy );
+  if( iter == strategies.end() )
+  {
+    std::string available;
+    for( auto const & entry : strategies )
     {
-      numComp = LvArray::integerConversion< HYPRE_Int >( numComponentsPerField[iFld] );
-      array1d< HYPRE_Int > vectorLabels( numComp );
-      for( HYPRE_Int k = 0; k < numComp; ++k )
-      {
-        vectorLabels[k] = k + firstLabel;
-      }
-      iend = istr + LvArray::integerConversion< HYPRE_Int >( numLocalDofsPerField[iFld] );
-      for( localIndex i = istr; i < iend; i += numComp )
-      {
-        for( integer k = 0; k < numComp; ++k )
-        {
-          ret[i+k] = vectorLabels[k];
-        }
-      }
-      istr = iend;
-      firstLabel += numComp;
+      available += " " + entry.first;
     }
+    GEOSX_ERROR( "Unsupported MGR strategy: " << params.strategy << ", the available ones are:" << available );
   }
-  return ret;
+  return iter->second( numComponentsPerField, params );
 }
 
+} // namespace mgr
+
 }
 
 #endif /*GEOSX_LINEARALGEBRA_INTERFACES_HYPREMGRSTRATEGIES_HPP_*/
@@ -18,6 +18,8 @@
 
 #include "HypreMatrix.hpp"
 #include "codingUtilities/Utilities.hpp"
+#include "common/TimingMacros.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
 
 #include "HYPRE.h"
 #include "_hypre_IJ_mv.h"
@@ -204,6 +206,97 @@ void HypreMatrix::createWithLocalSize( localIndex const localRows,
               m_ij_mat );
 }
 
+void HypreMatrix::create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                          MPI_Comm const & comm )
+{
+  GEOSX_LAI_ASSERT( closed() );
+
+  reset();
+
+  localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+  localIndex const numLocalRows = localMatrix.numRows();
+  HYPRE_BigInt const ilower = MpiWrapper::PrefixSum< HYPRE_BigInt >( numLocalRows );
+  HYPRE_BigInt const iupper = ilower + numLocalRows - 1;
+
+  // The column indices and values are handed over to hypre in place, using the CRS row offsets;
+  // only the row-wise arrays are converted to hypre's index types.
+  array1d< HYPRE_BigInt > rows( numLocalRows );
+  array1d< HYPRE_Int > rowSizes( numLocalRows );
+  array1d< HYPRE_Int > rowOffsets( numLocalRows );
+  array1d< HYPRE_Int > diagSizes( numLocalRows );
+  array1d< HYPRE_Int > offdSizes( numLocalRows );
+
+  for( localIndex localRow = 0; localRow < numLocalRows; ++localRow )
+  {
+    arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( localRow );
+    HYPRE_Int numDiag = 0;
+    for( localIndex k = 0; k < columns.size(); ++k )
+    {
+      numDiag += ( columns[k] >= ilower && columns[k] <= iupper ) ? 1 : 0;
+    }
+    rows[localRow] = ilower + localRow;
+    rowSizes[localRow] = LvArray::integerConversion< HYPRE_Int >( columns.size() );
+    rowOffsets[localRow] = LvArray::integerConversion< HYPRE_Int >( localMatrix.getOffsets()[localRow] );
+    diagSizes[localRow] = numDiag;
+    offdSizes[localRow] = rowSizes[localRow] - numDiag;
+  }
+
+  GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixCreate( comm, ilower, iupper, ilower, iupper, &m_ij_mat ) );
+  GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixSetObjectType( m_ij_mat, HYPRE_PARCSR ) );
+
+  // Exact diagonal/off-diagonal sizes let hypre write the entries straight into
+  // the ParCSR blocks instead of going through its auxiliary row storage.
+  GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixSetDiagOffdSizes( m_ij_mat, diagSizes.data(), offdSizes.data() ) );
+
+  globalIndex const * columns = numLocalRows > 0 ? localMatrix.getColumns( 0 ).dataIfContiguous() : nullptr;
+  real64 const * entries = numLocalRows > 0 ? localMatrix.getEntries( 0 ).dataIfContiguous() : nullptr;
+
+#if ( defined(GEOSX_USE_CUDA) && defined(HYPRE_USING_CUDA) ) || ( defined(GEOSX_USE_HIP) && defined(HYPRE_USING_HIP) )
+  // Hand device pointers over to hypre's device CSR assembly. The CRS offsets live on the
+  // device once the matrix is moved, so the addresses of the first row are read there.
+  GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixInitialize_v2( m_ij_mat, HYPRE_MEMORY_DEVICE ) );
+  localMatrix.move( LvArray::MemorySpace::GPU, false );
+  rows.move( LvArray::MemorySpace::GPU, false );
+  rowSizes.move( LvArray::MemorySpace::GPU, false );
+  rowOffsets.move( LvArray::MemorySpace::GPU, false );
+
+  if( numLocalRows > 0 )
+  {
+    array1d< globalIndex const * > devColumns( 1 );
+    array1d< real64 const * > devEntries( 1 );
+    arrayView1d< globalIndex const * > const devColumnsView = devColumns;
+    arrayView1d< real64 const * > const devEntriesView = devEntries;
+    forAll< parallelDevicePolicy<> >( 1, [=] GEOSX_DEVICE ( localIndex const )
+    {
+      devColumnsView[0] = localMatrix.getColumns( 0 ).dataIfContiguous();
+      devEntriesView[0] = localMatrix.getEntries( 0 ).dataIfContiguous();
+    } );
+    devColumns.move( LvArray::MemorySpace::CPU, false );
+    devEntries.move( LvArray::MemorySpace::CPU, false );
+    columns = devColumns[0];
+    entries = devEntries[0];
+  }
+#else
+  GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixInitialize( m_ij_mat ) );
+#endif
+
+  m_closed = false;
+
+  if( numLocalRows > 0 )
+  {
+    GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixSetValues2( m_ij_mat,
+                                                     LvArray::integerConversion< HYPRE_Int >( numLocalRows ),
+                                                     rowSizes.data(),
+                                                     rows.data(),
+                                                     rowOffsets.data(),
+                                                     toHYPRE_BigInt( columns ),
+                                                     entries ) );
+  }
+
+  close();
+}
+
 void HypreMatrix::set( real64 const value )
 {
   GEOSX_LAI_ASSERT( ready() );
@@ -533,6 +626,8 @@ void HypreMatrix::insert( globalIndex const * rowIndices,
 void HypreMatrix::apply( HypreVector const & src,
                          HypreVector & dst ) const
 {
+  GEOSX_MARK_FUNCTION;
+
   GEOSX_LAI_ASSERT( ready() );
   GEOSX_LAI_ASSERT( src.ready() );
   GEOSX_LAI_ASSERT( dst.ready() );
@@ -56,7 +56,7 @@ HyprePreconditioner::HyprePreconditioner( LinearSolverParameters params,
       }
       case LinearSolverParameters::PreconditionerType::amg:
       {
-        createAMG();
+        createAMG( dofManager );
         break;
       }
       case LinearSolverParameters::PreconditionerType::mgr:
@@ -122,7 +122,7 @@ HYPRE_Int getHypreAMGRelaxationType( string const & type )
 
 }
 
-void HyprePreconditioner::createAMG()
+void HyprePreconditioner::createAMG( DofManager const * const dofManager )
 {
   GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGCreate( &m_precond ) );
 
@@ -193,6 +193,27 @@ void HyprePreconditioner::createAMG()
     GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetStrongThreshold( m_precond, m_parameters.amg.threshold ) );
   }
 
+  // Set the number of levels with aggressive coarsening and the truncation of the interpolation,
+  // which reduce the size of the hierarchy and the memory traffic of each cycle
+  if( m_parameters.amg.aggressiveNumLevels > 0 )
+  {
+    GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetAggNumLevels( m_precond, toHYPRE_Int( m_parameters.amg.aggressiveNumLevels ) ) );
+  }
+  if( m_parameters.amg.interpMaxNonZeros > 0 )
+  {
+    GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetPMaxElmts( m_precond, toHYPRE_Int( m_parameters.amg.interpMaxNonZeros ) ) );
+    GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetAggPMaxElmts( m_precond, toHYPRE_Int( m_parameters.amg.interpMaxNonZeros ) ) );
+  }
+
+  // With the block storage, coarsen the support points instead of the scalar unknowns
+  // (row-sum norm of the blocks) and interpolate each field component separately
+  localIndex const blockSize = ( m_parameters.blockStorage && dofManager != nullptr ) ? dofManager->blockSize() : 1;
+  if( blockSize > 1 )
+  {
+    GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetNumFunctions( m_precond, toHYPRE_Int( blockSize ) ) );
+    GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetNodal( m_precond, 4 ) );
+  }
+
   m_functions->setup = HYPRE_BoomerAMGSetup;
   m_functions->apply = HYPRE_BoomerAMGSolve;
   m_functions->destroy = HYPRE_BoomerAMGDestroy;
@@ -231,9 +252,14 @@ void HyprePreconditioner::createMGR( DofManager const * const dofManager )
   array1d< localIndex > numComponentsPerField = dofManager->numComponentsPerField();
   array1d< localIndex > numLocalDofsPerField = dofManager->numLocalDofsPerField();
 
+  // the labels are read from the DoF numbering, which may interleave the fields
+  array1d< localIndex > const labels = dofManager->getLocalDofComponentLabels();
   m_auxData = std::unique_ptr< HyprePrecAuxData >( new HyprePrecAuxData() );
-  m_auxData->point_marker_array = computeLocalDofComponentLabels( numComponentsPerField,
-                                                                  numLocalDofsPerField );
+  m_auxData->point_marker_array.resize( labels.size() );
+  for( localIndex i = 0; i < labels.size(); ++i )
+  {
+    m_auxData->point_marker_array[i] = toHYPRE_Int( labels[i] );
+  }
 
   if( m_parameters.logLevel >= 1 )
   {
@@ -245,282 +271,84 @@ void HyprePreconditioner::createMGR( DofManager const * const dofManager )
   }
   if( m_parameters.logLevel >= 3 )
   {
-    GEOSX_LOG_RANK_VAR( computeLocalDofComponentLabels( numComponentsPerField,
-                                                        numLocalDofsPerField ) );
+    GEOSX_LOG_RANK_VAR( labels );
   }
 
-  HYPRE_Int mgr_bsize;
-  HYPRE_Int mgr_nlevels;
-  std::vector< HYPRE_Int > mgr_num_cindexes;
-  std::vector< std::vector< HYPRE_Int > > lv_cindexes;
-  std::vector< HYPRE_Int * > mgr_cindexes;
+  mgr::Strategy strategy = mgr::createStrategy( numComponentsPerField, m_parameters.mgr );
+  HYPRE_Int const mgr_nlevels = strategy.numLevels();
 
-  std::vector< HYPRE_Int > mgr_coarse_grid_method;
-  std::vector< HYPRE_Int > mgr_level_interp_type;
-  std::vector< HYPRE_Int > mgr_level_frelax_method;
-
-  if( ( m_parameters.mgr.strategy == "Poroelastic" ) | ( m_parameters.mgr.strategy == "Hydrofracture" ) )
+  std::vector< HYPRE_Int > mgr_num_cindexes( mgr_nlevels );
+  std::vector< HYPRE_Int * > mgr_cindexes( mgr_nlevels );
+  for( HYPRE_Int iLevel = 0; iLevel < mgr_nlevels; ++iLevel )
   {
-    // Note: at the moment we assume single-phase flow poroelasticity
-    //
-    // dofLabel: 0 = displacement, x-component
-    // dofLabel: 1 = displacement, y-component
-    // dofLabel: 2 = displacement, z-component
-    // dofLabel: 3 = pressure
-    //
-    // Ingredients
-    //
-    // 1. F-points displacement (0,1,2), C-points pressure (3)
-    // 2. F-points smoother: AMG, single V-cycle, separate displacemente components
-    // 3. C-points coarse-grid/Schur complement solver: boomer AMG
-    // 4. Global smoother: none
-
-    mgr_nlevels = 1;
-    mgr_bsize = 4;
-
-    mgr_num_cindexes.resize( mgr_nlevels );
-    mgr_num_cindexes[0] = 1; // Eliminate displacement components
-
-    lv_cindexes.resize( mgr_nlevels );
-    lv_cindexes[0].push_back( 3 );
-
-    mgr_cindexes.resize( mgr_nlevels );
-    for( HYPRE_Int iLevel = 0; iLevel < mgr_nlevels; ++iLevel )
-    {
-      mgr_cindexes[iLevel] = lv_cindexes[iLevel].data();
-    }
-
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetCpointsByPointMarkerArray( m_precond, mgr_bsize, mgr_nlevels,
-                                                                  mgr_num_cindexes.data(),
-                                                                  mgr_cindexes.data(),
-                                                                  m_auxData->point_marker_array.data() ) );
-
+    mgr_num_cindexes[iLevel] = LvArray::integerConversion< HYPRE_Int >( strategy.cpoints[iLevel].size() );
+    mgr_cindexes[iLevel] = strategy.cpoints[iLevel].data();
+  }
 
-    mgr_level_interp_type.resize( mgr_nlevels );
-    mgr_level_interp_type[0] = 2; //diagonal scaling (Jacobi)
+  GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetCpointsByPointMarkerArray( m_precond, strategy.blockSize, mgr_nlevels,
+                                                                mgr_num_cindexes.data(),
+                                                                mgr_cindexes.data(),
+                                                                m_auxData->point_marker_array.data() ) );
 
-    mgr_coarse_grid_method.resize( mgr_nlevels );
-    if( m_parameters.mgr.strategy == "Poroelastic" )
-    {
-      mgr_coarse_grid_method[0] = 1; //diagonal sparsification
-    }
-    else
-    {
-      mgr_coarse_grid_method[0] = 0; //Galerkin coarse grid computation using RAP
-    }
-
-    GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGCreate( &aux_precond ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetPrintLevel( aux_precond, 0 ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetMaxIter( aux_precond, 1 ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetTol( aux_precond, 0.0 ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetRelaxOrder( aux_precond, 1 ) );
-
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetFRelaxMethod( m_precond, 2 ) ); // AMG V-cycle
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetNonCpointsToFpoints( m_precond, 1 ));
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetPMaxElmts( m_precond, 0 ));
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetLevelInterpType( m_precond, mgr_level_interp_type.data() ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetCoarseGridMethod( m_precond, mgr_coarse_grid_method.data() ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetMaxGlobalsmoothIters( m_precond, 0 ) );
-    GEOSX_LAI_CHECK_ERROR(
-      HYPRE_MGRSetCoarseSolver( m_precond,
-                                (HYPRE_PtrToParSolverFcn)HYPRE_BoomerAMGSolve,
-                                (HYPRE_PtrToParSolverFcn)HYPRE_BoomerAMGSetup,
-                                aux_precond )
-      );
-
-    m_functions->aux_destroy = HYPRE_BoomerAMGDestroy;
+  if( !strategy.levelFRelaxMethod.empty() )
+  {
+    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetLevelFRelaxMethod( m_precond, strategy.levelFRelaxMethod.data() ) );
   }
-  else if( m_parameters.mgr.strategy == "CompositionalMultiphaseFlow" )
+  if( !strategy.levelInterpType.empty() )
   {
-    // Labels description stored in point_marker_array
-    //             0 = pressure
-    //             1 = density
-    //           ... = densities
-    // numLabels - 1 = density
-    //
-    // 2-level MGR reduction strategy which seems to work well for 2 components
-    // 1st level: eliminate the reservoir density associated with the volume constraint
-    // 2nd level: eliminate the pressure
-    // The coarse grid solved with ILU(0)
-    //
-    // TODO:
-    // - Experiment with block Jacobi for F-relaxation/interpolation of the reservoir densities
-    // - Explore ways to reduce onto the pressure variable and use AMG for coarse-grid solve
-    HYPRE_Int numLabels = LvArray::integerConversion< HYPRE_Int >( numComponentsPerField[0] );
-
-    mgr_bsize = numLabels;
-    mgr_nlevels = 2;
-
-    /* options for solvers at each level */
-    HYPRE_Int mgr_gsmooth_type = 16; // ILU(0)
-    HYPRE_Int mgr_num_gsmooth_sweeps = 1;
-
-    mgr_level_frelax_method.resize( mgr_nlevels );
-    mgr_level_frelax_method[0] = 0; // Jacobi
-    mgr_level_frelax_method[1] = 2; // AMG V-cycle
-
-    mgr_num_cindexes.resize( mgr_nlevels );
-    mgr_num_cindexes[0] = mgr_bsize - 1; // eliminate the last density reservoir block
-    mgr_num_cindexes[1] = mgr_bsize - 2; // eliminate pressure
-
-    lv_cindexes.resize( mgr_nlevels );
-    for( int cid=0; cid < mgr_bsize; cid++ )
-    {
-      // All points except the last density
-      // which corresponds to the volume constraint equation
-      if( cid < numLabels - 1 )
-      {
-        lv_cindexes[0].push_back( cid );
-      }
-    }
-    for( auto & cid : lv_cindexes[0] )
-    {
-      // eliminate pressure
-      if( cid != 0 )
-      {
-        lv_cindexes[1].push_back( cid );
-      }
-    }
-
-    mgr_cindexes.resize( mgr_nlevels );
-    for( HYPRE_Int iLevel = 0; iLevel < mgr_nlevels; ++iLevel )
-    {
-      mgr_cindexes[iLevel] = lv_cindexes[iLevel].data();
-    }
-
-
-    GEOSX_LAI_CHECK_ERROR( HYPRE_ILUCreate( &aux_precond ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_ILUSetType( aux_precond, 0 ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_ILUSetLevelOfFill( aux_precond, 0 ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_ILUSetMaxIter( aux_precond, 1 ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_ILUSetTol( aux_precond, 0.0 ) );
-
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetCpointsByPointMarkerArray( m_precond, mgr_bsize, mgr_nlevels,
-                                                                  mgr_num_cindexes.data(),
-                                                                  mgr_cindexes.data(),
-                                                                  m_auxData->point_marker_array.data() ) );
-
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetLevelFRelaxMethod( m_precond, mgr_level_frelax_method.data() ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetNonCpointsToFpoints( m_precond, 1 ));
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetGlobalsmoothType( m_precond, mgr_gsmooth_type ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetMaxGlobalsmoothIters( m_precond, mgr_num_gsmooth_sweeps ) );
-    GEOSX_LAI_CHECK_ERROR(
-      HYPRE_MGRSetCoarseSolver( m_precond,
-                                (HYPRE_PtrToParSolverFcn)HYPRE_ILUSolve,
-                                (HYPRE_PtrToParSolverFcn)HYPRE_ILUSetup,
-                                aux_precond )
-      );
-    m_functions->aux_destroy = HYPRE_ILUDestroy;
+    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetLevelInterpType( m_precond, strategy.levelInterpType.data() ) );
   }
-  else if( m_parameters.mgr.strategy == "CompositionalMultiphaseReservoir" )
+  if( !strategy.coarseGridMethod.empty() )
   {
-    // Labels description stored in point_marker_array
-    //                0 = reservoir pressure
-    //                1 = reservoir density
-    //              ... = ... (reservoir densities)
-    // numResLabels - 1 = reservoir density
-    //     numResLabels = well pressure
-    // numResLabels + 1 = well density
-    //              ... = ... (well densities)
-    // numResLabels + numWellLabels - 2 = well density
-    // numResLabels + numWellLabels - 1 = well rate
-    //
-    // 3-level MGR reduction strategy which seems to work well for 2 components
-    // 1st level: eliminate the reservoir density associated with the volume constraint
-    // 2nd level: eliminate the rest of the reservoir densities
-    // 3rd level: eliminate the pressure
-    // The coarse grid is the well block and solved with ILU(0)
-    //
-    // TODO:
-    // - Use block Jacobi for F-relaxation/interpolation of the reservoir densities (2nd level)
-
-    HYPRE_Int numResLabels = LvArray::integerConversion< HYPRE_Int >( numComponentsPerField[0] );
-    HYPRE_Int numWellLabels = LvArray::integerConversion< HYPRE_Int >( numComponentsPerField[1] );
-
-    mgr_bsize = numResLabels + numWellLabels;
-    mgr_nlevels = 3;
-
-    /* options for solvers at each level */
-    HYPRE_Int mgr_gsmooth_type = 16; // ILU(0)
-    HYPRE_Int mgr_num_gsmooth_sweeps = 1;
-
-    mgr_level_interp_type.resize( mgr_nlevels );
-    mgr_level_interp_type[0] = 2;
-    mgr_level_interp_type[1] = 2;
-    mgr_level_interp_type[2] = 2;
-
-    mgr_level_frelax_method.resize( mgr_nlevels );
-    mgr_level_frelax_method[0] = 0; // Jacobi
-    mgr_level_frelax_method[1] = 0; // Jacobi
-    mgr_level_frelax_method[2] = 2; // AMG V-cycle
-
-    mgr_num_cindexes.resize( mgr_nlevels );
-    mgr_num_cindexes[0] = mgr_bsize - 1; // eliminate the last density in the reservoir block
-    mgr_num_cindexes[1] = mgr_bsize - numResLabels + 1; // eliminate all densities reservoir block
-    mgr_num_cindexes[2] = mgr_bsize - numResLabels; // eliminate reservoir block
-
-    lv_cindexes.resize( mgr_nlevels );
-    for( int cid=0; cid < mgr_bsize; cid++ )
-    {
-      // All points except the last reservoir density
-      // which corresponds to the volume constraint equation
-      if( cid != numResLabels - 1 )
-      {
-        lv_cindexes[0].push_back( cid );
-      }
-    }
-    for( auto & cid : lv_cindexes[0] )
-    {
-      // eliminate the rest of the reservoir densities
-      if( cid == 0 || cid >= numResLabels )
-      {
-        lv_cindexes[1].push_back( cid );
-      }
-    }
-    for( auto & cid : lv_cindexes[1] )
+    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetCoarseGridMethod( m_precond, strategy.coarseGridMethod.data() ) );
+  }
+  if( strategy.pMaxElmts >= 0 )
+  {
+    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetPMaxElmts( m_precond, strategy.pMaxElmts ) );
+  }
+  GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetNonCpointsToFpoints( m_precond, 1 ) );
+  if( strategy.numGlobalSmoothSweeps > 0 )
+  {
+    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetGlobalsmoothType( m_precond, strategy.globalSmoothType ) );
+  }
+  GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetMaxGlobalsmoothIters( m_precond, strategy.numGlobalSmoothSweeps ) );
+
+  switch( strategy.coarseSolver )
+  {
+    case mgr::Strategy::CoarseSolver::amg:
     {
-      // eliminate the reservoir pressure
-      if( cid != 0 )
-      {
-        lv_cindexes[2].push_back( cid );
-      }
+      GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGCreate( &aux_precond ) );
+      GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetPrintLevel( aux_precond, 0 ) );
+      GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetMaxIter( aux_precond, 1 ) );
+      GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetTol( aux_precond, 0.0 ) );
+      GEOSX_LAI_CHECK_ERROR( HYPRE_BoomerAMGSetRelaxOrder( aux_precond, 1 ) );
+      GEOSX_LAI_CHECK_ERROR(
+        HYPRE_MGRSetCoarseSolver( m_precond,
+                                  (HYPRE_PtrToParSolverFcn)HYPRE_BoomerAMGSolve,
+                                  (HYPRE_PtrToParSolverFcn)HYPRE_BoomerAMGSetup,
+                                  aux_precond )
+        );
+      m_functions->aux_destroy = HYPRE_BoomerAMGDestroy;
+      break;
     }
-
-    mgr_cindexes.resize( mgr_nlevels );
-    for( HYPRE_Int iLevel = 0; iLevel < mgr_nlevels; ++iLevel )
+    case mgr::Strategy::CoarseSolver::ilu:
     {
-      mgr_cindexes[iLevel] = lv_cindexes[iLevel].data();
+      GEOSX_LAI_CHECK_ERROR( HYPRE_ILUCreate( &aux_precond ) );
+      GEOSX_LAI_CHECK_ERROR( HYPRE_ILUSetType( aux_precond, 0 ) ); // Block Jacobi - ILU
+      GEOSX_LAI_CHECK_ERROR( HYPRE_ILUSetLevelOfFill( aux_precond, 0 ) );
+      GEOSX_LAI_CHECK_ERROR( HYPRE_ILUSetMaxIter( aux_precond, 1 ) );
+      GEOSX_LAI_CHECK_ERROR( HYPRE_ILUSetTol( aux_precond, 0.0 ) );
+      GEOSX_LAI_CHECK_ERROR(
+        HYPRE_MGRSetCoarseSolver( m_precond,
+                                  (HYPRE_PtrToParSolverFcn)HYPRE_ILUSolve,
+                                  (HYPRE_PtrToParSolverFcn)HYPRE_ILUSetup,
+                                  aux_precond )
+        );
+      m_functions->aux_destroy = HYPRE_ILUDestroy;
+      break;
     }
-
-    GEOSX_LAI_CHECK_ERROR( HYPRE_ILUCreate( &aux_precond ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_ILUSetType( aux_precond, 0 ) ); // Block Jacobi - ILU
-    GEOSX_LAI_CHECK_ERROR( HYPRE_ILUSetLevelOfFill( aux_precond, 0 ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_ILUSetMaxIter( aux_precond, 1 ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_ILUSetTol( aux_precond, 0.0 ) );
-
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetCpointsByPointMarkerArray( m_precond, mgr_bsize, mgr_nlevels,
-                                                                  mgr_num_cindexes.data(),
-                                                                  mgr_cindexes.data(),
-                                                                  m_auxData->point_marker_array.data() ) );
-
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetLevelFRelaxMethod( m_precond, mgr_level_frelax_method.data() ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetNonCpointsToFpoints( m_precond, 1 ));
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetLevelInterpType( m_precond, mgr_level_interp_type.data() ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetGlobalsmoothType( m_precond, mgr_gsmooth_type ) );
-    GEOSX_LAI_CHECK_ERROR( HYPRE_MGRSetMaxGlobalsmoothIters( m_precond, mgr_num_gsmooth_sweeps ) );
-    GEOSX_LAI_CHECK_ERROR(
-      HYPRE_MGRSetCoarseSolver( m_precond,
-                                (HYPRE_PtrToParSolverFcn)HYPRE_ILUSolve,
-                                (HYPRE_PtrToParSolverFcn)HYPRE_ILUSetup,
-                                aux_precond )
-      );
-
-    m_functions->aux_destroy = HYPRE_ILUDestroy;
-  }
-  else
-  {
-    GEOSX_ERROR( "Unsupported MGR strategy: " << m_parameters.mgr.strategy );
   }
+
   m_functions->setup = HYPRE_MGRSetup;
   m_functions->apply = HYPRE_MGRSolve;
   m_functions->destroy = HYPRE_MGRDestroy;
@@ -115,7 +115,7 @@ public:
 
 private:
 
-  void createAMG();
+  void createAMG( DofManager const * const dofManager );
 
   void createMGR( DofManager const * const dofManager );
 
@@ -19,6 +19,7 @@
 #include "HypreSolver.hpp"
 
 #include "common/Stopwatch.hpp"
+#include "common/TimingMacros.hpp"
 #include "linearAlgebra/DofManager.hpp"
 #include "linearAlgebra/interfaces/hypre/HypreMatrix.hpp"
 #include "linearAlgebra/interfaces/hypre/HypreVector.hpp"
@@ -46,6 +47,20 @@ HypreSolver::HypreSolver( LinearSolverParameters parameters )
   m_parameters( std::move( parameters ) )
 { }
 
+HypreSolver::~HypreSolver()
+{
+  if( m_superluData )
+  {
+    SuperLU_DistDestroy( *m_superluData );
+  }
+#ifdef GEOSX_USE_SUITESPARSE
+  if( m_suiteSparseData )
+  {
+    SuiteSparseDestroy( *m_suiteSparseData );
+  }
+#endif
+}
+
 
 //// ----------------------------
 //// Top-Level Solver
@@ -77,13 +92,23 @@ void solve_parallelDirect( LinearSolverParameters const & parameters,
                            HypreMatrix & mat,
                            HypreVector & sol,
                            HypreVector & rhs,
-                           LinearSolverResult & result )
+                           LinearSolverResult & result,
+                           std::unique_ptr< SuperLU_DistData > & data )
 {
   // To be able to use SuperLU_Dist solver we need to disable floating point exceptions
   LvArray::system::FloatingPointExceptionGuard guard;
 
-  SuperLU_DistData SLUDData;
-  SuperLU_DistCreate( mat, parameters, SLUDData );
+  // The factorization of the previous solve is reused if the sparsity pattern has not changed
+  if( !data || !SuperLU_DistUpdate( mat, *data ) )
+  {
+    if( data )
+    {
+      SuperLU_DistDestroy( *data );
+    }
+    data = std::make_unique< SuperLU_DistData >();
+    SuperLU_DistCreate( mat, parameters, *data );
+  }
+  SuperLU_DistData & SLUDData = *data;
 
   int info = 0;
   real64 timeSetup;
@@ -113,7 +138,11 @@ void solve_parallelDirect( LinearSolverParameters const & parameters,
     result.status = LinearSolverResult::Status::Breakdown;
   }
 
-  SuperLU_DistDestroy( SLUDData );
+  if( !parameters.direct.reuseSymbolic || result.status != LinearSolverResult::Status::Success )
+  {
+    SuperLU_DistDestroy( SLUDData );
+    data.reset();
+  }
 }
 
 #ifdef GEOSX_USE_SUITESPARSE
@@ -121,13 +150,23 @@ void solve_serialDirect( LinearSolverParameters const & parameters,
                          HypreMatrix & mat,
                          HypreVector & sol,
                          HypreVector & rhs,
-                         LinearSolverResult & result )
+                         LinearSolverResult & result,
+                         std::unique_ptr< SuiteSparseData > & data )
 {
   // To be able to use UMFPACK direct solver we need to disable floating point exceptions
   LvArray::system::FloatingPointExceptionGuard guard;
 
-  SuiteSparseData SSData;
-  SuiteSparseCreate( mat, parameters, SSData );
+  // The symbolic factorization of the previous solve is reused if the sparsity pattern has not changed
+  if( !data || !SuiteSparseUpdate( mat, *data ) )
+  {
+    if( data )
+    {
+      SuiteSparseDestroy( *data );
+    }
+    data = std::make_unique< SuiteSparseData >();
+    SuiteSparseCreate( mat, parameters, *data );
+  }
+  SuiteSparseData & SSData = *data;
 
   int info = 0;
   real64 timeSetup;
@@ -157,7 +196,11 @@ void solve_serialDirect( LinearSolverParameters const & parameters,
     result.status = LinearSolverResult::Status::Breakdown;
   }
 
-  SuiteSparseDestroy( SSData );
+  if( !parameters.direct.reuseSymbolic || result.status != LinearSolverResult::Status::Success )
+  {
+    SuiteSparseDestroy( SSData );
+    data.reset();
+  }
 }
 #endif
 
@@ -292,12 +335,12 @@ void HypreSolver::solve_direct( HypreMatrix & mat,
 {
   if( m_parameters.direct.parallel )
   {
-    solve_parallelDirect( m_parameters, mat, sol, rhs, m_result );
+    solve_parallelDirect( m_parameters, mat, sol, rhs, m_result, m_superluData );
   }
   else
   {
 #ifdef GEOSX_USE_SUITESPARSE
-    solve_serialDirect( m_parameters, mat, sol, rhs, m_result );
+    solve_serialDirect( m_parameters, mat, sol, rhs, m_result, m_suiteSparseData );
 #else
     GEOSX_ERROR( "Hypre direct solver interface: serial direct solver not available (try to compile GEOSX TPLs with SuiteSparse)." );
 #endif
@@ -359,18 +402,25 @@ void HypreSolver::solve_krylov( HypreMatrix & mat,
                                                  precond.unwrapped() ) );
 
   // Setup
-  GEOSX_LAI_CHECK_ERROR( solverFuncs.setup( solver,
-                                            precondMat.unwrapped(),
-                                            rhs.unwrapped(),
-                                            sol.unwrapped() ) );
+  {
+    GEOSX_MARK_SCOPE( linearSetup );
+    GEOSX_LAI_CHECK_ERROR( solverFuncs.setup( solver,
+                                              precondMat.unwrapped(),
+                                              rhs.unwrapped(),
+                                              sol.unwrapped() ) );
+  }
   m_result.setupTime = watch.elapsedTime();
 
   // Solve
   watch.zero();
-  HYPRE_Int const result = solverFuncs.solve( solver,
-                                              mat.unwrapped(),
-                                              rhs.unwrapped(),
-                                              sol.unwrapped() );
+  HYPRE_Int result;
+  {
+    GEOSX_MARK_SCOPE( linearSolve );
+    result = solverFuncs.solve( solver,
+                                mat.unwrapped(),
+                                rhs.unwrapped(),
+                                sol.unwrapped() );
+  }
   m_result.solveTime = watch.elapsedTime();
 
   // Set result status based on return value
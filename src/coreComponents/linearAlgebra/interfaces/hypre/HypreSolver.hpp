@@ -22,12 +22,16 @@
 #include "linearAlgebra/utilities/LinearSolverParameters.hpp"
 #include "linearAlgebra/utilities/LinearSolverResult.hpp"
 
+#include <memory>
+
 namespace geosx
 {
 
 class DofManager;
 class HypreVector;
 class HypreMatrix;
+struct SuperLU_DistData;
+struct SuiteSparseData;
 
 /**
  * @brief This class creates and provides basic support for Hypre solvers.
@@ -45,7 +49,7 @@ public:
   /**
    * @brief Virtual destructor.
    */
-  virtual ~HypreSolver() = default;
+  virtual ~HypreSolver();
 
   /**
    * @brief Solve system with an iterative solver (HARD CODED PARAMETERS, GMRES).
@@ -75,6 +79,14 @@ private:
   LinearSolverParameters m_parameters;
   LinearSolverResult m_result;
 
+  /// SuperLU_Dist factorization kept between solves to reuse its symbolic part
+  std::unique_ptr< SuperLU_DistData > m_superluData;
+
+#ifdef GEOSX_USE_SUITESPARSE
+  /// SuiteSparse factorization kept between solves to reuse its symbolic part
+  std::unique_ptr< SuiteSparseData > m_suiteSparseData;
+#endif
+
   void solve_direct( HypreMatrix & mat,
                      HypreVector & sol,
                      HypreVector & rhs );
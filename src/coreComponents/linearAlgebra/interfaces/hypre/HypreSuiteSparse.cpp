@@ -20,6 +20,7 @@
 #define DLONG
 #endif
 
+#include <algorithm>
 #include <numeric>
 
 #include "HypreSuiteSparse.hpp"
@@ -150,6 +151,7 @@ void SuiteSparseCreate( HypreMatrix const & matrix,
 {
   // Get the default control parameters
   umfpack_dl_defaults( SSData.Control );
+  SSData.logLevel = params.logLevel;
   SSData.Control[UMFPACK_PRL] = params.logLevel > 1 ? 6 : 1;
   SSData.Control[UMFPACK_ORDERING] = UMFPACK_ORDERING_BEST;
 
@@ -157,6 +159,38 @@ void SuiteSparseCreate( HypreMatrix const & matrix,
   ConvertToSuiteSparseMatrix( matrix, SSData );
 }
 
+bool SuiteSparseUpdate( HypreMatrix const & matrix,
+                        SuiteSparseData & SSData )
+{
+  SuiteSparseData newData;
+  newData.logLevel = SSData.logLevel;
+  std::copy( SSData.Control, SSData.Control + UMFPACK_CONTROL, newData.Control );
+  ConvertToSuiteSparseMatrix( matrix, newData );
+
+  int samePattern = newData.workingRank == SSData.workingRank;
+  if( samePattern && MpiWrapper::Comm_rank( SSData.comm ) == SSData.workingRank )
+  {
+    samePattern = newData.numRows == SSData.numRows &&
+                  newData.nonZeros == SSData.nonZeros &&
+                  std::equal( SSData.rowPtr, SSData.rowPtr + SSData.numRows + 1, newData.rowPtr ) &&
+                  std::equal( SSData.colIndices, SSData.colIndices + SSData.nonZeros, newData.colIndices );
+  }
+  samePattern = MpiWrapper::Min( samePattern, SSData.comm );
+
+  if( !samePattern )
+  {
+    SuiteSparseDestroy( newData );
+    return false;
+  }
+
+  // The symbolic factorization moves to the new matrix, the numeric one is recomputed by the next setup
+  newData.Symbolic = SSData.Symbolic;
+  SSData.Symbolic = nullptr;
+  SuiteSparseDestroy( SSData );
+  SSData = newData;
+  return true;
+}
+
 int SuiteSparseSetup( SuiteSparseData & SSData,
                       real64 & time )
 {
@@ -165,7 +199,7 @@ int SuiteSparseSetup( SuiteSparseData & SSData,
   int status = 0;
 
   int const rank = MpiWrapper::Comm_rank( SSData.comm );
-  if( rank == SSData.workingRank )
+  if( rank == SSData.workingRank && SSData.Symbolic == nullptr )
   {
     // symbolic factorization
     status = umfpack_dl_symbolic( SSData.numCols,
@@ -188,7 +222,10 @@ int SuiteSparseSetup( SuiteSparseData & SSData,
     {
       umfpack_dl_report_symbolic( SSData.Symbolic, SSData.Control );
     }
+  }
 
+  if( rank == SSData.workingRank )
+  {
     // numeric factorization
     status = umfpack_dl_numeric( SSData.rowPtr,
                                  SSData.colIndices,
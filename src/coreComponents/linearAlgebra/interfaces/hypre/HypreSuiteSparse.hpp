@@ -50,8 +50,8 @@ struct SuiteSparseData
   real64 * data;                      //!< values
   real64 Info[UMFPACK_INFO];          //!< data structure to gather various info
   real64 Control[UMFPACK_CONTROL];    //!< SuiteSparse options
-  void * Symbolic;                    //!< pointer to the symbolic factorization
-  void * Numeric;                     //!< pointer to the numeric factorization
+  void * Symbolic = nullptr;          //!< pointer to the symbolic factorization
+  void * Numeric = nullptr;           //!< pointer to the numeric factorization
   MPI_Comm comm;                      //!< MPI communicator
   int workingRank;                    //!< MPI rank carring out the solution
 };
@@ -67,7 +67,18 @@ void SuiteSparseCreate( HypreMatrix const & matrix,
                         SuiteSparseData & SSData );
 
 /**
- * @brief Factorizes a linear system with SuiteSparse
+ * @brief Replaces the matrix of a factorized SuiteSparse data structure, keeping the symbolic
+ *        factorization for the next setup
+ * @param[in] matrix the new HypreMatrix object
+ * @param[in,out] SSData the structure containing the factorized matrix in SuiteSparse format
+ * @return @p false, leaving @p SSData unchanged, if the sparsity pattern of @p matrix differs
+ *         from the one of the factorized matrix
+ */
+bool SuiteSparseUpdate( HypreMatrix const & matrix,
+                        SuiteSparseData & SSData );
+
+/**
+ * @brief Factorizes a linear system with SuiteSparse, only numerically if the structure has been updated
  * @param[in,out] SSData the structure containing the matrix in SuiteSparse format
  * @param[out] time time spent in the factorization phase
  * @return info error code
@@ -127,6 +127,30 @@ void ConvertToSuperMatrix( HypreMatrix const & matrix,
                                   SLU_NR_loc,
                                   SLU_D,
                                   SLU_GE );
+
+  // Keep the sparsity pattern, SuperLU_Dist owns the arrays of the matrix
+  HYPRE_BigInt const * const hypreJ = hypre_CSRMatrixBigJ( SLUDData.localStrip );
+  SLUDData.patternRows.resize( matrix.numLocalRows() + 1 );
+  SLUDData.patternCols.resize( matrix.numLocalNonzeros() );
+  std::copy( SLUDData.rowPtr, SLUDData.rowPtr + SLUDData.patternRows.size(), SLUDData.patternRows.begin() );
+  std::copy( hypreJ, hypreJ + SLUDData.patternCols.size(), SLUDData.patternCols.begin() );
+}
+
+/**
+ * @brief Deallocates the matrix in SuperLU_Dist format
+ * @param[in,out] SLUDData the structure containing the matrix in SuperLU_Dist format
+ */
+void DestroySuperMatrix( SuperLU_DistData & SLUDData )
+{
+  // From HYPRE SuperLU_Dist interfaces (superlu.c)
+  // SuperLU frees assigned data, so set them to null before
+  // calling hypre_CSRMatrixdestroy on localStrip to avoid memory errors.
+  hypre_CSRMatrixI( SLUDData.localStrip ) = NULL;
+  hypre_CSRMatrixData( SLUDData.localStrip ) = NULL;
+  hypre_CSRMatrixBigJ( SLUDData.localStrip ) = NULL;
+  hypre_CSRMatrixDestroy( SLUDData.localStrip );
+
+  Destroy_CompRowLoc_Matrix_dist( &SLUDData.mat );
 }
 }
 
@@ -157,6 +181,43 @@ void SuperLU_DistCreate( HypreMatrix const & matrix,
   SLUDData.comm = matrix.getComm();
 }
 
+bool SuperLU_DistUpdate( HypreMatrix const & matrix,
+                         SuperLU_DistData & SLUDData )
+{
+  GEOSX_LAI_ASSERT( SLUDData.factorized );
+
+  bool samePattern = matrix.numGlobalRows() == SLUDData.mat.nrow &&
+                     matrix.numLocalRows() + 1 == SLUDData.patternRows.size() &&
+                     matrix.numLocalNonzeros() == SLUDData.patternCols.size();
+
+  hypre_CSRMatrix * const localStrip = hypre_MergeDiagAndOffd( matrix.unwrapped() );
+  if( samePattern )
+  {
+    HYPRE_Int const * const hypreI = hypre_CSRMatrixI( localStrip );
+    HYPRE_BigInt const * const hypreJ = hypre_CSRMatrixBigJ( localStrip );
+    samePattern = std::equal( SLUDData.patternRows.begin(), SLUDData.patternRows.end(), hypreI ) &&
+                  std::equal( SLUDData.patternCols.begin(), SLUDData.patternCols.end(), hypreJ );
+  }
+  hypre_CSRMatrixDestroy( localStrip );
+
+  if( !MpiWrapper::Min( samePattern ? 1 : 0, SLUDData.comm ) )
+  {
+    return false;
+  }
+
+  // Deallocate the factors and the matrix, the permutations and the symbolic structure are kept
+  dDestroy_LU( SLUDData.mat.nrow, &SLUDData.grid, &SLUDData.LUstruct );
+  PStatFree( &SLUDData.stat );
+  if( SLUDData.options.SolveInitialized )
+  {
+    dSolveFinalize( &SLUDData.options, &SLUDData.SOLVEstruct );
+  }
+  DestroySuperMatrix( SLUDData );
+
+  ConvertToSuperMatrix( matrix, SLUDData );
+  return true;
+}
+
 int SuperLU_DistSetup( SuperLU_DistData & SLUDData,
                        real64 & time )
 {
@@ -165,32 +226,41 @@ int SuperLU_DistSetup( SuperLU_DistData & SLUDData,
   int_t const m = SLUDData.mat.nrow;
   int_t const n = SLUDData.mat.ncol;
 
-  // Initialize ScalePermstruct.
-  dScalePermstructInit( m, n, &SLUDData.ScalePermstruct );
-
-  // Initialize LUstruct.
-  dLUstructInit( n, &SLUDData.LUstruct );
-
   // Initialize the statistics variables.
   PStatInit( &SLUDData.stat );
 
-  // Create process grid: the target is to have the process grid as square as possible
-  int const num_procs = MpiWrapper::Comm_size( SLUDData.comm );
-  int prows = static_cast< int >( std::sqrt( num_procs ) );
-  while( num_procs % prows )
+  // A matrix with the same sparsity pattern as the factorized one is only factorized numerically
+  if( SLUDData.factorized )
   {
-    --prows;
+    SLUDData.options.Fact = SamePattern;
   }
-  int pcols = num_procs/prows;
-  std::tie( prows, pcols ) = std::minmax( prows, pcols );
+  else
+  {
+    // Initialize ScalePermstruct.
+    dScalePermstructInit( m, n, &SLUDData.ScalePermstruct );
+
+    // Initialize LUstruct.
+    dLUstructInit( n, &SLUDData.LUstruct );
 
-  superlu_gridinit( SLUDData.comm, prows, pcols, &SLUDData.grid );
+    // Create process grid: the target is to have the process grid as square as possible
+    int const num_procs = MpiWrapper::Comm_size( SLUDData.comm );
+    int prows = static_cast< int >( std::sqrt( num_procs ) );
+    while( num_procs % prows )
+    {
+      --prows;
+    }
+    int pcols = num_procs/prows;
+    std::tie( prows, pcols ) = std::minmax( prows, pcols );
+
+    superlu_gridinit( SLUDData.comm, prows, pcols, &SLUDData.grid );
+
+    SLUDData.options.Fact = DOFACT;
+  }
 
   // Call the linear equation solver to factorize the matrix.
   int const nrhs = 0;
   int info = 0;
 
-  SLUDData.options.Fact = DOFACT;
   pdgssvx( &SLUDData.options,
            &SLUDData.mat,
            &SLUDData.ScalePermstruct,
@@ -204,6 +274,7 @@ int SuperLU_DistSetup( SuperLU_DistData & SLUDData,
            &SLUDData.stat,
            &info );
 
+  SLUDData.factorized = true;
   time = watch.elapsedTime();
 
   if( SLUDData.options.PrintStat == YES )
@@ -274,15 +345,7 @@ void SuperLU_DistDestroy( SuperLU_DistData & SLUDData )
     dSolveFinalize( &SLUDData.options, &SLUDData.SOLVEstruct );
   }
 
-  // From HYPRE SuperLU_Dist interfaces (superlu.c)
-  // SuperLU frees assigned data, so set them to null before
-  // calling hypre_CSRMatrixdestroy on localStrip to avoid memory errors.
-  hypre_CSRMatrixI( SLUDData.localStrip ) = NULL;
-  hypre_CSRMatrixData( SLUDData.localStrip ) = NULL;
-  hypre_CSRMatrixBigJ( SLUDData.localStrip ) = NULL;
-  hypre_CSRMatrixDestroy( SLUDData.localStrip );
-
-  Destroy_CompRowLoc_Matrix_dist( &SLUDData.mat );
+  DestroySuperMatrix( SLUDData );
 }
 
 }
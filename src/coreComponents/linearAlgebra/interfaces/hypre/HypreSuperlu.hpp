@@ -45,6 +45,9 @@ struct SuperLU_DistData
   dSOLVEstruct_t SOLVEstruct;         //!< data structure to solve the matrix
   superlu_dist_options_t options;     //!< SuperLU_Dist options
   MPI_Comm comm;                      //!< MPI communicator
+  array1d< globalIndex > patternRows; //!< row pointer of the local strip, to detect a change of sparsity pattern
+  array1d< globalIndex > patternCols; //!< column indices of the local strip, to detect a change of sparsity pattern
+  bool factorized = false;            //!< whether the structures hold a factorization
 };
 
 /**
@@ -58,7 +61,18 @@ void SuperLU_DistCreate( HypreMatrix const & matrix,
                          SuperLU_DistData & SLUDData );
 
 /**
- * @brief Factorizes a linear system with SuperLU_Dist
+ * @brief Replaces the matrix of a factorized SuperLU_Dist data structure, keeping the ordering
+ *        and the symbolic factorization for the next setup
+ * @param[in] matrix the new HypreMatrix object
+ * @param[in,out] SLUDData the structure containing the factorized matrix in SuperLU_Dist format
+ * @return @p false, leaving @p SLUDData unchanged, if the sparsity pattern of @p matrix differs
+ *         from the one of the factorized matrix
+ */
+bool SuperLU_DistUpdate( HypreMatrix const & matrix,
+                         SuperLU_DistData & SLUDData );
+
+/**
+ * @brief Factorizes a linear system with SuperLU_Dist, only numerically if the structure has been updated
  * @param[in,out] SLUDData the structure containing the matrix in SuperLU_Dist format
  * @param[out] time time spent in the factorization phase
  * @return info error code
@@ -20,6 +20,7 @@
 
 #include "codingUtilities/Utilities.hpp"
 #include "linearAlgebra/interfaces/hypre/HypreUtils.hpp"
+#include "mpiCommunications/DeterministicReduction.hpp"
 
 #include "HYPRE.h"
 #include "_hypre_IJ_mv.h"
@@ -129,6 +130,12 @@ void HypreVector::createWithLocalSize( localIndex const localSize,
   GEOSX_LAI_ASSERT( closed() );
   GEOSX_LAI_ASSERT_GE( localSize, 0 );
 
+  if( hasLocalSize( localSize, comm ) )
+  {
+    zero();
+    return;
+  }
+
   HYPRE_BigInt const jlower = MpiWrapper::PrefixSum< HYPRE_BigInt >( LvArray::integerConversion< HYPRE_BigInt >( localSize ) );
   HYPRE_BigInt const jupper = jlower + LvArray::integerConversion< HYPRE_BigInt >( localSize ) - 1;
 
@@ -166,11 +173,14 @@ void HypreVector::create( arrayView1d< real64 const > const & localValues,
 
   HYPRE_BigInt const localSize = LvArray::integerConversion< HYPRE_BigInt >( localValues.size() );
 
-  HYPRE_BigInt const jlower = MpiWrapper::PrefixSum< HYPRE_BigInt >( localSize );
-  HYPRE_BigInt const jupper = jlower + localSize - 1;
+  if( !hasLocalSize( localValues.size(), comm ) )
+  {
+    HYPRE_BigInt const jlower = MpiWrapper::PrefixSum< HYPRE_BigInt >( localSize );
+    HYPRE_BigInt const jupper = jlower + localSize - 1;
 
-  initialize( comm, jlower, jupper, m_ij_vector );
-  finalize( m_ij_vector, m_par_vector );
+    initialize( comm, jlower, jupper, m_ij_vector );
+    finalize( m_ij_vector, m_par_vector );
+  }
 
   HYPRE_Real * const local_data = extractLocalVector();
   for( localIndex i = 0; i < localValues.size(); ++i )
@@ -310,6 +320,11 @@ real64 HypreVector::dot( HypreVector const & vec ) const
   GEOSX_LAI_ASSERT( vec.ready() );
   GEOSX_LAI_ASSERT_EQ( globalSize(), vec.globalSize() );
 
+  if( DeterministicReduction::isEnabled() )
+  {
+    return DeterministicReduction::dot( extractLocalVector(), vec.extractLocalVector(), localSize(), getComm() );
+  }
+
   HYPRE_Real result;
   GEOSX_LAI_CHECK_ERROR( HYPRE_ParVectorInnerProd( m_par_vector, vec.m_par_vector, &result ) );
   return result;
@@ -347,6 +362,16 @@ real64 HypreVector::norm1() const
   GEOSX_LAI_ASSERT( ready() );
 
   real64 const * const local_data = extractLocalVector();
+
+  if( DeterministicReduction::isEnabled() )
+  {
+    real64 const loc_norm1 = DeterministicReduction::localSum< parallelHostPolicy >( localSize(), [local_data]( localIndex const i )
+    {
+      return std::fabs( local_data[i] );
+    } );
+    return DeterministicReduction::sum( loc_norm1, getComm() );
+  }
+
   real64 loc_norm1 = 0.0;
   for( HYPRE_Int i = 0; i < localSize(); ++i )
   {
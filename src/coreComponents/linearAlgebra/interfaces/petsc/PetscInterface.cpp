@@ -43,4 +43,10 @@ PetscInterface::createPreconditioner( LinearSolverParameters params )
   return std::make_unique< PetscPreconditioner >( params );
 }
 
+std::unique_ptr< PreconditionerBase< PetscInterface > >
+PetscInterface::createPreconditioner( LinearSolverParameters params, DofManager const & GEOSX_UNUSED_PARAM( dofManager ) )
+{
+  return std::make_unique< PetscPreconditioner >( params );
+}
+
 } //namespace geosx
@@ -60,6 +60,17 @@ struct PetscInterface
   static std::unique_ptr< PreconditionerBase< PetscInterface > >
   createPreconditioner( LinearSolverParameters params );
 
+  /**
+   * @brief Create a PETSc-based preconditioner object that may use the degree-of-freedom layout.
+   * @param params the preconditioner parameters
+   * @param dofManager the DofManager of the system, required by some preconditioners (e.g. MGR)
+   * @return owning pointer to the newly created preconditioner
+   *
+   * The DofManager is not needed by any of the preconditioners of this interface.
+   */
+  static std::unique_ptr< PreconditionerBase< PetscInterface > >
+  createPreconditioner( LinearSolverParameters params, DofManager const & dofManager );
+
   /// Alias for PetscMatrix
   using ParallelMatrix = PetscMatrix;
   /// Alias for PetscVector
@@ -23,12 +23,15 @@
 #endif
 
 #include "codingUtilities/Utilities.hpp"
+#include "common/TimingMacros.hpp"
 #include "linearAlgebra/interfaces/petsc/PetscUtils.hpp"
 #include "mpiCommunications/MpiWrapper.hpp"
 
 #include <petscvec.h>
 #include <petscmat.h>
 
+#include <algorithm>
+
 namespace geosx
 {
 
@@ -93,6 +96,97 @@ void PetscMatrix::createWithGlobalSize( globalIndex const globalRows,
   GEOSX_LAI_CHECK_ERROR( MatSetOption( m_mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE ) );
 }
 
+void PetscMatrix::create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                          MPI_Comm const & comm )
+{
+  create( localMatrix, 1, comm );
+}
+
+void PetscMatrix::create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                          localIndex const blockSize,
+                          MPI_Comm const & comm )
+{
+  GEOSX_LAI_ASSERT( closed() );
+  GEOSX_LAI_ASSERT_GT( blockSize, 0 );
+
+  reset();
+
+  localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+  localIndex const numLocalRows = localMatrix.numRows();
+  globalIndex const rankOffset = MpiWrapper::PrefixSum< globalIndex >( numLocalRows );
+
+  // the block format needs whole blocks on every rank, otherwise stay with the scalar one
+  bool const useBlocks = blockSize > 1 &&
+                         MpiWrapper::Min( ( numLocalRows % blockSize == 0 ) ? 1 : 0, comm ) == 1;
+  localIndex const bs = useBlocks ? blockSize : 1;
+  localIndex const numLocalBlockRows = numLocalRows / bs;
+  globalIndex const blockRankOffset = rankOffset / bs;
+
+  // exact diagonal/off-diagonal (block) row lengths avoid both over-allocation and reallocation during insertion
+  array1d< PetscInt > diagSizes( numLocalBlockRows );
+  array1d< PetscInt > offdSizes( numLocalBlockRows );
+  array1d< globalIndex > blockColumns;
+  for( localIndex blockRow = 0; blockRow < numLocalBlockRows; ++blockRow )
+  {
+    blockColumns.clear();
+    for( localIndex localRow = blockRow * bs; localRow < ( blockRow + 1 ) * bs; ++localRow )
+    {
+      arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( localRow );
+      for( localIndex k = 0; k < columns.size(); ++k )
+      {
+        blockColumns.emplace_back( columns[k] / bs );
+      }
+    }
+    std::sort( blockColumns.begin(), blockColumns.end() );
+    globalIndex const * const blockColumnsEnd = std::unique( blockColumns.begin(), blockColumns.end() );
+
+    PetscInt numDiag = 0;
+    PetscInt numOffd = 0;
+    for( globalIndex const * col = blockColumns.begin(); col != blockColumnsEnd; ++col )
+    {
+      bool const isDiag = *col >= blockRankOffset && *col < blockRankOffset + numLocalBlockRows;
+      numDiag += isDiag ? 1 : 0;
+      numOffd += isDiag ? 0 : 1;
+    }
+    diagSizes[blockRow] = numDiag;
+    offdSizes[blockRow] = numOffd;
+  }
+
+  GEOSX_LAI_CHECK_ERROR( MatCreate( comm, &m_mat ) );
+  GEOSX_LAI_CHECK_ERROR( MatSetType( m_mat, useBlocks ? MATBAIJ : MATMPIAIJ ) );
+  GEOSX_LAI_CHECK_ERROR( MatSetSizes( m_mat, numLocalRows, numLocalRows, PETSC_DETERMINE, PETSC_DETERMINE ) );
+  GEOSX_LAI_CHECK_ERROR( MatXAIJSetPreallocation( m_mat,
+                                                  LvArray::integerConversion< PetscInt >( bs ),
+                                                  diagSizes.data(),
+                                                  offdSizes.data(),
+                                                  nullptr,
+                                                  nullptr ) );
+  GEOSX_LAI_CHECK_ERROR( MatSetUp( m_mat ) );
+  GEOSX_LAI_CHECK_ERROR( MatSetOption( m_mat, MAT_NO_OFF_PROC_ENTRIES, PETSC_TRUE ) );
+
+  m_closed = false;
+
+  // rows are inserted straight from the CRS arrays, PETSc sorts the entries into blocks
+  for( localIndex localRow = 0; localRow < numLocalRows; ++localRow )
+  {
+    PetscInt const row = LvArray::integerConversion< PetscInt >( localRow + rankOffset );
+    arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( localRow );
+    GEOSX_LAI_CHECK_ERROR( MatSetValues( m_mat,
+                                         1,
+                                         &row,
+                                         LvArray::integerConversion< PetscInt >( columns.size() ),
+                                         toPetscInt( columns.dataIfContiguous() ),
+                                         localMatrix.getEntries( localRow ).dataIfContiguous(),
+                                         INSERT_VALUES ) );
+  }
+
+  close();
+
+  GEOSX_LAI_CHECK_ERROR( MatSetOption( m_mat, MAT_NO_OFF_PROC_ENTRIES, PETSC_FALSE ) );
+  GEOSX_LAI_CHECK_ERROR( MatSetOption( m_mat, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE ) );
+}
+
 bool PetscMatrix::created() const
 {
   return m_mat != nullptr;
@@ -453,6 +547,8 @@ void PetscMatrix::insert( globalIndex const * rowIndices,
 void PetscMatrix::apply( PetscVector const & src,
                          PetscVector & dst ) const
 {
+  GEOSX_MARK_FUNCTION;
+
   GEOSX_LAI_ASSERT( ready() );
   GEOSX_LAI_ASSERT( src.ready() );
   GEOSX_LAI_ASSERT( dst.ready() );
@@ -103,6 +103,18 @@ public:
                                      localIndex const maxEntriesPerRow,
                                      MPI_Comm const & comm ) override;
 
+  virtual void create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                       MPI_Comm const & comm ) override;
+
+  /**
+   * @copydoc MatrixBase<PetscMatrix,PetscVector>::create(CRSMatrixView<real64 const,globalIndex const> const &,localIndex const,MPI_Comm const &)
+   *
+   * The matrix is stored in the BAIJ format when every rank holds whole blocks, in the AIJ format otherwise.
+   */
+  virtual void create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                       localIndex const blockSize,
+                       MPI_Comm const & comm ) override;
+
   /**
    * @copydoc MatrixBase<PetscMatrix,PetscVector>::numGlobalRows
    */
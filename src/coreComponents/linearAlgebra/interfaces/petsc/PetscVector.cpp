@@ -20,6 +20,7 @@
 
 #include "codingUtilities/Utilities.hpp"
 #include "linearAlgebra/interfaces/petsc/PetscUtils.hpp"
+#include "mpiCommunications/DeterministicReduction.hpp"
 
 #include <petscvec.h>
 
@@ -91,6 +92,11 @@ void PetscVector::createWithLocalSize( localIndex const localSize, MPI_Comm cons
 {
   GEOSX_LAI_ASSERT( closed() );
   GEOSX_LAI_ASSERT_GE( localSize, 0 );
+  if( hasLocalSize( localSize, comm ) )
+  {
+    zero();
+    return;
+  }
   reset();
   GEOSX_LAI_CHECK_ERROR( VecCreate( comm, &m_vec ) );
   GEOSX_LAI_CHECK_ERROR( VecSetType( m_vec, VECMPI ) );
@@ -110,15 +116,18 @@ void PetscVector::createWithGlobalSize( globalIndex const globalSize, MPI_Comm c
 void PetscVector::create( arrayView1d< real64 const > const & localValues, MPI_Comm const & comm )
 {
   GEOSX_LAI_ASSERT( closed() );
-  reset();
   PetscInt const size = localValues.size();
   PetscScalar * values;
 
   localValues.move( LvArray::MemorySpace::CPU, false );
 
-  GEOSX_LAI_CHECK_ERROR( VecCreate( comm, &m_vec ) );
-  GEOSX_LAI_CHECK_ERROR( VecSetType( m_vec, VECMPI ) );
-  GEOSX_LAI_CHECK_ERROR( VecSetSizes( m_vec, size, PETSC_DETERMINE ) );
+  if( !hasLocalSize( localValues.size(), comm ) )
+  {
+    reset();
+    GEOSX_LAI_CHECK_ERROR( VecCreate( comm, &m_vec ) );
+    GEOSX_LAI_CHECK_ERROR( VecSetType( m_vec, VECMPI ) );
+    GEOSX_LAI_CHECK_ERROR( VecSetSizes( m_vec, size, PETSC_DETERMINE ) );
+  }
   GEOSX_LAI_CHECK_ERROR( VecGetArray( m_vec, &values ) );
 
   // set vector values
@@ -255,6 +264,11 @@ real64 PetscVector::dot( PetscVector const & vec ) const
   GEOSX_LAI_ASSERT( vec.ready() );
   GEOSX_LAI_ASSERT_EQ( globalSize(), vec.globalSize() );
 
+  if( DeterministicReduction::isEnabled() )
+  {
+    return DeterministicReduction::dot( extractLocalVector(), vec.extractLocalVector(), localSize(), getComm() );
+  }
+
   real64 dot;
   GEOSX_LAI_CHECK_ERROR( VecDot( m_vec, vec.m_vec, &dot ) );
   return dot;
@@ -294,6 +308,17 @@ void PetscVector::axpby( real64 const alpha,
 real64 PetscVector::norm1() const
 {
   GEOSX_LAI_ASSERT( ready() );
+
+  if( DeterministicReduction::isEnabled() )
+  {
+    real64 const * const values = extractLocalVector();
+    real64 const localNorm = DeterministicReduction::localSum< parallelHostPolicy >( localSize(), [values]( localIndex const i )
+    {
+      return std::fabs( values[i] );
+    } );
+    return DeterministicReduction::sum( localNorm, getComm() );
+  }
+
   real64 result;
   GEOSX_LAI_CHECK_ERROR( VecNorm( m_vec, NORM_1, &result ) );
   return result;
@@ -302,6 +327,12 @@ real64 PetscVector::norm1() const
 real64 PetscVector::norm2() const
 {
   GEOSX_LAI_ASSERT( ready() );
+
+  if( DeterministicReduction::isEnabled() )
+  {
+    return std::sqrt( dot( *this ) );
+  }
+
   real64 result;
   GEOSX_LAI_CHECK_ERROR( VecNorm( m_vec, NORM_2, &result ) );
   return result;
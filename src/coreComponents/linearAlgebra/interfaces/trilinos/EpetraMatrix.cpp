@@ -19,6 +19,7 @@
 #include "EpetraMatrix.hpp"
 
 #include "codingUtilities/Utilities.hpp"
+#include "common/TimingMacros.hpp"
 #include "linearAlgebra/interfaces/trilinos/EpetraUtils.hpp"
 
 #include <Epetra_Map.h>
@@ -107,6 +108,51 @@ void EpetraMatrix::createWithLocalSize( localIndex const localRows,
                                                      false );
 }
 
+void EpetraMatrix::create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                           MPI_Comm const & comm )
+{
+  GEOSX_LAI_ASSERT( closed() );
+
+  reset();
+
+  localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+  localIndex const numLocalRows = localMatrix.numRows();
+
+  // exact row lengths avoid both over-allocation and reallocation during insertion;
+  // all entries are locally owned, so the non-local assembly is skipped
+  array1d< int > rowSizes( numLocalRows );
+  for( localIndex localRow = 0; localRow < numLocalRows; ++localRow )
+  {
+    rowSizes[localRow] = LvArray::integerConversion< int >( localMatrix.numNonZeros( localRow ) );
+  }
+
+  m_dst_map = std::make_unique< Epetra_Map >( LvArray::integerConversion< globalIndex >( -1 ),
+                                              LvArray::integerConversion< int >( numLocalRows ),
+                                              0,
+                                              Epetra_MpiComm( MPI_PARAM( comm ) ) );
+  m_src_map = std::make_unique< Epetra_Map >( *m_dst_map );
+  m_matrix = std::make_unique< Epetra_FECrsMatrix >( Copy,
+                                                     *m_dst_map,
+                                                     rowSizes.data(),
+                                                     true );
+
+  m_closed = false;
+
+  // rows are inserted straight from the CRS arrays
+  globalIndex const rankOffset = m_dst_map->MinMyGID64();
+  for( localIndex localRow = 0; localRow < numLocalRows; ++localRow )
+  {
+    arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( localRow );
+    GEOSX_LAI_CHECK_ERROR_NNEG( m_matrix->InsertGlobalValues( localRow + rankOffset,
+                                                              rowSizes[localRow],
+                                                              localMatrix.getEntries( localRow ).dataIfContiguous(),
+                                                              toEpetraLongLong( columns.dataIfContiguous() ) ) );
+  }
+
+  close();
+}
+
 bool EpetraMatrix::created() const
 {
   return bool(m_matrix);
@@ -364,6 +410,8 @@ void EpetraMatrix::insert( globalIndex const * rowIndices,
 void EpetraMatrix::apply( EpetraVector const & src,
                           EpetraVector & dst ) const
 {
+  GEOSX_MARK_FUNCTION;
+
   GEOSX_LAI_ASSERT( ready() );
   GEOSX_LAI_ASSERT( src.ready() );
   GEOSX_LAI_ASSERT( dst.ready() );
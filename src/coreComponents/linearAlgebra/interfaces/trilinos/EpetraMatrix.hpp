@@ -94,6 +94,9 @@ public:
                                      localIndex const maxEntriesPerRow,
                                      MPI_Comm const & comm ) override;
 
+  virtual void create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                       MPI_Comm const & comm ) override;
+
   virtual void open() override;
 
   virtual void close() override;
@@ -20,6 +20,7 @@
 
 #include "codingUtilities/Utilities.hpp"
 #include "linearAlgebra/interfaces/trilinos/EpetraUtils.hpp"
+#include "mpiCommunications/DeterministicReduction.hpp"
 
 #include <Epetra_FEVector.h>
 #include <Epetra_Map.h>
@@ -94,10 +95,15 @@ bool EpetraVector::created() const
 }
 
 void EpetraVector::createWithLocalSize( localIndex const localSize,
-                                        MPI_Comm const & MPI_PARAM( comm ) )
+                                        MPI_Comm const & comm )
 {
   GEOSX_LAI_ASSERT( closed() );
   GEOSX_LAI_ASSERT_GE( localSize, 0 );
+  if( hasLocalSize( localSize, comm ) )
+  {
+    zero();
+    return;
+  }
   Epetra_Map const map( LvArray::integerConversion< long long >( -1 ),
                         LvArray::integerConversion< int >( localSize ),
                         0,
@@ -117,13 +123,22 @@ void EpetraVector::createWithGlobalSize( globalIndex const globalSize,
 }
 
 void EpetraVector::create( arrayView1d< real64 const > const & localValues,
-                           MPI_Comm const & MPI_PARAM( comm ) )
+                           MPI_Comm const & comm )
 {
   GEOSX_LAI_ASSERT( closed() );
 
   localValues.move( LvArray::MemorySpace::CPU, false );
 
   int const localSize = LvArray::integerConversion< int >( localValues.size() );
+  if( hasLocalSize( localSize, comm ) )
+  {
+    real64 * const values = ( *m_vector )[ 0 ];
+    for( int i = 0; i < localSize; ++i )
+    {
+      values[i] = localValues[i];
+    }
+    return;
+  }
   Epetra_Map const map( LvArray::integerConversion< long long >( -1 ),
                         localSize,
                         0,
@@ -248,6 +263,11 @@ real64 EpetraVector::dot( EpetraVector const & vec ) const
   GEOSX_LAI_ASSERT( vec.ready() );
   GEOSX_LAI_ASSERT_EQ( globalSize(), vec.globalSize() );
 
+  if( DeterministicReduction::isEnabled() )
+  {
+    return DeterministicReduction::dot( extractLocalVector(), vec.extractLocalVector(), localSize(), getComm() );
+  }
+
   real64 tmp;
   GEOSX_LAI_CHECK_ERROR( m_vector->Dot( vec.unwrapped(), &tmp ) );
   return tmp;
@@ -287,6 +307,16 @@ real64 EpetraVector::norm1() const
 {
   GEOSX_LAI_ASSERT( ready() );
 
+  if( DeterministicReduction::isEnabled() )
+  {
+    real64 const * const values = extractLocalVector();
+    real64 const localNorm = DeterministicReduction::localSum< parallelHostPolicy >( localSize(), [values]( localIndex const i )
+    {
+      return std::fabs( values[i] );
+    } );
+    return DeterministicReduction::sum( localNorm, getComm() );
+  }
+
   real64 tmp;
   m_vector->Norm1( &tmp );
   return tmp;
@@ -295,6 +325,12 @@ real64 EpetraVector::norm1() const
 real64 EpetraVector::norm2() const
 {
   GEOSX_LAI_ASSERT( ready() );
+
+  if( DeterministicReduction::isEnabled() )
+  {
+    return std::sqrt( dot( *this ) );
+  }
+
   real64 tmp;
   m_vector->Norm2( &tmp );
   return tmp;
@@ -35,4 +35,10 @@ TrilinosInterface::createPreconditioner( LinearSolverParameters params )
   return std::make_unique< TrilinosPreconditioner >( params );
 }
 
+std::unique_ptr< PreconditionerBase< TrilinosInterface > >
+TrilinosInterface::createPreconditioner( LinearSolverParameters params, DofManager const & GEOSX_UNUSED_PARAM( dofManager ) )
+{
+  return std::make_unique< TrilinosPreconditioner >( params );
+}
+
 }
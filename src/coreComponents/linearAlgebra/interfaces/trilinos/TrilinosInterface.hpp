@@ -56,6 +56,17 @@ struct TrilinosInterface
   static std::unique_ptr< PreconditionerBase< TrilinosInterface > >
   createPreconditioner( LinearSolverParameters params );
 
+  /**
+   * @brief Create a Trilinos-based preconditioner object that may use the degree-of-freedom layout.
+   * @param params the preconditioner parameters
+   * @param dofManager the DofManager of the system, required by some preconditioners (e.g. MGR)
+   * @return owning pointer to the newly created preconditioner
+   *
+   * The DofManager is not needed by any of the preconditioners of this interface.
+   */
+  static std::unique_ptr< PreconditionerBase< TrilinosInterface > >
+  createPreconditioner( LinearSolverParameters params, DofManager const & dofManager );
+
   /// Alias for EpetraMatrix
   using ParallelMatrix = EpetraMatrix;
   /// Alias for EpetraVector
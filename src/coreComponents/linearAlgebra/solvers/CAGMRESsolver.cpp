@@ -0,0 +1,353 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CAGMRESsolver.cpp
+ */
+
+#include "CAGMRESsolver.hpp"
+
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+#include "mpiCommunications/DeterministicReduction.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+namespace geosx
+{
+
+template< typename VECTOR >
+CAGMRESsolver< VECTOR >::CAGMRESsolver( LinearOperator< Vector > const & A,
+                                        LinearOperator< Vector > const & M,
+                                        real64 const tolerance,
+                                        localIndex const maxIterations,
+                                        integer const verbosity,
+                                        localIndex const maxRestart,
+                                        localIndex const stepSize )
+  : KrylovSolver< VECTOR >( A, M, tolerance, maxIterations, verbosity ),
+  m_maxRestart( maxRestart ),
+  m_stepSize( stepSize ),
+  m_kspace( m_maxRestart + 1 ),
+  m_kspaceInitialized( false )
+{
+  GEOSX_ERROR_IF_LE_MSG( m_maxRestart, 0, "CA-GMRES: max number of restart iterations must be positive." );
+  GEOSX_ERROR_IF_LE_MSG( m_stepSize, 0, "CA-GMRES: step size must be positive." );
+}
+
+template< typename VECTOR >
+CAGMRESsolver< VECTOR >::~CAGMRESsolver() = default;
+
+template< typename VECTOR >
+localIndex CAGMRESsolver< VECTOR >::orthogonalizeBlock( localIndex const numBasis,
+                                                        localIndex const numNew,
+                                                        arraySlice2d< real64 > const & C,
+                                                        arraySlice2d< real64 > const & R ) const
+{
+  // Gather the local parts of the products with the basis and of the Gram matrix of the block,
+  // so that a single reduction is needed for the whole block
+  localIndex const numCoefs = numBasis * numNew;
+  array1d< real64 > localDots( numCoefs + numNew * numNew );
+  array1d< real64 > dots( localDots.size() );
+
+  for( localIndex i = 0; i < numNew; ++i )
+  {
+    Vector const & w = m_kspace[numBasis + i];
+    for( localIndex l = 0; l < numBasis; ++l )
+    {
+      localDots[i * numBasis + l] = localDot( m_kspace[l], w );
+    }
+    for( localIndex l = 0; l <= i; ++l )
+    {
+      localDots[numCoefs + i * numNew + l] = localDot( m_kspace[numBasis + l], w );
+    }
+  }
+
+  if( DeterministicReduction::isEnabled() )
+  {
+    DeterministicReduction::sum( localDots.data(), dots.data(), LvArray::integerConversion< int >( dots.size() ), getComm( m_kspace[0] ) );
+  }
+  else
+  {
+    MpiWrapper::allReduce( localDots.data(), dots.data(), LvArray::integerConversion< int >( dots.size() ), MPI_SUM, getComm( m_kspace[0] ) );
+  }
+
+  for( localIndex i = 0; i < numNew; ++i )
+  {
+    for( localIndex l = 0; l < numBasis; ++l )
+    {
+      C( l, i ) = dots[i * numBasis + l];
+    }
+  }
+
+  // Cholesky factorization of the Gram matrix of the block once projected out of the basis,
+  // G - C^T C = R^T R, stopped at the first vector that is lost to cancellation
+  real64 const minPivotRatio = std::sqrt( GEOSX_KRYLOV_MIN_DIV );
+  localIndex numAccepted = 0;
+
+  for( localIndex i = 0; i < numNew; ++i )
+  {
+    real64 const wNorm2 = dots[numCoefs + i * numNew + i];
+    for( localIndex l = 0; l <= i; ++l )
+    {
+      real64 value = dots[numCoefs + i * numNew + l];
+      for( localIndex m = 0; m < numBasis; ++m )
+      {
+        value -= C( m, l ) * C( m, i );
+      }
+      for( localIndex m = 0; m < l; ++m )
+      {
+        value -= R( m, l ) * R( m, i );
+      }
+      R( l, i ) = l < i ? value / R( l, l ) : value;
+    }
+
+    if( !( R( i, i ) > minPivotRatio * wNorm2 ) )
+    {
+      break;
+    }
+    R( i, i ) = std::sqrt( R( i, i ) );
+    ++numAccepted;
+  }
+
+  // Orthonormalize the accepted vectors in place: q_i = ( w_i - Q c_i - sum_{l<i} r_li q_l ) / r_ii
+  for( localIndex i = 0; i < numAccepted; ++i )
+  {
+    VectorTemp & w = m_kspace[numBasis + i];
+    for( localIndex l = 0; l < numBasis; ++l )
+    {
+      w.axpy( -C( l, i ), m_kspace[l] );
+    }
+    for( localIndex l = 0; l < i; ++l )
+    {
+      w.axpy( -R( l, i ), m_kspace[numBasis + l] );
+    }
+    w.scale( 1.0 / R( i, i ) );
+  }
+
+  return numAccepted;
+}
+
+template< typename VECTOR >
+void CAGMRESsolver< VECTOR >::solve( Vector const & b,
+                                     Vector & x ) const
+{
+  // We create Krylov subspace vectors once using the size and partitioning of b.
+  // It is assumed that on every repeated call to solve() input vectors will keep
+  // the same (or at least compatible) size and partitioning.
+  if( !m_kspaceInitialized )
+  {
+    for( localIndex i = 0; i < m_maxRestart + 1; ++i )
+    {
+      m_kspace[i] = createTempVector( b );
+    }
+    m_kspaceInitialized = true;
+  }
+
+  Stopwatch watch;
+
+  // Compute the target absolute tolerance
+  real64 const absTol = b.norm2() * m_tolerance;
+
+  // Define vectors
+  VectorTemp r = createTempVector( b );
+  VectorTemp w = createTempVector( b );
+  VectorTemp z = createTempVector( b );
+
+  // Compute initial rk
+  m_operator.residual( x, b, r );
+
+  // Create upper Hessenberg matrix, as recovered from the blocks (H) and after the plane rotations (HR)
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > H( m_maxRestart + 1, m_maxRestart );
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > HR( m_maxRestart + 1, m_maxRestart );
+
+  // Create plane rotation storage
+  array1d< real64 > c( m_maxRestart + 1 );
+  array1d< real64 > s( m_maxRestart + 1 );
+  array1d< real64 > g( m_maxRestart + 1 );
+
+  // Create block orthogonalization storage
+  array2d< real64 > C( m_maxRestart + 1, m_stepSize );
+  array2d< real64 > R( m_stepSize, m_stepSize );
+
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.resize( m_maxIterations + 1 );
+
+  localIndex k = 0;
+  real64 rnorm = 0.0;
+
+  // Scaling of the monomial basis, estimated from the Hessenberg entries of the previous block
+  real64 sigma = 1.0;
+
+  while( m_result.status == LinearSolverResult::Status::NotConverged )
+  {
+    // Re-initialize Krylov subspace
+    g.setValues< serialPolicy >( 0.0 );
+    H.setValues< serialPolicy >( 0.0 );
+    g[0] = r.norm2();
+
+    // Record iteration progress
+    rnorm = std::fabs( g[0] );
+    logProgress( k, rnorm );
+
+    // Convergence check
+    if( rnorm < absTol )
+    {
+      m_result.status = LinearSolverResult::Status::Success;
+      break;
+    }
+    if( k >= m_maxIterations )
+    {
+      break;
+    }
+
+    m_kspace[0].axpby( 1.0 / g[0], r, 0.0 );
+
+    localIndex j = 0;
+    while( j < m_maxRestart && k < m_maxIterations && m_result.status == LinearSolverResult::Status::NotConverged )
+    {
+      localIndex const numNew = std::min( m_stepSize, std::min( m_maxRestart - j, m_maxIterations - k ) );
+
+      // Generate the block y_{i+1} = AM y_i / sigma from y_0 = q_j, without any reduction
+      for( localIndex i = 0; i < numNew; ++i )
+      {
+        m_precond.apply( m_kspace[j + i], z );
+        m_operator.apply( z, m_kspace[j + i + 1] );
+        m_kspace[j + i + 1].scale( 1.0 / sigma );
+      }
+
+      // Orthogonalization
+      localIndex const n = orthogonalizeBlock( j + 1, numNew, C, R );
+      if( n == 0 )
+      {
+        GEOSX_LOG_LEVEL_RANK_0( 1, "Breakdown in " << methodName() << ": no new direction in the block" );
+        m_result.status = LinearSolverResult::Status::Breakdown;
+        break;
+      }
+
+      // Recover the new columns of the Hessenberg matrix. The block satisfies AM Y_{0:n-1} = sigma Y_{1:n}
+      // with Y = Q T, where T_{:,0} = e_j and T_{:,i+1} stacks C_{:,i} and R_{:,i}. Since AM Q_{0:j-1} = Q H_{:,0:j-1},
+      // H_{:,j:j+n-1} T_{j:j+n-1,0:n-1} = sigma T_{:,1:n} - H_{:,0:j-1} T_{0:j-1,0:n-1}, where the block of T is upper triangular.
+      auto const T = [&]( localIndex const row, localIndex const col ) -> real64
+      {
+        if( col == 0 )
+        {
+          return row == j ? 1.0 : 0.0;
+        }
+        if( row <= j )
+        {
+          return C( row, col - 1 );
+        }
+        return row - j - 1 <= col - 1 ? R( row - j - 1, col - 1 ) : 0.0;
+      };
+
+      real64 hmax = 0.0;
+      for( localIndex i = 0; i < n; ++i )
+      {
+        for( localIndex row = 0; row <= j + n; ++row )
+        {
+          real64 value = sigma * T( row, i + 1 );
+          for( localIndex l = 0; l < j; ++l )
+          {
+            value -= H( row, l ) * T( l, i );
+          }
+          for( localIndex l = 0; l < i; ++l )
+          {
+            value -= H( row, j + l ) * T( j + l, i );
+          }
+          H( row, j + i ) = value / T( j + i, i );
+          hmax = std::max( hmax, std::fabs( H( row, j + i ) ) );
+        }
+      }
+      if( hmax > 0.0 )
+      {
+        sigma = hmax;
+      }
+
+      // Apply the rotations to the new columns, each one being a Krylov iteration
+      localIndex const jEnd = j + n;
+      while( j < jEnd )
+      {
+        for( localIndex row = 0; row <= j + 1; ++row )
+        {
+          HR( row, j ) = H( row, j );
+        }
+
+        // Apply all previous rotations to the new column
+        for( localIndex i = 0; i < j; ++i )
+        {
+          krylov::ApplyGivensRotation( c[i], s[i], HR( i, j ), HR( i+1, j ) );
+        }
+
+        // Compute and apply the new rotation to eliminate subdiagonal element
+        krylov::ComputeGivensRotation( HR( j, j ), HR( j+1, j ), c[j], s[j] );
+        krylov::ApplyGivensRotation( c[j], s[j], HR( j, j ), HR( j+1, j ) );
+        krylov::ApplyGivensRotation( c[j], s[j], g[j], g[j+1] );
+
+        ++j;
+        ++k;
+
+        // Record iteration progress
+        rnorm = std::fabs( g[j] );
+        logProgress( k, rnorm );
+
+        // Convergence check
+        if( rnorm < absTol )
+        {
+          m_result.status = LinearSolverResult::Status::Success;
+          break;
+        }
+      }
+    }
+
+    // Regardless of how we quit out of inner loop, j is the actual size of H
+    krylov::Backsolve( j, HR, g );
+    w.zero();
+    for( localIndex i = 0; i < j; ++i )
+    {
+      w.axpy( g[i], m_kspace[i] );
+    }
+    m_precond.apply( w, z );
+
+    // Update the solution vector and recompute residual
+    x.axpy( 1.0, z );
+    m_operator.residual( x, b, r );
+  }
+
+  m_result.numIterations = k;
+  m_result.residualReduction = rnorm / absTol * m_tolerance;
+  m_result.solveTime = watch.elapsedTime();
+
+  logResult();
+  m_residualNorms.resize( m_result.numIterations + 1 );
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class CAGMRESsolver< TrilinosInterface::ParallelVector >;
+template class CAGMRESsolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class CAGMRESsolver< HypreInterface::ParallelVector >;
+template class CAGMRESsolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class CAGMRESsolver< PetscInterface::ParallelVector >;
+template class CAGMRESsolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} // namespace geosx
@@ -0,0 +1,148 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CAGMRESsolver.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_SOLVERS_CAGMRESSOLVER_HPP_
+#define GEOSX_LINEARALGEBRA_SOLVERS_CAGMRESSOLVER_HPP_
+
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief This class implements the s-step (communication-avoiding) GMRES method
+ *        for monolithic and block linear operators.
+ * @tparam VECTOR type of vectors this solver operates on.
+ *
+ * Each step generates a block of s Krylov vectors with s preconditioner and operator
+ * applications and no global reduction. The block is orthogonalized against the basis
+ * and within itself with a single reduction (block classical Gram-Schmidt followed by a
+ * Cholesky QR), and the Hessenberg matrix of the Arnoldi relation is recovered from the
+ * change of basis, following "Communication-Avoiding Krylov Subspace Methods" from
+ * M. Hoemmen (2010). The number of reductions per Krylov vector is thereby divided by
+ * about s with respect to GMRESsolver. The monomial basis used within a block becomes
+ * ill-conditioned for large s: the vectors of a block that cannot be orthogonalized
+ * are dropped and generated again by the next block, and s should stay small (4 to 8).
+ */
+template< typename VECTOR >
+class CAGMRESsolver : public KrylovSolver< VECTOR >
+{
+public:
+
+  /// Alias for the base type
+  using Base = KrylovSolver< VECTOR >;
+
+  /// Alias for the vector type
+  using Vector = typename Base::Vector;
+
+  /**
+   * @name Constructor/Destructor Methods
+   */
+  ///@{
+
+  /**
+   * @brief Solver object constructor.
+   * @param[in] matrix        reference to the system matrix
+   * @param[in] precond       reference to the preconditioning operator
+   * @param[in] tolerance     relative residual norm reduction tolerance
+   * @param[in] maxIterations maximum number of Krylov iterations
+   * @param[in] verbosity     solver verbosity level
+   * @param[in] maxRestart    number of iterations until restart
+   * @param[in] stepSize      number of Krylov vectors generated per block (s)
+   */
+  CAGMRESsolver( LinearOperator< Vector > const & matrix,
+                 LinearOperator< Vector > const & precond,
+                 real64 const tolerance,
+                 localIndex const maxIterations,
+                 integer const verbosity = 0,
+                 localIndex const maxRestart = 100,
+                 localIndex const stepSize = 4 );
+
+  /**
+   * @brief Virtual destructor.
+   */
+  virtual ~CAGMRESsolver() override;
+
+  ///@}
+
+  /**
+   * @name KrylovSolver interface
+   */
+  ///@{
+
+  /**
+   * @brief Solve preconditioned system
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  virtual void solve( Vector const & b, Vector & x ) const override final;
+
+  virtual string methodName() const override final
+  {
+    return "CA-GMRES";
+  };
+
+  ///@}
+
+protected:
+
+  /// Alias for vector type that can be used for temporaries
+  using VectorTemp = typename KrylovSolver< VECTOR >::VectorTemp;
+
+  using Base::m_operator;
+  using Base::m_precond;
+  using Base::m_tolerance;
+  using Base::m_maxIterations;
+  using Base::m_logLevel;
+  using Base::m_result;
+  using Base::m_residualNorms;
+  using Base::createTempVector;
+  using Base::localDot;
+  using Base::getComm;
+  using Base::logProgress;
+  using Base::logResult;
+
+  /**
+   * @brief Orthogonalize a block of new Krylov vectors against the basis and within itself.
+   * @param numBasis number of orthonormal vectors already in the basis
+   * @param numNew number of new vectors, stored after the basis
+   * @param C coefficients of the new vectors in the basis (numBasis x numNew)
+   * @param R upper triangular factor of the new vectors once projected out of the basis (numNew x numNew)
+   * @return the number of leading new vectors that have been orthonormalized
+   */
+  localIndex orthogonalizeBlock( localIndex const numBasis,
+                                 localIndex const numNew,
+                                 arraySlice2d< real64 > const & C,
+                                 arraySlice2d< real64 > const & R ) const;
+
+  /// Number of iterations needed to restart GMRES
+  localIndex m_maxRestart;
+
+  /// Number of Krylov vectors generated per block
+  localIndex m_stepSize;
+
+  /// Storage for Krylov subspace vectors
+  array1d< VectorTemp > m_kspace;
+
+  /// Flag indicating whether kspace vectors have been created
+  mutable bool m_kspaceInitialized;
+};
+
+} // namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_SOLVERS_CAGMRESSOLVER_HPP_
@@ -0,0 +1,321 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CPRPreconditioner.cpp
+ */
+
+#include "CPRPreconditioner.hpp"
+
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace geosx
+{
+
+namespace
+{
+
+/**
+ * @brief Solve a small dense system with Gaussian elimination and partial pivoting.
+ * @param n the size of the system
+ * @param a the row-major matrix, overwritten by the factorization
+ * @param x the right-hand side on input, the solution on output
+ * @return @p false if the matrix is numerically singular
+ */
+bool solveDenseSystem( localIndex const n, real64 * const a, real64 * const x )
+{
+  real64 norm = 0.0;
+  for( localIndex i = 0; i < n * n; ++i )
+  {
+    norm = std::max( norm, std::fabs( a[i] ) );
+  }
+  real64 const tolerance = n * std::numeric_limits< real64 >::epsilon() * norm;
+
+  for( localIndex k = 0; k < n; ++k )
+  {
+    localIndex pivot = k;
+    for( localIndex i = k + 1; i < n; ++i )
+    {
+      if( std::fabs( a[i * n + k] ) > std::fabs( a[pivot * n + k] ) )
+      {
+        pivot = i;
+      }
+    }
+    if( std::fabs( a[pivot * n + k] ) <= tolerance )
+    {
+      return false;
+    }
+    if( pivot != k )
+    {
+      for( localIndex j = 0; j < n; ++j )
+      {
+        std::swap( a[k * n + j], a[pivot * n + j] );
+      }
+      std::swap( x[k], x[pivot] );
+    }
+    for( localIndex i = k + 1; i < n; ++i )
+    {
+      real64 const factor = a[i * n + k] / a[k * n + k];
+      for( localIndex j = k; j < n; ++j )
+      {
+        a[i * n + j] -= factor * a[k * n + j];
+      }
+      x[i] -= factor * x[k];
+    }
+  }
+
+  for( localIndex k = n - 1; k >= 0; --k )
+  {
+    for( localIndex j = k + 1; j < n; ++j )
+    {
+      x[k] -= a[k * n + j] * x[j];
+    }
+    x[k] /= a[k * n + k];
+  }
+  return true;
+}
+
+/**
+ * @brief Create the AMG preconditioner of the scalar pressure system.
+ * @tparam LAI linear algebra interface to use
+ * @param params the linear solver parameters
+ * @return the pressure preconditioner
+ */
+template< typename LAI >
+std::unique_ptr< PreconditionerBase< LAI > > createPressurePrecond( LinearSolverParameters params )
+{
+  params.preconditionerType = LinearSolverParameters::PreconditionerType::amg;
+  params.dofsPerNode = 1;
+  params.amg.separateComponents = false;
+  return LAI::createPreconditioner( params );
+}
+
+/**
+ * @brief Create the ILU(0) smoother of the full system.
+ * @tparam LAI linear algebra interface to use
+ * @param params the linear solver parameters
+ * @return the smoother
+ */
+template< typename LAI >
+std::unique_ptr< PreconditionerBase< LAI > > createSmoother( LinearSolverParameters params )
+{
+  params.preconditionerType = LinearSolverParameters::PreconditionerType::iluk;
+  params.ilu.fill = 0;
+  return LAI::createPreconditioner( params );
+}
+
+} // namespace
+
+template< typename LAI >
+CPRPreconditioner< LAI >::CPRPreconditioner( std::vector< DofManager::SubComponent > pressureDofs,
+                                             std::unique_ptr< PreconditionerBase< LAI > > pressurePrecond,
+                                             std::unique_ptr< PreconditionerBase< LAI > > smoother )
+  : Base(),
+  m_pressureDofs( std::move( pressureDofs ) ),
+  m_pressurePrecond( std::move( pressurePrecond ) ),
+  m_smoother( std::move( smoother ) )
+{
+  GEOSX_LAI_ASSERT( !m_pressureDofs.empty() );
+  GEOSX_LAI_ASSERT( m_pressurePrecond );
+  GEOSX_LAI_ASSERT( m_smoother );
+  for( DofManager::SubComponent const & dof : m_pressureDofs )
+  {
+    GEOSX_LAI_ASSERT_EQ( dof.hiComp - dof.loComp, 1 );
+  }
+}
+
+template< typename LAI >
+CPRPreconditioner< LAI >::CPRPreconditioner( LinearSolverParameters const & params,
+                                             std::vector< DofManager::SubComponent > pressureDofs )
+  : CPRPreconditioner( std::move( pressureDofs ),
+                       createPressurePrecond< LAI >( params ),
+                       createSmoother< LAI >( params ) )
+{}
+
+template< typename LAI >
+CPRPreconditioner< LAI >::CPRPreconditioner( LinearSolverParameters const & params,
+                                             std::vector< DofManager::SubComponent > pressureDofs,
+                                             std::unique_ptr< PreconditionerBase< LAI > > pressurePrecond )
+  : CPRPreconditioner( std::move( pressureDofs ),
+                       std::move( pressurePrecond ),
+                       createSmoother< LAI >( params ) )
+{}
+
+template< typename LAI >
+CPRPreconditioner< LAI >::~CPRPreconditioner() = default;
+
+template< typename LAI >
+void CPRPreconditioner< LAI >::reinitialize( Matrix const & mat, DofManager const & dofManager )
+{
+  MPI_Comm const & comm = mat.getComm();
+
+  dofManager.makeRestrictor( m_pressureDofs, comm, false, m_restrictor );
+  dofManager.makeRestrictor( m_pressureDofs, comm, true, m_prolongator );
+
+  m_rhsPressure.createWithLocalSize( m_restrictor.numLocalRows(), comm );
+  m_solPressure.createWithLocalSize( m_restrictor.numLocalRows(), comm );
+  m_residual.createWithLocalSize( mat.numLocalRows(), comm );
+  m_correction.createWithLocalSize( mat.numLocalRows(), comm );
+}
+
+template< typename LAI >
+void CPRPreconditioner< LAI >::computeDecoupling( Matrix const & mat, DofManager const & dofManager )
+{
+  localIndex maxNumComp = 0;
+  for( DofManager::SubComponent const & dof : m_pressureDofs )
+  {
+    maxNumComp = std::max( maxNumComp, dofManager.numComponents( dof.fieldName ) );
+  }
+
+  // The decoupling operator has the same row distribution as the restrictor
+  m_decoupling.createWithLocalSize( m_restrictor.numLocalRows(), mat.numLocalRows(), maxNumComp, mat.getComm() );
+  m_decoupling.open();
+
+  array1d< globalIndex > pressureDof( 1 );
+  array1d< real64 > pressureValue( 1 );
+  array1d< globalIndex > cols( mat.maxRowLength() );
+  array1d< real64 > values( mat.maxRowLength() );
+  array1d< globalIndex > blockCols( maxNumComp );
+  array1d< real64 > blockTransposed( maxNumComp * maxNumComp );
+  array1d< real64 > weights( maxNumComp );
+
+  for( globalIndex row = m_restrictor.ilower(); row < m_restrictor.iupper(); ++row )
+  {
+    // Find the field and the element the pressure unknown belongs to
+    m_restrictor.getRowCopy( row, pressureDof, pressureValue );
+
+    localIndex numComp = 0;
+    localIndex pressureComp = 0;
+    for( DofManager::SubComponent const & dof : m_pressureDofs )
+    {
+      globalIndex const fieldOffset = dofManager.globalOffset( dof.fieldName );
+      if( pressureDof[0] >= fieldOffset && pressureDof[0] < fieldOffset + dofManager.numLocalDofs( dof.fieldName ) )
+      {
+        numComp = dofManager.numComponents( dof.fieldName );
+        pressureComp = dof.loComp;
+        break;
+      }
+    }
+    GEOSX_LAI_ASSERT_GT( numComp, 0 );
+
+    // Extract the transposed diagonal block of the element
+    globalIndex const firstDof = pressureDof[0] - pressureComp;
+    std::fill( blockTransposed.begin(), blockTransposed.end(), 0.0 );
+    for( localIndex i = 0; i < numComp; ++i )
+    {
+      localIndex const rowLength = mat.globalRowLength( firstDof + i );
+      cols.resize( rowLength );
+      values.resize( rowLength );
+      mat.getRowCopy( firstDof + i, cols, values );
+      for( localIndex k = 0; k < rowLength; ++k )
+      {
+        globalIndex const j = cols[k] - firstDof;
+        if( j >= 0 && j < numComp )
+        {
+          blockTransposed[j * numComp + i] = values[k];
+        }
+      }
+      blockCols[i] = firstDof + i;
+      weights[i] = ( i == pressureComp ) ? 1.0 : 0.0;
+    }
+
+    // The weighted sum of the equations only depends on the pressure of the element
+    if( !solveDenseSystem( numComp, blockTransposed.data(), weights.data() ) )
+    {
+      for( localIndex i = 0; i < numComp; ++i )
+      {
+        weights[i] = ( i == pressureComp ) ? 1.0 : 0.0;
+      }
+    }
+
+    m_decoupling.insert( row, blockCols.data(), weights.data(), numComp );
+  }
+
+  m_decoupling.close();
+}
+
+template< typename LAI >
+void CPRPreconditioner< LAI >::compute( Matrix const & mat,
+                                        DofManager const & dofManager )
+{
+  // A change in size indicates a new matrix structure.
+  // This is done before Base::compute() since it overwrites old sizes.
+  bool const newSize = !this->ready() ||
+                       mat.numGlobalRows() != this->numGlobalRows() ||
+                       mat.numGlobalCols() != this->numGlobalCols();
+
+  Base::compute( mat, dofManager );
+
+  if( newSize )
+  {
+    reinitialize( mat, dofManager );
+  }
+
+  computeDecoupling( mat, dofManager );
+  mat.multiplyRAP( m_decoupling, m_prolongator, m_pressureMatrix );
+
+  m_pressurePrecond->compute( m_pressureMatrix );
+  m_smoother->compute( mat );
+}
+
+template< typename LAI >
+void CPRPreconditioner< LAI >::apply( Vector const & src,
+                                      Vector & dst ) const
+{
+  // First stage: solve the decoupled pressure system
+  m_decoupling.apply( src, m_rhsPressure );
+  m_pressurePrecond->apply( m_rhsPressure, m_solPressure );
+  m_prolongator.apply( m_solPressure, dst );
+
+  // Second stage: smooth the residual of the full system
+  this->matrix().residual( dst, src, m_residual );
+  m_smoother->apply( m_residual, m_correction );
+  dst.axpy( 1.0, m_correction );
+}
+
+template< typename LAI >
+void CPRPreconditioner< LAI >::clear()
+{
+  Base::clear();
+  m_pressurePrecond->clear();
+  m_smoother->clear();
+  m_restrictor.reset();
+  m_prolongator.reset();
+  m_decoupling.reset();
+  m_pressureMatrix.reset();
+  m_rhsPressure.reset();
+  m_solPressure.reset();
+  m_residual.reset();
+  m_correction.reset();
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class CPRPreconditioner< TrilinosInterface >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class CPRPreconditioner< HypreInterface >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class CPRPreconditioner< PetscInterface >;
+#endif
+
+}
@@ -0,0 +1,190 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CPRPreconditioner.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_SOLVERS_CPRPRECONDITIONER_HPP_
+#define GEOSX_LINEARALGEBRA_SOLVERS_CPRPRECONDITIONER_HPP_
+
+#include "linearAlgebra/DofManager.hpp"
+#include "linearAlgebra/solvers/PreconditionerBase.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+
+#include <memory>
+
+namespace geosx
+{
+
+/*
+ * Keeping the formulas in a separate comment block, see BlockPreconditioner.hpp.
+ *
+ * This class implements the two-stage preconditioner:
+ * @f$
+ * M^{-1} = M_{s}^{-1} \left( I - A P_{p} M_{p}^{-1} W_{p} \right) + P_{p} M_{p}^{-1} W_{p}
+ * @f$
+ * where @f$ P_{p} @f$ prolongates the pressure unknowns, @f$ W_{p} @f$ combines the equations of
+ * each element into a pressure equation with quasi-IMPES weights, @f$ M_{p}^{-1} ~= (W_{p} A P_{p})^{-1} @f$
+ * is the pressure preconditioner and @f$ M_{s}^{-1} @f$ is the smoother of the full system.
+ *
+ * The weights @f$ w_{i} @f$ of element @f$ i @f$ solve @f$ D_{i}^{T} w_{i} = e_{p} @f$, where @f$ D_{i} @f$
+ * is the diagonal block of the element: the pressure equation does not depend on the other
+ * primary variables of the element. Elements with a singular diagonal block keep their pressure row unchanged.
+ */
+
+/**
+ * @brief Two-stage Constrained Pressure Residual (CPR) preconditioner.
+ * @tparam LAI type of linear algebra interface providing matrix/vector types
+ *
+ * The pressure is expected to be a single component of each selected DoF field, all components
+ * of a field at a given support point making up the diagonal block used for decoupling.
+ */
+template< typename LAI >
+class CPRPreconditioner : public PreconditionerBase< LAI >
+{
+public:
+
+  /// Alias for the base type
+  using Base = PreconditionerBase< LAI >;
+
+  /// Alias for the vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for the matrix type
+  using Matrix = typename Base::Matrix;
+
+  /**
+   * @brief Constructor.
+   * @param pressureDofs the pressure component of each DoF field (one component per field)
+   * @param pressurePrecond preconditioner of the decoupled pressure system (ownership transferred)
+   * @param smoother preconditioner of the full system used in the second stage (ownership transferred)
+   */
+  CPRPreconditioner( std::vector< DofManager::SubComponent > pressureDofs,
+                     std::unique_ptr< PreconditionerBase< LAI > > pressurePrecond,
+                     std::unique_ptr< PreconditionerBase< LAI > > smoother );
+
+  /**
+   * @brief Constructor with the default stages: AMG on the pressure and ILU(0) on the full system.
+   * @param params the linear solver parameters (AMG parameters are used for the pressure stage)
+   * @param pressureDofs the pressure component of each DoF field (one component per field)
+   */
+  CPRPreconditioner( LinearSolverParameters const & params,
+                     std::vector< DofManager::SubComponent > pressureDofs );
+
+  /**
+   * @brief Constructor with a given pressure preconditioner and the default ILU(0) smoother.
+   * @param params the linear solver parameters
+   * @param pressureDofs the pressure component of each DoF field (one component per field)
+   * @param pressurePrecond preconditioner of the decoupled pressure system (ownership transferred)
+   */
+  CPRPreconditioner( LinearSolverParameters const & params,
+                     std::vector< DofManager::SubComponent > pressureDofs,
+                     std::unique_ptr< PreconditionerBase< LAI > > pressurePrecond );
+
+  /**
+   * @brief Destructor.
+   */
+  virtual ~CPRPreconditioner() override;
+
+  /**
+   * @name PreconditionerBase interface methods
+   */
+  ///@{
+
+  using PreconditionerBase< LAI >::compute;
+
+  /**
+   * @brief Compute the preconditioner from a matrix
+   * @param mat the matrix to precondition
+   * @param dofManager the Degree-of-Freedom manager associated with matrix
+   */
+  virtual void compute( Matrix const & mat,
+                        DofManager const & dofManager ) override;
+
+  /**
+   * @brief Apply operator to a vector
+   * @param src Input vector (x).
+   * @param dst Output vector (b).
+   *
+   * @warning @p src and @p dst cannot alias the same vector.
+   */
+  virtual void apply( Vector const & src, Vector & dst ) const override;
+
+  virtual void clear() override;
+
+  ///@}
+
+  /**
+   * @brief Access the decoupled pressure matrix.
+   * @return reference to the pressure matrix
+   */
+  Matrix const & getPressureMatrix() const
+  {
+    return m_pressureMatrix;
+  }
+
+private:
+
+  /**
+   * @brief Initialize/resize internal data structures for a new linear system.
+   * @param mat the new system matrix
+   * @param dofManager the new dof manager
+   */
+  void reinitialize( Matrix const & mat, DofManager const & dofManager );
+
+  /**
+   * @brief Compute the quasi-IMPES decoupling operator from the diagonal blocks of the matrix.
+   * @param mat the system matrix
+   * @param dofManager the dof manager
+   */
+  void computeDecoupling( Matrix const & mat, DofManager const & dofManager );
+
+  /// Description of the pressure components
+  std::vector< DofManager::SubComponent > m_pressureDofs;
+
+  /// Restriction to the pressure unknowns
+  Matrix m_restrictor;
+
+  /// Prolongation from the pressure unknowns
+  Matrix m_prolongator;
+
+  /// Quasi-IMPES decoupling operator, combining the equations of each element into a pressure equation
+  Matrix m_decoupling;
+
+  /// Decoupled pressure matrix
+  Matrix m_pressureMatrix;
+
+  /// Preconditioner of the pressure system
+  std::unique_ptr< PreconditionerBase< LAI > > m_pressurePrecond;
+
+  /// Smoother of the full system
+  std::unique_ptr< PreconditionerBase< LAI > > m_smoother;
+
+  /// Internal pressure residual
+  mutable Vector m_rhsPressure;
+
+  /// Internal pressure solution
+  mutable Vector m_solPressure;
+
+  /// Internal residual of the full system
+  mutable Vector m_residual;
+
+  /// Internal correction of the full system
+  mutable Vector m_correction;
+};
+
+} //namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_SOLVERS_CPRPRECONDITIONER_HPP_
@@ -0,0 +1,541 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file GCRODRsolver.cpp
+ */
+
+#include "GCRODRsolver.hpp"
+
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/BlasLapackLA.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace geosx
+{
+
+template< typename VECTOR >
+GCRODRsolver< VECTOR >::GCRODRsolver( LinearOperator< Vector > const & A,
+                                      LinearOperator< Vector > const & M,
+                                      real64 tolerance,
+                                      localIndex maxIterations,
+                                      integer verbosity,
+                                      localIndex maxRestart,
+                                      localIndex recycleSize )
+  : KrylovSolver< VECTOR >( A, M, tolerance, maxIterations, verbosity ),
+  m_maxRestart( maxRestart ),
+  m_recycleSize( recycleSize ),
+  m_kspace( m_maxRestart + 1 ),
+  m_recycleU( m_recycleSize ),
+  m_recycleC( m_recycleSize ),
+  m_nextU( m_recycleSize ),
+  m_nextC( m_recycleSize ),
+  m_numRecycled( 0 ),
+  m_recycleGlobalSize( -1 )
+{
+  GEOSX_ERROR_IF_LE_MSG( m_maxRestart, 0, "GCRO-DR: max number of restart iterations must be positive." );
+  GEOSX_ERROR_IF_LE_MSG( m_recycleSize, 0, "GCRO-DR: the size of the recycled subspace must be positive." );
+  GEOSX_ERROR_IF_GE_MSG( m_recycleSize, m_maxRestart,
+                         "GCRO-DR: the size of the recycled subspace must be smaller than the max number of restart iterations." );
+}
+
+template< typename VECTOR >
+GCRODRsolver< VECTOR >::~GCRODRsolver() = default;
+
+template< typename VECTOR >
+void GCRODRsolver< VECTOR >::updateRecycledSpace( Vector & z ) const
+{
+  array1d< Vector const * > basis;
+  array1d< real64 > h;
+  basis.reserve( m_numRecycled );
+  h.reserve( m_numRecycled );
+
+  // Orthonormalize C = A*M*U with CGS2, applying the same combinations to U so that the relation holds.
+  // The vectors that became (numerically) dependent with the new operator are dropped.
+  localIndex numAccepted = 0;
+  for( localIndex i = 0; i < m_numRecycled; ++i )
+  {
+    m_precond.apply( m_recycleU[i], z );
+    m_operator.apply( z, m_recycleC[i] );
+    real64 const initialNorm = m_recycleC[i].norm2();
+
+    h.resize( i );
+    for( integer pass = 0; pass < 2 && i > 0; ++pass )
+    {
+      m_recycleC[i].multiDot( basis.toViewConst(), h );
+      for( localIndex l = 0; l < i; ++l )
+      {
+        m_recycleC[i].axpy( -h[l], m_recycleC[l] );
+        m_recycleU[i].axpy( -h[l], m_recycleU[l] );
+      }
+    }
+
+    real64 const norm = m_recycleC[i].norm2();
+    if( norm <= std::sqrt( NumericTraits< real64 >::eps ) * initialNorm || isZero( norm ) )
+    {
+      break;
+    }
+    m_recycleC[i].scale( 1.0 / norm );
+    m_recycleU[i].scale( 1.0 / norm );
+    basis.emplace_back( &m_recycleC[i] );
+    numAccepted = i + 1;
+  }
+
+  GEOSX_LOG_LEVEL_RANK_0( 2, methodName() << ": recycling " << numAccepted << " of " << m_numRecycled << " vectors" );
+  m_numRecycled = numAccepted;
+}
+
+template< typename VECTOR >
+void GCRODRsolver< VECTOR >::projectOnRecycledSpace( Vector & r, Vector & x, Vector & w, Vector & z ) const
+{
+  array1d< Vector const * > basis( m_numRecycled );
+  array1d< real64 > h( m_numRecycled );
+  for( localIndex i = 0; i < m_numRecycled; ++i )
+  {
+    basis[i] = &m_recycleC[i];
+  }
+
+  // x += M*U*C^T*r, r -= C*C^T*r
+  r.multiDot( basis.toViewConst(), h );
+  w.zero();
+  for( localIndex i = 0; i < m_numRecycled; ++i )
+  {
+    w.axpy( h[i], m_recycleU[i] );
+    r.axpy( -h[i], m_recycleC[i] );
+  }
+  m_precond.apply( w, z );
+  x.axpy( 1.0, z );
+}
+
+template< typename VECTOR >
+void GCRODRsolver< VECTOR >::computeHarmonicRitzSpace( localIndex const numArnoldi,
+                                                       arraySlice2d< real64 const, MatrixLayout::COL_MAJOR > const & G,
+                                                       arraySlice1d< real64 const > const & d ) const
+{
+  localIndex const numRecycled = m_numRecycled;
+  localIndex const n = numRecycled + numArnoldi;
+
+  // W^T*V, with W = [C, V_0..V_numArnoldi] the orthonormal basis of the image of V = [U*D, V_0..V_numArnoldi-1]
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > WV( n + 1, n );
+  WV.setValues< serialPolicy >( 0.0 );
+  for( localIndex j = 0; j < numArnoldi; ++j )
+  {
+    WV( numRecycled + j, numRecycled + j ) = 1.0;
+  }
+  if( numRecycled > 0 )
+  {
+    array1d< Vector const * > basis( n + 1 );
+    array1d< real64 > h( n + 1 );
+    for( localIndex l = 0; l < numRecycled; ++l )
+    {
+      basis[l] = &m_recycleC[l];
+    }
+    for( localIndex j = 0; j <= numArnoldi; ++j )
+    {
+      basis[numRecycled + j] = &m_kspace[j];
+    }
+    for( localIndex i = 0; i < numRecycled; ++i )
+    {
+      m_recycleU[i].multiDot( basis.toViewConst(), h );
+      for( localIndex l = 0; l <= n; ++l )
+      {
+        WV( l, i ) = d[i] * h[l];
+      }
+    }
+  }
+
+  // The harmonic Ritz pairs solve G^T*G*p = theta*G^T*W^T*V*p
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > GTG( n, n );
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > GTWV( n, n );
+  for( localIndex a = 0; a < n; ++a )
+  {
+    for( localIndex b = 0; b < n; ++b )
+    {
+      real64 sumG = 0.0;
+      real64 sumWV = 0.0;
+      for( localIndex l = 0; l <= n; ++l )
+      {
+        sumG += G( l, a ) * G( l, b );
+        sumWV += G( l, a ) * WV( l, b );
+      }
+      GTG( a, b ) = sumG;
+      GTWV( a, b ) = sumWV;
+    }
+  }
+
+  array1d< real64 > alphaR( n );
+  array1d< real64 > alphaI( n );
+  array1d< real64 > beta( n );
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > eigenVectors( n, n );
+  BlasLapackLA::matrixGeneralizedEigen( GTG.toSliceConst(), GTWV.toSliceConst(),
+                                        alphaR, alphaI, beta, eigenVectors.toSlice() );
+
+  // Sort the harmonic Ritz values by increasing magnitude, the infinite ones last
+  array1d< real64 > magnitude( n );
+  array1d< localIndex > order( n );
+  for( localIndex i = 0; i < n; ++i )
+  {
+    magnitude[i] = isZero( beta[i] )
+                 ? std::numeric_limits< real64 >::max()
+                 : std::sqrt( alphaR[i] * alphaR[i] + alphaI[i] * alphaI[i] ) / std::fabs( beta[i] );
+  }
+  std::iota( order.begin(), order.end(), 0 );
+  std::sort( order.begin(), order.end(), [&]( localIndex const i, localIndex const j )
+  {
+    return magnitude[i] < magnitude[j];
+  } );
+
+  // Select the vectors of the smallest values, a complex pair contributing its real and imaginary parts
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > P( n, m_recycleSize );
+  array1d< integer > selected( n );
+  selected.setValues< serialPolicy >( 0 );
+  localIndex numSelected = 0;
+  for( localIndex const i : order )
+  {
+    if( numSelected == m_recycleSize )
+    {
+      break;
+    }
+    if( selected[i] )
+    {
+      continue;
+    }
+    localIndex const first = ( alphaI[i] < 0.0 ) ? i - 1 : i;
+    localIndex const numVectors = ( alphaI[i] < 0.0 || alphaI[i] > 0.0 ) ? 2 : 1;
+    if( numSelected + numVectors > m_recycleSize )
+    {
+      continue;
+    }
+    for( localIndex v = first; v < first + numVectors; ++v )
+    {
+      for( localIndex a = 0; a < n; ++a )
+      {
+        P( a, numSelected ) = eigenVectors( a, v );
+      }
+      selected[v] = 1;
+      ++numSelected;
+    }
+  }
+
+  // QR factorization G*P = Q*R with modified Gram-Schmidt
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > Q( n + 1, numSelected );
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > R( numSelected, numSelected );
+  for( localIndex i = 0; i < numSelected; ++i )
+  {
+    for( localIndex l = 0; l <= n; ++l )
+    {
+      real64 sum = 0.0;
+      for( localIndex a = 0; a < n; ++a )
+      {
+        sum += G( l, a ) * P( a, i );
+      }
+      Q( l, i ) = sum;
+    }
+  }
+
+  localIndex numAccepted = 0;
+  for( localIndex i = 0; i < numSelected; ++i )
+  {
+    real64 initialNorm = 0.0;
+    for( localIndex l = 0; l <= n; ++l )
+    {
+      initialNorm += Q( l, i ) * Q( l, i );
+    }
+    initialNorm = std::sqrt( initialNorm );
+
+    for( localIndex j = 0; j < i; ++j )
+    {
+      real64 dot = 0.0;
+      for( localIndex l = 0; l <= n; ++l )
+      {
+        dot += Q( l, j ) * Q( l, i );
+      }
+      R( j, i ) = dot;
+      for( localIndex l = 0; l <= n; ++l )
+      {
+        Q( l, i ) -= dot * Q( l, j );
+      }
+    }
+
+    real64 norm = 0.0;
+    for( localIndex l = 0; l <= n; ++l )
+    {
+      norm += Q( l, i ) * Q( l, i );
+    }
+    norm = std::sqrt( norm );
+    if( norm <= std::sqrt( NumericTraits< real64 >::eps ) * initialNorm || isZero( norm ) )
+    {
+      break;
+    }
+    R( i, i ) = norm;
+    for( localIndex l = 0; l <= n; ++l )
+    {
+      Q( l, i ) /= norm;
+    }
+    numAccepted = i + 1;
+  }
+
+  // P*R^{-1} in place: the coefficients of the next U in V
+  for( localIndex i = 0; i < numAccepted; ++i )
+  {
+    for( localIndex a = 0; a < n; ++a )
+    {
+      for( localIndex j = 0; j < i; ++j )
+      {
+        P( a, i ) -= R( j, i ) * P( a, j );
+      }
+      P( a, i ) /= R( i, i );
+    }
+  }
+
+  // Next U = V*P*R^{-1} and C = W*Q, so that A*M*U = C holds
+  for( localIndex i = 0; i < numAccepted; ++i )
+  {
+    m_nextU[i].zero();
+    m_nextC[i].zero();
+    for( localIndex l = 0; l < numRecycled; ++l )
+    {
+      m_nextU[i].axpy( P( l, i ) * d[l], m_recycleU[l] );
+      m_nextC[i].axpy( Q( l, i ), m_recycleC[l] );
+    }
+    for( localIndex j = 0; j < numArnoldi; ++j )
+    {
+      m_nextU[i].axpy( P( numRecycled + j, i ), m_kspace[j] );
+    }
+    for( localIndex j = 0; j <= numArnoldi; ++j )
+    {
+      m_nextC[i].axpy( Q( numRecycled + j, i ), m_kspace[j] );
+    }
+  }
+
+  for( localIndex i = 0; i < m_recycleSize; ++i )
+  {
+    std::swap( m_recycleU[i], m_nextU[i] );
+    std::swap( m_recycleC[i], m_nextC[i] );
+  }
+  m_numRecycled = numAccepted;
+}
+
+template< typename VECTOR >
+void GCRODRsolver< VECTOR >::solve( Vector const & b,
+                                    Vector & x ) const
+{
+  // We create the vectors using the size and partitioning of b. They are kept from one call
+  // to the next with the recycled subspace, unless the size of the system changes.
+  if( m_recycleGlobalSize != b.globalSize() )
+  {
+    for( localIndex i = 0; i < m_maxRestart + 1; ++i )
+    {
+      m_kspace[i] = createTempVector( b );
+    }
+    for( localIndex i = 0; i < m_recycleSize; ++i )
+    {
+      m_recycleU[i] = createTempVector( b );
+      m_recycleC[i] = createTempVector( b );
+      m_nextU[i] = createTempVector( b );
+      m_nextC[i] = createTempVector( b );
+    }
+    m_numRecycled = 0;
+    m_recycleGlobalSize = b.globalSize();
+  }
+
+  Stopwatch watch;
+
+  // Compute the target absolute tolerance
+  real64 const absTol = b.norm2() * m_tolerance;
+
+  // Define vectors
+  VectorTemp r = createTempVector( b );
+  VectorTemp w = createTempVector( b );
+  VectorTemp z = createTempVector( b );
+
+  // The operator or the preconditioner changed since the recycled subspace was computed
+  if( m_numRecycled > 0 )
+  {
+    updateRecycledSpace( z );
+  }
+
+  // Compute initial rk
+  m_operator.residual( x, b, r );
+
+  // Create the generalized Hessenberg matrix G = [D B; 0 H] of the relation A*M*[U*D, V] = [C, V]*G,
+  // and its copy reduced to upper triangular form by plane rotations
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > G( m_maxRestart + 1, m_maxRestart );
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > H( m_maxRestart + 1, m_maxRestart );
+
+  // Create plane rotation storage
+  array1d< real64 > c( m_maxRestart + 1 );
+  array1d< real64 > s( m_maxRestart + 1 );
+  array1d< real64 > g( m_maxRestart + 1 );
+
+  // Scaling of the recycled vectors to unit norm
+  array1d< real64 > d( m_recycleSize );
+
+  // Create storage for the batched projections on the current basis
+  array1d< Vector const * > basis;
+  array1d< real64 > h;
+  basis.reserve( m_maxRestart + 1 );
+  h.reserve( m_maxRestart + 1 );
+
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.resize( m_maxIterations + 1 );
+
+  localIndex k;
+  real64 rnorm = 0.0;
+
+  for( k = 0; k <= m_maxIterations && m_result.status == LinearSolverResult::Status::NotConverged; )
+  {
+    localIndex const numRecycled = m_numRecycled;
+
+    // Remove the component of the residual in the range of C, so that the least-squares
+    // right-hand side of the cycle only has one nonzero entry
+    if( numRecycled > 0 )
+    {
+      projectOnRecycledSpace( r, x, w, z );
+    }
+
+    G.setValues< serialPolicy >( 0.0 );
+    H.setValues< serialPolicy >( 0.0 );
+    g.setValues< serialPolicy >( 0.0 );
+    basis.resize( numRecycled );
+    for( localIndex i = 0; i < numRecycled; ++i )
+    {
+      d[i] = 1.0 / m_recycleU[i].norm2();
+      G( i, i ) = d[i];
+      H( i, i ) = d[i];
+      basis[i] = &m_recycleC[i];
+    }
+    g[numRecycled] = r.norm2();
+
+    localIndex j;
+    for( j = 0; j < m_maxRestart - numRecycled && k <= m_maxIterations; ++j, ++k )
+    {
+      localIndex const col = numRecycled + j;
+
+      // Record iteration progress
+      rnorm = std::fabs( g[col] );
+      logProgress( k, rnorm );
+
+      // Convergence check
+      if( rnorm < absTol )
+      {
+        m_result.status = LinearSolverResult::Status::Success;
+        break;
+      }
+
+      // Re-initialize Krylov subspace
+      if( j == 0 )
+      {
+        m_kspace[0].axpby( 1.0 / g[col], r, 0.0 );
+      }
+
+      // Compute the new vector
+      m_precond.apply( m_kspace[j], z );
+      m_operator.apply( z, w );
+
+      // Orthogonalization against C and the Arnoldi basis with CGS2, in batched reductions
+      basis.resize( col + 1 );
+      basis[col] = &m_kspace[j];
+      h.resize( col + 1 );
+      for( integer pass = 0; pass < 2; ++pass )
+      {
+        w.multiDot( basis.toViewConst(), h );
+        for( localIndex i = 0; i <= col; ++i )
+        {
+          G( i, col ) += h[i];
+          w.axpy( -h[i], *basis[i] );
+        }
+      }
+
+      G( col + 1, col ) = w.norm2();
+      GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( G( col + 1, col ) );
+      if( m_result.status == LinearSolverResult::Status::Breakdown )
+      {
+        break;
+      }
+      m_kspace[j+1].axpby( 1.0 / G( col + 1, col ), w, 0.0 );
+
+      // Apply the previous rotations of the cycle to the new column, the recycled columns being diagonal
+      for( localIndex i = 0; i <= col + 1; ++i )
+      {
+        H( i, col ) = G( i, col );
+      }
+      for( localIndex i = 0; i < j; ++i )
+      {
+        krylov::ApplyGivensRotation( c[i], s[i], H( numRecycled + i, col ), H( numRecycled + i + 1, col ) );
+      }
+
+      // Compute and apply the new rotation to eliminate subdiagonal element
+      krylov::ComputeGivensRotation( H( col, col ), H( col + 1, col ), c[j], s[j] );
+      krylov::ApplyGivensRotation( c[j], s[j], H( col, col ), H( col + 1, col ) );
+      krylov::ApplyGivensRotation( c[j], s[j], g[col], g[col + 1] );
+    }
+
+    // Regardless of how we quit out of inner loop, numRecycled + j is the actual size of H
+    krylov::Backsolve( numRecycled + j, H, g );
+    w.zero();
+    for( localIndex i = 0; i < numRecycled; ++i )
+    {
+      w.axpy( g[i] * d[i], m_recycleU[i] );
+    }
+    for( localIndex i = 0; i < j; ++i )
+    {
+      w.axpy( g[numRecycled + i], m_kspace[i] );
+    }
+    m_precond.apply( w, z );
+
+    // Update the solution vector
+    x.axpy( 1.0, z );
+
+    // Deflate the harmonic Ritz vectors of smallest magnitude in the next cycles and solves
+    if( j > 0 && m_result.status != LinearSolverResult::Status::Breakdown )
+    {
+      computeHarmonicRitzSpace( j, G.toSliceConst(), d.toSliceConst() );
+    }
+
+    // Recompute residual
+    m_operator.residual( x, b, r );
+  }
+
+  m_result.numIterations = k;
+  m_result.residualReduction = rnorm / absTol * m_tolerance;
+  m_result.solveTime = watch.elapsedTime();
+
+  logResult();
+  m_residualNorms.resize( m_result.numIterations + 1 );
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class GCRODRsolver< TrilinosInterface::ParallelVector >;
+template class GCRODRsolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class GCRODRsolver< HypreInterface::ParallelVector >;
+template class GCRODRsolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class GCRODRsolver< PetscInterface::ParallelVector >;
+template class GCRODRsolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} // namespace geosx
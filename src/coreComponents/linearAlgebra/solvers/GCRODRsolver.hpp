@@ -0,0 +1,192 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file GCRODRsolver.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_SOLVERS_GCRODRSOLVER_HPP_
+#define GEOSX_LINEARALGEBRA_SOLVERS_GCRODRSOLVER_HPP_
+
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief This class implements the Generalized Conjugate Residual method with inner
+ *        Orthogonalization and Deflated Restarting (right-preconditioned)
+ *        for monolithic and block linear operators.
+ * @tparam VECTOR type of vectors this solver operates on.
+ *
+ * At every restart, the harmonic Ritz vectors of the preconditioned operator associated with the
+ * eigenvalues of smallest magnitude are kept in a deflation subspace U, with C = A*M*U orthonormal,
+ * and the following Arnoldi cycles are orthogonalized against C. The subspace survives the end of
+ * solve(): on the next call, C is recomputed with the current operator and preconditioner, so that
+ * sequences of slowly changing systems (Newton iterations, time steps) start from the deflated space.
+ *
+ * @note  The notation is consistent with "Recycling Krylov subspaces for sequences of
+ *        linear systems" from M.L. Parks et al. (2006).
+ */
+template< typename VECTOR >
+class GCRODRsolver : public KrylovSolver< VECTOR >
+{
+public:
+
+  /// Alias for the base type
+  using Base = KrylovSolver< VECTOR >;
+
+  /// Alias for the vector type
+  using Vector = typename Base::Vector;
+
+  /**
+   * @name Constructor/Destructor Methods
+   */
+  ///@{
+
+  /**
+   * @brief Solver object constructor.
+   * @param[in] matrix        reference to the system matrix
+   * @param[in] precond       reference to the preconditioning operator
+   * @param[in] tolerance     relative residual norm reduction tolerance
+   * @param[in] maxIterations maximum number of Krylov iterations
+   * @param[in] verbosity     solver verbosity level
+   * @param[in] maxRestart    number of iterations until restart, including the recycled vectors
+   * @param[in] recycleSize   number of vectors of the recycled subspace
+   */
+  GCRODRsolver( LinearOperator< Vector > const & matrix,
+                LinearOperator< Vector > const & precond,
+                real64 const tolerance,
+                localIndex const maxIterations,
+                integer const verbosity = 0,
+                localIndex const maxRestart = 100,
+                localIndex const recycleSize = 10 );
+
+  /**
+   * @brief Virtual destructor.
+   */
+  virtual ~GCRODRsolver() override;
+
+  ///@}
+
+  /**
+   * @name KrylovSolver interface
+   */
+  ///@{
+
+  /**
+   * @brief Solve preconditioned system
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  virtual void solve( Vector const & b, Vector & x ) const override final;
+
+  virtual string methodName() const override final
+  {
+    return "GCRO-DR";
+  };
+
+  ///@}
+
+  /**
+   * @brief Get the current dimension of the recycled subspace.
+   * @return the number of recycled vectors
+   */
+  localIndex numRecycled() const
+  {
+    return m_numRecycled;
+  }
+
+  /**
+   * @brief Discard the recycled subspace, e.g. when the size of the system changes.
+   */
+  void clearRecycledSpace()
+  {
+    m_numRecycled = 0;
+  }
+
+protected:
+
+  /// Alias for vector type that can be used for temporaries
+  using VectorTemp = typename KrylovSolver< VECTOR >::VectorTemp;
+
+  using Base::m_operator;
+  using Base::m_precond;
+  using Base::m_tolerance;
+  using Base::m_maxIterations;
+  using Base::m_logLevel;
+  using Base::m_result;
+  using Base::m_residualNorms;
+  using Base::createTempVector;
+  using Base::logProgress;
+  using Base::logResult;
+
+private:
+
+  /**
+   * @brief Recompute C = A*M*U for the current operator and preconditioner, and orthonormalize it.
+   * @param z a work vector
+   */
+  void updateRecycledSpace( Vector & z ) const;
+
+  /**
+   * @brief Remove the component of the residual in the range of C from the residual and update the solution.
+   * @param r the residual
+   * @param x the solution
+   * @param w a work vector
+   * @param z a work vector
+   */
+  void projectOnRecycledSpace( Vector & r, Vector & x, Vector & w, Vector & z ) const;
+
+  /**
+   * @brief Select the next recycled subspace among the harmonic Ritz vectors of the last cycle.
+   * @param numArnoldi the number of Arnoldi vectors generated in the last cycle
+   * @param G the (unrotated) generalized Hessenberg matrix of the last cycle
+   * @param d the scaling factors of the recycled vectors
+   */
+  void computeHarmonicRitzSpace( localIndex const numArnoldi,
+                                 arraySlice2d< real64 const, MatrixLayout::COL_MAJOR > const & G,
+                                 arraySlice1d< real64 const > const & d ) const;
+
+  /// Number of iterations needed to restart, including the recycled vectors
+  localIndex m_maxRestart;
+
+  /// Maximum number of recycled vectors
+  localIndex m_recycleSize;
+
+  /// Storage for Krylov subspace vectors
+  mutable array1d< VectorTemp > m_kspace;
+
+  /// Recycled subspace U
+  mutable array1d< VectorTemp > m_recycleU;
+
+  /// Image of the recycled subspace C = A*M*U, orthonormal
+  mutable array1d< VectorTemp > m_recycleC;
+
+  /// Storage for the next recycled subspace U
+  mutable array1d< VectorTemp > m_nextU;
+
+  /// Storage for the next image of the recycled subspace C
+  mutable array1d< VectorTemp > m_nextC;
+
+  /// Current dimension of the recycled subspace
+  mutable localIndex m_numRecycled;
+
+  /// Global size of the system the recycled vectors were created for
+  mutable globalIndex m_recycleGlobalSize;
+};
+
+} // namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_SOLVERS_GCRODRSOLVER_HPP_
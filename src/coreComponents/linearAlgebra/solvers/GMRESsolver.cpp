@@ -43,54 +43,6 @@ GMRESsolver< VECTOR >::GMRESsolver( LinearOperator< Vector > const & A,
 template< typename VECTOR >
 GMRESsolver< VECTOR >::~GMRESsolver() = default;
 
-namespace
-{
-
-void ComputeGivensRotation( real64 const x, real64 const y, real64 & c, real64 & s )
-{
-  if( isZero( y ) )
-  {
-    c = 1.0;
-    s = 0.0;
-  }
-  else if( std::fabs( y ) > std::fabs( x ) )
-  {
-    real64 const nu = x / y;
-    s = 1.0 / std::sqrt( 1.0 + nu * nu );
-    c = nu * s;
-  }
-  else
-  {
-    real64 const nu = y / x;
-    c = 1.0 / std::sqrt( 1.0 + nu * nu );
-    s = nu * c;
-  }
-}
-
-void ApplyGivensRotation( real64 const c, real64 const s, real64 & dx, real64 & dy )
-{
-  real64 const temp = c * dx + s * dy;
-  dy = -s * dx + c * dy;
-  dx = temp;
-}
-
-void Backsolve( localIndex const k,
-                arraySlice2d< real64 const, MatrixLayout::COL_MAJOR > const & H,
-                arraySlice1d< real64 > const & g )
-{
-  for( localIndex j = k - 1; j >= 0; --j )
-  {
-    g[j] /= H( j, j );
-    for( localIndex i = j - 1; i >= 0; --i )
-    {
-      g[i] -= H( i, j ) * g[j];
-    }
-  }
-
-}
-
-}
-
 template< typename VECTOR >
 void GMRESsolver< VECTOR >::solve( Vector const & b,
                                    Vector & x ) const
@@ -127,6 +79,12 @@ void GMRESsolver< VECTOR >::solve( Vector const & b,
   array1d< real64 > s( m_maxRestart + 1 );
   array1d< real64 > g( m_maxRestart + 1 );
 
+  // Create storage for the batched projections on the current basis
+  array1d< Vector const * > basis;
+  array1d< real64 > h;
+  basis.reserve( m_maxRestart + 1 );
+  h.reserve( m_maxRestart + 1 );
+
   m_result.status = LinearSolverResult::Status::NotConverged;
   m_residualNorms.resize( m_maxIterations + 1 );
 
@@ -158,11 +116,23 @@ void GMRESsolver< VECTOR >::solve( Vector const & b,
       m_precond.apply( m_kspace[j], z );
       m_operator.apply( z, w );
 
-      // Orthogonalization
+      // Orthogonalization with classical Gram-Schmidt and one reorthogonalization pass (CGS2):
+      // each pass batches the projections on the whole basis in a single reduction
+      basis.resize( j + 1 );
+      basis[j] = &m_kspace[j];
+      h.resize( j + 1 );
       for( localIndex i = 0; i <= j; ++i )
       {
-        H( i, j ) = w.dot( m_kspace[i] );
-        w.axpby( -H( i, j ), m_kspace[i], 1.0 );
+        H( i, j ) = 0.0;
+      }
+      for( integer pass = 0; pass < 2; ++pass )
+      {
+        w.multiDot( basis.toViewConst(), h );
+        for( localIndex i = 0; i <= j; ++i )
+        {
+          H( i, j ) += h[i];
+          w.axpy( -h[i], m_kspace[i] );
+        }
       }
 
       H( j+1, j ) = w.norm2();
@@ -172,17 +142,17 @@ void GMRESsolver< VECTOR >::solve( Vector const & b,
       // Apply all previous rotations to the new column
       for( localIndex i = 0; i < j; ++i )
       {
-        ApplyGivensRotation( c[i], s[i], H( i, j ), H( i+1, j ) );
+        krylov::ApplyGivensRotation( c[i], s[i], H( i, j ), H( i+1, j ) );
       }
 
       // Compute and apply the new rotation to eliminate subdiagonal element
-      ComputeGivensRotation( H( j, j ), H( j+1, j ), c[j], s[j] );
-      ApplyGivensRotation( c[j], s[j], H( j, j ), H( j+1, j ) );
-      ApplyGivensRotation( c[j], s[j], g[j], g[j+1] );
+      krylov::ComputeGivensRotation( H( j, j ), H( j+1, j ), c[j], s[j] );
+      krylov::ApplyGivensRotation( c[j], s[j], H( j, j ), H( j+1, j ) );
+      krylov::ApplyGivensRotation( c[j], s[j], g[j], g[j+1] );
     }
 
     // Regardless of how we quit out of inner loop, j is the actual size of H
-    Backsolve( j, H, g );
+    krylov::Backsolve( j, H, g );
     w.zero();
     for( localIndex i = 0; i < j; ++i )
     {
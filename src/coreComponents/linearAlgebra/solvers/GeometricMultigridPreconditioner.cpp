@@ -0,0 +1,248 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file GeometricMultigridPreconditioner.cpp
+ */
+
+#include "GeometricMultigridPreconditioner.hpp"
+
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/SeparateComponentPreconditioner.hpp"
+
+namespace geosx
+{
+
+namespace
+{
+
+/// Number of power iterations estimating the largest eigenvalue of the Jacobi-preconditioned matrix
+constexpr integer numPowerIterations = 10;
+
+/**
+ * @brief Create the AMG preconditioner of the coarse matrix.
+ * @tparam LAI linear algebra interface to use
+ * @param params the linear solver parameters
+ * @return the coarse preconditioner
+ */
+template< typename LAI >
+std::unique_ptr< PreconditionerBase< LAI > > createCoarsePrecond( LinearSolverParameters params )
+{
+  params.preconditionerType = LinearSolverParameters::PreconditionerType::amg;
+  std::unique_ptr< PreconditionerBase< LAI > > precond = LAI::createPreconditioner( params );
+  // the coarse rows keep the components of each node together, as the fine ones
+  if( params.amg.separateComponents )
+  {
+    precond = std::make_unique< SeparateComponentPreconditioner< LAI > >( params.dofsPerNode, std::move( precond ) );
+  }
+  return precond;
+}
+
+} // namespace
+
+template< typename LAI >
+GeometricMultigridPreconditioner< LAI >::
+GeometricMultigridPreconditioner( CRSMatrix< real64, globalIndex > && localProlongator,
+                                  localIndex const numLocalCoarseRows,
+                                  integer const numSweeps,
+                                  std::unique_ptr< PreconditionerBase< LAI > > coarsePrecond )
+  : Base(),
+  m_localProlongator( std::move( localProlongator ) ),
+  m_numLocalCoarseRows( numLocalCoarseRows ),
+  m_numSweeps( numSweeps ),
+  m_damping( 0.0 ),
+  m_coarsePrecond( std::move( coarsePrecond ) )
+{
+  GEOSX_LAI_ASSERT( m_coarsePrecond );
+  GEOSX_LAI_ASSERT_GE( m_numLocalCoarseRows, 0 );
+  GEOSX_LAI_ASSERT_GT( m_numSweeps, 0 );
+}
+
+template< typename LAI >
+GeometricMultigridPreconditioner< LAI >::
+GeometricMultigridPreconditioner( LinearSolverParameters const & params,
+                                  CRSMatrix< real64, globalIndex > && localProlongator,
+                                  localIndex const numLocalCoarseRows )
+  : GeometricMultigridPreconditioner( std::move( localProlongator ),
+                                      numLocalCoarseRows,
+                                      params.amg.numSweeps,
+                                      createCoarsePrecond< LAI >( params ) )
+{}
+
+template< typename LAI >
+GeometricMultigridPreconditioner< LAI >::~GeometricMultigridPreconditioner() = default;
+
+template< typename LAI >
+void GeometricMultigridPreconditioner< LAI >::reinitialize( Matrix const & mat )
+{
+  GEOSX_LAI_ASSERT_EQ( m_localProlongator.numRows(), mat.numLocalRows() );
+
+  MPI_Comm const & comm = mat.getComm();
+
+  localIndex maxRowLength = 1;
+  for( localIndex i = 0; i < m_localProlongator.numRows(); ++i )
+  {
+    maxRowLength = std::max( maxRowLength, m_localProlongator.numNonZeros( i ) );
+  }
+
+  m_prolongator.createWithLocalSize( mat.numLocalRows(), m_numLocalCoarseRows, maxRowLength, comm );
+  m_prolongator.open();
+  for( localIndex i = 0; i < m_localProlongator.numRows(); ++i )
+  {
+    arraySlice1d< globalIndex const > const cols = m_localProlongator.getColumns( i );
+    arraySlice1d< real64 const > const values = m_localProlongator.getEntries( i );
+    for( localIndex k = 0; k < cols.size(); ++k )
+    {
+      m_prolongator.insert( mat.ilower() + i, cols[k], values[k] );
+    }
+  }
+  m_prolongator.close();
+  GEOSX_ERROR_IF( m_prolongator.numGlobalCols() == 0, "The geometric multigrid preconditioner needs a coarse level" );
+
+  m_diagInv.createWithLocalSize( mat.numLocalRows(), comm );
+  m_residual.createWithLocalSize( mat.numLocalRows(), comm );
+  m_correction.createWithLocalSize( mat.numLocalRows(), comm );
+  m_rhsCoarse.createWithLocalSize( m_numLocalCoarseRows, comm );
+  m_solCoarse.createWithLocalSize( m_numLocalCoarseRows, comm );
+}
+
+template< typename LAI >
+void GeometricMultigridPreconditioner< LAI >::computeDamping( Matrix const & mat )
+{
+  real64 const * const diagInv = m_diagInv.extractLocalVector();
+
+  // power iterations on D^{-1} A, the correction vector holds the iterate
+  m_correction.rand();
+  m_correction.scale( 1.0 / m_correction.norm2() );
+  real64 lambdaMax = 1.0;
+  for( integer iter = 0; iter < numPowerIterations; ++iter )
+  {
+    mat.apply( m_correction, m_residual );
+    real64 * const values = m_residual.extractLocalVector();
+    for( localIndex i = 0; i < m_residual.localSize(); ++i )
+    {
+      values[i] *= diagInv[i];
+    }
+    lambdaMax = m_residual.norm2();
+    GEOSX_ERROR_IF( lambdaMax <= 0.0, "The geometric multigrid smoother needs a nonsingular matrix" );
+    m_correction.copy( m_residual );
+    m_correction.scale( 1.0 / lambdaMax );
+  }
+
+  m_damping = 4.0 / ( 3.0 * lambdaMax );
+}
+
+template< typename LAI >
+void GeometricMultigridPreconditioner< LAI >::compute( Matrix const & mat )
+{
+  // A change in size indicates a new matrix structure.
+  // This is done before Base::compute() since it overwrites old sizes.
+  bool const newSize = !this->ready() ||
+                       mat.numGlobalRows() != this->numGlobalRows() ||
+                       mat.numGlobalCols() != this->numGlobalCols();
+
+  Base::compute( mat );
+
+  if( newSize )
+  {
+    reinitialize( mat );
+  }
+
+  mat.extractDiagonal( m_diagInv );
+  m_diagInv.reciprocal();
+  computeDamping( mat );
+
+  mat.multiplyPtAP( m_prolongator, m_coarseMatrix );
+  m_coarsePrecond->compute( m_coarseMatrix );
+}
+
+template< typename LAI >
+void GeometricMultigridPreconditioner< LAI >::smooth( Vector const & rhs,
+                                                      Vector & sol,
+                                                      integer const numSweeps ) const
+{
+  real64 const * const diagInv = m_diagInv.extractLocalVector();
+  real64 * const solValues = sol.extractLocalVector();
+
+  for( integer sweep = 0; sweep < numSweeps; ++sweep )
+  {
+    // r = A x - b, so that x <- x - omega D^{-1} r
+    this->matrix().residual( sol, rhs, m_residual );
+    real64 const * const residual = m_residual.extractLocalVector();
+    for( localIndex i = 0; i < sol.localSize(); ++i )
+    {
+      solValues[i] -= m_damping * diagInv[i] * residual[i];
+    }
+  }
+}
+
+template< typename LAI >
+void GeometricMultigridPreconditioner< LAI >::apply( Vector const & src,
+                                                     Vector & dst ) const
+{
+  GEOSX_LAI_ASSERT_EQ( this->numGlobalRows(), dst.globalSize() );
+  GEOSX_LAI_ASSERT_EQ( this->numGlobalCols(), src.globalSize() );
+
+  // Pre-smoothing from a zero guess: the first sweep needs no product
+  real64 const * const diagInv = m_diagInv.extractLocalVector();
+  real64 const * const srcValues = src.extractLocalVector();
+  real64 * const dstValues = dst.extractLocalVector();
+  for( localIndex i = 0; i < dst.localSize(); ++i )
+  {
+    dstValues[i] = m_damping * diagInv[i] * srcValues[i];
+  }
+  smooth( src, dst, m_numSweeps - 1 );
+
+  // Coarse correction of the residual, of opposite sign to the error
+  this->matrix().residual( dst, src, m_residual );
+  m_prolongator.applyTranspose( m_residual, m_rhsCoarse );
+  m_coarsePrecond->apply( m_rhsCoarse, m_solCoarse );
+  m_prolongator.apply( m_solCoarse, m_correction );
+  dst.axpy( -1.0, m_correction );
+
+  // Post-smoothing, as many sweeps as before to keep the cycle symmetric
+  smooth( src, dst, m_numSweeps );
+}
+
+template< typename LAI >
+void GeometricMultigridPreconditioner< LAI >::clear()
+{
+  Base::clear();
+  m_coarsePrecond->clear();
+  m_prolongator.reset();
+  m_coarseMatrix.reset();
+  m_diagInv.reset();
+  m_residual.reset();
+  m_correction.reset();
+  m_rhsCoarse.reset();
+  m_solCoarse.reset();
+  m_damping = 0.0;
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class GeometricMultigridPreconditioner< TrilinosInterface >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class GeometricMultigridPreconditioner< HypreInterface >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class GeometricMultigridPreconditioner< PetscInterface >;
+#endif
+
+}
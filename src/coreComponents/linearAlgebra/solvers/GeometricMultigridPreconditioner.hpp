@@ -0,0 +1,202 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file GeometricMultigridPreconditioner.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_SOLVERS_GEOMETRICMULTIGRIDPRECONDITIONER_HPP_
+#define GEOSX_LINEARALGEBRA_SOLVERS_GEOMETRICMULTIGRIDPRECONDITIONER_HPP_
+
+#include "linearAlgebra/solvers/PreconditionerBase.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+
+#include <memory>
+
+namespace geosx
+{
+
+/*
+ * Keeping the formulas in a separate comment block, see BlockPreconditioner.hpp.
+ *
+ * This class implements one V-cycle of a two-grid method:
+ * @f$
+ * x \leftarrow x + \omega D^{-1} ( b - A x ) \quad (\nu \text{ times}), \qquad
+ * x \leftarrow x + P M_{c}^{-1} P^{T} ( b - A x ), \qquad
+ * x \leftarrow x + \omega D^{-1} ( b - A x ) \quad (\nu \text{ times})
+ * @f$
+ * starting from @f$ x = 0 @f$, where @f$ P @f$ is the geometric prolongation given by the caller,
+ * @f$ A_{c} = P^{T} A P @f$ is the Galerkin coarse matrix and @f$ M_{c}^{-1} @f$ is a preconditioner
+ * of @f$ A_{c} @f$, algebraic multigrid by default, which coarsens the next levels.
+ *
+ * The damped Jacobi smoother only needs the product by @f$ A @f$ and its diagonal.
+ * The damping is @f$ \omega = 4 / ( 3 \lambda_{max}( D^{-1} A ) ) @f$, with the largest eigenvalue
+ * estimated by a few power iterations. With the same number of sweeps before and after the
+ * coarse correction, the cycle is symmetric and may precondition the conjugate gradient.
+ */
+
+/**
+ * @brief Two-grid preconditioner with a geometric prolongation and a damped Jacobi smoother.
+ * @tparam LAI type of linear algebra interface providing matrix/vector types
+ *
+ * The prolongation is given as its local rows, one per local row of the matrix, with the global
+ * indices of the coarse rows as columns. Each rank owns a contiguous range of coarse rows.
+ */
+template< typename LAI >
+class GeometricMultigridPreconditioner : public PreconditionerBase< LAI >
+{
+public:
+
+  /// Alias for the base type
+  using Base = PreconditionerBase< LAI >;
+
+  /// Alias for the vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for the matrix type
+  using Matrix = typename Base::Matrix;
+
+  /**
+   * @brief Constructor.
+   * @param localProlongator the local rows of the prolongation, columns numbered globally over the coarse rows
+   * @param numLocalCoarseRows the number of coarse rows owned by the rank
+   * @param numSweeps the number of smoothing sweeps before and after the coarse correction
+   * @param coarsePrecond the preconditioner of the coarse matrix (ownership transferred)
+   */
+  GeometricMultigridPreconditioner( CRSMatrix< real64, globalIndex > && localProlongator,
+                                    localIndex const numLocalCoarseRows,
+                                    integer const numSweeps,
+                                    std::unique_ptr< PreconditionerBase< LAI > > coarsePrecond );
+
+  /**
+   * @brief Constructor with the default coarse preconditioner: AMG with the parameters of @p params.
+   * @param params the linear solver parameters, providing the number of sweeps and the AMG parameters
+   * @param localProlongator the local rows of the prolongation, columns numbered globally over the coarse rows
+   * @param numLocalCoarseRows the number of coarse rows owned by the rank
+   */
+  GeometricMultigridPreconditioner( LinearSolverParameters const & params,
+                                    CRSMatrix< real64, globalIndex > && localProlongator,
+                                    localIndex const numLocalCoarseRows );
+
+  /**
+   * @brief Destructor.
+   */
+  virtual ~GeometricMultigridPreconditioner() override;
+
+  /**
+   * @name PreconditionerBase interface methods
+   */
+  ///@{
+
+  using PreconditionerBase< LAI >::compute;
+
+  /**
+   * @brief Compute the preconditioner from a matrix
+   * @param mat the matrix to precondition
+   */
+  virtual void compute( Matrix const & mat ) override;
+
+  /**
+   * @brief Apply operator to a vector
+   * @param src Input vector (x).
+   * @param dst Output vector (b).
+   *
+   * @warning @p src and @p dst cannot alias the same vector.
+   */
+  virtual void apply( Vector const & src, Vector & dst ) const override;
+
+  virtual void clear() override;
+
+  ///@}
+
+  /**
+   * @brief Access the coarse matrix.
+   * @return reference to the coarse matrix
+   */
+  Matrix const & getCoarseMatrix() const
+  {
+    return m_coarseMatrix;
+  }
+
+  /**
+   * @brief Get the damping of the Jacobi smoother.
+   * @return the damping computed from the last matrix
+   */
+  real64 getSmootherDamping() const
+  {
+    return m_damping;
+  }
+
+private:
+
+  /**
+   * @brief Build the prolongation and the internal vectors for a new linear system.
+   * @param mat the new system matrix
+   */
+  void reinitialize( Matrix const & mat );
+
+  /**
+   * @brief Estimate the largest eigenvalue of the Jacobi-preconditioned matrix and set the damping.
+   * @param mat the system matrix
+   */
+  void computeDamping( Matrix const & mat );
+
+  /**
+   * @brief Apply damped Jacobi sweeps to the fine level.
+   * @param rhs the right-hand side
+   * @param sol the solution, updated in place
+   * @param numSweeps the number of sweeps
+   */
+  void smooth( Vector const & rhs, Vector & sol, integer const numSweeps ) const;
+
+  /// Local rows of the prolongation
+  CRSMatrix< real64, globalIndex > m_localProlongator;
+
+  /// Number of local coarse rows
+  localIndex m_numLocalCoarseRows;
+
+  /// Number of smoothing sweeps before and after the coarse correction
+  integer m_numSweeps;
+
+  /// Damping of the Jacobi smoother
+  real64 m_damping;
+
+  /// Prolongation from the coarse level
+  Matrix m_prolongator;
+
+  /// Galerkin coarse matrix
+  Matrix m_coarseMatrix;
+
+  /// Preconditioner of the coarse matrix
+  std::unique_ptr< PreconditionerBase< LAI > > m_coarsePrecond;
+
+  /// Inverse of the diagonal of the matrix
+  Vector m_diagInv;
+
+  /// Internal fine residual
+  mutable Vector m_residual;
+
+  /// Internal coarse residual
+  mutable Vector m_rhsCoarse;
+
+  /// Internal coarse correction
+  mutable Vector m_solCoarse;
+
+  /// Internal fine correction
+  mutable Vector m_correction;
+};
+
+} //namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_SOLVERS_GEOMETRICMULTIGRIDPRECONDITIONER_HPP_
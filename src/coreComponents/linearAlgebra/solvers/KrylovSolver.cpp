@@ -18,8 +18,11 @@
 
 #include "KrylovSolver.hpp"
 #include "linearAlgebra/solvers/BiCGSTABsolver.hpp"
+#include "linearAlgebra/solvers/CAGMRESsolver.hpp"
 #include "linearAlgebra/solvers/CGsolver.hpp"
+#include "linearAlgebra/solvers/GCRODRsolver.hpp"
 #include "linearAlgebra/solvers/GMRESsolver.hpp"
+#include "linearAlgebra/solvers/PipelinedCGsolver.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 
 namespace geosx
@@ -77,6 +80,35 @@ KrylovSolver< VECTOR >::Create( LinearSolverParameters const & parameters,
                                                         parameters.logLevel,
                                                         parameters.krylov.maxRestart );
     }
+    case LinearSolverParameters::SolverType::pipecg:
+    {
+      GEOSX_ERROR_IF( !parameters.isSymmetric, "Cannot use pipelined CG solver with a non-symmetric system" );
+      return std::make_unique< PipelinedCGsolver< Vector > >( matrix,
+                                                              precond,
+                                                              parameters.krylov.relTolerance,
+                                                              parameters.krylov.maxIterations,
+                                                              parameters.logLevel );
+    }
+    case LinearSolverParameters::SolverType::cagmres:
+    {
+      return std::make_unique< CAGMRESsolver< Vector > >( matrix,
+                                                          precond,
+                                                          parameters.krylov.relTolerance,
+                                                          parameters.krylov.maxIterations,
+                                                          parameters.logLevel,
+                                                          parameters.krylov.maxRestart,
+                                                          parameters.krylov.stepSize );
+    }
+    case LinearSolverParameters::SolverType::gcrodr:
+    {
+      return std::make_unique< GCRODRsolver< Vector > >( matrix,
+                                                         precond,
+                                                         parameters.krylov.relTolerance,
+                                                         parameters.krylov.maxIterations,
+                                                         parameters.logLevel,
+                                                         parameters.krylov.maxRestart,
+                                                         parameters.krylov.recycleSize );
+    }
     default:
     {
       GEOSX_ERROR( "Unsupported linear solver type: " << parameters.solverType );
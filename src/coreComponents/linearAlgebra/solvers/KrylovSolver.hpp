@@ -24,6 +24,8 @@
 #include "linearAlgebra/utilities/BlockOperatorView.hpp"
 #include "linearAlgebra/utilities/LinearSolverParameters.hpp"
 #include "linearAlgebra/utilities/LinearSolverResult.hpp"
+#include "mpiCommunications/DeterministicReduction.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
 
 namespace geosx
 {
@@ -123,6 +125,15 @@ public:
     return m_residualNorms;
   }
 
+  /**
+   * @brief Set the relative residual norm reduction tolerance of the next solves.
+   * @param tolerance the tolerance
+   */
+  void setTolerance( real64 const tolerance )
+  {
+    m_tolerance = tolerance;
+  }
+
   /**
    * @brief Get log level.
    * @return integer value of the log level
@@ -153,6 +164,27 @@ private:
       v.createWithLocalSize( src.localSize(), src.getComm() );
       return v;
     }
+
+    static real64 localDot( VEC const & x, VEC const & y )
+    {
+      real64 const * const xValues = x.extractLocalVector();
+      real64 const * const yValues = y.extractLocalVector();
+      if( DeterministicReduction::isEnabled() )
+      {
+        return DeterministicReduction::localDot( xValues, yValues, x.localSize() );
+      }
+      RAJA::ReduceSum< parallelHostReduce, real64 > sum( 0.0 );
+      forAll< parallelHostPolicy >( x.localSize(), [=]( localIndex const i )
+      {
+        sum += xValues[i] * yValues[i];
+      } );
+      return sum.get();
+    }
+
+    static MPI_Comm getComm( VEC const & x )
+    {
+      return x.getComm();
+    }
   };
 
   template< typename VEC >
@@ -169,6 +201,21 @@ private:
       }
       return v;
     }
+
+    static real64 localDot( BlockVectorView< VEC > const & x, BlockVectorView< VEC > const & y )
+    {
+      real64 sum = 0.0;
+      for( localIndex i = 0; i < x.blockSize(); ++i )
+      {
+        sum += VectorStorageHelper< VEC >::localDot( x.block( i ), y.block( i ) );
+      }
+      return sum;
+    }
+
+    static MPI_Comm getComm( BlockVectorView< VEC > const & x )
+    {
+      return x.block( 0 ).getComm();
+    }
   };
 
   ///@endcond DO_NOT_DOCUMENT
@@ -190,6 +237,29 @@ protected:
     return VectorStorageHelper< VECTOR >::createFrom( src );
   }
 
+  /**
+   * @brief Compute the contribution of the locally owned entries to a dot product.
+   * @param x the first vector
+   * @param y the second vector
+   * @return the local part of the dot product, to be summed over the communicator of the vectors
+   *
+   * Used by the solvers that combine several dot products in a single global reduction.
+   */
+  static real64 localDot( Vector const & x, Vector const & y )
+  {
+    return VectorStorageHelper< VECTOR >::localDot( x, y );
+  }
+
+  /**
+   * @brief Get the communicator a vector is distributed over.
+   * @param x the vector
+   * @return the MPI communicator
+   */
+  static MPI_Comm getComm( Vector const & x )
+  {
+    return VectorStorageHelper< VECTOR >::getComm( x );
+  }
+
   /**
    * @brief Output iteration progress (called by implementations).
    * @param iter  current iteration number
@@ -19,6 +19,7 @@
 #define GEOSX_LINEARALGEBRA_SOLVERS_KRYLOVUTILS_HPP_
 
 #include "codingUtilities/Utilities.hpp"
+#include "common/DataTypes.hpp"
 
 /// Tolerance for division by zero in Krylov solvers
 #define GEOSX_KRYLOV_MIN_DIV ::geosx::NumericTraits< real64 >::eps
@@ -39,4 +40,77 @@
   } while( false )
 #endif
 
+namespace geosx
+{
+
+/// Dense kernels shared by the GMRES-type solvers
+namespace krylov
+{
+
+/**
+ * @brief Compute the Givens rotation that eliminates @p y from the vector (@p x, @p y).
+ * @param x the first entry
+ * @param y the entry to eliminate
+ * @param c the cosine of the rotation
+ * @param s the sine of the rotation
+ */
+inline void ComputeGivensRotation( real64 const x, real64 const y, real64 & c, real64 & s )
+{
+  if( isZero( y ) )
+  {
+    c = 1.0;
+    s = 0.0;
+  }
+  else if( std::fabs( y ) > std::fabs( x ) )
+  {
+    real64 const nu = x / y;
+    s = 1.0 / std::sqrt( 1.0 + nu * nu );
+    c = nu * s;
+  }
+  else
+  {
+    real64 const nu = y / x;
+    c = 1.0 / std::sqrt( 1.0 + nu * nu );
+    s = nu * c;
+  }
+}
+
+/**
+ * @brief Apply a Givens rotation to the vector (@p dx, @p dy).
+ * @param c the cosine of the rotation
+ * @param s the sine of the rotation
+ * @param dx the first entry
+ * @param dy the second entry
+ */
+inline void ApplyGivensRotation( real64 const c, real64 const s, real64 & dx, real64 & dy )
+{
+  real64 const temp = c * dx + s * dy;
+  dy = -s * dx + c * dy;
+  dx = temp;
+}
+
+/**
+ * @brief Solve the upper triangular system made of the @p k leading rows and columns of @p H in place.
+ * @param k the size of the system
+ * @param H the upper triangular matrix
+ * @param g the right-hand side on input, the solution on output
+ */
+inline void Backsolve( localIndex const k,
+                       arraySlice2d< real64 const, MatrixLayout::COL_MAJOR > const & H,
+                       arraySlice1d< real64 > const & g )
+{
+  for( localIndex j = k - 1; j >= 0; --j )
+  {
+    g[j] /= H( j, j );
+    for( localIndex i = j - 1; i >= 0; --i )
+    {
+      g[i] -= H( i, j ) * g[j];
+    }
+  }
+}
+
+} // namespace krylov
+
+} // namespace geosx
+
 #endif //GEOSX_LINEARALGEBRA_SOLVERS_KRYLOVUTILS_HPP_
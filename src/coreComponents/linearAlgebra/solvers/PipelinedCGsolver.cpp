@@ -0,0 +1,189 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PipelinedCGsolver.cpp
+ */
+
+#include "PipelinedCGsolver.hpp"
+
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/interfaces/LinearOperator.hpp"
+#include "linearAlgebra/utilities/BlockVectorView.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+#include "mpiCommunications/DeterministicReduction.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+namespace geosx
+{
+
+template< typename VECTOR >
+PipelinedCGsolver< VECTOR >::PipelinedCGsolver( LinearOperator< Vector > const & A,
+                                                LinearOperator< Vector > const & M,
+                                                real64 const tolerance,
+                                                localIndex const maxIterations,
+                                                integer const verbosity )
+  : KrylovSolver< VECTOR >( A, M, tolerance, maxIterations, verbosity )
+{}
+
+template< typename VECTOR >
+PipelinedCGsolver< VECTOR >::~PipelinedCGsolver() = default;
+
+template< typename VECTOR >
+void PipelinedCGsolver< VECTOR >::solve( Vector const & b, Vector & x ) const
+{
+  Stopwatch watch;
+
+  // Compute the target absolute tolerance
+  real64 const absTol = b.norm2() * m_tolerance;
+
+  // Residual, preconditioned residual and its image by the operator
+  VectorTemp r = createTempVector( b );
+  VectorTemp u = createTempVector( b );
+  VectorTemp w = createTempVector( b );
+
+  // Preconditioned w and its image by the operator, computed during the reduction
+  VectorTemp m = createTempVector( b );
+  VectorTemp n = createTempVector( b );
+
+  // Search direction p and the recurrences for s = Ap, q = Ms and z = Aq
+  VectorTemp p = createTempVector( b );
+  VectorTemp s = createTempVector( b );
+  VectorTemp q = createTempVector( b );
+  VectorTemp z = createTempVector( b );
+
+  p.zero();
+  s.zero();
+  q.zero();
+  z.zero();
+
+  // Compute initial r = b - Ax, u = Mr and w = Au
+  m_operator.residual( x, b, r );
+  m_precond.apply( r, u );
+  m_operator.apply( u, w );
+
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_result.numIterations = 0;
+  m_residualNorms.resize( m_maxIterations + 1 );
+
+  MPI_Comm const comm = getComm( b );
+
+  real64 gamma_old = 0.0;
+  real64 alpha_old = 0.0;
+  bool restart = true;
+
+  localIndex k;
+  real64 rnorm = 0.0;
+
+  for( k = 0; k <= m_maxIterations && m_result.status == LinearSolverResult::Status::NotConverged; ++k )
+  {
+    // Start the single reduction of the iteration: gamma = (r,u), delta = (w,u) and (r,r)
+    real64 const localDots[3] = { localDot( r, u ), localDot( w, u ), localDot( r, r ) };
+    real64 dots[3];
+    MPI_Request request = MPI_REQUEST_NULL;
+    if( DeterministicReduction::isEnabled() )
+    {
+      // the rank-ordered sum is blocking, the reduction no longer overlaps the updates
+      DeterministicReduction::sum( localDots, dots, 3, comm );
+    }
+    else
+    {
+      MpiWrapper::iAllReduce( localDots, dots, 3, MPI_SUM, comm, &request );
+    }
+
+    // Update m = Mw and n = Am while the reduction proceeds
+    m_precond.apply( w, m );
+    m_operator.apply( m, n );
+
+    MpiWrapper::Wait( &request, MPI_STATUS_IGNORE );
+
+    real64 const gamma = dots[0];
+    real64 const delta = dots[1];
+    rnorm = std::sqrt( dots[2] );
+    logProgress( k, rnorm );
+
+    // Convergence check on ||rk||/||b||
+    if( rnorm < absTol )
+    {
+      // The recurrence for r may drift away from the true residual, check the latter before exiting
+      m_operator.residual( x, b, r );
+      rnorm = r.norm2();
+      if( rnorm < absTol )
+      {
+        m_result.status = LinearSolverResult::Status::Success;
+        break;
+      }
+
+      // Restart the recurrences from the true residual
+      m_precond.apply( r, u );
+      m_operator.apply( u, w );
+      restart = true;
+      continue;
+    }
+
+    // Compute beta and alpha
+    real64 const beta = restart ? 0.0 : gamma / gamma_old;
+    real64 const denom = restart ? delta : delta - beta * gamma / alpha_old;
+    GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( denom );
+    if( m_result.status == LinearSolverResult::Status::Breakdown )
+    {
+      break;
+    }
+    real64 const alpha = gamma / denom;
+
+    // Update the recurrences
+    z.axpby( 1.0, n, beta );
+    q.axpby( 1.0, m, beta );
+    s.axpby( 1.0, w, beta );
+    p.axpby( 1.0, u, beta );
+
+    // Update x = x + alpha*p, r = r - alpha*s, u = u - alpha*q and w = w - alpha*z
+    x.axpby( alpha, p, 1.0 );
+    r.axpby( -alpha, s, 1.0 );
+    u.axpby( -alpha, q, 1.0 );
+    w.axpby( -alpha, z, 1.0 );
+
+    gamma_old = gamma;
+    alpha_old = alpha;
+    restart = false;
+  }
+
+  m_result.numIterations = std::min( k, m_maxIterations );
+  m_result.residualReduction = rnorm / absTol * m_tolerance;
+  m_result.solveTime = watch.elapsedTime();
+
+  logResult();
+  m_residualNorms.resize( m_result.numIterations + 1 );
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class PipelinedCGsolver< TrilinosInterface::ParallelVector >;
+template class PipelinedCGsolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class PipelinedCGsolver< HypreInterface::ParallelVector >;
+template class PipelinedCGsolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class PipelinedCGsolver< PetscInterface::ParallelVector >;
+template class PipelinedCGsolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} //namespace geosx
@@ -0,0 +1,117 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PipelinedCGsolver.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_SOLVERS_PIPELINEDCGSOLVER_HPP_
+#define GEOSX_LINEARALGEBRA_SOLVERS_PIPELINEDCGSOLVER_HPP_
+
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief This class implements the pipelined Conjugate Gradient method
+ *        for monolithic and block linear operators.
+ * @tparam VECTOR type of vectors this solver operates on.
+ * @note  The algorithm follows "Hiding global synchronization latency in the
+ *        preconditioned Conjugate Gradient algorithm" from P. Ghysels and
+ *        W. Vanroose (2014). The three dot products of an iteration are
+ *        combined in a single nonblocking reduction, which is overlapped with
+ *        the preconditioner and operator applications. It needs more vectors
+ *        and is slightly less stable than CGsolver, which remains preferable
+ *        when the reduction latency is not the bottleneck.
+ */
+template< typename VECTOR >
+class PipelinedCGsolver : public KrylovSolver< VECTOR >
+{
+public:
+
+  /// Alias for base type
+  using Base = KrylovSolver< VECTOR >;
+
+  /// Alias for template parameter
+  using Vector = typename Base::Vector;
+
+  /**
+   * @name Constructor/Destructor Methods
+   */
+  ///@{
+
+  /**
+   * @brief Constructor.
+   * @param [in] A reference to the system matrix.
+   * @param [in] M reference to the preconditioning operator.
+   * @param [in] tolerance relative residual norm reduction tolerance.
+   * @param [in] maxIterations maximum number of Krylov iterations.
+   * @param [in] verbosity solver verbosity level.
+   */
+  PipelinedCGsolver( LinearOperator< Vector > const & A,
+                     LinearOperator< Vector > const & M,
+                     real64 const tolerance,
+                     localIndex const maxIterations,
+                     integer const verbosity = 0 );
+
+  /**
+   * @brief Virtual destructor.
+   */
+  virtual ~PipelinedCGsolver() override;
+
+  ///@}
+
+  /**
+   * @name KrylovSolver interface
+   */
+  ///@{
+
+  /**
+   * @brief Solve preconditioned system
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  virtual void solve( Vector const & b, Vector & x ) const override final;
+
+  virtual string methodName() const override final
+  {
+    return "Pipelined CG";
+  };
+
+  ///@}
+
+protected:
+
+  /// Alias for vector type that can be used for temporaries
+  using VectorTemp = typename KrylovSolver< VECTOR >::VectorTemp;
+
+  using Base::m_operator;
+  using Base::m_precond;
+  using Base::m_tolerance;
+  using Base::m_maxIterations;
+  using Base::m_logLevel;
+  using Base::m_result;
+  using Base::m_residualNorms;
+  using Base::createTempVector;
+  using Base::localDot;
+  using Base::getComm;
+  using Base::logProgress;
+  using Base::logResult;
+
+};
+
+} // namespace geosx
+
+#endif /*GEOSX_LINEARALGEBRA_SOLVERS_PIPELINEDCGSOLVER_HPP_*/
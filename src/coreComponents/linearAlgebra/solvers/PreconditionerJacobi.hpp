@@ -0,0 +1,91 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_SOLVERS_PRECONDITIONERJACOBI_HPP_
+#define GEOSX_LINEARALGEBRA_SOLVERS_PRECONDITIONERJACOBI_HPP_
+
+#include "linearAlgebra/interfaces/LinearOperator.hpp"
+#include "linearAlgebra/solvers/PreconditionerBase.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief Common interface for the diagonal (point Jacobi) preconditioning operator.
+ * @tparam LAI linear algebra interface providing vectors, matrices and solvers
+ *
+ * Only the diagonal of the matrix is used, so the preconditioner may be
+ * computed from a matrix that only stores its diagonal, as is the case
+ * when the operator itself is applied matrix-free.
+ */
+template< typename LAI >
+class PreconditionerJacobi : public PreconditionerBase< LAI >
+{
+public:
+
+  /// Alias for base type
+  using Base = PreconditionerBase< LAI >;
+
+  /// Alias for vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for matrix type
+  using Matrix = typename Base::Matrix;
+
+  virtual ~PreconditionerJacobi() = default;
+
+  /**
+   * @brief Compute the preconditioner from a matrix.
+   * @param mat the matrix to precondition.
+   */
+  virtual void compute( Matrix const & mat ) override
+  {
+    Base::compute( mat );
+    m_diagInv.createWithLocalSize( mat.numLocalRows(), mat.getComm() );
+    mat.extractDiagonal( m_diagInv );
+    m_diagInv.reciprocal();
+  }
+
+  /**
+   * @brief Apply operator to a vector.
+   *
+   * @param src Input vector (src).
+   * @param dst Output vector (dst).
+   */
+  virtual void apply( Vector const & src,
+                      Vector & dst ) const override
+  {
+    GEOSX_LAI_ASSERT_EQ( this->numGlobalRows(), dst.globalSize() );
+    GEOSX_LAI_ASSERT_EQ( this->numGlobalCols(), src.globalSize() );
+
+    real64 const * const diagInv = m_diagInv.extractLocalVector();
+    real64 const * const srcValues = src.extractLocalVector();
+    real64 * const dstValues = dst.extractLocalVector();
+
+    forAll< parallelHostPolicy >( dst.localSize(), [=]( localIndex const i )
+    {
+      dstValues[i] = diagInv[i] * srcValues[i];
+    } );
+  }
+
+private:
+
+  /// Inverse of the diagonal of the matrix
+  Vector m_diagInv;
+};
+
+}
+
+#endif //GEOSX_LINEARALGEBRA_SOLVERS_PRECONDITIONERJACOBI_HPP_
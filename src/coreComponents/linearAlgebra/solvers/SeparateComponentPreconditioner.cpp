@@ -39,11 +39,20 @@ SeparateComponentPreconditioner( localIndex const numComp,
 template< typename LAI >
 SeparateComponentPreconditioner< LAI >::~SeparateComponentPreconditioner() = default;
 
+template< typename LAI >
+void SeparateComponentPreconditioner< LAI >::compute( Matrix const & mat )
+{
+  Base::compute( mat );
+
+  LAIHelperFunctions::SeparateComponentFilter( mat, m_matSC, m_numComp );
+  m_precond->compute( m_matSC );
+}
+
 template< typename LAI >
 void SeparateComponentPreconditioner< LAI >::compute( Matrix const & mat,
                                                       DofManager const & dofManager )
 {
-  Base::compute( mat, dofManager );
+  Base::compute( mat );
 
   // TODO: if matrix structure hasn't changed, can just copy entries into existing m_matSC
   LAIHelperFunctions::SeparateComponentFilter( mat, m_matSC, m_numComp );
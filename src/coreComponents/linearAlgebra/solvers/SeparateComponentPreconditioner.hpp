@@ -59,6 +59,8 @@ public:
 
   using PreconditionerBase< LAI >::compute;
 
+  virtual void compute( Matrix const & mat ) override;
+
   virtual void compute( Matrix const & mat, DofManager const & dofManager ) override;
 
   /**
@@ -0,0 +1,248 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file TwoLevelSchwarzPreconditioner.cpp
+ */
+
+#include "TwoLevelSchwarzPreconditioner.hpp"
+
+#include "linearAlgebra/interfaces/BlasLapackLA.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+namespace geosx
+{
+
+namespace
+{
+
+/**
+ * @brief Create the ILU(0) smoother of the subdomains.
+ * @tparam LAI linear algebra interface to use
+ * @param params the linear solver parameters
+ * @return the smoother
+ */
+template< typename LAI >
+std::unique_ptr< PreconditionerBase< LAI > > createSmoother( LinearSolverParameters params )
+{
+  params.preconditionerType = LinearSolverParameters::PreconditionerType::iluk;
+  params.ilu.fill = 0;
+  return LAI::createPreconditioner( params );
+}
+
+} // namespace
+
+template< typename LAI >
+TwoLevelSchwarzPreconditioner< LAI >::TwoLevelSchwarzPreconditioner( arrayView1d< localIndex const > const & rowAggregates,
+                                                                     localIndex const numLocalAggregates,
+                                                                     std::unique_ptr< PreconditionerBase< LAI > > smoother )
+  : Base(),
+  m_numLocalAggregates( numLocalAggregates ),
+  m_aggregateOffset( 0 ),
+  m_numGlobalAggregates( 0 ),
+  m_smoother( std::move( smoother ) )
+{
+  GEOSX_LAI_ASSERT( m_smoother );
+  GEOSX_LAI_ASSERT_GE( m_numLocalAggregates, 0 );
+
+  m_rowAggregates.resize( rowAggregates.size() );
+  for( localIndex i = 0; i < rowAggregates.size(); ++i )
+  {
+    GEOSX_LAI_ASSERT_GT( m_numLocalAggregates, rowAggregates[i] );
+    m_rowAggregates[i] = rowAggregates[i];
+  }
+}
+
+template< typename LAI >
+TwoLevelSchwarzPreconditioner< LAI >::TwoLevelSchwarzPreconditioner( LinearSolverParameters const & params,
+                                                                     arrayView1d< localIndex const > const & rowAggregates,
+                                                                     localIndex const numLocalAggregates )
+  : TwoLevelSchwarzPreconditioner( rowAggregates,
+                                   numLocalAggregates,
+                                   createSmoother< LAI >( params ) )
+{}
+
+template< typename LAI >
+TwoLevelSchwarzPreconditioner< LAI >::~TwoLevelSchwarzPreconditioner() = default;
+
+template< typename LAI >
+void TwoLevelSchwarzPreconditioner< LAI >::reinitialize( Matrix const & mat )
+{
+  GEOSX_LAI_ASSERT_EQ( m_rowAggregates.size(), mat.numLocalRows() );
+
+  MPI_Comm const & comm = mat.getComm();
+
+  array1d< globalIndex > numAggregates;
+  MpiWrapper::allGather( LvArray::integerConversion< globalIndex >( m_numLocalAggregates ), numAggregates, comm );
+
+  int const rank = MpiWrapper::Comm_rank( comm );
+  m_aggregateOffset = 0;
+  m_numGlobalAggregates = 0;
+  for( int r = 0; r < numAggregates.size(); ++r )
+  {
+    m_aggregateOffset += ( r < rank ) ? numAggregates[r] : 0;
+    m_numGlobalAggregates += numAggregates[r];
+  }
+  GEOSX_ERROR_IF( m_numGlobalAggregates == 0, "The two-level preconditioner needs at least one aggregate" );
+
+  m_prolongator.createWithLocalSize( mat.numLocalRows(), m_numLocalAggregates, 1, comm );
+  m_prolongator.open();
+  for( localIndex i = 0; i < m_rowAggregates.size(); ++i )
+  {
+    if( m_rowAggregates[i] >= 0 )
+    {
+      m_prolongator.insert( mat.ilower() + i, m_aggregateOffset + m_rowAggregates[i], 1.0 );
+    }
+  }
+  m_prolongator.close();
+
+  m_rhsCoarse.createWithLocalSize( m_numLocalAggregates, comm );
+  m_solCoarse.createWithLocalSize( m_numLocalAggregates, comm );
+  m_rhsCoarseLocal.resize( m_numGlobalAggregates );
+  m_rhsCoarseGlobal.resize( m_numGlobalAggregates );
+  m_coarseInverse.resize( m_numLocalAggregates, m_numGlobalAggregates );
+  m_correction.createWithLocalSize( mat.numLocalRows(), comm );
+}
+
+template< typename LAI >
+void TwoLevelSchwarzPreconditioner< LAI >::computeCoarseInverse()
+{
+  localIndex const numGlobal = LvArray::integerConversion< localIndex >( m_numGlobalAggregates );
+
+  // Each rank fills its own rows, the sum replicates the matrix
+  array2d< real64, MatrixLayout::ROW_MAJOR_PERM > localDense( numGlobal, numGlobal );
+  array2d< real64, MatrixLayout::ROW_MAJOR_PERM > dense( numGlobal, numGlobal );
+
+  array1d< globalIndex > cols( m_coarseMatrix.maxRowLength() );
+  array1d< real64 > values( m_coarseMatrix.maxRowLength() );
+  for( globalIndex row = m_coarseMatrix.ilower(); row < m_coarseMatrix.iupper(); ++row )
+  {
+    localIndex const rowLength = m_coarseMatrix.globalRowLength( row );
+    cols.resize( rowLength );
+    values.resize( rowLength );
+    m_coarseMatrix.getRowCopy( row, cols, values );
+    for( localIndex k = 0; k < rowLength; ++k )
+    {
+      localDense( row, cols[k] ) = values[k];
+    }
+  }
+
+  MpiWrapper::allReduce( localDense.data(),
+                         dense.data(),
+                         LvArray::integerConversion< int >( dense.size() ),
+                         MPI_SUM,
+                         m_coarseMatrix.getComm() );
+
+  // Invert the replicated matrix in place of the local copy, no longer needed
+  BlasLapackLA::matrixInverse( dense.toSliceConst(), localDense.toSlice() );
+
+  for( localIndex i = 0; i < m_numLocalAggregates; ++i )
+  {
+    for( localIndex j = 0; j < numGlobal; ++j )
+    {
+      m_coarseInverse( i, j ) = localDense( m_aggregateOffset + i, j );
+    }
+  }
+}
+
+template< typename LAI >
+void TwoLevelSchwarzPreconditioner< LAI >::compute( Matrix const & mat )
+{
+  // A change in size indicates a new matrix structure.
+  // This is done before Base::compute() since it overwrites old sizes.
+  bool const newSize = !this->ready() ||
+                       mat.numGlobalRows() != this->numGlobalRows() ||
+                       mat.numGlobalCols() != this->numGlobalCols();
+
+  Base::compute( mat );
+
+  if( newSize )
+  {
+    reinitialize( mat );
+  }
+
+  mat.multiplyPtAP( m_prolongator, m_coarseMatrix );
+  computeCoarseInverse();
+
+  m_smoother->compute( mat );
+}
+
+template< typename LAI >
+void TwoLevelSchwarzPreconditioner< LAI >::apply( Vector const & src,
+                                                  Vector & dst ) const
+{
+  // Coarse correction: restrict, gather the coarse residual and apply the local rows of the inverse
+  m_prolongator.applyTranspose( src, m_rhsCoarse );
+
+  real64 const * const rhsCoarse = m_rhsCoarse.extractLocalVector();
+  m_rhsCoarseLocal.setValues< serialPolicy >( 0.0 );
+  for( localIndex i = 0; i < m_numLocalAggregates; ++i )
+  {
+    m_rhsCoarseLocal[m_aggregateOffset + i] = rhsCoarse[i];
+  }
+  MpiWrapper::allReduce( m_rhsCoarseLocal.data(),
+                         m_rhsCoarseGlobal.data(),
+                         LvArray::integerConversion< int >( m_rhsCoarseGlobal.size() ),
+                         MPI_SUM,
+                         m_rhsCoarse.getComm() );
+
+  real64 * const solCoarse = m_solCoarse.extractLocalVector();
+  for( localIndex i = 0; i < m_numLocalAggregates; ++i )
+  {
+    real64 value = 0.0;
+    for( localIndex j = 0; j < m_rhsCoarseGlobal.size(); ++j )
+    {
+      value += m_coarseInverse( i, j ) * m_rhsCoarseGlobal[j];
+    }
+    solCoarse[i] = value;
+  }
+  m_prolongator.apply( m_solCoarse, dst );
+
+  // One-level correction, added to the coarse one
+  m_smoother->apply( src, m_correction );
+  dst.axpy( 1.0, m_correction );
+}
+
+template< typename LAI >
+void TwoLevelSchwarzPreconditioner< LAI >::clear()
+{
+  Base::clear();
+  m_smoother->clear();
+  m_prolongator.reset();
+  m_coarseMatrix.reset();
+  m_coarseInverse.clear();
+  m_rhsCoarse.reset();
+  m_solCoarse.reset();
+  m_rhsCoarseLocal.clear();
+  m_rhsCoarseGlobal.clear();
+  m_correction.reset();
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class TwoLevelSchwarzPreconditioner< TrilinosInterface >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class TwoLevelSchwarzPreconditioner< HypreInterface >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class TwoLevelSchwarzPreconditioner< PetscInterface >;
+#endif
+
+}
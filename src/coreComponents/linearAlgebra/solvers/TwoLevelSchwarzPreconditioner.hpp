@@ -0,0 +1,181 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file TwoLevelSchwarzPreconditioner.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_SOLVERS_TWOLEVELSCHWARZPRECONDITIONER_HPP_
+#define GEOSX_LINEARALGEBRA_SOLVERS_TWOLEVELSCHWARZPRECONDITIONER_HPP_
+
+#include "linearAlgebra/solvers/PreconditionerBase.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+
+#include <memory>
+
+namespace geosx
+{
+
+/*
+ * Keeping the formulas in a separate comment block, see BlockPreconditioner.hpp.
+ *
+ * This class implements the additive two-level preconditioner:
+ * @f$
+ * M^{-1} = M_{s}^{-1} + P A_{c}^{-1} P^{T}
+ * @f$
+ * where @f$ M_{s}^{-1} @f$ is the one-level (domain decomposition) smoother, @f$ P @f$ is the
+ * piecewise constant prolongation from the aggregates to the rows and @f$ A_{c} = P^{T} A P @f$
+ * is the coarse matrix, with one row per aggregate.
+ *
+ * The coarse matrix is small: it is replicated on all ranks and inverted with LAPACK,
+ * each rank keeping the rows of the inverse of its own aggregates.
+ */
+
+/**
+ * @brief Two-level additive Schwarz preconditioner with a coarse space made of aggregates.
+ * @tparam LAI type of linear algebra interface providing matrix/vector types
+ *
+ * The aggregates are given as an aggregate index per local row, numbered locally to each rank.
+ * Rows that belong to no aggregate (negative index) are only corrected by the smoother.
+ */
+template< typename LAI >
+class TwoLevelSchwarzPreconditioner : public PreconditionerBase< LAI >
+{
+public:
+
+  /// Alias for the base type
+  using Base = PreconditionerBase< LAI >;
+
+  /// Alias for the vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for the matrix type
+  using Matrix = typename Base::Matrix;
+
+  /**
+   * @brief Constructor.
+   * @param rowAggregates the local aggregate of each local row, negative if none
+   * @param numLocalAggregates the number of local aggregates
+   * @param smoother the one-level preconditioner (ownership transferred)
+   */
+  TwoLevelSchwarzPreconditioner( arrayView1d< localIndex const > const & rowAggregates,
+                                 localIndex const numLocalAggregates,
+                                 std::unique_ptr< PreconditionerBase< LAI > > smoother );
+
+  /**
+   * @brief Constructor with the default smoother: ILU(0) on the subdomains, with the overlap of the parameters.
+   * @param params the linear solver parameters
+   * @param rowAggregates the local aggregate of each local row, negative if none
+   * @param numLocalAggregates the number of local aggregates
+   */
+  TwoLevelSchwarzPreconditioner( LinearSolverParameters const & params,
+                                 arrayView1d< localIndex const > const & rowAggregates,
+                                 localIndex const numLocalAggregates );
+
+  /**
+   * @brief Destructor.
+   */
+  virtual ~TwoLevelSchwarzPreconditioner() override;
+
+  /**
+   * @name PreconditionerBase interface methods
+   */
+  ///@{
+
+  using PreconditionerBase< LAI >::compute;
+
+  /**
+   * @brief Compute the preconditioner from a matrix
+   * @param mat the matrix to precondition
+   */
+  virtual void compute( Matrix const & mat ) override;
+
+  /**
+   * @brief Apply operator to a vector
+   * @param src Input vector (x).
+   * @param dst Output vector (b).
+   *
+   * @warning @p src and @p dst cannot alias the same vector.
+   */
+  virtual void apply( Vector const & src, Vector & dst ) const override;
+
+  virtual void clear() override;
+
+  ///@}
+
+  /**
+   * @brief Access the coarse matrix.
+   * @return reference to the coarse matrix
+   */
+  Matrix const & getCoarseMatrix() const
+  {
+    return m_coarseMatrix;
+  }
+
+private:
+
+  /**
+   * @brief Build the prolongation and the internal vectors for a new linear system.
+   * @param mat the new system matrix
+   */
+  void reinitialize( Matrix const & mat );
+
+  /**
+   * @brief Replicate the coarse matrix on all ranks and keep the local rows of its inverse.
+   */
+  void computeCoarseInverse();
+
+  /// Local aggregate of each local row
+  array1d< localIndex > m_rowAggregates;
+
+  /// Number of local aggregates
+  localIndex m_numLocalAggregates;
+
+  /// Global index of the first local aggregate
+  globalIndex m_aggregateOffset;
+
+  /// Total number of aggregates
+  globalIndex m_numGlobalAggregates;
+
+  /// Piecewise constant prolongation from the aggregates
+  Matrix m_prolongator;
+
+  /// Coarse matrix
+  Matrix m_coarseMatrix;
+
+  /// Local rows of the inverse of the coarse matrix
+  array2d< real64, MatrixLayout::ROW_MAJOR_PERM > m_coarseInverse;
+
+  /// One-level smoother
+  std::unique_ptr< PreconditionerBase< LAI > > m_smoother;
+
+  /// Internal coarse residual
+  mutable Vector m_rhsCoarse;
+
+  /// Internal coarse solution
+  mutable Vector m_solCoarse;
+
+  /// Internal coarse residual gathered on all ranks
+  mutable array1d< real64 > m_rhsCoarseGlobal;
+
+  /// Internal sum buffer of the gathered coarse residual
+  mutable array1d< real64 > m_rhsCoarseLocal;
+
+  /// Internal correction of the smoother
+  mutable Vector m_correction;
+};
+
+} //namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_SOLVERS_TWOLEVELSCHWARZPRECONDITIONER_HPP_
@@ -1173,6 +1173,75 @@ void matrix_svd_test()
   }
 }
 
+template< typename LAI >
+void matrix_generalized_eigen_test()
+{
+  array1d< INDEX_TYPE > N_indices;
+  N_indices.emplace_back( 1 );
+  N_indices.emplace_back( 2 );
+  N_indices.emplace_back( 3 );
+  N_indices.emplace_back( 5 );
+  N_indices.emplace_back( 8 );
+
+  array2d< real64 > A;
+  array2d< real64 > B;
+  array1d< real64 > alphaR;
+  array1d< real64 > alphaI;
+  array1d< real64 > beta;
+  array2d< real64 > V;
+
+  for( INDEX_TYPE N : N_indices )
+  {
+    A.resize( N, N );
+    B.resize( N, N );
+    alphaR.resize( N );
+    alphaI.resize( N );
+    beta.resize( N );
+    V.resize( N, N );
+
+    // Populate matrix A with random coefficients, and make B diagonally dominant
+    LAI::matrixRand( A,
+                     LAI::RandomNumberDistribution::UNIFORM_m1p1 );
+    LAI::matrixRand( B,
+                     LAI::RandomNumberDistribution::UNIFORM_m1p1 );
+    for( INDEX_TYPE i = 0; i < N; ++i )
+    {
+      B( i, i ) += N;
+    }
+
+    LAI::matrixGeneralizedEigen( A, B, alphaR, alphaI, beta, V );
+
+    // Check that beta*A*v = alpha*B*v for every eigenpair, split in real and imaginary parts
+    for( INDEX_TYPE j = 0; j < N; ++j )
+    {
+      bool const isComplex = alphaI( j ) < 0.0 || alphaI( j ) > 0.0;
+      INDEX_TYPE const jRe = ( isComplex && alphaI( j ) < 0 ) ? j - 1 : j;
+      INDEX_TYPE const jIm = jRe + 1;
+      real64 const sign = ( alphaI( j ) < 0 ) ? -1.0 : 1.0;
+
+      for( INDEX_TYPE i = 0; i < N; ++i )
+      {
+        real64 AvRe = 0.0, AvIm = 0.0, BvRe = 0.0, BvIm = 0.0;
+        for( INDEX_TYPE l = 0; l < N; ++l )
+        {
+          real64 const vRe = V( l, jRe );
+          real64 const vIm = isComplex ? sign * V( l, jIm ) : 0.0;
+          AvRe += A( i, l ) * vRe;
+          AvIm += A( i, l ) * vIm;
+          BvRe += B( i, l ) * vRe;
+          BvIm += B( i, l ) * vIm;
+        }
+        EXPECT_NEAR( beta( j ) * AvRe,
+                     alphaR( j ) * BvRe - alphaI( j ) * BvIm,
+                     N * N * machinePrecision );
+        EXPECT_NEAR( beta( j ) * AvIm,
+                     alphaR( j ) * BvIm + alphaI( j ) * BvRe,
+                     N * N * machinePrecision );
+      }
+    }
+  }
+}
+
 TEST( Array1D, vectorNorm1 )
 {
   vector_norm1_test< BlasLapackLA >();
@@ -1304,6 +1373,11 @@ TEST( DenseLAInterface, matrixSVD )
   matrix_svd_test< BlasLapackLA >();
 }
 
+TEST( DenseLAInterface, matrixGeneralizedEigen )
+{
+  matrix_generalized_eigen_test< BlasLapackLA >();
+}
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
@@ -0,0 +1,116 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testAssemblyMap.cpp
+ */
+
+#include "gtest/gtest.h"
+
+#include "common/DataTypes.hpp"
+#include "managers/initialization.hpp"
+#include "linearAlgebra/utilities/AssemblyMap.hpp"
+
+using namespace geosx;
+
+namespace
+{
+
+/**
+ * @brief Make a matrix with the columns 0, 2, 5 in its first row and 1, 2 in its second row.
+ * @return the matrix
+ */
+CRSMatrix< real64, globalIndex > makeMatrix()
+{
+  CRSMatrix< real64, globalIndex > matrix( 2, 6, 3 );
+  for( globalIndex const col : { 5, 0, 2 } )
+  {
+    matrix.insertNonZero( 0, col, 0.0 );
+  }
+  for( globalIndex const col : { 2, 1 } )
+  {
+    matrix.insertNonZero( 1, col, 0.0 );
+  }
+  return matrix;
+}
+
+}
+
+TEST( AssemblyMap, findPosition )
+{
+  CRSMatrix< real64, globalIndex > const matrix = makeMatrix();
+
+  EXPECT_EQ( AssemblyMap::findPosition( matrix.getColumns( 0 ), 0 ), 0 );
+  EXPECT_EQ( AssemblyMap::findPosition( matrix.getColumns( 0 ), 2 ), 1 );
+  EXPECT_EQ( AssemblyMap::findPosition( matrix.getColumns( 0 ), 5 ), 2 );
+  EXPECT_EQ( AssemblyMap::findPosition( matrix.getColumns( 0 ), 1 ), -1 );
+  EXPECT_EQ( AssemblyMap::findPosition( matrix.getColumns( 0 ), 6 ), -1 );
+  EXPECT_EQ( AssemblyMap::findPosition( matrix.getColumns( 1 ), 1 ), 0 );
+  EXPECT_EQ( AssemblyMap::findPosition( matrix.getColumns( 1 ), 2 ), 1 );
+}
+
+TEST( AssemblyMap, addToRow )
+{
+  CRSMatrix< real64, globalIndex > matrix = makeMatrix();
+  CRSMatrixView< real64, globalIndex const > const matrixView = matrix.toViewConstSizes();
+
+  // a single item adding a 2x2 local matrix to the rows 0 and 1, in the columns 2 and 0
+  AssemblyMap map;
+  EXPECT_FALSE( map.isBuiltFor( matrixView, 1 ) );
+  arrayView3d< localIndex > const positions = map.setup( matrixView, 1, 2, 2 );
+  EXPECT_TRUE( map.isBuiltFor( matrixView, 1 ) );
+  EXPECT_FALSE( map.isBuiltFor( matrixView, 2 ) );
+
+  globalIndex const columns[2] = { 2, 0 };
+  forAll< serialPolicy >( 1, [=]( localIndex const item )
+  {
+    for( localIndex i = 0; i < 2; ++i )
+    {
+      for( localIndex j = 0; j < 2; ++j )
+      {
+        positions[item][i][j] = AssemblyMap::findPosition( matrixView.getColumns( i ), columns[j] );
+      }
+    }
+  } );
+
+  // the column 0 is missing from the row 1, and the entry of the column 2 in the row 1 is made stale
+  EXPECT_EQ( positions[0][1][1], -1 );
+  positions[0][1][0] = 0;
+
+  arrayView3d< localIndex const > const mapPositions = map.positions();
+  real64 const row0[2] = { 1.0, 2.0 };
+  real64 const row1[2] = { 3.0, 0.0 };
+  AssemblyMap::addToRow< serialAtomic >( matrixView, 0, mapPositions[0][0], columns, row0, 2 );
+  AssemblyMap::addToRow< serialAtomic >( matrixView, 0, mapPositions[0][0], columns, row0, 2 );
+  AssemblyMap::addToRow< serialAtomic >( matrixView, 1, mapPositions[0][1], columns, row1, 1 );
+
+  EXPECT_DOUBLE_EQ( matrix.getEntries( 0 )[0], 4.0 );
+  EXPECT_DOUBLE_EQ( matrix.getEntries( 0 )[1], 2.0 );
+  EXPECT_DOUBLE_EQ( matrix.getEntries( 0 )[2], 0.0 );
+  EXPECT_DOUBLE_EQ( matrix.getEntries( 1 )[0], 0.0 );
+  EXPECT_DOUBLE_EQ( matrix.getEntries( 1 )[1], 3.0 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+
+  geosx::basicSetup( argc, argv );
+
+  int const result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+
+  return result;
+}
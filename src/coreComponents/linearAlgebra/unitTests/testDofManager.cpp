@@ -380,6 +380,158 @@ TEST_F( DofManagerIndicesTest, Face_Elem_Partial )
   } );
 }
 
+/**
+ * @brief Check that the sparsity pattern is only rebuilt when the DOF layout or the mesh topology changes.
+ */
+TEST_F( DofManagerIndicesTest, SparsityReuse )
+{
+  CRSMatrix< real64, globalIndex > localMatrix;
+
+  auto setup = [&]( localIndex const numComp )
+  {
+    dofManager.setMesh( *problemManager->getDomainPartition(), 0, 0 );
+    dofManager.addField( "displacement", DofManager::Location::Node, numComp );
+    dofManager.addCoupling( "displacement", "displacement", DofManager::Connector::Elem );
+    dofManager.reorderByRank();
+
+    bool const reuse = dofManager.canReuseSparsityPattern( localMatrix );
+    if( !reuse )
+    {
+      SparsityPattern< globalIndex > pattern;
+      dofManager.setSparsityPattern( pattern );
+      localMatrix.assimilate< serialPolicy >( std::move( pattern ) );
+    }
+    return reuse;
+  };
+
+  EXPECT_FALSE( setup( 3 ) );
+  EXPECT_TRUE( setup( 3 ) );
+
+  // a different layout
+  EXPECT_FALSE( setup( 2 ) );
+  EXPECT_TRUE( setup( 2 ) );
+
+  // a modification of the topology
+  mesh->incrementTopologyVersion();
+  EXPECT_FALSE( setup( 2 ) );
+  EXPECT_TRUE( setup( 2 ) );
+}
+
+/**
+ * @brief Check that the capacity reserved in the sparsity pattern does not change its nonzeros.
+ */
+TEST_F( DofManagerIndicesTest, SparsityExtraCapacity )
+{
+  dofManager.setMesh( *problemManager->getDomainPartition(), 0, 0 );
+  dofManager.addField( "displacement", DofManager::Location::Node, 3 );
+  dofManager.addCoupling( "displacement", "displacement", DofManager::Connector::Elem );
+  dofManager.reorderByRank();
+
+  SparsityPattern< globalIndex > pattern;
+  dofManager.setSparsityPattern( pattern );
+
+  array1d< localIndex > extraRowCapacities( dofManager.numLocalDofs() );
+  for( localIndex localRow = 0; localRow < extraRowCapacities.size(); ++localRow )
+  {
+    extraRowCapacities[localRow] = localRow % 4;
+  }
+  SparsityPattern< globalIndex > patternExtra;
+  dofManager.setSparsityPattern( patternExtra, extraRowCapacities.toViewConst() );
+
+  ASSERT_EQ( patternExtra.numRows(), pattern.numRows() );
+  ASSERT_EQ( patternExtra.numColumns(), pattern.numColumns() );
+  for( localIndex localRow = 0; localRow < pattern.numRows(); ++localRow )
+  {
+    ASSERT_EQ( patternExtra.numNonZeros( localRow ), pattern.numNonZeros( localRow ) );
+    EXPECT_GE( patternExtra.nonZeroCapacity( localRow ), pattern.numNonZeros( localRow ) + extraRowCapacities[localRow] );
+    for( localIndex k = 0; k < pattern.numNonZeros( localRow ); ++k )
+    {
+      EXPECT_EQ( patternExtra.getColumns( localRow )[k], pattern.getColumns( localRow )[k] );
+    }
+  }
+}
+
+/**
+ * @brief Check that the local orderings are permutations of the rank's DOFs keeping the blocks of each object.
+ */
+TEST_F( DofManagerIndicesTest, LocalOrderings )
+{
+  string_array const regions = getRegions( mesh, {} );
+  ElementRegionManager const * const elemManager = mesh->getElemManager();
+
+  globalIndex numNonZerosFieldWise = -1;
+  for( LinearSolverParameters::DofOrdering const ordering : { LinearSolverParameters::DofOrdering::fieldWise,
+                                                              LinearSolverParameters::DofOrdering::interleaved,
+                                                              LinearSolverParameters::DofOrdering::rcm } )
+  {
+    SCOPED_TRACE( EnumStrings< LinearSolverParameters::DofOrdering >::toString( ordering ) );
+
+    dofManager.setMesh( *problemManager->getDomainPartition(), 0, 0 );
+    dofManager.addField( "pressure", DofManager::Location::Elem, 1 );
+    dofManager.addField( "displacement", DofManager::Location::Node, 3 );
+    dofManager.addField( "saturation", DofManager::Location::Elem, 2 );
+    dofManager.addCoupling( "pressure", "pressure", DofManager::Connector::Face );
+    dofManager.addCoupling( "saturation", "saturation", DofManager::Connector::Face );
+    dofManager.addCoupling( "pressure", "saturation", DofManager::Connector::Face );
+    dofManager.addCoupling( "displacement", "displacement", DofManager::Connector::Elem );
+    dofManager.addCoupling( "displacement", "pressure", DofManager::Connector::Elem );
+    dofManager.reorderByRank( ordering );
+
+    EXPECT_EQ( dofManager.fieldsContiguous(), ordering == LinearSolverParameters::DofOrdering::fieldWise );
+
+    // all the components of all the objects cover the rank's range once
+    auto const pressureDofs =
+      elemManager->ConstructViewAccessor< array1d< globalIndex >, arrayView1d< globalIndex const > >( dofManager.getKey( "pressure" ) );
+    auto const saturationDofs =
+      elemManager->ConstructViewAccessor< array1d< globalIndex >, arrayView1d< globalIndex const > >( dofManager.getKey( "saturation" ) );
+    arrayView1d< globalIndex const > const displacementDofs =
+      mesh->getNodeManager()->getReference< array1d< globalIndex > >( dofManager.getKey( "displacement" ) );
+
+    array1d< globalIndex > dofNumbers;
+    forLocalObjects< DofManager::Location::Elem >( mesh, regions, [&]( auto const idx )
+    {
+      globalIndex const pressureDof = pressureDofs[idx[0]][idx[1]][idx[2]];
+      globalIndex const saturationDof = saturationDofs[idx[0]][idx[1]][idx[2]];
+      dofNumbers.emplace_back( pressureDof );
+      dofNumbers.emplace_back( saturationDof );
+      dofNumbers.emplace_back( saturationDof + 1 );
+      if( ordering != LinearSolverParameters::DofOrdering::fieldWise )
+      {
+        EXPECT_EQ( saturationDof, pressureDof + 1 );
+      }
+    } );
+    forLocalObjects< DofManager::Location::Node >( mesh, regions, [&]( localIndex const idx )
+    {
+      for( localIndex c = 0; c < 3; ++c )
+      {
+        dofNumbers.emplace_back( displacementDofs[idx] + c );
+      }
+    } );
+    std::sort( dofNumbers.begin(), dofNumbers.end() );
+
+    ASSERT_EQ( dofNumbers.size(), dofManager.numLocalDofs() );
+    for( localIndex i = 0; i < dofNumbers.size(); ++i )
+    {
+      EXPECT_EQ( dofNumbers[i], dofManager.rankOffset() + i );
+    }
+
+    // the ordering only permutes the sparsity pattern
+    SparsityPattern< globalIndex > pattern;
+    dofManager.setSparsityPattern( pattern );
+    globalIndex numNonZeros = 0;
+    for( localIndex localRow = 0; localRow < pattern.numRows(); ++localRow )
+    {
+      numNonZeros += pattern.numNonZeros( localRow );
+    }
+    numNonZeros = MpiWrapper::Sum( numNonZeros );
+    if( numNonZerosFieldWise < 0 )
+    {
+      numNonZerosFieldWise = numNonZeros;
+    }
+    EXPECT_EQ( numNonZeros, numNonZerosFieldWise );
+  }
+}
+
 /**
  * @brief Test fixture for all typed (LAI dependent) DofManager tests.
  * @tparam LAI linear algebra interface type
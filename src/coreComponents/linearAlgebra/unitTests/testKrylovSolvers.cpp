@@ -25,6 +25,8 @@
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 #include "linearAlgebra/utilities/BlockOperatorWrapper.hpp"
 #include "linearAlgebra/solvers/PreconditionerIdentity.hpp"
+#include "linearAlgebra/solvers/GeometricMultigridPreconditioner.hpp"
+#include "linearAlgebra/solvers/TwoLevelSchwarzPreconditioner.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
 
 using namespace geosx;
@@ -57,6 +59,37 @@ LinearSolverParameters params_GMRES()
   return parameters;
 }
 
+LinearSolverParameters params_PipelinedCG()
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 500;
+  parameters.solverType = geosx::LinearSolverParameters::SolverType::pipecg;
+  parameters.isSymmetric = true;
+  return parameters;
+}
+
+LinearSolverParameters params_CAGMRES()
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 500;
+  parameters.krylov.stepSize = 4;
+  parameters.solverType = geosx::LinearSolverParameters::SolverType::cagmres;
+  return parameters;
+}
+
+LinearSolverParameters params_GCRODR()
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 500;
+  parameters.krylov.maxRestart = 100;
+  parameters.krylov.recycleSize = 20;
+  parameters.solverType = geosx::LinearSolverParameters::SolverType::gcrodr;
+  return parameters;
+}
+
 template< typename OPERATOR, typename PRECOND, typename VECTOR >
 class KrylovSolverTestBase : public ::testing::Test
 {
@@ -155,10 +188,126 @@ TYPED_TEST_P( KrylovSolverTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverTest, PipelinedCG )
+{
+  this->test( params_PipelinedCG() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, CAGMRES )
+{
+  this->test( params_CAGMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, GCRODR )
+{
+  this->test( params_GCRODR() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, GCRODR_Recycling )
+{
+  using Vector = typename TypeParam::ParallelVector;
+  LinearSolverParameters const params = params_GCRODR();
+  std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::Create( params, this->matrix, this->precond );
+
+  // a second right-hand side is solved faster with the subspace recycled from the first solve
+  localIndex numIterations[2];
+  for( localIndex i = 0; i < 2; ++i )
+  {
+    this->sol_true.rand();
+    this->sol_comp.zero();
+    this->matrix.apply( this->sol_true, this->rhs_true );
+    solver->solve( this->rhs_true, this->sol_comp );
+    EXPECT_TRUE( solver->result().success() );
+    numIterations[i] = solver->result().numIterations;
+  }
+  EXPECT_LT( numIterations[1], numIterations[0] );
+}
+
+TYPED_TEST_P( KrylovSolverTest, GMRES_TwoLevelSchwarz )
+{
+  using Vector = typename TypeParam::ParallelVector;
+  LinearSolverParameters const params = params_GMRES();
+
+  // aggregates of consecutive local rows, i.e. segments of the grid lines
+  localIndex constexpr aggregateSize = 100;
+  localIndex const numLocalRows = this->matrix.numLocalRows();
+  array1d< localIndex > rowAggregates( numLocalRows );
+  for( localIndex i = 0; i < numLocalRows; ++i )
+  {
+    rowAggregates[i] = i / aggregateSize;
+  }
+  localIndex const numAggregates = ( numLocalRows + aggregateSize - 1 ) / aggregateSize;
+
+  TwoLevelSchwarzPreconditioner< TypeParam > precond( params, rowAggregates, numAggregates );
+  precond.compute( this->matrix );
+  EXPECT_EQ( precond.getCoarseMatrix().numGlobalRows(), MpiWrapper::Sum( numAggregates ) );
+
+  this->sol_true.rand();
+  this->sol_comp.zero();
+  this->matrix.apply( this->sol_true, this->rhs_true );
+
+  std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::Create( params, this->matrix, precond );
+  solver->solve( this->rhs_true, this->sol_comp );
+  EXPECT_TRUE( solver->result().success() );
+
+  this->sol_comp.axpy( -1.0, this->sol_true );
+  EXPECT_LT( this->sol_comp.norm2() / this->sol_true.norm2(), this->cond_est * params.krylov.relTolerance );
+}
+
+TYPED_TEST_P( KrylovSolverTest, CG_GeometricMultigrid )
+{
+  using Vector = typename TypeParam::ParallelVector;
+  LinearSolverParameters const params = params_CG();
+
+  // linear interpolation along the local rows, from the even ones
+  localIndex const numLocalRows = this->matrix.numLocalRows();
+  localIndex const numLocalCoarseRows = ( numLocalRows + 1 ) / 2;
+  globalIndex const coarseOffset = MpiWrapper::PrefixSum< globalIndex >( numLocalCoarseRows );
+  CRSMatrix< real64, globalIndex > localProlongator( numLocalRows, MpiWrapper::Sum( numLocalCoarseRows ), 2 );
+  for( localIndex i = 0; i < numLocalRows; ++i )
+  {
+    if( i % 2 == 0 )
+    {
+      localProlongator.insertNonZero( i, coarseOffset + i / 2, 1.0 );
+    }
+    else if( i + 1 < numLocalRows )
+    {
+      localProlongator.insertNonZero( i, coarseOffset + ( i - 1 ) / 2, 0.5 );
+      localProlongator.insertNonZero( i, coarseOffset + ( i + 1 ) / 2, 0.5 );
+    }
+    else
+    {
+      localProlongator.insertNonZero( i, coarseOffset + ( i - 1 ) / 2, 1.0 );
+    }
+  }
+
+  GeometricMultigridPreconditioner< TypeParam > precond( params, std::move( localProlongator ), numLocalCoarseRows );
+  precond.compute( this->matrix );
+  EXPECT_EQ( precond.getCoarseMatrix().numGlobalRows(), MpiWrapper::Sum( numLocalCoarseRows ) );
+  EXPECT_GT( precond.getSmootherDamping(), 0.0 );
+
+  this->sol_true.rand();
+  this->sol_comp.zero();
+  this->matrix.apply( this->sol_true, this->rhs_true );
+
+  std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::Create( params, this->matrix, precond );
+  solver->solve( this->rhs_true, this->sol_comp );
+  EXPECT_TRUE( solver->result().success() );
+
+  this->sol_comp.axpy( -1.0, this->sol_true );
+  EXPECT_LT( this->sol_comp.norm2() / this->sol_true.norm2(), this->cond_est * params.krylov.relTolerance );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             PipelinedCG,
+                             CAGMRES,
+                             GCRODR,
+                             GCRODR_Recycling,
+                             GMRES_TwoLevelSchwarz,
+                             CG_GeometricMultigrid );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverTest, TrilinosInterface, );
@@ -245,10 +394,27 @@ TYPED_TEST_P( KrylovSolverBlockTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverBlockTest, PipelinedCG )
+{
+  this->test( params_PipelinedCG() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, CAGMRES )
+{
+  this->test( params_CAGMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, GCRODR )
+{
+  this->test( params_GCRODR() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverBlockTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             PipelinedCG,
+                             CAGMRES );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverBlockTest, TrilinosInterface, );
@@ -27,6 +27,7 @@
 #include "managers/DomainPartition.hpp"
 #include "meshUtilities/MeshManager.hpp"
 #include "mpiCommunications/CommunicationTools.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
 #include "linearAlgebra/utilities/LAIHelperFunctions.hpp"
 
 using namespace geosx;
@@ -247,6 +248,66 @@ TEST_F( LAIHelperFunctionsTest, Test_CellCenteredVectorPermutation )
 
 }
 
+TEST_F( LAIHelperFunctionsTest, Test_WriteReadLinearSystem )
+{
+  DomainPartition * const domain = problemManager->getDomainPartition();
+
+  DofManager dofManager( "test" );
+  dofManager.setMesh( *domain, 0, 0 );
+
+  string_array region;
+  region.emplace_back( "region1" );
+
+  dofManager.addField( "nodalVariable", DofManager::Location::Node, 3, region );
+  dofManager.addCoupling( "nodalVariable", "nodalVariable", DofManager::Connector::Elem );
+  dofManager.reorderByRank();
+
+  SparsityPattern< globalIndex > pattern;
+  dofManager.setSparsityPattern( pattern );
+  CRSMatrix< real64, globalIndex > localMatrix;
+  localMatrix.assimilate< serialPolicy >( std::move( pattern ) );
+
+  array1d< real64 > localRhs( localMatrix.numRows() );
+  for( localIndex i = 0; i < localMatrix.numRows(); ++i )
+  {
+    globalIndex const row = dofManager.rankOffset() + i;
+    arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( i );
+    arraySlice1d< real64 > const values = localMatrix.getEntries( i );
+    for( localIndex k = 0; k < cols.size(); ++k )
+    {
+      values[k] = 1.0 + ( row * 31 + cols[k] ) % 17;
+    }
+    localRhs[i] = 1.0 + row % 5;
+  }
+
+  ParallelMatrix matrix;
+  ParallelVector rhs;
+  matrix.create( localMatrix.toViewConst(), MPI_COMM_GEOSX );
+  rhs.create( localRhs.toViewConst(), MPI_COMM_GEOSX );
+
+  LAIHelperFunctions::WriteLinearSystem( "testLinearSystem", matrix, rhs, dofManager );
+
+  ParallelMatrix readMatrix;
+  ParallelVector readRhs;
+  LAIHelperFunctions::LinearSystemLayout layout;
+  LAIHelperFunctions::ReadLinearSystem( "testLinearSystem", MPI_COMM_GEOSX, readMatrix, readRhs, layout );
+
+  EXPECT_EQ( readMatrix.numGlobalRows(), matrix.numGlobalRows() );
+  EXPECT_EQ( readMatrix.numGlobalNonzeros(), matrix.numGlobalNonzeros() );
+  EXPECT_NEAR( readMatrix.normFrobenius(), matrix.normFrobenius(), 100 * machinePrecision * matrix.normFrobenius() );
+  EXPECT_NEAR( readRhs.norm2(), rhs.norm2(), 100 * machinePrecision * rhs.norm2() );
+
+  ASSERT_EQ( layout.fieldNames.size(), 1 );
+  EXPECT_EQ( layout.fieldNames[0], "nodalVariable" );
+  EXPECT_EQ( layout.numComponents[0], 3 );
+  ASSERT_EQ( layout.rowComponent.size(), readMatrix.numLocalRows() );
+  for( localIndex i = 0; i < readMatrix.numLocalRows(); ++i )
+  {
+    EXPECT_EQ( layout.rowField[i], 0 );
+    EXPECT_EQ( layout.rowComponent[i], ( readMatrix.ilower() + i ) % 3 );
+  }
+}
+
 /**
  * @function main
  * @brief Main function to setup the GEOSX environment, read the xml file and run all cases.
@@ -485,10 +485,63 @@ TYPED_TEST_P( LAOperationsTest, RectangularMatrixOperations )
   EXPECT_DOUBLE_EQ( c, std::sqrt( static_cast< real64 >( nRows * ( nRows + 1 ) * ( 2 * nRows + 1 ) ) / 3.0 ) );
 }
 
+TYPED_TEST_P( LAOperationsTest, CreateFromLocalMatrix )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+  using Vector = typename TypeParam::ParallelVector;
+
+  globalIndex const n = 100;
+  Matrix A;
+  compute2DLaplaceOperator( MPI_COMM_GEOSX, n, A );
+
+  // Copy the local rows into a CRS matrix with spare row capacity, so that rows are not contiguous
+  CRSMatrix< real64, globalIndex > localMatrix( A.numLocalRows(), A.numGlobalCols(), 8 );
+  array1d< globalIndex > cols( A.maxRowLength() );
+  array1d< real64 > values( A.maxRowLength() );
+  for( globalIndex i = A.ilower(); i < A.iupper(); ++i )
+  {
+    localIndex const rowLength = A.globalRowLength( i );
+    cols.resize( rowLength );
+    values.resize( rowLength );
+    A.getRowCopy( i, cols, values );
+    localMatrix.insertNonZeros( i - A.ilower(), cols.data(), values.data(), rowLength );
+  }
+
+  Matrix B;
+  B.create( localMatrix.toViewConst(), MPI_COMM_GEOSX );
+
+  EXPECT_EQ( B.numGlobalRows(), A.numGlobalRows() );
+  EXPECT_EQ( B.numGlobalCols(), A.numGlobalCols() );
+  EXPECT_EQ( B.numGlobalNonzeros(), A.numGlobalNonzeros() );
+
+  Vector x, yA, yB;
+  x.createWithLocalSize( A.numLocalCols(), MPI_COMM_GEOSX );
+  yA.createWithLocalSize( A.numLocalRows(), MPI_COMM_GEOSX );
+  yB.createWithLocalSize( A.numLocalRows(), MPI_COMM_GEOSX );
+  x.rand();
+
+  A.apply( x, yA );
+  B.apply( x, yB );
+  yB.axpy( -1.0, yA );
+  EXPECT_LT( yB.normInf(), machinePrecision * yA.normInf() );
+
+  // Block storage holds the same operator (explicit zeros of the blocks aside)
+  Matrix C;
+  C.create( localMatrix.toViewConst(), 2, MPI_COMM_GEOSX );
+
+  EXPECT_EQ( C.numGlobalRows(), A.numGlobalRows() );
+  EXPECT_EQ( C.numGlobalCols(), A.numGlobalCols() );
+
+  C.apply( x, yB );
+  yB.axpy( -1.0, yA );
+  EXPECT_LT( yB.normInf(), machinePrecision * yA.normInf() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( LAOperationsTest,
                              VectorFunctions,
                              MatrixMatrixOperations,
-                             RectangularMatrixOperations );
+                             RectangularMatrixOperations,
+                             CreateFromLocalMatrix );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, LAOperationsTest, TrilinosInterface, );
@@ -621,6 +674,38 @@ TYPED_TEST_P( SolverTestLaplace2D, Direct )
   this->test( params_Direct() );
 }
 
+TYPED_TEST_P( SolverTestLaplace2D, DirectReuseSymbolic )
+{
+  using Vector = typename TestFixture::Vector;
+  using Solver = typename TestFixture::Solver;
+
+  LinearSolverParameters params = params_Direct();
+  params.direct.reuseSymbolic = 1;
+  Solver solver( params );
+
+  Vector sol_true;
+  sol_true.createWithGlobalSize( this->matrix.numGlobalCols(), this->matrix.getComm() );
+  Vector rhs;
+  rhs.createWithGlobalSize( this->matrix.numGlobalRows(), this->matrix.getComm() );
+  Vector sol_comp;
+  sol_comp.createWithGlobalSize( this->matrix.numGlobalCols(), this->matrix.getComm() );
+
+  // the second solve only refactorizes the scaled matrix numerically
+  for( int i = 0; i < 2; ++i )
+  {
+    sol_true.rand();
+    this->matrix.apply( sol_true, rhs );
+    sol_comp.zero();
+    solver.solve( this->matrix, sol_comp, rhs );
+    EXPECT_TRUE( solver.result().success() );
+
+    sol_comp.axpy( -1.0, sol_true );
+    EXPECT_LT( sol_comp.norm2() / sol_true.norm2(), this->cond_est * params.krylov.relTolerance );
+
+    this->matrix.scale( 2.0 );
+  }
+}
+
 TYPED_TEST_P( SolverTestLaplace2D, GMRES_ILU )
 {
   this->test( params_GMRES_ILU() );
@@ -633,6 +718,7 @@ TYPED_TEST_P( SolverTestLaplace2D, CG_AMG )
 
 REGISTER_TYPED_TEST_SUITE_P( SolverTestLaplace2D,
                              Direct,
+                             DirectReuseSymbolic,
                              GMRES_ILU,
                              CG_AMG );
 
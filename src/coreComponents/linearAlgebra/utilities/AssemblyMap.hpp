@@ -0,0 +1,173 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file AssemblyMap.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_UTILITIES_ASSEMBLYMAP_HPP_
+#define GEOSX_LINEARALGEBRA_UTILITIES_ASSEMBLYMAP_HPP_
+
+#include "common/DataTypes.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+namespace geosx
+{
+
+/**
+ * @class AssemblyMap
+ *
+ * The positions in the rows of a local CRS matrix of the entries of assembly items, e.g. the connections of a
+ * stencil, each adding a local matrix with a fixed number of rows and columns. The positions are found once
+ * for a sparsity pattern, and the kernels then add the local matrices without searching the rows for their
+ * columns, as long as the sparsity pattern is unchanged.
+ *
+ * The map remembers the dimensions and the storage of the matrix it was built for. A position is checked
+ * against the column it is added to, and an entry whose position is stale is added after a search of its
+ * row, so that a map built for another sparsity pattern only costs the searches it was meant to save.
+ */
+class AssemblyMap
+{
+public:
+
+  /**
+   * @brief Check whether the map was built for a matrix.
+   * @param matrix the local matrix
+   * @param numItems the number of assembly items
+   * @return @p true if the map was built for the dimensions and storage of @p matrix and for @p numItems items
+   */
+  bool isBuiltFor( CRSMatrixView< real64, globalIndex const > const & matrix, localIndex const numItems ) const
+  {
+    return m_positions.size( 0 ) == numItems &&
+           m_numRows == matrix.numRows() &&
+           m_numColumns == matrix.numColumns() &&
+           m_columns == columnStorage( matrix );
+  }
+
+  /**
+   * @brief Resize the map for a matrix, all the positions being unset.
+   * @param matrix the local matrix
+   * @param numItems the number of assembly items
+   * @param numItemRows the number of rows of the local matrix of an item
+   * @param numItemColumns the number of columns of the local matrix of an item
+   * @return the positions of the items to fill, per item, row and column of its local matrix
+   */
+  arrayView3d< localIndex > setup( CRSMatrixView< real64, globalIndex const > const & matrix,
+                                   localIndex const numItems,
+                                   localIndex const numItemRows,
+                                   localIndex const numItemColumns )
+  {
+    m_numRows = matrix.numRows();
+    m_numColumns = matrix.numColumns();
+    m_columns = columnStorage( matrix );
+    m_positions.resize( numItems, numItemRows, numItemColumns );
+    m_positions.setValues< parallelDevicePolicy<> >( -1 );
+    return m_positions.toView();
+  }
+
+  /**
+   * @brief Get the positions of the items.
+   * @return the positions in the rows of the matrix, per item, row and column of its local matrix
+   */
+  arrayView3d< localIndex const > positions() const
+  { return m_positions.toViewConst(); }
+
+  /**
+   * @brief Find the position of a column in a row of the matrix.
+   * @param columns the sorted columns of the row
+   * @param column the column
+   * @return the position of @p column in @p columns, -1 if absent
+   */
+  GEOSX_HOST_DEVICE
+  static localIndex findPosition( arraySlice1d< globalIndex const > const & columns, globalIndex const column )
+  {
+    localIndex lower = 0;
+    localIndex upper = columns.size();
+    while( lower < upper )
+    {
+      localIndex const middle = ( lower + upper ) / 2;
+      if( columns[middle] < column )
+      {
+        lower = middle + 1;
+      }
+      else
+      {
+        upper = middle;
+      }
+    }
+    return ( lower < columns.size() && columns[lower] == column ) ? lower : -1;
+  }
+
+  /**
+   * @brief Add values to a row of the matrix at recorded positions.
+   * @tparam POLICY the atomic policy of the additions
+   * @param matrix the local matrix
+   * @param row the local row
+   * @param positions the positions of the columns in the row
+   * @param columns the columns
+   * @param values the values
+   * @param numValues the number of values
+   */
+  template< typename POLICY >
+  GEOSX_HOST_DEVICE
+  static void addToRow( CRSMatrixView< real64, globalIndex const > const & matrix,
+                        localIndex const row,
+                        arraySlice1d< localIndex const > const & positions,
+                        globalIndex const * const columns,
+                        real64 const * const values,
+                        localIndex const numValues )
+  {
+    arraySlice1d< globalIndex const > const rowColumns = matrix.getColumns( row );
+    arraySlice1d< real64 > const rowEntries = matrix.getEntries( row );
+    for( localIndex j = 0; j < numValues; ++j )
+    {
+      localIndex const position = positions[j];
+      if( position >= 0 && position < rowColumns.size() && rowColumns[position] == columns[j] )
+      {
+        RAJA::atomicAdd( POLICY{}, &rowEntries[position], values[j] );
+      }
+      else
+      {
+        // the map is stale
+        matrix.addToRowBinarySearchUnsorted< POLICY >( row, &columns[j], &values[j], 1 );
+      }
+    }
+  }
+
+private:
+
+  /**
+   * @brief Get the storage of the columns of a matrix.
+   * @param matrix the local matrix
+   * @return the address of the columns of the first row, nullptr if there is no row
+   */
+  static globalIndex const * columnStorage( CRSMatrixView< real64, globalIndex const > const & matrix )
+  { return matrix.numRows() > 0 ? matrix.getColumns( 0 ).dataIfContiguous() : nullptr; }
+
+  /// The number of rows of the matrix the map was built for
+  localIndex m_numRows = -1;
+
+  /// The number of columns of the matrix the map was built for
+  globalIndex m_numColumns = -1;
+
+  /// The storage of the columns of the matrix the map was built for
+  globalIndex const * m_columns = nullptr;
+
+  /// The positions in the rows of the matrix, per item, row and column of its local matrix, -1 if unset
+  array3d< localIndex > m_positions;
+};
+
+} // namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_UTILITIES_ASSEMBLYMAP_HPP_
@@ -20,6 +20,7 @@
 #define GEOSX_LINEARALGEBRA_UTILITIES_BLOCKVECTORVIEW_HPP_
 
 #include "linearAlgebra/common.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
 
 namespace geosx
 {
@@ -101,6 +102,14 @@ public:
    */
   real64 dot( BlockVectorView const & x ) const;
 
+  /**
+   * @brief Dot products with several block vectors, computed with a single global reduction.
+   * @param vecs the block vectors to compute products with
+   * @param result the dot products (must be sized as @p vecs)
+   */
+  void multiDot( arrayView1d< BlockVectorView const * const > const & vecs,
+                 arrayView1d< real64 > const & result ) const;
+
   /**
    * @brief 2-norm of the block vector.
    * @return 2-norm of the block vector
@@ -305,6 +314,37 @@ real64 BlockVectorView< VECTOR >::dot( BlockVectorView const & src ) const
   return accum;
 }
 
+template< typename VECTOR >
+void BlockVectorView< VECTOR >::multiDot( arrayView1d< BlockVectorView const * const > const & vecs,
+                                          arrayView1d< real64 > const & result ) const
+{
+  GEOSX_LAI_ASSERT_EQ( vecs.size(), result.size() );
+
+  // accumulate the local parts over the blocks, then reduce once
+  array1d< real64 > localResult( vecs.size() );
+  array1d< real64 > blockResult( vecs.size() );
+  array1d< VECTOR const * > blockVecs( vecs.size() );
+  for( localIndex i = 0; i < blockSize(); i++ )
+  {
+    for( localIndex j = 0; j < vecs.size(); j++ )
+    {
+      GEOSX_LAI_ASSERT_EQ( blockSize(), vecs[j]->blockSize() );
+      blockVecs[j] = &vecs[j]->block( i );
+    }
+    block( i ).localMultiDot( blockVecs, blockResult );
+    for( localIndex j = 0; j < vecs.size(); j++ )
+    {
+      localResult[j] += blockResult[j];
+    }
+  }
+
+  MpiWrapper::allReduce( localResult.data(),
+                         result.data(),
+                         LvArray::integerConversion< int >( result.size() ),
+                         MPI_SUM,
+                         block( 0 ).getComm() );
+}
+
 template< typename VECTOR >
 real64 BlockVectorView< VECTOR >::norm2() const
 {
@@ -19,6 +19,13 @@
 
 #include "LAIHelperFunctions.hpp"
 
+#include "mpiCommunications/MpiWrapper.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+
 namespace geosx
 {
 namespace LAIHelperFunctions
@@ -173,6 +180,228 @@ ParallelMatrix PermuteMatrix( ParallelMatrix const & matrix,
   return permutedMatrix;
 }
 
+namespace
+{
+
+/// Version of the linear system format written by WriteLinearSystem()
+integer constexpr linearSystemFormatVersion = 1;
+
+/// Number of leading entries (first row, number of rows, number of nonzeros) of each rank file
+localIndex constexpr chunkHeaderSize = 3;
+
+string chunkFileName( string const & prefix, int const rank )
+{
+  return prefix + "." + std::to_string( rank ) + ".bin";
+}
+
+template< typename T >
+void writeBinary( std::ofstream & os, T const * const data, localIndex const size )
+{
+  os.write( reinterpret_cast< char const * >( data ), size * sizeof( T ) );
+}
+
+template< typename T >
+void readBinary( std::ifstream & is, std::streamoff const pos, T * const data, localIndex const size )
+{
+  is.seekg( pos );
+  is.read( reinterpret_cast< char * >( data ), size * sizeof( T ) );
+  GEOSX_ERROR_IF( !is, "Failed to read linear system data" );
+}
+
+} // namespace
+
+void WriteLinearSystem( string const & prefix,
+                        ParallelMatrix const & matrix,
+                        ParallelVector const & rhs,
+                        DofManager const & dofManager )
+{
+  MPI_Comm const & comm = matrix.getComm();
+  array1d< string > const fieldNames = dofManager.fieldNames();
+  array1d< localIndex > const numComponents = dofManager.numComponentsPerField();
+  array1d< localIndex > const numLocalDofs = dofManager.numLocalDofsPerField();
+
+  if( MpiWrapper::Comm_rank( comm ) == 0 )
+  {
+    std::ofstream os( prefix + ".header" );
+    GEOSX_ERROR_IF( !os, "Failed to open " << prefix << ".header" );
+    os << "GEOSXLinearSystem " << linearSystemFormatVersion << "\n";
+    os << "numRanks " << MpiWrapper::Comm_size( comm ) << "\n";
+    os << "numGlobalRows " << matrix.numGlobalRows() << "\n";
+    os << "numFields " << fieldNames.size() << "\n";
+    for( localIndex f = 0; f < fieldNames.size(); ++f )
+    {
+      os << fieldNames[f] << " " << numComponents[f] << "\n";
+    }
+  }
+
+  // Rows of each field are contiguous on each rank, in field registration order
+  localIndex const numRows = matrix.numLocalRows();
+  array1d< integer > rowField( numRows );
+  array1d< integer > rowComponent( numRows );
+  localIndex row = 0;
+  for( localIndex f = 0; f < numLocalDofs.size(); ++f )
+  {
+    for( localIndex i = 0; i < numLocalDofs[f]; ++i, ++row )
+    {
+      rowField[row] = LvArray::integerConversion< integer >( f );
+      rowComponent[row] = LvArray::integerConversion< integer >( i % numComponents[f] );
+    }
+  }
+  GEOSX_LAI_ASSERT_EQ( row, numRows );
+
+  array1d< globalIndex > offsets( numRows + 1 );
+  offsets[0] = 0;
+  for( localIndex i = 0; i < numRows; ++i )
+  {
+    offsets[i + 1] = offsets[i] + matrix.globalRowLength( matrix.ilower() + i );
+  }
+
+  // Rows are written with sorted columns, as expected when reading them into a CRS matrix
+  array1d< globalIndex > cols( offsets[numRows] );
+  array1d< real64 > values( offsets[numRows] );
+  array1d< globalIndex > rowCols( matrix.maxRowLength() );
+  array1d< real64 > rowValues( matrix.maxRowLength() );
+  array1d< localIndex > perm( matrix.maxRowLength() );
+  for( localIndex i = 0; i < numRows; ++i )
+  {
+    localIndex const rowLength = LvArray::integerConversion< localIndex >( offsets[i + 1] - offsets[i] );
+    rowCols.resize( rowLength );
+    rowValues.resize( rowLength );
+    matrix.getRowCopy( matrix.ilower() + i, rowCols, rowValues );
+
+    perm.resize( rowLength );
+    std::iota( perm.begin(), perm.end(), 0 );
+    std::sort( perm.begin(), perm.end(), [&]( localIndex const a, localIndex const b ) { return rowCols[a] < rowCols[b]; } );
+    for( localIndex k = 0; k < rowLength; ++k )
+    {
+      cols[offsets[i] + k] = rowCols[perm[k]];
+      values[offsets[i] + k] = rowValues[perm[k]];
+    }
+  }
+
+  string const fileName = chunkFileName( prefix, MpiWrapper::Comm_rank( comm ) );
+  std::ofstream os( fileName, std::ios::binary );
+  GEOSX_ERROR_IF( !os, "Failed to open " << fileName );
+
+  globalIndex const header[chunkHeaderSize] = { matrix.ilower(), numRows, offsets[numRows] };
+  writeBinary( os, header, chunkHeaderSize );
+  writeBinary( os, offsets.data(), numRows + 1 );
+  writeBinary( os, cols.data(), cols.size() );
+  writeBinary( os, values.data(), values.size() );
+  writeBinary( os, rhs.extractLocalVector(), numRows );
+  writeBinary( os, rowField.data(), numRows );
+  writeBinary( os, rowComponent.data(), numRows );
+  GEOSX_ERROR_IF( !os, "Failed to write " << fileName );
+}
+
+void ReadLinearSystem( string const & prefix,
+                       MPI_Comm const & comm,
+                       ParallelMatrix & matrix,
+                       ParallelVector & rhs,
+                       LinearSystemLayout & layout )
+{
+  std::ifstream hs( prefix + ".header" );
+  GEOSX_ERROR_IF( !hs, "Failed to open " << prefix << ".header" );
+
+  string token;
+  integer version = 0;
+  hs >> token >> version;
+  GEOSX_ERROR_IF( token != "GEOSXLinearSystem" || version != linearSystemFormatVersion,
+                  prefix << ".header is not a linear system of version " << linearSystemFormatVersion );
+
+  int numChunks = 0;
+  globalIndex numGlobalRows = 0;
+  localIndex numFields = 0;
+  hs >> token >> numChunks >> token >> numGlobalRows >> token >> numFields;
+  layout.fieldNames.resize( numFields );
+  layout.numComponents.resize( numFields );
+  for( localIndex f = 0; f < numFields; ++f )
+  {
+    hs >> layout.fieldNames[f] >> layout.numComponents[f];
+  }
+  GEOSX_ERROR_IF( !hs, "Failed to read " << prefix << ".header" );
+
+  // Even distribution of the rows, independent of the layout the system was written with
+  int const rank = MpiWrapper::Comm_rank( comm );
+  int const numRanks = MpiWrapper::Comm_size( comm );
+  globalIndex const firstRow = rank * ( numGlobalRows / numRanks ) + std::min< globalIndex >( rank, numGlobalRows % numRanks );
+  globalIndex const endRow = firstRow + numGlobalRows / numRanks + ( rank < numGlobalRows % numRanks ? 1 : 0 );
+  localIndex const numRows = LvArray::integerConversion< localIndex >( endRow - firstRow );
+
+  array1d< localIndex > offsets( numRows + 1 );
+  array1d< globalIndex > cols;
+  array1d< real64 > values;
+  array1d< real64 > localRhs( numRows );
+  layout.rowField.resize( numRows );
+  layout.rowComponent.resize( numRows );
+  offsets[0] = 0;
+
+  // Rank files are read in order, so that rows are appended in increasing order
+  for( int chunk = 0; chunk < numChunks; ++chunk )
+  {
+    string const fileName = chunkFileName( prefix, chunk );
+    std::ifstream is( fileName, std::ios::binary );
+    GEOSX_ERROR_IF( !is, "Failed to open " << fileName );
+
+    globalIndex header[chunkHeaderSize];
+    readBinary( is, 0, header, chunkHeaderSize );
+    globalIndex const chunkFirstRow = header[0];
+    globalIndex const chunkNumRows = header[1];
+    globalIndex const chunkNumNonzeros = header[2];
+
+    globalIndex const lo = std::max( firstRow, chunkFirstRow );
+    globalIndex const hi = std::min( endRow, chunkFirstRow + chunkNumRows );
+    if( lo >= hi )
+    {
+      continue;
+    }
+    localIndex const n = LvArray::integerConversion< localIndex >( hi - lo );
+    localIndex const chunkRow = LvArray::integerConversion< localIndex >( lo - chunkFirstRow );
+    localIndex const localRow = LvArray::integerConversion< localIndex >( lo - firstRow );
+
+    std::streamoff const offsetsPos = chunkHeaderSize * sizeof( globalIndex );
+    std::streamoff const colsPos = offsetsPos + ( chunkNumRows + 1 ) * sizeof( globalIndex );
+    std::streamoff const valuesPos = colsPos + chunkNumNonzeros * sizeof( globalIndex );
+    std::streamoff const rhsPos = valuesPos + chunkNumNonzeros * sizeof( real64 );
+    std::streamoff const rowFieldPos = rhsPos + chunkNumRows * sizeof( real64 );
+    std::streamoff const rowComponentPos = rowFieldPos + chunkNumRows * sizeof( integer );
+
+    array1d< globalIndex > chunkOffsets( n + 1 );
+    readBinary( is, offsetsPos + chunkRow * sizeof( globalIndex ), chunkOffsets.data(), n + 1 );
+
+    localIndex const pos = cols.size();
+    localIndex const nnz = LvArray::integerConversion< localIndex >( chunkOffsets[n] - chunkOffsets[0] );
+    cols.resize( pos + nnz );
+    values.resize( pos + nnz );
+    readBinary( is, colsPos + chunkOffsets[0] * sizeof( globalIndex ), cols.data() + pos, nnz );
+    readBinary( is, valuesPos + chunkOffsets[0] * sizeof( real64 ), values.data() + pos, nnz );
+    readBinary( is, rhsPos + chunkRow * sizeof( real64 ), localRhs.data() + localRow, n );
+    readBinary( is, rowFieldPos + chunkRow * sizeof( integer ), layout.rowField.data() + localRow, n );
+    readBinary( is, rowComponentPos + chunkRow * sizeof( integer ), layout.rowComponent.data() + localRow, n );
+
+    for( localIndex i = 0; i < n; ++i )
+    {
+      offsets[localRow + i + 1] = pos + LvArray::integerConversion< localIndex >( chunkOffsets[i + 1] - chunkOffsets[0] );
+    }
+  }
+
+  array1d< localIndex > rowLengths( numRows );
+  for( localIndex i = 0; i < numRows; ++i )
+  {
+    rowLengths[i] = offsets[i + 1] - offsets[i];
+  }
+
+  CRSMatrix< real64, globalIndex > localMatrix;
+  localMatrix.resizeFromRowCapacities< serialPolicy >( numRows, numGlobalRows, rowLengths.data() );
+  for( localIndex i = 0; i < numRows; ++i )
+  {
+    localMatrix.insertNonZeros( i, cols.data() + offsets[i], values.data() + offsets[i], rowLengths[i] );
+  }
+
+  matrix.create( localMatrix.toViewConst(), comm );
+  rhs.create( localRhs.toViewConst(), comm );
+}
+
 } // namespace LAIHelperFunctions
 
 } // namespace geosx
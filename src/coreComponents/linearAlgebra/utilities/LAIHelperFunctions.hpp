@@ -21,6 +21,7 @@
 #define GEOSX_LINEARALGEBRA_UTILITIES_LAIHELPERFUNCTIONS_HPP_
 
 #include "common/DataTypes.hpp"
+#include "linearAlgebra/DofManager.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 #include "mesh/NodeManager.hpp"
 #include "mesh/ElementRegionManager.hpp"
@@ -105,6 +106,57 @@ void PrintPermutedMatrix( ParallelMatrix const & matrix,
                           ParallelMatrix const & permutationMatrixRight,
                           std::ostream & os );
 
+/**
+ * @brief DoF layout of a linear system read from disk.
+ */
+struct LinearSystemLayout
+{
+  /// Names of the DoF fields, in registration order
+  array1d< string > fieldNames;
+
+  /// Number of components of each DoF field
+  array1d< localIndex > numComponents;
+
+  /// Index of the DoF field of each locally owned row
+  array1d< integer > rowField;
+
+  /// Component (within its DoF field) of each locally owned row
+  array1d< integer > rowComponent;
+};
+
+/**
+ * @brief Write a linear system to disk for offline replay.
+ * @param prefix      prefix of the file names
+ * @param matrix      the system matrix
+ * @param rhs         the system right-hand side
+ * @param dofManager  the DoF manager associated with the system
+ *
+ * Rank 0 writes a text header @p prefix.header with the global size and the DoF fields,
+ * each rank writes its own rows in binary form to @p prefix.<rank>.bin: row offsets,
+ * global column indices, values, right-hand side, field and component of each row.
+ */
+void WriteLinearSystem( string const & prefix,
+                        ParallelMatrix const & matrix,
+                        ParallelVector const & rhs,
+                        DofManager const & dofManager );
+
+/**
+ * @brief Read a linear system written by WriteLinearSystem().
+ * @param prefix  prefix of the file names
+ * @param comm    the communicator to create the system on, of any size
+ * @param matrix  the system matrix
+ * @param rhs     the system right-hand side
+ * @param layout  the DoF layout of the locally owned rows
+ *
+ * Rows are evenly distributed over the ranks of @p comm, regardless of the number of
+ * ranks the system was written from.
+ */
+void ReadLinearSystem( string const & prefix,
+                       MPI_Comm const & comm,
+                       ParallelMatrix & matrix,
+                       ParallelVector & rhs,
+                       LinearSystemLayout & layout );
+
 /**
  * @brief Apply a separate component approximation (filter) to a matrix.
  * @tparam MATRIX the type of matrices
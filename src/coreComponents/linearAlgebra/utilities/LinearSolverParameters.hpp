@@ -37,12 +37,15 @@ struct LinearSolverParameters
    */
   enum class SolverType : integer
   {
-    direct,        ///< Direct solver
-    cg,            ///< CG
-    gmres,         ///< GMRES
-    fgmres,        ///< Flexible GMRES
-    bicgstab,      ///< BiCGStab
-    preconditioner ///< Preconditioner only
+    direct,         ///< Direct solver
+    cg,             ///< CG
+    gmres,          ///< GMRES
+    fgmres,         ///< Flexible GMRES
+    bicgstab,       ///< BiCGStab
+    preconditioner, ///< Preconditioner only
+    pipecg,         ///< Pipelined CG, with one nonblocking reduction per iteration (native solver only)
+    cagmres,        ///< s-step (communication-avoiding) GMRES (native solver only)
+    gcrodr          ///< GCRO-DR, GMRES recycling a deflation subspace between solves (native solver only)
   };
 
   /**
@@ -60,13 +63,29 @@ struct LinearSolverParameters
     ict,    ///< Incomplete Cholesky with thresholding
     amg,    ///< Algebraic Multigrid
     mgr,    ///< Multigrid reduction (Hypre only)
-    block   ///< Block preconditioner
+    block,  ///< Block preconditioner
+    cpr,    ///< Two-stage constrained pressure residual (compositional flow only)
+    gmg     ///< Geometric multigrid on the structured lattice (solid mechanics only)
+  };
+
+  /**
+   * @brief Ordering of the DoFs within each rank.
+   */
+  enum class DofOrdering : integer
+  {
+    fieldWise,   ///< One block per field, objects in mesh order
+    interleaved, ///< DoFs of all the fields supported by the same objects grouped per object
+    rcm          ///< Interleaved, objects permuted by reverse Cuthill-McKee on the local coupled graph
   };
 
   integer logLevel = 0;     ///< Output level [0=none, 1=basic, 2=everything]
   integer dofsPerNode = 1;  ///< Dofs per node (or support location) for non-scalar problems
   bool isSymmetric = false; ///< Whether input matrix is symmetric (may affect choice of scheme)
   integer stopIfError = 1;  ///< Whether to stop the simulation if the linear solver reports an error
+  integer captureSystems = 0; ///< Number of linear systems written to disk for offline replay
+  integer blockStorage = 0;   ///< Whether to store the matrix by blocks of the components of a single-field system
+
+  DofOrdering dofOrdering = DofOrdering::fieldWise; ///< Ordering of the local DoFs
 
   SolverType solverType = SolverType::direct;                        ///< Solver type
   PreconditionerType preconditionerType = PreconditionerType::iluk;  ///< Preconditioner type
@@ -103,6 +122,8 @@ struct LinearSolverParameters
     integer replaceTinyPivot = 1;           ///< Whether to replace tiny pivots by sqrt(epsilon)*norm(A)
     integer iterativeRefine = 1;            ///< Whether to perform iterative refinement
     integer parallel = 1;                   ///< Whether to use a parallel solver (instead of a serial one)
+    integer reuseSymbolic = 0;              ///< Whether to keep the ordering and symbolic factorization between solves
+                                            ///< of matrices with the same sparsity pattern (hypre only)
   }
   direct;                           ///< direct solver parameter struct
 
@@ -112,6 +133,8 @@ struct LinearSolverParameters
     real64 relTolerance = 1e-6;       ///< Relative convergence tolerance for iterative solvers
     integer maxIterations = 200;      ///< Max iterations before declaring convergence failure
     integer maxRestart = 200;         ///< Max number of vectors in Krylov basis before restarting
+    integer stepSize = 4;             ///< Number of Krylov vectors generated per block (s-step methods)
+    integer recycleSize = 10;         ///< Number of vectors of the subspace recycled between solves (GCRO-DR)
     integer useAdaptiveTol = false;   ///< Use Eisenstat-Walker adaptive tolerance
     real64 weakestTol = 1e-3;         ///< Weakest allowed tolerance when using adaptive method
   }
@@ -138,6 +161,8 @@ struct LinearSolverParameters
                                              ///< smoothed-aggregation AMG)
     integer separateComponents = false;      ///< Apply a separate component filter before AMG construction
     string nullSpaceType = "constantModes";  ///< Null space type [constantModes,rigidBodyModes]
+    integer aggressiveNumLevels = 0;         ///< Number of finest levels with aggressive coarsening (hypre only)
+    integer interpMaxNonZeros = 0;           ///< Max nonzeros per interpolation row, 0 for the default (hypre only)
   }
   amg;                                       ///< Algebraic Multigrid (AMG) parameters
 
@@ -147,6 +172,9 @@ struct LinearSolverParameters
     string strategy;                    ///< Predefined MGR solution strategy (solver specific)
     integer separateComponents = false; ///< Apply a separate displacement component (SDC) filter before AMG construction
     string displacementFieldName;       ///< Displacement field name need for SDC filter
+    array1d< integer > fpointLabels;    ///< Custom strategy: DoF component labels eliminated, level after level
+    array1d< integer > numFpointsPerLevel; ///< Custom strategy: number of labels eliminated at each level
+    string coarseSolver = "ilu";        ///< Custom strategy: coarse grid solver [ilu,amg]
   }
   mgr;                                  ///< Multigrid reduction (MGR) parameters
 
@@ -164,6 +192,42 @@ struct LinearSolverParameters
     integer overlap = 0;   ///< Ghost overlap
   }
   dd;                      ///< Domain decomposition parameter struct
+
+  /// Constrained pressure residual (CPR) parameters
+  struct CPR
+  {
+    /**
+     * @brief Preconditioner of the pressure stage
+     */
+    enum class PressureType : integer
+    {
+      amg,     ///< Algebraic multigrid
+      twoLevel ///< Two-level additive Schwarz, with a coarse space built on the aggregates of the mesh regions
+    };
+
+    PressureType pressurePrecond = PressureType::amg; ///< Pressure stage preconditioner
+  }
+  cpr;                                                ///< CPR parameter struct
+
+  /// Preconditioner reuse parameters (native Krylov solvers only)
+  struct Reuse
+  {
+    /**
+     * @brief When the preconditioner computed for a solve may be applied to the following ones
+     */
+    enum class Policy : integer
+    {
+      never,    ///< Recompute the preconditioner for every solve
+      timeStep, ///< Reuse the preconditioner until the end of the time step
+      numSolves ///< Reuse the preconditioner for up to maxSolves solves
+    };
+
+    Policy policy = Policy::never;   ///< Reuse policy
+    integer maxSolves = 10;          ///< Max number of solves with the same preconditioner (numSolves policy)
+    real64 iterationGrowth = 1.5;    ///< Recompute when the iteration count exceeds this factor times the count
+                                     ///< of the first solve with the current preconditioner
+  }
+  reuse;                             ///< Preconditioner reuse parameter struct
 };
 
 ENUM_STRINGS( LinearSolverParameters::SolverType,
@@ -172,7 +236,10 @@ ENUM_STRINGS( LinearSolverParameters::SolverType,
               "gmres",
               "fgmres",
               "bicgstab",
-              "preconditioner" )
+              "preconditioner",
+              "pipecg",
+              "cagmres",
+              "gcrodr" )
 
 ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
               "none",
@@ -185,7 +252,14 @@ ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
               "ict",
               "amg",
               "mgr",
-              "block" )
+              "block",
+              "cpr",
+              "gmg" )
+
+ENUM_STRINGS( LinearSolverParameters::DofOrdering,
+              "fieldWise",
+              "interleaved",
+              "rcm" )
 
 ENUM_STRINGS( LinearSolverParameters::Direct::ColPerm,
               "none",
@@ -199,6 +273,15 @@ ENUM_STRINGS( LinearSolverParameters::Direct::RowPerm,
               "none",
               "mc64" )
 
+ENUM_STRINGS( LinearSolverParameters::CPR::PressureType,
+              "amg",
+              "twoLevel" )
+
+ENUM_STRINGS( LinearSolverParameters::Reuse::Policy,
+              "never",
+              "timeStep",
+              "numSolves" )
+
 } /* namespace geosx */
 
 #endif /*GEOSX_LINEARALGEBRA_UTILITIES_LINEARSOLVERPARAMETERS_HPP_ */
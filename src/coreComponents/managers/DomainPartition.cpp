@@ -22,8 +22,11 @@
 #include "common/TimingMacros.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
 #include "fileIO/silo/SiloFile.hpp"
+#include "managers/FieldSpecification/FieldSpecificationManager.hpp"
 #include "managers/ObjectManagerBase.hpp"
+#include "mesh/WellElementSubRegion.hpp"
 #include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/LoadBalanceStatistics.hpp"
 #include "mpiCommunications/SpatialPartition.hpp"
 
 
@@ -51,7 +54,10 @@ DomainPartition::DomainPartition( std::string const & name,
 
 
 DomainPartition::~DomainPartition()
-{}
+{
+  // the field specifications keep pointers to the objects of the mesh they were applied to
+  FieldSpecificationManager::get().ClearTargets();
+}
 
 
 void DomainPartition::RegisterDataOnMeshRecursive( Group * const )
@@ -261,6 +267,31 @@ void DomainPartition::SetupCommunications( bool use_nonblocking )
   faceManager->computeGeometry( nodeManager );
 }
 
+void DomainPartition::recordRankSize() const
+{
+  localIndex numOwnedElements = 0;
+  localIndex numGhostElements = 0;
+  localIndex numWellElements = 0;
+  getMeshBodies()->forSubGroups< MeshBody >( [&]( MeshBody const & meshBody )
+  {
+    ElementRegionManager const & elemManager = *meshBody.getMeshLevel( 0 )->getElemManager();
+    elemManager.forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase const & subRegion )
+    {
+      numOwnedElements += subRegion.GetNumberOfLocalIndices();
+      numGhostElements += subRegion.size() - subRegion.GetNumberOfLocalIndices();
+    } );
+
+    // the well elements are counted apart, they do not cost as much as the cells
+    elemManager.forElementSubRegions< WellElementSubRegion >( [&]( WellElementSubRegion const & subRegion )
+    {
+      numWellElements += subRegion.GetNumberOfLocalIndices();
+      numOwnedElements -= subRegion.GetNumberOfLocalIndices();
+      numGhostElements -= subRegion.size() - subRegion.GetNumberOfLocalIndices();
+    } );
+  } );
+  LoadBalanceStatistics::setRankSize( numOwnedElements, numGhostElements, numWellElements );
+}
+
 void DomainPartition::AddNeighbors( const unsigned int idim,
                                     MPI_Comm & cartcomm,
                                     int * ncoords )
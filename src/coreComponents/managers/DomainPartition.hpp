@@ -106,6 +106,12 @@ public:
    */
   void SetupCommunications( bool use_nonblocking );
 
+  /**
+   * @brief Pass the numbers of owned, ghost and well elements of the rank to the LoadBalanceStatistics,
+   *        which lists them for the slowest ranks.
+   */
+  void recordRankSize() const;
+
   /**
    * @brief Recursively builds neighbors if an MPI cartesian topology is used (i.e. not metis).
    * @param idim Dimension index in the cartesian.
@@ -19,6 +19,8 @@
 #include "EventManager.hpp"
 
 #include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/LoadBalanceStatistics.hpp"
+#include "managers/DomainPartition.hpp"
 #include "managers/Events/EventBase.hpp"
 #include "common/TimingMacros.hpp"
 
@@ -36,7 +38,9 @@ EventManager::EventManager( std::string const & name,
   m_time(),
   m_dt(),
   m_cycle(),
-  m_currentSubEvent()
+  m_currentSubEvent(),
+  m_exitFlag( 0 ),
+  m_maxPendingTasks( 2 )
 {
   setInputFlags( InputFlags::REQUIRED );
 
@@ -53,6 +57,12 @@ EventManager::EventManager( std::string const & name,
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Maximum simulation cycle for the global event loop." );
 
+  registerWrapper( viewKeyStruct::maxPendingTasksString, &m_maxPendingTasks )->
+    setApplyDefaultValue( 2 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum number of deferred executions of the concurrent events queued or running. "
+                    "Once it is reached, the next concurrent event waits for the oldest one to finish." );
+
   registerWrapper( viewKeyStruct::timeString, &m_time )->
     setRestartFlags( RestartFlags::WRITE_AND_READ )->
     setDescription( "Current simulation time." );
@@ -99,7 +109,22 @@ void EventManager::Run( dataRepository::Group * domain )
 {
   GEOSX_MARK_FUNCTION;
 
-  integer exitFlag = 0;
+  BeginRun( domain );
+  while( Step( domain ) )
+  {}
+  EndRun( domain );
+}
+
+void EventManager::BeginRun( dataRepository::Group * GEOSX_UNUSED_PARAM( domain ) )
+{
+  GEOSX_MARK_FUNCTION;
+
+  m_exitFlag = 0;
+
+  GEOSX_ERROR_IF_LT_MSG( m_maxPendingTasks, 1, "maxPendingTasks should be at least 1" );
+  m_backgroundWorker.setMaxPendingTasks( m_maxPendingTasks );
+
+  LoadBalanceStatistics::setFirstCycle( m_cycle );
 
   // Setup event targets, sequence indicators
   array1d< integer > eventCounters( 2 );
@@ -107,6 +132,7 @@ void EventManager::Run( dataRepository::Group * domain )
   {
     subEvent.GetTargetReferences();
     subEvent.GetExecutionOrder( eventCounters );
+    subEvent.SetBackgroundWorker( &m_backgroundWorker );
   } );
 
   // Set the progress indicators
@@ -120,70 +146,98 @@ void EventManager::Run( dataRepository::Group * domain )
   {
     GEOSX_LOG_RANK_0( "The restart-file was written during step " << m_currentSubEvent << " of the event loop.  Resuming from that point." );
   }
+}
+
+bool EventManager::Step( dataRepository::Group * domain )
+{
+  GEOSX_MARK_FUNCTION;
 
-  // Run problem
   // Note: if currentSubEvent > 0, then we are resuming from a restart file
-  while((m_time < m_maxTime) && (m_cycle < m_maxCycle) && (exitFlag == 0))
+  if( !isRunning() )
   {
-    // Determine the cycle timestep
-    if( m_currentSubEvent == 0 )
-    {
-      // The max dt request
-      m_dt = m_maxTime - m_time;
-
-      // Determine the dt requests for each event
-      for(; m_currentSubEvent<this->numSubGroups(); ++m_currentSubEvent )
-      {
-        EventBase * subEvent = static_cast< EventBase * >( this->GetSubGroups()[m_currentSubEvent] );
-        m_dt = std::min( subEvent->GetTimestepRequest( m_time ), m_dt );
-      }
-      m_currentSubEvent = 0;
-
-#ifdef GEOSX_USE_MPI
-      // Find the min dt across processes
-      real64 dt_global;
-      MPI_Allreduce( &m_dt, &dt_global, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_GEOSX );
-      m_dt = dt_global;
-#endif
-    }
+    return false;
+  }
 
-    GEOSX_LOG_RANK_0( "Time: " << m_time << "s, dt:" << m_dt << "s, Cycle: " << m_cycle );
+  // Determine the cycle timestep
+  if( m_currentSubEvent == 0 )
+  {
+    // The max dt request
+    m_dt = m_maxTime - m_time;
 
-    // Execute
+    // Determine the dt requests for each event
     for(; m_currentSubEvent<this->numSubGroups(); ++m_currentSubEvent )
     {
       EventBase * subEvent = static_cast< EventBase * >( this->GetSubGroups()[m_currentSubEvent] );
+      m_dt = std::min( subEvent->GetTimestepRequest( m_time ), m_dt );
+    }
+    m_currentSubEvent = 0;
+
+    // Find the min dt across processes, in the same reduction as the contributions of the events
+    m_cycleReduction.clear();
+    CycleReduction::Handle const dtHandle = m_cycleReduction.addMin( m_dt );
+    this->forSubGroups< EventBase >( [&]( EventBase & subEvent )
+    {
+      subEvent.AddCycleReductions( m_cycleReduction );
+    } );
+    m_cycleReduction.reduce();
+    m_dt = m_cycleReduction.result( dtHandle );
+  }
+
+  GEOSX_LOG_RANK_0( "Time: " << m_time << "s, dt:" << m_dt << "s, Cycle: " << m_cycle );
+
+  // Execute
+  for(; m_currentSubEvent<this->numSubGroups(); ++m_currentSubEvent )
+  {
+    EventBase * subEvent = static_cast< EventBase * >( this->GetSubGroups()[m_currentSubEvent] );
+
+    // Calculate the event and sub-event forecasts
+    subEvent->CheckEvents( m_time, m_dt, m_cycle, domain );
+
+    // Print debug information for logLevel >= 1
+    GEOSX_LOG_LEVEL_RANK_0( 1,
+                            "     Event: " << m_currentSubEvent << " (" << subEvent->getName() << "), dt_request=" << subEvent->GetCurrentEventDtRequest() << ", forecast=" <<
+                            subEvent->getForecast() );
 
-      // Calculate the event and sub-event forecasts
-      subEvent->CheckEvents( m_time, m_dt, m_cycle, domain );
-
-      // Print debug information for logLevel >= 1
-      GEOSX_LOG_LEVEL_RANK_0( 1,
-                              "     Event: " << m_currentSubEvent << " (" << subEvent->getName() << "), dt_request=" << subEvent->GetCurrentEventDtRequest() << ", forecast=" <<
-                              subEvent->getForecast() );
-
-      // Execute, signal events
-      if( subEvent->hasToPrepareForExec() )
-      {
-        subEvent->SignalToPrepareForExecution( m_time, m_dt, m_cycle, domain );
-      }
-      else if( subEvent->isReadyForExec() )
-      {
-        subEvent->Execute( m_time, m_dt, m_cycle, 0, 0, domain );
-      }
-
-      // Check the exit flag
-      // Note: Currently, this is only being used by the HaltEvent
-      //       If it starts being used elsewhere it may need to be synchronized
-      exitFlag += subEvent->GetExitFlag();
+    // Execute, signal events
+    if( subEvent->hasToPrepareForExec() )
+    {
+      subEvent->SignalToPrepareForExecution( m_time, m_dt, m_cycle, domain );
+    }
+    else if( subEvent->isReadyForExec() )
+    {
+      subEvent->Execute( m_time, m_dt, m_cycle, 0, 0, domain );
     }
 
-    // Increment time/cycle, reset the subevent counter
-    m_time += m_dt;
-    ++m_cycle;
-    m_currentSubEvent = 0;
+    // Check the exit flag
+    // Note: Currently, this is only being used by the HaltEvent
+    //       If it starts being used elsewhere it may need to be synchronized
+    m_exitFlag += subEvent->GetExitFlag();
   }
 
+  // The element counts are updated for each report, the fracture solvers change them
+  if( LoadBalanceStatistics::isReportDue( m_cycle ) )
+  {
+    Group::group_cast< DomainPartition * >( domain )->recordRankSize();
+    LoadBalanceStatistics::printCycleReport( m_cycle );
+  }
+
+  logger::FlushRankMessages();
+
+  // Increment time/cycle, reset the subevent counter
+  m_time += m_dt;
+  ++m_cycle;
+  m_currentSubEvent = 0;
+
+  return isRunning();
+}
+
+void EventManager::EndRun( dataRepository::Group * domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  // The deferred executions may still write files the cleanup completes
+  m_backgroundWorker.wait();
+
   // Cleanup
   GEOSX_LOG_RANK_0( "Cleaning up events" );
 
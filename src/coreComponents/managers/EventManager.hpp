@@ -18,6 +18,8 @@
 
 #include "dataRepository/Group.hpp"
 #include "managers/Events/EventBase.hpp"
+#include "managers/Events/BackgroundWorker.hpp"
+#include "mpiCommunications/CycleReduction.hpp"
 
 
 namespace geosx
@@ -76,6 +78,32 @@ public:
    */
   void Run( dataRepository::Group * domain );
 
+  /**
+   * @brief Prepare the events for a run driven cycle by cycle with Step().
+   * @param[in] domain the current DomainPartition on which the Event will be ran
+   */
+  void BeginRun( dataRepository::Group * domain );
+
+  /**
+   * @brief Run one cycle of the execution loop, see Run().
+   * @param[in] domain the current DomainPartition on which the Event will be ran
+   * @return true if the run has more cycles, false once the max time or cycle is reached or an event halted it
+   */
+  bool Step( dataRepository::Group * domain );
+
+  /**
+   * @brief Clean up the events at the end of a run driven with Step().
+   * @param[in] domain the current DomainPartition on which the Event will be ran
+   */
+  void EndRun( dataRepository::Group * domain );
+
+  /**
+   * @brief Check whether the run has more cycles.
+   * @return true if neither the max time nor the max cycle is reached and no event halted the run
+   */
+  bool isRunning() const
+  { return ( m_time < m_maxTime ) && ( m_cycle < m_maxCycle ) && ( m_exitFlag == 0 ); }
+
   /**
    * @name viewKeyStruct/groupKeyStruct
    */
@@ -85,6 +113,7 @@ public:
   {
     static constexpr auto maxTimeString = "maxTime";
     static constexpr auto maxCycleString = "maxCycle";
+    static constexpr auto maxPendingTasksString = "maxPendingTasks";
 
     static constexpr auto timeString = "time";
     static constexpr auto dtString = "dt";
@@ -125,6 +154,18 @@ private:
 
   /// Current subevent index
   integer m_currentSubEvent;
+
+  /// Sum of the exit flags of the events since the beginning of the run
+  integer m_exitFlag;
+
+  /// Maximum number of deferred executions queued or running
+  integer m_maxPendingTasks;
+
+  /// Worker running the deferred executions of the concurrent events
+  BackgroundWorker m_backgroundWorker;
+
+  /// Reduction over the ranks of the time step requests and of the contributions of the events, once per cycle
+  CycleReduction m_cycleReduction;
 };
 
 
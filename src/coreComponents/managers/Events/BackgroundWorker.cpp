@@ -0,0 +1,129 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BackgroundWorker.cpp
+ */
+
+#include "BackgroundWorker.hpp"
+
+#include "common/Logger.hpp"
+
+namespace geosx
+{
+
+BackgroundWorker::BackgroundWorker( integer const maxPendingTasks ):
+  m_maxPendingTasks( maxPendingTasks )
+{
+  GEOSX_ERROR_IF_LT( maxPendingTasks, 1 );
+}
+
+BackgroundWorker::~BackgroundWorker()
+{
+  {
+    std::unique_lock< std::mutex > lock( m_mutex );
+    m_stop = true;
+  }
+  m_taskPushed.notify_all();
+  if( m_thread.joinable() )
+  {
+    m_thread.join();
+  }
+}
+
+void BackgroundWorker::setMaxPendingTasks( integer const maxPendingTasks )
+{
+  GEOSX_ERROR_IF_LT( maxPendingTasks, 1 );
+  std::unique_lock< std::mutex > lock( m_mutex );
+  m_maxPendingTasks = maxPendingTasks;
+}
+
+void BackgroundWorker::push( std::function< void() > task )
+{
+  std::unique_lock< std::mutex > lock( m_mutex );
+
+  // back-pressure, the producer waits rather than keeping more copies of its inputs
+  m_taskDone.wait( lock, [this]() { return m_numPendingTasks < m_maxPendingTasks; } );
+  rethrowTaskError( lock );
+
+  m_tasks.emplace_back( std::move( task ) );
+  ++m_numPendingTasks;
+  if( !m_thread.joinable() )
+  {
+    m_thread = std::thread( [this]() { run(); } );
+  }
+  lock.unlock();
+  m_taskPushed.notify_one();
+}
+
+void BackgroundWorker::wait()
+{
+  std::unique_lock< std::mutex > lock( m_mutex );
+  m_taskDone.wait( lock, [this]() { return m_numPendingTasks == 0; } );
+  rethrowTaskError( lock );
+}
+
+integer BackgroundWorker::numPendingTasks() const
+{
+  std::unique_lock< std::mutex > lock( m_mutex );
+  return m_numPendingTasks;
+}
+
+void BackgroundWorker::run()
+{
+  std::unique_lock< std::mutex > lock( m_mutex );
+  while( true )
+  {
+    m_taskPushed.wait( lock, [this]() { return m_stop || !m_tasks.empty(); } );
+    if( m_tasks.empty() )
+    {
+      return;
+    }
+
+    std::function< void() > task = std::move( m_tasks.front() );
+    m_tasks.pop_front();
+    lock.unlock();
+
+    std::exception_ptr error;
+    try
+    {
+      task();
+    }
+    catch( ... )
+    {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    if( error && !m_taskError )
+    {
+      m_taskError = error;
+    }
+    --m_numPendingTasks;
+    m_taskDone.notify_all();
+  }
+}
+
+void BackgroundWorker::rethrowTaskError( std::unique_lock< std::mutex > & lock )
+{
+  if( m_taskError )
+  {
+    std::exception_ptr error = m_taskError;
+    m_taskError = nullptr;
+    lock.unlock();
+    std::rethrow_exception( error );
+  }
+}
+
+} /* namespace geosx */
@@ -0,0 +1,126 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BackgroundWorker.hpp
+ */
+
+#ifndef GEOSX_MANAGERS_EVENTS_BACKGROUNDWORKER_HPP_
+#define GEOSX_MANAGERS_EVENTS_BACKGROUNDWORKER_HPP_
+
+#include "common/DataTypes.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace geosx
+{
+
+/**
+ * @class BackgroundWorker
+ * @brief Thread running tasks in the order they are pushed, while the main thread goes on.
+ *
+ * The thread is only started by the first task. The number of tasks queued or running is bounded, so that a
+ * producer faster than the worker waits instead of accumulating copies of its inputs. An exception thrown by
+ * a task is rethrown on the main thread by the next call to push() or wait().
+ */
+class BackgroundWorker
+{
+public:
+
+  /**
+   * @brief Construct a worker.
+   * @param maxPendingTasks the maximum number of tasks queued or running
+   */
+  explicit BackgroundWorker( integer const maxPendingTasks = 2 );
+
+  /**
+   * @brief Wait for the pending tasks and stop the thread.
+   */
+  ~BackgroundWorker();
+
+  BackgroundWorker( BackgroundWorker const & ) = delete;
+  BackgroundWorker & operator=( BackgroundWorker const & ) = delete;
+
+  /**
+   * @brief Set the maximum number of tasks queued or running.
+   * @param maxPendingTasks the maximum number of tasks, at least 1
+   */
+  void setMaxPendingTasks( integer const maxPendingTasks );
+
+  /**
+   * @brief Queue a task, waiting first for a pending task to finish if there are too many.
+   * @param task the task, it must not access anything the main thread modifies
+   */
+  void push( std::function< void() > task );
+
+  /**
+   * @brief Wait for all the pending tasks to finish.
+   */
+  void wait();
+
+  /**
+   * @brief Get the number of tasks queued or running.
+   * @return the number of pending tasks
+   */
+  integer numPendingTasks() const;
+
+private:
+
+  /**
+   * @brief Run the tasks until the worker is destroyed.
+   */
+  void run();
+
+  /**
+   * @brief Rethrow the exception of a task, if any.
+   * @param lock the lock of m_mutex, released before throwing
+   */
+  void rethrowTaskError( std::unique_lock< std::mutex > & lock );
+
+  /// Maximum number of tasks queued or running
+  integer m_maxPendingTasks;
+
+  /// Number of tasks queued or running
+  integer m_numPendingTasks = 0;
+
+  /// Tasks not started yet
+  std::deque< std::function< void() > > m_tasks;
+
+  /// Exception thrown by a task, not rethrown yet
+  std::exception_ptr m_taskError;
+
+  /// Whether the thread has to stop once the queue is empty
+  bool m_stop = false;
+
+  /// Protects the members above
+  mutable std::mutex m_mutex;
+
+  /// Signaled when a task is pushed or the worker stops
+  std::condition_variable m_taskPushed;
+
+  /// Signaled when a task finishes
+  std::condition_variable m_taskDone;
+
+  /// Thread running the tasks, started by the first push
+  std::thread m_thread;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MANAGERS_EVENTS_BACKGROUNDWORKER_HPP_ */
@@ -21,6 +21,10 @@
 
 #include "common/DataTypes.hpp"
 #include "common/TimingMacros.hpp"
+#include "dataRepository/MigrationAudit.hpp"
+#include "managers/Events/BackgroundWorker.hpp"
+#include "managers/Outputs/OutputBase.hpp"
+#include "mpiCommunications/LoadBalanceStatistics.hpp"
 
 namespace geosx
 {
@@ -48,7 +52,9 @@ EventBase::EventBase( const std::string & name,
   m_timeStepEventCount( 0 ),
   m_eventProgress( 0 ),
   m_currentEventDtRequest( 0.0 ),
-  m_target( nullptr )
+  m_concurrent( 0 ),
+  m_target( nullptr ),
+  m_backgroundWorker( nullptr )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
@@ -89,6 +95,13 @@ EventBase::EventBase( const std::string & name,
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "If this option is set, the event will reduce its timestep requests to match any specified beginTime/endTimes exactly." );
 
+  registerWrapper( viewKeyStruct::concurrentString, &m_concurrent )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "If this option is set and the target supports it (e.g. Blueprint and Probe outputs), the target copies "
+                    "what it reads and finishes its execution on a background thread, while the next events execute. "
+                    "The other targets execute in place." );
+
   registerWrapper( viewKeyStruct::lastTimeString, &m_lastTime )->
     setApplyDefaultValue( -1.0e100 )->
     setDescription( "Last event occurrence (time)" );
@@ -156,6 +169,26 @@ void EventBase::GetTargetReferences()
 }
 
 
+void EventBase::AddCycleReductions( CycleReduction & reduction )
+{
+  this->forSubGroups< EventBase >( [&]( EventBase & subEvent )
+  {
+    subEvent.AddCycleReductions( reduction );
+  } );
+}
+
+
+void EventBase::SetBackgroundWorker( BackgroundWorker * const worker )
+{
+  m_backgroundWorker = worker;
+
+  this->forSubGroups< EventBase >( [&]( EventBase & subEvent )
+  {
+    subEvent.SetBackgroundWorker( worker );
+  } );
+}
+
+
 void EventBase::CheckEvents( real64 const time,
                              real64 const dt,
                              integer const cycle,
@@ -222,7 +255,22 @@ void EventBase::Execute( real64 const time_n,
   if((m_target != nullptr) && (m_targetExecFlag == 0))
   {
     m_targetExecFlag = 1;
-    m_target->Execute( time_n, dt, cycleNumber, m_eventCount, m_eventProgress, domain );
+    MigrationAudit::ScopedSite const migrationSite( m_target->getName() );
+    if( m_concurrent && m_backgroundWorker != nullptr && m_target->CanDeferExecution() )
+    {
+      std::function< void() > deferred = m_target->DeferExecution( time_n, dt, cycleNumber, m_eventCount, m_eventProgress, domain );
+      if( deferred )
+      {
+        m_backgroundWorker->push( std::move( deferred ) );
+      }
+    }
+    else
+    {
+      // the solvers time their own phases
+      bool const isOutput = dynamic_cast< OutputBase * >( m_target ) != nullptr;
+      LoadBalanceStatistics::ScopedPhase const outputPhase( isOutput ? "output " + m_target->getName() : string() );
+      m_target->Execute( time_n, dt, cycleNumber, m_eventCount, m_eventProgress, domain );
+    }
   }
 
   // Iterate through the sub-event list using the managed integer m_currentSubEvent
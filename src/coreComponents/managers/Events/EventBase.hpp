@@ -27,6 +27,9 @@
 namespace geosx
 {
 
+class BackgroundWorker;
+class CycleReduction;
+
 /**
  * @class EventBase
  * A base class for managing code event targets (solver applications, etc.)
@@ -107,6 +110,12 @@ public:
    */
   virtual void ExpandObjectCatalogs() override;
 
+  /**
+   * @brief Set the worker running the deferred executions of the concurrent events and sub-events.
+   * @param worker the worker, it must outlive the run
+   */
+  void SetBackgroundWorker( BackgroundWorker * const worker );
+
   /**
    * @brief Process input data to retrieve targeted objects internally.
    * The target object for an event may be specified via the keyword "target" in the input xml.
@@ -150,6 +159,14 @@ public:
    */
   virtual real64 GetTimestepRequest( real64 const time ) override;
 
+  /**
+   * @brief Add the contributions of the event and its sub-events reduced over the ranks with the time step requests.
+   * The reduction is done before the events are checked, so that the events read their results instead of
+   * reducing their own values.
+   * @param reduction The reduction of the time step requests of the cycle.
+   */
+  virtual void AddCycleReductions( CycleReduction & reduction );
+
   /**
    * @brief Get event-specifit dt requests.
    * @param time The current simulation time.
@@ -193,6 +210,7 @@ public:
     static constexpr auto currentSubEventString = "currentSubEvent";
     static constexpr auto isTargetExecutingString = "isTargetExecuting";
     static constexpr auto finalDtStretchString = "finalDtStretch";
+    static constexpr auto concurrentString = "concurrent";
 
     dataRepository::ViewKey eventTarget = { "target" };
     dataRepository::ViewKey beginTime = { "beginTime" };
@@ -330,8 +348,14 @@ private:
   real64 m_eventProgress;
   real64 m_currentEventDtRequest;
 
+  /// Flag to execute the target concurrently with the next events
+  integer m_concurrent;
+
   /// A pointer to the optional event target
   ExecutableGroup * m_target;
+
+  /// Worker running the deferred executions of the target
+  BackgroundWorker * m_backgroundWorker;
 };
 
 } /* namespace geosx */
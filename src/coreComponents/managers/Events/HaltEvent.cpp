@@ -13,6 +13,9 @@
  */
 
 #include "HaltEvent.hpp"
+#include "managers/Outputs/RestartOutput.hpp"
+#include "mpiCommunications/CycleReduction.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
 #include <sys/time.h>
 
 /**
@@ -31,7 +34,11 @@ HaltEvent::HaltEvent( const std::string & name,
   m_externalStartTime( 0.0 ),
   m_externalLastTime( 0.0 ),
   m_externalDt( 0.0 ),
-  m_maxRuntime( 0.0 )
+  m_maxRuntime( 0.0 ),
+  m_checkpointSafetyFactor( 1.5 ),
+  m_triggered( false ),
+  m_cycleReduction( nullptr ),
+  m_forecastHandle( CycleReduction::invalidHandle )
 {
   timeval tim;
   gettimeofday( &tim, nullptr );
@@ -41,6 +48,12 @@ HaltEvent::HaltEvent( const std::string & name,
   registerWrapper( viewKeyStruct::maxRuntimeString, &m_maxRuntime )->
     setInputFlag( InputFlags::REQUIRED )->
     setDescription( "The maximum allowable runtime for the job." );
+
+  registerWrapper( viewKeyStruct::checkpointSafetyFactorString, &m_checkpointSafetyFactor )->
+    setApplyDefaultValue( 1.5 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "If the target is a Restart output, the longest time measured for its restart writes, "
+                    "multiplied by this factor, is reserved before the maximum runtime to write the last restart as the code exits." );
 }
 
 
@@ -48,10 +61,7 @@ HaltEvent::~HaltEvent()
 {}
 
 
-void HaltEvent::EstimateEventTiming( real64 const GEOSX_UNUSED_PARAM( time ),
-                                     real64 const GEOSX_UNUSED_PARAM( dt ),
-                                     integer const GEOSX_UNUSED_PARAM( cycle ),
-                                     Group * GEOSX_UNUSED_PARAM( domain ))
+integer HaltEvent::LocalForecast()
 {
   // Check run time
   timeval tim;
@@ -61,15 +71,46 @@ void HaltEvent::EstimateEventTiming( real64 const GEOSX_UNUSED_PARAM( time ),
   // Update values
   m_externalDt = currentTime - m_externalLastTime;
   m_externalLastTime = currentTime;
-  integer forecast = static_cast< integer >((m_maxRuntime - (currentTime - m_externalStartTime)) / m_externalDt);
 
-  // The timing for the ranks may differ slightly, so synchronize
-  // TODO: Only do the communication when you are close to the end?
-#ifdef GEOSX_USE_MPI
-  integer forecast_global;
-  MPI_Allreduce( &forecast, &forecast_global, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD );
-  forecast = forecast_global;
-#endif
+  // Keep the time to write the checkpoint as the code exits
+  real64 checkpointTime = 0.0;
+  RestartOutput const * const restartOutput = dynamic_cast< RestartOutput const * >( GetEventTarget() );
+  if( restartOutput != nullptr )
+  {
+    checkpointTime = m_checkpointSafetyFactor * restartOutput->getMaxWriteTime();
+  }
+  return static_cast< integer >((m_maxRuntime - (currentTime - m_externalStartTime) - checkpointTime) / m_externalDt);
+}
+
+
+void HaltEvent::AddCycleReductions( CycleReduction & reduction )
+{
+  EventBase::AddCycleReductions( reduction );
+
+  m_cycleReduction = &reduction;
+  m_forecastHandle = reduction.addMin( LocalForecast() );
+}
+
+
+void HaltEvent::EstimateEventTiming( real64 const GEOSX_UNUSED_PARAM( time ),
+                                     real64 const GEOSX_UNUSED_PARAM( dt ),
+                                     integer const GEOSX_UNUSED_PARAM( cycle ),
+                                     Group * GEOSX_UNUSED_PARAM( domain ))
+{
+  // The timing for the ranks may differ slightly, so synchronize.
+  // The rank with the slowest restart writes has the smallest forecast.
+  // The forecast is usually reduced with the time step requests of the cycle, it is only
+  // reduced here when the cycle resumes from a restart file written during the event loop.
+  integer forecast;
+  if( m_forecastHandle != CycleReduction::invalidHandle && m_cycleReduction->isReduced() )
+  {
+    forecast = static_cast< integer >( m_cycleReduction->result( m_forecastHandle ) );
+  }
+  else
+  {
+    forecast = MpiWrapper::Min( LocalForecast() );
+  }
+  m_forecastHandle = CycleReduction::invalidHandle;
 
   setForecast( forecast );
 
@@ -80,5 +121,44 @@ void HaltEvent::EstimateEventTiming( real64 const GEOSX_UNUSED_PARAM( time ),
 }
 
 
+void HaltEvent::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
+                         real64 const GEOSX_UNUSED_PARAM( dt ),
+                         integer const GEOSX_UNUSED_PARAM( cycleNumber ),
+                         integer const GEOSX_UNUSED_PARAM( eventCounter ),
+                         real64 const GEOSX_UNUSED_PARAM( eventProgress ),
+                         Group * GEOSX_UNUSED_PARAM( domain ) )
+{
+  if( !m_triggered )
+  {
+    m_triggered = true;
+    ExecutableGroup const * const target = GetEventTarget();
+    GEOSX_LOG_RANK_0( "HaltEvent " << getName() << ": the maximum runtime is near, the run stops at the end of this cycle"
+                                   << ( target != nullptr ? " and executes " + target->getName() : string() ) );
+  }
+}
+
+
+void HaltEvent::Cleanup( real64 const time_n,
+                         integer const cycleNumber,
+                         integer const eventCounter,
+                         real64 const eventProgress,
+                         Group * domain )
+{
+  ExecutableGroup * const target = GetEventTarget();
+  if( m_triggered && target != nullptr )
+  {
+    // The cleanup of the outputs writes a last file, and waits for the asynchronous restart writes to complete
+    if( dynamic_cast< OutputBase * >( target ) != nullptr )
+    {
+      target->Cleanup( time_n, cycleNumber, eventCounter, eventProgress, domain );
+    }
+    else
+    {
+      target->Execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+    }
+  }
+}
+
+
 REGISTER_CATALOG_ENTRY( EventBase, HaltEvent, std::string const &, Group * const )
 } /* namespace geosx */
@@ -29,6 +29,12 @@ namespace geosx
  * @class HaltEvent
  * An event type that is designed to look at the external clock.
  * This is useful for managing wall time limitations.
+ *
+ * When the event triggers, the code exits at the end of the current cycle.
+ * The target, typically a Restart output, is only executed then, as the code exits,
+ * so that the checkpoint holds the completed cycle. The time measured for the restart
+ * writes of the target is reserved in the forecast, for the checkpoint to be written
+ * before the wall time limit.
  */
 class HaltEvent : public EventBase
 {
@@ -60,6 +66,40 @@ public:
                                     real64 const dt,
                                     integer const cycle,
                                     dataRepository::Group * domain ) override;
+
+  /**
+   * @brief Add the rank-local forecast, whose minimum over the ranks is read when the event is checked.
+   * @copydoc EventBase::AddCycleReductions()
+   */
+  virtual void AddCycleReductions( CycleReduction & reduction ) override;
+
+  /**
+   * @brief Defer the execution of the target as the code exits.
+   * @copydoc EventBase::Execute()
+   */
+  virtual void Execute( real64 const time_n,
+                        real64 const dt,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        dataRepository::Group * domain ) override;
+
+  /**
+   * @brief Execute the target if the event triggered, and wait for its writes to complete.
+   * @copydoc ExecutableGroup::Cleanup()
+   */
+  virtual void Cleanup( real64 const time_n,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        dataRepository::Group * domain ) override;
+
+  /**
+   * @brief Measure the external clock and compute the forecast of the rank.
+   * @return the number of cycles left before the max runtime, as measured on the rank
+   */
+  integer LocalForecast();
+
   /// External start time
   real64 m_externalStartTime;
   /// External last time
@@ -68,11 +108,20 @@ public:
   real64 m_externalDt;
   /// Max runtime
   real64 m_maxRuntime;
+  /// Factor applied to the measured checkpoint time reserved before the max runtime
+  real64 m_checkpointSafetyFactor;
+  /// Whether the event triggered
+  bool m_triggered;
+  /// The reduction of the cycle holding the forecast, if it was added to one
+  CycleReduction const * m_cycleReduction;
+  /// The handle of the forecast in the reduction of the cycle
+  localIndex m_forecastHandle;
 
   /// @cond DO_NOT_DOCUMENT
   struct viewKeyStruct
   {
     static constexpr auto maxRuntimeString = "maxRuntime";
+    static constexpr auto checkpointSafetyFactorString = "checkpointSafetyFactor";
 
     dataRepository::ViewKey maxRuntime = { "maxRuntime" };
   } haltEventViewKeys;
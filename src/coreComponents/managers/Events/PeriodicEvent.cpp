@@ -168,7 +168,7 @@ void PeriodicEvent::CheckOptionalFunctionThreshold( real64 const time,
     // (Note: this shouldn't occur very often, since it is only called if the base forecast <= 0)
 #ifdef GEOSX_USE_MPI
     real64 result_global;
-    MPI_Allreduce( &result, &result_global, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+    MPI_Allreduce( &result, &result_global, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_GEOSX );
     result = result_global;
 #endif
   }
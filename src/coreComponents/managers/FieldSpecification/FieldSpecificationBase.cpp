@@ -98,6 +98,35 @@ FieldSpecificationBase::GetCatalog()
 void FieldSpecificationBase::PostProcessInput()
 {}
 
+SortedArrayView< localIndex const >
+FieldSpecificationBase::GetOwnedTargetSet( Group const & targetGroup,
+                                           string const & setName,
+                                           SortedArrayView< localIndex const > const & targetSet ) const
+{
+  arrayView1d< integer const > const & ghostRank =
+    targetGroup.getReference< array1d< integer > >( ObjectManagerBase::viewKeyStruct::ghostRankString );
+
+  OwnedTargetSet & ownedSet = m_ownedTargetSets[ std::make_pair( &targetGroup, setName ) ];
+  if( ownedSet.setSize != targetSet.size() || ownedSet.objectSize != ghostRank.size() )
+  {
+    // a new array, the previous one may have been moved to the device
+    SortedArray< localIndex > indices;
+    for( localIndex const a : targetSet )
+    {
+      if( ghostRank[a] < 0 )
+      {
+        indices.insert( a );
+      }
+    }
+
+    ownedSet.indices = std::move( indices );
+    ownedSet.setSize = targetSet.size();
+    ownedSet.objectSize = ghostRank.size();
+  }
+
+  return ownedSet.indices.toViewConst();
+}
+
 
 
 REGISTER_CATALOG_ENTRY( FieldSpecificationBase, FieldSpecificationBase, string const &, Group * const )
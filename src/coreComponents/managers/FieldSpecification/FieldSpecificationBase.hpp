@@ -120,7 +120,7 @@ public:
    * This function applies the value to a field variable. This function is typically
    * called from within the lambda to a call to FieldSpecificationManager::ApplyFieldValue().
    */
-  template< typename FIELD_OP, typename POLICY=parallelHostPolicy >
+  template< typename FIELD_OP, typename POLICY=parallelDevicePolicy<> >
   void ApplyFieldValue( SortedArrayView< localIndex const > const & targetSet,
                         real64 const time,
                         dataRepository::Group * dataGroup,
@@ -374,6 +374,7 @@ public:
    * @param[in] targetSet The set of indices which the boundary condition will be applied.
    * @param[in] dofMap The map from the local index of the primary field to the global degree of
    *                   freedom number.
+   * @param[in] dofRankOffset Offset of dof indices on current rank.
    * @param[inout] matrix the local system matrix
    *
    * This function zeroes the rows of the matrix that correspond to boundary conditions.
@@ -381,8 +382,30 @@ public:
   template< typename POLICY >
   void ZeroSystemRowsForBoundaryCondition( SortedArrayView< localIndex const > const & targetSet,
                                            arrayView1d< globalIndex const > const & dofMap,
+                                           globalIndex const dofRankOffset,
                                            CRSMatrixView< real64, globalIndex const > const & matrix ) const;
 
+  /**
+   * @brief Get the indices of a target set owned by this rank.
+   * @param[in] targetGroup The object the set belongs to.
+   * @param[in] setName The name of the set.
+   * @param[in] targetSet The set.
+   * @return The indices of @p targetSet that are not ghosts.
+   *
+   * The owned indices are kept from one application to the next, so that they are not filtered on the host
+   * and copied to the device each time. They are filtered again when the size of the set or of the object
+   * changes.
+   */
+  SortedArrayView< localIndex const > GetOwnedTargetSet( dataRepository::Group const & targetGroup,
+                                                         string const & setName,
+                                                         SortedArrayView< localIndex const > const & targetSet ) const;
+
+  /**
+   * @brief Forget the owned indices of the target sets, when the objects they belong to are destroyed.
+   */
+  void ClearOwnedTargetSets()
+  { m_ownedTargetSets.clear(); }
+
   /**
    * @brief View keys
    */
@@ -517,6 +540,15 @@ public:
     return m_scale;
   }
 
+  /**
+   * Accessor
+   * @return const m_normalizeBySetSize
+   */
+  bool NormalizeBySetSize() const
+  {
+    return m_normalizeBySetSize;
+  }
+
   /**
    * Mutator
    * @param[in] fieldName The name of the field
@@ -609,6 +641,22 @@ private:
   /// The name of a function used to turn on and off the boundary condition.
   string m_bcApplicationFunctionName;
 
+  /**
+   * @brief The owned indices of a target set, with the sizes they were filtered for.
+   */
+  struct OwnedTargetSet
+  {
+    /// The size of the target set
+    localIndex setSize = -1;
+    /// The size of the object the set belongs to
+    localIndex objectSize = -1;
+    /// The owned indices
+    SortedArray< localIndex > indices;
+  };
+
+  /// The owned indices of the target sets, by object and set name
+  mutable std::map< std::pair< dataRepository::Group const *, string >, OwnedTargetSet > m_ownedTargetSets;
+
   /// The factor used to normalize the boundary flux by the size of the set it is applied to
   //real64 m_setSizeScalingFactor;
 
@@ -799,6 +847,7 @@ FieldSpecificationBase::
       real64_array result;
       result.resize( LvArray::integerConversion< localIndex >( targetSet.size()));
       function->Evaluate( dataGroup, time, targetSet, result );
+      result.move( LvArray::MemorySpace::CPU, false );
       integer counter=0;
       for( auto a : targetSet )
       {
@@ -900,6 +949,7 @@ FieldSpecificationBase::
       real64_array result;
       result.resize( LvArray::integerConversion< localIndex >( targetSet.size()));
       function->Evaluate( dataGroup, time, targetSet, result );
+      result.move( LvArray::MemorySpace::CPU, false );
       integer counter=0;
       for( auto a : targetSet )
       {
@@ -1091,17 +1141,22 @@ FieldSpecificationBase::
 template< typename POLICY >
 void FieldSpecificationBase::ZeroSystemRowsForBoundaryCondition( SortedArrayView< localIndex const > const & targetSet,
                                                                  arrayView1d< globalIndex const > const & dofMap,
+                                                                 globalIndex const dofRankOffset,
                                                                  CRSMatrixView< real64, globalIndex const > const & matrix ) const
 
 {
   integer const component = GetComponent();
-  forAll< POLICY >( targetSet.size(), [targetSet, dofMap, matrix, component] GEOSX_HOST_DEVICE ( localIndex const i )
+  forAll< POLICY >( targetSet.size(), [targetSet, dofMap, dofRankOffset, matrix, component] GEOSX_HOST_DEVICE ( localIndex const i )
   {
     localIndex const a = targetSet[ i ];
-    globalIndex const dof = dofMap[ a ] + component;
+    globalIndex const localRow = dofMap[ a ] + component - dofRankOffset;
+    if( localRow < 0 || localRow >= matrix.numRows() )
+    {
+      return;
+    }
 
-    arraySlice1d< real64 > const entries = matrix.getEntries( dof );
-    localIndex const numEntries = matrix.numNonZeros( dof );
+    arraySlice1d< real64 > const entries = matrix.getEntries( localRow );
+    localIndex const numEntries = matrix.numNonZeros( localRow );
 
     for( localIndex j = 0; j < numEntries; ++j )
     {
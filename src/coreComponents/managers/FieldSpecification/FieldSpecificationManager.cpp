@@ -16,6 +16,9 @@
 
 #include "codingUtilities/StringUtilities.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <algorithm>
 
 namespace geosx
 {
@@ -56,6 +59,281 @@ void FieldSpecificationManager::ExpandObjectCatalogs()
 }
 
 
+std::vector< Group * > const & FieldSpecificationManager::getTargets( FieldSpecificationBase const & fs,
+                                                                    MeshLevel & meshLevel ) const
+{
+  Targets & targets = m_targets[ &fs ];
+
+  bool upToDate = targets.mesh == &meshLevel && targets.objectPath == fs.GetObjectPath();
+  for( std::pair< Group const *, localIndex > const & searchedGroup : targets.searchedGroups )
+  {
+    upToDate = upToDate && searchedGroup.first->numSubGroups() == searchedGroup.second;
+  }
+
+  if( upToDate )
+  {
+    return targets.objects;
+  }
+
+  targets.mesh = &meshLevel;
+  targets.objectPath = fs.GetObjectPath();
+  targets.objects.clear();
+  targets.searchedGroups.clear();
+
+  string_array const targetPath = stringutilities::Tokenize( fs.GetObjectPath(), "/" );
+  localIndex const targetPathLength = LvArray::integerConversion< localIndex >( targetPath.size());
+
+  Group * targetGroup = &meshLevel;
+
+  string processedPath;
+  for( localIndex pathLevel=0; pathLevel<targetPathLength; ++pathLevel )
+  {
+    Group * const elemRegionSubGroup = targetGroup->GetGroup( ElementRegionManager::groupKeyStruct::elementRegionsGroup );
+    if( elemRegionSubGroup!=nullptr )
+    {
+      targetGroup = elemRegionSubGroup;
+    }
+
+    Group * const elemSubRegionSubGroup = targetGroup->GetGroup( ElementRegionBase::viewKeyStruct::elementSubRegions );
+    if( elemSubRegionSubGroup!=nullptr )
+    {
+      targetGroup = elemSubRegionSubGroup;
+    }
+
+    if( targetPath[pathLevel] == ElementRegionManager::groupKeyStruct::elementRegionsGroup ||
+        targetPath[pathLevel] == ElementRegionBase::viewKeyStruct::elementSubRegions )
+    {
+      continue;
+    }
+
+    targetGroup = targetGroup->GetGroup( targetPath[pathLevel] );
+    processedPath += "/" + targetPath[pathLevel];
+
+    GEOSX_ERROR_IF( targetGroup == nullptr,
+                    "ApplyBoundaryCondition(): Last entry in objectPath ("<<processedPath<<") is not found" );
+  }
+
+  collectTargets( targetGroup, targets );
+  return targets.objects;
+}
+
+void FieldSpecificationManager::collectTargets( Group * const target, Targets & targets )
+{
+  if( ( target->getParent()->getName() == ElementRegionBase::viewKeyStruct::elementSubRegions
+        || target->getName() == "nodeManager"
+        || target->getName() == "FaceManager"
+        || target->getName() == "edgeManager" ) // TODO these 3 strings are harcoded because for the moment, there are
+                                                // inconsistencies with the name of the Managers...
+      && target->getName() != ObjectManagerBase::groupKeyStruct::setsString
+      && target->getName() != ObjectManagerBase::groupKeyStruct::neighborDataString )
+  {
+    targets.objects.emplace_back( target );
+  }
+  else
+  {
+    // the subregions created later, for instance by the fracture solvers, are found when the count changes
+    targets.searchedGroups.emplace_back( target, target->numSubGroups() );
+    target->forSubGroups( [&]( Group & subTarget )
+    {
+      collectTargets( &subTarget, targets );
+    } );
+  }
+}
+
+void FieldSpecificationManager::ClearTargets()
+{
+  m_targets.clear();
+  m_sourceFluxTables.clear();
+  forSubGroups< FieldSpecificationBase >( []( FieldSpecificationBase & fs )
+  {
+    fs.ClearOwnedTargetSets();
+  } );
+}
+
+void FieldSpecificationManager::ApplySourceFluxToSystem( real64 const time,
+                                                         real64 const dt,
+                                                         DomainPartition & domain,
+                                                         string const & dofKey,
+                                                         globalIndex const dofRankOffset,
+                                                         CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                         arrayView1d< real64 > const & localRhs ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  FunctionManager & functionManager = FunctionManager::Instance();
+
+  struct Source
+  {
+    FieldSpecificationBase const * fs;
+    SortedArrayView< localIndex const > ownedSet;
+    localIndex normalization;
+  };
+
+  std::vector< Group * > subRegions;
+  std::unordered_map< Group *, std::vector< Source > > subRegionSources;
+  std::vector< integer > localSetSizes;
+
+  Apply( time, &domain, "ElementRegions", FieldSpecificationBase::viewKeyStruct::fluxBoundaryConditionString,
+         [&]( FieldSpecificationBase const * const fs,
+              string const & setName,
+              SortedArrayView< localIndex const > const & targetSet,
+              Group * const subRegion,
+              string const & )
+  {
+    SortedArrayView< localIndex const > const ownedSet = fs->GetOwnedTargetSet( *subRegion, setName, targetSet );
+
+    string const & functionName = fs->GetFunctionName();
+    if( !functionName.empty() && functionManager.getGroupReference< FunctionBase >( functionName ).isFunctionOfTime() != 2 )
+    {
+      // the value differs from an element to the other, the source cannot share the table
+      arrayView1d< globalIndex const > const dofNumber = subRegion->getReference< array1d< globalIndex > >( dofKey );
+      fs->ApplyBoundaryConditionToSystem< FieldSpecificationAdd,
+                                          parallelDevicePolicy<> >( ownedSet,
+                                                                    time,
+                                                                    dt,
+                                                                    subRegion,
+                                                                    dofNumber,
+                                                                    dofRankOffset,
+                                                                    localMatrix,
+                                                                    localRhs,
+                                                                    [] GEOSX_HOST_DEVICE ( localIndex const )
+      {
+        return 0.0;
+      } );
+      return;
+    }
+
+    localIndex normalization = -1;
+    if( fs->NormalizeBySetSize() )
+    {
+      normalization = LvArray::integerConversion< localIndex >( localSetSizes.size() );
+      localSetSizes.emplace_back( ownedSet.size() );
+    }
+
+    std::vector< Source > & sources = subRegionSources[ subRegion ];
+    if( sources.empty() )
+    {
+      subRegions.emplace_back( subRegion );
+    }
+    sources.push_back( { fs, ownedSet, normalization } );
+  } );
+
+  // all the ranks go through the same sources, the set sizes are summed at once rather than one by one
+  std::vector< integer > globalSetSizes( localSetSizes.size() );
+  if( !localSetSizes.empty() )
+  {
+    MpiWrapper::allReduce( localSetSizes.data(),
+                           globalSetSizes.data(),
+                           LvArray::integerConversion< int >( localSetSizes.size() ),
+                           MPI_SUM,
+                           MPI_COMM_GEOSX );
+  }
+
+  // the functions of time of all the sources are evaluated at once, the tables sharing an axis together
+  std::vector< string > functionNames;
+  for( Group * const subRegion : subRegions )
+  {
+    for( Source const & source : subRegionSources.at( subRegion ) )
+    {
+      string const & functionName = source.fs->GetFunctionName();
+      if( !functionName.empty() && std::find( functionNames.begin(), functionNames.end(), functionName ) == functionNames.end() )
+      {
+        functionNames.emplace_back( functionName );
+      }
+    }
+  }
+  std::vector< real64 > values;
+  functionManager.evaluate( functionNames, time, values );
+  std::unordered_map< string, real64 > functionValues;
+  for( std::size_t k = 0; k < functionNames.size(); ++k )
+  {
+    functionValues.emplace( functionNames[k], values[k] );
+  }
+
+  for( Group * const subRegion : subRegions )
+  {
+    std::vector< Source > const & sources = subRegionSources.at( subRegion );
+    localIndex const numSources = LvArray::integerConversion< localIndex >( sources.size() );
+    SourceFluxTable & table = m_sourceFluxTables[ subRegion ];
+
+    bool upToDate = LvArray::integerConversion< localIndex >( table.sources.size() ) == numSources;
+    for( localIndex k = 0; upToDate && k < numSources; ++k )
+    {
+      SortedArrayView< localIndex const > const & ownedSet = sources[ k ].ownedSet;
+      upToDate = table.sources[ k ] == sources[ k ].fs &&
+                 table.offsets[ k + 1 ] - table.offsets[ k ] == ownedSet.size() &&
+                 std::equal( ownedSet.data(), ownedSet.data() + ownedSet.size(), table.hostElements.begin() + table.offsets[ k ] );
+    }
+
+    if( !upToDate )
+    {
+      table.sources.clear();
+      table.offsets.assign( 1, 0 );
+      table.hostElements.clear();
+      for( Source const & source : sources )
+      {
+        table.sources.emplace_back( source.fs );
+        table.hostElements.insert( table.hostElements.end(), source.ownedSet.data(), source.ownedSet.data() + source.ownedSet.size() );
+        table.offsets.emplace_back( LvArray::integerConversion< localIndex >( table.hostElements.size() ) );
+      }
+
+      localIndex const numEntries = LvArray::integerConversion< localIndex >( table.hostElements.size() );
+      table.elements.move( LvArray::MemorySpace::CPU, true );
+      table.sourceIndices.move( LvArray::MemorySpace::CPU, true );
+      table.components.move( LvArray::MemorySpace::CPU, true );
+      table.elements.resize( numEntries );
+      table.sourceIndices.resize( numEntries );
+      table.components.resize( numSources );
+      for( localIndex k = 0; k < numSources; ++k )
+      {
+        table.components[ k ] = sources[ k ].fs->GetComponent();
+        for( localIndex i = table.offsets[ k ]; i < table.offsets[ k + 1 ]; ++i )
+        {
+          table.elements[ i ] = table.hostElements[ i ];
+          table.sourceIndices[ i ] = k;
+        }
+      }
+    }
+
+    table.values.move( LvArray::MemorySpace::CPU, true );
+    table.values.resize( numSources );
+    for( localIndex k = 0; k < numSources; ++k )
+    {
+      FieldSpecificationBase const & fs = *sources[ k ].fs;
+      real64 value = fs.GetScale() * dt;
+      if( sources[ k ].normalization >= 0 )
+      {
+        integer const globalSetSize = globalSetSizes[ sources[ k ].normalization ];
+        value *= globalSetSize >= 1 ? 1.0 / globalSetSize : 1.0;
+      }
+
+      string const & functionName = fs.GetFunctionName();
+      if( !functionName.empty() )
+      {
+        value *= functionValues.at( functionName );
+      }
+      table.values[ k ] = value;
+    }
+
+    arrayView1d< globalIndex const > const dofNumber = subRegion->getReference< array1d< globalIndex > >( dofKey );
+    arrayView1d< localIndex const > const elements = table.elements.toViewConst();
+    arrayView1d< localIndex const > const sourceIndices = table.sourceIndices.toViewConst();
+    arrayView1d< integer const > const components = table.components.toViewConst();
+    arrayView1d< real64 const > const values = table.values.toViewConst();
+
+    // several sources may target the same element
+    forAll< parallelDevicePolicy<> >( elements.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+    {
+      localIndex const k = sourceIndices[ i ];
+      globalIndex const localRow = dofNumber[ elements[ i ] ] + components[ k ] - dofRankOffset;
+      if( localRow >= 0 && localRow < localRhs.size() )
+      {
+        RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[ localRow ], values[ k ] );
+      }
+    } );
+  }
+}
+
 void FieldSpecificationManager::ApplyInitialConditions( Group * domain ) const
 {
 
@@ -66,7 +344,8 @@ void FieldSpecificationManager::ApplyInitialConditions( Group * domain ) const
               Group * const targetGroup,
               string const fieldName )
   {
-    bc->ApplyFieldValue< FieldSpecificationEqual >( targetSet, 0.0, targetGroup, fieldName );
+    // the fields are initialized on the host, before any kernel touches them
+    bc->ApplyFieldValue< FieldSpecificationEqual, parallelHostPolicy >( targetSet, 0.0, targetGroup, fieldName );
   } );
 }
 
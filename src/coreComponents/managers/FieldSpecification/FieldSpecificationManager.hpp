@@ -26,6 +26,8 @@
 #include "managers/ObjectManagerBase.hpp"
 #include "managers/DomainPartition.hpp"
 
+#include <unordered_map>
+
 namespace geosx
 {
 namespace dataRepository
@@ -93,7 +95,7 @@ public:
    * and calls FieldSpecificationBase::ApplyFieldValue().
    *
    */
-  template< typename POLICY=parallelHostPolicy >
+  template< typename POLICY=parallelDevicePolicy<> >
   void ApplyFieldValue( real64 const time,
                         dataRepository::Group * domain,
                         string const & fieldPath,
@@ -135,7 +137,7 @@ public:
    * to apply any operations required for completing the application of the value to the field in addition to
    * setting the target field.
    */
-  template< typename POLICY=parallelHostPolicy, typename LAMBDA=void >
+  template< typename POLICY=parallelDevicePolicy<>, typename LAMBDA=void >
   void ApplyFieldValue( real64 const time,
                         dataRepository::Group * domain,
                         string const & fieldPath,
@@ -176,7 +178,7 @@ public:
    * operations required for completing the application of the value to the field in addition to
    * setting the target field.
    */
-  template< typename POLICY=parallelHostPolicy, typename PRELAMBDA=void, typename POSTLAMBDA=void >
+  template< typename POLICY=parallelDevicePolicy<>, typename PRELAMBDA=void, typename POSTLAMBDA=void >
   void ApplyFieldValue( real64 const time,
                         dataRepository::Group * domain,
                         string const & fieldPath,
@@ -214,6 +216,8 @@ public:
    * should be applied, and applies them. More specifically, this function simply checks
    * values of fieldPath,fieldName, against each FieldSpecificationBase object contained in the
    * FieldSpecificationManager and decides on whether or not to call the user defined lambda.
+   * The objects matching the object path of each FieldSpecificationBase are only searched for
+   * on its first application, see ClearTargets().
    */
   template< typename LAMBDA >
   void Apply( real64 const time,
@@ -232,9 +236,7 @@ public:
       if( ( isInitialCondition && fieldPath=="" ) ||
           ( !isInitialCondition && fs->GetObjectPath().find( fieldPath ) != string::npos ) )
       {
-        string_array const targetPath = stringutilities::Tokenize( fs->GetObjectPath(), "/" );
-        localIndex const targetPathLength = LvArray::integerConversion< localIndex >( targetPath.size());
-        string const targetName = fs->GetFieldName();
+        string const & targetName = fs->GetFieldName();
 
         if( ( isInitialCondition && fieldName=="" ) ||
             ( !isInitialCondition && time >= fs->GetStartTime() && time < fs->GetEndTime() && targetName==fieldName ) )
@@ -242,41 +244,59 @@ public:
           MeshLevel * const meshLevel = domain->group_cast< DomainPartition * >()->
                                           getMeshBody( 0 )->getMeshLevel( 0 );
 
-          dataRepository::Group * targetGroup = meshLevel;
-
-          string processedPath;
-          for( localIndex pathLevel=0; pathLevel<targetPathLength; ++pathLevel )
+          string_array const & setNames = fs->GetSetNames();
+          for( dataRepository::Group * const target : getTargets( *fs, *meshLevel ) )
           {
-            dataRepository::Group * const elemRegionSubGroup = targetGroup->GetGroup( ElementRegionManager::groupKeyStruct::elementRegionsGroup );
-            if( elemRegionSubGroup!=nullptr )
-            {
-              targetGroup = elemRegionSubGroup;
-            }
-
-            dataRepository::Group * const elemSubRegionSubGroup = targetGroup->GetGroup( ElementRegionBase::viewKeyStruct::elementSubRegions );
-            if( elemSubRegionSubGroup!=nullptr )
+            dataRepository::Group const * const setGroup = target->GetGroup( ObjectManagerBase::groupKeyStruct::setsString );
+            for( string const & setName : setNames )
             {
-              targetGroup = elemSubRegionSubGroup;
+              dataRepository::Wrapper< SortedArray< localIndex > > const * const setWrapper =
+                setGroup->getWrapper< SortedArray< localIndex > >( setName );
+              if( setWrapper != nullptr )
+              {
+                SortedArrayView< localIndex const > const & targetSet = setWrapper->reference();
+                lambda( fs, setName, targetSet, target, targetName );
+              }
             }
-
-            if( targetPath[pathLevel] == ElementRegionManager::groupKeyStruct::elementRegionsGroup ||
-                targetPath[pathLevel] == ElementRegionBase::viewKeyStruct::elementSubRegions )
-            {
-              continue;
-            }
-
-            targetGroup = targetGroup->GetGroup( targetPath[pathLevel] );
-            processedPath += "/" + targetPath[pathLevel];
-
-            GEOSX_ERROR_IF( targetGroup == nullptr,
-                            "ApplyBoundaryCondition(): Last entry in objectPath ("<<processedPath<<") is not found" );
           }
-          ApplyOnTargetRecursive( targetGroup, fs, targetName, lambda );
         }
       }
     }
   }
 
+  /**
+   * @brief Forget the objects the field specifications were applied to.
+   *
+   * The objects are resolved from the object path of each field specification on its first application, and
+   * only resolved again when their parents gain or lose subgroups. This must be called when the mesh they
+   * belong to is destroyed, it also clears the owned sets of FieldSpecificationBase::GetOwnedTargetSet().
+   */
+  void ClearTargets();
+
+  /**
+   * @brief Add the source fluxes of the element regions to the right-hand side of a system, all at once.
+   * @param time the time at which the sources are evaluated, usually the end of the time step
+   * @param dt the time step
+   * @param domain the DomainPartition object
+   * @param dofKey the key of the dof numbers in the element subregions
+   * @param dofRankOffset offset of dof indices on current rank
+   * @param localMatrix the local system matrix, unchanged by source fluxes
+   * @param localRhs the local right-hand side
+   *
+   * The owned targets of the sources of each subregion are flattened into a single table, kept as long as
+   * the owned target sets do not change, and added to the right-hand side in one kernel launch per subregion
+   * rather than one per source. Each time function is evaluated once and the sources normalized by their set
+   * size share a single reduction. The sources whose function does not only depend on time are still applied
+   * one by one. This is equivalent to applying each source with FieldSpecificationAdd.
+   */
+  void ApplySourceFluxToSystem( real64 const time,
+                                real64 const dt,
+                                DomainPartition & domain,
+                                string const & dofKey,
+                                globalIndex const dofRankOffset,
+                                CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                arrayView1d< real64 > const & localRhs ) const;
+
 private:
   /**
    * @brief private constructor for the singleton BoundaryConditionManager.
@@ -286,41 +306,63 @@ private:
   FieldSpecificationManager( string const & name, dataRepository::Group * const parent );
   virtual ~FieldSpecificationManager() override;
 
-  template< typename LAMBDA >
-  void ApplyOnTargetRecursive( Group * target,
-                               FieldSpecificationBase const * fs,
-                               string const & targetName,
-                               LAMBDA && lambda
-                               ) const
+  /**
+   * @brief The objects holding the sets a field specification is applied to.
+   */
+  struct Targets
   {
-    if( ( target->getParent()->getName() == ElementRegionBase::viewKeyStruct::elementSubRegions
-          || target->getName() == "nodeManager"
-          || target->getName() == "FaceManager"
-          || target->getName() == "edgeManager" ) // TODO these 3 strings are harcoded because for the moment, there are
-                                                  // inconsistencies with the name of the Managers...
-        && target->getName() != ObjectManagerBase::groupKeyStruct::setsString
-        && target->getName() != ObjectManagerBase::groupKeyStruct::neighborDataString )
-    {
-      dataRepository::Group const * setGroup = target->GetGroup( ObjectManagerBase::groupKeyStruct::setsString );
-      string_array setNames = fs->GetSetNames();
-      for( auto & setName : setNames )
-      {
-        dataRepository::Wrapper< SortedArray< localIndex > > const * const setWrapper = setGroup->getWrapper< SortedArray< localIndex > >( setName );
-        if( setWrapper != nullptr )
-        {
-          SortedArrayView< localIndex const > const & targetSet = setWrapper->reference();
-          lambda( fs, setName, targetSet, target, targetName );
-        }
-      }
-    }
-    else
-    {
-      target->forSubGroups( [&]( Group & subTarget )
-      {
-        ApplyOnTargetRecursive( &subTarget, fs, targetName, lambda );
-      } );
-    }
-  }
+    /// The mesh level the objects were found in
+    MeshLevel const * mesh = nullptr;
+    /// The object path the objects were found from
+    string objectPath;
+    /// The objects, in the order of a depth-first traversal of the object path
+    std::vector< dataRepository::Group * > objects;
+    /// The groups whose subgroups were searched for objects, with their number of subgroups at the time
+    std::vector< std::pair< dataRepository::Group const *, localIndex > > searchedGroups;
+  };
+
+  /**
+   * @brief Get the objects holding the sets a field specification is applied to, resolving them if needed.
+   * @param fs the field specification
+   * @param meshLevel the mesh level to look for the objects in
+   * @return the objects
+   */
+  std::vector< dataRepository::Group * > const & getTargets( FieldSpecificationBase const & fs,
+                                                             MeshLevel & meshLevel ) const;
+
+  /**
+   * @brief Add the objects holding sets found at or under a group to the targets.
+   * @param target the group
+   * @param targets the targets to add the objects to
+   */
+  static void collectTargets( dataRepository::Group * const target, Targets & targets );
+
+  /// The objects each field specification was last applied to
+  mutable std::unordered_map< FieldSpecificationBase const *, Targets > m_targets;
+
+  /**
+   * @brief The source fluxes applied to an element subregion, flattened into a table of owned elements.
+   */
+  struct SourceFluxTable
+  {
+    /// The sources
+    std::vector< FieldSpecificationBase const * > sources;
+    /// The offsets of the elements of each source in hostElements
+    std::vector< localIndex > offsets;
+    /// The host copy of the owned target sets the table was built from, to check it is up to date
+    std::vector< localIndex > hostElements;
+    /// The element of each entry
+    array1d< localIndex > elements;
+    /// The source of each entry
+    array1d< localIndex > sourceIndices;
+    /// The component of each source
+    array1d< integer > components;
+    /// The value of each source over the time step
+    array1d< real64 > values;
+  };
+
+  /// The source flux tables of the element subregions
+  mutable std::unordered_map< dataRepository::Group const *, SourceFluxTable > m_sourceFluxTables;
 };
 
 template< typename POLICY, typename LAMBDA >
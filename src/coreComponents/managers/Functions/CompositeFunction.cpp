@@ -105,6 +105,7 @@ void CompositeFunction::Evaluate( dataRepository::Group const * const group,
   {
     real64_array tmp( result.size());
     m_subFunctions[ii]->Evaluate( group, time, set, tmp );
+    tmp.move( LvArray::MemorySpace::CPU, false );
     subFunctionResults.emplace_back( std::move( tmp ));
   }
 
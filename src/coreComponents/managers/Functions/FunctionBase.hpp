@@ -80,6 +80,7 @@ public:
    * @param time current time
    * @param set the subset of nodes to apply the function to
    * @param result an array to hold the results of the function
+   * @note The results may be computed on the device, they must be moved to the host before being read there.
    */
   virtual void Evaluate( dataRepository::Group const * const group,
                          real64 const time,
@@ -135,6 +136,7 @@ protected:
    * @param[in] time current time
    * @param[in] set the subset of nodes to apply the function to
    * @param[out] result the results
+   * @note The points are evaluated in parallel on the host, LEAF::Evaluate( input ) must be thread safe
    */
   template< typename LEAF >
   void EvaluateT( dataRepository::Group const * const group,
@@ -190,7 +192,7 @@ void FunctionBase::EvaluateT( dataRepository::Group const * const group,
   GEOSX_ERROR_IF( result.size() != set.size(), "To apply a function to a set, the size of the result and set must match" );
 
 
-  forAll< serialPolicy >( set.size(), [&, set]( localIndex const i )
+  forAll< parallelHostPolicy >( set.size(), [&, set]( localIndex const i )
   {
     localIndex const index = set[ i ];
     double input[4];
@@ -22,6 +22,8 @@
 #include "FunctionBase.hpp"
 #include "common/DataTypes.hpp"
 
+#include <algorithm>
+
 namespace geosx
 {
 
@@ -59,4 +61,98 @@ void FunctionManager::ExpandObjectCatalogs()
   }
 }
 
+
+void FunctionManager::groupTables()
+{
+  m_tableGroups.clear();
+  m_tableColumns.clear();
+
+  // Find the tables sharing the coordinates of the first table of each group
+  std::vector< std::vector< TableFunction const * > > groups;
+  forSubGroups< TableFunction >( [&]( TableFunction const & table )
+  {
+    array1d< real64_array > const & coordinates = table.getCoordinates();
+    if( coordinates.size() != 1 || coordinates[0].size() == 0 )
+    {
+      return;
+    }
+
+    auto const sharesAxis = [&]( std::vector< TableFunction const * > const & group )
+    {
+      TableFunction const & first = *group.front();
+      real64_array const & axis = first.getCoordinates()[0];
+      return first.getInterpolationMethod() == table.getInterpolationMethod() &&
+             axis.size() == coordinates[0].size() &&
+             std::equal( axis.data(), axis.data() + axis.size(), coordinates[0].data() );
+    };
+
+    auto const group = std::find_if( groups.begin(), groups.end(), sharesAxis );
+    if( group == groups.end() )
+    {
+      groups.push_back( { &table } );
+    }
+    else
+    {
+      group->push_back( &table );
+    }
+  } );
+
+  // A single table gains nothing from the grouping
+  for( std::vector< TableFunction const * > const & group : groups )
+  {
+    if( group.size() < 2 )
+    {
+      continue;
+    }
+
+    localIndex const groupIndex = LvArray::integerConversion< localIndex >( m_tableGroups.size() );
+    localIndex const numCoordinates = group.front()->getCoordinates()[0].size();
+    localIndex const numColumns = LvArray::integerConversion< localIndex >( group.size() );
+
+    m_tableGroups.emplace_back();
+    TableGroup & tableGroup = m_tableGroups.back();
+    tableGroup.axis = group.front()->createKernelWrapper();
+    tableGroup.values.resize( numCoordinates, numColumns );
+    for( localIndex j = 0; j < numColumns; ++j )
+    {
+      array1d< real64 > const & values = group[j]->getValues();
+      for( localIndex i = 0; i < numCoordinates; ++i )
+      {
+        tableGroup.values[i][j] = values[i];
+      }
+      m_tableColumns[ group[j]->getName() ] = { groupIndex, j };
+    }
+  }
+}
+
+
+void FunctionManager::evaluate( std::vector< string > const & names,
+                                real64 const input,
+                                std::vector< real64 > & values ) const
+{
+  values.resize( names.size() );
+
+  // The values of each group are computed once, when a first table of the group is evaluated
+  std::vector< std::vector< real64 > > groupValues( m_tableGroups.size() );
+  for( std::size_t k = 0; k < names.size(); ++k )
+  {
+    auto const column = m_tableColumns.find( names[k] );
+    if( column == m_tableColumns.end() )
+    {
+      values[k] = getGroupReference< FunctionBase >( names[k] ).Evaluate( &input );
+      continue;
+    }
+
+    localIndex const groupIndex = column->second.first;
+    std::vector< real64 > & result = groupValues[ groupIndex ];
+    if( result.empty() )
+    {
+      TableGroup const & tableGroup = m_tableGroups[ groupIndex ];
+      result.resize( tableGroup.values.size( 1 ) );
+      tableGroup.axis.computeColumns( input, tableGroup.values.toViewConst(), result.data() );
+    }
+    values[k] = result[ column->second.second ];
+  }
+}
+
 } /* namespace ANST */
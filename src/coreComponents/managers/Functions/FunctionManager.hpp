@@ -21,6 +21,9 @@
 
 #include "dataRepository/Group.hpp"
 #include "FunctionBase.hpp"
+#include "TableFunction.hpp"
+
+#include <unordered_map>
 
 namespace geosx
 {
@@ -71,6 +74,45 @@ public:
    */
   virtual void ExpandObjectCatalogs() override;
 
+  /**
+   * @brief Group the 1D tables sharing the same coordinates and interpolation into multi-column tables.
+   * @note The tables are grouped after the input, the ones modified later must be grouped again.
+   */
+  void groupTables();
+
+  /**
+   * @brief Evaluate several functions of the same scalar input, e.g. the time.
+   * @param names the names of the functions
+   * @param input the input
+   * @param values the value of each function
+   *
+   * The grouped tables among the functions are evaluated together, with a single search of their shared axis.
+   */
+  void evaluate( std::vector< string > const & names,
+                 real64 const input,
+                 std::vector< real64 > & values ) const;
+
+protected:
+
+  virtual void PostProcessInput() override { groupTables(); }
+
+private:
+
+  /// 1D tables sharing the same coordinates and interpolation
+  struct TableGroup
+  {
+    /// The view of the first table of the group, which locates the inputs on the shared axis
+    TableFunction::KernelWrapper axis;
+
+    /// The values of the tables, one row per coordinate and one column per table
+    array2d< real64 > values;
+  };
+
+  /// The groups of tables
+  std::vector< TableGroup > m_tableGroups;
+
+  /// The group and column of the grouped tables, indexed by their name
+  std::unordered_map< string, std::pair< localIndex, localIndex > > m_tableColumns;
 };
 
 } /* namespace geosx */
@@ -19,6 +19,8 @@
 #include "SymbolicFunction.hpp"
 #include "common/DataTypes.hpp"
 
+#include <map>
+
 namespace geosx
 {
 
@@ -33,14 +35,60 @@ std::string const expression = "expression";
 
 using namespace dataRepository;
 
+#ifdef GEOSX_USE_MATHPRESSO
+namespace
+{
+
+/**
+ * @brief Get a compiled expression, compiling it only the first time it is requested.
+ * @param variableNames the variables of the expression, in the order of the evaluation inputs
+ * @param expression the expression
+ * @return the compiled expression
+ */
+std::shared_ptr< mathpresso::Expression const > getCompiledExpression( arrayView1d< string const > const & variableNames,
+                                                                       string const & expression )
+{
+  static std::map< string, std::shared_ptr< mathpresso::Expression const > > cache;
+
+  // The variables are part of the key, as their order gives the layout of the inputs
+  string key;
+  for( localIndex ii=0; ii<variableNames.size(); ++ii )
+  {
+    key += variableNames[ii] + ',';
+  }
+  key += ';' + expression;
+
+  std::shared_ptr< mathpresso::Expression const > & compiled = cache[ key ];
+  if( !compiled )
+  {
+    // Register variables
+    mathpresso::Context parserContext;
+    for( localIndex ii=0; ii<variableNames.size(); ++ii )
+    {
+      parserContext.addVariable( variableNames[ii].c_str(), static_cast< int >(ii * sizeof(double)));
+    }
+
+    // Add built in constants/functions (PI, E, sin, cos, ceil, exp, etc.),
+    // compile
+    parserContext.addBuiltIns();
+    std::shared_ptr< mathpresso::Expression > parserExpression = std::make_shared< mathpresso::Expression >();
+    mathpresso::Error err = parserExpression->compile( parserContext, expression.c_str(), mathpresso::kNoOptions );
+    GEOSX_ERROR_IF( err != mathpresso::kErrorOk, "JIT Compiler Error" );
+    compiled = parserExpression;
+  }
+  return compiled;
+}
+
+}
+#endif
+
 
 
 SymbolicFunction::SymbolicFunction( const std::string & name,
                                     Group * const parent ):
   FunctionBase( name, parent )
 #ifdef GEOSX_USE_MATHPRESSO
-  , parserContext(),
-  parserExpression()
+  , m_parserExpression()
 #endif
 {
   registerWrapper( keys::variableNames, &m_variableNames )->
@@ -61,17 +109,7 @@ SymbolicFunction::~SymbolicFunction()
 void SymbolicFunction::InitializeFunction()
 {
 #ifdef GEOSX_USE_MATHPRESSO
-  // Register variables
-  for( localIndex ii=0; ii<m_variableNames.size(); ++ii )
-  {
-    parserContext.addVariable( m_variableNames[ii].c_str(), static_cast< int >(ii * sizeof(double)));
-  }
-
-  // Add built in constants/functions (PI, E, sin, cos, ceil, exp, etc.),
-  // compile
-  parserContext.addBuiltIns();
-  mathpresso::Error err = parserExpression.compile( parserContext, m_expression.c_str(), mathpresso::kNoOptions );
-  GEOSX_ERROR_IF( err != mathpresso::kErrorOk, "JIT Compiler Error" );
+  m_parserExpression = getCompiledExpression( m_variableNames, m_expression );
 #else
   GEOSX_ERROR( "GEOSX was not built with mathpresso!" );
 #endif
@@ -23,6 +23,8 @@
 
 #ifdef GEOSX_USE_MATHPRESSO
 #include <mathpresso/mathpresso.h>
+
+#include <memory>
 #endif
 
 namespace geosx
@@ -32,6 +34,9 @@ namespace geosx
  * @class SymbolicFunction
  *
  * An interface for an arbitrary symbolic function
+ *
+ * The expression is compiled once for all the functions with the same expression and variables, and the
+ * compiled expression is evaluated on the points of a set in parallel.
  */
 class SymbolicFunction : public FunctionBase
 {
@@ -79,7 +84,7 @@ public:
   inline real64 Evaluate( real64 const * const input ) const override final
   {
 #ifdef GEOSX_USE_MATHPRESSO
-    return parserExpression.evaluate( reinterpret_cast< void * >( const_cast< real64 * >(input) ) );
+    return m_parserExpression->evaluate( reinterpret_cast< void * >( const_cast< real64 * >(input) ) );
 #else
     GEOSX_ERROR( "GEOSX was not built with mathpresso!" );
     return 0;
@@ -102,10 +107,9 @@ public:
 
 
 private:
-  // Symbolic math driver objects
+  // Symbolic math driver object, shared with the functions of the same expression and variables
 #ifdef GEOSX_USE_MATHPRESSO
-  mathpresso::Context parserContext;
-  mathpresso::Expression parserExpression;
+  std::shared_ptr< mathpresso::Expression const > m_parserExpression;
 #endif
 
 
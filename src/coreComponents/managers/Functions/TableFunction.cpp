@@ -17,6 +17,7 @@
  */
 
 #include "TableFunction.hpp"
+#include "common/DataLayouts.hpp"
 #include "common/DataTypes.hpp"
 #include <algorithm>
 
@@ -38,6 +39,40 @@ std::string const valueType = "valueType";
 
 using namespace dataRepository;
 
+namespace
+{
+
+/**
+ * @brief Gather the components of a vector input of the points of a set on the device.
+ * @tparam USD the unit stride dimension of the input
+ * @param var the input
+ * @param set the points
+ * @param first the column of the first component in @p input
+ * @param input the gathered inputs, one row per point
+ * @return the number of components
+ */
+template< int USD >
+localIndex gatherInput( arrayView2d< real64 const, USD > const & var,
+                        SortedArrayView< localIndex const > const & set,
+                        localIndex const first,
+                        arrayView2d< real64 > const & input )
+{
+  localIndex const numComponents = var.size( 1 );
+  GEOSX_ERROR_IF( first + numComponents > TableFunction::maxDimensions,
+                  "Function input size exceeds " << TableFunction::maxDimensions );
+
+  forAll< parallelDevicePolicy<> >( input.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+  {
+    for( localIndex c = 0; c < numComponents; ++c )
+    {
+      input[i][first + c] = var[ set[i] ][c];
+    }
+  } );
+  return numComponents;
+}
+
+}
+
 
 
 TableFunction::TableFunction( const std::string & name,
@@ -52,8 +87,8 @@ TableFunction::TableFunction( const std::string & name,
   m_dimensions( 0 ),
   m_size(),
   m_indexIncrement(),
-  m_corners(),
-  m_numCorners( 0 )
+  m_packedCoordinates(),
+  m_kernelWrapper()
 {
   registerWrapper( keys::tableCoordinates, &m_tableCoordinates1D )->
     setInputFlag( InputFlags::OPTIONAL )->
@@ -154,6 +189,7 @@ void TableFunction::reInitializeFunction()
 {
   m_dimensions = LvArray::integerConversion< localIndex >( m_coordinates.size());
   m_size.resize( m_dimensions );
+  GEOSX_ERROR_IF( m_dimensions > maxDimensions, "Table functions have at most " << maxDimensions << " dimensions" );
 
   // Setup index increment (assume data is in Fortran array order)
   localIndex increment = 1;
@@ -168,138 +204,100 @@ void TableFunction::reInitializeFunction()
   // Error checking
   GEOSX_ERROR_IF( increment != m_values.size(), "Table dimensions do not match!" );
 
-  // Build a quick map to help with linear interpolation
-  m_numCorners = static_cast< localIndex >(pow( 2, m_dimensions ));
-  for( localIndex ii=0; ii<m_numCorners; ++ii )
+  // Build the view of the table used for the evaluations
+  m_packedCoordinates.clear();
+  m_kernelWrapper.m_interpolationMethod = m_interpolationMethod;
+  m_kernelWrapper.m_numDimensions = m_dimensions;
+  for( localIndex ii=0; ii<m_dimensions; ++ii )
   {
-    for( localIndex jj=0; jj<m_dimensions; ++jj )
+    real64_array const & coords = m_coordinates[ii];
+    localIndex const size = m_size[ii];
+
+    m_kernelWrapper.m_size[ii] = size;
+    m_kernelWrapper.m_stride[ii] = m_indexIncrement[ii];
+    m_kernelWrapper.m_axisOffset[ii] = m_packedCoordinates.size();
+
+    // The axis is uniform if all its intervals match the mean spacing up to round-off
+    bool isUniform = size > 1 && coords[size - 1] > coords[0];
+    real64 const spacing = isUniform ? ( coords[size - 1] - coords[0] ) / ( size - 1 ) : 0.0;
+    for( localIndex jj=1; jj<size && isUniform; ++jj )
     {
-      m_corners[jj][ii] = int(ii / pow( 2, jj )) % 2;
+      isUniform = std::fabs( coords[jj] - coords[jj - 1] - spacing ) <= 1e-10 * spacing;
+    }
+    m_kernelWrapper.m_axisInvSpacing[ii] = isUniform ? 1.0 / spacing : 0.0;
+
+    for( localIndex jj=0; jj<size; ++jj )
+    {
+      m_packedCoordinates.emplace_back( coords[jj] );
     }
   }
+  m_kernelWrapper.m_coordinates = m_packedCoordinates.toViewConst();
+  m_kernelWrapper.m_values = m_values.toViewConst();
 }
 
-
-real64 TableFunction::Evaluate( real64 const * const input ) const
+void TableFunction::Evaluate( dataRepository::Group const * const group,
+                              real64 const time,
+                              SortedArrayView< localIndex const > const & set,
+                              real64_array & result ) const
 {
-  real64 result = 0.0;
-
-  // Linear interpolation
-  if( m_interpolationMethod == InterpolationType::Linear )
+  arrayView1d< string const > const & inputVarNames = this->getReference< string_array >( dataRepository::keys::inputVarNames );
+  localIndex const numVars = LvArray::integerConversion< localIndex >( inputVarNames.size() );
+  localIndex const numPoints = LvArray::integerConversion< localIndex >( set.size() );
+
+  // Make sure the result / set size match
+  GEOSX_ERROR_IF( result.size() != numPoints, "To apply a function to a set, the size of the result and set must match" );
+
+  // Gather the inputs of the points of the set on the device, one column per table dimension
+  array2d< real64 > input( numPoints, maxDimensions );
+  arrayView2d< real64 > const & inputView = input.toView();
+  localIndex numInputs = 0;
+  for( localIndex varIndex=0; varIndex<numVars; ++varIndex )
   {
-    localIndex bounds[m_maxDimensions][2];
-    real64 weights[m_maxDimensions][2];
+    string const & varName = inputVarNames[varIndex];
+    localIndex const first = numInputs;
 
-    // Determine position, weights
-    for( localIndex ii=0; ii<m_dimensions; ++ii )
+    if( varName == "time" )
     {
-      if( input[ii] <= m_coordinates[ii][0] )
-      {
-        // Coordinate is to the left of this axis
-        bounds[ii][0] = 0;
-        bounds[ii][1] = 0;
-        weights[ii][0] = 0;
-        weights[ii][1] = 1;
-      }
-      else if( input[ii] >= m_coordinates[ii][m_size[ii] - 1] )
-      {
-        // Coordinate is to the right of this axis
-        bounds[ii][0] = m_size[ii] - 1;
-        bounds[ii][1] = bounds[ii][0];
-        weights[ii][0] = 1;
-        weights[ii][1] = 0;
-      }
-      else
+      GEOSX_ERROR_IF( first >= maxDimensions, "Function input size exceeds " << maxDimensions );
+      forAll< parallelDevicePolicy<> >( numPoints, [=] GEOSX_HOST_DEVICE ( localIndex const i )
       {
-        // Find the coordinate index
-        ///TODO make this fast
-        // Note: lower_bound uses a binary search...  If we assume coordinates are
-        // evenly spaced, we can speed things up considerably
-        auto lower = std::lower_bound( m_coordinates[ii].begin(), m_coordinates[ii].end(), input[ii] );
-        bounds[ii][1] = LvArray::integerConversion< localIndex >( std::distance( m_coordinates[ii].begin(), lower ));
-        bounds[ii][0] = bounds[ii][1] - 1;
-
-        real64 dx = m_coordinates[ii][bounds[ii][1]] - m_coordinates[ii][bounds[ii][0]];
-        weights[ii][0] = 1.0 - (input[ii] - m_coordinates[ii][bounds[ii][0]]) / dx;
-        weights[ii][1] = 1.0 - weights[ii][0];
-      }
+        inputView[i][first] = time;
+      } );
+      ++numInputs;
     }
-
-    // Calculate the result
-    for( localIndex ii=0; ii<m_numCorners; ++ii )
+    else if( Wrapper< array1d< real64 > > const * const wrapper = group->getWrapper< array1d< real64 > >( varName ) )
     {
-      // Find array index
-      localIndex tableIndex = 0;
-      for( localIndex jj=0; jj<m_dimensions; ++jj )
+      GEOSX_ERROR_IF( first >= maxDimensions, "Function input size exceeds " << maxDimensions );
+      arrayView1d< real64 const > const & var = wrapper->reference().toViewConst();
+      forAll< parallelDevicePolicy<> >( numPoints, [=] GEOSX_HOST_DEVICE ( localIndex const i )
       {
-        tableIndex += bounds[jj][m_corners[jj][ii]] * m_indexIncrement[jj];
-      }
-
-      // Determine weighted value
-      real64 cornerValue = m_values[tableIndex];
-      for( localIndex jj=0; jj<m_dimensions; ++jj )
-      {
-        cornerValue *= weights[jj][m_corners[jj][ii]];
-      }
-      result += cornerValue;
+        inputView[i][first] = var[ set[i] ];
+      } );
+      ++numInputs;
     }
-  }
-  // Nearest, Upper, Lower interpolation methods
-  else
-  {
-    // Determine the index to the nearest table entry
-    localIndex tableIndex = 0;
-    for( localIndex ii=0; ii<m_dimensions; ++ii )
+    else if( Wrapper< array2d< real64 > > const * const wrapper = group->getWrapper< array2d< real64 > >( varName ) )
     {
-      // Determine the index along each table axis
-      localIndex subIndex = 0;
-
-      if( input[ii] <= m_coordinates[ii][0] )
-      {
-        // Coordinate is to the left of the table axis
-        subIndex = 0;
-      }
-      else if( input[ii] >= m_coordinates[ii][m_size[ii] - 1] )
-      {
-        // Coordinate is to the right of the table axis
-        subIndex = m_size[ii] - 1;
-      }
-      else
-      {
-        // Coordinate is within the table axis
-        // Note: std::distance will return the index of the upper table vertex
-        auto lower = std::lower_bound( m_coordinates[ii].begin(), m_coordinates[ii].end(), input[ii] );
-        subIndex = LvArray::integerConversion< localIndex >( std::distance( m_coordinates[ii].begin(), lower ));
-
-        // Interpolation types:
-        //   - Nearest returns the value of the closest table vertex
-        //   - Upper returns the value of the next table vertex
-        //   - Lower returns the value of the previous table vertex
-        if( m_interpolationMethod == InterpolationType::Nearest )
-        {
-          if((input[ii] - m_coordinates[ii][subIndex - 1]) <= (m_coordinates[ii][subIndex] - input[ii]))
-          {
-            --subIndex;
-          }
-        }
-        else if( m_interpolationMethod == InterpolationType::Lower )
-        {
-          if( subIndex > 0 )
-          {
-            --subIndex;
-          }
-        }
-      }
-
-      // Increment the global table index
-      tableIndex += subIndex * m_indexIncrement[ii];
+      numInputs += gatherInput( wrapper->reference().toViewConst(), set, first, inputView );
+    }
+    else if( Wrapper< array2d< real64, nodes::REFERENCE_POSITION_PERM > > const * const wrapper =
+               group->getWrapper< array2d< real64, nodes::REFERENCE_POSITION_PERM > >( varName ) )
+    {
+      numInputs += gatherInput( wrapper->reference().toViewConst(), set, first, inputView );
+    }
+    else
+    {
+      GEOSX_ERROR( "Table function input " << varName << " must be the time or a real64 array of " << group->getName() );
     }
-
-    // Retrieve the nearest value
-    result = m_values[tableIndex];
   }
 
-  return result;
+  GEOSX_ERROR_IF_NE_MSG( numInputs, m_dimensions, "The inputs of table function " << getName() << " do not match its dimensions" );
+
+  KernelWrapper const table = m_kernelWrapper;
+  arrayView1d< real64 > const & resultView = result.toView();
+  forAll< parallelDevicePolicy<> >( numPoints, [=] GEOSX_HOST_DEVICE ( localIndex const i )
+  {
+    resultView[i] = table.compute( &inputView[i][0] );
+  } );
 }
 
 REGISTER_CATALOG_ENTRY( FunctionBase, TableFunction, std::string const &, Group * const )
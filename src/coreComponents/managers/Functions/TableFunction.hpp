@@ -33,6 +33,101 @@ namespace geosx
 class TableFunction : public FunctionBase
 {
 public:
+
+  /// Maximum number of table dimensions
+  static localIndex constexpr maxDimensions = 4;
+
+  /// Enumerator of available interpolation types
+  enum class InterpolationType : integer
+  {
+    Linear,
+    Nearest,
+    Upper,
+    Lower
+  };
+
+  /**
+   * @class KernelWrapper
+   *
+   * A view of the table that can be evaluated in device kernels. The strides of the axes in the table values
+   * are precomputed, and the position of an input on a uniform axis is found from its spacing instead of
+   * with a binary search.
+   */
+  class KernelWrapper
+  {
+public:
+
+    /// Default constructor, the table must be assigned before being evaluated
+    KernelWrapper() = default;
+
+    /**
+     * @brief Evaluate the table.
+     * @param input the coordinates of the point, one per table dimension
+     * @return the interpolated value
+     */
+    GEOSX_HOST_DEVICE
+    real64 compute( real64 const * const input ) const;
+
+    /**
+     * @brief Evaluate 1D tables sharing the axis and interpolation of this one, with a single search of the axis.
+     * @param input the coordinate of the point
+     * @param values the values of the tables, one row per coordinate of the axis and one column per table
+     * @param result the interpolated value of each table
+     */
+    GEOSX_HOST_DEVICE
+    void computeColumns( real64 const input,
+                         arrayView2d< real64 const > const & values,
+                         real64 * const result ) const;
+
+private:
+
+    /// The table fills the wrapper in reInitializeFunction
+    friend class TableFunction;
+
+    /**
+     * @brief Find the first coordinate of an axis larger or equal to an input within the axis.
+     * @param dim the axis
+     * @param x the input, strictly between the first and last coordinates of the axis
+     * @return the index of the coordinate
+     */
+    GEOSX_HOST_DEVICE
+    localIndex upperIndex( localIndex const dim, real64 const x ) const;
+
+    /**
+     * @brief Get a coordinate of an axis.
+     * @param dim the axis
+     * @param i the index of the coordinate
+     * @return the coordinate
+     */
+    GEOSX_HOST_DEVICE
+    real64 coordinate( localIndex const dim, localIndex const i ) const
+    { return m_coordinates[ m_axisOffset[dim] + i ]; }
+
+    /// Table interpolation method
+    InterpolationType m_interpolationMethod = InterpolationType::Linear;
+
+    /// Number of active table dimensions
+    localIndex m_numDimensions = 0;
+
+    /// Number of coordinates of each axis
+    localIndex m_size[maxDimensions] = {};
+
+    /// Stride of each axis in the table values
+    localIndex m_stride[maxDimensions] = {};
+
+    /// Offset of each axis in the coordinates
+    localIndex m_axisOffset[maxDimensions] = {};
+
+    /// Inverse of the spacing of each uniform axis, 0 for the other axes
+    real64 m_axisInvSpacing[maxDimensions] = {};
+
+    /// Coordinates of all the axes, one axis after the other
+    arrayView1d< real64 const > m_coordinates;
+
+    /// Table values (in fortran order)
+    arrayView1d< real64 const > m_values;
+  };
+
   /**
    * @brief The constructor
    * @param[in] name the name of this object manager
@@ -83,17 +178,23 @@ public:
   virtual void Evaluate( dataRepository::Group const * const group,
                          real64 const time,
                          SortedArrayView< localIndex const > const & set,
-                         real64_array & result ) const override final
-  {
-    FunctionBase::EvaluateT< TableFunction >( group, time, set, result );
-  }
+                         real64_array & result ) const override final;
 
   /**
    * @brief Method to evaluate a function
    * @param input a scalar input
    * @return the function result
    */
-  virtual real64 Evaluate( real64 const * const input ) const override final;
+  virtual real64 Evaluate( real64 const * const input ) const override final
+  {
+    return m_kernelWrapper.compute( input );
+  }
+
+  /**
+   * @brief Create a view of the table that can be evaluated in device kernels
+   * @return the kernel wrapper, valid until the table is modified
+   */
+  KernelWrapper createKernelWrapper() const { return m_kernelWrapper; }
 
   /**
    * @brief Get the table axes definitions
@@ -117,20 +218,21 @@ public:
    */
   array1d< real64 > & getValues()       { return m_values; }
 
-  /// Enumerator of available interpolation types
-  enum class InterpolationType : integer
-  {
-    Linear,
-    Nearest,
-    Upper,
-    Lower
-  };
+  /**
+   * @brief Get the interpolation method
+   * @return The interpolation method
+   */
+  InterpolationType getInterpolationMethod() const { return m_interpolationMethod; }
 
   /**
    * @brief Set the interpolation method
    * @param method The interpolation method
    */
-  void setInterpolationMethod( InterpolationType const method ) { m_interpolationMethod = method; }
+  void setInterpolationMethod( InterpolationType const method )
+  {
+    m_interpolationMethod = method;
+    m_kernelWrapper.m_interpolationMethod = method;
+  }
 
   /**
    * @brief Set the table coordinates
@@ -163,9 +265,6 @@ private:
   /// Table values (in fortran order)
   real64_array m_values;
 
-  /// Maximum number of table dimensions
-  static localIndex constexpr m_maxDimensions = 4;
-
   /// Number of active table dimensions
   localIndex m_dimensions;
 
@@ -175,16 +274,230 @@ private:
   /// Array used to locate values within ND tables
   localIndex_array m_indexIncrement;
 
-  /**
-   * @brief The corners of the box that surround the value in N dimensions
-   * m_corners should be of size m_maxDimensions x (2^m_maxDimensions)
-   */
-  localIndex m_corners[m_maxDimensions][16];
+  /// Coordinates of all the axes, one axis after the other, read by the kernel wrapper
+  real64_array m_packedCoordinates;
 
-  /// The number of active table corners
-  localIndex m_numCorners;
+  /// The view of the table used for the evaluations, rebuilt by reInitializeFunction
+  KernelWrapper m_kernelWrapper;
 };
 
+GEOSX_HOST_DEVICE
+inline
+localIndex TableFunction::KernelWrapper::upperIndex( localIndex const dim, real64 const x ) const
+{
+  localIndex const size = m_size[dim];
+
+  if( m_axisInvSpacing[dim] > 0.0 )
+  {
+    // On a uniform axis the spacing gives the index, only corrected for the rounding of the coordinates
+    localIndex index = static_cast< localIndex >( ( x - coordinate( dim, 0 ) ) * m_axisInvSpacing[dim] ) + 1;
+    index = ( index < 1 ) ? 1 : ( ( index > size - 1 ) ? size - 1 : index );
+    while( index > 1 && coordinate( dim, index - 1 ) >= x )
+    {
+      --index;
+    }
+    while( coordinate( dim, index ) < x )
+    {
+      ++index;
+    }
+    return index;
+  }
+
+  // Binary search, keeping coordinate( lower ) < x <= coordinate( upper )
+  localIndex lower = 0;
+  localIndex upper = size - 1;
+  while( upper - lower > 1 )
+  {
+    localIndex const middle = ( lower + upper ) / 2;
+    if( coordinate( dim, middle ) < x )
+    {
+      lower = middle;
+    }
+    else
+    {
+      upper = middle;
+    }
+  }
+  return upper;
+}
+
+GEOSX_HOST_DEVICE
+inline
+real64 TableFunction::KernelWrapper::compute( real64 const * const input ) const
+{
+  real64 result = 0.0;
+
+  // Linear interpolation
+  if( m_interpolationMethod == InterpolationType::Linear )
+  {
+    localIndex bounds[maxDimensions][2];
+    real64 weights[maxDimensions][2];
+
+    // Determine position, weights
+    for( localIndex ii=0; ii<m_numDimensions; ++ii )
+    {
+      if( input[ii] <= coordinate( ii, 0 ) )
+      {
+        // Coordinate is to the left of this axis
+        bounds[ii][0] = 0;
+        bounds[ii][1] = 0;
+        weights[ii][0] = 0;
+        weights[ii][1] = 1;
+      }
+      else if( input[ii] >= coordinate( ii, m_size[ii] - 1 ) )
+      {
+        // Coordinate is to the right of this axis
+        bounds[ii][0] = m_size[ii] - 1;
+        bounds[ii][1] = bounds[ii][0];
+        weights[ii][0] = 1;
+        weights[ii][1] = 0;
+      }
+      else
+      {
+        // Find the coordinate index
+        bounds[ii][1] = upperIndex( ii, input[ii] );
+        bounds[ii][0] = bounds[ii][1] - 1;
+
+        real64 const dx = coordinate( ii, bounds[ii][1] ) - coordinate( ii, bounds[ii][0] );
+        weights[ii][0] = 1.0 - (input[ii] - coordinate( ii, bounds[ii][0] )) / dx;
+        weights[ii][1] = 1.0 - weights[ii][0];
+      }
+    }
+
+    // Calculate the result, the bits of a corner index selecting its bound along each axis
+    localIndex const numCorners = localIndex( 1 ) << m_numDimensions;
+    for( localIndex ii=0; ii<numCorners; ++ii )
+    {
+      // Find array index
+      localIndex tableIndex = 0;
+      real64 cornerWeight = 1.0;
+      for( localIndex jj=0; jj<m_numDimensions; ++jj )
+      {
+        localIndex const corner = ( ii >> jj ) & 1;
+        tableIndex += bounds[jj][corner] * m_stride[jj];
+        cornerWeight *= weights[jj][corner];
+      }
+
+      // Determine weighted value
+      result += m_values[tableIndex] * cornerWeight;
+    }
+  }
+  // Nearest, Upper, Lower interpolation methods
+  else
+  {
+    // Determine the index to the nearest table entry
+    localIndex tableIndex = 0;
+    for( localIndex ii=0; ii<m_numDimensions; ++ii )
+    {
+      // Determine the index along each table axis
+      localIndex subIndex = 0;
+
+      if( input[ii] <= coordinate( ii, 0 ) )
+      {
+        // Coordinate is to the left of the table axis
+        subIndex = 0;
+      }
+      else if( input[ii] >= coordinate( ii, m_size[ii] - 1 ) )
+      {
+        // Coordinate is to the right of the table axis
+        subIndex = m_size[ii] - 1;
+      }
+      else
+      {
+        // Coordinate is within the table axis
+        // Note: upperIndex returns the index of the upper table vertex
+        subIndex = upperIndex( ii, input[ii] );
+
+        // Interpolation types:
+        //   - Nearest returns the value of the closest table vertex
+        //   - Upper returns the value of the next table vertex
+        //   - Lower returns the value of the previous table vertex
+        if( m_interpolationMethod == InterpolationType::Nearest )
+        {
+          if((input[ii] - coordinate( ii, subIndex - 1 )) <= (coordinate( ii, subIndex ) - input[ii]))
+          {
+            --subIndex;
+          }
+        }
+        else if( m_interpolationMethod == InterpolationType::Lower )
+        {
+          if( subIndex > 0 )
+          {
+            --subIndex;
+          }
+        }
+      }
+
+      // Increment the global table index
+      tableIndex += subIndex * m_stride[ii];
+    }
+
+    // Retrieve the nearest value
+    result = m_values[tableIndex];
+  }
+
+  return result;
+}
+
+GEOSX_HOST_DEVICE
+inline
+void TableFunction::KernelWrapper::computeColumns( real64 const input,
+                                                   arrayView2d< real64 const > const & values,
+                                                   real64 * const result ) const
+{
+  localIndex const size = m_size[0];
+  localIndex const numColumns = values.size( 1 );
+
+  // The bounds and weights are those of compute, so that both give the same values
+  localIndex lower = 0;
+  localIndex upper = 0;
+  real64 lowerWeight = 0.0;
+  if( input <= coordinate( 0, 0 ) )
+  {
+    // Coordinate is to the left of the axis
+  }
+  else if( input >= coordinate( 0, size - 1 ) )
+  {
+    // Coordinate is to the right of the axis
+    lower = size - 1;
+    upper = lower;
+    lowerWeight = 1.0;
+  }
+  else
+  {
+    upper = upperIndex( 0, input );
+    lower = upper - 1;
+    real64 const dx = coordinate( 0, upper ) - coordinate( 0, lower );
+    lowerWeight = 1.0 - (input - coordinate( 0, lower )) / dx;
+
+    if( m_interpolationMethod == InterpolationType::Nearest )
+    {
+      upper = ((input - coordinate( 0, lower )) <= (coordinate( 0, upper ) - input)) ? lower : upper;
+    }
+    else if( m_interpolationMethod == InterpolationType::Lower )
+    {
+      upper = lower;
+    }
+  }
+
+  if( m_interpolationMethod == InterpolationType::Linear )
+  {
+    real64 const upperWeight = 1.0 - lowerWeight;
+    for( localIndex j = 0; j < numColumns; ++j )
+    {
+      result[j] = values[lower][j] * lowerWeight + values[upper][j] * upperWeight;
+    }
+  }
+  else
+  {
+    // Nearest, Upper, Lower interpolation methods, upper holds the selected coordinate
+    for( localIndex j = 0; j < numColumns; ++j )
+    {
+      result[j] = values[upper][j];
+    }
+  }
+}
+
 ENUM_STRINGS( TableFunction::InterpolationType, "linear", "nearest", "upper", "lower" )
 
 
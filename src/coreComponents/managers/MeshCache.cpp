@@ -0,0 +1,506 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MeshCache.cpp
+ */
+
+#include "MeshCache.hpp"
+
+#include "common/Path.hpp"
+#include "common/TimingMacros.hpp"
+#include "managers/DomainPartition.hpp"
+#include "mesh/AggregateElementSubRegion.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+#include "mesh/MeshBody.hpp"
+#include "mesh/SurfaceElementRegion.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+#include "mpiCommunications/NeighborCommunicator.hpp"
+#include "mpiCommunications/SpatialPartition.hpp"
+
+// TPL includes
+#include <conduit_relay.hpp>
+
+// System includes
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace
+{
+
+/// The kinds of subregions, telling how they are recreated
+/// @{
+constexpr char const cellSubRegion[] = "cell";
+constexpr char const aggregateSubRegion[] = "aggregate";
+constexpr char const regionSubRegion[] = "region";
+/// @}
+
+/**
+ * @brief Compute the 64-bit FNV-1a hash of a string.
+ * @param key the string
+ * @return the hash, as hexadecimal digits
+ */
+string hashKey( string const & key )
+{
+  std::uint64_t hash = 14695981039346656037ULL;
+  for( char const c : key )
+  {
+    hash = ( hash ^ static_cast< unsigned char >( c ) ) * 1099511628211ULL;
+  }
+  std::ostringstream os;
+  os << std::hex << std::setw( 16 ) << std::setfill( '0' ) << hash;
+  return os.str();
+}
+
+/**
+ * @brief Call a function on the subregions of all the regions of a mesh level, aggregates included.
+ * @tparam LAMBDA type of the function
+ * @param mesh the mesh level
+ * @param lambda the function, called with the region and the subregion
+ */
+template< typename LAMBDA >
+void forAllSubRegions( MeshLevel & mesh, LAMBDA && lambda )
+{
+  mesh.getElemManager()->forElementRegions< ElementRegionBase >( [&]( ElementRegionBase & region )
+  {
+    region.GetGroup( ElementRegionBase::viewKeyStruct::elementSubRegions )->
+      forSubGroups< ElementSubRegionBase >( [&]( ElementSubRegionBase & subRegion )
+    {
+      lambda( region, subRegion );
+    } );
+  } );
+}
+
+/**
+ * @brief Call a function on the object managers of a mesh level.
+ * @tparam LAMBDA type of the function
+ * @param mesh the mesh level
+ * @param lambda the function, called with a name unique in the level and the object manager
+ */
+template< typename LAMBDA >
+void forMeshObjects( MeshLevel & mesh, LAMBDA && lambda )
+{
+  lambda( string( "nodes" ), *mesh.getNodeManager() );
+  lambda( string( "edges" ), *mesh.getEdgeManager() );
+  lambda( string( "faces" ), *mesh.getFaceManager() );
+  forAllSubRegions( mesh, [&]( ElementRegionBase & region, ElementSubRegionBase & subRegion )
+  {
+    lambda( region.getName() + "/" + subRegion.getName(), subRegion );
+  } );
+}
+
+/**
+ * @brief Check whether a type is one of the arrays the preprocessing may import from the mesh files.
+ * @param type the type
+ * @return true if the type is an array known to rtTypes
+ */
+bool isArrayType( rtTypes::TypeIDs const type )
+{
+  return type >= rtTypes::TypeIDs::integer_array_id && type <= rtTypes::TypeIDs::real64_array3d_kji_id;
+}
+
+/**
+ * @brief Write a tensor to a conduit node.
+ * @param node the node
+ * @param tensor the tensor
+ */
+void setTensor( conduit::Node & node, R1Tensor const & tensor )
+{
+  std::vector< conduit::float64 > const values = { tensor[0], tensor[1], tensor[2] };
+  node.set( values );
+}
+
+/**
+ * @brief Read a tensor from a conduit node.
+ * @param node the node
+ * @param tensor the tensor
+ */
+void getTensor( conduit::Node const & node, R1Tensor & tensor )
+{
+  conduit::float64 const * const values = node.as_float64_ptr();
+  tensor[0] = values[0];
+  tensor[1] = values[1];
+  tensor[2] = values[2];
+}
+
+/**
+ * @brief Write an array to a conduit node.
+ * @tparam T the type of the values
+ * @param node the node
+ * @param values the array
+ */
+template< typename T >
+void setArray( conduit::Node & node, arrayView1d< T const > const & values )
+{
+  node.set( std::vector< T >( values.begin(), values.end() ) );
+}
+
+/**
+ * @brief Read an array from a conduit node written by setArray.
+ * @tparam T the type of the values
+ * @param node the node
+ * @param values the array, resized
+ */
+template< typename T >
+void getArray( conduit::Node const & node, array1d< T > & values )
+{
+  values.resize( LvArray::integerConversion< localIndex >( node.dtype().number_of_elements() ) );
+  if( values.empty() )
+  {
+    return;
+  }
+  T const * const data = static_cast< T const * >( node.element_ptr( 0 ) );
+  for( localIndex i = 0; i < values.size(); ++i )
+  {
+    values[i] = data[i];
+  }
+}
+
+/**
+ * @brief Write the spatial partition, built by the mesh generators and the setup of the communications.
+ * @param node the node
+ * @param partition the partition
+ */
+void writePartition( conduit::Node & node, SpatialPartition const & partition )
+{
+  setArray( node[ "partitions" ], partition.m_Partitions.toViewConst() );
+  setArray( node[ "periodic" ], partition.m_Periodic.toViewConst() );
+  setArray( node[ "coords" ], partition.m_coords.toViewConst() );
+  for( int dir = 0; dir < 3; ++dir )
+  {
+    setArray( node[ "locations" ][ std::to_string( dir ) ], partition.m_PartitionLocations[dir].toViewConst() );
+  }
+  setTensor( node[ "min" ], partition.m_min );
+  setTensor( node[ "max" ], partition.m_max );
+  setTensor( node[ "blockSize" ], partition.m_blockSize );
+  setTensor( node[ "gridSize" ], partition.m_gridSize );
+  setTensor( node[ "gridMin" ], partition.m_gridMin );
+  setTensor( node[ "gridMax" ], partition.m_gridMax );
+}
+
+/**
+ * @brief Read the spatial partition.
+ * @param node the node
+ * @param partition the partition
+ */
+void readPartition( conduit::Node const & node, SpatialPartition & partition )
+{
+  getArray( node[ "partitions" ], partition.m_Partitions );
+  getArray( node[ "periodic" ], partition.m_Periodic );
+  getArray( node[ "coords" ], partition.m_coords );
+  for( int dir = 0; dir < 3; ++dir )
+  {
+    getArray( node[ "locations" ][ std::to_string( dir ) ], partition.m_PartitionLocations[dir] );
+  }
+  getTensor( node[ "min" ], partition.m_min );
+  getTensor( node[ "max" ], partition.m_max );
+  getTensor( node[ "blockSize" ], partition.m_blockSize );
+  getTensor( node[ "gridSize" ], partition.m_gridSize );
+  getTensor( node[ "gridMin" ], partition.m_gridMin );
+  getTensor( node[ "gridMax" ], partition.m_gridMax );
+  partition.SetContactGhostRange( 0.0 );
+}
+
+/**
+ * @brief Write what the restart format does not describe of a mesh level: the objects created by the preprocessing.
+ * @param node the node
+ * @param mesh the mesh level
+ */
+void writeLevelStructure( conduit::Node & node, MeshLevel & mesh )
+{
+  forAllSubRegions( mesh, [&]( ElementRegionBase & region, ElementSubRegionBase & subRegion )
+  {
+    conduit::Node & subRegionNode = node[ "subRegions" ][ region.getName() ][ subRegion.getName() ];
+    if( dynamic_cast< CellElementSubRegion * >( &subRegion ) != nullptr )
+    {
+      subRegionNode[ "kind" ].set( string( cellSubRegion ) );
+      subRegionNode[ "elementType" ].set( subRegion.GetElementTypeString() );
+    }
+    else if( dynamic_cast< AggregateElementSubRegion * >( &subRegion ) != nullptr )
+    {
+      subRegionNode[ "kind" ].set( string( aggregateSubRegion ) );
+    }
+    else
+    {
+      // the surface and well subregions are created by their region
+      subRegionNode[ "kind" ].set( string( regionSubRegion ) );
+    }
+  } );
+
+  forMeshObjects( mesh, [&]( string const & name, ObjectManagerBase & object )
+  {
+    conduit::Node & objectNode = node[ "objects" ][ name ];
+    object.sets().forWrappers( [&]( WrapperBase const & set )
+    {
+      objectNode[ "sets" ][ set.getName() ].set( 1 );
+    } );
+    // the fields imported from the mesh files
+    object.forWrappers( [&]( WrapperBase const & wrapper )
+    {
+      rtTypes::TypeIDs const type = rtTypes::typeID( std::type_index( wrapper.get_typeid() ) );
+      if( isArrayType( type ) )
+      {
+        objectNode[ "arrays" ][ wrapper.getName() ].set( static_cast< conduit::int32 >( type ) );
+      }
+    } );
+  } );
+}
+
+/**
+ * @brief Recreate the objects created by the preprocessing of a mesh level, before its wrappers are read.
+ * @param node the node
+ * @param mesh the mesh level
+ */
+void readLevelStructure( conduit::Node const & node, MeshLevel & mesh )
+{
+  ElementRegionManager & elemManager = *mesh.getElemManager();
+  elemManager.forElementRegions< SurfaceElementRegion >( [&]( SurfaceElementRegion & region )
+  {
+    region.GenerateMesh( nullptr );
+  } );
+
+  conduit::Node const & regionsNode = node[ "subRegions" ];
+  for( conduit::index_t r = 0; r < regionsNode.number_of_children(); ++r )
+  {
+    conduit::Node const & regionNode = regionsNode.child( r );
+    ElementRegionBase * const region = elemManager.GetRegion( regionNode.name() );
+    GEOSX_ERROR_IF( region == nullptr, "The cached mesh has a region " << regionNode.name() << " missing from the input" );
+    Group & subRegions = *region->GetGroup( ElementRegionBase::viewKeyStruct::elementSubRegions );
+
+    for( conduit::index_t s = 0; s < regionNode.number_of_children(); ++s )
+    {
+      conduit::Node const & subRegionNode = regionNode.child( s );
+      string const kind = subRegionNode[ "kind" ].as_string();
+      if( subRegions.hasGroup( subRegionNode.name() ) )
+      {
+        continue;
+      }
+      if( kind == cellSubRegion )
+      {
+        subRegions.RegisterGroup< CellElementSubRegion >( subRegionNode.name() )->
+          SetElementType( subRegionNode[ "elementType" ].as_string() );
+      }
+      else if( kind == aggregateSubRegion )
+      {
+        subRegions.RegisterGroup< AggregateElementSubRegion >( subRegionNode.name() );
+      }
+      else
+      {
+        GEOSX_ERROR( "The subregion " << subRegionNode.name() << " of the cached mesh is not created by the region " << region->getName() );
+      }
+    }
+  }
+
+  forMeshObjects( mesh, [&]( string const & name, ObjectManagerBase & object )
+  {
+    GEOSX_ERROR_IF( !node[ "objects" ].has_child( name ), "The object " << name << " is not in the cached mesh" );
+    conduit::Node const & objectNode = node[ "objects" ][ name ];
+
+    if( objectNode.has_child( "sets" ) )
+    {
+      for( string const & setName : objectNode[ "sets" ].child_names() )
+      {
+        if( !object.sets().hasWrapper( setName ) )
+        {
+          object.CreateSet( setName );
+        }
+      }
+    }
+
+    if( objectNode.has_child( "arrays" ) )
+    {
+      conduit::Node const & arraysNode = objectNode[ "arrays" ];
+      for( conduit::index_t a = 0; a < arraysNode.number_of_children(); ++a )
+      {
+        string const arrayName = arraysNode.child( a ).name();
+        if( object.hasWrapper( arrayName ) )
+        {
+          continue;
+        }
+        rtTypes::TypeIDs const type = static_cast< rtTypes::TypeIDs >( arraysNode.child( a ).to_int32() );
+        rtTypes::ApplyArrayTypeLambda2( type, true, [&]( auto array, auto GEOSX_UNUSED_PARAM( baseType ) )
+        {
+          object.registerWrapper< decltype( array ) >( arrayName );
+        } );
+      }
+    }
+  } );
+}
+
+/**
+ * @brief Link the maps of a mesh level read from the cache with the objects they map to.
+ * @param mesh the mesh level
+ */
+void linkLevelRelations( MeshLevel & mesh )
+{
+  NodeManager & nodeManager = *mesh.getNodeManager();
+  EdgeManager & edgeManager = *mesh.getEdgeManager();
+  FaceManager & faceManager = *mesh.getFaceManager();
+  ElementRegionManager & elemManager = *mesh.getElemManager();
+
+  nodeManager.edgeList().SetRelatedObject( &edgeManager );
+  nodeManager.faceList().SetRelatedObject( &faceManager );
+  nodeManager.toElementRelation().setElementRegionManager( &elemManager );
+  edgeManager.nodeList().SetRelatedObject( &nodeManager );
+  edgeManager.faceList().SetRelatedObject( &faceManager );
+  faceManager.nodeList().SetRelatedObject( &nodeManager );
+  faceManager.edgeList().SetRelatedObject( &edgeManager );
+  faceManager.toElementRelation().setElementRegionManager( &elemManager );
+
+  elemManager.forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase & subRegion )
+  {
+    subRegion.setupRelatedObjectsInRelations( &mesh );
+  } );
+
+  forMeshObjects( mesh, []( string const &, ObjectManagerBase & object )
+  {
+    object.ConstructGlobalToLocalMap();
+  } );
+  nodeManager.SetMaxGlobalIndex();
+  edgeManager.SetMaxGlobalIndex();
+  faceManager.SetMaxGlobalIndex();
+}
+
+} // namespace
+
+MeshCache::MeshCache( string const & directory, string const & key ):
+  m_directory( directory + "/" + hashKey( key ) ),
+  m_key( key )
+{}
+
+string MeshCache::fileName() const
+{
+  std::ostringstream os;
+  os << m_directory << "/rank_" << std::setw( 7 ) << std::setfill( '0' ) << MpiWrapper::Comm_rank( MPI_COMM_GEOSX ) << ".hdf5";
+  return os.str();
+}
+
+bool MeshCache::read( DomainPartition & domain ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  conduit::Node cacheNode;
+  bool const exists = std::ifstream( fileName() ).good();
+  if( exists )
+  {
+    conduit::relay::io::load( fileName(), "hdf5", cacheNode );
+  }
+  bool const matches = exists && cacheNode.has_child( "key" ) && cacheNode[ "key" ].as_string() == m_key;
+
+  // one rank missing its file and all of them preprocess the mesh
+  if( MpiWrapper::Min( matches ? 1 : 0 ) == 0 )
+  {
+    GEOSX_LOG_RANK_0( "No preprocessed mesh in " << m_directory << ", the mesh is preprocessed and cached" );
+    return false;
+  }
+
+  SpatialPartition & partition = dynamic_cast< SpatialPartition & >( domain.getReference< PartitionBase >( keys::partitionManager ) );
+  readPartition( cacheNode[ "partition" ], partition );
+
+  Group & meshBodies = *domain.getMeshBodies();
+  meshBodies.forSubGroups< MeshBody >( [&]( MeshBody & meshBody )
+  {
+    conduit::Node const & bodyNode = cacheNode[ "bodies" ][ meshBody.getName() ];
+    meshBody.setGlobalLengthScale( bodyNode[ "globalLengthScale" ].to_float64() );
+    conduit::int64 const * const structured = bodyNode[ "structuredNodeCounts" ].as_int64_ptr();
+    globalIndex const numNodes[3] = { structured[0], structured[1], structured[2] };
+    meshBody.setStructuredNodeCounts( numNodes );
+
+    meshBody.forSubGroups< MeshLevel >( [&]( MeshLevel & mesh )
+    {
+      readLevelStructure( bodyNode[ "levels" ][ mesh.getName() ], mesh );
+    } );
+  } );
+
+  // the neighbors own groups in all the objects of the first level, as in DomainPartition::SetupCommunications
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  std::vector< NeighborCommunicator > & neighbors = domain.getNeighbors();
+  array1d< int > neighborRanks;
+  getArray( cacheNode[ "neighbors" ], neighborRanks );
+  for( int const neighborRank : neighborRanks )
+  {
+    neighbors.emplace_back( NeighborCommunicator( neighborRank ) );
+    neighbors.back().AddNeighborGroupToMesh( mesh );
+  }
+
+  meshBodies.getConduitNode().update( cacheNode[ "tree" ] );
+  meshBodies.loadFromConduit();
+
+  meshBodies.forSubGroups< MeshBody >( [&]( MeshBody & meshBody )
+  {
+    meshBody.forSubGroups< MeshLevel >( [&]( MeshLevel & level )
+    {
+      linkLevelRelations( level );
+    } );
+  } );
+
+  GEOSX_LOG_RANK_0( "Preprocessed mesh read from " << m_directory );
+  return true;
+}
+
+void MeshCache::write( DomainPartition & domain ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  conduit::Node cacheNode;
+  cacheNode[ "key" ].set( m_key );
+
+  SpatialPartition const & partition = dynamic_cast< SpatialPartition const & >( domain.getReference< PartitionBase >( keys::partitionManager ) );
+  writePartition( cacheNode[ "partition" ], partition );
+
+  array1d< int > neighborRanks;
+  for( NeighborCommunicator const & neighbor : domain.getNeighbors() )
+  {
+    neighborRanks.emplace_back( neighbor.NeighborRank() );
+  }
+  setArray( cacheNode[ "neighbors" ], neighborRanks.toViewConst() );
+
+  Group & meshBodies = *domain.getMeshBodies();
+  meshBodies.forSubGroups< MeshBody >( [&]( MeshBody & meshBody )
+  {
+    conduit::Node & bodyNode = cacheNode[ "bodies" ][ meshBody.getName() ];
+    bodyNode[ "globalLengthScale" ].set( meshBody.getGlobalLengthScale() );
+    std::vector< conduit::int64 > const structured = { meshBody.getStructuredNodeCount( 0 ),
+                                                       meshBody.getStructuredNodeCount( 1 ),
+                                                       meshBody.getStructuredNodeCount( 2 ) };
+    bodyNode[ "structuredNodeCounts" ].set( structured );
+
+    meshBody.forSubGroups< MeshLevel >( [&]( MeshLevel & mesh )
+    {
+      writeLevelStructure( bodyNode[ "levels" ][ mesh.getName() ], mesh );
+    } );
+  } );
+
+  // the values in the format of the restart files
+  meshBodies.prepareToWrite();
+  cacheNode[ "tree" ].set( meshBodies.getConduitNode() );
+  meshBodies.finishWriting();
+
+  if( MpiWrapper::Comm_rank( MPI_COMM_GEOSX ) == 0 )
+  {
+    makeDirsForPath( m_directory );
+  }
+  MpiWrapper::Barrier( MPI_COMM_GEOSX );
+
+  conduit::relay::io::save( cacheNode, fileName(), "hdf5" );
+  GEOSX_LOG_RANK_0( "Preprocessed mesh written to " << m_directory );
+}
+
+} /* namespace geosx */
@@ -0,0 +1,80 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MeshCache.hpp
+ */
+
+#ifndef GEOSX_MANAGERS_MESHCACHE_HPP_
+#define GEOSX_MANAGERS_MESHCACHE_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+class DomainPartition;
+
+/**
+ * @class MeshCache
+ * @brief Files of the preprocessed meshes of the ranks, reused by the runs of the same mesh and partition.
+ *
+ * Each rank writes the mesh bodies as they are once the mesh is generated, renumbered, mapped and ghosted,
+ * in the format of the restart files, along with what the restart files do not describe: the subregions,
+ * sets and imported fields created by the preprocessing, the neighbors and the spatial partition.
+ * A later run with the same key recreates them and reads the mesh instead of preprocessing it again.
+ * Unlike the restart, only the mesh is cached: the fields registered by the solvers, the numerical
+ * methods and the initial conditions are set up from the input as usual.
+ *
+ * The files of a key are in their own subdirectory of the cache directory, named after the hash of the key.
+ */
+class MeshCache
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param directory the cache directory
+   * @param key the description of everything the preprocessed mesh depends on
+   */
+  MeshCache( string const & directory, string const & key );
+
+  /**
+   * @brief Restore the preprocessed mesh, collective over the ranks.
+   * @param domain the domain, with the mesh bodies and levels created from the input
+   * @return true if all the ranks found their file of the key and restored their mesh, false if nothing changed
+   */
+  bool read( DomainPartition & domain ) const;
+
+  /**
+   * @brief Write the preprocessed mesh of the rank, collective over the ranks.
+   * @param domain the domain, just after the preprocessing of the mesh
+   */
+  void write( DomainPartition & domain ) const;
+
+private:
+
+  /// @return the name of the file of the rank
+  string fileName() const;
+
+  /// The subdirectory of the key
+  string m_directory;
+
+  /// The description of everything the preprocessed mesh depends on
+  string m_key;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MANAGERS_MESHCACHE_HPP_ */
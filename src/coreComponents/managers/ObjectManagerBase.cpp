@@ -285,6 +285,8 @@ localIndex ObjectManagerBase::PackPrivate( buffer_unit_type * & buffer,
       dataRepository::WrapperBase const * const wrapper = this->getWrapperBase( wrapperName );
       if( wrapper!=nullptr )
       {
+        GEOSX_ERROR_IF( on_device && !wrapper->isPackable( true ),
+                        "Wrapper " << wrapperName << " of " << this->getName() << " cannot be packed on device" );
         packedSize += bufferOps::Pack< DOPACK >( buffer, wrapperName );
         if( DOPACK )
         {
@@ -547,7 +549,15 @@ localIndex ObjectManagerBase::PackGlobalMapsPrivate( buffer_unit_type * & buffer
   localIndex const numPackedIndices = packList.size();
   packedSize += bufferOps::Pack< DOPACK >( buffer, numPackedIndices );
 
-  if( numPackedIndices > 0 )
+  if( numPackedIndices > 0 && bufferOps::getCompactGlobalIndices() )
+  {
+    globalIndex previousGlobalIndex = 0;
+    for( localIndex a=0; a<numPackedIndices; ++a )
+    {
+      packedSize += bufferOps::PackGlobalIndex< DOPACK >( buffer, this->m_localToGlobalMap[packList[a]], previousGlobalIndex );
+    }
+  }
+  else if( numPackedIndices > 0 )
   {
     globalIndex_array globalIndices;
     globalIndices.resize( numPackedIndices );
@@ -620,7 +630,19 @@ localIndex ObjectManagerBase::UnpackGlobalMaps( buffer_unit_type const * & buffe
     unpackedLocalIndices.resize( numUnpackedIndices );
 
     globalIndex_array globalIndices;
-    unpackedSize += bufferOps::Unpack( buffer, globalIndices );
+    if( bufferOps::getCompactGlobalIndices() )
+    {
+      globalIndices.resize( numUnpackedIndices );
+      globalIndex previousGlobalIndex = 0;
+      for( localIndex a = 0; a < numUnpackedIndices; ++a )
+      {
+        unpackedSize += bufferOps::UnpackGlobalIndex( buffer, globalIndices[a], previousGlobalIndex );
+      }
+    }
+    else
+    {
+      unpackedSize += bufferOps::Unpack( buffer, globalIndices );
+    }
     localIndex numNewIndices = 0;
     globalIndex_array newGlobalIndices;
     newGlobalIndices.reserve( numUnpackedIndices );
@@ -847,12 +869,16 @@ void ObjectManagerBase::CopyObject( const localIndex source, const localIndex de
   {
     SortedArray< localIndex > & targetSet = m_sets.getReference< SortedArray< localIndex > >( i );
 
-#if !defined(__CUDA_ARCH__)
-    targetSet.move( LvArray::MemorySpace::CPU, true );
+    // only the sets that get the destination are modified, the others keep a valid device copy
+#if !defined(GEOSX_DEVICE_COMPILE)
+    targetSet.move( LvArray::MemorySpace::CPU, false );
 #endif
 
     if( targetSet.count( source ) > 0 )
     {
+#if !defined(GEOSX_DEVICE_COMPILE)
+      targetSet.move( LvArray::MemorySpace::CPU, true );
+#endif
       targetSet.insert( destination );
     }
   }
@@ -526,6 +526,22 @@ public:
                           ArrayOfSetsView< localIndex > const & upmap,
                           ArrayOfArraysView< localIndex const > const & downmap );
 
+  /**
+   * @brief Release the unused capacity of a variable size relation map.
+   * @tparam MAP the type of the map, an ArrayOfArrays or an ArrayOfSets
+   * @param map the map to shrink
+   *
+   * Unlike compress, which only packs the arrays at the front of the buffer, the map is copied into
+   * a buffer holding exactly its values: any later insertion reallocates the buffer.
+   */
+  template< typename MAP >
+  static void shrinkToFit( MAP & map )
+  {
+    map.compress();
+    MAP shrunkMap( map );
+    map = std::move( shrunkMap );
+  }
+
   /**
    * @brief Updates the child and target indices after a topology change.
    * @param targetIndices The indices top update.
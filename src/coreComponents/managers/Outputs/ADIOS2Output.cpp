@@ -0,0 +1,80 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ADIOS2Output.cpp
+ */
+
+#include "ADIOS2Output.hpp"
+#include "common/TimingMacros.hpp"
+#include "managers/DomainPartition.hpp"
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+ADIOS2Output::ADIOS2Output( std::string const & name,
+                            Group * const parent ):
+  OutputBase( name, parent ),
+  m_plotLevel(),
+  m_engine(),
+  m_engineParameters(),
+  m_operator(),
+  m_writer()
+{
+  registerWrapper( viewKeysStruct::plotLevelString, &m_plotLevel )->
+    setApplyDefaultValue( 1 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum plot level of the fields to be written" );
+
+  registerWrapper( viewKeysStruct::engineString, &m_engine )->
+    setApplyDefaultValue( "BP5" )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "ADIOS2 engine, e.g. BP5 to write files or SST to stream the steps to a reader" );
+
+  registerWrapper( viewKeysStruct::engineParametersString, &m_engineParameters )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Parameters of the ADIOS2 engine, as key=value strings, e.g. NumAggregators=4 or AsyncWrite=On" );
+
+  registerWrapper( viewKeysStruct::operatorString, &m_operator )->
+    setApplyDefaultValue( "" )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "ADIOS2 operator compressing the fields, e.g. blosc, empty for no compression" );
+}
+
+ADIOS2Output::~ADIOS2Output()
+{}
+
+void ADIOS2Output::Execute( real64 const time_n,
+                            real64 const GEOSX_UNUSED_PARAM( dt ),
+                            integer const GEOSX_UNUSED_PARAM( cycleNumber ),
+                            integer const GEOSX_UNUSED_PARAM( eventCounter ),
+                            real64 const GEOSX_UNUSED_PARAM ( eventProgress ),
+                            Group * domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  DomainPartition * domainPartition = Group::group_cast< DomainPartition * >( domain );
+  if( !m_writer )
+  {
+    m_writer = std::make_unique< adios2io::ADIOS2WriterInterface >( getName(), m_engine, m_engineParameters, m_operator );
+  }
+  m_writer->SetPlotLevel( m_plotLevel );
+  m_writer->Write( time_n, *domainPartition );
+}
+
+
+REGISTER_CATALOG_ENTRY( OutputBase, ADIOS2Output, std::string const &, Group * const )
+} /* namespace geosx */
@@ -0,0 +1,101 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ADIOS2Output.hpp
+ */
+
+#ifndef GEOSX_MANAGERS_OUTPUTS_ADIOS2OUTPUT_HPP_
+#define GEOSX_MANAGERS_OUTPUTS_ADIOS2OUTPUT_HPP_
+
+#include "OutputBase.hpp"
+#include "fileIO/adios2/ADIOS2WriterInterface.hpp"
+
+#include <memory>
+
+namespace geosx
+{
+
+/**
+ * @class ADIOS2Output
+ *
+ * A class for writing the plotted fields through an ADIOS2 engine
+ */
+class ADIOS2Output : public OutputBase
+{
+public:
+  /// @copydoc geosx::dataRepository::Group::Group(std::string const & name, Group * const parent)
+  ADIOS2Output( std::string const & name, Group * const parent );
+
+  /// Destructor
+  virtual ~ADIOS2Output() override;
+
+  /**
+   * @brief Catalog name interface
+   * @return This type's catalog name
+   */
+  static string CatalogName() { return "ADIOS2"; }
+
+  /**
+   * @brief Writes out one ADIOS2 step.
+   * @copydoc EventBase::Execute()
+   */
+  virtual void Execute( real64 const time_n,
+                        real64 const dt,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        dataRepository::Group * domain ) override;
+
+  /**
+   * @brief Writes out a step as the code exits and closes the engine
+   * @copydoc ExecutableGroup::Cleanup()
+   */
+  virtual void Cleanup( real64 const time_n,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        dataRepository::Group * domain ) override
+  {
+    Execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+    m_writer.reset();
+  }
+
+  /// @cond DO_NOT_DOCUMENT
+  struct viewKeysStruct : OutputBase::viewKeysStruct
+  {
+    static constexpr auto plotLevelString = "plotLevel";
+    static constexpr auto engineString = "engine";
+    static constexpr auto engineParametersString = "engineParameters";
+    static constexpr auto operatorString = "operator";
+  } adios2OutputViewKeys;
+  /// @endcond
+
+private:
+  integer m_plotLevel;
+
+  string m_engine;
+
+  string_array m_engineParameters;
+
+  string m_operator;
+
+  /// The writer, created at the first output once the input is read
+  std::unique_ptr< adios2io::ADIOS2WriterInterface > m_writer;
+};
+
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MANAGERS_OUTPUTS_ADIOS2OUTPUT_HPP_ */
@@ -0,0 +1,113 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file AscentOutput.cpp
+ */
+
+/// Source includes
+#include "managers/Outputs/AscentOutput.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "managers/DomainPartition.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+// TPL includes
+#include <ascent.hpp>
+#include <conduit.hpp>
+
+namespace geosx
+{
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+AscentOutput::AscentOutput( std::string const & name,
+                            dataRepository::Group * const parent ):
+  BlueprintOutput( name, parent ),
+  m_actionsFile(),
+  m_ascent()
+{
+  registerWrapper( viewKeysStruct::actionsFileString, &m_actionsFile )->
+    setApplyDefaultValue( "ascent_actions.yaml" )->
+    setInputFlag( dataRepository::InputFlags::OPTIONAL )->
+    setDescription( "Ascent actions file (yaml or json), describing the pipelines, scenes and extracts to run" );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+AscentOutput::~AscentOutput()
+{
+  if( m_ascent )
+  {
+    m_ascent->close();
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void AscentOutput::Execute( real64 const time,
+                            real64 const,
+                            integer const cycle,
+                            integer const,
+                            real64 const,
+                            dataRepository::Group * group )
+{
+  GEOSX_MARK_FUNCTION;
+
+  if( !m_ascent )
+  {
+    conduit::Node options;
+    options[ "actions_file" ] = m_actionsFile;
+    options[ "default_dir" ] = childDirectory().empty() ? "." : childDirectory();
+#ifdef GEOSX_USE_MPI
+    options[ "mpi_comm" ] = MPI_Comm_c2f( MPI_COMM_GEOSX );
+#endif
+    m_ascent = std::make_unique< ascent::Ascent >();
+    m_ascent->open( options );
+  }
+
+  DomainPartition const & domain = dynamicCast< DomainPartition const & >( *group );
+
+  /// The fields point to the arrays of the domain, which Ascent reads in place until the actions are run.
+  conduit::Node meshRoot;
+  dataRepository::Group averagedElementData( "averagedElementData", this );
+  buildMesh( time, cycle, domain, meshRoot, averagedElementData );
+
+  conduit::Node & mesh = meshRoot[ "mesh" ];
+  mesh[ "state/domain_id" ] = MpiWrapper::Comm_rank();
+
+  m_ascent->publish( mesh );
+
+  /// The actions come from the actions file.
+  conduit::Node const actions;
+  m_ascent->execute( actions );
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void AscentOutput::Cleanup( real64 const time_n,
+                            integer const cycleNumber,
+                            integer const eventCounter,
+                            real64 const eventProgress,
+                            dataRepository::Group * domain )
+{
+  Execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+
+  /// Ascent is closed while MPI is still initialized.
+  m_ascent->close();
+  m_ascent.reset();
+}
+
+
+REGISTER_CATALOG_ENTRY( OutputBase, AscentOutput, std::string const &, dataRepository::Group * const )
+
+} /* namespace geosx */
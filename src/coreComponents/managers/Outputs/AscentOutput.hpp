@@ -0,0 +1,110 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file AscentOutput.hpp
+ */
+
+#ifndef GEOSX_MANAGERS_OUTPUTS_ASCENTOUTPUT_HPP_
+#define GEOSX_MANAGERS_OUTPUTS_ASCENTOUTPUT_HPP_
+
+#include "managers/Outputs/BlueprintOutput.hpp"
+
+#include <memory>
+
+namespace ascent
+{
+class Ascent;
+}
+
+namespace geosx
+{
+
+/**
+ * @class AscentOutput
+ * @brief A class publishing the Blueprint mesh to the in-situ pipelines of Ascent.
+ *
+ * The mesh is the one of BlueprintOutput, whose fields point to the arrays of the domain: nothing is copied
+ * but the reordered connectivity. The pipelines, scenes and extracts are described by the Ascent actions file,
+ * and run each time the output is executed, i.e. at the cadence of its event.
+ */
+class AscentOutput : public BlueprintOutput
+{
+public:
+
+  /**
+   * @brief Construct a new AscentOutput object.
+   * @param name The name of the AscentOutput in the data repository.
+   * @param parent The parent Group.
+   */
+  AscentOutput( std::string const & name,
+                Group * const parent );
+
+  /**
+   * @brief Destructor, closes Ascent.
+   */
+  virtual ~AscentOutput() override;
+
+  /**
+   * @brief Get the name used to register this object in an XML file.
+   * @return The string "Ascent".
+   */
+  static string CatalogName() { return "Ascent"; }
+
+  /**
+   * @brief Publishes the Blueprint mesh to Ascent and runs the actions.
+   * @copydetails EventBase::Execute()
+   */
+  virtual void Execute( real64 const time_n,
+                        real64 const dt,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        dataRepository::Group * domain ) override;
+
+  /// @copydoc ExecutableGroup::CanDeferExecution()
+  virtual bool CanDeferExecution() const override
+  { return false; }
+
+  /**
+   * @brief Runs the actions a last time at the end of the simulation, and closes Ascent.
+   * @copydetails ExecutableGroup::Cleanup()
+   */
+  virtual void Cleanup( real64 const time_n,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        dataRepository::Group * domain ) override;
+
+  /// @cond DO_NOT_DOCUMENT
+  struct viewKeysStruct : OutputBase::viewKeysStruct
+  {
+    static constexpr auto actionsFileString = "actionsFile";
+  } ascentOutputViewKeys;
+  /// @endcond
+
+private:
+
+  /// The Ascent actions file, describing the pipelines
+  string m_actionsFile;
+
+  /// The Ascent instance, opened at the first execution
+  std::unique_ptr< ascent::Ascent > m_ascent;
+};
+
+
+} /// namespace geosx
+
+#endif /// GEOSX_MANAGERS_OUTPUTS_ASCENTOUTPUT_HPP_
@@ -29,6 +29,8 @@
 #include <conduit_blueprint.hpp>
 #include <conduit_relay.hpp>
 
+#include <memory>
+
 namespace geosx
 {
 namespace internal
@@ -101,18 +103,71 @@ BlueprintOutput::BlueprintOutput( std::string const & name,
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 void BlueprintOutput::Execute( real64 const time,
-                               real64 const,
+                               real64 const dt,
                                integer const cycle,
-                               integer const,
-                               real64 const,
+                               integer const eventCounter,
+                               real64 const eventProgress,
                                dataRepository::Group * group )
+{
+  DeferExecution( time, dt, cycle, eventCounter, eventProgress, group )();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+std::function< void() > BlueprintOutput::DeferExecution( real64 const time,
+                                                         real64 const,
+                                                         integer const cycle,
+                                                         integer const,
+                                                         real64 const,
+                                                         dataRepository::Group * group )
 {
   GEOSX_MARK_FUNCTION;
 
   DomainPartition const & domain = dynamicCast< DomainPartition const & >( *group );
-  MeshLevel const & meshLevel = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
 
   conduit::Node meshRoot;
+  dataRepository::Group averagedElementData( "averagedElementData", this );
+  buildMesh( time, cycle, domain, meshRoot, averagedElementData );
+  conduit::Node & mesh = meshRoot[ "mesh" ];
+
+  /// Generate the Blueprint index.
+  conduit::Node fileRoot;
+  conduit::Node & index = fileRoot[ "blueprint_index/mesh" ];
+  conduit::blueprint::mesh::generate_index( mesh, "mesh", MpiWrapper::Comm_size(), index );
+
+  /// Verify that the index conforms to the Blueprint.
+  conduit::Node info;
+  GEOSX_ASSERT_MSG( conduit::blueprint::mesh::index::verify( index, info ), info.to_json() );
+
+  /// Write out the root index file, then write out the mesh.
+  char buffer[ 128 ];
+  GEOSX_ERROR_IF_GE( snprintf( buffer, 128, "blueprintFiles/cycle_%07d", cycle ), 128 );
+  std::string const filePathForRank = dataRepository::writeRootFile( fileRoot, buffer );
+
+  /// The fields point to the arrays of the mesh, the file is written from a deep copy.
+  std::shared_ptr< conduit::Node > snapshot = std::make_shared< conduit::Node >();
+  {
+    GEOSX_MARK_SCOPE( copy blueprint tree );
+    snapshot->set( meshRoot );
+  }
+
+  return [snapshot, filePathForRank]()
+  {
+    std::lock_guard< std::mutex > const lock( dataRepository::hdf5WriteMutex() );
+    conduit::relay::io::save( *snapshot, filePathForRank, "hdf5" );
+  };
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void BlueprintOutput::buildMesh( real64 const time,
+                                 integer const cycle,
+                                 DomainPartition const & domain,
+                                 conduit::Node & meshRoot,
+                                 dataRepository::Group & averagedElementData )
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshLevel const & meshLevel = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
   conduit::Node & mesh = meshRoot[ "mesh" ];
   conduit::Node & coordset = mesh[ "coordsets/nodes" ];
   conduit::Node & topologies = mesh[ "topologies" ];
@@ -122,7 +177,6 @@ void BlueprintOutput::Execute( real64 const time,
 
   addNodalData( *meshLevel.getNodeManager(), coordset, topologies, mesh[ "fields" ] );
 
-  dataRepository::Group averagedElementData( "averagedElementData", this );
   addElementData( *meshLevel.getElemManager(), coordset, topologies, mesh[ "fields" ], averagedElementData );
 
   /// The Blueprint will complain if the fields node is present but empty.
@@ -134,21 +188,6 @@ void BlueprintOutput::Execute( real64 const time,
   /// Verify that the mesh conforms to the Blueprint.
   conduit::Node info;
   GEOSX_ASSERT_MSG( conduit::blueprint::verify( "mesh", meshRoot, info ), info.to_json() );
-
-  /// Generate the Blueprint index.
-  conduit::Node fileRoot;
-  conduit::Node & index = fileRoot[ "blueprint_index/mesh" ];
-  conduit::blueprint::mesh::generate_index( mesh, "mesh", MpiWrapper::Comm_size(), index );
-
-  /// Verify that the index conforms to the Blueprint.
-  info.reset();
-  GEOSX_ASSERT_MSG( conduit::blueprint::mesh::index::verify( index, info ), info.to_json() );
-
-  /// Write out the root index file, then write out the mesh.
-  char buffer[ 128 ];
-  GEOSX_ERROR_IF_GE( snprintf( buffer, 128, "blueprintFiles/cycle_%07d", cycle ), 128 );
-  std::string const filePathForRank = dataRepository::writeRootFile( fileRoot, buffer );
-  conduit::relay::io::save( meshRoot, filePathForRank, "hdf5" );
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@ namespace geosx
 {
 
 /// Forward declarations
+class DomainPartition;
 class MeshLevel;
 class NodeManager;
 class ElementRegionManager;
@@ -68,6 +69,21 @@ public:
                         real64 const eventProgress,
                         dataRepository::Group * domain ) override;
 
+  /// @copydoc ExecutableGroup::CanDeferExecution()
+  virtual bool CanDeferExecution() const override
+  { return true; }
+
+  /**
+   * @brief Builds the Blueprint mesh and writes the root file, and returns the write of the mesh of the rank.
+   * @copydetails ExecutableGroup::DeferExecution()
+   */
+  virtual std::function< void() > DeferExecution( real64 const time_n,
+                                                  real64 const dt,
+                                                  integer const cycleNumber,
+                                                  integer const eventCounter,
+                                                  real64 const eventProgress,
+                                                  dataRepository::Group * domain ) override;
+
   /**
    * @brief Writes out a Blueprint plot file at the end of the simulation.
    * @copydetails ExecutableGroup::Cleanup()
@@ -79,6 +95,23 @@ public:
                         dataRepository::Group * domain ) override
   { Execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain ); }
 
+protected:
+
+  /**
+   * @brief Build the Blueprint mesh of the rank, whose fields point to the arrays of the domain.
+   * @param time The time of the mesh.
+   * @param cycle The cycle of the mesh.
+   * @param domain The DomainPartition to describe.
+   * @param meshRoot The Node holding the "mesh" Node to populate.
+   * @param averagedElementData The Group holding the quadrature averaged constitutive data the fields point to,
+   *   which must outlive @p meshRoot.
+   */
+  void buildMesh( real64 const time,
+                  integer const cycle,
+                  DomainPartition const & domain,
+                  conduit::Node & meshRoot,
+                  dataRepository::Group & averagedElementData );
+
 private:
 
   /**
@@ -20,6 +20,7 @@
 #include "mesh/MeshLevel.hpp"
 #include "managers/DomainPartition.hpp"
 #include "fileIO/coupling/ChomboCoupler.hpp"
+#include "managers/initialization.hpp"
 #include <string>
 #include <fstream>
 #include <chrono>
@@ -36,11 +37,13 @@ ChomboIO::ChomboIO( std::string const & name, Group * const parent ):
   m_beginCycle( 0 ),
   m_inputPath( "/INVALID_INPUT_PATH" ),
   m_waitForInput(),
-  m_useChomboPressures()
+  m_useChomboPressures(),
+  m_couplingMode( CouplingMode::file ),
+  m_lagCoupling()
 {
   registerWrapper( viewKeyStruct::outputPathString, &m_outputPath )->
-    setInputFlag( InputFlags::REQUIRED )->
-    setDescription( "Path at which the geosx to chombo file will be written." );
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Path at which the geosx to chombo file will be written. Required by the file coupling mode." );
 
   registerWrapper( viewKeyStruct::beginCycleString, &m_beginCycle )->
     setInputFlag( InputFlags::REQUIRED )->
@@ -60,6 +63,18 @@ ChomboIO::ChomboIO( std::string const & name, Group * const parent ):
     setInputFlag( InputFlags::OPTIONAL )->
     setDefaultValue( 0 )->
     setDescription( "True iff geosx should use the pressures chombo writes out." );
+
+  registerWrapper( viewKeyStruct::couplingModeString, &m_couplingMode )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( CouplingMode::file )->
+    setDescription( "How the data is exchanged with chombo. Valid options:\n* " + EnumStrings< CouplingMode >::concat( "\n* " ) +
+                    "\nThe mpi mode requires geosx to be launched with chombo in MPI_COMM_WORLD, with the --coupling-color option." );
+
+  registerWrapper( viewKeyStruct::lagCouplingString, &m_lagCoupling )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "True iff geosx uses at each coupling step the reply of chombo to the previous step, so that both codes "
+                    "compute concurrently. Only used by the mpi coupling mode." );
 }
 
 ChomboIO::~ChomboIO()
@@ -77,11 +92,20 @@ void ChomboIO::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
 {
   if( m_coupler == nullptr )
   {
-    GEOSX_ERROR_IF( m_waitForInput && m_inputPath == "/INVALID_INPUT_PATH", "Waiting for input but no input path was specified." );
-
     DomainPartition * const domainPartition = Group::group_cast< DomainPartition * >( domain );
     MeshLevel * const meshLevel = domainPartition->getMeshBody( 0 )->getMeshLevel( 0 );
-    m_coupler = new ChomboCoupler( MPI_COMM_GEOSX, m_outputPath, m_inputPath, *meshLevel );
+    if( m_couplingMode == CouplingMode::mpi )
+    {
+      int const remoteLeader = getCommandLineOptions().couplingRemoteLeader;
+      GEOSX_ERROR_IF( remoteLeader < 0, "The mpi coupling mode requires the --coupling-color command line option." );
+      m_coupler = new ChomboCoupler( MPI_COMM_GEOSX, remoteLeader, *meshLevel );
+    }
+    else
+    {
+      GEOSX_ERROR_IF( m_outputPath.empty(), "The file coupling mode requires an output path." );
+      GEOSX_ERROR_IF( m_waitForInput && m_inputPath == "/INVALID_INPUT_PATH", "Waiting for input but no input path was specified." );
+      m_coupler = new ChomboCoupler( MPI_COMM_GEOSX, m_outputPath, m_inputPath, *meshLevel );
+    }
   }
 
   if( cycleNumber < m_beginCycle )
@@ -89,6 +113,21 @@ void ChomboIO::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
     return;
   }
 
+  if( m_couplingMode == CouplingMode::mpi && m_lagCoupling )
+  {
+    // the reply to the previous step arrived while this step was computed, chombo processes this one during the next
+    if( m_coupler->readPosted() )
+    {
+      m_coupler->read( m_useChomboPressures );
+    }
+    m_coupler->write( dt );
+    if( m_waitForInput )
+    {
+      m_coupler->postRead();
+    }
+    return;
+  }
+
   m_coupler->write( dt );
 
   if( m_waitForInput )
@@ -20,6 +20,7 @@
 #define GEOSX_MANAGERS_OUTPUTS_CHOMBOIO_HPP_
 
 #include "OutputBase.hpp"
+#include "common/EnumStrings.hpp"
 #include "fileIO/coupling/ChomboCoupler.hpp"
 
 namespace geosx
@@ -39,6 +40,15 @@ public:
   /// Destructor
   virtual ~ChomboIO() override;
 
+  /**
+   * @brief How the data is exchanged with CHOMBO.
+   */
+  enum class CouplingMode : integer
+  {
+    file, ///< Through the boundary files at outputPath and inputPath
+    mpi   ///< In memory, over an intercommunicator with CHOMBO sharing MPI_COMM_WORLD
+  };
+
   /**
    * @brief Catalog name interface
    * @return This type's catalog name
@@ -79,12 +89,16 @@ public:
     static constexpr auto inputPathString = "inputPath";
     static constexpr auto waitForInputString = "waitForInput";
     static constexpr auto useChomboPressuresString = "useChomboPressures";
+    static constexpr auto couplingModeString = "couplingMode";
+    static constexpr auto lagCouplingString = "lagCoupling";
 
     dataRepository::ViewKey outputPath = { outputPathString };
     dataRepository::ViewKey beginCycle = { beginCycleString };
     dataRepository::ViewKey inputPath = { inputPathString };
     dataRepository::ViewKey waitForInput = { waitForInputString };
     dataRepository::ViewKey useChomboPressures = { useChomboPressuresString };
+    dataRepository::ViewKey couplingMode = { couplingModeString };
+    dataRepository::ViewKey lagCoupling = { lagCouplingString };
   } viewKeys;
   /// @endcond
 
@@ -95,8 +109,12 @@ private:
   std::string m_inputPath;
   integer m_waitForInput;
   integer m_useChomboPressures;
+  CouplingMode m_couplingMode;
+  integer m_lagCoupling;
 };
 
+ENUM_STRINGS( ChomboIO::CouplingMode, "file", "mpi" )
+
 
 } /* namespace geosx */
 
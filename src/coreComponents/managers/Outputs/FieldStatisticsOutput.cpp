@@ -0,0 +1,228 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file FieldStatisticsOutput.cpp
+ */
+
+#include "FieldStatisticsOutput.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "managers/DomainPartition.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <fstream>
+#include <limits>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+FieldStatisticsOutput::FieldStatisticsOutput( std::string const & name,
+                                              Group * const parent ):
+  OutputBase( name, parent ),
+  m_regionNames(),
+  m_fieldNames(),
+  m_percentiles(),
+  m_numBins( 1000 ),
+  m_headerWritten( false )
+{
+  registerWrapper( viewKeysStruct::regionNamesString, &m_regionNames )->
+    setInputFlag( InputFlags::REQUIRED )->
+    setDescription( "Names of the regions the statistics are computed over" );
+
+  registerWrapper( viewKeysStruct::fieldNamesString, &m_fieldNames )->
+    setInputFlag( InputFlags::REQUIRED )->
+    setDescription( "Names of the fields to sample" );
+
+  registerWrapper( viewKeysStruct::percentilesString, &m_percentiles )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Percentiles (between 0 and 100) reported along with the minimum, maximum and mean" );
+
+  registerWrapper( viewKeysStruct::numBinsString, &m_numBins )->
+    setApplyDefaultValue( 1000 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of histogram bins used to estimate the percentiles" );
+}
+
+FieldStatisticsOutput::~FieldStatisticsOutput()
+{}
+
+void FieldStatisticsOutput::PostProcessInput()
+{
+  GEOSX_ERROR_IF_LT_MSG( m_numBins, 1, "The number of bins of " << getName() << " must be positive." );
+  for( localIndex i = 0; i < m_percentiles.size(); ++i )
+  {
+    GEOSX_ERROR_IF( m_percentiles[i] < 0.0 || m_percentiles[i] > 100.0,
+                    "The percentiles of " << getName() << " must be between 0 and 100." );
+  }
+}
+
+std::vector< real64 > FieldStatisticsOutput::computeStatistics( ElementRegionManager const & elemManager,
+                                                                string const & regionName,
+                                                                string const & fieldName,
+                                                                arrayView1d< real64 const > const & percentiles,
+                                                                integer const numBins )
+{
+  string_array regionNames;
+  regionNames.emplace_back( regionName );
+
+  // Local minimum, maximum, sum and count over the locally owned elements
+  real64 localMin = std::numeric_limits< real64 >::max();
+  real64 localMax = std::numeric_limits< real64 >::lowest();
+  real64 localSum[2] = { 0.0, 0.0 };
+  elemManager.forElementSubRegions( regionNames, [&]( localIndex const, ElementSubRegionBase const & subRegion )
+  {
+    if( !subRegion.hasWrapper( fieldName ) )
+    {
+      return;
+    }
+    arrayView1d< real64 const > const & field = subRegion.getReference< array1d< real64 > >( fieldName );
+    arrayView1d< integer const > const & ghostRank = subRegion.ghostRank();
+    field.move( LvArray::MemorySpace::CPU, false );
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      if( ghostRank[k] < 0 )
+      {
+        localMin = std::min( localMin, field[k] );
+        localMax = std::max( localMax, field[k] );
+        localSum[0] += field[k];
+        localSum[1] += 1.0;
+      }
+    }
+  } );
+
+  real64 const globalMin = MpiWrapper::Min( localMin );
+  real64 const globalMax = MpiWrapper::Max( localMax );
+  real64 globalSum[2];
+  MpiWrapper::allReduce( localSum, globalSum, 2, MPI_SUM, MPI_COMM_GEOSX );
+  real64 const count = globalSum[1];
+
+  std::vector< real64 > statistics = { globalMin, globalMax, count > 0 ? globalSum[0] / count : 0.0 };
+  if( percentiles.empty() )
+  {
+    return statistics;
+  }
+
+  // Histogram of the values between the global minimum and maximum
+  real64 const binWidth = ( globalMax - globalMin ) / numBins;
+  std::vector< real64 > localCounts( numBins, 0.0 );
+  std::vector< real64 > globalCounts( numBins, 0.0 );
+  if( count > 0 && binWidth > 0 )
+  {
+    elemManager.forElementSubRegions( regionNames, [&]( localIndex const, ElementSubRegionBase const & subRegion )
+    {
+      if( !subRegion.hasWrapper( fieldName ) )
+      {
+        return;
+      }
+      arrayView1d< real64 const > const & field = subRegion.getReference< array1d< real64 > >( fieldName );
+      arrayView1d< integer const > const & ghostRank = subRegion.ghostRank();
+      for( localIndex k = 0; k < subRegion.size(); ++k )
+      {
+        if( ghostRank[k] < 0 )
+        {
+          integer const bin = std::min( static_cast< integer >( ( field[k] - globalMin ) / binWidth ), numBins - 1 );
+          localCounts[bin] += 1.0;
+        }
+      }
+    } );
+  }
+  MpiWrapper::allReduce( localCounts.data(), globalCounts.data(), numBins, MPI_SUM, MPI_COMM_GEOSX );
+
+  for( localIndex p = 0; p < percentiles.size(); ++p )
+  {
+    if( count <= 0 || binWidth <= 0 )
+    {
+      statistics.push_back( globalMin );
+      continue;
+    }
+    // Linear interpolation of the cumulative distribution inside of the bin holding the percentile
+    real64 const target = percentiles[p] / 100.0 * count;
+    real64 cumulated = 0.0;
+    integer bin = 0;
+    while( bin < numBins - 1 && cumulated + globalCounts[bin] < target )
+    {
+      cumulated += globalCounts[bin];
+      ++bin;
+    }
+    real64 const fraction = globalCounts[bin] > 0 ? ( target - cumulated ) / globalCounts[bin] : 0.0;
+    statistics.push_back( globalMin + ( bin + std::min( std::max( fraction, 0.0 ), 1.0 ) ) * binWidth );
+  }
+  return statistics;
+}
+
+void FieldStatisticsOutput::Execute( real64 const time_n,
+                                     real64 const GEOSX_UNUSED_PARAM( dt ),
+                                     integer const GEOSX_UNUSED_PARAM( cycleNumber ),
+                                     integer const GEOSX_UNUSED_PARAM( eventCounter ),
+                                     real64 const GEOSX_UNUSED_PARAM ( eventProgress ),
+                                     Group * domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  DomainPartition * domainPartition = Group::group_cast< DomainPartition * >( domain );
+  ElementRegionManager const & elemManager = *domainPartition->getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
+
+  for( string const & regionName : m_regionNames )
+  {
+    GEOSX_ERROR_IF( elemManager.GetRegion( regionName ) == nullptr,
+                    "Region " << regionName << " of " << getName() << " not found." );
+  }
+
+  std::vector< real64 > line;
+  for( string const & regionName : m_regionNames )
+  {
+    for( string const & fieldName : m_fieldNames )
+    {
+      std::vector< real64 > const statistics = computeStatistics( elemManager, regionName, fieldName, m_percentiles, m_numBins );
+      line.insert( line.end(), statistics.begin(), statistics.end() );
+    }
+  }
+
+  if( MpiWrapper::Comm_rank() == 0 )
+  {
+    std::ofstream file( getName() + ".csv", m_headerWritten ? std::ios::app : std::ios::trunc );
+    if( !m_headerWritten )
+    {
+      file << "time";
+      for( string const & regionName : m_regionNames )
+      {
+        for( string const & fieldName : m_fieldNames )
+        {
+          string const prefix = regionName + ":" + fieldName + ":";
+          file << "," << prefix << "min," << prefix << "max," << prefix << "mean";
+          for( localIndex p = 0; p < m_percentiles.size(); ++p )
+          {
+            file << "," << prefix << "p" << m_percentiles[p];
+          }
+        }
+      }
+      file << "\n";
+    }
+    file.precision( std::numeric_limits< real64 >::max_digits10 );
+    file << time_n;
+    for( real64 const value : line )
+    {
+      file << "," << value;
+    }
+    file << "\n";
+  }
+  m_headerWritten = true;
+}
+
+
+REGISTER_CATALOG_ENTRY( OutputBase, FieldStatisticsOutput, std::string const &, Group * const )
+} /* namespace geosx */
@@ -0,0 +1,113 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file FieldStatisticsOutput.hpp
+ */
+
+#ifndef GEOSX_MANAGERS_OUTPUTS_FIELDSTATISTICSOUTPUT_HPP_
+#define GEOSX_MANAGERS_OUTPUTS_FIELDSTATISTICSOUTPUT_HPP_
+
+#include "OutputBase.hpp"
+
+namespace geosx
+{
+
+class ElementRegionManager;
+
+/**
+ * @class FieldStatisticsOutput
+ *
+ * A class writing the statistics of element fields over regions instead of the fields themselves.
+ * Each output appends a line to <name>.csv with the time, then, for each region and each field,
+ * the minimum, the maximum, the mean and the requested percentiles over the locally owned elements.
+ */
+class FieldStatisticsOutput : public OutputBase
+{
+public:
+  /// @copydoc geosx::dataRepository::Group::Group(std::string const & name, Group * const parent)
+  FieldStatisticsOutput( std::string const & name, Group * const parent );
+
+  /// Destructor
+  virtual ~FieldStatisticsOutput() override;
+
+  /**
+   * @brief Catalog name interface
+   * @return This type's catalog name
+   */
+  static string CatalogName() { return "FieldStatistics"; }
+
+  /**
+   * @brief Computes the statistics and appends them to the file.
+   * @copydoc EventBase::Execute()
+   */
+  virtual void Execute( real64 const time_n,
+                        real64 const dt,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        dataRepository::Group * domain ) override;
+
+  /**
+   * @brief Computes the statistics of a field over a region.
+   * @param[in] elemManager the element region manager
+   * @param[in] regionName the name of the region
+   * @param[in] fieldName the name of the element field, an array of reals
+   * @param[in] percentiles the percentiles to compute, between 0 and 100
+   * @param[in] numBins the number of bins of the histogram approximating the percentiles
+   * @return the minimum, the maximum, the mean, and the percentiles
+   * @details The percentiles are interpolated in a histogram of the values between the minimum and the maximum,
+   * their error is bounded by the width of a bin.
+   */
+  static std::vector< real64 > computeStatistics( ElementRegionManager const & elemManager,
+                                                  string const & regionName,
+                                                  string const & fieldName,
+                                                  arrayView1d< real64 const > const & percentiles,
+                                                  integer const numBins );
+
+  /// @cond DO_NOT_DOCUMENT
+  struct viewKeysStruct : OutputBase::viewKeysStruct
+  {
+    static constexpr auto regionNamesString = "regionNames";
+    static constexpr auto fieldNamesString = "fieldNames";
+    static constexpr auto percentilesString = "percentiles";
+    static constexpr auto numBinsString = "numBins";
+  } fieldStatisticsOutputViewKeys;
+  /// @endcond
+
+protected:
+
+  virtual void PostProcessInput() override;
+
+private:
+  /// Names of the regions
+  string_array m_regionNames;
+
+  /// Names of the element fields
+  string_array m_fieldNames;
+
+  /// Percentiles to compute
+  array1d< real64 > m_percentiles;
+
+  /// Number of bins of the histograms approximating the percentiles
+  integer m_numBins;
+
+  /// Flag set once the header of the file is written
+  bool m_headerWritten;
+};
+
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MANAGERS_OUTPUTS_FIELDSTATISTICSOUTPUT_HPP_ */
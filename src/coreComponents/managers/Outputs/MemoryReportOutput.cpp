@@ -0,0 +1,235 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file MemoryReportOutput.cpp
+ */
+
+#include "MemoryReportOutput.hpp"
+
+#include "managers/ObjectManagerBase.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <umpire/ResourceManager.hpp>
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <vector>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace
+{
+
+/// The bytes allocated by the wrappers of a rank
+struct WrapperMemory
+{
+  /// Total bytes
+  real64 total = 0.0;
+  /// Bytes per ObjectManagerBase type
+  std::map< string, real64 > perType;
+  /// Bytes and path of each wrapper
+  std::vector< std::pair< real64, string > > perWrapper;
+};
+
+/**
+ * @brief Accumulate the bytes of the wrappers of a Group tree.
+ * @param[in] group the root of the tree
+ * @param[in] path the path of @p group
+ * @param[in] type the type the wrappers of @p group are attributed to, unless it is an ObjectManagerBase
+ * @param[inout] memory the accumulated bytes
+ */
+void collectWrapperMemory( Group const & group,
+                           string const & path,
+                           string const & type,
+                           WrapperMemory & memory )
+{
+  ObjectManagerBase const * const objectManager = dynamic_cast< ObjectManagerBase const * >( &group );
+  string const groupType = objectManager != nullptr ? objectManager->getCatalogName() : type;
+
+  group.forWrappers( [&]( WrapperBase const & wrapper )
+  {
+    real64 const bytes = wrapper.bytesAllocated();
+    memory.total += bytes;
+    memory.perType[ groupType ] += bytes;
+    memory.perWrapper.emplace_back( bytes, path + "/" + wrapper.getName() );
+  } );
+
+  group.forSubGroups( [&]( Group const & subGroup )
+  {
+    collectWrapperMemory( subGroup, path + "/" + subGroup.getName(), groupType, memory );
+  } );
+}
+
+/**
+ * @brief Format the reduction over the ranks of a number of bytes.
+ * @param[in] bytes the bytes on this rank
+ * @return the minimum, maximum and mean over the ranks, in MB
+ * @note This function is collective.
+ */
+string reduceBytes( real64 const bytes )
+{
+  real64 const toMB = 1.0 / ( 1024.0 * 1024.0 );
+  std::ostringstream oss;
+  oss << MpiWrapper::Min( bytes ) * toMB << " / "
+      << MpiWrapper::Max( bytes ) * toMB << " / "
+      << MpiWrapper::Sum( bytes ) * toMB / MpiWrapper::Comm_size() << " MB";
+  return oss.str();
+}
+
+}
+
+MemoryReportOutput::MemoryReportOutput( std::string const & name,
+                                        Group * const parent ):
+  OutputBase( name, parent ),
+  m_numLargestWrappers( 10 ),
+  m_reportAtSetup( 1 )
+{
+  registerWrapper( viewKeysStruct::numLargestWrappersString, &m_numLargestWrappers )->
+    setApplyDefaultValue( 10 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of largest wrappers listed in the report" );
+
+  registerWrapper( viewKeysStruct::reportAtSetupString, &m_reportAtSetup )->
+    setApplyDefaultValue( 1 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to also log the report at the end of the setup" );
+}
+
+MemoryReportOutput::~MemoryReportOutput()
+{}
+
+void MemoryReportOutput::PostProcessInput()
+{
+  GEOSX_ERROR_IF_LT_MSG( m_numLargestWrappers, 0, "The number of largest wrappers of " << getName() << " must be positive." );
+}
+
+void MemoryReportOutput::report( Group const & root,
+                                 integer const numLargestWrappers,
+                                 string const & title )
+{
+  WrapperMemory memory;
+  collectWrapperMemory( root, "", "Other", memory );
+
+  GEOSX_LOG_RANK_0( title << "\n  Allocated by the wrappers (min / max / mean over the ranks):\n"
+                          << "    total: " << reduceBytes( memory.total ) );
+
+  // some groups may only be created on some ranks: the types of rank 0 are reduced on all the ranks,
+  // with no bytes on the ranks that do not have them, and the types rank 0 does not have are reduced together
+  string typeNames;
+  if( MpiWrapper::Comm_rank() == 0 )
+  {
+    for( std::pair< string const, real64 > const & typeBytes : memory.perType )
+    {
+      typeNames += typeBytes.first + "\n";
+    }
+  }
+  MpiWrapper::Broadcast( typeNames, 0 );
+
+  std::map< string, real64 > otherTypes = memory.perType;
+  std::istringstream typeStream( typeNames );
+  string typeName;
+  while( std::getline( typeStream, typeName ) )
+  {
+    std::map< string, real64 >::const_iterator const typeBytes = memory.perType.find( typeName );
+    GEOSX_LOG_RANK_0( "    " << typeName << ": "
+                            << reduceBytes( typeBytes != memory.perType.end() ? typeBytes->second : 0.0 ) );
+    otherTypes.erase( typeName );
+  }
+
+  real64 otherBytes = 0.0;
+  for( std::pair< string const, real64 > const & typeBytes : otherTypes )
+  {
+    otherBytes += typeBytes.second;
+  }
+  if( MpiWrapper::Max( otherBytes ) > 0.0 )
+  {
+    GEOSX_LOG_RANK_0( "    types missing on rank 0: " << reduceBytes( otherBytes ) );
+  }
+
+  // the largest wrappers of the most loaded rank
+  int const rank = MpiWrapper::Comm_rank();
+  real64 const maxTotal = MpiWrapper::Max( memory.total );
+  int const loadedRank = MpiWrapper::Min( memory.total >= maxTotal ? rank : MpiWrapper::Comm_size() );
+  if( rank == loadedRank )
+  {
+    std::size_t const numListed = std::min( std::size_t( numLargestWrappers ), memory.perWrapper.size() );
+    std::partial_sort( memory.perWrapper.begin(), memory.perWrapper.begin() + numListed, memory.perWrapper.end(),
+                       []( std::pair< real64, string > const & a, std::pair< real64, string > const & b )
+    {
+      return a.first > b.first;
+    } );
+
+    std::ostringstream oss;
+    oss << "  Largest wrappers of the most loaded rank:";
+    for( std::size_t i = 0; i < numListed; ++i )
+    {
+      oss << "\n    " << memory.perWrapper[i].second << ": " << memory.perWrapper[i].first / ( 1024.0 * 1024.0 ) << " MB";
+    }
+    GEOSX_LOG_RANK( oss.str() );
+  }
+  MpiWrapper::Barrier();
+
+  // the allocations through Umpire, including the ones not held by the wrappers (buffers, matrices)
+  std::vector< std::pair< string, umpire::resource::MemoryResourceType > > spaces = { { "host", umpire::resource::Host } };
+#if defined( GEOSX_USE_DEVICE )
+  spaces.emplace_back( "device", umpire::resource::Device );
+  spaces.emplace_back( "pinned", umpire::resource::Pinned );
+#endif
+
+  umpire::ResourceManager & rm = umpire::ResourceManager::getInstance();
+  GEOSX_LOG_RANK_0( "  Allocated through Umpire (min / max / mean over the ranks):" );
+  for( std::pair< string, umpire::resource::MemoryResourceType > const & space : spaces )
+  {
+    umpire::Allocator allocator = rm.getAllocator( space.second );
+    string const current = reduceBytes( allocator.getCurrentSize() );
+    string const highWatermark = reduceBytes( allocator.getHighWatermark() );
+    GEOSX_LOG_RANK_0( "    " << space.first << ": current " << current << ", high-water mark " << highWatermark );
+  }
+}
+
+void MemoryReportOutput::logSetupReport( Group const & root ) const
+{
+  if( m_reportAtSetup )
+  {
+    report( root, m_numLargestWrappers, "Memory report " + getName() + " at the end of the setup:" );
+  }
+}
+
+void MemoryReportOutput::Execute( real64 const time_n,
+                                  real64 const GEOSX_UNUSED_PARAM( dt ),
+                                  integer const cycleNumber,
+                                  integer const GEOSX_UNUSED_PARAM( eventCounter ),
+                                  real64 const GEOSX_UNUSED_PARAM( eventProgress ),
+                                  Group * domain )
+{
+  Group const * root = domain;
+  while( root->getParent() != nullptr )
+  {
+    root = root->getParent();
+  }
+
+  std::ostringstream title;
+  title << "Memory report " << getName() << " at cycle " << cycleNumber << " (time " << time_n << " s):";
+  report( *root, m_numLargestWrappers, title.str() );
+}
+
+
+REGISTER_CATALOG_ENTRY( OutputBase, MemoryReportOutput, std::string const &, Group * const )
+} /* namespace geosx */
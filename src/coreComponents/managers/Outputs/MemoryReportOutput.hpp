@@ -0,0 +1,104 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file MemoryReportOutput.hpp
+ */
+
+#ifndef GEOSX_MANAGERS_OUTPUTS_MEMORYREPORTOUTPUT_HPP_
+#define GEOSX_MANAGERS_OUTPUTS_MEMORYREPORTOUTPUT_HPP_
+
+#include "OutputBase.hpp"
+
+namespace geosx
+{
+
+/**
+ * @class MemoryReportOutput
+ *
+ * A class logging the memory footprint of the data repository. The report walks the whole Group tree
+ * and lists the bytes allocated by the wrappers per ObjectManagerBase type and the largest wrappers of
+ * the most loaded rank, followed by the current size and the high-water mark of the Umpire allocators.
+ * The totals are reduced over the ranks (minimum, maximum and mean). The report is logged at the end
+ * of the setup, and at each execution of the output.
+ */
+class MemoryReportOutput : public OutputBase
+{
+public:
+  /// @copydoc geosx::dataRepository::Group::Group(std::string const & name, Group * const parent)
+  MemoryReportOutput( std::string const & name, Group * const parent );
+
+  /// Destructor
+  virtual ~MemoryReportOutput() override;
+
+  /**
+   * @brief Catalog name interface
+   * @return This type's catalog name
+   */
+  static string CatalogName() { return "MemoryReport"; }
+
+  /**
+   * @brief Logs the memory report.
+   * @copydoc EventBase::Execute()
+   */
+  virtual void Execute( real64 const time_n,
+                        real64 const dt,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        dataRepository::Group * domain ) override;
+
+  /**
+   * @brief Logs the memory report at the end of the setup, if requested.
+   * @param[in] root the root of the Group tree
+   * @note This function is collective.
+   */
+  void logSetupReport( dataRepository::Group const & root ) const;
+
+  /**
+   * @brief Logs the memory report of a Group tree.
+   * @param[in] root the root of the tree
+   * @param[in] numLargestWrappers the number of largest wrappers listed
+   * @param[in] title the title of the report
+   * @note This function is collective.
+   */
+  static void report( dataRepository::Group const & root,
+                      integer const numLargestWrappers,
+                      string const & title );
+
+  /// @cond DO_NOT_DOCUMENT
+  struct viewKeysStruct : OutputBase::viewKeysStruct
+  {
+    static constexpr auto numLargestWrappersString = "numLargestWrappers";
+    static constexpr auto reportAtSetupString = "reportAtSetup";
+  } memoryReportOutputViewKeys;
+  /// @endcond
+
+protected:
+
+  virtual void PostProcessInput() override;
+
+private:
+  /// Number of largest wrappers listed in the report
+  integer m_numLargestWrappers;
+
+  /// Flag to log the report at the end of the setup
+  integer m_reportAtSetup;
+};
+
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MANAGERS_OUTPUTS_MEMORYREPORTOUTPUT_HPP_ */
@@ -0,0 +1,222 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ProbeOutput.cpp
+ */
+
+#include "ProbeOutput.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "managers/DomainPartition.hpp"
+#include "mesh/CellElementSubRegion.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <fstream>
+#include <limits>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+ProbeOutput::ProbeOutput( std::string const & name,
+                          Group * const parent ):
+  OutputBase( name, parent ),
+  m_coordinates(),
+  m_fieldNames(),
+  m_numElementsLocated( -1 ),
+  m_probeElements()
+{
+  registerWrapper( viewKeysStruct::coordinatesString, &m_coordinates )->
+    setInputFlag( InputFlags::REQUIRED )->
+    setDescription( "Coordinates of the probes, one row of three values per probe" );
+
+  registerWrapper( viewKeysStruct::fieldNamesString, &m_fieldNames )->
+    setInputFlag( InputFlags::REQUIRED )->
+    setDescription( "Names of the fields to sample" );
+}
+
+ProbeOutput::~ProbeOutput()
+{}
+
+void ProbeOutput::PostProcessInput()
+{
+  GEOSX_ERROR_IF_NE_MSG( m_coordinates.size( 1 ), 3, "The coordinates of " << getName() << " must have three components." );
+}
+
+void ProbeOutput::locateProbes( ElementRegionManager const & elemManager )
+{
+  localIndex const numProbes = m_coordinates.size( 0 );
+  m_probeElements.resize( numProbes, 3 );
+  m_probeElements.setValues< serialPolicy >( -1 );
+
+  array1d< real64 > localDistance( numProbes );
+  localDistance.setValues< serialPolicy >( std::numeric_limits< real64 >::max() );
+
+  elemManager.forElementSubRegionsComplete< CellElementSubRegion >( [&]( localIndex const er,
+                                                                         localIndex const esr,
+                                                                         ElementRegionBase const &,
+                                                                         CellElementSubRegion const & subRegion )
+  {
+    arrayView2d< real64 const > const & center = subRegion.getElementCenter();
+    arrayView1d< integer const > const & ghostRank = subRegion.ghostRank();
+    center.move( LvArray::MemorySpace::CPU, false );
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      if( ghostRank[k] >= 0 )
+      {
+        continue;
+      }
+      for( localIndex p = 0; p < numProbes; ++p )
+      {
+        real64 distance = 0.0;
+        for( localIndex j = 0; j < 3; ++j )
+        {
+          distance += ( center( k, j ) - m_coordinates( p, j ) ) * ( center( k, j ) - m_coordinates( p, j ) );
+        }
+        if( distance < localDistance[p] )
+        {
+          localDistance[p] = distance;
+          m_probeElements( p, 0 ) = er;
+          m_probeElements( p, 1 ) = esr;
+          m_probeElements( p, 2 ) = k;
+        }
+      }
+    }
+  } );
+
+  // Only the lowest rank holding the nearest cell keeps the probe
+  int const rank = MpiWrapper::Comm_rank();
+  int const size = MpiWrapper::Comm_size();
+  array1d< real64 > globalDistance( numProbes );
+  MpiWrapper::allReduce( localDistance.data(), globalDistance.data(), LvArray::integerConversion< int >( numProbes ), MPI_MIN, MPI_COMM_GEOSX );
+
+  array1d< int > localOwner( numProbes );
+  array1d< int > globalOwner( numProbes );
+  for( localIndex p = 0; p < numProbes; ++p )
+  {
+    localOwner[p] = ( m_probeElements( p, 0 ) >= 0 && localDistance[p] <= globalDistance[p] ) ? rank : size;
+  }
+  MpiWrapper::allReduce( localOwner.data(), globalOwner.data(), LvArray::integerConversion< int >( numProbes ), MPI_MIN, MPI_COMM_GEOSX );
+
+  for( localIndex p = 0; p < numProbes; ++p )
+  {
+    GEOSX_ERROR_IF( globalOwner[p] == size, "No cell found for the point " << p << " of " << getName() );
+    if( globalOwner[p] != rank )
+    {
+      m_probeElements( p, 0 ) = -1;
+    }
+  }
+  m_numElementsLocated = elemManager.getNumberOfElements();
+}
+
+void ProbeOutput::Execute( real64 const time_n,
+                           real64 const dt,
+                           integer const cycleNumber,
+                           integer const eventCounter,
+                           real64 const eventProgress,
+                           Group * domain )
+{
+  std::function< void() > const write = DeferExecution( time_n, dt, cycleNumber, eventCounter, eventProgress, domain );
+  if( write )
+  {
+    write();
+  }
+}
+
+std::function< void() > ProbeOutput::DeferExecution( real64 const time_n,
+                                                     real64 const GEOSX_UNUSED_PARAM( dt ),
+                                                     integer const GEOSX_UNUSED_PARAM( cycleNumber ),
+                                                     integer const GEOSX_UNUSED_PARAM( eventCounter ),
+                                                     real64 const GEOSX_UNUSED_PARAM ( eventProgress ),
+                                                     Group * domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  DomainPartition * domainPartition = Group::group_cast< DomainPartition * >( domain );
+  ElementRegionManager const & elemManager = *domainPartition->getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
+
+  // The cells are searched once, and again only if the mesh changes
+  bool const writeHeader = m_numElementsLocated < 0;
+  if( MpiWrapper::Sum( elemManager.getNumberOfElements() != m_numElementsLocated ? 1 : 0 ) > 0 )
+  {
+    locateProbes( elemManager );
+  }
+
+  localIndex const numProbes = m_coordinates.size( 0 );
+  localIndex const numFields = m_fieldNames.size();
+  array1d< real64 > localValues( numProbes * numFields );
+  array1d< real64 > globalValues( numProbes * numFields );
+  localValues.setValues< serialPolicy >( 0.0 );
+  for( localIndex p = 0; p < numProbes; ++p )
+  {
+    if( m_probeElements( p, 0 ) < 0 )
+    {
+      continue;
+    }
+    ElementSubRegionBase const & subRegion =
+      *elemManager.GetRegion( m_probeElements( p, 0 ) )->GetSubRegion( m_probeElements( p, 1 ) );
+    for( localIndex f = 0; f < numFields; ++f )
+    {
+      if( subRegion.hasWrapper( m_fieldNames[f] ) )
+      {
+        arrayView1d< real64 const > const & field = subRegion.getReference< array1d< real64 > >( m_fieldNames[f] );
+        field.move( LvArray::MemorySpace::CPU, false );
+        localValues[ p * numFields + f ] = field[ m_probeElements( p, 2 ) ];
+      }
+      else
+      {
+        localValues[ p * numFields + f ] = std::numeric_limits< real64 >::quiet_NaN();
+      }
+    }
+  }
+  MpiWrapper::allReduce( localValues.data(), globalValues.data(), LvArray::integerConversion< int >( localValues.size() ), MPI_SUM, MPI_COMM_GEOSX );
+
+  if( MpiWrapper::Comm_rank() != 0 )
+  {
+    return {};
+  }
+
+  // the file is only written from copies, so that it can be written while the next events execute
+  string const fileName = getName() + ".csv";
+  array1d< string > const fieldNames( m_fieldNames );
+  return [fileName, fieldNames, globalValues, numProbes, numFields, writeHeader, time_n]()
+  {
+    std::ofstream file( fileName, writeHeader ? std::ios::trunc : std::ios::app );
+    if( writeHeader )
+    {
+      file << "time";
+      for( localIndex p = 0; p < numProbes; ++p )
+      {
+        for( localIndex f = 0; f < numFields; ++f )
+        {
+          file << "," << fieldNames[f] << "@" << p;
+        }
+      }
+      file << "\n";
+    }
+    file.precision( std::numeric_limits< real64 >::max_digits10 );
+    file << time_n;
+    for( localIndex i = 0; i < globalValues.size(); ++i )
+    {
+      file << "," << globalValues[i];
+    }
+    file << "\n";
+  };
+}
+
+
+REGISTER_CATALOG_ENTRY( OutputBase, ProbeOutput, std::string const &, Group * const )
+} /* namespace geosx */
@@ -0,0 +1,114 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file ProbeOutput.hpp
+ */
+
+#ifndef GEOSX_MANAGERS_OUTPUTS_PROBEOUTPUT_HPP_
+#define GEOSX_MANAGERS_OUTPUTS_PROBEOUTPUT_HPP_
+
+#include "OutputBase.hpp"
+
+namespace geosx
+{
+
+class ElementRegionManager;
+
+/**
+ * @class ProbeOutput
+ *
+ * A class sampling element fields at a set of points instead of writing the whole fields.
+ * Each point is attached once to the locally owned cell with the nearest center over all the ranks,
+ * and each output appends a line to <name>.csv with the time and the value of each field in each of
+ * these cells.
+ */
+class ProbeOutput : public OutputBase
+{
+public:
+  /// @copydoc geosx::dataRepository::Group::Group(std::string const & name, Group * const parent)
+  ProbeOutput( std::string const & name, Group * const parent );
+
+  /// Destructor
+  virtual ~ProbeOutput() override;
+
+  /**
+   * @brief Catalog name interface
+   * @return This type's catalog name
+   */
+  static string CatalogName() { return "Probe"; }
+
+  /**
+   * @brief Samples the fields and appends them to the file.
+   * @copydoc EventBase::Execute()
+   */
+  virtual void Execute( real64 const time_n,
+                        real64 const dt,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        dataRepository::Group * domain ) override;
+
+  /// @copydoc ExecutableGroup::CanDeferExecution()
+  virtual bool CanDeferExecution() const override
+  { return true; }
+
+  /**
+   * @brief Samples the fields, and returns the append to the file on rank 0.
+   * @copydoc ExecutableGroup::DeferExecution()
+   */
+  virtual std::function< void() > DeferExecution( real64 const time_n,
+                                                  real64 const dt,
+                                                  integer const cycleNumber,
+                                                  integer const eventCounter,
+                                                  real64 const eventProgress,
+                                                  dataRepository::Group * domain ) override;
+
+  /// @cond DO_NOT_DOCUMENT
+  struct viewKeysStruct : OutputBase::viewKeysStruct
+  {
+    static constexpr auto coordinatesString = "coordinates";
+    static constexpr auto fieldNamesString = "fieldNames";
+  } probeOutputViewKeys;
+  /// @endcond
+
+protected:
+
+  virtual void PostProcessInput() override;
+
+private:
+
+  /**
+   * @brief Attach each point to the locally owned cell with the nearest center over all the ranks.
+   * @param[in] elemManager the element region manager
+   */
+  void locateProbes( ElementRegionManager const & elemManager );
+
+  /// Coordinates of the points
+  array2d< real64 > m_coordinates;
+
+  /// Names of the element fields, arrays of reals
+  string_array m_fieldNames;
+
+  /// Number of elements when the probes were located, -1 before
+  localIndex m_numElementsLocated;
+
+  /// For each point, the region, subregion and element index of its cell if this rank owns it, -1 otherwise
+  array2d< localIndex > m_probeElements;
+};
+
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MANAGERS_OUTPUTS_PROBEOUTPUT_HPP_ */
@@ -17,11 +17,15 @@
  */
 
 #include "RestartOutput.hpp"
+#include "common/Stopwatch.hpp"
 #include "fileIO/silo/SiloFile.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/Functions/FunctionManager.hpp"
 #include "managers/ProblemManager.hpp"
 #include "managers/FieldSpecification/FieldSpecificationManager.hpp"
+#include "dataRepository/ConduitRestart.hpp"
+
+#include <conduit_relay.hpp>
 
 
 namespace geosx
@@ -31,11 +35,69 @@ using namespace dataRepository;
 
 RestartOutput::RestartOutput( std::string const & name,
                               Group * const parent ):
-  OutputBase( name, parent )
-{}
+  OutputBase( name, parent ),
+  m_ranksPerFile( 1 ),
+  m_asynchronous( 0 ),
+  m_maxPendingWrites( 1 ),
+  m_pendingWrites(),
+  m_maxWriteTime( 0.0 ),
+  m_lastWrittenCycle( -1 ),
+  m_incrementalRestarts( 0 ),
+  m_incrementalRestartsSinceFull( 0 ),
+  m_basePath(),
+  m_baseHashes()
+{
+  registerWrapper( viewKeyStruct::ranksPerFileString, &m_ranksPerFile )->
+    setApplyDefaultValue( 1 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of consecutive ranks writing their restart data into the same file. "
+                    "Values larger than 1 reduce the number of files at the price of serializing the writes within each file." );
+
+  registerWrapper( viewKeyStruct::asynchronousString, &m_asynchronous )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to copy the restart data into a host buffer and write it out in a background thread "
+                    "while the simulation continues. Only supported with ranksPerFile = 1." );
+
+  registerWrapper( viewKeyStruct::maxPendingWritesString, &m_maxPendingWrites )->
+    setApplyDefaultValue( 1 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum number of asynchronous restart writes in flight, "
+                    "a new restart waits for the oldest one to complete beyond that." );
+
+  registerWrapper( viewKeyStruct::incrementalRestartsString, &m_incrementalRestarts )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of incremental restarts written between two full restarts. "
+                    "An incremental restart only holds the arrays changed since the last full restart "
+                    "and requires it to be read back." );
+}
 
 RestartOutput::~RestartOutput()
-{}
+{
+  waitForPendingWrites( 0 );
+}
+
+void RestartOutput::PostProcessInput()
+{
+  GEOSX_ERROR_IF( m_asynchronous && m_ranksPerFile != 1,
+                  "The asynchronous restart output of " << getName() << " requires ranksPerFile = 1." );
+  GEOSX_ERROR_IF_LT_MSG( m_incrementalRestarts, 0,
+                         "The number of incremental restarts of " << getName() << " must be positive or zero." );
+  GEOSX_ERROR_IF_LT_MSG( m_maxPendingWrites, 1,
+                         "The maximum number of pending restart writes of " << getName() << " must be positive." );
+}
+
+void RestartOutput::waitForPendingWrites( integer const maxPending )
+{
+  while( !m_pendingWrites.empty() &&
+         ( m_pendingWrites.size() > static_cast< std::size_t >( maxPending ) ||
+           m_pendingWrites.front().wait_for( std::chrono::seconds( 0 ) ) == std::future_status::ready ) )
+  {
+    m_maxWriteTime = std::max( m_maxWriteTime, m_pendingWrites.front().get() );
+    m_pendingWrites.pop_front();
+  }
+}
 
 void RestartOutput::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
                              real64 const GEOSX_UNUSED_PARAM( dt ),
@@ -46,6 +108,9 @@ void RestartOutput::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
 {
   GEOSX_MARK_FUNCTION;
 
+  Stopwatch watch;
+  m_lastWrittenCycle = cycleNumber;
+
   DomainPartition * domainPartition = Group::group_cast< DomainPartition * >( domain );
   ProblemManager * problemManager = Group::group_cast< ProblemManager * >( domainPartition->getParent());
 
@@ -57,7 +122,66 @@ void RestartOutput::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
   problemManager->prepareToWrite();
   FunctionManager::Instance().prepareToWrite();
   FieldSpecificationManager::get().prepareToWrite();
-  writeTree( fileName );
+
+  // Between two full restarts, only write the arrays which changed since the last full restart.
+  conduit::Node const * tree = &rootConduitNode;
+  conduit::Node incrementalTree;
+  std::string basePath;
+  if( m_incrementalRestarts > 0 )
+  {
+    if( m_basePath.empty() || m_incrementalRestartsSinceFull >= m_incrementalRestarts )
+    {
+      m_baseHashes.clear();
+      hashTree( rootConduitNode, m_baseHashes );
+      m_basePath = fileName;
+      m_incrementalRestartsSinceFull = 0;
+    }
+    else
+    {
+      extractChangedTree( rootConduitNode, m_baseHashes, incrementalTree );
+      tree = &incrementalTree;
+      basePath = m_basePath;
+      ++m_incrementalRestartsSinceFull;
+    }
+  }
+
+  if( !m_asynchronous )
+  {
+    writeTree( fileName, *tree, m_ranksPerFile, basePath );
+    m_maxWriteTime = std::max( m_maxWriteTime, watch.elapsedTime() );
+  }
+  else
+  {
+    // Apply back-pressure when the file system cannot keep up with the restart frequency.
+    waitForPendingWrites( m_maxPendingWrites - 1 );
+
+    conduit::Node root;
+    std::string const filePath = writeRootFile( root, fileName, 1, basePath );
+
+    // Deep copy of the tree, the external arrays it points to keep changing as the simulation goes on.
+    std::shared_ptr< conduit::Node > snapshot = std::make_shared< conduit::Node >();
+    {
+      GEOSX_MARK_SCOPE( copy restart tree );
+      snapshot->set( *tree );
+    }
+
+    // HDF5 is not assumed to be thread safe: each write waits for the previous one before starting.
+    std::shared_future< real64 > previous = m_pendingWrites.empty() ? std::shared_future< real64 >() : m_pendingWrites.back();
+    real64 const copyTime = watch.elapsedTime();
+    GEOSX_LOG_RANK( "Writing out restart file asynchronously at " << filePath );
+    m_pendingWrites.emplace_back( std::async( std::launch::async, [snapshot, filePath, previous, copyTime]()
+    {
+      if( previous.valid() )
+      {
+        previous.wait();
+      }
+      std::lock_guard< std::mutex > const lock( dataRepository::hdf5WriteMutex() );
+      Stopwatch writeWatch;
+      conduit::relay::io::save( *snapshot, filePath, "hdf5" );
+      // The time to wait for the previous writes is not part of the cost of this one
+      return copyTime + writeWatch.elapsedTime();
+    } ).share() );
+  }
   problemManager->finishWriting();
   FunctionManager::Instance().finishWriting();
   FieldSpecificationManager::get().finishWriting();
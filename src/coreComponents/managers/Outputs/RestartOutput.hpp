@@ -21,6 +21,11 @@
 
 #include "OutputBase.hpp"
 
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <map>
+
 
 namespace geosx
 {
@@ -68,15 +73,75 @@ public:
                         real64 const eventProgress,
                         dataRepository::Group * domain ) override
   {
-    Execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+    // The restart of this cycle may already have been written, e.g. by a HaltEvent
+    if( cycleNumber != m_lastWrittenCycle )
+    {
+      Execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+    }
+    waitForPendingWrites( 0 );
   }
 
+  /**
+   * @brief Get the longest wall time taken by a restart write so far, including its asynchronous part.
+   * @return the time in seconds, 0 before the first write completed
+   */
+  real64 getMaxWriteTime() const
+  { return m_maxWriteTime; }
+
   /// @cond DO_NOT_DOCUMENT
   struct viewKeyStruct
   {
     dataRepository::ViewKey writeFEMFaces = { "writeFEMFaces" };
+    static constexpr auto ranksPerFileString = "ranksPerFile";
+    static constexpr auto asynchronousString = "asynchronous";
+    static constexpr auto maxPendingWritesString = "maxPendingWrites";
+    static constexpr auto incrementalRestartsString = "incrementalRestarts";
   } viewKeys;
   /// @endcond
+
+protected:
+
+  virtual void PostProcessInput() override;
+
+private:
+
+  /**
+   * @brief Block until at most @p maxPending asynchronous restart writes are still in flight.
+   * @param maxPending the number of writes allowed to remain in flight
+   *
+   * The completed writes are removed from the front, and their time recorded, without blocking.
+   */
+  void waitForPendingWrites( integer const maxPending );
+
+  /// Number of consecutive ranks writing their restart data into the same file
+  integer m_ranksPerFile;
+
+  /// Flag to copy the restart data into a host buffer and write it out in the background
+  integer m_asynchronous;
+
+  /// Maximum number of asynchronous restart writes in flight before Execute blocks
+  integer m_maxPendingWrites;
+
+  /// Asynchronous restart writes in flight, the oldest first, each returning its wall time
+  std::deque< std::shared_future< real64 > > m_pendingWrites;
+
+  /// Longest wall time taken by a restart write
+  real64 m_maxWriteTime;
+
+  /// Cycle of the last restart written, -1 if none
+  integer m_lastWrittenCycle;
+
+  /// Number of incremental restarts written between two full restarts
+  integer m_incrementalRestarts;
+
+  /// Number of incremental restarts written since the last full restart
+  integer m_incrementalRestartsSinceFull;
+
+  /// Path of the last full restart, the base of the incremental ones
+  string m_basePath;
+
+  /// Hashes of the arrays of the last full restart, indexed by their path in the tree
+  std::map< std::string, std::uint64_t > m_baseHashes;
 };
 
 
@@ -8,6 +8,8 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
   m_format( ),
   m_filename( ),
   m_recordCount( 0 ),
+  m_chunkSize( 1 ),
+  m_compressionLevel( 0 ),
   m_io( )
 {
   registerWrapper( viewKeys::timeHistoryOutputTarget, &m_collectorPaths )->
@@ -30,16 +32,33 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
     setRestartFlags( RestartFlags::WRITE_AND_READ )->
     setDescription( "The current history record to be written, on restart from an earlier time allows use to remove invalid future history." );
 
+  registerWrapper( viewKeys::timeHistoryChunkSize, &m_chunkSize )->
+    setApplyDefaultValue( 1 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "The number of history records per chunk of the data sets in the file, "
+                    "ideally the number of records collected between two outputs." );
+
+  registerWrapper( viewKeys::timeHistoryCompressionLevel, &m_compressionLevel )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "The level of the deflate compression applied to the chunks as they are written, from 0 (no compression) to 9." );
+
 }
 
 void TimeHistoryOutput::initCollectorParallel( ProblemManager & pm, HistoryCollection * collector )
 {
   bool freshInit = ( m_recordCount == 0 );
+  GEOSX_ERROR_IF_LT_MSG( m_chunkSize, 1, "The chunk size of " << getName() << " must be positive." );
+  GEOSX_ERROR_IF( m_compressionLevel < 0 || m_compressionLevel > 9,
+                  "The compression level of " << getName() << " must be between 0 and 9." );
   // rank == 0 do time output for the collector
   for( localIndex ii = 0; ii < collector->getCollectionCount( ); ++ii )
   {
     HistoryMetadata metadata = collector->getMetadata( pm, ii );
-    m_io.emplace_back( std::make_unique< HDFHistIO >( m_filename, metadata, m_recordCount ) );
+    std::unique_ptr< HDFHistIO > io = std::make_unique< HDFHistIO >( m_filename, metadata, m_recordCount );
+    io->setChunkSize( m_chunkSize );
+    io->setCompressionLevel( m_compressionLevel );
+    m_io.emplace_back( std::move( io ) );
     collector->registerBufferCall( ii, [this, ii]() { return m_io[ii]->getBufferHead( ); } );
     m_io.back()->init( !freshInit );
   }
@@ -47,7 +66,10 @@ void TimeHistoryOutput::initCollectorParallel( ProblemManager & pm, HistoryColle
   if( rnk == 0 )
   {
     HistoryMetadata timeMetadata = collector->getTimeMetadata( );
-    m_io.emplace_back( std::make_unique< HDFHistIO >( m_filename, timeMetadata, m_recordCount, 2, 2, MPI_COMM_SELF ) );
+    std::unique_ptr< HDFHistIO > io = std::make_unique< HDFHistIO >( m_filename, timeMetadata, m_recordCount, 2, 2, MPI_COMM_SELF );
+    io->setChunkSize( m_chunkSize );
+    io->setCompressionLevel( m_compressionLevel );
+    m_io.emplace_back( std::move( io ) );
     collector->registerTimeBufferCall( [this]() { return m_io.back()->getBufferHead( ); } );
     m_io.back()->init( !freshInit );
   }
@@ -80,6 +102,8 @@ void TimeHistoryOutput::initCollectorParallel( ProblemManager & pm, HistoryColle
 
 void TimeHistoryOutput::InitializePostSubGroups( Group * const group )
 {
+  // the outputs are initialized again for each realization of an ensemble
+  m_io.clear();
   {
     // check whether to truncate or append to the file up front so we don't have to bother during later accesses
     HDFFile( m_filename, (m_recordCount == 0), true, MPI_COMM_GEOSX );
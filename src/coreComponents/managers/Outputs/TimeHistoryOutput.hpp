@@ -88,6 +88,8 @@ public:
     static constexpr auto timeHistoryOutputFilename = "filename";
     static constexpr auto timeHistoryOutputFormat = "format";
     static constexpr auto timeHistoryRestart = "restart";
+    static constexpr auto timeHistoryChunkSize = "chunkSize";
+    static constexpr auto timeHistoryCompressionLevel = "compressionLevel";
   } timeHistoryOutputViewKeys;
   /// @endcond
 
@@ -108,6 +110,10 @@ private:
   string m_filename;
   /// The discrete number of time history states expected to be written to the file
   integer m_recordCount;
+  /// The number of history records per chunk of the data sets in the file
+  integer m_chunkSize;
+  /// The level of the deflate compression of the data sets in the file
+  integer m_compressionLevel;
   /// The buffered time history output objects for each collector to collect data into and to use to configure/write to file.
   std::vector< std::unique_ptr< BufferedHistoryIO > > m_io;
 };
@@ -50,6 +50,23 @@ VTKOutput::VTKOutput( std::string const & name,
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Output the data in binary format" );
 
+  registerWrapper( viewKeysStruct::asynchronousString, &m_asynchronous )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to copy the fields into VTK objects and write the files out in a background task "
+                    "while the simulation continues" );
+
+  registerWrapper( viewKeysStruct::compressionString, &m_compression )->
+    setApplyDefaultValue( "zlib" )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Compression of the binary data: none, zlib or lz4" );
+
+  registerWrapper( viewKeysStruct::cacheGeometryString, &m_cacheGeometry )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to build the points and cells of the cell element regions once and reuse them "
+                    "as long as the mesh topology does not change" );
+
 }
 
 VTKOutput::~VTKOutput()
@@ -74,6 +91,24 @@ void VTKOutput::Execute( real64 const time_n,
     m_writer.SetOutputMode( vtk::VTKOutputMode::ASCII );
   }
   m_writer.SetPlotLevel( m_plotLevel );
+  m_writer.SetAsynchronous( m_asynchronous );
+  m_writer.SetCacheGeometry( m_cacheGeometry );
+  if( m_compression == "none" )
+  {
+    m_writer.SetCompression( vtk::VTKCompression::NONE );
+  }
+  else if( m_compression == "zlib" )
+  {
+    m_writer.SetCompression( vtk::VTKCompression::ZLIB );
+  }
+  else if( m_compression == "lz4" )
+  {
+    m_writer.SetCompression( vtk::VTKCompression::LZ4 );
+  }
+  else
+  {
+    GEOSX_ERROR( "Unknown compression " << m_compression << " of the VTK output " << getName() );
+  }
   m_writer.Write( time_n, cycleNumber, *domainPartition );
 }
 
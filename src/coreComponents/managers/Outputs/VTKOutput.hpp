@@ -78,6 +78,9 @@ public:
     static constexpr auto writeFEMFaces = "writeFEMFaces";
     static constexpr auto plotLevel = "plotLevel";
     static constexpr auto binaryString = "writeBinaryData";
+    static constexpr auto asynchronousString = "asynchronous";
+    static constexpr auto compressionString = "compression";
+    static constexpr auto cacheGeometryString = "cacheGeometry";
 
   } vtkOutputViewKeys;
   /// @endcond
@@ -89,6 +92,12 @@ private:
 
   integer m_writeBinaryData;
 
+  integer m_asynchronous;
+
+  string m_compression;
+
+  integer m_cacheGeometry;
+
   vtk::VTKPolyDataWriterInterface m_writer;
 
 };
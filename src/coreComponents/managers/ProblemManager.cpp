@@ -16,28 +16,44 @@
 #include "ProblemManager.hpp"
 
 #include "codingUtilities/StringUtilities.hpp"
+#include "common/LaunchTuner.hpp"
 #include "common/Path.hpp"
+#include "common/TaskGraph.hpp"
 #include "common/TimingMacros.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
+#include "dataRepository/BufferOps.hpp"
 #include "dataRepository/ConduitRestart.hpp"
+#include "dataRepository/MigrationAudit.hpp"
 #include "dataRepository/RestartFlags.hpp"
+#include "dataRepository/SetupProfiler.hpp"
 #include "finiteElement/FiniteElementDiscretization.hpp"
 #include "finiteElement/FiniteElementDiscretizationManager.hpp"
+#include "finiteElement/kernelInterface/KernelBase.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/FieldSpecification/FieldSpecificationManager.hpp"
 #include "managers/initialization.hpp"
+#include "managers/MeshCache.hpp"
 #include "managers/NumericalMethodsManager.hpp"
 #include "managers/Outputs/OutputManager.hpp"
+#include "managers/Outputs/MemoryReportOutput.hpp"
+#include "managers/Outputs/TimeHistoryOutput.hpp"
 #include "managers/Tasks/TasksManager.hpp"
+#include "mesh/CellBlockManager.hpp"
 #include "mesh/MeshBody.hpp"
+#include "meshUtilities/MeshGeneratorBase.hpp"
 #include "meshUtilities/MeshManager.hpp"
 #include "meshUtilities/MeshUtilities.hpp"
 #include "meshUtilities/SimpleGeometricObjects/GeometricObjectManager.hpp"
 #include "meshUtilities/SimpleGeometricObjects/SimpleGeometricObjectBase.hpp"
+#include "mpiCommunications/CommunicationStatistics.hpp"
 #include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/DeterministicReduction.hpp"
+#include "mpiCommunications/LoadBalanceStatistics.hpp"
 #include "mpiCommunications/SpatialPartition.hpp"
 #include "physicsSolvers/PhysicsSolverManager.hpp"
 #include "physicsSolvers/SolverBase.hpp"
+#include "physicsSolvers/surfaceGeneration/EmbeddedSurfaceGenerator.hpp"
+#include "physicsSolvers/surfaceGeneration/SurfaceGenerator.hpp"
 
 // System includes
 #include <vector>
@@ -45,6 +61,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include <algorithm>
+#include <sstream>
 
 namespace geosx
 {
@@ -146,6 +163,60 @@ ProblemManager::ProblemManager( const std::string & name,
     setRestartFlags( RestartFlags::WRITE )->
     setDescription( "Whether to disallow using pinned memory allocations for MPI communication buffers." );
 
+  commandLine->registerWrapper< integer >( viewKeys.useGpuAwareMPI.Key( ) )->
+    setApplyDefaultValue( 0 )->
+    setRestartFlags( RestartFlags::WRITE )->
+    setDescription( "Whether the MPI implementation is GPU-aware, in which case device synchronization buffers are passed directly to MPI." );
+
+  commandLine->registerWrapper< integer >( viewKeys.useNeighborhoodCollectives.Key( ) )->
+    setApplyDefaultValue( 0 )->
+    setRestartFlags( RestartFlags::WRITE )->
+    setDescription( "Whether to use MPI neighborhood collectives for ghost discovery and field synchronization." );
+
+  commandLine->registerWrapper< integer >( viewKeys.useSharedMemoryHalo.Key( ) )->
+    setApplyDefaultValue( 0 )->
+    setRestartFlags( RestartFlags::WRITE )->
+    setDescription( "Whether to synchronize fields with the neighbors on the same node through MPI shared-memory windows." );
+
+  commandLine->registerWrapper< integer >( viewKeys.communicationStatistics.Key( ) )->
+    setApplyDefaultValue( 0 )->
+    setRestartFlags( RestartFlags::WRITE )->
+    setDescription( "Whether to record per-neighbor communication statistics and print a summary at the end of the run." );
+
+  commandLine->registerWrapper< integer >( viewKeys.loadBalanceReportInterval.Key( ) )->
+    setApplyDefaultValue( -1 )->
+    setRestartFlags( RestartFlags::WRITE )->
+    setDescription( "Number of cycles between two reports of the load imbalance, 0 to only report at the end of the run, -1 if disabled." );
+
+  commandLine->registerWrapper< integer >( viewKeys.compressGhostBuffers.Key( ) )->
+    setApplyDefaultValue( 0 )->
+    setRestartFlags( RestartFlags::WRITE )->
+    setDescription( "Whether to compress the buffers exchanged to build the ghosts and the synchronization lists." );
+
+  commandLine->registerWrapper< integer >( viewKeys.compactGlobalIndices.Key( ) )->
+    setApplyDefaultValue( 0 )->
+    setRestartFlags( RestartFlags::WRITE )->
+    setDescription( "Whether to pack the global indices of the maps and relations as variable-length differences." );
+
+  commandLine->registerWrapper< integer >( viewKeys.concurrentAssembly.Key( ) )->
+    setApplyDefaultValue( 0 )->
+    setRestartFlags( RestartFlags::WRITE )->
+    setDescription( "Whether to assemble the independent blocks of the coupled solvers concurrently." );
+
+  commandLine->registerWrapper< integer >( viewKeys.deterministicReductions.Key( ) )->
+    setApplyDefaultValue( 0 )->
+    setRestartFlags( RestartFlags::WRITE )->
+    setDescription( "Whether to sum the residual norms and the dot products in a fixed order, with compensation." );
+
+  commandLine->registerWrapper< string >( viewKeys.launchTuningCache.Key( ) )->
+    setRestartFlags( RestartFlags::WRITE )->
+    setDescription( "Name of the file caching the tuned block sizes of the device kernel launches, empty to disable the tuning." );
+
+  commandLine->registerWrapper< integer >( viewKeys.fuseKernelLaunches.Key( ) )->
+    setApplyDefaultValue( 0 )->
+    setRestartFlags( RestartFlags::WRITE )->
+    setDescription( "Whether to launch the subregions sharing an element type and a constitutive model together on the device." );
+
 }
 
 ProblemManager::~ProblemManager()
@@ -159,19 +230,41 @@ Group * ProblemManager::CreateChild( string const & GEOSX_UNUSED_PARAM( childKey
 void ProblemManager::ProblemSetup()
 {
   GEOSX_MARK_FUNCTION;
-  PostProcessInputRecursive();
-
-  GenerateMesh();
-
-  ApplyNumericalMethods();
-
-  RegisterDataOnMeshRecursive( GetGroup< DomainPartition >( groupKeys.domain )->getMeshBodies() );
-
-  Initialize( this );
+  {
+    SetupProfiler::ScopedPhase const phase( "PostProcessInput" );
+    PostProcessInputRecursive();
+  }
+  {
+    SetupProfiler::ScopedPhase const phase( "GenerateMesh" );
+    GenerateMesh();
+  }
+  {
+    SetupProfiler::ScopedPhase const phase( "ApplyNumericalMethods" );
+    ApplyNumericalMethods();
+  }
+  {
+    SetupProfiler::ScopedPhase const phase( "RegisterDataOnMesh" );
+    RegisterDataOnMeshRecursive( GetGroup< DomainPartition >( groupKeys.domain )->getMeshBodies() );
+  }
+  {
+    SetupProfiler::ScopedPhase const phase( "Initialize" );
+    Initialize( this );
+  }
+  {
+    SetupProfiler::ScopedPhase const phase( "ApplyInitialConditions" );
+    ApplyInitialConditions();
+  }
+  {
+    SetupProfiler::ScopedPhase const phase( "InitializePostInitialConditions" );
+    InitializePostInitialConditions( this );
+  }
 
-  ApplyInitialConditions();
+  GetGroup< OutputManager >( groupKeys.outputManager )->forSubGroups< MemoryReportOutput >( [&]( MemoryReportOutput const & output )
+  {
+    output.logSetupReport( *this );
+  } );
 
-  InitializePostInitialConditions( this );
+  SetupProfiler::printSummary();
 }
 
 
@@ -189,6 +282,17 @@ void ProblemManager::ParseCommandLineInput()
   commandLine->getReference< integer >( viewKeys.overridePartitionNumbers ) = opts.overridePartitionNumbers;
   commandLine->getReference< integer >( viewKeys.useNonblockingMPI ) = opts.useNonblockingMPI;
   commandLine->getReference< integer >( viewKeys.suppressPinned ) = opts.suppressPinned;
+  commandLine->getReference< integer >( viewKeys.useGpuAwareMPI ) = opts.useGpuAwareMPI;
+  commandLine->getReference< integer >( viewKeys.useNeighborhoodCollectives ) = opts.useNeighborhoodCollectives;
+  commandLine->getReference< integer >( viewKeys.useSharedMemoryHalo ) = opts.useSharedMemoryHalo;
+  commandLine->getReference< integer >( viewKeys.communicationStatistics ) = opts.communicationStatistics;
+  commandLine->getReference< integer >( viewKeys.loadBalanceReportInterval ) = opts.loadBalanceReportInterval;
+  commandLine->getReference< integer >( viewKeys.compressGhostBuffers ) = opts.compressGhostBuffers;
+  commandLine->getReference< integer >( viewKeys.compactGlobalIndices ) = opts.compactGlobalIndices;
+  commandLine->getReference< integer >( viewKeys.concurrentAssembly ) = opts.concurrentAssembly;
+  commandLine->getReference< integer >( viewKeys.deterministicReductions ) = opts.deterministicReductions;
+  commandLine->getReference< string >( viewKeys.launchTuningCache ) = opts.launchTuningCache;
+  commandLine->getReference< integer >( viewKeys.fuseKernelLaunches ) = opts.fuseKernelLaunches;
 
   std::string & inputFileName = commandLine->getReference< std::string >( viewKeys.inputFileName );
   inputFileName = opts.inputFileName;
@@ -224,6 +328,8 @@ void ProblemManager::ParseCommandLineInput()
   {
     chai::ArrayManager::getInstance()->disableCallbacks();
   }
+
+  dataRepository::MigrationAudit::setEnabled( opts.migrationAudit != 0 );
 }
 
 
@@ -420,6 +526,10 @@ void ProblemManager::SetSchemaDeviations( xmlWrapper::xmlNode schemaRoot,
 
     run->registerWrapper< array1d< int > >( "strongScaling" )->setInputFlag( InputFlags::OPTIONAL )->
       setDescription( "Repeat the benchmark N times, scaling the number of nodes in the benchmark by these values." );
+
+    run->registerWrapper< array1d< int > >( "weakScaling" )->setInputFlag( InputFlags::OPTIONAL )->
+      setDescription( "Repeat the benchmark N times, scaling the number of nodes and the number of elements of the "
+                      "internal meshes in the benchmark by these values." );
   }
 
   schemaUtilities::SchemaConstruction( benchmarks, schemaRoot, targetChoiceNode, documentationType );
@@ -428,6 +538,7 @@ void ProblemManager::SetSchemaDeviations( xmlWrapper::xmlNode schemaRoot,
 
 void ProblemManager::ParseInputFile()
 {
+  SetupProfiler::ScopedPhase const parsePhase( "ParseInputFile" );
   DomainPartition * domain  = getDomainPartition();
 
   Group * commandLine = GetGroup< Group >( groupKeys.commandLine );
@@ -463,7 +574,7 @@ void ProblemManager::ParseInputFile()
 
 
   // Load preprocessed xml file and check for errors
-  xmlResult = xmlDocument.load_file( inputFileName.c_str());
+  xmlResult = xmlWrapper::loadFile( xmlDocument, inputFileName );
   if( !xmlResult )
   {
     GEOSX_LOG_RANK_0( "XML parsed with errors!" );
@@ -506,6 +617,39 @@ void ProblemManager::PostProcessInput()
   integer const & suppressPinned = commandLine->getReference< integer >( viewKeys.suppressPinned );
   setPreferPinned((suppressPinned == 0));
 
+  integer const & useGpuAwareMPI = commandLine->getReference< integer >( viewKeys.useGpuAwareMPI );
+  setUseGpuAwareMPI( useGpuAwareMPI != 0 );
+
+  integer const & useNeighborhoodCollectives = commandLine->getReference< integer >( viewKeys.useNeighborhoodCollectives );
+  CommunicationTools::setUseNeighborhoodCollectives( useNeighborhoodCollectives != 0 );
+
+  integer const & useSharedMemoryHalo = commandLine->getReference< integer >( viewKeys.useSharedMemoryHalo );
+  CommunicationTools::setUseSharedMemoryHalo( useSharedMemoryHalo != 0 );
+
+  integer const & communicationStatistics = commandLine->getReference< integer >( viewKeys.communicationStatistics );
+  CommunicationStatistics::setEnabled( communicationStatistics != 0 );
+
+  integer const & loadBalanceReportInterval = commandLine->getReference< integer >( viewKeys.loadBalanceReportInterval );
+  LoadBalanceStatistics::setEnabled( loadBalanceReportInterval >= 0 );
+  LoadBalanceStatistics::setReportInterval( std::max( loadBalanceReportInterval, 0 ) );
+
+  integer const & compressGhostBuffers = commandLine->getReference< integer >( viewKeys.compressGhostBuffers );
+  CommunicationTools::setCompressGhostBuffers( compressGhostBuffers != 0 );
+
+  integer const & compactGlobalIndices = commandLine->getReference< integer >( viewKeys.compactGlobalIndices );
+  bufferOps::setCompactGlobalIndices( compactGlobalIndices != 0 );
+
+  integer const & concurrentAssembly = commandLine->getReference< integer >( viewKeys.concurrentAssembly );
+  TaskGraph::setConcurrent( concurrentAssembly != 0 );
+
+  integer const & deterministicReductions = commandLine->getReference< integer >( viewKeys.deterministicReductions );
+  DeterministicReduction::setEnabled( deterministicReductions != 0 );
+
+  LaunchTuner::setCacheFile( commandLine->getReference< string >( viewKeys.launchTuningCache ) );
+
+  integer const & fuseKernelLaunches = commandLine->getReference< integer >( viewKeys.fuseKernelLaunches );
+  finiteElement::setFuseSubRegionLaunches( fuseKernelLaunches != 0 );
+
   PartitionBase & partition = domain->getReference< PartitionBase >( keys::partitionManager );
   bool repartition = false;
   integer xpar = 1;
@@ -575,6 +719,54 @@ void ProblemManager::GenerateMesh()
   GEOSX_MARK_FUNCTION;
   DomainPartition * domain  = getDomainPartition();
 
+  // Without topology changes, the capacity reserved in the relation maps for new faces and edges is never used.
+  bool changesMeshTopology = false;
+  m_physicsSolverManager->forSubGroups< SolverBase >( [&]( SolverBase const & solver )
+  {
+    changesMeshTopology = changesMeshTopology || solver.changesMeshTopology();
+  } );
+
+  // The preprocessed mesh is cached as long as it is not modified by the solvers.
+  string const & cacheDirectory = getCommandLineOptions().meshCacheDirectory;
+  GEOSX_LOG_RANK_0_IF( !cacheDirectory.empty() && changesMeshTopology,
+                       "The mesh is not cached, since a solver changes its topology" );
+  bool const useCache = !cacheDirectory.empty() && !changesMeshTopology;
+  MeshCache const meshCache( cacheDirectory, useCache ? meshCacheKey() : "" );
+
+  if( !useCache || !meshCache.read( *domain ) )
+  {
+    PreprocessMesh( changesMeshTopology );
+    if( useCache )
+    {
+      meshCache.write( *domain );
+    }
+  }
+
+  // Report the balance of the decomposition, the rank owning the most elements sets the pace of the run.
+  MeshLevel * const meshLevel = domain->getMeshBody( 0 )->getMeshLevel( 0 );
+  localIndex numOwnedElems = 0;
+  meshLevel->getElemManager()->forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase const & subRegion )
+  {
+    numOwnedElems += subRegion.GetNumberOfLocalIndices();
+  } );
+  localIndex const minOwnedElems = MpiWrapper::Min( numOwnedElems );
+  localIndex const maxOwnedElems = MpiWrapper::Max( numOwnedElems );
+  globalIndex const numElems = MpiWrapper::Sum( globalIndex( numOwnedElems ) );
+  real64 const meanOwnedElems = real64( numElems ) / MpiWrapper::Comm_size();
+  GEOSX_LOG_RANK_0( "Elements owned per rank: min = " << minOwnedElems << ", max = " << maxOwnedElems
+                                                      << ", mean = " << meanOwnedElems
+                                                      << ", imbalance (max / mean) = "
+                                                      << ( meanOwnedElems > 0 ? maxOwnedElems / meanOwnedElems : 1.0 ) );
+}
+
+
+
+
+void ProblemManager::PreprocessMesh( bool const changesMeshTopology )
+{
+  GEOSX_MARK_FUNCTION;
+  DomainPartition * domain  = getDomainPartition();
+
   MeshManager * meshManager = this->GetGroup< MeshManager >( groupKeys.meshManager );
   meshManager->GenerateMeshes( domain );
   Group * const cellBlockManager = domain->GetGroup( keys::cellManager );
@@ -600,6 +792,13 @@ void ProblemManager::GenerateMesh()
                                        nodeManager );
       nodeManager->ConstructGlobalToLocalMap();
 
+      // Renumber before the element regions, faces and edges are derived from the nodes and cell blocks
+      MeshGeneratorBase const * const meshGenerator = meshManager->GetGroup< MeshGeneratorBase >( meshBody->getName() );
+      if( meshGenerator != nullptr )
+      {
+        meshGenerator->RenumberMesh( *nodeManager, *Group::group_cast< CellBlockManager * >( cellBlockManager ) );
+      }
+
       elemManager->GenerateMesh( cellBlockManager );
       nodeManager->SetElementMaps( meshLevel->getElemManager() );
 
@@ -618,7 +817,23 @@ void ProblemManager::GenerateMesh()
                                                        *faceManager );
       } );
 
-      elemManager->GenerateCellToEdgeMaps( faceManager );
+      // The cell to edge maps are only built for the solvers using them, otherwise they don't hold any value.
+      bool requiresCellToEdgeMaps = false;
+      m_physicsSolverManager->forSubGroups< SolverBase >( [&]( SolverBase const & solver )
+      {
+        requiresCellToEdgeMaps = requiresCellToEdgeMaps || solver.requiresCellToEdgeMaps();
+      } );
+      if( requiresCellToEdgeMaps )
+      {
+        elemManager->GenerateCellToEdgeMaps( faceManager );
+      }
+      else
+      {
+        elemManager->forElementSubRegions< CellElementSubRegion >( []( CellElementSubRegion & subRegion )
+        {
+          subRegion.edgeList().resize( subRegion.size(), 0 );
+        } );
+      }
 
       elemManager->GenerateAggregates( faceManager, nodeManager );
 
@@ -640,6 +855,51 @@ void ProblemManager::GenerateMesh()
   domain->SetupCommunications( useNonblockingMPI );
   faceManager->SetIsExternal();
   edgeManager->SetIsExternal( faceManager );
+
+  // Without topology changes, the capacity reserved in the relation maps for new faces and edges is never used.
+  if( !changesMeshTopology )
+  {
+    meshLevel->getNodeManager()->shrinkRelationMaps();
+    edgeManager->shrinkRelationMaps();
+    faceManager->shrinkRelationMaps();
+  }
+}
+
+
+string ProblemManager::meshCacheKey() const
+{
+  Group const * commandLine = GetGroup< Group >( groupKeys.commandLine );
+  PhysicsSolverManager const * physicsSolverManager = m_physicsSolverManager;
+
+  bool requiresCellToEdgeMaps = false;
+  physicsSolverManager->forSubGroups< SolverBase >( [&]( SolverBase const & solver )
+  {
+    requiresCellToEdgeMaps = requiresCellToEdgeMaps || solver.requiresCellToEdgeMaps();
+  } );
+
+  std::ostringstream key;
+  key << GEOSX_VERSION_FULL << "\n";
+  key << "ranks " << MpiWrapper::Comm_size( MPI_COMM_GEOSX ) << "\n";
+  if( commandLine->getReference< integer >( viewKeys.overridePartitionNumbers ) )
+  {
+    key << "partitions " << commandLine->getReference< integer >( viewKeys.xPartitionsOverride )
+        << " " << commandLine->getReference< integer >( viewKeys.yPartitionsOverride )
+        << " " << commandLine->getReference< integer >( viewKeys.zPartitionsOverride ) << "\n";
+  }
+  key << "cellToEdgeMaps " << requiresCellToEdgeMaps << "\n";
+
+  // The mesh files are only described by their names, a modified file needs a new cache.
+  for( string const & inputName : { groupKeys.meshManager.Key(),
+                                    groupKeys.geometricObjectManager.Key(),
+                                    getDomainPartition()->getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager()->getName() } )
+  {
+    for( xmlWrapper::xmlNode node = xmlProblemNode.child( inputName.c_str() ); node; node = node.next_sibling( inputName.c_str() ) )
+    {
+      node.print( key, "", pugi::format_raw );
+      key << "\n";
+    }
+  }
+  return key.str();
 }
 
 
@@ -650,7 +910,11 @@ void ProblemManager::ApplyNumericalMethods()
   ConstitutiveManager const * constitutiveManager = domain->GetGroup< ConstitutiveManager >( keys::ConstitutiveManager );
   Group * const meshBodies = domain->getMeshBodies();
 
-  map< std::pair< string, string >, localIndex > const regionQuadrature = calculateRegionQuadrature( *meshBodies );
+  map< std::pair< string, string >, localIndex > regionQuadrature;
+  {
+    SetupProfiler::ScopedPhase const phase( "calculateRegionQuadrature" );
+    regionQuadrature = calculateRegionQuadrature( *meshBodies );
+  }
 
   setRegionQuadrature( *meshBodies,
                        *constitutiveManager,
@@ -681,6 +945,9 @@ map< std::pair< string, string >, localIndex > ProblemManager::calculateRegionQu
       FiniteElementDiscretization const * const
       feDiscretization = feDiscretizationManager.GetGroup< FiniteElementDiscretization >( discretizationName );
 
+      // Memory used by the precomputed shape function gradients of this discretization
+      localIndex shapeGradientStorageSize = 0;
+
 
       for( localIndex a=0; a<meshBodies.GetSubGroups().size(); ++a )
       {
@@ -717,6 +984,8 @@ map< std::pair< string, string >, localIndex > ProblemManager::calculateRegionQu
                   localIndex const numQuadraturePoints = FE_TYPE::numQuadraturePoints;
 
                   feDiscretization->CalculateShapeFunctionGradients( X, &subRegion, finiteElement );
+                  shapeGradientStorageSize +=
+                    FiniteElementDiscretization::shapeGradientStorageSize< FE_TYPE >( subRegion.size() );
 
                   localIndex & numQuadraturePointsInList = regionQuadrature[ std::make_pair( regionName,
                                                                                              subRegion.getName() ) ];
@@ -738,6 +1007,15 @@ map< std::pair< string, string >, localIndex > ProblemManager::calculateRegionQu
           }
         }
       }
+
+      if( feDiscretization != nullptr )
+      {
+        real64 const shapeGradientStorageMB = MpiWrapper::Sum( shapeGradientStorageSize ) / ( 1024.0 * 1024.0 );
+        GEOSX_LOG_RANK_0( "Solver " << solver->getName() << ", discretization " << discretizationName << ": "
+                                    << EnumStrings< finiteElement::ShapeGradientStorage >::toString( feDiscretization->getShapeGradientStorage() )
+                                    << " shape function gradients in kernels, precomputed gradients use "
+                                    << shapeGradientStorageMB << " MB" );
+      }
     } // if( solver!=nullptr )
   }
 
@@ -789,6 +1067,20 @@ void ProblemManager::RunSimulation()
 {
   DomainPartition * domain = getDomainPartition();
   m_eventManager->Run( domain );
+
+  m_physicsSolverManager->forSubGroups< SolverBase >( [&]( SolverBase const & solver )
+  {
+    if( solver.getSolverStatistics().numTimeSteps() > 0 )
+    {
+      solver.getSolverStatistics().printSummary( solver.getName() );
+    }
+  } );
+
+  if( LoadBalanceStatistics::isEnabled() )
+  {
+    domain->recordRankSize();
+    LoadBalanceStatistics::printSummary();
+  }
 }
 
 DomainPartition * ProblemManager::getDomainPartition()
@@ -807,9 +1099,128 @@ void ProblemManager::ApplyInitialConditions()
   FieldSpecificationManager::get().ApplyInitialConditions( domain );
 }
 
+void ProblemManager::RunEnsemble( string const & ensembleFileName )
+{
+  GEOSX_MARK_FUNCTION;
+
+  m_physicsSolverManager->forSubGroups< SurfaceGenerator, EmbeddedSurfaceGenerator >( [&]( SolverBase const & solver )
+  {
+    GEOSX_ERROR( "The ensembles need a fixed mesh, which the solver " << solver.getName() << " modifies" );
+  } );
+
+  xmlWrapper::xmlDocument ensembleDocument;
+  xmlWrapper::xmlResult const result = ensembleDocument.load_file( ensembleFileName.c_str() );
+  GEOSX_ERROR_IF( !result, "Could not read the ensemble file " << ensembleFileName << ": " << result.description() );
+  xmlWrapper::xmlNode const ensembleNode = ensembleDocument.child( "Ensemble" );
+  GEOSX_ERROR_IF( ensembleNode.empty(), "The ensemble file " << ensembleFileName << " has no Ensemble element" );
+
+  // the state after the setup, as written to a restart file but kept in memory
+  conduit::Node initialState;
+  prepareToWrite();
+  initialState.set( dataRepository::rootConduitNode );
+  finishWriting();
+
+  CommandLineOptions const & opts = getCommandLineOptions();
+  DomainPartition * const domain = getDomainPartition();
+  OutputManager & outputManager = *GetGroup< OutputManager >( groupKeys.outputManager );
+
+  integer realizationIndex = 0;
+  for( xmlWrapper::xmlNode realizationNode = ensembleNode.child( "Realization" );
+       realizationNode;
+       realizationNode = realizationNode.next_sibling( "Realization" ), ++realizationIndex )
+  {
+    if( realizationIndex % opts.ensembleGroups != opts.ensembleGroupIndex )
+    {
+      continue;
+    }
+
+    xmlWrapper::xmlAttribute const nameAttribute = realizationNode.attribute( "name" );
+    string const realizationName = nameAttribute ? string( nameAttribute.value() ) : "realization" + std::to_string( realizationIndex );
+    GEOSX_LOG_RANK_0( "Running realization " << realizationName );
+
+    if( MpiWrapper::Comm_rank( MPI_COMM_GEOSX ) == 0 )
+    {
+      makeDirsForPath( realizationName );
+    }
+    MpiWrapper::Barrier( MPI_COMM_GEOSX );
+    GEOSX_ERROR_IF( chdir( realizationName.c_str() ) != 0, "Could not change to the directory of the realization " << realizationName );
+
+    // the state is restored before the parameters are set, since some of them are saved to the restart files
+    dataRepository::rootConduitNode.update( initialState );
+    loadFromConduit();
+    applyRealizationParameters( realizationNode );
+    ApplyInitialConditions();
+    postRestartInitializationRecursive( domain );
+
+    // the time histories are written to new files in the directory of the realization
+    outputManager.forSubGroups< TimeHistoryOutput >( [&]( TimeHistoryOutput & output )
+    {
+      output.InitializePostSubGroups( this );
+    } );
+
+    RunSimulation();
+
+    GEOSX_ERROR_IF( chdir( ".." ) != 0, "Could not leave the directory of the realization " << realizationName );
+  }
+}
+
+void ProblemManager::applyRealizationParameters( xmlWrapper::xmlNode const & realizationNode )
+{
+  DomainPartition * const domain = getDomainPartition();
+  Group const * const constitutiveManager = domain->GetGroup( keys::ConstitutiveManager );
+
+  for( xmlWrapper::xmlNode setNode = realizationNode.child( "Set" ); setNode; setNode = setNode.next_sibling( "Set" ) )
+  {
+    xmlWrapper::xmlAttribute const targetAttribute = setNode.attribute( "target" );
+    GEOSX_ERROR_IF( targetAttribute.empty(), "A parameter of " << realizationNode.path() << " has no target" );
+    string const targetPath = targetAttribute.value();
+
+    Group * const target = GetGroupByPath< Group >( targetPath );
+    GEOSX_ERROR_IF( target == nullptr, "The target " << targetPath << " of a parameter of " << realizationNode.path() << " does not exist" );
+
+    // the subregions have their own copies of the constitutive models, made at the setup
+    std::vector< Group * > targets( 1, target );
+    if( target->getParent() == constitutiveManager )
+    {
+      domain->getMeshBodies()->forSubGroups< MeshBody >( [&]( MeshBody & meshBody )
+      {
+        meshBody.forSubGroups< MeshLevel >( [&]( MeshLevel & meshLevel )
+        {
+          meshLevel.getElemManager()->forElementSubRegions( [&]( ElementSubRegionBase & subRegion )
+          {
+            Group * const constitutiveModels = subRegion.GetConstitutiveModels();
+            if( constitutiveModels->hasGroup( target->getName() ) )
+            {
+              targets.emplace_back( constitutiveModels->GetGroup( target->getName() ) );
+            }
+          } );
+        } );
+      } );
+    }
+
+    for( Group * const group : targets )
+    {
+      for( xmlWrapper::xmlAttribute attribute = setNode.first_attribute(); attribute; attribute = attribute.next_attribute() )
+      {
+        string const attributeName = attribute.name();
+        if( attributeName == "target" )
+        {
+          continue;
+        }
+
+        WrapperBase * const wrapper = group->getWrapperBase( attributeName );
+        GEOSX_ERROR_IF( wrapper == nullptr, targetPath << " has no parameter " << attributeName );
+        GEOSX_ERROR_IF( !wrapper->processInputFile( setNode ), "The parameter " << attributeName << " of " << targetPath << " is not an input" );
+      }
+      group->PostProcessInputRecursive();
+    }
+  }
+}
+
 void ProblemManager::ReadRestartOverwrite()
 {
   this->loadFromConduit();
+  dataRepository::finishLoadingTree();
   this->postRestartInitializationRecursive( GetGroup< DomainPartition >( keys::domain ) );
 }
 
@@ -129,6 +129,8 @@ public:
 
   /**
    * @brief Generates numerical meshes used throughout the code
+   * @details With a mesh cache directory on the command line, the preprocessed mesh is read from
+   *   the cache when it was written by a previous run of the same mesh inputs and partition.
    */
   void GenerateMesh();
 
@@ -154,6 +156,28 @@ public:
    */
   void RunSimulation();
 
+  /**
+   * @brief Run the realizations of an ensemble, reusing the mesh and the discretization of a single setup.
+   * @param ensembleFileName the file of the parameters of the realizations
+   *
+   * The ensemble file holds an Ensemble element with a Realization element per realization:
+   * @code{.xml}
+   * <Ensemble>
+   *   <Realization name="r0">
+   *     <Set target="/FieldSpecifications/permx" scale="1.0e-13"/>
+   *     <Set target="/domain/Constitutive/water" defaultViscosity="0.002"/>
+   *   </Realization>
+   * </Ensemble>
+   * @endcode
+   * Before each realization, the state saved to the restart files is restored to its value after the setup.
+   * Each Set then reads the given attributes into the wrappers of the same name of its target group, and
+   * the initial conditions are applied again. A constitutive model is set together with its copies on the
+   * subregions. A parameter not saved to the restart files keeps its value in the following realizations
+   * until one of them sets it again. Each realization writes its output in a directory named after it, and
+   * with several ensemble groups, each group of ranks runs every numGroups-th realization.
+   */
+  void RunEnsemble( string const & ensembleFileName );
+
   /**
    * @brief After initialization, overwrites data using a restart file
    */
@@ -233,6 +257,27 @@ public:
     dataRepository::ViewKey useNonblockingMPI        = {"useNonblockingMPI"};        ///< Flag to use non-block MPI key
     dataRepository::ViewKey suppressPinned           = {"suppressPinned"};           ///< Flag to suppress use of pinned
                                                                                      ///< memory key
+    dataRepository::ViewKey useGpuAwareMPI           = {"useGpuAwareMPI"};           ///< Flag to use GPU-aware MPI key
+    dataRepository::ViewKey useNeighborhoodCollectives = {"useNeighborhoodCollectives"}; ///< Flag to use neighborhood
+                                                                                         ///< collectives key
+    dataRepository::ViewKey useSharedMemoryHalo      = {"useSharedMemoryHalo"};      ///< Flag to use shared-memory
+                                                                                     ///< halo exchange key
+    dataRepository::ViewKey communicationStatistics  = {"communicationStatistics"};  ///< Flag to record
+                                                                                     ///< communication statistics key
+    dataRepository::ViewKey loadBalanceReportInterval = {"loadBalanceReportInterval"}; ///< Number of cycles between
+                                                                                       ///< load balance reports key
+    dataRepository::ViewKey compressGhostBuffers     = {"compressGhostBuffers"};     ///< Flag to compress the
+                                                                                     ///< ghost-setup buffers key
+    dataRepository::ViewKey compactGlobalIndices     = {"compactGlobalIndices"};     ///< Flag to delta encode the
+                                                                                     ///< packed global indices key
+    dataRepository::ViewKey concurrentAssembly       = {"concurrentAssembly"};       ///< Flag to assemble the coupled
+                                                                                     ///< blocks concurrently key
+    dataRepository::ViewKey deterministicReductions  = {"deterministicReductions"};  ///< Flag to reduce the norms
+                                                                                     ///< deterministically key
+    dataRepository::ViewKey launchTuningCache        = {"launchTuningCache"};        ///< Launch tuning cache file
+                                                                                     ///< name key
+    dataRepository::ViewKey fuseKernelLaunches       = {"fuseKernelLaunches"};       ///< Flag to fuse the
+                                                                                     ///< subregion launches key
   } viewKeys; ///< Command line input viewKeys
 
   /// Child group viewKeys
@@ -279,6 +324,18 @@ protected:
 
 private:
 
+  /**
+   * @brief Generate, renumber, map and ghost the meshes.
+   * @param changesMeshTopology whether a solver changes the topology of the mesh during the run
+   */
+  void PreprocessMesh( bool const changesMeshTopology );
+
+  /**
+   * @brief Describe everything the preprocessed mesh depends on, to look for it in the mesh cache.
+   * @return the version, the partition and the raw text of the mesh, geometry and element region inputs
+   */
+  string meshCacheKey() const;
+
   /**
    * @brief Determine the number of quadrature points required for each
    *   subregion.
@@ -302,6 +359,12 @@ private:
                             constitutive::ConstitutiveManager const & constitutiveManager,
                             map< std::pair< string, string >, localIndex > const & regionQuadrature );
 
+  /**
+   * @brief Set the parameters of a realization of an ensemble.
+   * @param realizationNode the Realization element of the ensemble file
+   */
+  void applyRealizationParameters( xmlWrapper::xmlNode const & realizationNode );
+
   /// The PhysicsSolverManager
   PhysicsSolverManager * m_physicsSolverManager;
 
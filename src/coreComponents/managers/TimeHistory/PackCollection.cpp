@@ -1,5 +1,7 @@
 #include "PackCollection.hpp"
 
+#include <algorithm>
+
 namespace geosx
 {
 PackCollection::PackCollection ( string const & name, Group * parent )
@@ -66,12 +68,16 @@ void PackCollection::updateSetsIndices( DomainPartition & domain )
   GEOSX_ERROR_IF( !target->isPackable( false ), "The object targeted for collection must be packable!" );
   localIndex num_sets = m_setNames.size( );
 
+  arrayView1d< integer const > const ghostRank = target_object->ghostRank();
+  localIndex const num_collections = num_sets > 0 ? num_sets : 1;
+  m_setsIndices.resize( num_collections );
+  m_ownedSetsIndices.resize( num_collections );
+
   if( num_sets > 0 )
   {
     // if sets are specified we retrieve the field only from those sets
 
     Group const * set_group = target_object->GetGroup( ObjectManagerBase::groupKeyStruct::setsString );
-    m_setsIndices.resize( num_sets );
     localIndex set_idx = 0;
     for( auto & set_name : m_setNames )
     {
@@ -79,27 +85,51 @@ void PackCollection::updateSetsIndices( DomainPartition & domain )
       if( set_wrapper != nullptr )
       {
         SortedArrayView< localIndex const > const & set = set_wrapper->reference();
-        m_setsIndices[ set_idx ].resize( 0 );
-        if( set.size() > 0 )
+        // the indices are only copied and filtered again when the set changes
+        if( set.size() != m_setsIndices[ set_idx ].size() ||
+            !std::equal( set.begin(), set.end(), m_setsIndices[ set_idx ].begin() ) )
         {
-          m_setsIndices[ set_idx ].insert( 0, set.begin(), set.end() );
+          m_setsIndices[ set_idx ].resize( 0 );
+          if( set.size() > 0 )
+          {
+            m_setsIndices[ set_idx ].insert( 0, set.begin(), set.end() );
+          }
+          updateOwnedIndices( set_idx, ghostRank );
         }
       }
       set_idx++;
     }
   }
-  else
+  else if( m_setsIndices[0].size() != target_object->size() )
   {
     // if no set is specified we retrieve the entire field
-    m_setsIndices.resize( 1 );
     m_setsIndices[0].resize( target_object->size());
     for( localIndex k=0; k <  target_object->size(); k++ )
     {
       m_setsIndices[0][k] = k;
     }
+    updateOwnedIndices( 0, ghostRank );
   }
 }
 
+void PackCollection::updateOwnedIndices( localIndex const setIndex,
+                                         arrayView1d< integer const > const & ghostRank )
+{
+  localIndex numIndices = 0;
+  for( localIndex k=0; k < m_setsIndices[setIndex].size(); k++ )
+  {
+    if( ghostRank[m_setsIndices[setIndex][k]] < 0 )
+    {
+      numIndices++;
+    }
+  }
+
+  array1d< localIndex > & ownedIndices = m_ownedSetsIndices[setIndex];
+  ownedIndices.move( LvArray::MemorySpace::CPU, true );
+  ownedIndices.resize( numIndices );
+  filterGhostIndices( setIndex, ownedIndices, ghostRank );
+}
+
 void PackCollection::filterGhostIndices( localIndex const setIndex,
                                          array1d< localIndex > & set,
                                          arrayView1d< integer const > const & ghostRank )
@@ -163,26 +193,13 @@ void PackCollection::collect( DomainPartition & domain,
   ObjectManagerBase const * target_object = this->getTargetObject( domain );
   WrapperBase const * target = target_object->getWrapperBase( m_fieldName );
 
-  arrayView1d< integer const > const ghostRank = target_object->ghostRank();
-  localIndex numIndices = 0;
-
-  //  count non ghost indices
-  for( localIndex k=0; k <  m_setsIndices[collectionIdx].size(); k++ )
+  // the owned indices stay on the device between collections, only the selected
+  // values are gathered there and written to the (pinned) history buffer
+  arrayView1d< localIndex const > const ownedIndices = m_ownedSetsIndices[collectionIdx].toViewConst();
+  if( ownedIndices.size() > 0 )
   {
-    if( ghostRank[m_setsIndices[collectionIdx][k]] < 0 )
-    {
-      numIndices++;
-    }
-  }
-
-  if( numIndices > 0 )
-  {
-    array1d< localIndex > setIndices( numIndices );
-    filterGhostIndices( collectionIdx, setIndices, ghostRank );
-    // if we could directly transfer a sorted array to an array1d including on device this wouldn't require storing a copy of the indices
-    target->PackByIndex( buffer, setIndices, false, true );
+    target->PackByIndex( buffer, ownedIndices, false, true );
   }
-
 }
 
 REGISTER_CATALOG_ENTRY( TaskBase, PackCollection, std::string const &, Group * const )
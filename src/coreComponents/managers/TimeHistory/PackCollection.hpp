@@ -64,6 +64,8 @@ public:
    * @note Refactoring the packing functions to allow direct usage of set indices
    *       from SortedArrayView instead of only ArrayViews will remove this
    *       duplication.
+   * @note The indices are only copied and filtered again when a set, or the target
+   *       object if no set is specified, changes size or content.
    */
   virtual void updateSetsIndices( DomainPartition & domain ) override final;
 
@@ -77,6 +79,14 @@ public:
                            array1d< localIndex > & set,
                            arrayView1d< integer const > const & ghostRank );
 
+  /**
+   * @brief Update the non ghost indices collected from a set.
+   * @param setIndex which set (collection item) needs to be filtered
+   * @param ghostRank the ghost rank of each index for the target object
+   */
+  void updateOwnedIndices( localIndex const setIndex,
+                           arrayView1d< integer const > const & ghostRank );
+
   /// @cond DO_NOT_DOCUMENT
   struct viewKeysStruct
   {
@@ -107,6 +117,8 @@ private:
   // for indexing)
   /// The indices for the specified sets to pack
   std::vector< array1d< localIndex > > m_setsIndices;
+  /// The non ghost indices of each set, kept on the device between collections
+  std::vector< array1d< localIndex > > m_ownedSetsIndices;
   /// The dataRepository name/path to get history data from
   string m_objectPath;
   /// The (packable) field associated with the specified object to get data from
@@ -0,0 +1,94 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2019 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2019 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2019 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All right reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolverStatisticsCollection.cpp
+ */
+
+#include "SolverStatisticsCollection.hpp"
+
+#include "mpiCommunications/MpiWrapper.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/SolverBase.hpp"
+
+namespace geosx
+{
+
+SolverStatisticsCollection::SolverStatisticsCollection( string const & name, Group * parent )
+  : HistoryCollection( name, parent )
+  , m_solverName( )
+  , m_fieldNames( )
+  , m_statistics( nullptr )
+{
+  registerWrapper( SolverStatisticsCollection::viewKeysStruct::solverName, &m_solverName )->
+    setInputFlag( InputFlags::REQUIRED )->
+    setDescription( "The name of the solver whose counters and timers are collected." );
+
+  registerWrapper( SolverStatisticsCollection::viewKeysStruct::fieldNames, &m_fieldNames )->
+    setInputFlag( InputFlags::REQUIRED )->
+    setDescription( "The names of the counters and timers of the solver to collect, one dataset per field "
+                    "(for instance lastStepNewtonIterations, lastStepLinearIterations, lastStepTimeStepCuts or lastStepAssemblyTime)." );
+}
+
+void SolverStatisticsCollection::InitializePostSubGroups( Group * const group )
+{
+  GEOSX_ERROR_IF( m_fieldNames.empty(), getName() << ": at least one field name must be given." );
+  m_collectionCount = m_fieldNames.size();
+
+  ProblemManager & problemManager = dynamicCast< ProblemManager & >( *group );
+  SolverBase const * const solver = problemManager.GetPhysicsSolverManager().GetGroup< SolverBase >( m_solverName );
+  GEOSX_ERROR_IF( solver == nullptr, getName() << ": " << m_solverName << " is not a solver." );
+  m_statistics = &solver->getSolverStatistics();
+
+  for( string const & fieldName : m_fieldNames )
+  {
+    GEOSX_ERROR_IF( m_statistics->getWrapper< integer >( fieldName ) == nullptr &&
+                    m_statistics->getWrapper< real64 >( fieldName ) == nullptr,
+                    getName() << ": " << fieldName << " is not a counter or a timer of " << m_solverName );
+  }
+
+  HistoryCollection::InitializePostSubGroups( group );
+}
+
+HistoryMetadata SolverStatisticsCollection::getMetadata( ProblemManager & GEOSX_UNUSED_PARAM( problemManager ), localIndex collectionIdx )
+{
+  GEOSX_ERROR_IF( collectionIdx >= m_fieldNames.size(), "Invalid collection index specified." );
+  localIndex const count = ( MpiWrapper::Comm_rank() == 0 ) ? 1 : 0;
+  return HistoryMetadata( m_fieldNames[collectionIdx], count, std::type_index( typeid( real64 ) ) );
+}
+
+void SolverStatisticsCollection::collect( DomainPartition & GEOSX_UNUSED_PARAM( domain ),
+                                          real64 const GEOSX_UNUSED_PARAM( time_n ),
+                                          real64 const GEOSX_UNUSED_PARAM( dt ),
+                                          localIndex const collectionIdx,
+                                          buffer_unit_type * & buffer )
+{
+  GEOSX_ERROR_IF( collectionIdx >= getCollectionCount( ), "Attempting to collection from an invalid collection index!" );
+
+  if( MpiWrapper::Comm_rank() != 0 )
+  {
+    return;
+  }
+
+  // the counters are written as real64, so that all the datasets of the collector have the same type
+  string const & fieldName = m_fieldNames[collectionIdx];
+  dataRepository::Wrapper< integer > const * const counter = m_statistics->getWrapper< integer >( fieldName );
+  real64 const value = ( counter != nullptr ) ? counter->reference() : m_statistics->getReference< real64 >( fieldName );
+
+  memcpy( buffer, &value, sizeof( real64 ) );
+  buffer += sizeof( real64 );
+}
+
+REGISTER_CATALOG_ENTRY( TaskBase, SolverStatisticsCollection, std::string const &, Group * const )
+}
@@ -0,0 +1,101 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2019 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2019 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2019 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All right reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolverStatisticsCollection.hpp
+ */
+
+#ifndef GEOSX_SolverStatisticsCollection_HPP_
+#define GEOSX_SolverStatisticsCollection_HPP_
+
+#include "TimeHistoryCollection.hpp"
+
+namespace geosx
+{
+
+class SolverStatistics;
+
+/**
+ * @class SolverStatisticsCollection
+ *
+ * A task class collecting the history of the counters and timers of a solver (see SolverStatistics).
+ *
+ * Each field is written as a real64 dataset with a single column, by the first rank only. The counters are the
+ * same on all the ranks, while the times are those measured on the first rank.
+ */
+class SolverStatisticsCollection : public HistoryCollection
+{
+public:
+  /**
+   * @brief Constructor
+   * @copydetails dataRepository::Group::Group( string const & name, Group * parent );
+   */
+  SolverStatisticsCollection( string const & name, Group * parent );
+
+  /**
+   * @brief Catalog name interface
+   * @return This type's catalog name
+   */
+  static string CatalogName() { return "SolverStatisticsCollection"; }
+
+  /// @copydoc dataRepository::Group::InitializePostSubGroups
+  void InitializePostSubGroups( Group * const group ) override;
+
+  /// @copydoc geosx::HistoryCollection::getMetadata
+  virtual HistoryMetadata getMetadata( ProblemManager & problemManager, localIndex collectionIdx ) override;
+
+  /// @copydoc geosx::HistoryCollection::getTargetName
+  virtual const string & getTargetName( ) const override
+  {
+    return m_solverName;
+  }
+
+  /**
+   * @brief The solver statistics do not depend on the mesh, this function does nothing.
+   * @param domain The domain partition.
+   */
+  virtual void updateSetsIndices( DomainPartition & domain ) override final
+  {
+    GEOSX_UNUSED_VAR( domain );
+  }
+
+  /// @cond DO_NOT_DOCUMENT
+  struct viewKeysStruct
+  {
+    static constexpr auto solverName = "solverName";
+    static constexpr auto fieldNames = "fieldNames";
+  } keys;
+  /// @endcond
+
+protected:
+
+  /// @copydoc geosx::HistoryCollection::collect
+  virtual void collect( DomainPartition & domain,
+                        real64 const time_n,
+                        real64 const dt,
+                        localIndex const collectionIdx,
+                        buffer_unit_type * & buffer ) override;
+
+private:
+
+  /// The name of the solver
+  string m_solverName;
+  /// The names of the counters and timers to collect
+  string_array m_fieldNames;
+  /// The statistics of the solver
+  SolverStatistics const * m_statistics;
+};
+
+}
+#endif
@@ -0,0 +1,182 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2019 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2019 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2019 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All right reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file WellHistoryCollection.cpp
+ */
+
+#include "WellHistoryCollection.hpp"
+
+#include "mesh/WellElementRegion.hpp"
+#include "mesh/WellElementSubRegion.hpp"
+
+namespace geosx
+{
+
+namespace
+{
+
+/**
+ * @class WellIndexCollection
+ *
+ * Collector of the global index of the well written in each column by a WellHistoryCollection.
+ */
+class WellIndexCollection : public HistoryCollection
+{
+public:
+  /**
+   * @brief Constructor
+   * @param wellCollection the collector of the well quantities
+   */
+  explicit WellIndexCollection( WellHistoryCollection const & wellCollection ):
+    HistoryCollection( "wellIndexCollection", nullptr ),
+    m_wellCollection( wellCollection )
+  {
+    // the meta collectors are not initialized as the other groups
+    m_bufferCalls.resize( m_collectionCount );
+  }
+
+  virtual HistoryMetadata getMetadata( ProblemManager & GEOSX_UNUSED_PARAM( problemManager ),
+                                       localIndex GEOSX_UNUSED_PARAM( collectionIdx ) ) override
+  {
+    localIndex const numLocalWells = LvArray::integerConversion< localIndex >( m_wellCollection.getLocalWellIndices().size() );
+    return HistoryMetadata( "wellIndex", numLocalWells, std::type_index( typeid( localIndex ) ) );
+  }
+
+  virtual const string & getTargetName( ) const override
+  {
+    return m_wellCollection.getTargetName();
+  }
+
+  virtual void updateSetsIndices( DomainPartition & GEOSX_UNUSED_PARAM( domain ) ) override
+  {}
+
+protected:
+  virtual void collect( DomainPartition & GEOSX_UNUSED_PARAM( domain ),
+                        real64 const GEOSX_UNUSED_PARAM( time_n ),
+                        real64 const GEOSX_UNUSED_PARAM( dt ),
+                        localIndex const GEOSX_UNUSED_PARAM( collectionIdx ),
+                        buffer_unit_type * & buffer ) override
+  {
+    std::vector< localIndex > const & wellIndices = m_wellCollection.getLocalWellIndices();
+    size_t const numBytes = wellIndices.size() * sizeof( localIndex );
+    memcpy( buffer, wellIndices.data(), numBytes );
+    buffer += numBytes;
+  }
+
+private:
+  /// The collector of the well quantities
+  WellHistoryCollection const & m_wellCollection;
+};
+
+}
+
+WellHistoryCollection::WellHistoryCollection( string const & name, Group * parent )
+  : HistoryCollection( name, parent )
+  , m_fieldNames( )
+  , m_wellRegionNames( )
+  , m_localWells( )
+  , m_localWellIndices( )
+{
+  registerWrapper( WellHistoryCollection::viewKeysStruct::fieldNames, &m_fieldNames )->
+    setInputFlag( InputFlags::REQUIRED )->
+    setDescription( "The names of the real64 fields of the well elements to collect at the top element of each well, one dataset per field." );
+
+  registerWrapper( WellHistoryCollection::viewKeysStruct::wellRegionNames, &m_wellRegionNames )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "The names of the well regions to collect, in the order of the global well indices. "
+                    "All the well regions are collected if empty." );
+}
+
+void WellHistoryCollection::InitializePostSubGroups( Group * const group )
+{
+  GEOSX_ERROR_IF( m_fieldNames.empty(), getName() << ": at least one field name must be given." );
+  m_collectionCount = m_fieldNames.size();
+  DomainPartition & domain = *( dynamicCast< ProblemManager & >( *group ).getDomainPartition( ) );
+  findLocalWells( domain );
+  HistoryCollection::InitializePostSubGroups( group );
+}
+
+void WellHistoryCollection::findLocalWells( DomainPartition & domain )
+{
+  ElementRegionManager const & elemManager = *domain.getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
+
+  // the regions are created from the input deck, hence listed in the same order on all the ranks
+  string_array regionNames = m_wellRegionNames;
+  if( regionNames.empty() )
+  {
+    elemManager.forElementRegions< WellElementRegion >( [&]( WellElementRegion const & region )
+    {
+      regionNames.emplace_back( region.getName() );
+    } );
+  }
+
+  m_localWells.clear();
+  m_localWellIndices.clear();
+  for( localIndex iwell = 0; iwell < regionNames.size(); ++iwell )
+  {
+    WellElementRegion const * const region = elemManager.GetRegion< WellElementRegion >( regionNames[iwell] );
+    GEOSX_ERROR_IF( region == nullptr, getName() << ": " << regionNames[iwell] << " is not a well region." );
+
+    WellElementSubRegion const * const subRegion = region->GetSubRegion< WellElementSubRegion >( region->GetSubRegionName() );
+    if( subRegion->IsLocallyOwned() && subRegion->GetTopWellElementIndex() >= 0 )
+    {
+      for( string const & fieldName : m_fieldNames )
+      {
+        GEOSX_ERROR_IF( subRegion->getWrapper< array1d< real64 > >( fieldName ) == nullptr,
+                        getName() << ": " << fieldName << " is not a real64 field of the elements of " << regionNames[iwell] );
+      }
+      m_localWells.emplace_back( subRegion );
+      m_localWellIndices.emplace_back( iwell );
+    }
+  }
+}
+
+HistoryMetadata WellHistoryCollection::getMetadata( ProblemManager & GEOSX_UNUSED_PARAM( problemManager ), localIndex collectionIdx )
+{
+  GEOSX_ERROR_IF( collectionIdx >= m_fieldNames.size(), "Invalid collection index specified." );
+  localIndex const numLocalWells = LvArray::integerConversion< localIndex >( m_localWells.size() );
+  return HistoryMetadata( m_fieldNames[collectionIdx], numLocalWells, std::type_index( typeid( real64 ) ) );
+}
+
+std::unique_ptr< HistoryCollection > WellHistoryCollection::getMetaCollector( ProblemManager & GEOSX_UNUSED_PARAM( problemManager ),
+                                                                              localIndex GEOSX_UNUSED_PARAM( metaIdx ) )
+{
+  return std::make_unique< WellIndexCollection >( *this );
+}
+
+void WellHistoryCollection::collect( DomainPartition & GEOSX_UNUSED_PARAM( domain ),
+                                     real64 const GEOSX_UNUSED_PARAM( time_n ),
+                                     real64 const GEOSX_UNUSED_PARAM( dt ),
+                                     localIndex const collectionIdx,
+                                     buffer_unit_type * & buffer )
+{
+  GEOSX_MARK_FUNCTION;
+  GEOSX_ERROR_IF( collectionIdx >= getCollectionCount( ), "Attempting to collection from an invalid collection index!" );
+
+  // one value per well, written next to each other on the host instead of packing each well separately
+  real64 * const values = reinterpret_cast< real64 * >( buffer );
+  for( size_t iwell = 0; iwell < m_localWells.size(); ++iwell )
+  {
+    WellElementSubRegion const & subRegion = *m_localWells[iwell];
+    arrayView1d< real64 const > const field =
+      subRegion.getReference< array1d< real64 > >( m_fieldNames[collectionIdx] ).toViewConst();
+    field.move( LvArray::MemorySpace::CPU, false );
+    values[iwell] = field[ subRegion.GetTopWellElementIndex() ];
+  }
+  buffer += m_localWells.size() * sizeof( real64 );
+}
+
+REGISTER_CATALOG_ENTRY( TaskBase, WellHistoryCollection, std::string const &, Group * const )
+}
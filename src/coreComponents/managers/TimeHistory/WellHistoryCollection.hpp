@@ -0,0 +1,131 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2019 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2019 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2019 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All right reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file WellHistoryCollection.hpp
+ */
+
+#ifndef GEOSX_WellHistoryCollection_HPP_
+#define GEOSX_WellHistoryCollection_HPP_
+
+#include "TimeHistoryCollection.hpp"
+
+namespace geosx
+{
+
+class WellElementSubRegion;
+
+/**
+ * @class WellHistoryCollection
+ *
+ * A task class collecting the history of well quantities for many wells at once.
+ *
+ * Each field is sampled at the top element of the target wells, and each rank writes the values of the wells it owns
+ * next to each other, so that a TimeHistoryOutput targeting this collector writes one dataset per field, with one
+ * column per well, instead of one dataset (and one set of collective I/O operations) per well and per field.
+ * The global index of the well of each column is written once, as the "wellIndex" metadata.
+ */
+class WellHistoryCollection : public HistoryCollection
+{
+public:
+  /**
+   * @brief Constructor
+   * @copydetails dataRepository::Group::Group( string const & name, Group * parent );
+   */
+  WellHistoryCollection( string const & name, Group * parent );
+
+  /**
+   * @brief Catalog name interface
+   * @return This type's catalog name
+   */
+  static string CatalogName() { return "WellHistoryCollection"; }
+
+  /// @copydoc dataRepository::Group::InitializePostSubGroups
+  void InitializePostSubGroups( Group * const group ) override;
+
+  /// @copydoc geosx::HistoryCollection::getMetadata
+  virtual HistoryMetadata getMetadata( ProblemManager & problemManager, localIndex collectionIdx ) override;
+
+  /// @copydoc geosx::HistoryCollection::getTargetName
+  virtual const string & getTargetName( ) const override
+  {
+    return getName();
+  }
+
+  /// @copydoc geosx::HistoryCollection::getNumMetaCollectors
+  virtual localIndex getNumMetaCollectors( ) const override
+  {
+    return 1;
+  }
+
+  /// @copydoc geosx::HistoryCollection::getMetaCollector
+  virtual std::unique_ptr< HistoryCollection > getMetaCollector( ProblemManager & problemManager, localIndex metaIdx ) override;
+
+  /**
+   * @brief Update the list of the target wells owned by this rank.
+   * @param domain The domain partition.
+   * @note The wells do not move between the ranks, so that the list is built once during initialization
+   *       and this function, called before each collection, does nothing.
+   */
+  virtual void updateSetsIndices( DomainPartition & domain ) override final
+  {
+    GEOSX_UNUSED_VAR( domain );
+  }
+
+  /**
+   * @brief Get the global index of each well owned by this rank among the target wells.
+   * @return the indices, in the order of the columns written by this rank
+   */
+  std::vector< localIndex > const & getLocalWellIndices() const
+  {
+    return m_localWellIndices;
+  }
+
+  /// @cond DO_NOT_DOCUMENT
+  struct viewKeysStruct
+  {
+    static constexpr auto fieldNames = "fieldNames";
+    static constexpr auto wellRegionNames = "wellRegionNames";
+  } keys;
+  /// @endcond
+
+protected:
+
+  /// @copydoc geosx::HistoryCollection::collect
+  virtual void collect( DomainPartition & domain,
+                        real64 const time_n,
+                        real64 const dt,
+                        localIndex const collectionIdx,
+                        buffer_unit_type * & buffer ) override;
+
+private:
+
+  /// The names of the fields of the well elements to collect
+  string_array m_fieldNames;
+  /// The names of the well regions to collect, all the well regions if empty
+  string_array m_wellRegionNames;
+  /**
+   * @brief Build the list of the target wells owned by this rank.
+   * @param domain The domain partition.
+   */
+  void findLocalWells( DomainPartition & domain );
+
+  /// The well subregions owned by this rank
+  std::vector< WellElementSubRegion const * > m_localWells;
+  /// The global index of each well owned by this rank among the target wells
+  std::vector< localIndex > m_localWellIndices;
+};
+
+}
+#endif
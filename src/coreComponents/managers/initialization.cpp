@@ -15,10 +15,16 @@
 #include "initialization.hpp"
 
 #include "common/DataTypes.hpp"
+#include "common/HugePageAllocator.hpp"
 #include "common/TimingMacros.hpp"
 #include "common/Path.hpp"
+#include "common/LaunchTuner.hpp"
+#include "dataRepository/MigrationAudit.hpp"
 #include "LvArray/src/system.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "mpiCommunications/CommunicationStatistics.hpp"
+#include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/CycleReduction.hpp"
 #include "mpiCommunications/MpiWrapper.hpp"
 
 // TPL includes
@@ -26,11 +32,13 @@
 #include <umpire/ResourceManager.hpp>
 
 #if defined( GEOSX_USE_CALIPER )
+#include <caliper/cali.h>
 #include <caliper/cali-manager.h>
 #include <adiak.hpp>
 #endif
 
 // System includes
+#include <cstring>
 #include <iomanip>
 
 #if defined( GEOSX_USE_MKL )
@@ -41,10 +49,18 @@
 #include <omp.h>
 #endif
 
+#if defined( GEOSX_USE_OPENMP ) && defined( __linux__ )
+#include <sched.h>
+#endif
+
 #if defined( GEOSX_USE_CUDA )
 #include <cuda.h>
 #endif
 
+#if defined( GEOSX_USE_HIP )
+#include <hip/hip_runtime.h>
+#endif
+
 #include <fenv.h>
 
 namespace geosx
@@ -57,6 +73,51 @@ CommandLineOptions s_commandLineOptions;
 
 #if defined( GEOSX_USE_CALIPER )
 cali::ConfigManager s_caliperManager;
+
+/// The name of the roofline report in the timer output string, which is not a preset of Caliper
+constexpr char const * rooflineReportName = "roofline-report";
+
+/// The channel of the roofline report, if requested
+cali_id_t s_rooflineChannel = CALI_INV_ID;
+
+/**
+ * @brief Create the channel of the per kernel roofline report.
+ *
+ * The snapshots are only taken at the beginning and the end of the kernel regions (see GEOSX_MARK_KERNEL),
+ * and aggregated by kernel. The report lists, for each kernel, the number of launches, the elements, the
+ * time and the estimated bytes and flops, the arithmetic intensity and the achieved bandwidth and flop rate.
+ * The times and metrics are summed over the ranks, the rates are hence those of an average rank.
+ */
+void setupRooflineReport()
+{
+  cali_configset_t config = cali_create_configset();
+#if defined( GEOSX_USE_MPI )
+  cali_configset_set( config, "CALI_SERVICES_ENABLE", "event,aggregate,mpireport,timestamp" );
+  char const * const queryKey = "CALI_MPIREPORT_CONFIG";
+#else
+  cali_configset_set( config, "CALI_SERVICES_ENABLE", "event,aggregate,report,timestamp" );
+  char const * const queryKey = "CALI_REPORT_CONFIG";
+#endif
+  cali_configset_set( config, "CALI_EVENT_TRIGGER", "kernel" );
+  cali_configset_set( config, "CALI_TIMER_SNAPSHOT_DURATION", "true" );
+  cali_configset_set( config, "CALI_TIMER_UNIT", "sec" );
+  cali_configset_set( config, "CALI_AGGREGATE_KEY", "kernel" );
+  cali_configset_set( config, "CALI_AGGREGATE_ATTRIBUTES", "time.duration,kernel.elements,kernel.bytes,kernel.flops" );
+  cali_configset_set( config, queryKey,
+                      "select kernel as Kernel,"
+                      "sum(count) as Launches,"
+                      "sum(sum#kernel.elements) as Elements,"
+                      "sum(sum#time.duration) as \"Time (s)\","
+                      "sum(sum#kernel.bytes) as Bytes,"
+                      "sum(sum#kernel.flops) as Flops,"
+                      "ratio(sum#kernel.flops,sum#kernel.bytes) as \"Flops/byte\","
+                      "ratio(sum#kernel.bytes,sum#time.duration,1e-9) as \"GB/s\","
+                      "ratio(sum#kernel.flops,sum#time.duration,1e-9) as \"GFlops/s\" "
+                      "where kernel group by kernel format table" );
+
+  s_rooflineChannel = cali_create_channel( rooflineReportName, 0, config );
+  cali_delete_configset( config );
+}
 #endif
 
 /**
@@ -123,7 +184,19 @@ void addUmpireHighWaterMarks()
 void setupCaliper()
 {
 #if defined( GEOSX_USE_CALIPER )
-  s_caliperManager.add( s_commandLineOptions.timerOutput.c_str() );
+  // the roofline report is built from its own channel, the other configurations are given to Caliper
+  std::string timerOutput = s_commandLineOptions.timerOutput;
+  std::string::size_type const rooflinePos = timerOutput.find( rooflineReportName );
+  if( rooflinePos != std::string::npos )
+  {
+    std::string::size_type const end = rooflinePos + std::strlen( rooflineReportName );
+    bool const trailingComma = end < timerOutput.size() && timerOutput[end] == ',';
+    bool const leadingComma = !trailingComma && rooflinePos > 0 && timerOutput[rooflinePos - 1] == ',';
+    timerOutput.erase( rooflinePos - leadingComma, end - rooflinePos + leadingComma + trailingComma );
+    setupRooflineReport();
+  }
+
+  s_caliperManager.add( timerOutput.c_str() );
   GEOSX_ERROR_IF( s_caliperManager.error(), "Caliper config error: " << s_caliperManager.error_msg() );
   s_caliperManager.start();
 
@@ -196,6 +269,19 @@ void setupCaliper()
   adiak::value( "CUDA runtime version", cudaRuntimeVersion );
   adiak::value( "CUDA driver version", cudaDriverVersion );
 
+  // HIP info
+  int hipRuntimeVersion = 0;
+  int hipDriverVersion = 0;
+#if defined( GEOSX_USE_HIP )
+  adiak::value( "HIP", "On" );
+  GEOSX_ERROR_IF_NE( hipSuccess, hipRuntimeGetVersion( &hipRuntimeVersion ) );
+  GEOSX_ERROR_IF_NE( hipSuccess, hipDriverGetVersion( &hipDriverVersion ) );
+#else
+  adiak::value( "HIP", "Off" );
+#endif
+  adiak::value( "HIP runtime version", hipRuntimeVersion );
+  adiak::value( "HIP driver version", hipDriverVersion );
+
 #endif // defined( GEOSX_USE_CALIPER )
 }
 
@@ -208,6 +294,10 @@ void finalizeCaliper()
 #ifdef GEOSX_USE_CALIPER
   adiak::fini();
   s_caliperManager.flush();
+  if( s_rooflineChannel != CALI_INV_ID )
+  {
+    cali_channel_flush( s_rooflineChannel, 0 );
+  }
 #endif
 }
 
@@ -282,10 +372,31 @@ void parseCommandLineOptions( int argc, char * * argv )
     SCHEMA,
     NONBLOCKING_MPI,
     SUPPRESS_PINNED,
+    GPU_AWARE_MPI,
+    NEIGHBORHOOD_COLLECTIVES,
+    SHARED_MEMORY_HALO,
+    COMMUNICATION_STATISTICS,
+    LOAD_BALANCE_REPORT,
+    COMPRESS_GHOST_BUFFERS,
+    COMPACT_GLOBAL_INDICES,
+    CONCURRENT_ASSEMBLY,
+    DETERMINISTIC_REDUCTIONS,
     PROBLEMNAME,
     OUTPUTDIR,
     TIMERS,
     SUPPRESS_MOVE_LOGGING,
+    MIGRATION_AUDIT,
+    LAUNCH_TUNING,
+    FUSE_KERNEL_LAUNCHES,
+    ENSEMBLE,
+    ENSEMBLE_GROUPS,
+    COUPLING_COLOR,
+    RANK_LOG_DIR,
+    AGGREGATE_RANK_LOG,
+    THREAD_AFFINITY,
+    HUGE_PAGES,
+    HUGE_PAGE_THRESHOLD,
+    MESH_CACHE,
   };
 
   const option::Descriptor usage[] =
@@ -301,9 +412,30 @@ void parseCommandLineOptions( int argc, char * * argv )
     { NONBLOCKING_MPI, 0, "b", "use-nonblocking", Arg::None, "\t-b, --use-nonblocking, \t Use non-blocking MPI communication" },
     { PROBLEMNAME, 0, "n", "name", Arg::NonEmpty, "\t-n, --name, \t Name of the problem, used for output" },
     { SUPPRESS_PINNED, 0, "s", "suppress-pinned", Arg::None, "\t-s, --suppress-pinned \t Suppress usage of pinned memory for MPI communication buffers" },
+    { GPU_AWARE_MPI, 0, "", "gpu-aware-mpi", Arg::None, "\t--gpu-aware-mpi \t Keep device synchronization buffers in device-accessible memory and pass them directly to a GPU-aware MPI" },
+    { NEIGHBORHOOD_COLLECTIVES, 0, "", "neighborhood-collectives", Arg::None, "\t--neighborhood-collectives \t Use MPI neighborhood collectives for ghost discovery and field synchronization" },
+    { SHARED_MEMORY_HALO, 0, "", "shared-memory-halo", Arg::None, "\t--shared-memory-halo \t Synchronize fields with the neighbors on the same node through MPI shared-memory windows" },
+    { COMMUNICATION_STATISTICS, 0, "", "communication-statistics", Arg::None, "\t--communication-statistics \t Record per-neighbor communication statistics and print a summary at the end of the run" },
+    { LOAD_BALANCE_REPORT, 0, "", "load-balance-report", Arg::Numeric, "\t--load-balance-report \t Time the phases on each rank and report the imbalance and the slowest ranks every given number of cycles (0 for the end of the run only)" },
+    { COMPRESS_GHOST_BUFFERS, 0, "", "compress-ghost-buffers", Arg::None, "\t--compress-ghost-buffers \t Compress the buffers exchanged to build the ghosts and the synchronization lists" },
+    { COMPACT_GLOBAL_INDICES, 0, "", "compact-global-indices", Arg::None, "\t--compact-global-indices \t Pack the global indices of the maps and relations as variable-length differences" },
+    { CONCURRENT_ASSEMBLY, 0, "", "concurrent-assembly", Arg::None, "\t--concurrent-assembly \t Assemble the independent blocks of the coupled solvers concurrently, each on a share of the OpenMP threads" },
+    { DETERMINISTIC_REDUCTIONS, 0, "", "deterministic-reductions", Arg::None, "\t--deterministic-reductions \t Sum the residual norms and the dot products in a fixed order with compensation, so that runs with the same partition give the same results" },
     { OUTPUTDIR, 0, "o", "output", Arg::NonEmpty, "\t-o, --output, \t Directory to put the output files" },
-    { TIMERS, 0, "t", "timers", Arg::NonEmpty, "\t-t, --timers, \t String specifying the type of timer output." },
+    { TIMERS, 0, "t", "timers", Arg::NonEmpty, "\t-t, --timers, \t String specifying the type of timer output, a Caliper configuration and/or roofline-report." },
     { SUPPRESS_MOVE_LOGGING, 0, "", "suppress-move-logging", Arg::None, "\t--suppress-move-logging \t Suppress logging of host-device data migration" },
+    { MIGRATION_AUDIT, 0, "", "migration-audit", Arg::None, "\t--migration-audit \t Log every host-device move of the wrappers and print a summary by wrapper and call site at the end of the run" },
+    { LAUNCH_TUNING, 0, "", "launch-tuning", Arg::NonEmpty, "\t--launch-tuning \t Tune the block size of the device kernel launches, reading and updating the given cache file" },
+    { FUSE_KERNEL_LAUNCHES, 0, "", "fuse-kernel-launches", Arg::None, "\t--fuse-kernel-launches \t Launch the subregions sharing an element type and a constitutive model together on the device" },
+    { ENSEMBLE, 0, "", "ensemble", Arg::NonEmpty, "\t--ensemble \t Run the realizations of the given ensemble file one after the other, after a single setup" },
+    { ENSEMBLE_GROUPS, 0, "", "ensemble-groups", Arg::Numeric, "\t--ensemble-groups \t Split the ranks in the given number of groups, each running its share of the realizations of the ensemble" },
+    { COUPLING_COLOR, 0, "", "coupling-color", Arg::Numeric, "\t--coupling-color \t Share MPI_COMM_WORLD with a coupled code, the GEOSX ranks splitting it with the given color" },
+    { RANK_LOG_DIR, 0, "", "rank-log-dir", Arg::NonEmpty, "\t--rank-log-dir \t Write the messages of each rank to a file of the given directory, from a background thread" },
+    { AGGREGATE_RANK_LOG, 0, "", "aggregate-rank-log", Arg::None, "\t--aggregate-rank-log \t Print the identical messages of the ranks once, from rank 0, with the list of the ranks" },
+    { THREAD_AFFINITY, 0, "", "thread-affinity", Arg::NonEmpty, "\t--thread-affinity \t Pin the OpenMP threads to the cores of the rank, close (consecutive cores) or spread (evenly distributed)" },
+    { HUGE_PAGES, 0, "", "huge-pages", Arg::NonEmpty, "\t--huge-pages \t Back the large host arrays with 2 MB huge pages, transparent (advised to the kernel) or explicit (reserved on the node)" },
+    { HUGE_PAGE_THRESHOLD, 0, "", "huge-page-threshold", Arg::Numeric, "\t--huge-page-threshold \t The size in MB from which a host allocation uses huge pages (default 2)" },
+    { MESH_CACHE, 0, "", "mesh-cache", Arg::NonEmpty, "\t--mesh-cache \t Read the preprocessed mesh from the given directory when it was cached by a run of the same mesh and partition, otherwise preprocess and cache it" },
     { 0, 0, nullptr, nullptr, nullptr, nullptr }
   };
 
@@ -386,6 +518,51 @@ void parseCommandLineOptions( int argc, char * * argv )
         s_commandLineOptions.suppressPinned = true;
       }
       break;
+      case GPU_AWARE_MPI:
+      {
+        s_commandLineOptions.useGpuAwareMPI = true;
+      }
+      break;
+      case NEIGHBORHOOD_COLLECTIVES:
+      {
+        s_commandLineOptions.useNeighborhoodCollectives = true;
+      }
+      break;
+      case SHARED_MEMORY_HALO:
+      {
+        s_commandLineOptions.useSharedMemoryHalo = true;
+      }
+      break;
+      case COMMUNICATION_STATISTICS:
+      {
+        s_commandLineOptions.communicationStatistics = true;
+      }
+      break;
+      case LOAD_BALANCE_REPORT:
+      {
+        s_commandLineOptions.loadBalanceReportInterval = std::stoi( opt.arg );
+      }
+      break;
+      case COMPRESS_GHOST_BUFFERS:
+      {
+        s_commandLineOptions.compressGhostBuffers = true;
+      }
+      break;
+      case COMPACT_GLOBAL_INDICES:
+      {
+        s_commandLineOptions.compactGlobalIndices = true;
+      }
+      break;
+      case CONCURRENT_ASSEMBLY:
+      {
+        s_commandLineOptions.concurrentAssembly = true;
+      }
+      break;
+      case DETERMINISTIC_REDUCTIONS:
+      {
+        s_commandLineOptions.deterministicReductions = true;
+      }
+      break;
       case SCHEMA:
       {
         s_commandLineOptions.schemaName = opt.arg;
@@ -411,6 +588,69 @@ void parseCommandLineOptions( int argc, char * * argv )
         s_commandLineOptions.suppressMoveLogging = true;
       }
       break;
+      case MIGRATION_AUDIT:
+      {
+        s_commandLineOptions.migrationAudit = true;
+      }
+      break;
+      case LAUNCH_TUNING:
+      {
+        s_commandLineOptions.launchTuningCache = opt.arg;
+      }
+      break;
+      case FUSE_KERNEL_LAUNCHES:
+      {
+        s_commandLineOptions.fuseKernelLaunches = true;
+      }
+      break;
+      case ENSEMBLE:
+      {
+        s_commandLineOptions.ensembleFileName = opt.arg;
+      }
+      break;
+      case ENSEMBLE_GROUPS:
+      {
+        s_commandLineOptions.ensembleGroups = std::stoi( opt.arg );
+      }
+      break;
+      case COUPLING_COLOR:
+      {
+        s_commandLineOptions.couplingColor = std::stoi( opt.arg );
+      }
+      break;
+      case RANK_LOG_DIR:
+      {
+        s_commandLineOptions.rankLogDirectory = opt.arg;
+      }
+      break;
+      case AGGREGATE_RANK_LOG:
+      {
+        s_commandLineOptions.aggregateRankLog = true;
+      }
+      break;
+      case THREAD_AFFINITY:
+      {
+        s_commandLineOptions.threadAffinity = opt.arg;
+        GEOSX_ERROR_IF( s_commandLineOptions.threadAffinity != "close" && s_commandLineOptions.threadAffinity != "spread",
+                        "Unknown thread affinity " << s_commandLineOptions.threadAffinity << ", expected close or spread" );
+      }
+      break;
+      case HUGE_PAGES:
+      {
+        s_commandLineOptions.hugePages = opt.arg;
+      }
+      break;
+      case HUGE_PAGE_THRESHOLD:
+      {
+        s_commandLineOptions.hugePageThreshold = std::stoi( opt.arg );
+        GEOSX_ERROR_IF_LT( s_commandLineOptions.hugePageThreshold, 0 );
+      }
+      break;
+      case MESH_CACHE:
+      {
+        s_commandLineOptions.meshCacheDirectory = opt.arg;
+      }
+      break;
     }
   }
 
@@ -433,6 +673,79 @@ void parseCommandLineOptions( int argc, char * * argv )
   }
 }
 
+/**
+ * @brief Restrict MPI_COMM_GEOSX to the GEOSX ranks when MPI_COMM_WORLD is shared with a coupled code.
+ *
+ * Both codes split MPI_COMM_WORLD with their own color, then gather the colors of all the ranks over
+ * MPI_COMM_WORLD to find the first rank of the other code, the remote leader of their intercommunicator.
+ */
+void setupCouplingGroups()
+{
+  integer const color = s_commandLineOptions.couplingColor;
+  if( color < 0 )
+  {
+    return;
+  }
+
+  // the queued rank messages are printed over the communicator freed below
+  logger::FlushRankMessages();
+
+  int const worldRank = MpiWrapper::Comm_rank( MPI_COMM_WORLD );
+  MPI_Comm appComm = MpiWrapper::Comm_split( MPI_COMM_WORLD, color, worldRank );
+  MpiWrapper::Comm_free( MPI_COMM_GEOSX );
+  MPI_COMM_GEOSX = appComm;
+
+  array1d< integer > colors;
+  MpiWrapper::allGather( color, colors, MPI_COMM_WORLD );
+  for( localIndex r = 0; r < colors.size(); ++r )
+  {
+    if( colors[r] != color )
+    {
+      s_commandLineOptions.couplingRemoteLeader = LvArray::integerConversion< integer >( r );
+      break;
+    }
+  }
+  GEOSX_ERROR_IF( s_commandLineOptions.couplingRemoteLeader < 0,
+                  "No coupled code shares MPI_COMM_WORLD with the coupling color " << color );
+
+  setupLogger();
+}
+
+/**
+ * @brief Split MPI_COMM_GEOSX in the groups of ranks running the realizations of the ensemble concurrently.
+ *
+ * Each group has contiguous ranks, so that it spans as few nodes as possible, and runs as a separate problem
+ * on its own MPI_COMM_GEOSX.
+ */
+void setupEnsembleGroups()
+{
+  integer const numGroups = s_commandLineOptions.ensembleGroups;
+  GEOSX_ERROR_IF_LT_MSG( numGroups, 1, "The number of ensemble groups must be positive" );
+  if( numGroups == 1 )
+  {
+    return;
+  }
+
+  GEOSX_ERROR_IF( s_commandLineOptions.ensembleFileName.empty(), "The ensemble groups need an ensemble file" );
+
+  int const rank = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
+  int const size = MpiWrapper::Comm_size( MPI_COMM_GEOSX );
+  GEOSX_ERROR_IF( size % numGroups != 0,
+                  "The number of ranks (" << size << ") is not a multiple of the number of ensemble groups (" << numGroups << ")" );
+
+  // the queued rank messages are printed over the communicator freed below
+  logger::FlushRankMessages();
+
+  int const groupIndex = rank / ( size / numGroups );
+  MPI_Comm groupComm = MpiWrapper::Comm_split( MPI_COMM_GEOSX, groupIndex, rank );
+  MpiWrapper::Comm_free( MPI_COMM_GEOSX );
+  MPI_COMM_GEOSX = groupComm;
+  s_commandLineOptions.ensembleGroupIndex = groupIndex;
+
+  // the rank 0 of each group logs for its group
+  setupLogger();
+}
+
 } // namespace internal
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -448,6 +761,16 @@ void basicSetup( int argc, char * argv[], bool const parseCommandLine )
   if( parseCommandLine )
   {
     internal::parseCommandLineOptions( argc, argv );
+    setupLogger();
+    internal::setupCouplingGroups();
+    internal::setupEnsembleGroups();
+    setupThreadAffinity();
+
+    CommandLineOptions const & opts = internal::s_commandLineOptions;
+    if( !opts.hugePages.empty() )
+    {
+      setupHugePageAllocator( opts.hugePages, std::size_t( opts.hugePageThreshold ) * 1024 * 1024 );
+    }
   }
 
   internal::setupCaliper();
@@ -465,20 +788,25 @@ void overrideInputFileName( std::string const & inputFileName )
 void basicCleanup()
 {
   LvArray::system::resetSignalHandling();
+  CommunicationStatistics::printSummary();
+  dataRepository::MigrationAudit::printSummary();
+  LaunchTuner::writeCache();
   finalizeLAI();
   finalizeLogger();
   internal::addUmpireHighWaterMarks();
   internal::finalizeCaliper();
+  CycleReduction::finalize();
   finalizeMPI();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 void setupLogger()
 {
+  CommandLineOptions const & opts = internal::s_commandLineOptions;
 #ifdef GEOSX_USE_MPI
-  logger::InitializeLogger( MPI_COMM_GEOSX );
+  logger::InitializeLogger( MPI_COMM_GEOSX, opts.rankLogDirectory, opts.aggregateRankLog );
 #else
-  logger::InitializeLogger();
+  logger::InitializeLogger( opts.rankLogDirectory, opts.aggregateRankLog );
 #endif
 }
 
@@ -493,6 +821,7 @@ void setupCXXUtils()
 {
   LvArray::system::setErrorHandler( []()
   {
+    logger::FlushLocalRankMessages();
   #if defined( GEOSX_USE_MPI )
     int mpi = 0;
     MPI_Initialized( &mpi );
@@ -526,6 +855,55 @@ void setupOpenMP()
 {
 #ifdef GEOSX_USE_OPENMP
   GEOSX_LOG_RANK_0( "Max threads: " << omp_get_max_threads() );
+  GEOSX_LOG_RANK_0( "Thread binding: " << ( omp_get_proc_bind() == omp_proc_bind_false ? "none" : "OMP_PROC_BIND" ) );
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void setupThreadAffinity()
+{
+  std::string const & affinity = internal::s_commandLineOptions.threadAffinity;
+  if( affinity.empty() )
+  {
+    return;
+  }
+
+#if defined( GEOSX_USE_OPENMP ) && defined( __linux__ )
+  GEOSX_WARNING_IF( omp_get_proc_bind() != omp_proc_bind_false,
+                    "The threads are pinned by --thread-affinity over the binding of OMP_PROC_BIND" );
+
+  // the cores given to the rank by the launcher
+  cpu_set_t rankSet;
+  CPU_ZERO( &rankSet );
+  GEOSX_ERROR_IF_NE( sched_getaffinity( 0, sizeof( cpu_set_t ), &rankSet ), 0 );
+  std::vector< int > cores;
+  for( int cpu = 0; cpu < CPU_SETSIZE; ++cpu )
+  {
+    if( CPU_ISSET( cpu, &rankSet ) )
+    {
+      cores.push_back( cpu );
+    }
+  }
+
+  int const numThreads = omp_get_max_threads();
+  int const numCores = LvArray::integerConversion< int >( cores.size() );
+  GEOSX_WARNING_IF( numThreads > numCores,
+                    "More OpenMP threads (" << numThreads << ") than cores (" << numCores << "), some threads share a core" );
+  int const stride = ( affinity == "spread" && numThreads < numCores ) ? numCores / numThreads : 1;
+
+  // the same static distribution of the threads as the host kernels
+  integer failures = 0;
+  #pragma omp parallel num_threads( numThreads ) reduction( +: failures )
+  {
+    cpu_set_t threadSet;
+    CPU_ZERO( &threadSet );
+    CPU_SET( cores[ ( omp_get_thread_num() * stride ) % numCores ], &threadSet );
+    failures += ( sched_setaffinity( 0, sizeof( cpu_set_t ), &threadSet ) != 0 );
+  }
+  GEOSX_WARNING_IF( failures > 0, failures << " OpenMP threads could not be pinned" );
+  GEOSX_LOG_RANK_0( "Thread affinity: " << affinity << ", " << numThreads << " threads over " << numCores << " cores" );
+#else
+  GEOSX_WARNING( "--thread-affinity needs an OpenMP build on Linux, the threads are not pinned" );
 #endif
 }
 
@@ -539,6 +917,8 @@ void setupMPI( int argc, char * argv[] )
 ///////////////////////////////////////////////////////////////////////////////
 void finalizeMPI()
 {
+  CommunicationTools::releaseGraphCommunicator();
+  CommunicationTools::releaseSharedMemoryCommunicator();
   MpiWrapper::Comm_free( MPI_COMM_GEOSX );
   MpiWrapper::Finalize();
 }
@@ -62,6 +62,43 @@ struct CommandLineOptions
   /// Generally only used by the integration tests.
   integer suppressPinned = false;
 
+  /// True iff the MPI implementation can read and write device
+  /// memory directly, so that device synchronization buffers
+  /// do not need to be staged through host memory.
+  integer useGpuAwareMPI = false;
+
+  /// True if exchanging with all the neighbors at once
+  /// through MPI neighborhood collectives.
+  integer useNeighborhoodCollectives = false;
+
+  /// True if the neighbors on the same node synchronize
+  /// fields through MPI shared-memory windows.
+  integer useSharedMemoryHalo = false;
+
+  /// True if recording the communications with each neighbor
+  /// and printing a summary at the end of the run.
+  integer communicationStatistics = false;
+
+  /// The number of cycles between two load balance reports,
+  /// 0 to only report at the end of the run, -1 if disabled.
+  integer loadBalanceReportInterval = -1;
+
+  /// True if compressing the buffers exchanged
+  /// to build the ghosts and the synchronization lists.
+  integer compressGhostBuffers = false;
+
+  /// True if packing the global indices of the maps
+  /// and relations as variable-length differences.
+  integer compactGlobalIndices = false;
+
+  /// True if assembling the independent blocks
+  /// of the coupled solvers concurrently.
+  integer concurrentAssembly = false;
+
+  /// True if summing the residual norms and the
+  /// dot products in a fixed order, reproducibly.
+  integer deterministicReductions = false;
+
   /// The name of the schema.
   std::string schemaName;
 
@@ -76,6 +113,58 @@ struct CommandLineOptions
 
   /// Suppress logging of host-device data migration.
   integer suppressMoveLogging = false;
+
+  /// True if logging the host-device moves of the wrappers
+  /// and printing a summary at the end of the run.
+  integer migrationAudit = false;
+
+  /// The cache file of the launch block size tuning, no tuning if empty.
+  std::string launchTuningCache = "";
+
+  /// True if fusing the device kernel launches of the
+  /// subregions sharing an element type and a constitutive model.
+  integer fuseKernelLaunches = false;
+
+  /// The file of the parameters of the realizations run
+  /// after a single setup, no ensemble if empty.
+  std::string ensembleFileName = "";
+
+  /// The number of groups of ranks running the
+  /// realizations of the ensemble concurrently.
+  integer ensembleGroups = 1;
+
+  /// The index of the group of ranks of this rank in the ensemble.
+  integer ensembleGroupIndex = 0;
+
+  /// The color of the GEOSX ranks when MPI_COMM_WORLD is shared with
+  /// a coupled code, negative if GEOSX runs alone.
+  integer couplingColor = -1;
+
+  /// The rank in MPI_COMM_WORLD of the first rank of the coupled code,
+  /// negative if GEOSX runs alone.
+  integer couplingRemoteLeader = -1;
+
+  /// The directory of the rank log files written by a background
+  /// thread, the rank messages go to the standard output if empty.
+  std::string rankLogDirectory = "";
+
+  /// True if printing the identical rank messages of all
+  /// the ranks once, from rank 0, at the end of each cycle.
+  integer aggregateRankLog = false;
+
+  /// The placement of the OpenMP threads pinned to the cores of the
+  /// rank, close or spread, the threads are not pinned if empty.
+  std::string threadAffinity = "";
+
+  /// The huge pages backing the large host allocations,
+  /// transparent or explicit, the default pages if empty.
+  std::string hugePages = "";
+
+  /// The size in MB from which a host allocation uses huge pages.
+  integer hugePageThreshold = 2;
+
+  /// The directory of the cached preprocessed meshes, no cache if empty.
+  std::string meshCacheDirectory = "";
 };
 
 /**
@@ -103,7 +192,7 @@ void overrideInputFileName( std::string const & inputFileName );
 void basicCleanup();
 
 /**
- * @brief Initialize the logger.
+ * @brief Initialize the logger, with the rank output selected on the command line once it is parsed.
  */
 void setupLogger();
 
@@ -128,6 +217,16 @@ void setupMKL();
  */
 void setupOpenMP();
 
+/**
+ * @brief Pin the OpenMP threads to the cores of the rank, as selected on the command line.
+ *
+ * The threads are bound in a first parallel region, so that the pages they touch first
+ * stay on their NUMA domain. With @c close the threads take consecutive cores, with @c spread
+ * they are distributed evenly over the cores of the rank. Without the option the placement is
+ * left to the OpenMP runtime, see OMP_PROC_BIND and OMP_PLACES.
+ */
+void setupThreadAffinity();
+
 /**
  * @brief Setup MPI.
  * @param [in] argc the number of command line arguments.
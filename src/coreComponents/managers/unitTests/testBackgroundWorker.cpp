@@ -0,0 +1,86 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "gtest/gtest.h"
+#include "managers/initialization.hpp"
+#include "managers/Events/BackgroundWorker.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+using namespace geosx;
+
+TEST( BackgroundWorker, runsTheTasksInOrder )
+{
+  std::vector< int > order;
+  {
+    BackgroundWorker worker( 3 );
+    for( int i = 0; i < 10; ++i )
+    {
+      worker.push( [&order, i]()
+      {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+        order.push_back( i );
+      } );
+      EXPECT_LE( worker.numPendingTasks(), 3 );
+    }
+    worker.wait();
+    EXPECT_EQ( worker.numPendingTasks(), 0 );
+  }
+
+  ASSERT_EQ( order.size(), 10 );
+  for( int i = 0; i < 10; ++i )
+  {
+    EXPECT_EQ( order[i], i );
+  }
+}
+
+TEST( BackgroundWorker, drainsTheTasksWhenDestroyed )
+{
+  std::atomic< int > numRun( 0 );
+  {
+    BackgroundWorker worker( 4 );
+    for( int i = 0; i < 4; ++i )
+    {
+      worker.push( [&numRun]() { ++numRun; } );
+    }
+  }
+  EXPECT_EQ( numRun, 4 );
+}
+
+TEST( BackgroundWorker, rethrowsTheErrorOfATask )
+{
+  BackgroundWorker worker;
+  worker.push( []() { throw std::runtime_error( "task failed" ); } );
+  EXPECT_THROW( worker.wait(), std::runtime_error );
+
+  // the error is only rethrown once
+  worker.push( []() {} );
+  EXPECT_NO_THROW( worker.wait() );
+}
+
+int main( int argc, char * * argv )
+{
+  basicSetup( argc, argv );
+
+  ::testing::InitGoogleTest( &argc, argv );
+
+  int const result = RUN_ALL_TESTS();
+
+  basicCleanup();
+
+  return result;
+}
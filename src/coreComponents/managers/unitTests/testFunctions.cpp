@@ -38,6 +38,26 @@ void evaluate1DFunction( FunctionBase * function,
   }
 }
 
+void evaluate1DTableOnDevice( TableFunction const & table,
+                              arrayView1d< real64 const > const & inputs,
+                              arrayView1d< real64 const > const & outputs )
+{
+  TableFunction::KernelWrapper const tableWrapper = table.createKernelWrapper();
+
+  real64_array predicted( inputs.size() );
+  arrayView1d< real64 > const & predictedView = predicted.toView();
+  forAll< parallelDevicePolicy<> >( inputs.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ii )
+  {
+    predictedView[ii] = tableWrapper.compute( &inputs[ii] );
+  } );
+  predicted.move( LvArray::MemorySpace::CPU, false );
+
+  for( localIndex ii=0; ii<inputs.size(); ++ii )
+  {
+    ASSERT_NEAR( predicted[ii], outputs[ii], 1e-10 );
+  }
+}
+
 
 
 TEST( FunctionTests, 1DTable )
@@ -121,6 +141,125 @@ TEST( FunctionTests, 1DTable )
 }
 
 
+TEST( FunctionTests, 1DTable_uniformOnDevice )
+{
+  FunctionManager * functionManager = &FunctionManager::FunctionManager::Instance();
+
+  // 1D table on a uniform axis, evaluated in a kernel
+  localIndex Naxis = 5;
+  localIndex Ntest = 7;
+
+  array1d< real64_array > coordinates;
+  coordinates.resize( 1 );
+  coordinates[0].resize( Naxis );
+  real64_array values( Naxis );
+  for( localIndex ii=0; ii<Naxis; ++ii )
+  {
+    coordinates[0][ii] = 0.1 * ii;
+    values[ii] = ii * ii;
+  }
+
+  TableFunction * table_u = functionManager->CreateChild( "TableFunction", "table_u" )->group_cast< TableFunction * >();
+  table_u->setTableCoordinates( coordinates );
+  table_u->setTableValues( values );
+  table_u->reInitializeFunction();
+
+  real64_array testCoordinates( Ntest );
+  testCoordinates[0] = -0.5;
+  testCoordinates[1] = 0.05;
+  testCoordinates[2] = 0.1;
+  testCoordinates[3] = 0.3;
+  testCoordinates[4] = 0.32;
+  testCoordinates[5] = 0.399;
+  testCoordinates[6] = 1.0;
+
+  // Linear Interpolation
+  real64_array testExpected( Ntest );
+  testExpected[0] = 0.0;
+  testExpected[1] = 0.5;
+  testExpected[2] = 1.0;
+  testExpected[3] = 9.0;
+  testExpected[4] = 10.4;
+  testExpected[5] = 15.93;
+  testExpected[6] = 16.0;
+  table_u->setInterpolationMethod( TableFunction::InterpolationType::Linear );
+  evaluate1DFunction( table_u, testCoordinates, testExpected );
+  evaluate1DTableOnDevice( *table_u, testCoordinates, testExpected );
+
+  // Lower, an input on a vertex gives its lower neighbor
+  testExpected[0] = 0.0;
+  testExpected[1] = 0.0;
+  testExpected[2] = 0.0;
+  testExpected[3] = 4.0;
+  testExpected[4] = 9.0;
+  testExpected[5] = 9.0;
+  testExpected[6] = 16.0;
+  table_u->setInterpolationMethod( TableFunction::InterpolationType::Lower );
+  evaluate1DFunction( table_u, testCoordinates, testExpected );
+  evaluate1DTableOnDevice( *table_u, testCoordinates, testExpected );
+}
+
+
+TEST( FunctionTests, 1DTable_sharedAxis )
+{
+  FunctionManager * functionManager = &FunctionManager::FunctionManager::Instance();
+
+  // Two tables on the same axis, a third one on another axis
+  localIndex Naxis = 4;
+  array1d< real64_array > coordinates;
+  coordinates.resize( 1 );
+  coordinates[0].resize( Naxis );
+  array1d< real64_array > otherCoordinates;
+  otherCoordinates.resize( 1 );
+  otherCoordinates[0].resize( Naxis );
+  real64_array values( Naxis );
+  for( localIndex ii=0; ii<Naxis; ++ii )
+  {
+    coordinates[0][ii] = ii * ii;
+    otherCoordinates[0][ii] = 2.0 * ii;
+    values[ii] = 1.5 - ii;
+  }
+
+  for( string const & name : { "shared_a", "shared_b", "shared_c" } )
+  {
+    TableFunction * table = functionManager->CreateChild( "TableFunction", name )->group_cast< TableFunction * >();
+    table->setTableCoordinates( name == "shared_c" ? otherCoordinates : coordinates );
+    for( localIndex ii=0; ii<Naxis; ++ii )
+    {
+      values[ii] *= -2.0;
+    }
+    table->setTableValues( values );
+    table->reInitializeFunction();
+  }
+
+  // The names may be in any order, and repeated
+  std::vector< string > const names = { "shared_b", "shared_a", "shared_c", "shared_b" };
+  std::vector< real64 > const inputs = { -1.0, 0.0, 0.5, 1.0, 3.0, 8.9, 20.0 };
+  for( TableFunction::InterpolationType const method : { TableFunction::InterpolationType::Linear,
+                                                         TableFunction::InterpolationType::Nearest,
+                                                         TableFunction::InterpolationType::Upper,
+                                                         TableFunction::InterpolationType::Lower } )
+  {
+    for( string const & name : names )
+    {
+      functionManager->getGroupReference< TableFunction >( name ).setInterpolationMethod( method );
+    }
+    functionManager->groupTables();
+
+    // The grouped tables give the values of their own evaluation
+    for( real64 const input : inputs )
+    {
+      std::vector< real64 > results;
+      functionManager->evaluate( names, input, results );
+      ASSERT_EQ( results.size(), names.size() );
+      for( std::size_t k = 0; k < names.size(); ++k )
+      {
+        EXPECT_DOUBLE_EQ( results[k], functionManager->getGroupReference< FunctionBase >( names[k] ).Evaluate( &input ) );
+      }
+    }
+  }
+}
+
 
 TEST( FunctionTests, 2DTable )
 {
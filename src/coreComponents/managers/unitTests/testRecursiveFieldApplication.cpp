@@ -18,6 +18,7 @@
 #include "managers/FieldSpecification/FieldSpecificationManager.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/initialization.hpp"
+#include "mesh/NodeManager.hpp"
 #include "rajaInterface/GEOS_RAJA_Interface.hpp"
 
 // TPL includes
@@ -49,7 +50,7 @@ void RegisterAndApplyField( DomainPartition * domain,
                                          Group * const targetGroup,
                                          string const name )
   {
-    bc->ApplyFieldValue< FieldSpecificationEqual >( targetSet, 0.0, targetGroup, name );
+    bc->ApplyFieldValue< FieldSpecificationEqual, parallelHostPolicy >( targetSet, 0.0, targetGroup, name );
   } );
 }
 
@@ -194,6 +195,37 @@ TEST( FieldSpecification, Recursive )
 
 }
 
+TEST( FieldSpecification, OwnedTargetSet )
+{
+  NodeManager nodeManager( "nodeManager", nullptr );
+  nodeManager.resize( 10 );
+  array1d< integer > & ghostRank = nodeManager.ghostRank();
+  ghostRank.setValues< serialPolicy >( -2 );
+  ghostRank[ 3 ] = 1;
+  ghostRank[ 7 ] = 0;
+
+  SortedArray< localIndex > targetSet;
+  for( localIndex i = 1; i < 10; i += 2 )
+  {
+    targetSet.insert( i );
+  }
+
+  FieldSpecificationBase fieldSpec( "fieldSpec", nullptr );
+  SortedArrayView< localIndex const > ownedSet = fieldSpec.GetOwnedTargetSet( nodeManager, "set", targetSet.toViewConst() );
+  ASSERT_EQ( ownedSet.size(), 3 );
+  EXPECT_EQ( ownedSet[ 0 ], 1 );
+  EXPECT_EQ( ownedSet[ 1 ], 5 );
+  EXPECT_EQ( ownedSet[ 2 ], 9 );
+
+  // The owned indices are kept as long as the set and the object keep their sizes
+  EXPECT_EQ( fieldSpec.GetOwnedTargetSet( nodeManager, "set", targetSet.toViewConst() ).data(), ownedSet.data() );
+
+  targetSet.insert( 8 );
+  ownedSet = fieldSpec.GetOwnedTargetSet( nodeManager, "set", targetSet.toViewConst() );
+  ASSERT_EQ( ownedSet.size(), 4 );
+  EXPECT_EQ( ownedSet[ 2 ], 8 );
+}
+
 
 int main( int argc, char * * argv )
 {
@@ -0,0 +1,485 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file DenseLA.hpp
+ * @brief Dense linear algebra on small matrices of compile time size, stored in C-arrays.
+ *
+ * The functions run on the host and on the device, without allocation nor library call, and are meant
+ * for the local matrices of the kernels, where BlasLapackLA would allocate arrays and call LAPACK for
+ * a few entries. The products, transposes and 3x3 inverses are those of LvArray::tensorOps, this file
+ * adds the factorizations, the symmetric eigen decomposition and the polar decomposition.
+ */
+
+#ifndef GEOSX_MATH_DENSELA_DENSELA_HPP_
+#define GEOSX_MATH_DENSELA_DENSELA_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/GeosxMacros.hpp"
+
+namespace geosx
+{
+
+namespace denseLA
+{
+
+/**
+ * @brief Compute the product C = alpha * A * B + beta * C.
+ * @tparam M the number of rows of A and C
+ * @tparam N the number of columns of B and C
+ * @tparam K the number of columns of A and of rows of B
+ * @param C the result
+ * @param A the left matrix
+ * @param B the right matrix
+ * @param alpha the scaling of the product
+ * @param beta the scaling of the previous value of C
+ */
+template< int M, int N, int K >
+GEOSX_HOST_DEVICE
+inline
+void matrixMatrixMultiply( real64 ( & C )[M][N],
+                           real64 const ( &A )[M][K],
+                           real64 const ( &B )[K][N],
+                           real64 const alpha = 1.0,
+                           real64 const beta = 0.0 )
+{
+  for( int i = 0; i < M; ++i )
+  {
+    for( int j = 0; j < N; ++j )
+    {
+      real64 value = 0.0;
+      for( int k = 0; k < K; ++k )
+      {
+        value += A[i][k] * B[k][j];
+      }
+      C[i][j] = alpha * value + ( beta == 0.0 ? 0.0 : beta * C[i][j] );
+    }
+  }
+}
+
+/**
+ * @brief Compute the LU factorization with partial pivoting P A = L U, in place.
+ * @tparam N the size of the matrix
+ * @param A the matrix, replaced by U in the upper triangle and the multipliers of L below
+ *   the diagonal, the unit diagonal of L is not stored
+ * @param pivots the row swapped with row i at step i
+ * @return false if the matrix is singular, in which case the factorization is incomplete
+ */
+template< int N >
+GEOSX_HOST_DEVICE
+inline
+bool luFactorize( real64 ( & A )[N][N],
+                  int ( & pivots )[N] )
+{
+  for( int k = 0; k < N; ++k )
+  {
+    int p = k;
+    for( int i = k + 1; i < N; ++i )
+    {
+      if( fabs( A[i][k] ) > fabs( A[p][k] ) )
+      {
+        p = i;
+      }
+    }
+    pivots[k] = p;
+    if( A[p][k] == 0.0 )
+    {
+      return false;
+    }
+    if( p != k )
+    {
+      for( int j = 0; j < N; ++j )
+      {
+        real64 const temp = A[k][j];
+        A[k][j] = A[p][j];
+        A[p][j] = temp;
+      }
+    }
+
+    real64 const invPivot = 1.0 / A[k][k];
+    for( int i = k + 1; i < N; ++i )
+    {
+      A[i][k] *= invPivot;
+      for( int j = k + 1; j < N; ++j )
+      {
+        A[i][j] -= A[i][k] * A[k][j];
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Solve A x = b with the LU factorization of A.
+ * @tparam N the size of the matrix
+ * @param LU the factorization computed by luFactorize()
+ * @param pivots the pivots computed by luFactorize()
+ * @param b the right-hand side, replaced by the solution
+ */
+template< int N >
+GEOSX_HOST_DEVICE
+inline
+void luSolve( real64 const ( &LU )[N][N],
+              int const ( &pivots )[N],
+              real64 ( & b )[N] )
+{
+  for( int k = 0; k < N; ++k )
+  {
+    real64 const temp = b[k];
+    b[k] = b[pivots[k]];
+    b[pivots[k]] = temp;
+  }
+  for( int i = 1; i < N; ++i )
+  {
+    for( int j = 0; j < i; ++j )
+    {
+      b[i] -= LU[i][j] * b[j];
+    }
+  }
+  for( int i = N - 1; i >= 0; --i )
+  {
+    for( int j = i + 1; j < N; ++j )
+    {
+      b[i] -= LU[i][j] * b[j];
+    }
+    b[i] /= LU[i][i];
+  }
+}
+
+/**
+ * @brief Compute the determinant of a matrix from its LU factorization.
+ * @tparam N the size of the matrix
+ * @param LU the factorization computed by luFactorize()
+ * @param pivots the pivots computed by luFactorize()
+ * @return the determinant
+ */
+template< int N >
+GEOSX_HOST_DEVICE
+inline
+real64 luDeterminant( real64 const ( &LU )[N][N],
+                      int const ( &pivots )[N] )
+{
+  real64 det = 1.0;
+  for( int k = 0; k < N; ++k )
+  {
+    det *= ( pivots[k] == k ) ? LU[k][k] : -LU[k][k];
+  }
+  return det;
+}
+
+/**
+ * @brief Compute the determinant of a matrix.
+ * @tparam N the size of the matrix
+ * @param A the matrix
+ * @return the determinant
+ */
+template< int N >
+GEOSX_HOST_DEVICE
+inline
+real64 determinant( real64 const ( &A )[N][N] )
+{
+  real64 LU[N][N];
+  for( int i = 0; i < N; ++i )
+  {
+    for( int j = 0; j < N; ++j )
+    {
+      LU[i][j] = A[i][j];
+    }
+  }
+  int pivots[N];
+  return luFactorize< N >( LU, pivots ) ? luDeterminant< N >( LU, pivots ) : 0.0;
+}
+
+/**
+ * @brief Compute the inverse of a matrix.
+ * @tparam N the size of the matrix
+ * @param A the matrix
+ * @param Ainv the inverse, unchanged if the matrix is singular
+ * @return the determinant of the matrix, zero if it is singular
+ */
+template< int N >
+GEOSX_HOST_DEVICE
+inline
+real64 matrixInverse( real64 const ( &A )[N][N],
+                      real64 ( & Ainv )[N][N] )
+{
+  real64 LU[N][N];
+  for( int i = 0; i < N; ++i )
+  {
+    for( int j = 0; j < N; ++j )
+    {
+      LU[i][j] = A[i][j];
+    }
+  }
+  int pivots[N];
+  if( !luFactorize< N >( LU, pivots ) )
+  {
+    return 0.0;
+  }
+
+  for( int j = 0; j < N; ++j )
+  {
+    real64 column[N] = { 0.0 };
+    column[j] = 1.0;
+    luSolve< N >( LU, pivots, column );
+    for( int i = 0; i < N; ++i )
+    {
+      Ainv[i][j] = column[i];
+    }
+  }
+  return luDeterminant< N >( LU, pivots );
+}
+
+/**
+ * @brief Compute the Cholesky factorization A = L L^T of a symmetric positive definite matrix, in place.
+ * @tparam N the size of the matrix
+ * @param A the matrix, of which only the lower triangle is read, replaced by L in the lower triangle
+ * @return false if the matrix is not positive definite, in which case the factorization is incomplete
+ */
+template< int N >
+GEOSX_HOST_DEVICE
+inline
+bool choleskyFactorize( real64 ( & A )[N][N] )
+{
+  for( int j = 0; j < N; ++j )
+  {
+    real64 diag = A[j][j];
+    for( int k = 0; k < j; ++k )
+    {
+      diag -= A[j][k] * A[j][k];
+    }
+    if( diag <= 0.0 )
+    {
+      return false;
+    }
+    A[j][j] = sqrt( diag );
+
+    real64 const invDiag = 1.0 / A[j][j];
+    for( int i = j + 1; i < N; ++i )
+    {
+      real64 value = A[i][j];
+      for( int k = 0; k < j; ++k )
+      {
+        value -= A[i][k] * A[j][k];
+      }
+      A[i][j] = value * invDiag;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Solve A x = b with the Cholesky factorization of A.
+ * @tparam N the size of the matrix
+ * @param L the factorization computed by choleskyFactorize(), of which only the lower triangle is read
+ * @param b the right-hand side, replaced by the solution
+ */
+template< int N >
+GEOSX_HOST_DEVICE
+inline
+void choleskySolve( real64 const ( &L )[N][N],
+                    real64 ( & b )[N] )
+{
+  for( int i = 0; i < N; ++i )
+  {
+    for( int j = 0; j < i; ++j )
+    {
+      b[i] -= L[i][j] * b[j];
+    }
+    b[i] /= L[i][i];
+  }
+  for( int i = N - 1; i >= 0; --i )
+  {
+    for( int j = i + 1; j < N; ++j )
+    {
+      b[i] -= L[j][i] * b[j];
+    }
+    b[i] /= L[i][i];
+  }
+}
+
+/**
+ * @brief Compute the eigenvalues and eigenvectors of a symmetric 3x3 matrix with the cyclic Jacobi method.
+ * @param A the symmetric matrix
+ * @param eigenvalues the eigenvalues, in increasing order
+ * @param eigenvectors the eigenvectors, stored in the columns in the order of the eigenvalues
+ *
+ * The rotations are applied until the off-diagonal entries are negligible with respect to the
+ * diagonal ones, which takes a few sweeps in double precision.
+ */
+GEOSX_HOST_DEVICE
+inline
+void symmetricEigen3( real64 const ( &A )[3][3],
+                      real64 ( & eigenvalues )[3],
+                      real64 ( & eigenvectors )[3][3] )
+{
+  constexpr int maxSweeps = 50;
+
+  real64 D[3][3];
+  for( int i = 0; i < 3; ++i )
+  {
+    for( int j = 0; j < 3; ++j )
+    {
+      D[i][j] = 0.5 * ( A[i][j] + A[j][i] );
+      eigenvectors[i][j] = ( i == j ) ? 1.0 : 0.0;
+    }
+  }
+
+  for( int sweep = 0; sweep < maxSweeps; ++sweep )
+  {
+    real64 const offDiag = D[0][1] * D[0][1] + D[0][2] * D[0][2] + D[1][2] * D[1][2];
+    real64 const diag = D[0][0] * D[0][0] + D[1][1] * D[1][1] + D[2][2] * D[2][2];
+    if( offDiag <= 1e-30 * diag || offDiag == 0.0 )
+    {
+      break;
+    }
+
+    for( int p = 0; p < 2; ++p )
+    {
+      for( int q = p + 1; q < 3; ++q )
+      {
+        if( D[p][q] == 0.0 )
+        {
+          continue;
+        }
+
+        // rotation zeroing D[p][q], with the smaller angle for stability
+        real64 const theta = ( D[q][q] - D[p][p] ) / ( 2.0 * D[p][q] );
+        real64 const t = ( theta >= 0 ? 1.0 : -1.0 ) / ( fabs( theta ) + sqrt( theta * theta + 1.0 ) );
+        real64 const c = 1.0 / sqrt( t * t + 1.0 );
+        real64 const s = t * c;
+
+        for( int k = 0; k < 3; ++k )
+        {
+          real64 const dkp = D[k][p];
+          real64 const dkq = D[k][q];
+          D[k][p] = c * dkp - s * dkq;
+          D[k][q] = s * dkp + c * dkq;
+        }
+        for( int k = 0; k < 3; ++k )
+        {
+          real64 const dpk = D[p][k];
+          real64 const dqk = D[q][k];
+          D[p][k] = c * dpk - s * dqk;
+          D[q][k] = s * dpk + c * dqk;
+        }
+        for( int k = 0; k < 3; ++k )
+        {
+          real64 const vkp = eigenvectors[k][p];
+          real64 const vkq = eigenvectors[k][q];
+          eigenvectors[k][p] = c * vkp - s * vkq;
+          eigenvectors[k][q] = s * vkp + c * vkq;
+        }
+      }
+    }
+  }
+
+  for( int i = 0; i < 3; ++i )
+  {
+    eigenvalues[i] = D[i][i];
+  }
+
+  // sort in increasing order, along with the eigenvectors
+  for( int i = 0; i < 2; ++i )
+  {
+    int minIndex = i;
+    for( int j = i + 1; j < 3; ++j )
+    {
+      if( eigenvalues[j] < eigenvalues[minIndex] )
+      {
+        minIndex = j;
+      }
+    }
+    if( minIndex != i )
+    {
+      real64 const temp = eigenvalues[i];
+      eigenvalues[i] = eigenvalues[minIndex];
+      eigenvalues[minIndex] = temp;
+      for( int k = 0; k < 3; ++k )
+      {
+        real64 const v = eigenvectors[k][i];
+        eigenvectors[k][i] = eigenvectors[k][minIndex];
+        eigenvectors[k][minIndex] = v;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Compute the polar decomposition F = R U of a 3x3 matrix with a positive determinant.
+ * @param F the matrix
+ * @param R the rotation
+ * @param U the right stretch, symmetric positive definite
+ *
+ * The stretch is the square root of F^T F, from its eigen decomposition, and the rotation is F U^{-1}.
+ * The finite strain kernels only need the incremental rotation, which the Hughes-Winget algorithm gives
+ * without a decomposition, this one is for the total rotation.
+ */
+GEOSX_HOST_DEVICE
+inline
+void polarDecomposition3( real64 const ( &F )[3][3],
+                          real64 ( & R )[3][3],
+                          real64 ( & U )[3][3] )
+{
+  real64 C[3][3];
+  for( int i = 0; i < 3; ++i )
+  {
+    for( int j = 0; j < 3; ++j )
+    {
+      C[i][j] = F[0][i] * F[0][j] + F[1][i] * F[1][j] + F[2][i] * F[2][j];
+    }
+  }
+
+  real64 eigenvalues[3];
+  real64 eigenvectors[3][3];
+  symmetricEigen3( C, eigenvalues, eigenvectors );
+
+  real64 stretch[3];
+  real64 invStretch[3];
+  for( int k = 0; k < 3; ++k )
+  {
+    stretch[k] = sqrt( eigenvalues[k] );
+    invStretch[k] = 1.0 / stretch[k];
+  }
+
+  real64 invU[3][3];
+  for( int i = 0; i < 3; ++i )
+  {
+    for( int j = 0; j < 3; ++j )
+    {
+      U[i][j] = 0.0;
+      invU[i][j] = 0.0;
+      for( int k = 0; k < 3; ++k )
+      {
+        real64 const vv = eigenvectors[i][k] * eigenvectors[j][k];
+        U[i][j] += stretch[k] * vv;
+        invU[i][j] += invStretch[k] * vv;
+      }
+    }
+  }
+
+  for( int i = 0; i < 3; ++i )
+  {
+    for( int j = 0; j < 3; ++j )
+    {
+      R[i][j] = F[i][0] * invU[0][j] + F[i][1] * invU[1][j] + F[i][2] * invU[2][j];
+    }
+  }
+}
+
+} // namespace denseLA
+
+} // namespace geosx
+
+#endif // GEOSX_MATH_DENSELA_DENSELA_HPP_
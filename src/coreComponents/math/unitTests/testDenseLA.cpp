@@ -0,0 +1,235 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/DataTypes.hpp"
+#include "math/denseLA/DenseLA.hpp"
+#include "LvArray/src/tensorOps.hpp"
+
+#include <random>
+
+using namespace geosx;
+
+namespace
+{
+
+constexpr real64 tolerance = 1e-12;
+
+template< int N >
+void randomMatrix( std::mt19937 & gen, real64 ( & A )[N][N] )
+{
+  std::uniform_real_distribution< real64 > value( -1.0, 1.0 );
+  for( int i = 0; i < N; ++i )
+  {
+    for( int j = 0; j < N; ++j )
+    {
+      A[i][j] = value( gen );
+    }
+  }
+}
+
+template< int N >
+void randomSymmetricPositiveDefinite( std::mt19937 & gen, real64 ( & A )[N][N] )
+{
+  real64 B[N][N];
+  randomMatrix< N >( gen, B );
+  for( int i = 0; i < N; ++i )
+  {
+    for( int j = 0; j < N; ++j )
+    {
+      A[i][j] = ( i == j ) ? N : 0.0;
+      for( int k = 0; k < N; ++k )
+      {
+        A[i][j] += B[i][k] * B[j][k];
+      }
+    }
+  }
+}
+
+}
+
+TEST( DenseLA, luSolveMatchesProduct )
+{
+  constexpr int N = 6;
+  std::mt19937 gen( 2020 );
+
+  real64 A[N][N];
+  randomMatrix< N >( gen, A );
+  real64 const x[N] = { 1.0, -2.0, 3.0, -4.0, 5.0, -6.0 };
+  real64 b[N] = { 0.0 };
+  for( int i = 0; i < N; ++i )
+  {
+    for( int j = 0; j < N; ++j )
+    {
+      b[i] += A[i][j] * x[j];
+    }
+  }
+
+  real64 LU[N][N];
+  LvArray::tensorOps::copy< N, N >( LU, A );
+  int pivots[N];
+  ASSERT_TRUE( denseLA::luFactorize< N >( LU, pivots ) );
+  denseLA::luSolve< N >( LU, pivots, b );
+  for( int i = 0; i < N; ++i )
+  {
+    EXPECT_NEAR( b[i], x[i], 1e-10 );
+  }
+}
+
+TEST( DenseLA, inverseAndDeterminant )
+{
+  constexpr int N = 5;
+  std::mt19937 gen( 2021 );
+
+  real64 A[N][N];
+  randomMatrix< N >( gen, A );
+  real64 Ainv[N][N];
+  real64 const det = denseLA::matrixInverse< N >( A, Ainv );
+  EXPECT_NEAR( det, denseLA::determinant< N >( A ), tolerance );
+
+  real64 I[N][N];
+  denseLA::matrixMatrixMultiply< N, N, N >( I, A, Ainv );
+  for( int i = 0; i < N; ++i )
+  {
+    for( int j = 0; j < N; ++j )
+    {
+      EXPECT_NEAR( I[i][j], ( i == j ) ? 1.0 : 0.0, 1e-10 );
+    }
+  }
+
+  real64 A3[3][3];
+  randomMatrix< 3 >( gen, A3 );
+  EXPECT_NEAR( denseLA::determinant< 3 >( A3 ), LvArray::tensorOps::determinant< 3 >( A3 ), tolerance );
+
+  real64 singular[3][3] = { { 1.0, 2.0, 3.0 }, { 2.0, 4.0, 6.0 }, { 0.0, 1.0, 1.0 } };
+  EXPECT_EQ( denseLA::determinant< 3 >( singular ), 0.0 );
+}
+
+TEST( DenseLA, choleskySolve )
+{
+  constexpr int N = 6;
+  std::mt19937 gen( 2022 );
+
+  real64 A[N][N];
+  randomSymmetricPositiveDefinite< N >( gen, A );
+  real64 b[N] = { 1.0, 0.0, -1.0, 2.0, 0.5, 3.0 };
+  real64 x[N];
+  LvArray::tensorOps::copy< N >( x, b );
+
+  real64 L[N][N];
+  LvArray::tensorOps::copy< N, N >( L, A );
+  ASSERT_TRUE( denseLA::choleskyFactorize< N >( L ) );
+  denseLA::choleskySolve< N >( L, x );
+  for( int i = 0; i < N; ++i )
+  {
+    real64 value = 0.0;
+    for( int j = 0; j < N; ++j )
+    {
+      value += A[i][j] * x[j];
+    }
+    EXPECT_NEAR( value, b[i], 1e-10 );
+  }
+
+  real64 indefinite[2][2] = { { 1.0, 2.0 }, { 2.0, 1.0 } };
+  EXPECT_FALSE( denseLA::choleskyFactorize< 2 >( indefinite ) );
+}
+
+TEST( DenseLA, symmetricEigen3 )
+{
+  std::mt19937 gen( 2023 );
+
+  real64 B[3][3];
+  randomMatrix< 3 >( gen, B );
+  real64 A[3][3];
+  for( int i = 0; i < 3; ++i )
+  {
+    for( int j = 0; j < 3; ++j )
+    {
+      A[i][j] = B[i][j] + B[j][i];
+    }
+  }
+
+  real64 eigenvalues[3];
+  real64 eigenvectors[3][3];
+  denseLA::symmetricEigen3( A, eigenvalues, eigenvectors );
+
+  EXPECT_LE( eigenvalues[0], eigenvalues[1] );
+  EXPECT_LE( eigenvalues[1], eigenvalues[2] );
+  for( int k = 0; k < 3; ++k )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      real64 Av = 0.0;
+      for( int j = 0; j < 3; ++j )
+      {
+        Av += A[i][j] * eigenvectors[j][k];
+      }
+      EXPECT_NEAR( Av, eigenvalues[k] * eigenvectors[i][k], 1e-10 );
+    }
+    for( int l = 0; l < 3; ++l )
+    {
+      real64 dot = 0.0;
+      for( int i = 0; i < 3; ++i )
+      {
+        dot += eigenvectors[i][k] * eigenvectors[i][l];
+      }
+      EXPECT_NEAR( dot, ( k == l ) ? 1.0 : 0.0, 1e-10 );
+    }
+  }
+
+  real64 diagonal[3][3] = { { 3.0, 0.0, 0.0 }, { 0.0, -1.0, 0.0 }, { 0.0, 0.0, 2.0 } };
+  denseLA::symmetricEigen3( diagonal, eigenvalues, eigenvectors );
+  EXPECT_EQ( eigenvalues[0], -1.0 );
+  EXPECT_EQ( eigenvalues[1], 2.0 );
+  EXPECT_EQ( eigenvalues[2], 3.0 );
+}
+
+TEST( DenseLA, polarDecomposition3 )
+{
+  std::mt19937 gen( 2023 );
+
+  // a deformation gradient close to the identity, as in a finite strain step
+  real64 F[3][3];
+  randomMatrix< 3 >( gen, F );
+  for( int i = 0; i < 3; ++i )
+  {
+    for( int j = 0; j < 3; ++j )
+    {
+      F[i][j] = 0.2 * F[i][j] + ( ( i == j ) ? 1.0 : 0.0 );
+    }
+  }
+
+  real64 R[3][3];
+  real64 U[3][3];
+  denseLA::polarDecomposition3( F, R, U );
+
+  EXPECT_NEAR( denseLA::determinant< 3 >( R ), 1.0, 1e-10 );
+  for( int i = 0; i < 3; ++i )
+  {
+    for( int j = 0; j < 3; ++j )
+    {
+      real64 RU = 0.0;
+      real64 RtR = 0.0;
+      for( int k = 0; k < 3; ++k )
+      {
+        RU += R[i][k] * U[k][j];
+        RtR += R[k][i] * R[k][j];
+      }
+      EXPECT_NEAR( RU, F[i][j], 1e-10 );
+      EXPECT_NEAR( RtR, ( i == j ) ? 1.0 : 0.0, 1e-10 );
+      EXPECT_NEAR( U[i][j], U[j][i], 1e-10 );
+    }
+  }
+}
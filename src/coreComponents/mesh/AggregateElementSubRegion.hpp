@@ -65,7 +65,7 @@ public:
    * @param[in,out] lambda all the fine cells in the aggregate
    */
   template< typename LAMBDA >
-  void forFineCellsInAggregate( localIndex aggregateIndex, LAMBDA lambda )
+  void forFineCellsInAggregate( localIndex aggregateIndex, LAMBDA lambda ) const
   {
     for( localIndex fineCell = m_nbFineCellsPerCoarseCell[aggregateIndex];
          fineCell < m_nbFineCellsPerCoarseCell[aggregateIndex+1]; fineCell++ )
@@ -75,6 +75,15 @@ public:
   }
 
 
+  /**
+   * @brief Gives the number of aggregate coarse cells.
+   * @return the number of aggregates, 0 if the aggregates have not been generated
+   */
+  localIndex GetNbAggregates() const
+  {
+    return m_nbFineCellsPerCoarseCell.size() > 0 ? m_nbFineCellsPerCoarseCell.size() - 1 : 0;
+  }
+
   /**
    * @brief Gives the number of fine cells of an aggregate coarse cell.
    * @param[in] aggregateIndex index of the aggregate coarse cell
@@ -38,24 +38,29 @@ localIndex Pack( buffer_unit_type * & buffer,
   {
     localIndex index = packList[a];
     sizeOfPackedChars += bufferOps::Pack< DO_PACKING >( buffer, var.m_toElementRegion.sizeOfArray( index ) );
+    globalIndex previousRegion = 0;
+    globalIndex previousSubRegion = 0;
+    globalIndex previousElement = 0;
     for( localIndex b=0; b<var.m_toElementRegion.sizeOfArray( index ); ++b )
     {
       localIndex elemRegionIndex    = var.m_toElementRegion[index][b];
       localIndex elemSubRegionIndex = var.m_toElementSubRegion[index][b];
       localIndex elemIndex          = var.m_toElementIndex[index][b];
 
-      sizeOfPackedChars += bufferOps::Pack< DO_PACKING >( buffer, elemRegionIndex );
-      sizeOfPackedChars += bufferOps::Pack< DO_PACKING >( buffer, elemSubRegionIndex );
+      sizeOfPackedChars += bufferOps::PackGlobalIndex< DO_PACKING >( buffer, elemRegionIndex, previousRegion );
+      sizeOfPackedChars += bufferOps::PackGlobalIndex< DO_PACKING >( buffer, elemSubRegionIndex, previousSubRegion );
 
       if( elemRegionIndex!=-1 && elemSubRegionIndex!=-1 && elemIndex!=-1 )
       {
         ElementRegionBase const * const elemRegion = elementRegionManager->GetRegion( elemRegionIndex );
         ElementSubRegionBase const * const elemSubRegion = elemRegion->GetSubRegion( elemSubRegionIndex );
-        sizeOfPackedChars += bufferOps::Pack< DO_PACKING >( buffer, elemSubRegion->localToGlobalMap()[elemIndex] );
+        sizeOfPackedChars += bufferOps::PackGlobalIndex< DO_PACKING >( buffer,
+                                                                       elemSubRegion->localToGlobalMap()[elemIndex],
+                                                                       previousElement );
       }
       else
       {
-        sizeOfPackedChars += bufferOps::Pack< DO_PACKING >( buffer, elemIndex );
+        sizeOfPackedChars += bufferOps::PackGlobalIndex< DO_PACKING >( buffer, elemIndex, previousElement );
       }
     }
   }
@@ -104,17 +109,22 @@ localIndex Unpack( buffer_unit_type const * & buffer,
       }
     }
 
+    globalIndex previousRegion = 0;
+    globalIndex previousSubRegion = 0;
+    globalIndex previousElement = 0;
     for( localIndex b=0; b<numIndicesUnpacked; ++b )
     {
 
-      localIndex elemRegionIndex;
-      sizeOfUnpackedChars += bufferOps::Unpack( buffer, elemRegionIndex );
+      globalIndex recvElemRegionIndex;
+      sizeOfUnpackedChars += bufferOps::UnpackGlobalIndex( buffer, recvElemRegionIndex, previousRegion );
+      localIndex const elemRegionIndex = LvArray::integerConversion< localIndex >( recvElemRegionIndex );
 
-      localIndex elemSubRegionIndex;
-      sizeOfUnpackedChars += bufferOps::Unpack( buffer, elemSubRegionIndex );
+      globalIndex recvElemSubRegionIndex;
+      sizeOfUnpackedChars += bufferOps::UnpackGlobalIndex( buffer, recvElemSubRegionIndex, previousSubRegion );
+      localIndex const elemSubRegionIndex = LvArray::integerConversion< localIndex >( recvElemSubRegionIndex );
 
       globalIndex globalElementIndex;
-      sizeOfUnpackedChars += bufferOps::Unpack( buffer, globalElementIndex );
+      sizeOfUnpackedChars += bufferOps::UnpackGlobalIndex( buffer, globalElementIndex, previousElement );
 
       if( elemRegionIndex!=-1 && elemSubRegionIndex!=-1 )
       {
@@ -168,24 +178,29 @@ localIndex Pack( buffer_unit_type * & buffer,
   {
     localIndex index = packList[a];
     sizeOfPackedChars += bufferOps::Pack< DO_PACKING >( buffer, var.m_toElementRegion.size( 1 ) );
+    globalIndex previousRegion = 0;
+    globalIndex previousSubRegion = 0;
+    globalIndex previousElement = 0;
     for( localIndex b=0; b<var.m_toElementRegion.size( 1 ); ++b )
     {
       localIndex elemRegionIndex    = var.m_toElementRegion[index][b];
       localIndex elemSubRegionIndex = var.m_toElementSubRegion[index][b];
       localIndex elemIndex          = var.m_toElementIndex[index][b];
 
-      sizeOfPackedChars += bufferOps::Pack< DO_PACKING >( buffer, elemRegionIndex );
-      sizeOfPackedChars += bufferOps::Pack< DO_PACKING >( buffer, elemSubRegionIndex );
+      sizeOfPackedChars += bufferOps::PackGlobalIndex< DO_PACKING >( buffer, elemRegionIndex, previousRegion );
+      sizeOfPackedChars += bufferOps::PackGlobalIndex< DO_PACKING >( buffer, elemSubRegionIndex, previousSubRegion );
 
       if( elemRegionIndex!=-1 && elemSubRegionIndex!=-1 && elemIndex!=-1 )
       {
         ElementRegionBase const * const elemRegion = elementRegionManager->GetRegion( elemRegionIndex );
         ElementSubRegionBase const * const elemSubRegion = elemRegion->GetSubRegion( elemSubRegionIndex );
-        sizeOfPackedChars += bufferOps::Pack< DO_PACKING >( buffer, elemSubRegion->localToGlobalMap()[elemIndex] );
+        sizeOfPackedChars += bufferOps::PackGlobalIndex< DO_PACKING >( buffer,
+                                                                       elemSubRegion->localToGlobalMap()[elemIndex],
+                                                                       previousElement );
       }
       else
       {
-        sizeOfPackedChars += bufferOps::Pack< DO_PACKING >( buffer, elemIndex );
+        sizeOfPackedChars += bufferOps::PackGlobalIndex< DO_PACKING >( buffer, elemIndex, previousElement );
       }
     }
   }
@@ -223,15 +238,21 @@ localIndex Unpack( buffer_unit_type const * & buffer,
     sizeOfUnpackedChars += bufferOps::Unpack( buffer, numSubIndicesUnpacked );
     GEOSX_ERROR_IF( numSubIndicesUnpacked != var.m_toElementRegion.size( 1 ), "" );
 
+    globalIndex previousRegion = 0;
+    globalIndex previousSubRegion = 0;
+    globalIndex previousElement = 0;
     for( localIndex b=0; b<numSubIndicesUnpacked; ++b )
     {
-      localIndex recvElemRegionIndex;
-      localIndex recvElemSubRegionIndex;
+      globalIndex recvRegionIndex;
+      globalIndex recvSubRegionIndex;
       globalIndex globalElementIndex;
 
-      sizeOfUnpackedChars += bufferOps::Unpack( buffer, recvElemRegionIndex );
-      sizeOfUnpackedChars += bufferOps::Unpack( buffer, recvElemSubRegionIndex );
-      sizeOfUnpackedChars += bufferOps::Unpack( buffer, globalElementIndex );
+      sizeOfUnpackedChars += bufferOps::UnpackGlobalIndex( buffer, recvRegionIndex, previousRegion );
+      sizeOfUnpackedChars += bufferOps::UnpackGlobalIndex( buffer, recvSubRegionIndex, previousSubRegion );
+      sizeOfUnpackedChars += bufferOps::UnpackGlobalIndex( buffer, globalElementIndex, previousElement );
+
+      localIndex const recvElemRegionIndex = LvArray::integerConversion< localIndex >( recvRegionIndex );
+      localIndex const recvElemSubRegionIndex = LvArray::integerConversion< localIndex >( recvSubRegionIndex );
 
       if( recvElemRegionIndex!=-1 && recvElemSubRegionIndex!=-1 && globalElementIndex!=-1 )
       {
@@ -0,0 +1,401 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CachedElementViewAccessor.hpp
+ */
+
+#ifndef GEOSX_MESH_CACHEDELEMENTVIEWACCESSOR_HPP_
+#define GEOSX_MESH_CACHEDELEMENTVIEWACCESSOR_HPP_
+
+#include "mesh/ElementRegionManager.hpp"
+
+#include <vector>
+
+namespace geosx
+{
+
+/**
+ * @class CachedElementViewAccessor
+ * @brief An ElementViewAccessor kept by a solver, built once and rebuilt only when the data it views changes.
+ * @tparam VIEWTYPE the type of the wrapped data, an Array
+ * @tparam LHS the type of the views stored in the accessor
+ *
+ * Building an accessor allocates its nested arrays and looks up by string every region, subregion and
+ * wrapper. The cached accessor keeps, for each subregion, the keys of the groups and of the wrapper it
+ * was built from, which are resolved by a comparison of the container layout stamps, along with the data
+ * pointer and size of the array it views. It is rebuilt if any of them changed: a region or subregion was
+ * added, a wrapper was registered or removed, or an array was resized or reallocated.
+ */
+template< typename VIEWTYPE, typename LHS = VIEWTYPE >
+class CachedElementViewAccessor
+{
+public:
+
+  /// The type of the accessor
+  using Accessor = ElementRegionManager::ElementViewAccessor< LHS >;
+
+  /**
+   * @brief Set the name given to the accessor when it is built.
+   * @param name the name
+   */
+  void setName( string const & name )
+  {
+    m_name = name;
+    m_accessor.setName( m_name );
+  }
+
+  /**
+   * @brief Get the accessor of data registered on the mesh, building it if it is not valid anymore.
+   * @param elemManager the element region manager
+   * @param viewName view name of the data
+   * @param neighborName neighbor data name
+   * @return the accessor
+   */
+  Accessor const & get( ElementRegionManager const & elemManager,
+                        string const & viewName,
+                        string const & neighborName = string() )
+  {
+    if( !isValid( elemManager, viewName, neighborName ) )
+    {
+      m_accessor = elemManager.ConstructViewAccessor< VIEWTYPE, LHS >( viewName, neighborName );
+      setKeys( elemManager, viewName, ObjectManagerBase::groupKeyStruct::neighborDataString, neighborName, false );
+    }
+    return m_accessor;
+  }
+
+  /**
+   * @copydoc get(ElementRegionManager const &, string const &, string const &)
+   */
+  Accessor const & get( ElementRegionManager & elemManager,
+                        string const & viewName,
+                        string const & neighborName = string() )
+  {
+    if( !isValid( elemManager, viewName, neighborName ) )
+    {
+      m_accessor = elemManager.ConstructViewAccessor< VIEWTYPE, LHS >( viewName, neighborName );
+      setKeys( elemManager, viewName, ObjectManagerBase::groupKeyStruct::neighborDataString, neighborName, false );
+    }
+    return m_accessor;
+  }
+
+  /**
+   * @brief Get the accessor of material data, building it if it is not valid anymore.
+   * @param elemManager the element region manager
+   * @param viewName view name of the data
+   * @param regionNames list of region names
+   * @param materialNames list of corresponding material names
+   * @param allowMissingViews flag to indicate whether it is allowed to miss the specified material data in material list
+   * @return the accessor
+   */
+  Accessor const & getMaterial( ElementRegionManager const & elemManager,
+                                string const & viewName,
+                                arrayView1d< string const > const & regionNames,
+                                arrayView1d< string const > const & materialNames,
+                                bool const allowMissingViews = false )
+  {
+    if( !isValid( elemManager, viewName, regionNames, materialNames ) )
+    {
+      m_accessor = elemManager.ConstructMaterialViewAccessor< VIEWTYPE, LHS >( viewName, regionNames, materialNames, allowMissingViews );
+      setMaterialKeys( elemManager, viewName, regionNames, materialNames );
+    }
+    return m_accessor;
+  }
+
+  /**
+   * @brief Drop the accessor, the next call builds it.
+   */
+  void clear()
+  {
+    m_accessor.clear();
+    m_entries.clear();
+    m_viewName.clear();
+  }
+
+private:
+
+  /// Where the data of the subregions of a region is
+  enum class Location : integer
+  {
+    none,      ///< the region has no data, as the regions without material in a material accessor
+    subRegion, ///< the data is on the subregions
+    group      ///< the data is in a group of the subregions
+  };
+
+  /// The keys an accessor entry was built from, and the data it views
+  struct Entry
+  {
+    /// Key of the group holding the groups of the data in the subregion, unused if the data is on the subregion
+    dataRepository::GroupKey parentKey;
+
+    /// Key of the group holding the data in the parent group, unused if the data is on the subregion
+    dataRepository::GroupKey groupKey;
+
+    /// Key of the wrapper
+    dataRepository::ViewKey wrapperKey;
+
+    /// The wrapper the view was taken from, nullptr if there was none
+    dataRepository::WrapperBase const * wrapper;
+
+    /// The data pointer of the wrapped array
+    void const * data;
+
+    /// The size of the wrapped array
+    localIndex size;
+  };
+
+  /**
+   * @brief Find the wrapper an entry views.
+   * @param subRegion the subregion of the entry
+   * @param entry the entry
+   * @param location where the data is
+   * @return the wrapper, nullptr if there is none or if it does not wrap a VIEWTYPE
+   */
+  static dataRepository::WrapperBase const * findWrapper( ElementSubRegionBase const & subRegion,
+                                                          Entry const & entry,
+                                                          Location const location )
+  {
+    if( location == Location::none )
+    {
+      return nullptr;
+    }
+    dataRepository::Group const * group = &subRegion;
+    if( location == Location::group )
+    {
+      group = subRegion.GetGroup( entry.parentKey );
+      group = ( group != nullptr ) ? group->GetGroup( entry.groupKey ) : nullptr;
+    }
+    dataRepository::WrapperBase const * const wrapper = ( group != nullptr ) ? group->getWrapperBase( entry.wrapperKey ) : nullptr;
+    return ( wrapper != nullptr && wrapper->get_typeid() == typeid( VIEWTYPE ) ) ? wrapper : nullptr;
+  }
+
+  /**
+   * @brief Record the data viewed by an entry.
+   * @param entry the entry
+   * @param wrapper the wrapper of the entry, nullptr if there is none
+   */
+  static void setData( Entry & entry, dataRepository::WrapperBase const * const wrapper )
+  {
+    entry.wrapper = nullptr;
+    entry.data = nullptr;
+    entry.size = 0;
+    if( wrapper != nullptr )
+    {
+      VIEWTYPE const & array = static_cast< dataRepository::Wrapper< VIEWTYPE > const * >( wrapper )->reference();
+      entry.wrapper = wrapper;
+      entry.data = array.data();
+      entry.size = array.size();
+    }
+  }
+
+  /**
+   * @brief Check that the entries still describe the regions, subregions and data of the mesh.
+   * @param elemManager the element region manager
+   * @return true if the accessor is valid
+   */
+  bool entriesAreValid( ElementRegionManager const & elemManager ) const
+  {
+    localIndex k = 0;
+    for( localIndex er = 0; er < elemManager.numRegions(); ++er )
+    {
+      ElementRegionBase const & region = *elemManager.GetRegion( er );
+      if( region.numSubRegions() != m_accessor[er].size() )
+      {
+        return false;
+      }
+      for( localIndex esr = 0; esr < region.numSubRegions(); ++esr, ++k )
+      {
+        Entry const & entry = m_entries[k];
+        dataRepository::WrapperBase const * const wrapper = findWrapper( *region.GetSubRegion( esr ), entry, m_locations[er] );
+        if( wrapper != entry.wrapper )
+        {
+          return false;
+        }
+        if( wrapper != nullptr )
+        {
+          VIEWTYPE const & array = static_cast< dataRepository::Wrapper< VIEWTYPE > const * >( wrapper )->reference();
+          if( array.data() != entry.data || array.size() != entry.size )
+          {
+            return false;
+          }
+        }
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Check that the accessor views the given element data of the mesh.
+   * @param elemManager the element region manager
+   * @param viewName view name of the data
+   * @param neighborName neighbor data name
+   * @return true if the accessor is valid
+   */
+  bool isValid( ElementRegionManager const & elemManager,
+                string const & viewName,
+                string const & neighborName ) const
+  {
+    return !m_viewName.empty() &&
+           !m_isMaterial &&
+           viewName == m_viewName &&
+           neighborName == m_neighborName &&
+           elemManager.numRegions() == m_accessor.size() &&
+           entriesAreValid( elemManager );
+  }
+
+  /**
+   * @brief Check that the accessor views the given material data of the mesh.
+   * @param elemManager the element region manager
+   * @param viewName view name of the data
+   * @param regionNames list of region names
+   * @param materialNames list of corresponding material names
+   * @return true if the accessor is valid
+   */
+  bool isValid( ElementRegionManager const & elemManager,
+                string const & viewName,
+                arrayView1d< string const > const & regionNames,
+                arrayView1d< string const > const & materialNames ) const
+  {
+    if( m_viewName.empty() ||
+        !m_isMaterial ||
+        viewName != m_viewName ||
+        regionNames.size() != m_regionNames.size() ||
+        elemManager.numRegions() != m_accessor.size() )
+    {
+      return false;
+    }
+    for( localIndex k = 0; k < regionNames.size(); ++k )
+    {
+      if( regionNames[k] != m_regionNames[k] || materialNames[k] != m_materialNames[k] )
+      {
+        return false;
+      }
+    }
+    return entriesAreValid( elemManager );
+  }
+
+  /**
+   * @brief Record the keys and data of a freshly built accessor.
+   * @param elemManager the element region manager
+   * @param viewName view name of the data
+   * @param parentName name of the group holding the groups of the data in the subregions
+   * @param groupName name of the group holding the data, empty if the data is on the subregions
+   * @param isMaterial whether the accessor views material data
+   */
+  void setKeys( ElementRegionManager const & elemManager,
+                string const & viewName,
+                string const & parentName,
+                string const & groupName,
+                bool const isMaterial )
+  {
+    m_viewName = viewName;
+    m_neighborName = isMaterial ? string() : groupName;
+    m_isMaterial = isMaterial;
+    if( !m_name.empty() )
+    {
+      m_accessor.setName( m_name );
+    }
+
+    m_entries.clear();
+    m_locations.assign( elemManager.numRegions(), groupName.empty() ? Location::subRegion : Location::group );
+    for( localIndex er = 0; er < elemManager.numRegions(); ++er )
+    {
+      ElementRegionBase const & region = *elemManager.GetRegion( er );
+      for( localIndex esr = 0; esr < region.numSubRegions(); ++esr )
+      {
+        m_entries.push_back( Entry{ parentName, groupName, viewName, nullptr, nullptr, 0 } );
+        Entry & entry = m_entries.back();
+        setData( entry, findWrapper( *region.GetSubRegion( esr ), entry, m_locations[er] ) );
+      }
+    }
+  }
+
+  /**
+   * @brief Record the keys and data of a freshly built material accessor.
+   * @param elemManager the element region manager
+   * @param viewName view name of the data
+   * @param regionNames list of region names
+   * @param materialNames list of corresponding material names
+   */
+  void setMaterialKeys( ElementRegionManager const & elemManager,
+                        string const & viewName,
+                        arrayView1d< string const > const & regionNames,
+                        arrayView1d< string const > const & materialNames )
+  {
+    m_regionNames.clear();
+    m_materialNames.clear();
+    std::vector< string > regionMaterials( elemManager.numRegions() );
+    for( localIndex k = 0; k < regionNames.size(); ++k )
+    {
+      m_regionNames.emplace_back( regionNames[k] );
+      m_materialNames.emplace_back( materialNames[k] );
+      regionMaterials[ elemManager.GetRegions().getIndex( regionNames[k] ) ] = materialNames[k];
+    }
+
+    m_viewName = viewName;
+    m_neighborName.clear();
+    m_isMaterial = true;
+    if( !m_name.empty() )
+    {
+      m_accessor.setName( m_name );
+    }
+
+    // the subregions of the regions not listed have no data, as in the accessor
+    m_entries.clear();
+    m_locations.clear();
+    for( localIndex er = 0; er < elemManager.numRegions(); ++er )
+    {
+      ElementRegionBase const & region = *elemManager.GetRegion( er );
+      m_locations.push_back( regionMaterials[er].empty() ? Location::none : Location::group );
+      for( localIndex esr = 0; esr < region.numSubRegions(); ++esr )
+      {
+        m_entries.push_back( Entry{ string( ElementSubRegionBase::groupKeyStruct::constitutiveModelsString ),
+                                    regionMaterials[er], viewName, nullptr, nullptr, 0 } );
+        Entry & entry = m_entries.back();
+        setData( entry, findWrapper( *region.GetSubRegion( esr ), entry, m_locations[er] ) );
+      }
+    }
+  }
+
+  /// The accessor
+  Accessor m_accessor;
+
+  /// The name given to the accessor
+  string m_name;
+
+  /// The view name of the data, empty if the accessor was not built
+  string m_viewName;
+
+  /// The neighbor data name
+  string m_neighborName;
+
+  /// Whether the accessor views material data
+  bool m_isMaterial = false;
+
+  /// The regions of the material data
+  std::vector< string > m_regionNames;
+
+  /// The materials of the regions
+  std::vector< string > m_materialNames;
+
+  /// Where the data of the subregions of each region is
+  std::vector< Location > m_locations;
+
+  /// The keys and data of the subregions, region by region
+  std::vector< Entry > m_entries;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MESH_CACHEDELEMENTVIEWACCESSOR_HPP_ */
@@ -312,10 +312,17 @@ void CellBlock::CalculateElementGeometricQuantities( NodeManager const & nodeMan
                                                      FaceManager const & GEOSX_UNUSED_PARAM( facemanager ) )
 {
   arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager.referencePosition();
+  arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = m_toNodesRelation.toViewConst();
+  arrayView2d< real64 > const elementCenter = m_elementCenter;
+  arrayView1d< real64 > const elementVolume = m_elementVolume;
+  localIndex const numNodesPerElement = m_numNodesPerElement;
 
-  forAll< serialPolicy >( this->size(), [=] ( localIndex const k )
+  forAll< parallelHostPolicy >( this->size(), [=] GEOSX_HOST_DEVICE ( localIndex const k )
   {
-    CalculateCellVolumesKernel( k, X );
+    elementVolume[ k ] = computationalGeometry::CellCenterAndVolume( elemsToNodes[ k ],
+                                                                     numNodesPerElement,
+                                                                     X,
+                                                                     elementCenter[ k ] );
   } );
 }
 
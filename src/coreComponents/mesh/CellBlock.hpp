@@ -129,47 +129,6 @@ public:
     } );
   }
 
-  /**
-   * @brief Compute the volume of the k-th element in the subregion.
-   * @param[in] k the index of the element in the subregion
-   * @param[in] X an arrayView of (const) node positions
-   */
-  inline void CalculateCellVolumesKernel( localIndex const k,
-                                          arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X ) const
-  {
-    LvArray::tensorOps::fill< 3 >( m_elementCenter[ k ], 0 );
-
-    R1Tensor Xlocal[10];
-
-    for( localIndex a = 0; a < m_numNodesPerElement; ++a )
-    {
-      Xlocal[ a ] = X[ m_toNodesRelation( k, a ) ];
-      LvArray::tensorOps::add< 3 >( m_elementCenter[ k ], X[ m_toNodesRelation( k, a ) ] );
-    }
-    LvArray::tensorOps::scale< 3 >( m_elementCenter[ k ], 1.0 / m_numNodesPerElement );
-
-    if( m_numNodesPerElement == 8 )
-    {
-      m_elementVolume[k] = computationalGeometry::HexVolume( Xlocal );
-    }
-    else if( m_numNodesPerElement == 4 )
-    {
-      m_elementVolume[k] = computationalGeometry::TetVolume( Xlocal );
-    }
-    else if( m_numNodesPerElement == 6 )
-    {
-      m_elementVolume[k] = computationalGeometry::WedgeVolume( Xlocal );
-    }
-    else if( m_numNodesPerElement == 5 )
-    {
-      m_elementVolume[k] = computationalGeometry::PyramidVolume( Xlocal );
-    }
-    else
-    {
-      GEOSX_ERROR( "GEOX does not support cells with " << m_numNodesPerElement << " nodes" );
-    }
-  }
-
   ///@}
 
   /**
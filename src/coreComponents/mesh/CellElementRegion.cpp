@@ -100,11 +100,11 @@ void CellElementRegion::GenerateAggregates( FaceManager const * const faceManage
   array1d< localIndex > offsetSubRegions( this->GetSubRegions().size() );
   for( localIndex subRegionIndex = 1; subRegionIndex < offsetSubRegions.size(); subRegionIndex++ )
   {
-    offsetSubRegions[subRegionIndex] = offsetSubRegions[subRegionIndex - 1] + this->GetSubRegion( subRegionIndex )->size();
+    offsetSubRegions[subRegionIndex] = offsetSubRegions[subRegionIndex - 1] + this->GetSubRegion( subRegionIndex - 1 )->size();
   }
   for( localIndex kf = 0; kf < faceManager->size(); ++kf )
   {
-    if( elemRegionList[kf][0] == regionIndex && elemRegionList[kf][1] == regionIndex && elemRegionList[kf][0] )
+    if( elemRegionList[kf][0] == regionIndex && elemRegionList[kf][1] == regionIndex )
     {
       localIndex const esr0 = elemSubRegionList[kf][0];
       idx_t const ei0  = LvArray::integerConversion< idx_t >( elemList[kf][0] + offsetSubRegions[esr0] );
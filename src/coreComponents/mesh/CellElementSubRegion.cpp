@@ -23,7 +23,8 @@ using namespace dataRepository;
 using namespace constitutive;
 
 CellElementSubRegion::CellElementSubRegion( string const & name, Group * const parent ):
-  CellBlock( name, parent )
+  CellBlock( name, parent ),
+  m_numElementColors( 0 )
 {
   registerWrapper( viewKeyStruct::constitutiveGroupingString, &m_constitutiveGrouping )->
     setSizedFromParent( 0 );
@@ -33,6 +34,11 @@ CellElementSubRegion::CellElementSubRegion( string const & name, Group * const p
   registerWrapper( viewKeyStruct::dNdXString, &m_dNdX )->setSizedFromParent( 1 )->reference().resizeDimension< 3 >( 3 );
 
   registerWrapper( viewKeyStruct::detJString, &m_detJ )->setSizedFromParent( 1 )->reference();
+
+  registerWrapper( viewKeyStruct::elementColorString, &m_elementColor )->
+    setSizedFromParent( 1 )->
+    setPlotLevel( PlotLevel::NOPLOT )->
+    setRestartFlags( RestartFlags::NO_WRITE );
 }
 
 CellElementSubRegion::~CellElementSubRegion()
@@ -74,6 +80,109 @@ void CellElementSubRegion::CopyFromCellBlock( CellBlock * source )
   } );
 }
 
+void CellElementSubRegion::computeElementColoring()
+{
+  arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = nodeList();
+  localIndex const numElems = elemsToNodes.size( 0 );
+  localIndex const numNodesPerElem = elemsToNodes.size( 1 );
+
+  // Build the node-to-element map restricted to this subregion
+  localIndex numNodes = 0;
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      numNodes = std::max( numNodes, elemsToNodes( k, a ) + 1 );
+    }
+  }
+
+  array1d< localIndex > nodeOffsets( numNodes + 1 );
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      ++nodeOffsets[ elemsToNodes( k, a ) + 1 ];
+    }
+  }
+  for( localIndex n = 0; n < numNodes; ++n )
+  {
+    nodeOffsets[ n + 1 ] += nodeOffsets[ n ];
+  }
+
+  array1d< localIndex > nodeElems( nodeOffsets[ numNodes ] );
+  array1d< localIndex > nodeFill( numNodes );
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      localIndex const n = elemsToNodes( k, a );
+      nodeElems[ nodeOffsets[ n ] + nodeFill[ n ]++ ] = k;
+    }
+  }
+
+  // Greedy coloring: each element takes the smallest color not used by an already colored neighbor.
+  // colorUsedBy[c] == k flags color c as taken for element k, which avoids resetting the flags.
+  m_elementColor.resize( numElems );
+  m_elementColor.setValues< serialPolicy >( -1 );
+  m_numElementColors = 0;
+  array1d< localIndex > colorUsedBy;
+
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      localIndex const n = elemsToNodes( k, a );
+      for( localIndex i = nodeOffsets[ n ]; i < nodeOffsets[ n + 1 ]; ++i )
+      {
+        integer const neighborColor = m_elementColor[ nodeElems[ i ] ];
+        if( neighborColor >= 0 )
+        {
+          colorUsedBy[ neighborColor ] = k;
+        }
+      }
+    }
+
+    integer color = 0;
+    while( color < m_numElementColors && colorUsedBy[ color ] == k )
+    {
+      ++color;
+    }
+    if( color == m_numElementColors )
+    {
+      ++m_numElementColors;
+      colorUsedBy.emplace_back( -1 );
+    }
+    m_elementColor[ k ] = color;
+  }
+}
+
+void CellElementSubRegion::sortElementsByColor( SortedArrayView< localIndex const > const & elements,
+                                                array1d< localIndex > & coloredElements,
+                                                array1d< localIndex > & colorOffsets ) const
+{
+  GEOSX_ERROR_IF( m_numElementColors == 0 && size() > 0, "The elements of " << getName() << " have not been colored" );
+
+  colorOffsets.resize( m_numElementColors + 1 );
+  colorOffsets.setValues< serialPolicy >( 0 );
+  for( localIndex const k : elements )
+  {
+    ++colorOffsets[ m_elementColor[ k ] + 1 ];
+  }
+  for( integer c = 0; c < m_numElementColors; ++c )
+  {
+    colorOffsets[ c + 1 ] += colorOffsets[ c ];
+  }
+
+  // Counting sort, stable so that the elements of a color keep their index order
+  array1d< localIndex > colorFill( m_numElementColors );
+  coloredElements.resize( elements.size() );
+  for( localIndex const k : elements )
+  {
+    integer const color = m_elementColor[ k ];
+    coloredElements[ colorOffsets[ color ] + colorFill[ color ]++ ] = k;
+  }
+}
+
 void CellElementSubRegion::ConstructSubRegionFromFaceSet( FaceManager const * const faceManager,
                                                           string const & setName )
 {
@@ -111,6 +111,38 @@ public:
     }
   }
 
+  /**
+   * @brief Color the elements such that two elements sharing a node never have the same color.
+   *
+   * The elements of one color can scatter their contributions to the nodes concurrently
+   * without atomics. The coloring is greedy in element index order, hence deterministic.
+   */
+  void computeElementColoring();
+
+  /**
+   * @brief Sort a list of elements by color.
+   * @param elements the elements to sort
+   * @param coloredElements the elements grouped by color, in increasing index order within a color
+   * @param colorOffsets the offset of each color in @p coloredElements, of size numElementColors() + 1
+   *
+   * computeElementColoring() must have been called first.
+   */
+  void sortElementsByColor( SortedArrayView< localIndex const > const & elements,
+                            array1d< localIndex > & coloredElements,
+                            array1d< localIndex > & colorOffsets ) const;
+
+  /**
+   * @brief @return The number of element colors, 0 if the elements have not been colored.
+   */
+  integer numElementColors() const
+  { return m_numElementColors; }
+
+  /**
+   * @brief @return The color of each element.
+   */
+  arrayView1d< integer const > elementColor() const
+  { return m_elementColor; }
+
   ///@}
 
   /**
@@ -125,6 +157,8 @@ public:
     static constexpr auto dNdXString = "dNdX";
     /// String key for the derivative of the jacobian.
     static constexpr auto detJString = "detJ";
+    /// String key for the element colors
+    static constexpr auto elementColorString = "elementColor";
     /// String key for the constitutive grouping
     static constexpr auto constitutiveGroupingString = "ConstitutiveGrouping";
     /// String key for the constitutive map
@@ -179,6 +213,12 @@ private:
   /// The array of jacobian determinantes.
   array2d< real64 > m_detJ;
 
+  /// The color of each element, such that elements sharing a node have different colors
+  array1d< integer > m_elementColor;
+
+  /// The number of element colors
+  integer m_numElementColors;
+
   /// Map of unmapped global indices in the element-to-node map
   map< localIndex, array1d< globalIndex > > m_unmappedGlobalIndicesInNodelist;
 
@@ -342,11 +342,11 @@ void populateMaps( ArrayOfArraysView< EdgeBuilder const > const & edgesByLowestN
   GEOSX_ERROR_IF_NE( numUniqueEdges, edgeToNodeMap.size( 0 ) );
 
   // The face to edge map has the same shape as the face to node map, so we can resize appropriately.
-  localIndex totalSize = 0;
-  for( localIndex faceID = 0; faceID < numFaces; ++faceID )
+  RAJA::ReduceSum< parallelHostReduce, localIndex > totalSize( 0 );
+  forAll< parallelHostPolicy >( numFaces, [&]( localIndex const faceID )
   {
     totalSize += faceToNodeMap.sizeOfArray( faceID );
-  }
+  } );
 
   // Resize the face to edge map
   faceToEdgeMap.resize( 0 );
@@ -357,7 +357,7 @@ void populateMaps( ArrayOfArraysView< EdgeBuilder const > const & edgesByLowestN
   faceToEdgeMap.reserve( entriesToReserve );
 
   // Reserve space for the total number of face edges + extra space for existing faces + even more space for new faces.
-  localIndex const valuesToReserve = totalSize + numFaces * FaceManager::edgeMapExtraSpacePerFace() * ( 1 + 2 * overAllocationFactor );
+  localIndex const valuesToReserve = totalSize.get() + numFaces * FaceManager::edgeMapExtraSpacePerFace() * ( 1 + 2 * overAllocationFactor );
   faceToEdgeMap.reserveValues( valuesToReserve );
   for( localIndex faceID = 0; faceID < numFaces; ++faceID )
   {
@@ -566,12 +566,12 @@ void EdgeManager::SetDomainBoundaryObjects( ObjectManagerBase const * const refe
 
   // get the "isDomainBoundary" field from for *this, and set it to zero
   arrayView1d< integer > const & isEdgeOnDomainBoundary = this->getDomainBoundaryIndicator();
-  isEdgeOnDomainBoundary.setValues< serialPolicy >( 0 );
+  isEdgeOnDomainBoundary.setValues< parallelHostPolicy >( 0 );
 
   ArrayOfArraysView< localIndex const > const & faceToEdgeMap = faceManager->edgeList().toViewConst();
 
   // loop through all faces
-  for( localIndex kf=0; kf<faceManager->size(); ++kf )
+  forAll< parallelHostPolicy >( faceManager->size(), [&]( localIndex const kf )
   {
     // check to see if the face is on a domain boundary
     if( isFaceOnDomainBoundary[kf] == 1 )
@@ -584,7 +584,7 @@ void EdgeManager::SetDomainBoundaryObjects( ObjectManagerBase const * const refe
         isEdgeOnDomainBoundary( faceToEdgeMap( kf, a ) ) = 1;
       }
     }
-  }
+  } );
 }
 
 bool EdgeManager::hasNode( const localIndex edgeID, const localIndex nodeID ) const
@@ -618,10 +618,11 @@ void EdgeManager::SetIsExternal( FaceManager const * const faceManager )
   ArrayOfArraysView< localIndex const > const & faceToEdges = faceManager->edgeList().toViewConst();
 
   // get the "isExternal" field from for *this, and set it to zero
-  m_isExternal.setValues< serialPolicy >( 0 );
+  arrayView1d< integer > const & isExternalEdge = m_isExternal;
+  isExternalEdge.setValues< parallelHostPolicy >( 0 );
 
   // loop through all faces
-  for( localIndex kf=0; kf<faceManager->size(); ++kf )
+  forAll< parallelHostPolicy >( faceManager->size(), [&]( localIndex const kf )
   {
     // check to see if the face is on a domain boundary
     if( isExternalFace[kf] == 1 )
@@ -630,10 +631,10 @@ void EdgeManager::SetIsExternal( FaceManager const * const faceManager )
       localIndex const numEdges = faceToEdges.sizeOfArray( kf );
       for( localIndex a = 0; a < numEdges; ++a )
       {
-        m_isExternal[ faceToEdges( kf, a ) ] = 1;
+        isExternalEdge[ faceToEdges( kf, a ) ] = 1;
       }
     }
-  }
+  } );
 }
 
 
@@ -882,6 +883,11 @@ void EdgeManager::compressRelationMaps()
   m_toFacesRelation.compress();
 }
 
+void EdgeManager::shrinkRelationMaps()
+{
+  shrinkToFit( m_toFacesRelation.Base() );
+}
+
 void EdgeManager::depopulateUpMaps( std::set< localIndex > const & receivedEdges,
                                     ArrayOfArraysView< localIndex const > const & facesToEdges )
 {
@@ -190,6 +190,12 @@ public:
    */
   void compressRelationMaps();
 
+  /**
+   * @brief Release all the capacity of the edge-to-face map, kept for the topology changes.
+   * @note Only worth it if the topology of the mesh doesn't change anymore.
+   */
+  void shrinkRelationMaps();
+
   /**
    * @brief Clean up the edges-to-faces mapping with respect to a new list of edges.
    * @param[in] receivedEdges the new list of edges indices
@@ -26,12 +26,13 @@ using namespace dataRepository;
 
 ElementRegionBase::ElementRegionBase( string const & name, Group * const parent ):
   ObjectManagerBase( name, parent ),
-  m_numericalMethod()
+  m_numericalMethod(),
+  m_elementSubRegionsKey( viewKeyStruct::elementSubRegions )
 {
 
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
-  this->RegisterGroup( viewKeyStruct::elementSubRegions );
+  this->RegisterGroup( m_elementSubRegionsKey );
 
   registerWrapper( viewKeyStruct::materialListString, &m_materialList )->
     setInputFlag( InputFlags::REQUIRED )->
@@ -97,7 +97,7 @@ public:
    */
   subGroupMap & GetSubRegions()
   {
-    return GetGroup( viewKeyStruct::elementSubRegions )->GetSubGroups();
+    return GetGroup( m_elementSubRegionsKey )->GetSubGroups();
   }
 
 /**
@@ -106,7 +106,7 @@ public:
  */
   subGroupMap const & GetSubRegions() const
   {
-    return GetGroup( viewKeyStruct::elementSubRegions )->GetSubGroups();
+    return GetGroup( m_elementSubRegionsKey )->GetSubGroups();
   }
 
 
@@ -120,7 +120,7 @@ public:
   template< typename SUBREGIONTYPE=ElementSubRegionBase >
   SUBREGIONTYPE const * GetSubRegion( string const & regionName ) const
   {
-    return this->GetGroup( viewKeyStruct::elementSubRegions )->GetGroup< SUBREGIONTYPE >( regionName );
+    return this->GetGroup( m_elementSubRegionsKey )->GetGroup< SUBREGIONTYPE >( regionName );
   }
 
 /**
@@ -129,7 +129,7 @@ public:
   template< typename SUBREGIONTYPE=ElementSubRegionBase >
   SUBREGIONTYPE * GetSubRegion( string const & regionName )
   {
-    return this->GetGroup( viewKeyStruct::elementSubRegions )->GetGroup< SUBREGIONTYPE >( regionName );
+    return this->GetGroup( m_elementSubRegionsKey )->GetGroup< SUBREGIONTYPE >( regionName );
   }
 
 /**
@@ -141,7 +141,7 @@ public:
   template< typename SUBREGIONTYPE=ElementSubRegionBase >
   SUBREGIONTYPE const * GetSubRegion( localIndex const & index ) const
   {
-    return this->GetGroup( viewKeyStruct::elementSubRegions )->GetGroup< SUBREGIONTYPE >( index );
+    return this->GetGroup( m_elementSubRegionsKey )->GetGroup< SUBREGIONTYPE >( index );
   }
 
 /**
@@ -150,7 +150,7 @@ public:
   template< typename SUBREGIONTYPE=ElementSubRegionBase >
   SUBREGIONTYPE * GetSubRegion( localIndex const & index )
   {
-    return this->GetGroup( viewKeyStruct::elementSubRegions )->GetGroup< SUBREGIONTYPE >( index );
+    return this->GetGroup( m_elementSubRegionsKey )->GetGroup< SUBREGIONTYPE >( index );
   }
 
 /**
@@ -159,7 +159,7 @@ public:
  */
   localIndex numSubRegions() const
   {
-    return this->GetGroup( viewKeyStruct::elementSubRegions )->GetSubGroups().size();
+    return this->GetGroup( m_elementSubRegionsKey )->GetSubGroups().size();
   }
 
 /**
@@ -237,7 +237,7 @@ public:
   template< typename SUBREGIONTYPE, typename ... SUBREGIONTYPES, typename LAMBDA >
   void forElementSubRegions( LAMBDA && lambda ) const
   {
-    Group const * const elementSubRegions = this->GetGroup( viewKeyStruct::elementSubRegions );
+    Group const * const elementSubRegions = this->GetGroup( m_elementSubRegionsKey );
     elementSubRegions->forSubGroups< SUBREGIONTYPE, SUBREGIONTYPES... >( std::forward< LAMBDA >( lambda ) );
   }
 
@@ -247,7 +247,7 @@ public:
   template< typename SUBREGIONTYPE, typename ... SUBREGIONTYPES, typename LAMBDA >
   void forElementSubRegions( LAMBDA && lambda )
   {
-    Group * const elementSubRegions = this->GetGroup( viewKeyStruct::elementSubRegions );
+    Group * const elementSubRegions = this->GetGroup( m_elementSubRegionsKey );
     elementSubRegions->forSubGroups< SUBREGIONTYPE, SUBREGIONTYPES... >( std::forward< LAMBDA >( lambda ) );
   }
 
@@ -335,6 +335,9 @@ private:
   /// Name of the numerical method
   string m_numericalMethod;
 
+  /// Cached key of the group of the subregions, looked up at each loop over the subregions
+  dataRepository::GroupKey m_elementSubRegionsKey;
+
 };
 
 
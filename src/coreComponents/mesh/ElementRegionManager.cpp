@@ -30,10 +30,17 @@ namespace geosx
 using namespace dataRepository;
 
 ElementRegionManager::ElementRegionManager( string const & name, Group * const parent ):
-  ObjectManagerBase( name, parent )
+  ObjectManagerBase( name, parent ),
+  m_elementRegionsKey( groupKeyStruct::elementRegionsGroup )
 {
   setInputFlags( InputFlags::OPTIONAL );
-  this->RegisterGroup< Group >( ElementRegionManager::groupKeyStruct::elementRegionsGroup );
+  this->RegisterGroup< Group >( m_elementRegionsKey );
+
+  registerWrapper( viewKeyStruct::perforationCacheFileString, &m_perforationCacheFile )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Prefix of the files, one per rank, caching the reservoir elements containing the perforations of the wells. "
+                    "The cached elements are reused while the mesh, its partitioning and the perforations do not change. "
+                    "No cache if empty" );
 }
 
 ElementRegionManager::~ElementRegionManager()
@@ -215,6 +222,12 @@ void ElementRegionManager::GenerateWells( MeshManager * const meshManager,
   globalIndex wellElemCount = 0;
   globalIndex wellNodeCount = 0;
 
+  // index the reservoir elements once for all the wells
+  ReservoirElementLocator const resElemLocator( *meshLevel );
+
+  // the perforations found in the cache of a previous run are not searched again
+  PerforationCache perforationCache( m_perforationCacheFile, *meshLevel );
+
   // construct the wells one by one
   forElementRegions< WellElementRegion >( [&]( WellElementRegion & wellRegion )
   {
@@ -230,7 +243,8 @@ void ElementRegionManager::GenerateWells( MeshManager * const meshManager,
     // generate the local data (well elements, nodes, perforations) on this well
     // note: each MPI rank knows the global info on the entire well (constructed earlier in InternalWellGenerator)
     // so we only need node and element offsets to construct the local-to-global maps in each wellElemSubRegion
-    wellRegion.GenerateWell( *meshLevel, *wellGeometry, nodeOffsetGlobal + wellNodeCount, elemOffsetGlobal + wellElemCount );
+    wellRegion.GenerateWell( *meshLevel, *wellGeometry, resElemLocator, perforationCache,
+                             nodeOffsetGlobal + wellNodeCount, elemOffsetGlobal + wellElemCount );
 
     // increment counters with global number of nodes and elements
     wellElemCount += wellGeometry->GetNumElements();
@@ -251,6 +265,13 @@ void ElementRegionManager::GenerateWells( MeshManager * const meshManager,
 
   } );
 
+  if( !m_perforationCacheFile.empty() )
+  {
+    perforationCache.write();
+    localIndex const numReusedWells = MpiWrapper::Min( perforationCache.numReusedWells() );
+    GEOSX_LOG_RANK_0( "Reused the cached perforations of " << numReusedWells << " well(s) from " << m_perforationCacheFile );
+  }
+
   // communicate to rebuild global node info since we modified global ordering
   nodeManager->SetMaxGlobalIndex();
 }
@@ -209,7 +209,7 @@ public:
    */
   subGroupMap const & GetRegions() const
   {
-    return this->GetGroup( groupKeyStruct::elementRegionsGroup )->GetSubGroups();
+    return this->GetGroup( m_elementRegionsKey )->GetSubGroups();
   }
 
   /**
@@ -218,7 +218,7 @@ public:
    */
   subGroupMap & GetRegions()
   {
-    return this->GetGroup( groupKeyStruct::elementRegionsGroup )->GetSubGroups();
+    return this->GetGroup( m_elementRegionsKey )->GetSubGroups();
   }
 
   /**
@@ -229,7 +229,7 @@ public:
   template< typename T=ElementRegionBase >
   T const * GetRegion( string const & regionName ) const
   {
-    return this->GetGroup( groupKeyStruct::elementRegionsGroup )->GetGroup< T >( regionName );
+    return this->GetGroup( m_elementRegionsKey )->GetGroup< T >( regionName );
   }
 
   /**
@@ -240,7 +240,7 @@ public:
   template< typename T=ElementRegionBase >
   T * GetRegion( string const & regionName )
   {
-    return this->GetGroup( groupKeyStruct::elementRegionsGroup )->GetGroup< T >( regionName );
+    return this->GetGroup( m_elementRegionsKey )->GetGroup< T >( regionName );
   }
 
   /**
@@ -251,7 +251,7 @@ public:
   template< typename T=ElementRegionBase >
   T const * GetRegion( localIndex const index ) const
   {
-    return this->GetGroup( groupKeyStruct::elementRegionsGroup )->GetGroup< T >( index );
+    return this->GetGroup( m_elementRegionsKey )->GetGroup< T >( index );
   }
 
   /**
@@ -262,7 +262,7 @@ public:
   template< typename T=ElementRegionBase >
   T * GetRegion( localIndex const index )
   {
-    return this->GetGroup( groupKeyStruct::elementRegionsGroup )->GetGroup< T >( index );
+    return this->GetGroup( m_elementRegionsKey )->GetGroup< T >( index );
   }
 
   /**
@@ -271,7 +271,7 @@ public:
    */
   localIndex numRegions() const
   {
-    return this->GetGroup( groupKeyStruct::elementRegionsGroup )->GetSubGroups().size();
+    return this->GetGroup( m_elementRegionsKey )->GetSubGroups().size();
   }
 
   /**
@@ -289,7 +289,7 @@ public:
   template< typename REGIONTYPE = ElementRegionBase, typename ... REGIONTYPES, typename LAMBDA >
   void forElementRegions( LAMBDA && lambda )
   {
-    Group * const elementRegions = this->GetGroup( groupKeyStruct::elementRegionsGroup );
+    Group * const elementRegions = this->GetGroup( m_elementRegionsKey );
     elementRegions->forSubGroups< REGIONTYPE, REGIONTYPES... >( std::forward< LAMBDA >( lambda ) );
   }
 
@@ -302,7 +302,7 @@ public:
   template< typename REGIONTYPE = ElementRegionBase, typename ... REGIONTYPES, typename LAMBDA >
   void forElementRegions( LAMBDA && lambda ) const
   {
-    Group const * const elementRegions = this->GetGroup( groupKeyStruct::elementRegionsGroup );
+    Group const * const elementRegions = this->GetGroup( m_elementRegionsKey );
     elementRegions->forSubGroups< REGIONTYPE, REGIONTYPES... >( std::forward< LAMBDA >( lambda ) );
   }
 
@@ -317,7 +317,7 @@ public:
   template< typename REGIONTYPE = ElementRegionBase, typename ... REGIONTYPES, typename LOOKUP_CONTAINER, typename LAMBDA >
   void forElementRegions( LOOKUP_CONTAINER const & targetRegions, LAMBDA && lambda )
   {
-    Group * const elementRegions = this->GetGroup( groupKeyStruct::elementRegionsGroup );
+    Group * const elementRegions = this->GetGroup( m_elementRegionsKey );
     elementRegions->forSubGroups< REGIONTYPE, REGIONTYPES... >( targetRegions, std::forward< LAMBDA >( lambda ) );
   }
 
@@ -332,7 +332,7 @@ public:
   template< typename REGIONTYPE = ElementRegionBase, typename ... REGIONTYPES, typename LOOKUP_CONTAINER, typename LAMBDA >
   void forElementRegions( LOOKUP_CONTAINER const & targetRegions, LAMBDA && lambda ) const
   {
-    Group const * const elementRegions = this->GetGroup( groupKeyStruct::elementRegionsGroup );
+    Group const * const elementRegions = this->GetGroup( m_elementRegionsKey );
     elementRegions->forSubGroups< REGIONTYPE, REGIONTYPES... >( targetRegions, std::forward< LAMBDA >( lambda ) );
   }
 
@@ -1028,6 +1028,15 @@ public:
                         ElementReferenceAccessor< localIndex_array > & packList,
                         bool const overwriteMap );
 
+  /**
+   * @brief View keys of the element region manager
+   */
+  struct viewKeyStruct : public ObjectManagerBase::viewKeyStruct
+  {
+    /// prefix of the files caching the reservoir elements of the perforations
+    static constexpr auto perforationCacheFileString = "perforationCacheFile";
+  };
+
   /**
    * @brief Group key associated with elementRegionsGroup
      struct groupKeyStruct : public ObjectManagerBase::groupKeyStruct
@@ -1041,6 +1050,9 @@ public:
 
 private:
 
+  /// Cached key of the group of the element regions, looked up at each loop over the regions
+  dataRepository::GroupKey m_elementRegionsKey;
+
   /**
    * @brief Pack a list of wrappers or get the buffer size needed to pack.
    * @param buffer pointer to the buffer to be packed
@@ -1093,6 +1105,9 @@ private:
    * @return reference to this object
    */
   ElementRegionManager & operator=( const ElementRegionManager & );
+
+  /// Prefix of the files caching the reservoir elements of the perforations, no cache if empty
+  string m_perforationCacheFile;
 };
 
 
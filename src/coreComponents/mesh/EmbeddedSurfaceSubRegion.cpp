@@ -92,6 +92,85 @@ void EmbeddedSurfaceSubRegion::CalculateElementGeometricQuantities( array1d< R1T
   m_elementVolume[k] = m_elementAperture[k] * m_elementArea[k];
 }
 
+/**
+ * @brief Intersect the edges of a cell element with the plane of a fracture.
+ * @tparam LAMBDA the type of the function called on the intersection points
+ * @param cellIndex the index of the cell element
+ * @param nodesCoord the position of the nodes
+ * @param edgeToNodes the edge to nodes map
+ * @param cellToEdges the cell element to edges map
+ * @param fracture the bounded plane of the fracture
+ * @param lambda the function called with each intersection point, in the order of the edges of the cell
+ * @return true if all the intersection points are inside the bounded plane
+ */
+template< typename LAMBDA >
+static bool forEachEdgeIntersection( localIndex const cellIndex,
+                                     arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodesCoord,
+                                     arrayView2d< localIndex const > const & edgeToNodes,
+                                     FixedOneToManyRelation const & cellToEdges,
+                                     BoundedPlane const & fracture,
+                                     LAMBDA && lambda )
+{
+  bool isInside = true;
+  R1Tensor origin        = fracture.getCenter();
+  R1Tensor normalVector  = fracture.getNormal();
+  localIndex edgeIndex;
+  R1Tensor lineDir, dist, point;
+  real64 prodScalarProd;
+
+  for( localIndex ke = 0; ke < cellToEdges.size( 1 ); ke++ )
+  {
+    edgeIndex = cellToEdges[cellIndex][ke];
+    LvArray::tensorOps::copy< 3 >( dist, nodesCoord[edgeToNodes[edgeIndex][0]] );
+    LvArray::tensorOps::subtract< 3 >( dist, origin );
+    prodScalarProd = LvArray::tensorOps::AiBi< 3 >( dist, normalVector );
+    LvArray::tensorOps::copy< 3 >( dist, nodesCoord[edgeToNodes[edgeIndex][1]] );
+    LvArray::tensorOps::subtract< 3 >( dist, origin );
+    prodScalarProd *= LvArray::tensorOps::AiBi< 3 >( dist, normalVector );
+
+    // check if the plane intersects the edge
+    if( prodScalarProd < 0 )
+    {
+      lineDir = LVARRAY_TENSOROPS_INIT_LOCAL_3( nodesCoord[edgeToNodes[edgeIndex][0]] );
+      LvArray::tensorOps::subtract< 3 >( lineDir, nodesCoord[edgeToNodes[edgeIndex][1]] );
+      LvArray::tensorOps::normalize< 3 >( lineDir );
+      //find the intersection point
+      point = computationalGeometry::LinePlaneIntersection( lineDir,
+                                                            nodesCoord[edgeToNodes[edgeIndex][0]],
+                                                            normalVector,
+                                                            origin );
+
+      // Check if the point is inside the fracture (bounded plane)
+      if( !(fracture.IsCoordInObject( point )) )
+      {
+        isInside = false;
+      }
+      lambda( point );
+    }
+  } //end of edge loop
+
+  return isInside;
+}
+
+bool EmbeddedSurfaceSubRegion::IsCutByFracture( localIndex const cellIndex,
+                                                arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodesCoord,
+                                                arrayView2d< localIndex const > const & edgeToNodes,
+                                                FixedOneToManyRelation const & cellToEdges,
+                                                BoundedPlane const & fracture )
+{
+  localIndex numIntersectionPoints = 0;
+  bool const isInside = forEachEdgeIntersection( cellIndex,
+                                                 nodesCoord,
+                                                 edgeToNodes,
+                                                 cellToEdges,
+                                                 fracture,
+                                                 [&]( R1Tensor const & )
+  {
+    ++numIntersectionPoints;
+  } );
+  return isInside && numIntersectionPoints > 0;
+}
+
 bool EmbeddedSurfaceSubRegion::AddNewEmbeddedSurface ( localIndex const cellIndex,
                                                        localIndex const subRegionIndex,
                                                        localIndex const regionIndex,
@@ -120,46 +199,19 @@ bool EmbeddedSurfaceSubRegion::AddNewEmbeddedSurface ( localIndex const cellInde
    * - Volume:
    */
 
-  bool addEmbeddedElem = true;
-  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodesCoord = nodeManager.referencePosition();
-  arrayView2d< localIndex const > const edgeToNodes = edgeManager.nodeList();
-  R1Tensor origin        = fracture->getCenter();
   R1Tensor normalVector  = fracture->getNormal();
-  localIndex edgeIndex;
-  R1Tensor lineDir, dist, point, distance;
-  real64 prodScalarProd;
+  R1Tensor distance;
 
   array1d< R1Tensor > intersectionPoints;
-  for( localIndex ke = 0; ke < cellToEdges.size( 1 ); ke++ )
+  bool const addEmbeddedElem = forEachEdgeIntersection( cellIndex,
+                                                        nodeManager.referencePosition(),
+                                                        edgeManager.nodeList(),
+                                                        cellToEdges,
+                                                        *fracture,
+                                                        [&]( R1Tensor const & point )
   {
-    edgeIndex = cellToEdges[cellIndex][ke];
-    LvArray::tensorOps::copy< 3 >( dist, nodesCoord[edgeToNodes[edgeIndex][0]] );
-    LvArray::tensorOps::subtract< 3 >( dist, origin );
-    prodScalarProd = LvArray::tensorOps::AiBi< 3 >( dist, normalVector );
-    LvArray::tensorOps::copy< 3 >( dist, nodesCoord[edgeToNodes[edgeIndex][1]] );
-    LvArray::tensorOps::subtract< 3 >( dist, origin );
-    prodScalarProd *= LvArray::tensorOps::AiBi< 3 >( dist, normalVector );
-
-    // check if the plane intersects the edge
-    if( prodScalarProd < 0 )
-    {
-      lineDir = LVARRAY_TENSOROPS_INIT_LOCAL_3( nodesCoord[edgeToNodes[edgeIndex][0]] );
-      LvArray::tensorOps::subtract< 3 >( lineDir, nodesCoord[edgeToNodes[edgeIndex][1]] );
-      LvArray::tensorOps::normalize< 3 >( lineDir );
-      //find the intersection point
-      point = computationalGeometry::LinePlaneIntersection( lineDir,
-                                                            nodesCoord[edgeToNodes[edgeIndex][0]],
-                                                            normalVector,
-                                                            origin );
-
-      // Check if the point is inside the fracture (bounded plane)
-      if( !(fracture->IsCoordInObject( point )) )
-      {
-        addEmbeddedElem = false;
-      }
-      intersectionPoints.emplace_back( point );
-    }
-  } //end of edge loop
+    intersectionPoints.emplace_back( point );
+  } );
 
   if( addEmbeddedElem && intersectionPoints.size() > 0 )
   {
@@ -118,6 +118,23 @@ public:
                               FixedOneToManyRelation const & cellToEdges,
                               BoundedPlane const * fracture );
 
+  /**
+   * @brief Check whether a cell element is cut by a fracture, without adding the embedded surface element.
+   * @param cellIndex cell element index
+   * @param nodesCoord the position of the nodes
+   * @param edgeToNodes the edge to nodes map
+   * @param cellToEdges cellElement to edges map
+   * @param fracture the bounded plane which is defining the embedded surface element
+   * @return true if AddNewEmbeddedSurface would add an embedded surface element for this cell
+   *
+   * The check only reads the mesh, so that the cells can be checked concurrently before adding the elements.
+   */
+  static bool IsCutByFracture( localIndex const cellIndex,
+                               arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodesCoord,
+                               arrayView2d< localIndex const > const & edgeToNodes,
+                               FixedOneToManyRelation const & cellToEdges,
+                               BoundedPlane const & fracture );
+
   /**
    * @brief inherit ghost rank from cell elements.
    * @param cellGhostRank cell element ghost ranks
@@ -596,23 +596,13 @@ void FaceManager::BuildFaces( NodeManager * const nodeManager, ElementRegionMana
 
 void FaceManager::computeGeometry( NodeManager const * const nodeManager )
 {
-  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager->referencePosition();
-
-  // loop over faces and calculate faceArea, faceNormal and faceCenter
-  forAll< parallelHostPolicy >( this->size(), [&]( localIndex const faceID )
-  {
-    m_faceArea[ faceID ] = computationalGeometry::Centroid_3DPolygon( m_nodeList[ faceID ],
-                                                                      X,
-                                                                      m_faceCenter[ faceID ],
-                                                                      m_faceNormal[ faceID ] );
-
-    // This needs to be done somewhere else, also we probably shouldn't be orienting the normals like this.
-    // Set normal orientation according to a global criterion
-    computationalGeometry::FixNormalOrientation_3D( m_faceNormal[ faceID ] );
-
-    // Compute the local rotation matrix according to the normal vector
-    computationalGeometry::RotationMatrix_3D( m_faceNormal[ faceID ], m_faceRotationMatrix[ faceID ] );
-  } );
+  // calculate faceArea, faceCenter, faceNormal and faceRotationMatrix
+  computationalGeometry::ComputeFaceGeometry< parallelHostPolicy >( nodeManager->referencePosition(),
+                                                                    m_nodeList.toViewConst(),
+                                                                    m_faceArea,
+                                                                    m_faceCenter,
+                                                                    m_faceNormal,
+                                                                    m_faceRotationMatrix );
 }
 
 void FaceManager::SetDomainBoundaryObjects( NodeManager * const nodeManager )
@@ -655,14 +645,11 @@ void FaceManager::SetIsExternal()
 {
   arrayView1d< integer const > const isDomainBoundary = this->getDomainBoundaryIndicator().toViewConst();
 
-  m_isExternal.setValues< serialPolicy >( 0 );
-  for( localIndex k=0; k<size(); ++k )
+  arrayView1d< integer > const & isExternal = m_isExternal;
+  forAll< parallelHostPolicy >( size(), [&]( localIndex const k )
   {
-    if( isDomainBoundary[k]==1 )
-    {
-      m_isExternal[k] = 1;
-    }
-  }
+    isExternal[k] = isDomainBoundary[k] == 1 ? 1 : 0;
+  } );
 }
 
 
@@ -957,6 +944,12 @@ void FaceManager::compressRelationMaps()
   m_edgeList.compress();
 }
 
+void FaceManager::shrinkRelationMaps()
+{
+  shrinkToFit( m_nodeList.Base() );
+  shrinkToFit( m_edgeList.Base() );
+}
+
 void FaceManager::enforceStateFieldConsistencyPostTopologyChange( std::set< localIndex > const & targetIndices )
 {
   arrayView1d< localIndex const > const childFaceIndices = getExtrinsicData< extrinsicMeshData::ChildIndex >();
@@ -237,6 +237,12 @@ public:
    */
   void compressRelationMaps();
 
+  /**
+   * @brief Release all the capacity of the face-to-node and face-to-edge maps, kept for the topology changes.
+   * @note Only worth it if the topology of the mesh doesn't change anymore.
+   */
+  void shrinkRelationMaps();
+
   /**
    * @brief Enforce child faces and parent faces to have opposite normals.
    * @param[in] targetIndices set of face indices for which the enforcement has to be done
@@ -48,4 +48,12 @@ void MeshBody::setGlobalLengthScale( real64 scale )
   m_globalLengthScale = scale;
 }
 
+void MeshBody::setStructuredNodeCounts( globalIndex const ( &numNodes )[3] )
+{
+  for( int dir = 0; dir < 3; ++dir )
+  {
+    m_structuredNodeCounts[dir] = numNodes[dir];
+  }
+}
+
 } /* namespace geosx */
@@ -84,6 +84,33 @@ public:
     return m_globalLengthScale;
   }
 
+  /**
+   * @brief Set the number of nodes in each direction of the structured lattice the nodes were generated on
+   * @param [in] numNodes number of lattice nodes along x, y and z
+   *
+   * The node global indices are then lexicographic over the lattice, the z index varying fastest.
+   */
+  void setStructuredNodeCounts( globalIndex const ( &numNodes )[3] );
+
+  /**
+   * @brief Check whether the nodes were generated on a structured lattice
+   * @return @p true if the nodes are numbered over a structured lattice
+   */
+  bool isStructured() const
+  {
+    return m_structuredNodeCounts[0] > 0;
+  }
+
+  /**
+   * @brief Get the number of nodes in one direction of the structured lattice
+   * @param [in] dir the direction (0, 1 or 2)
+   * @return the number of lattice nodes along @p dir, 0 if the mesh is not structured
+   */
+  globalIndex getStructuredNodeCount( int const dir ) const
+  {
+    return m_structuredNodeCounts[dir];
+  }
+
   /**
    * @brief Data repository keys
    */
@@ -104,6 +131,9 @@ private:
   /// The default value can be set to another value
   real64 m_globalLengthScale { 0. };
 
+  /// Number of nodes in each direction of the structured lattice, zero if the mesh is not structured
+  globalIndex m_structuredNodeCounts[3] { 0, 0, 0 };
+
 
 };
 
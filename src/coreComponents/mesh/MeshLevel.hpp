@@ -153,6 +153,17 @@ public:
    */
   EdgeManager & getEmbdSurfEdgeManager()             { return m_embSurfEdgeManager; }
 
+  /**
+   * @brief Get the version of the mesh topology.
+   * @return a counter incremented every time the topology of the mesh is modified
+   */
+  integer getTopologyVersion() const { return m_topologyVersion; }
+
+  /**
+   * @brief Record a modification of the topology of the mesh (e.g. when faces are split).
+   */
+  void incrementTopologyVersion() { ++m_topologyVersion; }
+
   ///@}
 
 private:
@@ -168,6 +179,9 @@ private:
   /// Manager for embedded surfaces edge data
   EdgeManager m_embSurfEdgeManager;
 
+  /// Version of the mesh topology
+  integer m_topologyVersion;
+
 };
 
 } /* namespace geosx */
@@ -263,6 +263,16 @@ void NodeManager::CompressRelationMaps()
 }
 
 
+void NodeManager::shrinkRelationMaps()
+{
+  shrinkToFit( m_toEdgesRelation.Base() );
+  shrinkToFit( m_toFacesRelation.Base() );
+  shrinkToFit( m_toElements.m_toElementRegion );
+  shrinkToFit( m_toElements.m_toElementSubRegion );
+  shrinkToFit( m_toElements.m_toElementIndex );
+}
+
+
 void NodeManager::ViewPackingExclusionList( SortedArray< localIndex > & exclusionList ) const
 {
   ObjectManagerBase::ViewPackingExclusionList( exclusionList );
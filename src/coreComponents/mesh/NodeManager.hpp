@@ -170,6 +170,12 @@ public:
    */
   void CompressRelationMaps();
 
+  /**
+   * @brief Release all the capacity of the relation maps, kept for the topology changes.
+   * @note Only worth it if the topology of the mesh doesn't change anymore.
+   */
+  void shrinkRelationMaps();
+
   /**
    * @name Packing methods
    */
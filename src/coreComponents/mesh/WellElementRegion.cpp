@@ -45,6 +45,8 @@ WellElementRegion::~WellElementRegion()
 
 void WellElementRegion::GenerateWell( MeshLevel & mesh,
                                       InternalWellGenerator const & wellGeometry,
+                                      ReservoirElementLocator const & resElemLocator,
+                                      PerforationCache & perforationCache,
                                       globalIndex nodeOffsetGlobal,
                                       globalIndex elemOffsetGlobal )
 {
@@ -64,7 +66,7 @@ void WellElementRegion::GenerateWell( MeshLevel & mesh,
   globalIndex const numPerforationsGlobal = wellGeometry.GetNumPerforations();
 
   // 1) select the local perforations based on connectivity to the local reservoir elements
-  subRegion->ConnectPerforationsToMeshElements( mesh, wellGeometry );
+  subRegion->ConnectPerforationsToMeshElements( mesh, wellGeometry, resElemLocator, perforationCache );
 
   globalIndex const matchedPerforations = MpiWrapper::Sum( perforationData->size() );
   GEOSX_ERROR_IF( matchedPerforations != numPerforationsGlobal,
@@ -95,6 +97,7 @@ void WellElementRegion::GenerateWell( MeshLevel & mesh,
   // 3) select the local well elements and mark boundary nodes (for ghosting)
   subRegion->Generate( mesh,
                        wellGeometry,
+                       resElemLocator,
                        elemStatusGlobal,
                        nodeOffsetGlobal,
                        elemOffsetGlobal );
@@ -27,6 +27,8 @@ namespace geosx
 {
 
 class MeshLevel;
+class PerforationCache;
+class ReservoirElementLocator;
 
 /**
  * @class WellElementRegion
@@ -127,11 +129,15 @@ public:
    * @brief Build the local well elements and perforations from global well geometry.
    * @param[in] mesh the mesh object (single level only)
    * @param[in] wellGeometry the InternalWellGenerator containing the global well topology
+   * @param[in] resElemLocator the spatial index of the reservoir elements of @p mesh
+   * @param[inout] perforationCache the cache of the reservoir elements containing the perforations
    * @param[in] nodeOffsetGlobal the offset of the first global well node ( = offset of last global mesh node + 1 )
    * @param[in] elemOffsetGlobal the offset of the first global well element ( = offset of last global mesh elem + 1 )
    */
   void GenerateWell( MeshLevel & mesh,
                      InternalWellGenerator const & wellGeometry,
+                     ReservoirElementLocator const & resElemLocator,
+                     PerforationCache & perforationCache,
                      globalIndex nodeOffsetGlobal,
                      globalIndex elemOffsetGlobal );
 
@@ -16,13 +16,70 @@
 
 #include "mesh/MeshLevel.hpp"
 #include "mesh/NodeManager.hpp"
-#include "mesh/MeshForLoopInterface.hpp"
 #include "mpiCommunications/MpiWrapper.hpp"
 #include "LvArray/src/output.hpp"
 
 namespace geosx
 {
 
+ReservoirElementLocator::ReservoirElementLocator( MeshLevel const & mesh )
+{
+  ElementRegionManager const * const elemManager = mesh.getElemManager();
+
+  localIndex numElems = 0;
+  elemManager->forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    numElems += subRegion.size();
+  } );
+
+  // index the elements in the order of the loop over the mesh, so that the ties
+  // between the closest elements are broken as in minLocOverElemsInMesh
+  m_elements.resize( numElems, 3 );
+  array2d< real64 > elemCenters( numElems, 3 );
+  localIndex k = 0;
+  for( localIndex er = 0; er < elemManager->numRegions(); ++er )
+  {
+    elemManager->GetRegion( er )->forElementSubRegionsIndex< CellElementSubRegion >( [&]( localIndex const esr,
+                                                                                        CellElementSubRegion const & subRegion )
+    {
+      arrayView2d< real64 const > const centers = subRegion.getElementCenter();
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei, ++k )
+      {
+        m_elements[k][0] = er;
+        m_elements[k][1] = esr;
+        m_elements[k][2] = ei;
+        for( int d = 0; d < 3; ++d )
+        {
+          elemCenters[k][d] = centers[ei][d];
+        }
+      }
+    } );
+  }
+
+  m_elementCenters.build( numElems, [&]( localIndex const i, real64 ( & min )[3], real64 ( & max )[3] )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      min[d] = elemCenters[i][d];
+      max[d] = elemCenters[i][d];
+    }
+  } );
+}
+
+void ReservoirElementLocator::FindClosestElement( R1Tensor const & location,
+                                                  localIndex & er,
+                                                  localIndex & esr,
+                                                  localIndex & ei ) const
+{
+  real64 const point[3] = { location[0], location[1], location[2] };
+  localIndex const closest = m_elementCenters.findNearest( point );
+
+  er  = closest >= 0 ? m_elements[closest][0] : -1;
+  esr = closest >= 0 ? m_elements[closest][1] : -1;
+  ei  = closest >= 0 ? m_elements[closest][2] : -1;
+}
+
+
 WellElementSubRegion::WellElementSubRegion( string const & name, Group * const parent ):
   ElementSubRegionBase( name, parent ),
   m_wellControlsName( "" ),
@@ -255,44 +312,6 @@ bool VisitNeighborElements( MeshLevel const & mesh,
   return matched;
 }
 
-/**
- * @brief Search for the reservoir element that is the *closest* from the center of well element.
-          Note that this reservoir element does not necessarily contain the center of the well element.
-          This "init" reservoir element will be used in SearchLocalElements to find the reservoir element that
-          contains the well element.
- * @param[in] meshLevel the mesh object (single level only)
- * @param[in] location the location of that we are trying to match with a reservoir element
- * @param[inout] erInit the region index of the reservoir element from which we start the search
- * @param[inout] esrInit the subregion index of the reservoir element from which we start the search
- * @param[inout] eiInit the element index of the reservoir element from which we start the search
- */
-void InitializeLocalSearch( MeshLevel const & mesh,
-                            R1Tensor const & location,
-                            localIndex & erInit,
-                            localIndex & esrInit,
-                            localIndex & eiInit )
-{
-  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > >
-  resElemCenter = mesh.getElemManager()->ConstructViewAccessor< array2d< real64 >,
-                                                                arrayView2d< real64 const > >( ElementSubRegionBase::viewKeyStruct::elementCenterString );
-  // to initialize the local search for the reservoir element that contains "location",
-  // we find the reservoir element that minimizes the distance from "location" to the reservoir element center
-  auto ret = minLocOverElemsInMesh( &mesh, [&] ( localIndex const er,
-                                                 localIndex const esr,
-                                                 localIndex const ei ) -> real64
-  {
-    R1Tensor v = location;
-    v -= resElemCenter[er][esr][ei];
-    return v.L2_Norm();
-  } );
-
-  // save the region, subregion and index of the reservoir element
-  // note that this reservoir element does not necessarily contains "location"
-  erInit  = std::get< 0 >( ret.second );
-  esrInit = std::get< 1 >( ret.second );
-  eiInit  = std::get< 2 >( ret.second );
-}
-
 /**
  * @brief Search for the reservoir element that contains the well element.
           To do that, loop over the reservoir elements that are in the neighborhood of (erInit,esrInit,eiInit)
@@ -359,6 +378,7 @@ bool SearchLocalElements( MeshLevel const & mesh,
 
 void WellElementSubRegion::Generate( MeshLevel & mesh,
                                      InternalWellGenerator const & wellGeometry,
+                                     ReservoirElementLocator const & resElemLocator,
                                      arrayView1d< integer > & elemStatusGlobal,
                                      globalIndex nodeOffsetGlobal,
                                      globalIndex elemOffsetGlobal )
@@ -398,6 +418,7 @@ void WellElementSubRegion::Generate( MeshLevel & mesh,
   //      then the well element is assigned to rank k
   AssignUnownedElementsInReservoir( mesh,
                                     wellGeometry,
+                                    resElemLocator,
                                     unownedElems,
                                     localElems,
                                     elemStatusGlobal );
@@ -456,6 +477,7 @@ void WellElementSubRegion::Generate( MeshLevel & mesh,
 
 void WellElementSubRegion::AssignUnownedElementsInReservoir( MeshLevel & mesh,
                                                              InternalWellGenerator const & wellGeometry,
+                                                             ReservoirElementLocator const & resElemLocator,
                                                              SortedArray< globalIndex >      const & unownedElems,
                                                              SortedArray< globalIndex > & localElems,
                                                              arrayView1d< integer > & elemStatusGlobal ) const
@@ -486,8 +508,8 @@ void WellElementSubRegion::AssignUnownedElementsInReservoir( MeshLevel & mesh,
     //         note that this reservoir element does not necessarily contain the center of the well element
     //         this "init" reservoir element will be used in SearchLocalElements to find the reservoir element that
     //         contains the well element
-    InitializeLocalSearch( mesh, location,
-                           erInit, esrInit, eiInit );
+    resElemLocator.FindClosestElement( location,
+                                       erInit, esrInit, eiInit );
 
     // Step 2: then, search for the reservoir element that contains the well element
     //         to do that, we loop over the reservoir elements that are in the neighborhood of (erInit,esrInit,eiInit)
@@ -771,11 +793,33 @@ void WellElementSubRegion::UpdateNodeManagerNodeToElementMap( MeshLevel & mesh )
 }
 
 void WellElementSubRegion::ConnectPerforationsToMeshElements( MeshLevel & mesh,
-                                                              InternalWellGenerator const & wellGeometry )
+                                                              InternalWellGenerator const & wellGeometry,
+                                                              ReservoirElementLocator const & resElemLocator,
+                                                              PerforationCache & perforationCache )
 {
   arrayView1d< R1Tensor const > const & perfCoordsGlobal = wellGeometry.GetPerfCoords();
   arrayView1d< real64 const >   const & perfWellTransmissibilityGlobal = wellGeometry.GetPerfTransmissibility();
 
+  // reuse the reservoir elements found in a previous run, without any search
+  std::vector< PerforationCache::Match > const * const cachedMatches = perforationCache.getMatches( wellGeometry );
+  if( cachedMatches != nullptr )
+  {
+    localIndex const numPerforationsLocal = LvArray::integerConversion< localIndex >( cachedMatches->size() );
+    m_perforationData.resize( numPerforationsLocal );
+    for( localIndex iperfLocal = 0; iperfLocal < numPerforationsLocal; ++iperfLocal )
+    {
+      PerforationCache::Match const & match = ( *cachedMatches )[iperfLocal];
+      m_perforationData.GetMeshElements().m_toElementRegion[iperfLocal] = match.er;
+      m_perforationData.GetMeshElements().m_toElementSubRegion[iperfLocal] = match.esr;
+      m_perforationData.GetMeshElements().m_toElementIndex[iperfLocal] = match.ei;
+      m_perforationData.GetWellTransmissibility()[iperfLocal] = perfWellTransmissibilityGlobal[match.perforation];
+      m_perforationData.GetLocation()[iperfLocal] = perfCoordsGlobal[match.perforation];
+      m_perforationData.localToGlobalMap()[iperfLocal] = match.perforation;
+    }
+    m_perforationData.ConstructGlobalToLocalMap();
+    return;
+  }
+
   m_perforationData.resize( perfCoordsGlobal.size() );
   localIndex iperfLocal = 0;
 
@@ -808,8 +852,8 @@ void WellElementSubRegion::ConnectPerforationsToMeshElements( MeshLevel & mesh,
       //         note that this reservoir element does not necessarily contain the center of the well element
       //         this "init" reservoir element will be used in SearchLocalElements to find the reservoir element that
       //         contains the well element
-      InitializeLocalSearch( mesh, location,
-                             erInit, esrInit, eiInit );
+      resElemLocator.FindClosestElement( location,
+                                         erInit, esrInit, eiInit );
     }
 
     // Step 2: then, search for the reservoir element that contains the well element
@@ -838,6 +882,16 @@ void WellElementSubRegion::ConnectPerforationsToMeshElements( MeshLevel & mesh,
   // set the size based on the number of perforations matched with local reservoir elements
   m_perforationData.resize( iperfLocal );
   m_perforationData.ConstructGlobalToLocalMap();
+
+  std::vector< PerforationCache::Match > matches( iperfLocal );
+  for( localIndex iperf = 0; iperf < iperfLocal; ++iperf )
+  {
+    matches[iperf] = { m_perforationData.localToGlobalMap()[iperf],
+                       m_perforationData.GetMeshElements().m_toElementRegion[iperf],
+                       m_perforationData.GetMeshElements().m_toElementSubRegion[iperf],
+                       m_perforationData.GetMeshElements().m_toElementIndex[iperf] };
+  }
+  perforationCache.setMatches( wellGeometry, std::move( matches ) );
 }
 
 void WellElementSubRegion::ReconstructLocalConnectivity()
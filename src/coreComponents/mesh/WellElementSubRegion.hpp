@@ -17,11 +17,52 @@
 
 #include "mesh/ElementSubRegionBase.hpp"
 #include "mesh/InterObjectRelation.hpp"
+#include "meshUtilities/BoundingVolumeHierarchy.hpp"
+#include "meshUtilities/PerforationCache.hpp"
 #include "meshUtilities/PerforationData.hpp"
 
 namespace geosx
 {
 
+/**
+ * @class ReservoirElementLocator
+ * @brief Spatial index of the centers of the reservoir elements of a mesh level.
+ *
+ * It is built once for all the wells of the mesh level, and gives the reservoir element from which
+ * the search of the element containing a well element or a perforation starts.
+ */
+class ReservoirElementLocator
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param[in] mesh the mesh object (single level only)
+   */
+  explicit ReservoirElementLocator( MeshLevel const & mesh );
+
+  /**
+   * @brief Search for the reservoir element whose center is the closest to a location.
+   * @param[in] location the location that we are trying to match with a reservoir element
+   * @param[out] er the region index of the closest reservoir element, -1 if there are no reservoir elements
+   * @param[out] esr the subregion index of the closest reservoir element, -1 if there are no reservoir elements
+   * @param[out] ei the element index of the closest reservoir element, -1 if there are no reservoir elements
+   */
+  void FindClosestElement( R1Tensor const & location,
+                           localIndex & er,
+                           localIndex & esr,
+                           localIndex & ei ) const;
+
+private:
+
+  /// The (region, subregion, element) indices of the indexed reservoir elements
+  array2d< localIndex > m_elements;
+
+  /// The hierarchy of the centers of the reservoir elements
+  BoundingVolumeHierarchy m_elementCenters;
+
+};
+
 /**
  * @class WellElementSubRegion
  * @brief This class describes a collection of local well elements and perforations.
@@ -234,6 +275,7 @@ public:
    * @brief Build the local well elements from global well element data.
    * @param[in] mesh the mesh object (single level only)
    * @param[in] wellGeometry the InternalWellGenerator containing the global well topology
+   * @param[in] resElemLocator the spatial index of the reservoir elements of @p mesh
    * @param[in] elemStatus list of well element status, as determined by perforations connected
    *                       to local or remote mesh partitions. Status values are defined in
    *                       enum SegmentStatus. They are used to partition well elements.
@@ -242,6 +284,7 @@ public:
    */
   void Generate( MeshLevel & mesh,
                  InternalWellGenerator const & wellGeometry,
+                 ReservoirElementLocator const & resElemLocator,
                  arrayView1d< integer > & elemStatus,
                  globalIndex nodeOffsetGlobal,
                  globalIndex elemOffsetGlobal );
@@ -250,9 +293,13 @@ public:
    * @brief For each perforation, find the reservoir element that contains the perforation.
    * @param[in] mesh the mesh object (single level only)
    * @param[in] wellGeometry the InternalWellGenerator containing the global well topology
+   * @param[in] resElemLocator the spatial index of the reservoir elements of @p mesh
+   * @param[inout] perforationCache the cache of the reservoir elements containing the perforations
    */
   void ConnectPerforationsToMeshElements( MeshLevel & mesh,
-                                          InternalWellGenerator const & wellGeometry );
+                                          InternalWellGenerator const & wellGeometry,
+                                          ReservoirElementLocator const & resElemLocator,
+                                          PerforationCache & perforationCache );
 
   /**
    * @brief Reconstruct the (local) map nextWellElemId using nextWellElemIdGlobal after the ghost exchange.
@@ -358,6 +405,7 @@ private:
             in the reservoir (and that can therefore be matched with a reservoir element) to an MPI rank.
    * @param[in] meshLevel the mesh object (single level only)
    * @param[in] wellGeometry the InternalWellGenerator containing the global well topology
+   * @param[in] resElemLocator the spatial index of the reservoir elements of @p mesh
    * @param[in] unownedElems set of unowned well elems.
    * @param[out] localElems set of local well elems. It contains the perforated well elements
                             connected to local mesh elements before the call, and is filled
@@ -367,6 +415,7 @@ private:
    */
   void AssignUnownedElementsInReservoir( MeshLevel & mesh,
                                          InternalWellGenerator const & wellGeometry,
+                                         ReservoirElementLocator const & resElemLocator,
                                          SortedArray< globalIndex >           const & unownedElems,
                                          SortedArray< globalIndex > & localElems,
                                          arrayView1d< integer > & elemStatusGlobal ) const;
@@ -0,0 +1,175 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BoundingVolumeHierarchy.cpp
+ */
+
+#include "BoundingVolumeHierarchy.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace geosx
+{
+
+real64 BoundingVolumeHierarchy::squaredDistance( Box const & box, real64 const (&point)[3] )
+{
+  real64 dist2 = 0.0;
+  for( int d = 0; d < 3; ++d )
+  {
+    real64 const gap = std::max( box.min[d] - point[d], point[d] - box.max[d] );
+    if( gap > 0.0 )
+    {
+      dist2 += gap * gap;
+    }
+  }
+  return dist2;
+}
+
+void BoundingVolumeHierarchy::buildTree()
+{
+  localIndex const numObjects = this->numObjects();
+
+  m_order.resize( numObjects );
+  std::iota( m_order.begin(), m_order.end(), 0 );
+
+  m_nodes.clear();
+  if( numObjects > 0 )
+  {
+    m_nodes.reserve( 2 * ( numObjects / leafSize + 1 ) );
+    buildNode( 0, numObjects );
+  }
+}
+
+localIndex BoundingVolumeHierarchy::buildNode( localIndex const begin, localIndex const end )
+{
+  localIndex const nodeIndex = LvArray::integerConversion< localIndex >( m_nodes.size() );
+  m_nodes.emplace_back();
+
+  // bounds of the boxes and of their centers
+  Box box;
+  real64 centerMin[3];
+  real64 centerMax[3];
+  for( int d = 0; d < 3; ++d )
+  {
+    box.min[d] = std::numeric_limits< real64 >::max();
+    box.max[d] = std::numeric_limits< real64 >::lowest();
+    centerMin[d] = box.min[d];
+    centerMax[d] = box.max[d];
+  }
+
+  for( localIndex k = begin; k < end; ++k )
+  {
+    Box const & objectBox = m_boxes[ m_order[k] ];
+    for( int d = 0; d < 3; ++d )
+    {
+      real64 const center = 0.5 * ( objectBox.min[d] + objectBox.max[d] );
+      box.min[d] = std::min( box.min[d], objectBox.min[d] );
+      box.max[d] = std::max( box.max[d], objectBox.max[d] );
+      centerMin[d] = std::min( centerMin[d], center );
+      centerMax[d] = std::max( centerMax[d], center );
+    }
+  }
+
+  localIndex left = -1;
+  localIndex right = -1;
+  if( end - begin > leafSize )
+  {
+    // split at the median of the centers along their longest extent
+    int axis = 0;
+    for( int d = 1; d < 3; ++d )
+    {
+      if( centerMax[d] - centerMin[d] > centerMax[axis] - centerMin[axis] )
+      {
+        axis = d;
+      }
+    }
+
+    localIndex const mid = begin + ( end - begin ) / 2;
+    std::nth_element( m_order.begin() + begin, m_order.begin() + mid, m_order.begin() + end,
+                      [&]( localIndex const i, localIndex const j )
+    {
+      return m_boxes[i].min[axis] + m_boxes[i].max[axis] < m_boxes[j].min[axis] + m_boxes[j].max[axis];
+    } );
+
+    left = buildNode( begin, mid );
+    right = buildNode( mid, end );
+  }
+
+  // the recursive calls may have reallocated the nodes
+  m_nodes[nodeIndex] = { box, begin, end, left, right };
+  return nodeIndex;
+}
+
+localIndex BoundingVolumeHierarchy::findNearest( real64 const (&point)[3] ) const
+{
+  localIndex nearest = -1;
+  if( m_nodes.empty() )
+  {
+    return nearest;
+  }
+
+  real64 nearestDist2 = std::numeric_limits< real64 >::max();
+
+  localIndex stack[ 64 ];
+  localIndex stackSize = 0;
+  stack[ stackSize++ ] = 0;
+
+  while( stackSize > 0 )
+  {
+    Node const & node = m_nodes[ stack[ --stackSize ] ];
+
+    // the ties are kept to return the smallest of the tied objects
+    if( squaredDistance( node.box, point ) > nearestDist2 )
+    {
+      continue;
+    }
+
+    if( node.right < 0 )
+    {
+      for( localIndex k = node.begin; k < node.end; ++k )
+      {
+        localIndex const i = m_order[k];
+        real64 const dist2 = squaredDistance( m_boxes[i], point );
+        if( dist2 < nearestDist2 || ( dist2 <= nearestDist2 && i < nearest ) )
+        {
+          nearestDist2 = dist2;
+          nearest = i;
+        }
+      }
+    }
+    else
+    {
+      // visit the closest child first to tighten the bound early
+      real64 const leftDist2 = squaredDistance( m_nodes[node.left].box, point );
+      real64 const rightDist2 = squaredDistance( m_nodes[node.right].box, point );
+      if( leftDist2 <= rightDist2 )
+      {
+        stack[ stackSize++ ] = node.right;
+        stack[ stackSize++ ] = node.left;
+      }
+      else
+      {
+        stack[ stackSize++ ] = node.left;
+        stack[ stackSize++ ] = node.right;
+      }
+    }
+  }
+
+  return nearest;
+}
+
+} /* namespace geosx */
@@ -0,0 +1,231 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BoundingVolumeHierarchy.hpp
+ */
+
+#ifndef GEOSX_MESHUTILITIES_BOUNDINGVOLUMEHIERARCHY_HPP_
+#define GEOSX_MESHUTILITIES_BOUNDINGVOLUMEHIERARCHY_HPP_
+
+#include "common/DataTypes.hpp"
+
+#include <vector>
+
+namespace geosx
+{
+
+/**
+ * @class BoundingVolumeHierarchy
+ * @brief Host spatial index over a set of axis-aligned boxes.
+ *
+ * The objects are given by their bounding boxes (a point is a box with min == max), and are
+ * identified by their index in [0, numObjects). The tree is built once by median splits along the
+ * longest axis, and then answers the box overlap and nearest object queries in logarithmic time
+ * instead of a loop over all the objects.
+ */
+class BoundingVolumeHierarchy
+{
+public:
+
+  /**
+   * @brief Construct an empty hierarchy.
+   */
+  BoundingVolumeHierarchy() = default;
+
+  /**
+   * @brief Construct the hierarchy.
+   * @tparam BOX_FUNC the type of the function giving the bounding box of an object
+   * @param[in] numObjects the number of objects
+   * @param[in] getBox the function giving the bounding box of an object, see build()
+   */
+  template< typename BOX_FUNC >
+  BoundingVolumeHierarchy( localIndex const numObjects, BOX_FUNC && getBox )
+  {
+    build( numObjects, std::forward< BOX_FUNC >( getBox ) );
+  }
+
+  /**
+   * @brief Build the hierarchy, replacing the previous objects.
+   * @tparam BOX_FUNC the type of the function giving the bounding box of an object
+   * @param[in] numObjects the number of objects
+   * @param[in] getBox the function called as getBox( i, min, max ), with min and max two real64[3],
+   *                   filling the bounding box of object i
+   */
+  template< typename BOX_FUNC >
+  void build( localIndex const numObjects, BOX_FUNC && getBox )
+  {
+    m_boxes.resize( numObjects );
+    for( localIndex i = 0; i < numObjects; ++i )
+    {
+      getBox( i, m_boxes[i].min, m_boxes[i].max );
+    }
+    buildTree();
+  }
+
+  /**
+   * @brief Get the number of objects in the hierarchy.
+   * @return the number of objects
+   */
+  localIndex numObjects() const
+  { return LvArray::integerConversion< localIndex >( m_boxes.size() ); }
+
+  /**
+   * @brief Call a function on all the objects whose bounding box overlaps a box.
+   * @tparam LAMBDA the type of the function
+   * @param[in] min the minimum coordinates of the box
+   * @param[in] max the maximum coordinates of the box
+   * @param[in] lambda the function called with the index of each overlapping object, in no particular order
+   *
+   * The boxes are closed, so that the objects touching the box are visited as well.
+   */
+  template< typename LAMBDA >
+  void forEachIntersecting( real64 const (&min)[3],
+                            real64 const (&max)[3],
+                            LAMBDA && lambda ) const
+  {
+    if( m_nodes.empty() )
+    {
+      return;
+    }
+
+    // the median splits bound the depth of the tree by log2( numObjects )
+    localIndex stack[ 64 ];
+    localIndex stackSize = 0;
+    stack[ stackSize++ ] = 0;
+
+    while( stackSize > 0 )
+    {
+      Node const & node = m_nodes[ stack[ --stackSize ] ];
+      if( !overlaps( node.box, min, max ) )
+      {
+        continue;
+      }
+
+      if( node.right < 0 )
+      {
+        for( localIndex k = node.begin; k < node.end; ++k )
+        {
+          localIndex const i = m_order[k];
+          if( overlaps( m_boxes[i], min, max ) )
+          {
+            lambda( i );
+          }
+        }
+      }
+      else
+      {
+        stack[ stackSize++ ] = node.right;
+        stack[ stackSize++ ] = node.left;
+      }
+    }
+  }
+
+  /**
+   * @brief Call a function on all the objects whose bounding box contains a point.
+   * @tparam LAMBDA the type of the function
+   * @param[in] point the coordinates of the point
+   * @param[in] lambda the function called with the index of each object containing @p point
+   */
+  template< typename LAMBDA >
+  void forEachContaining( real64 const (&point)[3], LAMBDA && lambda ) const
+  {
+    forEachIntersecting( point, point, std::forward< LAMBDA >( lambda ) );
+  }
+
+  /**
+   * @brief Find the object whose bounding box is the closest to a point.
+   * @param[in] point the coordinates of the point
+   * @return the index of the closest object, the smallest of the tied ones, or -1 if the hierarchy is empty
+   */
+  localIndex findNearest( real64 const (&point)[3] ) const;
+
+private:
+
+  /// An axis-aligned box
+  struct Box
+  {
+    /// Minimum coordinates
+    real64 min[3];
+    /// Maximum coordinates
+    real64 max[3];
+  };
+
+  /// A node of the tree, covering the objects m_order[begin:end)
+  struct Node
+  {
+    /// Bounding box of the objects of the node
+    Box box;
+    /// First object of the node in m_order
+    localIndex begin;
+    /// One past the last object of the node in m_order
+    localIndex end;
+    /// Index of the left child, -1 for a leaf
+    localIndex left;
+    /// Index of the right child, -1 for a leaf
+    localIndex right;
+  };
+
+  /// Maximum number of objects in a leaf
+  static constexpr localIndex leafSize = 8;
+
+  /**
+   * @brief Check if a box overlaps another one.
+   * @param[in] box the first box
+   * @param[in] min the minimum coordinates of the second box
+   * @param[in] max the maximum coordinates of the second box
+   * @return true if the boxes overlap
+   */
+  static bool overlaps( Box const & box, real64 const (&min)[3], real64 const (&max)[3] )
+  {
+    return box.min[0] <= max[0] && min[0] <= box.max[0] &&
+           box.min[1] <= max[1] && min[1] <= box.max[1] &&
+           box.min[2] <= max[2] && min[2] <= box.max[2];
+  }
+
+  /**
+   * @brief Compute the squared distance from a point to a box.
+   * @param[in] box the box
+   * @param[in] point the coordinates of the point
+   * @return the squared distance, zero if the point is in the box
+   */
+  static real64 squaredDistance( Box const & box, real64 const (&point)[3] );
+
+  /**
+   * @brief Build the tree from the boxes of the objects.
+   */
+  void buildTree();
+
+  /**
+   * @brief Build the subtree covering the objects m_order[begin:end).
+   * @param[in] begin the first object of the subtree
+   * @param[in] end one past the last object of the subtree
+   * @return the index of the root node of the subtree
+   */
+  localIndex buildNode( localIndex const begin, localIndex const end );
+
+  /// Bounding boxes of the objects
+  std::vector< Box > m_boxes;
+
+  /// Objects ordered such that each node covers a contiguous range
+  std::vector< localIndex > m_order;
+
+  /// Nodes of the tree, the root is the first one
+  std::vector< Node > m_nodes;
+
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MESHUTILITIES_BOUNDINGVOLUMEHIERARCHY_HPP_ */
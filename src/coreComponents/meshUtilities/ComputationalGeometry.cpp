@@ -26,8 +26,6 @@ namespace geosx
 namespace computationalGeometry
 {
 
-constexpr real64 machinePrecision = std::numeric_limits< real64 >::epsilon();
-
 //*************************************************************************************************
 R1Tensor LinePlaneIntersection( R1Tensor lineDir,
                                 R1Tensor linePoint,
@@ -137,77 +135,6 @@ void orderPointsCCW( array1d< R1Tensor > & points,
   }
 }
 
-//*************************************************************************************************
-void FixNormalOrientation_3D( arraySlice1d< real64 > const normal )
-{
-  real64 const orientationTolerance = 1.e+1*machinePrecision;
-
-  // Orient local normal in global sense.
-  // First check: align with z direction
-  if( normal[ 2 ] <= -orientationTolerance )
-  {
-    LvArray::tensorOps::scale< 3 >( normal, -1.0 );
-  }
-  else if( std::fabs( normal[ 2 ] ) < orientationTolerance )
-  {
-    // If needed, second check: align with y direction
-    if( normal[ 1 ] <= -orientationTolerance )
-    {
-      LvArray::tensorOps::scale< 3 >( normal, -1.0 );
-    }
-    else if( std::fabs( normal[ 1 ] ) < orientationTolerance )
-    {
-      // If needed, third check: align with x direction
-      if( normal[ 0 ] <= -orientationTolerance )
-      {
-        LvArray::tensorOps::scale< 3 >( normal, -1.0 );
-      }
-    }
-  }
-}
-
-//*************************************************************************************************
-void RotationMatrix_3D( arraySlice1d< real64 const > const normal,
-                        arraySlice2d< real64 > const rotationMatrix )
-{
-  real64 m1[ 3 ] = { normal[ 2 ], 0.0, -normal[ 0 ] };
-  real64 m2[ 3 ] = { 0.0, normal[ 2 ], -normal[ 1 ] };
-  real64 const norm_m1 = LvArray::tensorOps::l2Norm< 3 >( m1 );
-  real64 const norm_m2 = LvArray::tensorOps::l2Norm< 3 >( m2 );
-
-  // If present, looks for a vector with 0 norm
-  // Fix the uncertain case of norm_m1 very close to norm_m2
-  if( norm_m1+1.e+2*machinePrecision > norm_m2 )
-  {
-    LvArray::tensorOps::crossProduct( m2, normal, m1 );
-    LvArray::tensorOps::normalize< 3 >( m2 );
-    LvArray::tensorOps::normalize< 3 >( m1 );
-  }
-  else
-  {
-    LvArray::tensorOps::crossProduct( m1, normal, m2 );
-    LvArray::tensorOps::scale< 3 >( m1, -1 );
-    LvArray::tensorOps::normalize< 3 >( m1 );
-    LvArray::tensorOps::normalize< 3 >( m2 );
-  }
-
-  // Save everything in the standard form (3x3 rotation matrix)
-  rotationMatrix( 0, 0 ) = normal[ 0 ];
-  rotationMatrix( 1, 0 ) = normal[ 1 ];
-  rotationMatrix( 2, 0 ) = normal[ 2 ];
-  rotationMatrix( 0, 1 ) = m1[ 0 ];
-  rotationMatrix( 1, 1 ) = m1[ 1 ];
-  rotationMatrix( 2, 1 ) = m1[ 2 ];
-  rotationMatrix( 0, 2 ) = m2[ 0 ];
-  rotationMatrix( 1, 2 ) = m2[ 1 ];
-  rotationMatrix( 2, 2 ) = m2[ 2 ];
-
-  GEOSX_ERROR_IF( std::fabs( LvArray::tensorOps::determinant< 3 >( rotationMatrix ) - 1.0 ) > 1.e+1*machinePrecision,
-                  "Rotation matrix with determinant different from +1.0" );
-
-  return;
-}
-
 //*************************************************************************************************
 template< typename T >
 int sgn( T val )
@@ -243,55 +170,6 @@ bool IsPointInsidePolyhedron( arrayView2d< real64 const, nodes::REFERENCE_POSITI
   return true;
 }
 
-//*************************************************************************************************
-real64 TetVolume( R1Tensor const * const X )
-{
-  R1Tensor X1_X0( X[1] );
-  X1_X0 -= X[0];
-  R1Tensor X2_X0( X[2] );
-  X2_X0 -= X[0];
-  R1Tensor X3_X0( X[3] );
-  X3_X0 -= X[0];
-  return std::fabs( Dot( X1_X0, Cross( X2_X0, X3_X0 )) / 6.0 );
-}
-
-//*************************************************************************************************
-real64 WedgeVolume( R1Tensor const * const X )
-{
-  R1Tensor tet1[4];
-  tet1[0] = X[0];
-  tet1[1] = X[1];
-  tet1[2] = X[2];
-  tet1[3] = X[4];
-  R1Tensor tet2[4];
-  tet2[0] = X[0];
-  tet2[1] = X[2];
-  tet2[2] = X[4];
-  tet2[3] = X[5];
-  R1Tensor tet3[4];
-  tet3[0] = X[0];
-  tet3[1] = X[3];
-  tet3[2] = X[4];
-  tet3[3] = X[5];
-  return TetVolume( tet1 ) + TetVolume( tet2 ) + TetVolume( tet3 );
-}
-
-//*************************************************************************************************
-real64 PyramidVolume( R1Tensor const * const X )
-{
-  R1Tensor tet1[4];
-  tet1[0] = X[0];
-  tet1[1] = X[1];
-  tet1[2] = X[2];
-  tet1[3] = X[4];
-  R1Tensor tet2[4];
-  tet2[0] = X[0];
-  tet2[1] = X[2];
-  tet2[2] = X[3];
-  tet2[3] = X[4];
-  return TetVolume( tet1 ) + TetVolume( tet2 );
-}
-
 //*************************************************************************************************
 void GetBoundingBox( localIndex elemIndex,
                      arrayView2d< localIndex const, cells::NODE_MAP_USD > const & pointIndices,
@@ -23,12 +23,18 @@
 #include "common/DataLayouts.hpp"
 #include "LvArray/src/output.hpp"
 #include "LvArray/src/tensorOps.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+#include <limits>
 
 namespace geosx
 {
 namespace computationalGeometry
 {
 
+/// Machine epsilon for double-precision calculations
+constexpr real64 machinePrecision = std::numeric_limits< real64 >::epsilon();
+
 
 /**
  * @brief Calculate the intersection between a line and a plane.
@@ -121,11 +127,11 @@ real64 Centroid_3DPolygon( arraySlice1d< localIndex const > const pointsIndices,
   {
     for( localIndex a=0; a<pointsIndices.size(); ++a )
     {
-#if !defined(__CUDA_ARCH__)
+#if !defined(GEOSX_DEVICE_COMPILE)
       GEOSX_LOG_RANK( "Points: " << points[ pointsIndices[ a ] ] << " " << pointsIndices[ a ] );
 #endif
     }
-#if !defined(__CUDA_ARCH__)
+#if !defined(GEOSX_DEVICE_COMPILE)
     GEOSX_ERROR( "Negative area found : " << area );
 #endif
   }
@@ -139,17 +145,121 @@ real64 Centroid_3DPolygon( arraySlice1d< localIndex const > const pointsIndices,
 
 /**
  * @brief Change the orientation of the input vector to be consistent in a global sense.
+ * @tparam NORMAL_TYPE The type of @p normal.
  * @param[inout] normal normal to the face
  */
-void FixNormalOrientation_3D( arraySlice1d< real64 > const normal );
+template< typename NORMAL_TYPE >
+GEOSX_HOST_DEVICE
+inline
+void FixNormalOrientation_3D( NORMAL_TYPE && normal )
+{
+  real64 const orientationTolerance = 1.e+1 * machinePrecision;
+
+  // Orient local normal in global sense.
+  // First check: align with z direction
+  if( normal[ 2 ] <= -orientationTolerance )
+  {
+    LvArray::tensorOps::scale< 3 >( normal, -1.0 );
+  }
+  else if( fabs( normal[ 2 ] ) < orientationTolerance )
+  {
+    // If needed, second check: align with y direction
+    if( normal[ 1 ] <= -orientationTolerance )
+    {
+      LvArray::tensorOps::scale< 3 >( normal, -1.0 );
+    }
+    else if( fabs( normal[ 1 ] ) < orientationTolerance )
+    {
+      // If needed, third check: align with x direction
+      if( normal[ 0 ] <= -orientationTolerance )
+      {
+        LvArray::tensorOps::scale< 3 >( normal, -1.0 );
+      }
+    }
+  }
+}
 
 /**
  * @brief Calculate the rotation matrix for a face in the 3D space
+ * @tparam NORMAL_TYPE The type of @p normal.
+ * @tparam MATRIX_TYPE The type of @p rotationMatrix.
  * @param[in] normal normal to the face
  * @param[out] rotationMatrix rotation matrix for the face
  */
-void RotationMatrix_3D( arraySlice1d< real64 const > const normal,
-                        arraySlice2d< real64 > const rotationMatrix );
+template< typename NORMAL_TYPE, typename MATRIX_TYPE >
+GEOSX_HOST_DEVICE
+inline
+void RotationMatrix_3D( NORMAL_TYPE const & normal,
+                        MATRIX_TYPE && rotationMatrix )
+{
+  real64 m1[ 3 ] = { normal[ 2 ], 0.0, -normal[ 0 ] };
+  real64 m2[ 3 ] = { 0.0, normal[ 2 ], -normal[ 1 ] };
+  real64 const norm_m1 = LvArray::tensorOps::l2Norm< 3 >( m1 );
+  real64 const norm_m2 = LvArray::tensorOps::l2Norm< 3 >( m2 );
+
+  // If present, looks for a vector with 0 norm
+  // Fix the uncertain case of norm_m1 very close to norm_m2
+  if( norm_m1+1.e+2*machinePrecision > norm_m2 )
+  {
+    LvArray::tensorOps::crossProduct( m2, normal, m1 );
+    LvArray::tensorOps::normalize< 3 >( m2 );
+    LvArray::tensorOps::normalize< 3 >( m1 );
+  }
+  else
+  {
+    LvArray::tensorOps::crossProduct( m1, normal, m2 );
+    LvArray::tensorOps::scale< 3 >( m1, -1 );
+    LvArray::tensorOps::normalize< 3 >( m1 );
+    LvArray::tensorOps::normalize< 3 >( m2 );
+  }
+
+  // Save everything in the standard form (3x3 rotation matrix)
+  rotationMatrix[ 0 ][ 0 ] = normal[ 0 ];
+  rotationMatrix[ 1 ][ 0 ] = normal[ 1 ];
+  rotationMatrix[ 2 ][ 0 ] = normal[ 2 ];
+  rotationMatrix[ 0 ][ 1 ] = m1[ 0 ];
+  rotationMatrix[ 1 ][ 1 ] = m1[ 1 ];
+  rotationMatrix[ 2 ][ 1 ] = m1[ 2 ];
+  rotationMatrix[ 0 ][ 2 ] = m2[ 0 ];
+  rotationMatrix[ 1 ][ 2 ] = m2[ 1 ];
+  rotationMatrix[ 2 ][ 2 ] = m2[ 2 ];
+
+#if !defined(GEOSX_DEVICE_COMPILE)
+  GEOSX_ERROR_IF( fabs( LvArray::tensorOps::determinant< 3 >( rotationMatrix ) - 1.0 ) > 1.e+1*machinePrecision,
+                  "Rotation matrix with determinant different from +1.0" );
+#endif
+}
+
+/**
+ * @brief Compute the area, the center, the normal and the rotation matrix of faces.
+ * @tparam POLICY the policy of the loop over the faces
+ * @param[in] X the coordinates of the nodes
+ * @param[in] faceToNodes the nodes of the faces, ordered around each face
+ * @param[out] faceArea the areas of the faces
+ * @param[out] faceCenter the centers of the faces
+ * @param[out] faceNormal the unit normals of the faces, oriented in a global sense
+ * @param[out] faceRotationMatrix the rotation matrices of the faces, whose first column is the normal
+ */
+template< typename POLICY >
+void ComputeFaceGeometry( arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X,
+                          ArrayOfArraysView< localIndex const > const & faceToNodes,
+                          arrayView1d< real64 > const & faceArea,
+                          arrayView2d< real64 > const & faceCenter,
+                          arrayView2d< real64 > const & faceNormal,
+                          arrayView3d< real64 > const & faceRotationMatrix )
+{
+  forAll< POLICY >( faceToNodes.size(), [=] GEOSX_HOST_DEVICE ( localIndex const kf )
+  {
+    faceArea[ kf ] = Centroid_3DPolygon( faceToNodes[ kf ], X, faceCenter[ kf ], faceNormal[ kf ] );
+
+    // This needs to be done somewhere else, also we probably shouldn't be orienting the normals like this.
+    // Set normal orientation according to a global criterion
+    FixNormalOrientation_3D( faceNormal[ kf ] );
+
+    // Compute the local rotation matrix according to the normal vector
+    RotationMatrix_3D( faceNormal[ kf ], faceRotationMatrix[ kf ] );
+  } );
+}
 
 /**
  * @brief Check if a point is inside a convex polyhedron (3D polygon)
@@ -187,62 +297,143 @@ void GetBoundingBox( localIndex elemIndex,
  * @param[in] X vertices of the hexahedron
  * @return the volume of the hexahedron
  */
-inline
 GEOSX_HOST_DEVICE
-real64 HexVolume( R1Tensor const * const X )
+inline
+real64 HexVolume( real64 const X[][ 3 ] )
 {
-  R1Tensor X7_X1( X[7] );
-  X7_X1 -= X[1];
-
-  R1Tensor X6_X0( X[6] );
-  X6_X0 -= X[0];
-
-  R1Tensor X7_X2( X[7] );
-  X7_X2 -= X[2];
-
-  R1Tensor X3_X0( X[3] );
-  X3_X0 -= X[0];
-
-  R1Tensor X5_X0( X[5] );
-  X5_X0 -= X[0];
-
-  R1Tensor X7_X4( X[7] );
-  X7_X4 -= X[4];
-
-  R1Tensor X7_X1plusX6_X0( X7_X1 );
-  X7_X1plusX6_X0 += X6_X0;
-
-  R1Tensor X7_X2plusX5_X0( X7_X2 );
-  X7_X2plusX5_X0 += X5_X0;
-
-  R1Tensor X7_X4plusX3_X0( X7_X4 );
-  X7_X4plusX3_X0 += X3_X0;
+  real64 X7_X1[ 3 ], X6_X0[ 3 ], X7_X2[ 3 ], X3_X0[ 3 ], X5_X0[ 3 ], X7_X4[ 3 ];
+  LvArray::tensorOps::copy< 3 >( X7_X1, X[7] );
+  LvArray::tensorOps::subtract< 3 >( X7_X1, X[1] );
+  LvArray::tensorOps::copy< 3 >( X6_X0, X[6] );
+  LvArray::tensorOps::subtract< 3 >( X6_X0, X[0] );
+  LvArray::tensorOps::copy< 3 >( X7_X2, X[7] );
+  LvArray::tensorOps::subtract< 3 >( X7_X2, X[2] );
+  LvArray::tensorOps::copy< 3 >( X3_X0, X[3] );
+  LvArray::tensorOps::subtract< 3 >( X3_X0, X[0] );
+  LvArray::tensorOps::copy< 3 >( X5_X0, X[5] );
+  LvArray::tensorOps::subtract< 3 >( X5_X0, X[0] );
+  LvArray::tensorOps::copy< 3 >( X7_X4, X[7] );
+  LvArray::tensorOps::subtract< 3 >( X7_X4, X[4] );
+
+  real64 X7_X1plusX6_X0[ 3 ], X7_X2plusX5_X0[ 3 ], X7_X4plusX3_X0[ 3 ];
+  LvArray::tensorOps::copy< 3 >( X7_X1plusX6_X0, X7_X1 );
+  LvArray::tensorOps::add< 3 >( X7_X1plusX6_X0, X6_X0 );
+  LvArray::tensorOps::copy< 3 >( X7_X2plusX5_X0, X7_X2 );
+  LvArray::tensorOps::add< 3 >( X7_X2plusX5_X0, X5_X0 );
+  LvArray::tensorOps::copy< 3 >( X7_X4plusX3_X0, X7_X4 );
+  LvArray::tensorOps::add< 3 >( X7_X4plusX3_X0, X3_X0 );
+
+  real64 cross1[ 3 ], cross2[ 3 ], cross3[ 3 ];
+  LvArray::tensorOps::crossProduct( cross1, X7_X2, X3_X0 );
+  LvArray::tensorOps::crossProduct( cross2, X7_X2plusX5_X0, X7_X4 );
+  LvArray::tensorOps::crossProduct( cross3, X5_X0, X7_X4plusX3_X0 );
+
+  return 1.0/12.0 * ( LvArray::tensorOps::AiBi< 3 >( X7_X1plusX6_X0, cross1 ) +
+                      LvArray::tensorOps::AiBi< 3 >( X6_X0, cross2 ) +
+                      LvArray::tensorOps::AiBi< 3 >( X7_X1, cross3 ) );
+}
 
-  return 1.0/12.0 * ( Dot( X7_X1plusX6_X0, Cross( X7_X2, X3_X0 ) ) +
-                      Dot( X6_X0, Cross( X7_X2plusX5_X0, X7_X4 ) ) +
-                      Dot( X7_X1, Cross( X5_X0, X7_X4plusX3_X0 ) ) );
+/**
+ * @brief Compute the volume of the tetrahedron X[a], X[b], X[c], X[d].
+ * @param[in] X vertices
+ * @param[in] a index of the first vertex of the tetrahedron
+ * @param[in] b index of the second vertex of the tetrahedron
+ * @param[in] c index of the third vertex of the tetrahedron
+ * @param[in] d index of the fourth vertex of the tetrahedron
+ * @return the volume of the tetrahedron
+ */
+GEOSX_HOST_DEVICE
+inline
+real64 TetVolume( real64 const X[][ 3 ], int const a, int const b, int const c, int const d )
+{
+  real64 Xb_Xa[ 3 ], Xc_Xa[ 3 ], Xd_Xa[ 3 ];
+  LvArray::tensorOps::copy< 3 >( Xb_Xa, X[b] );
+  LvArray::tensorOps::subtract< 3 >( Xb_Xa, X[a] );
+  LvArray::tensorOps::copy< 3 >( Xc_Xa, X[c] );
+  LvArray::tensorOps::subtract< 3 >( Xc_Xa, X[a] );
+  LvArray::tensorOps::copy< 3 >( Xd_Xa, X[d] );
+  LvArray::tensorOps::subtract< 3 >( Xd_Xa, X[a] );
+
+  real64 cross[ 3 ];
+  LvArray::tensorOps::crossProduct( cross, Xc_Xa, Xd_Xa );
+  return fabs( LvArray::tensorOps::AiBi< 3 >( Xb_Xa, cross ) / 6.0 );
 }
 
 /**
  * @brief Compute the volume of an tetrahedron
- * @param[in] points vertices of the tetrahedron
+ * @param[in] X vertices of the tetrahedron
  * @return the volume of the tetrahedron
  */
-real64 TetVolume( R1Tensor const * const points );
+GEOSX_HOST_DEVICE
+inline
+real64 TetVolume( real64 const X[][ 3 ] )
+{
+  return TetVolume( X, 0, 1, 2, 3 );
+}
 
 /**
  * @brief Compute the volume of a wedge
- * @param[in] points vertices of the wedge
+ * @param[in] X vertices of the wedge
  * @return the volume of the wedge
  */
-real64 WedgeVolume( R1Tensor const * const points );
+GEOSX_HOST_DEVICE
+inline
+real64 WedgeVolume( real64 const X[][ 3 ] )
+{
+  return TetVolume( X, 0, 1, 2, 4 ) + TetVolume( X, 0, 2, 4, 5 ) + TetVolume( X, 0, 3, 4, 5 );
+}
 
 /**
  * @brief Compute the volume of a pyramid
- * @param[in] points vertices of the pyramid
+ * @param[in] X vertices of the pyramid
  * @return the volume of the pyramid
  */
-real64 PyramidVolume( R1Tensor const * const points );
+GEOSX_HOST_DEVICE
+inline
+real64 PyramidVolume( real64 const X[][ 3 ] )
+{
+  return TetVolume( X, 0, 1, 2, 4 ) + TetVolume( X, 0, 2, 3, 4 );
+}
+
+/**
+ * @brief Compute the center and the volume of a cell from the coordinates of its nodes.
+ * @param[in] elemToNodes the nodes of the cell
+ * @param[in] numNodes the number of nodes of the cell: 8 (hexahedron), 4 (tetrahedron), 6 (wedge) or 5 (pyramid)
+ * @param[in] X the coordinates of the nodes
+ * @param[out] center the average of the coordinates of the nodes of the cell
+ * @return the volume of the cell
+ */
+template< typename NODE_MAP_TYPE, typename CENTER_TYPE >
+GEOSX_HOST_DEVICE
+inline
+real64 CellCenterAndVolume( NODE_MAP_TYPE const & elemToNodes,
+                            localIndex const numNodes,
+                            arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X,
+                            CENTER_TYPE && center )
+{
+#if !defined(GEOSX_DEVICE_COMPILE)
+  GEOSX_ERROR_IF( numNodes != 8 && numNodes != 4 && numNodes != 6 && numNodes != 5,
+                  "GEOX does not support cells with " << numNodes << " nodes" );
+#endif
+
+  real64 Xlocal[ 8 ][ 3 ];
+  LvArray::tensorOps::fill< 3 >( center, 0 );
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    LvArray::tensorOps::copy< 3 >( Xlocal[ a ], X[ elemToNodes[ a ] ] );
+    LvArray::tensorOps::add< 3 >( center, Xlocal[ a ] );
+  }
+  LvArray::tensorOps::scale< 3 >( center, 1.0 / numNodes );
+
+  switch( numNodes )
+  {
+    case 8: return HexVolume( Xlocal );
+    case 4: return TetVolume( Xlocal );
+    case 6: return WedgeVolume( Xlocal );
+    case 5: return PyramidVolume( Xlocal );
+  }
+  return 0.0;
+}
 
 } // namespace computationalGeometry
 } // namespace geosx
@@ -23,12 +23,15 @@
 #include "codingUtilities/StringUtilities.hpp"
 #include <math.h>
 #include <algorithm>
+#include <array>
+#include <vector>
 
 #include "mpiCommunications/PartitionBase.hpp"
 #include "mpiCommunications/SpatialPartition.hpp"
 #include "common/DataTypes.hpp"
 
 #include "mesh/MeshBody.hpp"
+#include "meshUtilities/InternalWellGenerator.hpp"
 
 #include "common/TimingMacros.hpp"
 
@@ -44,7 +47,8 @@ InternalMeshGenerator::InternalMeshGenerator( string const & name, Group * const
 // }),
   m_dim( 0 ),
   m_min(),
-  m_max()
+  m_max(),
+  m_wellAwarePartitioning( 0 )
 {
 
   /*
@@ -123,6 +127,12 @@ InternalMeshGenerator::InternalMeshGenerator( string const & name, Group * const
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "pattern by which to decompose the hex mesh into prisms (more explanation required)" );
 
+  registerWrapper( keys::wellAwarePartitioning, &m_wellAwarePartitioning )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to place the partition boundaries such that the wells of this mesh, with their perforated "
+                    "cells, are not split between ranks, and that the well work is balanced" );
+
 }
 
 InternalMeshGenerator::~InternalMeshGenerator()
@@ -131,6 +141,132 @@ InternalMeshGenerator::~InternalMeshGenerator()
 }
 
 
+int InternalMeshGenerator::GetElemIndexAtCoord( int const dir, real64 const coord ) const
+{
+  localIndex const numBlocks = m_nElems[dir].size();
+  localIndex block = 0;
+  while( block < numBlocks - 1 && coord > m_vertices[dir][block+1] )
+  {
+    ++block;
+  }
+
+  real64 const blockMin = m_vertices[dir][block];
+  real64 const blockLength = m_vertices[dir][block+1] - blockMin;
+  int const index = m_firstElemIndexForBlock[dir][block] +
+                    static_cast< int >( std::floor( ( coord - blockMin ) / blockLength * m_nElems[dir][block] ) );
+
+  return std::min( std::max( index, m_firstElemIndexForBlock[dir][block] ), m_lastElemIndexForBlock[dir][block] );
+}
+
+void InternalMeshGenerator::SetWellAwarePartitionLocations( SpatialPartition & partition ) const
+{
+  // a partition boundary only moves away from its balanced location to keep a well intact
+  // if the weight of the partitions deviates by less than this fraction of the average weight
+  real64 constexpr maxImbalance = 0.25;
+
+  int numElemsTotal[3];
+  for( int dir = 0; dir < 3; ++dir )
+  {
+    numElemsTotal[dir] = m_lastElemIndexForBlock[dir][m_nElems[dir].size() - 1] + 1;
+  }
+
+  // element layers crossed by the polyline of each well of this mesh, and work of the well
+  std::vector< std::array< int, 6 > > wellLayers;
+  std::vector< real64 > wellWeight;
+  getParent()->forSubGroups< InternalWellGenerator >( [&]( InternalWellGenerator const & well )
+  {
+    if( well.GetMeshBodyName() != getName() )
+    {
+      return;
+    }
+
+    std::array< int, 6 > layers = { { numElemsTotal[0], numElemsTotal[1], numElemsTotal[2], -1, -1, -1 } };
+    arrayView1d< R1Tensor const > const polyNodeCoords = well.GetPolylineNodeCoords();
+    for( localIndex inode = 0; inode < polyNodeCoords.size(); ++inode )
+    {
+      for( int dir = 0; dir < 3; ++dir )
+      {
+        int const index = GetElemIndexAtCoord( dir, polyNodeCoords[inode][dir] );
+        layers[dir] = std::min( layers[dir], index );
+        layers[dir+3] = std::max( layers[dir+3], index );
+      }
+    }
+
+    // each perforation couples a well element to a reservoir cell, and costs about as much as a cell
+    wellLayers.emplace_back( layers );
+    wellWeight.emplace_back( well.GetNumPerforations() );
+  } );
+
+  if( wellLayers.empty() )
+  {
+    return;
+  }
+
+  for( int dir = 0; dir < 3; ++dir )
+  {
+    int const numPartitions = partition.m_Partitions( dir );
+    int const numLayers = numElemsTotal[dir];
+    if( numPartitions == 1 || numLayers < numPartitions )
+    {
+      continue;
+    }
+
+    // weight of each layer of elements normal to the direction, and boundaries crossing a well
+    real64 const numElemsPerLayer = real64( numElemsTotal[0] ) * numElemsTotal[1] * numElemsTotal[2] / numLayers;
+    std::vector< real64 > layerWeight( numLayers, numElemsPerLayer );
+    std::vector< real64 > cumulatedWeight( numLayers + 1, 0.0 );
+    std::vector< int > crossesWell( numLayers + 1, 0 );
+    for( std::size_t iwell = 0; iwell < wellLayers.size(); ++iwell )
+    {
+      int const firstLayer = wellLayers[iwell][dir];
+      int const lastLayer = wellLayers[iwell][dir+3];
+      for( int k = firstLayer; k <= lastLayer; ++k )
+      {
+        layerWeight[k] += wellWeight[iwell] / ( lastLayer - firstLayer + 1 );
+      }
+      for( int k = firstLayer + 1; k <= lastLayer; ++k )
+      {
+        crossesWell[k] = 1;
+      }
+    }
+    for( int k = 0; k < numLayers; ++k )
+    {
+      cumulatedWeight[k+1] = cumulatedWeight[k] + layerWeight[k];
+    }
+
+    real64 const averageWeight = cumulatedWeight[numLayers] / numPartitions;
+    partition.m_PartitionLocations[dir].resize( numPartitions - 1 );
+
+    int prevBoundary = 0;
+    for( int ipart = 1; ipart < numPartitions; ++ipart )
+    {
+      // each partition keeps at least one layer
+      real64 const target = ipart * averageWeight;
+      int bestBoundary = -1;
+      int bestIntactBoundary = -1;
+      for( int k = prevBoundary + 1; k <= numLayers - numPartitions + ipart; ++k )
+      {
+        real64 const deviation = std::fabs( cumulatedWeight[k] - target );
+        if( bestBoundary < 0 || deviation < std::fabs( cumulatedWeight[bestBoundary] - target ) )
+        {
+          bestBoundary = k;
+        }
+        if( !crossesWell[k] && deviation <= maxImbalance * averageWeight &&
+            ( bestIntactBoundary < 0 || deviation < std::fabs( cumulatedWeight[bestIntactBoundary] - target ) ) )
+        {
+          bestIntactBoundary = k;
+        }
+      }
+
+      prevBoundary = bestIntactBoundary >= 0 ? bestIntactBoundary : bestBoundary;
+
+      // same mapping as the element centers tested by IsCoordInPartition in GenerateMesh
+      real64 const location = m_min[dir] + ( m_max[dir] - m_min[dir] ) * prevBoundary / numLayers;
+      partition.m_PartitionLocations[dir][ipart-1] = location;
+    }
+  }
+}
+
 /**
  * @param domain
  */
@@ -378,12 +514,18 @@ void InternalMeshGenerator::GenerateMesh( DomainPartition * const domain )
     R1Tensor temp1( m_min );
     R1Tensor temp2( m_max );
 
+    if( m_wellAwarePartitioning && m_mapToRadial == 0 )
+    {
+      SetWellAwarePartitionLocations( dynamic_cast< SpatialPartition & >( partition ) );
+    }
+
     partition.setSizes( temp1, temp2 );
     temp2 -= temp1;
     meshBody->setGlobalLengthScale( std::fabs( temp2.L2_Norm() ) );
   }
 
   // find elemCenters for even uniform element sizes
+  // The centers only depend on the input, every rank computes them without any communication.
   array1d< array1d< real64 > > elemCenterCoords( 3 );
   for( int i = 0; i < 3; ++i )
   {
@@ -394,16 +536,10 @@ void InternalMeshGenerator::GenerateMesh( DomainPartition * const domain )
     }
 
     elemCenterCoords[i].resize( m_numElemsTotal[i] );
-    array1d< real64 > elemCenterCoordsLocal( m_numElemsTotal[i] );
     for( int k = 0; k < m_numElemsTotal[i]; ++k )
     {
-      elemCenterCoordsLocal[k] = m_min[i] + ( m_max[i] - m_min[i] ) * ( k + 0.5 ) / m_numElemsTotal[i];
+      elemCenterCoords[i][k] = m_min[i] + ( m_max[i] - m_min[i] ) * ( k + 0.5 ) / m_numElemsTotal[i];
     }
-    MpiWrapper::allReduce( elemCenterCoordsLocal.data(),
-                           elemCenterCoords[i].data(),
-                           m_numElemsTotal[i],
-                           MPI_MAX,
-                           MPI_COMM_GEOSX );
   }
 
   // find starting/ending index
@@ -625,6 +761,13 @@ void InternalMeshGenerator::GenerateMesh( DomainPartition * const domain )
     }
   }
 
+  // the global node indices of the cartesian meshes follow the lattice, which the geometric solvers may coarsen
+  if( m_mapToRadial == 0 && m_dim == 3 )
+  {
+    globalIndex const numNodesTotal[3] = { m_numElemsTotal[0] + 1, m_numElemsTotal[1] + 1, m_numElemsTotal[2] + 1 };
+    meshBody->setStructuredNodeCounts( numNodesTotal );
+  }
+
   {
     integer_array numElements;
     string_array elementRegionNames;
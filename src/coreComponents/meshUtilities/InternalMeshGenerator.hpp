@@ -62,6 +62,8 @@ string const cellBlockNames = "cellBlockNames";
 string const elementTypes = "elementTypes";
 /// key for triangle pattern identifier
 string const trianglePattern = "trianglePattern";
+/// key for the well-aware partitioning flag
+string const wellAwarePartitioning = "wellAwarePartitioning";
 }
 ///@}
 
@@ -69,6 +71,7 @@ string const trianglePattern = "trianglePattern";
 
 class NodeManager;
 class DomainPartition;
+class SpatialPartition;
 /**
  * @class InternalMeshGenerator
  * @brief The InternalMeshGenerator class is a class handling GEOSX generated meshes.
@@ -128,6 +131,25 @@ protected:
 
 private:
 
+  /**
+   * @brief Place the partition boundaries so that the wells of this mesh are not split between ranks.
+   * @param[inout] partition the Cartesian partition, whose partition locations are set in the partitioned directions
+   *
+   * In each partitioned direction, the cells are grouped in slabs, and each well and its perforated cells are treated
+   * as a single entity spanning the slabs crossed by its polyline. The slabs are weighted by their cells plus the well
+   * work, and the partition boundaries are placed at the slab boundaries balancing the weights without crossing a
+   * well, as long as the imbalance stays moderate.
+   */
+  void SetWellAwarePartitionLocations( SpatialPartition & partition ) const;
+
+  /**
+   * @brief Find the index of the element layer containing a coordinate, neglecting the bias of the element sizes.
+   * @param[in] dir the direction
+   * @param[in] coord the coordinate
+   * @return the index of the element layer, clamped to the mesh
+   */
+  int GetElemIndexAtCoord( int const dir, real64 const coord ) const;
+
   /// Mesh number of dimension
   int m_dim;
   /// Array of vertex coordinates
@@ -184,6 +206,9 @@ private:
    */
   int m_trianglePattern;
 
+  /// Flag to place the partition boundaries such that the wells are not split between ranks
+  integer m_wellAwarePartitioning;
+
   /// Node perturbation amplitude value
   realT m_fPerturb=0.0;
   /// Random seed for generation of the node perturbation field
@@ -182,6 +182,18 @@ public:
    */
   real64 GetElementRadius() const { return m_radius; }
 
+  /**
+   * @brief Get the name of the reservoir mesh associated with this well.
+   * @return the name of the mesh body
+   */
+  string const & GetMeshBodyName() const { return m_meshBodyName; }
+
+  /**
+   * @brief Get the physical location of the polyline nodes, available before the well geometry is generated.
+   * @return list of locations of the polyline nodes
+   */
+  arrayView1d< R1Tensor const > GetPolylineNodeCoords() const { return m_polyNodeCoords; }
+
   // getters for node data
 
   /**
@@ -19,20 +19,60 @@
 
 #include "MeshGeneratorBase.hpp"
 
+#include "mesh/CellBlockManager.hpp"
+#include "mesh/NodeManager.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
 
 namespace geosx
 {
 using namespace dataRepository;
 
 MeshGeneratorBase::MeshGeneratorBase( string const & name, Group * const parent ):
-  Group( name, parent )
+  Group( name, parent ),
+  m_nodeRenumbering( NodeRenumbering::none ),
+  m_elementRenumbering( ElementRenumbering::none )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
+
+  registerWrapper( viewKeyStruct::nodeRenumberingString, &m_nodeRenumbering )->
+    setApplyDefaultValue( m_nodeRenumbering )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Renumbering of the nodes improving the locality of the element-to-node gathers and the "
+                    "bandwidth of the matrices. Available options are:\n* " + EnumStrings< NodeRenumbering >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::elementRenumberingString, &m_elementRenumbering )->
+    setApplyDefaultValue( m_elementRenumbering )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Renumbering of the elements of each cell block by the position of their centroid along a "
+                    "space-filling curve. Available options are:\n* " + EnumStrings< ElementRenumbering >::concat( "\n* " ) );
 }
 
 MeshGeneratorBase::~MeshGeneratorBase()
 {}
 
+void MeshGeneratorBase::RenumberMesh( NodeManager & nodeManager,
+                                      CellBlockManager & cellBlockManager ) const
+{
+  if( m_nodeRenumbering == NodeRenumbering::none && m_elementRenumbering == ElementRenumbering::none )
+  {
+    return;
+  }
+
+  localIndex const initialBandwidth = MpiWrapper::Max( MeshRenumbering::nodeGraphBandwidth( cellBlockManager ) );
+
+  if( m_elementRenumbering == ElementRenumbering::morton )
+  {
+    MeshRenumbering::renumberElements( nodeManager, cellBlockManager );
+  }
+  MeshRenumbering::renumberNodes( m_nodeRenumbering, nodeManager, cellBlockManager );
+
+  localIndex const finalBandwidth = MpiWrapper::Max( MeshRenumbering::nodeGraphBandwidth( cellBlockManager ) );
+  GEOSX_LOG_RANK_0( getName() << ": renumbered nodes (" << EnumStrings< NodeRenumbering >::toString( m_nodeRenumbering )
+                              << ") and elements (" << EnumStrings< ElementRenumbering >::toString( m_elementRenumbering )
+                              << "), node graph bandwidth " << initialBandwidth << " -> " << finalBandwidth );
+}
+
 MeshGeneratorBase::CatalogInterface::CatalogType & MeshGeneratorBase::GetCatalog()
 {
   static MeshGeneratorBase::CatalogInterface::CatalogType catalog;
@@ -22,6 +22,7 @@
 #include "dataRepository/Group.hpp"
 #include "codingUtilities/Utilities.hpp"
 #include "common/DataTypes.hpp"
+#include "meshUtilities/MeshRenumbering.hpp"
 
 namespace geosx
 {
@@ -30,6 +31,7 @@ namespace dataRepository
 {}
 
 class NodeManager;
+class CellBlockManager;
 class DomainPartition;
 
 /**
@@ -97,6 +99,16 @@ public:
  */
   virtual void RemapMesh ( dataRepository::Group * const domain ) = 0;
 
+  /**
+   * @brief Renumber the generated nodes and cell blocks to improve the locality of the mesh data.
+   * @param[in,out] nodeManager the generated nodes
+   * @param[in,out] cellBlockManager the generated cell blocks
+   *
+   * This must be called before the element regions, faces and edges are built from the cell blocks.
+   */
+  void RenumberMesh( NodeManager & nodeManager,
+                     CellBlockManager & cellBlockManager ) const;
+
   /// Integer to trigger or not mesh re-mapping at the end of GenerateMesh call
   int m_delayMeshDeformation = 0;
 
@@ -110,6 +122,26 @@ public:
  */
   static CatalogInterface::CatalogType & GetCatalog();
 
+  /**
+   * @brief Struct to serve as a container for variable strings and keys.
+   * @struct viewKeyStruct
+   */
+  struct viewKeyStruct
+  {
+    /// String key for the node renumbering
+    static constexpr auto nodeRenumberingString = "nodeRenumbering";
+    /// String key for the element renumbering
+    static constexpr auto elementRenumberingString = "elementRenumbering";
+  };
+
+private:
+
+  /// Renumbering of the nodes applied after the mesh generation
+  NodeRenumbering m_nodeRenumbering;
+
+  /// Renumbering of the elements of each cell block applied after the mesh generation
+  ElementRenumbering m_elementRenumbering;
+
 };
 }
 
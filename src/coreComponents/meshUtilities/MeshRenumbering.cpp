@@ -0,0 +1,592 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MeshRenumbering.cpp
+ */
+
+#include "MeshRenumbering.hpp"
+
+#include "mesh/CellBlockManager.hpp"
+#include "mesh/NodeManager.hpp"
+#include "LvArray/src/tensorOps.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace MeshRenumbering
+{
+
+namespace
+{
+
+/// Number of bits per direction of the space-filling curve grids
+constexpr int numCurveBits = 21;
+
+/**
+ * @brief Interleave the bits of the three coordinates, the first coordinate being the most significant.
+ * @param coords the coordinates
+ * @return the interleaved bits
+ */
+std::uint64_t interleaveBits( std::uint32_t const ( &coords )[3] )
+{
+  std::uint64_t index = 0;
+  for( int b = numCurveBits - 1; b >= 0; --b )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      index = ( index << 1 ) | ( ( coords[ i ] >> b ) & 1u );
+    }
+  }
+  return index;
+}
+
+/**
+ * @brief Map points on the grid of the space-filling curves.
+ * @tparam POINTS type of the accessor to the point coordinates
+ * @tparam CURVE_INDEX type of the space-filling curve index function
+ * @param numPoints the number of points
+ * @param points accessor returning the coordinates of a point
+ * @param curveIndex the space-filling curve index function
+ * @return the index of each point along the curve
+ */
+template< typename POINTS, typename CURVE_INDEX >
+std::vector< std::uint64_t > computeCurveIndices( localIndex const numPoints,
+                                                  POINTS && points,
+                                                  CURVE_INDEX && curveIndex )
+{
+  real64 xMin[3] = { std::numeric_limits< real64 >::max(), std::numeric_limits< real64 >::max(), std::numeric_limits< real64 >::max() };
+  real64 xMax[3] = { std::numeric_limits< real64 >::lowest(), std::numeric_limits< real64 >::lowest(), std::numeric_limits< real64 >::lowest() };
+  for( localIndex p = 0; p < numPoints; ++p )
+  {
+    real64 x[3];
+    points( p, x );
+    for( int i = 0; i < 3; ++i )
+    {
+      xMin[ i ] = std::min( xMin[ i ], x[ i ] );
+      xMax[ i ] = std::max( xMax[ i ], x[ i ] );
+    }
+  }
+
+  real64 const gridMax = static_cast< real64 >( ( 1u << numCurveBits ) - 1 );
+  real64 scale[3];
+  for( int i = 0; i < 3; ++i )
+  {
+    scale[ i ] = xMax[ i ] > xMin[ i ] ? gridMax / ( xMax[ i ] - xMin[ i ] ) : 0.0;
+  }
+
+  std::vector< std::uint64_t > indices( numPoints );
+  for( localIndex p = 0; p < numPoints; ++p )
+  {
+    real64 x[3];
+    points( p, x );
+    std::uint32_t coords[3];
+    for( int i = 0; i < 3; ++i )
+    {
+      coords[ i ] = static_cast< std::uint32_t >( std::min( gridMax, ( x[ i ] - xMin[ i ] ) * scale[ i ] ) );
+    }
+    indices[ p ] = curveIndex( coords );
+  }
+  return indices;
+}
+
+/**
+ * @brief Compute the permutation sorting objects by increasing key, ties keeping the current order.
+ * @param keys the key of each object
+ * @param newToOld the old index of each object in the new ordering
+ */
+void sortByKeys( std::vector< std::uint64_t > const & keys,
+                 array1d< localIndex > & newToOld )
+{
+  newToOld.resize( LvArray::integerConversion< localIndex >( keys.size() ) );
+  std::iota( newToOld.begin(), newToOld.end(), 0 );
+  std::stable_sort( newToOld.begin(), newToOld.end(), [&]( localIndex const a, localIndex const b )
+  {
+    return keys[ a ] < keys[ b ];
+  } );
+}
+
+/**
+ * @brief Permute the first dimension of an array.
+ * @param array the array
+ * @param newToOld the old index of each row in the new ordering
+ */
+template< typename T, typename PERMUTATION >
+void permuteRows( Array< T, 1, PERMUTATION > & array,
+                  arrayView1d< localIndex const > const & newToOld )
+{
+  Array< T, 1, PERMUTATION > const source( array );
+  for( localIndex i = 0; i < newToOld.size(); ++i )
+  {
+    array[ i ] = source[ newToOld[ i ] ];
+  }
+}
+
+/**
+ * @copydoc permuteRows( Array< T, 1, PERMUTATION > &, arrayView1d< localIndex const > const & )
+ */
+template< typename T, typename PERMUTATION >
+void permuteRows( Array< T, 2, PERMUTATION > & array,
+                  arrayView1d< localIndex const > const & newToOld )
+{
+  Array< T, 2, PERMUTATION > const source( array );
+  for( localIndex i = 0; i < newToOld.size(); ++i )
+  {
+    for( localIndex j = 0; j < array.size( 1 ); ++j )
+    {
+      array( i, j ) = source( newToOld[ i ], j );
+    }
+  }
+}
+
+/**
+ * @copydoc permuteRows( Array< T, 1, PERMUTATION > &, arrayView1d< localIndex const > const & )
+ */
+template< typename T, typename PERMUTATION >
+void permuteRows( Array< T, 3, PERMUTATION > & array,
+                  arrayView1d< localIndex const > const & newToOld )
+{
+  Array< T, 3, PERMUTATION > const source( array );
+  for( localIndex i = 0; i < newToOld.size(); ++i )
+  {
+    for( localIndex j = 0; j < array.size( 1 ); ++j )
+    {
+      for( localIndex l = 0; l < array.size( 2 ); ++l )
+      {
+        array( i, j, l ) = source( newToOld[ i ], j, l );
+      }
+    }
+  }
+}
+
+/**
+ * @brief Build the node graph, two nodes being connected if they belong to the same element.
+ * @param cellBlockManager the cell blocks
+ * @param numNodes the number of nodes
+ * @param adjacency the neighbors of each node
+ */
+void buildNodeGraph( CellBlockManager & cellBlockManager,
+                     localIndex const numNodes,
+                     ArrayOfArrays< localIndex > & adjacency )
+{
+  // Node-to-element map over all the cell blocks, elements being numbered block after block
+  std::vector< arrayView2d< localIndex const, cells::NODE_MAP_USD > > elemsToNodes;
+  std::vector< localIndex > blockOffsets( 1, 0 );
+  cellBlockManager.forElementSubRegions( [&]( CellBlock & cellBlock )
+  {
+    elemsToNodes.emplace_back( cellBlock.nodeList().toViewConst() );
+    blockOffsets.emplace_back( blockOffsets.back() + cellBlock.size() );
+  } );
+
+  array1d< localIndex > nodeOffsets( numNodes + 1 );
+  for( arrayView2d< localIndex const, cells::NODE_MAP_USD > const & blockNodes : elemsToNodes )
+  {
+    for( localIndex k = 0; k < blockNodes.size( 0 ); ++k )
+    {
+      for( localIndex a = 0; a < blockNodes.size( 1 ); ++a )
+      {
+        ++nodeOffsets[ blockNodes( k, a ) + 1 ];
+      }
+    }
+  }
+  for( localIndex n = 0; n < numNodes; ++n )
+  {
+    nodeOffsets[ n + 1 ] += nodeOffsets[ n ];
+  }
+
+  array1d< localIndex > nodeElems( nodeOffsets[ numNodes ] );
+  array1d< localIndex > nodeFill( numNodes );
+  for( std::size_t b = 0; b < elemsToNodes.size(); ++b )
+  {
+    for( localIndex k = 0; k < elemsToNodes[ b ].size( 0 ); ++k )
+    {
+      for( localIndex a = 0; a < elemsToNodes[ b ].size( 1 ); ++a )
+      {
+        localIndex const n = elemsToNodes[ b ]( k, a );
+        nodeElems[ nodeOffsets[ n ] + nodeFill[ n ]++ ] = blockOffsets[ b ] + k;
+      }
+    }
+  }
+
+  // Gather the distinct neighbors of each node, lastSeenBy[m] == n flagging node m as a neighbor of node n
+  array1d< localIndex > lastSeenBy( numNodes );
+  lastSeenBy.setValues< serialPolicy >( -1 );
+  std::vector< localIndex > neighbors;
+  adjacency.resize( 0 );
+  for( localIndex n = 0; n < numNodes; ++n )
+  {
+    neighbors.clear();
+    lastSeenBy[ n ] = n;
+    for( localIndex i = nodeOffsets[ n ]; i < nodeOffsets[ n + 1 ]; ++i )
+    {
+      localIndex const elem = nodeElems[ i ];
+      std::size_t const b = std::upper_bound( blockOffsets.begin(), blockOffsets.end(), elem ) - blockOffsets.begin() - 1;
+      localIndex const k = elem - blockOffsets[ b ];
+      for( localIndex a = 0; a < elemsToNodes[ b ].size( 1 ); ++a )
+      {
+        localIndex const m = elemsToNodes[ b ]( k, a );
+        if( lastSeenBy[ m ] != n )
+        {
+          lastSeenBy[ m ] = n;
+          neighbors.emplace_back( m );
+        }
+      }
+    }
+
+    adjacency.appendArray( LvArray::integerConversion< localIndex >( neighbors.size() ) );
+    for( localIndex i = 0; i < adjacency.sizeOfArray( n ); ++i )
+    {
+      adjacency( n, i ) = neighbors[ i ];
+    }
+  }
+}
+
+/**
+ * @brief Breadth-first search from a vertex among the vertices not numbered yet.
+ * @param adjacency the neighbors of each vertex
+ * @param root the root of the search
+ * @param numbered flags of the vertices already numbered
+ * @param mark marker of the vertices reached by the search
+ * @param markValue value marking the vertices reached by this search
+ * @param lastLevel the vertices of the last level of the search
+ * @return the depth of the search
+ */
+localIndex breadthFirstDepth( ArrayOfArraysView< localIndex const > const & adjacency,
+                              localIndex const root,
+                              arrayView1d< integer const > const & numbered,
+                              arrayView1d< localIndex > const & mark,
+                              localIndex const markValue,
+                              std::vector< localIndex > & lastLevel )
+{
+  std::vector< localIndex > level( 1, root );
+  std::vector< localIndex > nextLevel;
+  mark[ root ] = markValue;
+  localIndex depth = 0;
+  while( true )
+  {
+    nextLevel.clear();
+    for( localIndex const v : level )
+    {
+      for( localIndex const w : adjacency[ v ] )
+      {
+        if( !numbered[ w ] && mark[ w ] != markValue )
+        {
+          mark[ w ] = markValue;
+          nextLevel.emplace_back( w );
+        }
+      }
+    }
+    if( nextLevel.empty() )
+    {
+      break;
+    }
+    level.swap( nextLevel );
+    ++depth;
+  }
+  lastLevel = level;
+  return depth;
+}
+
+} // namespace
+
+std::uint64_t mortonIndex( std::uint32_t const ( &coords )[3] )
+{
+  return interleaveBits( coords );
+}
+
+std::uint64_t hilbertIndex( std::uint32_t const ( &coords )[3] )
+{
+  // Transpose representation of the Hilbert index (J. Skilling, AIP Conf. Proc. 707, 2004)
+  std::uint32_t x[3] = { coords[0], coords[1], coords[2] };
+  std::uint32_t const m = 1u << ( numCurveBits - 1 );
+
+  // Inverse undo
+  for( std::uint32_t q = m; q > 1; q >>= 1 )
+  {
+    std::uint32_t const p = q - 1;
+    for( int i = 0; i < 3; ++i )
+    {
+      if( x[ i ] & q )
+      {
+        x[ 0 ] ^= p;
+      }
+      else
+      {
+        std::uint32_t const t = ( x[ 0 ] ^ x[ i ] ) & p;
+        x[ 0 ] ^= t;
+        x[ i ] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for( int i = 1; i < 3; ++i )
+  {
+    x[ i ] ^= x[ i - 1 ];
+  }
+  std::uint32_t t = 0;
+  for( std::uint32_t q = m; q > 1; q >>= 1 )
+  {
+    if( x[ 2 ] & q )
+    {
+      t ^= q - 1;
+    }
+  }
+  for( int i = 0; i < 3; ++i )
+  {
+    x[ i ] ^= t;
+  }
+
+  return interleaveBits( x );
+}
+
+void reverseCuthillMcKee( ArrayOfArraysView< localIndex const > const & adjacency,
+                          array1d< localIndex > & newToOld )
+{
+  localIndex const numVertices = adjacency.size();
+  newToOld.resize( numVertices );
+
+  array1d< integer > numbered( numVertices );
+  array1d< localIndex > mark( numVertices );
+  mark.setValues< serialPolicy >( -1 );
+  localIndex markValue = 0;
+
+  auto const byDegree = [&]( localIndex const a, localIndex const b )
+  {
+    return adjacency.sizeOfArray( a ) < adjacency.sizeOfArray( b );
+  };
+
+  // Candidate roots of the connected components, by increasing degree
+  std::vector< localIndex > candidates( numVertices );
+  std::iota( candidates.begin(), candidates.end(), 0 );
+  std::stable_sort( candidates.begin(), candidates.end(), byDegree );
+
+  localIndex head = 0;
+  localIndex tail = 0;
+  std::vector< localIndex > lastLevel;
+  std::vector< localIndex > next;
+  for( localIndex const candidate : candidates )
+  {
+    if( numbered[ candidate ] )
+    {
+      continue;
+    }
+
+    // Pseudo-peripheral root of the component (George and Liu)
+    localIndex root = candidate;
+    localIndex depth = breadthFirstDepth( adjacency, root, numbered, mark, markValue++, lastLevel );
+    while( true )
+    {
+      localIndex const farthest = *std::min_element( lastLevel.begin(), lastLevel.end(), byDegree );
+      localIndex const farthestDepth = breadthFirstDepth( adjacency, farthest, numbered, mark, markValue++, lastLevel );
+      if( farthestDepth <= depth )
+      {
+        break;
+      }
+      root = farthest;
+      depth = farthestDepth;
+    }
+
+    // Cuthill-McKee numbering of the component, newToOld being the queue of the search
+    numbered[ root ] = 1;
+    newToOld[ tail++ ] = root;
+    while( head < tail )
+    {
+      localIndex const v = newToOld[ head++ ];
+      next.clear();
+      for( localIndex const w : adjacency[ v ] )
+      {
+        if( !numbered[ w ] )
+        {
+          numbered[ w ] = 1;
+          next.emplace_back( w );
+        }
+      }
+      std::stable_sort( next.begin(), next.end(), byDegree );
+      for( localIndex const w : next )
+      {
+        newToOld[ tail++ ] = w;
+      }
+    }
+  }
+
+  std::reverse( newToOld.begin(), newToOld.end() );
+}
+
+void permuteObjects( ObjectManagerBase & object,
+                     arrayView1d< localIndex const > const & newToOld )
+{
+  GEOSX_ERROR_IF_NE( newToOld.size(), object.size() );
+
+  object.forWrappers( [&]( WrapperBase & wrapper )
+  {
+    if( wrapper.sizedFromParent() == 0 )
+    {
+      return;
+    }
+    rtTypes::ApplyArrayTypeLambda2( rtTypes::typeID( std::type_index( wrapper.get_typeid() ) ),
+                                    false,
+                                    [&]( auto array, auto GEOSX_UNUSED_PARAM( baseType ) )
+    {
+      using ArrayType = decltype( array );
+      Wrapper< ArrayType > * const typedWrapper = dynamic_cast< Wrapper< ArrayType > * >( &wrapper );
+      if( typedWrapper != nullptr && typedWrapper->reference().size( 0 ) == newToOld.size() )
+      {
+        permuteRows( typedWrapper->reference(), newToOld );
+      }
+    } );
+  } );
+
+  array1d< localIndex > oldToNew( newToOld.size() );
+  for( localIndex i = 0; i < newToOld.size(); ++i )
+  {
+    oldToNew[ newToOld[ i ] ] = i;
+  }
+
+  object.sets().forWrappers< SortedArray< localIndex > >( [&]( Wrapper< SortedArray< localIndex > > & wrapper )
+  {
+    SortedArray< localIndex > & set = wrapper.reference();
+    std::vector< localIndex > renumbered;
+    renumbered.reserve( set.size() );
+    for( localIndex const i : set )
+    {
+      renumbered.emplace_back( oldToNew[ i ] );
+    }
+    std::sort( renumbered.begin(), renumbered.end() );
+    set.clear();
+    set.insert( renumbered.begin(), renumbered.end() );
+  } );
+
+  object.ConstructGlobalToLocalMap();
+}
+
+void renumberElements( NodeManager const & nodeManager,
+                       CellBlockManager & cellBlockManager )
+{
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+
+  cellBlockManager.forElementSubRegions( [&]( CellBlock & cellBlock )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = cellBlock.nodeList().toViewConst();
+    localIndex const numNodesPerElem = elemsToNodes.size( 1 );
+
+    std::vector< std::uint64_t > const keys =
+      computeCurveIndices( elemsToNodes.size( 0 ),
+                           [&]( localIndex const k, real64 ( & centroid )[3] )
+    {
+      LvArray::tensorOps::fill< 3 >( centroid, 0.0 );
+      for( localIndex a = 0; a < numNodesPerElem; ++a )
+      {
+        LvArray::tensorOps::add< 3 >( centroid, X[ elemsToNodes( k, a ) ] );
+      }
+      LvArray::tensorOps::scale< 3 >( centroid, 1.0 / numNodesPerElem );
+    },
+                           mortonIndex );
+
+    array1d< localIndex > newToOld;
+    sortByKeys( keys, newToOld );
+
+    // The element-to-node map is not a plain array wrapper and is permuted explicitly
+    permuteRows< localIndex, cells::NODE_MAP_PERMUTATION >( cellBlock.nodeList(), newToOld.toViewConst() );
+    permuteObjects( cellBlock, newToOld.toViewConst() );
+  } );
+}
+
+void renumberNodes( NodeRenumbering const method,
+                    NodeManager & nodeManager,
+                    CellBlockManager & cellBlockManager )
+{
+  localIndex const numNodes = nodeManager.size();
+  array1d< localIndex > newToOld;
+
+  switch( method )
+  {
+    case NodeRenumbering::none:
+    {
+      return;
+    }
+    case NodeRenumbering::reverseCuthillMcKee:
+    {
+      ArrayOfArrays< localIndex > adjacency;
+      buildNodeGraph( cellBlockManager, numNodes, adjacency );
+      reverseCuthillMcKee( adjacency.toViewConst(), newToOld );
+      break;
+    }
+    case NodeRenumbering::hilbert:
+    {
+      arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+      std::vector< std::uint64_t > const keys =
+        computeCurveIndices( numNodes,
+                             [&]( localIndex const n, real64 ( & x )[3] )
+      {
+        LvArray::tensorOps::copy< 3 >( x, X[ n ] );
+      },
+                             hilbertIndex );
+      sortByKeys( keys, newToOld );
+      break;
+    }
+  }
+
+  permuteObjects( nodeManager, newToOld.toViewConst() );
+
+  array1d< localIndex > oldToNew( numNodes );
+  for( localIndex i = 0; i < numNodes; ++i )
+  {
+    oldToNew[ newToOld[ i ] ] = i;
+  }
+
+  cellBlockManager.forElementSubRegions( [&]( CellBlock & cellBlock )
+  {
+    arrayView2d< localIndex, cells::NODE_MAP_USD > const elemsToNodes = cellBlock.nodeList().toView();
+    for( localIndex k = 0; k < elemsToNodes.size( 0 ); ++k )
+    {
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        elemsToNodes( k, a ) = oldToNew[ elemsToNodes( k, a ) ];
+      }
+    }
+  } );
+}
+
+localIndex nodeGraphBandwidth( CellBlockManager & cellBlockManager )
+{
+  localIndex bandwidth = 0;
+  cellBlockManager.forElementSubRegions( [&]( CellBlock & cellBlock )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = cellBlock.nodeList().toViewConst();
+    for( localIndex k = 0; k < elemsToNodes.size( 0 ); ++k )
+    {
+      localIndex minNode = std::numeric_limits< localIndex >::max();
+      localIndex maxNode = 0;
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        minNode = std::min( minNode, elemsToNodes( k, a ) );
+        maxNode = std::max( maxNode, elemsToNodes( k, a ) );
+      }
+      bandwidth = std::max( bandwidth, maxNode - minNode );
+    }
+  } );
+  return bandwidth;
+}
+
+} // namespace MeshRenumbering
+
+} // namespace geosx
@@ -0,0 +1,135 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MeshRenumbering.hpp
+ */
+
+#ifndef GEOSX_MESHUTILITIES_MESHRENUMBERING_HPP_
+#define GEOSX_MESHUTILITIES_MESHRENUMBERING_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/EnumStrings.hpp"
+
+#include <cstdint>
+
+namespace geosx
+{
+
+class CellBlockManager;
+class NodeManager;
+class ObjectManagerBase;
+
+/**
+ * @enum NodeRenumbering
+ * @brief Renumbering of the mesh nodes applied at mesh import.
+ */
+enum class NodeRenumbering : integer
+{
+  none,                ///< Keep the ordering of the mesh generator
+  reverseCuthillMcKee, ///< Reverse Cuthill-McKee ordering of the node graph, minimizing its bandwidth
+  hilbert              ///< Ordering along a Hilbert curve through the node positions
+};
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( NodeRenumbering, "none", "reverseCuthillMcKee", "hilbert" )
+
+/**
+ * @enum ElementRenumbering
+ * @brief Renumbering of the elements of each cell block applied at mesh import.
+ */
+enum class ElementRenumbering : integer
+{
+  none,  ///< Keep the ordering of the mesh generator
+  morton ///< Ordering along a Morton (Z-order) curve through the element centroids
+};
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( ElementRenumbering, "none", "morton" )
+
+/**
+ * @brief Locality-improving renumbering of the nodes and the elements of a mesh.
+ *
+ * The renumbering is applied to the nodes and cell blocks produced by a mesh generator,
+ * before the element regions, faces and edges are derived from them: only the node and
+ * cell block wrappers have to be permuted, and all the maps built afterwards inherit the
+ * new ordering. Global indices are unchanged, the renumbering is local to each rank.
+ */
+namespace MeshRenumbering
+{
+
+/**
+ * @brief Renumber the elements of each cell block by the Morton index of their centroid.
+ * @param nodeManager the node manager holding the node positions
+ * @param cellBlockManager the cell blocks to renumber
+ */
+void renumberElements( NodeManager const & nodeManager,
+                       CellBlockManager & cellBlockManager );
+
+/**
+ * @brief Renumber the nodes and update the element-to-node maps of the cell blocks.
+ * @param method the node renumbering method
+ * @param nodeManager the node manager to renumber
+ * @param cellBlockManager the cell blocks referring to the nodes
+ */
+void renumberNodes( NodeRenumbering const method,
+                    NodeManager & nodeManager,
+                    CellBlockManager & cellBlockManager );
+
+/**
+ * @brief Compute the bandwidth of the node graph, i.e. the largest index difference of two nodes of an element.
+ * @param cellBlockManager the cell blocks
+ * @return the bandwidth
+ */
+localIndex nodeGraphBandwidth( CellBlockManager & cellBlockManager );
+
+/**
+ * @brief Compute the reverse Cuthill-McKee ordering of a graph.
+ * @param adjacency the neighbors of each vertex
+ * @param newToOld the old index of each vertex in the new ordering
+ */
+void reverseCuthillMcKee( ArrayOfArraysView< localIndex const > const & adjacency,
+                          array1d< localIndex > & newToOld );
+
+/**
+ * @brief Compute the index of a point along a 3D Morton curve.
+ * @param coords the coordinates of the point on a grid of 2^21 points in each direction
+ * @return the index of the point along the curve
+ */
+std::uint64_t mortonIndex( std::uint32_t const ( &coords )[3] );
+
+/**
+ * @brief Compute the index of a point along a 3D Hilbert curve.
+ * @param coords the coordinates of the point on a grid of 2^21 points in each direction
+ * @return the index of the point along the curve
+ */
+std::uint64_t hilbertIndex( std::uint32_t const ( &coords )[3] );
+
+/**
+ * @brief Apply a permutation to the objects of a manager.
+ * @param object the object manager
+ * @param newToOld the old index of each object in the new ordering
+ *
+ * All the array wrappers sized from the object manager are permuted, the sets are renumbered
+ * and the global-to-local map is rebuilt. Maps from other objects to these objects must be
+ * renumbered separately.
+ */
+void permuteObjects( ObjectManagerBase & object,
+                     arrayView1d< localIndex const > const & newToOld );
+
+} // namespace MeshRenumbering
+
+} // namespace geosx
+
+#endif //GEOSX_MESHUTILITIES_MESHRENUMBERING_HPP_
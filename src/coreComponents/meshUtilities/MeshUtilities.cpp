@@ -18,12 +18,15 @@
  */
 
 #include "MeshUtilities.hpp"
+#include "BoundingVolumeHierarchy.hpp"
 #include "managers/ObjectManagerBase.hpp"
 #include "dataRepository/xmlWrapper.hpp"
 #include "SimpleGeometricObjects/SimpleGeometricObjectBase.hpp"
 #include "common/TimingMacros.hpp"
 #include "mesh/NodeManager.hpp"
 
+#include <algorithm>
+
 namespace geosx
 {
 using namespace dataRepository;
@@ -48,6 +51,16 @@ void MeshUtilities::GenerateNodesets( dataRepository::Group const * geometries,
   localIndex const numNodes = nodeManager->size();
   Group & sets = nodeManager->sets();
 
+  // index the nodes once, so that each bounded object only tests the nodes in its bounding box
+  BoundingVolumeHierarchy const nodeTree( numNodes, [&]( localIndex const a, real64 ( & min )[3], real64 ( & max )[3] )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      min[d] = X( a, d );
+      max[d] = X( a, d );
+    }
+  } );
+
   for( int i = 0; i < geometries->GetSubGroups().size(); ++i )
   {
     SimpleGeometricObjectBase const * const object = geometries->GetGroup< SimpleGeometricObjectBase >( i );
@@ -55,11 +68,34 @@ void MeshUtilities::GenerateNodesets( dataRepository::Group const * geometries,
     {
       string name = object->getName();
       SortedArray< localIndex > & targetSet = sets.registerWrapper< SortedArray< localIndex > >( name )->reference();
-      for( localIndex a=0; a<numNodes; ++a )
+
+      R1Tensor boxMin, boxMax;
+      if( object->GetBoundingBox( boxMin, boxMax ) )
+      {
+        real64 const min[3] = { boxMin[0], boxMin[1], boxMin[2] };
+        real64 const max[3] = { boxMax[0], boxMax[1], boxMax[2] };
+
+        array1d< localIndex > nodesInObject;
+        nodeTree.forEachIntersecting( min, max, [&]( localIndex const a )
+        {
+          if( object->IsCoordInObject( X[a] ))
+          {
+            nodesInObject.emplace_back( a );
+          }
+        } );
+
+        // the tree visits the nodes in no particular order
+        std::sort( nodesInObject.begin(), nodesInObject.end() );
+        targetSet.insert( nodesInObject.begin(), nodesInObject.end() );
+      }
+      else
       {
-        if( object->IsCoordInObject( X[a] ))
+        for( localIndex a=0; a<numNodes; ++a )
         {
-          targetSet.insert( a );
+          if( object->IsCoordInObject( X[a] ))
+          {
+            targetSet.insert( a );
+          }
         }
       }
     }
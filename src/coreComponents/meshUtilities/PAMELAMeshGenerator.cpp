@@ -385,6 +385,9 @@ void PAMELAMeshGenerator::GenerateMesh( DomainPartition * const domain )
     }
   }
 
+  // Everything has been copied into the GEOSX data structure: release the PAMELA mesh before the faces,
+  // edges and ghosts are built so that both copies of the mesh don't coexist.
+  m_pamelaMesh.reset();
 }
 
 void PAMELAMeshGenerator::GetElemToNodesRelationInBox( const std::string & GEOSX_UNUSED_PARAM( elementType ),
@@ -0,0 +1,249 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PerforationCache.cpp
+ */
+
+#include "PerforationCache.hpp"
+
+#include "mesh/CellElementSubRegion.hpp"
+#include "mesh/MeshLevel.hpp"
+#include "meshUtilities/InternalWellGenerator.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <cstring>
+#include <fstream>
+
+namespace geosx
+{
+
+namespace
+{
+
+/// Tag at the beginning of the cache files, to be changed with their layout
+constexpr char cacheFileTag[] = "GEOSX_PERFORATION_CACHE_1";
+
+/**
+ * @brief Add bytes to a FNV-1a hash.
+ * @param[in] hash the current hash
+ * @param[in] data the bytes
+ * @param[in] numBytes the number of bytes
+ * @return the updated hash
+ */
+std::uint64_t hashBytes( std::uint64_t hash, void const * const data, std::size_t const numBytes )
+{
+  unsigned char const * const bytes = static_cast< unsigned char const * >( data );
+  for( std::size_t i = 0; i < numBytes; ++i )
+  {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/// Offset basis of the FNV-1a hash
+constexpr std::uint64_t hashSeed = 14695981039346656037ULL;
+
+template< typename T >
+void writeValue( std::ofstream & file, T const & value )
+{
+  file.write( reinterpret_cast< char const * >( &value ), sizeof( T ) );
+}
+
+template< typename T >
+bool readValue( std::ifstream & file, T & value )
+{
+  return static_cast< bool >( file.read( reinterpret_cast< char * >( &value ), sizeof( T ) ) );
+}
+
+}
+
+PerforationCache::PerforationCache( string const & filePrefix, MeshLevel const & mesh ):
+  m_fileName(),
+  m_meshHash( hashSeed ),
+  m_numReusedWells( 0 ),
+  m_modified( false )
+{
+  if( filePrefix.empty() )
+  {
+    return;
+  }
+
+  int const rank = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
+  int const numRanks = MpiWrapper::Comm_size( MPI_COMM_GEOSX );
+  m_fileName = filePrefix + "." + std::to_string( rank );
+
+  // the matches are local indices, valid as long as the local reservoir elements are numbered and placed as before
+  m_meshHash = hashBytes( m_meshHash, &numRanks, sizeof( numRanks ) );
+  mesh.getElemManager()->forElementSubRegionsComplete< CellElementSubRegion >( [&]( localIndex const er,
+                                                                                    localIndex const esr,
+                                                                                    ElementRegionBase const &,
+                                                                                    CellElementSubRegion const & subRegion )
+  {
+    localIndex const numElems = subRegion.size();
+    arrayView1d< globalIndex const > const localToGlobal = subRegion.localToGlobalMap();
+    arrayView2d< real64 const > const centers = subRegion.getElementCenter();
+    centers.move( LvArray::MemorySpace::CPU, false );
+
+    m_meshHash = hashBytes( m_meshHash, &er, sizeof( er ) );
+    m_meshHash = hashBytes( m_meshHash, &esr, sizeof( esr ) );
+    m_meshHash = hashBytes( m_meshHash, &numElems, sizeof( numElems ) );
+    m_meshHash = hashBytes( m_meshHash, localToGlobal.data(), numElems * sizeof( globalIndex ) );
+    for( localIndex ei = 0; ei < numElems; ++ei )
+    {
+      for( localIndex d = 0; d < 3; ++d )
+      {
+        real64 const coord = centers( ei, d );
+        m_meshHash = hashBytes( m_meshHash, &coord, sizeof( coord ) );
+      }
+    }
+  } );
+
+  read();
+}
+
+std::uint64_t PerforationCache::hashWell( InternalWellGenerator const & wellGeometry )
+{
+  arrayView1d< R1Tensor const > const perfCoords = wellGeometry.GetPerfCoords();
+  localIndex const numPerforations = perfCoords.size();
+
+  std::uint64_t hash = hashSeed;
+  hash = hashBytes( hash, &numPerforations, sizeof( numPerforations ) );
+  for( localIndex iperf = 0; iperf < numPerforations; ++iperf )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      real64 const coord = perfCoords[iperf][d];
+      hash = hashBytes( hash, &coord, sizeof( coord ) );
+    }
+  }
+  return hash;
+}
+
+std::vector< PerforationCache::Match > const * PerforationCache::getMatches( InternalWellGenerator const & wellGeometry )
+{
+  if( m_fileName.empty() )
+  {
+    return nullptr;
+  }
+
+  std::map< string, Entry >::const_iterator const cached = m_cachedWells.find( wellGeometry.getName() );
+  if( cached == m_cachedWells.end() || cached->second.wellHash != hashWell( wellGeometry ) )
+  {
+    return nullptr;
+  }
+
+  // the reused entries are written again with the new ones
+  ++m_numReusedWells;
+  Entry & entry = m_wells[wellGeometry.getName()];
+  entry = cached->second;
+  return &entry.matches;
+}
+
+void PerforationCache::setMatches( InternalWellGenerator const & wellGeometry, std::vector< Match > matches )
+{
+  if( m_fileName.empty() )
+  {
+    return;
+  }
+
+  m_wells[wellGeometry.getName()] = { hashWell( wellGeometry ), std::move( matches ) };
+  m_modified = true;
+}
+
+void PerforationCache::read()
+{
+  std::ifstream file( m_fileName, std::ios::binary );
+  if( !file )
+  {
+    return;
+  }
+
+  // a cache file written for another mesh or partitioning is ignored
+  char tag[ sizeof( cacheFileTag ) ];
+  std::uint64_t meshHash = 0;
+  std::uint64_t numWells = 0;
+  if( !file.read( tag, sizeof( tag ) ) || std::memcmp( tag, cacheFileTag, sizeof( tag ) ) != 0 ||
+      !readValue( file, meshHash ) || meshHash != m_meshHash ||
+      !readValue( file, numWells ) )
+  {
+    return;
+  }
+
+  std::map< string, Entry > cachedWells;
+  for( std::uint64_t iwell = 0; iwell < numWells; ++iwell )
+  {
+    std::uint64_t nameLength = 0;
+    std::uint64_t numMatches = 0;
+    Entry entry;
+    if( !readValue( file, nameLength ) )
+    {
+      return;
+    }
+    string name( nameLength, ' ' );
+    if( !file.read( &name[0], nameLength ) || !readValue( file, entry.wellHash ) || !readValue( file, numMatches ) )
+    {
+      return;
+    }
+    entry.matches.resize( numMatches );
+    for( Match & match : entry.matches )
+    {
+      if( !readValue( file, match.perforation ) || !readValue( file, match.er ) ||
+          !readValue( file, match.esr ) || !readValue( file, match.ei ) )
+      {
+        return;
+      }
+    }
+    cachedWells[name] = std::move( entry );
+  }
+
+  // the entries are only used once the whole file has been read
+  m_cachedWells = std::move( cachedWells );
+}
+
+void PerforationCache::write() const
+{
+  if( m_fileName.empty() || !m_modified )
+  {
+    return;
+  }
+
+  std::ofstream file( m_fileName, std::ios::binary | std::ios::trunc );
+  GEOSX_WARNING_IF( !file, "Cannot write the perforation cache file " << m_fileName );
+  if( !file )
+  {
+    return;
+  }
+
+  file.write( cacheFileTag, sizeof( cacheFileTag ) );
+  writeValue( file, m_meshHash );
+  writeValue( file, static_cast< std::uint64_t >( m_wells.size() ) );
+  for( std::pair< string const, Entry > const & well : m_wells )
+  {
+    writeValue( file, static_cast< std::uint64_t >( well.first.size() ) );
+    file.write( well.first.data(), well.first.size() );
+    writeValue( file, well.second.wellHash );
+    writeValue( file, static_cast< std::uint64_t >( well.second.matches.size() ) );
+    for( Match const & match : well.second.matches )
+    {
+      writeValue( file, match.perforation );
+      writeValue( file, match.er );
+      writeValue( file, match.esr );
+      writeValue( file, match.ei );
+    }
+  }
+}
+
+} /* namespace geosx */
@@ -0,0 +1,139 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file PerforationCache.hpp
+ */
+
+#ifndef GEOSX_MESHUTILITIES_PERFORATIONCACHE_HPP_
+#define GEOSX_MESHUTILITIES_PERFORATIONCACHE_HPP_
+
+#include "common/DataTypes.hpp"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace geosx
+{
+
+class MeshLevel;
+class InternalWellGenerator;
+
+/**
+ * @class PerforationCache
+ * @brief Host cache of the reservoir elements containing the perforations of the wells.
+ *
+ * Each rank keeps the perforations matched with its reservoir elements in its own file, named after
+ * the given prefix and the rank. The file starts with a hash of the local reservoir elements (their
+ * numbering and their centers) and of the number of ranks, and each well comes with a hash of its
+ * perforations, so that the matches are only reused when neither the mesh, its partitioning nor the
+ * well changed. Stale or missing entries are searched again and the file is rewritten.
+ */
+class PerforationCache
+{
+public:
+
+  /// A perforation matched with a local reservoir element
+  struct Match
+  {
+    /// Global index of the perforation in the well
+    globalIndex perforation;
+    /// Region index of the reservoir element
+    localIndex er;
+    /// Subregion index of the reservoir element
+    localIndex esr;
+    /// Index of the reservoir element
+    localIndex ei;
+  };
+
+  /**
+   * @brief Constructor, reading the cache file of this rank if it exists.
+   * @param[in] filePrefix the prefix of the cache files, the cache is disabled if empty
+   * @param[in] mesh the mesh level whose reservoir elements are matched with the perforations
+   */
+  PerforationCache( string const & filePrefix, MeshLevel const & mesh );
+
+  /**
+   * @brief Get the cached matches of a well.
+   * @param[in] wellGeometry the well
+   * @return the matches of the perforations of the well on this rank, or nullptr if they are not cached
+   */
+  std::vector< Match > const * getMatches( InternalWellGenerator const & wellGeometry );
+
+  /**
+   * @brief Store the matches of a well.
+   * @param[in] wellGeometry the well
+   * @param[in] matches the matches of the perforations of the well on this rank
+   */
+  void setMatches( InternalWellGenerator const & wellGeometry, std::vector< Match > matches );
+
+  /**
+   * @brief Write the cache file of this rank if some wells were not found in it.
+   */
+  void write() const;
+
+  /**
+   * @brief Get the number of wells whose matches were found in the cache file.
+   * @return the number of wells
+   */
+  localIndex numReusedWells() const
+  { return m_numReusedWells; }
+
+private:
+
+  /// The matches of the perforations of a well
+  struct Entry
+  {
+    /// Hash of the perforations of the well
+    std::uint64_t wellHash;
+    /// Matches of the perforations of the well on this rank
+    std::vector< Match > matches;
+  };
+
+  /**
+   * @brief Compute the hash of the perforations of a well.
+   * @param[in] wellGeometry the well
+   * @return the hash
+   */
+  static std::uint64_t hashWell( InternalWellGenerator const & wellGeometry );
+
+  /**
+   * @brief Read the cache file of this rank.
+   */
+  void read();
+
+  /// Name of the cache file of this rank, empty if the cache is disabled
+  string m_fileName;
+
+  /// Hash of the local reservoir elements
+  std::uint64_t m_meshHash;
+
+  /// Entries read from the cache file, by well name
+  std::map< string, Entry > m_cachedWells;
+
+  /// Entries of the current run, by well name
+  std::map< string, Entry > m_wells;
+
+  /// Number of wells whose matches were found in the cache file
+  localIndex m_numReusedWells;
+
+  /// Flag telling if some wells were not found in the cache file
+  bool m_modified;
+
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MESHUTILITIES_PERFORATIONCACHE_HPP_ */
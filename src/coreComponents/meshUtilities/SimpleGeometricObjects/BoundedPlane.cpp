@@ -18,6 +18,8 @@
 
 #include "BoundedPlane.hpp"
 
+#include <algorithm>
+
 namespace geosx
 {
 using namespace dataRepository;
@@ -102,6 +104,20 @@ void BoundedPlane::findRectangleLimits()
   }
 }
 
+void BoundedPlane::getBoundingBox( real64 (&min)[3], real64 (&max)[3] ) const
+{
+  for( int d = 0; d < 3; ++d )
+  {
+    min[d] = m_points[0][d];
+    max[d] = m_points[0][d];
+    for( localIndex i = 1; i < m_points.size(); ++i )
+    {
+      min[d] = std::min( min[d], m_points[i][d] );
+      max[d] = std::max( max[d], m_points[i][d] );
+    }
+  }
+}
+
 bool BoundedPlane::IsCoordInObject( const R1Tensor & coord ) const
 {
   bool isInside = true;
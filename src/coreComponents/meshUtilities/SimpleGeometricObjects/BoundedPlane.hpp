@@ -121,6 +121,13 @@ public:
    */
   R1Tensor const & getLengthVector() const {return m_lengthVector;}
 
+  /**
+   * @brief Get the axis-aligned bounding box of the bounded plane.
+   * @param min the minimum coordinates of the box
+   * @param max the maximum coordinates of the box
+   */
+  void getBoundingBox( real64 (&min)[3], real64 (&max)[3] ) const;
+
 
 protected:
 
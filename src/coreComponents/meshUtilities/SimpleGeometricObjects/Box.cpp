@@ -137,6 +137,29 @@ bool Box::IsCoordInObject( const R1Tensor & coord ) const
   return rval;
 }
 
+bool Box::GetBoundingBox( R1Tensor & min, R1Tensor & max ) const
+{
+  min = m_min;
+  max = m_max;
+  if( std::fabs( m_strikeAngle ) >= 1e-20 )
+  {
+    // bound the horizontal section of the box rotated back around its center,
+    // padded by the rounding of the rotation in IsCoordInObject
+    real64 const halfX = 0.5 * ( m_max[0] - m_min[0] );
+    real64 const halfY = 0.5 * ( m_max[1] - m_min[1] );
+    real64 const cosStrike = std::fabs( m_cosStrike );
+    real64 const sinStrike = std::fabs( m_sinStrike );
+    real64 const pad = 1e-12 * ( halfX + halfY + std::fabs( m_boxCenter[0] ) + std::fabs( m_boxCenter[1] ) );
+    real64 const extentX = cosStrike * halfX + sinStrike * halfY + pad;
+    real64 const extentY = sinStrike * halfX + cosStrike * halfY + pad;
+    min[0] = m_boxCenter[0] - extentX;
+    max[0] = m_boxCenter[0] + extentX;
+    min[1] = m_boxCenter[1] - extentY;
+    max[1] = m_boxCenter[1] + extentY;
+  }
+  return true;
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, Box, std::string const &, Group * const )
 
 } /* namespace geosx */
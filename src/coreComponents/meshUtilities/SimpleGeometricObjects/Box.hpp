@@ -68,6 +68,8 @@ public:
 
   bool IsCoordInObject( const R1Tensor & coord ) const override final;
 
+  bool GetBoundingBox( R1Tensor & min, R1Tensor & max ) const override final;
+
 protected:
 
   /**
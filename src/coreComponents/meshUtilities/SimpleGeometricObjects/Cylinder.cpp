@@ -78,6 +78,25 @@ bool Cylinder::IsCoordInObject( const R1Tensor & coord ) const
   return rval;
 }
 
+bool Cylinder::GetBoundingBox( R1Tensor & min, R1Tensor & max ) const
+{
+  // IsCoordInObject tests the distance to point1 along the axis in both directions,
+  // so the tested cylinder extends from point1 - ( point2 - point1 ) to point2
+  R1Tensor axisVector = m_point2;
+  axisVector -= m_point1;
+
+  R1Tensor end1 = m_point1;
+  end1 -= axisVector;
+
+  real64 const pad = m_radius + 1e-12 * ( m_radius + axisVector.L2_Norm() );
+  for( int i = 0; i < 3; ++i )
+  {
+    min[i] = std::min( end1[i], m_point2[i] ) - pad;
+    max[i] = std::max( end1[i], m_point2[i] ) + pad;
+  }
+  return true;
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, Cylinder, std::string const &, Group * const )
 
 } /* namespace geosx */
@@ -94,6 +94,16 @@ public:
    */
   virtual bool IsCoordInObject( const R1Tensor & coord ) const = 0;
 
+  /**
+   * @brief Get an axis-aligned box containing the object.
+   * @param[out] min the minimum (x,y,z) coordinates of the box
+   * @param[out] max the maximum (x,y,z) coordinates of the box
+   * @return false if the object is unbounded, in which case @p min and @p max are not set
+   */
+  virtual bool GetBoundingBox( R1Tensor & GEOSX_UNUSED_PARAM( min ),
+                               R1Tensor & GEOSX_UNUSED_PARAM( max ) ) const
+  { return false; }
+
 };
 
 
@@ -18,74 +18,112 @@
 
 #include "VTMMeshGenerator.hpp"
 
+#include "VtuFile.hpp"
+#include "common/TimingMacros.hpp"
 #include "managers/DomainPartition.hpp"
-
-#include "codingUtilities/StringUtilities.hpp"
-#include <math.h>
-
-#include "mpiCommunications/PartitionBase.hpp"
-#include "mpiCommunications/SpatialPartition.hpp"
-//#include "SimpleGeometricObjects.hpp"
-
 #include "mesh/MeshBody.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <map>
+#include <sstream>
+#include <unordered_map>
 
 namespace geosx
 {
 using namespace dataRepository;
 
-VTMMeshGenerator::VTMMeshGenerator( string const & name, Group * const parent ):
-  MeshGeneratorBase( name, parent )
+namespace
 {
 
-  /*
-     for( int i=0 ; i<3 ; ++i )
-     {
-     m_wExtensionMin[i] = 0;
-     m_wExtensionMax[i] = 0;
-     m_nExtensionLayersMin[i] = 0;
-     m_nExtensionLayersMax[i] = 0;
-     m_commonRatioMin[i] = 1.5;
-     m_commonRatioMax[i] = 1.5;
-     }
-   */
-
-  registerWrapper< string >( keys::filePath )->
-    setInputFlag( InputFlags::REQUIRED )->
-    setDescription( "path to the vtm file" );
+/**
+ * @brief Collect the files of the data sets of a multiblock, in the order of the blocks.
+ * @param[in] node the node of the multiblock or of one of its blocks
+ * @param[in] directory the directory of the .vtm, the files are relative to
+ * @param[out] files the paths of the files
+ */
+void collectBlockFiles( xmlWrapper::xmlNode const & node, string const & directory, std::vector< string > & files )
+{
+  for( xmlWrapper::xmlNode child = node.first_child(); !child.empty(); child = child.next_sibling() )
+  {
+    string const file = child.attribute( "file" ).value();
+    if( !file.empty() )
+    {
+      files.emplace_back( file[0] == '/' ? file : directory + '/' + file );
+    }
+    collectBlockFiles( child, directory, files );
+  }
 }
 
-VTMMeshGenerator::~VTMMeshGenerator()
+/// A VTK cell type imported as a GEOSX element type
+struct CellType
 {
-  // TODO Auto-generated destructor stub
-}
+  /// The name of the type in the names of the cell blocks
+  string name;
 
+  /// The GEOSX element type
+  string elementType;
 
+  /// The VTK node of each GEOSX node of the element
+  std::vector< localIndex > vtkNodes;
+};
 
-//}
-/**
- * @param domain
- */
-void VTMMeshGenerator::GenerateElementRegions( DomainPartition & GEOSX_UNUSED_PARAM( domain ) )
+/// The imported VTK cell types, by VTK type
+std::map< integer, CellType > const cellTypes =
+{
+  { 10, { "TETRA", "C3D4", { 0, 1, 2, 3 } } },
+  { 11, { "HEX", "C3D8", { 0, 1, 2, 3, 4, 5, 6, 7 } } },
+  { 12, { "HEX", "C3D8", { 0, 1, 3, 2, 4, 5, 7, 6 } } },
+  { 13, { "WEDGE", "C3D6", { 0, 1, 2, 3, 4, 5 } } },
+  { 14, { "PYRAMID", "C3D5", { 0, 1, 2, 3, 4 } } }
+};
+
+/// The cells of a cell block, gathered from the blocks of the rank
+struct CellBlockData
 {
-  //  lvector numElements;
-  //
-  //  for( array1d<string>::size_type r=0 ; r<m_regionNames.size() ; ++r )
-  //  {
-  //    numElements.push_back( 0 );
-  //  }
-  //
-  //  domain.m_feElementManager->resize( numElements, m_regionNames,
-  // m_elementType );
+  /// The GEOSX element type
+  string elementType;
+
+  /// The number of nodes of the cells
+  localIndex numNodesPerCell;
+
+  /// The local nodes of the cells, cell after cell
+  std::vector< localIndex > nodes;
+
+  /// The global ids of the cells
+  std::vector< globalIndex > globalIds;
+};
 
 }
 
-void VTMMeshGenerator::PostProcessInput()
+VTMMeshGenerator::VTMMeshGenerator( string const & name, Group * const parent ):
+  MeshGeneratorBase( name, parent )
 {
-  m_fileName = this->getReference< string >( keys::filePath );
-  m_vtmFile.Load( m_fileName, true, false );
+  registerWrapper( viewKeyStruct::filePathString, &m_filePath )->
+    setInputFlag( InputFlags::REQUIRED )->
+    setRestartFlags( RestartFlags::NO_WRITE )->
+    setDescription( "Path to the vtm file, with one vtu block per partition" );
+  registerWrapper( viewKeyStruct::globalPointIdsString, &m_globalPointIds )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( "GlobalPointIds" )->
+    setDescription( "Name of the point data array of the blocks with the global ids of the points" );
+  registerWrapper( viewKeyStruct::globalCellIdsString, &m_globalCellIds )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( "GlobalCellIds" )->
+    setDescription( "Name of the cell data array of the blocks with the global ids of the cells. "
+                    "If one of the blocks does not have it, the cells are numbered in the order of the blocks" );
+  registerWrapper( viewKeyStruct::regionAttributeString, &m_regionAttribute )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( "" )->
+    setDescription( "Name of the integer cell data array of the blocks with the regions of the cells. "
+                    "The cell blocks are named after the region and the type of their cells (e.g. 1_HEX), "
+                    "or only after the type of their cells if empty (e.g. HEX)" );
 }
 
+VTMMeshGenerator::~VTMMeshGenerator()
+{}
 
+void VTMMeshGenerator::GenerateElementRegions( DomainPartition & GEOSX_UNUSED_PARAM( domain ) )
+{}
 
 void VTMMeshGenerator::RemapMesh( dataRepository::Group * const GEOSX_UNUSED_PARAM( domain ) )
 {}
@@ -95,108 +133,239 @@ Group * VTMMeshGenerator::CreateChild( string const & GEOSX_UNUSED_PARAM( childK
   return nullptr;
 }
 
+std::vector< string > VTMMeshGenerator::readBlockFiles() const
+{
+  // The .vtm is small, but it is read by a single rank so that all the ranks do not open the same file.
+  string blockFiles;
+  if( MpiWrapper::Comm_rank() == 0 )
+  {
+    xmlWrapper::xmlDocument document;
+    xmlWrapper::xmlResult const result = document.load_file( m_filePath.c_str() );
+    GEOSX_ERROR_IF( !result, "Could not parse the VTK file " << m_filePath << ": " << result.description() );
+
+    xmlWrapper::xmlNode const root = document.child( "VTKFile" );
+    GEOSX_ERROR_IF( string( root.attribute( "type" ).value() ) != "vtkMultiBlockDataSet",
+                    "The VTK file " << m_filePath << " is not a multiblock data set" );
+
+    string directory, baseName;
+    splitPath( m_filePath, directory, baseName );
+    std::vector< string > files;
+    collectBlockFiles( root.child( "vtkMultiBlockDataSet" ), directory, files );
+    for( string const & file : files )
+    {
+      blockFiles += file + '\n';
+    }
+  }
+  MpiWrapper::Broadcast( blockFiles, 0 );
+
+  std::vector< string > files;
+  std::istringstream stream( blockFiles );
+  for( string file; std::getline( stream, file ); )
+  {
+    files.emplace_back( file );
+  }
+  return files;
+}
+
 void VTMMeshGenerator::GenerateMesh( DomainPartition * const domain )
 {
-  /// Basic mesh registration
+  GEOSX_MARK_FUNCTION;
+
   Group * const meshBodies = domain->GetGroup( std::string( "MeshBodies" ));
   MeshBody * const meshBody = meshBodies->RegisterGroup< MeshBody >( this->getName() );
+
+  //TODO for the moment we only consider on mesh level "Level0"
   MeshLevel * const meshLevel0 = meshBody->RegisterGroup< MeshLevel >( std::string( "Level0" ));
   NodeManager * nodeManager = meshLevel0->getNodeManager();
-  CellBlockManager * elementManager = domain->GetGroup< CellBlockManager >( keys::cellManager );
+  CellBlockManager * cellBlockManager = domain->GetGroup< CellBlockManager >( keys::cellManager );
+
+  // The blocks are distributed in contiguous ranges, the partitions of consecutive blocks are usually close.
+  std::vector< string > const blockFiles = readBlockFiles();
+  int const rank = MpiWrapper::Comm_rank();
+  int const numRanks = MpiWrapper::Comm_size();
+  localIndex const numBlocks = LvArray::integerConversion< localIndex >( blockFiles.size() );
+  GEOSX_ERROR_IF( numBlocks < numRanks,
+                  "The VTK file " << m_filePath << " has " << numBlocks << " blocks, it cannot be imported on "
+                                  << numRanks << " ranks. Use as many ranks as blocks at most." );
+  localIndex const firstBlock = numBlocks * rank / numRanks;
+  localIndex const lastBlock = numBlocks * ( rank + 1 ) / numRanks;
+  GEOSX_LOG_RANK_0( "Reading the " << numBlocks << " blocks of " << m_filePath << " on " << numRanks << " ranks" );
 
-  /// Region registrations
-  for( localIndex rankBlockIndex = 0; rankBlockIndex < m_vtmFile.NumRankBlocks(); rankBlockIndex++ )
+  // The points shared by several blocks of the rank are merged with their global ids.
+  std::unordered_map< globalIndex, localIndex > globalToLocalNode;
+  std::vector< real64 > nodeCoordinates;
+  std::vector< globalIndex > nodeGlobalIds;
+  std::map< string, CellBlockData > cellBlocksData;
+  bool hasCellGlobalIds = true;
+
+  for( localIndex block = firstBlock; block < lastBlock; ++block )
   {
-    const auto & rankBlock = m_vtmFile.GetRankBlock( rankBlockIndex );
-    for( localIndex meshBlockIndex = 0; meshBlockIndex < rankBlock.NumMeshBlocks(); meshBlockIndex++ )
+    VtuFile const vtuFile( blockFiles[block] );
+
+    array1d< real64 > coordinates;
+    array1d< globalIndex > pointGlobalIds;
+    vtuFile.readPoints( coordinates );
+    GEOSX_ERROR_IF( !vtuFile.hasPointData( m_globalPointIds ),
+                    "The block " << blockFiles[block] << " has no point data " << m_globalPointIds << " with the global ids of its points" );
+    vtuFile.readPointData( m_globalPointIds, pointGlobalIds );
+
+    array1d< localIndex > connectivity;
+    array1d< localIndex > offsets;
+    array1d< integer > types;
+    vtuFile.readCells( connectivity, offsets, types );
+
+    array1d< globalIndex > cellGlobalIds;
+    hasCellGlobalIds = hasCellGlobalIds && vtuFile.hasCellData( m_globalCellIds );
+    if( hasCellGlobalIds )
+    {
+      vtuFile.readCellData( m_globalCellIds, cellGlobalIds );
+    }
+
+    // The cells duplicated from the neighboring partitions are left to the ghosting.
+    array1d< integer > ghostTypes;
+    if( vtuFile.hasCellData( "vtkGhostType" ) )
+    {
+      vtuFile.readCellData( "vtkGhostType", ghostTypes );
+    }
+
+    array1d< integer > regions;
+    if( !m_regionAttribute.empty() )
     {
-      const auto & meshBlock = rankBlock.GetMeshBlock( meshBlockIndex );
-      if( meshBlock.IsARegionBlock() )
+      vtuFile.readCellData( m_regionAttribute, regions );
+    }
+
+    array1d< localIndex > blockToLocalNode( vtuFile.numPoints() );
+    blockToLocalNode.setValues< serialPolicy >( -1 );
+
+    for( localIndex k = 0; k < vtuFile.numCells(); ++k )
+    {
+      if( !ghostTypes.empty() && ( ghostTypes[k] & 1 ) )
+      {
+        continue;
+      }
+
+      auto const cellType = cellTypes.find( types[k] );
+      GEOSX_ERROR_IF( cellType == cellTypes.end(),
+                      "Unsupported VTK cell type " << types[k] << " in the block " << blockFiles[block] );
+      CellType const & type = cellType->second;
+
+      localIndex const cellBegin = k > 0 ? offsets[k - 1] : 0;
+      localIndex const numCellNodes = LvArray::integerConversion< localIndex >( type.vtkNodes.size() );
+      GEOSX_ERROR_IF_NE_MSG( offsets[k] - cellBegin, numCellNodes,
+                             "Wrong number of nodes of the cell " << k << " in the block " << blockFiles[block] );
+
+      string const cellBlockName = m_regionAttribute.empty() ? type.name : std::to_string( regions[k] ) + "_" + type.name;
+      CellBlockData & cellBlockData = cellBlocksData[cellBlockName];
+      cellBlockData.elementType = type.elementType;
+      cellBlockData.numNodesPerCell = numCellNodes;
+
+      for( localIndex const vtkNode : type.vtkNodes )
       {
-        const auto & mesh = meshBlock.mesh();
-        /// Write nodes
-        nodeManager->resize( mesh.NumVertices());
-        arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const & X = nodeManager->referencePosition();
-        for( localIndex a=0; a< mesh.NumVertices(); ++a )
+        localIndex const point = connectivity[cellBegin + vtkNode];
+        if( blockToLocalNode[point] < 0 )
         {
-          for( int i = 0; i < 3; ++i )
+          auto const inserted = globalToLocalNode.emplace( pointGlobalIds[point],
+                                                           LvArray::integerConversion< localIndex >( nodeGlobalIds.size() ) );
+          if( inserted.second )
           {
-            X( a, i ) = mesh.Vertex( a )[i];
+            nodeGlobalIds.emplace_back( pointGlobalIds[point] );
+            nodeCoordinates.insert( nodeCoordinates.end(), &coordinates[3 * point], &coordinates[3 * point] + 3 );
           }
+          blockToLocalNode[point] = inserted.first->second;
         }
-        /// Cell blocks registrations
-        if( mesh.NumHex() > 0 )
-        {
-          CellBlock * cellBlock = elementManager->GetGroup( keys::cellBlocks )->RegisterGroup< CellBlock >( "HEX" );
-          cellBlock->SetElementType( "C3D8" );
-          auto & cellToVertex = cellBlock->nodeList();
-          cellBlock->resize( mesh.NumCells());
-          cellToVertex.resize( mesh.NumCells(), mesh.NumVerticesInCell( 0 ) );
+        cellBlockData.nodes.emplace_back( blockToLocalNode[point] );
+      }
+      cellBlockData.globalIds.emplace_back( hasCellGlobalIds ? cellGlobalIds[k] : -1 );
+    }
+  }
 
-          for( localIndex k=0; k<mesh.NumCells(); ++k )
-          {
-            cellToVertex[k][0] = mesh.CellVertexIndex( k, 0 );
-            cellToVertex[k][1] = mesh.CellVertexIndex( k, 1 );
-            cellToVertex[k][2] = mesh.CellVertexIndex( k, 3 );
-            cellToVertex[k][3] = mesh.CellVertexIndex( k, 2 );
-            cellToVertex[k][4] = mesh.CellVertexIndex( k, 4 );
-            cellToVertex[k][5] = mesh.CellVertexIndex( k, 5 );
-            cellToVertex[k][6] = mesh.CellVertexIndex( k, 7 );
-            cellToVertex[k][7] = mesh.CellVertexIndex( k, 6 );
-          }
-        }
-        if( mesh.NumTetra() > 0 )
-        {
-          CellBlock * cellBlock = elementManager->GetGroup( keys::cellBlocks )->RegisterGroup< CellBlock >( "TETRA" );
-          cellBlock->SetElementType( "C3D4" );
-          auto & cellToVertex = cellBlock->nodeList();
-          cellBlock->resize( mesh.NumCells());
-          cellToVertex.resize( mesh.NumCells(), mesh.NumVerticesInCell( 0 ) );
+  // Nodes
+  localIndex const numNodes = LvArray::integerConversion< localIndex >( nodeGlobalIds.size() );
+  nodeManager->resize( numNodes );
+  arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const & X = nodeManager->referencePosition();
+  arrayView1d< globalIndex > const & nodeLocalToGlobal = nodeManager->localToGlobalMap();
+  SortedArray< localIndex > & allNodes = nodeManager->sets().registerWrapper< SortedArray< localIndex > >( std::string( "all" ) )->reference();
 
-          for( localIndex k=0; k<mesh.NumCells(); ++k )
-          {
-            cellToVertex[k][0] = mesh.CellVertexIndex( k, 0 );
-            cellToVertex[k][1] = mesh.CellVertexIndex( k, 1 );
-            cellToVertex[k][2] = mesh.CellVertexIndex( k, 2 );
-            cellToVertex[k][3] = mesh.CellVertexIndex( k, 3 );
-          }
-        }
-        if( mesh.NumPrism() > 0 )
-        {
-          CellBlock * cellBlock = elementManager->GetGroup( keys::cellBlocks )->RegisterGroup< CellBlock >( "WEDGE" );
-          cellBlock->SetElementType( "C3D6" );
-          auto & cellToVertex = cellBlock->nodeList();
-          cellBlock->resize( mesh.NumCells());
-          cellToVertex.resize( mesh.NumCells(), mesh.NumVerticesInCell( 0 ));
+  array1d< real64 > boundingBox( 6 );
+  for( int i = 0; i < 3; ++i )
+  {
+    boundingBox[i] = std::numeric_limits< real64 >::max();
+    boundingBox[i + 3] = std::numeric_limits< real64 >::lowest();
+  }
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      X( a, i ) = nodeCoordinates[3 * a + i];
+      boundingBox[i] = std::min( boundingBox[i], X( a, i ) );
+      boundingBox[i + 3] = std::max( boundingBox[i + 3], X( a, i ) );
+    }
+    nodeLocalToGlobal[a] = nodeGlobalIds[a];
+    allNodes.insert( a );
+  }
 
-          for( localIndex k=0; k<mesh.NumCells(); ++k )
-          {
-            cellToVertex[k][0] = mesh.CellVertexIndex( k, 0 );
-            cellToVertex[k][1] = mesh.CellVertexIndex( k, 1 );
-            cellToVertex[k][2] = mesh.CellVertexIndex( k, 2 );
-            cellToVertex[k][3] = mesh.CellVertexIndex( k, 3 );
-            cellToVertex[k][4] = mesh.CellVertexIndex( k, 4 );
-            cellToVertex[k][5] = mesh.CellVertexIndex( k, 5 );
-          }
-        }
-        if( mesh.NumPyr() > 0 )
-        {
-          CellBlock * cellBlock = elementManager->GetGroup( keys::cellBlocks )->RegisterGroup< CellBlock >( "PYR" );
-          cellBlock->SetElementType( "C3D5" );
-          auto & cellToVertex = cellBlock->nodeList();
-          cellBlock->resize( mesh.NumCells());
-          cellToVertex.resize( mesh.NumCells(), mesh.NumVerticesInCell( 0 ));
+  // Cell blocks
+  bool const useCellGlobalIds = MpiWrapper::Min( hasCellGlobalIds ? 1 : 0 ) == 1;
+  localIndex numCells = 0;
+  for( auto const & cellBlockData : cellBlocksData )
+  {
+    numCells += LvArray::integerConversion< localIndex >( cellBlockData.second.globalIds.size() );
+  }
+  globalIndex cellGlobalId = MpiWrapper::PrefixSum< globalIndex >( numCells );
 
-          for( localIndex k=0; k<mesh.NumCells(); ++k )
-          {
-            cellToVertex[k][0] = mesh.CellVertexIndex( k, 0 );
-            cellToVertex[k][1] = mesh.CellVertexIndex( k, 1 );
-            cellToVertex[k][2] = mesh.CellVertexIndex( k, 2 );
-            cellToVertex[k][3] = mesh.CellVertexIndex( k, 3 );
-            cellToVertex[k][4] = mesh.CellVertexIndex( k, 4 );
-          }
-        }
+  for( auto const & nameAndData : cellBlocksData )
+  {
+    CellBlockData const & cellBlockData = nameAndData.second;
+    localIndex const numBlockCells = LvArray::integerConversion< localIndex >( cellBlockData.globalIds.size() );
+
+    CellBlock * const cellBlock = cellBlockManager->GetGroup( keys::cellBlocks )->RegisterGroup< CellBlock >( nameAndData.first );
+    cellBlock->SetElementType( cellBlockData.elementType );
+    cellBlock->resize( numBlockCells );
+    auto & cellToVertex = cellBlock->nodeList();
+    cellToVertex.resize( numBlockCells, cellBlockData.numNodesPerCell );
+    arrayView1d< globalIndex > const & localToGlobal = cellBlock->localToGlobalMap();
+
+    for( localIndex k = 0; k < numBlockCells; ++k )
+    {
+      for( localIndex a = 0; a < cellBlockData.numNodesPerCell; ++a )
+      {
+        cellToVertex[k][a] = cellBlockData.nodes[k * cellBlockData.numNodesPerCell + a];
       }
+      localToGlobal[k] = useCellGlobalIds ? cellBlockData.globalIds[k] : cellGlobalId++;
+    }
+  }
+
+  // The ranks whose blocks touch share nodes: they are the neighbors the ghosts are exchanged with.
+  array1d< real64 > boundingBoxes;
+  MpiWrapper::allGather( boundingBox.toViewConst(), boundingBoxes );
+
+  R1Tensor xMin( std::numeric_limits< real64 >::max() );
+  R1Tensor xMax( std::numeric_limits< real64 >::lowest() );
+  for( int r = 0; r < numRanks; ++r )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      xMin[i] = std::min( xMin[i], boundingBoxes[6 * r + i] );
+      xMax[i] = std::max( xMax[i], boundingBoxes[6 * r + i + 3] );
+    }
+  }
+  xMax -= xMin;
+  meshBody->setGlobalLengthScale( std::fabs( xMax.L2_Norm() ) );
+
+  real64 const tolerance = 1e-8 * xMax.L2_Norm();
+  std::set< int > & neighbors = domain->getMetisNeighborList();
+  neighbors.clear();
+  for( int r = 0; r < numRanks; ++r )
+  {
+    bool touches = r != rank && numNodes > 0;
+    for( int i = 0; i < 3 && touches; ++i )
+    {
+      touches = boundingBoxes[6 * r + i] <= boundingBox[i + 3] + tolerance &&
+                boundingBox[i] <= boundingBoxes[6 * r + i + 3] + tolerance;
+    }
+    if( touches )
+    {
+      neighbors.insert( r );
     }
   }
 }
@@ -206,7 +375,6 @@ void VTMMeshGenerator::GetElemToNodesRelationInBox( const std::string & GEOSX_UN
                                                     const int & GEOSX_UNUSED_PARAM( iEle ),
                                                     int GEOSX_UNUSED_PARAM( nodeIDInBox )[],
                                                     const int GEOSX_UNUSED_PARAM( node_size ) )
-
 {}
 
 REGISTER_CATALOG_ENTRY( MeshGeneratorBase, VTMMeshGenerator, std::string const &, Group * const )
@@ -0,0 +1,380 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file VtuFile.cpp
+ */
+
+#include "VtuFile.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+
+namespace geosx
+{
+
+namespace
+{
+
+/**
+ * @brief Decode base64 characters, until @p maxBytes bytes are decoded or the end of the text.
+ * @param[in] begin the first character
+ * @param[in] end the end of the text
+ * @param[in] maxBytes the number of bytes to decode
+ * @param[out] bytes the decoded bytes
+ *
+ * The padding characters end a group of characters without ending the decoding, so that the header and the data
+ * of an array decode the same whether they were encoded together or separately.
+ */
+void decodeBase64( char const * const begin,
+                   char const * const end,
+                   std::size_t const maxBytes,
+                   std::vector< char > & bytes )
+{
+  bytes.clear();
+  unsigned int buffer = 0;
+  int numBits = 0;
+  for( char const * c = begin; c != end && *c != '<' && bytes.size() < maxBytes; ++c )
+  {
+    int digit;
+    if( *c >= 'A' && *c <= 'Z' )
+    {
+      digit = *c - 'A';
+    }
+    else if( *c >= 'a' && *c <= 'z' )
+    {
+      digit = *c - 'a' + 26;
+    }
+    else if( *c >= '0' && *c <= '9' )
+    {
+      digit = *c - '0' + 52;
+    }
+    else if( *c == '+' )
+    {
+      digit = 62;
+    }
+    else if( *c == '/' )
+    {
+      digit = 63;
+    }
+    else
+    {
+      // The padding drops the bits left of the group, the white spaces are ignored.
+      if( *c == '=' )
+      {
+        buffer = 0;
+        numBits = 0;
+      }
+      continue;
+    }
+
+    buffer = ( buffer << 6 ) | digit;
+    numBits += 6;
+    if( numBits >= 8 )
+    {
+      numBits -= 8;
+      bytes.push_back( static_cast< char >( ( buffer >> numBits ) & 0xFF ) );
+    }
+  }
+}
+
+/**
+ * @brief Convert the values of a binary array.
+ * @tparam SOURCE the type of the values in the file
+ * @tparam T the type the values are converted to
+ * @param[in] data the first byte of the values
+ * @param[in] numValues the number of values
+ * @param[out] values the converted values
+ */
+template< typename SOURCE, typename T >
+void convertBinary( char const * const data, localIndex const numValues, array1d< T > & values )
+{
+  values.resize( numValues );
+  for( localIndex i = 0; i < numValues; ++i )
+  {
+    // The values of the appended data are not aligned.
+    SOURCE value;
+    std::memcpy( &value, data + i * sizeof( SOURCE ), sizeof( SOURCE ) );
+    values[i] = static_cast< T >( value );
+  }
+}
+
+/**
+ * @brief Convert the values of a binary array, given the name of their type in the file.
+ * @tparam T the type the values are converted to
+ * @param[in] type the VTK name of the type of the values
+ * @param[in] data the first byte of the values
+ * @param[in] numBytes the number of bytes of the values
+ * @param[out] values the converted values
+ * @return false if the type is unknown
+ */
+template< typename T >
+bool convertBinary( string const & type, char const * const data, std::size_t const numBytes, array1d< T > & values )
+{
+  std::map< string, std::function< void() > > const converters =
+  {
+    { "Int8", [&](){ convertBinary< std::int8_t >( data, numBytes / sizeof( std::int8_t ), values ); } },
+    { "UInt8", [&](){ convertBinary< std::uint8_t >( data, numBytes / sizeof( std::uint8_t ), values ); } },
+    { "Int16", [&](){ convertBinary< std::int16_t >( data, numBytes / sizeof( std::int16_t ), values ); } },
+    { "UInt16", [&](){ convertBinary< std::uint16_t >( data, numBytes / sizeof( std::uint16_t ), values ); } },
+    { "Int32", [&](){ convertBinary< std::int32_t >( data, numBytes / sizeof( std::int32_t ), values ); } },
+    { "UInt32", [&](){ convertBinary< std::uint32_t >( data, numBytes / sizeof( std::uint32_t ), values ); } },
+    { "Int64", [&](){ convertBinary< std::int64_t >( data, numBytes / sizeof( std::int64_t ), values ); } },
+    { "UInt64", [&](){ convertBinary< std::uint64_t >( data, numBytes / sizeof( std::uint64_t ), values ); } },
+    { "Float32", [&](){ convertBinary< float >( data, numBytes / sizeof( float ), values ); } },
+    { "Float64", [&](){ convertBinary< double >( data, numBytes / sizeof( double ), values ); } }
+  };
+
+  auto const converter = converters.find( type );
+  if( converter == converters.end() )
+  {
+    return false;
+  }
+  converter->second();
+  return true;
+}
+
+/**
+ * @brief Convert the values of an ascii array.
+ * @tparam T the type the values are converted to
+ * @param[in] text the values separated by white spaces
+ * @param[in] isFloatingPoint whether the values in the file are floating point values
+ * @param[out] values the converted values
+ */
+template< typename T >
+void convertAscii( char const * text, bool const isFloatingPoint, array1d< T > & values )
+{
+  values.clear();
+  while( true )
+  {
+    char * next;
+    T const value = isFloatingPoint ? static_cast< T >( std::strtod( text, &next ) )
+                                    : static_cast< T >( std::strtoll( text, &next, 10 ) );
+    if( next == text )
+    {
+      break;
+    }
+    values.emplace_back( value );
+    text = next;
+  }
+}
+
+} // namespace
+
+VtuFile::VtuFile( string const & fileName ):
+  m_fileName( fileName ),
+  m_content(),
+  m_document(),
+  m_piece(),
+  m_headerSize( sizeof( std::uint32_t ) ),
+  m_appendedBegin( 0 ),
+  m_appendedBase64( false ),
+  m_numPoints( 0 ),
+  m_numCells( 0 )
+{
+  std::ifstream file( fileName, std::ios::binary );
+  GEOSX_ERROR_IF( !file, "Could not open the VTK file " << fileName );
+  m_content.assign( std::istreambuf_iterator< char >( file ), std::istreambuf_iterator< char >() );
+
+  // The appended data is not valid XML: only the headers before it are parsed, closed by the end of the root.
+  std::size_t headersEnd = m_content.size();
+  std::size_t const appendedTag = m_content.find( "<AppendedData" );
+  if( appendedTag != string::npos )
+  {
+    headersEnd = appendedTag;
+    std::size_t const appendedTagEnd = m_content.find( '>', appendedTag );
+    std::size_t const underscore = m_content.find( '_', appendedTagEnd );
+    GEOSX_ERROR_IF( appendedTagEnd == string::npos || underscore == string::npos,
+                    "Invalid appended data in the VTK file " << fileName );
+    string const tag = m_content.substr( appendedTag, appendedTagEnd - appendedTag );
+    m_appendedBase64 = tag.find( "base64" ) != string::npos;
+    m_appendedBegin = underscore + 1;
+  }
+  string headers = m_content.substr( 0, headersEnd );
+  if( appendedTag != string::npos )
+  {
+    headers += "</VTKFile>";
+  }
+
+  xmlWrapper::xmlResult const result = m_document.load_buffer( headers.data(), headers.size() );
+  GEOSX_ERROR_IF( !result, "Could not parse the VTK file " << fileName << ": " << result.description() );
+
+  xmlWrapper::xmlNode const root = m_document.child( "VTKFile" );
+  GEOSX_ERROR_IF( string( root.attribute( "type" ).value() ) != "UnstructuredGrid",
+                  "The VTK file " << fileName << " is not an unstructured grid" );
+  GEOSX_ERROR_IF( !root.attribute( "compressor" ).empty(),
+                  "The VTK file " << fileName << " is compressed, only uncompressed files are supported" );
+  GEOSX_ERROR_IF( !root.attribute( "byte_order" ).empty() && string( root.attribute( "byte_order" ).value() ) != "LittleEndian",
+                  "The VTK file " << fileName << " is big endian, only little endian files are supported" );
+  if( string( root.attribute( "header_type" ).value() ) == "UInt64" )
+  {
+    m_headerSize = sizeof( std::uint64_t );
+  }
+
+  xmlWrapper::xmlNode const grid = root.child( "UnstructuredGrid" );
+  m_piece = grid.child( "Piece" );
+  GEOSX_ERROR_IF( m_piece.empty(), "The VTK file " << fileName << " has no piece" );
+  GEOSX_ERROR_IF( !m_piece.next_sibling( "Piece" ).empty(),
+                  "The VTK file " << fileName << " has several pieces, only one piece per file is supported" );
+
+  m_numPoints = m_piece.attribute( "NumberOfPoints" ).as_llong();
+  m_numCells = m_piece.attribute( "NumberOfCells" ).as_llong();
+}
+
+xmlWrapper::xmlNode VtuFile::findDataArray( string const & section, string const & name ) const
+{
+  for( xmlWrapper::xmlNode dataArray = m_piece.child( section.c_str() ).child( "DataArray" );
+       !dataArray.empty();
+       dataArray = dataArray.next_sibling( "DataArray" ) )
+  {
+    if( name.empty() || name == dataArray.attribute( "Name" ).value() )
+    {
+      return dataArray;
+    }
+  }
+  return xmlWrapper::xmlNode();
+}
+
+bool VtuFile::hasPointData( string const & name ) const
+{
+  return !findDataArray( "PointData", name ).empty();
+}
+
+bool VtuFile::hasCellData( string const & name ) const
+{
+  return !findDataArray( "CellData", name ).empty();
+}
+
+void VtuFile::readPoints( array1d< real64 > & coordinates ) const
+{
+  xmlWrapper::xmlNode const dataArray = findDataArray( "Points", "" );
+  GEOSX_ERROR_IF( dataArray.empty(), "The VTK file " << m_fileName << " has no points" );
+  GEOSX_ERROR_IF( dataArray.attribute( "NumberOfComponents" ).as_int( 1 ) != 3,
+                  "The points of the VTK file " << m_fileName << " do not have 3 coordinates" );
+  readDataArray( dataArray, 3 * m_numPoints, coordinates );
+}
+
+void VtuFile::readCells( array1d< localIndex > & connectivity,
+                         array1d< localIndex > & offsets,
+                         array1d< integer > & types ) const
+{
+  xmlWrapper::xmlNode const offsetsArray = findDataArray( "Cells", "offsets" );
+  xmlWrapper::xmlNode const connectivityArray = findDataArray( "Cells", "connectivity" );
+  xmlWrapper::xmlNode const typesArray = findDataArray( "Cells", "types" );
+  GEOSX_ERROR_IF( offsetsArray.empty() || connectivityArray.empty() || typesArray.empty(),
+                  "The VTK file " << m_fileName << " has no cell connectivity, offsets or types" );
+
+  readDataArray( offsetsArray, m_numCells, offsets );
+  readDataArray( connectivityArray, m_numCells > 0 ? offsets[m_numCells - 1] : 0, connectivity );
+  readDataArray( typesArray, m_numCells, types );
+}
+
+template< typename T >
+void VtuFile::readPointData( string const & name, array1d< T > & values ) const
+{
+  xmlWrapper::xmlNode const dataArray = findDataArray( "PointData", name );
+  GEOSX_ERROR_IF( dataArray.empty(), "The VTK file " << m_fileName << " has no point data " << name );
+  readDataArray( dataArray, m_numPoints, values );
+}
+
+template< typename T >
+void VtuFile::readCellData( string const & name, array1d< T > & values ) const
+{
+  xmlWrapper::xmlNode const dataArray = findDataArray( "CellData", name );
+  GEOSX_ERROR_IF( dataArray.empty(), "The VTK file " << m_fileName << " has no cell data " << name );
+  readDataArray( dataArray, m_numCells, values );
+}
+
+template< typename T >
+void VtuFile::readDataArray( xmlWrapper::xmlNode const & dataArray,
+                             localIndex const numValues,
+                             array1d< T > & values ) const
+{
+  string const type = dataArray.attribute( "type" ).value();
+  string const format = dataArray.attribute( "format" ).empty() ? "ascii" : dataArray.attribute( "format" ).value();
+  string const name = dataArray.attribute( "Name" ).value();
+
+  if( format == "ascii" )
+  {
+    convertAscii( dataArray.child_value(), type.compare( 0, 5, "Float" ) == 0, values );
+  }
+  else
+  {
+    char const * begin;
+    char const * end;
+    if( format == "binary" )
+    {
+      begin = dataArray.child_value();
+      end = begin + std::strlen( begin );
+    }
+    else
+    {
+      GEOSX_ERROR_IF( format != "appended" || m_appendedBegin == 0,
+                      "Unknown format " << format << " of the array " << name << " of the VTK file " << m_fileName );
+      begin = m_content.data() + m_appendedBegin + dataArray.attribute( "offset" ).as_ullong();
+      end = m_content.data() + m_content.size();
+    }
+
+    // Each binary array starts with its size in bytes.
+    bool const isBase64 = format == "binary" || m_appendedBase64;
+    std::vector< char > decoded;
+    char const * header = begin;
+    if( isBase64 )
+    {
+      decodeBase64( begin, end, m_headerSize, decoded );
+      header = decoded.data();
+    }
+    GEOSX_ERROR_IF( std::size_t( ( isBase64 ? decoded.data() + decoded.size() : end ) - header ) < m_headerSize,
+                    "Truncated array " << name << " in the VTK file " << m_fileName );
+    std::uint64_t numBytes;
+    if( m_headerSize == sizeof( std::uint64_t ) )
+    {
+      std::memcpy( &numBytes, header, sizeof( std::uint64_t ) );
+    }
+    else
+    {
+      std::uint32_t numBytes32;
+      std::memcpy( &numBytes32, header, sizeof( std::uint32_t ) );
+      numBytes = numBytes32;
+    }
+
+    char const * data = begin + m_headerSize;
+    if( isBase64 )
+    {
+      decodeBase64( begin, end, m_headerSize + numBytes, decoded );
+      data = decoded.data() + m_headerSize;
+      end = decoded.data() + decoded.size();
+    }
+    GEOSX_ERROR_IF( std::uint64_t( end - data ) < numBytes,
+                    "Truncated array " << name << " in the VTK file " << m_fileName );
+
+    GEOSX_ERROR_IF( !convertBinary( type, data, numBytes, values ),
+                    "Unknown type " << type << " of the array " << name << " of the VTK file " << m_fileName );
+  }
+
+  GEOSX_ERROR_IF_NE_MSG( values.size(), numValues,
+                         "Wrong number of values of the array " << name << " in the VTK file " << m_fileName );
+}
+
+/// @cond DO_NOT_DOCUMENT
+template void VtuFile::readPointData( string const &, array1d< globalIndex > & ) const;
+template void VtuFile::readPointData( string const &, array1d< real64 > & ) const;
+template void VtuFile::readCellData( string const &, array1d< globalIndex > & ) const;
+template void VtuFile::readCellData( string const &, array1d< integer > & ) const;
+template void VtuFile::readCellData( string const &, array1d< real64 > & ) const;
+/// @endcond
+
+} // namespace geosx
@@ -0,0 +1,148 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file VtuFile.hpp
+ */
+
+#ifndef GEOSX_MESHUTILITIES_VTUFILE_HPP
+#define GEOSX_MESHUTILITIES_VTUFILE_HPP
+
+#include "common/DataTypes.hpp"
+#include "dataRepository/xmlWrapper.hpp"
+
+namespace geosx
+{
+
+/**
+ * @class VtuFile
+ * @brief Reader of the single piece VTK XML unstructured grid files (.vtu).
+ *
+ * The arrays can be written in the ascii, binary (base64) or appended (raw or base64) formats, uncompressed and
+ * in little endian. Only the XML headers are parsed as a document: the appended data stays in the content of the
+ * file and each array is decoded from there when it is read, straight into the type requested by the caller.
+ */
+class VtuFile
+{
+public:
+
+  /**
+   * @brief Read the file and parse its headers.
+   * @param[in] fileName the path to the .vtu file
+   */
+  explicit VtuFile( string const & fileName );
+
+  /// @return the number of points of the piece
+  localIndex numPoints() const { return m_numPoints; }
+
+  /// @return the number of cells of the piece
+  localIndex numCells() const { return m_numCells; }
+
+  /**
+   * @param[in] name the name of the array
+   * @return true if the point data has an array named @p name
+   */
+  bool hasPointData( string const & name ) const;
+
+  /**
+   * @param[in] name the name of the array
+   * @return true if the cell data has an array named @p name
+   */
+  bool hasCellData( string const & name ) const;
+
+  /**
+   * @brief Read the coordinates of the points.
+   * @param[out] coordinates the 3 coordinates of the points, point after point
+   */
+  void readPoints( array1d< real64 > & coordinates ) const;
+
+  /**
+   * @brief Read the cell to point connectivity and the VTK cell types.
+   * @param[out] connectivity the points of the cells, cell after cell
+   * @param[out] offsets the end of each cell in @p connectivity
+   * @param[out] types the VTK type of each cell
+   */
+  void readCells( array1d< localIndex > & connectivity,
+                  array1d< localIndex > & offsets,
+                  array1d< integer > & types ) const;
+
+  /**
+   * @brief Read a single component array of the point data.
+   * @tparam T the type the values are converted to
+   * @param[in] name the name of the array
+   * @param[out] values the values, one per point
+   */
+  template< typename T >
+  void readPointData( string const & name, array1d< T > & values ) const;
+
+  /**
+   * @brief Read a single component array of the cell data.
+   * @tparam T the type the values are converted to
+   * @param[in] name the name of the array
+   * @param[out] values the values, one per cell
+   */
+  template< typename T >
+  void readCellData( string const & name, array1d< T > & values ) const;
+
+private:
+
+  /**
+   * @brief Find an array of a section of the piece.
+   * @param[in] section the name of the section (PointData, CellData, Points or Cells)
+   * @param[in] name the name of the array, the first array of the section if empty
+   * @return the DataArray node, empty if not found
+   */
+  xmlWrapper::xmlNode findDataArray( string const & section, string const & name ) const;
+
+  /**
+   * @brief Decode an array and convert its values.
+   * @tparam T the type the values are converted to
+   * @param[in] dataArray the DataArray node
+   * @param[in] numValues the expected number of values
+   * @param[out] values the values
+   */
+  template< typename T >
+  void readDataArray( xmlWrapper::xmlNode const & dataArray, localIndex const numValues, array1d< T > & values ) const;
+
+  /// The name of the file, for the error messages
+  string m_fileName;
+
+  /// The content of the file
+  string m_content;
+
+  /// The XML headers, everything before the appended data
+  xmlWrapper::xmlDocument m_document;
+
+  /// The Piece node of the unstructured grid
+  xmlWrapper::xmlNode m_piece;
+
+  /// The size in bytes of the headers of the binary arrays
+  std::size_t m_headerSize;
+
+  /// The position in the content of the first byte of the appended data
+  std::size_t m_appendedBegin;
+
+  /// Whether the appended data is encoded in base64 instead of raw
+  bool m_appendedBase64;
+
+  /// The number of points of the piece
+  localIndex m_numPoints;
+
+  /// The number of cells of the piece
+  localIndex m_numCells;
+};
+
+} // namespace geosx
+
+#endif /* GEOSX_MESHUTILITIES_VTUFILE_HPP */
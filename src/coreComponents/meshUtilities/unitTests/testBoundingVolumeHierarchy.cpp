@@ -0,0 +1,150 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "meshUtilities/BoundingVolumeHierarchy.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <algorithm>
+#include <limits>
+#include <random>
+
+using namespace geosx;
+
+namespace
+{
+
+/// Points on a few horizontal layers, so that many of them are tied in z.
+array2d< real64 > makePoints( localIndex const numPoints )
+{
+  std::mt19937 gen( 2020 );
+  std::uniform_real_distribution< real64 > dist( 0.0, 1.0 );
+
+  array2d< real64 > points( numPoints, 3 );
+  for( localIndex i = 0; i < numPoints; ++i )
+  {
+    points[i][0] = dist( gen );
+    points[i][1] = dist( gen );
+    points[i][2] = std::floor( 4.0 * dist( gen ) ) / 4.0;
+  }
+  return points;
+}
+
+BoundingVolumeHierarchy makeTree( array2d< real64 > const & points )
+{
+  return BoundingVolumeHierarchy( points.size( 0 ), [&]( localIndex const i, real64 ( & min )[3], real64 ( & max )[3] )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      min[d] = points[i][d];
+      max[d] = points[i][d];
+    }
+  } );
+}
+
+}
+
+TEST( BoundingVolumeHierarchy, emptyHierarchy )
+{
+  BoundingVolumeHierarchy const tree = makeTree( array2d< real64 >( 0, 3 ) );
+
+  real64 const point[3] = { 0.0, 0.0, 0.0 };
+  EXPECT_EQ( tree.findNearest( point ), -1 );
+
+  localIndex numVisited = 0;
+  tree.forEachContaining( point, [&]( localIndex const ) { ++numVisited; } );
+  EXPECT_EQ( numVisited, 0 );
+}
+
+TEST( BoundingVolumeHierarchy, findNearestMatchesLinearSearch )
+{
+  array2d< real64 > const points = makePoints( 2000 );
+  BoundingVolumeHierarchy const tree = makeTree( points );
+
+  array2d< real64 > const queries = makePoints( 200 );
+  for( localIndex q = 0; q < queries.size( 0 ); ++q )
+  {
+    real64 const point[3] = { queries[q][0], queries[q][1], queries[q][2] };
+
+    // the first of the closest points, as in a loop over the points
+    localIndex nearest = -1;
+    real64 nearestDist2 = std::numeric_limits< real64 >::max();
+    for( localIndex i = 0; i < points.size( 0 ); ++i )
+    {
+      real64 dist2 = 0.0;
+      for( int d = 0; d < 3; ++d )
+      {
+        dist2 += ( points[i][d] - point[d] ) * ( points[i][d] - point[d] );
+      }
+      if( dist2 < nearestDist2 )
+      {
+        nearestDist2 = dist2;
+        nearest = i;
+      }
+    }
+
+    EXPECT_EQ( tree.findNearest( point ), nearest );
+  }
+}
+
+TEST( BoundingVolumeHierarchy, forEachIntersectingMatchesLinearSearch )
+{
+  array2d< real64 > const points = makePoints( 2000 );
+  BoundingVolumeHierarchy const tree = makeTree( points );
+
+  array2d< real64 > const queries = makePoints( 50 );
+  for( localIndex q = 0; q < queries.size( 0 ); ++q )
+  {
+    // the boxes touch one of the layers of points
+    real64 const min[3] = { queries[q][0] - 0.2, queries[q][1] - 0.1, 0.0 };
+    real64 const max[3] = { queries[q][0] + 0.1, queries[q][1] + 0.2, queries[q][2] };
+
+    std::vector< localIndex > expected;
+    for( localIndex i = 0; i < points.size( 0 ); ++i )
+    {
+      bool inBox = true;
+      for( int d = 0; d < 3; ++d )
+      {
+        inBox = inBox && points[i][d] >= min[d] && points[i][d] <= max[d];
+      }
+      if( inBox )
+      {
+        expected.push_back( i );
+      }
+    }
+
+    std::vector< localIndex > visited;
+    tree.forEachIntersecting( min, max, [&]( localIndex const i ) { visited.push_back( i ); } );
+    std::sort( visited.begin(), visited.end() );
+
+    EXPECT_EQ( visited, expected );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+
+  geosx::basicSetup( argc, argv );
+
+  int const result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+
+  return result;
+}
@@ -0,0 +1,166 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "meshUtilities/ComputationalGeometry.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <cmath>
+
+using namespace geosx;
+
+namespace
+{
+
+constexpr real64 tolerance = 1e-14;
+
+/// The corners of the unit cube, numbered as the nodes of a C3D8 element of the internal mesh.
+constexpr real64 unitCube[ 8 ][ 3 ] = { { 0, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 }, { 1, 1, 0 },
+                                        { 0, 0, 1 }, { 1, 0, 1 }, { 0, 1, 1 }, { 1, 1, 1 } };
+
+/// The unit tetrahedron.
+constexpr real64 unitTet[ 4 ][ 3 ] = { { 0, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+
+/// Half of the unit cube, numbered as a C3D6 element of the internal mesh: the pairs of nodes are the edges along z.
+constexpr real64 unitWedge[ 6 ][ 3 ] = { { 1, 1, 1 }, { 1, 1, 0 }, { 0, 0, 1 },
+                                         { 0, 0, 0 }, { 0, 1, 1 }, { 0, 1, 0 } };
+
+/// The pyramid on the unit square with its apex above the center, the base numbered around the square.
+constexpr real64 unitPyramid[ 5 ][ 3 ] = { { 0, 0, 0 }, { 1, 0, 0 }, { 1, 1, 0 }, { 0, 1, 0 }, { 0.5, 0.5, 1 } };
+
+/**
+ * @brief Map the vertices of a cell by x -> A x + b, with det( A ) = 3.
+ * @param[in] X the vertices
+ * @param[in] numNodes the number of vertices
+ * @param[out] Y the mapped vertices
+ */
+void affineMap( real64 const X[][ 3 ], localIndex const numNodes, real64 Y[][ 3 ] )
+{
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    Y[ a ][ 0 ] = 2.0 * X[ a ][ 0 ] + 0.7 * X[ a ][ 1 ] - 0.3 * X[ a ][ 2 ] + 1.5;
+    Y[ a ][ 1 ] = 3.0 * X[ a ][ 1 ] + 0.2 * X[ a ][ 2 ] - 4.0;
+    Y[ a ][ 2 ] = 0.5 * X[ a ][ 2 ] + 10.0;
+  }
+}
+
+/**
+ * @brief Check CellCenterAndVolume on a cell whose vertices are stored as the nodes of a mesh, out of order.
+ * @param[in] X the vertices of the cell
+ * @param[in] numNodes the number of vertices
+ * @param[in] volume the expected volume
+ */
+void checkCellCenterAndVolume( real64 const X[][ 3 ], localIndex const numNodes, real64 const volume )
+{
+  // the cell only uses a part of the nodes, numbered backwards
+  localIndex const numMeshNodes = numNodes + 3;
+  array2d< real64, nodes::REFERENCE_POSITION_PERM > nodePositions( numMeshNodes, 3 );
+  nodePositions.setValues< serialPolicy >( -1.0 );
+  array1d< localIndex > elemToNodes( numNodes );
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    elemToNodes[ a ] = numMeshNodes - 1 - a;
+    LvArray::tensorOps::copy< 3 >( nodePositions[ elemToNodes[ a ] ], X[ a ] );
+  }
+
+  real64 expectedCenter[ 3 ] = { 0.0, 0.0, 0.0 };
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    LvArray::tensorOps::add< 3 >( expectedCenter, X[ a ] );
+  }
+  LvArray::tensorOps::scale< 3 >( expectedCenter, 1.0 / numNodes );
+
+  real64 center[ 3 ];
+  real64 const computedVolume = computationalGeometry::CellCenterAndVolume( elemToNodes.toViewConst(),
+                                                                            numNodes,
+                                                                            nodePositions.toViewConst(),
+                                                                            center );
+  EXPECT_NEAR( computedVolume, volume, tolerance * volume );
+  for( int i = 0; i < 3; ++i )
+  {
+    EXPECT_NEAR( center[ i ], expectedCenter[ i ], tolerance * ( 1.0 + std::abs( expectedCenter[ i ] ) ) );
+  }
+}
+
+}
+
+TEST( ComputationalGeometry, hexVolume )
+{
+  EXPECT_NEAR( computationalGeometry::HexVolume( unitCube ), 1.0, tolerance );
+
+  real64 X[ 8 ][ 3 ];
+  affineMap( unitCube, 8, X );
+  EXPECT_NEAR( computationalGeometry::HexVolume( X ), 3.0, 3.0 * tolerance );
+}
+
+TEST( ComputationalGeometry, tetVolume )
+{
+  EXPECT_NEAR( computationalGeometry::TetVolume( unitTet ), 1.0 / 6.0, tolerance );
+
+  real64 X[ 4 ][ 3 ];
+  affineMap( unitTet, 4, X );
+  EXPECT_NEAR( computationalGeometry::TetVolume( X ), 0.5, 0.5 * tolerance );
+
+  // the volume does not depend on the orientation of the vertices
+  EXPECT_NEAR( computationalGeometry::TetVolume( X, 1, 0, 2, 3 ), 0.5, 0.5 * tolerance );
+}
+
+TEST( ComputationalGeometry, wedgeVolume )
+{
+  EXPECT_NEAR( computationalGeometry::WedgeVolume( unitWedge ), 0.5, tolerance );
+
+  real64 X[ 6 ][ 3 ];
+  affineMap( unitWedge, 6, X );
+  EXPECT_NEAR( computationalGeometry::WedgeVolume( X ), 1.5, 1.5 * tolerance );
+}
+
+TEST( ComputationalGeometry, pyramidVolume )
+{
+  EXPECT_NEAR( computationalGeometry::PyramidVolume( unitPyramid ), 1.0 / 3.0, tolerance );
+
+  real64 X[ 5 ][ 3 ];
+  affineMap( unitPyramid, 5, X );
+  EXPECT_NEAR( computationalGeometry::PyramidVolume( X ), 1.0, tolerance );
+}
+
+TEST( ComputationalGeometry, cellCenterAndVolume )
+{
+  checkCellCenterAndVolume( unitCube, 8, 1.0 );
+  checkCellCenterAndVolume( unitTet, 4, 1.0 / 6.0 );
+  checkCellCenterAndVolume( unitWedge, 6, 0.5 );
+  checkCellCenterAndVolume( unitPyramid, 5, 1.0 / 3.0 );
+
+  real64 X[ 8 ][ 3 ];
+  affineMap( unitCube, 8, X );
+  checkCellCenterAndVolume( X, 8, 3.0 );
+  affineMap( unitTet, 4, X );
+  checkCellCenterAndVolume( X, 4, 0.5 );
+  affineMap( unitWedge, 6, X );
+  checkCellCenterAndVolume( X, 6, 1.5 );
+  affineMap( unitPyramid, 5, X );
+  checkCellCenterAndVolume( X, 5, 1.0 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,204 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "meshUtilities/VtuFile.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace geosx;
+
+namespace
+{
+
+/// The coordinates of the points of a single hexahedron
+std::vector< double > const coordinates = { 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0,
+                                            0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1 };
+
+/// The global ids of the points
+std::vector< std::int64_t > const pointIds = { 10, 11, 12, 13, 14, 15, 16, 17 };
+
+/// The connectivity of the hexahedron
+std::vector< std::int64_t > const connectivity = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+std::string encodeBase64( std::string const & bytes )
+{
+  static char const digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string encoded;
+  for( std::size_t i = 0; i < bytes.size(); i += 3 )
+  {
+    unsigned int group = 0;
+    for( std::size_t j = 0; j < 3; ++j )
+    {
+      group = ( group << 8 ) | ( i + j < bytes.size() ? static_cast< unsigned char >( bytes[i + j] ) : 0 );
+    }
+    for( std::size_t j = 0; j < 4; ++j )
+    {
+      encoded += i + j <= bytes.size() ? digits[( group >> ( 18 - 6 * j ) ) & 0x3F] : '=';
+    }
+  }
+  return encoded;
+}
+
+/// The raw bytes of an array, preceded by its size with a header of type HEADER
+template< typename HEADER, typename T >
+std::string rawArray( std::vector< T > const & values, bool const separateHeader, bool const base64 )
+{
+  HEADER const numBytes = static_cast< HEADER >( values.size() * sizeof( T ) );
+  std::string const header( reinterpret_cast< char const * >( &numBytes ), sizeof( HEADER ) );
+  std::string const data( reinterpret_cast< char const * >( values.data() ), numBytes );
+  if( !base64 )
+  {
+    return header + data;
+  }
+  return separateHeader ? encodeBase64( header ) + encodeBase64( data ) : encodeBase64( header + data );
+}
+
+template< typename T >
+std::string asciiArray( std::vector< T > const & values )
+{
+  std::ostringstream stream;
+  for( T const & value : values )
+  {
+    stream << value << ' ';
+  }
+  return stream.str();
+}
+
+/// Write the hexahedron with all the arrays in @p format
+void writeFile( std::string const & fileName, std::string const & format )
+{
+  std::vector< std::int64_t > const offsets = { 8 };
+  std::vector< std::uint8_t > const types = { 12 };
+
+  std::vector< std::string > arrays;
+  std::string appended;
+  auto const addArray = [&]( std::string const & ascii, std::string const & raw, std::string const & base64 )
+  {
+    if( format == "ascii" )
+    {
+      arrays.emplace_back( "format=\"ascii\">" + ascii );
+    }
+    else if( format == "binary" )
+    {
+      arrays.emplace_back( "format=\"binary\">" + base64 );
+    }
+    else
+    {
+      arrays.emplace_back( "format=\"appended\" offset=\"" + std::to_string( appended.size() ) + "\">" );
+      appended += format == "raw" ? raw : base64;
+    }
+  };
+  addArray( asciiArray( pointIds ), rawArray< std::uint64_t >( pointIds, false, false ), rawArray< std::uint64_t >( pointIds, true, true ) );
+  addArray( asciiArray( coordinates ), rawArray< std::uint64_t >( coordinates, false, false ), rawArray< std::uint64_t >( coordinates, true, true ) );
+  addArray( asciiArray( connectivity ), rawArray< std::uint64_t >( connectivity, false, false ), rawArray< std::uint64_t >( connectivity, true, true ) );
+  addArray( asciiArray( offsets ), rawArray< std::uint64_t >( offsets, false, false ), rawArray< std::uint64_t >( offsets, false, true ) );
+  addArray( "12", rawArray< std::uint64_t >( types, false, false ), rawArray< std::uint64_t >( types, false, true ) );
+
+  std::ofstream file( fileName, std::ios::binary );
+  file << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\">\n"
+       << "  <UnstructuredGrid>\n"
+       << "    <Piece NumberOfPoints=\"8\" NumberOfCells=\"1\">\n"
+       << "      <PointData>\n"
+       << "        <DataArray type=\"Int64\" Name=\"GlobalPointIds\" " << arrays[0] << "</DataArray>\n"
+       << "      </PointData>\n"
+       << "      <Points>\n"
+       << "        <DataArray type=\"Float64\" NumberOfComponents=\"3\" " << arrays[1] << "</DataArray>\n"
+       << "      </Points>\n"
+       << "      <Cells>\n"
+       << "        <DataArray type=\"Int64\" Name=\"connectivity\" " << arrays[2] << "</DataArray>\n"
+       << "        <DataArray type=\"Int64\" Name=\"offsets\" " << arrays[3] << "</DataArray>\n"
+       << "        <DataArray type=\"UInt8\" Name=\"types\" " << arrays[4] << "</DataArray>\n"
+       << "      </Cells>\n"
+       << "    </Piece>\n"
+       << "  </UnstructuredGrid>\n";
+  if( !appended.empty() )
+  {
+    file << "  <AppendedData encoding=\"" << format << "\">\n   _" << appended << "\n  </AppendedData>\n";
+  }
+  file << "</VTKFile>\n";
+}
+
+}
+
+class VtuFileTest : public ::testing::TestWithParam< std::string >
+{};
+
+TEST_P( VtuFileTest, readHexahedron )
+{
+  std::string const fileName = "testVtuFile_" + GetParam() + ".vtu";
+  writeFile( fileName, GetParam() );
+
+  VtuFile const vtuFile( fileName );
+  ASSERT_EQ( vtuFile.numPoints(), 8 );
+  ASSERT_EQ( vtuFile.numCells(), 1 );
+  EXPECT_TRUE( vtuFile.hasPointData( "GlobalPointIds" ) );
+  EXPECT_FALSE( vtuFile.hasCellData( "GlobalCellIds" ) );
+
+  array1d< real64 > points;
+  vtuFile.readPoints( points );
+  ASSERT_EQ( points.size(), 24 );
+  for( localIndex i = 0; i < 24; ++i )
+  {
+    EXPECT_EQ( points[i], coordinates[i] );
+  }
+
+  array1d< globalIndex > globalIds;
+  vtuFile.readPointData( "GlobalPointIds", globalIds );
+  ASSERT_EQ( globalIds.size(), 8 );
+  for( localIndex i = 0; i < 8; ++i )
+  {
+    EXPECT_EQ( globalIds[i], pointIds[i] );
+  }
+
+  array1d< localIndex > cellNodes;
+  array1d< localIndex > offsets;
+  array1d< integer > types;
+  vtuFile.readCells( cellNodes, offsets, types );
+  ASSERT_EQ( cellNodes.size(), 8 );
+  for( localIndex i = 0; i < 8; ++i )
+  {
+    EXPECT_EQ( cellNodes[i], connectivity[i] );
+  }
+  ASSERT_EQ( offsets.size(), 1 );
+  EXPECT_EQ( offsets[0], 8 );
+  ASSERT_EQ( types.size(), 1 );
+  EXPECT_EQ( types[0], 12 );
+
+  std::remove( fileName.c_str() );
+}
+
+INSTANTIATE_TEST_CASE_P( VtuFileFormats, VtuFileTest, ::testing::Values( "ascii", "binary", "raw", "base64" ) );
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+
+  geosx::basicSetup( argc, argv );
+
+  int const result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+
+  return result;
+}
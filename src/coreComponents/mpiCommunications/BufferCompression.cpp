@@ -0,0 +1,313 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BufferCompression.cpp
+ */
+
+#include "mpiCommunications/BufferCompression.hpp"
+
+#include "common/Logger.hpp"
+#include "common/TimingMacros.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace geosx
+{
+
+namespace bufferCompression
+{
+
+namespace
+{
+
+using byte = unsigned char;
+
+/// How the payload of a compressed buffer is stored
+enum class Method : byte
+{
+  Raw = 0,    ///< Plain copy of the original buffer
+  DeltaLZ = 1 ///< Delta-encoded 8-byte words, compressed with the LZ codec
+};
+
+/// Size of the header: the size of the original buffer and the method
+constexpr localIndex headerSize = sizeof( localIndex ) + 1;
+
+/// Size of the words of the delta encoding
+constexpr localIndex wordSize = sizeof( std::uint64_t );
+
+/// Shortest back-reference
+constexpr localIndex minMatch = 4;
+
+/// Farthest back-reference, the offsets are stored on two bytes
+constexpr localIndex maxOffset = 65535;
+
+/// Log2 of the number of entries of the hash table
+constexpr int hashBits = 14;
+
+/// Largest possible size of the LZ encoding of @p size bytes
+localIndex compressBound( localIndex const size )
+{
+  return size + size / 255 + 16;
+}
+
+std::uint32_t read32( byte const * const ptr )
+{
+  std::uint32_t value;
+  std::memcpy( &value, ptr, sizeof( value ) );
+  return value;
+}
+
+std::uint32_t hashSequence( std::uint32_t const sequence )
+{
+  return ( sequence * 2654435761u ) >> ( 32 - hashBits );
+}
+
+/// Replace each 8-byte word by its difference with the previous one, the trailing bytes are copied as is
+void deltaEncode( byte const * const input, localIndex const size, byte * const output )
+{
+  localIndex const numWords = size / wordSize;
+  std::uint64_t previous = 0;
+  for( localIndex i = 0; i < numWords; ++i )
+  {
+    std::uint64_t word;
+    std::memcpy( &word, input + i * wordSize, wordSize );
+    std::uint64_t const delta = word - previous;
+    std::memcpy( output + i * wordSize, &delta, wordSize );
+    previous = word;
+  }
+  std::copy( input + numWords * wordSize, input + size, output + numWords * wordSize );
+}
+
+/// Inverse of deltaEncode, in place
+void deltaDecode( byte * const data, localIndex const size )
+{
+  localIndex const numWords = size / wordSize;
+  std::uint64_t previous = 0;
+  for( localIndex i = 0; i < numWords; ++i )
+  {
+    std::uint64_t delta;
+    std::memcpy( &delta, data + i * wordSize, wordSize );
+    previous += delta;
+    std::memcpy( data + i * wordSize, &previous, wordSize );
+  }
+}
+
+/// Write the part of a length that does not fit in its nibble, as a sequence of bytes ended by one below 255
+byte * writeLength( byte * output, localIndex length )
+{
+  while( length >= 255 )
+  {
+    *output++ = 255;
+    length -= 255;
+  }
+  *output++ = static_cast< byte >( length );
+  return output;
+}
+
+/// Write a sequence: a run of literals followed, unless it is the last sequence, by a back-reference
+byte * writeSequence( byte * output,
+                      byte const * const literals,
+                      localIndex const numLiterals,
+                      localIndex const offset,
+                      localIndex const matchLength )
+{
+  byte * const token = output++;
+  *token = static_cast< byte >( std::min( numLiterals, localIndex( 15 ) ) << 4 );
+  if( numLiterals >= 15 )
+  {
+    output = writeLength( output, numLiterals - 15 );
+  }
+  output = std::copy( literals, literals + numLiterals, output );
+
+  if( matchLength > 0 )
+  {
+    *output++ = static_cast< byte >( offset & 0xff );
+    *output++ = static_cast< byte >( ( offset >> 8 ) & 0xff );
+    localIndex const extraLength = matchLength - minMatch;
+    *token |= static_cast< byte >( std::min( extraLength, localIndex( 15 ) ) );
+    if( extraLength >= 15 )
+    {
+      output = writeLength( output, extraLength - 15 );
+    }
+  }
+  return output;
+}
+
+/// LZ-compress @p size bytes, @p output must hold compressBound( size ) bytes
+localIndex lzCompress( byte const * const input, localIndex const size, byte * const output )
+{
+  std::vector< localIndex > table( localIndex( 1 ) << hashBits, -1 );
+
+  byte * op = output;
+  localIndex anchor = 0;
+  localIndex pos = 0;
+  while( pos + minMatch <= size )
+  {
+    std::uint32_t const sequence = read32( input + pos );
+    std::uint32_t const hash = hashSequence( sequence );
+    localIndex const candidate = table[hash];
+    table[hash] = pos;
+
+    if( candidate < 0 || pos - candidate > maxOffset || read32( input + candidate ) != sequence )
+    {
+      ++pos;
+      continue;
+    }
+
+    localIndex matchLength = minMatch;
+    while( pos + matchLength < size && input[candidate + matchLength] == input[pos + matchLength] )
+    {
+      ++matchLength;
+    }
+
+    op = writeSequence( op, input + anchor, pos - anchor, pos - candidate, matchLength );
+    pos += matchLength;
+    anchor = pos;
+  }
+
+  // the last sequence only holds the remaining literals
+  op = writeSequence( op, input + anchor, size - anchor, 0, 0 );
+  return op - output;
+}
+
+/// Read the part of a length that did not fit in its nibble
+localIndex readLength( byte const * & input, byte const * const end )
+{
+  localIndex length = 0;
+  byte value;
+  do
+  {
+    GEOSX_ERROR_IF( input >= end, "Corrupted compressed buffer" );
+    value = *input++;
+    length += value;
+  } while( value == 255 );
+  return length;
+}
+
+/// LZ-decompress @p size bytes into @p output which holds @p capacity bytes, return the decompressed size
+localIndex lzDecompress( byte const * input, localIndex const size, byte * const output, localIndex const capacity )
+{
+  byte const * const end = input + size;
+  byte * op = output;
+  byte * const outputEnd = output + capacity;
+
+  while( input < end )
+  {
+    byte const token = *input++;
+
+    localIndex numLiterals = token >> 4;
+    if( numLiterals == 15 )
+    {
+      numLiterals += readLength( input, end );
+    }
+    GEOSX_ERROR_IF( end - input < numLiterals || outputEnd - op < numLiterals, "Corrupted compressed buffer" );
+    op = std::copy( input, input + numLiterals, op );
+    input += numLiterals;
+
+    if( input == end )
+    {
+      break;
+    }
+
+    GEOSX_ERROR_IF( end - input < 2, "Corrupted compressed buffer" );
+    localIndex const offset = input[0] | ( localIndex( input[1] ) << 8 );
+    input += 2;
+
+    localIndex matchLength = token & 15;
+    if( matchLength == 15 )
+    {
+      matchLength += readLength( input, end );
+    }
+    matchLength += minMatch;
+
+    GEOSX_ERROR_IF( offset == 0 || offset > op - output || outputEnd - op < matchLength, "Corrupted compressed buffer" );
+
+    // the reference may overlap the bytes being written, so copy one byte at a time
+    byte const * match = op - offset;
+    for( localIndex i = 0; i < matchLength; ++i )
+    {
+      *op++ = *match++;
+    }
+  }
+
+  return op - output;
+}
+
+}
+
+void compress( buffer_unit_type const * const data,
+               localIndex const size,
+               buffer_type & compressed )
+{
+  GEOSX_MARK_FUNCTION;
+
+  byte const * const input = reinterpret_cast< byte const * >( data );
+
+  std::vector< byte > delta( size );
+  deltaEncode( input, size, delta.data() );
+
+  compressed.resize( headerSize + compressBound( size ) );
+  byte * const output = reinterpret_cast< byte * >( compressed.data() );
+  std::memcpy( output, &size, sizeof( localIndex ) );
+
+  localIndex const compressedSize = lzCompress( delta.data(), size, output + headerSize );
+  if( compressedSize < size )
+  {
+    output[sizeof( localIndex )] = static_cast< byte >( Method::DeltaLZ );
+    compressed.resize( headerSize + compressedSize );
+  }
+  else
+  {
+    output[sizeof( localIndex )] = static_cast< byte >( Method::Raw );
+    std::copy( input, input + size, output + headerSize );
+    compressed.resize( headerSize + size );
+  }
+}
+
+void decompress( buffer_unit_type const * const data,
+                 localIndex const size,
+                 buffer_type & decompressed )
+{
+  GEOSX_MARK_FUNCTION;
+
+  GEOSX_ERROR_IF_LT_MSG( size, headerSize, "Corrupted compressed buffer" );
+  byte const * const input = reinterpret_cast< byte const * >( data );
+
+  localIndex originalSize;
+  std::memcpy( &originalSize, input, sizeof( localIndex ) );
+  Method const method = static_cast< Method >( input[sizeof( localIndex )] );
+
+  decompressed.resize( originalSize );
+  byte * const output = reinterpret_cast< byte * >( decompressed.data() );
+
+  if( method == Method::Raw )
+  {
+    GEOSX_ERROR_IF_NE_MSG( size - headerSize, originalSize, "Corrupted compressed buffer" );
+    std::copy( input + headerSize, input + size, output );
+  }
+  else
+  {
+    GEOSX_ERROR_IF( method != Method::DeltaLZ, "Corrupted compressed buffer" );
+    localIndex const decompressedSize = lzDecompress( input + headerSize, size - headerSize, output, originalSize );
+    GEOSX_ERROR_IF_NE_MSG( decompressedSize, originalSize, "Corrupted compressed buffer" );
+    deltaDecode( output, originalSize );
+  }
+}
+
+} /* namespace bufferCompression */
+
+} /* namespace geosx */
@@ -0,0 +1,67 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file BufferCompression.hpp
+ */
+
+#ifndef GEOSX_MPICOMMUNICATIONS_BUFFERCOMPRESSION_HPP_
+#define GEOSX_MPICOMMUNICATIONS_BUFFERCOMPRESSION_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief Lightweight lossless compression of packed communication buffers.
+ *
+ * The packed buffers of the ghost setup are mostly made of 64-bit integers (global indices, sizes, and the
+ * entries of the maps), which are sorted or close to each other. The buffer is first delta-encoded as a
+ * sequence of 8-byte words, which turns runs of sorted indices into runs of small, repeated differences, and
+ * then compressed with a byte-oriented LZ77 codec in the spirit of LZ4 (literal runs and back-references of
+ * at most 64KB, found with a hash table of 4-byte sequences).
+ *
+ * A compressed buffer starts with the size of the original buffer and the method used, and falls back to
+ * a plain copy when compression does not make the buffer smaller, so it is never more than a few bytes
+ * larger than the original.
+ */
+namespace bufferCompression
+{
+
+/**
+ * @brief Compress a buffer.
+ * @param data the buffer to compress
+ * @param size the size of @p data in bytes
+ * @param compressed the compressed buffer, resized to its size
+ */
+void compress( buffer_unit_type const * const data,
+               localIndex const size,
+               buffer_type & compressed );
+
+/**
+ * @brief Decompress a buffer compressed with compress().
+ * @param data the compressed buffer
+ * @param size the size of @p data in bytes
+ * @param decompressed the original buffer, resized to its size
+ */
+void decompress( buffer_unit_type const * const data,
+                 localIndex const size,
+                 buffer_type & decompressed );
+
+} /* namespace bufferCompression */
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MPICOMMUNICATIONS_BUFFERCOMPRESSION_HPP_ */
@@ -0,0 +1,280 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CommunicationStatistics.cpp
+ */
+
+#include "mpiCommunications/CommunicationStatistics.hpp"
+
+#include "common/Logger.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#ifdef GEOSX_USE_CALIPER
+#include <caliper/cali.h>
+#endif
+
+#include <array>
+#include <iomanip>
+#include <sstream>
+
+namespace geosx
+{
+
+namespace
+{
+
+/// What was exchanged with one neighbor
+struct NeighborRecord
+{
+  globalIndex messagesSent = 0;
+  globalIndex bytesSent = 0;
+  globalIndex messagesReceived = 0;
+  globalIndex bytesReceived = 0;
+  real64 latency = 0.0;
+  globalIndex numLatencies = 0;
+};
+
+/// What was exchanged with all the neighbors for one purpose
+struct PurposeRecord
+{
+  std::map< int, NeighborRecord > neighbors;
+  real64 waitTime = 0.0;
+};
+
+struct Records
+{
+  bool enabled = false;
+  CommunicationStatistics::Purpose current = CommunicationStatistics::Purpose::Other;
+  std::array< PurposeRecord, CommunicationStatistics::numPurposes > purposes;
+};
+
+Records & records()
+{
+  static Records rec;
+  return rec;
+}
+
+NeighborRecord & neighborRecord( int const neighborRank )
+{
+  Records & rec = records();
+  return rec.purposes[ static_cast< integer >( rec.current ) ].neighbors[ neighborRank ];
+}
+
+}
+
+char const * CommunicationStatistics::purposeName( Purpose const purpose )
+{
+  switch( purpose )
+  {
+    case Purpose::GhostSetup: return "ghost setup";
+    case Purpose::FieldSync: return "field sync";
+    case Purpose::FractureUpdate: return "fracture update";
+    case Purpose::Other: return "other";
+  }
+  return "";
+}
+
+void CommunicationStatistics::setEnabled( bool const enabled )
+{
+  records().enabled = enabled;
+}
+
+bool CommunicationStatistics::isEnabled()
+{
+  return records().enabled;
+}
+
+CommunicationStatistics::Purpose CommunicationStatistics::currentPurpose()
+{
+  return records().current;
+}
+
+void CommunicationStatistics::recordSend( int const neighborRank, std::size_t const bytes )
+{
+  if( isEnabled() )
+  {
+    NeighborRecord & record = neighborRecord( neighborRank );
+    ++record.messagesSent;
+    record.bytesSent += LvArray::integerConversion< globalIndex >( bytes );
+  }
+}
+
+void CommunicationStatistics::recordReceive( int const neighborRank, std::size_t const bytes )
+{
+  if( isEnabled() )
+  {
+    NeighborRecord & record = neighborRecord( neighborRank );
+    ++record.messagesReceived;
+    record.bytesReceived += LvArray::integerConversion< globalIndex >( bytes );
+  }
+}
+
+void CommunicationStatistics::recordLatency( int const neighborRank, real64 const seconds )
+{
+  if( isEnabled() )
+  {
+    NeighborRecord & record = neighborRecord( neighborRank );
+    record.latency += seconds;
+    ++record.numLatencies;
+  }
+}
+
+void CommunicationStatistics::recordWait( real64 const seconds )
+{
+  if( isEnabled() )
+  {
+    Records & rec = records();
+    rec.purposes[ static_cast< integer >( rec.current ) ].waitTime += seconds;
+  }
+}
+
+void CommunicationStatistics::printSummary()
+{
+  if( !isEnabled() )
+  {
+    return;
+  }
+
+  int const numRanks = MpiWrapper::Comm_size();
+
+  GEOSX_LOG_RANK_0( "\nCommunication statistics over " << numRanks << " ranks:" );
+  GEOSX_LOG_RANK_0( std::setw( 16 ) << "purpose" << " | " <<
+                    std::setw( 12 ) << "messages" << " | " <<
+                    std::setw( 14 ) << "bytes sent" << " | " <<
+                    std::setw( 14 ) << "max rank bytes" << " | " <<
+                    std::setw( 12 ) << "latency (s)" << " | " <<
+                    std::setw( 12 ) << "avg wait (s)" << " | " <<
+                    std::setw( 12 ) << "max wait (s)" << " | " <<
+                    "heaviest pair (bytes sent)" );
+
+  for( integer p = 0; p < numPurposes; ++p )
+  {
+    PurposeRecord const & record = records().purposes[p];
+
+    globalIndex messages = 0;
+    globalIndex bytesSent = 0;
+    real64 latency = 0.0;
+    globalIndex numLatencies = 0;
+    globalIndex heaviestBytes = 0;
+    int heaviestNeighbor = -1;
+    for( std::pair< int const, NeighborRecord > const & entry : record.neighbors )
+    {
+      messages += entry.second.messagesSent;
+      bytesSent += entry.second.bytesSent;
+      latency += entry.second.latency;
+      numLatencies += entry.second.numLatencies;
+      if( entry.second.bytesSent > heaviestBytes )
+      {
+        heaviestBytes = entry.second.bytesSent;
+        heaviestNeighbor = entry.first;
+      }
+    }
+
+    globalIndex const totalMessages = MpiWrapper::Sum( messages );
+    globalIndex const totalBytes = MpiWrapper::Sum( bytesSent );
+    globalIndex const maxBytes = MpiWrapper::Max( bytesSent );
+    real64 const totalLatency = MpiWrapper::Sum( latency );
+    globalIndex const totalNumLatencies = MpiWrapper::Sum( numLatencies );
+    real64 const totalWait = MpiWrapper::Sum( record.waitTime );
+    real64 const maxWait = MpiWrapper::Max( record.waitTime );
+
+    // find out which rank/neighbor pair exchanged the most data
+    array1d< globalIndex > allHeaviestBytes;
+    array1d< int > allHeaviestNeighbors;
+    MpiWrapper::allGather( heaviestBytes, allHeaviestBytes );
+    MpiWrapper::allGather( heaviestNeighbor, allHeaviestNeighbors );
+
+    if( totalMessages == 0 && totalWait <= 0.0 )
+    {
+      continue;
+    }
+
+    int heaviestRank = 0;
+    for( int rank = 1; rank < numRanks; ++rank )
+    {
+      if( allHeaviestBytes[rank] > allHeaviestBytes[heaviestRank] )
+      {
+        heaviestRank = rank;
+      }
+    }
+
+    std::ostringstream heaviestPair;
+    if( allHeaviestNeighbors[heaviestRank] >= 0 )
+    {
+      heaviestPair << heaviestRank << " -> " << allHeaviestNeighbors[heaviestRank] <<
+        " (" << allHeaviestBytes[heaviestRank] << ")";
+    }
+
+    GEOSX_LOG_RANK_0( std::setw( 16 ) << purposeName( static_cast< Purpose >( p ) ) << " | " <<
+                      std::setw( 12 ) << totalMessages << " | " <<
+                      std::setw( 14 ) << totalBytes << " | " <<
+                      std::setw( 14 ) << maxBytes << " | " <<
+                      std::setw( 12 ) << std::setprecision( 4 ) <<
+                      ( totalNumLatencies > 0 ? totalLatency / totalNumLatencies : 0.0 ) << " | " <<
+                      std::setw( 12 ) << totalWait / numRanks << " | " <<
+                      std::setw( 12 ) << maxWait << " | " <<
+                      heaviestPair.str() );
+  }
+}
+
+CommunicationStatistics::ScopedPurpose::ScopedPurpose( Purpose const purpose ):
+  m_isOutermost( false )
+{
+  Records & rec = records();
+  if( rec.enabled && rec.current == Purpose::Other )
+  {
+    m_isOutermost = true;
+    rec.current = purpose;
+#ifdef GEOSX_USE_CALIPER
+    cali_begin_string_byname( "communication", purposeName( purpose ) );
+#endif
+  }
+}
+
+CommunicationStatistics::ScopedPurpose::~ScopedPurpose()
+{
+  if( m_isOutermost )
+  {
+    records().current = Purpose::Other;
+#ifdef GEOSX_USE_CALIPER
+    cali_end_byname( "communication" );
+#endif
+  }
+}
+
+CommunicationStatistics::ScopedWait::ScopedWait():
+  m_start( -1.0 )
+{
+  if( isEnabled() )
+  {
+#ifdef GEOSX_USE_CALIPER
+    cali_begin_region( "communicationWait" );
+#endif
+    m_start = MpiWrapper::Wtime();
+  }
+}
+
+CommunicationStatistics::ScopedWait::~ScopedWait()
+{
+  if( m_start >= 0.0 )
+  {
+    recordWait( MpiWrapper::Wtime() - m_start );
+#ifdef GEOSX_USE_CALIPER
+    cali_end_region( "communicationWait" );
+#endif
+  }
+}
+
+} /* namespace geosx */
@@ -0,0 +1,176 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CommunicationStatistics.hpp
+ */
+
+#ifndef GEOSX_MPICOMMUNICATIONS_COMMUNICATIONSTATISTICS_HPP_
+#define GEOSX_MPICOMMUNICATIONS_COMMUNICATIONSTATISTICS_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+/**
+ * @class CommunicationStatistics
+ *
+ * Records the communications of the rank with each of its neighbors: the number of messages and bytes sent
+ * and received, the latency between posting a message and completing its receive, and the time spent blocked
+ * waiting for messages. The records are grouped by purpose (ghost setup, field synchronization, fracture
+ * update), which is set for a scope with a ScopedPurpose. Each purpose scope is also exposed as a Caliper
+ * annotation named "communication".
+ *
+ * Nothing is recorded unless the statistics are enabled (--communication-statistics), in which case a summary
+ * table is printed at the end of the run.
+ */
+class CommunicationStatistics
+{
+public:
+
+  /**
+   * @enum Purpose
+   * What a communication is used for.
+   */
+  enum class Purpose : integer
+  {
+    GhostSetup,     ///< Ghost discovery and global numbering
+    FieldSync,      ///< Synchronization of the ghost values of fields
+    FractureUpdate, ///< Topology changes and synchronizations of the surface generator
+    Other           ///< Any other communication
+  };
+
+  /// The number of purposes
+  static constexpr integer numPurposes = 4;
+
+  /**
+   * @brief Get the name of a purpose.
+   * @param purpose the purpose
+   * @return the name
+   */
+  static char const * purposeName( Purpose const purpose );
+
+  /**
+   * @brief Enable or disable the recording.
+   * @param enabled whether to record the communications
+   */
+  static void setEnabled( bool const enabled );
+
+  /**
+   * @brief Get whether the communications are recorded.
+   * @return true if the communications are recorded
+   */
+  static bool isEnabled();
+
+  /**
+   * @brief Get the purpose of the communications currently taking place.
+   * @return the purpose
+   */
+  static Purpose currentPurpose();
+
+  /**
+   * @brief Record a message sent to a neighbor.
+   * @param neighborRank the rank of the neighbor
+   * @param bytes the size of the message
+   */
+  static void recordSend( int const neighborRank, std::size_t const bytes );
+
+  /**
+   * @brief Record a message received from a neighbor.
+   * @param neighborRank the rank of the neighbor
+   * @param bytes the size of the message
+   */
+  static void recordReceive( int const neighborRank, std::size_t const bytes );
+
+  /**
+   * @brief Record the time between posting the messages with a neighbor and completing their receive.
+   * @param neighborRank the rank of the neighbor
+   * @param seconds the latency
+   */
+  static void recordLatency( int const neighborRank, real64 const seconds );
+
+  /**
+   * @brief Record time spent blocked in a MPI wait.
+   * @param seconds the time spent waiting
+   */
+  static void recordWait( real64 const seconds );
+
+  /**
+   * @brief Print the summary table of all the ranks on rank 0, collective over MPI_COMM_GEOSX.
+   */
+  static void printSummary();
+
+  /**
+   * @class ScopedPurpose
+   * Sets the purpose of the communications for its lifetime. Nested scopes keep the purpose of the outermost
+   * one, so that a field synchronization done during a fracture update counts as a fracture update.
+   */
+  class ScopedPurpose
+  {
+public:
+
+    /**
+     * @brief Constructor.
+     * @param purpose the purpose of the communications of the scope
+     */
+    explicit ScopedPurpose( Purpose const purpose );
+
+    /**
+     * @brief Destructor, restores the previous purpose.
+     */
+    ~ScopedPurpose();
+
+    ScopedPurpose( ScopedPurpose const & ) = delete;
+    ScopedPurpose( ScopedPurpose && ) = delete;
+    ScopedPurpose & operator=( ScopedPurpose const & ) = delete;
+    ScopedPurpose & operator=( ScopedPurpose && ) = delete;
+
+private:
+    /// Whether this scope set the purpose
+    bool m_isOutermost;
+  };
+
+  /**
+   * @class ScopedWait
+   * Records the lifetime of the object as time spent waiting.
+   */
+  class ScopedWait
+  {
+public:
+
+    /**
+     * @brief Constructor, starts the timer if the statistics are enabled.
+     */
+    ScopedWait();
+
+    /**
+     * @brief Destructor, records the elapsed time.
+     */
+    ~ScopedWait();
+
+    ScopedWait( ScopedWait const & ) = delete;
+    ScopedWait( ScopedWait && ) = delete;
+    ScopedWait & operator=( ScopedWait const & ) = delete;
+    ScopedWait & operator=( ScopedWait && ) = delete;
+
+private:
+    /// The time the wait started, negative if the statistics are disabled
+    real64 m_start;
+  };
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MPICOMMUNICATIONS_COMMUNICATIONSTATISTICS_HPP_ */
@@ -21,7 +21,11 @@
 
 
 #include "common/TimingMacros.hpp"
+#include "mpiCommunications/CommunicationStatistics.hpp"
+#include "mpiCommunications/GraphCommunicator.hpp"
+#include "mpiCommunications/LoadBalanceStatistics.hpp"
 #include "mpiCommunications/NeighborCommunicator.hpp"
+#include "mpiCommunications/SharedMemoryCommunicator.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/ObjectManagerBase.hpp"
 
@@ -46,25 +50,26 @@ CommunicationTools::~CommunicationTools()
 std::set< int > & CommunicationTools::getFreeCommIDs()
 {
   static std::set< int > commIDs;
-  static bool isInitialized = false;
-
-  if( !isInitialized )
-  {
-    for( int a = 0; a < NeighborCommunicator::maxComm; ++a )
-    {
-      commIDs.insert( a );
-    }
-    isInitialized = true;
-  }
-
   return commIDs;
 }
 
+int & CommunicationTools::getNumCommIDs()
+{
+  static int numCommIDs = 0;
+  return numCommIDs;
+}
 
 int CommunicationTools::reserveCommID()
 {
   std::set< int > & commIDs = getFreeCommIDs();
 
+  // the pool grows when all the IDs are in use, and released IDs are recycled lowest first so that
+  // all the ranks agree on the ID of a communication as long as they reserve and release in the same order
+  if( commIDs.empty() )
+  {
+    return getNumCommIDs()++;
+  }
+
   int rval = *( commIDs.begin() );
   commIDs.erase( rval );
   return rval;
@@ -74,6 +79,10 @@ void CommunicationTools::releaseCommID( int & ID )
 {
   std::set< int > & commIDs = getFreeCommIDs();
 
+  if( ID < 0 || ID >= getNumCommIDs() )
+  {
+    GEOSX_ERROR( "Attempting to release commID " << ID << " that was never reserved" );
+  }
   if( commIDs.count( ID ) > 0 )
   {
     GEOSX_ERROR( "Attempting to release commID that is already free" );
@@ -82,11 +91,157 @@ void CommunicationTools::releaseCommID( int & ID )
   ID = -1;
 }
 
+namespace
+{
+
+bool & useNeighborhoodCollectives()
+{
+  static bool useCollectives = false;
+  return useCollectives;
+}
+
+std::unique_ptr< GraphCommunicator > & graphCommunicator()
+{
+  static std::unique_ptr< GraphCommunicator > graph;
+  return graph;
+}
+
+bool & compressGhostBuffers()
+{
+  static bool compress = false;
+  return compress;
+}
+
+bool & useSharedMemoryHalo()
+{
+  static bool useSharedMemory = false;
+  return useSharedMemory;
+}
+
+std::unique_ptr< SharedMemoryCommunicator > & sharedMemoryCommunicator()
+{
+  static std::unique_ptr< SharedMemoryCommunicator > sharedMemory;
+  return sharedMemory;
+}
+
+/// The synchronizations queued while a DeferredSynchronization is alive
+struct DeferredSynchronizations
+{
+  /// Fields to synchronize for one mesh level, set of neighbors and packing location
+  struct Entry
+  {
+    MeshLevel * mesh;
+    std::vector< NeighborCommunicator > * neighbors;
+    bool onDevice;
+    std::map< string, string_array > fieldNames;
+  };
+
+  int depth = 0;
+  std::vector< Entry > entries;
+  std::vector< std::function< void() > > callbacks;
+};
+
+DeferredSynchronizations & deferredSynchronizations()
+{
+  static DeferredSynchronizations deferred;
+  return deferred;
+}
+
+void mergeFieldNames( std::map< string, string_array > const & source,
+                      std::map< string, string_array > & target )
+{
+  for( std::pair< string const, string_array > const & entry : source )
+  {
+    string_array & targetNames = target[entry.first];
+    for( string const & name : entry.second )
+    {
+      if( std::find( targetNames.begin(), targetNames.end(), name ) == targetNames.end() )
+      {
+        targetNames.emplace_back( name );
+      }
+    }
+  }
+}
+
+}
+
+void CommunicationTools::setUseNeighborhoodCollectives( bool const useCollectives )
+{
+  useNeighborhoodCollectives() = useCollectives;
+}
+
+bool CommunicationTools::getUseNeighborhoodCollectives()
+{
+  return useNeighborhoodCollectives();
+}
+
+void CommunicationTools::buildGraphCommunicator( std::vector< NeighborCommunicator > const & neighbors )
+{
+  graphCommunicator().reset();
+  graphCommunicator() = std::make_unique< GraphCommunicator >( neighbors );
+}
+
+GraphCommunicator & CommunicationTools::getGraphCommunicator( std::vector< NeighborCommunicator > const & neighbors )
+{
+  std::unique_ptr< GraphCommunicator > & graph = graphCommunicator();
+  GEOSX_ERROR_IF( graph == nullptr || !graph->matches( neighbors ),
+                  "The graph communicator has not been built for this neighbor list. "
+                  "It must be (re)built collectively with CommunicationTools::buildGraphCommunicator()." );
+  return *graph;
+}
+
+void CommunicationTools::releaseGraphCommunicator()
+{
+  graphCommunicator().reset();
+}
+
+void CommunicationTools::setCompressGhostBuffers( bool const compress )
+{
+  compressGhostBuffers() = compress;
+}
+
+bool CommunicationTools::getCompressGhostBuffers()
+{
+  return compressGhostBuffers();
+}
+
+void CommunicationTools::setUseSharedMemoryHalo( bool const useSharedMemory )
+{
+  useSharedMemoryHalo() = useSharedMemory;
+}
+
+bool CommunicationTools::getUseSharedMemoryHalo()
+{
+  return useSharedMemoryHalo();
+}
+
+void CommunicationTools::buildSharedMemoryCommunicator( std::vector< NeighborCommunicator > const & neighbors )
+{
+  sharedMemoryCommunicator().reset();
+  sharedMemoryCommunicator() = std::make_unique< SharedMemoryCommunicator >( neighbors );
+}
+
+SharedMemoryCommunicator &
+CommunicationTools::getSharedMemoryCommunicator( std::vector< NeighborCommunicator > const & neighbors )
+{
+  std::unique_ptr< SharedMemoryCommunicator > & sharedMemory = sharedMemoryCommunicator();
+  GEOSX_ERROR_IF( sharedMemory == nullptr || !sharedMemory->matches( neighbors ),
+                  "The shared-memory communicator has not been built for this neighbor list. "
+                  "It must be (re)built collectively with CommunicationTools::buildSharedMemoryCommunicator()." );
+  return *sharedMemory;
+}
+
+void CommunicationTools::releaseSharedMemoryCommunicator()
+{
+  sharedMemoryCommunicator().reset();
+}
+
 void CommunicationTools::AssignGlobalIndices( ObjectManagerBase & object,
                                               ObjectManagerBase const & compositionObject,
                                               std::vector< NeighborCommunicator > & neighbors )
 {
   GEOSX_MARK_FUNCTION;
+  CommunicationStatistics::ScopedPurpose const commPurpose( CommunicationStatistics::Purpose::GhostSetup );
   arrayView1d< integer > const & ghostRank = object.ghostRank();
   ghostRank.setValues< serialPolicy >( -2 );
 
@@ -184,10 +339,13 @@ void CommunicationTools::AssignGlobalIndices( ObjectManagerBase & object,
   for( std::size_t count=0; count<neighbors.size(); ++count )
   {
     int neighborIndex;
-    MpiWrapper::Waitany( commData.size,
-                         commData.mpiSizeRecvBufferRequest.data(),
-                         &neighborIndex,
-                         commData.mpiSizeRecvBufferStatus.data() );
+    {
+      CommunicationStatistics::ScopedWait const wait;
+      MpiWrapper::Waitany( commData.size,
+                           commData.mpiSizeRecvBufferRequest.data(),
+                           &neighborIndex,
+                           commData.mpiSizeRecvBufferStatus.data() );
+    }
 
     NeighborCommunicator & neighbor = neighbors[neighborIndex];
 
@@ -216,12 +374,16 @@ void CommunicationTools::AssignGlobalIndices( ObjectManagerBase & object,
   for( std::size_t count=0; count<neighbors.size(); ++count )
   {
     int neighborIndex;
-    MpiWrapper::Waitany( commData.size,
-                         commData.mpiRecvBufferRequest.data(),
-                         &neighborIndex,
-                         commData.mpiRecvBufferStatus.data() );
+    {
+      CommunicationStatistics::ScopedWait const wait;
+      MpiWrapper::Waitany( commData.size,
+                           commData.mpiRecvBufferRequest.data(),
+                           &neighborIndex,
+                           commData.mpiRecvBufferStatus.data() );
+    }
 
     NeighborCommunicator & neighbor = neighbors[neighborIndex];
+    neighbor.recordCompletion( commData.commID );
 
     globalIndex const * recBuffer = receiveBuffers[neighborIndex].data();
     localIndex recBufferSize = receiveBufferSizes[neighborIndex];
@@ -323,22 +485,13 @@ void CommunicationTools::AssignGlobalIndices( ObjectManagerBase & object,
 }
 
 void CommunicationTools::AssignNewGlobalIndices( ObjectManagerBase & object,
-                                                 std::set< localIndex > const & indexList )
+                                                 FlatSet< localIndex > const & indexList )
 {
-  // TODO: This should be done with a prefix sum!
-  int const thisRank = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
-  int const commSize = MpiWrapper::Comm_size( MPI_COMM_GEOSX );
-  localIndex numberOfNewObjectsHere = indexList.size();
-  localIndex_array numberOfNewObjects( commSize );
-  localIndex_array glocalIndexOffset( commSize );
-  MpiWrapper::allGather( numberOfNewObjectsHere, numberOfNewObjects );
-
+  GEOSX_MARK_FUNCTION;
 
-  glocalIndexOffset[0] = 0;
-  for( int rank = 1; rank < commSize; ++rank )
-  {
-    glocalIndexOffset[rank] = glocalIndexOffset[rank - 1] + numberOfNewObjects[rank - 1];
-  }
+  // the new objects of this rank are numbered after the new objects of all the lower ranks
+  localIndex const numberOfNewObjectsHere = indexList.size();
+  globalIndex const globalIndexOffset = MpiWrapper::PrefixSum< globalIndex >( numberOfNewObjectsHere );
 
   arrayView1d< globalIndex > const & localToGlobal = object.localToGlobalMap();
 
@@ -349,7 +502,7 @@ void CommunicationTools::AssignNewGlobalIndices( ObjectManagerBase & object,
                     "Local object " << newLocalIndex << " should be new but already has a global index "
                                     << localToGlobal[newLocalIndex] );
 
-    localToGlobal[newLocalIndex] = object.maxGlobalIndex() + glocalIndexOffset[thisRank] + nIndicesAssigned + 1;
+    localToGlobal[newLocalIndex] = object.maxGlobalIndex() + globalIndexOffset + nIndicesAssigned + 1;
     object.updateGlobalToLocalMap( newLocalIndex );
 
     nIndicesAssigned += 1;
@@ -361,37 +514,27 @@ void CommunicationTools::AssignNewGlobalIndices( ObjectManagerBase & object,
 void
 CommunicationTools::
   AssignNewGlobalIndices( ElementRegionManager & elementManager,
-                          std::map< std::pair< localIndex, localIndex >, std::set< localIndex > > const & newElems )
+                          std::map< std::pair< localIndex, localIndex >, FlatSet< localIndex > > const & newElems )
 {
-  // TODO: This should be done with a prefix sum!
-  int const thisRank = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
-  int const commSize = MpiWrapper::Comm_size( MPI_COMM_GEOSX );
+  GEOSX_MARK_FUNCTION;
 
   localIndex numberOfNewObjectsHere = 0;
 
   for( auto const & iter : newElems )
   {
-    std::set< localIndex > const & indexList = iter.second;
+    FlatSet< localIndex > const & indexList = iter.second;
     numberOfNewObjectsHere += indexList.size();
   }
 
-  localIndex_array numberOfNewObjects( commSize );
-  localIndex_array glocalIndexOffset( commSize );
-  MpiWrapper::allGather( numberOfNewObjectsHere, numberOfNewObjects );
-
-
-  glocalIndexOffset[0] = 0;
-  for( int rank = 1; rank < commSize; ++rank )
-  {
-    glocalIndexOffset[rank] = glocalIndexOffset[rank - 1] + numberOfNewObjects[rank - 1];
-  }
+  // the new objects of this rank are numbered after the new objects of all the lower ranks
+  globalIndex const globalIndexOffset = MpiWrapper::PrefixSum< globalIndex >( numberOfNewObjectsHere );
 
   localIndex nIndicesAssigned = 0;
   for( auto const & iter : newElems )
   {
     localIndex const er = iter.first.first;
     localIndex const esr = iter.first.second;
-    std::set< localIndex > const & indexList = iter.second;
+    FlatSet< localIndex > const & indexList = iter.second;
 
     ElementSubRegionBase * const subRegion = elementManager.GetRegion( er )->GetSubRegion( esr );
     arrayView1d< globalIndex > const & localToGlobal = subRegion->localToGlobalMap();
@@ -402,7 +545,7 @@ CommunicationTools::
                       "Local object " << newLocalIndex << " should be new but already has a global index "
                                       << localToGlobal[newLocalIndex] );
 
-      localToGlobal[newLocalIndex] = elementManager.maxGlobalIndex() + glocalIndexOffset[thisRank] + nIndicesAssigned + 1;
+      localToGlobal[newLocalIndex] = elementManager.maxGlobalIndex() + globalIndexOffset + nIndicesAssigned + 1;
       subRegion->updateGlobalToLocalMap( newLocalIndex );
 
       nIndicesAssigned += 1;
@@ -418,6 +561,7 @@ CommunicationTools::
                                        std::vector< NeighborCommunicator > & allNeighbors )
 {
   GEOSX_MARK_FUNCTION;
+  CommunicationStatistics::ScopedPurpose const commPurpose( CommunicationStatistics::Purpose::GhostSetup );
   arrayView1d< integer > const & domainBoundaryIndicator = objectManager->getDomainBoundaryIndicator();
 
   array1d< globalIndex > globalPartitionBoundaryObjectsIndices;
@@ -606,6 +750,7 @@ void fixReceiveLists( ObjectManagerBase & objectManager,
   }
 
   /// Wait on the initial send requests.
+  CommunicationStatistics::ScopedWait const wait;
   MpiWrapper::Waitall( nonLocalGhostsRequests.size(), nonLocalGhostsRequests.data(), MPI_STATUSES_IGNORE );
 }
 
@@ -683,6 +828,7 @@ void CommunicationTools::FindGhosts( MeshLevel & meshLevel,
                                      bool const unorderedComms )
 {
   GEOSX_MARK_FUNCTION;
+  CommunicationStatistics::ScopedPurpose const commPurpose( CommunicationStatistics::Purpose::GhostSetup );
   int commID = CommunicationTools::reserveCommID();
 
   NodeManager & nodeManager = *( meshLevel.getNodeManager() );
@@ -702,11 +848,29 @@ void CommunicationTools::FindGhosts( MeshLevel & meshLevel,
   };
   auto unpackGhosts = [&] ( int idx )
   {
+    neighbors[idx].recordCompletion( commID );
     neighbors[idx].UnpackGhosts( meshLevel, commID );
     return MPI_REQUEST_NULL;
   };
 
-  waitOrderedOrWaitAll( neighbors.size(), { sendGhosts, postRecv, unpackGhosts }, unorderedComms );
+  bool const useCollectives = getUseNeighborhoodCollectives();
+  if( useCollectives )
+  {
+    buildGraphCommunicator( neighbors );
+    for( NeighborCommunicator & neighbor : neighbors )
+    {
+      neighbor.PrepareGhosts( 1, meshLevel, commID );
+    }
+    getGraphCommunicator( neighbors ).exchangeBuffers( neighbors, commID );
+    for( std::size_t i = 0; i < neighbors.size(); ++i )
+    {
+      unpackGhosts( i );
+    }
+  }
+  else
+  {
+    waitOrderedOrWaitAll( neighbors.size(), { sendGhosts, postRecv, unpackGhosts }, unorderedComms );
+  }
 
   nodeManager.SetReceiveLists();
   edgeManager.SetReceiveLists();
@@ -731,17 +895,37 @@ void CommunicationTools::FindGhosts( MeshLevel & meshLevel,
   };
   auto rebuildSyncLists = [&] ( int idx )
   {
+    neighbors[idx].recordCompletion( commID );
     neighbors[idx].UnpackAndRebuildSyncLists( meshLevel, commID );
     return MPI_REQUEST_NULL;
   };
+  auto exchangeSyncLists = [&] ()
+  {
+    if( useCollectives )
+    {
+      for( NeighborCommunicator & neighbor : neighbors )
+      {
+        neighbor.PrepareSyncLists( meshLevel, commID );
+      }
+      getGraphCommunicator( neighbors ).exchangeBuffers( neighbors, commID );
+      for( std::size_t i = 0; i < neighbors.size(); ++i )
+      {
+        rebuildSyncLists( i );
+      }
+    }
+    else
+    {
+      waitOrderedOrWaitAll( neighbors.size(), { sendSyncLists, postRecv, rebuildSyncLists }, unorderedComms );
+    }
+  };
 
-  waitOrderedOrWaitAll( neighbors.size(), { sendSyncLists, postRecv, rebuildSyncLists }, unorderedComms );
+  exchangeSyncLists();
 
   fixReceiveLists( nodeManager, neighbors );
   fixReceiveLists( edgeManager, neighbors );
   fixReceiveLists( faceManager, neighbors );
 
-  waitOrderedOrWaitAll( neighbors.size(), { sendSyncLists, postRecv, rebuildSyncLists }, unorderedComms );
+  exchangeSyncLists();
 
   nodeManager.FixUpDownMaps( false );
   verifyGhostingConsistency( nodeManager, neighbors );
@@ -757,6 +941,16 @@ void CommunicationTools::FindGhosts( MeshLevel & meshLevel,
 
   removeUnusedNeighbors( nodeManager, edgeManager, faceManager, elemManager, neighbors );
 
+  if( useCollectives )
+  {
+    // the neighbor list may have shrunk, all the ranks rebuild the graph together
+    buildGraphCommunicator( neighbors );
+  }
+  if( getUseSharedMemoryHalo() )
+  {
+    buildSharedMemoryCommunicator( neighbors );
+  }
+
   nodeManager.CompressRelationMaps();
   edgeManager.compressRelationMaps();
   faceManager.compressRelationMaps();
@@ -806,10 +1000,13 @@ void CommunicationTools::SynchronizePackSendRecv( const std::map< string, string
   for( std::size_t count=0; count<neighbors.size(); ++count )
   {
     int neighborIndex;
-    MpiWrapper::Waitany( icomm.size,
-                         icomm.mpiSizeRecvBufferRequest.data(),
-                         &neighborIndex,
-                         icomm.mpiSizeRecvBufferStatus.data() );
+    {
+      CommunicationStatistics::ScopedWait const wait;
+      MpiWrapper::Waitany( icomm.size,
+                           icomm.mpiSizeRecvBufferRequest.data(),
+                           &neighborIndex,
+                           icomm.mpiSizeRecvBufferStatus.data() );
+    }
 
     NeighborCommunicator & neighbor = neighbors[neighborIndex];
 
@@ -833,15 +1030,20 @@ void CommunicationTools::SynchronizeUnpack( MeshLevel * const mesh,
   for( std::size_t count=0; count<neighbors.size(); ++count )
   {
     int neighborIndex;
-    MpiWrapper::Waitany( icomm.size,
-                         icomm.mpiRecvBufferRequest.data(),
-                         &neighborIndex,
-                         icomm.mpiRecvBufferStatus.data() );
+    {
+      CommunicationStatistics::ScopedWait const wait;
+      MpiWrapper::Waitany( icomm.size,
+                           icomm.mpiRecvBufferRequest.data(),
+                           &neighborIndex,
+                           icomm.mpiRecvBufferStatus.data() );
+    }
 
     NeighborCommunicator & neighbor = neighbors[neighborIndex];
+    neighbor.recordCompletion( icomm.commID );
     neighbor.UnpackBufferForSync( icomm.fieldNames, mesh, icomm.commID, on_device );
   }
 
+  CommunicationStatistics::ScopedWait const wait;
   MpiWrapper::Waitall( icomm.size,
                        icomm.mpiSizeSendBufferRequest.data(),
                        icomm.mpiSizeSendBufferStatus.data() );
@@ -857,11 +1059,177 @@ void CommunicationTools::SynchronizeFields( const std::map< string, string_array
                                             std::vector< NeighborCommunicator > & neighbors,
                                             bool on_device )
 {
+  CommunicationStatistics::ScopedPurpose const commPurpose( CommunicationStatistics::Purpose::FieldSync );
+  LoadBalanceStatistics::ScopedPhase const syncPhase( "synchronization" );
+  dataRepository::MigrationAudit::ScopedSite const migrationSite( "field sync" );
+
+  if( getUseSharedMemoryHalo() )
+  {
+    getSharedMemoryCommunicator( neighbors ).synchronizeFields( fieldNames, mesh, neighbors, on_device );
+    return;
+  }
+
+  if( getUseNeighborhoodCollectives() )
+  {
+    getGraphCommunicator( neighbors ).synchronizeFields( fieldNames, mesh, neighbors, on_device );
+    return;
+  }
+
   MPI_iCommData icomm;
   SynchronizePackSendRecvSizes( fieldNames, mesh, neighbors, icomm, on_device );
   SynchronizePackSendRecv( fieldNames, mesh, neighbors, icomm, on_device );
   SynchronizeUnpack( mesh, neighbors, icomm, on_device );
 }
 
+void CommunicationTools::SynchronizeModifiedFields( std::map< string, string_array > const & fieldNames,
+                                                    std::map< string, SortedArrayView< localIndex const > > const & modifiedObjects,
+                                                    MeshLevel & mesh,
+                                                    std::vector< NeighborCommunicator > & neighbors,
+                                                    bool on_device )
+{
+  GEOSX_MARK_FUNCTION;
+  CommunicationStatistics::ScopedPurpose const commPurpose( CommunicationStatistics::Purpose::FieldSync );
+  LoadBalanceStatistics::ScopedPhase const syncPhase( "synchronization" );
+
+  for( std::pair< string const, string_array > const & entry : fieldNames )
+  {
+    GEOSX_ERROR_IF( entry.first != "node" && entry.first != "edge" && entry.first != "face",
+                    "The modified objects can only be synchronized for the nodes, edges and faces, not for " << entry.first );
+    GEOSX_ERROR_IF( modifiedObjects.count( entry.first ) == 0,
+                    "The modified objects of type " << entry.first << " are not given" );
+  }
+
+  MPI_iCommData icomm;
+  icomm.resize( neighbors.size() );
+
+  for( std::size_t neighborIndex=0; neighborIndex<neighbors.size(); ++neighborIndex )
+  {
+    NeighborCommunicator & neighbor = neighbors[neighborIndex];
+    int const bufferSize = neighbor.PackCommSizeForModifiedSync( fieldNames, mesh, modifiedObjects, icomm.commID, on_device );
+
+    neighbor.MPI_iSendReceiveBufferSizes( icomm.commID,
+                                          icomm.mpiSizeSendBufferRequest[neighborIndex],
+                                          icomm.mpiSizeRecvBufferRequest[neighborIndex],
+                                          MPI_COMM_GEOSX );
+
+    neighbor.resizeSendBuffer( icomm.commID, bufferSize );
+    neighbor.PackCommBufferForModifiedSync( fieldNames, mesh, modifiedObjects, icomm.commID, on_device );
+  }
+
+  for( std::size_t count=0; count<neighbors.size(); ++count )
+  {
+    int neighborIndex;
+    {
+      CommunicationStatistics::ScopedWait const wait;
+      MpiWrapper::Waitany( icomm.size,
+                           icomm.mpiSizeRecvBufferRequest.data(),
+                           &neighborIndex,
+                           icomm.mpiSizeRecvBufferStatus.data() );
+    }
+
+    neighbors[neighborIndex].MPI_iSendReceiveBuffers( icomm.commID,
+                                                      icomm.mpiSendBufferRequest[neighborIndex],
+                                                      icomm.mpiRecvBufferRequest[neighborIndex],
+                                                      MPI_COMM_GEOSX );
+  }
+
+  for( std::size_t count=0; count<neighbors.size(); ++count )
+  {
+    int neighborIndex;
+    {
+      CommunicationStatistics::ScopedWait const wait;
+      MpiWrapper::Waitany( icomm.size,
+                           icomm.mpiRecvBufferRequest.data(),
+                           &neighborIndex,
+                           icomm.mpiRecvBufferStatus.data() );
+    }
+
+    NeighborCommunicator & neighbor = neighbors[neighborIndex];
+    neighbor.recordCompletion( icomm.commID );
+    neighbor.UnpackBufferForModifiedSync( fieldNames, mesh, icomm.commID, on_device );
+  }
+
+  CommunicationStatistics::ScopedWait const wait;
+  MpiWrapper::Waitall( icomm.size,
+                       icomm.mpiSizeSendBufferRequest.data(),
+                       icomm.mpiSizeSendBufferStatus.data() );
+
+  MpiWrapper::Waitall( icomm.size,
+                       icomm.mpiSendBufferRequest.data(),
+                       icomm.mpiSendBufferStatus.data() );
+}
+
+void CommunicationTools::SynchronizeFields( const std::map< string, string_array > & fieldNames,
+                                            MeshLevel * const mesh,
+                                            std::vector< NeighborCommunicator > & neighbors,
+                                            bool on_device,
+                                            std::function< void() > const & onSynchronized )
+{
+  DeferredSynchronizations & deferred = deferredSynchronizations();
+  if( deferred.depth == 0 )
+  {
+    SynchronizeFields( fieldNames, mesh, neighbors, on_device );
+    if( onSynchronized )
+    {
+      onSynchronized();
+    }
+    return;
+  }
+
+  auto const iter = std::find_if( deferred.entries.begin(), deferred.entries.end(),
+                                  [&]( DeferredSynchronizations::Entry const & entry )
+  {
+    return entry.mesh == mesh && entry.neighbors == &neighbors && entry.onDevice == on_device;
+  } );
+
+  if( iter == deferred.entries.end() )
+  {
+    deferred.entries.push_back( { mesh, &neighbors, on_device, fieldNames } );
+  }
+  else
+  {
+    mergeFieldNames( fieldNames, iter->fieldNames );
+  }
+
+  if( onSynchronized )
+  {
+    deferred.callbacks.emplace_back( onSynchronized );
+  }
+}
+
+void CommunicationTools::BeginDeferredSynchronization()
+{
+  ++deferredSynchronizations().depth;
+}
+
+void CommunicationTools::EndDeferredSynchronization()
+{
+  GEOSX_MARK_FUNCTION;
+
+  DeferredSynchronizations & deferred = deferredSynchronizations();
+  GEOSX_ERROR_IF( deferred.depth <= 0, "EndDeferredSynchronization() called without a matching BeginDeferredSynchronization()" );
+
+  if( --deferred.depth > 0 )
+  {
+    return;
+  }
+
+  // move the queue out first, the callbacks may issue new synchronizations
+  std::vector< DeferredSynchronizations::Entry > entries;
+  std::vector< std::function< void() > > callbacks;
+  entries.swap( deferred.entries );
+  callbacks.swap( deferred.callbacks );
+
+  for( DeferredSynchronizations::Entry const & entry : entries )
+  {
+    SynchronizeFields( entry.fieldNames, entry.mesh, *entry.neighbors, entry.onDevice );
+  }
+
+  for( std::function< void() > const & callback : callbacks )
+  {
+    callback();
+  }
+}
+
 
 } /* namespace geosx */
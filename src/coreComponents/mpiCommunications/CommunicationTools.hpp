@@ -22,7 +22,9 @@
 #include "MpiWrapper.hpp"
 
 #include "common/DataTypes.hpp"
+#include "common/FlatContainers.hpp"
 
+#include <functional>
 #include <set>
 
 namespace geosx
@@ -31,6 +33,8 @@ namespace geosx
 
 class ObjectManagerBase;
 class NeighborCommunicator;
+class GraphCommunicator;
+class SharedMemoryCommunicator;
 class MeshLevel;
 class ElementRegionManager;
 
@@ -50,20 +54,96 @@ public:
                                    std::vector< NeighborCommunicator > & neighbors );
 
   static void AssignNewGlobalIndices( ObjectManagerBase & object,
-                                      std::set< localIndex > const & indexList );
+                                      FlatSet< localIndex > const & indexList );
 
   static void
   AssignNewGlobalIndices( ElementRegionManager & elementManager,
-                          std::map< std::pair< localIndex, localIndex >, std::set< localIndex > > const & newElems );
+                          std::map< std::pair< localIndex, localIndex >, FlatSet< localIndex > > const & newElems );
 
   static void FindGhosts( MeshLevel & meshLevel,
                           std::vector< NeighborCommunicator > & neighbors,
                           bool use_nonblocking );
 
   static std::set< int > & getFreeCommIDs();
+  static int & getNumCommIDs();
   static int reserveCommID();
   static void releaseCommID( int & ID );
 
+  /**
+   * @brief Select the neighborhood-collective backend for ghost discovery and field synchronization.
+   * @param useNeighborhoodCollectives if true, exchange with all the neighbors at once through a
+   *        distributed graph communicator instead of point-to-point messages
+   */
+  static void setUseNeighborhoodCollectives( bool const useNeighborhoodCollectives );
+
+  /**
+   * @brief Get whether the neighborhood-collective backend is selected.
+   * @return true if the neighborhood-collective backend is used
+   */
+  static bool getUseNeighborhoodCollectives();
+
+  /**
+   * @brief (Re)build the graph communicator for a neighbor list, collective over MPI_COMM_GEOSX.
+   * @param neighbors the neighbors of the rank
+   */
+  static void buildGraphCommunicator( std::vector< NeighborCommunicator > const & neighbors );
+
+  /**
+   * @brief Get the graph communicator, which must have been built for @p neighbors.
+   * @param neighbors the neighbors of the rank
+   * @return the graph communicator
+   */
+  static GraphCommunicator & getGraphCommunicator( std::vector< NeighborCommunicator > const & neighbors );
+
+  /**
+   * @brief Free the graph communicator, must be called before MPI is finalized.
+   */
+  static void releaseGraphCommunicator();
+
+  /**
+   * @brief Select whether the ghost-setup buffers are compressed.
+   * @param compressGhostBuffers if true, the buffers exchanged to build the ghosts and the synchronization
+   *        lists are compressed before being sent
+   */
+  static void setCompressGhostBuffers( bool const compressGhostBuffers );
+
+  /**
+   * @brief Get whether the ghost-setup buffers are compressed.
+   * @return true if the ghost-setup buffers are compressed
+   */
+  static bool getCompressGhostBuffers();
+
+  /**
+   * @brief Select the node-aware backend for field synchronization.
+   * @param useSharedMemoryHalo if true, the neighbors living on the same node synchronize through
+   *        a MPI shared-memory window instead of messages
+   */
+  static void setUseSharedMemoryHalo( bool const useSharedMemoryHalo );
+
+  /**
+   * @brief Get whether the node-aware backend is selected.
+   * @return true if the node-aware backend is used
+   */
+  static bool getUseSharedMemoryHalo();
+
+  /**
+   * @brief (Re)build the shared-memory communicator for a neighbor list, collective over MPI_COMM_GEOSX.
+   * @param neighbors the neighbors of the rank
+   */
+  static void buildSharedMemoryCommunicator( std::vector< NeighborCommunicator > const & neighbors );
+
+  /**
+   * @brief Get the shared-memory communicator, which must have been built for @p neighbors.
+   * @param neighbors the neighbors of the rank
+   * @return the shared-memory communicator
+   */
+  static SharedMemoryCommunicator & getSharedMemoryCommunicator( std::vector< NeighborCommunicator > const & neighbors );
+
+  /**
+   * @brief Free the shared-memory communicator, must be called before MPI is finalized.
+   */
+  static void releaseSharedMemoryCommunicator();
+
   static void FindMatchedPartitionBoundaryObjects( ObjectManagerBase * const group,
                                                    std::vector< NeighborCommunicator > & allNeighbors );
 
@@ -72,6 +152,53 @@ public:
                                  std::vector< NeighborCommunicator > & allNeighbors,
                                  bool on_device = false );
 
+  /**
+   * @brief Synchronize a set of fields, or queue them if a DeferredSynchronization is active.
+   * @param fieldNames map from object type ("node", "edge", "face", "elems") to the names of the fields to sync
+   * @param mesh the mesh level on which the fields live
+   * @param allNeighbors the neighbors to exchange with
+   * @param on_device whether the fields are packed/unpacked on the device
+   * @param onSynchronized work depending on the synchronized ghost values, called once they have been received
+   *
+   * When the synchronization is deferred, the fields are merged with the other deferred fields of the same mesh
+   * level and neighbors, and all of them are sent in a single message per neighbor when the outermost
+   * DeferredSynchronization goes out of scope. The callbacks are then called in the order they were queued.
+   */
+  static void SynchronizeFields( const std::map< string, string_array > & fieldNames,
+                                 MeshLevel * const mesh,
+                                 std::vector< NeighborCommunicator > & allNeighbors,
+                                 bool on_device,
+                                 std::function< void() > const & onSynchronized );
+
+  /**
+   * @brief Synchronize a set of fields on the ghosts of the modified objects only.
+   * @param fieldNames map from object type ("node", "edge", "face") to the names of the fields to sync
+   * @param modifiedObjects map from each object type of @p fieldNames to the sorted local indices of the objects
+   *                        whose fields changed on this rank since they were last synchronized
+   * @param mesh the mesh level on which the fields live
+   * @param allNeighbors the neighbors to exchange with
+   * @param on_device whether the fields are packed/unpacked on the device
+   *
+   * Each rank only sends the owned objects of @p modifiedObjects that are ghosted by a neighbor, so that the messages
+   * are sized to the change instead of the whole ghost layer. The other ghosts keep their value, so the result only
+   * matches SynchronizeFields if they were synchronized and not written to since.
+   */
+  static void SynchronizeModifiedFields( std::map< string, string_array > const & fieldNames,
+                                         std::map< string, SortedArrayView< localIndex const > > const & modifiedObjects,
+                                         MeshLevel & mesh,
+                                         std::vector< NeighborCommunicator > & allNeighbors,
+                                         bool on_device = false );
+
+  /**
+   * @brief Start deferring the calls to SynchronizeFields that provide a callback.
+   */
+  static void BeginDeferredSynchronization();
+
+  /**
+   * @brief Stop deferring, and flush the deferred synchronizations if this ends the outermost deferral.
+   */
+  static void EndDeferredSynchronization();
+
   static void SynchronizePackSendRecvSizes( const std::map< string, string_array > & fieldNames,
                                             MeshLevel * const mesh,
                                             std::vector< NeighborCommunicator > & neighbors,
@@ -93,6 +220,33 @@ public:
 };
 
 
+/**
+ * @class DeferredSynchronization
+ *
+ * Scope guard coalescing the deferrable field synchronizations issued while it is alive, for instance by the
+ * sub-solvers of a coupled solver, into one message per neighbor. The synchronizations are flushed when the
+ * outermost guard is destroyed.
+ */
+class DeferredSynchronization
+{
+public:
+  DeferredSynchronization()
+  {
+    CommunicationTools::BeginDeferredSynchronization();
+  }
+
+  ~DeferredSynchronization()
+  {
+    CommunicationTools::EndDeferredSynchronization();
+  }
+
+  DeferredSynchronization( DeferredSynchronization const & ) = delete;
+  DeferredSynchronization( DeferredSynchronization && ) = delete;
+  DeferredSynchronization & operator=( DeferredSynchronization const & ) = delete;
+  DeferredSynchronization & operator=( DeferredSynchronization && ) = delete;
+};
+
+
 class MPI_iCommData
 {
 public:
@@ -0,0 +1,160 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CycleReduction.cpp
+ */
+
+#include "mpiCommunications/CycleReduction.hpp"
+
+#include "common/Logger.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <algorithm>
+
+namespace geosx
+{
+
+#ifdef GEOSX_USE_MPI
+namespace
+{
+
+/// The datatype of an (operation, value) pair, reduced as a whole so that MPI never splits a pair
+MPI_Datatype s_taggedValueType = MPI_DATATYPE_NULL;
+
+/// The MPI operation of the reductions
+MPI_Op s_taggedValuesOp = MPI_OP_NULL;
+
+/// The operation applied to the (operation, value) pairs of the reduced buffer
+void reduceTaggedValues( void * const in, void * const inout, int * const len, MPI_Datatype * )
+{
+  real64 const * const inValues = static_cast< real64 const * >( in );
+  real64 * const inoutValues = static_cast< real64 * >( inout );
+  for( int i = 0; i < *len; ++i )
+  {
+    real64 const a = inValues[ 2 * i + 1 ];
+    real64 & b = inoutValues[ 2 * i + 1 ];
+    switch( static_cast< CycleReduction::Operation >( static_cast< integer >( inValues[ 2 * i ] ) ) )
+    {
+      case CycleReduction::Operation::Min:
+        b = std::min( a, b );
+        break;
+      case CycleReduction::Operation::Max:
+        b = std::max( a, b );
+        break;
+      case CycleReduction::Operation::Sum:
+        b += a;
+        break;
+    }
+  }
+}
+
+/// Create the datatype and the operation of the reductions at the first use
+void createTaggedValuesOp()
+{
+  if( s_taggedValuesOp == MPI_OP_NULL )
+  {
+    MPI_Type_contiguous( 2, MPI_DOUBLE, &s_taggedValueType );
+    MPI_Type_commit( &s_taggedValueType );
+    MPI_Op_create( &reduceTaggedValues, 1, &s_taggedValuesOp );
+  }
+}
+
+}
+#endif
+
+void CycleReduction::clear()
+{
+  m_operations.clear();
+  m_values.clear();
+  m_reduced = false;
+}
+
+CycleReduction::Handle CycleReduction::addMin( real64 const value )
+{
+  return add( Operation::Min, value );
+}
+
+CycleReduction::Handle CycleReduction::addMax( real64 const value )
+{
+  return add( Operation::Max, value );
+}
+
+CycleReduction::Handle CycleReduction::addSum( real64 const value )
+{
+  return add( Operation::Sum, value );
+}
+
+CycleReduction::Handle CycleReduction::add( Operation const op, real64 const value )
+{
+  GEOSX_ERROR_IF( m_reduced, "The contributions have already been reduced, clear them first" );
+  m_operations.emplace_back( op );
+  m_values.emplace_back( value );
+  return LvArray::integerConversion< Handle >( m_values.size() ) - 1;
+}
+
+void CycleReduction::reduce()
+{
+  GEOSX_ERROR_IF( m_reduced, "The contributions have already been reduced" );
+  m_reduced = true;
+
+#ifdef GEOSX_USE_MPI
+  if( m_values.empty() || MpiWrapper::Comm_size() == 1 )
+  {
+    return;
+  }
+
+  // the operations travel with the values, the reduction of the tags leaves them unchanged
+  std::vector< real64 > localBuffer( 2 * m_values.size() );
+  for( std::size_t i = 0; i < m_values.size(); ++i )
+  {
+    localBuffer[ 2 * i ] = static_cast< integer >( m_operations[ i ] );
+    localBuffer[ 2 * i + 1 ] = m_values[ i ];
+  }
+
+  createTaggedValuesOp();
+  std::vector< real64 > globalBuffer( localBuffer.size() );
+  MPI_Allreduce( localBuffer.data(),
+                 globalBuffer.data(),
+                 LvArray::integerConversion< int >( m_values.size() ),
+                 s_taggedValueType,
+                 s_taggedValuesOp,
+                 MPI_COMM_GEOSX );
+
+  for( std::size_t i = 0; i < m_values.size(); ++i )
+  {
+    m_values[ i ] = globalBuffer[ 2 * i + 1 ];
+  }
+#endif
+}
+
+void CycleReduction::finalize()
+{
+#ifdef GEOSX_USE_MPI
+  if( s_taggedValuesOp != MPI_OP_NULL )
+  {
+    MPI_Op_free( &s_taggedValuesOp );
+    MPI_Type_free( &s_taggedValueType );
+  }
+#endif
+}
+
+real64 CycleReduction::result( Handle const handle ) const
+{
+  GEOSX_ERROR_IF( !m_reduced, "The contributions have not been reduced" );
+  GEOSX_ERROR_IF( handle < 0 || handle >= size(), "Invalid contribution handle " << handle );
+  return m_values[ handle ];
+}
+
+} // namespace geosx
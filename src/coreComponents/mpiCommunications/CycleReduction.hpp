@@ -0,0 +1,137 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file CycleReduction.hpp
+ */
+
+#ifndef GEOSX_MPICOMMUNICATIONS_CYCLEREDUCTION_HPP_
+#define GEOSX_MPICOMMUNICATIONS_CYCLEREDUCTION_HPP_
+
+#include "common/DataTypes.hpp"
+
+#include <vector>
+
+namespace geosx
+{
+
+/**
+ * @class CycleReduction
+ *
+ * Gathers the rank-local contributions of the components of the cycle reduced over the ranks (the time step
+ * requests, the halt forecasts) to reduce them all with a single allreduce, whatever their number and their
+ * operations. Each contribution is tagged with its operation in the reduced buffer, so that the minima, maxima
+ * and sums are resolved together.
+ *
+ * The ranks must add the same contributions in the same order, which is the case of the contributions of
+ * components whose control flow only depends on replicated data.
+ */
+class CycleReduction
+{
+public:
+
+  /// The handle of a contribution
+  using Handle = localIndex;
+
+  /// The handle of no contribution
+  static constexpr Handle invalidHandle = -1;
+
+  /// The operations of the contributions, stored with their values in the reduced buffer
+  enum class Operation : integer
+  {
+    Min, ///< Minimum over the ranks
+    Max, ///< Maximum over the ranks
+    Sum  ///< Sum over the ranks
+  };
+
+  /**
+   * @brief Drop the contributions, to gather the ones of a new phase.
+   */
+  void clear();
+
+  /**
+   * @brief Add a contribution whose minimum is taken over the ranks.
+   * @param value the rank-local value
+   * @return the handle to read the result
+   */
+  Handle addMin( real64 const value );
+
+  /**
+   * @brief Add a contribution whose maximum is taken over the ranks.
+   * @param value the rank-local value
+   * @return the handle to read the result
+   */
+  Handle addMax( real64 const value );
+
+  /**
+   * @brief Add a contribution summed over the ranks.
+   * @param value the rank-local value
+   * @return the handle to read the result
+   */
+  Handle addSum( real64 const value );
+
+  /**
+   * @brief Reduce all the contributions over the ranks, in a single allreduce.
+   */
+  void reduce();
+
+  /**
+   * @brief Free the MPI datatype and operation of the reductions, before MPI is finalized.
+   */
+  static void finalize();
+
+  /**
+   * @brief Get whether the contributions have been reduced since they were added.
+   * @return true if the results can be read
+   */
+  bool isReduced() const
+  { return m_reduced; }
+
+  /**
+   * @brief Get the number of contributions.
+   * @return the number of contributions
+   */
+  localIndex size() const
+  { return LvArray::integerConversion< localIndex >( m_values.size() ); }
+
+  /**
+   * @brief Get the result of a contribution.
+   * @param handle the handle returned when adding the contribution
+   * @return the value reduced over the ranks
+   */
+  real64 result( Handle const handle ) const;
+
+private:
+
+  /**
+   * @brief Add a contribution.
+   * @param op the operation applied over the ranks
+   * @param value the rank-local value
+   * @return the handle to read the result
+   */
+  Handle add( Operation const op, real64 const value );
+
+  /// The operations of the contributions
+  std::vector< Operation > m_operations;
+
+  /// The values of the contributions, rank-local until reduced
+  std::vector< real64 > m_values;
+
+  /// Whether the values have been reduced
+  bool m_reduced = false;
+};
+
+} // namespace geosx
+
+#endif //GEOSX_MPICOMMUNICATIONS_CYCLEREDUCTION_HPP_
@@ -0,0 +1,112 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file DeterministicReduction.cpp
+ */
+
+#include "mpiCommunications/DeterministicReduction.hpp"
+
+namespace geosx
+{
+
+namespace
+{
+
+bool & enabledFlag()
+{
+  static bool enabled = false;
+  return enabled;
+}
+
+}
+
+void DeterministicReduction::setEnabled( bool const enabled )
+{
+  enabledFlag() = enabled;
+}
+
+bool DeterministicReduction::isEnabled()
+{
+  return enabledFlag();
+}
+
+real64 DeterministicReduction::localDot( real64 const * const x,
+                                         real64 const * const y,
+                                         localIndex const size )
+{
+  return localSum< parallelHostPolicy >( size, [x, y]( localIndex const i )
+  {
+    return x[ i ] * y[ i ];
+  } );
+}
+
+void DeterministicReduction::sum( real64 const * const localValues,
+                                  real64 * const globalValues,
+                                  int const count,
+                                  MPI_Comm const comm )
+{
+#ifdef GEOSX_USE_MPI
+  int const numRanks = MpiWrapper::Comm_size( comm );
+  if( numRanks > 1 )
+  {
+    // the values of all the ranks are gathered and added in rank order on each rank, so that neither the order
+    // nor the grouping of the additions depends on the algorithm of MPI
+    array1d< real64 > localBuffer( count );
+    for( int i = 0; i < count; ++i )
+    {
+      localBuffer[ i ] = localValues[ i ];
+    }
+
+    array1d< real64 > allValues;
+    MpiWrapper::allGather( localBuffer.toViewConst(), allValues, comm );
+
+    for( int i = 0; i < count; ++i )
+    {
+      CompensatedSum total;
+      for( int rank = 0; rank < numRanks; ++rank )
+      {
+        total.add( allValues[ rank * count + i ] );
+      }
+      globalValues[ i ] = total.value();
+    }
+    return;
+  }
+#else
+  GEOSX_UNUSED_VAR( comm );
+#endif
+
+  for( int i = 0; i < count; ++i )
+  {
+    globalValues[ i ] = localValues[ i ];
+  }
+}
+
+real64 DeterministicReduction::sum( real64 const localValue,
+                                    MPI_Comm const comm )
+{
+  real64 globalValue;
+  sum( &localValue, &globalValue, 1, comm );
+  return globalValue;
+}
+
+real64 DeterministicReduction::dot( real64 const * const x,
+                                    real64 const * const y,
+                                    localIndex const size,
+                                    MPI_Comm const comm )
+{
+  return sum( localDot( x, y, size ), comm );
+}
+
+} // namespace geosx
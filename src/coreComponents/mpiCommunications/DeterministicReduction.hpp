@@ -0,0 +1,204 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file DeterministicReduction.hpp
+ */
+
+#ifndef GEOSX_MPICOMMUNICATIONS_DETERMINISTICREDUCTION_HPP_
+#define GEOSX_MPICOMMUNICATIONS_DETERMINISTICREDUCTION_HPP_
+
+#include "common/DataTypes.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+namespace geosx
+{
+
+/**
+ * @class DeterministicReduction
+ *
+ * Sums over the entries of a rank and over the ranks whose results do not depend on the number of threads, on their
+ * scheduling or on the reduction algorithm of MPI, so that two runs with the same partition compute the residual
+ * norms and the dot products to the last bit.
+ *
+ * The entries of a rank are split in blocks of a fixed size, each block is summed sequentially and the block sums
+ * are added in block order. The sums of the ranks are then gathered on every rank and added in rank order. All the
+ * additions are compensated (Kahan-Babuska), which also makes the sums more accurate.
+ *
+ * The mode is disabled by default, the reductions then use the RAJA reducers and MPI_SUM.
+ */
+class DeterministicReduction
+{
+public:
+
+  /// The number of entries of the blocks summed sequentially
+  static constexpr localIndex blockSize = 1024;
+
+  /**
+   * @struct CompensatedSum
+   * A sum with the running compensation of its rounding errors.
+   */
+  struct CompensatedSum
+  {
+    /// The rounded sum
+    real64 sum = 0.0;
+
+    /// The sum of the rounding errors
+    real64 error = 0.0;
+
+    /**
+     * @brief Add a value to the sum.
+     * @param value the value
+     */
+    GEOSX_HOST_DEVICE inline
+    void add( real64 const value )
+    {
+      real64 const newSum = sum + value;
+      if( LvArray::math::abs( sum ) >= LvArray::math::abs( value ) )
+      {
+        error += ( sum - newSum ) + value;
+      }
+      else
+      {
+        error += ( value - newSum ) + sum;
+      }
+      sum = newSum;
+    }
+
+    /**
+     * @brief Add another compensated sum.
+     * @param other the sum to add
+     */
+    GEOSX_HOST_DEVICE inline
+    void add( CompensatedSum const & other )
+    {
+      add( other.sum );
+      error += other.error;
+    }
+
+    /**
+     * @brief @return the compensated value of the sum
+     */
+    GEOSX_HOST_DEVICE inline
+    real64 value() const
+    { return sum + error; }
+  };
+
+  /**
+   * @brief Enable or disable the deterministic reductions.
+   * @param enabled whether the residual norms and the dot products are reduced deterministically
+   */
+  static void setEnabled( bool const enabled );
+
+  /**
+   * @brief Get whether the reductions are deterministic.
+   * @return true if the residual norms and the dot products are reduced deterministically
+   */
+  static bool isEnabled();
+
+  /**
+   * @brief Sum terms over the entries of the rank, in a fixed order.
+   * @tparam POLICY the policy of the loop over the blocks of entries
+   * @tparam LAMBDA the type of the function returning the term of an entry
+   * @param numTerms the number of entries
+   * @param term the function returning the term of an entry, called in the kernels of @p POLICY
+   * @return the sum of the terms of all the entries
+   */
+  template< typename POLICY, typename LAMBDA >
+  static real64 localSum( localIndex const numTerms, LAMBDA && term );
+
+  /**
+   * @brief Compute the dot product of the entries of the rank of two vectors, in a fixed order.
+   * @param x the local entries of the first vector, on the host
+   * @param y the local entries of the second vector, on the host
+   * @param size the number of local entries
+   * @return the part of the dot product of the rank, to be summed over the ranks with sum()
+   */
+  static real64 localDot( real64 const * const x,
+                          real64 const * const y,
+                          localIndex const size );
+
+  /**
+   * @brief Sum values over the ranks, in rank order.
+   * @param localValues the values of the rank
+   * @param globalValues the sums over the ranks, may alias @p localValues
+   * @param count the number of values
+   * @param comm the communicator of the ranks
+   *
+   * The values of all the ranks are gathered, which suits the few values of the residual norms or of the dot
+   * products of a Krylov iteration.
+   */
+  static void sum( real64 const * const localValues,
+                   real64 * const globalValues,
+                   int const count,
+                   MPI_Comm const comm );
+
+  /**
+   * @brief Sum a value over the ranks, in rank order.
+   * @param localValue the value of the rank
+   * @param comm the communicator of the ranks
+   * @return the sum over the ranks
+   */
+  static real64 sum( real64 const localValue,
+                     MPI_Comm const comm );
+
+  /**
+   * @brief Compute the dot product of two distributed vectors deterministically.
+   * @param x the local entries of the first vector, on the host
+   * @param y the local entries of the second vector, on the host
+   * @param size the number of local entries
+   * @param comm the communicator of the vectors
+   * @return the dot product
+   */
+  static real64 dot( real64 const * const x,
+                     real64 const * const y,
+                     localIndex const size,
+                     MPI_Comm const comm );
+};
+
+template< typename POLICY, typename LAMBDA >
+real64 DeterministicReduction::localSum( localIndex const numTerms, LAMBDA && term )
+{
+  localIndex const numBlocks = ( numTerms + blockSize - 1 ) / blockSize;
+
+  // the sum and the error of each block
+  array1d< real64 > blockSums( 2 * numBlocks );
+  arrayView1d< real64 > const sums = blockSums.toView();
+
+  forAll< POLICY >( numBlocks, [=] GEOSX_HOST_DEVICE ( localIndex const b )
+  {
+    CompensatedSum blockSum;
+    localIndex const end = LvArray::math::min( numTerms, ( b + 1 ) * blockSize );
+    for( localIndex i = b * blockSize; i < end; ++i )
+    {
+      blockSum.add( term( i ) );
+    }
+    sums[ 2 * b ] = blockSum.sum;
+    sums[ 2 * b + 1 ] = blockSum.error;
+  } );
+
+  // the blocks are added in their order on the host
+  blockSums.move( LvArray::MemorySpace::CPU, false );
+  CompensatedSum total;
+  for( localIndex b = 0; b < numBlocks; ++b )
+  {
+    total.add( CompensatedSum{ blockSums[ 2 * b ], blockSums[ 2 * b + 1 ] } );
+  }
+  return total.value();
+}
+
+} // namespace geosx
+
+#endif //GEOSX_MPICOMMUNICATIONS_DETERMINISTICREDUCTION_HPP_
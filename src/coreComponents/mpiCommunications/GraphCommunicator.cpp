@@ -0,0 +1,194 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file GraphCommunicator.cpp
+ */
+
+#include "mpiCommunications/GraphCommunicator.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "mesh/MeshLevel.hpp"
+#include "mpiCommunications/CommunicationStatistics.hpp"
+#include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/NeighborCommunicator.hpp"
+
+#include <algorithm>
+
+namespace geosx
+{
+
+GraphCommunicator::GraphCommunicator( std::vector< NeighborCommunicator > const & neighbors ):
+  m_comm( MPI_COMM_NULL ),
+  m_commID( CommunicationTools::reserveCommID() ),
+  m_neighborRanks(),
+  m_sendCounts(),
+  m_recvCounts(),
+  m_sendDispls(),
+  m_recvDispls(),
+  m_sendBuffer(),
+  m_recvBuffer()
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex const numNeighbors = LvArray::integerConversion< localIndex >( neighbors.size() );
+
+  m_neighborRanks.resize( numNeighbors );
+  m_sendCounts.resize( numNeighbors );
+  m_recvCounts.resize( numNeighbors );
+  m_sendDispls.resize( numNeighbors );
+  m_recvDispls.resize( numNeighbors );
+
+  for( localIndex i = 0; i < numNeighbors; ++i )
+  {
+    m_neighborRanks[i] = neighbors[i].NeighborRank();
+  }
+
+  m_comm = MpiWrapper::Dist_graph_create_adjacent( MPI_COMM_GEOSX,
+                                                   LvArray::integerConversion< int >( numNeighbors ),
+                                                   m_neighborRanks.data() );
+}
+
+GraphCommunicator::~GraphCommunicator()
+{
+  if( m_comm != MPI_COMM_NULL )
+  {
+    MpiWrapper::Comm_free( m_comm );
+  }
+  CommunicationTools::releaseCommID( m_commID );
+}
+
+bool GraphCommunicator::matches( std::vector< NeighborCommunicator > const & neighbors ) const
+{
+  if( LvArray::integerConversion< localIndex >( neighbors.size() ) != m_neighborRanks.size() )
+  {
+    return false;
+  }
+
+  for( localIndex i = 0; i < m_neighborRanks.size(); ++i )
+  {
+    if( neighbors[i].NeighborRank() != m_neighborRanks[i] )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void GraphCommunicator::exchangeSizes()
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex const numNeighbors = m_neighborRanks.size();
+
+  {
+    CommunicationStatistics::ScopedWait const wait;
+    MpiWrapper::Neighbor_alltoall( m_sendCounts.data(), m_recvCounts.data(), 1, m_comm );
+  }
+
+  int sendOffset = 0;
+  int recvOffset = 0;
+  for( localIndex i = 0; i < numNeighbors; ++i )
+  {
+    m_sendDispls[i] = sendOffset;
+    m_recvDispls[i] = recvOffset;
+    sendOffset += m_sendCounts[i];
+    recvOffset += m_recvCounts[i];
+
+    CommunicationStatistics::recordSend( m_neighborRanks[i], m_sendCounts[i] );
+    CommunicationStatistics::recordReceive( m_neighborRanks[i], m_recvCounts[i] );
+  }
+
+  m_sendBuffer.resize( sendOffset );
+  m_recvBuffer.resize( recvOffset );
+}
+
+void GraphCommunicator::exchangeBuffers( std::vector< NeighborCommunicator > & neighbors,
+                                         int const commID )
+{
+  GEOSX_MARK_FUNCTION;
+  GEOSX_ERROR_IF( !matches( neighbors ), "The neighbor list changed since the GraphCommunicator was built" );
+
+  localIndex const numNeighbors = m_neighborRanks.size();
+
+  for( localIndex i = 0; i < numNeighbors; ++i )
+  {
+    m_sendCounts[i] = LvArray::integerConversion< int >( neighbors[i].SendBuffer( commID ).size() );
+  }
+
+  exchangeSizes();
+
+  for( localIndex i = 0; i < numNeighbors; ++i )
+  {
+    buffer_type const & sendBuffer = neighbors[i].SendBuffer( commID );
+    std::copy( sendBuffer.begin(), sendBuffer.end(), m_sendBuffer.begin() + m_sendDispls[i] );
+  }
+
+  {
+    CommunicationStatistics::ScopedWait const wait;
+    MpiWrapper::Neighbor_alltoallv( m_sendBuffer.data(), m_sendCounts.data(), m_sendDispls.data(),
+                                    m_recvBuffer.data(), m_recvCounts.data(), m_recvDispls.data(),
+                                    m_comm );
+  }
+
+  for( localIndex i = 0; i < numNeighbors; ++i )
+  {
+    neighbors[i].resizeRecvBuffer( commID, m_recvCounts[i] );
+    std::copy( m_recvBuffer.begin() + m_recvDispls[i],
+               m_recvBuffer.begin() + m_recvDispls[i] + m_recvCounts[i],
+               neighbors[i].ReceiveBuffer( commID ).begin() );
+  }
+}
+
+void GraphCommunicator::synchronizeFields( std::map< string, string_array > const & fieldNames,
+                                           MeshLevel * const mesh,
+                                           std::vector< NeighborCommunicator > & neighbors,
+                                           bool const onDevice )
+{
+  GEOSX_MARK_FUNCTION;
+  GEOSX_ERROR_IF( !matches( neighbors ), "The neighbor list changed since the GraphCommunicator was built" );
+
+  localIndex const numNeighbors = m_neighborRanks.size();
+
+  for( localIndex i = 0; i < numNeighbors; ++i )
+  {
+    m_sendCounts[i] = neighbors[i].PackCommSizeForSync( fieldNames, *mesh, m_commID, onDevice );
+  }
+
+  exchangeSizes();
+
+  // pack directly at each neighbor's offset in the contiguous send buffer
+  for( localIndex i = 0; i < numNeighbors; ++i )
+  {
+    int const packedSize = neighbors[i].PackCommBufferForSync( fieldNames,
+                                                               *mesh,
+                                                               m_sendBuffer.data() + m_sendDispls[i],
+                                                               onDevice );
+    GEOSX_ERROR_IF_NE( packedSize, m_sendCounts[i] );
+  }
+
+  {
+    CommunicationStatistics::ScopedWait const wait;
+    MpiWrapper::Neighbor_alltoallv( m_sendBuffer.data(), m_sendCounts.data(), m_sendDispls.data(),
+                                    m_recvBuffer.data(), m_recvCounts.data(), m_recvDispls.data(),
+                                    m_comm );
+  }
+
+  for( localIndex i = 0; i < numNeighbors; ++i )
+  {
+    neighbors[i].UnpackBufferForSync( fieldNames, mesh, m_recvBuffer.data() + m_recvDispls[i], onDevice );
+  }
+}
+
+} /* namespace geosx */
@@ -0,0 +1,126 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file GraphCommunicator.hpp
+ */
+
+#ifndef GEOSX_MPICOMMUNICATIONS_GRAPHCOMMUNICATOR_HPP_
+#define GEOSX_MPICOMMUNICATIONS_GRAPHCOMMUNICATOR_HPP_
+
+#include "MpiWrapper.hpp"
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+class MeshLevel;
+class NeighborCommunicator;
+
+/**
+ * @class GraphCommunicator
+ *
+ * A distributed graph communicator built from the list of neighbors of the rank. All the neighbors are
+ * exchanged with at once through the MPI neighborhood collectives: one MPI_Neighbor_alltoall for the message
+ * sizes and one MPI_Neighbor_alltoallv for the data, instead of one point-to-point message pair per neighbor.
+ *
+ * Building the graph and every exchange are collective over MPI_COMM_GEOSX, the graph must therefore be rebuilt
+ * on all ranks at the same time whenever the neighbor list changes.
+ */
+class GraphCommunicator
+{
+public:
+
+  /**
+   * @brief Constructor, collective over MPI_COMM_GEOSX.
+   * @param neighbors the neighbors of the rank, which define the edges of the graph
+   */
+  explicit GraphCommunicator( std::vector< NeighborCommunicator > const & neighbors );
+
+  /**
+   * @brief Destructor, frees the graph communicator.
+   */
+  ~GraphCommunicator();
+
+  GraphCommunicator( GraphCommunicator const & ) = delete;
+  GraphCommunicator( GraphCommunicator && ) = delete;
+  GraphCommunicator & operator=( GraphCommunicator const & ) = delete;
+  GraphCommunicator & operator=( GraphCommunicator && ) = delete;
+
+  /**
+   * @brief Check whether the graph was built for the given neighbors, in the same order.
+   * @param neighbors the neighbors
+   * @return true if the graph can be used to exchange with @p neighbors
+   */
+  bool matches( std::vector< NeighborCommunicator > const & neighbors ) const;
+
+  /**
+   * @brief Exchange the send buffers of all the neighbors for @p commID into their receive buffers.
+   * @param neighbors the neighbors, whose send buffers have been packed
+   * @param commID the communication ID of the buffers
+   */
+  void exchangeBuffers( std::vector< NeighborCommunicator > & neighbors,
+                        int const commID );
+
+  /**
+   * @brief Synchronize the ghost values of a set of fields with all the neighbors.
+   * @param fieldNames map from object type ("node", "edge", "face", "elems") to the names of the fields to sync
+   * @param mesh the mesh level on which the fields live
+   * @param neighbors the neighbors
+   * @param onDevice whether the fields are packed/unpacked on the device
+   */
+  void synchronizeFields( std::map< string, string_array > const & fieldNames,
+                          MeshLevel * const mesh,
+                          std::vector< NeighborCommunicator > & neighbors,
+                          bool const onDevice );
+
+private:
+
+  /**
+   * @brief Exchange m_sendCounts into m_recvCounts, compute the displacements and size the buffers.
+   */
+  void exchangeSizes();
+
+  /// The distributed graph communicator
+  MPI_Comm m_comm;
+
+  /// Communication ID used to compute the sync pack sizes
+  int m_commID;
+
+  /// Rank of each neighbor in the graph
+  array1d< int > m_neighborRanks;
+
+  /// Number of bytes sent to each neighbor
+  array1d< int > m_sendCounts;
+
+  /// Number of bytes received from each neighbor
+  array1d< int > m_recvCounts;
+
+  /// Offset of the data sent to each neighbor in m_sendBuffer
+  array1d< int > m_sendDispls;
+
+  /// Offset of the data received from each neighbor in m_recvBuffer
+  array1d< int > m_recvDispls;
+
+  /// Buffer holding the data sent to all the neighbors
+  buffer_type m_sendBuffer;
+
+  /// Buffer holding the data received from all the neighbors
+  buffer_type m_recvBuffer;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MPICOMMUNICATIONS_GRAPHCOMMUNICATOR_HPP_ */
@@ -0,0 +1,314 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file LoadBalanceStatistics.cpp
+ */
+
+#include "mpiCommunications/LoadBalanceStatistics.hpp"
+
+#include "common/Logger.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+namespace geosx
+{
+
+namespace
+{
+
+/// The times of one phase
+struct PhaseRecord
+{
+  string name;
+  real64 cycleSeconds = 0.0;
+  real64 totalSeconds = 0.0;
+};
+
+struct Records
+{
+  bool enabled = false;
+  integer reportInterval = 0;
+  /// The first cycle of the current report
+  integer firstCycle = 0;
+  /// The numbers of owned, ghost and well elements of the rank
+  std::array< localIndex, 3 > rankSize = { { 0, 0, 0 } };
+  /// The phases in the order they were first timed
+  std::vector< PhaseRecord > phases;
+  std::unordered_map< string, std::size_t > index;
+};
+
+/// The name of the phase of the field synchronizations, mostly spent waiting for the slowest neighbor
+constexpr char const * synchronizationPhase = "synchronization";
+
+Records & records()
+{
+  static Records rec;
+  return rec;
+}
+
+/**
+ * @brief Add the time spent in a phase.
+ * @param name the name of the phase
+ * @param seconds the time spent in the phase
+ */
+void addTime( string const & name, real64 const seconds )
+{
+  Records & rec = records();
+  std::unordered_map< string, std::size_t >::const_iterator const iter = rec.index.find( name );
+  std::size_t i;
+  if( iter == rec.index.end() )
+  {
+    i = rec.phases.size();
+    rec.index.emplace( name, i );
+    rec.phases.emplace_back();
+    rec.phases.back().name = name;
+  }
+  else
+  {
+    i = iter->second;
+  }
+  rec.phases[i].cycleSeconds += seconds;
+  rec.phases[i].totalSeconds += seconds;
+}
+
+/**
+ * @brief Get the innermost phase being timed by the thread.
+ * @return a reference to the pointer to the phase, null if none
+ */
+LoadBalanceStatistics::ScopedPhase * & currentPhase()
+{
+  thread_local LoadBalanceStatistics::ScopedPhase * phase = nullptr;
+  return phase;
+}
+
+/**
+ * @brief Print the imbalance of the phases timed on rank 0 and the slowest ranks, collective over MPI_COMM_GEOSX.
+ * @param title the title of the report
+ * @param useTotal whether to report the times of the whole run, or of the cycles since the last report
+ */
+void printReport( string const & title, bool const useTotal )
+{
+  Records const & rec = records();
+
+  // the ranks may not have timed the same phases, the ones of rank 0 are reported
+  std::ostringstream namesStream;
+  for( PhaseRecord const & phase : rec.phases )
+  {
+    namesStream << phase.name << '\n';
+  }
+  string names = namesStream.str();
+  MpiWrapper::Broadcast( names, 0 );
+
+  std::vector< string > phaseNames;
+  std::istringstream namesInput( names );
+  for( string name; std::getline( namesInput, name ); )
+  {
+    phaseNames.emplace_back( name );
+  }
+  if( phaseNames.empty() )
+  {
+    return;
+  }
+
+  // the times of the phases, followed by the size of the rank
+  int const numPhases = LvArray::integerConversion< int >( phaseNames.size() );
+  int const numValues = numPhases + 3;
+  std::vector< real64 > values( numValues, 0.0 );
+  for( int p = 0; p < numPhases; ++p )
+  {
+    std::unordered_map< string, std::size_t >::const_iterator const iter = rec.index.find( phaseNames[p] );
+    if( iter != rec.index.end() )
+    {
+      PhaseRecord const & phase = rec.phases[ iter->second ];
+      values[p] = useTotal ? phase.totalSeconds : phase.cycleSeconds;
+    }
+  }
+  for( int i = 0; i < 3; ++i )
+  {
+    values[numPhases + i] = rec.rankSize[i];
+  }
+
+  int const numRanks = MpiWrapper::Comm_size();
+  std::vector< real64 > allValues( MpiWrapper::Comm_rank() == 0 ? numRanks * numValues : 0 );
+  MpiWrapper::gather( values.data(), numValues, allValues.data(), numValues, 0, MPI_COMM_GEOSX );
+
+  if( MpiWrapper::Comm_rank() != 0 )
+  {
+    return;
+  }
+
+  GEOSX_LOG_RANK_0( "\nLoad balance over " << numRanks << " ranks, " << title << ":" );
+  GEOSX_LOG_RANK_0( std::setw( 12 ) << "avg (s)" << " | " <<
+                    std::setw( 12 ) << "max (s)" << " | " <<
+                    std::setw( 10 ) << "max / avg" << " | " <<
+                    std::setw( 12 ) << "slowest rank" << " | phase" );
+
+  // the ranks are compared by the time of their work, the fastest ones wait for the others in the synchronizations
+  std::vector< real64 > rankTimes( numRanks, 0.0 );
+  for( int p = 0; p <= numPhases; ++p )
+  {
+    // the last line is the sum of the phases doing work
+    bool const isWork = p < numPhases && phaseNames[p] != synchronizationPhase;
+    real64 sum = 0.0;
+    real64 max = 0.0;
+    int slowestRank = 0;
+    for( int r = 0; r < numRanks; ++r )
+    {
+      real64 const seconds = ( p < numPhases ) ? allValues[ r * numValues + p ] : rankTimes[r];
+      if( isWork )
+      {
+        rankTimes[r] += seconds;
+      }
+      sum += seconds;
+      if( seconds > max )
+      {
+        max = seconds;
+        slowestRank = r;
+      }
+    }
+    real64 const avg = sum / numRanks;
+    GEOSX_LOG_RANK_0( std::setw( 12 ) << avg << " | " <<
+                      std::setw( 12 ) << max << " | " <<
+                      std::setw( 10 ) << ( avg > 0.0 ? max / avg : 1.0 ) << " | " <<
+                      std::setw( 12 ) << slowestRank << " | " << ( p < numPhases ? phaseNames[p] : "work (all but the synchronizations)" ) );
+  }
+
+  std::vector< int > ranks( numRanks );
+  std::iota( ranks.begin(), ranks.end(), 0 );
+  int const numListed = std::min( numRanks, int( LoadBalanceStatistics::numSlowestRanks ) );
+  std::partial_sort( ranks.begin(), ranks.begin() + numListed, ranks.end(), [&]( int const r0, int const r1 )
+  {
+    return rankTimes[r0] > rankTimes[r1];
+  } );
+
+  GEOSX_LOG_RANK_0( "Slowest ranks:" );
+  GEOSX_LOG_RANK_0( std::setw( 8 ) << "rank" << " | " <<
+                    std::setw( 12 ) << "work (s)" << " | " <<
+                    std::setw( 14 ) << "owned elements" << " | " <<
+                    std::setw( 14 ) << "ghost elements" << " | " <<
+                    std::setw( 13 ) << "well elements" );
+  for( int i = 0; i < numListed; ++i )
+  {
+    int const r = ranks[i];
+    GEOSX_LOG_RANK_0( std::setw( 8 ) << r << " | " <<
+                      std::setw( 12 ) << rankTimes[r] << " | " <<
+                      std::setw( 14 ) << globalIndex( allValues[ r * numValues + numPhases ] ) << " | " <<
+                      std::setw( 14 ) << globalIndex( allValues[ r * numValues + numPhases + 1 ] ) << " | " <<
+                      std::setw( 13 ) << globalIndex( allValues[ r * numValues + numPhases + 2 ] ) );
+  }
+}
+
+}
+
+void LoadBalanceStatistics::setEnabled( bool const enabled )
+{
+  records().enabled = enabled;
+}
+
+bool LoadBalanceStatistics::isEnabled()
+{
+  return records().enabled;
+}
+
+void LoadBalanceStatistics::setReportInterval( integer const numCycles )
+{
+  GEOSX_ERROR_IF_LT_MSG( numCycles, 0, "The number of cycles between two load balance reports cannot be negative" );
+  records().reportInterval = numCycles;
+}
+
+integer LoadBalanceStatistics::reportInterval()
+{
+  return records().reportInterval;
+}
+
+void LoadBalanceStatistics::setRankSize( localIndex const numOwnedElements,
+                                         localIndex const numGhostElements,
+                                         localIndex const numWellElements )
+{
+  records().rankSize = { { numOwnedElements, numGhostElements, numWellElements } };
+}
+
+void LoadBalanceStatistics::setFirstCycle( integer const cycle )
+{
+  records().firstCycle = cycle;
+}
+
+bool LoadBalanceStatistics::isReportDue( integer const cycle )
+{
+  Records const & rec = records();
+  return rec.enabled && rec.reportInterval > 0 && ( cycle + 1 ) % rec.reportInterval == 0;
+}
+
+void LoadBalanceStatistics::printCycleReport( integer const cycle )
+{
+  Records & rec = records();
+  if( !rec.enabled )
+  {
+    return;
+  }
+
+  printReport( "cycles " + std::to_string( rec.firstCycle ) + " to " + std::to_string( cycle ), false );
+
+  for( PhaseRecord & phase : rec.phases )
+  {
+    phase.cycleSeconds = 0.0;
+  }
+  rec.firstCycle = cycle + 1;
+}
+
+LoadBalanceStatistics::ScopedPhase::ScopedPhase( string name ):
+  m_name( isEnabled() ? std::move( name ) : string() ),
+  m_parent( currentPhase() ),
+  m_nestedSeconds( 0.0 ),
+  m_stopwatch()
+{
+  if( !m_name.empty() )
+  {
+    currentPhase() = this;
+  }
+}
+
+LoadBalanceStatistics::ScopedPhase::~ScopedPhase()
+{
+  if( !m_name.empty() )
+  {
+    real64 const seconds = m_stopwatch.elapsedTime();
+    addTime( m_name, seconds - m_nestedSeconds );
+    if( m_parent != nullptr )
+    {
+      m_parent->m_nestedSeconds += seconds;
+    }
+    currentPhase() = m_parent;
+  }
+}
+
+void LoadBalanceStatistics::printSummary()
+{
+  if( !isEnabled() )
+  {
+    return;
+  }
+
+  printReport( "whole run", true );
+}
+
+} /* namespace geosx */
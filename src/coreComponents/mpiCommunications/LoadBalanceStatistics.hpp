@@ -0,0 +1,146 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file LoadBalanceStatistics.hpp
+ */
+
+#ifndef GEOSX_MPICOMMUNICATIONS_LOADBALANCESTATISTICS_HPP_
+#define GEOSX_MPICOMMUNICATIONS_LOADBALANCESTATISTICS_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/Stopwatch.hpp"
+
+namespace geosx
+{
+
+/**
+ * @class LoadBalanceStatistics
+ *
+ * Times the phases of the time steps on each rank (the assembly, the update of the state and the linear solve
+ * of each solver, the field synchronizations, the outputs) to measure the load imbalance of the decomposition.
+ * A report gives for each phase the average and maximum time over the ranks and their ratio, and lists the
+ * slowest ranks with their number of owned elements, ghost elements and well elements, so that the stragglers
+ * can be related to the decomposition. The ranks are compared by the time of their work, all the phases but the
+ * "synchronization" one, in which the fastest ranks wait for their neighbors.
+ *
+ * Nothing is recorded unless the statistics are enabled (--load-balance-report), in which case a report of the
+ * last cycles is printed every reportInterval() cycles, and a report of the whole run at the end.
+ */
+class LoadBalanceStatistics
+{
+public:
+
+  /// The number of slowest ranks listed in the reports
+  static constexpr integer numSlowestRanks = 5;
+
+  /**
+   * @brief Enable or disable the recording.
+   * @param enabled whether to time the phases
+   */
+  static void setEnabled( bool const enabled );
+
+  /**
+   * @brief Get whether the phases are timed.
+   * @return true if the phases are timed
+   */
+  static bool isEnabled();
+
+  /**
+   * @brief Set the number of cycles between two reports.
+   * @param numCycles the number of cycles, 0 to only report at the end of the run
+   */
+  static void setReportInterval( integer const numCycles );
+
+  /**
+   * @brief Get the number of cycles between two reports.
+   * @return the number of cycles, 0 if only reporting at the end of the run
+   */
+  static integer reportInterval();
+
+  /**
+   * @brief Set the size of the part of the mesh of the rank.
+   * @param numOwnedElements the number of elements owned by the rank, excluding the well elements
+   * @param numGhostElements the number of ghost elements, excluding the well elements
+   * @param numWellElements the number of well elements owned by the rank
+   */
+  static void setRankSize( localIndex const numOwnedElements,
+                           localIndex const numGhostElements,
+                           localIndex const numWellElements );
+
+  /**
+   * @brief Set the first cycle of the next report, at the beginning of a run or of a restart.
+   * @param cycle the index of the cycle
+   */
+  static void setFirstCycle( integer const cycle );
+
+  /**
+   * @brief Get whether a report of the last cycles is due after a cycle.
+   * @param cycle the index of the cycle that just completed
+   * @return true if the statistics are enabled and the report is due
+   */
+  static bool isReportDue( integer const cycle );
+
+  /**
+   * @brief Print the report of the cycles since the previous one and restart the timing of the cycles.
+   *        Collective over MPI_COMM_GEOSX.
+   * @param cycle the index of the cycle that just completed
+   */
+  static void printCycleReport( integer const cycle );
+
+  /**
+   * @brief Print the report of the whole run, collective over MPI_COMM_GEOSX.
+   */
+  static void printSummary();
+
+  /**
+   * @class ScopedPhase
+   * Adds its lifetime to the time of a phase, if the statistics are enabled. The time of the phases nested
+   * in it is excluded, so that the phases do not overlap and their times can be summed.
+   */
+  class ScopedPhase
+  {
+public:
+
+    /**
+     * @brief Constructor, starts the timer.
+     * @param name the name of the phase, nothing is recorded if it is empty
+     */
+    explicit ScopedPhase( string name );
+
+    /**
+     * @brief Destructor, records the elapsed time.
+     */
+    ~ScopedPhase();
+
+    ScopedPhase( ScopedPhase const & ) = delete;
+    ScopedPhase( ScopedPhase && ) = delete;
+    ScopedPhase & operator=( ScopedPhase const & ) = delete;
+    ScopedPhase & operator=( ScopedPhase && ) = delete;
+
+private:
+    /// The name of the phase, empty if nothing is recorded
+    string const m_name;
+    /// The phase this one is nested in
+    ScopedPhase * const m_parent;
+    /// The time of the phases nested in this one
+    real64 m_nestedSeconds;
+    /// The timer started at construction
+    Stopwatch m_stopwatch;
+  };
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MPICOMMUNICATIONS_LOADBALANCESTATISTICS_HPP_ */
@@ -21,6 +21,8 @@
 
 #include "MpiWrapper.hpp"
 
+#include <algorithm>
+
 #if defined(__clang__)
   #pragma clang diagnostic push
   #pragma clang diagnostic ignored "-Wunused-parameter"
@@ -82,6 +84,22 @@ void MpiWrapper::Comm_free( MPI_Comm & comm )
 #endif
 }
 
+MPI_Comm MpiWrapper::Dist_graph_create_adjacent( MPI_Comm const comm,
+                                                 int const MPI_PARAM( degree ),
+                                                 int const MPI_PARAM( neighbors )[] )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_Comm graphComm;
+  MPI_CHECK_ERROR( MPI_Dist_graph_create_adjacent( comm,
+                                                   degree, neighbors, MPI_UNWEIGHTED,
+                                                   degree, neighbors, MPI_UNWEIGHTED,
+                                                   MPI_INFO_NULL, 0, &graphComm ) );
+  return graphComm;
+#else
+  return comm;
+#endif
+}
+
 std::size_t MpiWrapper::getSizeofMpiType( MPI_Datatype const type )
 {
   if( type == MPI_CHAR )
@@ -155,6 +173,96 @@ MPI_Comm MpiWrapper::Comm_split( MPI_Comm const comm, int color, int key )
 #endif
 }
 
+MPI_Comm MpiWrapper::Comm_split_shared( MPI_Comm const comm )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_Comm scomm;
+  MPI_CHECK_ERROR( MPI_Comm_split_type( comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &scomm ) );
+  return scomm;
+#else
+  return comm;
+#endif
+}
+
+void MpiWrapper::Group_translate_ranks( MPI_Comm const MPI_PARAM( comm ),
+                                        int const n,
+                                        int const ranks[],
+                                        MPI_Comm const MPI_PARAM( targetComm ),
+                                        int targetRanks[] )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_Group group;
+  MPI_Group targetGroup;
+  MPI_CHECK_ERROR( MPI_Comm_group( comm, &group ) );
+  MPI_CHECK_ERROR( MPI_Comm_group( targetComm, &targetGroup ) );
+  MPI_CHECK_ERROR( MPI_Group_translate_ranks( group, n, ranks, targetGroup, targetRanks ) );
+  MPI_CHECK_ERROR( MPI_Group_free( &group ) );
+  MPI_CHECK_ERROR( MPI_Group_free( &targetGroup ) );
+#else
+  std::copy( ranks, ranks + n, targetRanks );
+#endif
+}
+
+void * MpiWrapper::Win_allocate_shared( std::size_t const MPI_PARAM( size ),
+                                        MPI_Comm const MPI_PARAM( comm ),
+                                        MPI_Win & win )
+{
+#ifdef GEOSX_USE_MPI
+  void * baseptr = nullptr;
+  MPI_CHECK_ERROR( MPI_Win_allocate_shared( LvArray::integerConversion< MPI_Aint >( size ),
+                                            1, MPI_INFO_NULL, comm, &baseptr, &win ) );
+  return baseptr;
+#else
+  win = MPI_WIN_NULL;
+  GEOSX_ERROR( "MpiWrapper::Win_allocate_shared() requires GEOSX to be built with MPI" );
+  return nullptr;
+#endif
+}
+
+void * MpiWrapper::Win_shared_query( MPI_Win const MPI_PARAM( win ), int const MPI_PARAM( rank ) )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_Aint size;
+  int dispUnit;
+  void * baseptr = nullptr;
+  MPI_CHECK_ERROR( MPI_Win_shared_query( win, rank, &size, &dispUnit, &baseptr ) );
+  return baseptr;
+#else
+  GEOSX_ERROR( "MpiWrapper::Win_shared_query() requires GEOSX to be built with MPI" );
+  return nullptr;
+#endif
+}
+
+void MpiWrapper::Win_free( MPI_Win & win )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_CHECK_ERROR( MPI_Win_free( &win ) );
+#else
+  win = MPI_WIN_NULL;
+#endif
+}
+
+void MpiWrapper::Win_lock_all( MPI_Win const MPI_PARAM( win ) )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_CHECK_ERROR( MPI_Win_lock_all( MPI_MODE_NOCHECK, win ) );
+#endif
+}
+
+void MpiWrapper::Win_unlock_all( MPI_Win const MPI_PARAM( win ) )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_CHECK_ERROR( MPI_Win_unlock_all( win ) );
+#endif
+}
+
+void MpiWrapper::Win_sync( MPI_Win const MPI_PARAM( win ) )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_CHECK_ERROR( MPI_Win_sync( win ) );
+#endif
+}
+
 int MpiWrapper::Test( MPI_Request * request, int * flag, MPI_Status * status )
 {
 #ifdef GEOSX_USE_MPI
@@ -197,6 +305,22 @@ int MpiWrapper::Waitall( int count, MPI_Request array_of_requests[], MPI_Status
   return 0;
 }
 
+int MpiWrapper::Startall( int count, MPI_Request array_of_requests[] )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Startall( count, array_of_requests );
+#endif
+  return 0;
+}
+
+int MpiWrapper::Request_free( MPI_Request * request )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Request_free( request );
+#endif
+  return 0;
+}
+
 double MpiWrapper::Wtime( void )
 {
 #ifdef GEOSX_USE_MPI
@@ -83,6 +83,9 @@ typedef int MPI_Request;
 typedef int MPI_Info;
 #define MPI_INFO_NULL (MPI_Info)(0x60000000)
 
+typedef int MPI_Win;
+#define MPI_WIN_NULL ((MPI_Win)0x20000000)
+
 struct MPI_Status
 {
   int junk;
@@ -160,6 +163,15 @@ public:
 
   static void Comm_free( MPI_Comm & comm );
 
+  /**
+   * @brief Wrapper around MPI_Dist_graph_create_adjacent() for a symmetric communication graph.
+   * @param[in] comm The communicator the graph is built from.
+   * @param[in] degree The number of neighbors of the calling rank.
+   * @param[in] neighbors The ranks (within \p comm) of the neighbors, which are both sources and destinations.
+   * @return The distributed graph communicator, which must be freed with Comm_free().
+   */
+  static MPI_Comm Dist_graph_create_adjacent( MPI_Comm const comm, int const degree, int const neighbors[] );
+
   inline static int Comm_rank( MPI_Comm const & MPI_PARAM( comm )=MPI_COMM_GEOSX )
   {
     int rank = 0;
@@ -186,6 +198,53 @@ public:
 
   static MPI_Comm Comm_split( MPI_Comm const comm, int color, int key );
 
+  /**
+   * @brief Wrapper around MPI_Comm_split_type() with MPI_COMM_TYPE_SHARED.
+   * @param[in] comm The communicator to split.
+   * @return The communicator of the ranks of \p comm that can share memory with the calling rank (i.e. that
+   *         live on the same node), which must be freed with Comm_free().
+   */
+  static MPI_Comm Comm_split_shared( MPI_Comm const comm );
+
+  /**
+   * @brief Wrapper around MPI_Group_translate_ranks() taking communicators instead of groups.
+   * @param[in] comm The communicator \p ranks are given in.
+   * @param[in] n The number of ranks to translate.
+   * @param[in] ranks The ranks in \p comm.
+   * @param[in] targetComm The communicator to translate the ranks to.
+   * @param[out] targetRanks The ranks in \p targetComm, or MPI_UNDEFINED for the ranks that are not part of it.
+   */
+  static void Group_translate_ranks( MPI_Comm const comm,
+                                     int const n,
+                                     int const ranks[],
+                                     MPI_Comm const targetComm,
+                                     int targetRanks[] );
+
+  /**
+   * @brief Wrapper around MPI_Win_allocate_shared().
+   * @param[in] size The size in bytes of the segment of the calling rank.
+   * @param[in] comm A communicator whose ranks all share memory, as built by Comm_split_shared().
+   * @param[out] win The window, which must be freed with Win_free().
+   * @return The address of the segment of the calling rank.
+   */
+  static void * Win_allocate_shared( std::size_t const size, MPI_Comm const comm, MPI_Win & win );
+
+  /**
+   * @brief Wrapper around MPI_Win_shared_query().
+   * @param[in] win A window allocated with Win_allocate_shared().
+   * @param[in] rank The rank within the communicator of \p win whose segment is queried.
+   * @return The address of the segment of \p rank in the address space of the calling rank.
+   */
+  static void * Win_shared_query( MPI_Win const win, int const rank );
+
+  static void Win_free( MPI_Win & win );
+
+  static void Win_lock_all( MPI_Win const win );
+
+  static void Win_unlock_all( MPI_Win const win );
+
+  static void Win_sync( MPI_Win const win );
+
   static int Test( MPI_Request * request, int * flag, MPI_Status * status );
 
   static int Wait( MPI_Request * request, MPI_Status * status );
@@ -196,6 +255,10 @@ public:
 
   static int Waitall( int count, MPI_Request array_of_requests[], MPI_Status array_of_statuses[] );
 
+  static int Startall( int count, MPI_Request array_of_requests[] );
+
+  static int Request_free( MPI_Request * request );
+
   static double Wtime( void );
 
 
@@ -320,6 +383,18 @@ public:
   template< typename T >
   static int allReduce( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Iallreduce.
+   * @param[in] sendbuf The pointer to the sending buffer.
+   * @param[out] recvbuf The pointer to the receive buffer, only valid once @p request has completed.
+   * @param[in] count The number of values to send/receive.
+   * @param[in] op The MPI_Op to perform.
+   * @param[in] comm The MPI_Comm over which the reduction operates.
+   * @param[out] request The MPI_Request to wait on.
+   * @return The return value of the underlying call to MPI_Iallreduce().
+   */
+  template< typename T >
+  static int iAllReduce( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm, MPI_Request * request );
 
   template< typename T >
   static int scan( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm );
@@ -459,6 +534,78 @@ public:
                     MPI_Comm comm,
                     MPI_Request * request );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Send_init()
+   * @param[in] buf The pointer to the buffer that contains the data to be sent.
+   * @param[in] count The number of elements in \p buf.
+   * @param[in] dest The rank of the destination process within \p comm.
+   * @param[in] tag The message tag that is be used to distinguish different types of messages.
+   * @param[in] comm The handle to the MPI_Comm.
+   * @param[out] request Pointer to the persistent MPI_Request associated with this request.
+   * @return The return value of the underlying call to MPI_Send_init().
+   * @note The request must be started with Startall() and released with Request_free().
+   */
+  template< typename T >
+  static int Send_init( T const * const buf,
+                        int count,
+                        int dest,
+                        int tag,
+                        MPI_Comm comm,
+                        MPI_Request * request );
+
+  /**
+   * @brief Strongly typed wrapper around MPI_Recv_init()
+   * @param[out] buf The pointer to the buffer that the data will be received in.
+   * @param[in] count The number of elements in \p buf.
+   * @param[in] source The rank of the source process within \p comm.
+   * @param[in] tag The message tag that is be used to distinguish different types of messages.
+   * @param[in] comm The handle to the MPI_Comm.
+   * @param[out] request Pointer to the persistent MPI_Request associated with this request.
+   * @return The return value of the underlying call to MPI_Recv_init().
+   * @note The request must be started with Startall() and released with Request_free().
+   */
+  template< typename T >
+  static int Recv_init( T * const buf,
+                        int count,
+                        int source,
+                        int tag,
+                        MPI_Comm comm,
+                        MPI_Request * request );
+
+  /**
+   * @brief Strongly typed wrapper around MPI_Neighbor_alltoall()
+   * @param[in] sendbuf The \p count values to send to each neighbor, in the neighbor order of \p comm.
+   * @param[out] recvbuf The \p count values received from each neighbor, in the neighbor order of \p comm.
+   * @param[in] count The number of values exchanged with each neighbor.
+   * @param[in] comm A distributed graph communicator.
+   * @return The return value of the underlying call to MPI_Neighbor_alltoall().
+   */
+  template< typename T >
+  static int Neighbor_alltoall( T const * const sendbuf,
+                                T * const recvbuf,
+                                int count,
+                                MPI_Comm comm );
+
+  /**
+   * @brief Strongly typed wrapper around MPI_Neighbor_alltoallv()
+   * @param[in] sendbuf The buffer holding the data sent to all the neighbors.
+   * @param[in] sendcounts The number of values sent to each neighbor.
+   * @param[in] sdispls The offset in \p sendbuf of the data sent to each neighbor.
+   * @param[out] recvbuf The buffer receiving the data from all the neighbors.
+   * @param[in] recvcounts The number of values received from each neighbor.
+   * @param[in] rdispls The offset in \p recvbuf of the data received from each neighbor.
+   * @param[in] comm A distributed graph communicator.
+   * @return The return value of the underlying call to MPI_Neighbor_alltoallv().
+   */
+  template< typename T >
+  static int Neighbor_alltoallv( T const * const sendbuf,
+                                 int const sendcounts[],
+                                 int const sdispls[],
+                                 T * const recvbuf,
+                                 int const recvcounts[],
+                                 int const rdispls[],
+                                 MPI_Comm comm );
+
   /**
    * @brief Convenience function for a MPI_Reduce using a MPI_MIN operation.
    * @param value the value to send into the reduction.
@@ -626,6 +773,24 @@ int MpiWrapper::allReduce( T const * const sendbuf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::iAllReduce( T const * const sendbuf,
+                            T * const recvbuf,
+                            int count,
+                            MPI_Op MPI_PARAM( op ),
+                            MPI_Comm MPI_PARAM( comm ),
+                            MPI_Request * const request )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_Datatype const MPI_TYPE = getMpiType< T >();
+  return MPI_Iallreduce( sendbuf, recvbuf, count, MPI_TYPE, op, comm, request );
+#else
+  memcpy( recvbuf, sendbuf, count*sizeof(T) );
+  *request = MPI_REQUEST_NULL;
+  return 0;
+#endif
+}
+
 template< typename T >
 int MpiWrapper::scan( T const * const sendbuf,
                       T * const recvbuf,
@@ -850,6 +1015,71 @@ int MpiWrapper::iSend( T const * const buf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::Send_init( T const * const MPI_PARAM( buf ),
+                           int MPI_PARAM( count ),
+                           int MPI_PARAM( dest ),
+                           int MPI_PARAM( tag ),
+                           MPI_Comm MPI_PARAM( comm ),
+                           MPI_Request * MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Send_init( buf, count, getMpiType< T >(), dest, tag, comm, request );
+#else
+  GEOSX_ERROR( "Not implemented." );
+  return MPI_SUCCESS;
+#endif
+}
+
+template< typename T >
+int MpiWrapper::Recv_init( T * const MPI_PARAM( buf ),
+                           int MPI_PARAM( count ),
+                           int MPI_PARAM( source ),
+                           int MPI_PARAM( tag ),
+                           MPI_Comm MPI_PARAM( comm ),
+                           MPI_Request * MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Recv_init( buf, count, getMpiType< T >(), source, tag, comm, request );
+#else
+  GEOSX_ERROR( "Not implemented." );
+  return MPI_SUCCESS;
+#endif
+}
+
+template< typename T >
+int MpiWrapper::Neighbor_alltoall( T const * const MPI_PARAM( sendbuf ),
+                                   T * const MPI_PARAM( recvbuf ),
+                                   int MPI_PARAM( count ),
+                                   MPI_Comm MPI_PARAM( comm ) )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_Datatype const MPI_TYPE = getMpiType< T >();
+  return MPI_Neighbor_alltoall( sendbuf, count, MPI_TYPE, recvbuf, count, MPI_TYPE, comm );
+#else
+  // without MPI there are no neighbors
+  return MPI_SUCCESS;
+#endif
+}
+
+template< typename T >
+int MpiWrapper::Neighbor_alltoallv( T const * const MPI_PARAM( sendbuf ),
+                                    int const MPI_PARAM( sendcounts )[],
+                                    int const MPI_PARAM( sdispls )[],
+                                    T * const MPI_PARAM( recvbuf ),
+                                    int const MPI_PARAM( recvcounts )[],
+                                    int const MPI_PARAM( rdispls )[],
+                                    MPI_Comm MPI_PARAM( comm ) )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_Datatype const MPI_TYPE = getMpiType< T >();
+  return MPI_Neighbor_alltoallv( sendbuf, sendcounts, sdispls, MPI_TYPE, recvbuf, recvcounts, rdispls, MPI_TYPE, comm );
+#else
+  // without MPI there are no neighbors
+  return MPI_SUCCESS;
+#endif
+}
+
 template< typename U, typename T >
 U MpiWrapper::PrefixSum( T const value )
 {
@@ -20,6 +20,9 @@
 #include "mpiCommunications/NeighborCommunicator.hpp"
 
 #include "common/TimingMacros.hpp"
+#include "mpiCommunications/BufferCompression.hpp"
+#include "mpiCommunications/CommunicationStatistics.hpp"
+#include "mpiCommunications/CommunicationTools.hpp"
 #include "managers/ObjectManagerBase.hpp"
 #include "mesh/MeshLevel.hpp"
 #include <sys/time.h>
@@ -29,16 +32,124 @@ namespace geosx
 
 using namespace dataRepository;
 
+namespace
+{
+
+/**
+ * @brief Pack the fields of the modified objects of a send list, preceded by their positions in the list.
+ * @tparam DO_PACKING whether to pack, or only compute the size
+ * @param buffer the buffer to pack into
+ * @param manager the manager of the objects
+ * @param wrapperNames the fields to pack
+ * @param ghostsToSend the send list
+ * @param modifiedObjects the sorted local indices of the modified objects
+ * @param on_device whether the fields are packed from the device
+ * @return the number of bytes packed
+ */
+template< bool DO_PACKING >
+int packModifiedForSync( buffer_unit_type * & buffer,
+                         ObjectManagerBase const & manager,
+                         string_array const & wrapperNames,
+                         arrayView1d< localIndex const > const & ghostsToSend,
+                         SortedArrayView< localIndex const > const & modifiedObjects,
+                         bool const on_device )
+{
+  array1d< localIndex > positions;
+  array1d< localIndex > packList;
+  if( !modifiedObjects.empty() )
+  {
+    for( localIndex k = 0; k < ghostsToSend.size(); ++k )
+    {
+      if( modifiedObjects.contains( ghostsToSend[k] ) )
+      {
+        positions.emplace_back( k );
+        packList.emplace_back( ghostsToSend[k] );
+      }
+    }
+  }
+
+  localIndex packedSize = bufferOps::Pack< DO_PACKING >( buffer, positions.toViewConst() );
+  if( DO_PACKING )
+  {
+    packedSize += manager.Pack( buffer, wrapperNames, packList, 0, on_device );
+  }
+  else
+  {
+    packedSize += manager.PackSize( wrapperNames, packList, 0, on_device );
+  }
+  return LvArray::integerConversion< int >( packedSize );
+}
+
+/**
+ * @brief Unpack the fields packed by packModifiedForSync into the matching ghosts of a receive list.
+ * @param buffer the buffer to unpack from
+ * @param manager the manager of the objects
+ * @param ghostsToReceive the receive list
+ * @param on_device whether the fields are unpacked on the device
+ * @return the number of bytes unpacked
+ */
+int unpackModifiedForSync( buffer_unit_type const * & buffer,
+                           ObjectManagerBase & manager,
+                           arrayView1d< localIndex const > const & ghostsToReceive,
+                           bool const on_device )
+{
+  array1d< localIndex > positions;
+  localIndex unpackedSize = bufferOps::Unpack( buffer, positions );
+
+  array1d< localIndex > unpackList( positions.size() );
+  for( localIndex k = 0; k < positions.size(); ++k )
+  {
+    unpackList[k] = ghostsToReceive[ positions[k] ];
+  }
+
+  arrayView1d< localIndex > unpackListView = unpackList.toView();
+  unpackedSize += manager.Unpack( buffer, unpackListView, 0, on_device );
+  return LvArray::integerConversion< int >( unpackedSize );
+}
+
+/// The object types that can be synchronized for the modified objects only
+char const * const modifiedSyncObjectTypes[3] = { "node", "edge", "face" };
+
+/**
+ * @brief Get the manager of an object type synchronized for the modified objects only.
+ * @param mesh the mesh level
+ * @param objectType the object type, one of modifiedSyncObjectTypes
+ * @return the manager
+ */
+ObjectManagerBase const & getModifiedSyncManager( MeshLevel const & mesh, string const & objectType )
+{
+  if( objectType == "node" )
+  {
+    return *mesh.getNodeManager();
+  }
+  if( objectType == "edge" )
+  {
+    return *mesh.getEdgeManager();
+  }
+  return *mesh.getFaceManager();
+}
+
+/**
+ * @copydoc getModifiedSyncManager( MeshLevel const &, string const & )
+ */
+ObjectManagerBase & getModifiedSyncManager( MeshLevel & mesh, string const & objectType )
+{
+  if( objectType == "node" )
+  {
+    return *mesh.getNodeManager();
+  }
+  if( objectType == "edge" )
+  {
+    return *mesh.getEdgeManager();
+  }
+  return *mesh.getFaceManager();
+}
+
+}
+
 NeighborCommunicator::NeighborCommunicator():
   m_neighborRank( -1 ),
-  m_sendBufferSize(),
-  m_receiveBufferSize(),
-  m_sendBuffer{ maxComm },
-  m_receiveBuffer{ maxComm },
-  m_mpiSendBufferRequest(),
-  m_mpiRecvBufferRequest(),
-  m_mpiSendBufferStatus(),
-  m_mpiRecvBufferStatus()
+  m_contexts()
 { }
 
 void NeighborCommunicator::MPI_iSendReceive( buffer_unit_type const * const sendBuffer,
@@ -67,14 +178,66 @@ void NeighborCommunicator::MPI_iSendReceive( buffer_unit_type const * const send
                      receiveTag,
                      mpiComm,
                      &receiveRequest );
+
+  recordPost( commID, sendSize, receiveSize );
+}
+
+void NeighborCommunicator::recordPost( int const commID, int const sendSize, int const receiveSize ) const
+{
+  if( !CommunicationStatistics::isEnabled() )
+  {
+    return;
+  }
+
+  if( sendSize >= 0 )
+  {
+    CommunicationStatistics::recordSend( m_neighborRank, sendSize );
+  }
+  if( receiveSize >= 0 )
+  {
+    CommunicationStatistics::recordReceive( m_neighborRank, receiveSize );
+  }
+  context( commID ).postTime = MpiWrapper::Wtime();
+}
+
+void NeighborCommunicator::recordCompletion( int const commID ) const
+{
+  if( CommunicationStatistics::isEnabled() )
+  {
+    CommunicationStatistics::recordLatency( m_neighborRank, MpiWrapper::Wtime() - context( commID ).postTime );
+  }
+}
+
+void NeighborCommunicator::compressSetupSendBuffer( int const commID, int const packedSize )
+{
+  if( !CommunicationTools::getCompressGhostBuffers() )
+  {
+    return;
+  }
+
+  buffer_type compressed;
+  bufferCompression::compress( SendBuffer( commID ).data(), packedSize, compressed );
+  this->resizeSendBuffer( commID, LvArray::integerConversion< int >( compressed.size() ) );
+  std::copy( compressed.begin(), compressed.end(), SendBuffer( commID ).begin() );
+}
+
+buffer_type const & NeighborCommunicator::setupReceiveBuffer( int const commID, buffer_type & decompressed ) const
+{
+  if( !CommunicationTools::getCompressGhostBuffers() )
+  {
+    return ReceiveBuffer( commID );
+  }
+
+  bufferCompression::decompress( ReceiveBuffer( commID ).data(), ReceiveBufferSize( commID ), decompressed );
+  return decompressed;
 }
 
 void NeighborCommunicator::MPI_iSendReceiveBufferSizes( int const commID,
                                                         MPI_Comm mpiComm )
 {
   MPI_iSendReceiveBufferSizes( commID,
-                               m_mpiSendBufferRequest[commID],
-                               m_mpiRecvBufferRequest[commID],
+                               context( commID ).mpiSendBufferRequest,
+                               context( commID ).mpiRecvBufferRequest,
                                mpiComm );
 }
 
@@ -83,9 +246,9 @@ void NeighborCommunicator::MPI_iSendReceiveBufferSizes( int const commID,
                                                         MPI_Request & mpiRecvRequest,
                                                         MPI_Comm mpiComm )
 {
-//  m_sendBufferSize[commID] = LvArray::integerConversion<int>( m_sendBuffer[commID].size());
-  MPI_iSendReceive( &m_sendBufferSize[commID], 1, mpiSendRequest,
-                    &m_receiveBufferSize[commID],
+//  context( commID ).sendBufferSize = LvArray::integerConversion<int>( context( commID ).sendBuffer.size());
+  MPI_iSendReceive( &context( commID ).sendBufferSize, 1, mpiSendRequest,
+                    &context( commID ).receiveBufferSize,
                     1, mpiRecvRequest,
                     commID,
                     mpiComm );
@@ -95,8 +258,8 @@ void NeighborCommunicator::MPI_iSendReceiveBuffers( int const commID,
                                                     MPI_Comm mpiComm )
 {
   MPI_iSendReceiveBuffers( commID,
-                           m_mpiSendBufferRequest[commID],
-                           m_mpiRecvBufferRequest[commID],
+                           context( commID ).mpiSendBufferRequest,
+                           context( commID ).mpiRecvBufferRequest,
                            mpiComm );
 }
 
@@ -105,13 +268,13 @@ void NeighborCommunicator::MPI_iSendReceiveBuffers( int const commID,
                                                     MPI_Request & mpiRecvRequest,
                                                     MPI_Comm mpiComm )
 {
-  m_receiveBuffer[commID].resize( m_receiveBufferSize[commID] );
+  context( commID ).receiveBuffer.resize( context( commID ).receiveBufferSize );
 
-  MPI_iSendReceive( m_sendBuffer[commID].data(),
-                    LvArray::integerConversion< int >( m_sendBuffer[commID].size()),
+  MPI_iSendReceive( context( commID ).sendBuffer.data(),
+                    LvArray::integerConversion< int >( context( commID ).sendBuffer.size()),
                     mpiSendRequest,
-                    m_receiveBuffer[commID].data(),
-                    LvArray::integerConversion< int >( m_receiveBuffer[commID].size()),
+                    context( commID ).receiveBuffer.data(),
+                    LvArray::integerConversion< int >( context( commID ).receiveBuffer.size()),
                     mpiRecvRequest,
                     commID,
                     mpiComm );
@@ -122,8 +285,8 @@ void NeighborCommunicator::MPI_iSendReceive( int const commID,
                                              MPI_Comm mpiComm )
 {
   MPI_iSendReceive( commID,
-                    m_mpiSendBufferRequest[commID],
-                    m_mpiRecvBufferRequest[commID],
+                    context( commID ).mpiSendBufferRequest,
+                    context( commID ).mpiRecvBufferRequest,
                     mpiComm );
 }
 
@@ -134,16 +297,19 @@ void NeighborCommunicator::MPI_iSendReceive( int const commID,
 {
   MPI_iSendReceiveBufferSizes( commID, mpiComm );
 
-  MpiWrapper::Waitall( 1, &( m_mpiRecvBufferRequest[commID] ), &( m_mpiRecvBufferStatus[commID] ) );
-  MpiWrapper::Waitall( 1, &( m_mpiSendBufferRequest[commID] ), &( m_mpiSendBufferStatus[commID] ) );
+  {
+    CommunicationStatistics::ScopedWait const wait;
+    MpiWrapper::Waitall( 1, &( context( commID ).mpiRecvBufferRequest ), &( context( commID ).mpiRecvBufferStatus ) );
+    MpiWrapper::Waitall( 1, &( context( commID ).mpiSendBufferRequest ), &( context( commID ).mpiSendBufferStatus ) );
+  }
 
-  m_receiveBuffer[commID].resize( m_receiveBufferSize[commID] );
+  context( commID ).receiveBuffer.resize( context( commID ).receiveBufferSize );
 
-  MPI_iSendReceive( m_sendBuffer[commID].data(),
-                    m_sendBufferSize[commID],
+  MPI_iSendReceive( context( commID ).sendBuffer.data(),
+                    context( commID ).sendBufferSize,
                     mpiSendRequest,
-                    m_receiveBuffer[commID].data(),
-                    m_receiveBufferSize[commID],
+                    context( commID ).receiveBuffer.data(),
+                    context( commID ).receiveBufferSize,
                     mpiRecvRequest,
                     commID,
                     mpiComm );
@@ -156,24 +322,27 @@ void NeighborCommunicator::MPI_iSendReceive( buffer_unit_type const * const send
 {
   MPI_iSendReceive( &sendSize,
                     1,
-                    m_mpiSendBufferRequest[commID],
-                    &m_receiveBufferSize[commID],
+                    context( commID ).mpiSendBufferRequest,
+                    &context( commID ).receiveBufferSize,
                     1,
-                    m_mpiRecvBufferRequest[commID],
+                    context( commID ).mpiRecvBufferRequest,
                     commID,
                     mpiComm );
 
-  MpiWrapper::Waitall( 1, &( m_mpiRecvBufferRequest[commID] ), &( m_mpiRecvBufferStatus[commID] ) );
-  MpiWrapper::Waitall( 1, &( m_mpiSendBufferRequest[commID] ), &( m_mpiSendBufferStatus[commID] ) );
+  {
+    CommunicationStatistics::ScopedWait const wait;
+    MpiWrapper::Waitall( 1, &( context( commID ).mpiRecvBufferRequest ), &( context( commID ).mpiRecvBufferStatus ) );
+    MpiWrapper::Waitall( 1, &( context( commID ).mpiSendBufferRequest ), &( context( commID ).mpiSendBufferStatus ) );
+  }
 
-  m_receiveBuffer[commID].resize( m_receiveBufferSize[commID] );
+  context( commID ).receiveBuffer.resize( context( commID ).receiveBufferSize );
 
   MPI_iSendReceive( sendBuffer,
                     sendSize,
-                    m_mpiSendBufferRequest[commID],
-                    m_receiveBuffer[commID].data(),
-                    m_receiveBufferSize[commID],
-                    m_mpiRecvBufferRequest[commID],
+                    context( commID ).mpiSendBufferRequest,
+                    context( commID ).receiveBuffer.data(),
+                    context( commID ).receiveBufferSize,
+                    context( commID ).mpiRecvBufferRequest,
                     commID,
                     mpiComm );
 }
@@ -185,22 +354,28 @@ void NeighborCommunicator::MPI_WaitAll( int const GEOSX_UNUSED_PARAM( commID ),
                                         MPI_Status & mpiReceiveStatus )
 
 {
+  CommunicationStatistics::ScopedWait const wait;
   MpiWrapper::Waitall( 1, &mpiRecvRequest, &mpiReceiveStatus );
   MpiWrapper::Waitall( 1, &mpiSendRequest, &mpiSendStatus );
 }
 
 void NeighborCommunicator::MPI_WaitAll( int const commID )
 {
-  MpiWrapper::Waitall( 1, &( m_mpiRecvBufferRequest[commID] ), &( m_mpiRecvBufferStatus[commID] ) );
-  MpiWrapper::Waitall( 1, &( m_mpiSendBufferRequest[commID] ), &( m_mpiSendBufferStatus[commID] ) );
+  {
+    CommunicationStatistics::ScopedWait const wait;
+    MpiWrapper::Waitall( 1, &( context( commID ).mpiRecvBufferRequest ), &( context( commID ).mpiRecvBufferStatus ) );
+  }
+  recordCompletion( commID );
+  CommunicationStatistics::ScopedWait const wait;
+  MpiWrapper::Waitall( 1, &( context( commID ).mpiSendBufferRequest ), &( context( commID ).mpiSendBufferStatus ) );
 }
 
 void NeighborCommunicator::Clear()
 {
-  for( int i = 0; i < maxComm; ++i )
+  for( CommContext & ctx : m_contexts )
   {
-    m_sendBuffer[i].clear();
-    m_receiveBuffer[i].clear();
+    ctx.sendBuffer.clear();
+    ctx.receiveBuffer.clear();
   }
 }
 
@@ -219,56 +394,60 @@ void NeighborCommunicator::AddNeighborGroupToMesh( MeshLevel & mesh ) const
 int NeighborCommunicator::PostSizeRecv( int const commID )
 {
   int const recvTag = 101; //CommTag( m_neighborRank, MpiWrapper::Comm_rank(), commID );
-  return MpiWrapper::iRecv( &m_receiveBufferSize[commID],
+  recordPost( commID, -1, sizeof( int ) );
+  return MpiWrapper::iRecv( &context( commID ).receiveBufferSize,
                             1,
                             m_neighborRank,
                             recvTag,
                             MPI_COMM_GEOSX,
-                            &m_mpiRecvSizeRequest[commID] );
+                            &context( commID ).mpiRecvSizeRequest );
 }
 
 MPI_Request NeighborCommunicator::GetSizeRecvRequest( int const commID )
 {
-  return m_mpiRecvSizeRequest[commID];
+  return context( commID ).mpiRecvSizeRequest;
 }
 
 int NeighborCommunicator::PostSizeSend( int const commID )
 {
   int const sendTag = 101; //CommTag( m_neighborRank, MpiWrapper::Comm_rank(), commID );
-  return MpiWrapper::iSend( &m_sendBufferSize[commID],
+  recordPost( commID, sizeof( int ), -1 );
+  return MpiWrapper::iSend( &context( commID ).sendBufferSize,
                             1,
                             m_neighborRank,
                             sendTag,
                             MPI_COMM_GEOSX,
-                            &m_mpiSendSizeRequest[commID] );
+                            &context( commID ).mpiSendSizeRequest );
 }
 
 int NeighborCommunicator::PostRecv( int const commID )
 {
   int const recvTag = 102; //CommTag( m_neighborRank, MpiWrapper::Comm_rank(), commID );
-  m_receiveBuffer[commID].resize( m_receiveBufferSize[commID] );
-  return MpiWrapper::iRecv( m_receiveBuffer[commID].data(),
-                            m_receiveBufferSize[commID],
+  context( commID ).receiveBuffer.resize( context( commID ).receiveBufferSize );
+  recordPost( commID, -1, context( commID ).receiveBufferSize );
+  return MpiWrapper::iRecv( context( commID ).receiveBuffer.data(),
+                            context( commID ).receiveBufferSize,
                             m_neighborRank,
                             recvTag,
                             MPI_COMM_GEOSX,
-                            &m_mpiRecvBufferRequest[commID] );
+                            &context( commID ).mpiRecvBufferRequest );
 }
 
 MPI_Request NeighborCommunicator::GetRecvRequest( int const commID )
 {
-  return m_mpiRecvBufferRequest[commID];
+  return context( commID ).mpiRecvBufferRequest;
 }
 
 int NeighborCommunicator::PostSend( int const commID )
 {
   int const sendTag = 102; //CommTag( m_neighborRank, MpiWrapper::Comm_rank(), commID );
-  return MpiWrapper::iSend( m_sendBuffer[commID].data(),
-                            m_sendBufferSize[commID],
+  recordPost( commID, context( commID ).sendBufferSize, -1 );
+  return MpiWrapper::iSend( context( commID ).sendBuffer.data(),
+                            context( commID ).sendBufferSize,
                             m_neighborRank,
                             sendTag,
                             MPI_COMM_GEOSX,
-                            &m_mpiSendBufferRequest[commID] );
+                            &context( commID ).mpiSendBufferRequest );
 }
 
 using ElemAdjListViewType = ElementRegionManager::ElementViewAccessor< arrayView1d< localIndex > >;
@@ -327,6 +506,18 @@ void NeighborCommunicator::PrepareAndSendGhosts( bool const GEOSX_UNUSED_PARAM(
 
   this->PostSizeRecv( commID ); // post recv for buffer size from neighbor.
 
+  PrepareGhosts( depth, mesh, commID );
+
+  this->PostSizeSend( commID );
+  this->PostSend( commID );
+}
+
+void NeighborCommunicator::PrepareGhosts( integer const depth,
+                                          MeshLevel & mesh,
+                                          int const commID )
+{
+  GEOSX_MARK_FUNCTION;
+
   NodeManager & nodeManager = *(mesh.getNodeManager());
   EdgeManager & edgeManager = *(mesh.getEdgeManager());
   FaceManager & faceManager = *(mesh.getFaceManager());
@@ -359,7 +550,6 @@ void NeighborCommunicator::PrepareAndSendGhosts( bool const GEOSX_UNUSED_PARAM(
                                     elemManager, elemAdjacencyList );
 
   this->resizeSendBuffer( commID, bufferSize );
-  this->PostSizeSend( commID );
 
   buffer_type & sendBuffer = SendBuffer( commID );
   buffer_unit_type * sendBufferPtr = sendBuffer.data();
@@ -372,7 +562,7 @@ void NeighborCommunicator::PrepareAndSendGhosts( bool const GEOSX_UNUSED_PARAM(
 
   GEOSX_ERROR_IF_NE( bufferSize, packedSize );
 
-  this->PostSend( commID );
+  compressSetupSendBuffer( commID, packedSize );
 }
 
 void NeighborCommunicator::UnpackGhosts( MeshLevel & mesh,
@@ -385,7 +575,8 @@ void NeighborCommunicator::UnpackGhosts( MeshLevel & mesh,
   FaceManager & faceManager = *(mesh.getFaceManager());
   ElementRegionManager & elemManager = *(mesh.getElemManager());
 
-  buffer_type const & receiveBuffer = ReceiveBuffer( commID );
+  buffer_type decompressedBuffer;
+  buffer_type const & receiveBuffer = setupReceiveBuffer( commID, decompressedBuffer );
   buffer_unit_type const * receiveBufferPtr = receiveBuffer.data();
 
   int unpackedSize = 0;
@@ -427,6 +618,17 @@ void NeighborCommunicator::PrepareAndSendSyncLists( MeshLevel const & mesh,
 
   this->PostSizeRecv( commID );
 
+  PrepareSyncLists( mesh, commID );
+
+  this->PostSizeSend( commID );
+  this->PostSend( commID );
+}
+
+void NeighborCommunicator::PrepareSyncLists( MeshLevel const & mesh,
+                                             int const commID )
+{
+  GEOSX_MARK_FUNCTION;
+
   NodeManager const & nodeManager = *(mesh.getNodeManager());
   EdgeManager const & edgeManager = *(mesh.getEdgeManager());
   FaceManager const & faceManager = *(mesh.getFaceManager());
@@ -474,7 +676,7 @@ void NeighborCommunicator::PrepareAndSendSyncLists( MeshLevel const & mesh,
   } );
 
   this->resizeSendBuffer( commID, bufferSize );
-  this->PostSizeSend( commID );
+  sendBufferPtr = sendBuffer.data();
 
   int packedSize = 0;
   packedSize += bufferOps::Pack< true >( sendBufferPtr,
@@ -508,7 +710,7 @@ void NeighborCommunicator::PrepareAndSendSyncLists( MeshLevel const & mesh,
 
   GEOSX_ERROR_IF( bufferSize != packedSize, "Allocated Buffer Size is not equal to packed buffer size" );
 
-  this->PostSend( commID );
+  compressSetupSendBuffer( commID, packedSize );
 }
 
 void NeighborCommunicator::UnpackAndRebuildSyncLists( MeshLevel & mesh,
@@ -525,7 +727,8 @@ void NeighborCommunicator::UnpackAndRebuildSyncLists( MeshLevel & mesh,
   localIndex_array & edgeGhostsToSend = edgeManager.getNeighborData( m_neighborRank ).ghostsToSend();
   localIndex_array & faceGhostsToSend = faceManager.getNeighborData( m_neighborRank ).ghostsToSend();
 
-  buffer_type const & receiveBuffer = ReceiveBuffer( commID );
+  buffer_type decompressedBuffer;
+  buffer_type const & receiveBuffer = setupReceiveBuffer( commID, decompressedBuffer );
   buffer_unit_type const * receiveBufferPtr = receiveBuffer.data();
 
   bufferOps::UnpackSyncList( receiveBufferPtr,
@@ -595,7 +798,7 @@ int NeighborCommunicator::PackCommSizeForSync( std::map< string, string_array >
     } );
   }
 
-  this->m_sendBufferSize[commID] = bufferSize;
+  this->context( commID ).sendBufferSize = bufferSize;
   return bufferSize;
 }
 
@@ -607,6 +810,19 @@ void NeighborCommunicator::PackCommBufferForSync( std::map< string, string_array
 {
   GEOSX_MARK_FUNCTION;
 
+  buffer_type & sendBuffer = SendBuffer( commID );
+  int const bufferSize =  LvArray::integerConversion< int >( sendBuffer.size());
+
+  int const packedSize = PackCommBufferForSync( fieldNames, mesh, sendBuffer.data(), on_device );
+
+  GEOSX_ERROR_IF_NE( bufferSize, packedSize );
+}
+
+int NeighborCommunicator::PackCommBufferForSync( std::map< string, string_array > const & fieldNames,
+                                                 MeshLevel const & mesh,
+                                                 buffer_unit_type * sendBufferPtr,
+                                                 bool on_device ) const
+{
   NodeManager const & nodeManager = *(mesh.getNodeManager());
   EdgeManager const & edgeManager = *(mesh.getEdgeManager());
   FaceManager const & faceManager = *(mesh.getFaceManager());
@@ -616,10 +832,6 @@ void NeighborCommunicator::PackCommBufferForSync( std::map< string, string_array
   arrayView1d< localIndex const > const & edgeGhostsToSend = edgeManager.getNeighborData( m_neighborRank ).ghostsToSend();
   arrayView1d< localIndex const > const & faceGhostsToSend = faceManager.getNeighborData( m_neighborRank ).ghostsToSend();
 
-  buffer_type & sendBuffer = SendBuffer( commID );
-  int const bufferSize =  LvArray::integerConversion< int >( sendBuffer.size());
-  buffer_unit_type * sendBufferPtr = sendBuffer.data();
-
   int packedSize = 0;
   if( fieldNames.count( "node" ) > 0 )
   {
@@ -644,9 +856,87 @@ void NeighborCommunicator::PackCommBufferForSync( std::map< string, string_array
     } );
   }
 
-  GEOSX_ERROR_IF_NE( bufferSize, packedSize );
+  return packedSize;
+}
+
+
+int NeighborCommunicator::PackCommSizeForModifiedSync( std::map< string, string_array > const & fieldNames,
+                                                       MeshLevel const & mesh,
+                                                       std::map< string, SortedArrayView< localIndex const > > const & modifiedObjects,
+                                                       int const commID,
+                                                       bool on_device )
+{
+  GEOSX_MARK_FUNCTION;
+
+  buffer_unit_type * junk = nullptr;
+  int bufferSize = 0;
+  for( char const * const objectType : modifiedSyncObjectTypes )
+  {
+    if( fieldNames.count( objectType ) > 0 )
+    {
+      ObjectManagerBase const & manager = getModifiedSyncManager( mesh, objectType );
+      bufferSize += packModifiedForSync< false >( junk,
+                                                  manager,
+                                                  fieldNames.at( objectType ),
+                                                  manager.getNeighborData( m_neighborRank ).ghostsToSend(),
+                                                  modifiedObjects.at( objectType ),
+                                                  on_device );
+    }
+  }
+
+  this->context( commID ).sendBufferSize = bufferSize;
+  return bufferSize;
+}
+
+void NeighborCommunicator::PackCommBufferForModifiedSync( std::map< string, string_array > const & fieldNames,
+                                                          MeshLevel const & mesh,
+                                                          std::map< string, SortedArrayView< localIndex const > > const & modifiedObjects,
+                                                          int const commID,
+                                                          bool on_device )
+{
+  GEOSX_MARK_FUNCTION;
+
+  buffer_type & sendBuffer = SendBuffer( commID );
+  buffer_unit_type * sendBufferPtr = sendBuffer.data();
+
+  int packedSize = 0;
+  for( char const * const objectType : modifiedSyncObjectTypes )
+  {
+    if( fieldNames.count( objectType ) > 0 )
+    {
+      ObjectManagerBase const & manager = getModifiedSyncManager( mesh, objectType );
+      packedSize += packModifiedForSync< true >( sendBufferPtr,
+                                                 manager,
+                                                 fieldNames.at( objectType ),
+                                                 manager.getNeighborData( m_neighborRank ).ghostsToSend(),
+                                                 modifiedObjects.at( objectType ),
+                                                 on_device );
+    }
+  }
+
+  GEOSX_ERROR_IF_NE( LvArray::integerConversion< int >( sendBuffer.size() ), packedSize );
 }
 
+void NeighborCommunicator::UnpackBufferForModifiedSync( std::map< string, string_array > const & fieldNames,
+                                                        MeshLevel & mesh,
+                                                        int const commID,
+                                                        bool on_device )
+{
+  GEOSX_MARK_FUNCTION;
+
+  buffer_unit_type const * receiveBufferPtr = ReceiveBuffer( commID ).data();
+  for( char const * const objectType : modifiedSyncObjectTypes )
+  {
+    if( fieldNames.count( objectType ) > 0 )
+    {
+      ObjectManagerBase & manager = getModifiedSyncManager( mesh, objectType );
+      unpackModifiedForSync( receiveBufferPtr,
+                             manager,
+                             manager.getNeighborData( m_neighborRank ).ghostsToReceive(),
+                             on_device );
+    }
+  }
+}
 
 void NeighborCommunicator::SendRecvBuffers( int const commID )
 {
@@ -662,8 +952,14 @@ void NeighborCommunicator::UnpackBufferForSync( std::map< string, string_array >
   GEOSX_MARK_FUNCTION;
 
   buffer_type const & receiveBuffer = ReceiveBuffer( commID );
-  buffer_unit_type const * receiveBufferPtr = receiveBuffer.data();
+  UnpackBufferForSync( fieldNames, mesh, receiveBuffer.data(), on_device );
+}
 
+int NeighborCommunicator::UnpackBufferForSync( std::map< string, string_array > const & fieldNames,
+                                               MeshLevel * const mesh,
+                                               buffer_unit_type const * receiveBufferPtr,
+                                               bool on_device )
+{
   NodeManager & nodeManager = *(mesh->getNodeManager());
   EdgeManager & edgeManager = *(mesh->getEdgeManager());
   FaceManager & faceManager = *(mesh->getFaceManager());
@@ -697,6 +993,8 @@ void NeighborCommunicator::UnpackBufferForSync( std::map< string, string_array >
       unpackedSize += subRegion.Unpack( receiveBufferPtr, subRegion.getNeighborData( m_neighborRank ).ghostsToReceive(), 0, on_device );
     } );
   }
+
+  return unpackedSize;
 }
 
 
@@ -25,6 +25,8 @@
 #include "dataRepository/ReferenceWrapper.hpp"
 #include "LvArray/src/limits.hpp"
 
+#include <deque>
+
 namespace geosx
 {
 inline int CommTag( int const GEOSX_UNUSED_PARAM( senderRank ),
@@ -120,9 +122,9 @@ public:
                          MPI_Comm mpiComm )
   {
     MPI_iSendReceive( sendBuffer,
-                      m_mpiSendBufferRequest[commID],
+                      context( commID ).mpiSendBufferRequest,
                       recvBuffer,
-                      m_mpiRecvBufferRequest[commID],
+                      context( commID ).mpiRecvBufferRequest,
                       commID,
                       mpiComm );
   }
@@ -219,6 +221,15 @@ public:
    */
   int PostSend( int const commID );
 
+  /**
+   * Generates the adjacency lists and packs the ghost
+   *  information for m_neighborRank into the send buffer
+   *  of commID, without posting any communication.
+   */
+  void PrepareGhosts( int const depth,
+                      MeshLevel & meshLevel,
+                      int const commID );
+
   /**
    * Posts non-blocking sends to m_neighborRank for
    *  both the size and regular communication buffers
@@ -243,6 +254,14 @@ public:
   void UnpackGhosts( MeshLevel & meshLevel,
                      int const commID );
 
+  /**
+   * Packs the synchronization lists for m_neighborRank
+   *  into the send buffer of commID, without posting
+   *  any communication.
+   */
+  void PrepareSyncLists( MeshLevel const & meshLevel,
+                         int const commID );
+
   /**
    * Posts non-blocking sends to m_neighborRank for
    *  both the size and regular communication buffers
@@ -270,11 +289,68 @@ public:
                               int const commID,
                               bool on_device = false );
 
+  /**
+   * @brief Pack the synchronized fields into a caller-owned buffer.
+   * @param fieldNames map from object type ("node", "edge", "face", "elems") to the fields to pack
+   * @param meshLevel the mesh containing the objects to pack
+   * @param sendBufferPtr pointer to the beginning of a buffer sized with PackCommSizeForSync
+   * @param on_device whether the fields are packed from the device
+   * @return the number of bytes packed
+   */
+  int PackCommBufferForSync( std::map< string, string_array > const & fieldNames,
+                             MeshLevel const & meshLevel,
+                             buffer_unit_type * sendBufferPtr,
+                             bool on_device = false ) const;
+
   int PackCommSizeForSync( std::map< string, string_array > const & fieldNames,
                            MeshLevel const & meshLevel,
                            int const commID,
                            bool on_device = false );
 
+  /**
+   * @brief Compute the size of the buffer synchronizing the fields of the modified objects of the send lists.
+   * @param fieldNames map from object type ("node", "edge", "face") to the fields to pack
+   * @param meshLevel the mesh containing the objects to pack
+   * @param modifiedObjects map from each object type of @p fieldNames to the sorted local indices of its modified objects
+   * @param commID the communication ID
+   * @param on_device whether the fields are packed from the device
+   * @return the size of the buffer
+   */
+  int PackCommSizeForModifiedSync( std::map< string, string_array > const & fieldNames,
+                                   MeshLevel const & meshLevel,
+                                   std::map< string, SortedArrayView< localIndex const > > const & modifiedObjects,
+                                   int const commID,
+                                   bool on_device = false );
+
+  /**
+   * @brief Pack the fields of the modified objects of the send lists into the send buffer of @p commID.
+   * @param fieldNames map from object type ("node", "edge", "face") to the fields to pack
+   * @param meshLevel the mesh containing the objects to pack
+   * @param modifiedObjects map from each object type of @p fieldNames to the sorted local indices of its modified objects
+   * @param commID the communication ID, whose send buffer was sized with PackCommSizeForModifiedSync
+   * @param on_device whether the fields are packed from the device
+   *
+   * The objects are packed with their positions in the send lists, so that the neighbor unpacks them
+   * in the matching entries of its receive lists.
+   */
+  void PackCommBufferForModifiedSync( std::map< string, string_array > const & fieldNames,
+                                      MeshLevel const & meshLevel,
+                                      std::map< string, SortedArrayView< localIndex const > > const & modifiedObjects,
+                                      int const commID,
+                                      bool on_device = false );
+
+  /**
+   * @brief Unpack the fields packed by PackCommBufferForModifiedSync into the ghosts.
+   * @param fieldNames map from object type ("node", "edge", "face") to the fields to unpack
+   * @param meshLevel the mesh containing the objects to unpack
+   * @param commID the communication ID
+   * @param on_device whether the fields are unpacked on the device
+   */
+  void UnpackBufferForModifiedSync( std::map< string, string_array > const & fieldNames,
+                                    MeshLevel & meshLevel,
+                                    int const commID,
+                                    bool on_device = false );
+
   void SendRecvBuffers( int const commID );
 
   void UnpackBufferForSync( std::map< string, string_array > const & fieldNames,
@@ -282,72 +358,145 @@ public:
                             int const commID,
                             bool on_device = false );
 
+  /**
+   * @brief Unpack the synchronized fields from a caller-owned buffer.
+   * @param fieldNames map from object type ("node", "edge", "face", "elems") to the fields to unpack
+   * @param meshLevel the mesh containing the objects to unpack
+   * @param receiveBufferPtr pointer to the beginning of the received data
+   * @param on_device whether the fields are unpacked on the device
+   * @return the number of bytes unpacked
+   */
+  int UnpackBufferForSync( std::map< string, string_array > const & fieldNames,
+                           MeshLevel * const meshLevel,
+                           buffer_unit_type const * receiveBufferPtr,
+                           bool on_device = false );
+
   void SetNeighborRank( int const rank ) { m_neighborRank = rank; }
   int NeighborRank() const { return m_neighborRank; }
 
   void Clear();
 
-  static int constexpr maxComm = 100;
-
   buffer_type const & ReceiveBuffer( int commID ) const
   {
-    return m_receiveBuffer[commID];
+    return context( commID ).receiveBuffer;
   }
   buffer_type & ReceiveBuffer( int commID )
   {
-    return m_receiveBuffer[commID];
+    return context( commID ).receiveBuffer;
   }
 
   int const & ReceiveBufferSize( int commID ) const
   {
-    return m_receiveBufferSize[commID];
+    return context( commID ).receiveBufferSize;
   }
   int & ReceiveBufferSize( int commID )
   {
-    return m_receiveBufferSize[commID];
+    return context( commID ).receiveBufferSize;
   }
 
 
   buffer_type const & SendBuffer( int commID ) const
   {
-    return m_sendBuffer[commID];
+    return context( commID ).sendBuffer;
   }
   buffer_type & SendBuffer( int commID )
   {
-    return m_sendBuffer[commID];
+    return context( commID ).sendBuffer;
   }
 
   void resizeSendBuffer( int const commID, int const newSize )
   {
-    m_sendBufferSize[commID] = newSize;
-    m_sendBuffer[commID].resize( newSize );
+    CommContext & ctx = context( commID );
+    ctx.sendBufferSize = newSize;
+    ctx.sendBuffer.resize( newSize );
   }
 
   void resizeRecvBuffer( int const commID, int const newSize )
   {
-    m_receiveBufferSize[commID] = newSize;
-    m_receiveBuffer[commID].resize( newSize );
+    CommContext & ctx = context( commID );
+    ctx.receiveBufferSize = newSize;
+    ctx.receiveBuffer.resize( newSize );
   }
 
   void AddNeighborGroupToMesh( MeshLevel & mesh ) const;
 
+  /**
+   * @brief Record the latency of the messages of @p commID, once their receive has completed.
+   * @param commID the communication ID
+   */
+  void recordCompletion( int const commID ) const;
+
 private:
-  int m_neighborRank;
 
-  int m_sendBufferSize[maxComm];
-  int m_receiveBufferSize[maxComm];
+  /**
+   * @brief Record the messages posted for @p commID in the communication statistics.
+   * @param commID the communication ID
+   * @param sendSize the number of bytes sent, or -1 if nothing is sent
+   * @param receiveSize the number of bytes received, or -1 if nothing is received
+   */
+  void recordPost( int const commID, int const sendSize, int const receiveSize ) const;
+
+  /**
+   * @brief Compress the packed send buffer of @p commID if the ghost-setup buffers are compressed.
+   * @param commID the communication ID
+   * @param packedSize the number of bytes packed in the send buffer
+   */
+  void compressSetupSendBuffer( int const commID, int const packedSize );
+
+  /**
+   * @brief Get the received setup buffer of @p commID, decompressed if the ghost-setup buffers are compressed.
+   * @param commID the communication ID
+   * @param decompressed storage for the decompressed buffer
+   * @return the buffer to unpack
+   */
+  buffer_type const & setupReceiveBuffer( int const commID, buffer_type & decompressed ) const;
+
+  /**
+   * @struct CommContext
+   * The buffers and requests of one communication ID. The contexts are created the first time a communication ID
+   * is used with this neighbor and are kept afterwards, so that released communication IDs are recycled along
+   * with their buffer capacity.
+   */
+  struct CommContext
+  {
+    int sendBufferSize = 0;
+    int receiveBufferSize = 0;
+
+    buffer_type sendBuffer;
+    buffer_type receiveBuffer;
+
+    MPI_Request mpiSendBufferRequest = MPI_REQUEST_NULL;
+    MPI_Request mpiRecvBufferRequest = MPI_REQUEST_NULL;
+
+    MPI_Request mpiSendSizeRequest = MPI_REQUEST_NULL;
+    MPI_Request mpiRecvSizeRequest = MPI_REQUEST_NULL;
 
-  std::vector< buffer_type > m_sendBuffer;
-  std::vector< buffer_type > m_receiveBuffer;
+    MPI_Status mpiSendBufferStatus;
+    MPI_Status mpiRecvBufferStatus;
 
-  MPI_Request m_mpiSendBufferRequest[maxComm];
-  MPI_Request m_mpiRecvBufferRequest[maxComm];
+    /// Time the last messages were posted, only set when the communication statistics are enabled
+    real64 postTime = 0.0;
+  };
 
-  MPI_Request m_mpiSendSizeRequest[maxComm];
-  MPI_Request m_mpiRecvSizeRequest[maxComm];
+  /**
+   * @brief Get the context of a communication ID, creating it if needed.
+   * @param commID the communication ID
+   * @return the context
+   */
+  CommContext & context( int const commID ) const
+  {
+    GEOSX_ASSERT_GE( commID, 0 );
+    if( commID >= LvArray::integerConversion< int >( m_contexts.size() ) )
+    {
+      m_contexts.resize( commID + 1 );
+    }
+    return m_contexts[commID];
+  }
+
+  int m_neighborRank;
 
-  MPI_Status m_mpiSendBufferStatus[maxComm];
-  MPI_Status m_mpiRecvBufferStatus[maxComm];
+  /// The communication contexts indexed by communication ID, a deque is used since MPI holds pointers into them
+  mutable std::deque< CommContext > m_contexts;
 };
 
 
@@ -360,27 +509,27 @@ void NeighborCommunicator::MPI_iSendReceive( array1d< T > const & sendBuffer,
                                              int const commID,
                                              MPI_Comm mpiComm )
 {
-  m_sendBufferSize[commID] = LvArray::integerConversion< int >( sendBuffer.size());
+  context( commID ).sendBufferSize = LvArray::integerConversion< int >( sendBuffer.size());
 
-  MPI_iSendReceive( &m_sendBufferSize[commID],
+  MPI_iSendReceive( &context( commID ).sendBufferSize,
                     1,
                     sendReq,
-                    &m_receiveBufferSize[commID],
+                    &context( commID ).receiveBufferSize,
                     1,
                     recvReq,
                     commID,
                     mpiComm );
 
-  MpiWrapper::Wait( &( recvReq ), &( m_mpiRecvBufferStatus[commID] ) );
-  MpiWrapper::Wait( &( sendReq ), &( m_mpiSendBufferStatus[commID] ) );
+  MpiWrapper::Wait( &( recvReq ), &( context( commID ).mpiRecvBufferStatus ) );
+  MpiWrapper::Wait( &( sendReq ), &( context( commID ).mpiSendBufferStatus ) );
 
-  recvBuffer.resize( m_receiveBufferSize[commID] );
+  recvBuffer.resize( context( commID ).receiveBufferSize );
 
   MPI_iSendReceive( sendBuffer.data(),
-                    m_sendBufferSize[commID],
+                    context( commID ).sendBufferSize,
                     sendReq,
                     recvBuffer.data(),
-                    m_receiveBufferSize[commID],
+                    context( commID ).receiveBufferSize,
                     recvReq,
                     commID,
                     mpiComm );
@@ -0,0 +1,310 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SharedMemoryCommunicator.cpp
+ */
+
+#include "mpiCommunications/SharedMemoryCommunicator.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "mesh/MeshLevel.hpp"
+#include "mpiCommunications/CommunicationStatistics.hpp"
+#include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/NeighborCommunicator.hpp"
+
+#include <algorithm>
+
+namespace geosx
+{
+
+namespace
+{
+
+/// Alignment of the data of each neighbor in a segment
+constexpr std::size_t segmentAlignment = 8;
+
+std::size_t alignSegmentOffset( std::size_t const offset )
+{
+  return ( offset + segmentAlignment - 1 ) / segmentAlignment * segmentAlignment;
+}
+
+/// Size in bytes of the segment table: the number of entries, then (node rank, offset, size) per on-node neighbor
+std::size_t segmentTableSize( localIndex const numNodeNeighbors )
+{
+  return alignSegmentOffset( ( 1 + 3 * numNodeNeighbors ) * sizeof( int ) );
+}
+
+}
+
+SharedMemoryCommunicator::SharedMemoryCommunicator( std::vector< NeighborCommunicator > const & neighbors ):
+  m_nodeComm( MpiWrapper::Comm_split_shared( MPI_COMM_GEOSX ) ),
+  m_window( MPI_WIN_NULL ),
+  m_commID( CommunicationTools::reserveCommID() ),
+  m_neighborRanks(),
+  m_nodeNeighbors(),
+  m_nodeNeighborRanks(),
+  m_offNodeNeighbors(),
+  m_capacity( 0 ),
+  m_segment( nullptr ),
+  m_neighborSegments(),
+  m_sizeSendRequests(),
+  m_sizeRecvRequests(),
+  m_sendRequests(),
+  m_recvRequests(),
+  m_statuses()
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex const numNeighbors = LvArray::integerConversion< localIndex >( neighbors.size() );
+
+  m_neighborRanks.resize( numNeighbors );
+  for( localIndex i = 0; i < numNeighbors; ++i )
+  {
+    m_neighborRanks[i] = neighbors[i].NeighborRank();
+  }
+
+  array1d< int > nodeRanks( numNeighbors );
+  MpiWrapper::Group_translate_ranks( MPI_COMM_GEOSX,
+                                     LvArray::integerConversion< int >( numNeighbors ),
+                                     m_neighborRanks.data(),
+                                     m_nodeComm,
+                                     nodeRanks.data() );
+
+  for( localIndex i = 0; i < numNeighbors; ++i )
+  {
+    if( nodeRanks[i] != MPI_UNDEFINED )
+    {
+      m_nodeNeighbors.emplace_back( i );
+      m_nodeNeighborRanks.emplace_back( nodeRanks[i] );
+    }
+    else
+    {
+      m_offNodeNeighbors.emplace_back( i );
+    }
+  }
+
+  m_neighborSegments.resize( m_nodeNeighbors.size(), nullptr );
+
+  localIndex const numOffNode = m_offNodeNeighbors.size();
+  m_sizeSendRequests.resize( numOffNode );
+  m_sizeRecvRequests.resize( numOffNode );
+  m_sendRequests.resize( numOffNode );
+  m_recvRequests.resize( numOffNode );
+  m_statuses.resize( numOffNode );
+  for( localIndex j = 0; j < numOffNode; ++j )
+  {
+    m_sizeSendRequests[j] = MPI_REQUEST_NULL;
+    m_sizeRecvRequests[j] = MPI_REQUEST_NULL;
+    m_sendRequests[j] = MPI_REQUEST_NULL;
+    m_recvRequests[j] = MPI_REQUEST_NULL;
+  }
+}
+
+SharedMemoryCommunicator::~SharedMemoryCommunicator()
+{
+  if( m_window != MPI_WIN_NULL )
+  {
+    MpiWrapper::Win_unlock_all( m_window );
+    MpiWrapper::Win_free( m_window );
+  }
+  if( m_nodeComm != MPI_COMM_NULL && m_nodeComm != MPI_COMM_GEOSX )
+  {
+    MpiWrapper::Comm_free( m_nodeComm );
+  }
+  CommunicationTools::releaseCommID( m_commID );
+}
+
+bool SharedMemoryCommunicator::matches( std::vector< NeighborCommunicator > const & neighbors ) const
+{
+  if( LvArray::integerConversion< localIndex >( neighbors.size() ) != m_neighborRanks.size() )
+  {
+    return false;
+  }
+
+  for( localIndex i = 0; i < m_neighborRanks.size(); ++i )
+  {
+    if( neighbors[i].NeighborRank() != m_neighborRanks[i] )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void SharedMemoryCommunicator::reserve( std::size_t const size )
+{
+  // this reduction also guarantees that all the ranks of the node are done reading the previous exchange
+  int const grow = size > m_capacity ? 1 : 0;
+  if( MpiWrapper::Max( grow, m_nodeComm ) == 0 )
+  {
+    return;
+  }
+
+  GEOSX_MARK_FUNCTION;
+
+  if( m_window != MPI_WIN_NULL )
+  {
+    MpiWrapper::Win_unlock_all( m_window );
+    MpiWrapper::Win_free( m_window );
+  }
+
+  if( size > m_capacity )
+  {
+    m_capacity = std::max( size, m_capacity + m_capacity / 2 );
+  }
+
+  m_segment = static_cast< buffer_unit_type * >( MpiWrapper::Win_allocate_shared( m_capacity, m_nodeComm, m_window ) );
+  MpiWrapper::Win_lock_all( m_window );
+
+  for( localIndex j = 0; j < m_nodeNeighbors.size(); ++j )
+  {
+    m_neighborSegments[j] = static_cast< buffer_unit_type const * >( MpiWrapper::Win_shared_query( m_window,
+                                                                                                   m_nodeNeighborRanks[j] ) );
+  }
+}
+
+void SharedMemoryCommunicator::synchronizeFields( std::map< string, string_array > const & fieldNames,
+                                                  MeshLevel * const mesh,
+                                                  std::vector< NeighborCommunicator > & neighbors,
+                                                  bool const onDevice )
+{
+  GEOSX_MARK_FUNCTION;
+  GEOSX_ERROR_IF( !matches( neighbors ), "The neighbor list changed since the SharedMemoryCommunicator was built" );
+
+  localIndex const numNodeNeighbors = m_nodeNeighbors.size();
+  int const numOffNode = LvArray::integerConversion< int >( m_offNodeNeighbors.size() );
+
+  // start the off-node exchanges first so that they progress while the on-node data is exchanged
+  for( int j = 0; j < numOffNode; ++j )
+  {
+    NeighborCommunicator & neighbor = neighbors[m_offNodeNeighbors[j]];
+    neighbor.resizeSendBuffer( m_commID, neighbor.PackCommSizeForSync( fieldNames, *mesh, m_commID, onDevice ) );
+    neighbor.MPI_iSendReceiveBufferSizes( m_commID, m_sizeSendRequests[j], m_sizeRecvRequests[j], MPI_COMM_GEOSX );
+    neighbor.PackCommBufferForSync( fieldNames, *mesh, m_commID, onDevice );
+  }
+
+  // lay out the segment of the rank
+  array1d< int > offsets( numNodeNeighbors );
+  array1d< int > sizes( numNodeNeighbors );
+  std::size_t segmentSize = numNodeNeighbors > 0 ? segmentTableSize( numNodeNeighbors ) : 0;
+  for( localIndex j = 0; j < numNodeNeighbors; ++j )
+  {
+    NeighborCommunicator & neighbor = neighbors[m_nodeNeighbors[j]];
+    sizes[j] = neighbor.PackCommSizeForSync( fieldNames, *mesh, m_commID, onDevice );
+    offsets[j] = LvArray::integerConversion< int >( segmentSize );
+    segmentSize = alignSegmentOffset( segmentSize + sizes[j] );
+  }
+
+  reserve( segmentSize );
+
+  for( int count = 0; count < numOffNode; ++count )
+  {
+    int j = MPI_UNDEFINED;
+    {
+      CommunicationStatistics::ScopedWait const wait;
+      MpiWrapper::Waitany( numOffNode, m_sizeRecvRequests.data(), &j, m_statuses.data() );
+    }
+    neighbors[m_offNodeNeighbors[j]].MPI_iSendReceiveBuffers( m_commID,
+                                                              m_sendRequests[j],
+                                                              m_recvRequests[j],
+                                                              MPI_COMM_GEOSX );
+  }
+
+  // pack the on-node data into the segment of the rank, behind the table
+  if( numNodeNeighbors > 0 )
+  {
+    int * const table = reinterpret_cast< int * >( m_segment );
+    table[0] = LvArray::integerConversion< int >( numNodeNeighbors );
+    for( localIndex j = 0; j < numNodeNeighbors; ++j )
+    {
+      table[1 + 3 * j] = m_nodeNeighborRanks[j];
+      table[2 + 3 * j] = offsets[j];
+      table[3 + 3 * j] = sizes[j];
+      CommunicationStatistics::recordSend( m_neighborRanks[m_nodeNeighbors[j]], sizes[j] );
+
+      NeighborCommunicator & neighbor = neighbors[m_nodeNeighbors[j]];
+      if( onDevice )
+      {
+        // the shared segment is not device-accessible, stage through the send buffer
+        neighbor.resizeSendBuffer( m_commID, sizes[j] );
+        neighbor.PackCommBufferForSync( fieldNames, *mesh, m_commID, onDevice );
+        buffer_type const & sendBuffer = neighbor.SendBuffer( m_commID );
+        std::copy( sendBuffer.begin(), sendBuffer.end(), m_segment + offsets[j] );
+      }
+      else
+      {
+        int const packedSize = neighbor.PackCommBufferForSync( fieldNames, *mesh, m_segment + offsets[j], onDevice );
+        GEOSX_ERROR_IF_NE( packedSize, sizes[j] );
+      }
+    }
+  }
+
+  if( m_window != MPI_WIN_NULL )
+  {
+    CommunicationStatistics::ScopedWait const wait;
+    MpiWrapper::Win_sync( m_window );
+    MpiWrapper::Barrier( m_nodeComm );
+    MpiWrapper::Win_sync( m_window );
+  }
+
+  // unpack directly from the segments of the on-node neighbors
+  int const nodeRank = MpiWrapper::Comm_rank( m_nodeComm );
+  for( localIndex j = 0; j < numNodeNeighbors; ++j )
+  {
+    buffer_unit_type const * const segment = m_neighborSegments[j];
+    int const * const table = reinterpret_cast< int const * >( segment );
+
+    int entry = 0;
+    while( entry < table[0] && table[1 + 3 * entry] != nodeRank )
+    {
+      ++entry;
+    }
+    GEOSX_ERROR_IF( entry == table[0], "Rank " << m_neighborRanks[m_nodeNeighbors[j]] <<
+                    " did not pack any data for rank " << MpiWrapper::Comm_rank() );
+
+    int const offset = table[2 + 3 * entry];
+    int const size = table[3 + 3 * entry];
+    CommunicationStatistics::recordReceive( m_neighborRanks[m_nodeNeighbors[j]], size );
+
+    NeighborCommunicator & neighbor = neighbors[m_nodeNeighbors[j]];
+    if( onDevice )
+    {
+      neighbor.resizeRecvBuffer( m_commID, size );
+      std::copy( segment + offset, segment + offset + size, neighbor.ReceiveBuffer( m_commID ).begin() );
+      neighbor.UnpackBufferForSync( fieldNames, mesh, m_commID, onDevice );
+    }
+    else
+    {
+      neighbor.UnpackBufferForSync( fieldNames, mesh, segment + offset, onDevice );
+    }
+  }
+
+  for( int count = 0; count < numOffNode; ++count )
+  {
+    int j = MPI_UNDEFINED;
+    {
+      CommunicationStatistics::ScopedWait const wait;
+      MpiWrapper::Waitany( numOffNode, m_recvRequests.data(), &j, m_statuses.data() );
+    }
+    neighbors[m_offNodeNeighbors[j]].recordCompletion( m_commID );
+    neighbors[m_offNodeNeighbors[j]].UnpackBufferForSync( fieldNames, mesh, m_commID, onDevice );
+  }
+
+  CommunicationStatistics::ScopedWait const wait;
+  MpiWrapper::Waitall( numOffNode, m_sizeSendRequests.data(), m_statuses.data() );
+  MpiWrapper::Waitall( numOffNode, m_sendRequests.data(), m_statuses.data() );
+}
+
+} /* namespace geosx */
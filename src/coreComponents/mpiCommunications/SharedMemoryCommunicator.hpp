@@ -0,0 +1,146 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SharedMemoryCommunicator.hpp
+ */
+
+#ifndef GEOSX_MPICOMMUNICATIONS_SHAREDMEMORYCOMMUNICATOR_HPP_
+#define GEOSX_MPICOMMUNICATIONS_SHAREDMEMORYCOMMUNICATOR_HPP_
+
+#include "MpiWrapper.hpp"
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+class MeshLevel;
+class NeighborCommunicator;
+
+/**
+ * @class SharedMemoryCommunicator
+ *
+ * A node-aware halo exchange. The neighbors living on the same node as the rank exchange their ghost data
+ * through a MPI shared-memory window: each rank packs the data of all its on-node neighbors into its own
+ * segment of the window, and each neighbor unpacks it directly from there, without going through the MPI
+ * message stack and without a receive buffer. The off-node neighbors are exchanged with point-to-point
+ * messages as usual, and these messages are in flight while the on-node data is exchanged.
+ *
+ * Each segment starts with a small table giving, for each on-node neighbor, the offset and size of its data,
+ * so that the packed sizes are never exchanged between on-node neighbors.
+ *
+ * Building the communicator and every exchange are collective over the ranks of a node, which are
+ * synchronized with a barrier once the segments are packed. The window is grown (collectively over the
+ * node) when a rank needs a larger segment.
+ */
+class SharedMemoryCommunicator
+{
+public:
+
+  /**
+   * @brief Constructor, collective over MPI_COMM_GEOSX.
+   * @param neighbors the neighbors of the rank
+   */
+  explicit SharedMemoryCommunicator( std::vector< NeighborCommunicator > const & neighbors );
+
+  /**
+   * @brief Destructor, frees the window and the node communicator.
+   */
+  ~SharedMemoryCommunicator();
+
+  SharedMemoryCommunicator( SharedMemoryCommunicator const & ) = delete;
+  SharedMemoryCommunicator( SharedMemoryCommunicator && ) = delete;
+  SharedMemoryCommunicator & operator=( SharedMemoryCommunicator const & ) = delete;
+  SharedMemoryCommunicator & operator=( SharedMemoryCommunicator && ) = delete;
+
+  /**
+   * @brief Check whether the communicator was built for the given neighbors, in the same order.
+   * @param neighbors the neighbors
+   * @return true if the communicator can be used to exchange with @p neighbors
+   */
+  bool matches( std::vector< NeighborCommunicator > const & neighbors ) const;
+
+  /**
+   * @brief Get the number of neighbors living on the same node as the rank.
+   * @return the number of on-node neighbors
+   */
+  localIndex numNodeNeighbors() const
+  { return m_nodeNeighbors.size(); }
+
+  /**
+   * @brief Synchronize the ghost values of a set of fields with all the neighbors.
+   * @param fieldNames map from object type ("node", "edge", "face", "elems") to the names of the fields to sync
+   * @param mesh the mesh level on which the fields live
+   * @param neighbors the neighbors
+   * @param onDevice whether the fields are packed/unpacked on the device
+   */
+  void synchronizeFields( std::map< string, string_array > const & fieldNames,
+                          MeshLevel * const mesh,
+                          std::vector< NeighborCommunicator > & neighbors,
+                          bool const onDevice );
+
+private:
+
+  /**
+   * @brief Make sure the segment of the rank holds at least @p size bytes, collective over the node.
+   * @param size the number of bytes needed by the rank
+   */
+  void reserve( std::size_t const size );
+
+  /// The communicator of the ranks living on the same node
+  MPI_Comm m_nodeComm;
+
+  /// The shared-memory window
+  MPI_Win m_window;
+
+  /// Communication ID of the off-node messages
+  int m_commID;
+
+  /// Rank of each neighbor in MPI_COMM_GEOSX
+  array1d< int > m_neighborRanks;
+
+  /// Index of the neighbors living on the same node
+  array1d< localIndex > m_nodeNeighbors;
+
+  /// Rank in m_nodeComm of each on-node neighbor
+  array1d< int > m_nodeNeighborRanks;
+
+  /// Index of the neighbors living on other nodes
+  array1d< localIndex > m_offNodeNeighbors;
+
+  /// Size in bytes of the segment of the rank
+  std::size_t m_capacity;
+
+  /// Segment of the rank
+  buffer_unit_type * m_segment;
+
+  /// Segment of each on-node neighbor, in the address space of the rank
+  std::vector< buffer_unit_type const * > m_neighborSegments;
+
+  /// Size requests of the off-node messages
+  array1d< MPI_Request > m_sizeSendRequests;
+  array1d< MPI_Request > m_sizeRecvRequests;
+
+  /// Data requests of the off-node messages
+  array1d< MPI_Request > m_sendRequests;
+  array1d< MPI_Request > m_recvRequests;
+
+  /// Statuses of the off-node requests
+  array1d< MPI_Status > m_statuses;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MPICOMMUNICATIONS_SHAREDMEMORYCOMMUNICATOR_HPP_ */
@@ -0,0 +1,348 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SynchronizationPlan.cpp
+ */
+
+#include "mpiCommunications/SynchronizationPlan.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "managers/ObjectManagerBase.hpp"
+#include "mesh/MeshLevel.hpp"
+#include "mpiCommunications/CommunicationStatistics.hpp"
+#include "mpiCommunications/LoadBalanceStatistics.hpp"
+#include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/NeighborCommunicator.hpp"
+
+#include <algorithm>
+
+namespace geosx
+{
+
+SynchronizationPlan::SynchronizationPlan( std::map< string, string_array > const & fieldNames,
+                                          MeshLevel & mesh,
+                                          std::vector< NeighborCommunicator > & neighbors,
+                                          bool const onDevice ):
+  m_fieldNames( fieldNames ),
+  m_mesh( &mesh ),
+  m_neighbors( &neighbors ),
+  m_onDevice( onDevice ),
+  m_commID( CommunicationTools::reserveCommID() ),
+  m_sizeCommID( CommunicationTools::reserveCommID() ),
+  m_inProgress( false ),
+  m_startTime( 0.0 ),
+  m_neighborRanks(),
+  m_signatures(),
+  m_sendSizes(),
+  m_recvSizes(),
+  m_sendBuffers(),
+  m_recvBuffers(),
+  m_sendRequests(),
+  m_recvRequests(),
+  m_sendStatus(),
+  m_recvStatus()
+{
+  localIndex const numNeighbors = LvArray::integerConversion< localIndex >( neighbors.size() );
+
+  m_neighborRanks.resize( numNeighbors );
+  m_signatures.resize( numNeighbors );
+  m_sendSizes.resize( numNeighbors );
+  m_recvSizes.resize( numNeighbors );
+
+  // with a GPU-aware MPI the buffers packed on device stay in device-accessible memory,
+  // so that they are handed directly to MPI instead of being staged through the host
+#ifdef GEOSX_USE_CHAI
+  buffer_type const emptyBuffer{ BufferAllocator< buffer_unit_type >( m_onDevice && getUseGpuAwareMPI() ) };
+#else
+  buffer_type const emptyBuffer;
+#endif
+  m_sendBuffers.resize( numNeighbors, emptyBuffer );
+  m_recvBuffers.resize( numNeighbors, emptyBuffer );
+  m_sendRequests.resize( numNeighbors );
+  m_recvRequests.resize( numNeighbors );
+  m_sendStatus.resize( numNeighbors );
+  m_recvStatus.resize( numNeighbors );
+
+  std::vector< localIndex > allNeighbors( numNeighbors );
+  for( localIndex i = 0; i < numNeighbors; ++i )
+  {
+    m_neighborRanks[i] = neighbors[i].NeighborRank();
+    m_sendRequests[i] = MPI_REQUEST_NULL;
+    m_recvRequests[i] = MPI_REQUEST_NULL;
+    allNeighbors[i] = i;
+  }
+
+  setupNeighbors( allNeighbors );
+}
+
+SynchronizationPlan::~SynchronizationPlan()
+{
+  GEOSX_ERROR_IF( m_inProgress, "SynchronizationPlan destroyed while a synchronization is in progress" );
+
+  for( localIndex i = 0; i < m_neighborRanks.size(); ++i )
+  {
+    freeRequests( i );
+  }
+
+  CommunicationTools::releaseCommID( m_commID );
+  CommunicationTools::releaseCommID( m_sizeCommID );
+}
+
+bool SynchronizationPlan::matches( std::map< string, string_array > const & fieldNames,
+                                   MeshLevel const & mesh,
+                                   std::vector< NeighborCommunicator > const & neighbors ) const
+{
+  if( m_mesh != &mesh || m_neighbors != &neighbors || m_fieldNames.size() != fieldNames.size() )
+  {
+    return false;
+  }
+
+  for( std::pair< string const, string_array > const & entry : fieldNames )
+  {
+    auto const iter = m_fieldNames.find( entry.first );
+    if( iter == m_fieldNames.end() ||
+        iter->second.size() != entry.second.size() ||
+        !std::equal( entry.second.begin(), entry.second.end(), iter->second.begin() ) )
+    {
+      return false;
+    }
+  }
+
+  if( LvArray::integerConversion< localIndex >( neighbors.size() ) != m_neighborRanks.size() )
+  {
+    return false;
+  }
+
+  for( localIndex i = 0; i < m_neighborRanks.size(); ++i )
+  {
+    if( neighbors[i].NeighborRank() != m_neighborRanks[i] )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void SynchronizationPlan::computeSignature( localIndex const neighborIndex,
+                                            array1d< localIndex > & signature ) const
+{
+  int const neighborRank = m_neighborRanks[neighborIndex];
+
+  signature.clear();
+  auto addObject = [&]( ObjectManagerBase const & object )
+  {
+    NeighborData const & neighborData = object.getNeighborData( neighborRank );
+    signature.emplace_back( neighborData.ghostsToSend().size() );
+    signature.emplace_back( neighborData.ghostsToReceive().size() );
+  };
+
+  if( m_fieldNames.count( "node" ) > 0 )
+  {
+    addObject( *m_mesh->getNodeManager() );
+  }
+  if( m_fieldNames.count( "edge" ) > 0 )
+  {
+    addObject( *m_mesh->getEdgeManager() );
+  }
+  if( m_fieldNames.count( "face" ) > 0 )
+  {
+    addObject( *m_mesh->getFaceManager() );
+  }
+  if( m_fieldNames.count( "elems" ) > 0 )
+  {
+    m_mesh->getElemManager()->forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase const & subRegion )
+    {
+      addObject( subRegion );
+    } );
+  }
+}
+
+void SynchronizationPlan::freeRequests( localIndex const neighborIndex )
+{
+  if( m_sendRequests[neighborIndex] != MPI_REQUEST_NULL )
+  {
+    MpiWrapper::Request_free( &m_sendRequests[neighborIndex] );
+    m_sendRequests[neighborIndex] = MPI_REQUEST_NULL;
+  }
+  if( m_recvRequests[neighborIndex] != MPI_REQUEST_NULL )
+  {
+    MpiWrapper::Request_free( &m_recvRequests[neighborIndex] );
+    m_recvRequests[neighborIndex] = MPI_REQUEST_NULL;
+  }
+}
+
+void SynchronizationPlan::setupNeighbors( std::vector< localIndex > const & neighborIndices )
+{
+  GEOSX_MARK_FUNCTION;
+
+  std::vector< NeighborCommunicator > & neighbors = *m_neighbors;
+  localIndex const numSetup = LvArray::integerConversion< localIndex >( neighborIndices.size() );
+
+  array1d< MPI_Request > sizeSendRequests( numSetup );
+  array1d< MPI_Request > sizeRecvRequests( numSetup );
+  array1d< MPI_Status > sizeSendStatus( numSetup );
+  array1d< MPI_Status > sizeRecvStatus( numSetup );
+
+  // compute the local pack sizes and post the (one-time) size handshake
+  for( localIndex j = 0; j < numSetup; ++j )
+  {
+    localIndex const i = neighborIndices[j];
+    NeighborCommunicator & neighbor = neighbors[i];
+
+    freeRequests( i );
+    computeSignature( i, m_signatures[i] );
+
+    m_sendSizes[i] = neighbor.PackCommSizeForSync( m_fieldNames, *m_mesh, m_commID, m_onDevice );
+
+    neighbor.MPI_iSendReceive( &m_sendSizes[i],
+                               1,
+                               sizeSendRequests[j],
+                               &m_recvSizes[i],
+                               1,
+                               sizeRecvRequests[j],
+                               m_sizeCommID,
+                               MPI_COMM_GEOSX );
+  }
+
+  MpiWrapper::Waitall( LvArray::integerConversion< int >( numSetup ), sizeRecvRequests.data(), sizeRecvStatus.data() );
+  MpiWrapper::Waitall( LvArray::integerConversion< int >( numSetup ), sizeSendRequests.data(), sizeSendStatus.data() );
+
+  // allocate the persistent buffers and bind the persistent requests to them
+  for( localIndex const i : neighborIndices )
+  {
+    int const neighborRank = m_neighborRanks[i];
+
+    m_sendBuffers[i].resize( m_sendSizes[i] );
+    m_recvBuffers[i].resize( m_recvSizes[i] );
+
+    MpiWrapper::Send_init( m_sendBuffers[i].data(),
+                           m_sendSizes[i],
+                           neighborRank,
+                           CommTag( MpiWrapper::Comm_rank(), neighborRank, m_commID ),
+                           MPI_COMM_GEOSX,
+                           &m_sendRequests[i] );
+
+    MpiWrapper::Recv_init( m_recvBuffers[i].data(),
+                           m_recvSizes[i],
+                           neighborRank,
+                           CommTag( neighborRank, MpiWrapper::Comm_rank(), m_commID ),
+                           MPI_COMM_GEOSX,
+                           &m_recvRequests[i] );
+  }
+}
+
+void SynchronizationPlan::refresh()
+{
+  std::vector< localIndex > changedNeighbors;
+  array1d< localIndex > signature;
+  for( localIndex i = 0; i < m_neighborRanks.size(); ++i )
+  {
+    computeSignature( i, signature );
+    if( signature.size() != m_signatures[i].size() ||
+        !std::equal( signature.begin(), signature.end(), m_signatures[i].begin() ) )
+    {
+      changedNeighbors.emplace_back( i );
+    }
+  }
+
+  if( !changedNeighbors.empty() )
+  {
+    setupNeighbors( changedNeighbors );
+  }
+}
+
+void SynchronizationPlan::start()
+{
+  GEOSX_MARK_FUNCTION;
+  GEOSX_ERROR_IF( m_inProgress, "SynchronizationPlan::start() called twice without a call to finish()" );
+  CommunicationStatistics::ScopedPurpose const commPurpose( CommunicationStatistics::Purpose::FieldSync );
+  LoadBalanceStatistics::ScopedPhase const syncPhase( "synchronization" );
+
+  refresh();
+
+  std::vector< NeighborCommunicator > & neighbors = *m_neighbors;
+  int const numNeighbors = LvArray::integerConversion< int >( m_neighborRanks.size() );
+
+  // post the receives first so that the messages can land directly in the receive buffers
+  MpiWrapper::Startall( numNeighbors, m_recvRequests.data() );
+
+  for( int i = 0; i < numNeighbors; ++i )
+  {
+    int const packedSize = neighbors[i].PackCommBufferForSync( m_fieldNames, *m_mesh, m_sendBuffers[i].data(), m_onDevice );
+    GEOSX_ERROR_IF_NE_MSG( packedSize, m_sendSizes[i],
+                           "Packed size changed since the SynchronizationPlan was built" );
+  }
+
+  MpiWrapper::Startall( numNeighbors, m_sendRequests.data() );
+
+  if( CommunicationStatistics::isEnabled() )
+  {
+    for( int i = 0; i < numNeighbors; ++i )
+    {
+      CommunicationStatistics::recordSend( m_neighborRanks[i], m_sendSizes[i] );
+      CommunicationStatistics::recordReceive( m_neighborRanks[i], m_recvSizes[i] );
+    }
+    m_startTime = MpiWrapper::Wtime();
+  }
+
+  m_inProgress = true;
+}
+
+void SynchronizationPlan::finish()
+{
+  GEOSX_MARK_FUNCTION;
+  GEOSX_ERROR_IF( !m_inProgress, "SynchronizationPlan::finish() called without a call to start()" );
+  CommunicationStatistics::ScopedPurpose const commPurpose( CommunicationStatistics::Purpose::FieldSync );
+  LoadBalanceStatistics::ScopedPhase const syncPhase( "synchronization" );
+
+  std::vector< NeighborCommunicator > & neighbors = *m_neighbors;
+  int const numNeighbors = LvArray::integerConversion< int >( m_neighborRanks.size() );
+
+  for( int count = 0; count < numNeighbors; ++count )
+  {
+    int neighborIndex = MPI_UNDEFINED;
+    {
+      CommunicationStatistics::ScopedWait const wait;
+      MpiWrapper::Waitany( numNeighbors,
+                           m_recvRequests.data(),
+                           &neighborIndex,
+                           m_recvStatus.data() );
+    }
+
+    if( neighborIndex != MPI_UNDEFINED )
+    {
+      if( CommunicationStatistics::isEnabled() )
+      {
+        CommunicationStatistics::recordLatency( m_neighborRanks[neighborIndex], MpiWrapper::Wtime() - m_startTime );
+      }
+      neighbors[neighborIndex].UnpackBufferForSync( m_fieldNames, m_mesh, m_recvBuffers[neighborIndex].data(), m_onDevice );
+    }
+  }
+
+  {
+    CommunicationStatistics::ScopedWait const wait;
+    MpiWrapper::Waitall( numNeighbors, m_sendRequests.data(), m_sendStatus.data() );
+  }
+
+  m_inProgress = false;
+}
+
+void SynchronizationPlan::execute()
+{
+  start();
+  finish();
+}
+
+} /* namespace geosx */
@@ -0,0 +1,199 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SynchronizationPlan.hpp
+ */
+
+#ifndef GEOSX_MPICOMMUNICATIONS_SYNCHRONIZATIONPLAN_HPP_
+#define GEOSX_MPICOMMUNICATIONS_SYNCHRONIZATIONPLAN_HPP_
+
+#include "MpiWrapper.hpp"
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+class MeshLevel;
+class NeighborCommunicator;
+
+/**
+ * @class SynchronizationPlan
+ *
+ * A reusable halo-exchange plan for a fixed set of fields on a MeshLevel. The packed sizes are exchanged once
+ * when the plan is built, the send/receive buffers are allocated once, and the messages are posted through
+ * persistent MPI requests, so that each call to execute() only packs, starts, waits and unpacks.
+ *
+ * The plan watches the size of the ghost lists shared with each neighbor. When they change (for instance after
+ * a topology change), only the affected neighbor pairs are re-sized, which is safe since both ranks of a pair
+ * see the same change. The plan assumes that the packed size of each field only depends on the number of objects
+ * packed, which is true for all fixed-size arrays.
+ *
+ * When the fields are packed on device and GEOSX is run with a GPU-aware MPI (--gpu-aware-mpi), the persistent
+ * buffers are allocated in device-accessible memory and are passed to MPI without being staged through the host.
+ */
+class SynchronizationPlan
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param fieldNames map from object type ("node", "edge", "face", "elems") to the names of the fields to sync
+   * @param mesh the mesh level on which the fields live
+   * @param neighbors the neighbors to exchange with
+   * @param onDevice whether the fields are packed/unpacked on the device
+   */
+  SynchronizationPlan( std::map< string, string_array > const & fieldNames,
+                       MeshLevel & mesh,
+                       std::vector< NeighborCommunicator > & neighbors,
+                       bool const onDevice = false );
+
+  /**
+   * @brief Destructor, frees the persistent requests and the reserved communication IDs.
+   */
+  ~SynchronizationPlan();
+
+  SynchronizationPlan( SynchronizationPlan const & ) = delete;
+  SynchronizationPlan( SynchronizationPlan && ) = delete;
+  SynchronizationPlan & operator=( SynchronizationPlan const & ) = delete;
+  SynchronizationPlan & operator=( SynchronizationPlan && ) = delete;
+
+  /**
+   * @brief Perform a full synchronization, equivalent to start() followed by finish().
+   */
+  void execute();
+
+  /**
+   * @brief Pack the send buffers and start the persistent sends and receives.
+   */
+  void start();
+
+  /**
+   * @brief Wait for the receives, unpack them, and wait for the sends to complete.
+   */
+  void finish();
+
+  /**
+   * @brief Check whether this plan was built for the given fields, mesh and neighbors.
+   * @param fieldNames map from object type to the names of the fields to sync
+   * @param mesh the mesh level
+   * @param neighbors the neighbors
+   * @return true if the plan can be used for this synchronization
+   */
+  bool matches( std::map< string, string_array > const & fieldNames,
+                MeshLevel const & mesh,
+                std::vector< NeighborCommunicator > const & neighbors ) const;
+
+  /**
+   * @brief Get the number of bytes sent to a neighbor by each execution of the plan.
+   * @param neighborIndex the index of the neighbor
+   * @return the size of the send buffer
+   */
+  int sendSize( localIndex const neighborIndex ) const
+  { return m_sendSizes[neighborIndex]; }
+
+  /**
+   * @brief Get the number of bytes received from a neighbor by each execution of the plan.
+   * @param neighborIndex the index of the neighbor
+   * @return the size of the receive buffer
+   */
+  int recvSize( localIndex const neighborIndex ) const
+  { return m_recvSizes[neighborIndex]; }
+
+private:
+
+  /**
+   * @brief Compute the ghost list sizes shared with a neighbor.
+   * @param neighborIndex the index of the neighbor
+   * @param signature the list of sizes
+   */
+  void computeSignature( localIndex const neighborIndex,
+                         array1d< localIndex > & signature ) const;
+
+  /**
+   * @brief (Re)compute the buffer sizes and the persistent requests for a subset of the neighbors.
+   * @param neighborIndices the indices of the neighbors to set up
+   */
+  void setupNeighbors( std::vector< localIndex > const & neighborIndices );
+
+  /**
+   * @brief Release the persistent requests associated with a neighbor.
+   * @param neighborIndex the index of the neighbor
+   */
+  void freeRequests( localIndex const neighborIndex );
+
+  /**
+   * @brief Check the ghost lists and re-size the plan for the neighbor pairs that changed.
+   */
+  void refresh();
+
+  /// The fields synchronized by this plan
+  std::map< string, string_array > const m_fieldNames;
+
+  /// The mesh level the fields live on
+  MeshLevel * const m_mesh;
+
+  /// The neighbors to exchange with
+  std::vector< NeighborCommunicator > * const m_neighbors;
+
+  /// Whether the packing happens on device
+  bool const m_onDevice;
+
+  /// Communication ID used for the data messages
+  int m_commID;
+
+  /// Communication ID used for the size handshakes
+  int m_sizeCommID;
+
+  /// Whether a synchronization has been started and not finished
+  bool m_inProgress;
+
+  /// Time the last synchronization was started, only set when the communication statistics are enabled
+  real64 m_startTime;
+
+  /// Rank of each neighbor, used to detect changes in the neighbor list
+  array1d< int > m_neighborRanks;
+
+  /// Ghost list sizes for each neighbor when the plan was set up
+  std::vector< array1d< localIndex > > m_signatures;
+
+  /// Number of bytes sent to each neighbor
+  array1d< int > m_sendSizes;
+
+  /// Number of bytes received from each neighbor
+  array1d< int > m_recvSizes;
+
+  /// Persistent send buffers
+  std::vector< buffer_type > m_sendBuffers;
+
+  /// Persistent receive buffers
+  std::vector< buffer_type > m_recvBuffers;
+
+  /// Persistent send requests
+  array1d< MPI_Request > m_sendRequests;
+
+  /// Persistent receive requests
+  array1d< MPI_Request > m_recvRequests;
+
+  /// Statuses of the send requests
+  array1d< MPI_Status > m_sendStatus;
+
+  /// Statuses of the receive requests
+  array1d< MPI_Status > m_recvStatus;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MPICOMMUNICATIONS_SYNCHRONIZATIONPLAN_HPP_ */
@@ -0,0 +1,104 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "mpiCommunications/BufferCompression.hpp"
+
+#include <cstring>
+#include <random>
+
+using namespace geosx;
+
+namespace
+{
+
+void checkRoundTrip( buffer_type const & original )
+{
+  buffer_type compressed;
+  bufferCompression::compress( original.data(), original.size(), compressed );
+
+  buffer_type decompressed;
+  bufferCompression::decompress( compressed.data(), compressed.size(), decompressed );
+
+  ASSERT_EQ( decompressed.size(), original.size() );
+  for( std::size_t i = 0; i < original.size(); ++i )
+  {
+    ASSERT_EQ( decompressed[i], original[i] );
+  }
+}
+
+}
+
+TEST( testBufferCompression, empty )
+{
+  checkRoundTrip( buffer_type() );
+}
+
+TEST( testBufferCompression, sortedGlobalIndices )
+{
+  // a packed list of sorted global indices, preceded by a string so that the indices are not word-aligned
+  std::vector< globalIndex > indices;
+  for( globalIndex i = 0; i < 10000; ++i )
+  {
+    indices.emplace_back( 1000000000 + 3 * i + ( i % 7 == 0 ) );
+  }
+
+  char const name[] = "nodeManager";
+  buffer_type original( sizeof( name ) + indices.size() * sizeof( globalIndex ) );
+  std::memcpy( original.data(), name, sizeof( name ) );
+  std::memcpy( original.data() + sizeof( name ), indices.data(), indices.size() * sizeof( globalIndex ) );
+
+  buffer_type compressed;
+  bufferCompression::compress( original.data(), original.size(), compressed );
+  EXPECT_LT( compressed.size(), original.size() / 4 );
+
+  checkRoundTrip( original );
+}
+
+TEST( testBufferCompression, incompressible )
+{
+  std::mt19937 generator( 2020 );
+  std::uniform_int_distribution< int > distribution( -128, 127 );
+
+  buffer_type original( 100003 );
+  for( buffer_unit_type & value : original )
+  {
+    value = static_cast< buffer_unit_type >( distribution( generator ) );
+  }
+
+  // random data is stored as is, behind a small header
+  buffer_type compressed;
+  bufferCompression::compress( original.data(), original.size(), compressed );
+  EXPECT_LE( compressed.size(), original.size() + 16 );
+
+  checkRoundTrip( original );
+}
+
+TEST( testBufferCompression, longRuns )
+{
+  buffer_type original( 70000, 0 );
+  for( std::size_t i = 0; i < original.size(); i += 1000 )
+  {
+    original[i] = static_cast< buffer_unit_type >( i % 100 );
+  }
+
+  checkRoundTrip( original );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,90 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "managers/initialization.hpp"
+#include "mpiCommunications/CycleReduction.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+using namespace geosx;
+
+TEST( CycleReduction, MixedOperations )
+{
+  int const rank = MpiWrapper::Comm_rank();
+  int const size = MpiWrapper::Comm_size();
+
+  CycleReduction reduction;
+  CycleReduction::Handle const minHandle = reduction.addMin( 10.0 + rank );
+  CycleReduction::Handle const maxHandle = reduction.addMax( -1.0 * rank );
+  CycleReduction::Handle const sumHandle = reduction.addSum( 1.0 );
+  CycleReduction::Handle const flagHandle = reduction.addMax( rank == size - 1 ? 1.0 : 0.0 );
+  EXPECT_EQ( reduction.size(), 4 );
+  EXPECT_FALSE( reduction.isReduced() );
+
+  reduction.reduce();
+  EXPECT_TRUE( reduction.isReduced() );
+  EXPECT_DOUBLE_EQ( reduction.result( minHandle ), 10.0 );
+  EXPECT_DOUBLE_EQ( reduction.result( maxHandle ), 0.0 );
+  EXPECT_DOUBLE_EQ( reduction.result( sumHandle ), size );
+  EXPECT_DOUBLE_EQ( reduction.result( flagHandle ), 1.0 );
+
+  // a new phase starts from no contribution
+  reduction.clear();
+  EXPECT_EQ( reduction.size(), 0 );
+  CycleReduction::Handle const dtHandle = reduction.addMin( rank == 0 ? 0.5 : 2.0 );
+  reduction.reduce();
+  EXPECT_DOUBLE_EQ( reduction.result( dtHandle ), 0.5 );
+}
+
+TEST( CycleReduction, ManyContributions )
+{
+  int const rank = MpiWrapper::Comm_rank();
+  int const size = MpiWrapper::Comm_size();
+
+  // enough pairs for the allreduce to be segmented, an odd number of them
+  localIndex const numValues = 50001;
+  CycleReduction reduction;
+  for( localIndex i = 0; i < numValues; ++i )
+  {
+    if( i % 3 == 0 )
+    {
+      reduction.addMin( rank + i );
+    }
+    else if( i % 3 == 1 )
+    {
+      reduction.addMax( rank + i );
+    }
+    else
+    {
+      reduction.addSum( rank + i );
+    }
+  }
+  reduction.reduce();
+
+  for( localIndex i = 0; i < numValues; ++i )
+  {
+    real64 const expected = ( i % 3 == 0 ) ? i : ( ( i % 3 == 1 ) ? i + size - 1 : size * i + size * ( size - 1 ) / 2 );
+    EXPECT_DOUBLE_EQ( reduction.result( i ), expected );
+  }
+}
+
+int main( int ac, char * av[] )
+{
+  ::testing::InitGoogleTest( &ac, av );
+  geosx::basicSetup( ac, av );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
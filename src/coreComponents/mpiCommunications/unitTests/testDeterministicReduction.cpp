@@ -0,0 +1,109 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include "managers/initialization.hpp"
+#include "mpiCommunications/DeterministicReduction.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+using namespace geosx;
+
+namespace
+{
+
+// terms whose plain sum loses the small ones, the large ones cancelling each other
+real64 term( localIndex const i )
+{
+  return ( i % 3 == 0 ) ? 1e16 : ( ( i % 3 == 1 ) ? 1.0 : -1e16 );
+}
+
+}
+
+TEST( DeterministicReduction, LocalSum )
+{
+  auto const termOf = []( localIndex const i )
+  {
+    return term( i );
+  };
+
+  EXPECT_EQ( DeterministicReduction::localSum< parallelHostPolicy >( 0, termOf ), 0.0 );
+
+  // several blocks, the last one partial
+  localIndex const numTerms = 3 * DeterministicReduction::blockSize + 3 * 7;
+  real64 const result = DeterministicReduction::localSum< parallelHostPolicy >( numTerms, termOf );
+  EXPECT_EQ( result, real64( ( numTerms + 1 ) / 3 ) );
+
+  // the same bits with a serial loop over the blocks
+  EXPECT_EQ( DeterministicReduction::localSum< serialPolicy >( numTerms, termOf ), result );
+}
+
+TEST( DeterministicReduction, LocalDot )
+{
+  localIndex const size = 2 * DeterministicReduction::blockSize + 5;
+  array1d< real64 > x( size );
+  array1d< real64 > y( size );
+  for( localIndex i = 0; i < size; ++i )
+  {
+    x[ i ] = term( i );
+    y[ i ] = 0.5;
+  }
+  EXPECT_EQ( DeterministicReduction::localDot( x.data(), y.data(), size ), 0.5 * ( ( size + 1 ) / 3 ) );
+}
+
+TEST( DeterministicReduction, RankOrderSum )
+{
+  int const rank = MpiWrapper::Comm_rank();
+  int const size = MpiWrapper::Comm_size();
+
+  auto rankValue = []( int const r, int const i )
+  {
+    return ( i == 0 ) ? 1.0 / ( r + 3.0 ) : ( r % 2 == 0 ? 1e16 : -1e16 ) + r;
+  };
+
+  real64 const localValues[ 2 ] = { rankValue( rank, 0 ), rankValue( rank, 1 ) };
+  real64 globalValues[ 2 ];
+  DeterministicReduction::sum( localValues, globalValues, 2, MPI_COMM_GEOSX );
+
+  // the values of the ranks added in rank order with compensation
+  for( int i = 0; i < 2; ++i )
+  {
+    DeterministicReduction::CompensatedSum expected;
+    for( int r = 0; r < size; ++r )
+    {
+      expected.add( rankValue( r, i ) );
+    }
+    EXPECT_EQ( globalValues[ i ], expected.value() );
+  }
+
+  EXPECT_EQ( DeterministicReduction::sum( 1.0, MPI_COMM_GEOSX ), real64( size ) );
+}
+
+TEST( DeterministicReduction, Enabled )
+{
+  EXPECT_FALSE( DeterministicReduction::isEnabled() );
+  DeterministicReduction::setEnabled( true );
+  EXPECT_TRUE( DeterministicReduction::isEnabled() );
+  DeterministicReduction::setEnabled( false );
+  EXPECT_FALSE( DeterministicReduction::isEnabled() );
+}
+
+int main( int ac, char * av[] )
+{
+  ::testing::InitGoogleTest( &ac, av );
+  geosx::basicSetup( ac, av );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -45,6 +45,22 @@ LinearSolverParametersInput::LinearSolverParametersInput( std::string const & na
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Whether to stop the simulation if the linear solver reports an error" );
 
+  registerWrapper( viewKeyStruct::captureSystemsString, &m_parameters.captureSystems )->
+    setApplyDefaultValue( m_parameters.captureSystems )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of linear systems (matrix, rhs and DoF layout) written to disk for offline replay, starting from the first solve" );
+
+  registerWrapper( viewKeyStruct::blockStorageString, &m_parameters.blockStorage )->
+    setApplyDefaultValue( m_parameters.blockStorage )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Whether to store the matrix by blocks of the components of its DoF field, if it has only one (PETSc BAIJ format, nodal hypre AMG)" );
+
+  registerWrapper( viewKeyStruct::dofOrderingString, &m_parameters.dofOrdering )->
+    setApplyDefaultValue( m_parameters.dofOrdering )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Ordering of the DoFs within each rank, interleaved and rcm improve the locality of coupled systems. "
+                    "Available options are:\n* " + EnumStrings< LinearSolverParameters::DofOrdering >::concat( "\n* " ) );
+
   registerWrapper( viewKeyStruct::directCheckResTolString, &m_parameters.direct.checkResidualTolerance )->
     setApplyDefaultValue( m_parameters.direct.checkResidualTolerance )->
     setInputFlag( InputFlags::OPTIONAL )->
@@ -80,6 +96,11 @@ LinearSolverParametersInput::LinearSolverParametersInput( std::string const & na
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Whether to use a parallel solver (instead of a serial one)" );
 
+  registerWrapper( viewKeyStruct::directReuseSymbString, &m_parameters.direct.reuseSymbolic )->
+    setApplyDefaultValue( m_parameters.direct.reuseSymbolic )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Whether to keep the ordering and symbolic factorization of the direct solver between solves of matrices with the same sparsity pattern (hypre only)" );
+
   registerWrapper( viewKeyStruct::krylovMaxIterString, &m_parameters.krylov.maxIterations )->
     setApplyDefaultValue( m_parameters.krylov.maxIterations )->
     setInputFlag( InputFlags::OPTIONAL )->
@@ -90,6 +111,16 @@ LinearSolverParametersInput::LinearSolverParametersInput( std::string const & na
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Maximum iterations before restart (GMRES only)" );
 
+  registerWrapper( viewKeyStruct::krylovRecycleSizeString, &m_parameters.krylov.recycleSize )->
+    setApplyDefaultValue( m_parameters.krylov.recycleSize )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of vectors of the deflation subspace recycled from one solve to the next (gcrodr only)" );
+
+  registerWrapper( viewKeyStruct::krylovStepSizeString, &m_parameters.krylov.stepSize )->
+    setApplyDefaultValue( m_parameters.krylov.stepSize )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of Krylov vectors generated and orthogonalized together (cagmres only)" );
+
   registerWrapper( viewKeyStruct::krylovTolString, &m_parameters.krylov.relTolerance )->
     setApplyDefaultValue( m_parameters.krylov.relTolerance )->
     setInputFlag( InputFlags::OPTIONAL )->
@@ -131,6 +162,16 @@ LinearSolverParametersInput::LinearSolverParametersInput( std::string const & na
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "AMG strength-of-connection threshold" );
 
+  registerWrapper( viewKeyStruct::amgAggressiveLevelsString, &m_parameters.amg.aggressiveNumLevels )->
+    setApplyDefaultValue( m_parameters.amg.aggressiveNumLevels )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of finest AMG levels coarsened aggressively, which yields smaller and sparser coarse levels (hypre only)" );
+
+  registerWrapper( viewKeyStruct::amgInterpMaxNonZeroString, &m_parameters.amg.interpMaxNonZeros )->
+    setApplyDefaultValue( m_parameters.amg.interpMaxNonZeros )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum number of nonzeros per row of the AMG interpolation, 0 to keep the default (hypre only)" );
+
   registerWrapper( viewKeyStruct::iluFillString, &m_parameters.ilu.fill )->
     setApplyDefaultValue( m_parameters.ilu.fill )->
     setInputFlag( InputFlags::OPTIONAL )->
@@ -140,6 +181,50 @@ LinearSolverParametersInput::LinearSolverParametersInput( std::string const & na
     setApplyDefaultValue( m_parameters.ilu.threshold )->
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "ILU(T) threshold factor" );
+
+  registerWrapper( viewKeyStruct::mgrStrategyString, &m_mgrStrategy )->
+    setApplyDefaultValue( "" )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "MGR strategy, empty to keep the default strategy of the solver (hypre only). Available options are: "
+                    "Poroelastic, Hydrofracture, CompositionalMultiphaseFlow, CompositionalMultiphaseReservoir, "
+                    "SinglePhaseReservoir, Custom" );
+
+  registerWrapper( viewKeyStruct::mgrFpointLabelsString, &m_parameters.mgr.fpointLabels )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "DoF component labels eliminated by the Custom MGR strategy, level after level. "
+                    "The components of the DoF fields are labeled consecutively, in the order of the fields" );
+
+  registerWrapper( viewKeyStruct::mgrNumFpointsString, &m_parameters.mgr.numFpointsPerLevel )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of DoF component labels eliminated at each level of the Custom MGR strategy" );
+
+  registerWrapper( viewKeyStruct::mgrCoarseSolverString, &m_parameters.mgr.coarseSolver )->
+    setApplyDefaultValue( m_parameters.mgr.coarseSolver )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Coarse grid solver of the Custom MGR strategy. Available options are: ilu, amg" );
+
+  registerWrapper( viewKeyStruct::cprPressurePrecondString, &m_parameters.cpr.pressurePrecond )->
+    setApplyDefaultValue( m_parameters.cpr.pressurePrecond )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Preconditioner of the CPR pressure stage, twoLevel requires the aggregates of the mesh regions (coarseningRatio). "
+                    "Available options are:\n* " + EnumStrings< LinearSolverParameters::CPR::PressureType >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::precondReuseString, &m_parameters.reuse.policy )->
+    setApplyDefaultValue( m_parameters.reuse.policy )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "When the preconditioner may be reused by the following solves (iterative solvers only). Available options are:\n* " +
+                    EnumStrings< LinearSolverParameters::Reuse::Policy >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::precondMaxReuseString, &m_parameters.reuse.maxSolves )->
+    setApplyDefaultValue( m_parameters.reuse.maxSolves )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum number of solves with the same preconditioner (numSolves reuse policy)" );
+
+  registerWrapper( viewKeyStruct::precondReuseGrowthString, &m_parameters.reuse.iterationGrowth )->
+    setApplyDefaultValue( m_parameters.reuse.iterationGrowth )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "The preconditioner is recomputed when the iterations of a solve exceed this factor times "
+                    "the iterations of the first solve with the preconditioner" );
 }
 
 void LinearSolverParametersInput::PostProcessInput()
@@ -149,16 +234,22 @@ void LinearSolverParametersInput::PostProcessInput()
   static const std::set< integer > binaryOptions = { 0, 1 };
 
   GEOSX_ERROR_IF( binaryOptions.count( m_parameters.stopIfError ) == 0, viewKeyStruct::stopIfErrorString << " option can be either 0 (false) or 1 (true)" );
+  GEOSX_ERROR_IF( binaryOptions.count( m_parameters.blockStorage ) == 0, viewKeyStruct::blockStorageString << " option can be either 0 (false) or 1 (true)" );
   GEOSX_ERROR_IF( binaryOptions.count( m_parameters.direct.equilibrate ) == 0, viewKeyStruct::directEquilString << " option can be either 0 (false) or 1 (true)" );
   GEOSX_ERROR_IF( binaryOptions.count( m_parameters.direct.replaceTinyPivot ) == 0, viewKeyStruct::directReplTinyPivotString << " option can be either 0 (false) or 1 (true)" );
   GEOSX_ERROR_IF( binaryOptions.count( m_parameters.direct.iterativeRefine ) == 0, viewKeyStruct::directIterRefString << " option can be either 0 (false) or 1 (true)" );
   GEOSX_ERROR_IF( binaryOptions.count( m_parameters.direct.parallel ) == 0, viewKeyStruct::directParallelString << " option can be either 0 (false) or 1 (true)" );
+  GEOSX_ERROR_IF( binaryOptions.count( m_parameters.direct.reuseSymbolic ) == 0, viewKeyStruct::directReuseSymbString << " option can be either 0 (false) or 1 (true)" );
+
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.captureSystems, 0, "Invalid value of " << viewKeyStruct::captureSystemsString );
 
   GEOSX_ERROR_IF_LT_MSG( m_parameters.direct.checkResidualTolerance, 0.0, "Invalid value of " << viewKeyStruct::krylovTolString );
   GEOSX_ERROR_IF_GT_MSG( m_parameters.direct.checkResidualTolerance, 1.0, "Invalid value of " << viewKeyStruct::krylovTolString );
 
   GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.maxIterations, 0, "Invalid value of " << viewKeyStruct::krylovMaxIterString );
   GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.maxRestart, 0, "Invalid value of " << viewKeyStruct::krylovMaxRestartString );
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.stepSize, 1, "Invalid value of " << viewKeyStruct::krylovStepSizeString );
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.recycleSize, 1, "Invalid value of " << viewKeyStruct::krylovRecycleSizeString );
 
   GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.relTolerance, 0.0, "Invalid value of " << viewKeyStruct::krylovTolString );
   GEOSX_ERROR_IF_GT_MSG( m_parameters.krylov.relTolerance, 1.0, "Invalid value of " << viewKeyStruct::krylovTolString );
@@ -169,8 +260,29 @@ void LinearSolverParametersInput::PostProcessInput()
   GEOSX_ERROR_IF_LT_MSG( m_parameters.amg.numSweeps, 0, "Invalid value of " << viewKeyStruct::amgNumSweepsString );
   GEOSX_ERROR_IF_LT_MSG( m_parameters.amg.threshold, 0.0, "Invalid value of " << viewKeyStruct::amgThresholdString );
   GEOSX_ERROR_IF_GT_MSG( m_parameters.amg.threshold, 1.0, "Invalid value of " << viewKeyStruct::amgThresholdString );
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.amg.aggressiveNumLevels, 0, "Invalid value of " << viewKeyStruct::amgAggressiveLevelsString );
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.amg.interpMaxNonZeros, 0, "Invalid value of " << viewKeyStruct::amgInterpMaxNonZeroString );
 
   // TODO input validation for other AMG parameters ?
+
+  if( !m_mgrStrategy.empty() )
+  {
+    m_parameters.mgr.strategy = m_mgrStrategy;
+  }
+
+  localIndex numFpointLabels = 0;
+  for( integer const numFpoints : m_parameters.mgr.numFpointsPerLevel )
+  {
+    GEOSX_ERROR_IF_LT_MSG( numFpoints, 1, "Invalid value of " << viewKeyStruct::mgrNumFpointsString );
+    numFpointLabels += numFpoints;
+  }
+  GEOSX_ERROR_IF_NE_MSG( numFpointLabels, m_parameters.mgr.fpointLabels.size(),
+                         viewKeyStruct::mgrNumFpointsString << " does not match the size of " << viewKeyStruct::mgrFpointLabelsString );
+  GEOSX_ERROR_IF( m_parameters.mgr.coarseSolver != "ilu" && m_parameters.mgr.coarseSolver != "amg",
+                  "Invalid value of " << viewKeyStruct::mgrCoarseSolverString << ", the options are ilu and amg" );
+
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.reuse.maxSolves, 1, "Invalid value of " << viewKeyStruct::precondMaxReuseString );
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.reuse.iterationGrowth, 1.0, "Invalid value of " << viewKeyStruct::precondReuseGrowthString );
 }
 
 REGISTER_CATALOG_ENTRY( Group, LinearSolverParametersInput, std::string const &, Group * const )
@@ -71,6 +71,9 @@ public:
     static constexpr auto solverTypeString         = "solverType";         ///< Solver type key
     static constexpr auto preconditionerTypeString = "preconditionerType"; ///< Preconditioner type key
     static constexpr auto stopIfErrorString        = "stopIfError";        ///< stop if error key
+    static constexpr auto captureSystemsString     = "captureSystems";     ///< number of captured systems key
+    static constexpr auto blockStorageString       = "blockStorage";       ///< block storage key
+    static constexpr auto dofOrderingString        = "dofOrdering";        ///< local DoF ordering key
 
     static constexpr auto directCheckResTolString   = "directCheckResTol";    ///< direct solver check residual tolerance key
     static constexpr auto directEquilString         = "directEquil";          ///< direct solver equilibrate key
@@ -79,26 +82,45 @@ public:
     static constexpr auto directReplTinyPivotString = "directReplTinyPivot";  ///< direct solver replace tiny pivot key
     static constexpr auto directIterRefString       = "directIterRef";        ///< direct solver iterative refinement key
     static constexpr auto directParallelString      = "directParallel";       ///< direct solver parallelism key
+    static constexpr auto directReuseSymbString     = "directReuseSymbolic";  ///< direct solver symbolic factorization reuse key
 
     static constexpr auto krylovMaxIterString     = "krylovMaxIter";     ///< Krylov max iterations key
     static constexpr auto krylovMaxRestartString  = "krylovMaxRestart";  ///< Krylov max iterations key
+    static constexpr auto krylovRecycleSizeString = "krylovRecycleSize"; ///< Krylov recycled subspace size key
+    static constexpr auto krylovStepSizeString    = "krylovStepSize";    ///< Krylov s-step block size key
     static constexpr auto krylovTolString         = "krylovTol";         ///< Krylov tolerance key
     static constexpr auto krylovAdaptiveTolString = "krylovAdaptiveTol"; ///< Krylov adaptive tolerance key
     static constexpr auto krylovWeakTolString     = "krylovWeakestTol";  ///< Krylov weakest tolerance key
 
-    static constexpr auto amgNumSweepsString = "amgNumSweeps";             ///< AMG number of sweeps key
-    static constexpr auto amgSmootherString  = "amgSmootherType";          ///< AMG smoother type key
-    static constexpr auto amgCoarseString    = "amgCoarseSolver";          ///< AMG coarse solver key
-    static constexpr auto amgThresholdString = "amgThreshold";             ///< AMG threshold key
+    static constexpr auto amgNumSweepsString        = "amgNumSweeps";               ///< AMG number of sweeps key
+    static constexpr auto amgSmootherString         = "amgSmootherType";            ///< AMG smoother type key
+    static constexpr auto amgCoarseString           = "amgCoarseSolver";            ///< AMG coarse solver key
+    static constexpr auto amgThresholdString        = "amgThreshold";               ///< AMG threshold key
+    static constexpr auto amgAggressiveLevelsString = "amgAggressiveLevels";        ///< AMG aggressive coarsening levels key
+    static constexpr auto amgInterpMaxNonZeroString = "amgInterpMaxNonZero";        ///< AMG interpolation truncation key
 
     static constexpr auto iluFillString      = "iluFill";       ///< ILU fill key
     static constexpr auto iluThresholdString = "iluThreshold";  ///< ILU threshold key
+
+    static constexpr auto mgrStrategyString        = "mgrStrategy";        ///< MGR strategy key
+    static constexpr auto mgrFpointLabelsString    = "mgrFpointLabels";    ///< MGR custom eliminated labels key
+    static constexpr auto mgrNumFpointsString      = "mgrNumFpointsPerLevel"; ///< MGR custom number of eliminated labels key
+    static constexpr auto mgrCoarseSolverString    = "mgrCoarseSolver";    ///< MGR custom coarse solver key
+
+    static constexpr auto cprPressurePrecondString = "cprPressurePrecond"; ///< CPR pressure stage preconditioner key
+
+    static constexpr auto precondReuseString       = "precondReuse";       ///< Preconditioner reuse policy key
+    static constexpr auto precondMaxReuseString    = "precondMaxReuse";    ///< Preconditioner max reuse key
+    static constexpr auto precondReuseGrowthString = "precondReuseGrowth"; ///< Preconditioner reuse iteration growth key
   } viewKeys;
 
 private:
 
   LinearSolverParameters m_parameters;
 
+  /// MGR strategy given in the input, replacing the default one of the solver if not empty
+  string m_mgrStrategy;
+
 };
 
 } // namespace geosx
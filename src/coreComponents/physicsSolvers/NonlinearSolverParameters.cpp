@@ -99,6 +99,62 @@ NonlinearSolverParameters::NonlinearSolverParameters( std::string const & name,
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Maximum number of time sub-steps allowed for the solver" );
 
+  registerWrapper( viewKeysStruct::timeStepControlString, &m_timeStepControl )->
+    setApplyDefaultValue( TimeStepControl::NewtonIterations )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "How the size of the next time step is chosen. Options are: \n "
+                    "* NewtonIterations - Double or halve the time step based on the number of Newton iterations.\n"
+                    "* TargetChange     - Scale the time step to bring the change of the primary variables to the targets of the solver.\n"
+                    "* Combined         - Take the smallest of the two time steps above." );
+
+  registerWrapper( viewKeysStruct::maxTimeStepIncreaseFactorString, &m_maxTimeStepIncreaseFactor )->
+    setApplyDefaultValue( 2.0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum factor by which the time step can grow from a step to the next one with a target change control. "
+                    "The time step is never reduced by more than timestepCutFactor." );
+
+  registerWrapper( viewKeysStruct::timeStepControlIntegralGainString, &m_timeStepControlIntegralGain )->
+    setApplyDefaultValue( 1.0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Exponent of the ratio of the target change to the change of the last step in the target change control." );
+
+  registerWrapper( viewKeysStruct::timeStepControlProportionalGainString, &m_timeStepControlProportionalGain )->
+    setApplyDefaultValue( 0.0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Exponent of the ratio of the changes of the two last steps in the target change control. "
+                    "A positive value damps the oscillations of the time step size." );
+
+  registerWrapper( viewKeysStruct::jacobianFreeString, &m_jacobianFree )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to solve the Newton systems with Jacobian-free products: the Krylov solver applies the Jacobian "
+                    "by finite differences of the residual, and the assembled matrix is only used to build the preconditioner. "
+                    "Requires an iterative linear solver." );
+
+  registerWrapper( viewKeysStruct::jacobianFreePerturbationString, &m_jacobianFreePerturbation )->
+    setApplyDefaultValue( 1.0e-6 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Norm of the perturbation of the primary variables in the finite differences of the Jacobian-free products. "
+                    "It should be small compared to the magnitude of the primary variables, but far above their round-off." );
+
+  registerWrapper( viewKeysStruct::nonlinearPreconditionerString, &m_nonlinearPreconditioner )->
+    setApplyDefaultValue( NonlinearPreconditioner::None )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Nonlinear iterations applied between the global Newton iterations. Options are: \n "
+                    "* None            - Only apply the global Newton iterations.\n"
+                    "* SubdomainNewton - After each global update, apply Newton iterations restricted to the unknowns of each rank, "
+                    "the other unknowns being frozen." );
+
+  registerWrapper( viewKeysStruct::subdomainMaxIterString, &m_subdomainMaxIter )->
+    setApplyDefaultValue( 3 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum number of subdomain Newton iterations after each global update." );
+
+  registerWrapper( viewKeysStruct::subdomainTolString, &m_subdomainTol )->
+    setApplyDefaultValue( 1.0e-2 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Reduction of the residual of each subdomain at which its Newton iterations stop." );
+
 
 
 }
@@ -109,6 +165,12 @@ void NonlinearSolverParameters::PostProcessInput()
   {
     GEOSX_ERROR( " dtIncIterLimit should be smaller than dtCutIterLimit!!" );
   }
+  GEOSX_ERROR_IF_LT_MSG( m_maxTimeStepIncreaseFactor, 1.0, "maxTimeStepIncreaseFactor should be at least 1" );
+  GEOSX_ERROR_IF_LT_MSG( m_timeStepControlIntegralGain, 0.0, "timeStepControlIntegralGain should be non-negative" );
+  GEOSX_ERROR_IF_LT_MSG( m_timeStepControlProportionalGain, 0.0, "timeStepControlProportionalGain should be non-negative" );
+  GEOSX_ERROR_IF_LE_MSG( m_jacobianFreePerturbation, 0.0, "jacobianFreePerturbation should be positive" );
+  GEOSX_ERROR_IF_LT_MSG( m_subdomainMaxIter, 1, "subdomainMaxIter should be at least 1" );
+  GEOSX_ERROR_IF_LE_MSG( m_subdomainTol, 0.0, "subdomainTol should be positive" );
 }
 
 
@@ -83,6 +83,18 @@ public:
     static constexpr auto minNumNewtonIterationsString  = "minNumberOfNewtonIterations";
     static constexpr auto timeStepCutFactorString       = "timestepCutFactor";
 
+    static constexpr auto timeStepControlString         = "timeStepControl";
+    static constexpr auto maxTimeStepIncreaseFactorString = "maxTimeStepIncreaseFactor";
+    static constexpr auto timeStepControlIntegralGainString = "timeStepControlIntegralGain";
+    static constexpr auto timeStepControlProportionalGainString = "timeStepControlProportionalGain";
+
+    static constexpr auto jacobianFreeString            = "jacobianFree";
+    static constexpr auto jacobianFreePerturbationString = "jacobianFreePerturbation";
+
+    static constexpr auto nonlinearPreconditionerString = "nonlinearPreconditioner";
+    static constexpr auto subdomainMaxIterString        = "subdomainMaxIter";
+    static constexpr auto subdomainTolString            = "subdomainTol";
+
   } viewKeys;
 
 
@@ -117,6 +129,25 @@ public:
     Require, ///< Use line search. If smaller residual than starting residual is not achieved, cut time step.
   };
 
+  /**
+   * @brief Indicates how the size of the next time step is chosen.
+   */
+  enum class TimeStepControl : integer
+  {
+    NewtonIterations, ///< Double or halve the time step based on the number of Newton iterations.
+    TargetChange,     ///< Scale the time step to bring the change of the primary variables to their targets.
+    Combined,         ///< Take the smallest of the two time steps above.
+  };
+
+  /**
+   * @brief Indicates the nonlinear iterations applied between the global Newton iterations.
+   */
+  enum class NonlinearPreconditioner : integer
+  {
+    None,            ///< Only apply the global Newton iterations.
+    SubdomainNewton, ///< Apply Newton iterations restricted to the unknowns of each rank after each global update.
+  };
+
   /// Flag to apply a line search.
   LineSearchAction m_lineSearchAction;
 
@@ -156,6 +187,33 @@ public:
   /// Factor by which the time step will be cut if a timestep cut is required.
   real64 m_timeStepCutFactor;
 
+  /// How the size of the next time step is chosen.
+  TimeStepControl m_timeStepControl;
+
+  /// Maximum factor by which the time step can grow from a step to the next one with a target change control.
+  real64 m_maxTimeStepIncreaseFactor;
+
+  /// Exponent of the ratio of the target change to the change of the last step.
+  real64 m_timeStepControlIntegralGain;
+
+  /// Exponent of the ratio of the changes of the two last steps.
+  real64 m_timeStepControlProportionalGain;
+
+  /// Flag to apply the Jacobian by finite differences of the residual in the Krylov solver.
+  integer m_jacobianFree;
+
+  /// Norm of the perturbation of the primary variables in the Jacobian-free products.
+  real64 m_jacobianFreePerturbation;
+
+  /// Nonlinear iterations applied between the global Newton iterations.
+  NonlinearPreconditioner m_nonlinearPreconditioner;
+
+  /// Maximum number of subdomain Newton iterations after each global update.
+  integer m_subdomainMaxIter;
+
+  /// Reduction of the residual of each subdomain at which its Newton iterations stop.
+  real64 m_subdomainTol;
+
   /// number of times that the time-step had to be cut
   integer m_numdtAttempts;
 
@@ -163,6 +221,10 @@ public:
 
 ENUM_STRINGS( NonlinearSolverParameters::LineSearchAction, "None", "Attempt", "Require" )
 
+ENUM_STRINGS( NonlinearSolverParameters::TimeStepControl, "NewtonIterations", "TargetChange", "Combined" )
+
+ENUM_STRINGS( NonlinearSolverParameters::NonlinearPreconditioner, "None", "SubdomainNewton" )
+
 } /* namespace geosx */
 
 #endif /* GEOSX_PHYSICSSOLVERS_NONLINEARSOLVERPARAMETERS_HPP_ */
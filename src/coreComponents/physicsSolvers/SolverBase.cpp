@@ -15,10 +15,17 @@
 #include "SolverBase.hpp"
 #include "PhysicsSolverManager.hpp"
 
+#include "common/Stopwatch.hpp"
 #include "common/TimingMacros.hpp"
+#include "linearAlgebra/interfaces/LinearOperator.hpp"
+#include "linearAlgebra/utilities/LAIHelperFunctions.hpp"
 #include "linearAlgebra/utilities/LinearSolverParameters.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
+#include "linearAlgebra/solvers/SeparateComponentPreconditioner.hpp"
 #include "managers/DomainPartition.hpp"
+#include "mpiCommunications/DeterministicReduction.hpp"
+#include "mpiCommunications/LoadBalanceStatistics.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
 
 namespace geosx
 {
@@ -32,9 +39,12 @@ SolverBase::SolverBase( std::string const & name,
   m_cflFactor(),
   m_maxStableDt{ 1e99 },
   m_nextDt( 1e99 ),
+  m_stepChange( -1.0 ),
+  m_previousStepChange( -1.0 ),
   m_dofManager( name ),
   m_linearSolverParameters( groupKeyStruct::linearSolverParametersString, this ),
-  m_nonlinearSolverParameters( groupKeyStruct::nonlinearSolverParametersString, this )
+  m_nonlinearSolverParameters( groupKeyStruct::nonlinearSolverParametersString, this ),
+  m_solverStatistics( groupKeyStruct::solverStatisticsString, this )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
@@ -77,6 +87,7 @@ SolverBase::SolverBase( std::string const & name,
 
   RegisterGroup( groupKeyStruct::linearSolverParametersString, &m_linearSolverParameters );
   RegisterGroup( groupKeyStruct::nonlinearSolverParametersString, &m_nonlinearSolverParameters );
+  RegisterGroup( groupKeyStruct::solverStatisticsString, &m_solverStatistics );
 
   m_localMatrix.setName( this->getName() + "/localMatrix" );
   m_localRhs.setName( this->getName() + "/localRhs" );
@@ -140,6 +151,8 @@ void SolverBase::Execute( real64 const time_n,
                           Group * const domain )
 {
   GEOSX_MARK_FUNCTION;
+  // the time of the step not spent in the assembly, the linear solve or the state update, such as the explicit kernels
+  LoadBalanceStatistics::ScopedPhase const stepPhase( "step " + getName() );
   real64 dtRemaining = dt;
   real64 nextDt = dt;
 
@@ -182,7 +195,29 @@ void SolverBase::Execute( real64 const time_n,
 void SolverBase::SetNextDt( real64 const & currentDt,
                             real64 & nextDt )
 {
-  SetNextDtBasedOnNewtonIter( currentDt, nextDt );
+  using TimeStepControl = NonlinearSolverParameters::TimeStepControl;
+
+  switch( m_nonlinearSolverParameters.m_timeStepControl )
+  {
+    case TimeStepControl::NewtonIterations:
+    {
+      SetNextDtBasedOnNewtonIter( currentDt, nextDt );
+      break;
+    }
+    case TimeStepControl::TargetChange:
+    {
+      SetNextDtBasedOnStepChange( currentDt, nextDt );
+      break;
+    }
+    case TimeStepControl::Combined:
+    {
+      real64 nextDtNewton;
+      SetNextDtBasedOnNewtonIter( currentDt, nextDtNewton );
+      SetNextDtBasedOnStepChange( currentDt, nextDt );
+      nextDt = std::min( nextDt, nextDtNewton );
+      break;
+    }
+  }
 }
 
 void SolverBase::SetNextDtBasedOnNewtonIter( real64 const & currentDt,
@@ -210,37 +245,83 @@ void SolverBase::SetNextDtBasedOnNewtonIter( real64 const & currentDt,
   }
 }
 
+void SolverBase::SetNextDtBasedOnStepChange( real64 const & currentDt,
+                                             real64 & nextDt )
+{
+  if( m_stepChange < 0.0 )
+  {
+    SetNextDtBasedOnNewtonIter( currentDt, nextDt );
+    return;
+  }
+
+  NonlinearSolverParameters const & params = m_nonlinearSolverParameters;
+
+  // a step that did not change anything lets the time step grow as much as allowed
+  real64 const change = std::max( m_stepChange, std::numeric_limits< real64 >::epsilon() );
+  real64 factor = std::pow( 1.0 / change, params.m_timeStepControlIntegralGain );
+  if( m_previousStepChange > 0.0 )
+  {
+    factor *= std::pow( m_previousStepChange / change, params.m_timeStepControlProportionalGain );
+  }
+  factor = std::min( std::max( factor, params.m_timeStepCutFactor ), params.m_maxTimeStepIncreaseFactor );
+
+  nextDt = factor * currentDt;
+  GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": normalized change of the step = " << m_stepChange
+                                       << ", time-step required will be scaled by " << factor << "." );
+}
+
+void SolverBase::SetStepChange( real64 const localChange )
+{
+  m_previousStepChange = m_stepChange;
+  m_stepChange = MpiWrapper::Max( localChange );
+}
+
 real64 SolverBase::LinearImplicitStep( real64 const & time_n,
                                        real64 const & dt,
                                        integer const GEOSX_UNUSED_PARAM( cycleNumber ),
                                        DomainPartition & domain )
 {
+  if( !m_precondReuse.markedByCoupling )
+  {
+    m_precondReuse.newTimeStep = true;
+  }
+
+  m_solverStatistics.beginTimeStep();
+
   // call setup for physics solver. Pre step allocations etc.
   // TODO: Nonlinear step does not call its own setup, need to decide on consistent behavior
   ImplicitStepSetup( time_n, dt, domain );
 
-  // zero out matrix/rhs before assembly
-  m_localMatrix.setValues< parallelDevicePolicy<> >( 0.0 );
-  m_localRhs.setValues< parallelDevicePolicy<> >( 0.0 );
-
-  // call assemble to fill the matrix and the rhs
-  AssembleSystem( time_n,
-                  dt,
-                  domain,
-                  m_dofManager,
-                  m_localMatrix.toViewConstSizes(),
-                  m_localRhs.toView() );
-
-  // apply boundary conditions to system
-  ApplyBoundaryConditions( time_n,
-                           dt,
-                           domain,
-                           m_dofManager,
-                           m_localMatrix.toViewConstSizes(),
-                           m_localRhs.toView() );
+  {
+    LoadBalanceStatistics::ScopedPhase const assemblyPhase( "assembly " + getName() );
+    Stopwatch assemblyWatch;
+
+    // zero out matrix/rhs before assembly
+    m_localMatrix.setValues< parallelDevicePolicy<> >( 0.0 );
+    m_localRhs.setValues< parallelDevicePolicy<> >( 0.0 );
+
+    // call assemble to fill the matrix and the rhs
+    AssembleSystem( time_n,
+                    dt,
+                    domain,
+                    m_dofManager,
+                    m_localMatrix.toViewConstSizes(),
+                    m_localRhs.toView() );
+
+    // apply boundary conditions to system
+    ApplyBoundaryConditions( time_n,
+                             dt,
+                             domain,
+                             m_dofManager,
+                             m_localMatrix.toViewConstSizes(),
+                             m_localRhs.toView() );
+
+    m_solverStatistics.addAssemblyTime( assemblyWatch.elapsedTime() );
+  }
 
   // Compose parallel LA matrix/rhs out of local LA matrix/rhs
-  m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
+  localIndex const blockSize = m_linearSolverParameters.get().blockStorage ? m_dofManager.blockSize() : 1;
+  m_matrix.create( m_localMatrix.toViewConst(), blockSize, MPI_COMM_GEOSX );
   m_rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
   m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
 
@@ -258,11 +339,16 @@ real64 SolverBase::LinearImplicitStep( real64 const & time_n,
   m_solution.extract( m_localSolution );
 
   // apply the system solution to the fields/variables
-  ApplySystemSolution( m_dofManager, m_localSolution, 1.0, domain );
+  {
+    LoadBalanceStatistics::ScopedPhase const updatePhase( "state update " + getName() );
+    ApplySystemSolution( m_dofManager, m_localSolution, 1.0, domain );
+  }
 
   // final step for completion of timestep. typically secondary variable updates and cleanup.
   ImplicitStepComplete( time_n, dt, domain );
 
+  m_solverStatistics.endTimeStep();
+
   // return the achieved timestep
   return dt;
 }
@@ -310,8 +396,8 @@ bool SolverBase::LineSearch( real64 const & time_n,
     ApplySystemSolution( dofManager, localSolution, localScaleFactor, domain );
 
     // re-assemble system
-    localMatrix.setValues< parallelDevicePolicy<> >( 0.0 );
-    localRhs.setValues< parallelDevicePolicy<> >( 0.0 );
+    localMatrix.setValues< parallelDeviceAsyncPolicy<> >( 0.0 );
+    localRhs.setValues< parallelDeviceAsyncPolicy<> >( 0.0 );
     AssembleSystem( time_n, dt, domain, dofManager, localMatrix, localRhs );
 
     // apply boundary conditions to system
@@ -392,6 +478,67 @@ real64 SolverBase::EisenstatWalker( real64 const newNewtonNorm,
   return krylovTol;
 }
 
+/**
+ * @brief Jacobian of the residual applied by a first-order finite difference, J v = ( R( u + e v ) - R( u ) ) / e.
+ *
+ * The perturbation e = b / ||v||, b being the jacobianFreePerturbation parameter, is applied and removed with
+ * ApplySystemSolution(), and R( u ) is the residual assembled by the Newton iteration, in the local rhs. The solvers
+ * solving J du = rhs with the assembled rhs instead of its opposite assemble -R, and get the opposite difference.
+ */
+class SolverBase::JacobianFreeOperator : public LinearOperator< ParallelVector >
+{
+public:
+
+  explicit JacobianFreeOperator( SolverBase & solver ):
+    m_solver( solver )
+  {}
+
+  virtual void apply( ParallelVector const & src, ParallelVector & dst ) const override
+  {
+    GEOSX_MARK_FUNCTION;
+
+    JacobianFree & jf = m_solver.m_jacobianFree;
+    DofManager const & dofManager = m_solver.m_dofManager;
+
+    real64 const srcNorm = src.norm2();
+    if( srcNorm <= 0.0 )
+    {
+      dst.zero();
+      return;
+    }
+    real64 const eps = m_solver.m_nonlinearSolverParameters.m_jacobianFreePerturbation / srcNorm;
+
+    jf.perturbation.resize( src.localSize() );
+    jf.residual.resize( m_solver.m_localRhs.size() );
+    src.extract( jf.perturbation );
+
+    m_solver.ApplySystemSolution( dofManager, jf.perturbation.toViewConst(), eps, *jf.domain );
+    jf.residual.setValues< parallelDevicePolicy<> >( 0.0 );
+    m_solver.AssembleResidual( jf.time, jf.dt, *jf.domain, dofManager, jf.residual.toView() );
+    m_solver.ApplySystemSolution( dofManager, jf.perturbation.toViewConst(), -eps, *jf.domain );
+
+    real64 const scale = -jf.rhsSign / eps;
+    arrayView1d< real64 > const residual = jf.residual.toView();
+    arrayView1d< real64 const > const baseResidual = m_solver.m_localRhs.toViewConst();
+    forAll< parallelDevicePolicy<> >( residual.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+    {
+      residual[i] = scale * ( residual[i] - baseResidual[i] );
+    } );
+
+    dst.create( jf.residual.toViewConst(), MPI_COMM_GEOSX );
+  }
+
+  virtual globalIndex numGlobalRows() const override
+  { return m_solver.m_dofManager.numGlobalDofs(); }
+
+  virtual globalIndex numGlobalCols() const override
+  { return m_solver.m_dofManager.numGlobalDofs(); }
+
+private:
+
+  SolverBase & m_solver;
+};
+
 real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
                                           real64 const & dt,
                                           integer const cycleNumber,
@@ -402,6 +549,11 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
   // value to track the achieved dt for this step.
   real64 stepDt = dt;
 
+  if( !m_precondReuse.markedByCoupling )
+  {
+    m_precondReuse.newTimeStep = true;
+  }
+
   integer const maxNewtonIter = m_nonlinearSolverParameters.m_maxIterNewton;
   integer const minNewtonIter = m_nonlinearSolverParameters.m_minIterNewton;
   real64 const newtonTol = m_nonlinearSolverParameters.m_newtonTol;
@@ -416,6 +568,8 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
   // a flag to denote whether we have converged
   integer isConverged = 0;
 
+  m_solverStatistics.beginTimeStep();
+
   // outer loop attempts to apply full timestep, and managed the cutting of the timestep if
   // required.
   for( dtAttempt = 0; dtAttempt < maxNumberDtCuts; ++dtAttempt )
@@ -424,6 +578,7 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
     if( dtAttempt > 0 )
     {
       ResetStateToBeginningOfStep( domain );
+      m_solverStatistics.addTimeStepCut();
     }
 
     // keep residual from previous iteration in case we need to do a line search
@@ -441,25 +596,32 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
         std::cout << output << std::endl;
       }
 
-      // zero out matrix/rhs before assembly
-      m_localMatrix.setValues< parallelDevicePolicy<> >( 0.0 );
-      m_localRhs.setValues< parallelDevicePolicy<> >( 0.0 );
-
-      // call assemble to fill the matrix and the rhs
-      AssembleSystem( time_n,
-                      stepDt,
-                      domain,
-                      m_dofManager,
-                      m_localMatrix.toViewConstSizes(),
-                      m_localRhs.toView() );
-
-      // apply boundary conditions to system
-      ApplyBoundaryConditions( time_n,
-                               stepDt,
-                               domain,
-                               m_dofManager,
-                               m_localMatrix.toViewConstSizes(),
-                               m_localRhs.toView() );
+      {
+        LoadBalanceStatistics::ScopedPhase const assemblyPhase( "assembly " + getName() );
+        Stopwatch assemblyWatch;
+
+        // zero out matrix/rhs before assembly, the assembly kernels follow on the stream without waiting on the host
+        m_localMatrix.setValues< parallelDeviceAsyncPolicy<> >( 0.0 );
+        m_localRhs.setValues< parallelDeviceAsyncPolicy<> >( 0.0 );
+
+        // call assemble to fill the matrix and the rhs
+        AssembleSystem( time_n,
+                        stepDt,
+                        domain,
+                        m_dofManager,
+                        m_localMatrix.toViewConstSizes(),
+                        m_localRhs.toView() );
+
+        // apply boundary conditions to system
+        ApplyBoundaryConditions( time_n,
+                                 stepDt,
+                                 domain,
+                                 m_dofManager,
+                                 m_localMatrix.toViewConstSizes(),
+                                 m_localRhs.toView() );
+
+        m_solverStatistics.addAssemblyTime( assemblyWatch.elapsedTime() );
+      }
 
       // TODO: maybe add scale function here?
       // Scale()
@@ -534,16 +696,23 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
         krylovParams.relTolerance = EisenstatWalker( residualNorm, lastResidual, krylovParams.weakestTol );
       }
 
-      // Compose parallel LA matrix/rhs out of local LA matrix/rhs
-      m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
+      // Compose parallel LA matrix/rhs out of local LA matrix/rhs, by blocks of the field components if requested
+      localIndex const blockSize = m_linearSolverParameters.get().blockStorage ? m_dofManager.blockSize() : 1;
+      m_matrix.create( m_localMatrix.toViewConst(), blockSize, MPI_COMM_GEOSX );
       m_rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
       m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
 
       // Output the linear system matrix/rhs for debugging purposes
       DebugOutputSystem( time_n, cycleNumber, newtonIter, m_matrix, m_rhs );
 
-      // Solve the linear system
+      // Solve the linear system, the Krylov solver may apply the Jacobian by finite differences of the residual
+      m_jacobianFree.active = m_nonlinearSolverParameters.m_jacobianFree > 0;
+      m_jacobianFree.time = time_n;
+      m_jacobianFree.dt = stepDt;
+      m_jacobianFree.domain = &domain;
+      m_solverStatistics.addNewtonIteration();
       SolveSystem( m_dofManager, m_matrix, m_rhs, m_solution );
+      m_jacobianFree.active = false;
 
       // Output the linear system solution for debugging purposes
       DebugOutputSolution( time_n, cycleNumber, newtonIter, m_solution );
@@ -562,7 +731,16 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
       }
 
       // apply the system solution to the fields/variables
-      ApplySystemSolution( m_dofManager, m_localSolution, scaleFactor, domain );
+      {
+        LoadBalanceStatistics::ScopedPhase const updatePhase( "state update " + getName() );
+        ApplySystemSolution( m_dofManager, m_localSolution, scaleFactor, domain );
+      }
+
+      // reduce the local nonlinearities before the next global iteration
+      if( m_nonlinearSolverParameters.m_nonlinearPreconditioner == NonlinearSolverParameters::NonlinearPreconditioner::SubdomainNewton )
+      {
+        SubdomainNewtonIterations( time_n, stepDt, domain, SolvedRhsSign( m_rhs ) );
+      }
 
       lastResidual = residualNorm;
     }
@@ -593,6 +771,8 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
     }
   }
 
+  m_solverStatistics.endTimeStep();
+
   // return the achieved timestep
   return stepDt;
 }
@@ -631,15 +811,23 @@ void SolverBase::SetupSystem( DomainPartition & domain,
   dofManager.setMesh( domain, 0, 0 );
 
   SetupDofs( domain, dofManager );
-  dofManager.reorderByRank();
+  dofManager.reorderByRank( m_linearSolverParameters.get().dofOrdering );
 
   localIndex const numLocalRows = dofManager.numLocalDofs();
 
-  SparsityPattern< globalIndex > pattern;
   if( setSparsity )
   {
-    dofManager.setSparsityPattern( pattern );
-    localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+    // as long as the DOF layout is unchanged, the matrix keeps its sparsity pattern and only its values are reset
+    if( dofManager.canReuseSparsityPattern( localMatrix ) )
+    {
+      localMatrix.setValues< parallelDevicePolicy<> >( 0.0 );
+    }
+    else
+    {
+      SparsityPattern< globalIndex > pattern;
+      dofManager.setSparsityPattern( pattern );
+      localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+    }
   }
 
   localRhs.resize( numLocalRows );
@@ -670,6 +858,17 @@ void SolverBase::ApplyBoundaryConditions( real64 const GEOSX_UNUSED_PARAM( time
   GEOSX_ERROR( "SolverBase::ApplyBoundaryConditions called!. Should be overridden." );
 }
 
+void SolverBase::AssembleResidual( real64 const time,
+                                   real64 const dt,
+                                   DomainPartition & domain,
+                                   DofManager const & dofManager,
+                                   arrayView1d< real64 > const & localRhs )
+{
+  m_localMatrix.setValues< parallelDevicePolicy<> >( 0.0 );
+  AssembleSystem( time, dt, domain, dofManager, m_localMatrix.toViewConstSizes(), localRhs );
+  ApplyBoundaryConditions( time, dt, domain, dofManager, m_localMatrix.toViewConstSizes(), localRhs );
+}
+
 namespace
 {
 
@@ -752,12 +951,56 @@ void SolverBase::DebugOutputSolution( real64 const & time,
                        getLogLevel() >= 3 );
 }
 
+void ResidualNormParts::reduce()
+{
+  // a single allreduce per operation, whatever the number of solvers and subregions
+  if( !m_sums.empty() )
+  {
+    std::vector< real64 > const localSums( m_sums );
+    if( DeterministicReduction::isEnabled() )
+    {
+      DeterministicReduction::sum( localSums.data(), m_sums.data(), LvArray::integerConversion< int >( m_sums.size() ), MPI_COMM_GEOSX );
+    }
+    else
+    {
+      MpiWrapper::allReduce( localSums.data(), m_sums.data(), LvArray::integerConversion< int >( m_sums.size() ), MPI_SUM, MPI_COMM_GEOSX );
+    }
+  }
+  if( !m_maxima.empty() )
+  {
+    std::vector< real64 > const localMaxima( m_maxima );
+    MpiWrapper::allReduce( localMaxima.data(), m_maxima.data(), LvArray::integerConversion< int >( m_maxima.size() ), MPI_MAX, MPI_COMM_GEOSX );
+  }
+  m_sumCursor = 0;
+  m_maxCursor = 0;
+}
+
+real64
+SolverBase::CalculateResidualNorm( DomainPartition const & domain,
+                                   DofManager const & dofManager,
+                                   arrayView1d< real64 const > const & localRhs )
+{
+  GEOSX_MARK_FUNCTION;
+
+  ResidualNormParts parts;
+  CalculateLocalResidualNorms( domain, dofManager, localRhs, parts );
+  parts.reduce();
+  return CombineResidualNorms( parts );
+}
+
+void
+SolverBase::CalculateLocalResidualNorms( DomainPartition const & GEOSX_UNUSED_PARAM( domain ),
+                                         DofManager const & GEOSX_UNUSED_PARAM( dofManager ),
+                                         arrayView1d< real64 const > const & GEOSX_UNUSED_PARAM( localRhs ),
+                                         ResidualNormParts & GEOSX_UNUSED_PARAM( parts ) )
+{
+  GEOSX_ERROR( "SolverBase::CalculateLocalResidualNorms called!. Should be overridden." );
+}
+
 real64
-SolverBase::CalculateResidualNorm( DomainPartition const & GEOSX_UNUSED_PARAM( domain ),
-                                   DofManager const & GEOSX_UNUSED_PARAM( dofManager ),
-                                   arrayView1d< real64 const > const & GEOSX_UNUSED_PARAM( localRhs ) )
+SolverBase::CombineResidualNorms( ResidualNormParts & GEOSX_UNUSED_PARAM( parts ) )
 {
-  GEOSX_ERROR( "SolverBase::CalculateResidualNorm called!. Should be overridden." );
+  GEOSX_ERROR( "SolverBase::CombineResidualNorms called!. Should be overridden." );
   return 0;
 }
 
@@ -767,6 +1010,7 @@ void SolverBase::SolveSystem( DofManager const & dofManager,
                               ParallelVector & solution )
 {
   GEOSX_MARK_FUNCTION;
+  LoadBalanceStatistics::ScopedPhase const solvePhase( "linear solve " + getName() );
 
 //  Keep for debugging comparisons
 //  static int count = 0;
@@ -780,24 +1024,119 @@ void SolverBase::SolveSystem( DofManager const & dofManager,
 
   LinearSolverParameters const & params = m_linearSolverParameters.get();
 
+  if( m_numCapturedSystems < params.captureSystems )
+  {
+    string const prefix = getName() + "_system_" + std::to_string( m_numCapturedSystems );
+    GEOSX_LOG_RANK_0( "Writing linear system to " << prefix );
+    LAIHelperFunctions::WriteLinearSystem( prefix, matrix, rhs, dofManager );
+    ++m_numCapturedSystems;
+  }
+
   // TODO: We probably want to keep an instance of linear solver as a member of physics solver
   //       so we can have constant access to last solve statistics, convergence history, etc.
   //       This requires unifying "LAI interface" solvers with "native" Krylov solvers somehow.
 
+  GEOSX_ERROR_IF( m_jacobianFree.active && params.solverType == LinearSolverParameters::SolverType::direct,
+                  getName() << ": the Jacobian-free products require an iterative linear solver" );
+
+  if( m_jacobianFree.active )
+  {
+    m_jacobianFree.rhsSign = SolvedRhsSign( rhs );
+  }
+
+  // the Jacobian-free products are only applied by the native Krylov solvers, the matrix only builds the preconditioner
+  bool const nativeOnly = params.solverType == LinearSolverParameters::SolverType::pipecg ||
+                          params.solverType == LinearSolverParameters::SolverType::cagmres ||
+                          params.solverType == LinearSolverParameters::SolverType::gcrodr ||
+                          m_jacobianFree.active;
+
+  bool const reusePrecond = params.reuse.policy != LinearSolverParameters::Reuse::Policy::never &&
+                            params.preconditionerType != LinearSolverParameters::PreconditionerType::none &&
+                            ( params.solverType == LinearSolverParameters::SolverType::cg ||
+                              params.solverType == LinearSolverParameters::SolverType::gmres ||
+                              params.solverType == LinearSolverParameters::SolverType::bicgstab ||
+                              nativeOnly );
+
+  // some solvers and the reuse of the preconditioner are only available with the native Krylov solvers
+  if( ( reusePrecond || nativeOnly ) && !m_precond )
+  {
+    m_precond = LAInterface::createPreconditioner( params, dofManager );
+    if( params.amg.separateComponents && params.preconditionerType == LinearSolverParameters::PreconditionerType::amg )
+    {
+      m_precond = std::make_unique< SeparateComponentPreconditioner< LAInterface > >( params.dofsPerNode, std::move( m_precond ) );
+    }
+    m_precondReuse.recompute = true;
+  }
+
+  // the time of the setup of the native preconditioners is measured here, the other solvers report it
+  real64 setupTime = 0.0;
+  real64 solveTime = 0.0;
+  Stopwatch linearWatch;
+
   if( params.solverType == LinearSolverParameters::SolverType::direct || !m_precond )
   {
-    LinearSolver solver( params );
-    solver.solve( matrix, solution, rhs, &dofManager );
-    m_linearSolverResult = solver.result();
+    // the direct solver is kept between solves to reuse the symbolic part of its factorization
+    bool const keepSolver = params.solverType == LinearSolverParameters::SolverType::direct && params.direct.reuseSymbolic;
+    if( !keepSolver || !m_directSolver )
+    {
+      m_directSolver = std::make_unique< LinearSolver >( params );
+    }
+    m_directSolver->solve( matrix, solution, rhs, &dofManager );
+    m_linearSolverResult = m_directSolver->result();
+    setupTime = m_linearSolverResult.setupTime;
+    solveTime = m_linearSolverResult.solveTime;
+    if( !keepSolver )
+    {
+      m_directSolver.reset();
+    }
+  }
+  else if( !reusePrecond )
+  {
+    m_precond->compute( matrix, dofManager );
+    setupTime = linearWatch.elapsedTime();
+    linearWatch.zero();
+    SolveWithKrylovSolver( params, matrix, rhs, solution );
+    solveTime = linearWatch.elapsedTime();
   }
   else
   {
-    m_precond->compute( matrix, dofManager );
-    std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::Create( params, matrix, *m_precond );
-    solver->solve( rhs, solution );
-    m_linearSolverResult = solver->result();
+    PrecondReuse & reuse = m_precondReuse;
+    if( reuse.recompute ||
+        ( params.reuse.policy == LinearSolverParameters::Reuse::Policy::timeStep && reuse.newTimeStep ) ||
+        ( params.reuse.policy == LinearSolverParameters::Reuse::Policy::numSolves && reuse.numSolves >= params.reuse.maxSolves ) )
+    {
+      // the preconditioner may keep pointers to its matrix, which is rebuilt by the next assembly:
+      // it is computed from a copy that lives as long as the preconditioner is reused, and the
+      // previous copy is only released once the preconditioner no longer refers to it
+      std::unique_ptr< ParallelMatrix > precondMatrix = std::make_unique< ParallelMatrix >( matrix );
+      m_precond->compute( *precondMatrix, dofManager );
+      reuse.matrix = std::move( precondMatrix );
+      reuse.numSolves = 0;
+      reuse.recompute = false;
+      GEOSX_LOG_LEVEL_RANK_0( 2, getName() << ": preconditioner recomputed" );
+    }
+    reuse.newTimeStep = false;
+
+    setupTime = linearWatch.elapsedTime();
+    linearWatch.zero();
+    SolveWithKrylovSolver( params, matrix, rhs, solution );
+    solveTime = linearWatch.elapsedTime();
+
+    // the first solve sets the reference iteration count, a growth beyond it means the preconditioner is outdated
+    if( reuse.numSolves == 0 )
+    {
+      reuse.referenceIterations = m_linearSolverResult.numIterations;
+    }
+    else if( m_linearSolverResult.numIterations > params.reuse.iterationGrowth * reuse.referenceIterations )
+    {
+      reuse.recompute = true;
+    }
+    reuse.recompute = reuse.recompute || !m_linearSolverResult.success();
+    ++reuse.numSolves;
   }
 
+  m_solverStatistics.addLinearSolve( m_linearSolverResult.numIterations, setupTime, solveTime );
+
   //  Keep for debugging comparisons
 //  if( count < 2 )
 //  {
@@ -817,6 +1156,154 @@ void SolverBase::SolveSystem( DofManager const & dofManager,
   }
 }
 
+real64 SolverBase::SolvedRhsSign( ParallelVector const & rhs ) const
+{
+  // the solved rhs is the assembled one, scaled by -1 by most solvers
+  real64 const * const rhsValues = rhs.extractLocalVector();
+  arrayView1d< real64 const > const localRhs = m_localRhs.toViewConst();
+  localRhs.move( LvArray::MemorySpace::CPU, false );
+  real64 localDot = 0.0;
+  for( localIndex i = 0; i < rhs.localSize(); ++i )
+  {
+    localDot += rhsValues[i] * localRhs[i];
+  }
+  return MpiWrapper::Sum( localDot ) < 0.0 ? -1.0 : 1.0;
+}
+
+void SolverBase::SubdomainNewtonIterations( real64 const time_n,
+                                            real64 const dt,
+                                            DomainPartition & domain,
+                                            real64 const rhsSign )
+{
+  GEOSX_MARK_FUNCTION;
+
+  integer const maxIter = m_nonlinearSolverParameters.m_subdomainMaxIter;
+  real64 const tol = m_nonlinearSolverParameters.m_subdomainTol;
+
+  // the subdomain systems are small enough to be solved directly
+  LinearSolverParameters params = m_linearSolverParameters.get();
+  params.solverType = LinearSolverParameters::SolverType::direct;
+  params.logLevel = 0;
+
+  globalIndex const rankOffset = m_dofManager.rankOffset();
+  localIndex const numRows = m_localRhs.size();
+
+  real64 initialNorm = -1.0;
+  integer iter = 0;
+  for( ; iter < maxIter; ++iter )
+  {
+    m_localMatrix.setValues< parallelDeviceAsyncPolicy<> >( 0.0 );
+    m_localRhs.setValues< parallelDeviceAsyncPolicy<> >( 0.0 );
+    AssembleSystem( time_n, dt, domain, m_dofManager, m_localMatrix.toViewConstSizes(), m_localRhs.toView() );
+    ApplyBoundaryConditions( time_n, dt, domain, m_dofManager, m_localMatrix.toViewConstSizes(), m_localRhs.toView() );
+
+    arrayView1d< real64 const > const localRhs = m_localRhs.toViewConst();
+    localRhs.move( LvArray::MemorySpace::CPU, false );
+    real64 norm = 0.0;
+    for( localIndex i = 0; i < numRows; ++i )
+    {
+      norm += localRhs[i] * localRhs[i];
+    }
+    norm = std::sqrt( norm );
+    if( initialNorm < 0.0 )
+    {
+      initialNorm = norm;
+    }
+
+    bool const converged = norm <= tol * initialNorm;
+    if( MpiWrapper::Min( converged ? 1 : 0 ) == 1 )
+    {
+      break;
+    }
+
+    // the diagonal block of the rank, renumbered from zero
+    CRSMatrixView< real64 const, globalIndex const > const localMatrix = m_localMatrix.toViewConst();
+    localMatrix.move( LvArray::MemorySpace::CPU, false );
+    array1d< localIndex > rowLengths( numRows );
+    for( localIndex row = 0; row < numRows; ++row )
+    {
+      arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( row );
+      for( localIndex k = 0; k < cols.size(); ++k )
+      {
+        rowLengths[row] += ( cols[k] >= rankOffset && cols[k] < rankOffset + numRows ) ? 1 : 0;
+      }
+    }
+
+    CRSMatrix< real64, globalIndex > blockMatrix;
+    blockMatrix.resizeFromRowCapacities< serialPolicy >( numRows, numRows, rowLengths.data() );
+    array1d< real64 > blockRhs( numRows );
+    for( localIndex row = 0; row < numRows; ++row )
+    {
+      arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( row );
+      arraySlice1d< real64 const > const values = localMatrix.getEntries( row );
+      for( localIndex k = 0; k < cols.size(); ++k )
+      {
+        if( cols[k] >= rankOffset && cols[k] < rankOffset + numRows )
+        {
+          blockMatrix.insertNonZero( row, cols[k] - rankOffset, values[k] );
+        }
+      }
+      // a converged rank still takes part in the synchronizations, with a zero update
+      blockRhs[row] = converged ? 0.0 : rhsSign * localRhs[row];
+    }
+
+    ParallelMatrix matrix;
+    ParallelVector rhs;
+    ParallelVector solution;
+    matrix.create( blockMatrix.toViewConst(), MPI_COMM_SELF );
+    rhs.create( blockRhs.toViewConst(), MPI_COMM_SELF );
+    solution.createWithLocalSize( numRows, MPI_COMM_SELF );
+    if( !converged )
+    {
+      LinearSolver solver( params );
+      solver.solve( matrix, solution, rhs );
+    }
+    solution.extract( m_localSolution );
+
+    real64 const scaleFactor = ScalingForSystemSolution( domain, m_dofManager, m_localSolution );
+    if( !CheckSystemSolution( domain, m_dofManager, m_localSolution, scaleFactor ) )
+    {
+      break;
+    }
+    {
+      LoadBalanceStatistics::ScopedPhase const updatePhase( "state update " + getName() );
+      ApplySystemSolution( m_dofManager, m_localSolution, scaleFactor, domain );
+    }
+  }
+
+  GEOSX_LOG_LEVEL_RANK_0( 2, "    Subdomain Newton iterations: " << iter );
+}
+
+void SolverBase::SolveWithKrylovSolver( LinearSolverParameters const & params,
+                                        ParallelMatrix & matrix,
+                                        ParallelVector & rhs,
+                                        ParallelVector & solution )
+{
+  // the Jacobian-free operator only lives for this solve, and changes with the state anyway
+  JacobianFreeOperator const jacobianFreeOperator( *this );
+  LinearOperator< ParallelVector > const & op = m_jacobianFree.active
+                                                ? static_cast< LinearOperator< ParallelVector > const & >( jacobianFreeOperator )
+                                                : matrix;
+
+  bool const recycle = params.solverType == LinearSolverParameters::SolverType::gcrodr && !m_jacobianFree.active;
+  if( !m_krylovSolver || !recycle || m_krylovSolverMatrix != &op || m_krylovSolverPrecond != m_precond.get() )
+  {
+    m_krylovSolver = KrylovSolver< ParallelVector >::Create( params, op, *m_precond );
+    m_krylovSolverMatrix = &op;
+    m_krylovSolverPrecond = m_precond.get();
+  }
+
+  // the tolerance may be adapted from one Newton iteration to the next
+  m_krylovSolver->setTolerance( params.krylov.relTolerance );
+  m_krylovSolver->solve( rhs, solution );
+  m_linearSolverResult = m_krylovSolver->result();
+
+  if( !recycle )
+  {
+    m_krylovSolver.reset();
+  }
+}
+
 bool SolverBase::CheckSystemSolution( DomainPartition const & GEOSX_UNUSED_PARAM( domain ),
                                       DofManager const & GEOSX_UNUSED_PARAM( dofManager ),
                                       arrayView1d< real64 const > const & GEOSX_UNUSED_PARAM( localSolution ),
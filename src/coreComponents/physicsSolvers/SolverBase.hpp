@@ -25,6 +25,7 @@
 #include "mesh/MeshBody.hpp"
 #include "physicsSolvers/NonlinearSolverParameters.hpp"
 #include "physicsSolvers/LinearSolverParameters.hpp"
+#include "physicsSolvers/SolverStatistics.hpp"
 
 #include <string>
 #include <limits>
@@ -33,6 +34,67 @@ namespace geosx
 {
 
 class DomainPartition;
+template< typename VECTOR > class KrylovSolver;
+
+/**
+ * @class ResidualNormParts
+ * @brief The rank-local partial results of a residual norm.
+ *
+ * The solvers append their partial results, reduced over the ranks in one allreduce per
+ * operation, then read them back in the same order to combine them into their norm, so that
+ * the norms of the solvers of a coupling are computed with a single pair of allreduces.
+ */
+class ResidualNormParts
+{
+public:
+
+  /**
+   * @brief Append a partial result summed over the ranks.
+   * @param value the rank-local value
+   */
+  void appendSum( real64 const value )
+  { m_sums.emplace_back( value ); }
+
+  /**
+   * @brief Append a partial result whose maximum is taken over the ranks.
+   * @param value the rank-local value
+   */
+  void appendMax( real64 const value )
+  { m_maxima.emplace_back( value ); }
+
+  /**
+   * @brief Reduce the partial results over the ranks and rewind the reading.
+   */
+  void reduce();
+
+  /**
+   * @brief Read the next reduced sum.
+   * @return the sum over the ranks of the next value appended with appendSum()
+   */
+  real64 nextSum()
+  { return m_sums[ m_sumCursor++ ]; }
+
+  /**
+   * @brief Read the next reduced maximum.
+   * @return the maximum over the ranks of the next value appended with appendMax()
+   */
+  real64 nextMax()
+  { return m_maxima[ m_maxCursor++ ]; }
+
+private:
+
+  /// The partial results summed over the ranks
+  std::vector< real64 > m_sums;
+
+  /// The partial results whose maximum is taken over the ranks
+  std::vector< real64 > m_maxima;
+
+  /// The index of the next sum to read
+  std::size_t m_sumCursor = 0;
+
+  /// The index of the next maximum to read
+  std::size_t m_maxCursor = 0;
+};
 
 class SolverBase : public ExecutableGroup
 {
@@ -115,6 +177,35 @@ public:
   array1d< real64 > & getLocalSolution() { return m_localSolution; }
   arrayView1d< real64 const > getLocalSolution() const { return m_localSolution; }
 
+  /**
+   * @brief Let a coupled solver decide when a new time step starts for the reuse of the preconditioner
+   * @param marked if true, the nonlinear steps of this solver no longer start a new time step for the reuse of
+   *   the preconditioner, the coupled solver calls markNewTimeStep instead
+   *
+   * This allows a sequentially coupled solver to keep the preconditioner of this solver through its coupling
+   * iterations, each of which is a nonlinear step of this solver.
+   */
+  void setTimeStepMarkedByCoupling( bool const marked ) { m_precondReuse.markedByCoupling = marked; }
+
+  /**
+   * @brief Check if a coupled solver decides when a new time step starts for the reuse of the preconditioner
+   * @return true if the coupled solver calls markNewTimeStep
+   */
+  bool isTimeStepMarkedByCoupling() const { return m_precondReuse.markedByCoupling; }
+
+  /**
+   * @brief Start a new time step for the reuse of the preconditioner
+   */
+  void markNewTimeStep() { m_precondReuse.newTimeStep = true; }
+
+  /**
+   * @brief Require the reused preconditioner to be recomputed before the next solve
+   *
+   * This is meant for the solvers whose matrix changes beyond what the reuse policy expects within a time step,
+   * for instance when the set of active constraints changes.
+   */
+  void markPreconditionerOutdated() { m_precondReuse.recompute = true; }
+
   /**
    * @defgroup Solver Interface Functions
    *
@@ -162,6 +253,19 @@ public:
   void SetNextDtBasedOnNewtonIter( real64 const & currentDt,
                                    real64 & nextDt );
 
+  /**
+   * @brief Set the next time step to bring the change of the primary variables to their targets.
+   * @param [in]  currentDt the time step that was achieved
+   * @param [out] nextDt the next time step
+   *
+   * The next time step is currentDt * (1/c)^kI * (c_prev/c)^kP, where c is the change of the last step
+   * normalized by its target (see SetStepChange), c_prev the one of the step before, and kI, kP the gains of
+   * the nonlinear solver parameters. It is bounded by timestepCutFactor and maxTimeStepIncreaseFactor, and
+   * falls back to SetNextDtBasedOnNewtonIter if the solver does not measure its changes.
+   */
+  void SetNextDtBasedOnStepChange( real64 const & currentDt,
+                                   real64 & nextDt );
+
 
   /**
    * @brief Entry function for an explicit time integration step
@@ -346,6 +450,25 @@ public:
                            CRSMatrixView< real64, globalIndex const > const & localMatrix,
                            arrayView1d< real64 > const & localRhs );
 
+  /**
+   * @brief Assemble the residual of the system, for the Jacobian-free products.
+   * @param time the time at the beginning of the step
+   * @param dt the desired timestep
+   * @param domain the domain partition
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param localRhs the residual, zeroed by the caller
+   *
+   * The default implementation calls AssembleSystem() and ApplyBoundaryConditions() on the local matrix, which is
+   * only a work array at that point. The solvers able to assemble their residual alone may override this to skip
+   * the derivatives.
+   */
+  virtual void
+  AssembleResidual( real64 const time,
+                    real64 const dt,
+                    DomainPartition & domain,
+                    DofManager const & dofManager,
+                    arrayView1d< real64 > const & localRhs );
+
   /**
    * @brief Output the assembled linear system for debug purposes.
    * @param time beginning-of-step time
@@ -389,6 +512,31 @@ public:
                          DofManager const & dofManager,
                          arrayView1d< real64 const > const & localRhs );
 
+  /**
+   * @brief compute the rank-local partial results of the norm of the global system residual
+   * @param domain the domain partition
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param localRhs the system right-hand side vector
+   * @param parts the partial results, to which the results of this solver are appended
+   *
+   * The default implementation of CalculateResidualNorm() reduces the partial results over the ranks
+   * and combines them with CombineResidualNorms(). The partial results are reduced in a single
+   * allreduce per operation, coupled solvers append the partial results of their subsolvers.
+   */
+  virtual void
+  CalculateLocalResidualNorms( DomainPartition const & domain,
+                               DofManager const & dofManager,
+                               arrayView1d< real64 const > const & localRhs,
+                               ResidualNormParts & parts );
+
+  /**
+   * @brief combine the reduced partial results of the norm of the global system residual
+   * @param parts the reduced partial results, read in the order of CalculateLocalResidualNorms()
+   * @return norm of the residual
+   */
+  virtual real64
+  CombineResidualNorms( ResidualNormParts & parts );
+
   /**
    * @brief function to apply a linear system solver to the assembled system.
    * @param matrix the system matrix
@@ -532,6 +680,7 @@ public:
   {
     constexpr static auto linearSolverParametersString = "LinearSolverParameters";
     constexpr static auto nonlinearSolverParametersString = "NonlinearSolverParameters";
+    constexpr static auto solverStatisticsString = "SolverStatistics";
   } groupKeys;
 
 
@@ -581,10 +730,33 @@ public:
     return m_nonlinearSolverParameters;
   }
 
+  /**
+   * @brief const accessor for the counters and timers of the time steps.
+   * @return the solver statistics
+   */
+  SolverStatistics const & getSolverStatistics() const
+  {
+    return m_solverStatistics;
+  }
+
   string getDiscretization() const { return m_discretizationName; }
 
   arrayView1d< string const > targetRegionNames() const { return m_targetRegionNames; }
 
+  /**
+   * @brief Get whether the solver uses the maps from the cell elements to their edges.
+   * @return true if the cell to edge maps must be built during the mesh setup
+   *
+   * These maps are only built if at least one solver requires them.
+   */
+  virtual bool requiresCellToEdgeMaps() const { return false; }
+
+  /**
+   * @brief Get whether the solver changes the topology of the mesh during the simulation.
+   * @return true if the relation maps must keep spare capacity for the topology changes
+   */
+  virtual bool changesMeshTopology() const { return false; }
+
   virtual std::vector< string > getConstitutiveRelations( string const & regionName ) const
   {
     GEOSX_UNUSED_VAR( regionName );
@@ -701,10 +873,25 @@ protected:
   void ValidateModelMapping( ElementRegionManager const & elemRegionManager,
                              arrayView1d< string const > const & modelNames ) const;
 
+  /**
+   * @brief Record the change of the primary variables over the step that was just accepted.
+   * @param localChange the largest change on this rank, each variable normalized by its target change
+   *
+   * The solvers measuring their changes call this in ImplicitStepComplete, for the target change time step
+   * control. This is a collective call.
+   */
+  void SetStepChange( real64 const localChange );
+
   real64 m_cflFactor;
   real64 m_maxStableDt;
   real64 m_nextDt;
 
+  /// Normalized change of the primary variables over the last accepted step, negative if not measured
+  real64 m_stepChange;
+
+  /// Normalized change of the primary variables over the step before the last one, negative if not measured
+  real64 m_previousStepChange;
+
   /// name of the FV discretization object in the data repository
   string m_discretizationName;
 
@@ -733,11 +920,125 @@ protected:
   /// Nonlinear solver parameters
   NonlinearSolverParameters m_nonlinearSolverParameters;
 
+  /// Counters and timers of the time steps
+  SolverStatistics m_solverStatistics;
+
 private:
 
+  /**
+   * @brief Solve the system with a native Krylov solver preconditioned by m_precond.
+   * @param params the linear solver parameters
+   * @param matrix the system matrix
+   * @param rhs the system right-hand side vector
+   * @param solution the solution vector
+   *
+   * A recycling solver is kept from one solve to the next, as long as it applies to the same
+   * matrix and preconditioner objects, the other solvers are created for each solve.
+   */
+  void SolveWithKrylovSolver( LinearSolverParameters const & params,
+                              ParallelMatrix & matrix,
+                              ParallelVector & rhs,
+                              ParallelVector & solution );
+
+  /**
+   * @brief Get the sign relating the solved rhs to the assembled residual in the local rhs.
+   * @param rhs the rhs passed to SolverBase::SolveSystem()
+   * @return -1 for the solvers solving with the opposite of the local rhs, 1 for the other ones
+   *
+   * This is a collective call.
+   */
+  real64 SolvedRhsSign( ParallelVector const & rhs ) const;
+
+  /**
+   * @brief Apply Newton iterations restricted to the unknowns of each rank, the other unknowns being frozen.
+   * @param time_n the time at the beginning of the step
+   * @param dt the size of the step
+   * @param domain the domain partition
+   * @param rhsSign the sign relating the solved rhs to the local rhs, see SolvedRhsSign()
+   *
+   * This is the nonlinear additive Schwarz smoother, with no overlap, applied after each global Newton update.
+   * Each rank solves its diagonal block directly, and stops once its residual is reduced by subdomainTol.
+   * The ranks keep iterating together, since the updates are synchronized. This is a collective call.
+   */
+  void SubdomainNewtonIterations( real64 const time_n,
+                                  real64 const dt,
+                                  DomainPartition & domain,
+                                  real64 const rhsSign );
+
+  /// Linear operator applying the Jacobian by finite differences of the residual
+  class JacobianFreeOperator;
+
+  /// State of the nonlinear step read by the Jacobian-free products
+  struct JacobianFree
+  {
+    /// Whether the Krylov solver applies the Jacobian-free operator
+    bool active = false;
+
+    /// Time at the beginning of the step
+    real64 time = 0.0;
+
+    /// Size of the step
+    real64 dt = 0.0;
+
+    /// Domain of the step
+    DomainPartition * domain = nullptr;
+
+    /// Sign relating the solved rhs to the assembled one, -1 for the solvers assembling the residual itself
+    real64 rhsSign = -1.0;
+
+    /// Perturbation of the primary variables
+    array1d< real64 > perturbation;
+
+    /// Residual of the perturbed primary variables
+    array1d< real64 > residual;
+  };
+
+  /// State of the preconditioner reused by the native Krylov solvers
+  struct PrecondReuse
+  {
+    /// Copy of the matrix the preconditioner was computed from
+    std::unique_ptr< ParallelMatrix > matrix;
+
+    /// Number of solves with the current preconditioner
+    integer numSolves = 0;
+
+    /// Iterations of the first solve with the current preconditioner
+    integer referenceIterations = 0;
+
+    /// Whether the preconditioner must be recomputed before the next solve
+    bool recompute = true;
+
+    /// Whether no solve has happened yet in the current time step
+    bool newTimeStep = true;
+
+    /// Whether the time steps are marked by a coupled solver instead of the nonlinear steps
+    bool markedByCoupling = false;
+  };
+
   /// List of names of regions the solver will be applied to
   array1d< string > m_targetRegionNames;
 
+  /// State of the reused preconditioner
+  PrecondReuse m_precondReuse;
+
+  /// State of the Jacobian-free products
+  JacobianFree m_jacobianFree;
+
+  /// Direct solver kept between solves to reuse its symbolic factorization
+  std::unique_ptr< LinearSolver > m_directSolver;
+
+  /// Native Krylov solver kept between solves to recycle its subspace
+  std::unique_ptr< KrylovSolver< ParallelVector > > m_krylovSolver;
+
+  /// Operator the kept Krylov solver applies
+  LinearOperator< ParallelVector > const * m_krylovSolverMatrix = nullptr;
+
+  /// Preconditioner the kept Krylov solver applies
+  PreconditionerBase< LAInterface > const * m_krylovSolverPrecond = nullptr;
+
+  /// Number of linear systems written to disk for offline replay
+  integer m_numCapturedSystems = 0;
+
 };
 
 template< typename BASETYPE, typename LOOKUP_TYPE >
@@ -0,0 +1,162 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolverStatistics.cpp
+ */
+
+#include "SolverStatistics.hpp"
+
+#include "mpiCommunications/MpiWrapper.hpp"
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+SolverStatistics::SolverStatistics( std::string const & name,
+                                    Group * const parent ):
+  Group( name, parent ),
+  m_numTimeSteps( 0 ),
+  m_numTimeStepCuts( 0 ),
+  m_numNewtonIterations( 0 ),
+  m_numLinearSolves( 0 ),
+  m_numLinearIterations( 0 ),
+  m_assemblyTime( 0.0 ),
+  m_linearSetupTime( 0.0 ),
+  m_linearSolveTime( 0.0 ),
+  m_lastStepTimeStepCuts( 0 ),
+  m_lastStepNewtonIterations( 0 ),
+  m_lastStepLinearIterations( 0 ),
+  m_lastStepAssemblyTime( 0.0 ),
+  m_lastStepLinearSetupTime( 0.0 ),
+  m_lastStepLinearSolveTime( 0.0 )
+{
+  registerWrapper( viewKeyStruct::numTimeStepsString, &m_numTimeSteps )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Number of completed time steps." );
+
+  registerWrapper( viewKeyStruct::numTimeStepCutsString, &m_numTimeStepCuts )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Total number of time step cuts." );
+
+  registerWrapper( viewKeyStruct::numNewtonIterationsString, &m_numNewtonIterations )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Total number of Newton iterations, including those of the cut time steps." );
+
+  registerWrapper( viewKeyStruct::numLinearSolvesString, &m_numLinearSolves )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Total number of linear solves." );
+
+  registerWrapper( viewKeyStruct::numLinearIterationsString, &m_numLinearIterations )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Total number of linear solver iterations." );
+
+  registerWrapper( viewKeyStruct::assemblyTimeString, &m_assemblyTime )->
+    setApplyDefaultValue( 0.0 )->
+    setDescription( "Total assembly time on this rank, in seconds." );
+
+  registerWrapper( viewKeyStruct::linearSetupTimeString, &m_linearSetupTime )->
+    setApplyDefaultValue( 0.0 )->
+    setDescription( "Total preconditioner setup and factorization time on this rank, in seconds." );
+
+  registerWrapper( viewKeyStruct::linearSolveTimeString, &m_linearSolveTime )->
+    setApplyDefaultValue( 0.0 )->
+    setDescription( "Total linear solve time on this rank, in seconds." );
+
+  registerWrapper( viewKeyStruct::lastStepTimeStepCutsString, &m_lastStepTimeStepCuts )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Number of cuts of the last time step." );
+
+  registerWrapper( viewKeyStruct::lastStepNewtonIterationsString, &m_lastStepNewtonIterations )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Number of Newton iterations of the last time step." );
+
+  registerWrapper( viewKeyStruct::lastStepLinearIterationsString, &m_lastStepLinearIterations )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Number of linear solver iterations of the last time step." );
+
+  registerWrapper( viewKeyStruct::lastStepAssemblyTimeString, &m_lastStepAssemblyTime )->
+    setApplyDefaultValue( 0.0 )->
+    setDescription( "Assembly time of the last time step on this rank, in seconds." );
+
+  registerWrapper( viewKeyStruct::lastStepLinearSetupTimeString, &m_lastStepLinearSetupTime )->
+    setApplyDefaultValue( 0.0 )->
+    setDescription( "Preconditioner setup and factorization time of the last time step on this rank, in seconds." );
+
+  registerWrapper( viewKeyStruct::lastStepLinearSolveTimeString, &m_lastStepLinearSolveTime )->
+    setApplyDefaultValue( 0.0 )->
+    setDescription( "Linear solve time of the last time step on this rank, in seconds." );
+}
+
+void SolverStatistics::beginTimeStep()
+{
+  m_lastStepTimeStepCuts = 0;
+  m_lastStepNewtonIterations = 0;
+  m_lastStepLinearIterations = 0;
+  m_lastStepAssemblyTime = 0.0;
+  m_lastStepLinearSetupTime = 0.0;
+  m_lastStepLinearSolveTime = 0.0;
+}
+
+void SolverStatistics::endTimeStep()
+{
+  ++m_numTimeSteps;
+}
+
+void SolverStatistics::addTimeStepCut()
+{
+  ++m_lastStepTimeStepCuts;
+  ++m_numTimeStepCuts;
+}
+
+void SolverStatistics::addNewtonIteration()
+{
+  ++m_lastStepNewtonIterations;
+  ++m_numNewtonIterations;
+}
+
+void SolverStatistics::addAssemblyTime( real64 const time )
+{
+  m_lastStepAssemblyTime += time;
+  m_assemblyTime += time;
+}
+
+void SolverStatistics::addLinearSolve( integer const numIterations,
+                                       real64 const setupTime,
+                                       real64 const solveTime )
+{
+  ++m_numLinearSolves;
+  m_lastStepLinearIterations += numIterations;
+  m_numLinearIterations += numIterations;
+  m_lastStepLinearSetupTime += setupTime;
+  m_linearSetupTime += setupTime;
+  m_lastStepLinearSolveTime += solveTime;
+  m_linearSolveTime += solveTime;
+}
+
+void SolverStatistics::printSummary( string const & solverName ) const
+{
+  real64 const assemblyTime = MpiWrapper::Max( m_assemblyTime );
+  real64 const linearSetupTime = MpiWrapper::Max( m_linearSetupTime );
+  real64 const linearSolveTime = MpiWrapper::Max( m_linearSolveTime );
+
+  GEOSX_LOG_RANK_0( solverName << ": " << m_numTimeSteps << " time steps, " << m_numTimeStepCuts << " time step cuts, " <<
+                    m_numNewtonIterations << " Newton iterations, " << m_numLinearSolves << " linear solves, " <<
+                    m_numLinearIterations << " linear iterations" );
+  GEOSX_LOG_RANK_0( solverName << ": assembly " << assemblyTime << " s, linear setup " << linearSetupTime <<
+                    " s, linear solve " << linearSolveTime << " s (maximum over the ranks)" );
+}
+
+} // namespace geosx
@@ -0,0 +1,166 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolverStatistics.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_SOLVERSTATISTICS_HPP_
+#define GEOSX_PHYSICSSOLVERS_SOLVERSTATISTICS_HPP_
+
+#include "dataRepository/Group.hpp"
+
+namespace geosx
+{
+
+/**
+ * @class SolverStatistics
+ * @brief Counters and timers of the time steps of a solver.
+ *
+ * The values of the last time step and the totals since the beginning of the run are wrappers, saved to the
+ * restart files and collected by a SolverStatisticsCollection, so that the performance of the solver can be
+ * plotted against the simulated time. The Newton iterations, the time step cuts, and the assembly and linear
+ * solver times of the cut attempts are counted as well. The times are measured on each rank.
+ */
+class SolverStatistics : public dataRepository::Group
+{
+public:
+
+  /**
+   * @brief Constructor
+   * @param[in] name The name of the new instantiation of this Group.
+   * @param[in] parent A pointer to the parent of this Group.
+   */
+  SolverStatistics( std::string const & name,
+                    Group * const parent );
+
+  /**
+   * @brief Default Move Constructor
+   * @param The source object of the move.
+   */
+  SolverStatistics( SolverStatistics && ) = default;
+
+  /**
+   * @brief The name of this object in the catalog.
+   * @return A string containing the name of this object in the catalog.
+   */
+  static string CatalogName() { return "SolverStatistics"; }
+
+  /**
+   * @brief Reset the values of the last time step, at the beginning of a new one.
+   */
+  void beginTimeStep();
+
+  /**
+   * @brief Count a completed time step.
+   */
+  void endTimeStep();
+
+  /**
+   * @brief Count a cut of the current time step.
+   */
+  void addTimeStepCut();
+
+  /**
+   * @brief Count a Newton iteration of the current time step.
+   */
+  void addNewtonIteration();
+
+  /**
+   * @brief Add the time of an assembly of the system.
+   * @param[in] time the time, in seconds
+   */
+  void addAssemblyTime( real64 const time );
+
+  /**
+   * @brief Count a linear solve.
+   * @param[in] numIterations the number of iterations of the linear solver
+   * @param[in] setupTime the time of the setup of the preconditioner or of the factorization, in seconds
+   * @param[in] solveTime the time of the solve, in seconds
+   */
+  void addLinearSolve( integer const numIterations,
+                       real64 const setupTime,
+                       real64 const solveTime );
+
+  /**
+   * @brief Get the number of completed time steps.
+   * @return the number of time steps
+   */
+  integer numTimeSteps() const
+  { return m_numTimeSteps; }
+
+  /**
+   * @brief Print the totals, with the maximum of the times over the ranks.
+   * @param[in] solverName the name of the solver
+   * @note This function is collective on MPI_COMM_GEOSX.
+   */
+  void printSummary( string const & solverName ) const;
+
+  /// @cond DO_NOT_DOCUMENT
+  struct viewKeyStruct
+  {
+    static constexpr auto numTimeStepsString               = "numTimeSteps";
+    static constexpr auto numTimeStepCutsString            = "numTimeStepCuts";
+    static constexpr auto numNewtonIterationsString        = "numNewtonIterations";
+    static constexpr auto numLinearSolvesString            = "numLinearSolves";
+    static constexpr auto numLinearIterationsString        = "numLinearIterations";
+    static constexpr auto assemblyTimeString               = "assemblyTime";
+    static constexpr auto linearSetupTimeString            = "linearSetupTime";
+    static constexpr auto linearSolveTimeString            = "linearSolveTime";
+
+    static constexpr auto lastStepTimeStepCutsString       = "lastStepTimeStepCuts";
+    static constexpr auto lastStepNewtonIterationsString   = "lastStepNewtonIterations";
+    static constexpr auto lastStepLinearIterationsString   = "lastStepLinearIterations";
+    static constexpr auto lastStepAssemblyTimeString       = "lastStepAssemblyTime";
+    static constexpr auto lastStepLinearSetupTimeString    = "lastStepLinearSetupTime";
+    static constexpr auto lastStepLinearSolveTimeString    = "lastStepLinearSolveTime";
+  } viewKeys;
+  /// @endcond
+
+private:
+
+  /// Number of completed time steps
+  integer m_numTimeSteps;
+  /// Total number of time step cuts
+  integer m_numTimeStepCuts;
+  /// Total number of Newton iterations
+  integer m_numNewtonIterations;
+  /// Total number of linear solves
+  integer m_numLinearSolves;
+  /// Total number of linear solver iterations
+  integer m_numLinearIterations;
+  /// Total assembly time, in seconds
+  real64 m_assemblyTime;
+  /// Total preconditioner setup and factorization time, in seconds
+  real64 m_linearSetupTime;
+  /// Total linear solve time, in seconds
+  real64 m_linearSolveTime;
+
+  /// Number of time step cuts of the last time step
+  integer m_lastStepTimeStepCuts;
+  /// Number of Newton iterations of the last time step
+  integer m_lastStepNewtonIterations;
+  /// Number of linear solver iterations of the last time step
+  integer m_lastStepLinearIterations;
+  /// Assembly time of the last time step, in seconds
+  real64 m_lastStepAssemblyTime;
+  /// Preconditioner setup and factorization time of the last time step, in seconds
+  real64 m_lastStepLinearSetupTime;
+  /// Linear solve time of the last time step, in seconds
+  real64 m_lastStepLinearSolveTime;
+};
+
+} // namespace geosx
+
+#endif /* GEOSX_PHYSICSSOLVERS_SOLVERSTATISTICS_HPP_ */
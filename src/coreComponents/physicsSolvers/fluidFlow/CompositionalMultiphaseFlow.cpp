@@ -27,13 +27,18 @@
 #include "dataRepository/Group.hpp"
 #include "finiteVolume/FiniteVolumeManager.hpp"
 #include "finiteVolume/FluxApproximationBase.hpp"
+#include "linearAlgebra/solvers/CPRPreconditioner.hpp"
+#include "linearAlgebra/solvers/TwoLevelSchwarzPreconditioner.hpp"
 #include "managers/FieldSpecification/FieldSpecificationManager.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/NumericalMethodsManager.hpp"
 #include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/DeterministicReduction.hpp"
 #include "mpiCommunications/MpiWrapper.hpp"
 #include "physicsSolvers/fluidFlow/CompositionalMultiphaseFlowKernels.hpp"
 
+#include <limits>
+
 #if defined( __INTEL_COMPILER )
 #pragma GCC optimize "O0"
 #endif
@@ -56,7 +61,17 @@ CompositionalMultiphaseFlow::CompositionalMultiphaseFlow( const string & name,
   m_capPressureFlag( 0 ),
   m_maxCompFracChange( 1.0 ),
   m_minScalingFactor( 0.01 ),
-  m_allowCompDensChopping( 1 )
+  m_allowCompDensChopping( 1 ),
+  m_useAdaptiveImplicit( 0 ),
+  m_maxExplicitCFL( 1.0 ),
+  m_lazyUpdateTolerance( 0.0 ),
+  m_targetPhaseVolFracChange( 0.2 ),
+  m_exactFluidDerivIterations( 0 ),
+  m_fluidDerivStallRatio( 0.9 ),
+  m_numSolutionUpdates( 0 ),
+  m_fluidDerivLagged( false ),
+  m_fluidDerivLagStalled( false ),
+  m_lastResidualNorm( std::numeric_limits< real64 >::max() )
 {
 //START_SPHINX_INCLUDE_00
   this->registerWrapper( viewKeyStruct::temperatureString, &m_temperature )->
@@ -90,6 +105,47 @@ CompositionalMultiphaseFlow::CompositionalMultiphaseFlow( const string & name,
     setApplyDefaultValue( 1 )->
     setDescription( "Flag indicating whether local (cell-wise) chopping of negative compositions is allowed" );
 
+  this->registerWrapper( viewKeyStruct::useAdaptiveImplicitString, &m_useAdaptiveImplicit )->
+    setSizedFromParent( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Flag indicating whether the cells with a small CFL number are treated explicitly (adaptive-implicit mode)" );
+
+  this->registerWrapper( viewKeyStruct::maxExplicitCFLString, &m_maxExplicitCFL )->
+    setSizedFromParent( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( 1.0 )->
+    setDescription( "Maximum CFL number of the cells treated explicitly in the adaptive-implicit mode" );
+
+  this->registerWrapper( viewKeyStruct::lazyUpdateToleranceString, &m_lazyUpdateTolerance )->
+    setSizedFromParent( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( 0.0 )->
+    setDescription( "Relative change of the pressure and component densities of a cell below which its properties are "
+                    "not updated between two Newton iterations. All the cells are updated if 0" );
+
+  this->registerWrapper( viewKeyStruct::targetPhaseVolFractionChangeString, &m_targetPhaseVolFracChange )->
+    setSizedFromParent( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( 0.2 )->
+    setDescription( "Target (absolute) change of a phase volume fraction over a time step, used with the "
+                    "targetPressureChange when the timeStepControl of the nonlinear solver parameters is TargetChange or Combined" );
+
+  this->registerWrapper( viewKeyStruct::exactFluidDerivativeIterationsString, &m_exactFluidDerivIterations )->
+    setSizedFromParent( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( 0 )->
+    setDescription( "Number of Newton iterations of a time step with exact fluid property derivatives. In the following "
+                    "iterations only the property values are updated, and the Jacobian uses their lagged derivatives. "
+                    "The derivatives are never lagged if 0" );
+
+  this->registerWrapper( viewKeyStruct::fluidDerivativeStallRatioString, &m_fluidDerivStallRatio )->
+    setSizedFromParent( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setApplyDefaultValue( 0.9 )->
+    setDescription( "Ratio of two successive residual norms above which the convergence is considered stalled with "
+                    "lagged fluid derivatives, which are then exact until the end of the time step" );
+
   m_linearSolverParameters.get().mgr.strategy = "CompositionalMultiphaseFlow";
 
 }
@@ -104,6 +160,12 @@ void CompositionalMultiphaseFlow::PostProcessInput()
                          "The maximum absolute change in component fraction must smaller or equal to 1.0" );
   GEOSX_ERROR_IF_LT_MSG( m_maxCompFracChange, 0.0,
                          "The maximum absolute change in component fraction must larger or equal to 0.0" );
+  GEOSX_ERROR_IF_LE_MSG( m_maxExplicitCFL, 0.0,
+                         "The maximum CFL number of the explicit cells must be larger than 0.0" );
+  GEOSX_ERROR_IF_LT_MSG( m_lazyUpdateTolerance, 0.0,
+                         "The lazy update tolerance must be larger or equal to 0.0" );
+  GEOSX_ERROR_IF_LE_MSG( m_targetPhaseVolFracChange, 0.0,
+                         "The target change of a phase volume fraction must be larger than 0.0" );
 }
 
 void CompositionalMultiphaseFlow::RegisterDataOnMesh( Group * const MeshBodies )
@@ -154,6 +216,21 @@ void CompositionalMultiphaseFlow::RegisterDataOnMesh( Group * const MeshBodies )
       elementSubRegion.registerWrapper< array2d< real64 > >( viewKeyStruct::phaseDensityOldString );
       elementSubRegion.registerWrapper< array3d< real64 > >( viewKeyStruct::phaseComponentFractionOldString );
       elementSubRegion.registerWrapper< array1d< real64 > >( viewKeyStruct::porosityOldString );
+      elementSubRegion.registerWrapper< array2d< real64 > >( viewKeyStruct::phaseMobilityOldString );
+
+      elementSubRegion.registerWrapper< array1d< real64 > >( viewKeyStruct::cflNumberString )->
+        setRestartFlags( RestartFlags::NO_WRITE )->
+        setPlotLevel( PlotLevel::LEVEL_1 );
+
+      // all the cells are implicit until the CFL numbers of a converged step are known
+      elementSubRegion.registerWrapper< array1d< integer > >( viewKeyStruct::isImplicitString )->
+        setApplyDefaultValue( 1 )->
+        setPlotLevel( PlotLevel::LEVEL_1 );
+
+      elementSubRegion.registerWrapper< array1d< real64 > >( viewKeyStruct::pressureAtLastUpdateString )->
+        setRestartFlags( RestartFlags::NO_WRITE );
+      elementSubRegion.registerWrapper< array2d< real64 > >( viewKeyStruct::globalCompDensityAtLastUpdateString )->
+        setRestartFlags( RestartFlags::NO_WRITE );
     } );
   }
 }
@@ -282,6 +359,9 @@ void CompositionalMultiphaseFlow::ResizeFields( MeshLevel & meshLevel ) const
     subRegion.getReference< array2d< real64 > >( viewKeyStruct::phaseVolumeFractionOldString ).resizeDimension< 1 >( NP );
     subRegion.getReference< array2d< real64 > >( viewKeyStruct::phaseDensityOldString ).resizeDimension< 1 >( NP );
     subRegion.getReference< array3d< real64 > >( viewKeyStruct::phaseComponentFractionOldString ).resizeDimension< 1, 2 >( NP, NC );
+    subRegion.getReference< array2d< real64 > >( viewKeyStruct::phaseMobilityOldString ).resizeDimension< 1 >( NP );
+
+    subRegion.getReference< array2d< real64 > >( viewKeyStruct::globalCompDensityAtLastUpdateString ).resizeDimension< 1 >( NC );
   } );
 }
 
@@ -439,13 +519,12 @@ void CompositionalMultiphaseFlow::UpdateFluidModel( Group & dataGroup, localInde
   {
     typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
 
-    // MultiFluid models are not thread-safe or device-capable yet
-    FluidUpdateKernel::Launch< serialPolicy >( dataGroup.size(),
-                                               fluidWrapper,
-                                               pres,
-                                               dPres,
-                                               m_temperature,
-                                               compFrac );
+    FluidUpdateKernel::Launch< typename TYPEOFREF( castedFluid ) ::UpdatePolicy >( dataGroup.size(),
+                                                                                   fluidWrapper,
+                                                                                   pres,
+                                                                                   dPres,
+                                                                                   m_temperature,
+                                                                                   compFrac );
   } );
 }
 
@@ -506,13 +585,88 @@ void CompositionalMultiphaseFlow::UpdateState( Group & dataGroup, localIndex con
 {
   GEOSX_MARK_FUNCTION;
 
-  UpdateComponentFraction( dataGroup );
-  UpdateFluidModel( dataGroup, targetIndex );
-  UpdatePhaseVolumeFraction( dataGroup, targetIndex );
+  // the solid model only depends on pressure and is updated on its own
   UpdateSolidModel( dataGroup, targetIndex );
-  UpdateRelPermModel( dataGroup, targetIndex );
-  UpdatePhaseMobility( dataGroup, targetIndex );
-  UpdateCapPressureModel( dataGroup, targetIndex );
+
+  // inputs
+
+  arrayView1d< real64 const > const pres =
+    dataGroup.getReference< array1d< real64 > >( viewKeyStruct::pressureString );
+
+  arrayView1d< real64 const > const dPres =
+    dataGroup.getReference< array1d< real64 > >( viewKeyStruct::deltaPressureString );
+
+  arrayView2d< real64 const > const compDens =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::globalCompDensityString );
+
+  arrayView2d< real64 const > const dCompDens =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::deltaGlobalCompDensityString );
+
+  MultiFluidBase & fluid = GetConstitutiveModel< MultiFluidBase >( dataGroup, m_fluidModelNames[targetIndex] );
+
+  RelativePermeabilityBase & relPerm =
+    GetConstitutiveModel< RelativePermeabilityBase >( dataGroup, m_relPermModelNames[targetIndex] );
+
+  CapillaryPressureBase * const capPressure = m_capPressureFlag
+                                            ? &GetConstitutiveModel< CapillaryPressureBase >( dataGroup, m_capPressureModelNames[targetIndex] )
+                                            : nullptr;
+
+  // outputs
+
+  arrayView2d< real64 > const compFrac =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::globalCompFractionString );
+
+  arrayView3d< real64 > const dCompFrac_dCompDens =
+    dataGroup.getReference< array3d< real64 > >( viewKeyStruct::dGlobalCompFraction_dGlobalCompDensityString );
+
+  arrayView2d< real64 > const phaseVolFrac =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::phaseVolumeFractionString );
+
+  arrayView2d< real64 > const dPhaseVolFrac_dPres =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::dPhaseVolumeFraction_dPressureString );
+
+  arrayView3d< real64 > const dPhaseVolFrac_dComp =
+    dataGroup.getReference< array3d< real64 > >( viewKeyStruct::dPhaseVolumeFraction_dGlobalCompDensityString );
+
+  arrayView2d< real64 > const phaseMob =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::phaseMobilityString );
+
+  arrayView2d< real64 > const dPhaseMob_dPres =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::dPhaseMobility_dPressureString );
+
+  arrayView3d< real64 > const dPhaseMob_dComp =
+    dataGroup.getReference< array3d< real64 > >( viewKeyStruct::dPhaseMobility_dGlobalCompDensityString );
+
+  arrayView1d< real64 > const presAtLastUpdate =
+    dataGroup.getReference< array1d< real64 > >( viewKeyStruct::pressureAtLastUpdateString );
+
+  arrayView2d< real64 > const compDensAtLastUpdate =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::globalCompDensityAtLastUpdateString );
+
+  // the component fraction, fluid, saturation, relperm, mobility and capillary pressure updates
+  // are done cell by cell in a single pass instead of one pass over the subregion each
+  KernelLaunchSelector2< PropertyUpdateKernel >( m_numComponents, m_numPhases,
+                                                 dataGroup.size(),
+                                                 m_lazyUpdateTolerance,
+                                                 m_fluidDerivLagged,
+                                                 presAtLastUpdate,
+                                                 compDensAtLastUpdate,
+                                                 pres,
+                                                 dPres,
+                                                 m_temperature,
+                                                 compDens,
+                                                 dCompDens,
+                                                 fluid,
+                                                 relPerm,
+                                                 capPressure,
+                                                 compFrac,
+                                                 dCompFrac_dCompDens,
+                                                 phaseVolFrac,
+                                                 dPhaseVolFrac_dPres,
+                                                 dPhaseVolFrac_dComp,
+                                                 phaseMob,
+                                                 dPhaseMob_dPres,
+                                                 dPhaseMob_dComp );
 }
 
 void CompositionalMultiphaseFlow::InitializeFluidState( MeshLevel & mesh ) const
@@ -568,7 +722,7 @@ void CompositionalMultiphaseFlow::InitializePostInitialConditions_PreSubGroups(
   fieldNames["elems"].emplace_back( string( viewKeyStruct::pressureString ) );
   fieldNames["elems"].emplace_back( string( viewKeyStruct::globalCompDensityString ) );
 
-  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain.getNeighbors() );
+  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain.getNeighbors(), true );
 
   // set mass fraction flag on fluid models
   forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
@@ -605,14 +759,16 @@ real64 CompositionalMultiphaseFlow::SolverStep( real64 const & time_n,
 
 void CompositionalMultiphaseFlow::BackupFields( MeshLevel & mesh ) const
 {
-  // backup some fields used in time derivative approximation
+  // backup some fields used in time derivative approximation, the subregions are independent
+  ConcurrentLaunches launches;
   forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
   {
-    arrayView1d< integer const > const elemGhostRank = subRegion.ghostRank();
     arrayView1d< real64 const > const poroRef =
       subRegion.getReference< array1d< real64 > >( viewKeyStruct::referencePorosityString );
     arrayView2d< real64 const > const phaseVolFrac =
       subRegion.getReference< array2d< real64 > >( viewKeyStruct::phaseVolumeFractionString );
+    arrayView2d< real64 const > const phaseMob =
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::phaseMobilityString );
 
     MultiFluidBase const & fluid = GetConstitutiveModel< MultiFluidBase >( subRegion, fluidModelNames()[targetIndex] );
     arrayView3d< real64 const > const phaseDens = fluid.phaseDensity();
@@ -628,21 +784,22 @@ void CompositionalMultiphaseFlow::BackupFields( MeshLevel & mesh ) const
       subRegion.getReference< array2d< real64 > >( viewKeyStruct::phaseVolumeFractionOldString );
     arrayView3d< real64 > const phaseCompFracOld =
       subRegion.getReference< array3d< real64 > >( viewKeyStruct::phaseComponentFractionOldString );
+    arrayView2d< real64 > const phaseMobOld =
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::phaseMobilityOldString );
     arrayView1d< real64 > const poroOld =
       subRegion.getReference< array1d< real64 > >( viewKeyStruct::porosityOldString );
 
     localIndex const NC = m_numComponents;
     localIndex const NP = m_numPhases;
 
-    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    // the ghost cells are backed up too, since the adaptive-implicit flux upwinds their old mobilities and compositions
+    launches.forAll( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
     {
-      if( elemGhostRank[ei] >= 0 )
-        return;
-
       for( localIndex ip = 0; ip < NP; ++ip )
       {
         phaseDensOld[ei][ip] = phaseDens[ei][0][ip];
         phaseVolFracOld[ei][ip] = phaseVolFrac[ei][ip];
+        phaseMobOld[ei][ip] = phaseMob[ei][ip];
 
         for( localIndex ic = 0; ic < NC; ++ic )
         {
@@ -665,12 +822,48 @@ CompositionalMultiphaseFlow::ImplicitStepSetup( real64 const & GEOSX_UNUSED_PARA
   ResetViews( mesh );
 
   // set deltas to zero and recompute dependent quantities
+  m_stateSnapshot.clear();
   ResetStateToBeginningOfStep( domain );
+  RecordStateOfBeginningOfStep( mesh );
 
   // backup fields used in time derivative approximation
   BackupFields( mesh );
 }
 
+void CompositionalMultiphaseFlow::RecordStateOfBeginningOfStep( MeshLevel & mesh )
+{
+  GEOSX_MARK_FUNCTION;
+
+  m_stateSnapshot.clear();
+
+  forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
+  {
+    for( char const * const fieldName : { viewKeyStruct::globalCompFractionString,
+                                          viewKeyStruct::dGlobalCompFraction_dGlobalCompDensityString,
+                                          viewKeyStruct::phaseVolumeFractionString,
+                                          viewKeyStruct::dPhaseVolumeFraction_dPressureString,
+                                          viewKeyStruct::dPhaseVolumeFraction_dGlobalCompDensityString,
+                                          viewKeyStruct::phaseMobilityString,
+                                          viewKeyStruct::dPhaseMobility_dPressureString,
+                                          viewKeyStruct::dPhaseMobility_dGlobalCompDensityString,
+                                          viewKeyStruct::pressureAtLastUpdateString,
+                                          viewKeyStruct::globalCompDensityAtLastUpdateString } )
+    {
+      m_stateSnapshot.registerWrapper( *subRegion.getWrapperBase( fieldName ) );
+    }
+
+    m_stateSnapshot.registerGroup( GetConstitutiveModel( subRegion, m_fluidModelNames[targetIndex] ) );
+    m_stateSnapshot.registerGroup( GetConstitutiveModel( subRegion, m_solidModelNames[targetIndex] ) );
+    m_stateSnapshot.registerGroup( GetConstitutiveModel( subRegion, m_relPermModelNames[targetIndex] ) );
+    if( m_capPressureFlag )
+    {
+      m_stateSnapshot.registerGroup( GetConstitutiveModel( subRegion, m_capPressureModelNames[targetIndex] ) );
+    }
+  } );
+
+  m_stateSnapshot.record();
+}
+
 void CompositionalMultiphaseFlow::SetupDofs( DomainPartition const & domain,
                                              DofManager & dofManager ) const
 {
@@ -686,6 +879,38 @@ void CompositionalMultiphaseFlow::SetupDofs( DomainPartition const & domain,
   dofManager.addCoupling( viewKeyStruct::dofFieldString, fluxApprox );
 }
 
+void CompositionalMultiphaseFlow::SetupSystem( DomainPartition & domain,
+                                               DofManager & dofManager,
+                                               CRSMatrix< real64, globalIndex > & localMatrix,
+                                               array1d< real64 > & localRhs,
+                                               array1d< real64 > & localSolution,
+                                               bool const setSparsity )
+{
+  FlowSolverBase::SetupSystem( domain, dofManager, localMatrix, localRhs, localSolution, setSparsity );
+
+  LinearSolverParameters const & params = m_linearSolverParameters.get();
+  if( !m_precond &&
+      params.solverType != LinearSolverParameters::SolverType::direct &&
+      params.preconditionerType == LinearSolverParameters::PreconditionerType::cpr )
+  {
+    // the pressure is the first unknown of the elements
+    std::vector< DofManager::SubComponent > pressureDofs{ { viewKeyStruct::dofFieldString, 0, 1 } };
+    if( params.cpr.pressurePrecond == LinearSolverParameters::CPR::PressureType::twoLevel )
+    {
+      // the coarse space of the pressure stage is made of the aggregates of the target regions
+      MeshLevel const & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+      array1d< localIndex > rowAggregates;
+      localIndex const numAggregates = MapRowsToAggregates( mesh, dofManager, viewKeyStruct::dofFieldString, rowAggregates );
+      auto pressurePrecond = std::make_unique< TwoLevelSchwarzPreconditioner< LAInterface > >( params, rowAggregates, numAggregates );
+      m_precond = std::make_unique< CPRPreconditioner< LAInterface > >( params, std::move( pressureDofs ), std::move( pressurePrecond ) );
+    }
+    else
+    {
+      m_precond = std::make_unique< CPRPreconditioner< LAInterface > >( params, std::move( pressureDofs ) );
+    }
+  }
+}
+
 void CompositionalMultiphaseFlow::AssembleSystem( real64 const GEOSX_UNUSED_PARAM( time_n ),
                                                   real64 const dt,
                                                   DomainPartition & domain,
@@ -872,6 +1097,10 @@ void CompositionalMultiphaseFlow::AssembleFluxTerms( real64 const dt,
                                          m_phaseCapPressure.toNestedViewConst(),
                                          m_dPhaseCapPressure_dPhaseVolFrac.toNestedViewConst(),
                                          m_capPressureFlag,
+                                         m_useAdaptiveImplicit,
+                                         m_isImplicit.toNestedViewConst(),
+                                         m_phaseMobOld.toNestedViewConst(),
+                                         m_phaseCompFracOld.toNestedViewConst(),
                                          dt,
                                          localMatrix.toViewConstSizes(),
                                          localRhs.toView() );
@@ -950,50 +1179,17 @@ void CompositionalMultiphaseFlow::ApplySourceFluxBC( real64 const time,
                                                      CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                                      arrayView1d< real64 > const & localRhs ) const
 {
-
   FieldSpecificationManager & fsManager = FieldSpecificationManager::get();
 
   string const dofKey = dofManager.getKey( viewKeyStruct::dofFieldString );
 
-  fsManager.Apply( time + dt,
-                   &domain,
-                   "ElementRegions",
-                   FieldSpecificationBase::viewKeyStruct::fluxBoundaryConditionString,
-                   [&]( FieldSpecificationBase const * const fs,
-                        string const &,
-                        SortedArrayView< localIndex const > const & lset,
-                        Group * const subRegion,
-                        string const & )
-  {
-
-    arrayView1d< globalIndex const > const dofNumber = subRegion->getReference< array1d< globalIndex > >( dofKey );
-    arrayView1d< integer const > const ghostRank =
-      subRegion->getReference< array1d< integer > >( ObjectManagerBase::viewKeyStruct::ghostRankString );
-
-    SortedArray< localIndex > localSet;
-    for( localIndex const a : lset )
-    {
-      if( ghostRank[a] < 0 )
-      {
-        localSet.insert( a );
-      }
-    }
-
-    fs->ApplyBoundaryConditionToSystem< FieldSpecificationAdd,
-                                        parallelDevicePolicy<> >( localSet.toViewConst(),
-                                                                  time + dt,
-                                                                  dt,
-                                                                  subRegion,
-                                                                  dofNumber,
-                                                                  dofManager.rankOffset(),
-                                                                  localMatrix,
-                                                                  localRhs,
-                                                                  [] GEOSX_HOST_DEVICE ( localIndex const )
-    {
-      return 0.0;
-    } );
-
-  } );
+  fsManager.ApplySourceFluxToSystem( time + dt,
+                                     dt,
+                                     domain,
+                                     dofKey,
+                                     dofManager.rankOffset(),
+                                     localMatrix,
+                                     localRhs );
 }
 
 
@@ -1030,10 +1226,10 @@ void CompositionalMultiphaseFlow::ApplyDirichletBC( real64 const time,
     bcStatusMap[subRegionName][setName].setValues< serialPolicy >( false );
 
     // 1.1. Apply BC to set the field values
-    fs->ApplyFieldValue< FieldSpecificationEqual, parallelHostPolicy >( targetSet,
-                                                                        time + dt,
-                                                                        subRegion,
-                                                                        viewKeyStruct::bcPressureString );
+    fs->ApplyFieldValue< FieldSpecificationEqual, parallelDevicePolicy<> >( targetSet,
+                                                                            time + dt,
+                                                                            subRegion,
+                                                                            viewKeyStruct::bcPressureString );
   } );
 
   // 2. Apply composition BC (global component fraction) and store them for constitutive call
@@ -1057,10 +1253,10 @@ void CompositionalMultiphaseFlow::ApplyDirichletBC( real64 const time,
     bcStatusMap[subRegionName][setName][comp] = true;
 
     // 2.1. Apply BC to set the field values
-    fs->ApplyFieldValue< FieldSpecificationEqual, parallelHostPolicy >( targetSet,
-                                                                        time + dt,
-                                                                        subRegion,
-                                                                        viewKeyStruct::globalCompFractionString );
+    fs->ApplyFieldValue< FieldSpecificationEqual, parallelDevicePolicy<> >( targetSet,
+                                                                            time + dt,
+                                                                            subRegion,
+                                                                            viewKeyStruct::globalCompFractionString );
   } );
 
   // 2.3 Check consistency between composition BC applied to sets
@@ -1114,12 +1310,11 @@ void CompositionalMultiphaseFlow::ApplyDirichletBC( real64 const time,
     {
       typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
 
-      // MultiFluid models are not thread-safe or device-capable yet
-      FluidUpdateKernel::Launch< serialPolicy >( targetSet,
-                                                 fluidWrapper,
-                                                 bcPres,
-                                                 m_temperature,
-                                                 compFrac );
+      FluidUpdateKernel::Launch< typename TYPEOFREF( castedFluid ) ::UpdatePolicy >( targetSet,
+                                                                                     fluidWrapper,
+                                                                                     bcPres,
+                                                                                     m_temperature,
+                                                                                     compFrac );
     } );
 
     forAll< parallelDevicePolicy<> >( targetSet.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
@@ -1157,9 +1352,10 @@ void CompositionalMultiphaseFlow::ApplyDirichletBC( real64 const time,
 
 }
 
-real64 CompositionalMultiphaseFlow::CalculateResidualNorm( DomainPartition const & domain,
-                                                           DofManager const & dofManager,
-                                                           arrayView1d< real64 const > const & localRhs )
+void CompositionalMultiphaseFlow::CalculateLocalResidualNorms( DomainPartition const & domain,
+                                                               DofManager const & dofManager,
+                                                               arrayView1d< real64 const > const & localRhs,
+                                                               ResidualNormParts & parts )
 {
   localIndex const NDOF = m_numComponents + 1;
 
@@ -1179,6 +1375,29 @@ real64 CompositionalMultiphaseFlow::CalculateResidualNorm( DomainPartition const
     arrayView1d< real64 const > const & refPoro = subRegion.getReference< array1d< real64 > >( viewKeyStruct::referencePorosityString );
     arrayView2d< real64 const > const & totalDens = fluid.totalDensity();
 
+    if( DeterministicReduction::isEnabled() )
+    {
+      // fixed-order sum of the subregion, the dofs of an element being added in order
+      localResidualNorm += DeterministicReduction::localSum< parallelDevicePolicy<> >( subRegion.size(),
+                                                                                       [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+      {
+        real64 elemSum = 0.0;
+        if( elemGhostRank[ei] < 0 )
+        {
+          localIndex const localRow = dofNumber[ei] - rankOffset;
+          real64 const normalizer = totalDens[ei][0] * refPoro[ei] * volume[ei];
+
+          for( localIndex idof = 0; idof < NDOF; ++idof )
+          {
+            real64 const val = localRhs[localRow + idof] / normalizer;
+            elemSum += val * val;
+          }
+        }
+        return elemSum;
+      } );
+      return;
+    }
+
     RAJA::ReduceSum< parallelDeviceReduce, real64 > localSum( 0.0 );
 
     forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
@@ -1199,8 +1418,13 @@ real64 CompositionalMultiphaseFlow::CalculateResidualNorm( DomainPartition const
     localResidualNorm += localSum.get();
   } );
 
+  parts.appendSum( localResidualNorm );
+}
+
+real64 CompositionalMultiphaseFlow::CombineResidualNorms( ResidualNormParts & parts )
+{
   // compute global residual norm
-  real64 const residual = std::sqrt( MpiWrapper::Sum( localResidualNorm ) );
+  real64 const residual = std::sqrt( parts.nextSum() );
 
   if( getLogLevel() >= 1 && logger::internal::rank==0 )
   {
@@ -1209,6 +1433,14 @@ real64 CompositionalMultiphaseFlow::CalculateResidualNorm( DomainPartition const
     std::cout<<output;
   }
 
+  // the residual is exact with lagged fluid derivatives, only the Newton direction is approximate
+  if( m_fluidDerivLagged && !m_fluidDerivLagStalled && residual > m_fluidDerivStallRatio * m_lastResidualNorm )
+  {
+    m_fluidDerivLagStalled = true;
+    GEOSX_LOG_LEVEL_RANK_0( 1, "        Convergence stalled with lagged fluid derivatives, evaluating them again" );
+  }
+  m_lastResidualNorm = residual;
+
   return residual;
 }
 
@@ -1395,14 +1627,23 @@ void CompositionalMultiphaseFlow::ApplySystemSolution( DofManager const & dofMan
     ChopNegativeDensities( domain );
   }
 
+  // the state is assembled in the next Newton iteration, whose fluid derivatives may be lagged
+  // the updates are counted here, since the Newton iterations of a coupled solver are not counted by this solver
+  ++m_numSolutionUpdates;
+  m_fluidDerivLagged = m_exactFluidDerivIterations > 0 &&
+                       !m_fluidDerivLagStalled &&
+                       m_numSolutionUpdates >= m_exactFluidDerivIterations;
+
   std::map< string, string_array > fieldNames;
   fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaPressureString ) );
   fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaGlobalCompDensityString ) );
-  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain.getNeighbors(), true );
-
-  forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
+  // the state update needs the ghost values, it is delayed with the synchronization when it is deferred
+  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain.getNeighbors(), true, [this, &mesh]()
   {
-    UpdateState( subRegion, targetIndex );
+    forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
+    {
+      UpdateState( subRegion, targetIndex );
+    } );
   } );
 }
 
@@ -1411,6 +1652,7 @@ void CompositionalMultiphaseFlow::ChopNegativeDensities( DomainPartition & domai
   MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
 
   localIndex const NC = m_numComponents;
+  ConcurrentLaunches launches;
   forTargetSubRegions( mesh, [&]( localIndex const, ElementSubRegionBase & subRegion )
   {
     arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
@@ -1420,7 +1662,7 @@ void CompositionalMultiphaseFlow::ChopNegativeDensities( DomainPartition & domai
     arrayView2d< real64 > const dCompDens =
       subRegion.getReference< array2d< real64 > >( viewKeyStruct::deltaGlobalCompDensityString );
 
-    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    launches.forAll( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
     {
       if( ghostRank[ei] < 0 )
       {
@@ -1441,6 +1683,12 @@ void CompositionalMultiphaseFlow::ResetStateToBeginningOfStep( DomainPartition &
 {
   MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
 
+  // the first iterations of the step, or of its new attempt, have exact fluid derivatives
+  m_numSolutionUpdates = 0;
+  m_fluidDerivLagged = false;
+  m_fluidDerivLagStalled = false;
+  m_lastResidualNorm = std::numeric_limits< real64 >::max();
+
   forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
   {
     arrayView1d< real64 > const & dPres =
@@ -1451,30 +1699,58 @@ void CompositionalMultiphaseFlow::ResetStateToBeginningOfStep( DomainPartition &
     dPres.setValues< parallelDevicePolicy<> >( 0.0 );
     dCompDens.setValues< parallelDevicePolicy<> >( 0.0 );
 
+    // the dependent quantities of the beginning of the step are copied back below, instead of recomputed
+    if( m_stateSnapshot.isRecorded() )
+    {
+      return;
+    }
+
+    // forget the state of the last update, so that all the cells are updated at the beginning of the step
+    arrayView1d< real64 > const & presAtLastUpdate =
+      subRegion.getReference< array1d< real64 > >( viewKeyStruct::pressureAtLastUpdateString );
+    presAtLastUpdate.setValues< parallelDevicePolicy<> >( std::numeric_limits< real64 >::quiet_NaN() );
+
     UpdateState( subRegion, targetIndex );
   } );
+
+  if( m_stateSnapshot.isRecorded() )
+  {
+    m_stateSnapshot.restore();
+  }
 }
 
 void CompositionalMultiphaseFlow::ImplicitStepComplete( real64 const & GEOSX_UNUSED_PARAM( time ),
-                                                        real64 const & GEOSX_UNUSED_PARAM( dt ),
+                                                        real64 const & dt,
                                                         DomainPartition & domain )
 {
   localIndex const NC = m_numComponents;
+  localIndex const NP = m_numPhases;
 
   MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
 
+  real64 localMaxDeltaPres = 0.0;
+  real64 localMaxDeltaPhaseVolFrac = 0.0;
+
   forTargetSubRegions( mesh, [&]( localIndex const, ElementSubRegionBase & subRegion )
   {
+    arrayView1d< integer const > const elemGhostRank = subRegion.ghostRank();
     arrayView1d< real64 const > const dPres =
       subRegion.getReference< array1d< real64 > >( viewKeyStruct::deltaPressureString );
     arrayView2d< real64 const > const dCompDens =
       subRegion.getReference< array2d< real64 > >( viewKeyStruct::deltaGlobalCompDensityString );
+    arrayView2d< real64 const > const phaseVolFrac =
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::phaseVolumeFractionString );
+    arrayView2d< real64 const > const phaseVolFracOld =
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::phaseVolumeFractionOldString );
 
     arrayView1d< real64 > const pres =
       subRegion.getReference< array1d< real64 > >( viewKeyStruct::pressureString );
     arrayView2d< real64 > const compDens =
       subRegion.getReference< array2d< real64 > >( viewKeyStruct::globalCompDensityString );
 
+    RAJA::ReduceMax< parallelDeviceReduce, real64 > maxDeltaPres( 0.0 );
+    RAJA::ReduceMax< parallelDeviceReduce, real64 > maxDeltaPhaseVolFrac( 0.0 );
+
     forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
     {
       pres[ei] += dPres[ei];
@@ -1482,8 +1758,115 @@ void CompositionalMultiphaseFlow::ImplicitStepComplete( real64 const & GEOSX_UNU
       {
         compDens[ei][ic] += dCompDens[ei][ic];
       }
+
+      if( elemGhostRank[ei] < 0 )
+      {
+        maxDeltaPres.max( LvArray::math::abs( dPres[ei] ) );
+        for( localIndex ip = 0; ip < NP; ++ip )
+        {
+          maxDeltaPhaseVolFrac.max( LvArray::math::abs( phaseVolFrac[ei][ip] - phaseVolFracOld[ei][ip] ) );
+        }
+      }
     } );
+
+    localMaxDeltaPres = std::max( localMaxDeltaPres, maxDeltaPres.get() );
+    localMaxDeltaPhaseVolFrac = std::max( localMaxDeltaPhaseVolFrac, maxDeltaPhaseVolFrac.get() );
   } );
+
+  SetStepChange( std::max( localMaxDeltaPres / m_targetPressureChange,
+                           localMaxDeltaPhaseVolFrac / m_targetPhaseVolFracChange ) );
+
+  // choose the implicit cells of the next time step from the converged fluxes of this one
+  if( m_useAdaptiveImplicit )
+  {
+    UpdateImplicitCells( dt, domain );
+  }
+}
+
+void CompositionalMultiphaseFlow::UpdateImplicitCells( real64 const dt, DomainPartition & domain ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  ElementRegionManager const & elemManager = *mesh.getElemManager();
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
+
+  forTargetSubRegions( mesh, [&]( localIndex const, ElementSubRegionBase & subRegion )
+  {
+    arrayView1d< real64 > const & cflNumber =
+      subRegion.getReference< array1d< real64 > >( viewKeyStruct::cflNumberString );
+    cflNumber.setValues< parallelDevicePolicy<> >( 0.0 );
+  } );
+
+  // the pressure has been incremented in ImplicitStepComplete, so that it matches the converged mobilities
+  ElementRegionManager::ElementViewAccessor< arrayView1d< real64 > > throughput =
+    elemManager.ConstructArrayViewAccessor< real64, 1 >( viewKeyStruct::cflNumberString );
+  throughput.setName( getName() + "/accessors/" + viewKeyStruct::cflNumberString );
+
+  fluxApprox.forAllStencils( mesh, [&] ( auto const & stencil )
+  {
+    CFLNumberKernel::Launch( m_numPhases,
+                             stencil,
+                             m_pressure.toNestedViewConst(),
+                             m_gravCoef.toNestedViewConst(),
+                             m_phaseMob.toNestedViewConst(),
+                             m_phaseDens.toNestedViewConst(),
+                             m_phaseCapPressure.toNestedViewConst(),
+                             m_capPressureFlag,
+                             throughput.toNestedView() );
+  } );
+
+  real64 const maxExplicitCFL = m_maxExplicitCFL;
+  localIndex numImplicit = 0;
+  localIndex numCells = 0;
+
+  forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
+  {
+    arrayView1d< integer const > const elemGhostRank = subRegion.ghostRank();
+    arrayView1d< real64 const > const volume = subRegion.getElementVolume();
+    arrayView1d< real64 const > const poroRef =
+      subRegion.getReference< array1d< real64 > >( viewKeyStruct::referencePorosityString );
+
+    ConstitutiveBase const & solid = GetConstitutiveModel( subRegion, solidModelNames()[targetIndex] );
+    arrayView2d< real64 const > const pvMult =
+      solid.getReference< array2d< real64 > >( ConstitutiveBase::viewKeyStruct::poreVolumeMultiplierString );
+
+    arrayView1d< real64 > const cflNumber =
+      subRegion.getReference< array1d< real64 > >( viewKeyStruct::cflNumberString );
+    arrayView1d< integer > const isImplicit =
+      subRegion.getReference< array1d< integer > >( viewKeyStruct::isImplicitString );
+
+    RAJA::ReduceSum< parallelDeviceReduce, localIndex > subRegionNumImplicit( 0 );
+    RAJA::ReduceSum< parallelDeviceReduce, localIndex > subRegionNumCells( 0 );
+
+    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      if( elemGhostRank[ei] >= 0 )
+        return;
+
+      real64 const poreVol = volume[ei] * poroRef[ei] * pvMult[ei][0];
+      cflNumber[ei] = ( poreVol > 0.0 ) ? dt * cflNumber[ei] / poreVol : 0.0;
+      isImplicit[ei] = ( cflNumber[ei] > maxExplicitCFL ) ? 1 : 0;
+
+      subRegionNumImplicit += isImplicit[ei];
+      subRegionNumCells += 1;
+    } );
+
+    numImplicit += subRegionNumImplicit.get();
+    numCells += subRegionNumCells.get();
+  } );
+
+  // the flux kernel needs the implicitness of the ghost cells
+  std::map< string, string_array > fieldNames;
+  fieldNames["elems"].emplace_back( string( viewKeyStruct::cflNumberString ) );
+  fieldNames["elems"].emplace_back( string( viewKeyStruct::isImplicitString ) );
+  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain.getNeighbors(), true );
+
+  GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": " << MpiWrapper::Sum( numImplicit ) << " implicit cells out of "
+                                       << MpiWrapper::Sum( numCells ) << " for the next time step" );
 }
 
 void CompositionalMultiphaseFlow::ResetViews( MeshLevel & mesh )
@@ -1523,6 +1906,18 @@ void CompositionalMultiphaseFlow::ResetViews( MeshLevel & mesh )
   m_dPhaseMob_dCompDens = elemManager.ConstructArrayViewAccessor< real64, 3 >( viewKeyStruct::dPhaseMobility_dGlobalCompDensityString );
   m_dPhaseMob_dCompDens.setName( getName() + "/accessors/" + viewKeyStruct::dPhaseMobility_dGlobalCompDensityString );
 
+  m_isImplicit.clear();
+  m_isImplicit = elemManager.ConstructArrayViewAccessor< integer, 1 >( viewKeyStruct::isImplicitString );
+  m_isImplicit.setName( getName() + "/accessors/" + viewKeyStruct::isImplicitString );
+
+  m_phaseMobOld.clear();
+  m_phaseMobOld = elemManager.ConstructArrayViewAccessor< real64, 2 >( viewKeyStruct::phaseMobilityOldString );
+  m_phaseMobOld.setName( getName() + "/accessors/" + viewKeyStruct::phaseMobilityOldString );
+
+  m_phaseCompFracOld.clear();
+  m_phaseCompFracOld = elemManager.ConstructArrayViewAccessor< real64, 3 >( viewKeyStruct::phaseComponentFractionOldString );
+  m_phaseCompFracOld.setName( getName() + "/accessors/" + viewKeyStruct::phaseComponentFractionOldString );
+
   {
     using keys = MultiFluidBase::viewKeyStruct;
 
@@ -19,6 +19,7 @@
 #ifndef GEOSX_PHYSICSSOLVERS_FINITEVOLUME_COMPOSITIONALMULTIPHASEFLOW_HPP_
 #define GEOSX_PHYSICSSOLVERS_FINITEVOLUME_COMPOSITIONALMULTIPHASEFLOW_HPP_
 
+#include "dataRepository/WrapperSnapshot.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBase.hpp"
 
 namespace geosx
@@ -113,6 +114,14 @@ public:
   SetupDofs( DomainPartition const & domain,
              DofManager & dofManager ) const override;
 
+  virtual void
+  SetupSystem( DomainPartition & domain,
+               DofManager & dofManager,
+               CRSMatrix< real64, globalIndex > & localMatrix,
+               array1d< real64 > & localRhs,
+               array1d< real64 > & localSolution,
+               bool const setSparsity = true ) override;
+
   virtual void
   AssembleSystem( real64 const time_n,
                   real64 const dt,
@@ -129,10 +138,14 @@ public:
                            CRSMatrixView< real64, globalIndex const > const & localMatrix,
                            arrayView1d< real64 > const & localRhs ) override;
 
+  virtual void
+  CalculateLocalResidualNorms( DomainPartition const & domain,
+                               DofManager const & dofManager,
+                               arrayView1d< real64 const > const & localRhs,
+                               ResidualNormParts & parts ) override;
+
   virtual real64
-  CalculateResidualNorm( DomainPartition const & domain,
-                         DofManager const & dofManager,
-                         arrayView1d< real64 const > const & localRhs ) override;
+  CombineResidualNorms( ResidualNormParts & parts ) override;
 
   virtual void
   SolveSystem( DofManager const & dofManager,
@@ -210,6 +223,14 @@ public:
   /**
    * @brief Recompute all dependent quantities from primary variables (including constitutive models)
    * @param domain the domain containing the mesh and fields
+   *
+   * The fluid, relperm and capillary pressure models are updated along with the saturations and mobilities
+   * in a single pass over the cells, which gives the same results as the individual updates above.
+   * If lazyUpdateTolerance is positive, the cells whose pressure and component densities changed by less
+   * than this tolerance since their last update keep their properties. All the cells are updated at the
+   * beginning of each time step.
+   * After exactFluidDerivativeIterations Newton iterations of a time step, only the values of the fluid
+   * properties are updated and their derivatives are lagged, see ApplySystemSolution().
    */
   void UpdateState( Group & dataGroup, localIndex const targetIndex ) const;
 
@@ -287,6 +308,12 @@ public:
 
     static constexpr auto maxCompFracChangeString = "maxCompFractionChange";
     static constexpr auto allowLocalCompDensChoppingString = "allowLocalCompDensityChopping";
+    static constexpr auto useAdaptiveImplicitString = "useAdaptiveImplicit";
+    static constexpr auto maxExplicitCFLString = "maxExplicitCFL";
+    static constexpr auto lazyUpdateToleranceString = "lazyUpdateTolerance";
+    static constexpr auto targetPhaseVolFractionChangeString = "targetPhaseVolFractionChange";
+    static constexpr auto exactFluidDerivativeIterationsString = "exactFluidDerivativeIterations";
+    static constexpr auto fluidDerivativeStallRatioString = "fluidDerivativeStallRatio";
 
     static constexpr auto facePressureString  = "facePressure";
     static constexpr auto bcPressureString    = "bcPressure";
@@ -313,6 +340,15 @@ public:
     static constexpr auto phaseDensityOldString            = "phaseDensityOld";
     static constexpr auto phaseComponentFractionOldString  = "phaseComponentFractionOld";
     static constexpr auto porosityOldString                = "porosityOld";
+    static constexpr auto phaseMobilityOldString           = "phaseMobilityOld";
+
+    // these are used to choose the implicit cells in the adaptive-implicit mode
+    static constexpr auto cflNumberString  = "CFLNumber";
+    static constexpr auto isImplicitString = "isImplicit";
+
+    // these are used to skip the property updates of the cells whose state did not change
+    static constexpr auto pressureAtLastUpdateString          = "pressureAtLastUpdate";
+    static constexpr auto globalCompDensityAtLastUpdateString = "globalCompDensityAtLastUpdate";
 
     // these are allocated on faces for BC application until we can get constitutive models on faces
     static constexpr auto phaseViscosityString             = "phaseViscosity";
@@ -340,6 +376,24 @@ public:
    */
   void BackupFields( MeshLevel & mesh ) const;
 
+  /**
+   * @brief Record the dependent quantities of the beginning of the step, restored if the step is cut
+   * @param mesh the mesh containing the fields
+   *
+   * The snapshot covers the outputs of UpdateState: the secondary fields of the solver and the constitutive models.
+   */
+  void RecordStateOfBeginningOfStep( MeshLevel & mesh );
+
+  /**
+   * @brief Compute the cell CFL numbers and choose the cells treated implicitly in the next time step
+   * @param dt the time step size used to compute the CFL numbers
+   * @param domain the domain containing the mesh and fields
+   *
+   * In the adaptive-implicit mode, the cells whose CFL number is below maxExplicitCFL are explicit:
+   * the mobilities and phase compositions upwinded from them are taken at the beginning of the time step.
+   */
+  void UpdateImplicitCells( real64 const dt, DomainPartition & domain ) const;
+
   /**
    * @brief Function to perform the Application of Dirichlet type BC's
    * @param time current time
@@ -438,6 +492,39 @@ private:
   /// flag indicating whether local (cell-wise) chopping of negative compositions is allowed
   integer m_allowCompDensChopping;
 
+  /// flag indicating whether the implicitness of each cell is chosen from its CFL number at each time step
+  integer m_useAdaptiveImplicit;
+
+  /// maximum CFL number of the cells treated explicitly in the adaptive-implicit mode
+  real64 m_maxExplicitCFL;
+
+  /// relative change of the state of a cell below which its properties are not updated (0 to update all the cells)
+  real64 m_lazyUpdateTolerance;
+
+  /// target (absolute) change of a phase volume fraction over a time step, for the target change time step control
+  real64 m_targetPhaseVolFracChange;
+
+  /// number of Newton iterations of a time step with exact fluid derivatives, before they are lagged (0 to never lag)
+  integer m_exactFluidDerivIterations;
+
+  /// ratio of two successive residual norms above which the lagged fluid derivatives are evaluated again
+  real64 m_fluidDerivStallRatio;
+
+  /// number of solution updates since the beginning of the time step
+  integer m_numSolutionUpdates;
+
+  /// flag indicating whether the fluid derivatives of the current state are lagged
+  bool m_fluidDerivLagged;
+
+  /// flag indicating whether the convergence stalled with lagged fluid derivatives during the time step
+  bool m_fluidDerivLagStalled;
+
+  /// residual norm of the previous Newton iteration, to detect the stall of the convergence
+  real64 m_lastResidualNorm;
+
+  /// copy of the dependent quantities of the beginning of the step
+  dataRepository::WrapperSnapshot m_stateSnapshot;
+
 
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > m_pressure;
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > m_deltaPressure;
@@ -451,6 +538,10 @@ private:
   ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > m_dPhaseMob_dPres;
   ElementRegionManager::ElementViewAccessor< arrayView3d< real64 const > > m_dPhaseMob_dCompDens;
 
+  ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > m_isImplicit;
+  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > m_phaseMobOld;
+  ElementRegionManager::ElementViewAccessor< arrayView3d< real64 const > > m_phaseCompFracOld;
+
   ElementRegionManager::ElementViewAccessor< arrayView3d< real64 const > > m_phaseDens;
   ElementRegionManager::ElementViewAccessor< arrayView3d< real64 const > > m_dPhaseDens_dPres;
   ElementRegionManager::ElementViewAccessor< arrayView4d< real64 const > > m_dPhaseDens_dComp;
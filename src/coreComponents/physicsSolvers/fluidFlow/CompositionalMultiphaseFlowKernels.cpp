@@ -18,6 +18,9 @@
 
 #include "CompositionalMultiphaseFlowKernels.hpp"
 
+#include "constitutive/capillaryPressure/capillaryPressureSelector.hpp"
+#include "constitutive/fluid/multiFluidSelector.hpp"
+#include "constitutive/relativePermeability/relativePermeabilitySelector.hpp"
 #include "finiteVolume/CellElementStencilTPFA.hpp"
 #include "finiteVolume/FaceElementStencil.hpp"
 
@@ -505,6 +508,284 @@ INST_PhaseMobilityKernel( 5, 3 );
 
 #undef INST_PhaseMobilityKernel
 
+/******************************** PropertyUpdateKernel ********************************/
+
+namespace
+{
+
+/// Stands for the capillary pressure wrapper when the solver has no capillary pressure model
+struct NoCapillaryPressureUpdate
+{
+  GEOSX_HOST_DEVICE
+  localIndex numGauss() const { return 0; }
+
+  GEOSX_HOST_DEVICE
+  void Update( localIndex const,
+               localIndex const,
+               arraySlice1d< real64 const > const & ) const
+  {}
+};
+
+/**
+ * @brief Launch the fused property update of a subregion with the kernel wrappers of its models.
+ * @note The launch is a named function rather than a generic lambda so that its kernel can be a device lambda.
+ */
+template< localIndex NC, localIndex NP, typename POLICY,
+          typename FLUID_WRAPPER, typename RELPERM_WRAPPER, typename CAPPRES_WRAPPER >
+void launchPropertyUpdate( localIndex const size,
+                           FLUID_WRAPPER const & fluidWrapper,
+                           RELPERM_WRAPPER const & relPermWrapper,
+                           CAPPRES_WRAPPER const & capPresWrapper,
+                           real64 const lazyUpdateTolerance,
+                           bool const lagFluidDerivatives,
+                           arrayView1d< real64 > const & presAtLastUpdate,
+                           arrayView2d< real64 > const & compDensAtLastUpdate,
+                           arrayView1d< real64 const > const & pres,
+                           arrayView1d< real64 const > const & dPres,
+                           real64 const temp,
+                           arrayView2d< real64 const > const & compDens,
+                           arrayView2d< real64 const > const & dCompDens,
+                           arrayView3d< real64 const > const & phaseFrac,
+                           arrayView3d< real64 const > const & dPhaseFrac_dPres,
+                           arrayView4d< real64 const > const & dPhaseFrac_dComp,
+                           arrayView3d< real64 const > const & phaseDens,
+                           arrayView3d< real64 const > const & dPhaseDens_dPres,
+                           arrayView4d< real64 const > const & dPhaseDens_dComp,
+                           arrayView3d< real64 const > const & phaseVisc,
+                           arrayView3d< real64 const > const & dPhaseVisc_dPres,
+                           arrayView4d< real64 const > const & dPhaseVisc_dComp,
+                           arrayView3d< real64 const > const & phaseRelPerm,
+                           arrayView4d< real64 const > const & dPhaseRelPerm_dPhaseVolFrac,
+                           arrayView2d< real64 > const & compFrac,
+                           arrayView3d< real64 > const & dCompFrac_dCompDens,
+                           arrayView2d< real64 > const & phaseVolFrac,
+                           arrayView2d< real64 > const & dPhaseVolFrac_dPres,
+                           arrayView3d< real64 > const & dPhaseVolFrac_dComp,
+                           arrayView2d< real64 > const & phaseMob,
+                           arrayView2d< real64 > const & dPhaseMob_dPres,
+                           arrayView3d< real64 > const & dPhaseMob_dComp )
+{
+  forAll< POLICY >( size, [=] GEOSX_HOST_DEVICE ( localIndex const a )
+  {
+    if( lazyUpdateTolerance > 0.0 &&
+        !PropertyUpdateKernel::UpdateLastState< NC >( lazyUpdateTolerance,
+                                                      pres[a],
+                                                      dPres[a],
+                                                      compDens[a],
+                                                      dCompDens[a],
+                                                      presAtLastUpdate[a],
+                                                      compDensAtLastUpdate[a] ) )
+    {
+      return;
+    }
+
+    ComponentFractionKernel::Compute< NC >( compDens[a],
+                                            dCompDens[a],
+                                            compFrac[a],
+                                            dCompFrac_dCompDens[a] );
+
+    for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+    {
+      if( lagFluidDerivatives )
+      {
+        fluidWrapper.UpdateValues( a, q, pres[a] + dPres[a], temp, compFrac[a] );
+      }
+      else
+      {
+        fluidWrapper.Update( a, q, pres[a] + dPres[a], temp, compFrac[a] );
+      }
+    }
+
+    // with lagged fluid derivatives, the derivatives below are approximate while the values are exact
+    PhaseVolumeFractionKernel::Compute< NC, NP >( compDens[a],
+                                                  dCompDens[a],
+                                                  dCompFrac_dCompDens[a],
+                                                  phaseDens[a][0],
+                                                  dPhaseDens_dPres[a][0],
+                                                  dPhaseDens_dComp[a][0],
+                                                  phaseFrac[a][0],
+                                                  dPhaseFrac_dPres[a][0],
+                                                  dPhaseFrac_dComp[a][0],
+                                                  phaseVolFrac[a],
+                                                  dPhaseVolFrac_dPres[a],
+                                                  dPhaseVolFrac_dComp[a] );
+
+    for( localIndex q = 0; q < relPermWrapper.numGauss(); ++q )
+    {
+      relPermWrapper.Update( a, q, phaseVolFrac[a] );
+    }
+
+    PhaseMobilityKernel::Compute< NC, NP >( dCompFrac_dCompDens[a],
+                                            phaseDens[a][0],
+                                            dPhaseDens_dPres[a][0],
+                                            dPhaseDens_dComp[a][0],
+                                            phaseVisc[a][0],
+                                            dPhaseVisc_dPres[a][0],
+                                            dPhaseVisc_dComp[a][0],
+                                            phaseRelPerm[a][0],
+                                            dPhaseRelPerm_dPhaseVolFrac[a][0],
+                                            dPhaseVolFrac_dPres[a],
+                                            dPhaseVolFrac_dComp[a],
+                                            phaseMob[a],
+                                            dPhaseMob_dPres[a],
+                                            dPhaseMob_dComp[a] );
+
+    for( localIndex q = 0; q < capPresWrapper.numGauss(); ++q )
+    {
+      capPresWrapper.Update( a, q, phaseVolFrac[a] );
+    }
+  } );
+}
+
+}
+
+template< localIndex NC, localIndex NP >
+void
+PropertyUpdateKernel::
+  Launch( localIndex const size,
+          real64 const lazyUpdateTolerance,
+          bool const lagFluidDerivatives,
+          arrayView1d< real64 > const & presAtLastUpdate,
+          arrayView2d< real64 > const & compDensAtLastUpdate,
+          arrayView1d< real64 const > const & pres,
+          arrayView1d< real64 const > const & dPres,
+          real64 const temp,
+          arrayView2d< real64 const > const & compDens,
+          arrayView2d< real64 const > const & dCompDens,
+          constitutive::MultiFluidBase & fluid,
+          constitutive::RelativePermeabilityBase & relPerm,
+          constitutive::CapillaryPressureBase * const capPressure,
+          arrayView2d< real64 > const & compFrac,
+          arrayView3d< real64 > const & dCompFrac_dCompDens,
+          arrayView2d< real64 > const & phaseVolFrac,
+          arrayView2d< real64 > const & dPhaseVolFrac_dPres,
+          arrayView3d< real64 > const & dPhaseVolFrac_dComp,
+          arrayView2d< real64 > const & phaseMob,
+          arrayView2d< real64 > const & dPhaseMob_dPres,
+          arrayView3d< real64 > const & dPhaseMob_dComp )
+{
+  arrayView3d< real64 const > const & phaseFrac = fluid.phaseFraction();
+  arrayView3d< real64 const > const & dPhaseFrac_dPres = fluid.dPhaseFraction_dPressure();
+  arrayView4d< real64 const > const & dPhaseFrac_dComp = fluid.dPhaseFraction_dGlobalCompFraction();
+
+  arrayView3d< real64 const > const & phaseDens = fluid.phaseDensity();
+  arrayView3d< real64 const > const & dPhaseDens_dPres = fluid.dPhaseDensity_dPressure();
+  arrayView4d< real64 const > const & dPhaseDens_dComp = fluid.dPhaseDensity_dGlobalCompFraction();
+
+  arrayView3d< real64 const > const & phaseVisc = fluid.phaseViscosity();
+  arrayView3d< real64 const > const & dPhaseVisc_dPres = fluid.dPhaseViscosity_dPressure();
+  arrayView4d< real64 const > const & dPhaseVisc_dComp = fluid.dPhaseViscosity_dGlobalCompFraction();
+
+  arrayView3d< real64 const > const & phaseRelPerm = relPerm.phaseRelPerm();
+  arrayView4d< real64 const > const & dPhaseRelPerm_dPhaseVolFrac = relPerm.dPhaseRelPerm_dPhaseVolFraction();
+
+  auto launch = [&] ( auto const & capPresWrapper )
+  {
+    constitutive::constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
+    {
+      typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+
+      constitutive::constitutiveUpdatePassThru( relPerm, [&] ( auto & castedRelPerm )
+      {
+        typename TYPEOFREF( castedRelPerm ) ::KernelWrapper relPermWrapper = castedRelPerm.createKernelWrapper();
+
+        // The fused update follows the launch policy of the fluid model
+        launchPropertyUpdate< NC, NP, typename TYPEOFREF( castedFluid ) ::UpdatePolicy >( size,
+                                                                                          fluidWrapper,
+                                                                                          relPermWrapper,
+                                                                                          capPresWrapper,
+                                                                                          lazyUpdateTolerance,
+                                                                                          lagFluidDerivatives,
+                                                                                          presAtLastUpdate,
+                                                                                          compDensAtLastUpdate,
+                                                                                          pres,
+                                                                                          dPres,
+                                                                                          temp,
+                                                                                          compDens,
+                                                                                          dCompDens,
+                                                                                          phaseFrac,
+                                                                                          dPhaseFrac_dPres,
+                                                                                          dPhaseFrac_dComp,
+                                                                                          phaseDens,
+                                                                                          dPhaseDens_dPres,
+                                                                                          dPhaseDens_dComp,
+                                                                                          phaseVisc,
+                                                                                          dPhaseVisc_dPres,
+                                                                                          dPhaseVisc_dComp,
+                                                                                          phaseRelPerm,
+                                                                                          dPhaseRelPerm_dPhaseVolFrac,
+                                                                                          compFrac,
+                                                                                          dCompFrac_dCompDens,
+                                                                                          phaseVolFrac,
+                                                                                          dPhaseVolFrac_dPres,
+                                                                                          dPhaseVolFrac_dComp,
+                                                                                          phaseMob,
+                                                                                          dPhaseMob_dPres,
+                                                                                          dPhaseMob_dComp );
+      } );
+    } );
+  };
+
+  if( capPressure != nullptr )
+  {
+    constitutive::constitutiveUpdatePassThru( *capPressure, [&] ( auto & castedCapPres )
+    {
+      typename TYPEOFREF( castedCapPres ) ::KernelWrapper capPresWrapper = castedCapPres.createKernelWrapper();
+      launch( capPresWrapper );
+    } );
+  }
+  else
+  {
+    launch( NoCapillaryPressureUpdate() );
+  }
+}
+
+#define INST_PropertyUpdateKernel( NC, NP ) \
+  template \
+  void \
+  PropertyUpdateKernel:: \
+    Launch< NC, NP >( localIndex const size, \
+                      real64 const lazyUpdateTolerance, \
+                      bool const lagFluidDerivatives, \
+                      arrayView1d< real64 > const & presAtLastUpdate, \
+                      arrayView2d< real64 > const & compDensAtLastUpdate, \
+                      arrayView1d< real64 const > const & pres, \
+                      arrayView1d< real64 const > const & dPres, \
+                      real64 const temp, \
+                      arrayView2d< real64 const > const & compDens, \
+                      arrayView2d< real64 const > const & dCompDens, \
+                      constitutive::MultiFluidBase & fluid, \
+                      constitutive::RelativePermeabilityBase & relPerm, \
+                      constitutive::CapillaryPressureBase * const capPressure, \
+                      arrayView2d< real64 > const & compFrac, \
+                      arrayView3d< real64 > const & dCompFrac_dCompDens, \
+                      arrayView2d< real64 > const & phaseVolFrac, \
+                      arrayView2d< real64 > const & dPhaseVolFrac_dPres, \
+                      arrayView3d< real64 > const & dPhaseVolFrac_dComp, \
+                      arrayView2d< real64 > const & phaseMob, \
+                      arrayView2d< real64 > const & dPhaseMob_dPres, \
+                      arrayView3d< real64 > const & dPhaseMob_dComp )
+
+INST_PropertyUpdateKernel( 1, 1 );
+INST_PropertyUpdateKernel( 2, 1 );
+INST_PropertyUpdateKernel( 3, 1 );
+INST_PropertyUpdateKernel( 4, 1 );
+INST_PropertyUpdateKernel( 5, 1 );
+
+INST_PropertyUpdateKernel( 1, 2 );
+INST_PropertyUpdateKernel( 2, 2 );
+INST_PropertyUpdateKernel( 3, 2 );
+INST_PropertyUpdateKernel( 4, 2 );
+INST_PropertyUpdateKernel( 5, 2 );
+
+INST_PropertyUpdateKernel( 1, 3 );
+INST_PropertyUpdateKernel( 2, 3 );
+INST_PropertyUpdateKernel( 3, 3 );
+INST_PropertyUpdateKernel( 4, 3 );
+INST_PropertyUpdateKernel( 5, 3 );
+
+#undef INST_PropertyUpdateKernel
+
 /******************************** AccumulationKernel ********************************/
 
 template< localIndex NC >
@@ -763,6 +1044,10 @@ FluxKernel::
            ElementViewConst< arrayView3d< real64 const > > const & phaseCapPressure,
            ElementViewConst< arrayView4d< real64 const > > const & dPhaseCapPressure_dPhaseVolFrac,
            integer const capPressureFlag,
+           integer const adaptiveImplicitFlag,
+           ElementViewConst< arrayView1d< integer const > > const & isImplicit,
+           ElementViewConst< arrayView2d< real64 const > > const & phaseMobOld,
+           ElementViewConst< arrayView3d< real64 const > > const & phaseCompFracOld,
            real64 const dt,
            arraySlice1d< real64 > const localFlux,
            arraySlice2d< real64 > const localFluxJacobian )
@@ -896,7 +1181,13 @@ FluxKernel::
     localIndex esr_up = sesri[k_up];
     localIndex ei_up  = sei[k_up];
 
-    real64 const mobility = phaseMob[er_up][esr_up][ei_up][ip];
+    // in the adaptive-implicit mode, the transport coefficients of an explicit upstream cell
+    // are frozen at the beginning of the time step, only the potential remains implicit
+    bool const explicitUpwind = adaptiveImplicitFlag && isImplicit[er_up][esr_up][ei_up] == 0;
+
+    real64 const mobility = explicitUpwind
+                          ? phaseMobOld[er_up][esr_up][ei_up][ip]
+                          : phaseMob[er_up][esr_up][ei_up][ip];
 
     // skip the phase flux if phase not present or immobile upstream
     if( std::fabs( mobility ) < 1e-20 ) // TODO better constant
@@ -936,14 +1227,17 @@ FluxKernel::
       }
     }
 
-    real64 const dMob_dP  = dPhaseMob_dPres[er_up][esr_up][ei_up][ip];
-    arraySlice1d< real64 const > dPhaseMob_dCompSub = dPhaseMob_dComp[er_up][esr_up][ei_up][ip];
-
     // add contribution from upstream cell mobility derivatives
-    dPhaseFlux_dP[k_up] += dMob_dP * potGrad;
-    for( localIndex jc = 0; jc < NC; ++jc )
+    if( !explicitUpwind )
     {
-      dPhaseFlux_dC[k_up][jc] += dPhaseMob_dCompSub[jc] * potGrad;
+      real64 const dMob_dP  = dPhaseMob_dPres[er_up][esr_up][ei_up][ip];
+      arraySlice1d< real64 const > dPhaseMob_dCompSub = dPhaseMob_dComp[er_up][esr_up][ei_up][ip];
+
+      dPhaseFlux_dP[k_up] += dMob_dP * potGrad;
+      for( localIndex jc = 0; jc < NC; ++jc )
+      {
+        dPhaseFlux_dC[k_up][jc] += dPhaseMob_dCompSub[jc] * potGrad;
+      }
     }
 
     // slice some constitutive arrays to avoid too much indexing in component loop
@@ -954,7 +1248,7 @@ FluxKernel::
     // compute component fluxes and derivatives using upstream cell composition
     for( localIndex ic = 0; ic < NC; ++ic )
     {
-      real64 const ycp = phaseCompFracSub[ic];
+      real64 const ycp = explicitUpwind ? phaseCompFracOld[er_up][esr_up][ei_up][ip][ic] : phaseCompFracSub[ic];
       compFlux[ic] += phaseFlux * ycp;
 
       // derivatives stemming from phase flux
@@ -967,6 +1261,11 @@ FluxKernel::
         }
       }
 
+      if( explicitUpwind )
+      {
+        continue;
+      }
+
       // additional derivatives stemming from upstream cell phase composition
       dCompFlux_dP[k_up][ic] += phaseFlux * dPhaseCompFrac_dPresSub[ic];
 
@@ -1030,6 +1329,10 @@ FluxKernel::
           ElementViewConst< arrayView3d< real64 const > > const & phaseCapPressure,
           ElementViewConst< arrayView4d< real64 const > > const & dPhaseCapPressure_dPhaseVolFrac,
           integer const capPressureFlag,
+          integer const adaptiveImplicitFlag,
+          ElementViewConst< arrayView1d< integer const > > const & isImplicit,
+          ElementViewConst< arrayView2d< real64 const > > const & phaseMobOld,
+          ElementViewConst< arrayView3d< real64 const > > const & phaseCompFracOld,
           real64 const dt,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs )
@@ -1042,78 +1345,107 @@ FluxKernel::
   localIndex constexpr NUM_ELEMS   = STENCIL_TYPE::NUM_POINT_IN_FLUX;
   localIndex constexpr MAX_STENCIL = STENCIL_TYPE::MAX_STENCIL_SIZE;
 
-  forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+  // When the stencil is colored, the connections of a color share no cell and are assembled without atomics
+  arrayView1d< localIndex const > const colorOffsets = stencil.getColorOffsets();
+  arrayView1d< localIndex const > const coloredConnections = stencil.getColoredConnections();
+  bool const colored = !colorOffsets.empty();
+
+  localIndex const numColors = colored ? colorOffsets.size() - 1 : 1;
+  for( localIndex color = 0; color < numColors; ++color )
   {
-    // TODO: hack! for MPFA, etc. must obtain proper size from e.g. seri
-    localIndex const stencilSize = MAX_STENCIL;
-    localIndex constexpr NDOF = NC + 1;
+    localIndex const first = colored ? colorOffsets[color] : 0;
+    localIndex const last = colored ? colorOffsets[color + 1] : stencil.size();
 
-    stackArray1d< real64, NUM_ELEMS * NC >                      localFlux( NUM_ELEMS * NC );
-    stackArray2d< real64, NUM_ELEMS * NC * MAX_STENCIL * NDOF > localFluxJacobian( NUM_ELEMS * NC, stencilSize * NDOF );
-
-    FluxKernel::Compute< NC, NUM_ELEMS, MAX_STENCIL >( numPhases,
-                                                       stencilSize,
-                                                       seri[iconn],
-                                                       sesri[iconn],
-                                                       sei[iconn],
-                                                       weights[iconn],
-                                                       pres,
-                                                       dPres,
-                                                       gravCoef,
-                                                       phaseMob,
-                                                       dPhaseMob_dPres,
-                                                       dPhaseMob_dComp,
-                                                       dPhaseVolFrac_dPres,
-                                                       dPhaseVolFrac_dComp,
-                                                       dCompFrac_dCompDens,
-                                                       phaseDens,
-                                                       dPhaseDens_dPres,
-                                                       dPhaseDens_dComp,
-                                                       phaseCompFrac,
-                                                       dPhaseCompFrac_dPres,
-                                                       dPhaseCompFrac_dComp,
-                                                       phaseCapPressure,
-                                                       dPhaseCapPressure_dPhaseVolFrac,
-                                                       capPressureFlag,
-                                                       dt,
-                                                       localFlux,
-                                                       localFluxJacobian );
-
-    // populate dof indices
-    globalIndex dofColIndices[ MAX_STENCIL * NDOF ];
-    for( localIndex i = 0; i < stencilSize; ++i )
+    forAll< parallelDevicePolicy<> >( last - first, [=] GEOSX_HOST_DEVICE ( localIndex const index )
     {
-      globalIndex const offset = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
-
-      for( localIndex jdof = 0; jdof < NDOF; ++jdof )
+      localIndex const iconn = colored ? coloredConnections[first + index] : index;
+
+      // TODO: hack! for MPFA, etc. must obtain proper size from e.g. seri
+      localIndex const stencilSize = MAX_STENCIL;
+      localIndex constexpr NDOF = NC + 1;
+
+      stackArray1d< real64, NUM_ELEMS * NC >                      localFlux( NUM_ELEMS * NC );
+      stackArray2d< real64, NUM_ELEMS * NC * MAX_STENCIL * NDOF > localFluxJacobian( NUM_ELEMS * NC, stencilSize * NDOF );
+
+      FluxKernel::Compute< NC, NUM_ELEMS, MAX_STENCIL >( numPhases,
+                                                         stencilSize,
+                                                         seri[iconn],
+                                                         sesri[iconn],
+                                                         sei[iconn],
+                                                         weights[iconn],
+                                                         pres,
+                                                         dPres,
+                                                         gravCoef,
+                                                         phaseMob,
+                                                         dPhaseMob_dPres,
+                                                         dPhaseMob_dComp,
+                                                         dPhaseVolFrac_dPres,
+                                                         dPhaseVolFrac_dComp,
+                                                         dCompFrac_dCompDens,
+                                                         phaseDens,
+                                                         dPhaseDens_dPres,
+                                                         dPhaseDens_dComp,
+                                                         phaseCompFrac,
+                                                         dPhaseCompFrac_dPres,
+                                                         dPhaseCompFrac_dComp,
+                                                         phaseCapPressure,
+                                                         dPhaseCapPressure_dPhaseVolFrac,
+                                                         capPressureFlag,
+                                                         adaptiveImplicitFlag,
+                                                         isImplicit,
+                                                         phaseMobOld,
+                                                         phaseCompFracOld,
+                                                         dt,
+                                                         localFlux,
+                                                         localFluxJacobian );
+
+      // populate dof indices
+      globalIndex dofColIndices[ MAX_STENCIL * NDOF ];
+      for( localIndex i = 0; i < stencilSize; ++i )
       {
-        dofColIndices[i * NDOF + jdof] = offset + jdof;
+        globalIndex const offset = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+
+        for( localIndex jdof = 0; jdof < NDOF; ++jdof )
+        {
+          dofColIndices[i * NDOF + jdof] = offset + jdof;
+        }
       }
-    }
 
-    // TODO: apply equation/variable change transformation(s)
+      // TODO: apply equation/variable change transformation(s)
 
-    // Add to residual/jacobian
-    for( localIndex i = 0; i < NUM_ELEMS; ++i )
-    {
-      if( ghostRank[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] < 0 )
+      // Add to residual/jacobian
+      for( localIndex i = 0; i < NUM_ELEMS; ++i )
       {
-        globalIndex const globalRow = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
-        localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - rankOffset );
-        GEOSX_ASSERT_GE( localRow, 0 );
-        GEOSX_ASSERT_GT( localMatrix.numRows(), localRow + NC );
-
-        for( localIndex ic = 0; ic < NC; ++ic )
+        if( ghostRank[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] < 0 )
         {
-          RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow + ic], localFlux[i * NC + ic] );
-          localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow + ic,
-                                                                            dofColIndices,
-                                                                            localFluxJacobian[i * NC + ic].dataIfContiguous(),
-                                                                            stencilSize * NDOF );
+          globalIndex const globalRow = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+          localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - rankOffset );
+          GEOSX_ASSERT_GE( localRow, 0 );
+          GEOSX_ASSERT_GT( localMatrix.numRows(), localRow + NC );
+
+          for( localIndex ic = 0; ic < NC; ++ic )
+          {
+            if( colored )
+            {
+              localRhs[localRow + ic] += localFlux[i * NC + ic];
+              localMatrix.addToRowBinarySearchUnsorted< serialAtomic >( localRow + ic,
+                                                                        dofColIndices,
+                                                                        localFluxJacobian[i * NC + ic].dataIfContiguous(),
+                                                                        stencilSize * NDOF );
+            }
+            else
+            {
+              RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow + ic], localFlux[i * NC + ic] );
+              localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow + ic,
+                                                                                dofColIndices,
+                                                                                localFluxJacobian[i * NC + ic].dataIfContiguous(),
+                                                                                stencilSize * NDOF );
+            }
+          }
         }
       }
-    }
-  } );
+    } );
+  }
 }
 
 #define INST_FluxKernel( NC, STENCIL_TYPE ) \
@@ -1142,6 +1474,10 @@ FluxKernel::
                                 ElementViewConst< arrayView3d< real64 const > > const & phaseCapPressure, \
                                 ElementViewConst< arrayView4d< real64 const > > const & dPhaseCapPressure_dPhaseVolFrac, \
                                 integer const capPressureFlag, \
+                                integer const adaptiveImplicitFlag, \
+                                ElementViewConst< arrayView1d< integer const > > const & isImplicit, \
+                                ElementViewConst< arrayView2d< real64 const > > const & phaseMobOld, \
+                                ElementViewConst< arrayView3d< real64 const > > const & phaseCompFracOld, \
                                 real64 const dt, \
                                 CRSMatrixView< real64, globalIndex const > const & localMatrix, \
                                 arrayView1d< real64 > const & localRhs )
@@ -1160,6 +1496,91 @@ INST_FluxKernel( 5, FaceElementStencil );
 
 #undef INST_FluxKernel
 
+/******************************** CFLNumberKernel ********************************/
+
+template< typename STENCIL_TYPE >
+void
+CFLNumberKernel::
+  Launch( localIndex const numPhases,
+          STENCIL_TYPE const & stencil,
+          ElementViewConst< arrayView1d< real64 const > > const & pres,
+          ElementViewConst< arrayView1d< real64 const > > const & gravCoef,
+          ElementViewConst< arrayView2d< real64 const > > const & phaseMob,
+          ElementViewConst< arrayView3d< real64 const > > const & phaseDens,
+          ElementViewConst< arrayView3d< real64 const > > const & phaseCapPressure,
+          integer const capPressureFlag,
+          ElementView< arrayView1d< real64 > > const & throughput )
+{
+  typename STENCIL_TYPE::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
+  typename STENCIL_TYPE::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
+  typename STENCIL_TYPE::IndexContainerViewConstType const & sei = stencil.getElementIndices();
+  typename STENCIL_TYPE::WeightContainerViewConstType const & weights = stencil.getWeights();
+
+  localIndex constexpr NUM_ELEMS   = STENCIL_TYPE::NUM_POINT_IN_FLUX;
+  localIndex constexpr MAX_STENCIL = STENCIL_TYPE::MAX_STENCIL_SIZE;
+
+  forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+  {
+    for( localIndex ip = 0; ip < numPhases; ++ip )
+    {
+      real64 densMean = 0.0;
+      for( localIndex i = 0; i < NUM_ELEMS; ++i )
+      {
+        densMean += 0.5 * phaseDens[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )][0][ip];
+      }
+
+      // same potential difference as in FluxKernel
+      real64 potGrad = 0.0;
+      for( localIndex i = 0; i < MAX_STENCIL; ++i )
+      {
+        localIndex const er  = seri( iconn, i );
+        localIndex const esr = sesri( iconn, i );
+        localIndex const ei  = sei( iconn, i );
+        real64 const weight  = weights[iconn][i];
+
+        real64 const capPressure = capPressureFlag ? phaseCapPressure[er][esr][ei][0][ip] : 0.0;
+        potGrad += weight * ( pres[er][esr][ei] - capPressure - densMean * gravCoef[er][esr][ei] );
+      }
+
+      localIndex const k_up = (potGrad >= 0) ? 0 : 1;
+      localIndex const er_up  = seri( iconn, k_up );
+      localIndex const esr_up = sesri( iconn, k_up );
+      localIndex const ei_up  = sei( iconn, k_up );
+
+      // the mobilities include the density, divide it out to get the volumetric flux
+      real64 const densUp = phaseDens[er_up][esr_up][ei_up][0][ip];
+      if( densUp < 1e-10 )
+      {
+        continue;
+      }
+      real64 const volFlux = std::fabs( phaseMob[er_up][esr_up][ei_up][ip] * potGrad ) / densUp;
+
+      for( localIndex i = 0; i < NUM_ELEMS; ++i )
+      {
+        RAJA::atomicAdd( parallelDeviceAtomic{}, &throughput[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )], volFlux );
+      }
+    }
+  } );
+}
+
+#define INST_CFLNumberKernel( STENCIL_TYPE ) \
+  template \
+  void CFLNumberKernel:: \
+    Launch< STENCIL_TYPE >( localIndex const numPhases, \
+                            STENCIL_TYPE const & stencil, \
+                            ElementViewConst< arrayView1d< real64 const > > const & pres, \
+                            ElementViewConst< arrayView1d< real64 const > > const & gravCoef, \
+                            ElementViewConst< arrayView2d< real64 const > > const & phaseMob, \
+                            ElementViewConst< arrayView3d< real64 const > > const & phaseDens, \
+                            ElementViewConst< arrayView3d< real64 const > > const & phaseCapPressure, \
+                            integer const capPressureFlag, \
+                            ElementView< arrayView1d< real64 > > const & throughput )
+
+INST_CFLNumberKernel( CellElementStencilTPFA );
+INST_CFLNumberKernel( FaceElementStencil );
+
+#undef INST_CFLNumberKernel
+
 /******************************** VolumeBalanceKernel ********************************/
 
 template< localIndex NC, localIndex NP >
@@ -26,6 +26,13 @@
 namespace geosx
 {
 
+namespace constitutive
+{
+class MultiFluidBase;
+class RelativePermeabilityBase;
+class CapillaryPressureBase;
+}
+
 namespace CompositionalMultiphaseFlowKernels
 {
 
@@ -194,7 +201,7 @@ struct FluidUpdateKernel
           real64 const temp,
           arrayView2d< real64 const > const & compFrac )
   {
-    forAll< POLICY >( size, [=] ( localIndex const k )
+    forAll< POLICY >( size, [=] GEOSX_HOST_DEVICE ( localIndex const k )
     {
       for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
       {
@@ -212,7 +219,7 @@ struct FluidUpdateKernel
           real64 const temp,
           arrayView2d< real64 const > const & compFrac )
   {
-    forAll< POLICY >( size, [=] ( localIndex const k )
+    forAll< POLICY >( size, [=] GEOSX_HOST_DEVICE ( localIndex const k )
     {
       for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
       {
@@ -230,7 +237,7 @@ struct FluidUpdateKernel
           real64 const temp,
           arrayView2d< real64 const > const & compFrac )
   {
-    forAll< POLICY >( targetSet.size(), [=] ( localIndex const a )
+    forAll< POLICY >( targetSet.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
     {
       localIndex const k = targetSet[a];
       for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
@@ -248,7 +255,7 @@ struct FluidUpdateKernel
           real64 const temp,
           arrayView2d< real64 const > const & compFrac )
   {
-    forAll< POLICY >( targetSet.size(), [=] ( localIndex const a )
+    forAll< POLICY >( targetSet.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
     {
       localIndex const k = targetSet[a];
       for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
@@ -331,6 +338,119 @@ struct CapillaryPressureUpdateKernel
   }
 };
 
+/******************************** PropertyUpdateKernel ********************************/
+
+/**
+ * @brief Functions to update all the dependent properties of a cell in a single pass
+ *
+ * Fuses the component fraction, fluid, phase volume fraction, relative permeability, phase mobility
+ * and capillary pressure updates: each cell is read once and its properties are computed while the
+ * intermediate results are still in cache, instead of streaming the whole subregion through six launches.
+ */
+struct PropertyUpdateKernel
+{
+  /**
+   * @brief Check whether the state of a cell changed since its last update, and store the new state if it did.
+   * @tparam NC the number of components
+   * @param tolerance the relative change of pressure and component densities below which the state is unchanged
+   * @param pres the pressure at the beginning of the step
+   * @param dPres the pressure increment
+   * @param compDens the global component densities at the beginning of the step
+   * @param dCompDens the global component density increments
+   * @param presAtLastUpdate the pressure of the last update, NaN to force the update
+   * @param compDensAtLastUpdate the global component densities of the last update
+   * @return true if the properties of the cell must be updated
+   */
+  template< localIndex NC >
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  static bool
+  UpdateLastState( real64 const tolerance,
+                   real64 const & pres,
+                   real64 const & dPres,
+                   arraySlice1d< real64 const > const & compDens,
+                   arraySlice1d< real64 const > const & dCompDens,
+                   real64 & presAtLastUpdate,
+                   arraySlice1d< real64 > const & compDensAtLastUpdate )
+  {
+    real64 const newPres = pres + dPres;
+    real64 totalDens = 0.0;
+    for( localIndex ic = 0; ic < NC; ++ic )
+    {
+      totalDens += compDens[ic] + dCompDens[ic];
+    }
+
+    // written so that a NaN stored state always compares as changed
+    bool changed = !( std::fabs( newPres - presAtLastUpdate ) <= tolerance * std::fabs( newPres ) );
+    for( localIndex ic = 0; ic < NC; ++ic )
+    {
+      changed = changed || !( std::fabs( compDens[ic] + dCompDens[ic] - compDensAtLastUpdate[ic] ) <= tolerance * totalDens );
+    }
+
+    if( changed )
+    {
+      presAtLastUpdate = newPres;
+      for( localIndex ic = 0; ic < NC; ++ic )
+      {
+        compDensAtLastUpdate[ic] = compDens[ic] + dCompDens[ic];
+      }
+    }
+    return changed;
+  }
+
+  /**
+   * @brief Update the dependent properties of the cells of a subregion.
+   * @tparam NC the number of components
+   * @tparam NP the number of phases
+   * @param size the number of cells
+   * @param lazyUpdateTolerance the relative change of the state of a cell below which it is not updated,
+   *   0 to update all the cells
+   * @param lagFluidDerivatives flag indicating whether only the values of the fluid properties are updated,
+   *   their derivatives being kept from the previous update
+   * @param presAtLastUpdate the pressure of the last update of each cell
+   * @param compDensAtLastUpdate the global component densities of the last update of each cell
+   * @param pres the pressure at the beginning of the step
+   * @param dPres the pressure increment
+   * @param temp the temperature
+   * @param compDens the global component densities at the beginning of the step
+   * @param dCompDens the global component density increments
+   * @param fluid the fluid model, updated in place
+   * @param relPerm the relative permeability model, updated in place
+   * @param capPressure the capillary pressure model, updated in place, or nullptr if there is none
+   * @param compFrac the global component fractions
+   * @param dCompFrac_dCompDens the derivatives of the component fractions wrt the component densities
+   * @param phaseVolFrac the phase volume fractions
+   * @param dPhaseVolFrac_dPres the derivatives of the phase volume fractions wrt pressure
+   * @param dPhaseVolFrac_dComp the derivatives of the phase volume fractions wrt the component densities
+   * @param phaseMob the phase mobilities
+   * @param dPhaseMob_dPres the derivatives of the phase mobilities wrt pressure
+   * @param dPhaseMob_dComp the derivatives of the phase mobilities wrt the component densities
+   */
+  template< localIndex NC, localIndex NP >
+  static void
+  Launch( localIndex const size,
+          real64 const lazyUpdateTolerance,
+          bool const lagFluidDerivatives,
+          arrayView1d< real64 > const & presAtLastUpdate,
+          arrayView2d< real64 > const & compDensAtLastUpdate,
+          arrayView1d< real64 const > const & pres,
+          arrayView1d< real64 const > const & dPres,
+          real64 const temp,
+          arrayView2d< real64 const > const & compDens,
+          arrayView2d< real64 const > const & dCompDens,
+          constitutive::MultiFluidBase & fluid,
+          constitutive::RelativePermeabilityBase & relPerm,
+          constitutive::CapillaryPressureBase * const capPressure,
+          arrayView2d< real64 > const & compFrac,
+          arrayView3d< real64 > const & dCompFrac_dCompDens,
+          arrayView2d< real64 > const & phaseVolFrac,
+          arrayView2d< real64 > const & dPhaseVolFrac_dPres,
+          arrayView3d< real64 > const & dPhaseVolFrac_dComp,
+          arrayView2d< real64 > const & phaseMob,
+          arrayView2d< real64 > const & dPhaseMob_dPres,
+          arrayView3d< real64 > const & dPhaseMob_dComp );
+};
+
 /******************************** AccumulationKernel ********************************/
 
 /**
@@ -438,6 +558,10 @@ struct FluxKernel
            ElementViewConst< arrayView3d< real64 const > > const & phaseCapPressure,
            ElementViewConst< arrayView4d< real64 const > > const & dPhaseCapPressure_dPhaseVolFrac,
            integer const capPressureFlag,
+           integer const adaptiveImplicitFlag,
+           ElementViewConst< arrayView1d< integer const > > const & isImplicit,
+           ElementViewConst< arrayView2d< real64 const > > const & phaseMobOld,
+           ElementViewConst< arrayView3d< real64 const > > const & phaseCompFracOld,
            real64 const dt,
            arraySlice1d< real64 > const localFlux,
            arraySlice2d< real64 > const localFluxJacobian );
@@ -467,11 +591,57 @@ struct FluxKernel
           ElementViewConst< arrayView3d< real64 const > > const & phaseCapPressure,
           ElementViewConst< arrayView4d< real64 const > > const & dPhaseCapPressure_dPhaseVolFrac,
           integer const capPressureFlag,
+          integer const adaptiveImplicitFlag,
+          ElementViewConst< arrayView1d< integer const > > const & isImplicit,
+          ElementViewConst< arrayView2d< real64 const > > const & phaseMobOld,
+          ElementViewConst< arrayView3d< real64 const > > const & phaseCompFracOld,
           real64 const dt,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs );
 };
 
+/******************************** CFLNumberKernel ********************************/
+
+/**
+ * @brief Functions to compute the cell CFL numbers used to choose the implicit cells in the adaptive-implicit mode
+ */
+struct CFLNumberKernel
+{
+
+  template< typename VIEWTYPE >
+  using ElementViewConst = ElementRegionManager::ElementViewConst< VIEWTYPE >;
+
+  template< typename VIEWTYPE >
+  using ElementView = ElementRegionManager::ElementView< VIEWTYPE >;
+
+  /**
+   * @brief Accumulate the absolute volumetric phase fluxes through the faces of each cell
+   * @tparam STENCIL_TYPE the type of the flux stencil
+   * @param[in] numPhases the number of fluid phases
+   * @param[in] stencil the flux stencil
+   * @param[in] pres the cell pressures
+   * @param[in] gravCoef the cell gravity coefficients
+   * @param[in] phaseMob the cell phase mobilities
+   * @param[in] phaseDens the cell phase densities
+   * @param[in] phaseCapPressure the cell phase capillary pressures
+   * @param[in] capPressureFlag flag indicating whether capillary pressure is present
+   * @param[inout] throughput the sum of the inflows and outflows of each cell
+   *
+   * The sum of the inflows and outflows bounds both of them, which also accounts for the flow to and from the wells.
+   */
+  template< typename STENCIL_TYPE >
+  static void
+  Launch( localIndex const numPhases,
+          STENCIL_TYPE const & stencil,
+          ElementViewConst< arrayView1d< real64 const > > const & pres,
+          ElementViewConst< arrayView1d< real64 const > > const & gravCoef,
+          ElementViewConst< arrayView2d< real64 const > > const & phaseMob,
+          ElementViewConst< arrayView3d< real64 const > > const & phaseDens,
+          ElementViewConst< arrayView3d< real64 const > > const & phaseCapPressure,
+          integer const capPressureFlag,
+          ElementView< arrayView1d< real64 > > const & throughput );
+};
+
 /******************************** VolumeBalanceKernel ********************************/
 
 /**
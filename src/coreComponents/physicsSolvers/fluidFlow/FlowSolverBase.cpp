@@ -22,6 +22,7 @@
 #include "finiteVolume/FluxApproximationBase.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/NumericalMethodsManager.hpp"
+#include "mesh/AggregateElementSubRegion.hpp"
 
 namespace geosx
 {
@@ -73,6 +74,12 @@ FlowSolverBase::FlowSolverBase( std::string const & name,
     setDescription( "Coefficient to move between harmonic mean (1.0) and arithmetic mean (0.0) for the "
                     "calculation of permeability between elements." );
 
+  this->registerWrapper( viewKeyStruct::targetPressureChangeString, &m_targetPressureChange )->
+    setApplyDefaultValue( 1.0e6 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Target change of the pressure over a time step, used when the timeStepControl of the "
+                    "nonlinear solver parameters is TargetChange or Combined." );
+
 }
 
 void FlowSolverBase::RegisterDataOnMesh( Group * const MeshBodies )
@@ -125,6 +132,8 @@ void FlowSolverBase::PostProcessInput()
   SolverBase::PostProcessInput();
   CheckModelNames( m_fluidModelNames, viewKeyStruct::fluidNamesString );
   CheckModelNames( m_solidModelNames, viewKeyStruct::solidNamesString );
+  GEOSX_ERROR_IF_LE_MSG( m_targetPressureChange, 0.0,
+                         getName() << ": " << viewKeyStruct::targetPressureChangeString << " should be positive" );
 }
 
 void FlowSolverBase::InitializePreSubGroups( Group * const rootGroup )
@@ -258,6 +267,74 @@ void FlowSolverBase::ResetViews( MeshLevel & mesh )
 #endif
 }
 
+localIndex FlowSolverBase::MapRowsToAggregates( MeshLevel const & mesh,
+                                                DofManager const & dofManager,
+                                                string const & dofFieldName,
+                                                array1d< localIndex > & rowAggregates ) const
+{
+  string const dofKey = dofManager.getKey( dofFieldName );
+  localIndex const numComp = dofManager.numComponents( dofFieldName );
+  globalIndex const dofOffset = dofManager.globalOffset( dofFieldName );
+
+  rowAggregates.resize( dofManager.numLocalDofs( dofFieldName ) / numComp );
+  rowAggregates.setValues< serialPolicy >( -1 );
+
+  localIndex numAggregates = 0;
+  forTargetRegions< CellElementRegion >( mesh, [&]( localIndex const,
+                                                    CellElementRegion const & region )
+  {
+    AggregateElementSubRegion const * const aggregateSubRegion =
+      region.GetSubRegion< AggregateElementSubRegion >( "coarse" );
+    GEOSX_ERROR_IF( aggregateSubRegion == nullptr || aggregateSubRegion->GetNbAggregates() == 0,
+                    "No aggregates on region " << region.getName() << ", set its " <<
+                    CellElementRegion::viewKeyStruct::coarseningRatioString );
+
+    // The fine cells of the aggregates are numbered through all the subregions of the region, ghosts included
+    array1d< localIndex > offsetSubRegions( region.numSubRegions() + 1 );
+    for( localIndex esr = 0; esr < region.numSubRegions(); ++esr )
+    {
+      offsetSubRegions[esr + 1] = offsetSubRegions[esr] + region.GetSubRegion( esr )->size();
+    }
+
+    array1d< localIndex > fineAggregates( offsetSubRegions[region.numSubRegions()] );
+    for( localIndex a = 0; a < aggregateSubRegion->GetNbAggregates(); ++a )
+    {
+      aggregateSubRegion->forFineCellsInAggregate( a, [&]( localIndex const fineCell )
+      {
+        fineAggregates[fineCell] = a;
+      } );
+    }
+
+    // Aggregates made of ghost cells only are dropped
+    array1d< localIndex > compactAggregates( aggregateSubRegion->GetNbAggregates() );
+    compactAggregates.setValues< serialPolicy >( -1 );
+
+    region.forElementSubRegionsIndex< CellElementSubRegion >( [&]( localIndex const esr,
+                                                                   CellElementSubRegion const & subRegion )
+    {
+      arrayView1d< globalIndex const > const & dofNumber = subRegion.getReference< array1d< globalIndex > >( dofKey );
+      arrayView1d< integer const > const & elemGhostRank = subRegion.ghostRank();
+
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        if( elemGhostRank[ei] >= 0 )
+        {
+          continue;
+        }
+        localIndex const a = fineAggregates[offsetSubRegions[esr] + ei];
+        if( compactAggregates[a] < 0 )
+        {
+          compactAggregates[a] = numAggregates++;
+        }
+        localIndex const row = LvArray::integerConversion< localIndex >( ( dofNumber[ei] - dofOffset ) / numComp );
+        rowAggregates[row] = compactAggregates[a];
+      }
+    } );
+  } );
+
+  return numAggregates;
+}
+
 std::vector< string > FlowSolverBase::getConstitutiveRelations( string const & regionName ) const
 {
 
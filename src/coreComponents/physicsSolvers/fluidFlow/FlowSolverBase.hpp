@@ -106,6 +106,7 @@ public:
 
     static constexpr auto inputFluxEstimateString  = "inputFluxEstimate";
     static constexpr auto meanPermCoeffString  = "meanPermCoeff";
+    static constexpr auto targetPressureChangeString = "targetPressureChange";
   } viewKeysFlowSolverBase;
 
   struct groupKeyStruct : SolverBase::groupKeyStruct
@@ -148,6 +149,19 @@ protected:
 
   void PrecomputeData( MeshLevel & mesh );
 
+  /**
+   * @brief Map the local rows of the cell pressure system to the aggregates of the target regions.
+   * @param mesh the mesh level
+   * @param dofManager the dof manager
+   * @param dofFieldName the name of the cell DoF field, the pressure system having a row per locally owned cell
+   * @param rowAggregates the local aggregate of each local row, negative if the cell belongs to no aggregate
+   * @return the number of local aggregates, counting only the aggregates holding locally owned cells
+   */
+  localIndex MapRowsToAggregates( MeshLevel const & mesh,
+                                  DofManager const & dofManager,
+                                  string const & dofFieldName,
+                                  array1d< localIndex > & rowAggregates ) const;
+
   virtual void PostProcessInput() override;
 
   virtual void InitializePreSubGroups( Group * const rootGroup ) override;
@@ -175,6 +189,9 @@ protected:
 
   real64 m_meanPermCoeff;
 
+  /// Target change of the pressure over a time step, for the target change time step control
+  real64 m_targetPressureChange;
+
   /// views into constant data fields
   ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > m_elemGhostRank;
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > >  m_volume;
@@ -49,8 +49,12 @@ using namespace ProppantTransportKernels;
 
 ProppantTransport::ProppantTransport( const std::string & name,
                                       Group * const parent ):
-  FlowSolverBase( name, parent )
+  FlowSolverBase( name, parent ),
+  m_subcyclePhase( SubcyclePhase::None ),
+  m_subcycleStateSaved( false )
 {
+  m_dofNumber.setName( getName() + "/accessors/dofNumber" );
+
   this->registerWrapper( viewKeyStruct::proppantNamesString, &m_proppantModelNames )->setInputFlag( InputFlags::REQUIRED )->
     setDescription( "Name of proppant constitutive object to use for this solver." );
 
@@ -82,12 +86,23 @@ ProppantTransport::ProppantTransport( const std::string & name,
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Flag that enables/disables proppant-packing update" );
 
+  registerWrapper( viewKeyStruct::subcycleCFLString, &m_subcycleCFL )->setApplyDefaultValue( 0.0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "CFL number above which the fracture elements take several substeps per time step, "
+                    "while the others take one. The subcycling is disabled if not positive" );
+
+  registerWrapper( viewKeyStruct::maxNumSubcyclesString, &m_maxNumSubcycles )->setApplyDefaultValue( 8 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum number of substeps of the subcycled fracture elements per time step" );
+
 }
 
 void ProppantTransport::PostProcessInput()
 {
   FlowSolverBase::PostProcessInput();
   CheckModelNames( m_proppantModelNames, viewKeyStruct::proppantNamesString );
+
+  GEOSX_ERROR_IF( m_maxNumSubcycles < 1, viewKeyStruct::maxNumSubcyclesString << " must be at least 1" );
 }
 
 void ProppantTransport::RegisterDataOnMesh( Group * const MeshBodies )
@@ -128,6 +143,13 @@ void ProppantTransport::RegisterDataOnMesh( Group * const MeshBodies )
       subRegion.registerWrapper< array1d< real64 > >( viewKeyStruct::poroMultiplierString )->setDefaultValue( 1.0 );
       subRegion.registerWrapper< array1d< R1Tensor > >( viewKeyStruct::transTMultiplierString )->setDefaultValue( { 1.0, 1.0, 1.0 } );
       subRegion.registerWrapper< array2d< real64 > >( viewKeyStruct::bcComponentConcentrationString )->setDefaultValue( 0.0 );
+
+      subRegion.registerWrapper< array1d< real64 > >( viewKeyStruct::proppantCFLString )->setPlotLevel( PlotLevel::LEVEL_1 );
+      subRegion.registerWrapper< array1d< integer > >( viewKeyStruct::isSubcycledString );
+      subRegion.registerWrapper< array2d< real64 > >( viewKeyStruct::interfaceFluxString );
+      subRegion.registerWrapper< array1d< real64 > >( viewKeyStruct::stepStartProppantConcentrationString );
+      subRegion.registerWrapper< array2d< real64 > >( viewKeyStruct::stepStartComponentConcentrationString );
+      subRegion.registerWrapper< array2d< real64 > >( viewKeyStruct::stepStartComponentDensityString );
     } );
 
   }
@@ -182,30 +204,15 @@ void ProppantTransport::ResizeFractureFields( MeshLevel & mesh )
       subRegion.getReference< array2d< real64 > >( viewKeyStruct::deltaComponentConcentrationString ).resizeDimension< 1 >( NC );
       subRegion.getReference< array2d< real64 > >( viewKeyStruct::oldComponentDensityString ).resizeDimension< 1 >( NC );
       subRegion.getReference< array2d< real64 > >( viewKeyStruct::bcComponentConcentrationString ).resizeDimension< 1 >( NC );
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::stepStartComponentConcentrationString ).resizeDimension< 1 >( NC );
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::stepStartComponentDensityString ).resizeDimension< 1 >( NC );
     } );
   }
-}
-
-void ProppantTransport::UpdateFluidModel( Group & dataGroup, localIndex const targetIndex )
-{
-  GEOSX_MARK_FUNCTION;
-
-  arrayView1d< real64 const > const pres  = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::pressureString );
-  arrayView1d< real64 const > const dPres = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::deltaPressureString );
-
-  arrayView2d< real64 const > const componentConc  = dataGroup.getReference< array2d< real64 > >( viewKeyStruct::componentConcentrationString );
-  arrayView2d< real64 const > const dComponentConc = dataGroup.getReference< array2d< real64 > >( viewKeyStruct::deltaComponentConcentrationString );
 
-  SlurryFluidBase & fluid = GetConstitutiveModel< SlurryFluidBase >( dataGroup, m_fluidModelNames[targetIndex] );
-
-  constitutive::constitutiveUpdatePassThru( fluid, [&]( auto & castedFluid )
+  forTargetSubRegions< FaceElementSubRegion >( mesh, [&]( localIndex const,
+                                                          FaceElementSubRegion & subRegion )
   {
-    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
-    FluidUpdateKernel::Launch( fluidWrapper,
-                               pres,
-                               dPres,
-                               componentConc,
-                               dComponentConc );
+    subRegion.getReference< array2d< real64 > >( viewKeyStruct::interfaceFluxString ).resizeDimension< 1 >( m_numDofPerCell );
   } );
 }
 
@@ -233,39 +240,6 @@ void ProppantTransport::UpdateComponentDensity( Group & dataGroup, localIndex co
 }
 
 
-void ProppantTransport::UpdateProppantModel( Group & dataGroup, localIndex const targetIndex )
-{
-  GEOSX_MARK_FUNCTION;
-
-  arrayView1d< real64 const > const proppantConc  = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::proppantConcentrationString );
-  arrayView1d< real64 const > const dProppantConc = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::deltaProppantConcentrationString );
-
-  SlurryFluidBase const & fluid = GetConstitutiveModel< SlurryFluidBase >( dataGroup, m_fluidModelNames[targetIndex] );
-
-  arrayView2d< real64 const > const fluidDens            = fluid.fluidDensity();
-  arrayView2d< real64 const > const dFluidDens_dPres     = fluid.dFluidDensity_dPressure();
-  arrayView3d< real64 const > const dFluidDens_dCompConc = fluid.dFluidDensity_dComponentConcentration();
-  arrayView2d< real64 const > const fluidVisc            = fluid.fluidViscosity();
-  arrayView2d< real64 const > const dFluidVisc_dPres     = fluid.dFluidViscosity_dPressure();
-  arrayView3d< real64 const > const dFluidVisc_dCompConc = fluid.dFluidViscosity_dComponentConcentration();
-
-  ParticleFluidBase & proppant = GetConstitutiveModel< ParticleFluidBase >( dataGroup, m_proppantModelNames[targetIndex] );
-
-  constitutiveUpdatePassThru( proppant, [&]( auto & castedProppant )
-  {
-    typename TYPEOFREF( castedProppant ) ::KernelWrapper proppantWrapper = castedProppant.createKernelWrapper();
-    ProppantUpdateKernel::Launch( proppantWrapper,
-                                  proppantConc,
-                                  dProppantConc,
-                                  fluidDens,
-                                  dFluidDens_dPres,
-                                  dFluidDens_dCompConc,
-                                  fluidVisc,
-                                  dFluidVisc_dPres,
-                                  dFluidVisc_dCompConc );
-  } );
-}
-
 void ProppantTransport::UpdateProppantMobility( Group & dataGroup )
 {
   GEOSX_MARK_FUNCTION;
@@ -288,8 +262,50 @@ void ProppantTransport::UpdateState( Group & dataGroup, localIndex const targetI
 {
   GEOSX_MARK_FUNCTION;
 
-  UpdateFluidModel( dataGroup, targetIndex );
-  UpdateProppantModel( dataGroup, targetIndex );
+  arrayView1d< real64 const > const pres  = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::pressureString );
+  arrayView1d< real64 const > const dPres = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::deltaPressureString );
+
+  arrayView2d< real64 const > const componentConc  = dataGroup.getReference< array2d< real64 > >( viewKeyStruct::componentConcentrationString );
+  arrayView2d< real64 const > const dComponentConc = dataGroup.getReference< array2d< real64 > >( viewKeyStruct::deltaComponentConcentrationString );
+
+  arrayView1d< real64 const > const proppantConc  = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::proppantConcentrationString );
+  arrayView1d< real64 const > const dProppantConc = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::deltaProppantConcentrationString );
+
+  SlurryFluidBase & fluid = GetConstitutiveModel< SlurryFluidBase >( dataGroup, m_fluidModelNames[targetIndex] );
+
+  arrayView2d< real64 const > const fluidDens            = fluid.fluidDensity();
+  arrayView2d< real64 const > const dFluidDens_dPres     = fluid.dFluidDensity_dPressure();
+  arrayView3d< real64 const > const dFluidDens_dCompConc = fluid.dFluidDensity_dComponentConcentration();
+  arrayView2d< real64 const > const fluidVisc            = fluid.fluidViscosity();
+  arrayView2d< real64 const > const dFluidVisc_dPres     = fluid.dFluidViscosity_dPressure();
+  arrayView3d< real64 const > const dFluidVisc_dCompConc = fluid.dFluidViscosity_dComponentConcentration();
+
+  ParticleFluidBase & proppant = GetConstitutiveModel< ParticleFluidBase >( dataGroup, m_proppantModelNames[targetIndex] );
+
+  constitutive::constitutiveUpdatePassThru( fluid, [&]( auto & castedFluid )
+  {
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+
+    constitutive::constitutiveUpdatePassThru( proppant, [&]( auto & castedProppant )
+    {
+      typename TYPEOFREF( castedProppant ) ::KernelWrapper proppantWrapper = castedProppant.createKernelWrapper();
+
+      StateUpdateKernel::Launch( fluidWrapper,
+                                 proppantWrapper,
+                                 pres,
+                                 dPres,
+                                 componentConc,
+                                 dComponentConc,
+                                 proppantConc,
+                                 dProppantConc,
+                                 fluidDens,
+                                 dFluidDens_dPres,
+                                 dFluidDens_dCompConc,
+                                 fluidVisc,
+                                 dFluidVisc_dPres,
+                                 dFluidVisc_dCompConc );
+    } );
+  } );
 }
 
 void ProppantTransport::InitializePostInitialConditions_PreSubGroups( Group * const rootGroup )
@@ -361,7 +377,7 @@ real64 ProppantTransport::SolverStep( real64 const & time_n,
   PreStepUpdate( time_n, dt, domain );
 
   // currently the only method is implicit time integration
-  real64 const dtReturn= this->NonlinearImplicitStep( time_n, dt, cycleNumber, domain );
+  real64 const dtReturn = SubcycledImplicitStep( time_n, dt, cycleNumber, domain );
 
   // final step for completion of timestep. typically secondary variable updates and cleanup.
 
@@ -383,6 +399,8 @@ void ProppantTransport::PreStepUpdate( real64 const & time,
 
   FlowSolverBase::PrecomputeData( mesh );
 
+  m_subcycleStateSaved = false;
+
   NodeManager const & nodeManager = *mesh.getNodeManager();
   FaceManager const & faceManager = *mesh.getFaceManager();
 
@@ -559,6 +577,11 @@ void ProppantTransport::AssembleSystem( real64 const time,
                      dofManager,
                      localMatrix,
                      localRhs );
+
+  if( m_subcyclePhase == SubcyclePhase::Slow )
+  {
+    AssembleInterfaceFluxes( domain, dofManager, localRhs );
+  }
 }
 
 void ProppantTransport::AssembleAccumulationTerms( real64 const dt,
@@ -640,10 +663,7 @@ void ProppantTransport::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM( time
 
   string const dofKey = dofManager.getKey( viewKeyStruct::proppantConcentrationString );
 
-  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > >
-  dofNumberAccessor = elemManager.ConstructViewAccessor< array1d< globalIndex >, arrayView1d< globalIndex const > >( dofKey );
-
-  FluxKernel::ElementViewConst< arrayView1d< globalIndex const > > const dofNumber = dofNumberAccessor.toNestedViewConst();
+  FluxKernel::ElementViewConst< arrayView1d< globalIndex const > > const dofNumber = m_dofNumber.get( elemManager, dofKey ).toNestedViewConst();
 
   FluxKernel::ElementViewConst< arrayView1d< real64 const > > const pres  = m_pressure.toNestedViewConst();
   FluxKernel::ElementViewConst< arrayView1d< real64 const > > const dPres = m_deltaPressure.toNestedViewConst();
@@ -689,6 +709,9 @@ void ProppantTransport::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM( time
 
   FluxKernel::ElementViewConst< arrayView1d< integer const > > const elemGhostRank = m_elemGhostRank.toNestedViewConst();
 
+  FluxKernel::ElementViewConst< arrayView1d< integer const > > const isSubcycled = m_isSubcycled.toNestedViewConst();
+  FluxKernel::ElementView< arrayView2d< real64 > > const interfaceFlux = m_interfaceFlux.toNestedView();
+
   fluxApprox.forStencils< FaceElementStencil >( mesh, [&]( auto const & stencil )
   {
 
@@ -729,6 +752,9 @@ void ProppantTransport::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM( time
                         isProppantMobile,
                         proppantPackVf,
                         aperture,
+                        m_subcyclePhase,
+                        isSubcycled,
+                        interfaceFlux,
                         localMatrix,
                         localRhs );
   } );
@@ -894,12 +920,18 @@ void ProppantTransport::ApplyBoundaryConditions( real64 const time_n,
       } );
     } );
   }
+
+  if( m_subcyclePhase != SubcyclePhase::None )
+  {
+    FreezeInactiveElements( domain, dofManager, localMatrix, localRhs );
+  }
 }
 
-real64
-ProppantTransport::CalculateResidualNorm( DomainPartition const & domain,
-                                          DofManager const & dofManager,
-                                          arrayView1d< real64 const > const & localRhs )
+void
+ProppantTransport::CalculateLocalResidualNorms( DomainPartition const & domain,
+                                                DofManager const & dofManager,
+                                                arrayView1d< real64 const > const & localRhs,
+                                                ResidualNormParts & parts )
 {
   MeshLevel const & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
 
@@ -935,9 +967,14 @@ ProppantTransport::CalculateResidualNorm( DomainPartition const & domain,
     localResidualNorm += localSum.get();
   } );
 
+  parts.appendSum( localResidualNorm );
+}
+
+real64
+ProppantTransport::CombineResidualNorms( ResidualNormParts & parts )
+{
   // compute global residual norm
-  real64 const globalResidualNorm = MpiWrapper::Sum( localResidualNorm, MPI_COMM_GEOSX );
-  return sqrt( globalResidualNorm );
+  return sqrt( parts.nextSum() );
 }
 
 void ProppantTransport::ApplySystemSolution( DofManager const & dofManager,
@@ -995,6 +1032,12 @@ void ProppantTransport::ResetStateToBeginningOfStep( DomainPartition & domain )
 {
   MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
 
+  if( m_subcycleStateSaved )
+  {
+    // undo the substeps committed by SubcycledImplicitStep
+    BackupSubcycleState( mesh, true );
+  }
+
   localIndex const NC = m_numComponents;
 
   forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
@@ -1059,6 +1102,14 @@ void ProppantTransport::ResetViews( MeshLevel & mesh )
   m_isProppantMobile = elemManager.ConstructArrayViewAccessor< integer, 1 >( viewKeyStruct::isProppantMobileString );
   m_isProppantMobile.setName( getName() + "/accessors/" + viewKeyStruct::isProppantMobileString );
 
+  m_isSubcycled.clear();
+  m_isSubcycled = elemManager.ConstructArrayViewAccessor< integer, 1 >( viewKeyStruct::isSubcycledString );
+  m_isSubcycled.setName( getName() + "/accessors/" + viewKeyStruct::isSubcycledString );
+
+  m_interfaceFlux.clear();
+  m_interfaceFlux = elemManager.ConstructViewAccessor< array2d< real64 >, arrayView2d< real64 > >( viewKeyStruct::interfaceFluxString );
+  m_interfaceFlux.setName( getName() + "/accessors/" + viewKeyStruct::interfaceFluxString );
+
   m_isProppantBoundaryElement.clear();
   m_isProppantBoundaryElement = elemManager.ConstructArrayViewAccessor< integer, 1 >( viewKeyStruct::isProppantBoundaryString );
   m_isProppantBoundaryElement.setName( getName() + "/accessors/" + viewKeyStruct::isProppantBoundaryString );
@@ -1390,5 +1441,324 @@ void ProppantTransport::UpdateProppantPackVolume( real64 const GEOSX_UNUSED_PARA
 }
 
 
+real64 ProppantTransport::SubcycledImplicitStep( real64 const & time_n,
+                                                 real64 const & dt,
+                                                 integer const cycleNumber,
+                                                 DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  if( m_subcycleCFL <= 0.0 )
+  {
+    return NonlinearImplicitStep( time_n, dt, cycleNumber, domain );
+  }
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
+  // a step repeated after a time step cut or by a coupled solver starts again from the saved state
+  BackupSubcycleState( mesh, m_subcycleStateSaved );
+  m_subcycleStateSaved = true;
+
+  integer const numSubcycles = MarkSubcycledElements( dt, domain );
+  if( numSubcycles <= 1 )
+  {
+    return NonlinearImplicitStep( time_n, dt, cycleNumber, domain );
+  }
+
+  forTargetSubRegions( mesh, [&]( localIndex const, ElementSubRegionBase & subRegion )
+  {
+    subRegion.getReference< array2d< real64 > >( viewKeyStruct::interfaceFluxString ).setValues< parallelDevicePolicy<> >( 0.0 );
+  } );
+
+  real64 const subDt = dt / numSubcycles;
+  for( integer k = 0; k < numSubcycles; ++k )
+  {
+    GEOSX_LOG_LEVEL_RANK_0( 1, "\tProppant substep " << k + 1 << " of " << numSubcycles << ", dt = " << subDt );
+
+    m_subcyclePhase = SubcyclePhase::Fast;
+    real64 const subDtReturn = NonlinearImplicitStep( time_n + k * subDt, subDt, cycleNumber, domain );
+    if( subDtReturn < subDt )
+    {
+      // let the caller repeat the whole step with the achieved substep
+      m_subcyclePhase = SubcyclePhase::None;
+      return subDtReturn * numSubcycles;
+    }
+
+    AccumulateInterfaceFluxes( time_n + k * subDt, subDt, domain );
+    CompleteSubstep( mesh );
+  }
+
+  m_subcyclePhase = SubcyclePhase::Slow;
+  real64 const dtReturn = NonlinearImplicitStep( time_n, dt, cycleNumber, domain );
+  m_subcyclePhase = SubcyclePhase::None;
+
+  return dtReturn;
+}
+
+integer ProppantTransport::MarkSubcycledElements( real64 const dt, DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  R1Tensor downVector = gravityVector();
+  downVector.Normalize();
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
+
+  // the CFL number field first holds the volumetric outflux of the elements
+  forTargetSubRegions( mesh, [&]( localIndex const, ElementSubRegionBase & subRegion )
+  {
+    subRegion.getReference< array1d< real64 > >( viewKeyStruct::proppantCFLString ).setValues< parallelDevicePolicy<> >( 0.0 );
+  } );
+
+  ElementRegionManager::ElementViewAccessor< arrayView1d< real64 > > const outfluxAccessor =
+    mesh.getElemManager()->ConstructViewAccessor< array1d< real64 >, arrayView1d< real64 > >( viewKeyStruct::proppantCFLString );
+
+  FluxKernel::ElementView< arrayView1d< real64 > > const outflux = outfluxAccessor.toNestedView();
+
+  fluxApprox.forAllStencils( mesh, [&]( auto const & stencil )
+  {
+    FluxKernel::LaunchOutfluxCalculation( stencil,
+                                          m_transTMultiplier.toNestedViewConst(),
+                                          downVector,
+                                          m_pressure.toNestedViewConst(),
+                                          m_deltaPressure.toNestedViewConst(),
+                                          m_gravCoef.toNestedViewConst(),
+                                          m_density.toNestedViewConst(),
+                                          m_viscosity.toNestedViewConst(),
+                                          m_elementAperture.toNestedViewConst(),
+                                          outflux );
+  } );
+
+  real64 const subcycleCFL = m_subcycleCFL;
+  real64 localMaxCFL = 0.0;
+  localIndex localNumSubcycled = 0;
+
+  forTargetSubRegions( mesh, [&]( localIndex const, ElementSubRegionBase & subRegion )
+  {
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    arrayView1d< real64 const > const volume = subRegion.getElementVolume();
+    arrayView1d< real64 > const cfl = subRegion.getReference< array1d< real64 > >( viewKeyStruct::proppantCFLString );
+    arrayView1d< integer > const isSubcycled = subRegion.getReference< array1d< integer > >( viewKeyStruct::isSubcycledString );
+
+    RAJA::ReduceMax< parallelDeviceReduce, real64 > maxCFL( 0.0 );
+    RAJA::ReduceSum< parallelDeviceReduce, localIndex > numSubcycled( 0 );
+
+    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      cfl[ei] = volume[ei] > 0.0 ? cfl[ei] * dt / volume[ei] : 0.0;
+      isSubcycled[ei] = cfl[ei] > subcycleCFL;
+      if( ghostRank[ei] < 0 )
+      {
+        maxCFL.max( cfl[ei] );
+        numSubcycled += isSubcycled[ei];
+      }
+    } );
+
+    localMaxCFL = std::max( localMaxCFL, maxCFL.get() );
+    localNumSubcycled += numSubcycled.get();
+  } );
+
+  // the outflux of the ghosts misses the connections of the other ranks
+  std::map< string, string_array > fieldNames;
+  fieldNames["elems"].emplace_back( string( viewKeyStruct::proppantCFLString ) );
+  fieldNames["elems"].emplace_back( string( viewKeyStruct::isSubcycledString ) );
+  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain.getNeighbors(), true );
+
+  real64 const maxCFL = MpiWrapper::Max( localMaxCFL );
+  localIndex const numSubcycled = MpiWrapper::Sum( localNumSubcycled );
+
+  integer const numSubcycles = numSubcycled > 0
+                               ? std::min( m_maxNumSubcycles, LvArray::integerConversion< integer >( std::ceil( maxCFL / subcycleCFL ) ) )
+                               : 1;
+
+  GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": max CFL number " << maxCFL << ", " << numSubcycled
+                                       << " elements subcycled with " << numSubcycles << " substeps" );
+
+  return numSubcycles;
+}
+
+void ProppantTransport::BackupSubcycleState( MeshLevel & mesh, bool const restore )
+{
+  localIndex const NC = m_numComponents;
+
+  forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
+  {
+    arrayView1d< real64 > const proppantConc =
+      subRegion.getReference< array1d< real64 > >( viewKeyStruct::proppantConcentrationString );
+    arrayView1d< real64 > const dProppantConc =
+      subRegion.getReference< array1d< real64 > >( viewKeyStruct::deltaProppantConcentrationString );
+    arrayView2d< real64 > const componentConc =
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::componentConcentrationString );
+    arrayView2d< real64 > const dComponentConc =
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::deltaComponentConcentrationString );
+    arrayView2d< real64 > const componentDensOld =
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::oldComponentDensityString );
+
+    arrayView1d< real64 > const startProppantConc =
+      subRegion.getReference< array1d< real64 > >( viewKeyStruct::stepStartProppantConcentrationString );
+    arrayView2d< real64 > const startComponentConc =
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::stepStartComponentConcentrationString );
+    arrayView2d< real64 > const startComponentDens =
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::stepStartComponentDensityString );
+
+    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      if( restore )
+      {
+        proppantConc[ei] = startProppantConc[ei];
+        dProppantConc[ei] = 0.0;
+        for( localIndex c = 0; c < NC; ++c )
+        {
+          componentConc[ei][c] = startComponentConc[ei][c];
+          dComponentConc[ei][c] = 0.0;
+          componentDensOld[ei][c] = startComponentDens[ei][c];
+        }
+      }
+      else
+      {
+        startProppantConc[ei] = proppantConc[ei];
+        for( localIndex c = 0; c < NC; ++c )
+        {
+          startComponentConc[ei][c] = componentConc[ei][c];
+          startComponentDens[ei][c] = componentDensOld[ei][c];
+        }
+      }
+    } );
+
+    if( restore )
+    {
+      UpdateState( subRegion, targetIndex );
+    }
+  } );
+}
+
+void ProppantTransport::CompleteSubstep( MeshLevel & mesh )
+{
+  localIndex const NC = m_numComponents;
+
+  forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
+  {
+    arrayView1d< integer const > const isSubcycled =
+      subRegion.getReference< array1d< integer > >( viewKeyStruct::isSubcycledString );
+    arrayView1d< real64 > const proppantConc =
+      subRegion.getReference< array1d< real64 > >( viewKeyStruct::proppantConcentrationString );
+    arrayView1d< real64 > const dProppantConc =
+      subRegion.getReference< array1d< real64 > >( viewKeyStruct::deltaProppantConcentrationString );
+    arrayView2d< real64 > const componentConc =
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::componentConcentrationString );
+    arrayView2d< real64 > const dComponentConc =
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::deltaComponentConcentrationString );
+    arrayView2d< real64 > const componentDensOld =
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::oldComponentDensityString );
+
+    SlurryFluidBase const & fluid = GetConstitutiveModel< SlurryFluidBase >( subRegion, targetIndex );
+    arrayView3d< real64 const > const componentDens = fluid.componentDensity();
+
+    // the next substep starts from the end of this one, the frozen elements keep the state of the step start
+    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      if( isSubcycled[ei] )
+      {
+        proppantConc[ei] += dProppantConc[ei];
+        dProppantConc[ei] = 0.0;
+        for( localIndex c = 0; c < NC; ++c )
+        {
+          componentConc[ei][c] += dComponentConc[ei][c];
+          dComponentConc[ei][c] = 0.0;
+          componentDensOld[ei][c] = componentDens[ei][0][c];
+        }
+      }
+    } );
+  } );
+}
+
+void ProppantTransport::AccumulateInterfaceFluxes( real64 const time_n, real64 const dt, DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  // the fluxes are evaluated with the converged state of the substep, the system is left untouched
+  m_subcyclePhase = SubcyclePhase::Interface;
+  AssembleFluxTerms( time_n,
+                     dt,
+                     domain,
+                     m_dofManager,
+                     m_localMatrix.toViewConstSizes(),
+                     m_localRhs.toView() );
+  m_subcyclePhase = SubcyclePhase::Fast;
+}
+
+void ProppantTransport::AssembleInterfaceFluxes( DomainPartition const & domain,
+                                                 DofManager const & dofManager,
+                                                 arrayView1d< real64 > const & localRhs ) const
+{
+  MeshLevel const & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
+  string const dofKey = dofManager.getKey( viewKeyStruct::proppantConcentrationString );
+  globalIndex const rankOffset = dofManager.rankOffset();
+  localIndex const NDOF = m_numDofPerCell;
+
+  forTargetSubRegions( mesh, [&]( localIndex const, ElementSubRegionBase const & subRegion )
+  {
+    arrayView1d< globalIndex const > const dofNumber = subRegion.getReference< array1d< globalIndex > >( dofKey );
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    arrayView2d< real64 const > const interfaceFlux =
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::interfaceFluxString );
+
+    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      if( ghostRank[ei] < 0 )
+      {
+        localIndex const localRow = LvArray::integerConversion< localIndex >( dofNumber[ei] - rankOffset );
+        for( localIndex idof = 0; idof < NDOF; ++idof )
+        {
+          localRhs[localRow + idof] += interfaceFlux[ei][idof];
+        }
+      }
+    } );
+  } );
+}
+
+void ProppantTransport::FreezeInactiveElements( DomainPartition const & domain,
+                                                DofManager const & dofManager,
+                                                CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                arrayView1d< real64 > const & localRhs ) const
+{
+  MeshLevel const & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
+  string const dofKey = dofManager.getKey( viewKeyStruct::proppantConcentrationString );
+  globalIndex const rankOffset = dofManager.rankOffset();
+  localIndex const NDOF = m_numDofPerCell;
+  integer const frozen = m_subcyclePhase == SubcyclePhase::Slow ? 1 : 0;
+
+  forTargetSubRegions( mesh, [&]( localIndex const, ElementSubRegionBase const & subRegion )
+  {
+    arrayView1d< globalIndex const > const dofNumber = subRegion.getReference< array1d< globalIndex > >( dofKey );
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    arrayView1d< integer const > const isSubcycled = subRegion.getReference< array1d< integer > >( viewKeyStruct::isSubcycledString );
+
+    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      if( ghostRank[ei] < 0 && isSubcycled[ei] == frozen )
+      {
+        // keep the diagonal only, with a zero residual the element does not change
+        localIndex const localRow = LvArray::integerConversion< localIndex >( dofNumber[ei] - rankOffset );
+        for( localIndex idof = 0; idof < NDOF; ++idof )
+        {
+          FieldSpecificationEqual::SpecifyFieldValue( dofNumber[ei] + idof,
+                                                      rankOffset,
+                                                      localMatrix,
+                                                      localRhs[localRow + idof],
+                                                      0.0,
+                                                      0.0 );
+        }
+      }
+    } );
+  } );
+}
+
 REGISTER_CATALOG_ENTRY( SolverBase, ProppantTransport, std::string const &, Group * const )
 } /* namespace geosx */
@@ -20,6 +20,7 @@
 #define SRC_COMPONENTS_CORE_SRC_PHYSICSSOLVERS_PROPPANTTRANSPORT_HPP_
 
 #include <constitutive/fluid/ParticleFluidBase.hpp>
+#include "mesh/CachedElementViewAccessor.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBase.hpp"
 #include "constitutive/fluid/SlurryFluidBase.hpp"
 
@@ -42,6 +43,15 @@ class DomainPartition;
 class ProppantTransport : public FlowSolverBase
 {
 public:
+
+  /// The part of a subcycled step being assembled, see SubcycledImplicitStep
+  enum class SubcyclePhase : integer
+  {
+    None,      ///< The step is not subcycled, all the elements are assembled
+    Fast,      ///< A substep of the subcycled elements
+    Interface, ///< The accumulation of the fluxes from the subcycled elements to the others
+    Slow       ///< The final step of the elements that are not subcycled
+  };
   /**
    * @brief main constructor for Group Objects
    * @param name the name of this instantiation of Group in the repository
@@ -97,6 +107,25 @@ public:
                        real64 const & dt,
                        DomainPartition & domain );
 
+  /**
+   * @brief Advance the proppant over a time step, subcycling the elements of high CFL number.
+   * @param time_n the time at the beginning of the step
+   * @param dt the time step
+   * @param cycleNumber the cycle number
+   * @param domain the domain
+   * @return the time step achieved
+   *
+   * The elements whose CFL number exceeds subcycleCFL take several implicit substeps while the others are frozen.
+   * The fluxes the substeps exchange with the frozen elements are accumulated and imposed to them in a final step
+   * over the whole time step, so that the proppant and components are conserved across the interface. Falls back
+   * to NonlinearImplicitStep if the subcycling is disabled or not needed. To be called once the pressure of the
+   * step is known, after PreStepUpdate.
+   */
+  real64 SubcycledImplicitStep( real64 const & time_n,
+                                real64 const & dt,
+                                integer const cycleNumber,
+                                DomainPartition & domain );
+
   /**
    * @defgroup Solver Interface Functions
    *
@@ -129,10 +158,14 @@ public:
                            CRSMatrixView< real64, globalIndex const > const & localMatrix,
                            arrayView1d< real64 > const & localRhs ) override;
 
+  virtual void
+  CalculateLocalResidualNorms( DomainPartition const & domain,
+                               DofManager const & dofManager,
+                               arrayView1d< real64 const > const & localRhs,
+                               ResidualNormParts & parts ) override;
+
   virtual real64
-  CalculateResidualNorm( DomainPartition const & domain,
-                         DofManager const & dofManager,
-                         arrayView1d< real64 const > const & localRhs ) override;
+  CombineResidualNorms( ResidualNormParts & parts ) override;
 
   virtual void
   SolveSystem( DofManager const & dofManager,
@@ -226,6 +259,17 @@ public:
     static constexpr auto criticalShieldsNumberString  = "criticalShieldsNumber";
     static constexpr auto frictionCoefficientString  = "frictionCoefficient";
 
+    static constexpr auto subcycleCFLString  = "subcycleCFL";
+    static constexpr auto maxNumSubcyclesString  = "maxNumSubcycles";
+
+    // subcycling of the elements of high CFL number
+    static constexpr auto proppantCFLString  = "proppantCFL";
+    static constexpr auto isSubcycledString  = "isSubcycled";
+    static constexpr auto interfaceFluxString  = "interfaceFlux";
+    static constexpr auto stepStartProppantConcentrationString  = "stepStartProppantConcentration";
+    static constexpr auto stepStartComponentConcentrationString  = "stepStartComponentConcentration";
+    static constexpr auto stepStartComponentDensityString  = "stepStartComponentDensity";
+
   } viewKeysProppantTransport;
 
   viewKeyStruct & viewKeys() { return viewKeysProppantTransport; }
@@ -260,15 +304,12 @@ private:
   void ResetViews( MeshLevel & mesh ) override;
 
   /**
-   * @brief Function to update fluid properties
-   * @param domain the domain
+   * @brief Function to update the component densities of the fluid
+   * @param dataGroup the element subregion
+   * @param targetIndex the index of the subregion in the target regions
    */
-  void UpdateFluidModel( Group & dataGroup, localIndex const targetIndex );
-
   void UpdateComponentDensity( Group & dataGroup, localIndex const targetIndex );
 
-  void UpdateProppantModel( Group & dataGroup, localIndex const targetIndex );
-
   /**
    * @brief Function to update cell-based fluid flux
    */
@@ -276,11 +317,63 @@ private:
                             DomainPartition & domain );
 
   /**
-   * @brief Function to update fluid and proppant properties
-   * @param domain the domain
+   * @brief Function to update fluid and proppant properties, in a single pass over the elements
+   * @param dataGroup the element subregion
+   * @param targetIndex the index of the subregion in the target regions
    */
   void UpdateState( Group & dataGroup, localIndex const targetIndex );
 
+  /**
+   * @brief Compute the CFL number of the elements and flag those to subcycle
+   * @param dt the time step
+   * @param domain the domain
+   * @return the number of substeps of the flagged elements, 1 if none is flagged
+   */
+  integer MarkSubcycledElements( real64 const dt, DomainPartition & domain );
+
+  /**
+   * @brief Save or restore the state of the elements at the beginning of a subcycled step
+   * @param mesh the mesh
+   * @param restore if true restore the state, save it otherwise
+   */
+  void BackupSubcycleState( MeshLevel & mesh, bool const restore );
+
+  /**
+   * @brief Commit the state of the subcycled elements at the end of a substep
+   * @param mesh the mesh
+   */
+  void CompleteSubstep( MeshLevel & mesh );
+
+  /**
+   * @brief Add the fluxes of a converged substep from the subcycled elements to the others to the interface fluxes
+   * @param time_n the time at the beginning of the substep
+   * @param dt the substep
+   * @param domain the domain
+   */
+  void AccumulateInterfaceFluxes( real64 const time_n, real64 const dt, DomainPartition & domain );
+
+  /**
+   * @brief Add the accumulated interface fluxes to the residual of the elements that are not subcycled
+   * @param domain the domain
+   * @param dofManager the dof manager
+   * @param localRhs the local residual
+   */
+  void AssembleInterfaceFluxes( DomainPartition const & domain,
+                                DofManager const & dofManager,
+                                arrayView1d< real64 > const & localRhs ) const;
+
+  /**
+   * @brief Freeze the equations of the elements that are not solved in the current phase of a subcycled step
+   * @param domain the domain
+   * @param dofManager the dof manager
+   * @param localMatrix the local matrix
+   * @param localRhs the local residual
+   */
+  void FreezeInactiveElements( DomainPartition const & domain,
+                               DofManager const & dofManager,
+                               CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                               arrayView1d< real64 > const & localRhs ) const;
+
   /// views into primary variable fields
 
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > m_pressure;
@@ -292,8 +385,13 @@ private:
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > m_proppantPackVolumeFraction;
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > m_proppantExcessPackVolume;
   ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > m_isProppantBoundaryElement;
+
+  /// Accessor to the degrees of freedom of the elements, rebuilt only when the mesh changes
+  CachedElementViewAccessor< array1d< globalIndex >, arrayView1d< globalIndex const > > m_dofNumber;
   ElementRegionManager::ElementViewAccessor< arrayView1d< R1Tensor const > > m_transTMultiplier;
   ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > m_isProppantMobile;
+  ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > m_isSubcycled;
+  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 > > m_interfaceFlux;
 
   /// views into material fields
 
@@ -338,6 +436,18 @@ private:
   real64 m_proppantDensity;
   real64 m_criticalShieldsNumber;
   real64 m_frictionCoefficient;
+
+  /// CFL number above which the elements are subcycled, the subcycling is disabled if not positive
+  real64 m_subcycleCFL;
+
+  /// maximum number of substeps of the subcycled elements
+  integer m_maxNumSubcycles;
+
+  /// part of the subcycled step being assembled
+  SubcyclePhase m_subcyclePhase;
+
+  /// whether the state at the beginning of the step has been saved for the subcycling
+  bool m_subcycleStateSaved;
 };
 
 
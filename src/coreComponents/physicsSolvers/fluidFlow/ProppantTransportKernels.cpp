@@ -815,6 +815,9 @@ void FluxKernel::
                                     ElementViewConst< arrayView1d< integer const > > const & GEOSX_UNUSED_PARAM( isProppantMobile ),
                                     ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( proppantPackVf ),
                                     ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( aperture ),
+                                    ProppantTransport::SubcyclePhase const GEOSX_UNUSED_PARAM( subcyclePhase ),
+                                    ElementViewConst< arrayView1d< integer const > > const & GEOSX_UNUSED_PARAM( isSubcycled ),
+                                    ElementView< arrayView2d< real64 > > const & GEOSX_UNUSED_PARAM( interfaceFlux ),
                                     CRSMatrixView< real64, globalIndex const > const & GEOSX_UNUSED_PARAM( localMatrix ),
                                     arrayView1d< real64 > const & GEOSX_UNUSED_PARAM( localRhs ) )
 {
@@ -860,6 +863,9 @@ void FluxKernel::
                                 ElementViewConst< arrayView1d< integer const > > const & isProppantMobile,
                                 ElementViewConst< arrayView1d< real64 const > > const & proppantPackVf,
                                 ElementViewConst< arrayView1d< real64 const > > const & aperture,
+                                ProppantTransport::SubcyclePhase const subcyclePhase,
+                                ElementViewConst< arrayView1d< integer const > > const & isSubcycled,
+                                ElementView< arrayView2d< real64 > > const & interfaceFlux,
                                 CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                 arrayView1d< real64 > const & localRhs )
 {
@@ -882,6 +888,23 @@ void FluxKernel::
 
     if( ( numFluxElems > 1 || updateProppantPacking != 0 ) ) //isGhostConnectors[iconn][0] < 0 )
     {
+      if( subcyclePhase != ProppantTransport::SubcyclePhase::None )
+      {
+        // the substeps only see the connections of the subcycled elements, the final step the others
+        localIndex numSubcycled = 0;
+        for( localIndex i = 0; i < numFluxElems; ++i )
+        {
+          numSubcycled += isSubcycled[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+        }
+        bool const isInterface = numSubcycled > 0 && numSubcycled < numFluxElems;
+        if( ( subcyclePhase == ProppantTransport::SubcyclePhase::Fast && numSubcycled == 0 ) ||
+            ( subcyclePhase == ProppantTransport::SubcyclePhase::Interface && !isInterface ) ||
+            ( subcyclePhase == ProppantTransport::SubcyclePhase::Slow && numSubcycled > 0 ) )
+        {
+          return;
+        }
+      }
+
       localIndex const stencilSize  = numFluxElems;
       localIndex const DOF = numFluxElems * numDofPerCell;
 
@@ -933,6 +956,25 @@ void FluxKernel::
                        localFlux,
                        localFluxJacobian );
 
+      if( subcyclePhase == ProppantTransport::SubcyclePhase::Interface )
+      {
+        // record what the substep exchanged with the elements that are not subcycled
+        for( localIndex i = 0; i < numFluxElems; ++i )
+        {
+          localIndex const eri = seri( iconn, i );
+          localIndex const esri = sesri( iconn, i );
+          localIndex const ei = sei( iconn, i );
+          if( ghostRank[eri][esri][ei] < 0 && isSubcycled[eri][esri][ei] == 0 )
+          {
+            for( localIndex idof = 0; idof < numDofPerCell; ++idof )
+            {
+              RAJA::atomicAdd( parallelDeviceAtomic{}, &interfaceFlux[eri][esri][ei][idof], localFlux[i * numDofPerCell + idof] );
+            }
+          }
+        }
+        return;
+      }
+
       for( localIndex i = 0; i < stencilSize; ++i )
       {
         for( localIndex j = 0; j < numDofPerCell; ++j )
@@ -1130,6 +1172,146 @@ void FluxKernel::
   } );
 }
 
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void
+FluxKernel::
+  ComputeOutflux( localIndex const numElems,
+                  arraySlice1d< localIndex const > const & stencilElementIndices,
+                  arraySlice1d< real64 const > const & stencilWeights,
+                  arraySlice1d< R1Tensor const > const & stencilCellCenterToEdgeCenters,
+                  arrayView1d< R1Tensor const > const & transMultiplier,
+                  R1Tensor const unitGravityVector,
+                  arrayView1d< real64 const > const & pres,
+                  arrayView1d< real64 const > const & dPres,
+                  arrayView1d< real64 const > const & gravDepth,
+                  arrayView2d< real64 const > const & dens,
+                  arrayView2d< real64 const > const & visc,
+                  arrayView1d< real64 const > const & aperture,
+                  arrayView1d< real64 > const & outflux )
+{
+  real64 constexpr TINY = 1e-10;
+
+  localIndex constexpr maxNumFluxElems = FaceElementStencil::NUM_POINT_IN_FLUX;
+
+  stackArray1d< real64, maxNumFluxElems > weight( numElems );
+  stackArray1d< real64, maxNumFluxElems > transT( numElems );
+
+  real64 sumOfWeights = 0;
+
+  for( localIndex i = 0; i < numElems; ++i )
+  {
+    localIndex const ei = stencilElementIndices[i];
+
+    sumOfWeights += stencilWeights[i];
+    weight[i] = stencilWeights[i];
+
+    transT[i] = aperture[ei] * aperture[ei] * aperture[ei] * stencilWeights[i];
+
+    real64 const edgeLength = 12.0 * stencilWeights[i] * stencilCellCenterToEdgeCenters[i].L2_Norm();
+    real64 const stencilEdgeToFaceDownDistance =
+      -Dot( stencilCellCenterToEdgeCenters[i], unitGravityVector ) * edgeLength / stencilCellCenterToEdgeCenters[i].L2_Norm();
+
+    transT[i] *= fabs( stencilEdgeToFaceDownDistance ) > TINY ? transMultiplier[ei][1] : transMultiplier[ei][0];
+  }
+
+  real64 edgeDensity = 0.0;
+  real64 edgeViscosity = 0.0;
+
+  for( localIndex i = 0; i < numElems; ++i )
+  {
+    localIndex const ei = stencilElementIndices[i];
+    weight[i] /= sumOfWeights;
+    edgeDensity += weight[i] * dens[ei][0];
+    edgeViscosity += weight[i] * visc[ei][0];
+  }
+
+  real64 transTSum = 0.0;
+  real64 Pe = 0.0;
+
+  for( localIndex i = 0; i < numElems; ++i )
+  {
+    localIndex const ei = stencilElementIndices[i];
+    Pe += transT[i] * ( pres[ei] + dPres[ei] - edgeDensity * gravDepth[ei] );
+    transTSum += transT[i];
+  }
+
+  Pe /= transTSum;
+
+  for( localIndex i = 0; i < numElems; ++i )
+  {
+    localIndex const ei = stencilElementIndices[i];
+
+    // a negative edge to face flux leaves the element
+    real64 const edgeToFaceFlux = transT[i] * ( Pe - ( pres[ei] + dPres[ei] - edgeDensity * gravDepth[ei] ) ) / edgeViscosity;
+    if( edgeToFaceFlux < 0.0 )
+    {
+      RAJA::atomicAdd( parallelDeviceAtomic{}, &outflux[ei], -edgeToFaceFlux );
+    }
+  }
+}
+
+template<>
+void FluxKernel::
+  LaunchOutfluxCalculation< CellElementStencilTPFA >( CellElementStencilTPFA const & GEOSX_UNUSED_PARAM( stencil ),
+                                                      ElementViewConst< arrayView1d< R1Tensor const > > const & GEOSX_UNUSED_PARAM( transTMultiplier ),
+                                                      R1Tensor const GEOSX_UNUSED_PARAM( unitGravityVector ),
+                                                      ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( pres ),
+                                                      ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( dPres ),
+                                                      ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( gravDepth ),
+                                                      ElementViewConst< arrayView2d< real64 const > > const & GEOSX_UNUSED_PARAM( dens ),
+                                                      ElementViewConst< arrayView2d< real64 const > > const & GEOSX_UNUSED_PARAM( visc ),
+                                                      ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( aperture ),
+                                                      ElementView< arrayView1d< real64 > > const & GEOSX_UNUSED_PARAM( outflux ) )
+{}
+
+template<>
+void FluxKernel::
+  LaunchOutfluxCalculation< FaceElementStencil >( FaceElementStencil const & stencil,
+                                                  ElementViewConst< arrayView1d< R1Tensor const > > const & transTMultiplier,
+                                                  R1Tensor const unitGravityVector,
+                                                  ElementViewConst< arrayView1d< real64 const > > const & pres,
+                                                  ElementViewConst< arrayView1d< real64 const > > const & dPres,
+                                                  ElementViewConst< arrayView1d< real64 const > > const & gravDepth,
+                                                  ElementViewConst< arrayView2d< real64 const > > const & dens,
+                                                  ElementViewConst< arrayView2d< real64 const > > const & visc,
+                                                  ElementViewConst< arrayView1d< real64 const > > const & aperture,
+                                                  ElementView< arrayView1d< real64 > > const & outflux )
+{
+  typename FaceElementStencil::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
+  typename FaceElementStencil::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
+  typename FaceElementStencil::IndexContainerViewConstType const & sei = stencil.getElementIndices();
+  typename FaceElementStencil::WeightContainerViewConstType const & weights = stencil.getWeights();
+
+  ArrayOfArraysView< R1Tensor const > const & cellCenterToEdgeCenters = stencil.getCellCenterToEdgeCenters();
+
+  forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+  {
+    localIndex const numFluxElems = seri.sizeOfArray( iconn );
+    if( numFluxElems < 2 )
+    {
+      return;
+    }
+
+    localIndex const er = seri[iconn][0];
+    localIndex const esr = sesri[iconn][0];
+
+    ComputeOutflux( numFluxElems,
+                    sei[iconn],
+                    weights[iconn],
+                    cellCenterToEdgeCenters[iconn],
+                    transTMultiplier[er][esr],
+                    unitGravityVector,
+                    pres[er][esr],
+                    dPres[er][esr],
+                    gravDepth[er][esr],
+                    dens[er][esr],
+                    visc[er][esr],
+                    aperture[er][esr],
+                    outflux[er][esr] );
+  } );
+}
+
 
 template<>
 void ProppantPackVolumeKernel::
@@ -30,16 +30,31 @@ namespace geosx
 namespace ProppantTransportKernels
 {
 
-/******************************** FluidUpdateKernel ********************************/
+/******************************** StateUpdateKernel ********************************/
 
-struct FluidUpdateKernel
+/**
+ * @brief Update the fluid and proppant properties of the elements in a single pass.
+ *
+ * The proppant model reads the fluid density and viscosity that the fluid model has just computed
+ * for the same element, so both updates are done by the same thread without a launch in between.
+ */
+struct StateUpdateKernel
 {
-  template< typename FLUID_WRAPPER >
+  template< typename FLUID_WRAPPER, typename PROPPANT_WRAPPER >
   static void Launch( FLUID_WRAPPER const & fluidWrapper,
+                      PROPPANT_WRAPPER const & proppantWrapper,
                       arrayView1d< real64 const > const & pres,
                       arrayView1d< real64 const > const & dPres,
                       arrayView2d< real64 const > const & componentConcentration,
-                      arrayView2d< real64 const > const & dComponentConcentration )
+                      arrayView2d< real64 const > const & dComponentConcentration,
+                      arrayView1d< real64 const > const & proppantConc,
+                      arrayView1d< real64 const > const & dProppantConc,
+                      arrayView2d< real64 const > const & fluidDens,
+                      arrayView2d< real64 const > const & dFluidDens_dPres,
+                      arrayView3d< real64 const > const & dFluidDens_dCompConc,
+                      arrayView2d< real64 const > const & fluidVisc,
+                      arrayView2d< real64 const > const & dFluidVisc_dPres,
+                      arrayView3d< real64 const > const & dFluidVisc_dCompConc )
   {
     forAll< parallelDevicePolicy<> >( fluidWrapper.numElems(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
     {
@@ -58,6 +73,15 @@ struct FluidUpdateKernel
                                           compConc,
                                           0.0 );
       }
+
+      proppantWrapper.Update( a,
+                              proppantConc[a] + dProppantConc[a],
+                              fluidDens[a][0],
+                              dFluidDens_dPres[a][0],
+                              dFluidDens_dCompConc[a][0],
+                              fluidVisc[a][0],
+                              dFluidVisc_dPres[a][0],
+                              dFluidVisc_dCompConc[a][0] );
     } );
   }
 };
@@ -93,35 +117,6 @@ struct ComponentDensityUpdateKernel
   }
 };
 
-/******************************** ProppantUpdateKernel ********************************/
-
-struct ProppantUpdateKernel
-{
-  template< typename PROPPANT_WRAPPER >
-  static void Launch( PROPPANT_WRAPPER const & proppantWrapper,
-                      arrayView1d< real64 const > const & proppantConc,
-                      arrayView1d< real64 const > const & dProppantConc,
-                      arrayView2d< real64 const > const & fluidDens,
-                      arrayView2d< real64 const > const & dFluidDens_dPres,
-                      arrayView3d< real64 const > const & dFluidDens_dCompConc,
-                      arrayView2d< real64 const > const & fluidVisc,
-                      arrayView2d< real64 const > const & dFluidVisc_dPres,
-                      arrayView3d< real64 const > const & dFluidVisc_dCompConc )
-  {
-    forAll< parallelDevicePolicy<> >( proppantWrapper.numElems(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
-    {
-      proppantWrapper.Update( a,
-                              proppantConc[a] + dProppantConc[a],
-                              fluidDens[a][0],
-                              dFluidDens_dPres[a][0],
-                              dFluidDens_dCompConc[a][0],
-                              fluidVisc[a][0],
-                              dFluidVisc_dPres[a][0],
-                              dFluidVisc_dCompConc[a][0] );
-    } );
-  }
-};
-
 /******************************** AccumulationKernel ********************************/
 
 struct AccumulationKernel
@@ -224,6 +219,9 @@ struct FluxKernel
           ElementViewConst< arrayView1d< integer const > > const & isProppantMobile,
           ElementViewConst< arrayView1d< real64 const > > const & proppantPackVf,
           ElementViewConst< arrayView1d< real64 const > > const & aperture,
+          ProppantTransport::SubcyclePhase const subcyclePhase,
+          ElementViewConst< arrayView1d< integer const > > const & isSubcycled,
+          ElementView< arrayView2d< real64 > > const & interfaceFlux,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs );
 
@@ -241,6 +239,23 @@ struct FluxKernel
                                   ElementViewConst< arrayView1d< real64 const > > const & proppantPackVf,
                                   ElementView< arrayView1d< R1Tensor > > const & cellBasedFlux );
 
+  /**
+   * @brief launches the kernel to compute the volumetric slurry outflux of the elements, used for their CFL number.
+   * @tparam STENCIL_TYPE The type of the stencil that is being used.
+   */
+  template< typename STENCIL_TYPE >
+  static void
+  LaunchOutfluxCalculation( STENCIL_TYPE const & stencil,
+                            ElementViewConst< arrayView1d< R1Tensor const > > const & transTMultiplier,
+                            R1Tensor const unitGravityVector,
+                            ElementViewConst< arrayView1d< real64 const > > const & pres,
+                            ElementViewConst< arrayView1d< real64 const > > const & dPres,
+                            ElementViewConst< arrayView1d< real64 const > > const & gravDepth,
+                            ElementViewConst< arrayView2d< real64 const > > const & dens,
+                            ElementViewConst< arrayView2d< real64 const > > const & visc,
+                            ElementViewConst< arrayView1d< real64 const > > const & aperture,
+                            ElementView< arrayView1d< real64 > > const & outflux );
+
   /**
    * @brief Compute flux and its derivatives for a given multi-element connector.
    *
@@ -305,6 +320,23 @@ struct FluxKernel
                         arrayView1d< real64 const > const & aperture,
                         arrayView1d< real64 const > const & GEOSX_UNUSED_PARAM( proppantPackVf ),
                         arrayView1d< R1Tensor > const & cellBasedFlux );
+
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  static void
+  ComputeOutflux( localIndex const numElems,
+                  arraySlice1d< localIndex const > const & stencilElementIndices,
+                  arraySlice1d< real64 const > const & stencilWeights,
+                  arraySlice1d< R1Tensor const > const & stencilCellCenterToEdgeCenters,
+                  arrayView1d< R1Tensor const > const & transMultiplier,
+                  R1Tensor const unitGravityVector,
+                  arrayView1d< real64 const > const & pres,
+                  arrayView1d< real64 const > const & dPres,
+                  arrayView1d< real64 const > const & gravDepth,
+                  arrayView2d< real64 const > const & dens,
+                  arrayView2d< real64 const > const & visc,
+                  arrayView1d< real64 const > const & aperture,
+                  arrayView1d< real64 > const & outflux );
 };
 
 struct ProppantPackVolumeKernel
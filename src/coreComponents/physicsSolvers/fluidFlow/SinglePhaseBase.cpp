@@ -23,6 +23,7 @@
 #include "common/TimingMacros.hpp"
 #include "constitutive/fluid/SingleFluidBase.hpp"
 #include "constitutive/fluid/singleFluidSelector.hpp"
+#include "constitutive/solid/LinearElasticIsotropic.hpp"
 #include "finiteVolume/FiniteVolumeManager.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/FieldSpecification/FieldSpecificationManager.hpp"
@@ -195,13 +196,14 @@ void SinglePhaseBase::UpdateMobility( Group & dataGroup, localIndex const target
   ConstitutiveBase & fluid = GetConstitutiveModel( dataGroup, m_fluidModelNames[targetIndex] );
   FluidPropViews fluidProps = getFluidProperties( fluid );
 
-  SinglePhaseBaseKernels::MobilityKernel::Launch< parallelDevicePolicy<> >( dataGroup.size(),
-                                                                            fluidProps.dens,
-                                                                            fluidProps.dDens_dPres,
-                                                                            fluidProps.visc,
-                                                                            fluidProps.dVisc_dPres,
-                                                                            mob,
-                                                                            dMob_dPres );
+  // the state update runs back to back on the stream, the host does not wait for it
+  SinglePhaseBaseKernels::MobilityKernel::Launch< parallelDeviceAsyncPolicy<> >( dataGroup.size(),
+                                                                                 fluidProps.dens,
+                                                                                 fluidProps.dDens_dPres,
+                                                                                 fluidProps.visc,
+                                                                                 fluidProps.dVisc_dPres,
+                                                                                 mob,
+                                                                                 dMob_dPres );
 }
 
 void SinglePhaseBase::UpdateState( Group & dataGroup, localIndex const targetIndex ) const
@@ -225,7 +227,7 @@ void SinglePhaseBase::InitializePostInitialConditions_PreSubGroups( Group * cons
   std::map< string, string_array > fieldNames;
   fieldNames["elems"].emplace_back( string( viewKeyStruct::pressureString ) );
 
-  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain->getNeighbors() );
+  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain->getNeighbors(), true );
 
   ResetViews( mesh );
 
@@ -371,22 +373,35 @@ void SinglePhaseBase::ImplicitStepComplete( real64 const & GEOSX_UNUSED_PARAM( t
 
   MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
 
+  real64 localMaxDeltaPres = 0.0;
+
   forTargetSubRegions( mesh, [&]( localIndex const,
                                   ElementSubRegionBase & subRegion )
   {
+    arrayView1d< integer const > const elemGhostRank = subRegion.ghostRank();
     arrayView1d< real64 const > const dPres = subRegion.getReference< array1d< real64 > >( viewKeyStruct::deltaPressureString );
     arrayView1d< real64 const > const dVol = subRegion.getReference< array1d< real64 > >( viewKeyStruct::deltaVolumeString );
 
     arrayView1d< real64 > const pres = subRegion.getReference< array1d< real64 > >( viewKeyStruct::pressureString );
     arrayView1d< real64 > const vol = subRegion.getReference< array1d< real64 > >( CellBlock::viewKeyStruct::elementVolumeString );
 
+    RAJA::ReduceMax< parallelDeviceReduce, real64 > maxDeltaPres( 0.0 );
+
     forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
     {
       pres[ei] += dPres[ei];
       vol[ei] += dVol[ei];
+      if( elemGhostRank[ei] < 0 )
+      {
+        maxDeltaPres.max( LvArray::math::abs( dPres[ei] ) );
+      }
     } );
+
+    localMaxDeltaPres = std::max( localMaxDeltaPres, maxDeltaPres.get() );
   } );
 
+  SetStepChange( localMaxDeltaPres / m_targetPressureChange );
+
   forTargetSubRegions< FaceElementSubRegion >( mesh, [&]( localIndex const,
                                                           FaceElementSubRegion & subRegion )
   {
@@ -487,8 +502,8 @@ void SinglePhaseBase::AccumulationLaunch( localIndex const targetIndex,
     solid.getReference< array2d< real64 > >( ConstitutiveBase::viewKeyStruct::poreVolumeMultiplierString );
   arrayView2d< real64 const > const dPvMult_dPres =
     solid.getReference< array2d< real64 > >( ConstitutiveBase::viewKeyStruct::dPVMult_dPresString );
-  arrayView1d< real64 const > const bulkModulus =
-    ISPORO ? solid.getReference< array1d< real64 > >( "BulkModulus" ) : porosityOld;
+  MaterialParameterView const bulkModulus =
+    ISPORO ? dynamicCast< LinearElasticIsotropic const & >( solid ).bulkModulusParameter() : MaterialParameterView( porosityOld );
   real64 const biotCoefficient = ISPORO ? solid.getReference< real64 >( "BiotCoefficient" ) : 0.0;
 
   using Kernel = AccumulationKernel< CellElementSubRegion >;
@@ -656,45 +671,13 @@ void SinglePhaseBase::ApplySourceFluxBC( real64 const time_n,
   FieldSpecificationManager & fsManager = FieldSpecificationManager::get();
   string const dofKey = dofManager.getKey( viewKeyStruct::pressureString );
 
-  fsManager.Apply( time_n + dt, &domain,
-                   "ElementRegions",
-                   FieldSpecificationBase::viewKeyStruct::fluxBoundaryConditionString,
-                   [&]( FieldSpecificationBase const * const fs,
-                        string const &,
-                        SortedArrayView< localIndex const > const & lset,
-                        Group * subRegion,
-                        string const & ) -> void
-  {
-    arrayView1d< globalIndex const > const
-    dofNumber = subRegion->getReference< array1d< globalIndex > >( dofKey );
-
-    arrayView1d< integer const > const
-    ghostRank = subRegion->getReference< array1d< integer > >( ObjectManagerBase::viewKeyStruct::ghostRankString );
-
-    SortedArray< localIndex > localSet;
-    for( localIndex const a : lset )
-    {
-      if( ghostRank[a] < 0 )
-      {
-        localSet.insert( a );
-      }
-    }
-
-    fs->ApplyBoundaryConditionToSystem< FieldSpecificationAdd,
-                                        parallelDevicePolicy<> >( localSet.toViewConst(),
-                                                                  time_n + dt,
-                                                                  dt,
-                                                                  subRegion,
-                                                                  dofNumber,
-                                                                  dofManager.rankOffset(),
-                                                                  localMatrix,
-                                                                  localRhs,
-                                                                  [] GEOSX_HOST_DEVICE ( localIndex const )
-    {
-      return 0.0;
-    } );
-
-  } );
+  fsManager.ApplySourceFluxToSystem( time_n + dt,
+                                     dt,
+                                     domain,
+                                     dofKey,
+                                     dofManager.rankOffset(),
+                                     localMatrix,
+                                     localRhs );
 }
 
 void SinglePhaseBase::SolveSystem( DofManager const & dofManager,
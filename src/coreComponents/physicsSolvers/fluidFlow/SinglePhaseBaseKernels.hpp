@@ -20,6 +20,7 @@
 #define GEOSX_PHYSICSSOLVERS_FLUIDFLOW_SINGLEPHASEBASEKERNELS_HPP
 
 #include "common/DataTypes.hpp"
+#include "constitutive/MaterialParameterView.hpp"
 #include "finiteVolume/FluxApproximationBase.hpp"
 #include "rajaInterface/GEOS_RAJA_Interface.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
@@ -251,7 +252,7 @@ struct AccumulationKernel< CellElementSubRegion >
                       arrayView2d< real64 const > const & dPVMult_dPres,
                       arrayView1d< real64 const > const & oldTotalMeanStress,
                       arrayView1d< real64 const > const & totalMeanStress,
-                      arrayView1d< real64 const > const & bulkModulus,
+                      constitutive::MaterialParameterView const & bulkModulus,
                       real64 const biotCoefficient,
                       CRSMatrixView< real64, globalIndex const > const & localMatrix,
                       arrayView1d< real64 > const & localRhs )
@@ -375,7 +376,8 @@ struct FluidUpdateKernel
                       arrayView1d< real64 const > const & pres,
                       arrayView1d< real64 const > const & dPres )
   {
-    forAll< parallelDevicePolicy<> >( fluidWrapper.numElems(), [=] GEOSX_HOST_DEVICE ( localIndex const k )
+    // the update is only read by the kernels that follow it on the stream, the host does not wait for it
+    forAll< parallelDeviceAsyncPolicy<> >( fluidWrapper.numElems(), [=] GEOSX_HOST_DEVICE ( localIndex const k )
     {
       for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
       {
@@ -389,6 +391,11 @@ struct FluidUpdateKernel
 
 struct ResidualNormKernel
 {
+  /**
+   * @brief Accumulate the norm of the residual of a subregion into reducers shared by the subregions.
+   *
+   * The reducers are only read once after the last subregion, which saves a device synchronization per subregion.
+   */
   template< typename POLICY, typename REDUCE_POLICY, typename LOCAL_VECTOR >
   static void Launch( LOCAL_VECTOR const localResidual,
                       globalIndex const rankOffset,
@@ -397,12 +404,10 @@ struct ResidualNormKernel
                       arrayView1d< real64 const > const & refPoro,
                       arrayView1d< real64 const > const & volume,
                       arrayView1d< real64 const > const & densOld,
-                      real64 * localResidualNorm )
+                      RAJA::ReduceSum< REDUCE_POLICY, real64 > const & localSum,
+                      RAJA::ReduceSum< REDUCE_POLICY, real64 > const & normSum,
+                      RAJA::ReduceSum< REDUCE_POLICY, localIndex > const & count )
   {
-    RAJA::ReduceSum< REDUCE_POLICY, real64 > localSum( 0.0 );
-    RAJA::ReduceSum< REDUCE_POLICY, real64 > normSum( 0.0 );
-    RAJA::ReduceSum< REDUCE_POLICY, localIndex > count( 0 );
-
     forAll< POLICY >( presDofNumber.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
     {
       if( ghostRank[a] < 0 )
@@ -414,6 +419,24 @@ struct ResidualNormKernel
         count += 1;
       }
     } );
+  }
+
+  template< typename POLICY, typename REDUCE_POLICY, typename LOCAL_VECTOR >
+  static void Launch( LOCAL_VECTOR const localResidual,
+                      globalIndex const rankOffset,
+                      arrayView1d< globalIndex const > const & presDofNumber,
+                      arrayView1d< integer const > const & ghostRank,
+                      arrayView1d< real64 const > const & refPoro,
+                      arrayView1d< real64 const > const & volume,
+                      arrayView1d< real64 const > const & densOld,
+                      real64 * localResidualNorm )
+  {
+    RAJA::ReduceSum< REDUCE_POLICY, real64 > localSum( 0.0 );
+    RAJA::ReduceSum< REDUCE_POLICY, real64 > normSum( 0.0 );
+    RAJA::ReduceSum< REDUCE_POLICY, localIndex > count( 0 );
+
+    Launch< POLICY >( localResidual, rankOffset, presDofNumber, ghostRank, refPoro, volume, densOld,
+                      localSum, normSum, count );
 
     localResidualNorm[0] += localSum.get();
     localResidualNorm[1] += normSum.get();
@@ -425,17 +448,21 @@ struct ResidualNormKernel
 
 struct SolutionCheckKernel
 {
+  /**
+   * @brief Check the updated pressure of a subregion into a reducer shared by the subregions.
+   *
+   * The reducer is only read once after the last subregion, which saves a device synchronization per subregion.
+   */
   template< typename POLICY, typename REDUCE_POLICY, typename LOCAL_VECTOR >
-  static localIndex Launch( LOCAL_VECTOR const localSolution,
-                            globalIndex const rankOffset,
-                            arrayView1d< globalIndex const > const & presDofNumber,
-                            arrayView1d< integer const > const & ghostRank,
-                            arrayView1d< real64 const > const & pres,
-                            arrayView1d< real64 const > const & dPres,
-                            real64 const scalingFactor )
+  static void Launch( LOCAL_VECTOR const localSolution,
+                      globalIndex const rankOffset,
+                      arrayView1d< globalIndex const > const & presDofNumber,
+                      arrayView1d< integer const > const & ghostRank,
+                      arrayView1d< real64 const > const & pres,
+                      arrayView1d< real64 const > const & dPres,
+                      real64 const scalingFactor,
+                      RAJA::ReduceMin< REDUCE_POLICY, localIndex > const & minVal )
   {
-    RAJA::ReduceMin< REDUCE_POLICY, localIndex > minVal( 1 );
-
     forAll< POLICY >( presDofNumber.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
     {
       if( ghostRank[ei] < 0 && presDofNumber[ei] >= 0 )
@@ -450,6 +477,21 @@ struct SolutionCheckKernel
       }
 
     } );
+  }
+
+  template< typename POLICY, typename REDUCE_POLICY, typename LOCAL_VECTOR >
+  static localIndex Launch( LOCAL_VECTOR const localSolution,
+                            globalIndex const rankOffset,
+                            arrayView1d< globalIndex const > const & presDofNumber,
+                            arrayView1d< integer const > const & ghostRank,
+                            arrayView1d< real64 const > const & pres,
+                            arrayView1d< real64 const > const & dPres,
+                            real64 const scalingFactor )
+  {
+    RAJA::ReduceMin< REDUCE_POLICY, localIndex > minVal( 1 );
+
+    Launch< POLICY >( localSolution, rankOffset, presDofNumber, ghostRank, pres, dPres, scalingFactor, minVal );
+
     return minVal.get();
   }
 
@@ -19,6 +19,7 @@
 #include "SinglePhaseFVM.hpp"
 
 #include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/DeterministicReduction.hpp"
 #include "common/TimingMacros.hpp"
 #include "constitutive/fluid/singleFluidSelector.hpp"
 #include "managers/NumericalMethodsManager.hpp"
@@ -40,12 +41,38 @@ using namespace constitutive;
 using namespace SinglePhaseBaseKernels;
 using namespace SinglePhaseFVMKernels;
 
+namespace
+{
+
+/// Only the flux entries of the TPFA connections are mapped
+template< typename STENCIL_TYPE >
+void buildFluxAssemblyMaps( STENCIL_TYPE const &,
+                            globalIndex const,
+                            FluxKernel::ElementViewConst< arrayView1d< globalIndex const > > const &,
+                            FluxKernel::ElementViewConst< arrayView1d< integer const > > const &,
+                            CRSMatrixView< real64, globalIndex const > const &,
+                            std::vector< AssemblyMap > & )
+{}
+
+void buildFluxAssemblyMaps( CellElementStencilTPFA const & stencil,
+                            globalIndex const rankOffset,
+                            FluxKernel::ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
+                            FluxKernel::ElementViewConst< arrayView1d< integer const > > const & ghostRank,
+                            CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                            std::vector< AssemblyMap > & assemblyMaps )
+{
+  FluxKernel::BuildAssemblyMaps( stencil, rankOffset, dofNumber, ghostRank, localMatrix, assemblyMaps );
+}
+
+}
+
 template< typename BASE >
 SinglePhaseFVM< BASE >::SinglePhaseFVM( const std::string & name,
                                         Group * const parent ):
   BASE( name, parent )
 {
   m_numDofPerCell = 1;
+  m_elemDofNumber.setName( this->getName() + "/accessors/dofNumber" );
 }
 
 
@@ -85,17 +112,59 @@ void SinglePhaseFVM< BASE >::SetupSystem( DomainPartition & domain,
 }
 
 template< typename BASE >
-real64 SinglePhaseFVM< BASE >::CalculateResidualNorm( DomainPartition const & domain,
-                                                      DofManager const & dofManager,
-                                                      arrayView1d< real64 const > const & localRhs )
+void SinglePhaseFVM< BASE >::CalculateLocalResidualNorms( DomainPartition const & domain,
+                                                          DofManager const & dofManager,
+                                                          arrayView1d< real64 const > const & localRhs,
+                                                          ResidualNormParts & parts )
 {
   MeshLevel const & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
 
   string const dofKey = dofManager.getKey( viewKeyStruct::pressureString );
   globalIndex const rankOffset = dofManager.rankOffset();
 
-  // compute the norm of local residual scaled by cell pore volume
-  real64 localResidualNorm[3] = { 0.0, 0.0, 0.0 };
+  if( DeterministicReduction::isEnabled() )
+  {
+    // fixed-order sums of each subregion, added in the order of the subregions
+    DeterministicReduction::CompensatedSum localSum;
+    DeterministicReduction::CompensatedSum normSum;
+    localIndex count = 0;
+    forTargetSubRegions( mesh, [&]( localIndex const,
+                                    ElementSubRegionBase const & subRegion )
+    {
+      arrayView1d< globalIndex const > const & dofNumber = subRegion.getReference< array1d< globalIndex > >( dofKey );
+      arrayView1d< integer const > const & elemGhostRank = subRegion.ghostRank();
+      arrayView1d< real64 const > const & refPoro        = subRegion.getReference< array1d< real64 > >( viewKeyStruct::referencePorosityString );
+      arrayView1d< real64 const > const & volume         = subRegion.getElementVolume();
+      arrayView1d< real64 const > const & densOld        = subRegion.getReference< array1d< real64 > >( viewKeyStruct::densityOldString );
+
+      localSum.add( DeterministicReduction::localSum< parallelDevicePolicy<> >( dofNumber.size(),
+                                                                                [=] GEOSX_HOST_DEVICE ( localIndex const a )
+      {
+        real64 const val = ( elemGhostRank[a] < 0 ) ? localRhs[dofNumber[a] - rankOffset] : 0.0;
+        return val * val;
+      } ) );
+      normSum.add( DeterministicReduction::localSum< parallelDevicePolicy<> >( dofNumber.size(),
+                                                                               [=] GEOSX_HOST_DEVICE ( localIndex const a )
+      {
+        return ( elemGhostRank[a] < 0 ) ? refPoro[a] * densOld[a] * volume[a] : 0.0;
+      } ) );
+      count += LvArray::integerConversion< localIndex >( DeterministicReduction::localSum< parallelDevicePolicy<> >( dofNumber.size(),
+                                                                                                                  [=] GEOSX_HOST_DEVICE ( localIndex const a )
+      {
+        return ( elemGhostRank[a] < 0 ) ? 1.0 : 0.0;
+      } ) );
+    } );
+
+    parts.appendSum( localSum.value() );
+    parts.appendSum( normSum.value() );
+    parts.appendSum( count );
+    return;
+  }
+
+  // compute the norm of local residual scaled by cell pore volume, reduced over the subregions on the device
+  RAJA::ReduceSum< parallelDeviceReduce, real64 > localSum( 0.0 );
+  RAJA::ReduceSum< parallelDeviceReduce, real64 > normSum( 0.0 );
+  RAJA::ReduceSum< parallelDeviceReduce, localIndex > count( 0 );
   forTargetSubRegions( mesh, [&]( localIndex const,
                                   ElementSubRegionBase const & subRegion )
   {
@@ -105,26 +174,31 @@ real64 SinglePhaseFVM< BASE >::CalculateResidualNorm( DomainPartition const & do
     arrayView1d< real64 const > const & volume         = subRegion.getElementVolume();
     arrayView1d< real64 const > const & densOld        = subRegion.getReference< array1d< real64 > >( viewKeyStruct::densityOldString );
 
-    ResidualNormKernel::Launch< parallelDevicePolicy<>, parallelDeviceReduce >( localRhs,
-                                                                                rankOffset,
-                                                                                dofNumber,
-                                                                                elemGhostRank,
-                                                                                refPoro,
-                                                                                volume,
-                                                                                densOld,
-                                                                                localResidualNorm );
+    ResidualNormKernel::Launch< parallelDeviceAsyncPolicy<> >( localRhs,
+                                                               rankOffset,
+                                                               dofNumber,
+                                                               elemGhostRank,
+                                                               refPoro,
+                                                               volume,
+                                                               densOld,
+                                                               localSum,
+                                                               normSum,
+                                                               count );
   } );
 
-  // compute global residual norm
-  real64 globalResidualNorm[3] = {0, 0, 0};
-  MpiWrapper::allReduce( localResidualNorm,
-                         globalResidualNorm,
-                         3,
-                         MPI_SUM,
-                         MPI_COMM_GEOSX );
+  parts.appendSum( localSum.get() );
+  parts.appendSum( normSum.get() );
+  parts.appendSum( count.get() );
+}
 
+template< typename BASE >
+real64 SinglePhaseFVM< BASE >::CombineResidualNorms( ResidualNormParts & parts )
+{
+  real64 const squaredNorm = parts.nextSum();
+  real64 const normalizer = parts.nextSum();
+  real64 const count = parts.nextSum();
 
-  real64 const residual = sqrt( globalResidualNorm[0] ) / ( ( globalResidualNorm[1] + m_fluxEstimate ) / (globalResidualNorm[2]+1) );
+  real64 const residual = sqrt( squaredNorm ) / ( ( normalizer + m_fluxEstimate ) / (count+1) );
   return residual;
 }
 
@@ -145,11 +219,13 @@ void SinglePhaseFVM< BASE >::ApplySystemSolution( DofManager const & dofManager,
   std::map< string, string_array > fieldNames;
   fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaPressureString ) );
 
-  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain.getNeighbors(), true );
-
-  forTargetSubRegions( mesh, [&] ( localIndex const targetIndex, ElementSubRegionBase & subRegion )
+  // the state update needs the ghost values, it is delayed with the synchronization when it is deferred
+  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain.getNeighbors(), true, [this, &mesh]()
   {
-    this->UpdateState( subRegion, targetIndex );
+    forTargetSubRegions( mesh, [&] ( localIndex const targetIndex, ElementSubRegionBase & subRegion )
+    {
+      this->UpdateState( subRegion, targetIndex );
+    } );
   } );
 }
 
@@ -180,12 +256,19 @@ void SinglePhaseFVM< BASE >::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM(
   FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
 
   string const & dofKey = dofManager.getKey( viewKeyStruct::pressureString );
-  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > >
-  elemDofNumber = mesh.getElemManager()->ConstructArrayViewAccessor< globalIndex, 1 >( dofKey );
-  elemDofNumber.setName( this->getName() + "/accessors/" + dofKey );
+  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const &
+  elemDofNumber = m_elemDofNumber.get( *mesh.getElemManager(), dofKey );
 
   fluxApprox.forAllStencils( mesh, [&]( auto const & stencil )
   {
+    // the positions are searched once per sparsity pattern rather than at each assembly
+    buildFluxAssemblyMaps( stencil,
+                           dofManager.rankOffset(),
+                           elemDofNumber.toNestedViewConst(),
+                           m_elemGhostRank.toNestedViewConst(),
+                           localMatrix,
+                           m_fluxAssemblyMaps );
+
     FluxKernel::Launch( stencil,
                         dt,
                         dofManager.rankOffset(),
@@ -209,7 +292,8 @@ void SinglePhaseFVM< BASE >::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM(
 #endif
                         localMatrix,
                         localRhs,
-                        m_derivativeFluxResidual_dAperture->toViewConstSizes() );
+                        m_derivativeFluxResidual_dAperture->toViewConstSizes(),
+                        m_fluxAssemblyMaps );
   } );
 }
 
@@ -263,9 +347,8 @@ void SinglePhaseFVM< BASE >::ApplyFaceDirichletBC( real64 const time_n,
     faceManager.getReference< array1d< real64 > >( viewKeyStruct::gravityCoefString );
 
   string const & dofKey = dofManager.getKey( viewKeyStruct::pressureString );
-  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > >
-  elemDofNumber = mesh.getElemManager()->ConstructArrayViewAccessor< globalIndex, 1 >( dofKey );
-  elemDofNumber.setName( this->getName() + "/accessors/" + dofKey );
+  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const &
+  elemDofNumber = m_elemDofNumber.get( *mesh.getElemManager(), dofKey );
 
   // Take BCs defined for "pressure" field and apply values to "facePressure"
   fsManager.Apply( time_n + dt,
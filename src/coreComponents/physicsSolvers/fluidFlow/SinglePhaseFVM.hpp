@@ -19,6 +19,7 @@
 #ifndef GEOSX_PHYSICSSOLVERS_FLUIDFLOW_SINGLEPHASEFVM_HPP_
 #define GEOSX_PHYSICSSOLVERS_FLUIDFLOW_SINGLEPHASEFVM_HPP_
 
+#include "mesh/CachedElementViewAccessor.hpp"
 #include "physicsSolvers/fluidFlow/SinglePhaseBase.hpp"
 #include "physicsSolvers/fluidFlow/SinglePhaseProppantBase.hpp"
 
@@ -172,10 +173,14 @@ public:
                            CRSMatrixView< real64, globalIndex const > const & localMatrix,
                            arrayView1d< real64 > const & localRhs ) override;
 
+  virtual void
+  CalculateLocalResidualNorms( DomainPartition const & domain,
+                               DofManager const & dofManager,
+                               arrayView1d< real64 const > const & localRhs,
+                               ResidualNormParts & parts ) override;
+
   virtual real64
-  CalculateResidualNorm( DomainPartition const & domain,
-                         DofManager const & dofManager,
-                         arrayView1d< real64 const > const & localRhs ) override;
+  CombineResidualNorms( ResidualNormParts & parts ) override;
 
   virtual void
   ApplySystemSolution( DofManager const & dofManager,
@@ -243,7 +248,11 @@ private:
                              CRSMatrixView< real64, globalIndex const > const & localMatrix,
                              arrayView1d< real64 > const & localRhs );
 
-  // no data needed here, see SinglePhaseBase
+  /// Accessor to the degrees of freedom of the elements, rebuilt only when the mesh changes
+  CachedElementViewAccessor< array1d< globalIndex >, arrayView1d< globalIndex const > > m_elemDofNumber;
+
+  /// Positions of the flux entries of the TPFA connections in the rows of the matrix, rebuilt with its sparsity pattern
+  std::vector< AssemblyMap > m_fluxAssemblyMaps;
 
 };
 
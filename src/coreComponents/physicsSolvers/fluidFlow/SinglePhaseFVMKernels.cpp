@@ -382,61 +382,306 @@ void FluxKernel::
 #endif
                                     CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                     arrayView1d< real64 > const & localRhs,
-                                    CRSMatrixView< real64, localIndex const > const & GEOSX_UNUSED_PARAM( dR_dAper ) )
+                                    CRSMatrixView< real64, localIndex const > const & GEOSX_UNUSED_PARAM( dR_dAper ),
+                                    std::vector< AssemblyMap > const & assemblyMaps )
 {
   constexpr localIndex maxNumFluxElems = CellElementStencilTPFA::NUM_POINT_IN_FLUX;
   constexpr localIndex numFluxElems = CellElementStencilTPFA::NUM_POINT_IN_FLUX;
   constexpr localIndex maxStencilSize = CellElementStencilTPFA::MAX_STENCIL_SIZE;
   constexpr localIndex stencilSize  = CellElementStencilTPFA::MAX_STENCIL_SIZE;
 
+  // When the stencil is colored, the connections of a color share no cell and are assembled without atomics
+  bool const colored = !stencil.getColorOffsets().empty();
+
+  // The maps give the positions of the entries in the rows, instead of searching them
+  std::vector< CellElementStencilTPFA::SubRegionConnections > const & subRegionConnections = stencil.getSubRegionConnections();
+  bool const mapped = assemblyMaps.size() == subRegionConnections.size() + 1;
+
+  // The connections within a subregion index the subregion views directly
+  for( std::size_t k = 0; k < subRegionConnections.size(); ++k )
+  {
+    CellElementStencilTPFA::SubRegionConnections const & connections = subRegionConnections[k];
+    localIndex const er = connections.regionIndex;
+    localIndex const esr = connections.subRegionIndex;
+
+    arrayView2d< localIndex const > const sei = connections.elementIndices.toViewConst();
+    arrayView2d< real64 const > const weights = connections.weights.toViewConst();
+
+    arrayView1d< globalIndex const > const subRegionDofNumber = dofNumber[er][esr];
+    arrayView1d< integer const > const subRegionGhostRank = ghostRank[er][esr];
+    arrayView1d< real64 const > const subRegionPres = pres[er][esr];
+    arrayView1d< real64 const > const subRegionDPres = dPres[er][esr];
+    arrayView1d< real64 const > const subRegionGravCoef = gravCoef[er][esr];
+    arrayView2d< real64 const > const subRegionDens = dens[er][esr];
+    arrayView2d< real64 const > const subRegionDDens_dPres = dDens_dPres[er][esr];
+    arrayView1d< real64 const > const subRegionMob = mob[er][esr];
+    arrayView1d< real64 const > const subRegionDMob_dPres = dMob_dPres[er][esr];
+    arrayView3d< localIndex const > const positions = mapped ? assemblyMaps[k].positions() : arrayView3d< localIndex const >();
+
+    localIndex const numColors = colored ? connections.colorOffsets.size() - 1 : 1;
+    for( localIndex color = 0; color < numColors; ++color )
+    {
+      localIndex const first = colored ? connections.colorOffsets[color] : 0;
+      localIndex const last = colored ? connections.colorOffsets[color + 1] : sei.size( 0 );
+
+      forAll< parallelDevicePolicy<> >( last - first, [=] GEOSX_HOST_DEVICE ( localIndex const index )
+      {
+        localIndex const iconn = first + index;
+
+        // working arrays
+        stackArray1d< globalIndex, maxNumFluxElems > dofColIndices( stencilSize );
+        stackArray1d< real64, maxNumFluxElems > localFlux( numFluxElems );
+        stackArray2d< real64, maxNumFluxElems *maxStencilSize > localFluxJacobian( numFluxElems, stencilSize );
+
+        Compute( stencilSize,
+                 sei[iconn],
+                 sei[iconn],
+                 sei[iconn],
+                 weights[iconn],
+                 subRegionPres,
+                 subRegionDPres,
+                 subRegionGravCoef,
+                 subRegionDens,
+                 subRegionDDens_dPres,
+                 subRegionMob,
+                 subRegionDMob_dPres,
+                 dt,
+                 localFlux,
+                 localFluxJacobian );
+
+        // extract DOF numbers
+        for( localIndex i = 0; i < stencilSize; ++i )
+        {
+          dofColIndices[i] = subRegionDofNumber[sei( iconn, i )];
+        }
+
+        for( localIndex i = 0; i < numFluxElems; ++i )
+        {
+          if( subRegionGhostRank[sei( iconn, i )] < 0 )
+          {
+            globalIndex const globalRow = subRegionDofNumber[sei( iconn, i )];
+            localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - rankOffset );
+            GEOSX_ASSERT_GE( localRow, 0 );
+            GEOSX_ASSERT_GT( localMatrix.numRows(), localRow );
+
+            if( colored )
+            {
+              localRhs[localRow] += localFlux[i];
+              if( mapped )
+              {
+                AssemblyMap::addToRow< serialAtomic >( localMatrix,
+                                                       localRow,
+                                                       positions[iconn][i],
+                                                       dofColIndices.data(),
+                                                       localFluxJacobian[i].dataIfContiguous(),
+                                                       stencilSize );
+              }
+              else
+              {
+                localMatrix.addToRowBinarySearchUnsorted< serialAtomic >( localRow,
+                                                                          dofColIndices.data(),
+                                                                          localFluxJacobian[i].dataIfContiguous(),
+                                                                          stencilSize );
+              }
+            }
+            else
+            {
+              RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow], localFlux[i] );
+              if( mapped )
+              {
+                AssemblyMap::addToRow< parallelDeviceAtomic >( localMatrix,
+                                                               localRow,
+                                                               positions[iconn][i],
+                                                               dofColIndices.data(),
+                                                               localFluxJacobian[i].dataIfContiguous(),
+                                                               stencilSize );
+              }
+              else
+              {
+                localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow,
+                                                                                  dofColIndices.data(),
+                                                                                  localFluxJacobian[i].dataIfContiguous(),
+                                                                                  stencilSize );
+              }
+            }
+          }
+        }
+      } );
+    }
+  }
+
+  // The connections between two subregions go through the element views
   typename CellElementStencilTPFA::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
   typename CellElementStencilTPFA::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
   typename CellElementStencilTPFA::IndexContainerViewConstType const & sei = stencil.getElementIndices();
   typename CellElementStencilTPFA::WeightContainerViewConstType const & weights = stencil.getWeights();
+  arrayView1d< localIndex const > const crossConnections = stencil.getCrossSubRegionConnections();
+  arrayView1d< localIndex const > const crossColorOffsets = stencil.getCrossSubRegionColorOffsets();
+  arrayView3d< localIndex const > const crossPositions = mapped ? assemblyMaps.back().positions() : arrayView3d< localIndex const >();
+
+  localIndex const numColors = colored ? crossColorOffsets.size() - 1 : 1;
+  for( localIndex color = 0; color < numColors; ++color )
+  {
+    localIndex const first = colored ? crossColorOffsets[color] : 0;
+    localIndex const last = colored ? crossColorOffsets[color + 1] : crossConnections.size();
+
+    forAll< parallelDevicePolicy<> >( last - first, [=] GEOSX_HOST_DEVICE ( localIndex const index )
+    {
+      localIndex const iconn = crossConnections[first + index];
+      localIndex const icross = first + index;
+
+      // working arrays
+      stackArray1d< globalIndex, maxNumFluxElems > dofColIndices( stencilSize );
+      stackArray1d< real64, maxNumFluxElems > localFlux( numFluxElems );
+      stackArray2d< real64, maxNumFluxElems *maxStencilSize > localFluxJacobian( numFluxElems, stencilSize );
+
+      Compute( stencilSize,
+               seri[iconn],
+               sesri[iconn],
+               sei[iconn],
+               weights[iconn],
+               pres,
+               dPres,
+               gravCoef,
+               dens,
+               dDens_dPres,
+               mob,
+               dMob_dPres,
+               dt,
+               localFlux,
+               localFluxJacobian );
+
+      // extract DOF numbers
+      for( localIndex i = 0; i < stencilSize; ++i )
+      {
+        dofColIndices[i] = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+      }
+
+      for( localIndex i = 0; i < numFluxElems; ++i )
+      {
+        if( ghostRank[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] < 0 )
+        {
+          globalIndex const globalRow = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+          localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - rankOffset );
+          GEOSX_ASSERT_GE( localRow, 0 );
+          GEOSX_ASSERT_GT( localMatrix.numRows(), localRow );
+
+          if( colored )
+          {
+            localRhs[localRow] += localFlux[i];
+            if( mapped )
+            {
+              AssemblyMap::addToRow< serialAtomic >( localMatrix,
+                                                     localRow,
+                                                     crossPositions[icross][i],
+                                                     dofColIndices.data(),
+                                                     localFluxJacobian[i].dataIfContiguous(),
+                                                     stencilSize );
+            }
+            else
+            {
+              localMatrix.addToRowBinarySearchUnsorted< serialAtomic >( localRow,
+                                                                        dofColIndices.data(),
+                                                                        localFluxJacobian[i].dataIfContiguous(),
+                                                                        stencilSize );
+            }
+          }
+          else
+          {
+            RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow], localFlux[i] );
+            if( mapped )
+            {
+              AssemblyMap::addToRow< parallelDeviceAtomic >( localMatrix,
+                                                             localRow,
+                                                             crossPositions[icross][i],
+                                                             dofColIndices.data(),
+                                                             localFluxJacobian[i].dataIfContiguous(),
+                                                             stencilSize );
+            }
+            else
+            {
+              localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow,
+                                                                                dofColIndices.data(),
+                                                                                localFluxJacobian[i].dataIfContiguous(),
+                                                                                stencilSize );
+            }
+          }
+        }
+      }
+    } );
+  }
+}
 
-  forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+void FluxKernel::
+  BuildAssemblyMaps( CellElementStencilTPFA const & stencil,
+                     globalIndex const rankOffset,
+                     ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
+                     ElementViewConst< arrayView1d< integer const > > const & ghostRank,
+                     CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                     std::vector< AssemblyMap > & assemblyMaps )
+{
+  constexpr localIndex numFluxElems = CellElementStencilTPFA::NUM_POINT_IN_FLUX;
+  constexpr localIndex stencilSize  = CellElementStencilTPFA::MAX_STENCIL_SIZE;
+
+  std::vector< CellElementStencilTPFA::SubRegionConnections > const & subRegionConnections = stencil.getSubRegionConnections();
+  assemblyMaps.resize( subRegionConnections.size() + 1 );
+
+  // The connections within a subregion, in the order of their list
+  for( std::size_t k = 0; k < subRegionConnections.size(); ++k )
   {
-    // working arrays
-    stackArray1d< globalIndex, maxNumFluxElems > dofColIndices( stencilSize );
-    stackArray1d< real64, maxNumFluxElems > localFlux( numFluxElems );
-    stackArray2d< real64, maxNumFluxElems *maxStencilSize > localFluxJacobian( numFluxElems, stencilSize );
-
-    Compute( stencilSize,
-             seri[iconn],
-             sesri[iconn],
-             sei[iconn],
-             weights[iconn],
-             pres,
-             dPres,
-             gravCoef,
-             dens,
-             dDens_dPres,
-             mob,
-             dMob_dPres,
-             dt,
-             localFlux,
-             localFluxJacobian );
-
-    // extract DOF numbers
-    for( localIndex i = 0; i < stencilSize; ++i )
+    CellElementStencilTPFA::SubRegionConnections const & connections = subRegionConnections[k];
+    arrayView2d< localIndex const > const sei = connections.elementIndices.toViewConst();
+    if( assemblyMaps[k].isBuiltFor( localMatrix, sei.size( 0 ) ) )
     {
-      dofColIndices[i] = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+      continue;
     }
 
+    arrayView1d< globalIndex const > const subRegionDofNumber = dofNumber[connections.regionIndex][connections.subRegionIndex];
+    arrayView1d< integer const > const subRegionGhostRank = ghostRank[connections.regionIndex][connections.subRegionIndex];
+    arrayView3d< localIndex > const positions = assemblyMaps[k].setup( localMatrix, sei.size( 0 ), numFluxElems, stencilSize );
+
+    forAll< parallelDevicePolicy<> >( sei.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+    {
+      for( localIndex i = 0; i < numFluxElems; ++i )
+      {
+        if( subRegionGhostRank[sei( iconn, i )] < 0 )
+        {
+          localIndex const localRow = LvArray::integerConversion< localIndex >( subRegionDofNumber[sei( iconn, i )] - rankOffset );
+          arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( localRow );
+          for( localIndex j = 0; j < stencilSize; ++j )
+          {
+            positions[iconn][i][j] = AssemblyMap::findPosition( columns, subRegionDofNumber[sei( iconn, j )] );
+          }
+        }
+      }
+    } );
+  }
+
+  // The connections between two subregions, in the order of the list of these connections
+  typename CellElementStencilTPFA::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
+  typename CellElementStencilTPFA::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
+  typename CellElementStencilTPFA::IndexContainerViewConstType const & sei = stencil.getElementIndices();
+  arrayView1d< localIndex const > const crossConnections = stencil.getCrossSubRegionConnections();
+  if( assemblyMaps.back().isBuiltFor( localMatrix, crossConnections.size() ) )
+  {
+    return;
+  }
+
+  arrayView3d< localIndex > const positions = assemblyMaps.back().setup( localMatrix, crossConnections.size(), numFluxElems, stencilSize );
+  forAll< parallelDevicePolicy<> >( crossConnections.size(), [=] GEOSX_HOST_DEVICE ( localIndex const icross )
+  {
+    localIndex const iconn = crossConnections[icross];
     for( localIndex i = 0; i < numFluxElems; ++i )
     {
       if( ghostRank[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] < 0 )
       {
         globalIndex const globalRow = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
         localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - rankOffset );
-        GEOSX_ASSERT_GE( localRow, 0 );
-        GEOSX_ASSERT_GT( localMatrix.numRows(), localRow );
-
-        RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow], localFlux[i] );
-        localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow,
-                                                                          dofColIndices.data(),
-                                                                          localFluxJacobian[i].dataIfContiguous(),
-                                                                          stencilSize );
+        arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( localRow );
+        for( localIndex j = 0; j < stencilSize; ++j )
+        {
+          positions[icross][i][j] = AssemblyMap::findPosition( columns, dofNumber[seri( iconn, j )][sesri( iconn, j )][sei( iconn, j )] );
+        }
       }
     }
   } );
@@ -467,7 +712,8 @@ void FluxKernel::
 #endif
                                 CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                 arrayView1d< real64 > const & localRhs,
-                                CRSMatrixView< real64, localIndex const > const & dR_dAper )
+                                CRSMatrixView< real64, localIndex const > const & dR_dAper,
+                                std::vector< AssemblyMap > const & GEOSX_UNUSED_PARAM( assemblyMaps ) )
 {
   constexpr localIndex maxNumFluxElems = FaceElementStencil::NUM_POINT_IN_FLUX;
   constexpr localIndex maxStencilSize = FaceElementStencil::MAX_STENCIL_SIZE;
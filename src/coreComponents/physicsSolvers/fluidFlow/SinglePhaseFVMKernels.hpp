@@ -24,6 +24,7 @@
 #include "finiteVolume/FluxApproximationBase.hpp"
 #include "rajaInterface/GEOS_RAJA_Interface.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/utilities/AssemblyMap.hpp"
 #include "physicsSolvers/fluidFlow/SinglePhaseBaseKernels.hpp"
 
 namespace geosx
@@ -149,6 +150,8 @@ struct FluxKernel
    * @param[in] dMob_dPres The derivative of mobility wrt pressure in each element
    * @param[out] jacobian The linear system matrix
    * @param[out] residual The linear system residual
+   * @param[in] assemblyMaps The positions of the flux entries in the rows of the matrix, built by BuildAssemblyMaps(),
+   *                         empty to search the rows
    */
   template< typename STENCIL_TYPE >
   static void
@@ -175,7 +178,26 @@ struct FluxKernel
 #endif
             CRSMatrixView< real64, globalIndex const > const & localMatrix,
             arrayView1d< real64 > const & localRhs,
-            CRSMatrixView< real64, localIndex const > const & dR_dAper );
+            CRSMatrixView< real64, localIndex const > const & dR_dAper,
+            std::vector< AssemblyMap > const & assemblyMaps );
+
+  /**
+   * @brief Record the positions of the flux entries of the TPFA connections in the rows of the matrix.
+   * @param[in] stencil The stencil object.
+   * @param[in] rankOffset The offset of the dofs of this rank
+   * @param[in] dofNumber The dofNumbers for each element
+   * @param[in] ghostRank The ghost ranks of the elements
+   * @param[in] localMatrix The linear system matrix, whose sparsity pattern holds the connections
+   * @param[inout] assemblyMaps The map of the connections of each subregion, followed by the map of the
+   *                            connections between two subregions. The maps already built for the matrix are kept.
+   */
+  static void
+  BuildAssemblyMaps( CellElementStencilTPFA const & stencil,
+                     globalIndex const rankOffset,
+                     ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
+                     ElementViewConst< arrayView1d< integer const > > const & ghostRank,
+                     CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                     std::vector< AssemblyMap > & assemblyMaps );
 
 
   /**
@@ -39,11 +39,19 @@ SinglePhaseHybridFVM::SinglePhaseHybridFVM( const std::string & name,
                                             Group * const parent ):
   SinglePhaseBase( name, parent ),
   m_faceDofKey( "" ),
-  m_areaRelTol( 1e-8 )
+  m_areaRelTol( 1e-8 ),
+  m_precomputeTransMatrix( 0 )
 {
 
   // one cell-centered dof per cell
   m_numDofPerCell = 1;
+  m_elemDofNumber.setName( getName() + "/accessors/dofNumber" );
+
+  registerWrapper( viewKeyStruct::precomputeTransMatrixString, &m_precomputeTransMatrix )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to store the transmissibility matrix of each element, recomputed only when the permeability "
+                    "of the element changes, instead of recomputing it at each assembly." );
 
 }
 
@@ -66,6 +74,20 @@ void SinglePhaseHybridFVM::RegisterDataOnMesh( Group * const MeshBodies )
       setRegisteringObjects( this->getName())->
       setDescription( "An array that holds the accumulated pressure updates at the faces." );
 
+    // cached transmissibility matrices, sized in InitializePostInitialConditions_PreSubGroups if requested
+    forTargetSubRegions< CellElementSubRegion >( *meshLevel, [&]( localIndex const,
+                                                                  CellElementSubRegion & subRegion )
+    {
+      subRegion.registerWrapper< array3d< real64 > >( viewKeyStruct::transMatrixString )->
+        setRestartFlags( RestartFlags::NO_WRITE )->
+        setRegisteringObjects( this->getName())->
+        setDescription( "An array that holds the cached transmissibility matrix of each element." );
+
+      subRegion.registerWrapper< array1d< R1Tensor > >( viewKeyStruct::transMatrixPermeabilityString )->
+        setRestartFlags( RestartFlags::NO_WRITE )->
+        setRegisteringObjects( this->getName())->
+        setDescription( "An array that holds the permeability used to compute the cached transmissibility matrices." );
+    } );
   }
 }
 
@@ -106,6 +128,23 @@ void SinglePhaseHybridFVM::InitializePostInitialConditions_PreSubGroups( Group *
   GEOSX_ERROR_IF_LE_MSG( minVal.get(), 0.0,
                          "The transmissibility multipliers used in SinglePhaseHybridFVM must strictly larger than 0.0" );
 
+  if( m_precomputeTransMatrix )
+  {
+    MeshLevel & cachedMesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+    forTargetSubRegions< CellElementSubRegion >( cachedMesh, [&]( localIndex const,
+                                                                  CellElementSubRegion & subRegion )
+    {
+      localIndex const numFacesPerElement = subRegion.numFacesPerElement();
+      subRegion.getReference< array3d< real64 > >( viewKeyStruct::transMatrixString ).
+        resizeDimension< 1, 2 >( numFacesPerElement, numFacesPerElement );
+
+      // a negative permeability forces the computation of all the matrices at the first update
+      arrayView1d< R1Tensor > const & transMatrixPerm =
+        subRegion.getReference< array1d< R1Tensor > >( viewKeyStruct::transMatrixPermeabilityString );
+      transMatrixPerm.setValues< serialPolicy >( R1Tensor( -1.0 ) );
+    } );
+  }
+
 }
 
 void SinglePhaseHybridFVM::ImplicitStepSetup( real64 const & time_n,
@@ -117,6 +156,12 @@ void SinglePhaseHybridFVM::ImplicitStepSetup( real64 const & time_n,
   // setup the cell-centered fields
   SinglePhaseBase::ImplicitStepSetup( time_n, dt, domain );
 
+  // refresh the cached transmissibility matrices if the permeability has changed since the previous step
+  if( m_precomputeTransMatrix )
+  {
+    UpdateTransMatrices( domain );
+  }
+
   // setup the face fields
   MeshLevel & meshLevel     = *domain.getMeshBodies()->GetGroup< MeshBody >( 0 )->getMeshLevel( 0 );
   FaceManager & faceManager = *meshLevel.getFaceManager();
@@ -129,6 +174,51 @@ void SinglePhaseHybridFVM::ImplicitStepSetup( real64 const & time_n,
   dFacePres.setValues< parallelDevicePolicy<> >( 0.0 );
 }
 
+void SinglePhaseHybridFVM::UpdateTransMatrices( DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshLevel & mesh                = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  NodeManager const & nodeManager = *mesh.getNodeManager();
+  FaceManager const & faceManager = *mesh.getFaceManager();
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition = nodeManager.referencePosition();
+  ArrayOfArraysView< localIndex const > const & faceToNodes = faceManager.nodeList().toViewConst();
+
+  string const & coeffName = fluxApprox.getReference< string >( FluxApproximationBase::viewKeyStruct::coeffNameString );
+  arrayView1d< real64 const > const & transMultiplier =
+    faceManager.getReference< array1d< real64 > >( coeffName + FluxApproximationBase::viewKeyStruct::transMultiplierString );
+
+  real64 const lengthTolerance = domain.getMeshBody( 0 )->getGlobalLengthScale() * m_areaRelTol;
+
+  localIndex numRecomputed = 0;
+  forTargetSubRegions< CellElementSubRegion >( mesh, [&]( localIndex const,
+                                                          CellElementSubRegion & subRegion )
+  {
+    arrayView3d< real64 > const & transMatrix =
+      subRegion.getReference< array3d< real64 > >( viewKeyStruct::transMatrixString );
+    arrayView1d< R1Tensor > const & transMatrixPerm =
+      subRegion.getReference< array1d< R1Tensor > >( viewKeyStruct::transMatrixPermeabilityString );
+
+    helpers::KernelLaunchSelectorFaceSwitch( subRegion.numFacesPerElement(), [&] ( auto NF )
+    {
+      numRecomputed += TransMatrixKernel::Launch< NF() >( subRegion,
+                                                          nodePosition,
+                                                          faceToNodes,
+                                                          transMultiplier,
+                                                          lengthTolerance,
+                                                          transMatrix,
+                                                          transMatrixPerm );
+    } );
+  } );
+
+  GEOSX_LOG_LEVEL_RANK_0( 2, getName() << ": " << MpiWrapper::Sum( numRecomputed ) << " transmissibility matrices recomputed" );
+}
+
 void SinglePhaseHybridFVM::ImplicitStepComplete( real64 const & time_n,
                                                  real64 const & dt,
                                                  DomainPartition & domain )
@@ -217,9 +307,8 @@ void SinglePhaseHybridFVM::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM( t
 
   // get the element dof numbers for the assembly
   string const & elemDofKey = dofManager.getKey( viewKeyStruct::pressureString );
-  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > elemDofNumber =
-    mesh.getElemManager()->ConstructArrayViewAccessor< globalIndex, 1 >( elemDofKey );
-  elemDofNumber.setName( getName() + "/accessors/" + elemDofKey );
+  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const & elemDofNumber =
+    m_elemDofNumber.get( *mesh.getElemManager(), elemDofKey );
 
   // get the face-centered pressures
   arrayView1d< real64 const > const & facePres =
@@ -257,6 +346,10 @@ void SinglePhaseHybridFVM::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM( t
     SingleFluidBase const & fluid =
       GetConstitutiveModel< SingleFluidBase >( subRegion, m_fluidModelNames[targetIndex] );
 
+    // empty unless the transmissibility matrices are precomputed
+    arrayView3d< real64 const > const & cachedTransMatrix =
+      subRegion.template getReference< array3d< real64 > >( viewKeyStruct::transMatrixString );
+
     KernelLaunchSelector< FluxKernel >( subRegion.numFacesPerElement(),
                                         er,
                                         esr,
@@ -279,6 +372,7 @@ void SinglePhaseHybridFVM::AssembleFluxTerms( real64 const GEOSX_UNUSED_PARAM( t
                                         elemDofNumber.toNestedViewConst(),
                                         dofManager.rankOffset(),
                                         lengthTolerance,
+                                        cachedTransMatrix,
                                         dt,
                                         localMatrix,
                                         localRhs );
@@ -298,9 +392,10 @@ void SinglePhaseHybridFVM::ApplyBoundaryConditions( real64 const time_n,
 }
 
 
-real64 SinglePhaseHybridFVM::CalculateResidualNorm( DomainPartition const & domain,
-                                                    DofManager const & dofManager,
-                                                    arrayView1d< real64 const > const & localRhs )
+void SinglePhaseHybridFVM::CalculateLocalResidualNorms( DomainPartition const & domain,
+                                                        DofManager const & dofManager,
+                                                        arrayView1d< real64 const > const & localRhs,
+                                                        ResidualNormParts & parts )
 {
   MeshLevel const & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
   FaceManager const & faceManager = *mesh.getFaceManager();
@@ -317,11 +412,13 @@ real64 SinglePhaseHybridFVM::CalculateResidualNorm( DomainPartition const & doma
 
   // local residual
   real64 localResidualNorm[4] = { 0.0, 0.0, 0.0, 0.0 };
-  real64 globalResidualNorm[4] = { 0.0, 0.0, 0.0, 0.0 };
+  RAJA::ReduceSum< parallelDeviceReduce, real64 > localSum( 0.0 );
+  RAJA::ReduceSum< parallelDeviceReduce, real64 > normSum( 0.0 );
+  RAJA::ReduceSum< parallelDeviceReduce, localIndex > count( 0 );
 
   // 1. Compute the residual for the mass conservation equations
 
-  // compute the norm of local residual scaled by cell pore volume
+  // compute the norm of local residual scaled by cell pore volume, reduced over the subregions on the device
 
   real64 defaultViscosity = 0; // for the normalization of the face residuals
   localIndex subRegionCounter = 0;
@@ -336,15 +433,16 @@ real64 SinglePhaseHybridFVM::CalculateResidualNorm( DomainPartition const & doma
     arrayView1d< real64 const > const & volume = subRegion.getElementVolume();
     arrayView1d< real64 const > const & densOld = subRegion.getReference< array1d< real64 > >( viewKeyStruct::densityOldString );
 
-    SinglePhaseBaseKernels::ResidualNormKernel::Launch< parallelDevicePolicy<>,
-                                                        parallelDeviceReduce >( localRhs,
-                                                                                rankOffset,
-                                                                                elemDofNumber,
-                                                                                elemGhostRank,
-                                                                                refPoro,
-                                                                                volume,
-                                                                                densOld,
-                                                                                localResidualNorm );
+    SinglePhaseBaseKernels::ResidualNormKernel::Launch< parallelDeviceAsyncPolicy<> >( localRhs,
+                                                                                       rankOffset,
+                                                                                       elemDofNumber,
+                                                                                       elemGhostRank,
+                                                                                       refPoro,
+                                                                                       volume,
+                                                                                       densOld,
+                                                                                       localSum,
+                                                                                       normSum,
+                                                                                       count );
 
     SingleFluidBase const & fluid = GetConstitutiveModel< SingleFluidBase >( subRegion, m_fluidModelNames[targetIndex] );
     defaultViscosity += fluid.defaultViscosity();
@@ -361,6 +459,10 @@ real64 SinglePhaseHybridFVM::CalculateResidualNorm( DomainPartition const & doma
 
   defaultViscosity /= subRegionCounter;
 
+  localResidualNorm[0] = localSum.get();
+  localResidualNorm[1] = normSum.get();
+  localResidualNorm[2] = count.get();
+
   // 2. Compute the residual for the face-based constraints
   SinglePhaseHybridFVMKernels::ResidualNormKernel::Launch< parallelDevicePolicy<>,
                                                            parallelDeviceReduce >( localRhs,
@@ -374,16 +476,21 @@ real64 SinglePhaseHybridFVM::CalculateResidualNorm( DomainPartition const & doma
                                                                                    defaultViscosity,
                                                                                    &localResidualNorm[3] );
 
-  // 3. Combine the two norms
-
-  // compute global residual norm
-  MpiWrapper::allReduce( localResidualNorm,
-                         globalResidualNorm,
-                         4,
-                         MPI_SUM,
-                         MPI_COMM_GEOSX );
+  for( real64 const value : localResidualNorm )
+  {
+    parts.appendSum( value );
+  }
+}
 
+real64 SinglePhaseHybridFVM::CombineResidualNorms( ResidualNormParts & parts )
+{
+  real64 globalResidualNorm[4];
+  for( real64 & value : globalResidualNorm )
+  {
+    value = parts.nextSum();
+  }
 
+  // 3. Combine the two norms
   real64 const elemResidualNorm = sqrt( globalResidualNorm[0] )
                                   / ( ( globalResidualNorm[1] + m_fluxEstimate ) / (globalResidualNorm[2]+1) );
   real64 const faceResidualNorm = sqrt( globalResidualNorm[3] );
@@ -404,7 +511,8 @@ bool SinglePhaseHybridFVM::CheckSystemSolution( DomainPartition const & domain,
   MeshLevel const & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
   FaceManager const & faceManager = *mesh.getFaceManager();
 
-  localIndex localCheck = 1;
+  // the check is reduced over the subregions and the faces on the device, and read once
+  RAJA::ReduceMin< parallelDeviceReduce, localIndex > localCheck( 1 );
 
   string const elemDofKey = dofManager.getKey( viewKeyStruct::pressureString );
   string const faceDofKey = dofManager.getKey( viewKeyStruct::facePressureString );
@@ -424,21 +532,14 @@ bool SinglePhaseHybridFVM::CheckSystemSolution( DomainPartition const & domain,
     arrayView1d< real64 const > const & dPres =
       subRegion.getReference< array1d< real64 > >( viewKeyStruct::deltaPressureString );
 
-    localIndex const subRegionSolutionCheck =
-      SinglePhaseBaseKernels::SolutionCheckKernel::Launch< parallelDevicePolicy<>,
-                                                           parallelDeviceReduce >( localSolution,
-                                                                                   rankOffset,
-                                                                                   elemDofNumber,
-                                                                                   elemGhostRank,
-                                                                                   pres,
-                                                                                   dPres,
-                                                                                   scalingFactor );
-
-    if( subRegionSolutionCheck == 0 )
-    {
-      localCheck = 0;
-    }
-
+    SinglePhaseBaseKernels::SolutionCheckKernel::Launch< parallelDeviceAsyncPolicy<> >( localSolution,
+                                                                                        rankOffset,
+                                                                                        elemDofNumber,
+                                                                                        elemGhostRank,
+                                                                                        pres,
+                                                                                        dPres,
+                                                                                        scalingFactor,
+                                                                                        localCheck );
   } );
 
   arrayView1d< integer const > const & faceGhostRank = faceManager.ghostRank();
@@ -450,22 +551,16 @@ bool SinglePhaseHybridFVM::CheckSystemSolution( DomainPartition const & domain,
   arrayView1d< real64 const > const & dFacePres =
     faceManager.getReference< array1d< real64 > >( viewKeyStruct::deltaFacePressureString );
 
-  localIndex const faceSolutionCheck =
-    SinglePhaseBaseKernels::SolutionCheckKernel::Launch< parallelDevicePolicy<>,
-                                                         parallelDeviceReduce >( localSolution,
-                                                                                 rankOffset,
-                                                                                 faceDofNumber,
-                                                                                 faceGhostRank,
-                                                                                 facePres,
-                                                                                 dFacePres,
-                                                                                 scalingFactor );
-
-  if( faceSolutionCheck == 0 )
-  {
-    localCheck = 0;
-  }
+  SinglePhaseBaseKernels::SolutionCheckKernel::Launch< parallelDeviceAsyncPolicy<> >( localSolution,
+                                                                                      rankOffset,
+                                                                                      faceDofNumber,
+                                                                                      faceGhostRank,
+                                                                                      facePres,
+                                                                                      dFacePres,
+                                                                                      scalingFactor,
+                                                                                      localCheck );
 
-  return MpiWrapper::Min( localCheck );
+  return MpiWrapper::Min( localCheck.get() );
 }
 
 
@@ -503,12 +598,14 @@ void SinglePhaseHybridFVM::ApplySystemSolution( DofManager const & dofManager,
   CommunicationTools::SynchronizeFields( fieldNames,
                                          &mesh,
                                          domain.getNeighbors(),
-                                         true );
-
-  forTargetSubRegions( mesh, [&]( localIndex const targetIndex,
-                                  ElementSubRegionBase & subRegion )
+                                         true,
+                                         [this, &mesh]()
   {
-    UpdateState( subRegion, targetIndex );
+    forTargetSubRegions( mesh, [&]( localIndex const targetIndex,
+                                    ElementSubRegionBase & subRegion )
+    {
+      UpdateState( subRegion, targetIndex );
+    } );
   } );
 }
 
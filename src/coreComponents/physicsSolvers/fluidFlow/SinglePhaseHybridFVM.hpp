@@ -19,6 +19,7 @@
 #ifndef GEOSX_PHYSICSSOLVERS_FLUIDFLOW_SINGLEPHASEHYBRIDFVM_HPP_
 #define GEOSX_PHYSICSSOLVERS_FLUIDFLOW_SINGLEPHASEHYBRIDFVM_HPP_
 
+#include "mesh/CachedElementViewAccessor.hpp"
 #include "physicsSolvers/fluidFlow/SinglePhaseBase.hpp"
 #include "physicsSolvers/fluidFlow/SinglePhaseHybridFVMKernels.hpp"
 
@@ -98,10 +99,14 @@ public:
                            CRSMatrixView< real64, globalIndex const > const & localMatrix,
                            arrayView1d< real64 > const & localRhs ) override;
 
+  virtual void
+  CalculateLocalResidualNorms( DomainPartition const & domain,
+                               DofManager const & dofManager,
+                               arrayView1d< real64 const > const & localRhs,
+                               ResidualNormParts & parts ) override;
+
   virtual real64
-  CalculateResidualNorm( DomainPartition const & domain,
-                         DofManager const & dofManager,
-                         arrayView1d< real64 const > const & localRhs ) override;
+  CombineResidualNorms( ResidualNormParts & parts ) override;
 
   virtual bool
   CheckSystemSolution( DomainPartition const & domain,
@@ -149,6 +154,11 @@ public:
     // primary face-based field
     static constexpr auto deltaFacePressureString = "deltaFacePressure";
 
+    // input flag and cached element-based transmissibility matrices
+    static constexpr auto precomputeTransMatrixString = "precomputeTransMatrix";
+    static constexpr auto transMatrixString = "transMatrix";
+    static constexpr auto transMatrixPermeabilityString = "transMatrixPermeability";
+
   } viewKeysSinglePhaseHybridFVM;
 
   viewKeyStruct & viewKeys()
@@ -170,15 +180,27 @@ public:
 
 private:
 
+  /**
+   * @brief Recompute the cached transmissibility matrices of the elements whose permeability has changed
+   * @param domain the domain containing the mesh and fields
+   */
+  void UpdateTransMatrices( DomainPartition & domain );
+
   /// Dof key for the member functions that do not have access to the coupled Dof manager
   string m_faceDofKey;
 
   /// relative tolerance (redundant with FluxApproximationBase)
   real64 m_areaRelTol;
 
+  /// flag to precompute the transmissibility matrices instead of recomputing them at each assembly
+  integer m_precomputeTransMatrix;
+
   /// region filter used in flux assembly
   SortedArray< localIndex > m_regionFilter;
 
+  /// Accessor to the degrees of freedom of the elements, rebuilt only when the mesh changes
+  CachedElementViewAccessor< array1d< globalIndex >, arrayView1d< globalIndex const > > m_elemDofNumber;
+
 };
 
 } /* namespace geosx */
@@ -402,6 +402,64 @@ AssemblerKernel::Compute( localIndex const er,
 }
 
 
+/******************************** TransMatrixKernel ********************************/
+
+template< localIndex NF >
+localIndex
+TransMatrixKernel::Launch( CellElementSubRegion const & subRegion,
+                           arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
+                           ArrayOfArraysView< localIndex const > const & faceToNodes,
+                           arrayView1d< real64 const > const & transMultiplier,
+                           real64 const lengthTolerance,
+                           arrayView3d< real64 > const & transMatrix,
+                           arrayView1d< R1Tensor > const & transMatrixPerm )
+{
+  // get the map from elem to faces
+  arrayView2d< localIndex const > const elemToFaces = subRegion.faceList().toViewConst();
+
+  // get the element data needed for transmissibility computation
+  arrayView2d< real64 const > const elemCenter =
+    subRegion.getReference< array2d< real64 > >( CellBlock::viewKeyStruct::elementCenterString );
+  arrayView1d< real64 const > const elemVolume =
+    subRegion.getReference< array1d< real64 > >( CellBlock::viewKeyStruct::elementVolumeString );
+  arrayView1d< R1Tensor const > const elemPerm =
+    subRegion.getReference< array1d< R1Tensor > >( SinglePhaseBase::viewKeyStruct::permeabilityString );
+
+  RAJA::ReduceSum< parallelDeviceReduce, localIndex > numRecomputed( 0 );
+
+  forAll< parallelDevicePolicy< 32 > >( subRegion.size(), [=] GEOSX_DEVICE ( localIndex const ei )
+  {
+    // the cached matrix is still valid if the permeability has not changed since it was computed
+    if( elemPerm[ei][0] == transMatrixPerm[ei][0] &&
+        elemPerm[ei][1] == transMatrixPerm[ei][1] &&
+        elemPerm[ei][2] == transMatrixPerm[ei][2] )
+    {
+      return;
+    }
+
+    real64 const perm[ 3 ] = { elemPerm[ei][0], elemPerm[ei][1], elemPerm[ei][2] };
+
+    HybridFVMInnerProduct::QTPFACellInnerProductKernel::Compute< NF >( nodePosition,
+                                                                       transMultiplier,
+                                                                       faceToNodes,
+                                                                       elemToFaces[ei],
+                                                                       elemCenter[ei],
+                                                                       elemVolume[ei],
+                                                                       perm,
+                                                                       2,
+                                                                       lengthTolerance,
+                                                                       transMatrix[ei] );
+
+    for( localIndex i = 0; i < 3; ++i )
+    {
+      transMatrixPerm[ei][i] = perm[i];
+    }
+    numRecomputed += 1;
+  } );
+
+  return numRecomputed.get();
+}
+
 /******************************** FluxKernel ********************************/
 
 template< localIndex NF >
@@ -427,6 +485,7 @@ FluxKernel::Launch( localIndex er,
                     ElementViewConst< arrayView1d< globalIndex const > > const & elemDofNumber,
                     localIndex const rankOffset,
                     real64 const lengthTolerance,
+                    arrayView3d< real64 const > const & cachedTransMatrix,
                     real64 const dt,
                     CRSMatrixView< real64, globalIndex const > const & localMatrix,
                     arrayView1d< real64 > const & localRhs )
@@ -459,6 +518,9 @@ FluxKernel::Launch( localIndex er,
   arrayView2d< real64 const > const elemDens = fluid.density();
   arrayView2d< real64 const > const dElemDens_dp = fluid.dDensity_dPressure();
 
+  // use the cached transmissibility matrices if they have been precomputed
+  bool const useCachedTransMatrix = cachedTransMatrix.size( 0 ) == subRegion.size() && cachedTransMatrix.size( 1 ) == NF;
+
   // assemble the residual and Jacobian element by element
   // in this loop we assemble both equation types: mass conservation in the elements and constraints at the faces
   using KERNEL_POLICY = parallelDevicePolicy< 32 >;
@@ -467,20 +529,22 @@ FluxKernel::Launch( localIndex er,
     // transmissibility matrix
     stackArray2d< real64, NF *NF > transMatrix( NF, NF );
 
-    real64 const perm[ 3 ] = { elemPerm[ei][0], elemPerm[ei][1], elemPerm[ei][2] };
-
-    // recompute the local transmissibility matrix at each iteration
-    // we can decide later to precompute transMatrix if needed
-    HybridFVMInnerProduct::QTPFACellInnerProductKernel::Compute< NF >( nodePosition,
-                                                                       transMultiplier,
-                                                                       faceToNodes,
-                                                                       elemToFaces[ei],
-                                                                       elemCenter[ei],
-                                                                       elemVolume[ei],
-                                                                       perm,
-                                                                       2,
-                                                                       lengthTolerance,
-                                                                       transMatrix );
+    if( !useCachedTransMatrix )
+    {
+      real64 const perm[ 3 ] = { elemPerm[ei][0], elemPerm[ei][1], elemPerm[ei][2] };
+
+      // recompute the local transmissibility matrix at each iteration
+      HybridFVMInnerProduct::QTPFACellInnerProductKernel::Compute< NF >( nodePosition,
+                                                                         transMultiplier,
+                                                                         faceToNodes,
+                                                                         elemToFaces[ei],
+                                                                         elemCenter[ei],
+                                                                         elemVolume[ei],
+                                                                         perm,
+                                                                         2,
+                                                                         lengthTolerance,
+                                                                         transMatrix );
+    }
 
     // perform flux assembly in this element
     SinglePhaseHybridFVMKernels::AssemblerKernel::Compute< NF >( er, esr, ei,
@@ -505,7 +569,7 @@ FluxKernel::Launch( localIndex er,
                                                                  elemGhostRank[ei],
                                                                  rankOffset,
                                                                  dt,
-                                                                 transMatrix,
+                                                                 useCachedTransMatrix ? cachedTransMatrix[ei] : transMatrix.toSliceConst(),
                                                                  localMatrix,
                                                                  localRhs );
 
@@ -563,6 +627,22 @@ INST_AssembleKernelHelper( 6 );
 
 #undef INST_AssembleKernelHelper
 
+#define INST_TransMatrixKernel( NF ) \
+  template \
+  localIndex TransMatrixKernel::Launch< NF >( CellElementSubRegion const & subRegion, \
+                                              arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition, \
+                                              ArrayOfArraysView< localIndex const > const & faceToNodes, \
+                                              arrayView1d< real64 const > const & transMultiplier, \
+                                              real64 const lengthTolerance, \
+                                              arrayView3d< real64 > const & transMatrix, \
+                                              arrayView1d< R1Tensor > const & transMatrixPerm )
+
+INST_TransMatrixKernel( 4 );
+INST_TransMatrixKernel( 5 );
+INST_TransMatrixKernel( 6 );
+
+#undef INST_TransMatrixKernel
+
 #define INST_FluxKernel( NF ) \
   template \
   void FluxKernel::Launch< NF >( localIndex er, \
@@ -586,6 +666,7 @@ INST_AssembleKernelHelper( 6 );
                                  ElementViewConst< arrayView1d< globalIndex const > > const & elemDofNumber, \
                                  localIndex const rankOffset, \
                                  real64 const lengthTolerance, \
+                                 arrayView3d< real64 const > const & cachedTransMatrix, \
                                  real64 const dt, \
                                  CRSMatrixView< real64, globalIndex const > const & localMatrix, \
                                  arrayView1d< real64 > const & localRhs )
@@ -260,6 +260,37 @@ struct AssemblerKernel
 
 };
 
+/******************************** TransMatrixKernel ********************************/
+
+struct TransMatrixKernel
+{
+
+  /**
+   * @brief Update the cached transmissibility matrices of the elements whose permeability has changed
+   * @param[in] subRegion the cell element subregion
+   * @param[in] nodePosition position of the nodes
+   * @param[in] faceToNodes map from face to nodes
+   * @param[in] transMultiplier the transmissibility multiplier at the mesh faces
+   * @param[in] lengthTolerance the tolerance used in the trans calculations
+   * @param[inout] transMatrix the cached transmissibility matrices of the elements
+   * @param[inout] transMatrixPerm the permeability used to compute the cached matrices
+   * @return the number of recomputed matrices
+   *
+   * The matrices only depend on the geometry and on the permeability, so they are recomputed
+   * only in the elements in which the permeability differs from the one stored with the cache.
+   */
+  template< localIndex NF >
+  static localIndex
+  Launch( CellElementSubRegion const & subRegion,
+          arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
+          ArrayOfArraysView< localIndex const > const & faceToNodes,
+          arrayView1d< real64 const > const & transMultiplier,
+          real64 const lengthTolerance,
+          arrayView3d< real64 > const & transMatrix,
+          arrayView1d< R1Tensor > const & transMatrixPerm );
+
+};
+
 /******************************** FluxKernel ********************************/
 
 struct FluxKernel
@@ -296,6 +327,8 @@ struct FluxKernel
    * @param[in] dMobility_dp the derivatives of the mobilities in the domain wrt cell-centered pressure (non-local)
    * @param[in] elemDofNumber the dof numbers of the cells in the domain (non-local)
    * @param[in] rankOffset the offset of this rank
+   * @param[in] lengthTolerance the tolerance used in the trans calculations
+   * @param[in] cachedTransMatrix the cached transmissibility matrices, recomputed in each element if empty
    * @param[in] dt time step size
    * @param[inout] localMatrix the local Jacobian matrix
    * @param[inout] localRhs the local right-hand side vector
@@ -323,6 +356,7 @@ struct FluxKernel
           ElementViewConst< arrayView1d< globalIndex const > > const & elemDofNumber,
           localIndex const rankOffset,
           real64 const lengthTolerance,
+          arrayView3d< real64 const > const & cachedTransMatrix,
           real64 const dt,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs );
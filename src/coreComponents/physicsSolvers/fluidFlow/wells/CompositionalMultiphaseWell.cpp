@@ -349,12 +349,12 @@ void CompositionalMultiphaseWell::UpdateFluidModel( WellElementSubRegion & subRe
   {
     typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
 
-    CompositionalMultiphaseFlowKernels::FluidUpdateKernel::Launch< serialPolicy >( subRegion.size(),
-                                                                                   fluidWrapper,
-                                                                                   pres,
-                                                                                   dPres,
-                                                                                   m_temperature,
-                                                                                   compFrac );
+    CompositionalMultiphaseFlowKernels::FluidUpdateKernel::Launch< typename TYPEOFREF( castedFluid ) ::UpdatePolicy >( subRegion.size(),
+                                                                                                                       fluidWrapper,
+                                                                                                                       pres,
+                                                                                                                       dPres,
+                                                                                                                       m_temperature,
+                                                                                                                       compFrac );
   } );
 }
 
@@ -484,11 +484,11 @@ void CompositionalMultiphaseWell::InitializeWells( DomainPartition & domain )
     {
       typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
 
-      CompositionalMultiphaseFlowKernels::FluidUpdateKernel::Launch< serialPolicy >( subRegion.size(),
-                                                                                     fluidWrapper,
-                                                                                     wellElemPressure,
-                                                                                     m_temperature,
-                                                                                     wellElemCompFrac );
+      CompositionalMultiphaseFlowKernels::FluidUpdateKernel::Launch< typename TYPEOFREF( castedFluid ) ::UpdatePolicy >( subRegion.size(),
+                                                                                                                         fluidWrapper,
+                                                                                                                         wellElemPressure,
+                                                                                                                         m_temperature,
+                                                                                                                         wellElemCompFrac );
     } );
 
     CompDensInitializationKernel::Launch< parallelDevicePolicy<> >( subRegion.size(),
@@ -613,10 +613,11 @@ void CompositionalMultiphaseWell::AssembleVolumeBalanceTerms( real64 const GEOSX
 }
 
 
-real64
-CompositionalMultiphaseWell::CalculateResidualNorm( DomainPartition const & domain,
-                                                    DofManager const & dofManager,
-                                                    arrayView1d< real64 const > const & localRhs )
+void
+CompositionalMultiphaseWell::CalculateLocalResidualNorms( DomainPartition const & domain,
+                                                          DofManager const & dofManager,
+                                                          arrayView1d< real64 const > const & localRhs,
+                                                          ResidualNormParts & parts )
 {
   GEOSX_MARK_FUNCTION;
 
@@ -648,7 +649,13 @@ CompositionalMultiphaseWell::CalculateResidualNorm( DomainPartition const & doma
                                                         totalDens,
                                                         &localResidualNorm );
   } );
-  return sqrt( MpiWrapper::Sum( localResidualNorm, MPI_COMM_GEOSX ) );
+  parts.appendSum( localResidualNorm );
+}
+
+real64
+CompositionalMultiphaseWell::CombineResidualNorms( ResidualNormParts & parts )
+{
+  return sqrt( parts.nextSum() );
 }
 
 real64
@@ -884,13 +891,15 @@ CompositionalMultiphaseWell::ApplySystemSolution( DofManager const & dofManager,
   fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaPressureString ) );
   fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaGlobalCompDensityString ) );
   fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaMixtureConnRateString ) );
+  // update properties once the ghost values are received
   CommunicationTools::SynchronizeFields( fieldNames,
                                          domain.getMeshBody( 0 )->getMeshLevel( 0 ),
                                          domain.getNeighbors(),
-                                         true );
-
-  // update properties
-  UpdateStateAll( domain );
+                                         true,
+                                         [this, &domain]()
+  {
+    UpdateStateAll( domain );
+  } );
 
 }
 
@@ -899,6 +908,8 @@ void CompositionalMultiphaseWell::ChopNegativeDensities( DomainPartition & domai
   MeshLevel & meshLevel = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
   localIndex const NC = m_numComponents;
 
+  // the wells are too small to fill the device alone, their loops run concurrently
+  ConcurrentLaunches launches;
   forTargetSubRegions< WellElementSubRegion >( meshLevel, [&]( localIndex const,
                                                                WellElementSubRegion & subRegion )
   {
@@ -909,7 +920,7 @@ void CompositionalMultiphaseWell::ChopNegativeDensities( DomainPartition & domai
     arrayView2d< real64 > const & dWellElemCompDens =
       subRegion.getReference< array2d< real64 > >( viewKeyStruct::deltaGlobalCompDensityString );
 
-    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iwelem )
+    launches.forAll( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iwelem )
     {
       if( wellElemGhostRank[iwelem] < 0 )
       {
@@ -935,6 +946,7 @@ void CompositionalMultiphaseWell::ResetStateToBeginningOfStep( DomainPartition &
   MeshLevel & meshLevel = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
   localIndex const NC = m_numComponents;
 
+  ConcurrentLaunches launches;
   forTargetSubRegions< WellElementSubRegion >( meshLevel, [&]( localIndex const,
                                                                WellElementSubRegion & subRegion )
   {
@@ -947,7 +959,7 @@ void CompositionalMultiphaseWell::ResetStateToBeginningOfStep( DomainPartition &
     arrayView1d< real64 > const & dConnRate =
       subRegion.getReference< array1d< real64 > >( viewKeyStruct::deltaMixtureConnRateString );
 
-    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iwelem )
+    launches.forAll( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iwelem )
     {
       // extract solution and apply to dP
       dWellElemPressure[iwelem] = 0;
@@ -959,6 +971,9 @@ void CompositionalMultiphaseWell::ResetStateToBeginningOfStep( DomainPartition &
     } );
   } );
 
+  // the constitutive updates are launched on the default stream
+  launches.sync();
+
   // call constitutive models
   UpdateStateAll( domain );
 }
@@ -1141,6 +1156,7 @@ void CompositionalMultiphaseWell::FormPressureRelations( DomainPartition const &
                                                               localRhs );
     if( controlHasSwitched == 1 )
     {
+      wellControls.RecordControlSwitch();
       if( wellControls.GetControl() == WellControls::Control::BHP )
       {
         wellControls.SetControl( WellControls::Control::LIQUIDRATE,
@@ -1170,6 +1186,7 @@ void CompositionalMultiphaseWell::ImplicitStepComplete( real64 const & GEOSX_UNU
   MeshLevel & meshLevel = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
   localIndex const NC = m_numComponents;
 
+  ConcurrentLaunches launches;
   forTargetSubRegions< WellElementSubRegion >( meshLevel, [&]( localIndex const,
                                                                WellElementSubRegion & subRegion )
   {
@@ -1190,7 +1207,7 @@ void CompositionalMultiphaseWell::ImplicitStepComplete( real64 const & GEOSX_UNU
     arrayView1d< real64 const > const & dConnRate =
       subRegion.getReference< array1d< real64 > >( viewKeyStruct::deltaMixtureConnRateString );
 
-    forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iwelem )
+    launches.forAll( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iwelem )
     {
       wellElemPressure[iwelem] += dWellElemPressure[iwelem];
       for( localIndex ic = 0; ic < NC; ++ic )
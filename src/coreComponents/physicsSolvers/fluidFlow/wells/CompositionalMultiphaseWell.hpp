@@ -106,10 +106,14 @@ public:
   /**@{*/
 
 
+  virtual void
+  CalculateLocalResidualNorms( DomainPartition const & domain,
+                               DofManager const & dofManager,
+                               arrayView1d< real64 const > const & localRhs,
+                               ResidualNormParts & parts ) override;
+
   virtual real64
-  CalculateResidualNorm( DomainPartition const & domain,
-                         DofManager const & dofManager,
-                         arrayView1d< real64 const > const & localRhs ) override;
+  CombineResidualNorms( ResidualNormParts & parts ) override;
 
   virtual real64
   ScalingForSystemSolution( DomainPartition const & domain,
@@ -166,6 +170,10 @@ public:
 
   virtual string ResElementDofName() const override { return CompositionalMultiphaseFlow::viewKeyStruct::dofFieldString; }
 
+  virtual string WellElementConnectionRateName() const override { return viewKeyStruct::mixtureConnRateString; }
+
+  virtual string WellElementDeltaConnectionRateName() const override { return viewKeyStruct::deltaMixtureConnRateString; }
+
   virtual localIndex NumFluidComponents() const override { return m_numComponents; }
 
   virtual localIndex NumFluidPhases() const override { return m_numPhases; }
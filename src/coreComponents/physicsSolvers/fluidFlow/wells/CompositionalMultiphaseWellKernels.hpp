@@ -48,6 +48,7 @@ struct ControlEquationHelper
           real64 const & dWellElemPressure,
           real64 const & connRate,
           real64 const & dConnRate,
+          real64 const & switchTolerance,
           WellControls::Control & newControl )
   {
     // TODO: check all inactive constraints (possibly more than one) and switch the one which is most violated
@@ -63,7 +64,7 @@ struct ControlEquationHelper
     if( currentControl == WellControls::Control::BHP )
     {
       // the control is viable if the reference rate is below the max rate
-      controlIsViable = ( fabs( refRate ) <= fabs( targetConnRate ) );
+      controlIsViable = ( fabs( refRate ) <= ( 1.0 + switchTolerance ) * fabs( targetConnRate ) );
     }
     else // rate control
     {
@@ -71,12 +72,12 @@ struct ControlEquationHelper
       if( wellType == WellControls::Type::PRODUCER )
       {
         // targetBHP specifies a min pressure here
-        controlIsViable = ( refPressure >= targetBHP );
+        controlIsViable = ( refPressure >= ( 1.0 - switchTolerance ) * targetBHP );
       }
       else
       {
         // targetBHP specifies a max pressure here
-        controlIsViable = ( refPressure <= targetBHP );
+        controlIsViable = ( refPressure <= ( 1.0 + switchTolerance ) * targetBHP );
       }
     }
 
@@ -322,15 +323,15 @@ struct FluxKernel
         {
           if( oneSidedEqnRowIndices[i] >= 0 && oneSidedEqnRowIndices[i] < localMatrix.numRows() )
           {
-            localMatrix.addToRow< parallelDeviceAtomic >( oneSidedEqnRowIndices[i],
-                                                          &oneSidedDofColIndices_dRate,
-                                                          oneSidedFluxJacobian_dRate.data() + i,
-                                                          1 );
-            localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( oneSidedEqnRowIndices[i],
-                                                                              oneSidedDofColIndices_dPresCompUp.data(),
-                                                                              oneSidedFluxJacobian_dPresCompUp.data() + i * resNDOF,
-                                                                              resNDOF );
-            atomicAdd( parallelDeviceAtomic{}, &localRhs[oneSidedEqnRowIndices[i]], oneSidedFlux[i] );
+            localMatrix.addToRow< AtomicPolicy< POLICY > >( oneSidedEqnRowIndices[i],
+                                                            &oneSidedDofColIndices_dRate,
+                                                            oneSidedFluxJacobian_dRate.data() + i,
+                                                            1 );
+            localMatrix.addToRowBinarySearchUnsorted< AtomicPolicy< POLICY > >( oneSidedEqnRowIndices[i],
+                                                                                oneSidedDofColIndices_dPresCompUp.data(),
+                                                                                oneSidedFluxJacobian_dPresCompUp.data() + i * resNDOF,
+                                                                                resNDOF );
+            atomicAdd( AtomicPolicy< POLICY >{}, &localRhs[oneSidedEqnRowIndices[i]], oneSidedFlux[i] );
           }
         }
       }
@@ -395,15 +396,15 @@ struct FluxKernel
         {
           if( eqnRowIndices[i] >= 0 && eqnRowIndices[i] < localMatrix.numRows() )
           {
-            localMatrix.addToRow< parallelDeviceAtomic >( eqnRowIndices[i],
-                                                          &dofColIndices_dRate,
-                                                          localFluxJacobian_dRate.data() + i,
-                                                          1 );
-            localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( eqnRowIndices[i],
-                                                                              dofColIndices_dPresCompUp.data(),
-                                                                              localFluxJacobian_dPresCompUp.data() + i * resNDOF,
-                                                                              resNDOF );
-            atomicAdd( parallelDeviceAtomic{}, &localRhs[eqnRowIndices[i]], localFlux[i] );
+            localMatrix.addToRow< AtomicPolicy< POLICY > >( eqnRowIndices[i],
+                                                            &dofColIndices_dRate,
+                                                            localFluxJacobian_dRate.data() + i,
+                                                            1 );
+            localMatrix.addToRowBinarySearchUnsorted< AtomicPolicy< POLICY > >( eqnRowIndices[i],
+                                                                                dofColIndices_dPresCompUp.data(),
+                                                                                localFluxJacobian_dPresCompUp.data() + i * resNDOF,
+                                                                                resNDOF );
+            atomicAdd( AtomicPolicy< POLICY >{}, &localRhs[eqnRowIndices[i]], localFlux[i] );
           }
         }
       }
@@ -445,6 +446,8 @@ struct PressureRelationKernel
     WellControls::Control const currentControl = wellControls.GetControl();
     WellControls::Type const wellType = wellControls.GetType();
     localIndex const iwelemControl = wellControls.GetReferenceWellElementIndex();
+    real64 const switchTolerance = wellControls.GetControlSwitchTolerance();
+    bool const canSwitchControl = wellControls.CanSwitchControl();
 
     // compute a coefficient to normalize the momentum equation
     //real64 const targetBHP = wellControls.GetTargetBHP();
@@ -462,16 +465,21 @@ struct PressureRelationKernel
       if( iwelemNext < 0 && isLocallyOwned ) // if iwelemNext < 0, form control equation
       {
 
+        // the switch only changes the control equation, the Newton iterations continue from the current iterate
         WellControls::Control newControl = currentControl;
-        ControlEquationHelper::Switch( wellType,
-                                       currentControl,
-                                       targetBHP,
-                                       targetRate,
-                                       wellElemPressure[iwelemControl],
-                                       dWellElemPressure[iwelemControl],
-                                       connRate[iwelemControl],
-                                       dConnRate[iwelemControl],
-                                       newControl );
+        if( canSwitchControl )
+        {
+          ControlEquationHelper::Switch( wellType,
+                                         currentControl,
+                                         targetBHP,
+                                         targetRate,
+                                         wellElemPressure[iwelemControl],
+                                         dWellElemPressure[iwelemControl],
+                                         connRate[iwelemControl],
+                                         dConnRate[iwelemControl],
+                                         switchTolerance,
+                                         newControl );
+        }
         if( currentControl != newControl )
         {
           switchControl.max( 1 );
@@ -553,11 +561,11 @@ struct PressureRelationKernel
 
         if( eqnRowIndex >= 0 && eqnRowIndex < localMatrix.numRows() )
         {
-          localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( eqnRowIndex,
-                                                                            dofColIndices.data(),
-                                                                            localPresRelJacobian.data(),
-                                                                            2 * resNDOF );
-          atomicAdd( parallelDeviceAtomic{}, &localRhs[eqnRowIndex], localPresRel );
+          localMatrix.addToRowBinarySearchUnsorted< AtomicPolicy< POLICY > >( eqnRowIndex,
+                                                                              dofColIndices.data(),
+                                                                              localPresRelJacobian.data(),
+                                                                              2 * resNDOF );
+          atomicAdd( AtomicPolicy< POLICY >{}, &localRhs[eqnRowIndex], localPresRel );
         }
       }
     } );
@@ -1024,9 +1032,9 @@ struct PresCompFracInitializationKernel
     localIndex const iwelemControl = wellControls.GetReferenceWellElementIndex();
 
     // loop over all perforations to compute an average mixture density and component fraction
-    RAJA::ReduceSum< parallelDeviceReduce, real64 > sumTotalDensity( 0 );
-    RAJA::ReduceMin< parallelDeviceReduce, real64 > minResPressure( 1e10 );
-    RAJA::ReduceMax< parallelDeviceReduce, real64 > maxResPressure( 0 );
+    RAJA::ReduceSum< ReducePolicy< POLICY >, real64 > sumTotalDensity( 0 );
+    RAJA::ReduceMin< ReducePolicy< POLICY >, real64 > minResPressure( 1e10 );
+    RAJA::ReduceMax< ReducePolicy< POLICY >, real64 > maxResPressure( 0 );
     forAll< POLICY >( perforationSize, [=] GEOSX_HOST_DEVICE ( localIndex const iperf )
     {
       // get the reservoir (sub)region and element indices
@@ -1051,7 +1059,7 @@ struct PresCompFracInitializationKernel
     stackArray1d< real64, maxNumComp > sumCompFrac( NC );
     for( localIndex ic = 0; ic < NC; ++ic )
     {
-      RAJA::ReduceSum< parallelDeviceReduce, real64 > sum( 0.0 );
+      RAJA::ReduceSum< ReducePolicy< POLICY >, real64 > sum( 0.0 );
       forAll< POLICY >( perforationSize, [=] GEOSX_HOST_DEVICE ( localIndex const iperf )
       {
         // get the reservoir (sub)region and element indices
@@ -280,6 +280,7 @@ void SinglePhaseWell::FormPressureRelations( DomainPartition const & domain,
 
     if( controlHasSwitched == 1 )
     {
+      wellControls.RecordControlSwitch();
       if( wellControls.GetControl() == WellControls::Control::BHP )
       {
         wellControls.SetControl( WellControls::Control::LIQUIDRATE,
@@ -380,10 +381,11 @@ void SinglePhaseWell::ComputePerforationRates( WellElementSubRegion & subRegion,
 }
 
 
-real64
-SinglePhaseWell::CalculateResidualNorm( DomainPartition const & domain,
-                                        DofManager const & dofManager,
-                                        arrayView1d< real64 const > const & localRhs )
+void
+SinglePhaseWell::CalculateLocalResidualNorms( DomainPartition const & domain,
+                                              DofManager const & dofManager,
+                                              arrayView1d< real64 const > const & localRhs,
+                                              ResidualNormParts & parts )
 {
   GEOSX_MARK_FUNCTION;
 
@@ -413,8 +415,14 @@ SinglePhaseWell::CalculateResidualNorm( DomainPartition const & domain,
 
   } );
 
+  parts.appendSum( localResidualNorm );
+}
+
+real64
+SinglePhaseWell::CombineResidualNorms( ResidualNormParts & parts )
+{
   // compute global residual norm
-  return sqrt( MpiWrapper::Sum( localResidualNorm, MPI_COMM_GEOSX ) );
+  return sqrt( parts.nextSum() );
 }
 
 bool SinglePhaseWell::CheckSystemSolution( DomainPartition const & domain,
@@ -484,13 +492,15 @@ SinglePhaseWell::ApplySystemSolution( DofManager const & dofManager,
   std::map< string, string_array > fieldNames;
   fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaPressureString ) );
   fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaConnRateString ) );
+  // update properties once the ghost values are received
   CommunicationTools::SynchronizeFields( fieldNames,
                                          domain.getMeshBody( 0 )->getMeshLevel( 0 ),
                                          domain.getNeighbors(),
-                                         true );
-
-  // update properties
-  UpdateStateAll( domain );
+                                         true,
+                                         [this, &domain]()
+  {
+    UpdateStateAll( domain );
+  } );
 }
 
 void SinglePhaseWell::ResetStateToBeginningOfStep( DomainPartition & domain )
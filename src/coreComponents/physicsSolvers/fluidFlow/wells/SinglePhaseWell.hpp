@@ -102,10 +102,14 @@ public:
    */
   /**@{*/
 
+  virtual void
+  CalculateLocalResidualNorms( DomainPartition const & domain,
+                               DofManager const & dofManager,
+                               arrayView1d< real64 const > const & localRhs,
+                               ResidualNormParts & parts ) override;
+
   virtual real64
-  CalculateResidualNorm( DomainPartition const & domain,
-                         DofManager const & dofManager,
-                         arrayView1d< real64 const > const & localRhs ) override;
+  CombineResidualNorms( ResidualNormParts & parts ) override;
 
   virtual bool
   CheckSystemSolution( DomainPartition const & domain,
@@ -133,6 +137,10 @@ public:
 
   virtual string ResElementDofName() const override { return SinglePhaseBase::viewKeyStruct::pressureString; }
 
+  virtual string WellElementConnectionRateName() const override { return viewKeyStruct::connRateString; }
+
+  virtual string WellElementDeltaConnectionRateName() const override { return viewKeyStruct::deltaConnRateString; }
+
   virtual localIndex NumFluidComponents() const override { return 1; }
 
   virtual localIndex NumFluidPhases() const override { return 1; }
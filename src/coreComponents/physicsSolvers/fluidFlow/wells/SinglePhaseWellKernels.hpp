@@ -47,6 +47,7 @@ struct ControlEquationHelper
           real64 const & dWellElemPressure,
           real64 const & connRate,
           real64 const & dConnRate,
+          real64 const & switchTolerance,
           WellControls::Control & newControl )
   {
     // if isViable is true at the end of the following checks, no need to switch
@@ -59,7 +60,7 @@ struct ControlEquationHelper
     if( currentControl == WellControls::Control::BHP )
     {
       // the control is viable if the reference rate is below the max rate
-      controlIsViable = ( fabs( refRate ) <= fabs( targetConnRate ) );
+      controlIsViable = ( fabs( refRate ) <= ( 1.0 + switchTolerance ) * fabs( targetConnRate ) );
     }
     else // rate control
     {
@@ -67,12 +68,12 @@ struct ControlEquationHelper
       if( wellType == WellControls::Type::PRODUCER )
       {
         // targetBHP specifies a min pressure here
-        controlIsViable = ( refPressure >= targetBHP );
+        controlIsViable = ( refPressure >= ( 1.0 - switchTolerance ) * targetBHP );
       }
       else
       {
         // targetBHP specifies a max pressure here
-        controlIsViable = ( refPressure <= targetBHP );
+        controlIsViable = ( refPressure <= ( 1.0 + switchTolerance ) * targetBHP );
       }
     }
 
@@ -201,11 +202,11 @@ struct FluxKernel
 
         if( oneSidedEqnRowIndex >= 0 && oneSidedEqnRowIndex < localMatrix.numRows() )
         {
-          localMatrix.addToRow< parallelDeviceAtomic >( oneSidedEqnRowIndex,
-                                                        &oneSidedDofColIndex_dRate,
-                                                        &oneSidedLocalFluxJacobian_dRate,
-                                                        1 );
-          atomicAdd( parallelDeviceAtomic{}, &localRhs[oneSidedEqnRowIndex], oneSidedLocalFlux );
+          localMatrix.addToRow< AtomicPolicy< POLICY > >( oneSidedEqnRowIndex,
+                                                          &oneSidedDofColIndex_dRate,
+                                                          &oneSidedLocalFluxJacobian_dRate,
+                                                          1 );
+          atomicAdd( AtomicPolicy< POLICY >{}, &localRhs[oneSidedEqnRowIndex], oneSidedLocalFlux );
         }
       }
       else
@@ -236,11 +237,11 @@ struct FluxKernel
         {
           if( eqnRowIndices[i] >= 0 && eqnRowIndices[i] < localMatrix.numRows() )
           {
-            localMatrix.addToRow< parallelDeviceAtomic >( eqnRowIndices[i],
-                                                          &dofColIndex_dRate,
-                                                          &localFluxJacobian_dRate[i],
-                                                          1 );
-            atomicAdd( parallelDeviceAtomic{}, &localRhs[eqnRowIndices[i]], localFlux[i] );
+            localMatrix.addToRow< AtomicPolicy< POLICY > >( eqnRowIndices[i],
+                                                            &dofColIndex_dRate,
+                                                            &localFluxJacobian_dRate[i],
+                                                            1 );
+            atomicAdd( AtomicPolicy< POLICY >{}, &localRhs[eqnRowIndices[i]], localFlux[i] );
           }
         }
       }
@@ -277,6 +278,8 @@ struct PressureRelationKernel
     WellControls::Control const currentControl = wellControls.GetControl();
     WellControls::Type const wellType = wellControls.GetType();
     localIndex const iwelemControl = wellControls.GetReferenceWellElementIndex();
+    real64 const switchTolerance = wellControls.GetControlSwitchTolerance();
+    bool const canSwitchControl = wellControls.CanSwitchControl();
 
     RAJA::ReduceMax< REDUCE_POLICY, localIndex > switchControl( 0 );
 
@@ -288,16 +291,21 @@ struct PressureRelationKernel
 
       if( iwelemNext < 0 && isLocallyOwned ) // if iwelemNext < 0, form control equation
       {
+        // the switch only changes the control equation, the Newton iterations continue from the current iterate
         WellControls::Control newControl = currentControl;
-        ControlEquationHelper::Switch( wellType,
-                                       currentControl,
-                                       targetBHP,
-                                       targetRate,
-                                       wellElemPressure[iwelemControl],
-                                       dWellElemPressure[iwelemControl],
-                                       connRate[iwelemControl],
-                                       dConnRate[iwelemControl],
-                                       newControl );
+        if( canSwitchControl )
+        {
+          ControlEquationHelper::Switch( wellType,
+                                         currentControl,
+                                         targetBHP,
+                                         targetRate,
+                                         wellElemPressure[iwelemControl],
+                                         dWellElemPressure[iwelemControl],
+                                         connRate[iwelemControl],
+                                         dConnRate[iwelemControl],
+                                         switchTolerance,
+                                         newControl );
+        }
         if( currentControl != newControl )
         {
           switchControl.max( 1 );
@@ -355,11 +363,11 @@ struct PressureRelationKernel
 
         if( eqnRowIndex >= 0 && eqnRowIndex < localMatrix.numRows() )
         {
-          localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( eqnRowIndex,
-                                                                            &dofColIndices[0],
-                                                                            &localPresRelJacobian[0],
-                                                                            2 );
-          atomicAdd( parallelDeviceAtomic{}, &localRhs[eqnRowIndex], localPresRel );
+          localMatrix.addToRowBinarySearchUnsorted< AtomicPolicy< POLICY > >( eqnRowIndex,
+                                                                              &dofColIndices[0],
+                                                                              &localPresRelJacobian[0],
+                                                                              2 );
+          atomicAdd( AtomicPolicy< POLICY >{}, &localRhs[eqnRowIndex], localPresRel );
         }
       }
     } );
@@ -540,9 +548,9 @@ struct PresInitializationKernel
     localIndex const iwelemControl = wellControls.GetReferenceWellElementIndex();
 
     // loop over all perforations to compute an average density
-    RAJA::ReduceSum< parallelDeviceReduce, real64 > sumDensity( 0 );
-    RAJA::ReduceMin< parallelDeviceReduce, real64 > minResPressure( 1e10 );
-    RAJA::ReduceMax< parallelDeviceReduce, real64 > maxResPressure( 0 );
+    RAJA::ReduceSum< ReducePolicy< POLICY >, real64 > sumDensity( 0 );
+    RAJA::ReduceMin< ReducePolicy< POLICY >, real64 > minResPressure( 1e10 );
+    RAJA::ReduceMax< ReducePolicy< POLICY >, real64 > maxResPressure( 0 );
     forAll< POLICY >( perforationSize, [=] GEOSX_HOST_DEVICE ( localIndex const iperf )
     {
 
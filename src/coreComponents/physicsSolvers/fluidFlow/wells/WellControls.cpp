@@ -30,7 +30,10 @@ WellControls::WellControls( string const & name, Group * const parent )
   m_refWellElemIndex( -1 ),
   m_currentControl( Control::BHP ),
   m_targetBHP( 0.0 ),
-  m_targetRate( 0.0 )
+  m_targetRate( 0.0 ),
+  m_controlSwitchTolerance( 0.0 ),
+  m_maxControlSwitches( 0 ),
+  m_numControlSwitches( 0 )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
@@ -58,6 +61,18 @@ WellControls::WellControls( string const & name, Group * const parent )
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Global component densities for the injection stream" );
 
+  registerWrapper( viewKeyStruct::controlSwitchToleranceString, &m_controlSwitchTolerance )->
+    setApplyDefaultValue( 0.0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Relative margin by which the inactive constraint must be violated before the control switches "
+                    "during the Newton iterations, to prevent the control from oscillating" );
+
+  registerWrapper( viewKeyStruct::maxControlSwitchesString, &m_maxControlSwitches )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum number of control switches per time step, after which the control is kept "
+                    "until the end of the step. No limit if zero" );
+
 }
 
 
@@ -94,6 +109,9 @@ void WellControls::PostProcessInput()
     GEOSX_ERROR( "Target rate for well "<< getName() << " is negative" );
   }
 
+  GEOSX_ERROR_IF( m_controlSwitchTolerance < 0.0 || m_controlSwitchTolerance >= 1.0,
+                  "Invalid control switch tolerance for well " << getName() );
+
   // 4) check injection stream
   if( !m_injectionStream.empty())
   {
@@ -172,12 +172,42 @@ public:
   const real64 & GetTargetRate() const { return m_targetRate; }
 
 
+  /**
+   * @brief Set the target rate, without changing the control type.
+   * @param[in] rate the target rate, negative for a producer
+   */
+  void SetTargetRate( real64 const rate ) { m_targetRate = rate; }
+
+
   /**
    * @brief Const accessor for the composition of the injection rate
    * @return a global component fraction vector
    */
   arrayView1d< real64 const > GetInjectionStream() const { return m_injectionStream; }
 
+  /**
+   * @brief Get the relative margin by which the inactive constraint must be violated to switch the control.
+   * @return the switch tolerance
+   */
+  real64 GetControlSwitchTolerance() const { return m_controlSwitchTolerance; }
+
+  /**
+   * @brief Check if the control may still switch during the current time step.
+   * @return true if the number of switches in the time step is below the limit
+   */
+  bool CanSwitchControl() const
+  { return m_maxControlSwitches <= 0 || m_numControlSwitches < m_maxControlSwitches; }
+
+  /**
+   * @brief Count a control switch in the current time step.
+   */
+  void RecordControlSwitch() { ++m_numControlSwitches; }
+
+  /**
+   * @brief Reset the count of control switches at the beginning of a time step.
+   */
+  void ResetControlSwitches() { m_numControlSwitches = 0; }
+
   ///@}
 
   /// @cond DO_NOT_DOCUMENT
@@ -202,6 +232,10 @@ public:
     static constexpr auto targetRateString       = "targetRate";
     /// String key for the well injection stream
     static constexpr auto injectionStreamString  = "injectionStream";
+    /// String key for the control switch tolerance
+    static constexpr auto controlSwitchToleranceString = "controlSwitchTolerance";
+    /// String key for the maximum number of control switches per time step
+    static constexpr auto maxControlSwitchesString = "maxControlSwitchesPerStep";
     /// ViewKey for the reference index (currently unused)
     dataRepository::ViewKey referenceIndex  = { refWellElemIndexString };
     /// ViewKey for the well type
@@ -253,6 +287,15 @@ private:
   /// Vector with global component fractions at the injector
   array1d< real64 >  m_injectionStream;
 
+  /// Relative margin by which the inactive constraint must be violated to switch the control
+  real64 m_controlSwitchTolerance;
+
+  /// Maximum number of control switches per time step, no limit if zero
+  integer m_maxControlSwitches;
+
+  /// Number of control switches in the current time step
+  integer m_numControlSwitches;
+
 };
 
 ENUM_STRINGS( WellControls::Type, "producer", "injector" )
@@ -0,0 +1,200 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/*
+ * @file WellGroupControls.cpp
+ */
+
+#include "WellGroupControls.hpp"
+
+#include "dataRepository/InputFlags.hpp"
+#include "physicsSolvers/fluidFlow/wells/WellControls.hpp"
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+WellGroupControls::WellGroupControls( string const & name, Group * const parent )
+  : Group( name, parent ),
+  m_maxGroupRate( 0.0 ),
+  m_groupSwitchTolerance( 0.0 ),
+  m_isActive( false )
+{
+  setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
+
+  enableLogLevelInput();
+
+  registerWrapper( viewKeyStruct::wellControlsNamesString, &m_wellControlsNames )->
+    setInputFlag( InputFlags::REQUIRED )->
+    setDescription( "Names of the well controls of the wells of the group" );
+
+  registerWrapper( viewKeyStruct::maxGroupRateString, &m_maxGroupRate )->
+    setInputFlag( InputFlags::REQUIRED )->
+    setDescription( "Maximum total rate of the wells of the group, in the units of the target rates of the wells" );
+
+  registerWrapper( viewKeyStruct::groupSwitchToleranceString, &m_groupSwitchTolerance )->
+    setApplyDefaultValue( 0.0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Relative margin by which the total rate of the wells must exceed the maximum group rate "
+                    "to activate the group constraint" );
+
+  registerWrapper( viewKeyStruct::wellMaxRatesString, &m_wellMaxRates )->
+    setInputFlag( InputFlags::FALSE )->
+    setDescription( "Target rates given in the controls of the wells, restored at the beginning of each time step" );
+}
+
+
+WellGroupControls::~WellGroupControls()
+{}
+
+
+void WellGroupControls::ResetGroupControl()
+{
+  m_isActive = false;
+  for( localIndex iwell = 0; iwell < NumWells(); ++iwell )
+  {
+    WellControls & wellControls = *m_wellControls[iwell];
+    real64 const sign = ( wellControls.GetType() == WellControls::Type::PRODUCER ) ? -1.0 : 1.0;
+    wellControls.SetTargetRate( sign * m_wellMaxRates[iwell] );
+  }
+}
+
+
+void WellGroupControls::UpdateTargetRates( arrayView1d< real64 const > const & wellRates,
+                                           localIndex const firstWell )
+{
+  localIndex const numWells = NumWells();
+
+  real64 totalRate = 0.0;
+  for( localIndex iwell = 0; iwell < numWells; ++iwell )
+  {
+    totalRate += std::fabs( wellRates[firstWell + iwell] );
+  }
+
+  if( !m_isActive && totalRate > ( 1.0 + m_groupSwitchTolerance ) * m_maxGroupRate )
+  {
+    m_isActive = true;
+    GEOSX_LOG_LEVEL_RANK_0( 1, "Group constraint " << getName() << " activated: the total rate " << totalRate
+                                                   << " exceeds the maximum group rate " << m_maxGroupRate );
+  }
+
+  if( !m_isActive )
+  {
+    return;
+  }
+
+  // the wells without any rate keep a small share, so that they are not shut until the end of the time step
+  real64 const minGuideRate = 1e-6 * totalRate / numWells;
+  array1d< real64 > guideRates( numWells );
+  array1d< real64 > targetRates( numWells );
+  for( localIndex iwell = 0; iwell < numWells; ++iwell )
+  {
+    guideRates[iwell] = std::max( std::fabs( wellRates[firstWell + iwell] ), minGuideRate );
+  }
+
+  AllocateGroupRate( m_maxGroupRate, guideRates, m_wellMaxRates, targetRates );
+
+  for( localIndex iwell = 0; iwell < numWells; ++iwell )
+  {
+    WellControls & wellControls = *m_wellControls[iwell];
+    real64 const sign = ( wellControls.GetType() == WellControls::Type::PRODUCER ) ? -1.0 : 1.0;
+    wellControls.SetTargetRate( sign * targetRates[iwell] );
+  }
+}
+
+
+void WellGroupControls::AllocateGroupRate( real64 const groupRate,
+                                           arrayView1d< real64 const > const & guideRates,
+                                           arrayView1d< real64 const > const & maxRates,
+                                           arrayView1d< real64 > const & targetRates )
+{
+  localIndex const numWells = guideRates.size();
+
+  // the wells reaching their maximum rate are capped, and the rest of the group rate is split again between the others
+  array1d< integer > isCapped( numWells );
+  real64 remainingRate = groupRate;
+  bool hasNewCap = true;
+  while( hasNewCap )
+  {
+    hasNewCap = false;
+
+    real64 guideSum = 0.0;
+    for( localIndex iwell = 0; iwell < numWells; ++iwell )
+    {
+      if( isCapped[iwell] == 0 )
+      {
+        guideSum += guideRates[iwell];
+      }
+    }
+
+    for( localIndex iwell = 0; iwell < numWells; ++iwell )
+    {
+      if( isCapped[iwell] == 1 )
+      {
+        continue;
+      }
+      targetRates[iwell] = ( guideSum > 0.0 ) ? remainingRate * guideRates[iwell] / guideSum : 0.0;
+      if( targetRates[iwell] >= maxRates[iwell] )
+      {
+        targetRates[iwell] = maxRates[iwell];
+        isCapped[iwell] = 1;
+        remainingRate -= maxRates[iwell];
+        hasNewCap = true;
+      }
+    }
+  }
+}
+
+
+void WellGroupControls::PostProcessInput()
+{
+  GEOSX_ERROR_IF( m_wellControlsNames.empty(),
+                  "The group " << getName() << " has no well" );
+
+  GEOSX_ERROR_IF( m_maxGroupRate <= 0.0,
+                  "The maximum rate of the group " << getName() << " must be positive" );
+
+  GEOSX_ERROR_IF( m_groupSwitchTolerance < 0.0 || m_groupSwitchTolerance >= 1.0,
+                  "Invalid group switch tolerance for the group " << getName() );
+}
+
+
+void WellGroupControls::InitializePostInitialConditions_PreSubGroups( Group * const GEOSX_UNUSED_PARAM( rootGroup ) )
+{
+  localIndex const numWells = NumWells();
+
+  m_wellControls.clear();
+  for( localIndex iwell = 0; iwell < numWells; ++iwell )
+  {
+    WellControls * const wellControls = getParent()->GetGroup< WellControls >( m_wellControlsNames[iwell] );
+    GEOSX_ERROR_IF( wellControls == nullptr,
+                    "Well constraint " << m_wellControlsNames[iwell] << " of the group " << getName() << " not found" );
+    GEOSX_ERROR_IF( iwell > 0 && wellControls->GetType() != m_wellControls.front()->GetType(),
+                    "The wells of the group " << getName() << " must be all producers or all injectors" );
+    m_wellControls.emplace_back( wellControls );
+  }
+
+  // after a restart, the targets of the controls may have been set by the group, so the saved input targets are kept
+  if( m_wellMaxRates.size() != numWells )
+  {
+    m_wellMaxRates.resize( numWells );
+    for( localIndex iwell = 0; iwell < numWells; ++iwell )
+    {
+      m_wellMaxRates[iwell] = std::fabs( m_wellControls[iwell]->GetTargetRate() );
+    }
+  }
+}
+
+} //namespace geosx
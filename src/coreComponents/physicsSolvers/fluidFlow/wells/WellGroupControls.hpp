@@ -0,0 +1,198 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/*
+ * @file WellGroupControls.hpp
+ */
+
+
+#ifndef GEOSX_PHYSICSSOLVERS_FLUIDFLOW_WELLS_WELLGROUPCONTROLS_HPP
+#define GEOSX_PHYSICSSOLVERS_FLUIDFLOW_WELLS_WELLGROUPCONTROLS_HPP
+
+#include "dataRepository/Group.hpp"
+
+namespace geosx
+{
+namespace dataRepository
+{
+namespace keys
+{
+static constexpr auto wellGroupControls = "WellGroupControls";
+}
+}
+
+class WellControls;
+
+/**
+ * @class WellGroupControls
+ * @brief This class describes a rate constraint shared by a group of wells.
+ *
+ * The group is a small facility network, replicated on all the ranks: the well solver gathers the rates
+ * of all the wells of all the groups with a single reduction per Newton iteration, then each group
+ * updates the target rates of its wells locally, without any other communication.
+ * When the total rate of the wells exceeds the maximum group rate, the group rate is split between the
+ * wells in proportion to their current rates, without exceeding the target rate of each well. The group
+ * constraint then stays active until the end of the time step, to prevent the targets from oscillating.
+ */
+class WellGroupControls : public dataRepository::Group
+{
+public:
+
+  /**
+   * @name Constructor / Destructor
+   */
+  ///@{
+
+  /**
+   * @brief Constructor for WellGroupControls Objects.
+   * @param[in] name the name of this instantiation of WellGroupControls in the repository
+   * @param[in] parent the parent group of this instantiation of WellGroupControls
+   */
+  explicit WellGroupControls( string const & name, dataRepository::Group * const parent );
+
+  /**
+   * @brief Default destructor.
+   */
+  ~WellGroupControls() override;
+
+  /**
+   * @brief Deleted default constructor.
+   */
+  WellGroupControls() = delete;
+
+  /**
+   * @brief Deleted copy constructor.
+   */
+  WellGroupControls( WellGroupControls const & ) = delete;
+
+  /**
+   * @brief Deleted move constructor.
+   */
+  WellGroupControls( WellGroupControls && ) = delete;
+
+  /**
+   * @brief Deleted assignment operator.
+   * @return a reference to a group control object
+   */
+  WellGroupControls & operator=( WellGroupControls const & ) = delete;
+
+  /**
+   * @brief Deleted move operator.
+   * @return a reference to a group control object
+   */
+  WellGroupControls & operator=( WellGroupControls && ) = delete;
+
+  ///@}
+
+  /**
+   * @brief Get the names of the controls of the wells of the group.
+   * @return the names of the well controls
+   */
+  arrayView1d< string const > GetWellControlsNames() const { return m_wellControlsNames; }
+
+  /**
+   * @brief Get the number of wells in the group.
+   * @return the number of wells
+   */
+  localIndex NumWells() const { return m_wellControlsNames.size(); }
+
+  /**
+   * @brief Check if the group constraint is active in the current time step.
+   * @return true if the target rates of the wells are set by the group
+   */
+  bool IsActive() const { return m_isActive; }
+
+  /**
+   * @brief Deactivate the group constraint and restore the target rates of the wells at the beginning of a time step.
+   */
+  void ResetGroupControl();
+
+  /**
+   * @brief Update the target rates of the wells from their current rates.
+   * @param[in] wellRates the current rates of the wells of all the groups, identical on all the ranks
+   * @param[in] firstWell the index of the first well of this group in @p wellRates
+   */
+  void UpdateTargetRates( arrayView1d< real64 const > const & wellRates,
+                          localIndex const firstWell );
+
+  /**
+   * @brief Split a group rate between wells in proportion to their guide rates, without exceeding their maximum rates.
+   * @param[in] groupRate the rate of the group
+   * @param[in] guideRates the (non-negative) guide rates of the wells
+   * @param[in] maxRates the maximum rates of the wells
+   * @param[out] targetRates the target rates of the wells, equal to the maximum rates if they add up to less than the group rate
+   */
+  static void AllocateGroupRate( real64 const groupRate,
+                                 arrayView1d< real64 const > const & guideRates,
+                                 arrayView1d< real64 const > const & maxRates,
+                                 arrayView1d< real64 > const & targetRates );
+
+  /**
+   * @brief Struct to serve as a container for variable strings and keys.
+   * @struct viewKeyStruct
+   */
+  struct viewKeyStruct
+  {
+    /// String key for the names of the well controls of the group
+    static constexpr auto wellControlsNamesString = "wellControlsNames";
+    /// String key for the maximum group rate
+    static constexpr auto maxGroupRateString = "maxGroupRate";
+    /// String key for the group switch tolerance
+    static constexpr auto groupSwitchToleranceString = "groupSwitchTolerance";
+    /// String key for the target rates of the wells given in their controls
+    static constexpr auto wellMaxRatesString = "wellMaxRates";
+  }
+  /// ViewKey struct for the WellGroupControls class
+  viewKeysWellGroupControls;
+
+protected:
+
+  /**
+   * @brief This function provides capability to post process input values prior to
+   * any other initialization operations.
+   */
+  virtual void PostProcessInput() override;
+
+  /**
+   * @brief Called by InitializePostInitialConditions() prior to initializing sub-Groups.
+   * @param[in] rootGroup A group that is passed in to the initialization functions
+   *                  in order to facilitate the initialization.
+   */
+  virtual void InitializePostInitialConditions_PreSubGroups( Group * const rootGroup ) override;
+
+private:
+
+  /// Names of the controls of the wells of the group
+  array1d< string > m_wellControlsNames;
+
+  /// Maximum total rate of the wells of the group
+  real64 m_maxGroupRate;
+
+  /// Relative margin by which the group rate must be exceeded to activate the group constraint
+  real64 m_groupSwitchTolerance;
+
+  /// Absolute values of the target rates given in the controls of the wells
+  array1d< real64 > m_wellMaxRates;
+
+  /// Controls of the wells of the group
+  std::vector< WellControls * > m_wellControls;
+
+  /// Flag telling if the group constraint is active in the current time step
+  bool m_isActive;
+
+};
+
+} //namespace geosx
+
+#endif //GEOSX_PHYSICSSOLVERS_FLUIDFLOW_WELLS_WELLGROUPCONTROLS_HPP
@@ -19,7 +19,9 @@
 #include "WellSolverBase.hpp"
 
 #include "managers/DomainPartition.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
 #include "physicsSolvers/fluidFlow/wells/WellControls.hpp"
+#include "physicsSolvers/fluidFlow/wells/WellGroupControls.hpp"
 #include "mesh/WellElementRegion.hpp"
 #include "mesh/WellElementSubRegion.hpp"
 #include "meshUtilities/PerforationData.hpp"
@@ -52,6 +54,10 @@ Group * WellSolverBase::CreateChild( string const & childKey, string const & chi
   {
     rval = RegisterGroup< WellControls >( childName );
   }
+  else if( childKey == keys::wellGroupControls )
+  {
+    rval = RegisterGroup< WellGroupControls >( childName );
+  }
   else
   {
     SolverBase::CreateChild( childKey, childName );
@@ -62,6 +68,7 @@ Group * WellSolverBase::CreateChild( string const & childKey, string const & chi
 void WellSolverBase::ExpandObjectCatalogs()
 {
   CreateChild( keys::wellControls, keys::wellControls );
+  CreateChild( keys::wellGroupControls, keys::wellGroupControls );
 }
 
 
@@ -125,6 +132,18 @@ void WellSolverBase::ImplicitStepSetup( real64 const & time_n,
     InitializeWells( domain );
   }
 
+  // the controls may switch again in the new time step
+  MeshLevel const & meshLevel = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  forTargetSubRegions< WellElementSubRegion >( meshLevel, [&]( localIndex const,
+                                                               WellElementSubRegion const & subRegion )
+  {
+    GetWellControls( subRegion ).ResetControlSwitches();
+  } );
+  forSubGroups< WellGroupControls >( [&]( WellGroupControls & groupControls )
+  {
+    groupControls.ResetGroupControl();
+  } );
+
   // set deltas to zero and recompute dependent quantities
   ResetStateToBeginningOfStep( domain );
 }
@@ -142,6 +161,9 @@ void WellSolverBase::AssembleSystem( real64 const time,
   // then assemble the volume balance equations
   AssembleVolumeBalanceTerms( time, dt, domain, dofManager, localMatrix, localRhs );
 
+  // then update the targets of the wells constrained by a group
+  UpdateGroupControls( domain );
+
   // then assemble the pressure relations between well elements
   FormPressureRelations( domain, dofManager, localMatrix, localRhs );
 }
@@ -193,6 +215,70 @@ void WellSolverBase::InitializePostInitialConditions_PreSubGroups( Group * const
 
   // Precompute solver-specific constant data (e.g. gravity-coefficient)
   PrecomputeData( domain );
+
+  // the rates of the wells of the groups are gathered in the order of the groups
+  m_groupWellIndices.clear();
+  forSubGroups< WellGroupControls >( [&]( WellGroupControls const & groupControls )
+  {
+    for( string const & wellControlsName : groupControls.GetWellControlsNames() )
+    {
+      GEOSX_ERROR_IF( m_groupWellIndices.count( wellControlsName ) > 0,
+                      "Well constraint " << wellControlsName << " is in more than one group" );
+      localIndex const groupWellIndex = LvArray::integerConversion< localIndex >( m_groupWellIndices.size() );
+      m_groupWellIndices[wellControlsName] = groupWellIndex;
+    }
+  } );
+}
+
+void WellSolverBase::UpdateGroupControls( DomainPartition const & domain )
+{
+  // the groups are given in the input, hence known on all the ranks
+  if( m_groupWellIndices.empty() )
+  {
+    return;
+  }
+
+  GEOSX_MARK_FUNCTION;
+
+  localIndex const numGroupWells = LvArray::integerConversion< localIndex >( m_groupWellIndices.size() );
+  array1d< real64 > localWellRates( numGroupWells );
+  array1d< real64 > wellRates( numGroupWells );
+
+  // each well rate is given by the rank owning the well head
+  MeshLevel const & meshLevel = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  forTargetSubRegions< WellElementSubRegion >( meshLevel, [&]( localIndex const,
+                                                               WellElementSubRegion const & subRegion )
+  {
+    std::map< string, localIndex >::const_iterator const groupWell = m_groupWellIndices.find( subRegion.GetWellControlsName() );
+    if( !subRegion.IsLocallyOwned() || groupWell == m_groupWellIndices.end() )
+    {
+      return;
+    }
+
+    arrayView1d< real64 const > const connRate =
+      subRegion.getReference< array1d< real64 > >( WellElementConnectionRateName() );
+    arrayView1d< real64 const > const dConnRate =
+      subRegion.getReference< array1d< real64 > >( WellElementDeltaConnectionRateName() );
+    connRate.move( LvArray::MemorySpace::CPU, false );
+    dConnRate.move( LvArray::MemorySpace::CPU, false );
+
+    localIndex const iwelemControl = GetWellControls( subRegion ).GetReferenceWellElementIndex();
+    localWellRates[groupWell->second] = connRate[iwelemControl] + dConnRate[iwelemControl];
+  } );
+
+  // a single reduction for all the wells of all the groups
+  MpiWrapper::allReduce( localWellRates.data(),
+                         wellRates.data(),
+                         LvArray::integerConversion< int >( numGroupWells ),
+                         MPI_SUM,
+                         MPI_COMM_GEOSX );
+
+  localIndex firstWell = 0;
+  forSubGroups< WellGroupControls >( [&]( WellGroupControls & groupControls )
+  {
+    groupControls.UpdateTargetRates( wellRates.toViewConst(), firstWell );
+    firstWell += groupControls.NumWells();
+  } );
 }
 
 void WellSolverBase::PrecomputeData( DomainPartition & domain )
@@ -217,15 +303,15 @@ void WellSolverBase::PrecomputeData( DomainPartition & domain )
     arrayView1d< real64 > const perfGravCoef =
       perforationData->getReference< array1d< real64 > >( viewKeyStruct::gravityCoefString );
 
-    for( localIndex iwelem = 0; iwelem < subRegion.size(); ++iwelem )
+    forAll< parallelHostPolicy >( subRegion.size(), [=]( localIndex const iwelem )
     {
       // precompute the depth of the well elements
-      wellElemGravCoef[iwelem] = wellElemLocation( iwelem, 0 ) * gravVector[ 0 ] + wellElemLocation( iwelem, 1 ) * gravVector[ 1 ] + wellElemLocation( iwelem,
-                                                                                                                                                       2 ) *
-                                 gravVector[ 2 ];
-    }
+      wellElemGravCoef[iwelem] = wellElemLocation( iwelem, 0 ) * gravVector[ 0 ]
+                                 + wellElemLocation( iwelem, 1 ) * gravVector[ 1 ]
+                                 + wellElemLocation( iwelem, 2 ) * gravVector[ 2 ];
+    } );
 
-    forAll< serialPolicy >( perforationData->size(), [=]( localIndex const iperf )
+    forAll< parallelHostPolicy >( perforationData->size(), [=]( localIndex const iperf )
     {
       // precompute the depth of the perforations
       perfGravCoef[iperf] = Dot( perfLocation[iperf], gravVector );
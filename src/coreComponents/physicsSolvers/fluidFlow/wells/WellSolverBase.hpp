@@ -126,6 +126,18 @@ public:
    */
   virtual string ResElementDofName() const = 0;
 
+  /**
+   * @brief get the name of the connection rate defined on well elements, used in the rate controls
+   * @return name of the connection rate field used by derived solver type
+   */
+  virtual string WellElementConnectionRateName() const = 0;
+
+  /**
+   * @brief get the name of the Newton update of the connection rate defined on well elements
+   * @return name of the connection rate update field used by derived solver type
+   */
+  virtual string WellElementDeltaConnectionRateName() const = 0;
+
   /**
    * @brief const getter for the number of fluid components
    * @return the number of fluid components
@@ -280,16 +292,19 @@ protected:
   virtual void ResetViews( DomainPartition & domain );
 
   /**
-   * @brief Initialize all the primary and secondary variables in all the wells
+   * @brief Update the target rates of the wells of the groups from the current rates of the wells
    * @param domain the domain containing the well manager to access individual wells
+   *
+   * The rates of all the wells of all the groups are gathered with a single reduction, then the groups,
+   * replicated on all the ranks, update the targets of their wells without any other communication.
    */
-  virtual void InitializeWells( DomainPartition & domain ) = 0;
+  void UpdateGroupControls( DomainPartition const & domain );
 
   /**
-   * @brief Check if the controls are viable; if not, switch the controls
+   * @brief Initialize all the primary and secondary variables in all the wells
    * @param domain the domain containing the well manager to access individual wells
    */
-  //virtual void CheckWellControlSwitch( DomainPartition & domain ) = 0;
+  virtual void InitializeWells( DomainPartition & domain ) = 0;
 
   /// name of the flow solver
   string m_flowSolverName;
@@ -297,6 +312,9 @@ protected:
   /// names of the fluid constitutive models
   array1d< string > m_fluidModelNames;
 
+  /// index of each well of a group in the rates gathered by UpdateGroupControls, by name of the well controls
+  std::map< string, localIndex > m_groupWellIndices;
+
   /// the number of Degrees of Freedom per well element
   localIndex m_numDofPerWellElement;
 
@@ -0,0 +1,82 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "managers/initialization.hpp"
+#include "physicsSolvers/fluidFlow/wells/WellGroupControls.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+
+namespace
+{
+
+/// Split @p groupRate between the wells and return the target rates.
+array1d< real64 > allocate( real64 const groupRate,
+                            std::vector< real64 > const & guides,
+                            std::vector< real64 > const & maxima )
+{
+  localIndex const numWells = LvArray::integerConversion< localIndex >( guides.size() );
+  array1d< real64 > guideRates( numWells );
+  array1d< real64 > maxRates( numWells );
+  array1d< real64 > targetRates( numWells );
+  for( localIndex iwell = 0; iwell < numWells; ++iwell )
+  {
+    guideRates[iwell] = guides[iwell];
+    maxRates[iwell] = maxima[iwell];
+  }
+  WellGroupControls::AllocateGroupRate( groupRate, guideRates, maxRates, targetRates );
+  return targetRates;
+}
+
+}
+
+TEST( WellGroupControls, splitInProportionToTheGuideRates )
+{
+  array1d< real64 > const targetRates = allocate( 6.0, { 1.0, 2.0, 3.0 }, { 10.0, 10.0, 10.0 } );
+  EXPECT_DOUBLE_EQ( targetRates[0], 1.0 );
+  EXPECT_DOUBLE_EQ( targetRates[1], 2.0 );
+  EXPECT_DOUBLE_EQ( targetRates[2], 3.0 );
+}
+
+TEST( WellGroupControls, cappedWellsGiveTheirShareToTheOthers )
+{
+  // the first well can take at most 1, the rest is split between the two others
+  array1d< real64 > const targetRates = allocate( 9.0, { 4.0, 1.0, 3.0 }, { 1.0, 10.0, 10.0 } );
+  EXPECT_DOUBLE_EQ( targetRates[0], 1.0 );
+  EXPECT_DOUBLE_EQ( targetRates[1], 2.0 );
+  EXPECT_DOUBLE_EQ( targetRates[2], 6.0 );
+}
+
+TEST( WellGroupControls, allWellsCappedBelowTheGroupRate )
+{
+  array1d< real64 > const targetRates = allocate( 100.0, { 1.0, 1.0 }, { 2.0, 3.0 } );
+  EXPECT_DOUBLE_EQ( targetRates[0], 2.0 );
+  EXPECT_DOUBLE_EQ( targetRates[1], 3.0 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+
+  geosx::basicSetup( argc, argv );
+
+  int const result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+
+  return result;
+}
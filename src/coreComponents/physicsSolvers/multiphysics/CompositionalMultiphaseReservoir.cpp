@@ -26,6 +26,7 @@
 
 #include "common/TimingMacros.hpp"
 #include "constitutive/fluid/MultiFluidBase.hpp"
+#include "linearAlgebra/solvers/CPRPreconditioner.hpp"
 #include "physicsSolvers/fluidFlow/CompositionalMultiphaseFlow.hpp"
 #include "physicsSolvers/fluidFlow/wells/CompositionalMultiphaseWell.hpp"
 
@@ -45,6 +46,27 @@ CompositionalMultiphaseReservoir::CompositionalMultiphaseReservoir( const std::s
 CompositionalMultiphaseReservoir::~CompositionalMultiphaseReservoir()
 {}
 
+void CompositionalMultiphaseReservoir::SetupSystem( DomainPartition & domain,
+                                                    DofManager & dofManager,
+                                                    CRSMatrix< real64, globalIndex > & localMatrix,
+                                                    array1d< real64 > & localRhs,
+                                                    array1d< real64 > & localSolution,
+                                                    bool const setSparsity )
+{
+  ReservoirSolverBase::SetupSystem( domain, dofManager, localMatrix, localRhs, localSolution, setSparsity );
+
+  LinearSolverParameters const & params = m_linearSolverParameters.get();
+  if( !m_precond &&
+      params.solverType != LinearSolverParameters::SolverType::direct &&
+      params.preconditionerType == LinearSolverParameters::PreconditionerType::cpr )
+  {
+    // the pressure is the first unknown of both reservoir and well elements
+    std::vector< DofManager::SubComponent > pressureDofs{ { m_wellSolver->ResElementDofName(), 0, 1 },
+                                                          { m_wellSolver->WellElementDofName(), 0, 1 } };
+    m_precond = std::make_unique< CPRPreconditioner< LAInterface > >( params, std::move( pressureDofs ) );
+  }
+}
+
 void CompositionalMultiphaseReservoir::AddCouplingSparsityPattern( DomainPartition const & domain,
                                                                    DofManager const & dofManager,
                                                                    SparsityPatternView< globalIndex > const & pattern ) const
@@ -162,10 +184,8 @@ void CompositionalMultiphaseReservoir::AssembleCouplingTerms( real64 const GEOSX
   localIndex const resNDOF = m_wellSolver->NumDofPerResElement();
 
   string const resDofKey = dofManager.getKey( m_wellSolver->ResElementDofName() );
-  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const resDofNumberAccessor =
-    elemManager.ConstructArrayViewAccessor< globalIndex, 1 >( resDofKey );
   ElementRegionManager::ElementViewConst< arrayView1d< globalIndex const > > const resDofNumber =
-    resDofNumberAccessor.toNestedViewConst();
+    m_resDofNumber.get( elemManager, resDofKey ).toNestedViewConst();
   globalIndex const rankOffset = dofManager.rankOffset();
 
   elemManager.forElementSubRegions< WellElementSubRegion >( [&]( WellElementSubRegion const & subRegion )
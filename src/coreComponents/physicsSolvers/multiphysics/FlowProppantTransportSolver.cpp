@@ -159,7 +159,7 @@ real64 FlowProppantTransportSolver::SolverStep( real64 const & time_n,
 
     GEOSX_LOG_LEVEL_RANK_0( 1, "\tIteration: " << iter+1  << ", Proppant Solver: " );
 
-    dtReturnTemporary = m_proppantSolver->NonlinearImplicitStep( time_n, dtReturn, cycleNumber, domain );
+    dtReturnTemporary = m_proppantSolver->SubcycledImplicitStep( time_n, dtReturn, cycleNumber, domain );
 
     if( dtReturnTemporary < dtReturn )
     {
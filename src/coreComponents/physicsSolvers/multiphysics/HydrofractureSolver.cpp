@@ -20,6 +20,7 @@
 
 #include "HydrofractureSolver.hpp"
 
+#include "common/TaskGraph.hpp"
 #include "common/TimingMacros.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
 #include "constitutive/contact/ContactRelationBase.hpp"
@@ -53,7 +54,12 @@ HydrofractureSolver::HydrofractureSolver( const std::string & name,
   m_couplingTypeOption( CouplingTypeOption::FIM ),
   m_solidSolver( nullptr ),
   m_flowSolver( nullptr ),
-  m_maxNumResolves( 10 )
+  m_maxNumResolves( 10 ),
+  m_surfaceGenerationFrequency( 1 ),
+  m_numStepsSinceSurfaceGeneration( 0 ),
+  m_targetNewFaceElementsPerStep( 0 ),
+  m_numNewFaceElements( 0 ),
+  m_fractureStencilRevision( -1 )
 {
   registerWrapper( viewKeyStruct::solidSolverNameString, &m_solidSolverName )->
     setInputFlag( InputFlags::REQUIRED )->
@@ -76,6 +82,18 @@ HydrofractureSolver::HydrofractureSolver( const std::string & name,
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Value to indicate how many resolves may be executed to perform surface generation after the execution of flow and mechanics solver. " );
 
+  registerWrapper( viewKeyStruct::surfaceGenerationFrequencyString, &m_surfaceGenerationFrequency )->
+    setApplyDefaultValue( 1 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of time steps between two calls of the surface generator with the Explicit coupling, "
+                    "so that the topology changes are batched." );
+
+  registerWrapper( viewKeyStruct::targetNewFaceElementsPerStepString, &m_targetNewFaceElementsPerStep )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Targeted number of new fracture elements per time step. The next time step is scaled "
+                    "to approach this number while the fracture grows. 0 to not use this criterion." );
+
   m_numResolves[0] = 0;
 
   m_linearSolverParameters.get().mgr.strategy = "Hydrofracture";
@@ -154,6 +172,17 @@ void HydrofractureSolver::PostProcessInput()
 
   m_flowSolver = this->getParent()->GetGroup< FlowSolverBase >( m_flowSolverName );
   GEOSX_ERROR_IF( m_flowSolver == nullptr, this->getName() << ": invalid flow solver name: " << m_flowSolverName );
+
+  if( m_couplingTypeOption == CouplingTypeOption::Explicit )
+  {
+    GEOSX_ERROR_IF( m_solidSolver->timeIntegrationOption() != SolidMechanicsLagrangianFEM::TimeIntegrationOption::ExplicitDynamic,
+                    this->getName() << ": the Explicit coupling requires the ExplicitDynamic time integration in " << m_solidSolverName );
+    GEOSX_ERROR_IF_LT_MSG( m_surfaceGenerationFrequency, 1,
+                           this->getName() << ": invalid value of " << viewKeyStruct::surfaceGenerationFrequencyString );
+
+    // the fluid pressure loads the fracture faces through the external forces of the nodes
+    m_solidSolver->setApplyExplicitExternalForces( true );
+  }
 }
 
 void HydrofractureSolver::InitializePostInitialConditions_PreSubGroups( Group * const GEOSX_UNUSED_PARAM( problemManager ) )
@@ -179,10 +208,16 @@ real64 HydrofractureSolver::SolverStep( real64 const & time_n,
 
   SolverBase * const surfaceGenerator = this->getParent()->GetGroup< SolverBase >( "SurfaceGen" );
 
+  globalIndex const numFractureElements = getGlobalNumFractureElements( domain );
+
   if( m_couplingTypeOption == CouplingTypeOption::SIM_FixedStress )
   {
     dtReturn = SplitOperatorStep( time_n, dt, cycleNumber, domain );
   }
+  else if( m_couplingTypeOption == CouplingTypeOption::Explicit )
+  {
+    dtReturn = ExplicitStep( time_n, dt, cycleNumber, domain );
+  }
   else if( m_couplingTypeOption == CouplingTypeOption::FIM )
   {
 
@@ -256,9 +291,23 @@ real64 HydrofractureSolver::SolverStep( real64 const & time_n,
     m_numResolves[1] = solveIter;
   }
 
+  m_numNewFaceElements = getGlobalNumFractureElements( domain ) - numFractureElements;
+
   return dtReturn;
 }
 
+globalIndex HydrofractureSolver::getGlobalNumFractureElements( DomainPartition & domain ) const
+{
+  ElementRegionManager const & elemManager = *domain.getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
+
+  globalIndex numLocalElements = 0;
+  elemManager.forElementSubRegions< FaceElementSubRegion >( [&]( FaceElementSubRegion const & subRegion )
+  {
+    numLocalElements += subRegion.GetNumberOfLocalIndices();
+  } );
+  return MpiWrapper::Sum( numLocalElements );
+}
+
 void HydrofractureSolver::UpdateDeformationForCoupling( DomainPartition & domain )
 {
   MeshLevel * const meshLevel = domain.getMeshBody( 0 )->getMeshLevel( 0 );
@@ -463,12 +512,111 @@ real64 HydrofractureSolver::ExplicitStep( real64 const & time_n,
                                           DomainPartition & domain )
 {
   GEOSX_MARK_FUNCTION;
+
+  // the pressure of the previous step loads the fracture faces during the explicit step of the solid
+  ComputeFracturePressureForces( domain );
   m_solidSolver->ExplicitStep( time_n, dt, cycleNumber, domain );
-  m_flowSolver->SolverStep( time_n, dt, cycleNumber, domain );
+
+  // the fracture flow is then solved with the volume change given by the new opening
+  m_flowSolver->ImplicitStepSetup( time_n, dt, domain );
+  UpdateDeformationForCoupling( domain );
+  m_flowSolver->SetupSystem( domain,
+                             m_flowSolver->getDofManager(),
+                             m_flowSolver->getLocalMatrix(),
+                             m_flowSolver->getLocalRhs(),
+                             m_flowSolver->getLocalSolution() );
+  m_flowSolver->NonlinearImplicitStep( time_n, dt, cycleNumber, domain );
+  m_flowSolver->ImplicitStepComplete( time_n, dt, domain );
+
+  // the topology changes are batched, so that the systems and the synchronization plans set up for a
+  // fracture are kept for several steps
+  SolverBase * const surfaceGenerator = this->getParent()->GetGroup< SolverBase >( "SurfaceGen" );
+  ++m_numStepsSinceSurfaceGeneration;
+  if( surfaceGenerator != nullptr && m_numStepsSinceSurfaceGeneration >= m_surfaceGenerationFrequency )
+  {
+    m_numStepsSinceSurfaceGeneration = 0;
+
+    int const locallyFractured = surfaceGenerator->SolverStep( time_n, dt, cycleNumber, domain ) > 0 ? 1 : 0;
+    if( MpiWrapper::Max( locallyFractured ) > 0 )
+    {
+      std::map< string, string_array > fieldNames;
+      fieldNames["node"].emplace_back( keys::IncrementalDisplacement );
+      fieldNames["node"].emplace_back( keys::TotalDisplacement );
+      fieldNames["node"].emplace_back( keys::Velocity );
+      fieldNames["elems"].emplace_back( string( FlowSolverBase::viewKeyStruct::pressureString ) );
+      fieldNames["elems"].emplace_back( "elementAperture" );
+
+      CommunicationTools::SynchronizeFields( fieldNames,
+                                             domain.getMeshBody( 0 )->getMeshLevel( 0 ),
+                                             domain.getNeighbors() );
+
+      this->UpdateDeformationForCoupling( domain );
+      m_flowSolver->ResetViews( *domain.getMeshBody( 0 )->getMeshLevel( 0 ) );
+    }
+  }
 
   return dt;
 }
 
+void HydrofractureSolver::ComputeFracturePressureForces( DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
+  FaceManager const & faceManager = *mesh.getFaceManager();
+  NodeManager & nodeManager = *mesh.getNodeManager();
+  ElementRegionManager const & elemManager = *mesh.getElemManager();
+
+  arrayView2d< real64 const > const faceNormal = faceManager.faceNormal();
+  ArrayOfArraysView< localIndex const > const faceToNodeMap = faceManager.nodeList().toViewConst();
+
+  arrayView2d< real64 > const
+  fext = nodeManager.getReference< array2d< real64 > >( SolidMechanicsLagrangianFEM::viewKeyStruct::forceExternal );
+  fext.setValues< parallelDevicePolicy<> >( 0 );
+
+  elemManager.forElementSubRegions< FaceElementSubRegion >( [&]( FaceElementSubRegion const & subRegion )
+  {
+    if( subRegion.hasWrapper( FlowSolverBase::viewKeyStruct::pressureString ) )
+    {
+      arrayView1d< real64 const > const fluidPressure =
+        subRegion.getReference< array1d< real64 > >( FlowSolverBase::viewKeyStruct::pressureString );
+      arrayView1d< real64 const > const area = subRegion.getElementArea();
+      arrayView2d< localIndex const > const elemsToFaces = subRegion.faceList();
+
+      // same nodal forces as in AssembleForceResidualDerivativeWrtPressure, the nodes shared by several
+      // fracture elements are updated atomically
+      forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const kfe )
+      {
+        localIndex const kf0 = elemsToFaces[kfe][0];
+        localIndex const kf1 = elemsToFaces[kfe][1];
+        localIndex const numNodesPerFace = faceToNodeMap.sizeOfArray( kf0 );
+
+        real64 Nbar[ 3 ];
+        LvArray::tensorOps::copy< 3 >( Nbar, faceNormal[ kf0 ] );
+        LvArray::tensorOps::subtract< 3 >( Nbar, faceNormal[ kf1 ] );
+        LvArray::tensorOps::normalize< 3 >( Nbar );
+
+        real64 const nodalForceMag = fluidPressure[kfe] * area[kfe] / numNodesPerFace;
+
+        for( localIndex kf = 0; kf < 2; ++kf )
+        {
+          real64 const kfSign = kf == 0 ? -1.0 : 1.0;
+          localIndex const faceIndex = elemsToFaces[kfe][kf];
+          for( localIndex a = 0; a < numNodesPerFace; ++a )
+          {
+            localIndex const node = faceToNodeMap( faceIndex, a );
+            for( int i = 0; i < 3; ++i )
+            {
+              RAJA::atomicAdd( parallelDeviceAtomic{}, &fext[node][i], kfSign * nodalForceMag * Nbar[i] );
+            }
+          }
+        }
+      } );
+    }
+  } );
+}
+
 
 void HydrofractureSolver::SetupDofs( DomainPartition const & domain,
                                      DofManager & dofManager ) const
@@ -510,38 +658,41 @@ void HydrofractureSolver::SetupSystem( DomainPartition & domain,
   dofManager.setMesh( domain, 0, 0 );
 
   SetupDofs( domain, dofManager );
-  dofManager.reorderByRank();
+  dofManager.reorderByRank( m_linearSolverParameters.get().dofOrdering );
 
   localIndex const numLocalRows = dofManager.numLocalDofs();
 
-  SparsityPattern< globalIndex > patternOriginal;
-  dofManager.setSparsityPattern( patternOriginal );
+  // Without new face elements nor new fracture connections the coupled sparsity pattern is unchanged,
+  // so the matrix and the flux-aperture derivatives are kept and only their values are reset
+  localIndex const fractureStencilRevision = getFractureStencilRevision( domain );
+  bool const fractureUnchanged = MpiWrapper::Max( fractureStencilRevision != m_fractureStencilRevision ? 1 : 0 ) == 0;
+  if( fractureUnchanged && dofManager.canReuseSparsityPattern( localMatrix ) )
+  {
+    localMatrix.setValues< parallelDevicePolicy<> >( 0.0 );
+    localRhs.resize( numLocalRows );
+    localSolution.resize( numLocalRows );
+    return;
+  }
 
-  // Get the original row lengths (diagonal blocks only)
-  array1d< localIndex > rowLengths( patternOriginal.numRows() );
-  for( localIndex localRow = 0; localRow < patternOriginal.numRows(); ++localRow )
+  // The new face elements renumber the DOFs, so the system is rebuilt whenever the fracture changes
+  if( getLogLevel() >= 1 && m_fractureStencilRevision >= 0 )
   {
-    rowLengths[localRow] = patternOriginal.numNonZeros( localRow );
+    localIndex const numModifiedRows = getModifiedFractureRows( domain, dofManager, m_fractureStencilRevision ).size();
+    GEOSX_LOG_RANK( "Fracture propagation modified the connections of " << numModifiedRows << " rows" );
   }
+  m_fractureStencilRevision = fractureStencilRevision;
 
-  // Add the number of nonzeros induced by coupling
-  addFluxApertureCouplingNNZ( domain, dofManager, rowLengths.toView() );
+  // Count the nonzeros induced by the flux-aperture coupling, and reserve them in the pattern of the DofManager
+  // so that they are inserted in place rather than in a copy of the whole pattern
+  array1d< localIndex > couplingRowLengths( numLocalRows );
+  addFluxApertureCouplingNNZ( domain, dofManager, couplingRowLengths.toView() );
 
-  // Create a new pattern with enough capacity for coupled matrix
   SparsityPattern< globalIndex > pattern;
-  pattern.resizeFromRowCapacities< parallelHostPolicy >( patternOriginal.numRows(),
-                                                         patternOriginal.numColumns(),
-                                                         rowLengths.data() );
-
-  // Copy the original nonzeros
-  for( localIndex localRow = 0; localRow < patternOriginal.numRows(); ++localRow )
-  {
-    globalIndex const * cols = patternOriginal.getColumns( localRow ).dataIfContiguous();
-    pattern.insertNonZeros( localRow, cols, cols + patternOriginal.numNonZeros( localRow ) );
-  }
+  dofManager.setSparsityPattern( pattern, couplingRowLengths.toViewConst() );
 
   // Add the nonzeros from coupling
   addFluxApertureCouplingSparsityPattern( domain, dofManager, pattern.toView() );
+  pattern.compress();
 
   localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
 
@@ -556,6 +707,61 @@ void HydrofractureSolver::SetupSystem( DomainPartition & domain,
 
 }
 
+localIndex HydrofractureSolver::getFractureStencilRevision( DomainPartition const & domain ) const
+{
+  MeshLevel const & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_flowSolver->getDiscretization() );
+
+  localIndex revision = 0;
+  fluxApprox.forStencils< FaceElementStencil >( mesh, [&]( FaceElementStencil const & stencil )
+  {
+    revision += stencil.revision();
+  } );
+  return revision;
+}
+
+SortedArray< globalIndex > HydrofractureSolver::getModifiedFractureRows( DomainPartition const & domain,
+                                                                         DofManager const & dofManager,
+                                                                         localIndex const sinceRevision ) const
+{
+  MeshLevel const & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  ElementRegionManager const & elemManager = *mesh.getElemManager();
+
+  string const presDofKey = dofManager.getKey( FlowSolverBase::viewKeyStruct::pressureString );
+  globalIndex const rankOffset = dofManager.rankOffset();
+  globalIndex const numLocalRows = dofManager.numLocalDofs();
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_flowSolver->getDiscretization() );
+
+  SortedArray< globalIndex > rows;
+  fluxApprox.forStencils< FaceElementStencil >( mesh, [&]( FaceElementStencil const & stencil )
+  {
+    typename FaceElementStencil::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
+    typename FaceElementStencil::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
+    typename FaceElementStencil::IndexContainerViewConstType const & sei = stencil.getElementIndices();
+
+    array1d< localIndex > const modifiedConnections = stencil.getModifiedConnections( sinceRevision );
+    for( localIndex const iconn : modifiedConnections )
+    {
+      for( localIndex k = 0; k < stencil.stencilSize( iconn ); ++k )
+      {
+        ElementSubRegionBase const & subRegion = *elemManager.GetRegion( seri[iconn][k] )->GetSubRegion( sesri[iconn][k] );
+        globalIndex const row = subRegion.getReference< array1d< globalIndex > >( presDofKey )[sei[iconn][k]];
+        if( row - rankOffset >= 0 && row - rankOffset < numLocalRows )
+        {
+          rows.insert( row );
+        }
+      }
+    }
+  } );
+  return rows;
+}
+
 void HydrofractureSolver::addFluxApertureCouplingNNZ( DomainPartition & domain,
                                                       DofManager & dofManager,
                                                       arrayView1d< localIndex > const & rowLengths ) const
@@ -695,26 +901,52 @@ void HydrofractureSolver::AssembleSystem( real64 const time,
 {
   GEOSX_MARK_FUNCTION;
 
-  m_solidSolver->AssembleSystem( time,
-                                 dt,
-                                 domain,
-                                 dofManager,
-                                 localMatrix,
-                                 localRhs );
+  // the whole system is zeroed once, so that the solid and flow blocks, which write to the rows of different
+  // fields, may then be assembled concurrently
+  localMatrix.setValues< parallelDevicePolicy< 32 > >( 0 );
+  localRhs.setValues< parallelDevicePolicy< 32 > >( 0 );
 
-  m_flowSolver->ResetViews( *(domain.getMeshBody( 0 )->getMeshLevel( 0 ) ) );
+  TaskGraph assembly;
 
-  m_flowSolver->AssembleSystem( time,
-                                dt,
-                                domain,
-                                dofManager,
-                                localMatrix,
-                                localRhs );
+  TaskGraph::TaskId const solidAssembly =
+    assembly.addTask( dofManager.numLocalDofs( keys::TotalDisplacement ), [&]
+  {
+    m_solidSolver->AssembleSystemContributions( dt,
+                                                domain,
+                                                dofManager,
+                                                localMatrix,
+                                                localRhs );
+  } );
 
+  TaskGraph::TaskId const flowAssembly =
+    assembly.addTask( dofManager.numLocalDofs( FlowSolverBase::viewKeyStruct::pressureString ), [&]
+  {
+    m_flowSolver->ResetViews( *(domain.getMeshBody( 0 )->getMeshLevel( 0 ) ) );
+
+    m_flowSolver->AssembleSystem( time,
+                                  dt,
+                                  domain,
+                                  dofManager,
+                                  localMatrix,
+                                  localRhs );
+  } );
 
-  AssembleForceResidualDerivativeWrtPressure( domain, localMatrix, localRhs );
+  // the coupling blocks add to the rows of the displacement and of the pressure respectively
+  assembly.addTask( dofManager.numLocalDofs( keys::TotalDisplacement ), [&]
+  {
+    AssembleForceResidualDerivativeWrtPressure( domain, localMatrix, localRhs );
+  }, { solidAssembly } );
 
-  AssembleFluidMassResidualDerivativeWrtDisplacement( domain, localMatrix );
+  // this block only enters the matrix, which is not applied by the Jacobian-free products
+  if( m_nonlinearSolverParameters.m_jacobianFree == 0 )
+  {
+    assembly.addTask( dofManager.numLocalDofs( FlowSolverBase::viewKeyStruct::pressureString ), [&]
+    {
+      AssembleFluidMassResidualDerivativeWrtDisplacement( domain, localMatrix );
+    }, { flowAssembly } );
+  }
+
+  assembly.execute();
 }
 
 void HydrofractureSolver::ApplyBoundaryConditions( real64 const time,
@@ -1005,14 +1237,18 @@ HydrofractureSolver::
                        DomainPartition & domain )
 {
   GEOSX_MARK_FUNCTION;
-  m_solidSolver->ApplySystemSolution( dofManager,
-                                      localSolution,
-                                      scalingFactor,
-                                      domain );
-  m_flowSolver->ApplySystemSolution( dofManager,
-                                     localSolution,
-                                     -scalingFactor,
-                                     domain );
+  {
+    // send the displacement and pressure updates in a single message per neighbor
+    DeferredSynchronization deferredSync;
+    m_solidSolver->ApplySystemSolution( dofManager,
+                                        localSolution,
+                                        scalingFactor,
+                                        domain );
+    m_flowSolver->ApplySystemSolution( dofManager,
+                                       localSolution,
+                                       -scalingFactor,
+                                       domain );
+  }
 
   UpdateDeformationForCoupling( domain );
 }
@@ -1031,16 +1267,25 @@ HydrofractureSolver::ScalingForSystemSolution( DomainPartition const & domain,
 void HydrofractureSolver::SetNextDt( real64 const & currentDt,
                                      real64 & nextDt )
 {
+  // the Newton convergence history gives the first estimate, growing the step in the quiet phases
+  this->SetNextDtBasedOnNewtonIter( currentDt, nextDt );
 
-  if( m_numResolves[0] == 0 && m_numResolves[1] == 0 )
+  // the rupture rate predicted by the surface generator is only updated by the steps that fractured
+  SolverBase * const surfaceGenerator = this->getParent()->GetGroup< SolverBase >( "SurfaceGen" );
+  if( surfaceGenerator != nullptr && m_numNewFaceElements > 0 && surfaceGenerator->GetTimestepRequest() < 1e99 )
   {
-    this->SetNextDtBasedOnNewtonIter( currentDt, nextDt );
+    nextDt = std::min( nextDt, surfaceGenerator->GetTimestepRequest() );
   }
-  else
+
+  // the number of new elements is assumed proportional to the step, the change of step is bounded since
+  // the rupture comes in bursts
+  if( m_targetNewFaceElementsPerStep > 0 && m_numNewFaceElements > 0 )
   {
-    SolverBase * const surfaceGenerator =  this->getParent()->GetGroup< SolverBase >( "SurfaceGen" );
-    nextDt = surfaceGenerator->GetTimestepRequest() < 1e99 ? surfaceGenerator->GetTimestepRequest() : currentDt;
+    real64 const ratio = static_cast< real64 >( m_targetNewFaceElementsPerStep ) / m_numNewFaceElements;
+    nextDt = std::min( nextDt, currentDt * std::min( 2.0, std::max( 0.1, ratio ) ) );
   }
+
+  GEOSX_LOG_LEVEL_RANK_0( 3, this->getName() << ": " << m_numNewFaceElements << " new fracture elements in the last step" );
   GEOSX_LOG_LEVEL_RANK_0( 3, this->getName() << ": nextDt request is "  << nextDt );
 }
 
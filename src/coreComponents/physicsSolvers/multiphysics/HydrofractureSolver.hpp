@@ -117,6 +117,22 @@ public:
 
   void UpdateDeformationForCoupling( DomainPartition & domain );
 
+  /**
+   * @brief Count the fracture elements over all the ranks.
+   * @param domain the domain partition
+   * @return the global number of face elements, the ghosts excluded
+   */
+  globalIndex getGlobalNumFractureElements( DomainPartition & domain ) const;
+
+  /**
+   * @brief Compute the nodal forces of the fluid pressure on the faces of the fracture elements.
+   * @param domain the physical domain object
+   *
+   * The forces are stored in the external force field of the nodes, which loads the nodes in the explicit steps
+   * of the solid solver. The computation runs in a device kernel.
+   */
+  void ComputeFracturePressureForces( DomainPartition & domain );
+
 //  void ApplyFractureFluidCoupling( DomainPartition * const domain,
 //                                   systemSolverInterface::EpetraBlockSystem & blockSystem );
 
@@ -140,7 +156,8 @@ public:
   enum class CouplingTypeOption : integer
   {
     FIM,
-    SIM_FixedStress
+    SIM_FixedStress,
+    Explicit
   };
 
   struct viewKeyStruct : SolverBase::viewKeyStruct
@@ -156,6 +173,8 @@ public:
 
     constexpr static auto contactRelationNameString = "contactRelationName";
     constexpr static auto maxNumResolvesString = "maxNumResolves";
+    constexpr static auto surfaceGenerationFrequencyString = "surfaceGenerationFrequency";
+    constexpr static auto targetNewFaceElementsPerStepString = "targetNewFaceElementsPerStep";
 
 #ifdef GEOSX_USE_SEPARATION_COEFFICIENT
     constexpr static auto separationCoeff0String = "separationCoeff0";
@@ -191,6 +210,24 @@ protected:
                                                DofManager & dofManager,
                                                SparsityPatternView< globalIndex > const & pattern ) const;
 
+  /**
+   * @brief Get the revision of the fracture stencils, which changes when fracture connections are added or modified.
+   * @param domain the physical domain object
+   * @return the sum of the revisions of the fracture stencils
+   */
+  localIndex getFractureStencilRevision( DomainPartition const & domain ) const;
+
+  /**
+   * @brief Get the rows of the system touched by the fracture connections modified since a revision.
+   * @param domain the physical domain object
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param sinceRevision the revision of the fracture stencils the system was last set up for
+   * @return the locally owned pressure rows of the face elements of the modified connections
+   */
+  SortedArray< globalIndex > getModifiedFractureRows( DomainPartition const & domain,
+                                                      DofManager const & dofManager,
+                                                      localIndex const sinceRevision ) const;
+
 private:
 
   string m_solidSolverName;
@@ -206,9 +243,24 @@ private:
 
   integer m_maxNumResolves;
   integer m_numResolves[2];
+
+  /// Number of explicit steps between two calls of the surface generator
+  integer m_surfaceGenerationFrequency;
+
+  /// Number of explicit steps since the last call of the surface generator
+  integer m_numStepsSinceSurfaceGeneration;
+
+  /// Targeted number of new face elements per time step, 0 to not limit the time steps on the fracture growth
+  integer m_targetNewFaceElementsPerStep;
+
+  /// Global number of face elements created during the last time step
+  globalIndex m_numNewFaceElements;
+
+  /// The revision of the fracture stencils the linear system was set up for, -1 before the first setup
+  localIndex m_fractureStencilRevision;
 };
 
-ENUM_STRINGS( HydrofractureSolver::CouplingTypeOption, "FIM", "SIM_FixedStress" )
+ENUM_STRINGS( HydrofractureSolver::CouplingTypeOption, "FIM", "SIM_FixedStress", "Explicit" )
 
 } /* namespace geosx */
 
@@ -23,6 +23,7 @@
 #include "constitutive/ConstitutiveManager.hpp"
 #include "constitutive/contact/ContactRelationBase.hpp"
 #include "constitutive/fluid/SingleFluidBase.hpp"
+#include "constitutive/solid/LinearElasticIsotropic.hpp"
 #include "finiteVolume/FiniteVolumeManager.hpp"
 #include "finiteVolume/FluxApproximationBase.hpp"
 #include "managers/DomainPartition.hpp"
@@ -169,6 +170,14 @@ void LagrangianContactSolver::InitializePreSubGroups( Group * const rootGroup )
   ConstitutiveBase const * const contactRelation  = cm->GetConstitutiveRelation< ConstitutiveBase >( m_contactRelationName );
   GEOSX_ERROR_IF( contactRelation == nullptr, "fracture constitutive model " + m_contactRelationName + " not found" );
   m_contactRelationFullIndex = contactRelation->getIndexInParent();
+
+  // the tolerances are computed from the per-element moduli
+  for( string const & solidName : m_solidSolver->solidMaterialNames() )
+  {
+    LinearElasticIsotropic const * const elasticSolid = cm->GetConstitutiveRelation< LinearElasticIsotropic >( solidName );
+    GEOSX_ERROR_IF( elasticSolid != nullptr && elasticSolid->hasMaterialTable(),
+                    "constitutive model " + solidName + " must store its moduli per element" );
+  }
 }
 
 void LagrangianContactSolver::ImplicitStepSetup( real64 const & time_n,
@@ -529,6 +538,13 @@ real64 LagrangianContactSolver::NonlinearImplicitStep( real64 const & time_n,
 
   bool useElasticStep = !IsFractureAllInStickCondition( domain );
 
+  // the matrix keeps its sparsity pattern through the active set iterations, the traction couplings being set
+  // for all the fracture states, but the preconditioner is only reused while the active set is unchanged
+  if( !isTimeStepMarkedByCoupling() )
+  {
+    markNewTimeStep();
+  }
+
   // outer loop attempts to apply full timestep, and managed the cutting of the timestep if
   // required.
   for( dtAttempt = 0; dtAttempt < maxNumberDtCuts; ++dtAttempt )
@@ -537,6 +553,7 @@ real64 LagrangianContactSolver::NonlinearImplicitStep( real64 const & time_n,
     if( dtAttempt > 0 )
     {
       ResetStateToBeginningOfStep( domain );
+      markPreconditionerOutdated();
       globalIndex numStick, numSlip, numOpen;
       ComputeFractureStateStatistics( domain, numStick, numSlip, numOpen, true );
     }
@@ -704,6 +721,10 @@ real64 LagrangianContactSolver::NonlinearImplicitStep( real64 const & time_n,
       // *******************************
       bool const isPreviousFractureStateValid = UpdateFractureState( domain );
       GEOSX_LOG_LEVEL_RANK_0( 1, "active set flag: " << std::boolalpha << isPreviousFractureStateValid );
+      if( !isPreviousFractureStateValid )
+      {
+        markPreconditionerOutdated();
+      }
 
       if( getLogLevel() >= 1 )
       {
@@ -730,6 +751,7 @@ real64 LagrangianContactSolver::NonlinearImplicitStep( real64 const & time_n,
         useElasticStep = false;
         ResetStateToBeginningOfStep( domain );
         SetFractureStateForElasticStep( domain );
+        markPreconditionerOutdated();
       }
       else
       {
@@ -1700,6 +1722,9 @@ void LagrangianContactSolver::ApplySystemSolution( DofManager const & dofManager
 {
   GEOSX_MARK_FUNCTION;
 
+  // send the displacement and traction updates in a single message per neighbor
+  DeferredSynchronization deferredSync;
+
   m_solidSolver->ApplySystemSolution( dofManager, localSolution, scalingFactor, domain );
 
   dofManager.addVectorToField( localSolution, viewKeyStruct::tractionString, viewKeyStruct::deltaTractionString, -scalingFactor );
@@ -1716,9 +1741,11 @@ void LagrangianContactSolver::ApplySystemSolution( DofManager const & dofManager
   CommunicationTools::SynchronizeFields( fieldNames,
                                          domain.getMeshBody( 0 )->getMeshLevel( 0 ),
                                          domain.getNeighbors(),
-                                         true );
-
-  UpdateDeformationForCoupling( domain );
+                                         true,
+                                         [this, &domain]()
+  {
+    UpdateDeformationForCoupling( domain );
+  } );
 }
 
 void LagrangianContactSolver::InitializeFractureState( MeshLevel & mesh,
@@ -39,8 +39,10 @@ PhaseFieldFractureSolver::PhaseFieldFractureSolver( const std::string & name,
   SolverBase( name, parent ),
   m_solidSolverName(),
   m_damageSolverName(),
-  m_couplingTypeOption( CouplingTypeOption::FixedStress )
-
+  m_couplingTypeOption( CouplingTypeOption::FixedStress ),
+  m_couplingDamageTolerance( 0.0 ),
+  m_precondDamageTolerance( -1.0 ),
+  m_damageMappingTolerance( 0.0 )
 {
   registerWrapper( viewKeyStruct::solidSolverNameString, &m_solidSolverName )->
     setInputFlag( InputFlags::REQUIRED )->
@@ -60,6 +62,26 @@ PhaseFieldFractureSolver::PhaseFieldFractureSolver( const std::string & name,
     setInputFlag( InputFlags::REQUIRED )->
     setDescription( "turn on subcycling on each load step" );
 
+  registerWrapper( viewKeyStruct::couplingDamageToleranceString, &m_couplingDamageTolerance )->
+    setApplyDefaultValue( 0.0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Largest change of the nodal damage between two coupling iterations for the coupling to converge. "
+                    "If 0, the coupling converges once the solid mechanics solver needs no Newton iteration." );
+
+  registerWrapper( viewKeyStruct::precondDamageToleranceString, &m_precondDamageTolerance )->
+    setApplyDefaultValue( -1.0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Largest change of the nodal damage before the preconditioner of the solid mechanics solver is "
+                    "recomputed. The preconditioner is otherwise kept across the coupling iterations and the time steps "
+                    "as long as the reuse policy of its linear solver allows. If negative, it is recomputed in each time step." );
+
+  registerWrapper( viewKeyStruct::damageMappingToleranceString, &m_damageMappingTolerance )->
+    setApplyDefaultValue( 0.0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Change of the nodal damage below which the damage of the quadrature points of an element is not "
+                    "updated after a damage solve. Only the elements with a node whose damage changed by more since it "
+                    "was last mapped are updated. If 0, an element is updated as soon as the damage of one of its nodes changes." );
+
 }
 
 void PhaseFieldFractureSolver::RegisterDataOnMesh( dataRepository::Group * const MeshBodies )
@@ -122,6 +144,11 @@ void PhaseFieldFractureSolver::PostProcessInput()
 
     minNewtonIterSolid = 0;
     minNewtonIterFluid = 0;
+
+    // The sub-solvers are called once per coupling iteration: let the preconditioner reuse policies
+    // count the time steps of the coupled solver instead
+    solidSolver.setTimeStepMarkedByCoupling( true );
+    damageSolver.setTimeStepMarkedByCoupling( true );
   }
 }
 
@@ -203,6 +230,18 @@ real64 PhaseFieldFractureSolver::SplitOperatorStep( real64 const & time_n,
 
   this->ImplicitStepSetup( time_n, dt, domain );
 
+  // the elasticity matrix only changes with the degradation, so that its preconditioner may outlive the time step
+  damageSolver.markNewTimeStep();
+  if( m_precondDamageTolerance < 0 )
+  {
+    solidSolver.markNewTimeStep();
+  }
+  else
+  {
+    damageChange( domain, m_precondDamage, false );
+  }
+  damageChange( domain, m_couplingDamage, true );
+
   NonlinearSolverParameters & solverParams = getNonlinearSolverParameters();
   integer & iter = solverParams.m_numNewtonIterations;
   iter = 0;
@@ -264,6 +303,22 @@ real64 PhaseFieldFractureSolver::SplitOperatorStep( real64 const & time_n,
       dtReturn = dtReturnTemporary;
       continue;
     }
+
+    real64 const couplingDamageChange = damageChange( domain, m_couplingDamage, true );
+    GEOSX_LOG_LEVEL_RANK_0( 1, "\tIteration: " << iter+1 << ", largest damage change: " << couplingDamageChange );
+
+    if( m_precondDamageTolerance >= 0 && damageChange( domain, m_precondDamage, false ) > m_precondDamageTolerance )
+    {
+      solidSolver.markPreconditionerOutdated();
+      damageChange( domain, m_precondDamage, true );
+    }
+
+    if( m_couplingDamageTolerance > 0 && couplingDamageChange < m_couplingDamageTolerance )
+    {
+      GEOSX_LOG_LEVEL_RANK_0( 1, "***** The iterative coupling has converged in " << iter+1 << " iterations! *****\n" );
+      isConverged = true;
+      break;
+    }
     ++iter;
   }
 
@@ -293,40 +348,76 @@ void PhaseFieldFractureSolver::mapDamageToQuadrature( DomainPartition & domain )
   //should get reference to damage field here.
   arrayView1d< real64 const > const nodalDamage = nodeManager->getReference< array1d< real64 > >( damageFieldName );
 
-  ElementRegionManager * const elemManager = mesh->getElemManager();
-
-  ConstitutiveManager * const constitutiveManager = domain.GetGroup< ConstitutiveManager >( keys::ConstitutiveManager );
+  // flag the nodes whose damage changed since it was last mapped, all of them on the first mapping
+  bool const mapAll = m_mappedDamage.size() != nodalDamage.size();
+  if( mapAll )
+  {
+    m_mappedDamage.resize( nodalDamage.size() );
+  }
+  arrayView1d< real64 > const mappedDamage = m_mappedDamage.toView();
+  real64 const tolerance = m_damageMappingTolerance;
 
-  ElementRegionManager::ConstitutiveRelationAccessor< ConstitutiveBase >
-  constitutiveRelations = elemManager->ConstructFullConstitutiveAccessor< ConstitutiveBase >( constitutiveManager );
+  array1d< integer > changedNodes( nodalDamage.size() );
+  arrayView1d< integer > const isChanged = changedNodes.toView();
+  forAll< parallelDevicePolicy<> >( nodalDamage.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
+  {
+    isChanged[a] = mapAll || LvArray::math::abs( nodalDamage[a] - mappedDamage[a] ) > tolerance;
+    if( isChanged[a] )
+    {
+      mappedDamage[a] = nodalDamage[a];
+    }
+  } );
+  arrayView1d< integer const > const nodeChanged = changedNodes.toViewConst();
 
+  localIndex numElements = 0;
+  localIndex numActiveElements = 0;
 
   // begin region loop
-  forTargetSubRegionsComplete< CellElementSubRegion >( *mesh, [this, &solidSolver, nodalDamage]
+  forTargetSubRegionsComplete< CellElementSubRegion >( *mesh, [this, &solidSolver, nodalDamage, nodeChanged, &numElements, &numActiveElements]
                                                          ( localIndex const targetIndex, localIndex, localIndex, ElementRegionBase &, CellElementSubRegion & elementSubRegion )
   {
     constitutive::ConstitutiveBase * const
     solidModel = elementSubRegion.getConstitutiveModel< constitutive::ConstitutiveBase >( solidSolver.solidMaterialNames()[targetIndex] );
 
-    ConstitutivePassThru< DamageBase >::Execute( solidModel, [this, &elementSubRegion, nodalDamage]( auto * const damageModel )
+    ConstitutivePassThru< DamageBase >::Execute( solidModel, [this, &elementSubRegion, nodalDamage, nodeChanged, &numElements, &numActiveElements]( auto * const damageModel )
     {
       using CONSTITUTIVE_TYPE = TYPEOFPTR( damageModel );
       typename CONSTITUTIVE_TYPE::KernelWrapper constitutiveUpdate = damageModel->createKernelUpdates();
 
-      arrayView2d< real64 > const damageFieldOnMaterial = constitutiveUpdate.m_damage;
+      arrayView2d< solid::STATE_TYPE > const damageFieldOnMaterial = constitutiveUpdate.m_damage;
       arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemNodes = elementSubRegion.nodeList();
 
+      // the active elements are those with a changed node
+      array1d< localIndex > activeElements;
+      activeElements.reserve( elementSubRegion.size() );
+      forAll< serialPolicy >( elementSubRegion.size(), [=, &activeElements]( localIndex const k )
+      {
+        for( localIndex a = 0; a < elemNodes.size( 1 ); ++a )
+        {
+          if( nodeChanged[elemNodes( k, a )] )
+          {
+            activeElements.emplace_back( k );
+            break;
+          }
+        }
+      } );
+      arrayView1d< localIndex const > const activeElementList = activeElements.toViewConst();
+
+      numElements += elementSubRegion.size();
+      numActiveElements += activeElementList.size();
+
       finiteElement::FiniteElementBase const &
       fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( m_discretizationName );
 
-      finiteElement::dispatch3D( fe, [nodalDamage, &elementSubRegion, damageFieldOnMaterial, elemNodes]( auto & finiteElement )
+      finiteElement::dispatch3D( fe, [nodalDamage, activeElementList, damageFieldOnMaterial, elemNodes]( auto & finiteElement )
       {
         using FE_TYPE = TYPEOFREF( finiteElement );
         constexpr localIndex numNodesPerElement = FE_TYPE::numNodes;
         constexpr localIndex n_q_points = FE_TYPE::numQuadraturePoints;
 
-        forAll< serialPolicy >( elementSubRegion.size(), [nodalDamage, damageFieldOnMaterial, elemNodes] ( localIndex const k )
+        forAll< parallelDevicePolicy<> >( activeElementList.size(), [nodalDamage, activeElementList, damageFieldOnMaterial, elemNodes] GEOSX_HOST_DEVICE ( localIndex const i )
         {
+          localIndex const k = activeElementList[i];
           for( localIndex q = 0; q < n_q_points; ++q )
           {
             real64 N[ numNodesPerElement ];
@@ -336,20 +427,51 @@ void PhaseFieldFractureSolver::mapDamageToQuadrature( DomainPartition & domain )
             for( localIndex a = 0; a < numNodesPerElement; ++a )
             {
               damageFieldOnMaterial( k, q ) += N[a] * nodalDamage[elemNodes( k, a )];
-              //solution is probably not going to work because the solution of the coupled solver
-              //has both damage and displacements. Using the damageResult field from the Damage solver
-              //is probably better
-              //            std::cout<<"q, N, Dnode = "<<q<<", "<<feDiscretization->m_finiteElement->value(a, q)<<",
-              // "<<nodalDamage[elemNodes(k, a)]<<std::endl;
             }
-            //          std::cout<<"damage("<<k<<","<<q<<") = "<<damageFieldOnMaterial(k,q)<<std::endl;
           }
         } );
       } );
     } );
   } );
 
+  GEOSX_LOG_LEVEL_RANK_0( 2, "\tDamage mapped to the quadrature points of " << MpiWrapper::Sum( numActiveElements ) << " of "
+                                                                           << MpiWrapper::Sum( numElements ) << " elements" );
+}
+
+real64 PhaseFieldFractureSolver::damageChange( DomainPartition & domain,
+                                               array1d< real64 > & referenceDamage,
+                                               bool const updateReference ) const
+{
+  NodeManager const & nodeManager = *domain.getMeshBody( 0 )->getMeshLevel( 0 )->getNodeManager();
+
+  PhaseFieldDamageFEM const &
+  damageSolver = *( this->getParent()->GetGroup( m_damageSolverName )->group_cast< PhaseFieldDamageFEM const * >() );
+
+  arrayView1d< real64 const > const nodalDamage = nodeManager.getReference< array1d< real64 > >( damageSolver.getFieldName() );
+  arrayView1d< integer const > const nodeGhostRank = nodeManager.ghostRank();
+
+  if( referenceDamage.size() != nodalDamage.size() )
+  {
+    referenceDamage.resize( nodalDamage.size() );
+    referenceDamage.setValues< parallelDevicePolicy<> >( nodalDamage );
+  }
+  arrayView1d< real64 > const reference = referenceDamage.toView();
+
+  RAJA::ReduceMax< parallelDeviceReduce, real64 > maxChange( 0.0 );
+
+  forAll< parallelDevicePolicy<> >( nodalDamage.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
+  {
+    if( nodeGhostRank[a] < 0 )
+    {
+      maxChange.max( LvArray::math::abs( nodalDamage[a] - reference[a] ) );
+    }
+    if( updateReference )
+    {
+      reference[a] = nodalDamage[a];
+    }
+  } );
 
+  return MpiWrapper::Max( maxChange.get() );
 }
 
 REGISTER_CATALOG_ENTRY( SolverBase, PhaseFieldFractureSolver, std::string const &, Group * const )
@@ -68,8 +68,26 @@ public:
                             integer const cycleNumber,
                             DomainPartition & domain );
 
+  /**
+   * @brief Interpolate the nodal damage to the quadrature points of the damage models of the solid solver.
+   * @param domain the domain partition
+   *
+   * Only the active elements, which have a node whose damage changed by more than the damage mapping tolerance since
+   * it was last mapped, are updated. The other elements keep the damage of their quadrature points.
+   */
   void mapDamageToQuadrature( DomainPartition & domain );
 
+  /**
+   * @brief Compute the largest change of the nodal damage since a reference damage.
+   * @param domain the domain partition
+   * @param referenceDamage the reference nodal damage, set to the current damage if it is not sized yet
+   * @param updateReference if true, the reference is set to the current damage
+   * @return the largest change over the locally owned nodes of all the ranks
+   */
+  real64 damageChange( DomainPartition & domain,
+                       array1d< real64 > & referenceDamage,
+                       bool const updateReference ) const;
+
   enum class CouplingTypeOption : integer
   {
     FixedStress,
@@ -86,6 +104,9 @@ public:
     constexpr static auto solidSolverNameString = "solidSolverName";
     constexpr static auto damageSolverNameString = "damageSolverName";
     constexpr static auto subcyclingOptionString = "subcycling";
+    constexpr static auto couplingDamageToleranceString = "couplingDamageTolerance";
+    constexpr static auto precondDamageToleranceString = "precondDamageTolerance";
+    constexpr static auto damageMappingToleranceString = "damageMappingTolerance";
 
   } PhaseFieldFractureSolverViewKeys;
 
@@ -101,6 +122,25 @@ private:
   CouplingTypeOption m_couplingTypeOption;
   integer m_subcyclingOption;
 
+  /// Largest change of the damage between two coupling iterations for the coupling to converge, 0 if not checked
+  real64 m_couplingDamageTolerance;
+
+  /// Largest change of the damage before the preconditioner of the solid solver is recomputed, negative to
+  /// recompute it with the reuse policy of its linear solver only
+  real64 m_precondDamageTolerance;
+
+  /// Nodal damage of the previous coupling iteration
+  array1d< real64 > m_couplingDamage;
+
+  /// Nodal damage when the preconditioner of the solid solver was last marked outdated
+  array1d< real64 > m_precondDamage;
+
+  /// Change of the nodal damage below which the damage of the quadrature points of an element is not updated
+  real64 m_damageMappingTolerance;
+
+  /// Nodal damage when the node was last considered changed by the mapping to the quadrature points
+  array1d< real64 > m_mappedDamage;
+
 };
 
 ENUM_STRINGS( PhaseFieldFractureSolver::CouplingTypeOption, "FixedStress", "TightlyCoupled" )
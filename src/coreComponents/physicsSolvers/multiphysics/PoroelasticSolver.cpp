@@ -22,20 +22,27 @@
 
 #include "../solidMechanics/SolidMechanicsPoroElasticKernel.hpp"
 #include "common/DataLayouts.hpp"
+#include "common/TaskGraph.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
+#include "constitutive/solid/LinearElasticIsotropic.hpp"
 #include "constitutive/solid/PoroElastic.hpp"
 #include "constitutive/fluid/SingleFluidBase.hpp"
 #include "managers/NumericalMethodsManager.hpp"
 #include "finiteElement/Kinematics.h"
+#include "linearAlgebra/interfaces/BlasLapackLA.hpp"
 #include "linearAlgebra/solvers/BlockPreconditioner.hpp"
 #include "linearAlgebra/solvers/SeparateComponentPreconditioner.hpp"
 #include "managers/DomainPartition.hpp"
 #include "mesh/MeshForLoopInterface.hpp"
 #include "meshUtilities/ComputationalGeometry.hpp"
+#include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
 #include "physicsSolvers/fluidFlow/SinglePhaseBase.hpp"
 #include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
 #include "rajaInterface/GEOS_RAJA_Interface.hpp"
 
+#include <limits>
+
 namespace geosx
 {
 
@@ -47,7 +54,10 @@ PoroelasticSolver::PoroelasticSolver( const std::string & name,
   SolverBase( name, parent ),
   m_solidSolverName(),
   m_flowSolverName(),
-  m_couplingTypeOption( CouplingTypeOption::FIM )
+  m_couplingTypeOption( CouplingTypeOption::FIM ),
+  m_couplingAcceleration( CouplingAcceleration::None ),
+  m_couplingAccelerationDepth( 5 ),
+  m_aitkenRelaxation( 1.0 )
 
 {
   registerWrapper( viewKeyStruct::solidSolverNameString, &m_solidSolverName )->
@@ -62,6 +72,17 @@ PoroelasticSolver::PoroelasticSolver( const std::string & name,
     setInputFlag( InputFlags::REQUIRED )->
     setDescription( "Coupling method. Valid options:\n* " + EnumStrings< CouplingTypeOption >::concat( "\n* " ) );
 
+  registerWrapper( viewKeyStruct::couplingAccelerationString, &m_couplingAcceleration )->
+    setApplyDefaultValue( CouplingAcceleration::None )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Acceleration of the SIM_FixedStress coupling iterations. Valid options: " +
+                    EnumStrings< CouplingAcceleration >::concat( ", " ) );
+
+  registerWrapper( viewKeyStruct::couplingAccelerationDepthString, &m_couplingAccelerationDepth )->
+    setApplyDefaultValue( 5 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of previous coupling iterations used by the Anderson acceleration" );
+
   m_linearSolverParameters.get().mgr.strategy = "Poroelastic";
   m_linearSolverParameters.get().mgr.separateComponents = true;
   m_linearSolverParameters.get().mgr.displacementFieldName = keys::TotalDisplacement;
@@ -169,7 +190,15 @@ void PoroelasticSolver::PostProcessInput()
     // otherwise it will never converge.
     m_flowSolver->getNonlinearSolverParameters().m_minIterNewton = 0;
     m_solidSolver->getNonlinearSolverParameters().m_minIterNewton = 0;
+
+    // The sub-solvers are called once per coupling iteration: let the preconditioner reuse policies
+    // count the time steps of the coupled solver instead
+    m_flowSolver->setTimeStepMarkedByCoupling( true );
+    m_solidSolver->setTimeStepMarkedByCoupling( true );
   }
+
+  GEOSX_ERROR_IF( m_couplingAccelerationDepth < 1,
+                  viewKeyStruct::couplingAccelerationDepthString << " must be at least 1" );
 }
 
 void PoroelasticSolver::InitializePostInitialConditions_PreSubGroups( Group * const problemManager )
@@ -279,11 +308,11 @@ void PoroelasticSolver::UpdateDeformationForCoupling( DomainPartition & domain )
     arrayView1d< real64 > const &
     dVol = elementSubRegion.getReference< array1d< real64 > >( SinglePhaseBase::viewKeyStruct::deltaVolumeString );
 
-    arrayView1d< real64 const > const & bulkModulus = solid.getReference< array1d< real64 > >( "BulkModulus" );
+    MaterialParameterView const bulkModulus = dynamicCast< LinearElasticIsotropic const & >( solid ).bulkModulusParameter();
 
     real64 const biotCoefficient = solid.getReference< real64 >( "BiotCoefficient" );
 
-    arrayView3d< real64 const, solid::STRESS_USD > const & stress = solid.getStress();
+    arrayView3d< solid::STATE_TYPE const, solid::STRESS_USD > const & stress = solid.getStress();
 
 
     localIndex const numNodesPerElement = elemsToNodes.size( 1 );
@@ -291,7 +320,6 @@ void PoroelasticSolver::UpdateDeformationForCoupling( DomainPartition & domain )
     fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( m_solidSolver->getDiscretizationName() );
     localIndex const numQuadraturePoints = fe.getNumQuadraturePoints();
 
-    // TODO: remove use of R1Tensor and use device policy
     forAll< parallelDevicePolicy< 32 > >( elementSubRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
     {
       real64 effectiveMeanStress = 0.0;
@@ -307,11 +335,11 @@ void PoroelasticSolver::UpdateDeformationForCoupling( DomainPartition & domain )
                  * (totalMeanStress[ei] - oldTotalMeanStress[ei] + dPres[ei]);
 
       // update element volume
-      R1Tensor Xlocal[ElementRegionManager::maxNumNodesPerElem];
+      real64 Xlocal[ElementRegionManager::maxNumNodesPerElem][3];
       for( localIndex a = 0; a < numNodesPerElement; ++a )
       {
-        Xlocal[a] = X[elemsToNodes[ei][a]];
-        Xlocal[a] += u[elemsToNodes[ei][a]];
+        LvArray::tensorOps::copy< 3 >( Xlocal[a], X[elemsToNodes[ei][a]] );
+        LvArray::tensorOps::add< 3 >( Xlocal[a], u[elemsToNodes[ei][a]] );
       }
 
       dVol[ei] = computationalGeometry::HexVolume( Xlocal ) - volume[ei];
@@ -334,25 +362,40 @@ void PoroelasticSolver::AssembleSystem( real64 const time_n,
 //                                 localMatrix,
 //                                 localRhs );
 
-  m_solidSolver->AssemblyLaunch< constitutive::PoroElasticBase,
-                                 SolidMechanicsLagrangianFEMKernels::QuasiStaticPoroElastic >( domain,
-                                                                                               dofManager,
-                                                                                               localMatrix,
-                                                                                               localRhs );
+  // J_SS and J_FF write to the rows of different fields, and may be assembled concurrently
+  TaskGraph assembly;
+
+  TaskGraph::TaskId const solidAssembly =
+    assembly.addTask( dofManager.numLocalDofs( keys::TotalDisplacement ), [&]
+  {
+    m_solidSolver->AssemblyLaunch< constitutive::PoroElasticBase,
+                                   SolidMechanicsLagrangianFEMKernels::QuasiStaticPoroElastic >( domain,
+                                                                                                 dofManager,
+                                                                                                 localMatrix,
+                                                                                                 localRhs );
+  } );
 
   // assemble J_FF
-  m_flowSolver->AssembleSystem( time_n, dt,
-                                domain,
-                                dofManager,
-                                localMatrix,
-                                localRhs );
+  TaskGraph::TaskId const flowAssembly =
+    assembly.addTask( dofManager.numLocalDofs( FlowSolverBase::viewKeyStruct::pressureString ), [&]
+  {
+    m_flowSolver->AssembleSystem( time_n, dt,
+                                  domain,
+                                  dofManager,
+                                  localMatrix,
+                                  localRhs );
+  } );
 
   // assemble J_SF
-  AssembleCouplingTerms( domain,
-                         dofManager,
-                         localMatrix,
-                         localRhs );
+  assembly.addTask( 0.0, [&]
+  {
+    AssembleCouplingTerms( domain,
+                           dofManager,
+                           localMatrix,
+                           localRhs );
+  }, { solidAssembly, flowAssembly } );
 
+  assembly.execute();
 }
 
 void PoroelasticSolver::AssembleCouplingTerms( DomainPartition const & domain,
@@ -503,15 +546,23 @@ void PoroelasticSolver::ApplyBoundaryConditions( real64 const time_n,
                                          localRhs );
 }
 
-real64 PoroelasticSolver::CalculateResidualNorm( DomainPartition const & domain,
-                                                 DofManager const & dofManager,
-                                                 arrayView1d< real64 const > const & localRhs )
+void PoroelasticSolver::CalculateLocalResidualNorms( DomainPartition const & domain,
+                                                     DofManager const & dofManager,
+                                                     arrayView1d< real64 const > const & localRhs,
+                                                     ResidualNormParts & parts )
+{
+  // the partial norms of both subsolvers are reduced together
+  m_solidSolver->CalculateLocalResidualNorms( domain, dofManager, localRhs, parts );
+  m_flowSolver->CalculateLocalResidualNorms( domain, dofManager, localRhs, parts );
+}
+
+real64 PoroelasticSolver::CombineResidualNorms( ResidualNormParts & parts )
 {
   // compute norm of momentum balance residual equations
-  real64 const momementumResidualNorm = m_solidSolver->CalculateResidualNorm( domain, dofManager, localRhs );
+  real64 const momementumResidualNorm = m_solidSolver->CombineResidualNorms( parts );
 
   // compute norm of mass balance residual equations
-  real64 const massResidualNorm = m_flowSolver->CalculateResidualNorm( domain, dofManager, localRhs );
+  real64 const massResidualNorm = m_flowSolver->CombineResidualNorms( parts );
 
   if( getLogLevel() >= 1 && logger::internal::rank==0 )
   {
@@ -564,6 +615,8 @@ void PoroelasticSolver::ApplySystemSolution( DofManager const & dofManager,
                                              real64 const scalingFactor,
                                              DomainPartition & domain )
 {
+  // send the displacement and pressure updates in a single message per neighbor
+  DeferredSynchronization deferredSync;
   // update displacement field
   m_solidSolver->ApplySystemSolution( dofManager, localSolution, scalingFactor, domain );
   // update pressure field
@@ -592,6 +645,11 @@ real64 PoroelasticSolver::SplitOperatorStep( real64 const & time_n,
 
   ImplicitStepSetup( time_n, dt, domain );
 
+  m_flowSolver->markNewTimeStep();
+  m_solidSolver->markNewTimeStep();
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
   int iter = 0;
   while( iter < m_nonlinearSolverParameters.m_maxIterNewton )
   {
@@ -631,7 +689,15 @@ real64 PoroelasticSolver::SplitOperatorStep( real64 const & time_n,
     }
     if( m_solidSolver->getNonlinearSolverParameters().m_numNewtonIterations > 0 )
     {
+      if( m_couplingAcceleration != CouplingAcceleration::None )
+      {
+        PackCouplingValues( mesh, m_couplingInput );
+      }
       UpdateDeformationForCoupling( domain );
+      if( m_couplingAcceleration != CouplingAcceleration::None )
+      {
+        AccelerateCoupling( iter, domain );
+      }
     }
     ++iter;
   }
@@ -641,6 +707,197 @@ real64 PoroelasticSolver::SplitOperatorStep( real64 const & time_n,
   return dtReturn;
 }
 
+void PoroelasticSolver::PackCouplingValues( MeshLevel & mesh, array1d< real64 > & values )
+{
+  localIndex numValues = 0;
+  forTargetSubRegionsComplete< CellElementSubRegion >( mesh, [&]( localIndex const,
+                                                                  localIndex const,
+                                                                  localIndex const,
+                                                                  ElementRegionBase &,
+                                                                  CellElementSubRegion & subRegion )
+  {
+    numValues += 2 * subRegion.size();
+  } );
+
+  values.resize( numValues );
+  m_couplingOwned.resize( numValues );
+
+  localIndex offset = 0;
+  forTargetSubRegionsComplete< CellElementSubRegion >( mesh, [&]( localIndex const,
+                                                                  localIndex const,
+                                                                  localIndex const,
+                                                                  ElementRegionBase &,
+                                                                  CellElementSubRegion & subRegion )
+  {
+    arrayView1d< integer const > const & ghostRank = subRegion.ghostRank();
+    arrayView1d< real64 const > const & poro =
+      subRegion.getReference< array1d< real64 > >( SinglePhaseBase::viewKeyStruct::porosityString );
+    arrayView1d< real64 const > const & dVol =
+      subRegion.getReference< array1d< real64 > >( SinglePhaseBase::viewKeyStruct::deltaVolumeString );
+    arrayView1d< real64 const > const & volume =
+      subRegion.getReference< array1d< real64 > >( CellBlock::viewKeyStruct::elementVolumeString );
+
+    arrayView1d< real64 > const & packed = values;
+    arrayView1d< real64 > const & owned = m_couplingOwned;
+    forAll< serialPolicy >( subRegion.size(), [=]( localIndex const ei )
+    {
+      // the volume change is scaled by the volume so that both variables have the same magnitude
+      packed[offset + 2 * ei] = poro[ei];
+      packed[offset + 2 * ei + 1] = dVol[ei] / volume[ei];
+      owned[offset + 2 * ei] = ghostRank[ei] < 0 ? 1.0 : 0.0;
+      owned[offset + 2 * ei + 1] = ghostRank[ei] < 0 ? 1.0 : 0.0;
+    } );
+    offset += 2 * subRegion.size();
+  } );
+}
+
+void PoroelasticSolver::UnpackCouplingValues( MeshLevel & mesh, arrayView1d< real64 const > const & values ) const
+{
+  localIndex offset = 0;
+  forTargetSubRegionsComplete< CellElementSubRegion >( mesh, [&]( localIndex const,
+                                                                  localIndex const,
+                                                                  localIndex const,
+                                                                  ElementRegionBase &,
+                                                                  CellElementSubRegion & subRegion )
+  {
+    arrayView1d< real64 > const & poro =
+      subRegion.getReference< array1d< real64 > >( SinglePhaseBase::viewKeyStruct::porosityString );
+    arrayView1d< real64 > const & dVol =
+      subRegion.getReference< array1d< real64 > >( SinglePhaseBase::viewKeyStruct::deltaVolumeString );
+    arrayView1d< real64 const > const & volume =
+      subRegion.getReference< array1d< real64 > >( CellBlock::viewKeyStruct::elementVolumeString );
+
+    forAll< serialPolicy >( subRegion.size(), [=]( localIndex const ei )
+    {
+      poro[ei] = values[offset + 2 * ei];
+      dVol[ei] = values[offset + 2 * ei + 1] * volume[ei];
+    } );
+    offset += 2 * subRegion.size();
+  } );
+}
+
+real64 PoroelasticSolver::CouplingDot( arrayView1d< real64 const > const & a,
+                                       arrayView1d< real64 const > const & b ) const
+{
+  real64 localDot = 0.0;
+  for( localIndex i = 0; i < a.size(); ++i )
+  {
+    localDot += m_couplingOwned[i] * a[i] * b[i];
+  }
+  return MpiWrapper::Sum( localDot );
+}
+
+void PoroelasticSolver::AccelerateCoupling( integer const iter, DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
+  // g is the fixed-point map applied to the input x, f = g - x its residual
+  array1d< real64 > values;
+  PackCouplingValues( mesh, values );
+  localIndex const numValues = values.size();
+
+  array1d< real64 > residual( numValues );
+  for( localIndex i = 0; i < numValues; ++i )
+  {
+    residual[i] = values[i] - m_couplingInput[i];
+  }
+
+  if( iter == 0 || m_prevCouplingResidual.size() != numValues )
+  {
+    // first iteration of the step: plain fixed-point update, which is already in place
+    m_aitkenRelaxation = 1.0;
+    m_couplingValueDiffs.clear();
+    m_couplingResidualDiffs.clear();
+    m_prevCouplingValues = values;
+    m_prevCouplingResidual = residual;
+    return;
+  }
+
+  array1d< real64 > residualDiff( numValues );
+  for( localIndex i = 0; i < numValues; ++i )
+  {
+    residualDiff[i] = residual[i] - m_prevCouplingResidual[i];
+  }
+
+  array1d< real64 > accelerated( numValues );
+  if( m_couplingAcceleration == CouplingAcceleration::Aitken )
+  {
+    real64 const diffNorm2 = CouplingDot( residualDiff, residualDiff );
+    if( diffNorm2 > 0.0 )
+    {
+      m_aitkenRelaxation = -m_aitkenRelaxation * CouplingDot( m_prevCouplingResidual, residualDiff ) / diffNorm2;
+    }
+    GEOSX_LOG_LEVEL_RANK_0( 2, "\tAitken relaxation: " << m_aitkenRelaxation );
+
+    for( localIndex i = 0; i < numValues; ++i )
+    {
+      accelerated[i] = m_couplingInput[i] + m_aitkenRelaxation * residual[i];
+    }
+  }
+  else
+  {
+    array1d< real64 > valueDiff( numValues );
+    for( localIndex i = 0; i < numValues; ++i )
+    {
+      valueDiff[i] = values[i] - m_prevCouplingValues[i];
+    }
+    m_couplingResidualDiffs.emplace_back( std::move( residualDiff ) );
+    m_couplingValueDiffs.emplace_back( std::move( valueDiff ) );
+    if( LvArray::integerConversion< integer >( m_couplingResidualDiffs.size() ) > m_couplingAccelerationDepth )
+    {
+      m_couplingResidualDiffs.erase( m_couplingResidualDiffs.begin() );
+      m_couplingValueDiffs.erase( m_couplingValueDiffs.begin() );
+    }
+
+    // Least-squares mixing coefficients: ( dF^T dF ) gamma = dF^T f, slightly regularized
+    localIndex const depth = LvArray::integerConversion< localIndex >( m_couplingResidualDiffs.size() );
+    array2d< real64, MatrixLayout::ROW_MAJOR_PERM > normalMatrix( depth, depth );
+    array2d< real64, MatrixLayout::ROW_MAJOR_PERM > normalMatrixInv( depth, depth );
+    array1d< real64 > normalRhs( depth );
+    for( localIndex a = 0; a < depth; ++a )
+    {
+      for( localIndex b = a; b < depth; ++b )
+      {
+        normalMatrix( a, b ) = CouplingDot( m_couplingResidualDiffs[a], m_couplingResidualDiffs[b] );
+        normalMatrix( b, a ) = normalMatrix( a, b );
+      }
+      normalRhs[a] = CouplingDot( m_couplingResidualDiffs[a], residual );
+    }
+    real64 trace = 0.0;
+    for( localIndex a = 0; a < depth; ++a )
+    {
+      trace += normalMatrix( a, a );
+    }
+    for( localIndex a = 0; a < depth; ++a )
+    {
+      normalMatrix( a, a ) += 1e-12 * trace / depth + std::numeric_limits< real64 >::min();
+    }
+    BlasLapackLA::matrixInverse( normalMatrix.toSliceConst(), normalMatrixInv.toSlice() );
+
+    accelerated = values;
+    for( localIndex a = 0; a < depth; ++a )
+    {
+      real64 gamma = 0.0;
+      for( localIndex b = 0; b < depth; ++b )
+      {
+        gamma += normalMatrixInv( a, b ) * normalRhs[b];
+      }
+      arrayView1d< real64 const > const & valueDiffA = m_couplingValueDiffs[a];
+      for( localIndex i = 0; i < numValues; ++i )
+      {
+        accelerated[i] -= gamma * valueDiffA[i];
+      }
+    }
+    GEOSX_LOG_LEVEL_RANK_0( 2, "\tAnderson acceleration with " << depth << " previous iterations" );
+  }
+
+  m_prevCouplingValues = values;
+  m_prevCouplingResidual = residual;
+  UnpackCouplingValues( mesh, accelerated );
+}
+
 
 REGISTER_CATALOG_ENTRY( SolverBase, PoroelasticSolver, std::string const &, Group * const )
 
@@ -84,10 +84,14 @@ public:
                            CRSMatrixView< real64, globalIndex const > const & localMatrix,
                            arrayView1d< real64 > const & localRhs ) override;
 
+  virtual void
+  CalculateLocalResidualNorms( DomainPartition const & domain,
+                               DofManager const & dofManager,
+                               arrayView1d< real64 const > const & localRhs,
+                               ResidualNormParts & parts ) override;
+
   virtual real64
-  CalculateResidualNorm( DomainPartition const & domain,
-                         DofManager const & dofManager,
-                         arrayView1d< real64 const > const & localRhs ) override;
+  CombineResidualNorms( ResidualNormParts & parts ) override;
 
   virtual void
   SolveSystem( DofManager const & dofManager,
@@ -129,12 +133,22 @@ public:
     SIM_FixedStress
   };
 
+  /// Acceleration of the fixed-stress coupling iterations
+  enum class CouplingAcceleration : integer
+  {
+    None,     ///< Plain fixed-point (Picard) iterations
+    Aitken,   ///< Aitken dynamic relaxation
+    Anderson  ///< Anderson mixing of the last iterates
+  };
+
 
 
   struct viewKeyStruct : SolverBase::viewKeyStruct
   {
     constexpr static auto couplingTypeOptionString = "couplingTypeOptionEnum";
     constexpr static auto couplingTypeOptionStringString = "couplingTypeOption";
+    constexpr static auto couplingAccelerationString = "couplingAcceleration";
+    constexpr static auto couplingAccelerationDepthString = "couplingAccelerationDepth";
 
     constexpr static auto totalMeanStressString = "totalMeanStress";
     constexpr static auto oldTotalMeanStressString = "oldTotalMeanStress";
@@ -166,11 +180,65 @@ private:
 
   void CreatePreconditioner();
 
+  /**
+   * @brief Gather the coupling variables (porosity and volumetric strain increment) of the cells
+   * @param mesh the mesh
+   * @param values the coupling variables
+   */
+  void PackCouplingValues( MeshLevel & mesh, array1d< real64 > & values );
+
+  /**
+   * @brief Scatter the coupling variables back to the cells
+   * @param mesh the mesh
+   * @param values the coupling variables
+   */
+  void UnpackCouplingValues( MeshLevel & mesh, arrayView1d< real64 const > const & values ) const;
+
+  /**
+   * @brief Compute the inner product of two coupling vectors over the locally owned cells of all ranks
+   * @param a the first vector
+   * @param b the second vector
+   * @return the inner product
+   */
+  real64 CouplingDot( arrayView1d< real64 const > const & a, arrayView1d< real64 const > const & b ) const;
+
+  /**
+   * @brief Replace the coupling variables just computed by UpdateDeformationForCoupling with an accelerated iterate
+   * @param iter the coupling iteration, the history is cleared when it is zero
+   * @param domain the domain
+   *
+   * The coupling variables before the update must have been stored in m_couplingInput.
+   */
+  void AccelerateCoupling( integer const iter, DomainPartition & domain );
+
   string m_solidSolverName;
   string m_flowSolverName;
 
   CouplingTypeOption m_couplingTypeOption;
 
+  /// acceleration of the fixed-stress iterations
+  CouplingAcceleration m_couplingAcceleration;
+
+  /// number of previous iterates used by the Anderson acceleration
+  integer m_couplingAccelerationDepth;
+
+  /// coupling variables before the current update of the deformation
+  array1d< real64 > m_couplingInput;
+
+  /// 1 for the coupling variables of the locally owned cells, 0 for the ghosts
+  array1d< real64 > m_couplingOwned;
+
+  /// coupling variables and residual of the previous iteration
+  array1d< real64 > m_prevCouplingValues;
+  array1d< real64 > m_prevCouplingResidual;
+
+  /// differences of the successive coupling variables and residuals, most recent last (Anderson)
+  std::vector< array1d< real64 > > m_couplingValueDiffs;
+  std::vector< array1d< real64 > > m_couplingResidualDiffs;
+
+  /// relaxation factor of the previous iteration (Aitken)
+  real64 m_aitkenRelaxation;
+
   // pointer to the flow sub-solver
   FlowSolverBase * m_flowSolver;
 
@@ -181,6 +249,8 @@ private:
 
 ENUM_STRINGS( PoroelasticSolver::CouplingTypeOption, "FIM", "SIM_FixedStress" )
 
+ENUM_STRINGS( PoroelasticSolver::CouplingAcceleration, "None", "Aitken", "Anderson" )
+
 } /* namespace geosx */
 
 #endif /* GEOSX_PHYSICSSOLVERS_COUPLEDSOLVERS_POROELASTICSOLVER_HPP_ */
@@ -23,10 +23,16 @@
 
 #include "ReservoirSolverBase.hpp"
 
+#include "codingUtilities/Utilities.hpp"
+#include "common/TaskGraph.hpp"
 #include "common/TimingMacros.hpp"
+#include "linearAlgebra/interfaces/BlasLapackLA.hpp"
+#include "mpiCommunications/CommunicationTools.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBase.hpp"
 #include "physicsSolvers/fluidFlow/wells/WellSolverBase.hpp"
 
+#include <algorithm>
+
 namespace geosx
 {
 
@@ -37,8 +43,12 @@ ReservoirSolverBase::ReservoirSolverBase( const std::string & name,
                                           Group * const parent ):
   SolverBase( name, parent ),
   m_flowSolverName(),
-  m_wellSolverName()
+  m_wellSolverName(),
+  m_wellCondensation( 0 ),
+  m_numGlobalCondensedWells( 0 )
 {
+  m_resDofNumber.setName( getName() + "/accessors/resDofNumber" );
+
   registerWrapper( viewKeyStruct::flowSolverNameString, &m_flowSolverName )->
     setInputFlag( InputFlags::REQUIRED )->
     setDescription( "Name of the flow solver to use in the reservoir-well system solver" );
@@ -47,6 +57,12 @@ ReservoirSolverBase::ReservoirSolverBase( const std::string & name,
     setInputFlag( InputFlags::REQUIRED )->
     setDescription( "Name of the well solver to use in the reservoir-well system solver" );
 
+  registerWrapper( viewKeyStruct::wellCondensationString, &m_wellCondensation )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to eliminate the well unknowns from the linear system before the solve, and to recover them "
+                    "afterwards. Only the wells entirely on one rank, perforations included, are eliminated." );
+
   this->getWrapper< string >( viewKeyStruct::discretizationString )->
     setInputFlag( InputFlags::FALSE );
 
@@ -217,38 +233,74 @@ void ReservoirSolverBase::SetupSystem( DomainPartition & domain,
   dofManager.setMesh( domain, 0, 0 );
 
   SetupDofs( domain, dofManager );
-  dofManager.reorderByRank();
-
-  // Set the sparsity pattern without reservoir-well coupling
-  SparsityPattern< globalIndex > patternDiag;
-  dofManager.setSparsityPattern( patternDiag );
+  dofManager.reorderByRank( m_linearSolverParameters.get().dofOrdering );
 
-  // Get the original row lengths (diagonal blocks only)
-  array1d< localIndex > rowLengths( patternDiag.numRows() );
-  for( localIndex localRow = 0; localRow < patternDiag.numRows(); ++localRow )
+  // the perforations are static and the well controls do not change the DOFs, so the coupled
+  // pattern, and the condensed wells, are kept as long as the DOF layout is unchanged
+  if( dofManager.canReuseSparsityPattern( localMatrix ) )
   {
-    rowLengths[localRow] = patternDiag.numNonZeros( localRow );
+    localMatrix.setValues< parallelDevicePolicy<> >( 0.0 );
   }
+  else
+  {
+    // Set the sparsity pattern without reservoir-well coupling
+    SparsityPattern< globalIndex > patternDiag;
+    dofManager.setSparsityPattern( patternDiag );
 
-  // Add the number of nonzeros induced by coupling on perforations
-  AddCouplingNumNonzeros( domain, dofManager, rowLengths.toView() );
+    // Get the original row lengths (diagonal blocks only)
+    array1d< localIndex > rowLengths( patternDiag.numRows() );
+    for( localIndex localRow = 0; localRow < patternDiag.numRows(); ++localRow )
+    {
+      rowLengths[localRow] = patternDiag.numNonZeros( localRow );
+    }
 
-  // Create a new pattern with enough capacity for coupled matrix
-  SparsityPattern< globalIndex > pattern;
-  pattern.resizeFromRowCapacities< parallelHostPolicy >( patternDiag.numRows(), patternDiag.numColumns(), rowLengths.data() );
+    // Add the number of nonzeros induced by coupling on perforations
+    AddCouplingNumNonzeros( domain, dofManager, rowLengths.toView() );
 
-  // Copy the original nonzeros
-  for( localIndex localRow = 0; localRow < patternDiag.numRows(); ++localRow )
-  {
-    globalIndex const * cols = patternDiag.getColumns( localRow ).dataIfContiguous();
-    pattern.insertNonZeros( localRow, cols, cols + patternDiag.numNonZeros( localRow ) );
-  }
+    // The condensation of a well couples all its perforated reservoir elements
+    FindCondensedWells( domain, dofManager );
+    for( CondensedWell const & well : m_condensedWells )
+    {
+      for( localIndex const row : well.resRows )
+      {
+        rowLengths[row] += well.resRows.size();
+      }
+    }
+
+    // Create a new pattern with enough capacity for coupled matrix
+    SparsityPattern< globalIndex > pattern;
+    pattern.resizeFromRowCapacities< parallelHostPolicy >( patternDiag.numRows(),
+                                                           patternDiag.numColumns(),
+                                                           rowLengths.data() );
+
+    // Copy the original nonzeros
+    for( localIndex localRow = 0; localRow < patternDiag.numRows(); ++localRow )
+    {
+      globalIndex const * cols = patternDiag.getColumns( localRow ).dataIfContiguous();
+      pattern.insertNonZeros( localRow, cols, cols + patternDiag.numNonZeros( localRow ) );
+    }
+
+    // Add the nonzeros from coupling
+    AddCouplingSparsityPattern( domain, dofManager, pattern.toView() );
+
+    globalIndex const rankOffset = dofManager.rankOffset();
+    for( CondensedWell const & well : m_condensedWells )
+    {
+      array1d< globalIndex > resDofs( well.resRows.size() );
+      for( localIndex i = 0; i < well.resRows.size(); ++i )
+      {
+        resDofs[i] = rankOffset + well.resRows[i];
+      }
+      for( localIndex const row : well.resRows )
+      {
+        pattern.insertNonZeros( row, resDofs.begin(), resDofs.end() );
+      }
+    }
 
-  // Add the nonzeros from coupling
-  AddCouplingSparsityPattern( domain, dofManager, pattern.toView() );
+    // Finally, steal the pattern into a CRS matrix
+    localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
+  }
 
-  // Finally, steal the pattern into a CRS matrix
-  localMatrix.assimilate< parallelDevicePolicy<> >( std::move( pattern ) );
   localRhs.resize( localMatrix.numRows() );
   localSolution.resize( localMatrix.numRows() );
 
@@ -275,41 +327,58 @@ void ReservoirSolverBase::AssembleSystem( real64 const time_n,
                                           CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                           arrayView1d< real64 > const & localRhs )
 {
+  // J_RR and J_WW write to the rows of different fields, and may be assembled concurrently
+  TaskGraph assembly;
+
   // assemble J_RR (excluding perforation rates)
-  m_flowSolver->AssembleSystem( time_n, dt,
-                                domain,
-                                dofManager,
-                                localMatrix,
-                                localRhs );
-
-  /*
-   * This redundant call to UpdateStateAll is here to make sure that we compute the
-   * perforation rates AFTER the reservoir phase compositions have been moved to device.
-   *
-   * An issue with ElementViewAccessors is that if the outer arrays are already on device,
-   * but an inner array gets touched and updated on host, capturing outer arrays in a device kernel
-   * DOES NOT call move() on the inner array (see implementation of NewChaiBuffer::moveNested()).
-   * Here we force the move by launching a dummy kernel.
-   *
-   * If the perforation rates are computed BEFORE the reservoir phase compositions have been
-   * moved to device, the calculation is wrong. the problem should go away when fluid updates
-   * are executed on device.
-   */
-  m_wellSolver->UpdateStateAll( domain );
-
-  // assemble J_WW (excluding perforation rates)
-  m_wellSolver->AssembleSystem( time_n, dt,
-                                domain,
-                                dofManager,
-                                localMatrix,
-                                localRhs );
+  TaskGraph::TaskId const flowAssembly =
+    assembly.addTask( dofManager.numLocalDofs( m_wellSolver->ResElementDofName() ), [&]
+  {
+    m_flowSolver->AssembleSystem( time_n, dt,
+                                  domain,
+                                  dofManager,
+                                  localMatrix,
+                                  localRhs );
+  } );
+
+  TaskGraph::TaskId const wellAssembly =
+    assembly.addTask( dofManager.numLocalDofs( m_wellSolver->WellElementDofName() ), [&]
+  {
+    /*
+     * This redundant call to UpdateStateAll is here to make sure that we compute the
+     * perforation rates AFTER the reservoir phase compositions have been moved to device.
+     *
+     * An issue with ElementViewAccessors is that if the outer arrays are already on device,
+     * but an inner array gets touched and updated on host, capturing outer arrays in a device kernel
+     * DOES NOT call move() on the inner array (see implementation of NewChaiBuffer::moveNested()).
+     * Here we force the move by launching a dummy kernel.
+     *
+     * If the perforation rates are computed BEFORE the reservoir phase compositions have been
+     * moved to device, the calculation is wrong. the problem should go away when fluid updates
+     * are executed on device. The tasks only run concurrently on host builds, so this still
+     * follows the assembly of J_RR on device.
+     */
+    m_wellSolver->UpdateStateAll( domain );
+
+    // assemble J_WW (excluding perforation rates)
+    m_wellSolver->AssembleSystem( time_n, dt,
+                                  domain,
+                                  dofManager,
+                                  localMatrix,
+                                  localRhs );
+  } );
 
   // assemble perforation rates in J_WR, J_RW, J_RR and J_WW
-  AssembleCouplingTerms( time_n, dt,
-                         domain,
-                         dofManager,
-                         localMatrix,
-                         localRhs );
+  assembly.addTask( 0.0, [&]
+  {
+    AssembleCouplingTerms( time_n, dt,
+                           domain,
+                           dofManager,
+                           localMatrix,
+                           localRhs );
+  }, { flowAssembly, wellAssembly } );
+
+  assembly.execute();
 }
 
 
@@ -329,14 +398,22 @@ void ReservoirSolverBase::ApplyBoundaryConditions( real64 const time_n,
   // no boundary conditions for wells
 }
 
-real64 ReservoirSolverBase::CalculateResidualNorm( DomainPartition const & domain,
-                                                   DofManager const & dofManager,
-                                                   arrayView1d< real64 const > const & localRhs )
+void ReservoirSolverBase::CalculateLocalResidualNorms( DomainPartition const & domain,
+                                                       DofManager const & dofManager,
+                                                       arrayView1d< real64 const > const & localRhs,
+                                                       ResidualNormParts & parts )
+{
+  // the partial norms of the reservoir and well equations are reduced together
+  m_flowSolver->CalculateLocalResidualNorms( domain, dofManager, localRhs, parts );
+  m_wellSolver->CalculateLocalResidualNorms( domain, dofManager, localRhs, parts );
+}
+
+real64 ReservoirSolverBase::CombineResidualNorms( ResidualNormParts & parts )
 {
   // compute norm of reservoir equations residuals
-  real64 const reservoirResidualNorm = m_flowSolver->CalculateResidualNorm( domain, dofManager, localRhs );
+  real64 const reservoirResidualNorm = m_flowSolver->CombineResidualNorms( parts );
   // compute norm of well equations residuals
-  real64 const wellResidualNorm      = m_wellSolver->CalculateResidualNorm( domain, dofManager, localRhs );
+  real64 const wellResidualNorm      = m_wellSolver->CombineResidualNorms( parts );
 
   return sqrt( reservoirResidualNorm * reservoirResidualNorm + wellResidualNorm * wellResidualNorm );
 }
@@ -348,9 +425,263 @@ void ReservoirSolverBase::SolveSystem( DofManager const & dofManager,
 {
   GEOSX_MARK_FUNCTION;
 
+  // the well unknowns are eliminated from the local system, which is then distributed again
+  if( m_numGlobalCondensedWells > 0 )
+  {
+    CondenseWells( dofManager.rankOffset(), m_localMatrix.toViewConstSizes(), m_localRhs.toView() );
+    matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
+    rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
+  }
+
   rhs.scale( -1.0 );
   solution.zero();
   SolverBase::SolveSystem( dofManager, matrix, rhs, solution );
+
+  if( m_numGlobalCondensedWells > 0 )
+  {
+    solution.extract( m_localSolution );
+    BackSubstituteWells( m_localSolution.toView() );
+    solution.create( m_localSolution.toViewConst(), MPI_COMM_GEOSX );
+  }
+}
+
+void ReservoirSolverBase::FindCondensedWells( DomainPartition const & domain,
+                                              DofManager const & dofManager )
+{
+  m_condensedWells.clear();
+  m_numGlobalCondensedWells = 0;
+  if( !m_wellCondensation )
+  {
+    return;
+  }
+
+  localIndex const resNDOF = m_wellSolver->NumDofPerResElement();
+  localIndex const wellNDOF = m_wellSolver->NumDofPerWellElement();
+
+  MeshLevel const & meshLevel = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  ElementRegionManager const & elemManager = *meshLevel.getElemManager();
+
+  string const wellDofKey = dofManager.getKey( m_wellSolver->WellElementDofName() );
+  string const resDofKey = dofManager.getKey( m_wellSolver->ResElementDofName() );
+
+  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const & resElemDofNumber =
+    elemManager.ConstructArrayViewAccessor< globalIndex, 1 >( resDofKey );
+
+  ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > const & resElemGhostRank =
+    elemManager.ConstructArrayViewAccessor< integer, 1 >( ObjectManagerBase::viewKeyStruct::ghostRankString );
+
+  globalIndex const rankOffset = dofManager.rankOffset();
+
+  // the well subregions are the same on all the ranks, so that the global reductions match
+  elemManager.forElementSubRegions< WellElementSubRegion >( [&]( WellElementSubRegion const & subRegion )
+  {
+    PerforationData const * const perforationData = subRegion.GetPerforationData();
+
+    arrayView1d< localIndex const > const & resElementRegion = perforationData->GetMeshElements().m_toElementRegion;
+    arrayView1d< localIndex const > const & resElementSubRegion = perforationData->GetMeshElements().m_toElementSubRegion;
+    arrayView1d< localIndex const > const & resElementIndex = perforationData->GetMeshElements().m_toElementIndex;
+
+    localIndex const numOwnedWellElems = subRegion.GetNumberOfLocalIndices();
+    localIndex const numPerforations = perforationData->size();
+
+    bool ownsReservoirElements = true;
+    for( localIndex iperf = 0; iperf < numPerforations; ++iperf )
+    {
+      localIndex const er = resElementRegion[iperf];
+      localIndex const esr = resElementSubRegion[iperf];
+      localIndex const ei = resElementIndex[iperf];
+      ownsReservoirElements = ownsReservoirElements && resElemGhostRank[er][esr][ei] < 0;
+    }
+
+    // no other rank has well elements or perforations of this well, the reductions are done on all the ranks
+    localIndex const numGlobalWellElems = MpiWrapper::Sum( numOwnedWellElems );
+    localIndex const numGlobalPerforations = MpiWrapper::Sum( numPerforations );
+    bool const isCondensed = numOwnedWellElems > 0 &&
+                             numOwnedWellElems == subRegion.size() &&
+                             numOwnedWellElems == numGlobalWellElems &&
+                             numPerforations == numGlobalPerforations &&
+                             ownsReservoirElements;
+    if( !isCondensed )
+    {
+      return;
+    }
+
+    arrayView1d< globalIndex const > const & wellElemDofNumber =
+      subRegion.getReference< array1d< globalIndex > >( wellDofKey );
+
+    CondensedWell well;
+    for( localIndex iwelem = 0; iwelem < subRegion.size(); ++iwelem )
+    {
+      for( localIndex idof = 0; idof < wellNDOF; ++idof )
+      {
+        globalIndex const wellDofNumber = wellElemDofNumber[iwelem] + idof;
+        well.wellRows.emplace_back( LvArray::integerConversion< localIndex >( wellDofNumber - rankOffset ) );
+      }
+    }
+    for( localIndex iperf = 0; iperf < numPerforations; ++iperf )
+    {
+      localIndex const er = resElementRegion[iperf];
+      localIndex const esr = resElementSubRegion[iperf];
+      localIndex const ei = resElementIndex[iperf];
+      globalIndex const resDofNumber = resElemDofNumber[er][esr][ei];
+      for( localIndex idof = 0; idof < resNDOF; ++idof )
+      {
+        well.resRows.emplace_back( LvArray::integerConversion< localIndex >( resDofNumber + idof - rankOffset ) );
+      }
+    }
+
+    // several perforations may share a reservoir element
+    std::sort( well.wellRows.begin(), well.wellRows.end() );
+    std::sort( well.resRows.begin(), well.resRows.end() );
+    well.resRows.resize( std::unique( well.resRows.begin(), well.resRows.end() ) - well.resRows.begin() );
+
+    m_condensedWells.emplace_back( std::move( well ) );
+  } );
+
+  m_numGlobalCondensedWells = MpiWrapper::Sum( LvArray::integerConversion< globalIndex >( m_condensedWells.size() ) );
+  GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": " << m_numGlobalCondensedWells
+                                       << " well(s) condensed before the linear solve" );
+}
+
+void ReservoirSolverBase::CondenseWells( globalIndex const rankOffset,
+                                         CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                         arrayView1d< real64 > const & localRhs )
+{
+  GEOSX_MARK_FUNCTION;
+
+  // the wells may share reservoir elements, they are condensed one after the other
+  for( CondensedWell & well : m_condensedWells )
+  {
+    localIndex const numWellRows = well.wellRows.size();
+    localIndex const numResRows = well.resRows.size();
+
+    auto const findRow = []( array1d< localIndex > const & rows, globalIndex const col, globalIndex const offset )
+    {
+      localIndex const row = LvArray::integerConversion< localIndex >( col - offset );
+      localIndex const * const pos = std::lower_bound( rows.begin(), rows.end(), row );
+      return ( pos != rows.end() && *pos == row ) ? LvArray::integerConversion< localIndex >( pos - rows.begin() ) : -1;
+    };
+
+    // dense blocks of the well rows
+    array2d< real64 > wellBlock( numWellRows, numWellRows );
+    array2d< real64 > wellResBlock( numWellRows, numResRows );
+    array1d< real64 > wellResidual( numWellRows );
+    for( localIndex i = 0; i < numWellRows; ++i )
+    {
+      localIndex const row = well.wellRows[i];
+      arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( row );
+      arraySlice1d< real64 > const entries = localMatrix.getEntries( row );
+      for( localIndex k = 0; k < localMatrix.numNonZeros( row ); ++k )
+      {
+        localIndex const j = findRow( well.wellRows, columns[k], rankOffset );
+        if( j >= 0 )
+        {
+          wellBlock[i][j] = entries[k];
+        }
+        else
+        {
+          localIndex const jres = findRow( well.resRows, columns[k], rankOffset );
+          GEOSX_ERROR_IF( jres < 0 && entries[k] != 0.0,
+                          getName() << ": unexpected coupling of a condensed well with the column " << columns[k] );
+          if( jres >= 0 )
+          {
+            wellResBlock[i][jres] = entries[k];
+          }
+        }
+        // the well rows are replaced by the identity
+        entries[k] = ( columns[k] == rankOffset + row ) ? 1.0 : 0.0;
+      }
+      wellResidual[i] = localRhs[row];
+      localRhs[row] = 0.0;
+    }
+
+    // dense block of the reservoir rows, whose couplings with the well are removed
+    array2d< real64 > resWellBlock( numResRows, numWellRows );
+    for( localIndex i = 0; i < numResRows; ++i )
+    {
+      localIndex const row = well.resRows[i];
+      arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( row );
+      arraySlice1d< real64 > const entries = localMatrix.getEntries( row );
+      for( localIndex k = 0; k < localMatrix.numNonZeros( row ); ++k )
+      {
+        localIndex const j = findRow( well.wellRows, columns[k], rankOffset );
+        if( j >= 0 )
+        {
+          resWellBlock[i][j] = entries[k];
+          entries[k] = 0.0;
+        }
+      }
+    }
+
+    // the well blocks are small, their inverse is cheaper to apply than a factorization
+    array2d< real64 > wellBlockInv( numWellRows, numWellRows );
+    real64 det;
+    BlasLapackLA::matrixInverse( wellBlock.toSliceConst(), wellBlockInv.toSlice(), det );
+    GEOSX_ERROR_IF( isZero( det, 0.0 ), getName() << ": singular well block in the condensation" );
+
+    well.wellToRes.resize( numWellRows, numResRows );
+    well.wellRhs.resize( numWellRows );
+    BlasLapackLA::matrixMatrixMultiply( wellBlockInv.toSliceConst(),
+                                        wellResBlock.toSliceConst(),
+                                        well.wellToRes.toSlice() );
+    BlasLapackLA::matrixVectorMultiply( wellBlockInv.toSliceConst(),
+                                        wellResidual.toSliceConst(),
+                                        well.wellRhs.toSlice() );
+
+    // Schur complement on the perforated reservoir elements
+    array2d< real64 > schur( numResRows, numResRows );
+    array1d< real64 > schurRhs( numResRows );
+    BlasLapackLA::matrixMatrixMultiply( resWellBlock.toSliceConst(),
+                                        well.wellToRes.toSliceConst(),
+                                        schur.toSlice(),
+                                        -1.0 );
+    BlasLapackLA::matrixVectorMultiply( resWellBlock.toSliceConst(),
+                                        well.wellRhs.toSliceConst(),
+                                        schurRhs.toSlice(),
+                                        -1.0 );
+
+    array1d< globalIndex > resDofs( numResRows );
+    for( localIndex i = 0; i < numResRows; ++i )
+    {
+      resDofs[i] = rankOffset + well.resRows[i];
+    }
+    for( localIndex i = 0; i < numResRows; ++i )
+    {
+      localMatrix.addToRowBinarySearchUnsorted< serialAtomic >( well.resRows[i],
+                                                                resDofs.data(),
+                                                                schur[i].dataIfContiguous(),
+                                                                numResRows );
+      localRhs[well.resRows[i]] += schurRhs[i];
+    }
+  }
+}
+
+void ReservoirSolverBase::BackSubstituteWells( arrayView1d< real64 > const & localSolution ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  // the well rows of the system solve A_WW x_W = -r_W - A_WR x_R
+  for( CondensedWell const & well : m_condensedWells )
+  {
+    array1d< real64 > resSolution( well.resRows.size() );
+    for( localIndex i = 0; i < well.resRows.size(); ++i )
+    {
+      resSolution[i] = localSolution[well.resRows[i]];
+    }
+
+    array1d< real64 > wellSolution( well.wellRows.size() );
+    BlasLapackLA::vectorCopy( well.wellRhs.toSliceConst(), wellSolution.toSlice() );
+    BlasLapackLA::matrixVectorMultiply( well.wellToRes.toSliceConst(),
+                                        resSolution.toSliceConst(),
+                                        wellSolution.toSlice(),
+                                        -1.0,
+                                        -1.0 );
+
+    for( localIndex i = 0; i < well.wellRows.size(); ++i )
+    {
+      localSolution[well.wellRows[i]] = wellSolution[i];
+    }
+  }
 }
 
 bool ReservoirSolverBase::CheckSystemSolution( DomainPartition const & domain,
@@ -369,6 +700,8 @@ void ReservoirSolverBase::ApplySystemSolution( DofManager const & dofManager,
                                                real64 const scalingFactor,
                                                DomainPartition & domain )
 {
+  // send the reservoir and well updates in a single message per neighbor
+  DeferredSynchronization deferredSync;
   // update the reservoir variables
   m_flowSolver->ApplySystemSolution( dofManager, localSolution, scalingFactor, domain );
   // update the well variables
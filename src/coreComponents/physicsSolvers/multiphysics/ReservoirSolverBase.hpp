@@ -24,8 +24,11 @@
 #ifndef GEOSX_PHYSICSSOLVERS_MULTIPHYSICS_RESERVOIRSOLVERBASE_HPP_
 #define GEOSX_PHYSICSSOLVERS_MULTIPHYSICS_RESERVOIRSOLVERBASE_HPP_
 
+#include "mesh/CachedElementViewAccessor.hpp"
 #include "physicsSolvers/SolverBase.hpp"
 
+#include <vector>
+
 namespace geosx
 {
 
@@ -107,10 +110,14 @@ public:
                            CRSMatrixView< real64, globalIndex const > const & localMatrix,
                            arrayView1d< real64 > const & localRhs ) override;
 
+  virtual void
+  CalculateLocalResidualNorms( DomainPartition const & domain,
+                               DofManager const & dofManager,
+                               arrayView1d< real64 const > const & localRhs,
+                               ResidualNormParts & parts ) override;
+
   virtual real64
-  CalculateResidualNorm( DomainPartition const & domain,
-                         DofManager const & dofManager,
-                         arrayView1d< real64 const > const & localRhs ) override;
+  CombineResidualNorms( ResidualNormParts & parts ) override;
 
   virtual void
   SolveSystem( DofManager const & dofManager,
@@ -181,6 +188,9 @@ public:
     // solver that assembles the well
     constexpr static auto wellSolverNameString = "wellSolverName";
 
+    // flag to eliminate the well unknowns before the linear solve
+    constexpr static auto wellCondensationString = "wellCondensation";
+
   } reservoirWellsSolverViewKeys;
 
 
@@ -209,6 +219,34 @@ protected:
    */
   virtual void ResetViews( DomainPartition * const domain );
 
+  /**
+   * @brief Find the wells whose unknowns can be eliminated locally from the linear system.
+   * @param domain the physical domain object
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   *
+   * A well is condensed by the rank that owns all its elements and all its perforated reservoir elements,
+   * the other wells are kept in the global system.
+   */
+  void FindCondensedWells( DomainPartition const & domain,
+                           DofManager const & dofManager );
+
+  /**
+   * @brief Eliminate the unknowns of the condensed wells from the local system.
+   * @param rankOffset the offset of the local rows
+   * @param localMatrix the system matrix, replaced by the Schur complement on the reservoir rows
+   *                    and by the identity on the well rows
+   * @param localRhs the system right-hand side vector, condensed in the same way
+   */
+  void CondenseWells( globalIndex const rankOffset,
+                      CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                      arrayView1d< real64 > const & localRhs );
+
+  /**
+   * @brief Recover the unknowns of the condensed wells from the reservoir solution.
+   * @param localSolution the solution of the condensed system, overwritten on the well rows
+   */
+  void BackSubstituteWells( arrayView1d< real64 > const & localSolution ) const;
+
   /// solver that assembles the reservoir equations
   string m_flowSolverName;
 
@@ -221,6 +259,31 @@ protected:
   /// pointer to the well sub-solver
   WellSolverBase * m_wellSolver;
 
+  /// flag to eliminate the well unknowns before the linear solve
+  integer m_wellCondensation;
+
+  /// Accessor to the degrees of freedom of the reservoir elements, rebuilt only when the mesh changes
+  CachedElementViewAccessor< array1d< globalIndex >, arrayView1d< globalIndex const > > m_resDofNumber;
+
+  /// A well whose unknowns are eliminated locally
+  struct CondensedWell
+  {
+    /// Sorted local rows of the well unknowns
+    array1d< localIndex > wellRows;
+    /// Sorted local rows of the unknowns of the perforated reservoir elements
+    array1d< localIndex > resRows;
+    /// Inverse of the well block times the well-reservoir block, from the last condensation
+    array2d< real64 > wellToRes;
+    /// Inverse of the well block times the well right-hand side, from the last condensation
+    array1d< real64 > wellRhs;
+  };
+
+  /// The wells condensed by this rank
+  std::vector< CondensedWell > m_condensedWells;
+
+  /// Number of condensed wells over all the ranks
+  globalIndex m_numGlobalCondensedWells;
+
 };
 
 } /* namespace geosx */
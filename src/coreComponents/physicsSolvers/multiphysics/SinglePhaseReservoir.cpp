@@ -37,7 +37,9 @@ using namespace constitutive;
 SinglePhaseReservoir::SinglePhaseReservoir( const std::string & name,
                                             Group * const parent ):
   ReservoirSolverBase( name, parent )
-{}
+{
+  m_linearSolverParameters.get().mgr.strategy = "SinglePhaseReservoir";
+}
 
 SinglePhaseReservoir::~SinglePhaseReservoir()
 {}
@@ -141,10 +143,8 @@ void SinglePhaseReservoir::AssembleCouplingTerms( real64 const GEOSX_UNUSED_PARA
   ElementRegionManager const & elemManager = *meshLevel.getElemManager();
 
   string const resDofKey = dofManager.getKey( m_wellSolver->ResElementDofName() );
-  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > const resDofNumberAccessor =
-    elemManager.ConstructArrayViewAccessor< globalIndex, 1 >( resDofKey );
   ElementRegionManager::ElementViewConst< arrayView1d< globalIndex const > > const resDofNumber =
-    resDofNumberAccessor.toNestedViewConst();
+    m_resDofNumber.get( elemManager, resDofKey ).toNestedViewConst();
   globalIndex const rankOffset = dofManager.rankOffset();
 
   // loop over the wells
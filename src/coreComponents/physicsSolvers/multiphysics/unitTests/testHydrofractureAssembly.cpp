@@ -0,0 +1,238 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "codingUtilities/UnitTestUtilities.hpp"
+#include "common/TaskGraph.hpp"
+#include "managers/initialization.hpp"
+#include "managers/ProblemManager.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/unitTests/testCompFlowUtils.hpp"
+#include "physicsSolvers/multiphysics/HydrofractureSolver.hpp"
+
+using namespace geosx;
+using namespace geosx::testing;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Solvers gravityVector=\"0.0, 0.0, 0.0\">\n"
+  "    <Hydrofracture name=\"hydrofracture\"\n"
+  "                   solidSolverName=\"lagsolve\"\n"
+  "                   fluidSolverName=\"SinglePhaseFlow\"\n"
+  "                   couplingTypeOption=\"FIM\"\n"
+  "                   logLevel=\"0\"\n"
+  "                   discretization=\"FE1\"\n"
+  "                   targetRegions=\"{ Domain, Fracture }\"\n"
+  "                   contactRelationName=\"fractureContact\">\n"
+  "      <NonlinearSolverParameters newtonTol=\"1.0e-5\"\n"
+  "                                 newtonMaxIter=\"20\"/>\n"
+  "      <LinearSolverParameters solverType=\"direct\"/>\n"
+  "    </Hydrofracture>\n"
+  "    <SolidMechanicsLagrangianSSLE name=\"lagsolve\"\n"
+  "                                  timeIntegrationOption=\"QuasiStatic\"\n"
+  "                                  discretization=\"FE1\"\n"
+  "                                  targetRegions=\"{ Domain, Fracture }\"\n"
+  "                                  solidMaterialNames=\"{ rock }\"\n"
+  "                                  contactRelationName=\"fractureContact\"/>\n"
+  "    <SinglePhaseFVM name=\"SinglePhaseFlow\"\n"
+  "                    discretization=\"singlePhaseTPFA\"\n"
+  "                    targetRegions=\"{ Fracture }\"\n"
+  "                    fluidNames=\"{ water }\"\n"
+  "                    solidNames=\"{ rock }\"\n"
+  "                    inputFluxEstimate=\"1\"\n"
+  "                    meanPermCoeff=\"0.8\"/>\n"
+  "    <SurfaceGenerator name=\"SurfaceGen\"\n"
+  "                      fractureRegion=\"Fracture\"\n"
+  "                      targetRegions=\"{ Domain }\"\n"
+  "                      nodeBasedSIF=\"1\"\n"
+  "                      solidMaterialNames=\"{ rock }\"\n"
+  "                      rockToughness=\"3e6\"/>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh1\"\n"
+  "                  elementTypes=\"{ C3D8 }\"\n"
+  "                  xCoords=\"{ -2, 2 }\"\n"
+  "                  yCoords=\"{ 0, 4 }\"\n"
+  "                  zCoords=\"{ 0, 1 }\"\n"
+  "                  nx=\"{ 4 }\"\n"
+  "                  ny=\"{ 4 }\"\n"
+  "                  nz=\"{ 1 }\"\n"
+  "                  cellBlockNames=\"{ cb1 }\"/>\n"
+  "  </Mesh>\n"
+  "  <Geometry>\n"
+  "    <Box name=\"fracture\" xMin=\"-0.01, -1.01, -0.01\" xMax=\" 0.01, 2.01, 1.01\"/>\n"
+  "    <Box name=\"source\" xMin=\"-0.01, -1.01, -0.01\" xMax=\" 0.01, 1.01, 1.01\"/>\n"
+  "    <Box name=\"core\" xMin=\"-0.01, -1.01, -0.01\" xMax=\" 0.01, 4.01, 1.01\"/>\n"
+  "  </Geometry>\n"
+  "  <Events maxTime=\"1.0\">\n"
+  "    <SoloEvent name=\"preFracture\"\n"
+  "               target=\"/Solvers/SurfaceGen\"/>\n"
+  "    <PeriodicEvent name=\"solverApplications\"\n"
+  "                   forceDt=\"1.0\"\n"
+  "                   target=\"/Solvers/hydrofracture\"/>\n"
+  "  </Events>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteElements>\n"
+  "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+  "    </FiniteElements>\n"
+  "    <FiniteVolume>\n"
+  "      <TwoPointFluxApproximation name=\"singlePhaseTPFA\"\n"
+  "                                 fieldName=\"pressure\"\n"
+  "                                 coefficientName=\"permeability\"/>\n"
+  "    </FiniteVolume>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"Domain\" cellBlocks=\"{ cb1 }\" materialList=\"{ water, rock }\"/>\n"
+  "    <SurfaceElementRegion name=\"Fracture\" defaultAperture=\"0.02e-3\" materialList=\"{ water, rock }\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <CompressibleSinglePhaseFluid name=\"water\"\n"
+  "                                  defaultDensity=\"1000\"\n"
+  "                                  defaultViscosity=\"1.0e-3\"\n"
+  "                                  referencePressure=\"0.0\"\n"
+  "                                  referenceDensity=\"1000\"\n"
+  "                                  compressibility=\"5e-10\"\n"
+  "                                  referenceViscosity=\"1.0e-3\"\n"
+  "                                  viscosibility=\"0.0\"/>\n"
+  "    <PoroLinearElasticIsotropic name=\"rock\"\n"
+  "                                defaultDensity=\"2700\"\n"
+  "                                defaultBulkModulus=\"20.0e9\"\n"
+  "                                defaultShearModulus=\"12.0e9\"\n"
+  "                                BiotCoefficient=\"1\"\n"
+  "                                compressibility=\"1.6155088853e-18\"\n"
+  "                                referencePressure=\"2.125e6\"/>\n"
+  "    <Contact name=\"fractureContact\" penaltyStiffness=\"1.0e0\">\n"
+  "      <TableFunction name=\"aperTable\" coordinates=\"{ -1.0e-3, 0.0 }\" values=\"{ 0.002e-3, 0.02e-3 }\"/>\n"
+  "    </Contact>\n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification name=\"waterDensity\" initialCondition=\"1\" setNames=\"{ fracture }\"\n"
+  "                        objectPath=\"ElementRegions\" fieldName=\"water_density\" scale=\"1000\"/>\n"
+  "    <FieldSpecification name=\"separableFace\" initialCondition=\"1\" setNames=\"{ core }\"\n"
+  "                        objectPath=\"faceManager\" fieldName=\"isFaceSeparable\" scale=\"1\"/>\n"
+  "    <FieldSpecification name=\"frac\" initialCondition=\"1\" setNames=\"{ fracture }\"\n"
+  "                        objectPath=\"faceManager\" fieldName=\"ruptureState\" scale=\"1\"/>\n"
+  "    <FieldSpecification name=\"yconstraint\" objectPath=\"nodeManager\" fieldName=\"TotalDisplacement\"\n"
+  "                        component=\"1\" scale=\"0.0\" setNames=\"{ yneg, ypos }\"/>\n"
+  "    <FieldSpecification name=\"zconstraint\" objectPath=\"nodeManager\" fieldName=\"TotalDisplacement\"\n"
+  "                        component=\"2\" scale=\"0.0\" setNames=\"{ all }\"/>\n"
+  "    <FieldSpecification name=\"xConstraint\" objectPath=\"nodeManager\" fieldName=\"TotalDisplacement\"\n"
+  "                        component=\"0\" scale=\"0.0\" setNames=\"{ xneg, xpos }\"/>\n"
+  "    <SourceFlux name=\"sourceTerm\" objectPath=\"ElementRegions/Fracture\" scale=\"-1.0\" setNames=\"{ source }\"/>\n"
+  "  </FieldSpecifications>\n"
+  "</Problem>";
+
+class HydrofractureAssemblyTest : public ::testing::Test
+{
+public:
+
+  HydrofractureAssemblyTest()
+    : problemManager( std::make_unique< ProblemManager >( "Problem", nullptr ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( *problemManager, xmlInput );
+    solver = problemManager->GetPhysicsSolverManager().GetGroup< HydrofractureSolver >( "hydrofracture" );
+
+    DomainPartition & domain = *problemManager->getDomainPartition();
+
+    // split the initial fracture before the coupled system is set up, as the preFracture event does
+    SolverBase * const surfaceGenerator = problemManager->GetPhysicsSolverManager().GetGroup< SolverBase >( "SurfaceGen" );
+    surfaceGenerator->SolverStep( time, 0.0, 0, domain );
+
+    solver->ImplicitStepSetup( time, dt, domain );
+    solver->SetupSystem( domain,
+                         solver->getDofManager(),
+                         solver->getLocalMatrix(),
+                         solver->getLocalRhs(),
+                         solver->getLocalSolution() );
+  }
+
+  void TearDown() override
+  {
+    TaskGraph::setConcurrent( false );
+  }
+
+  void assemble( bool const concurrent )
+  {
+    TaskGraph::setConcurrent( concurrent );
+    solver->AssembleSystem( time,
+                            dt,
+                            *problemManager->getDomainPartition(),
+                            solver->getDofManager(),
+                            solver->getLocalMatrix().toViewConstSizes(),
+                            solver->getLocalRhs().toView() );
+    solver->getLocalRhs().move( LvArray::MemorySpace::CPU, false );
+  }
+
+  static real64 constexpr time = 0.0;
+  static real64 constexpr dt = 1.0;
+
+  std::unique_ptr< ProblemManager > problemManager;
+  HydrofractureSolver * solver;
+};
+
+real64 constexpr HydrofractureAssemblyTest::time;
+real64 constexpr HydrofractureAssemblyTest::dt;
+
+TEST_F( HydrofractureAssemblyTest, concurrentMatchesSerialAssembly )
+{
+  CRSMatrix< real64, globalIndex > & localMatrix = solver->getLocalMatrix();
+  array1d< real64 > & localRhs = solver->getLocalRhs();
+
+  // the blocks assembled one after another; the next assembly starts from this non-zero system
+  assemble( false );
+  CRSMatrix< real64, globalIndex > serialMatrix( localMatrix );
+  array1d< real64 > serialRhs( localRhs );
+
+  // the solid and flow blocks assembled in the same wave
+  assemble( true );
+
+  // the atomic additions of the kernels may only change the rounding of the entries
+  real64 matrixScale = 0.0;
+  serialMatrix.move( LvArray::MemorySpace::CPU, false );
+  for( localIndex i = 0; i < serialMatrix.numRows(); ++i )
+  {
+    arraySlice1d< real64 const > const entries = serialMatrix.getEntries( i );
+    for( localIndex k = 0; k < entries.size(); ++k )
+    {
+      matrixScale = std::max( matrixScale, std::abs( entries[k] ) );
+    }
+  }
+  real64 rhsScale = 0.0;
+  for( localIndex i = 0; i < serialRhs.size(); ++i )
+  {
+    rhsScale = std::max( rhsScale, std::abs( serialRhs[i] ) );
+  }
+  ASSERT_GT( matrixScale, 0.0 );
+
+  real64 const relTol = 1e-12;
+  compareLocalMatrices( localMatrix.toViewConst(), serialMatrix.toViewConst(), relTol, relTol * matrixScale );
+  ASSERT_EQ( localRhs.size(), serialRhs.size() );
+  for( localIndex i = 0; i < localRhs.size(); ++i )
+  {
+    checkRelativeError( localRhs[i], serialRhs[i], relTol, relTol * rhsScale, "row " + std::to_string( i ) );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
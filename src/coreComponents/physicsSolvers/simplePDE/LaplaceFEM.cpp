@@ -21,9 +21,14 @@
 #include "LaplaceFEMKernels.hpp"
 
 #include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/LoadBalanceStatistics.hpp"
 #include "common/TimingMacros.hpp"
 #include "common/DataTypes.hpp"
+#include "common/Stopwatch.hpp"
 #include "finiteElement/FiniteElementDiscretizationManager.hpp"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+#include "linearAlgebra/solvers/PreconditionerIdentity.hpp"
+#include "linearAlgebra/solvers/PreconditionerJacobi.hpp"
 #include "managers/DomainPartition.hpp"
 
 namespace geosx
@@ -84,7 +89,10 @@ LaplaceFEM::LaplaceFEM( const std::string & name,
                         Group * const parent ):
   SolverBase( name, parent ),
   m_fieldName( "primaryField" ),
-  m_timeIntegrationOption( TimeIntegrationOption::ImplicitTransient )
+  m_timeIntegrationOption( TimeIntegrationOption::ImplicitTransient ),
+  m_matrixFree( 0 ),
+  m_matrixFreeOperator(),
+  m_matrixFreeConstrainedRows()
 {
   registerWrapper( laplaceFEMViewKeys.timeIntegrationOption.Key(), &m_timeIntegrationOption )->
     setInputFlag( InputFlags::REQUIRED )->
@@ -93,9 +101,41 @@ LaplaceFEM::LaplaceFEM( const std::string & name,
   registerWrapper( laplaceFEMViewKeys.fieldVarName.Key(), &m_fieldName )->
     setInputFlag( InputFlags::REQUIRED )->
     setDescription( "Name of field variable" );
+
+  registerWrapper( laplaceFEMViewKeys.matrixFree.Key(), &m_matrixFree )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to apply the operator matrix-free in the Krylov iterations instead of assembling it. "
+                    "Only the diagonal is assembled, to precondition the solve. Requires an implicit time "
+                    "integration, a cg, gmres or bicgstab linear solver and a none or jacobi preconditioner." );
 }
 //END_SPHINX_INCLUDE_01
 
+/* CHECKING THE INPUT
+   Once the input is read, we check that the matrix-free option is used with the
+   time integrations and linear solvers that support it.
+ */
+void LaplaceFEM::PostProcessInput()
+{
+  SolverBase::PostProcessInput();
+
+  if( m_matrixFree )
+  {
+    LinearSolverParameters const & linParams = m_linearSolverParameters.get();
+    string const & key = laplaceFEMViewKeys.matrixFree.Key();
+
+    GEOSX_ERROR_IF( m_timeIntegrationOption == TimeIntegrationOption::ExplicitTransient,
+                    getName() << ": " << key << " requires the SteadyState or ImplicitTransient time integration" );
+    GEOSX_ERROR_IF( linParams.solverType != LinearSolverParameters::SolverType::cg &&
+                    linParams.solverType != LinearSolverParameters::SolverType::gmres &&
+                    linParams.solverType != LinearSolverParameters::SolverType::bicgstab,
+                    getName() << ": " << key << " requires a cg, gmres or bicgstab linear solver" );
+    GEOSX_ERROR_IF( linParams.preconditionerType != LinearSolverParameters::PreconditionerType::none &&
+                    linParams.preconditionerType != LinearSolverParameters::PreconditionerType::jacobi,
+                    getName() << ": " << key << " requires a none or jacobi preconditioner" );
+  }
+}
+
 
 // Destructor
 LaplaceFEM::~LaplaceFEM()
@@ -128,6 +168,20 @@ void LaplaceFEM::RegisterDataOnMesh( Group * const MeshBodies )
       setApplyDefaultValue( 0.0 )->
       setPlotLevel( PlotLevel::LEVEL_0 )->
       setDescription( "Primary field variable" );
+
+    // The matrix-free operator is applied to nodal work fields
+    if( m_matrixFree )
+    {
+      nodes->registerWrapper< real64_array >( matrixFreeInputName() )->
+        setPlotLevel( PlotLevel::NOPLOT )->
+        setRestartFlags( RestartFlags::NO_WRITE )->
+        setDescription( "Work array holding the vector the matrix-free operator is applied to." );
+
+      nodes->registerWrapper< real64_array >( matrixFreeOutputName() )->
+        setPlotLevel( PlotLevel::NOPLOT )->
+        setRestartFlags( RestartFlags::NO_WRITE )->
+        setDescription( "Work array holding the result of the matrix-free operator application." );
+    }
   }
 }
 //END_SPHINX_INCLUDE_02
@@ -211,6 +265,22 @@ void LaplaceFEM::SetupSystem( DomainPartition & domain,
   arrayView1d< globalIndex const > const &
   dofIndex = nodeManager->getReference< globalIndex_array >( dofManager.getKey( m_fieldName ) );
 
+  if( m_matrixFree )
+  {
+    // only the diagonal is assembled, the off-diagonal entries are applied on the fly
+    SparsityPattern< globalIndex > diagonalPattern( dofManager.numLocalDofs(),
+                                                    dofManager.numGlobalDofs(),
+                                                    1 );
+    globalIndex const rankOffset = dofManager.rankOffset();
+    for( localIndex row = 0; row < dofManager.numLocalDofs(); ++row )
+    {
+      diagonalPattern.insertNonZero( row, rankOffset + row );
+    }
+    diagonalPattern.compress();
+    localMatrix.assimilate< parallelDevicePolicy<> >( std::move( diagonalPattern ) );
+    return;
+  }
+
   SparsityPattern< globalIndex > sparsityPattern( dofManager.numLocalDofs(),
                                                   dofManager.numGlobalDofs(),
                                                   8*8*3 );
@@ -253,6 +323,8 @@ void LaplaceFEM::AssembleSystem( real64 const GEOSX_UNUSED_PARAM( time_n ),
                                  CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                  arrayView1d< real64 > const & localRhs )
 {
+  GEOSX_MARK_FUNCTION;
+
   MeshLevel * const mesh = domain.getMeshBodies()->GetGroup< MeshBody >( 0 )->getMeshLevel( 0 );
 
   NodeManager & nodeManager = *(mesh->getNodeManager());
@@ -261,6 +333,36 @@ void LaplaceFEM::AssembleSystem( real64 const GEOSX_UNUSED_PARAM( time_n ),
   dofIndex =  nodeManager.getReference< array1d< globalIndex > >( dofManager.getKey( m_fieldName ) );
 
 
+  if( m_matrixFree )
+  {
+    // only the diagonal and the residual are assembled
+    finiteElement::
+      regionBasedKernelApplication< parallelDevicePolicy< 32 >,
+                                    constitutive::NullModel,
+                                    CellElementSubRegion,
+                                    LaplaceFEMDiagonal >( *mesh,
+                                                          targetRegionNames(),
+                                                          this->getDiscretizationName(),
+                                                          arrayView1d< string const >(),
+                                                          dofIndex,
+                                                          dofManager.rankOffset(),
+                                                          localMatrix,
+                                                          localRhs,
+                                                          m_fieldName );
+
+    if( m_matrixFreeOperator == nullptr )
+    {
+      m_matrixFreeOperator = std::make_unique< LaplaceFEMMatrixFreeOperator >( domain,
+                                                                               dofManager,
+                                                                               m_fieldName,
+                                                                               targetRegionNames(),
+                                                                               this->getDiscretizationName(),
+                                                                               matrixFreeInputName(),
+                                                                               matrixFreeOutputName() );
+    }
+    return;
+  }
+
   finiteElement::
     regionBasedKernelApplication< parallelDevicePolicy< 32 >,
                                   constitutive::NullModel,
@@ -313,6 +415,37 @@ void LaplaceFEM::ApplyBoundaryConditions( real64 const time_n,
                                           arrayView1d< real64 > const & localRhs )
 {
   ApplyDirichletBC_implicit( time_n + dt, dofManager, domain, localMatrix, localRhs );
+
+  if( m_matrixFree )
+  {
+    // flag the rows reduced to their diagonal, so that the matrix-free operator does the same
+    m_matrixFreeConstrainedRows.resize( localMatrix.numRows() );
+    m_matrixFreeConstrainedRows.setValues< serialPolicy >( 0 );
+    arrayView1d< integer > const constrainedRows = m_matrixFreeConstrainedRows;
+    globalIndex const rankOffset = dofManager.rankOffset();
+    string const dofKey = dofManager.getKey( m_fieldName );
+
+    FieldSpecificationManager::get().Apply( time_n + dt,
+                                            &domain,
+                                            "nodeManager",
+                                            m_fieldName,
+                                            [&]( FieldSpecificationBase const * const,
+                                                 string const &,
+                                                 SortedArrayView< localIndex const > const & targetSet,
+                                                 Group * const targetGroup,
+                                                 string const & GEOSX_UNUSED_PARAM( fieldName ) )
+    {
+      arrayView1d< globalIndex const > const dofNumber = targetGroup->getReference< globalIndex_array >( dofKey );
+      for( localIndex const a : targetSet )
+      {
+        globalIndex const localRow = dofNumber[a] - rankOffset;
+        if( localRow >= 0 && localRow < constrainedRows.size() )
+        {
+          constrainedRows[localRow] = 1;
+        }
+      }
+    } );
+  }
 }
 
 /*
@@ -327,7 +460,56 @@ void LaplaceFEM::SolveSystem( DofManager const & dofManager,
 {
   rhs.scale( -1.0 ); // TODO decide if we want this here
   solution.zero();
-  SolverBase::SolveSystem( dofManager, matrix, rhs, solution );
+
+  if( !m_matrixFree )
+  {
+    SolverBase::SolveSystem( dofManager, matrix, rhs, solution );
+    return;
+  }
+
+  GEOSX_MARK_FUNCTION;
+  LoadBalanceStatistics::ScopedPhase const solvePhase( "linear solve " + getName() );
+
+  // the matrix only holds the diagonal of the operator, which is applied matrix-free
+  LinearSolverParameters const & params = m_linearSolverParameters.get();
+  Stopwatch linearWatch;
+
+  LaplaceFEMMatrixFreeOperator const & matrixFreeOperator = setupMatrixFreeOperator( matrix );
+
+  std::unique_ptr< PreconditionerBase< LAInterface > > precond;
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::jacobi )
+  {
+    precond = std::make_unique< PreconditionerJacobi< LAInterface > >();
+  }
+  else
+  {
+    precond = std::make_unique< PreconditionerIdentity< LAInterface > >();
+  }
+  precond->compute( matrix );
+  real64 const setupTime = linearWatch.elapsedTime();
+  linearWatch.zero();
+
+  std::unique_ptr< KrylovSolver< ParallelVector > > solver =
+    KrylovSolver< ParallelVector >::Create( params, matrixFreeOperator, *precond );
+  solver->solve( rhs, solution );
+  m_linearSolverResult = solver->result();
+  m_solverStatistics.addLinearSolve( m_linearSolverResult.numIterations, setupTime, linearWatch.elapsedTime() );
+
+  if( params.stopIfError )
+  {
+    GEOSX_ERROR_IF( m_linearSolverResult.breakdown(), "Linear solution breakdown -> simulation STOP" );
+  }
+  else
+  {
+    GEOSX_WARNING_IF( !m_linearSolverResult.success(), "Linear solution failed" );
+  }
+}
+
+LaplaceFEMMatrixFreeOperator const & LaplaceFEM::setupMatrixFreeOperator( ParallelMatrix const & diagonalMatrix )
+{
+  GEOSX_ERROR_IF( m_matrixFreeOperator == nullptr, "The matrix-free operator is built by the assembly of the system" );
+  m_matrixFreeOperator->setDiagonal( diagonalMatrix, m_matrixFreeConstrainedRows );
+  return *m_matrixFreeOperator;
 }
 
 /*
@@ -19,6 +19,7 @@
 #include "physicsSolvers/SolverBase.hpp"  // an abstraction class shared by all physics solvers
 #include "managers/FieldSpecification/FieldSpecificationManager.hpp" // a manager that can access and set values on the discretized domain
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"  // interface to linear solvers and linear algebra libraries
+#include "LaplaceFEMMatrixFreeOperator.hpp" // application of the operator without assembling it
 
 namespace geosx
 {
@@ -49,6 +50,9 @@ public:
   // This method ties properties with their supporting mesh
   virtual void RegisterDataOnMesh( Group * const MeshBodies ) override final;
 
+  // This method checks the input once it is read
+  virtual void PostProcessInput() override;
+
 //END_SPHINX_INCLUDE_02
 /**
  * @defgroup Solver Interface Functions
@@ -128,6 +132,10 @@ public:
                                   CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                   arrayView1d< real64 > const & localRhs );
 
+  // This method is specific to the matrix-free mode, once the system is assembled and the boundary conditions applied
+  // It sets the diagonal of the matrix-free operator from the assembled diagonal matrix and returns the operator
+  LaplaceFEMMatrixFreeOperator const & setupMatrixFreeOperator( ParallelMatrix const & diagonalMatrix );
+
   // Choice of transient treatment options (steady, backward, forward Euler scheme):
   //START_SPHINX_INCLUDE_01
   enum class TimeIntegrationOption : integer
@@ -147,6 +155,7 @@ public:
   {
     dataRepository::ViewKey timeIntegrationOption = { "timeIntegrationOption" };
     dataRepository::ViewKey fieldVarName = { "fieldName" };
+    dataRepository::ViewKey matrixFree = { "matrixFree" };
 
   } laplaceFEMViewKeys;
   //END_SPHINX_INCLUDE_04
@@ -157,6 +166,15 @@ private:
   string m_fieldName;  // User-defined name of the physical quantity we wish to solve for (such as "Temperature", etc.)
   TimeIntegrationOption m_timeIntegrationOption;  // Choice of transient treatment (SteadyState, ImplicitTransient or ExplicitTransient)
 
+  // The operator may be applied matrix-free in the Krylov iterations, with only its diagonal assembled:
+  integer m_matrixFree;  // Flag to apply the operator matrix-free instead of assembling it
+  std::unique_ptr< LaplaceFEMMatrixFreeOperator > m_matrixFreeOperator;  // The matrix-free operator, built on the first assembly
+  array1d< integer > m_matrixFreeConstrainedRows;  // For each local row, whether it is constrained by a Dirichlet boundary condition
+
+  // Names of the nodal work fields of the matrix-free operator
+  string matrixFreeInputName() const { return m_fieldName + "_matrixFreeInput"; }
+  string matrixFreeOutputName() const { return m_fieldName + "_matrixFreeOutput"; }
+
 };
 
 
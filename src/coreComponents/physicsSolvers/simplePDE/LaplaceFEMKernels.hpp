@@ -74,6 +74,7 @@ public:
   using Base::m_rhs;
   using Base::m_elemsToNodes;
   using Base::m_finiteElementSpace;
+  using Base::calcShapeGradientsInKernel;
 
   /// The number of nodes per element.
   static constexpr int numNodesPerElem = Base::numTestSupportPointsPerElem;
@@ -128,17 +129,12 @@ public:
     GEOSX_HOST_DEVICE
     StackVariables():
       Base::StackVariables(),
-            xLocal(),
             primaryField_local{ 0.0 }
     {}
 
-#if !defined(CALC_FEM_SHAPE_IN_KERNEL)
-    /// Dummy
-    int xLocal;
-#else
-    /// C-array stack storage for element local the nodal positions.
+    /// C-array stack storage for element local the nodal positions, only gathered when
+    /// the shape function gradients are computed in the kernel.
     real64 xLocal[ numNodesPerElem ][ 3 ];
-#endif
 
     /// C-array storage for the element local primary field variable.
     real64 primaryField_local[numNodesPerElem];
@@ -162,12 +158,13 @@ public:
     {
       localIndex const localNodeIndex = m_elemsToNodes( k, a );
 
-#if defined(CALC_FEM_SHAPE_IN_KERNEL)
-      for( int i=0; i<3; ++i )
+      if( calcShapeGradientsInKernel )
       {
-        stack.xLocal[ a ][ i ] = m_X[ localNodeIndex ][ i ];
+        for( int i=0; i<3; ++i )
+        {
+          stack.xLocal[ a ][ i ] = m_X[ localNodeIndex ][ i ];
+        }
       }
-#endif
 
       stack.primaryField_local[ a ] = m_primaryField[ localNodeIndex ];
       stack.localRowDofIndex[a] = m_dofNumber[localNodeIndex];
@@ -253,6 +250,290 @@ protected:
 };
 
 
+//*****************************************************************************
+/**
+ * @brief Implements the residual and diagonal assembly of Laplace's equation
+ *   for the matrix-free solves.
+ * @copydoc geosx::LaplaceFEMKernel
+ *
+ * ### LaplaceFEMDiagonal Description
+ * Same as LaplaceFEMKernel, except that only the diagonal of the element
+ * matrix is computed, and the residual is computed from the gradient of the
+ * primary field at the quadrature points. The global matrix is expected to
+ * hold a single nonzero per row, on the diagonal.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class LaplaceFEMDiagonal : public LaplaceFEMKernel< SUBREGION_TYPE,
+                                                    CONSTITUTIVE_TYPE,
+                                                    FE_TYPE >
+{
+public:
+  /// An alias for the base class.
+  using Base = LaplaceFEMKernel< SUBREGION_TYPE,
+                                 CONSTITUTIVE_TYPE,
+                                 FE_TYPE >;
+
+  using Base::numNodesPerElem;
+  using Base::m_dofRankOffset;
+  using Base::m_matrix;
+  using Base::m_rhs;
+  using Base::m_finiteElementSpace;
+
+  /**
+   * @copydoc geosx::LaplaceFEMKernel::LaplaceFEMKernel
+   */
+  using Base::Base;
+
+  //***************************************************************************
+  /**
+   * @class StackVariables
+   * @copydoc geosx::LaplaceFEMKernel::StackVariables
+   *
+   * Adds a stack array for the diagonal of the element matrix.
+   */
+  struct StackVariables : public Base::StackVariables
+  {
+public:
+
+    /// Constructor.
+    GEOSX_HOST_DEVICE
+    StackVariables():
+      Base::StackVariables(),
+            localDiagonal{ 0.0 }
+    {}
+
+    /// Stack storage for the diagonal of the element matrix.
+    real64 localDiagonal[ numNodesPerElem ];
+  };
+
+  /**
+   * @copydoc geosx::finiteElement::ImplicitKernelBase::quadraturePointKernel
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    real64 dNdX[ numNodesPerElem ][ 3 ];
+    real64 const detJ = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, dNdX );
+
+    real64 gradField[ 3 ] = { 0.0, 0.0, 0.0 };
+    for( localIndex b=0; b<numNodesPerElem; ++b )
+    {
+      LvArray::tensorOps::scaledAdd< 3 >( gradField, dNdX[b], stack.primaryField_local[b] );
+    }
+
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      stack.localDiagonal[ a ] += LvArray::tensorOps::AiBi< 3 >( dNdX[a], dNdX[a] ) * detJ;
+      stack.localResidual[ a ] += LvArray::tensorOps::AiBi< 3 >( dNdX[a], gradField ) * detJ;
+    }
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::ImplicitKernelBase::complete
+   *
+   * Map the element local diagonal and residual to the global matrix/vector.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    GEOSX_UNUSED_VAR( k );
+    real64 maxForce = 0;
+
+    for( int a = 0; a < numNodesPerElem; ++a )
+    {
+      globalIndex const globalDof = stack.localRowDofIndex[ a ];
+      localIndex const dof = LvArray::integerConversion< localIndex >( globalDof - m_dofRankOffset );
+      if( dof < 0 || dof >= m_matrix.numRows() ) continue;
+      m_matrix.template addToRow< parallelDeviceAtomic >( dof, &globalDof, &stack.localDiagonal[ a ], 1 );
+
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], stack.localResidual[ a ] );
+      maxForce = fmax( maxForce, fabs( stack.localResidual[ a ] ) );
+    }
+
+    return maxForce;
+  }
+};
+
+//*****************************************************************************
+/**
+ * @brief Implements the matrix-free application of the Laplace operator to a
+ *   nodal field.
+ * @copydoc geosx::finiteElement::KernelBase
+ *
+ * ### LaplaceFEMApply Description
+ * Computes the action of the same operator as the one assembled by
+ * LaplaceFEMKernel, without forming it: the gradient of the input field is
+ * computed at each quadrature point, and its divergence against the test
+ * functions is accumulated in the output field.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class LaplaceFEMApply :
+  public finiteElement::KernelBase< SUBREGION_TYPE,
+                                    CONSTITUTIVE_TYPE,
+                                    FE_TYPE,
+                                    1,
+                                    1 >
+{
+public:
+  /// An alias for the base class.
+  using Base = finiteElement::KernelBase< SUBREGION_TYPE,
+                                          CONSTITUTIVE_TYPE,
+                                          FE_TYPE,
+                                          1,
+                                          1 >;
+
+  /// The number of nodes per element.
+  static constexpr int numNodesPerElem = Base::numTestSupportPointsPerElem;
+  using Base::m_elemsToNodes;
+  using Base::m_finiteElementSpace;
+  using Base::calcShapeGradientsInKernel;
+
+  /**
+   * @brief Constructor
+   * @copydoc geosx::finiteElement::KernelBase::KernelBase
+   * @param nodeManager Reference to the NodeManager object.
+   * @param edgeManager Reference to the EdgeManager object.
+   * @param faceManager Reference to the FaceManager object.
+   * @param inputField The nodal field the operator is applied to.
+   * @param outputField The nodal field the result is added to.
+   */
+  LaplaceFEMApply( NodeManager const & nodeManager,
+                   EdgeManager const & edgeManager,
+                   FaceManager const & faceManager,
+                   SUBREGION_TYPE const & elementSubRegion,
+                   FE_TYPE const & finiteElementSpace,
+                   CONSTITUTIVE_TYPE * const inputConstitutiveType,
+                   arrayView1d< real64 const > const & inputField,
+                   arrayView1d< real64 > const & outputField ):
+    Base( elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType ),
+    m_X( nodeManager.referencePosition()),
+    m_input( inputField ),
+    m_output( outputField )
+  {
+    GEOSX_UNUSED_VAR( edgeManager );
+    GEOSX_UNUSED_VAR( faceManager );
+  }
+
+  //***************************************************************************
+  /**
+   * @class StackVariables
+   * @copydoc geosx::finiteElement::KernelBase::StackVariables
+   *
+   * Adds stack arrays for the element local input and output fields.
+   */
+  struct StackVariables : public Base::StackVariables
+  {
+public:
+
+    /// Constructor.
+    GEOSX_HOST_DEVICE
+    StackVariables():
+      Base::StackVariables(),
+            inputLocal(),
+            outputLocal{ 0.0 }
+    {}
+
+    /// C-array stack storage for element local the nodal positions, only gathered when
+    /// the shape function gradients are computed in the kernel.
+    real64 xLocal[ numNodesPerElem ][ 3 ];
+
+    /// Stack storage for the element local input field.
+    real64 inputLocal[ numNodesPerElem ];
+
+    /// Stack storage for the element local output field.
+    real64 outputLocal[ numNodesPerElem ];
+  };
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::setup
+   *
+   * The input field is gathered into element local stack storage.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void setup( localIndex const k,
+              StackVariables & stack ) const
+  {
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      localIndex const localNodeIndex = m_elemsToNodes( k, a );
+
+      if( calcShapeGradientsInKernel )
+      {
+        for( int i=0; i<3; ++i )
+        {
+          stack.xLocal[ a ][ i ] = m_X[ localNodeIndex ][ i ];
+        }
+      }
+
+      stack.inputLocal[ a ] = m_input[ localNodeIndex ];
+    }
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::quadraturePointKernel
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    real64 dNdX[ numNodesPerElem ][ 3 ];
+    real64 const detJ = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, dNdX );
+
+    real64 gradField[ 3 ] = { 0.0, 0.0, 0.0 };
+    for( localIndex b=0; b<numNodesPerElem; ++b )
+    {
+      LvArray::tensorOps::scaledAdd< 3 >( gradField, dNdX[b], stack.inputLocal[b] );
+    }
+
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      stack.outputLocal[ a ] += LvArray::tensorOps::AiBi< 3 >( dNdX[a], gradField ) * detJ;
+    }
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::complete
+   *
+   * The element contribution is scattered to the output field.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_output[ m_elemsToNodes( k, a ) ], stack.outputLocal[ a ] );
+    }
+    return 0;
+  }
+
+protected:
+  /// The array containing the nodal position array.
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const m_X;
+
+  /// The nodal field the operator is applied to.
+  arrayView1d< real64 const > const m_input;
+
+  /// The nodal field the result is added to.
+  arrayView1d< real64 > const m_output;
+};
+
+
 } // namespace geosx
 
 #include "finiteElement/kernelInterface/SparsityKernelBase.hpp"
@@ -0,0 +1,127 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file LaplaceFEMMatrixFreeOperator.cpp
+ */
+
+#include "LaplaceFEMMatrixFreeOperator.hpp"
+#include "LaplaceFEMKernels.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "linearAlgebra/DofManager.hpp"
+#include "managers/DomainPartition.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+LaplaceFEMMatrixFreeOperator::LaplaceFEMMatrixFreeOperator( DomainPartition & domain,
+                                                            DofManager const & dofManager,
+                                                            string const & fieldName,
+                                                            arrayView1d< string const > const & targetRegions,
+                                                            string const & discretizationName,
+                                                            string const & inputFieldName,
+                                                            string const & outputFieldName ):
+  LinearOperator< ParallelVector >(),
+  m_domain( domain ),
+  m_dofManager( dofManager ),
+  m_fieldName( fieldName ),
+  m_targetRegions( targetRegions ),
+  m_discretizationName( discretizationName ),
+  m_inputFieldName( inputFieldName ),
+  m_outputFieldName( outputFieldName ),
+  m_syncPlan(),
+  m_diagonal(),
+  m_constrainedRows()
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["node"].emplace_back( m_inputFieldName );
+
+  m_syncPlan = std::make_unique< SynchronizationPlan >( fieldNames,
+                                                        *domain.getMeshBody( 0 )->getMeshLevel( 0 ),
+                                                        domain.getNeighbors(),
+                                                        true );
+}
+
+void LaplaceFEMMatrixFreeOperator::setDiagonal( ParallelMatrix const & diagonalMatrix,
+                                                arrayView1d< integer const > const & constrainedRows )
+{
+  GEOSX_ERROR_IF_NE( diagonalMatrix.numLocalRows(), constrainedRows.size() );
+
+  ParallelVector diagonal;
+  diagonal.createWithLocalSize( diagonalMatrix.numLocalRows(), diagonalMatrix.getComm() );
+  diagonalMatrix.extractDiagonal( diagonal );
+
+  m_diagonal.resize( diagonal.localSize() );
+  diagonal.extract( m_diagonal );
+  m_constrainedRows = constrainedRows;
+}
+
+void LaplaceFEMMatrixFreeOperator::apply( ParallelVector const & src, ParallelVector & dst ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshLevel & mesh = *m_domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  NodeManager & nodeManager = *mesh.getNodeManager();
+
+  // scatter the owned values of the input, then fetch the ghosts
+  m_dofManager.copyVectorToField( src, m_fieldName, m_inputFieldName, 1.0 );
+  m_syncPlan->execute();
+
+  arrayView1d< real64 const > const input = nodeManager.getReference< array1d< real64 > >( m_inputFieldName );
+  arrayView1d< real64 > const output = nodeManager.getReference< array1d< real64 > >( m_outputFieldName );
+  output.setValues< parallelDevicePolicy<> >( 0.0 );
+
+  finiteElement::
+    regionBasedKernelApplication< parallelDevicePolicy< 32 >,
+                                  constitutive::NullModel,
+                                  CellElementSubRegion,
+                                  LaplaceFEMApply >( mesh,
+                                                     m_targetRegions,
+                                                     m_discretizationName,
+                                                     arrayView1d< string const >(),
+                                                     input,
+                                                     output );
+
+  m_dofManager.copyFieldToVector( dst, m_outputFieldName, m_fieldName, 1.0 );
+
+  // the constrained rows only keep their diagonal entry
+  arrayView1d< real64 const > const diagonal = m_diagonal;
+  arrayView1d< integer const > const constrainedRows = m_constrainedRows;
+  real64 const * const srcValues = src.extractLocalVector();
+  real64 * const dstValues = dst.extractLocalVector();
+
+  forAll< parallelHostPolicy >( dst.localSize(), [=]( localIndex const i )
+  {
+    if( constrainedRows[i] )
+    {
+      dstValues[i] = diagonal[i] * srcValues[i];
+    }
+  } );
+}
+
+globalIndex LaplaceFEMMatrixFreeOperator::numGlobalRows() const
+{
+  return m_dofManager.numGlobalDofs();
+}
+
+globalIndex LaplaceFEMMatrixFreeOperator::numGlobalCols() const
+{
+  return m_dofManager.numGlobalDofs();
+}
+
+} /* namespace geosx */
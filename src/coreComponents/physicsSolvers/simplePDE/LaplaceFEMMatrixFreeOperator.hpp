@@ -0,0 +1,115 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file LaplaceFEMMatrixFreeOperator.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_SIMPLEPDE_LAPLACEFEMMATRIXFREEOPERATOR_HPP_
+#define GEOSX_PHYSICSSOLVERS_SIMPLEPDE_LAPLACEFEMMATRIXFREEOPERATOR_HPP_
+
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/interfaces/LinearOperator.hpp"
+#include "mpiCommunications/SynchronizationPlan.hpp"
+
+namespace geosx
+{
+
+class DofManager;
+class DomainPartition;
+
+/**
+ * @class LaplaceFEMMatrixFreeOperator
+ *
+ * Applies the operator of LaplaceFEM without assembling it.
+ *
+ * Each application scatters the input vector to a nodal work field, synchronizes its ghost values, computes the
+ * element contributions on the fly with the LaplaceFEMApply kernel and gathers the owned values of the output work
+ * field. The rows constrained by a Dirichlet boundary condition only keep their diagonal entry, as in the assembled
+ * matrix.
+ */
+class LaplaceFEMMatrixFreeOperator : public LinearOperator< ParallelVector >
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param domain the domain the operator is computed on
+   * @param dofManager the DofManager of the primary field
+   * @param fieldName the name of the primary field
+   * @param targetRegions the regions the operator is computed on
+   * @param discretizationName the name of the finite element discretization
+   * @param inputFieldName the name of the nodal work field the input vector is scattered to
+   * @param outputFieldName the name of the nodal work field the output vector is gathered from
+   */
+  LaplaceFEMMatrixFreeOperator( DomainPartition & domain,
+                                DofManager const & dofManager,
+                                string const & fieldName,
+                                arrayView1d< string const > const & targetRegions,
+                                string const & discretizationName,
+                                string const & inputFieldName,
+                                string const & outputFieldName );
+
+  virtual ~LaplaceFEMMatrixFreeOperator() override = default;
+
+  /**
+   * @brief Set the diagonal of the operator and the rows constrained by a Dirichlet boundary condition.
+   * @param diagonalMatrix a matrix holding the diagonal of the operator, with the boundary conditions applied
+   * @param constrainedRows for each local row, whether it is constrained
+   */
+  void setDiagonal( ParallelMatrix const & diagonalMatrix,
+                    arrayView1d< integer const > const & constrainedRows );
+
+  virtual void apply( ParallelVector const & src, ParallelVector & dst ) const override;
+
+  virtual globalIndex numGlobalRows() const override;
+
+  virtual globalIndex numGlobalCols() const override;
+
+private:
+
+  /// The domain the operator is computed on
+  DomainPartition & m_domain;
+
+  /// The DofManager of the primary field
+  DofManager const & m_dofManager;
+
+  /// The name of the primary field
+  string const m_fieldName;
+
+  /// The regions the operator is computed on
+  arrayView1d< string const > const m_targetRegions;
+
+  /// The name of the finite element discretization
+  string const m_discretizationName;
+
+  /// The name of the nodal work field of the input
+  string const m_inputFieldName;
+
+  /// The name of the nodal work field of the output
+  string const m_outputFieldName;
+
+  /// Halo exchange of the input work field, reused by every application
+  std::unique_ptr< SynchronizationPlan > m_syncPlan;
+
+  /// The local values of the diagonal of the operator
+  array1d< real64 > m_diagonal;
+
+  /// For each local row, whether it is constrained by a Dirichlet boundary condition
+  arrayView1d< integer const > m_constrainedRows;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_PHYSICSSOLVERS_SIMPLEPDE_LAPLACEFEMMATRIXFREEOPERATOR_HPP_ */
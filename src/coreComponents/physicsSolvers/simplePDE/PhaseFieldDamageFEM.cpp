@@ -272,7 +272,8 @@ void PhaseFieldDamageFEM::ApplySystemSolution( DofManager const & dofManager,
 
   CommunicationTools::SynchronizeFields( fieldNames,
                                          mesh,
-                                         domain.getNeighbors() );
+                                         domain.getNeighbors(),
+                                         true );
 }
 
 void PhaseFieldDamageFEM::ApplyBoundaryConditions(
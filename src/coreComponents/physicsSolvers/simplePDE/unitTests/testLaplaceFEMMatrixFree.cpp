@@ -0,0 +1,216 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "codingUtilities/UnitTestUtilities.hpp"
+#include "managers/initialization.hpp"
+#include "managers/ProblemManager.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/unitTests/testCompFlowUtils.hpp"
+#include "physicsSolvers/simplePDE/LaplaceFEM.hpp"
+
+#include <cmath>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+/**
+ * @brief The deck of the test, with the operator assembled or applied matrix-free.
+ * @param matrixFree whether the operator is applied matrix-free
+ * @return the deck
+ */
+string laplaceInput( bool const matrixFree )
+{
+  return string() +
+         "<Problem>\n"
+         "  <Solvers>\n"
+         "    <LaplaceFEM name=\"laplace\"\n"
+         "                discretization=\"FE1\"\n"
+         "                timeIntegrationOption=\"SteadyState\"\n"
+         "                fieldName=\"Temperature\"\n"
+         "                matrixFree=\"" + ( matrixFree ? "1" : "0" ) + "\"\n"
+         "                targetRegions=\"{ Region1 }\"/>\n"
+         "  </Solvers>\n"
+         "  <Mesh>\n"
+         "    <InternalMesh name=\"mesh1\"\n"
+         "                  elementTypes=\"{ C3D8 }\"\n"
+         "                  xCoords=\"{ 0, 1 }\"\n"
+         "                  yCoords=\"{ 0, 1 }\"\n"
+         "                  zCoords=\"{ 0, 1 }\"\n"
+         "                  nx=\"{ 4 }\"\n"
+         "                  ny=\"{ 3 }\"\n"
+         "                  nz=\"{ 2 }\"\n"
+         "                  cellBlockNames=\"{ cb1 }\"/>\n"
+         "  </Mesh>\n"
+         "  <Events maxTime=\"1.0\">\n"
+         "    <PeriodicEvent name=\"solverApplications\"\n"
+         "                   forceDt=\"1.0\"\n"
+         "                   target=\"/Solvers/laplace\"/>\n"
+         "  </Events>\n"
+         "  <NumericalMethods>\n"
+         "    <FiniteElements>\n"
+         "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+         "    </FiniteElements>\n"
+         "  </NumericalMethods>\n"
+         "  <ElementRegions>\n"
+         "    <CellElementRegion name=\"Region1\" cellBlocks=\"{ cb1 }\" materialList=\"{ nullModel }\"/>\n"
+         "  </ElementRegions>\n"
+         "  <Constitutive>\n"
+         "    <NullModel name=\"nullModel\"/>\n"
+         "  </Constitutive>\n"
+         "  <FieldSpecifications>\n"
+         "    <FieldSpecification name=\"sourceTerm\" fieldName=\"Temperature\" objectPath=\"nodeManager\"\n"
+         "                        scale=\"1.0\" setNames=\"{ source }\"/>\n"
+         "    <FieldSpecification name=\"sinkTerm\" fieldName=\"Temperature\" objectPath=\"nodeManager\"\n"
+         "                        scale=\"0.0\" setNames=\"{ sink }\"/>\n"
+         "  </FieldSpecifications>\n"
+         "  <Geometry>\n"
+         "    <Box name=\"source\" xMin=\"-0.01, -0.01, -0.01\" xMax=\"+0.01, +1.01, +1.01\"/>\n"
+         "    <Box name=\"sink\" xMin=\"+0.99, -0.01, -0.01\" xMax=\"+1.01, +1.01, +1.01\"/>\n"
+         "  </Geometry>\n"
+         "</Problem>";
+}
+
+class LaplaceFEMMatrixFreeTest : public ::testing::Test
+{
+public:
+
+  LaplaceFEMMatrixFreeTest()
+    : assembledProblem( std::make_unique< ProblemManager >( "Problem", nullptr ) ),
+    matrixFreeProblem( std::make_unique< ProblemManager >( "Problem", nullptr ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( *assembledProblem, laplaceInput( false ).c_str() );
+    setupProblemFromXML( *matrixFreeProblem, laplaceInput( true ).c_str() );
+  }
+
+  /**
+   * @brief Assemble the system of the solver of a problem and apply the boundary conditions.
+   * @param problemManager the problem
+   * @param matrix the assembled matrix, only the diagonal in the matrix-free mode
+   * @return the solver
+   */
+  static LaplaceFEM & assemble( ProblemManager & problemManager, ParallelMatrix & matrix )
+  {
+    LaplaceFEM & solver = *problemManager.GetPhysicsSolverManager().GetGroup< LaplaceFEM >( "laplace" );
+    DomainPartition & domain = *problemManager.getDomainPartition();
+
+    solver.ImplicitStepSetup( time, dt, domain );
+
+    CRSMatrix< real64, globalIndex > & localMatrix = solver.getLocalMatrix();
+    array1d< real64 > & localRhs = solver.getLocalRhs();
+    localMatrix.setValues< parallelDevicePolicy<> >( 0.0 );
+    localRhs.setValues< parallelDevicePolicy<> >( 0.0 );
+
+    solver.AssembleSystem( time,
+                           dt,
+                           domain,
+                           solver.getDofManager(),
+                           localMatrix.toViewConstSizes(),
+                           localRhs.toView() );
+    solver.ApplyBoundaryConditions( time,
+                                    dt,
+                                    domain,
+                                    solver.getDofManager(),
+                                    localMatrix.toViewConstSizes(),
+                                    localRhs.toView() );
+
+    matrix.create( localMatrix.toViewConst(), MPI_COMM_GEOSX );
+    return solver;
+  }
+
+  static real64 constexpr time = 0.0;
+  static real64 constexpr dt = 1.0;
+
+  std::unique_ptr< ProblemManager > assembledProblem;
+  std::unique_ptr< ProblemManager > matrixFreeProblem;
+};
+
+real64 constexpr LaplaceFEMMatrixFreeTest::time;
+real64 constexpr LaplaceFEMMatrixFreeTest::dt;
+
+TEST_F( LaplaceFEMMatrixFreeTest, applyMatchesAssembledProduct )
+{
+  ParallelMatrix assembledMatrix;
+  LaplaceFEM & assembledSolver = assemble( *assembledProblem, assembledMatrix );
+
+  ParallelMatrix diagonalMatrix;
+  LaplaceFEM & matrixFreeSolver = assemble( *matrixFreeProblem, diagonalMatrix );
+  LaplaceFEMMatrixFreeOperator const & matrixFreeOperator = matrixFreeSolver.setupMatrixFreeOperator( diagonalMatrix );
+
+  // both decks number the degrees of freedom the same way
+  localIndex const numLocalRows = assembledMatrix.numLocalRows();
+  ASSERT_EQ( diagonalMatrix.numLocalRows(), numLocalRows );
+  ASSERT_EQ( matrixFreeOperator.numGlobalRows(), assembledMatrix.numGlobalRows() );
+
+  // the Dirichlet rows of the assembled matrix are reduced to their diagonal, the test has to cover some of them
+  CRSMatrixView< real64 const, globalIndex const > const localMatrix = assembledSolver.getLocalMatrix().toViewConst();
+  globalIndex const rankOffset = assembledSolver.getDofManager().rankOffset();
+  localIndex numConstrainedRows = 0;
+  for( localIndex i = 0; i < localMatrix.numRows(); ++i )
+  {
+    arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( i );
+    arraySlice1d< real64 const > const entries = localMatrix.getEntries( i );
+    bool constrained = true;
+    for( localIndex k = 0; k < columns.size(); ++k )
+    {
+      constrained = constrained && ( columns[k] == rankOffset + i || entries[k] == 0.0 );
+    }
+    numConstrainedRows += constrained ? 1 : 0;
+  }
+  ASSERT_GT( MpiWrapper::Sum( numConstrainedRows ), 0 );
+  ASSERT_LT( MpiWrapper::Sum( numConstrainedRows ), assembledMatrix.numGlobalRows() );
+
+  // an input without any symmetry, so that a wrong entry cannot go unnoticed
+  array1d< real64 > localInput( numLocalRows );
+  for( localIndex i = 0; i < numLocalRows; ++i )
+  {
+    localInput[i] = 1.0 + std::sin( 1.7 * ( rankOffset + i ) );
+  }
+  ParallelVector input;
+  input.create( localInput.toViewConst(), MPI_COMM_GEOSX );
+
+  ParallelVector assembledOutput;
+  assembledOutput.createWithLocalSize( numLocalRows, MPI_COMM_GEOSX );
+  assembledMatrix.apply( input, assembledOutput );
+
+  ParallelVector matrixFreeOutput;
+  matrixFreeOutput.createWithLocalSize( numLocalRows, MPI_COMM_GEOSX );
+  matrixFreeOperator.apply( input, matrixFreeOutput );
+
+  real64 const scale = assembledMatrix.normInf() * input.normInf();
+  ASSERT_GT( scale, 0.0 );
+
+  real64 const * const assembledValues = assembledOutput.extractLocalVector();
+  real64 const * const matrixFreeValues = matrixFreeOutput.extractLocalVector();
+  real64 const relTol = 1e-12;
+  for( localIndex i = 0; i < numLocalRows; ++i )
+  {
+    checkRelativeError( matrixFreeValues[i], assembledValues[i], relTol, relTol * scale,
+                        "row " + std::to_string( rankOffset + i ) );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
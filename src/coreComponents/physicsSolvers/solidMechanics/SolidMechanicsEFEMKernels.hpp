@@ -0,0 +1,645 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsEFEMKernels.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSEFEMKERNELS_HPP_
+#define GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSEFEMKERNELS_HPP_
+
+#include "finiteElement/kernelInterface/ImplicitKernelBase.hpp"
+#include "mesh/EmbeddedSurfaceSubRegion.hpp"
+
+namespace geosx
+{
+
+namespace SolidMechanicsEFEMKernels
+{
+
+/**
+ * @brief Get the Voigt index of the entry (i,j) of a symmetric tensor, as assembled by the
+ *   embedded fracture operators.
+ * @param i the row of the entry
+ * @param j the column of the entry
+ * @return the Voigt index
+ */
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+int voigtIndex( int const i, int const j )
+{
+  return i == j ? 1 : 6 - i - j;
+}
+
+/**
+ * @brief Assemble the equilibrium operator of an embedded surface element.
+ * @param eqMatrix the equilibrium operator, number of jump enrichments x number of strain components
+ * @param nVec the normal vector of the surface
+ * @param tVec1 the first tangent vector of the surface
+ * @param tVec2 the second tangent vector of the surface
+ * @param hInv the ratio of the area of the surface to the volume of the cell
+ */
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void assembleEquilibriumOperator( real64 ( & eqMatrix )[3][6],
+                                  real64 const ( &nVec )[3],
+                                  real64 const ( &tVec1 )[3],
+                                  real64 const ( &tVec2 )[3],
+                                  real64 const hInv )
+{
+  real64 nDn[3][3], t1DnSym[3][3], t2DnSym[3][3];
+
+  // n dyadic n
+  LvArray::tensorOps::Rij_eq_AiBj< 3, 3 >( nDn, nVec, nVec );
+
+  // sym(n dyadic t1) and sym (n dyadic t2)
+  LvArray::tensorOps::Rij_eq_AiBj< 3, 3 >( t1DnSym, nVec, tVec1 );
+  LvArray::tensorOps::Rij_add_AiBj< 3, 3 >( t1DnSym, tVec1, nVec );
+  LvArray::tensorOps::scale< 3, 3 >( t1DnSym, 0.5 );
+
+  LvArray::tensorOps::Rij_eq_AiBj< 3, 3 >( t2DnSym, nVec, tVec2 );
+  LvArray::tensorOps::Rij_add_AiBj< 3, 3 >( t2DnSym, tVec2, nVec );
+  LvArray::tensorOps::scale< 3, 3 >( t2DnSym, 0.5 );
+
+  LvArray::tensorOps::fill< 3, 6 >( eqMatrix, 0 );
+  for( int i=0; i < 3; ++i )
+  {
+    for( int j=0; j < 3; ++j )
+    {
+      eqMatrix[0][voigtIndex( i, j )] += nDn[i][j];
+      eqMatrix[1][voigtIndex( i, j )] += t1DnSym[i][j];
+      eqMatrix[2][voigtIndex( i, j )] += t2DnSym[i][j];
+    }
+  }
+  LvArray::tensorOps::scale< 3, 6 >( eqMatrix, -hInv );
+}
+
+/**
+ * @brief Assemble the compatibility operator of an embedded surface element at a quadrature point.
+ * @param compMatrix the compatibility operator, number of strain components x number of jump enrichments
+ * @param nVec the normal vector of the surface
+ * @param tVec1 the first tangent vector of the surface
+ * @param tVec2 the second tangent vector of the surface
+ * @param mVec the opposite of the gradient of the Heaviside function interpolated at the quadrature point
+ */
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void assembleCompatibilityOperator( real64 ( & compMatrix )[6][3],
+                                    real64 const ( &nVec )[3],
+                                    real64 const ( &tVec1 )[3],
+                                    real64 const ( &tVec2 )[3],
+                                    real64 const ( &mVec )[3] )
+{
+  real64 nDmSym[3][3], t1DmSym[3][3], t2DmSym[3][3];
+
+  // sym(n dyadic m)
+  LvArray::tensorOps::Rij_eq_AiBj< 3, 3 >( nDmSym, mVec, nVec );
+  LvArray::tensorOps::Rij_add_AiBj< 3, 3 >( nDmSym, nVec, mVec );
+  LvArray::tensorOps::scale< 3, 3 >( nDmSym, 0.5 );
+
+  // sym(t1 dyadic m) and sym(t2 dyadic m)
+  LvArray::tensorOps::Rij_eq_AiBj< 3, 3 >( t1DmSym, mVec, tVec1 );
+  LvArray::tensorOps::Rij_add_AiBj< 3, 3 >( t1DmSym, tVec1, mVec );
+  LvArray::tensorOps::scale< 3, 3 >( t1DmSym, 0.5 );
+
+  LvArray::tensorOps::Rij_eq_AiBj< 3, 3 >( t2DmSym, mVec, tVec2 );
+  LvArray::tensorOps::Rij_add_AiBj< 3, 3 >( t2DmSym, tVec2, mVec );
+  LvArray::tensorOps::scale< 3, 3 >( t2DmSym, 0.5 );
+
+  LvArray::tensorOps::fill< 6, 3 >( compMatrix, 0 );
+  for( int i=0; i < 3; ++i )
+  {
+    for( int j=0; j < 3; ++j )
+    {
+      compMatrix[voigtIndex( i, j )][0] += nDmSym[i][j];
+      compMatrix[voigtIndex( i, j )][1] += t1DmSym[i][j];
+      compMatrix[voigtIndex( i, j )][2] += t2DmSym[i][j];
+    }
+  }
+}
+
+/**
+ * @brief Assemble the strain operator (B) of a cell at a quadrature point.
+ * @tparam NUM_NODES_PER_ELEM the number of nodes of the cell
+ * @param strainMatrix the strain operator, number of strain components x number of displacement dofs
+ * @param dNdX the derivatives of the shape functions at the quadrature point
+ */
+template< int NUM_NODES_PER_ELEM >
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void assembleStrainOperator( real64 ( & strainMatrix )[6][3*NUM_NODES_PER_ELEM],
+                             real64 const ( &dNdX )[NUM_NODES_PER_ELEM][3] )
+{
+  LvArray::tensorOps::fill< 6, 3*NUM_NODES_PER_ELEM >( strainMatrix, 0 );
+  for( int a=0; a<NUM_NODES_PER_ELEM; ++a )
+  {
+    strainMatrix[0][a*3 + 0] = dNdX[a][0];
+    strainMatrix[1][a*3 + 1] = dNdX[a][1];
+    strainMatrix[2][a*3 + 2] = dNdX[a][2];
+
+    strainMatrix[3][a*3 + 1] = dNdX[a][2];
+    strainMatrix[3][a*3 + 2] = dNdX[a][1];
+
+    strainMatrix[4][a*3 + 0] = dNdX[a][2];
+    strainMatrix[4][a*3 + 2] = dNdX[a][0];
+
+    strainMatrix[5][a*3 + 0] = dNdX[a][1];
+    strainMatrix[5][a*3 + 1] = dNdX[a][0];
+  }
+}
+
+/**
+ * @brief Compute the traction on an embedded surface element and its derivative with respect to the jump.
+ * @param contactStiffness the penalty stiffness of the contact relation
+ * @param dispJump the displacement jump
+ * @param tractionVector the traction vector
+ * @param dTdw the derivative of the traction with respect to the jump
+ */
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void computeTraction( real64 const contactStiffness,
+                      real64 const ( &dispJump )[3],
+                      real64 ( & tractionVector )[3],
+                      real64 ( & dTdw )[3][3] )
+{
+  LvArray::tensorOps::fill< 3, 3 >( dTdw, 0 );
+
+  // check if fracture is open
+  if( dispJump[0] >= 0 )
+  {
+    tractionVector[0] = 1e5;
+  }
+  else
+  {
+    // Contact through penalty condition.
+    tractionVector[0] = contactStiffness * dispJump[0];
+  }
+  tractionVector[1] = 0.0;
+  tractionVector[2] = 0.0;
+}
+
+/**
+ * @brief Implements the kernel assembling the coupling of the displacement and of the
+ *   displacement jump of the embedded surface elements, for quasi-static equilibrium.
+ * @copydoc geosx::finiteElement::ImplicitKernelBase
+ *
+ * ### QuasiStatic Description
+ * The kernel is launched by geosx::finiteElement::regionBasedKernelApplication on the cell
+ * subregions, one launch per embedded surface subregion. Unlike the cell kernels, the
+ * kernel loops over the locally owned embedded surface elements cutting the cells of the
+ * subregion: the element index @p k given to setup(), quadraturePointKernel() and
+ * complete() is the index of an embedded surface element, the cell being stored in the
+ * stack variables.
+ *
+ * The mechanics of the cells is assembled by the solid mechanics solver, this kernel adds
+ * the blocks coupling the displacement and the jump dofs and the jump block.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class QuasiStatic :
+  public finiteElement::ImplicitKernelBase< SUBREGION_TYPE,
+                                            CONSTITUTIVE_TYPE,
+                                            FE_TYPE,
+                                            3,
+                                            3 >
+{
+public:
+  /// Alias for the base class;
+  using Base = finiteElement::ImplicitKernelBase< SUBREGION_TYPE,
+                                                  CONSTITUTIVE_TYPE,
+                                                  FE_TYPE,
+                                                  3,
+                                                  3 >;
+
+  /// Number of nodes per element...which is equal to the
+  /// numTestSupportPointPerElem and numTrialSupportPointPerElem by definition.
+  static constexpr int numNodesPerElem = Base::numTestSupportPointsPerElem;
+
+  /// Number of displacement dofs per element.
+  static constexpr int numUdofs = numNodesPerElem * 3;
+
+  /// Number of jump dofs per embedded surface element.
+  static constexpr int numWdofs = 3;
+
+  using Base::m_dofNumber;
+  using Base::m_dofRankOffset;
+  using Base::m_matrix;
+  using Base::m_rhs;
+  using Base::m_elemsToNodes;
+  using Base::m_constitutiveUpdate;
+  using Base::m_finiteElementSpace;
+
+  /// The loop is over the embedded surface elements, see kernelLaunch().
+  static constexpr bool fusibleLaunch = false;
+
+  /**
+   * @brief Constructor
+   * @copydoc geosx::finiteElement::ImplicitKernelBase::ImplicitKernelBase
+   * @param embeddedSurfSubRegion the embedded surface subregion
+   * @param jumpDofNumber the global dof numbers of the jump of the embedded surface elements
+   * @param dispJump the displacement jump of the embedded surface elements
+   * @param contactStiffness the penalty stiffness of the contact relation
+   */
+  QuasiStatic( NodeManager const & nodeManager,
+               EdgeManager const & edgeManager,
+               FaceManager const & faceManager,
+               SUBREGION_TYPE const & elementSubRegion,
+               FE_TYPE const & finiteElementSpace,
+               CONSTITUTIVE_TYPE * const inputConstitutiveType,
+               EmbeddedSurfaceSubRegion const & embeddedSurfSubRegion,
+               arrayView1d< globalIndex const > const & inputDofNumber,
+               arrayView1d< globalIndex const > const & jumpDofNumber,
+               arrayView1d< R1Tensor const > const & dispJump,
+               globalIndex const rankOffset,
+               CRSMatrixView< real64, globalIndex const > const & inputMatrix,
+               arrayView1d< real64 > const & inputRhs,
+               real64 const contactStiffness ):
+    Base( nodeManager,
+          edgeManager,
+          faceManager,
+          elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType,
+          inputDofNumber,
+          rankOffset,
+          inputMatrix,
+          inputRhs ),
+    m_X( nodeManager.referencePosition()),
+    m_disp( nodeManager.totalDisplacement()),
+    m_wDofNumber( jumpDofNumber ),
+    m_w( dispJump ),
+    m_nVec( embeddedSurfSubRegion.getNormalVector() ),
+    m_tVec1( embeddedSurfSubRegion.getTangentVector1() ),
+    m_tVec2( embeddedSurfSubRegion.getTangentVector2() ),
+    m_surfaceCenter( embeddedSurfSubRegion.getElementCenter() ),
+    m_surfaceArea( embeddedSurfSubRegion.getElementArea() ),
+    m_elementVolume( elementSubRegion.getElementVolume() ),
+    m_surfaceGhostRank( embeddedSurfSubRegion.ghostRank() ),
+    m_surfaceToRegion( embeddedSurfSubRegion.getToCellRelation().m_toElementRegion.toViewConst() ),
+    m_surfaceToSubRegion( embeddedSurfSubRegion.getToCellRelation().m_toElementSubRegion.toViewConst() ),
+    m_surfaceToCell( embeddedSurfSubRegion.getToCellRelation().m_toElementIndex.toViewConst() ),
+    m_regionIndex( elementSubRegion.getParent()->getParent()->getIndexInParent() ),
+    m_subRegionIndex( elementSubRegion.getIndexInParent() ),
+    m_contactStiffness( contactStiffness )
+  {
+    GEOSX_ERROR_IF_NE( embeddedSurfSubRegion.numOfJumpEnrichments(), numWdofs );
+  }
+
+  //*****************************************************************************
+  /**
+   * @class StackVariables
+   * @copydoc geosx::finiteElement::KernelBase::StackVariables
+   *
+   * The local matrices are the coupling and jump blocks, the square local Jacobian of
+   * ImplicitKernelBase is not needed.
+   */
+  struct StackVariables : public finiteElement::KernelBase< SUBREGION_TYPE,
+                                                            CONSTITUTIVE_TYPE,
+                                                            FE_TYPE,
+                                                            3,
+                                                            3 >::StackVariables
+  {
+public:
+
+    /// Constructor.
+    GEOSX_HOST_DEVICE
+    StackVariables():
+      cellIndex( -1 ),
+      dispEqnRowIndices{ 0 },
+      jumpEqnRowIndices{ 0 },
+      dispColIndices{ 0 },
+      jumpColIndices{ 0 },
+      uLocal{ 0.0 },
+      wLocal{ 0.0 },
+      Kwu_elem{ {0.0} },
+      Kuw_elem{ {0.0} },
+      Kww_elem{ {0.0} }
+    {}
+
+    /// The index of the cell cut by the embedded surface element.
+    localIndex cellIndex;
+
+    /// The local row indices of the displacement equations.
+    localIndex dispEqnRowIndices[numUdofs];
+
+    /// The local row indices of the jump equations.
+    localIndex jumpEqnRowIndices[numWdofs];
+
+    /// The global column indices of the displacement dofs.
+    globalIndex dispColIndices[numUdofs];
+
+    /// The global column indices of the jump dofs.
+    globalIndex jumpColIndices[numWdofs];
+
+    /// C-array stack storage for element local the nodal positions.
+    real64 xLocal[numNodesPerElem][3];
+
+    /// The displacement of the nodes of the cell.
+    real64 uLocal[numUdofs];
+
+    /// The displacement jump of the embedded surface element.
+    real64 wLocal[numWdofs];
+
+    /// The Heaviside function of the surface at the nodes of the cell.
+    real64 heaviside[numNodesPerElem];
+
+    /// The normal vector of the surface.
+    real64 nVec[3];
+
+    /// The first tangent vector of the surface.
+    real64 tVec1[3];
+
+    /// The second tangent vector of the surface.
+    real64 tVec2[3];
+
+    /// The stiffness of the cell.
+    real64 dMatrix[6][6];
+
+    /// The product of the equilibrium operator and of the stiffness.
+    real64 matED[numWdofs][6];
+
+    /// The block of the jump equations and of the displacement dofs.
+    real64 Kwu_elem[numWdofs][numUdofs];
+
+    /// The block of the displacement equations and of the jump dofs.
+    real64 Kuw_elem[numUdofs][numWdofs];
+
+    /// The block of the jump equations and of the jump dofs.
+    real64 Kww_elem[numWdofs][numWdofs];
+  };
+  //*****************************************************************************
+
+  /**
+   * @brief Gather the data of the embedded surface element and of its cell.
+   * @copydoc ::geosx::finiteElement::KernelBase::setup
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void setup( localIndex const k,
+              StackVariables & stack ) const
+  {
+    localIndex const cellIndex = m_surfaceToCell( k, 0 );
+    stack.cellIndex = cellIndex;
+
+    for( int i=0; i<3; ++i )
+    {
+      stack.nVec[i] = m_nVec[k][i];
+      stack.tVec1[i] = m_tVec1[k][i];
+      stack.tVec2[i] = m_tVec2[k][i];
+    }
+
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      localIndex const localNodeIndex = m_elemsToNodes( cellIndex, a );
+
+      real64 distance = 0.0;
+      for( int i=0; i<3; ++i )
+      {
+        stack.xLocal[a][i] = m_X[localNodeIndex][i];
+        stack.uLocal[a*3+i] = m_disp[localNodeIndex][i];
+        stack.dispEqnRowIndices[a*3+i] = LvArray::integerConversion< localIndex >( m_dofNumber[localNodeIndex] + i - m_dofRankOffset );
+        stack.dispColIndices[a*3+i] = m_dofNumber[localNodeIndex] + i;
+        distance += ( stack.xLocal[a][i] - m_surfaceCenter( k, i ) ) * stack.nVec[i];
+      }
+      stack.heaviside[a] = distance > 0 ? 1.0 : 0.0;
+    }
+
+    for( int i=0; i<numWdofs; ++i )
+    {
+      stack.jumpEqnRowIndices[i] = LvArray::integerConversion< localIndex >( m_wDofNumber[k] + i - m_dofRankOffset );
+      stack.jumpColIndices[i] = m_wDofNumber[k] + i;
+      stack.wLocal[i] = m_w[k][i];
+    }
+
+    m_constitutiveUpdate.GetStiffness( cellIndex, 0, stack.dMatrix );
+
+    real64 eqMatrix[numWdofs][6];
+    assembleEquilibriumOperator( eqMatrix,
+                                 stack.nVec,
+                                 stack.tVec1,
+                                 stack.tVec2,
+                                 m_surfaceArea[k] / m_elementVolume[cellIndex] );
+    LvArray::tensorOps::Rij_eq_AikBkj< numWdofs, 6, 6 >( stack.matED, eqMatrix, stack.dMatrix );
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::quadraturePointKernel
+   *
+   * Adds the contributions of the quadrature point of the cell to the coupling and jump blocks.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    GEOSX_UNUSED_VAR( k );
+
+    real64 dNdX[numNodesPerElem][3];
+    real64 const detJ = m_finiteElementSpace.template getGradN< FE_TYPE >( stack.cellIndex, q, stack.xLocal, dNdX );
+
+    // opposite of the gradient of the Heaviside function at the quadrature point
+    real64 mVec[3] = { 0.0, 0.0, 0.0 };
+    for( int a=0; a<numNodesPerElem; ++a )
+    {
+      for( int i=0; i<3; ++i )
+      {
+        mVec[i] -= dNdX[a][i] * stack.heaviside[a];
+      }
+    }
+
+    real64 compMatrix[6][numWdofs];
+    assembleCompatibilityOperator( compMatrix, stack.nVec, stack.tVec1, stack.tVec2, mVec );
+
+    real64 strainMatrix[6][numUdofs];
+    assembleStrainOperator< numNodesPerElem >( strainMatrix, dNdX );
+
+    // transp(B)D
+    real64 matBD[numUdofs][6];
+    LvArray::tensorOps::Rij_eq_AkiBkj< numUdofs, 6, 6 >( matBD, strainMatrix, stack.dMatrix );
+
+    // EDC, EDB and transp(B)DC
+    real64 Kww_gauss[numWdofs][numWdofs];
+    real64 Kwu_gauss[numWdofs][numUdofs];
+    real64 Kuw_gauss[numUdofs][numWdofs];
+    LvArray::tensorOps::Rij_eq_AikBkj< numWdofs, numWdofs, 6 >( Kww_gauss, stack.matED, compMatrix );
+    LvArray::tensorOps::Rij_eq_AikBkj< numWdofs, numUdofs, 6 >( Kwu_gauss, stack.matED, strainMatrix );
+    LvArray::tensorOps::Rij_eq_AikBkj< numUdofs, numWdofs, 6 >( Kuw_gauss, matBD, compMatrix );
+
+    LvArray::tensorOps::scaledAdd< numWdofs, numWdofs >( stack.Kww_elem, Kww_gauss, -detJ );
+    LvArray::tensorOps::scaledAdd< numWdofs, numUdofs >( stack.Kwu_elem, Kwu_gauss, -detJ );
+    LvArray::tensorOps::scaledAdd< numUdofs, numWdofs >( stack.Kuw_elem, Kuw_gauss, -detJ );
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::ImplicitKernelBase::complete
+   *
+   * Adds the traction to the jump equations, computes the residuals and assembles the
+   * coupling and jump blocks into the global system.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    GEOSX_UNUSED_VAR( k );
+    real64 maxForce = 0;
+
+    real64 tractionVec[numWdofs];
+    real64 dTdw[numWdofs][numWdofs];
+    computeTraction( m_contactStiffness, stack.wLocal, tractionVec, dTdw );
+
+    LvArray::tensorOps::scaledAdd< numWdofs, numWdofs >( stack.Kww_elem, dTdw, -1.0 );
+
+    // R1 = Kww w + Kwu u + t, R0 = Kuw w
+    real64 R1[numWdofs];
+    real64 R0[numUdofs];
+    LvArray::tensorOps::copy< numWdofs >( R1, tractionVec );
+    LvArray::tensorOps::Ri_add_AijBj< numWdofs, numWdofs >( R1, stack.Kww_elem, stack.wLocal );
+    LvArray::tensorOps::Ri_add_AijBj< numWdofs, numUdofs >( R1, stack.Kwu_elem, stack.uLocal );
+    LvArray::tensorOps::fill< numUdofs >( R0, 0 );
+    LvArray::tensorOps::Ri_add_AijBj< numUdofs, numWdofs >( R0, stack.Kuw_elem, stack.wLocal );
+
+    for( int i = 0; i < numUdofs; ++i )
+    {
+      localIndex const dof = stack.dispEqnRowIndices[i];
+      if( dof < 0 || dof >= m_matrix.numRows() ) continue;
+
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[dof], R0[i] );
+      m_matrix.template addToRowBinarySearchUnsorted< parallelDeviceAtomic >( dof,
+                                                                              stack.jumpColIndices,
+                                                                              stack.Kuw_elem[i],
+                                                                              numWdofs );
+      maxForce = fmax( maxForce, fabs( R0[i] ) );
+    }
+
+    for( int i = 0; i < numWdofs; ++i )
+    {
+      localIndex const dof = stack.jumpEqnRowIndices[i];
+      if( dof < 0 || dof >= m_matrix.numRows() ) continue;
+
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[dof], R1[i] );
+      m_matrix.template addToRowBinarySearchUnsorted< parallelDeviceAtomic >( dof,
+                                                                              stack.jumpColIndices,
+                                                                              stack.Kww_elem[i],
+                                                                              numWdofs );
+      m_matrix.template addToRowBinarySearchUnsorted< parallelDeviceAtomic >( dof,
+                                                                              stack.dispColIndices,
+                                                                              stack.Kwu_elem[i],
+                                                                              numUdofs );
+    }
+
+    return maxForce;
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::kernelLaunch
+   *
+   * ### QuasiStatic Description
+   * The elements processed are the locally owned embedded surface elements cutting the cells
+   * of the subregion, listed on the host before the launch.
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static real64
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent )
+  {
+    GEOSX_MARK_FUNCTION;
+    GEOSX_UNUSED_VAR( numElems );
+
+    arrayView1d< integer const > const & surfaceGhostRank = kernelComponent.m_surfaceGhostRank;
+    arrayView2d< localIndex const > const & surfaceToRegion = kernelComponent.m_surfaceToRegion;
+    arrayView2d< localIndex const > const & surfaceToSubRegion = kernelComponent.m_surfaceToSubRegion;
+
+    array1d< localIndex > surfaceList;
+    surfaceList.reserve( surfaceGhostRank.size() );
+    for( localIndex k = 0; k < surfaceGhostRank.size(); ++k )
+    {
+      if( surfaceGhostRank[k] < 0 &&
+          surfaceToRegion( k, 0 ) == kernelComponent.m_regionIndex &&
+          surfaceToSubRegion( k, 0 ) == kernelComponent.m_subRegionIndex )
+      {
+        surfaceList.emplace_back( k );
+      }
+    }
+
+    arrayView1d< localIndex const > const surfaces = surfaceList.toViewConst();
+    return finiteElement::launchElementLoop< POLICY >( surfaces.size(),
+                                                       kernelComponent,
+                                                       [surfaces] GEOSX_HOST_DEVICE ( localIndex const index )
+    {
+      return surfaces[ index ];
+    } );
+  }
+
+protected:
+  /// The array containing the nodal position array.
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const m_X;
+
+  /// The rank-global displacement array.
+  arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const m_disp;
+
+  /// The global dof numbers of the jump.
+  arrayView1d< globalIndex const > const m_wDofNumber;
+
+  /// The displacement jump of the embedded surface elements.
+  arrayView1d< R1Tensor const > const m_w;
+
+  /// The normal vectors of the embedded surface elements.
+  arrayView1d< R1Tensor const > const m_nVec;
+
+  /// The first tangent vectors of the embedded surface elements.
+  arrayView1d< R1Tensor const > const m_tVec1;
+
+  /// The second tangent vectors of the embedded surface elements.
+  arrayView1d< R1Tensor const > const m_tVec2;
+
+  /// The centers of the embedded surface elements.
+  arrayView2d< real64 const > const m_surfaceCenter;
+
+  /// The areas of the embedded surface elements.
+  arrayView1d< real64 const > const m_surfaceArea;
+
+  /// The volumes of the cells.
+  arrayView1d< real64 const > const m_elementVolume;
+
+  /// The ghost rank of the embedded surface elements.
+  arrayView1d< integer const > const m_surfaceGhostRank;
+
+  /// The region of the cell of each embedded surface element.
+  arrayView2d< localIndex const > const m_surfaceToRegion;
+
+  /// The subregion of the cell of each embedded surface element.
+  arrayView2d< localIndex const > const m_surfaceToSubRegion;
+
+  /// The cell of each embedded surface element.
+  arrayView2d< localIndex const > const m_surfaceToCell;
+
+  /// The index of the region of the subregion.
+  localIndex const m_regionIndex;
+
+  /// The index of the subregion in its region.
+  localIndex const m_subRegionIndex;
+
+  /// The penalty stiffness of the contact relation.
+  real64 const m_contactStiffness;
+};
+
+} // namespace SolidMechanicsEFEMKernels
+
+} // namespace geosx
+
+#endif // GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSEFEMKERNELS_HPP_
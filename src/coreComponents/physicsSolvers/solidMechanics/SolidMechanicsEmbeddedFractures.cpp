@@ -29,10 +29,10 @@
 #include "mesh/SurfaceElementRegion.hpp"
 #include "mesh/MeshForLoopInterface.hpp"
 #include "meshUtilities/ComputationalGeometry.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsEFEMKernels.hpp"
 #include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
 #include "rajaInterface/GEOS_RAJA_Interface.hpp"
 #include "linearAlgebra/utilities/LAIHelperFunctions.hpp"
-#include "linearAlgebra/interfaces/BlasLapackLA.hpp"
 
 
 namespace geosx
@@ -180,7 +180,7 @@ void SolidMechanicsEmbeddedFractures::SetupSystem( DomainPartition & domain,
 
   dofManager.setMesh( domain, 0, 0 );
   SetupDofs( domain, dofManager );
-  dofManager.reorderByRank();
+  dofManager.reorderByRank( m_linearSolverParameters.get().dofOrdering );
 
   // Set the sparsity pattern without the Kwu and Kuw blocks.
   SparsityPattern< globalIndex > patternDiag;
@@ -241,288 +241,44 @@ void SolidMechanicsEmbeddedFractures::AssembleSystem( real64 const time,
                                  localRhs );
 
 
-  MeshLevel const & mesh                   = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
-  NodeManager const & nodeManager          = *mesh.getNodeManager();
-  ElementRegionManager const & elemManager = *mesh.getElemManager();
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  NodeManager const & nodeManager = *mesh.getNodeManager();
+  ElementRegionManager & elemManager = *mesh.getElemManager();
 
   ConstitutiveManager const * const constitutiveManager = domain.getConstitutiveManager();
-
-  arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const & disp  = nodeManager.totalDisplacement();
-  arrayView2d< real64 const, nodes::TOTAL_DISPLACEMENT_USD > const & dDisp = nodeManager.incrementalDisplacement();
-  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodesCoord = nodeManager.referencePosition();
-
-  r1_array const uhattilde;
+  ContactRelationBase const * const
+  contactRelation = constitutiveManager->GetGroup< ContactRelationBase >( m_contactRelationName );
 
   string const dofKey     = dofManager.getKey( keys::TotalDisplacement );
   string const jumpDofKey = dofManager.getKey( viewKeyStruct::dispJumpString );
 
-  arrayView1d< globalIndex const > const & globalDofNumber = nodeManager.getReference< globalIndex_array >( dofKey );
-
-//  ElementRegionManager::ConstitutiveRelationAccessor< ConstitutiveBase const >
-//  constitutiveRelations = elemManager.ConstructFullConstitutiveAccessor< ConstitutiveBase const >( constitutiveManager );
+  arrayView1d< globalIndex const > const & dispDofNumber = nodeManager.getReference< globalIndex_array >( dofKey );
 
-  ElementRegionManager::MaterialViewAccessor< real64 > const
-  density = elemManager.ConstructFullMaterialViewAccessor< real64 >( "density0",
-                                                                     constitutiveManager );
-  globalIndex const rankOffset = dofManager.rankOffset();
-
-  constexpr int dim = 3;
-  static constexpr int maxNumUdof = dim * 8; // this is hard-coded for now.
-
-  // Initialise local matrices and vectors
-  array1d< globalIndex >       dispEqnRowIndices ( maxNumUdof );
-  array1d< globalIndex >       jumpEqnRowIndices    ( 3 );
-  array1d< globalIndex >       dispColIndices ( maxNumUdof );
-  array1d< globalIndex >       jumpColIndices ( 3 );
-
-  array2d< real64 >            Kwu_elem( 3, maxNumUdof );
-  array2d< real64 >            Kuw_elem( maxNumUdof, 3 );
-  array2d< real64 >            Kww_elem( 3, 3 );
-  array1d< real64 >            R1( 3 );
-  array1d< real64 >            R0( maxNumUdof );
-  array1d< real64 >            tractionVec( 3 );
-  array2d< real64 >            dTdw( 3, 3 );
-
-  // Equilibrium and compatibility operators for the element
-  // number of strain components x number of jump enrichments. The comp operator is different
-  // at each Gauss point.
-  array2d< real64 >       eqMatrix( 3, 6 );
-  array2d< real64 >       compMatrix( 6, 3 );
-  array2d< real64 >       strainMatrix( 6, maxNumUdof );
-
-  // local storage of contribution of each gauss point
-  array2d< real64 >            Kwu_gauss( 3, maxNumUdof );
-  array2d< real64 >            Kuw_gauss( maxNumUdof, 3 );
-  array2d< real64 >            Kww_gauss( 3, 3 );
-
-  // intermediate objects to do BDC, EDB, EDC
-  array2d< real64 >            matBD( maxNumUdof, 6 );
-  array2d< real64 >            matED( 3, 6 );
-
-  array1d< R1Tensor > u_local( 8 );
-  array1d< R1Tensor > du_local( 8 );
-
-  array1d< real64 >       u( maxNumUdof );
-  array1d< real64 >       w( 3 );
-
-  array2d< real64 > dMatrix( 6, 6 );
-
-  // begin region loop
-  elemManager.forElementRegions< SurfaceElementRegion >( [&]( SurfaceElementRegion const & embeddedRegion )->void
+  elemManager.forElementSubRegions< EmbeddedSurfaceSubRegion >( [&]( EmbeddedSurfaceSubRegion const & embeddedSurfaceSubRegion )
   {
-    // loop of embeddeSubregions
-    embeddedRegion.forElementSubRegions< EmbeddedSurfaceSubRegion >( [&]( EmbeddedSurfaceSubRegion const & embeddedSurfaceSubRegion )->void
-    {
-      localIndex const numEmbeddedElems = embeddedSurfaceSubRegion.size();
-
-      FixedToManyElementRelation const & embeddedSurfacesToCells = embeddedSurfaceSubRegion.getToCellRelation();
-
-      arrayView1d< globalIndex const > const &
-      embeddedElementDofNumber = embeddedSurfaceSubRegion.getReference< array1d< globalIndex > >( jumpDofKey );
-      arrayView1d< R1Tensor const > const & w_global  = embeddedSurfaceSubRegion.getReference< array1d< R1Tensor > >( viewKeyStruct::dispJumpString );
-      arrayView1d< R1Tensor const > const & dw_global = embeddedSurfaceSubRegion.getReference< array1d< R1Tensor > >( viewKeyStruct::deltaDispJumpString );
-
-      arrayView1d< real64 const > const & fractureSurfaceArea = embeddedSurfaceSubRegion.getElementArea();
-
-      arrayView1d< integer const > const & ghostRank = embeddedSurfaceSubRegion.ghostRank();
-
-      jumpEqnRowIndices.resize( embeddedSurfaceSubRegion.numOfJumpEnrichments() );
-      jumpColIndices.resize( embeddedSurfaceSubRegion.numOfJumpEnrichments() );
-
-      // loop over embedded surfaces
-      for( localIndex k=0; k<numEmbeddedElems; ++k )
-      {
-        if( ghostRank[k] < 0 )
-        {
-          // Get rock matrix element subregion
-          CellElementSubRegion const * const elementSubRegion =
-            Group::group_cast< CellElementSubRegion const * const >
-              ( elemManager.GetRegion( embeddedSurfacesToCells.m_toElementRegion[k][0] )->
-                GetSubRegion( embeddedSurfacesToCells.m_toElementSubRegion[k][0] ));
-
-          localIndex cellElementIndex = embeddedSurfacesToCells.m_toElementIndex[k][0];
-
-          CellBlock::NodeMapType const & elemsToNodes = elementSubRegion->nodeList();
-          // Get the number of nodes per element
-          localIndex const numNodesPerElement = elemsToNodes.size( 1 );
-
-          // Get finite element discretization info
-          finiteElement::FiniteElementBase const &
-          fe = elementSubRegion->getReference< finiteElement::FiniteElementBase >( m_solidSolver->getDiscretizationName() );
-
-          // Resize based on number of dof of the subregion
-          int nUdof = numNodesPerElement * 3;
-          dispEqnRowIndices.resize( nUdof );
-          dispColIndices.resize( nUdof );
-          Kwu_elem.resizeDimension< 1 >( nUdof );
-          Kuw_elem.resizeDimension< 0 >( nUdof );
-          R0.resize( nUdof );
-          u.resize( nUdof );
-
-          // Initialize
-          Kwu_elem.setValues< serialPolicy >( 0 );
-          Kuw_elem.setValues< serialPolicy >( 0 );
-          Kww_elem.setValues< serialPolicy >( 0 );
-          R0.setValues< serialPolicy >( 0 );
-          R1.setValues< serialPolicy >( 0 );
-          dTdw.setValues< serialPolicy >( 0 );
-          eqMatrix.setValues< serialPolicy >( 0 );
-          compMatrix.setValues< serialPolicy >( 0 );
-          strainMatrix.setValues< serialPolicy >( 0 );
-
-          u_local.resize( numNodesPerElement );
-          du_local.resize( numNodesPerElement );
-
-          // Get mechanical moduli tensor
-          LinearElasticIsotropic const * constitutiveRelation = elementSubRegion->getConstitutiveModel< LinearElasticIsotropic >( m_solidSolver->solidMaterialNames()[0] );
-          LinearElasticIsotropic::KernelWrapper const & solidConstitutive = constitutiveRelation->createKernelUpdates();
-          solidConstitutive.GetStiffness( cellElementIndex, dMatrix );
-
-          // Basis functions derivatives
-          arrayView4d< real64 const > const & dNdX = elementSubRegion->dNdX();
-
-          // transformation determinant
-          arrayView2d< real64 const > const & detJ = elementSubRegion->detJ();
-
-          // Fill in equilibrium operator
-          arrayView1d< real64 const > const & cellVolume = elementSubRegion->getElementVolume();
-          real64 hInv = fractureSurfaceArea[k] / cellVolume[cellElementIndex]; // AreaFrac / cellVolume
-          AssembleEquilibriumOperator( eqMatrix, embeddedSurfaceSubRegion, k, hInv );
-
-          // Dof index of nodal displacements and row indices
-          for( localIndex a=0; a<numNodesPerElement; ++a )
-          {
-            localIndex localNodeIndex = elemsToNodes[cellElementIndex][a];
-
-            for( int i=0; i < dim; ++i )
-            {
-              dispEqnRowIndices[static_cast< int >(a)*dim+i] = globalDofNumber[localNodeIndex] + i - rankOffset;
-              dispColIndices[static_cast< int >(a)*dim+i]    = globalDofNumber[localNodeIndex] + i;
-            }
-          }
-
-          for( localIndex i = 0; i < numNodesPerElement; ++i )
-          {
-            localIndex const nodeID = elemsToNodes( cellElementIndex, i );
-            u_local[ i ] = disp[ nodeID ];
-            du_local[ i ] = dDisp[ nodeID ];
-          }
-
-          // Dof number of jump enrichment
-          for( int i= 0; i < embeddedSurfaceSubRegion.numOfJumpEnrichments(); i++ )
-          {
-            jumpEqnRowIndices[i] = embeddedElementDofNumber[k] + i - rankOffset;
-            jumpColIndices[i]    = embeddedElementDofNumber[k] + i;
-            w( i ) = w_global[k][i] + 0*dw_global[k][i];
-          }
-
-          // copy values in the R1Tensor object to use in BlasLapack interface
-          for( localIndex j=0; j < numNodesPerElement; ++j )
-          {
-            for( int i=0; i<dim; ++i )
-            {
-              u( j*dim + i ) = u_local[j][i] + 0*du_local[j][i];
-            }
-          }
-
-          // 1. Assembly of element matrices
-
-          // Resize local storages.
-          Kwu_gauss.resizeDimension< 1 >( nUdof );
-          Kuw_gauss.resizeDimension< 0 >( nUdof );
-          matBD.resizeDimension< 0 >( nUdof );
-          strainMatrix.resizeDimension< 1 >( nUdof );
-
-          BlasLapackLA::matrixMatrixMultiply( eqMatrix, dMatrix, matED );
-
-          // Compute traction
-          ComputeTraction( constitutiveManager, w, tractionVec, dTdw );
-
-          for( integer q=0; q<fe.getNumQuadraturePoints(); ++q )
-          {
-            const realT detJq = detJ[cellElementIndex][q];
-            AssembleCompatibilityOperator( compMatrix,
-                                           embeddedSurfaceSubRegion,
-                                           k,
-                                           q,
-                                           elemsToNodes,
-                                           nodesCoord,
-                                           cellElementIndex,
-                                           numNodesPerElement,
-                                           dNdX );
-
-            AssembleStrainOperator( strainMatrix,
-                                    cellElementIndex,
-                                    q,
-                                    numNodesPerElement,
-                                    dNdX );
-            // transp(B)D
-            BlasLapackLA::matrixTMatrixMultiply( strainMatrix, dMatrix, matBD );
-            // EDC
-            BlasLapackLA::matrixMatrixMultiply( matED, compMatrix, Kww_gauss );
-            // EDB
-            BlasLapackLA::matrixMatrixMultiply( matED, strainMatrix, Kwu_gauss );
-            // transp(B)DB
-            BlasLapackLA::matrixMatrixMultiply( matBD, compMatrix, Kuw_gauss );
-
-            // multiply by determinant
-            BlasLapackLA::matrixScale( detJq, Kwu_gauss );
-            BlasLapackLA::matrixScale( detJq, Kuw_gauss );
-            BlasLapackLA::matrixScale( detJq, Kww_gauss );
-
-            // Add Gauss point contribution to element matrix
-            BlasLapackLA::matrixMatrixAdd( Kww_gauss, Kww_elem, -1 );
-            BlasLapackLA::matrixMatrixAdd( Kwu_gauss, Kwu_elem, -1 );
-            BlasLapackLA::matrixMatrixAdd( Kuw_gauss, Kuw_elem, -1 );
-          }
-
-          BlasLapackLA::matrixMatrixAdd( dTdw, Kww_elem, -1 );
-
-          BlasLapackLA::matrixVectorMultiply( Kww_elem, w, R1 );
-          BlasLapackLA::matrixVectorMultiply( Kwu_elem, u, R1, 1, 1 );
-
-          BlasLapackLA::matrixVectorMultiply( Kuw_elem, w, R0, 1, 1 );
-
-          BlasLapackLA::vectorVectorAdd( tractionVec, R1, 1 );
-
-          // 2. Assembly into global system
-          // fill in residual vector
-          for( localIndex i = 0; i < dispEqnRowIndices.size(); ++i )
-          {
-            if( dispEqnRowIndices[i] >= 0 && dispEqnRowIndices[i] < localMatrix.numRows() )
-            {
-              RAJA::atomicAdd< parallelDeviceAtomic >( &localRhs[dispEqnRowIndices[i]], R0[i] );
-
-              localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( dispEqnRowIndices[i],
-                                                                                jumpColIndices.data(),
-                                                                                Kuw_elem[i],
-                                                                                embeddedSurfaceSubRegion.numOfJumpEnrichments() );
-            }
-          }
-
-          for( localIndex i=0; i < jumpEqnRowIndices.size(); ++i )
-          {
-            if( jumpEqnRowIndices[i] >= 0 && jumpEqnRowIndices[i] < localMatrix.numRows() )
-            {
-              RAJA::atomicAdd< parallelDeviceAtomic >( &localRhs[jumpEqnRowIndices[i]], R1[i] );
-
-              // fill in matrix
-              localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( jumpEqnRowIndices[i],
-                                                                                jumpColIndices.data(),
-                                                                                Kww_elem [i],
-                                                                                embeddedSurfaceSubRegion.numOfJumpEnrichments() );
-
-              localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( jumpEqnRowIndices[i],
-                                                                                dispColIndices.data(),
-                                                                                Kwu_elem[i],
-                                                                                numNodesPerElement * dim );
-            }
-
-          }
-        }
-      } // loop over embedded surfaces
-    } ); // subregion loop
-  } ); // region loop
+    arrayView1d< globalIndex const > const &
+    jumpDofNumber = embeddedSurfaceSubRegion.getReference< array1d< globalIndex > >( jumpDofKey );
+    arrayView1d< R1Tensor const > const &
+    dispJump = embeddedSurfaceSubRegion.getReference< array1d< R1Tensor > >( viewKeyStruct::dispJumpString );
+
+    // The kernel is applied to the cells of the solid solver cut by the embedded surface elements.
+    finiteElement::
+      regionBasedKernelApplication< parallelDevicePolicy< 32 >,
+                                    constitutive::SolidBase,
+                                    CellElementSubRegion,
+                                    SolidMechanicsEFEMKernels::QuasiStatic >( mesh,
+                                                                              m_solidSolver->targetRegionNames(),
+                                                                              m_solidSolver->getDiscretizationName(),
+                                                                              m_solidSolver->solidMaterialNames(),
+                                                                              embeddedSurfaceSubRegion,
+                                                                              dispDofNumber,
+                                                                              jumpDofNumber,
+                                                                              dispJump,
+                                                                              dofManager.rankOffset(),
+                                                                              localMatrix,
+                                                                              localRhs,
+                                                                              contactRelation->stiffness() );
+  } );
 }
 
 void SolidMechanicsEmbeddedFractures::AddCouplingNumNonzeros( DomainPartition & domain,
@@ -675,161 +431,6 @@ void SolidMechanicsEmbeddedFractures::AddCouplingSparsityPattern( DomainPartitio
   } );
 }
 
-void SolidMechanicsEmbeddedFractures::AssembleEquilibriumOperator( array2d< real64 > & eqMatrix,
-                                                                   EmbeddedSurfaceSubRegion const & embeddedSurfaceSubRegion,
-                                                                   const localIndex k,
-                                                                   const real64 hInv )
-{
-  GEOSX_MARK_FUNCTION;
-  // Normal and tangent unit vectors
-  R1Tensor const nVec  = embeddedSurfaceSubRegion.getNormalVector( k );
-  R1Tensor const tVec1 = embeddedSurfaceSubRegion.getTangentVector1( k );
-  R1Tensor const tVec2 = embeddedSurfaceSubRegion.getTangentVector2( k );
-
-  BlasLapackLA::matrixScale( 0, eqMatrix );
-
-  real64 nDn[3][3], t1DnSym[3][3], t2DnSym[3][3];
-
-  // n dyadic n
-  LvArray::tensorOps::Rij_eq_AiBj< 3, 3 >( nDn, nVec, nVec );
-
-  // sym(n dyadic t1) and sym (n dyadic t2)
-  LvArray::tensorOps::Rij_eq_AiBj< 3, 3 >( t1DnSym, nVec, tVec1 );
-  LvArray::tensorOps::Rij_add_AiBj< 3, 3 >( t1DnSym, tVec1, nVec );
-  LvArray::tensorOps::scale< 3, 3 >( t1DnSym, 0.5 );
-
-  LvArray::tensorOps::Rij_eq_AiBj< 3, 3 >( t2DnSym, nVec, tVec2 );
-  LvArray::tensorOps::Rij_add_AiBj< 3, 3 >( t2DnSym, tVec2, nVec );
-  LvArray::tensorOps::scale< 3, 3 >( t2DnSym, 0.5 );
-
-  int VoigtIndex;
-
-  for( int i=0; i < 3; ++i )
-  {
-    for( int j=0; j < 3; ++j )
-    {
-      if( i == j )
-      {
-        VoigtIndex = 1;
-      }
-      else
-      {
-        VoigtIndex = 6 - i - j;
-      }
-      eqMatrix( 0, VoigtIndex ) += nDn     [i][j];
-      eqMatrix( 1, VoigtIndex ) += t1DnSym [i][j];
-      eqMatrix( 2, VoigtIndex ) += t2DnSym [i][j];
-    }
-  }
-  BlasLapackLA::matrixScale( -hInv, eqMatrix );
-}
-
-void
-SolidMechanicsEmbeddedFractures::
-  AssembleCompatibilityOperator( array2d< real64 > & compMatrix,
-                                 EmbeddedSurfaceSubRegion const & embeddedSurfaceSubRegion,
-                                 localIndex const k,
-                                 localIndex const q,
-                                 CellBlock::NodeMapType const & elemsToNodes,
-                                 arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodesCoord,
-                                 localIndex const cellElementIndex,
-                                 localIndex const numNodesPerElement,
-                                 arrayView4d< real64 const > const & dNdX )
-{
-  GEOSX_MARK_FUNCTION;
-
-  // Normal and tangent unit vectors
-  R1Tensor const nVec  = embeddedSurfaceSubRegion.getNormalVector( k );
-  R1Tensor const tVec1 = embeddedSurfaceSubRegion.getTangentVector1( k );
-  R1Tensor const tVec2 = embeddedSurfaceSubRegion.getTangentVector2( k );
-
-  // Fill in compatibility operator
-
-  // 1. construct mvector sum(dNdX(a) * H(a)) value for each Gauss point
-  R1Tensor mVec;
-  real64 heavisideFun;
-  mVec = 0.0;
-  for( integer a=0; a<numNodesPerElement; ++a )
-  {
-    // Heaviside
-    heavisideFun = embeddedSurfaceSubRegion.
-                     ComputeHeavisideFunction( nodesCoord[ elemsToNodes[cellElementIndex][a] ], k );
-    // sum contribution of each node
-    mVec[0] -= dNdX( cellElementIndex, q, a, 0 ) * heavisideFun;
-    mVec[1] -= dNdX( cellElementIndex, q, a, 1 ) * heavisideFun;
-    mVec[2] -= dNdX( cellElementIndex, q, a, 2 ) * heavisideFun;
-  }
-
-  BlasLapackLA::matrixScale( 0, compMatrix );
-
-  // 2. fill in the operator itself
-
-  real64 nDmSym[3][3], t1DmSym[3][3], t2DmSym[3][3];
-
-  // sym(n dyadic m)
-  LvArray::tensorOps::Rij_eq_AiBj< 3, 3 >( nDmSym, mVec, nVec );
-  LvArray::tensorOps::Rij_add_AiBj< 3, 3 >( nDmSym, nVec, mVec );
-  LvArray::tensorOps::scale< 3, 3 >( nDmSym, 0.5 );
-
-  // sym(n dyadic t1) and sym (n dyadic t2)
-  LvArray::tensorOps::Rij_eq_AiBj< 3, 3 >( t1DmSym, mVec, tVec1 );
-  LvArray::tensorOps::Rij_add_AiBj< 3, 3 >( t1DmSym, tVec1, mVec );
-  LvArray::tensorOps::scale< 3, 3 >( t1DmSym, 0.5 );
-
-  LvArray::tensorOps::Rij_eq_AiBj< 3, 3 >( t2DmSym, mVec, tVec2 );
-  LvArray::tensorOps::Rij_add_AiBj< 3, 3 >( t2DmSym, tVec2, mVec );
-  LvArray::tensorOps::scale< 3, 3 >( t2DmSym, 0.5 );
-
-  int VoigtIndex;
-
-  for( int i=0; i < 3; ++i )
-  {
-    for( int j=0; j < 3; ++j )
-    {
-      if( i == j )
-      {
-        VoigtIndex = 1;
-      }
-      else
-      {
-        VoigtIndex = 6 - i - j;
-      }
-      compMatrix( VoigtIndex, 0 ) += nDmSym [i][j];
-      compMatrix( VoigtIndex, 1 ) += t1DmSym[i][j];
-      compMatrix( VoigtIndex, 2 ) += t2DmSym[i][j];
-    }
-  }
-}
-
-void SolidMechanicsEmbeddedFractures::AssembleStrainOperator( array2d< real64 > & strainMatrix,
-                                                              localIndex const elIndex,
-                                                              localIndex const q,
-                                                              localIndex const numNodesPerElement,
-                                                              arrayView4d< real64 const > const & dNdX )
-{
-  GEOSX_MARK_FUNCTION;
-  strainMatrix.setValues< serialPolicy >( 0 ); // make 0
-
-  for( integer a=0; a<numNodesPerElement; ++a )
-  {
-
-    strainMatrix( 0, a*3 + 0 ) = dNdX( elIndex, q, a, 0 );
-    strainMatrix( 1, a*3 + 1 ) = dNdX( elIndex, q, a, 1 );
-    strainMatrix( 2, a*3 + 2 ) = dNdX( elIndex, q, a, 2 );
-
-    strainMatrix( 3, a*3 + 1 ) = dNdX( elIndex, q, a, 2 );
-    strainMatrix( 3, a*3 + 2 ) = dNdX( elIndex, q, a, 1 );
-
-    strainMatrix( 4, a*3 + 0 ) = dNdX( elIndex, q, a, 2 );
-    strainMatrix( 4, a*3 + 2 ) = dNdX( elIndex, q, a, 0 );
-
-    strainMatrix( 5, a*3 + 0 ) = dNdX( elIndex, q, a, 1 );
-    strainMatrix( 5, a*3 + 1 ) = dNdX( elIndex, q, a, 0 );
-  }
-
-
-}
-
 void SolidMechanicsEmbeddedFractures::ApplyBoundaryConditions( real64 const time,
                                                                real64 const dt,
                                                                DomainPartition & domain,
@@ -962,41 +563,5 @@ void SolidMechanicsEmbeddedFractures::ApplySystemSolution( DofManager const & do
 
 }
 
-void SolidMechanicsEmbeddedFractures::ComputeTraction( ConstitutiveManager const * const constitutiveManager,
-                                                       array1d< real64 >  const & dispJump,
-                                                       array1d< real64 > & tractionVector,
-                                                       array2d< real64 > & dTdw )
-{
-  // Compute traction vector on the fracture element
-  ContactRelationBase const * const
-  contactRelation = constitutiveManager->GetGroup< ContactRelationBase >( m_contactRelationName );
-
-  // check if fracture is open
-  bool open = dispJump[0] >= 0 ? true : false;
-
-  if( open )
-  {
-    tractionVector[0] = 1e5;
-    tractionVector[1] = 0.0;
-    tractionVector[2] = 0.0;
-    dTdw( 0, 0 ) = 0.0;
-    dTdw( 0, 1 ) = 0.0;
-    dTdw( 0, 2 ) = 0.0;
-    dTdw( 1, 0 ) = 0.0;
-    dTdw( 1, 1 ) = 0.0;
-    dTdw( 1, 2 ) = 0.0;
-    dTdw( 2, 0 ) = 0.0;
-    dTdw( 2, 1 ) = 0.0;
-    dTdw( 2, 2 ) = 0.0;
-  }
-  else
-  {
-    // Contact through penalty condition.
-    tractionVector[0] = contactRelation->stiffness() * dispJump[0];
-    tractionVector[1] = 0;
-    tractionVector[2] = 0;
-  }
-}
-
 REGISTER_CATALOG_ENTRY( SolverBase, SolidMechanicsEmbeddedFractures, std::string const &, Group * const )
 } /* namespace geosx */
@@ -64,6 +64,7 @@ public:
   using Base::m_elemGhostRank;
   using Base::m_constitutiveUpdate;
   using Base::m_finiteElementSpace;
+  using Base::calcShapeGradientsInKernel;
 
   using Base::m_dt;
   using Base::m_u;
@@ -134,9 +135,10 @@ public:
       localIndex const nodeIndex = m_elemsToNodes( k, a );
       for( int i=0; i<numDofPerTrialSupportPoint; ++i )
       {
-#if defined(CALC_FEM_SHAPE_IN_KERNEL)
-        stack.xLocal[ a ][ i ] = m_X[ nodeIndex ][ i ];
-#endif
+        if( calcShapeGradientsInKernel )
+        {
+          stack.xLocal[ a ][ i ] = m_X[ nodeIndex ][ i ];
+        }
         stack.uLocal[ a ][ i ] = m_u[ nodeIndex ][ i ];
         stack.varLocal[ a ][ i ] = m_vel[ nodeIndex ][ i ];
       }
@@ -155,35 +157,18 @@ public:
     real64 dNdX[ numNodesPerElem ][ 3 ];
     real64 const detJ = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, dNdX );
 
-    real64 dUhatdX[3][3] = { {0} };
-    real64 dUdX[3][3] = { {0} };
-    real64 F[3][3] = { {0} };
-    real64 Ldt[3][3] = { {0} };
-    real64 fInv[3][3] = { {0} };
+    real64 dUhatdX[3][3];
+    real64 dUdX[3][3];
+    real64 fInv[3][3];
 
-    FE_TYPE::gradient( dNdX, stack.varLocal, dUhatdX );
-    FE_TYPE::gradient( dNdX, stack.uLocal, dUdX );
+    // both gradients in a single pass over the nodes
+    CalculateGradients< numNodesPerElem >( dUhatdX, dUdX, stack.varLocal, stack.uLocal, dNdX );
 
     LvArray::tensorOps::scale< 3, 3 >( dUhatdX, m_dt );
 
-    // calculate du/dX
-    LvArray::tensorOps::scaledCopy< 3, 3 >( F, dUhatdX, 0.5 );
-    LvArray::tensorOps::add< 3, 3 >( F, dUdX );
-    LvArray::tensorOps::addIdentity< 3 >( F, 1.0 );
-    LvArray::tensorOps::invert< 3 >( fInv, F );
-
-    // chain rule: calculate dv/dx^(n+1/2) = dv/dX * dX/dx^(n+1/2)
-    LvArray::tensorOps::Rij_eq_AikBkj< 3, 3, 3 >( Ldt, dUhatdX, fInv );
-
-    // calculate gradient (end of step)
-    LvArray::tensorOps::copy< 3, 3 >( F, dUhatdX );
-    LvArray::tensorOps::add< 3, 3 >( F, dUdX );
-    LvArray::tensorOps::addIdentity< 3 >( F, 1.0 );
-    real64 const detF = LvArray::tensorOps::invert< 3 >( fInv, F );
-
     real64 Rot[ 3 ][ 3 ];
     real64 Dadt[ 6 ];
-    HughesWinget( Rot, Dadt, Ldt );
+    real64 const detF = HughesWingetIncrements( Rot, Dadt, fInv, dUhatdX, dUdX );
 
     m_constitutiveUpdate.HypoElastic( k, q, Dadt, Rot );
 
@@ -22,19 +22,30 @@
 #include "SolidMechanicsSmallStrainImplicitNewmarkKernel.hpp"
 #include "SolidMechanicsSmallStrainExplicitNewmarkKernel.hpp"
 #include "SolidMechanicsFiniteStrainExplicitNewmarkKernel.hpp"
+#include "SolidMechanicsSmallStrainMatrixFreeKernel.hpp"
+#include "SolidMechanicsSmallStrainCachedStiffnessKernel.hpp"
 
 #include "codingUtilities/Utilities.hpp"
 #include "common/TimingMacros.hpp"
 #include "constitutive/ConstitutiveManager.hpp"
+#include "constitutive/ConstitutivePassThru.hpp"
 #include "constitutive/contact/ContactRelationBase.hpp"
+#include "constitutive/solid/LinearElasticAnisotropic.hpp"
+#include "constitutive/solid/LinearElasticIsotropic.hpp"
+#include "constitutive/solid/LinearElasticTransverseIsotropic.hpp"
 #include "finiteElement/FiniteElementDiscretizationManager.hpp"
 #include "finiteElement/Kinematics.h"
+#include "linearAlgebra/solvers/GeometricMultigridPreconditioner.hpp"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+#include "linearAlgebra/solvers/PreconditionerIdentity.hpp"
+#include "linearAlgebra/solvers/PreconditionerJacobi.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/FieldSpecification/FieldSpecificationManager.hpp"
 #include "managers/NumericalMethodsManager.hpp"
 #include "mesh/FaceElementSubRegion.hpp"
 #include "meshUtilities/ComputationalGeometry.hpp"
 #include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/DeterministicReduction.hpp"
 #include "mpiCommunications/NeighborCommunicator.hpp"
 #include "rajaInterface/GEOS_RAJA_Interface.hpp"
 
@@ -62,8 +73,16 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const std::string & na
   m_sendOrReceiveNodes(),
   m_nonSendOrReceiveNodes(),
   m_targetNodes(),
-  m_iComm(),
-  m_effectiveStress( 0 )
+  m_explicitSyncPlan(),
+  m_explicitCommunicationOverlap( 1 ),
+  m_explicitColoredAssembly( 0 ),
+  m_explicitSubcycleLevels( 0 ),
+  m_effectiveStress( 0 ),
+  m_matrixFree( 0 ),
+  m_matrixFreeOperator(),
+  m_matrixFreeConstrainedRows(),
+  m_cacheElementStiffness( 0 ),
+  m_elementStiffnessIsCached( false )
 {
   m_sendOrReceiveNodes.setName( "SolidMechanicsLagrangianFEM::m_sendOrReceiveNodes" );
   m_nonSendOrReceiveNodes.setName( "SolidMechanicsLagrangianFEM::m_nonSendOrReceiveNodes" );
@@ -131,11 +150,49 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const std::string & na
     setInputFlag( InputFlags::FALSE )->
     setDescription( "The maximum force contribution in the problem domain." );
 
+  registerWrapper( viewKeyStruct::explicitCommunicationOverlapString, &m_explicitCommunicationOverlap )->
+    setApplyDefaultValue( 1 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to overlap the nodal synchronization of the explicit time integration with the computation "
+                    "of the elements that are not attached to any send or receive node. If 0, the synchronization "
+                    "is only started once all the elements have been computed." );
+
+  registerWrapper( viewKeyStruct::explicitColoredAssemblyString, &m_explicitColoredAssembly )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to assemble the nodal forces of the explicit time integration color by color, the elements "
+                    "of a color sharing no node, instead of with atomic additions. The results are then reproducible "
+                    "from run to run." );
+
+  registerWrapper( viewKeyStruct::explicitSubcycleLevelsString, &m_explicitSubcycleLevels )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum number of times the time step of the explicit time integration is halved for the elements "
+                    "with a smaller stable time step. Each node advances with the largest of these time steps that is "
+                    "stable for all its elements, and each element at the rate of its finest node. If 0, all the "
+                    "elements advance with the time step." );
+
   registerWrapper( viewKeyStruct::effectiveStress, &m_effectiveStress )->
     setApplyDefaultValue( 0 )->
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Apply fluid pressure to produce effective stress when integrating stress." );
 
+  registerWrapper( viewKeyStruct::matrixFreeString, &m_matrixFree )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to apply the stiffness matrix-free in the Krylov iterations instead of assembling it. "
+                    "Only the diagonal is assembled, to precondition the solve. Requires the QuasiStatic time "
+                    "integration, no contact, a cg, gmres, bicgstab, pipecg or cagmres linear solver and a none "
+                    "or jacobi preconditioner." );
+
+  registerWrapper( viewKeyStruct::cacheElementStiffnessString, &m_cacheElementStiffness )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to store the element stiffness matrices on the first assembly and reuse them in the next "
+                    "ones, instead of integrating them again. With matrixFree, the stiffness is then applied from the "
+                    "stored matrices. Requires the QuasiStatic time integration, the small strain theory, no effective "
+                    "stress and linear elastic solid models." );
+
 }
 
 void SolidMechanicsLagrangianFEM::PostProcessInput()
@@ -148,6 +205,43 @@ void SolidMechanicsLagrangianFEM::PostProcessInput()
   linParams.isSymmetric = true;
   linParams.dofsPerNode = 3;
   linParams.amg.separateComponents = true;
+
+  if( m_matrixFree )
+  {
+    GEOSX_ERROR_IF( m_timeIntegrationOption != TimeIntegrationOption::QuasiStatic,
+                    getName() << ": " << viewKeyStruct::matrixFreeString << " requires the QuasiStatic time integration" );
+    GEOSX_ERROR_IF( m_contactRelationName != viewKeyStruct::noContactRelationNameString,
+                    getName() << ": " << viewKeyStruct::matrixFreeString << " does not support contact" );
+    GEOSX_ERROR_IF( linParams.solverType != LinearSolverParameters::SolverType::cg &&
+                    linParams.solverType != LinearSolverParameters::SolverType::gmres &&
+                    linParams.solverType != LinearSolverParameters::SolverType::bicgstab &&
+                    linParams.solverType != LinearSolverParameters::SolverType::pipecg &&
+                    linParams.solverType != LinearSolverParameters::SolverType::cagmres,
+                    getName() << ": " << viewKeyStruct::matrixFreeString << " requires a cg, gmres, bicgstab, pipecg or cagmres linear solver" );
+    GEOSX_ERROR_IF( linParams.preconditionerType != LinearSolverParameters::PreconditionerType::none &&
+                    linParams.preconditionerType != LinearSolverParameters::PreconditionerType::jacobi,
+                    getName() << ": " << viewKeyStruct::matrixFreeString << " requires a none or jacobi preconditioner" );
+  }
+
+  // the prolongation follows the lattice of the nodes, which the split of the faces breaks
+  GEOSX_ERROR_IF( linParams.preconditionerType == LinearSolverParameters::PreconditionerType::gmg &&
+                  m_contactRelationName != viewKeyStruct::noContactRelationNameString,
+                  getName() << ": the gmg preconditioner does not support contact" );
+
+  if( m_cacheElementStiffness )
+  {
+    GEOSX_ERROR_IF( m_timeIntegrationOption != TimeIntegrationOption::QuasiStatic,
+                    getName() << ": " << viewKeyStruct::cacheElementStiffnessString << " requires the QuasiStatic time integration" );
+    GEOSX_ERROR_IF( m_strainTheory != 0,
+                    getName() << ": " << viewKeyStruct::cacheElementStiffnessString << " requires the small strain theory" );
+    GEOSX_ERROR_IF( m_effectiveStress != 0,
+                    getName() << ": " << viewKeyStruct::cacheElementStiffnessString << " does not support the effective stress" );
+  }
+
+  GEOSX_ERROR_IF( m_explicitSubcycleLevels < 0,
+                  getName() << ": " << viewKeyStruct::explicitSubcycleLevelsString << " must be non-negative" );
+  GEOSX_ERROR_IF( m_explicitSubcycleLevels > 0 && m_timeIntegrationOption != TimeIntegrationOption::ExplicitDynamic,
+                  getName() << ": " << viewKeyStruct::explicitSubcycleLevelsString << " requires the ExplicitDynamic time integration" );
 }
 
 SolidMechanicsLagrangianFEM::~SolidMechanicsLagrangianFEM()
@@ -214,17 +308,51 @@ void SolidMechanicsLagrangianFEM::RegisterDataOnMesh( Group * const MeshBodies )
       setRegisteringObjects( this->getName())->
       setDescription( "An array that holds the contact force." );
 
+    nodes->registerWrapper< array2d< real64 > >( viewKeyStruct::matrixFreeInputString )->
+      setPlotLevel( PlotLevel::NOPLOT )->
+      setRestartFlags( RestartFlags::NO_WRITE )->
+      setRegisteringObjects( this->getName())->
+      setDescription( "Work array holding the vector the matrix-free stiffness is applied to." )->
+      reference().resizeDimension< 1 >( 3 );
+
+    nodes->registerWrapper< array2d< real64 > >( viewKeyStruct::matrixFreeOutputString )->
+      setPlotLevel( PlotLevel::NOPLOT )->
+      setRestartFlags( RestartFlags::NO_WRITE )->
+      setRegisteringObjects( this->getName())->
+      setDescription( "Work array holding the result of the matrix-free stiffness application." )->
+      reference().resizeDimension< 1 >( 3 );
+
+    nodes->registerWrapper< array1d< integer > >( viewKeyStruct::explicitSubcycleLevelString )->
+      setPlotLevel( PlotLevel::LEVEL_2 )->
+      setRestartFlags( RestartFlags::NO_WRITE )->
+      setRegisteringObjects( this->getName())->
+      setDescription( "An array that holds the subcycling level of the nodes in the explicit time integration." );
+
+    nodes->registerWrapper< array1d< globalIndex > >( viewKeyStruct::gmgCoarseNodeString )->
+      setApplyDefaultValue( -1 )->
+      setPlotLevel( PlotLevel::NOPLOT )->
+      setRestartFlags( RestartFlags::NO_WRITE )->
+      setRegisteringObjects( this->getName())->
+      setDescription( "Global index of the node on the coarse level of the geometric multigrid, -1 if not a coarse node." );
+
     ElementRegionManager * const
     elementRegionManager = mesh.second->group_cast< MeshBody * >()->getMeshLevel( 0 )->getElemManager();
     elementRegionManager->forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
     {
-      subRegion.registerWrapper< array3d< real64, solid::STRESS_PERMUTATION > >( viewKeyStruct::stress_n )->
+      subRegion.registerWrapper< array3d< solid::STATE_TYPE, solid::STRESS_PERMUTATION > >( viewKeyStruct::stress_n )->
         setPlotLevel( PlotLevel::NOPLOT )->
         setRestartFlags( RestartFlags::NO_WRITE )->
         setRegisteringObjects( this->getName())->
         setDescription( "Array to hold the beginning of step stress for implicit problem rewinds" )->
         reference().resizeDimension< 2 >( 6 );
 
+      subRegion.registerWrapper< array3d< real64 > >( viewKeyStruct::elementStiffnessString )->
+        setPlotLevel( PlotLevel::NOPLOT )->
+        setRestartFlags( RestartFlags::NO_WRITE )->
+        setRegisteringObjects( this->getName())->
+        setDescription( "Array to hold the element stiffness matrices of the linear elastic models, "
+                        "only sized when they are cached" );
+
       subRegion.registerWrapper< SortedArray< localIndex > >( viewKeyStruct::elemsAttachedToSendOrReceiveNodes )->
         setPlotLevel( PlotLevel::NOPLOT )->
         setRestartFlags( RestartFlags::NO_WRITE );
@@ -232,6 +360,50 @@ void SolidMechanicsLagrangianFEM::RegisterDataOnMesh( Group * const MeshBodies )
       subRegion.registerWrapper< SortedArray< localIndex > >( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodes )->
         setPlotLevel( PlotLevel::NOPLOT )->
         setRestartFlags( RestartFlags::NO_WRITE );
+
+      for( string const elementListName : { viewKeyStruct::elemsAttachedToSendOrReceiveNodes,
+                                            viewKeyStruct::elemsNotAttachedToSendOrReceiveNodes } )
+      {
+        subRegion.registerWrapper< array1d< localIndex > >( SolidMechanicsLagrangianFEMKernels::coloredElementListName( elementListName ) )->
+          setPlotLevel( PlotLevel::NOPLOT )->
+          setRestartFlags( RestartFlags::NO_WRITE );
+
+        subRegion.registerWrapper< array1d< localIndex > >( SolidMechanicsLagrangianFEMKernels::elementListColorOffsetsName( elementListName ) )->
+          setPlotLevel( PlotLevel::NOPLOT )->
+          setRestartFlags( RestartFlags::NO_WRITE );
+      }
+
+      if( m_explicitSubcycleLevels > 0 )
+      {
+        subRegion.registerWrapper< array1d< real64 > >( viewKeyStruct::explicitStableTimeStepString )->
+          setPlotLevel( PlotLevel::LEVEL_2 )->
+          setRestartFlags( RestartFlags::NO_WRITE )->
+          setRegisteringObjects( this->getName())->
+          setDescription( "An array that holds the stable time step of the explicit time integration of the elements." );
+
+        subRegion.registerWrapper< array1d< integer > >( viewKeyStruct::explicitSubcycleLevelString )->
+          setPlotLevel( PlotLevel::LEVEL_2 )->
+          setRestartFlags( RestartFlags::NO_WRITE )->
+          setRegisteringObjects( this->getName())->
+          setDescription( "An array that holds the subcycling level of the elements in the explicit time integration." );
+
+        for( integer level = 0; level <= m_explicitSubcycleLevels; ++level )
+        {
+          string const elementListName = subcycleElementListName( level );
+
+          subRegion.registerWrapper< SortedArray< localIndex > >( elementListName )->
+            setPlotLevel( PlotLevel::NOPLOT )->
+            setRestartFlags( RestartFlags::NO_WRITE );
+
+          subRegion.registerWrapper< array1d< localIndex > >( SolidMechanicsLagrangianFEMKernels::coloredElementListName( elementListName ) )->
+            setPlotLevel( PlotLevel::NOPLOT )->
+            setRestartFlags( RestartFlags::NO_WRITE );
+
+          subRegion.registerWrapper< array1d< localIndex > >( SolidMechanicsLagrangianFEMKernels::elementListColorOffsetsName( elementListName ) )->
+            setPlotLevel( PlotLevel::NOPLOT )->
+            setRestartFlags( RestartFlags::NO_WRITE );
+        }
+      }
     } );
 
   }
@@ -404,12 +576,25 @@ void SolidMechanicsLagrangianFEM::InitializePostInitialConditions_PreSubGroups(
                                                                                                               targetRegionNames(),
                                                                                                               solidMaterialNames() );
 
-  forTargetRegionsComplete( mesh, [&]( localIndex const,
+  forTargetRegionsComplete( mesh, [&]( localIndex const targetIndex,
                                        localIndex const er,
                                        ElementRegionBase & elemRegion )
   {
     elemRegion.forElementSubRegionsIndex< CellElementSubRegion >( [&]( localIndex const esr, CellElementSubRegion & elementSubRegion )
     {
+      if( m_cacheElementStiffness )
+      {
+        // only the stiffness of the linear elastic models is independent of the state
+        string const solidModelType =
+          elementSubRegion.getConstitutiveModel( m_solidMaterialNames[targetIndex] )->getCatalogName();
+        GEOSX_ERROR_IF( solidModelType != constitutive::LinearElasticIsotropic::CatalogName() &&
+                        solidModelType != constitutive::LinearElasticAnisotropic::CatalogName() &&
+                        solidModelType != constitutive::LinearElasticTransverseIsotropic::CatalogName(),
+                        getName() << ": " << viewKeyStruct::cacheElementStiffnessString <<
+                        " requires linear elastic solid models, " << m_solidMaterialNames[targetIndex] <<
+                        " is a " << solidModelType );
+      }
+
       SortedArray< localIndex > & elemsAttachedToSendOrReceiveNodes = getElemsAttachedToSendOrReceiveNodes( elementSubRegion );
       SortedArray< localIndex > & elemsNotAttachedToSendOrReceiveNodes = getElemsNotAttachedToSendOrReceiveNodes( elementSubRegion );
 
@@ -437,6 +622,12 @@ void SolidMechanicsLagrangianFEM::InitializePostInitialConditions_PreSubGroups(
         constexpr localIndex numNodesPerElem = FE_TYPE::numNodes;
         constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
 
+        if( m_cacheElementStiffness )
+        {
+          elementSubRegion.getReference< array3d< real64 > >( viewKeyStruct::elementStiffnessString ).
+            resizeDimension< 1, 2 >( 3 * numNodesPerElem, 3 * numNodesPerElem );
+        }
+
         real64 N[numNodesPerElem];
         for( localIndex k=0; k < elemsToNodes.size( 0 ); ++k )
         {
@@ -481,6 +672,20 @@ void SolidMechanicsLagrangianFEM::InitializePostInitialConditions_PreSubGroups(
       elemsNotAttachedToSendOrReceiveNodes.insert( tmpElemsNotAttachedToSendOrReceiveNodes.begin(),
                                                    tmpElemsNotAttachedToSendOrReceiveNodes.end() );
 
+      if( m_explicitColoredAssembly )
+      {
+        elementSubRegion.computeElementColoring();
+        for( string const elementListName : { viewKeyStruct::elemsAttachedToSendOrReceiveNodes,
+                                              viewKeyStruct::elemsNotAttachedToSendOrReceiveNodes } )
+        {
+          string const coloredListName = SolidMechanicsLagrangianFEMKernels::coloredElementListName( elementListName );
+          string const colorOffsetsName = SolidMechanicsLagrangianFEMKernels::elementListColorOffsetsName( elementListName );
+          elementSubRegion.sortElementsByColor( elementSubRegion.getReference< SortedArray< localIndex > >( elementListName ).toViewConst(),
+                                                elementSubRegion.getReference< array1d< localIndex > >( coloredListName ),
+                                                elementSubRegion.getReference< array1d< localIndex > >( colorOffsetsName ) );
+        }
+      }
+
     } );
   } );
 
@@ -491,6 +696,183 @@ void SolidMechanicsLagrangianFEM::InitializePostInitialConditions_PreSubGroups(
   m_targetNodes = m_sendOrReceiveNodes;
   m_targetNodes.insert( m_nonSendOrReceiveNodes.begin(),
                         m_nonSendOrReceiveNodes.end() );
+
+  if( m_explicitSubcycleLevels > 0 )
+  {
+    computeExplicitStableTimeSteps( mesh );
+  }
+}
+
+
+void SolidMechanicsLagrangianFEM::computeExplicitStableTimeSteps( MeshLevel & mesh )
+{
+  GEOSX_MARK_FUNCTION;
+
+  NodeManager const & nodes = *mesh.getNodeManager();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodes.referencePosition();
+
+  real64 const cflFactor = m_cflFactor;
+
+  forTargetSubRegions< CellElementSubRegion >( mesh, [&]( localIndex const targetIndex,
+                                                          CellElementSubRegion & subRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes = subRegion.nodeList();
+    arrayView1d< real64 > const & stableDt =
+      subRegion.getReference< array1d< real64 > >( viewKeyStruct::explicitStableTimeStepString );
+    localIndex const numNodesPerElem = elemsToNodes.size( 1 );
+
+    constitutive::ConstitutiveBase * const
+    solidModel = subRegion.getConstitutiveModel( m_solidMaterialNames[targetIndex] );
+
+    constitutive::ConstitutivePassThru< constitutive::SolidBase >::Execute( solidModel, [&]( auto * const castedSolid )
+    {
+      using CONSTITUTIVE_TYPE = TYPEOFPTR( castedSolid );
+      typename CONSTITUTIVE_TYPE::KernelWrapper const solidUpdate = castedSolid->createKernelUpdates();
+      arrayView2d< real64 const > const & density = castedSolid->getDensity();
+      localIndex const numQuadraturePoints = density.size( 1 );
+
+      forAll< parallelHostPolicy >( subRegion.size(), [=]( localIndex const k )
+      {
+        // the smallest distance between two nodes bounds the size of the element in any direction
+        real64 minDistance2 = std::numeric_limits< real64 >::max();
+        for( localIndex a = 0; a < numNodesPerElem; ++a )
+        {
+          for( localIndex b = a + 1; b < numNodesPerElem; ++b )
+          {
+            real64 dX[ 3 ] = LVARRAY_TENSOROPS_INIT_LOCAL_3( X[ elemsToNodes( k, b ) ] );
+            LvArray::tensorOps::subtract< 3 >( dX, X[ elemsToNodes( k, a ) ] );
+            minDistance2 = fmin( minDistance2, LvArray::tensorOps::l2NormSquared< 3 >( dX ) );
+          }
+        }
+
+        // the largest normal stiffness bounds the speed of the compressional waves
+        real64 maxWaveSpeed2 = 0;
+        for( localIndex q = 0; q < numQuadraturePoints; ++q )
+        {
+          real64 c[ 6 ][ 6 ];
+          solidUpdate.GetStiffness( k, q, c );
+          maxWaveSpeed2 = fmax( maxWaveSpeed2, fmax( c[0][0], fmax( c[1][1], c[2][2] ) ) / density( k, q ) );
+        }
+
+        stableDt[ k ] = cflFactor * sqrt( minDistance2 / maxWaveSpeed2 );
+      } );
+    } );
+  } );
+}
+
+
+void SolidMechanicsLagrangianFEM::binExplicitSubcycleLevels( DomainPartition & domain, real64 const dt )
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  NodeManager & nodes = *mesh.getNodeManager();
+
+  arrayView1d< integer > const & nodeLevel = nodes.getReference< array1d< integer > >( viewKeyStruct::explicitSubcycleLevelString );
+  nodeLevel.setValues< serialPolicy >( 0 );
+
+  integer const maxLevel = m_explicitSubcycleLevels;
+
+  // a node takes the finest level required by its elements
+  localIndex numUnstableElements = 0;
+  forTargetSubRegions< CellElementSubRegion >( mesh, [&]( localIndex const,
+                                                          CellElementSubRegion & subRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes = subRegion.nodeList();
+    arrayView1d< real64 const > const & stableDt =
+      subRegion.getReference< array1d< real64 > >( viewKeyStruct::explicitStableTimeStepString );
+    arrayView1d< integer const > const & elemGhostRank = subRegion.ghostRank();
+
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      integer level = 0;
+      while( level < maxLevel && dt / ( 1 << level ) > stableDt[ k ] )
+      {
+        ++level;
+      }
+      if( dt / ( 1 << level ) > stableDt[ k ] && elemGhostRank[ k ] < 0 )
+      {
+        ++numUnstableElements;
+      }
+
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        nodeLevel[ elemsToNodes( k, a ) ] = std::max( nodeLevel[ elemsToNodes( k, a ) ], level );
+      }
+    }
+  } );
+
+  // the owners see all the elements of their nodes
+  std::map< string, string_array > fieldNames;
+  fieldNames["node"].emplace_back( viewKeyStruct::explicitSubcycleLevelString );
+  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain.getNeighbors() );
+
+  // an element takes the finest level of its nodes, so that all its nodes have a constant velocity over its time step
+  forTargetSubRegions< CellElementSubRegion >( mesh, [&]( localIndex const,
+                                                          CellElementSubRegion & subRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes = subRegion.nodeList();
+    arrayView1d< integer > const & elemLevel =
+      subRegion.getReference< array1d< integer > >( viewKeyStruct::explicitSubcycleLevelString );
+
+    std::vector< std::vector< localIndex > > levelElements( maxLevel + 1 );
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      elemLevel[ k ] = 0;
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        elemLevel[ k ] = std::max( elemLevel[ k ], nodeLevel[ elemsToNodes( k, a ) ] );
+      }
+      levelElements[ elemLevel[ k ] ].emplace_back( k );
+    }
+
+    for( integer level = 0; level <= maxLevel; ++level )
+    {
+      string const elementListName = subcycleElementListName( level );
+      SortedArray< localIndex > & elementList = subRegion.getReference< SortedArray< localIndex > >( elementListName );
+      elementList.clear();
+      elementList.insert( levelElements[ level ].begin(), levelElements[ level ].end() );
+
+      if( m_explicitColoredAssembly )
+      {
+        subRegion.sortElementsByColor( elementList.toViewConst(),
+                                       subRegion.getReference< array1d< localIndex > >( SolidMechanicsLagrangianFEMKernels::coloredElementListName( elementListName ) ),
+                                       subRegion.getReference< array1d< localIndex > >( SolidMechanicsLagrangianFEMKernels::elementListColorOffsetsName( elementListName ) ) );
+      }
+    }
+  } );
+
+  std::vector< std::vector< localIndex > > levelNodes( maxLevel + 1 );
+  integer localNumLevels = 1;
+  for( localIndex a = 0; a < nodes.size(); ++a )
+  {
+    levelNodes[ nodeLevel[ a ] ].emplace_back( a );
+    localNumLevels = std::max( localNumLevels, nodeLevel[ a ] + 1 );
+  }
+
+  m_subcycleLevelNodes.resize( maxLevel + 1 );
+  for( integer level = 0; level <= maxLevel; ++level )
+  {
+    m_subcycleLevelNodes[ level ].clear();
+    m_subcycleLevelNodes[ level ].insert( levelNodes[ level ].begin(), levelNodes[ level ].end() );
+  }
+
+  m_numSubcycleLevels = MpiWrapper::Max( localNumLevels );
+  m_subcycleBinnedDt = dt;
+  m_subcycleBinnedNumNodes = nodes.size();
+
+  numUnstableElements = MpiWrapper::Sum( numUnstableElements );
+  GEOSX_LOG_RANK_0_IF( numUnstableElements > 0,
+                       getName() << ": " << numUnstableElements << " elements are not stable with the finest time step "
+                                 << dt / ( 1 << maxLevel ) << ", " << viewKeyStruct::explicitSubcycleLevelsString << " should be increased" );
+  GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": " << m_numSubcycleLevels << " subcycling levels from the time step " << dt
+                                       << " to " << dt / ( 1 << ( m_numSubcycleLevels - 1 ) ) );
+}
+
+
+string SolidMechanicsLagrangianFEM::subcycleElementListName( integer const level )
+{
+  return viewKeyStruct::explicitSubcycleElementsString + std::to_string( level );
 }
 
 
@@ -590,7 +972,16 @@ real64 SolidMechanicsLagrangianFEM::ExplicitStep( real64 const & time_n,
   fieldNames["node"].emplace_back( keys::Velocity );
   fieldNames["node"].emplace_back( keys::Acceleration );
 
-  CommunicationTools::SynchronizePackSendRecvSizes( fieldNames, &mesh, domain.getNeighbors(), m_iComm, true );
+  if( !m_explicitSyncPlan || !m_explicitSyncPlan->matches( fieldNames, mesh, domain.getNeighbors() ) )
+  {
+    m_explicitSyncPlan.reset();
+    m_explicitSyncPlan = std::make_unique< SynchronizationPlan >( fieldNames, mesh, domain.getNeighbors(), true );
+  }
+
+  if( m_explicitSubcycleLevels > 0 )
+  {
+    return ExplicitSubcycledStep( time_n, dt, domain );
+  }
 
   fsManager.ApplyFieldValue< parallelDevicePolicy< 1024 > >( time_n, &domain, "nodeManager", keys::Acceleration );
 
@@ -602,32 +993,17 @@ real64 SolidMechanicsLagrangianFEM::ExplicitStep( real64 const & time_n,
   //4. x^{n+1} = x^{n} + v^{n+{1}/{2}} dt (x is displacement)
   SolidMechanicsLagrangianFEMKernels::displacementUpdate( vel, uhat, u, dt );
 
-  fsManager.ApplyFieldValue( time_n + dt,
-                             &domain, "nodeManager",
-                             NodeManager::viewKeyStruct::totalDisplacementString,
-                             [&]( FieldSpecificationBase const * const bc,
-                                  SortedArrayView< localIndex const > const & targetSet )
-  {
-    integer const component = bc->GetComponent();
-    forAll< parallelDevicePolicy< 1024 > >( targetSet.size(),
-                                            [=] GEOSX_DEVICE ( localIndex const i )
-    {
-      localIndex const a = targetSet[ i ];
-      vel( a, component ) = u( a, component );
-    } );
-  },
-                             [&]( FieldSpecificationBase const * const bc,
-                                  SortedArrayView< localIndex const > const & targetSet )
+  ApplyDisplacementBC_explicit( time_n + dt, dt, domain );
+
+  // the acceleration holds the sum of the nodal forces, the coupling forces are added to the internal ones
+  if( m_applyExplicitExternalForces )
   {
-    integer const component = bc->GetComponent();
-    forAll< parallelDevicePolicy< 1024 > >( targetSet.size(),
-                                            [=] GEOSX_DEVICE ( localIndex const i )
+    arrayView2d< real64 const > const & fext = nodes.getReference< array2d< real64 > >( viewKeyStruct::forceExternal );
+    forAll< parallelDevicePolicy<> >( acc.size( 0 ), [=] GEOSX_DEVICE ( localIndex const a )
     {
-      localIndex const a = targetSet[ i ];
-      uhat( a, component ) = u( a, component ) - vel( a, component );
-      vel( a, component )  = uhat( a, component ) / dt;
+      LvArray::tensorOps::add< 3 >( acc[ a ], fext[ a ] );
     } );
-  } );
+  }
 
   //Step 5. Calculate deformation input to constitutive model and update state to
   // Q^{n+1}
@@ -643,7 +1019,11 @@ real64 SolidMechanicsLagrangianFEM::ExplicitStep( real64 const & time_n,
 
   fsManager.ApplyFieldValue< parallelDevicePolicy< 1024 > >( time_n, &domain, "nodeManager", keys::Velocity );
 
-  CommunicationTools::SynchronizePackSendRecv( fieldNames, &mesh, domain.getNeighbors(), m_iComm, true );
+  // the boundary nodes are final at this point, so the exchange can proceed while the interior elements are computed
+  if( m_explicitCommunicationOverlap )
+  {
+    m_explicitSyncPlan->start();
+  }
 
   explicitKernelDispatch( mesh,
                           targetRegionNames(),
@@ -657,11 +1037,150 @@ real64 SolidMechanicsLagrangianFEM::ExplicitStep( real64 const & time_n,
 
   fsManager.ApplyFieldValue< parallelDevicePolicy< 1024 > >( time_n, &domain, "nodeManager", keys::Velocity );
 
-  CommunicationTools::SynchronizeUnpack( &mesh, domain.getNeighbors(), m_iComm, true );
+  if( !m_explicitCommunicationOverlap )
+  {
+    m_explicitSyncPlan->start();
+  }
+  m_explicitSyncPlan->finish();
 
   return dt;
 }
 
+real64 SolidMechanicsLagrangianFEM::ExplicitSubcycledStep( real64 const & time_n,
+                                                           real64 const & dt,
+                                                           DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  NodeManager & nodes = *mesh.getNodeManager();
+
+  FieldSpecificationManager & fsManager = FieldSpecificationManager::get();
+
+  arrayView1d< real64 const > const & mass = nodes.getReference< array1d< real64 > >( keys::Mass );
+  arrayView2d< real64, nodes::VELOCITY_USD > const & vel = nodes.velocity();
+
+  arrayView2d< real64, nodes::TOTAL_DISPLACEMENT_USD > const & u = nodes.totalDisplacement();
+  arrayView2d< real64, nodes::INCR_DISPLACEMENT_USD > const & uhat = nodes.incrementalDisplacement();
+  arrayView2d< real64, nodes::ACCELERATION_USD > const & acc = nodes.acceleration();
+
+  if( dt != m_subcycleBinnedDt || nodes.size() != m_subcycleBinnedNumNodes )
+  {
+    binExplicitSubcycleLevels( domain, dt );
+  }
+
+  // the finest level advances once per substep, the level l every 2^(numLevels-1-l) substeps
+  integer const numSubsteps = 1 << ( m_numSubcycleLevels - 1 );
+  real64 const substepDt = dt / numSubsteps;
+
+  for( integer substep = 0; substep < numSubsteps; ++substep )
+  {
+    real64 const time = time_n + substep * substepDt;
+
+    fsManager.ApplyFieldValue< parallelDevicePolicy< 1024 > >( time, &domain, "nodeManager", keys::Acceleration );
+
+    //3: v^{n+1/2} = v^{n} + a^{n} dt_l/2 on the nodes of the levels starting their time step dt_l
+    for( integer level = 0; level < m_numSubcycleLevels; ++level )
+    {
+      SortedArrayView< localIndex const > const & levelNodes = m_subcycleLevelNodes[ level ].toViewConst();
+      if( substep % ( numSubsteps >> level ) == 0 )
+      {
+        SolidMechanicsLagrangianFEMKernels::velocityUpdate( acc, vel, dt / ( 2 << level ), levelNodes );
+      }
+      else
+      {
+        // only the forces of the last substep of the time step of the level are summed
+        SolidMechanicsLagrangianFEMKernels::accelerationReset( acc, levelNodes );
+      }
+    }
+
+    fsManager.ApplyFieldValue< parallelDevicePolicy< 1024 > >( time, &domain, "nodeManager", keys::Velocity );
+
+    //4. x^{n+1} = x^{n} + v^{n+{1}/{2}} dt, the velocity being constant over the time step of each level
+    SolidMechanicsLagrangianFEMKernels::displacementUpdate( vel, uhat, u, substepDt );
+
+    ApplyDisplacementBC_explicit( time + substepDt, substepDt, domain );
+
+    if( m_applyExplicitExternalForces )
+    {
+      arrayView2d< real64 const > const & fext = nodes.getReference< array2d< real64 > >( viewKeyStruct::forceExternal );
+      forAll< parallelDevicePolicy<> >( acc.size( 0 ), [=] GEOSX_DEVICE ( localIndex const a )
+      {
+        LvArray::tensorOps::add< 3 >( acc[ a ], fext[ a ] );
+      } );
+    }
+
+    //Step 5. the elements of the levels ending their time step are updated with the increment over that time step
+    for( integer level = 0; level < m_numSubcycleLevels; ++level )
+    {
+      if( ( substep + 1 ) % ( numSubsteps >> level ) == 0 )
+      {
+        explicitKernelDispatch( mesh,
+                                targetRegionNames(),
+                                this->getDiscretizationName(),
+                                m_solidMaterialNames,
+                                dt / ( 1 << level ),
+                                subcycleElementListName( level ) );
+      }
+    }
+
+    for( integer level = 0; level < m_numSubcycleLevels; ++level )
+    {
+      if( ( substep + 1 ) % ( numSubsteps >> level ) == 0 )
+      {
+        SolidMechanicsLagrangianFEMKernels::velocityUpdate( acc, mass, vel, dt / ( 2 << level ),
+                                                            m_subcycleLevelNodes[ level ].toViewConst() );
+      }
+    }
+
+    fsManager.ApplyFieldValue< parallelDevicePolicy< 1024 > >( time, &domain, "nodeManager", keys::Velocity );
+
+    m_explicitSyncPlan->start();
+    m_explicitSyncPlan->finish();
+  }
+
+  return dt;
+}
+
+void SolidMechanicsLagrangianFEM::ApplyDisplacementBC_explicit( real64 const time,
+                                                                real64 const dt,
+                                                                DomainPartition & domain )
+{
+  FieldSpecificationManager & fsManager = FieldSpecificationManager::get();
+
+  NodeManager & nodes = *domain.getMeshBody( 0 )->getMeshLevel( 0 )->getNodeManager();
+  arrayView2d< real64, nodes::VELOCITY_USD > const & vel = nodes.velocity();
+  arrayView2d< real64, nodes::TOTAL_DISPLACEMENT_USD > const & u = nodes.totalDisplacement();
+  arrayView2d< real64, nodes::INCR_DISPLACEMENT_USD > const & uhat = nodes.incrementalDisplacement();
+
+  fsManager.ApplyFieldValue( time,
+                             &domain, "nodeManager",
+                             NodeManager::viewKeyStruct::totalDisplacementString,
+                             [&]( FieldSpecificationBase const * const bc,
+                                  SortedArrayView< localIndex const > const & targetSet )
+  {
+    integer const component = bc->GetComponent();
+    forAll< parallelDevicePolicy< 1024 > >( targetSet.size(),
+                                            [=] GEOSX_DEVICE ( localIndex const i )
+    {
+      localIndex const a = targetSet[ i ];
+      vel( a, component ) = u( a, component );
+    } );
+  },
+                             [&]( FieldSpecificationBase const * const bc,
+                                  SortedArrayView< localIndex const > const & targetSet )
+  {
+    integer const component = bc->GetComponent();
+    forAll< parallelDevicePolicy< 1024 > >( targetSet.size(),
+                                            [=] GEOSX_DEVICE ( localIndex const i )
+    {
+      localIndex const a = targetSet[ i ];
+      uhat( a, component ) = u( a, component ) - vel( a, component );
+      vel( a, component )  = uhat( a, component ) / dt;
+    } );
+  } );
+}
+
 
 
 void SolidMechanicsLagrangianFEM::ApplyDisplacementBC_implicit( real64 const time,
@@ -887,14 +1406,14 @@ SolidMechanicsLagrangianFEM::
   {
     SolidBase const & constitutiveRelation = GetConstitutiveModel< SolidBase >( subRegion, m_solidMaterialNames[targetIndex] );
 
-    arrayView3d< real64 const, solid::STRESS_USD > const & stress = constitutiveRelation.getStress();
+    arrayView3d< solid::STATE_TYPE const, solid::STRESS_USD > const & stress = constitutiveRelation.getStress();
 
-    array3d< real64, solid::STRESS_PERMUTATION > &
-    stress_n = subRegion.getReference< array3d< real64, solid::STRESS_PERMUTATION > >( viewKeyStruct::stress_n );
+    array3d< solid::STATE_TYPE, solid::STRESS_PERMUTATION > &
+    stress_n = subRegion.getReference< array3d< solid::STATE_TYPE, solid::STRESS_PERMUTATION > >( viewKeyStruct::stress_n );
     // TODO: eliminate
     stress_n.resize( stress.size( 0 ), stress.size( 1 ), 6 );
 
-    arrayView3d< real64, solid::STRESS_USD > const & vstress_n = stress_n.toView();
+    arrayView3d< solid::STATE_TYPE, solid::STRESS_USD > const & vstress_n = stress_n.toView();
 
     forAll< parallelDevicePolicy<> >( stress.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const k )
     {
@@ -977,13 +1496,45 @@ void SolidMechanicsLagrangianFEM::SetupSystem( DomainPartition & domain,
                                                bool const setSparisty )
 {
   GEOSX_MARK_FUNCTION;
-  SolverBase::SetupSystem( domain, dofManager, localMatrix, localRhs, localSolution, setSparisty );
+  GEOSX_UNUSED_VAR( setSparisty );
+  SolverBase::SetupSystem( domain, dofManager, localMatrix, localRhs, localSolution, false );
+
+  LinearSolverParameters const & params = m_linearSolverParameters.get();
+  if( !m_precond &&
+      params.solverType != LinearSolverParameters::SolverType::direct &&
+      params.preconditionerType == LinearSolverParameters::PreconditionerType::gmg )
+  {
+    SetupGeometricMultigrid( domain, dofManager );
+  }
+
+  // the sparsity pattern only changes with the topology of the mesh, e.g. when the surface generator splits faces
+  if( dofManager.canReuseSparsityPattern( localMatrix ) )
+  {
+    localMatrix.setValues< parallelDevicePolicy<> >( 0.0 );
+    return;
+  }
 
   MeshLevel & mesh = *(domain.getMeshBodies()->GetGroup< MeshBody >( 0 )->getMeshLevel( 0 ));
   NodeManager const & nodeManager = *(mesh.getNodeManager());
   arrayView1d< globalIndex const > const &
   dofNumber = nodeManager.getReference< globalIndex_array >( dofManager.getKey( keys::TotalDisplacement ) );
 
+  if( m_matrixFree )
+  {
+    // only the diagonal is assembled, the off-diagonal entries are applied on the fly
+    SparsityPattern< globalIndex > diagonalPattern( dofManager.numLocalDofs(),
+                                                    dofManager.numGlobalDofs(),
+                                                    1 );
+    globalIndex const rankOffset = dofManager.rankOffset();
+    for( localIndex row = 0; row < dofManager.numLocalDofs(); ++row )
+    {
+      diagonalPattern.insertNonZero( row, rankOffset + row );
+    }
+    diagonalPattern.compress();
+    localMatrix.assimilate< parallelDevicePolicy<> >( std::move( diagonalPattern ) );
+    return;
+  }
+
   SparsityPattern< globalIndex > sparsityPattern( dofManager.numLocalDofs(),
                                                   dofManager.numGlobalDofs(),
                                                   8*8*3*1.2 );
@@ -1022,6 +1573,145 @@ void SolidMechanicsLagrangianFEM::SetupSystem( DomainPartition & domain,
 
 }
 
+void SolidMechanicsLagrangianFEM::SetupGeometricMultigrid( DomainPartition & domain,
+                                                           DofManager const & dofManager )
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshBody const & meshBody = *domain.getMeshBody( 0 );
+  GEOSX_ERROR_IF( !meshBody.isStructured(),
+                  getName() << ": the gmg preconditioner requires a cartesian mesh of the internal mesh generator" );
+
+  globalIndex const numLatticeNodes[3] = { meshBody.getStructuredNodeCount( 0 ),
+                                           meshBody.getStructuredNodeCount( 1 ),
+                                           meshBody.getStructuredNodeCount( 2 ) };
+
+  // the nodes are numbered lexicographically over the lattice, z varying fastest
+  auto const latticeIndex = [&]( globalIndex const nodeGlobalIndex, int const dir ) -> globalIndex
+  {
+    globalIndex const stride = ( dir == 0 ) ? numLatticeNodes[1] * numLatticeNodes[2] : ( ( dir == 1 ) ? numLatticeNodes[2] : 1 );
+    return ( nodeGlobalIndex / stride ) % numLatticeNodes[dir];
+  };
+  auto const isCoarse = [&]( globalIndex const index, int const dir ) -> bool
+  {
+    return index % 2 == 0 || index == numLatticeNodes[dir] - 1;
+  };
+  globalIndex const numGlobalLatticeNodes = numLatticeNodes[0] * numLatticeNodes[1] * numLatticeNodes[2];
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  NodeManager & nodeManager = *mesh.getNodeManager();
+
+  arrayView1d< globalIndex const > const & dofNumber =
+    nodeManager.getReference< globalIndex_array >( dofManager.getKey( keys::TotalDisplacement ) );
+  arrayView1d< integer const > const & ghostRank = nodeManager.ghostRank();
+  arrayView1d< globalIndex const > const & localToGlobal = nodeManager.localToGlobalMap();
+  unordered_map< globalIndex, localIndex > const & globalToLocal = nodeManager.globalToLocalMap();
+  arrayView1d< globalIndex > const & coarseNode = nodeManager.getReference< array1d< globalIndex > >( viewKeyStruct::gmgCoarseNodeString );
+
+  // number the owned coarse nodes contiguously over the ranks, the ghosts receive the numbers of their owners
+  localIndex numLocalCoarseNodes = 0;
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    coarseNode[a] = -1;
+    globalIndex const nodeGlobalIndex = localToGlobal[a];
+    if( ghostRank[a] < 0 && dofNumber[a] >= 0 && nodeGlobalIndex < numGlobalLatticeNodes &&
+        isCoarse( latticeIndex( nodeGlobalIndex, 0 ), 0 ) &&
+        isCoarse( latticeIndex( nodeGlobalIndex, 1 ), 1 ) &&
+        isCoarse( latticeIndex( nodeGlobalIndex, 2 ), 2 ) )
+    {
+      coarseNode[a] = numLocalCoarseNodes++;
+    }
+  }
+
+  globalIndex const coarseOffset = MpiWrapper::PrefixSum< globalIndex >( numLocalCoarseNodes );
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    if( coarseNode[a] >= 0 )
+    {
+      coarseNode[a] += coarseOffset;
+    }
+  }
+
+  std::map< string, string_array > fieldNames;
+  fieldNames["node"].emplace_back( viewKeyStruct::gmgCoarseNodeString );
+  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain.getNeighbors() );
+
+  // the parents of a fine node are its neighbors in the lattice along the directions where it is not coarse,
+  // they share an element with it and are therefore present on the rank
+  localIndex constexpr numComponents = 3;
+  globalIndex const rankOffset = dofManager.rankOffset();
+  CRSMatrix< real64, globalIndex > localProlongator( dofManager.numLocalDofs(),
+                                                     numComponents * MpiWrapper::Sum( LvArray::integerConversion< globalIndex >( numLocalCoarseNodes ) ),
+                                                     8 );
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    globalIndex const nodeGlobalIndex = localToGlobal[a];
+    if( ghostRank[a] >= 0 || dofNumber[a] < 0 || nodeGlobalIndex >= numGlobalLatticeNodes )
+    {
+      continue;
+    }
+
+    globalIndex parentIndex[3][2];
+    real64 parentWeight[3][2];
+    int numParents[3];
+    for( int dir = 0; dir < 3; ++dir )
+    {
+      globalIndex const index = latticeIndex( nodeGlobalIndex, dir );
+      if( isCoarse( index, dir ) )
+      {
+        numParents[dir] = 1;
+        parentIndex[dir][0] = index;
+        parentWeight[dir][0] = 1.0;
+      }
+      else
+      {
+        numParents[dir] = 2;
+        parentIndex[dir][0] = index - 1;
+        parentIndex[dir][1] = index + 1;
+        parentWeight[dir][0] = 0.5;
+        parentWeight[dir][1] = 0.5;
+      }
+    }
+
+    // the parents without a displacement are dropped, the weights of the others still sum to one
+    globalIndex parents[8];
+    real64 weights[8];
+    int count = 0;
+    real64 weightSum = 0.0;
+    for( int i = 0; i < numParents[0]; ++i )
+    {
+      for( int j = 0; j < numParents[1]; ++j )
+      {
+        for( int k = 0; k < numParents[2]; ++k )
+        {
+          globalIndex const parentGlobalIndex = ( parentIndex[0][i] * numLatticeNodes[1] + parentIndex[1][j] ) * numLatticeNodes[2] + parentIndex[2][k];
+          auto const parent = globalToLocal.find( parentGlobalIndex );
+          if( parent != globalToLocal.end() && coarseNode[parent->second] >= 0 )
+          {
+            parents[count] = coarseNode[parent->second];
+            weights[count] = parentWeight[0][i] * parentWeight[1][j] * parentWeight[2][k];
+            weightSum += weights[count];
+            ++count;
+          }
+        }
+      }
+    }
+
+    localIndex const localRow = LvArray::integerConversion< localIndex >( dofNumber[a] - rankOffset );
+    for( int p = 0; p < count; ++p )
+    {
+      for( localIndex c = 0; c < numComponents; ++c )
+      {
+        localProlongator.insertNonZero( localRow + c, numComponents * parents[p] + c, weights[p] / weightSum );
+      }
+    }
+  }
+
+  m_precond = std::make_unique< GeometricMultigridPreconditioner< LAInterface > >( m_linearSolverParameters.get(),
+                                                                                 std::move( localProlongator ),
+                                                                                 numComponents * numLocalCoarseNodes );
+}
+
 void SolidMechanicsLagrangianFEM::AssembleSystem( real64 const GEOSX_UNUSED_PARAM( time_n ),
                                                   real64 const dt,
                                                   DomainPartition & domain,
@@ -1034,6 +1724,20 @@ void SolidMechanicsLagrangianFEM::AssembleSystem( real64 const GEOSX_UNUSED_PARA
   localMatrix.setValues< parallelDevicePolicy< 32 > >( 0 );
   localRhs.setValues< parallelDevicePolicy< 32 > >( 0 );
 
+  AssembleSystemContributions( dt, domain, dofManager, localMatrix, localRhs );
+}
+
+void SolidMechanicsLagrangianFEM::AssembleSystemContributions( real64 const dt,
+                                                               DomainPartition & domain,
+                                                               DofManager const & dofManager,
+                                                               CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                                               arrayView1d< real64 > const & localRhs )
+{
+  GEOSX_MARK_FUNCTION;
+
+  GEOSX_ERROR_IF( m_matrixFree && m_effectiveStress==1,
+                  getName() << ": " << viewKeyStruct::matrixFreeString << " does not support the effective stress" );
+
   if( m_effectiveStress==1 )
   {
     GEOSX_UNUSED_VAR( dt );
@@ -1044,6 +1748,31 @@ void SolidMechanicsLagrangianFEM::AssembleSystem( real64 const GEOSX_UNUSED_PARA
                                                                                   localRhs );
 
   }
+  else if( m_cacheElementStiffness )
+  {
+    GEOSX_UNUSED_VAR( dt );
+    string const elementStiffnessName = viewKeyStruct::elementStiffnessString;
+    integer const reuseElementStiffness = m_elementStiffnessIsCached;
+    integer const diagonalOnly = m_matrixFree;
+    AssemblyLaunch< constitutive::SolidBase,
+                    SolidMechanicsLagrangianFEMKernels::QuasiStaticCachedStiffness >( domain,
+                                                                                      dofManager,
+                                                                                      localMatrix,
+                                                                                      localRhs,
+                                                                                      elementStiffnessName,
+                                                                                      reuseElementStiffness,
+                                                                                      diagonalOnly );
+    m_elementStiffnessIsCached = true;
+  }
+  else if( m_matrixFree )
+  {
+    GEOSX_UNUSED_VAR( dt );
+    AssemblyLaunch< constitutive::SolidBase,
+                    SolidMechanicsLagrangianFEMKernels::QuasiStaticDiagonal >( domain,
+                                                                               dofManager,
+                                                                               localMatrix,
+                                                                               localRhs );
+  }
   else
   {
     if( m_timeIntegrationOption == TimeIntegrationOption::QuasiStatic )
@@ -1070,6 +1799,19 @@ void SolidMechanicsLagrangianFEM::AssembleSystem( real64 const GEOSX_UNUSED_PARA
     }
   }
 
+  if( m_matrixFree && m_matrixFreeOperator == nullptr )
+  {
+    // the stiffness is applied from the stored element matrices when they are cached
+    m_matrixFreeOperator = std::make_unique< SolidMechanicsMatrixFreeOperator >( domain,
+                                                                                 dofManager,
+                                                                                 targetRegionNames(),
+                                                                                 this->getDiscretizationName(),
+                                                                                 m_solidMaterialNames,
+                                                                                 viewKeyStruct::matrixFreeInputString,
+                                                                                 viewKeyStruct::matrixFreeOutputString,
+                                                                                 m_cacheElementStiffness ? viewKeyStruct::elementStiffnessString : "" );
+  }
+
   if( getLogLevel() >= 2 )
   {
     GEOSX_LOG_RANK_0( "After SolidMechanicsLagrangianFEM::AssembleSystem" );
@@ -1128,13 +1870,45 @@ SolidMechanicsLagrangianFEM::
   }
 
   ApplyDisplacementBC_implicit( time_n + dt, dofManager, domain, localMatrix, localRhs );
+
+  if( m_matrixFree )
+  {
+    // flag the rows reduced to their diagonal, so that the matrix-free operator does the same
+    m_matrixFreeConstrainedRows.resize( localMatrix.numRows() );
+    m_matrixFreeConstrainedRows.setValues< serialPolicy >( 0 );
+    arrayView1d< integer > const constrainedRows = m_matrixFreeConstrainedRows;
+    globalIndex const rankOffset = dofManager.rankOffset();
+
+    fsManager.Apply( time_n + dt,
+                     &domain,
+                     "nodeManager",
+                     keys::TotalDisplacement,
+                     [&]( FieldSpecificationBase const * const bc,
+                          string const &,
+                          SortedArrayView< localIndex const > const & targetSet,
+                          Group * const targetGroup,
+                          string const & GEOSX_UNUSED_PARAM( fieldName ) )
+    {
+      arrayView1d< globalIndex const > const dofNumber = targetGroup->getReference< globalIndex_array >( dofKey );
+      integer const component = bc->GetComponent();
+      for( localIndex const a : targetSet )
+      {
+        globalIndex const localRow = dofNumber[a] + component - rankOffset;
+        if( localRow >= 0 && localRow < constrainedRows.size() )
+        {
+          constrainedRows[localRow] = 1;
+        }
+      }
+    } );
+  }
 }
 
-real64
+void
 SolidMechanicsLagrangianFEM::
-  CalculateResidualNorm( DomainPartition const & domain,
-                         DofManager const & dofManager,
-                         arrayView1d< real64 const > const & localRhs )
+  CalculateLocalResidualNorms( DomainPartition const & domain,
+                               DofManager const & dofManager,
+                               arrayView1d< real64 const > const & localRhs,
+                               ResidualNormParts & parts )
 {
   GEOSX_MARK_FUNCTION;
 
@@ -1147,10 +1921,36 @@ SolidMechanicsLagrangianFEM::
 
   arrayView1d< integer const > const & ghostRank = nodeManager.ghostRank();
 
-  RAJA::ReduceSum< parallelDeviceReduce, real64 > localSum( 0.0 );
-
   SortedArrayView< localIndex const > const & targetNodes = m_targetNodes.toViewConst();
 
+  if( DeterministicReduction::isEnabled() )
+  {
+    // fixed-order sum over the target nodes, the components of a node being added in order
+    real64 const orderedSum =
+      DeterministicReduction::localSum< parallelDevicePolicy<> >( targetNodes.size(),
+                                                                  [localRhs, dofNumber, rankOffset, ghostRank, targetNodes] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      real64 nodeSum = 0.0;
+      localIndex const nodeIndex = targetNodes[k];
+      if( ghostRank[nodeIndex] < 0 )
+      {
+        localIndex const localRow = LvArray::integerConversion< localIndex >( dofNumber[nodeIndex] - rankOffset );
+
+        for( localIndex dim = 0; dim < 3; ++dim )
+        {
+          nodeSum += localRhs[localRow + dim] * localRhs[localRow + dim];
+        }
+      }
+      return nodeSum;
+    } );
+
+    parts.appendSum( orderedSum );
+    parts.appendMax( this->m_maxForce );
+    return;
+  }
+
+  RAJA::ReduceSum< parallelDeviceReduce, real64 > localSum( 0.0 );
+
   forAll< parallelDevicePolicy<> >( targetNodes.size(),
                                     [localRhs, localSum, dofNumber, rankOffset, ghostRank, targetNodes] GEOSX_HOST_DEVICE ( localIndex const k )
   {
@@ -1166,39 +1966,20 @@ SolidMechanicsLagrangianFEM::
     }
   } );
 
-  real64 const localResidualNorm[2] = { localSum.get(), this->m_maxForce };
-
-  // globalResidualNorm[0]: the sum of all the local sum(rhs^2).
-  // globalResidualNorm[1]: max of max force of each rank. Basically max force globally
-  real64 globalResidualNorm[2] = {0, 0};
-
-  int const rank = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
-  int const size = MpiWrapper::Comm_size( MPI_COMM_GEOSX );
-  array1d< real64 > globalValues( size * 2 );
-
-  // Everything is done on rank 0
-  MpiWrapper::gather( localResidualNorm,
-                      2,
-                      globalValues.data(),
-                      2,
-                      0,
-                      MPI_COMM_GEOSX );
-
-  if( rank==0 )
-  {
-    for( int r=0; r<size; ++r )
-    {
-      // sum/max across all ranks
-      globalResidualNorm[0] += globalValues[r*2];
-      globalResidualNorm[1] = std::max( globalResidualNorm[1], globalValues[r*2+1] );
-    }
-  }
-
-  MpiWrapper::bcast( globalResidualNorm, 2, 0, MPI_COMM_GEOSX );
+  // the sum of all the local sum(rhs^2), and the max of max force of each rank. Basically max force globally
+  parts.appendSum( localSum.get() );
+  parts.appendMax( this->m_maxForce );
+}
 
+real64
+SolidMechanicsLagrangianFEM::
+  CombineResidualNorms( ResidualNormParts & parts )
+{
+  real64 const squaredNorm = parts.nextSum();
+  real64 const maxForce = parts.nextMax();
 
-  real64 const residual = sqrt( globalResidualNorm[0] )/(globalResidualNorm[1]+1);  // the + 1 is for the first
-                                                                                    // time-step when maxForce = 0;
+  real64 const residual = sqrt( squaredNorm )/(maxForce+1);  // the + 1 is for the first
+                                                             // time-step when maxForce = 0;
 
   if( getLogLevel() >= 1 && logger::internal::rank==0 )
   {
@@ -1239,7 +2020,8 @@ SolidMechanicsLagrangianFEM::ApplySystemSolution( DofManager const & dofManager,
   CommunicationTools::SynchronizeFields( fieldNames,
                                          domain.getMeshBody( 0 )->getMeshLevel( 0 ),
                                          domain.getNeighbors(),
-                                         true );
+                                         true,
+                                         {} );
 }
 
 void SolidMechanicsLagrangianFEM::SolveSystem( DofManager const & dofManager,
@@ -1248,7 +2030,44 @@ void SolidMechanicsLagrangianFEM::SolveSystem( DofManager const & dofManager,
                                                ParallelVector & solution )
 {
   solution.zero();
-  SolverBase::SolveSystem( dofManager, matrix, rhs, solution );
+
+  if( !m_matrixFree )
+  {
+    SolverBase::SolveSystem( dofManager, matrix, rhs, solution );
+    return;
+  }
+
+  GEOSX_MARK_FUNCTION;
+
+  // the matrix only holds the diagonal of the operator, which is applied matrix-free
+  LinearSolverParameters const & params = m_linearSolverParameters.get();
+
+  m_matrixFreeOperator->setDiagonal( matrix, m_matrixFreeConstrainedRows );
+
+  std::unique_ptr< PreconditionerBase< LAInterface > > precond;
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::jacobi )
+  {
+    precond = std::make_unique< PreconditionerJacobi< LAInterface > >();
+  }
+  else
+  {
+    precond = std::make_unique< PreconditionerIdentity< LAInterface > >();
+  }
+  precond->compute( matrix );
+
+  std::unique_ptr< KrylovSolver< ParallelVector > > solver =
+    KrylovSolver< ParallelVector >::Create( params, *m_matrixFreeOperator, *precond );
+  solver->solve( rhs, solution );
+  m_linearSolverResult = solver->result();
+
+  if( params.stopIfError )
+  {
+    GEOSX_ERROR_IF( m_linearSolverResult.breakdown(), "Linear solution breakdown -> simulation STOP" );
+  }
+  else
+  {
+    GEOSX_WARNING_IF( !m_linearSolverResult.success(), "Linear solution failed" );
+  }
 }
 
 void SolidMechanicsLagrangianFEM::ResetStateToBeginningOfStep( DomainPartition & domain )
@@ -1283,10 +2102,10 @@ void SolidMechanicsLagrangianFEM::ResetStressToBeginningOfStep( DomainPartition
   {
     SolidBase & constitutiveRelation = GetConstitutiveModel< SolidBase >( subRegion, m_solidMaterialNames[targetIndex] );
 
-    arrayView3d< real64, solid::STRESS_USD > const & stress = constitutiveRelation.getStress();
+    arrayView3d< solid::STATE_TYPE, solid::STRESS_USD > const & stress = constitutiveRelation.getStress();
 
-    arrayView3d< real64 const, solid::STRESS_USD > const &
-    stress_n = subRegion.getReference< array3d< real64, solid::STRESS_PERMUTATION > >( viewKeyStruct::stress_n );
+    arrayView3d< solid::STATE_TYPE const, solid::STRESS_USD > const &
+    stress_n = subRegion.getReference< array3d< solid::STATE_TYPE, solid::STRESS_PERMUTATION > >( viewKeyStruct::stress_n );
 
     forAll< parallelDevicePolicy<> >( stress.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const k )
     {
@@ -23,9 +23,11 @@
 #include "common/TimingMacros.hpp"
 #include "mesh/MeshForLoopInterface.hpp"
 #include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/SynchronizationPlan.hpp"
 #include "physicsSolvers/SolverBase.hpp"
 
 #include "SolidMechanicsLagrangianFEMKernels.hpp"
+#include "SolidMechanicsMatrixFreeOperator.hpp"
 
 namespace geosx
 {
@@ -101,6 +103,23 @@ public:
                        integer const cycleNumber,
                        DomainPartition & domain ) override;
 
+  /**
+   * @brief Advance the explicit time integration by one step, each level of elements at its own rate.
+   * @param time_n the time at the beginning of the step
+   * @param dt the time step, which is the time step of the coarsest level
+   * @param domain the domain partition
+   * @return the time step
+   *
+   * The elements of level l advance with the time step dt / 2^l, the level of an element being the finest
+   * level of its nodes, and the level of a node the finest level whose time step is stable for all its
+   * elements. The nodes keep a constant velocity between their own updates, so that the increment of the
+   * coarser elements over their time step is consistent with the displacement of their nodes.
+   * Called by ExplicitStep once its synchronization plan is up to date.
+   */
+  real64 ExplicitSubcycledStep( real64 const & time_n,
+                                real64 const & dt,
+                                DomainPartition & domain );
+
   virtual void
   ImplicitStepSetup( real64 const & time_n,
                      real64 const & dt,
@@ -126,6 +145,23 @@ public:
                   CRSMatrixView< real64, globalIndex const > const & localMatrix,
                   arrayView1d< real64 > const & localRhs ) override;
 
+  /**
+   * @brief Add the contributions of the solid to the system, without zeroing the matrix and the right-hand side first.
+   * @param dt the time step
+   * @param domain the domain
+   * @param dofManager the degree-of-freedom manager
+   * @param localMatrix the local part of the matrix
+   * @param localRhs the local part of the right-hand side
+   *
+   * Coupled solvers which assemble the other fields concurrently zero the system once beforehand.
+   */
+  void
+  AssembleSystemContributions( real64 const dt,
+                               DomainPartition & domain,
+                               DofManager const & dofManager,
+                               CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                               arrayView1d< real64 > const & localRhs );
+
   virtual void
   SolveSystem( DofManager const & dofManager,
                ParallelMatrix & matrix,
@@ -145,10 +181,14 @@ public:
                                         CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                         arrayView1d< real64 > const & localRhs ) override;
 
+  virtual void
+  CalculateLocalResidualNorms( DomainPartition const & domain,
+                               DofManager const & dofManager,
+                               arrayView1d< real64 const > const & localRhs,
+                               ResidualNormParts & parts ) override;
+
   virtual real64
-  CalculateResidualNorm( DomainPartition const & domain,
-                         DofManager const & dofManager,
-                         arrayView1d< real64 const > const & localRhs ) override;
+  CombineResidualNorms( ResidualNormParts & parts ) override;
 
   virtual void ResetStateToBeginningOfStep( DomainPartition & domain ) override;
 
@@ -176,6 +216,42 @@ public:
   template< typename ... PARAMS >
   real64 explicitKernelDispatch( PARAMS && ... params );
 
+  /**
+   * @brief Compute the stable time step of the explicit time integration of each target element.
+   * @param mesh the mesh level
+   *
+   * The stable time step of an element is the CFL factor times its smallest node distance over the
+   * speed of the compressional waves, estimated from the largest diagonal entry of the stiffness.
+   */
+  void computeExplicitStableTimeSteps( MeshLevel & mesh );
+
+  /**
+   * @brief Sort the target elements and nodes into the subcycling levels of a time step.
+   * @param domain the domain partition
+   * @param dt the time step of the coarsest level
+   */
+  void binExplicitSubcycleLevels( DomainPartition & domain, real64 const dt );
+
+  /**
+   * @brief Name of the list of the elements of a subcycling level.
+   * @param level the level
+   * @return the name of the entry holding the elements of @p level on each subregion
+   */
+  static string subcycleElementListName( integer const level );
+
+  /**
+   * @brief Apply the displacement boundary conditions of the explicit time integration.
+   * @param time the time at the end of the update
+   * @param dt the time interval of the update
+   * @param domain the domain partition
+   *
+   * The increment of the constrained nodes is set to reach the prescribed displacement, and their velocity to
+   * this increment over @p dt.
+   */
+  void ApplyDisplacementBC_explicit( real64 const time,
+                                     real64 const dt,
+                                     DomainPartition & domain );
+
   /**
    * Applies displacement boundary conditions to the system for implicit time integration
    * @param time The time to use for any lookups associated with this BC
@@ -234,6 +310,18 @@ public:
     static constexpr auto elemsAttachedToSendOrReceiveNodes = "elemsAttachedToSendOrReceiveNodes";
     static constexpr auto elemsNotAttachedToSendOrReceiveNodes = "elemsNotAttachedToSendOrReceiveNodes";
     static constexpr auto effectiveStress = "effectiveStress";
+    static constexpr auto explicitCommunicationOverlapString = "explicitCommunicationOverlap";
+    static constexpr auto explicitColoredAssemblyString = "explicitColoredAssembly";
+    static constexpr auto explicitSubcycleLevelsString = "explicitSubcycleLevels";
+    static constexpr auto explicitStableTimeStepString = "explicitStableTimeStep";
+    static constexpr auto explicitSubcycleLevelString = "explicitSubcycleLevel";
+    static constexpr auto explicitSubcycleElementsString = "explicitSubcycleElements";
+    static constexpr auto matrixFreeString = "matrixFree";
+    static constexpr auto matrixFreeInputString = "matrixFreeInput";
+    static constexpr auto matrixFreeOutputString = "matrixFreeOutput";
+    static constexpr auto cacheElementStiffnessString = "cacheElementStiffness";
+    static constexpr auto elementStiffnessString = "elementStiffness";
+    static constexpr auto gmgCoarseNodeString = "gmgCoarseNode";
 
     dataRepository::ViewKey vTilde = { vTildeString };
     dataRepository::ViewKey uhatTilde = { uhatTildeString };
@@ -267,12 +355,36 @@ public:
 
   real64 & getMaxForce() { return m_maxForce; }
 
+  /**
+   * @brief Get the time integration option of the solver.
+   * @return the time integration option
+   */
+  TimeIntegrationOption timeIntegrationOption() const { return m_timeIntegrationOption; }
+
+  /**
+   * @brief Set whether the external nodal forces load the nodes in the explicit steps.
+   * @param apply if true, ExplicitStep adds the forces of the externalForce field, such as the hydraulic forces set by
+   *   a coupled solver, to the internal forces
+   */
+  void setApplyExplicitExternalForces( bool const apply ) { m_applyExplicitExternalForces = apply; }
+
 
 protected:
   virtual void PostProcessInput() override final;
 
   virtual void InitializePostInitialConditions_PreSubGroups( dataRepository::Group * const problemManager ) override final;
 
+  /**
+   * @brief Build the geometric multigrid preconditioner from the structured lattice of the nodes.
+   * @param domain the domain partition
+   * @param dofManager the degree-of-freedom manager of the displacement
+   *
+   * The coarse nodes are the nodes of even lattice indices, and the last ones along each direction.
+   * The prolongation interpolates the displacement of the fine nodes trilinearly in the lattice.
+   */
+  void SetupGeometricMultigrid( DomainPartition & domain,
+                                DofManager const & dofManager );
+
   real64 m_newmarkGamma;
   real64 m_newmarkBeta;
   real64 m_massDamping;
@@ -287,13 +399,54 @@ protected:
   SortedArray< localIndex > m_sendOrReceiveNodes;
   SortedArray< localIndex > m_nonSendOrReceiveNodes;
   SortedArray< localIndex > m_targetNodes;
-  MPI_iCommData m_iComm;
+
+  /// Persistent halo-exchange plan for the nodal fields synchronized in ExplicitStep
+  std::unique_ptr< SynchronizationPlan > m_explicitSyncPlan;
+
+  /// Flag to overlap the explicit nodal synchronization with the interior element computation
+  integer m_explicitCommunicationOverlap;
+
+  /// Flag to assemble the explicit nodal forces color by color instead of with atomics
+  integer m_explicitColoredAssembly;
+
+  /// The number of subcycling levels finer than the time step in the explicit time integration, 0 if not subcycling
+  integer m_explicitSubcycleLevels;
+
+  /// The time step of the current binning into subcycling levels, negative if not binned
+  real64 m_subcycleBinnedDt = -1.0;
+
+  /// The number of nodes when the subcycling levels were binned, to bin them again after a topology change
+  localIndex m_subcycleBinnedNumNodes = -1;
+
+  /// The number of subcycling levels used over all the ranks
+  integer m_numSubcycleLevels = 0;
+
+  /// The target nodes of each subcycling level
+  std::vector< SortedArray< localIndex > > m_subcycleLevelNodes;
+
+  /// Whether the external nodal forces are added to the internal forces in ExplicitStep
+  bool m_applyExplicitExternalForces = false;
 
   /// Indicates whether or not to use effective stress when integrating the
   /// stress divergence in the kernels. This means calling the poroelastic
   /// variant of the solid mechanics kernels.
   integer m_effectiveStress;
 
+  /// Flag to apply the stiffness matrix-free in the Krylov solves instead of assembling it
+  integer m_matrixFree;
+
+  /// The matrix-free stiffness operator, built on the first assembly
+  std::unique_ptr< SolidMechanicsMatrixFreeOperator > m_matrixFreeOperator;
+
+  /// For each local row, whether it is constrained by a Dirichlet boundary condition (matrix-free mode only)
+  array1d< integer > m_matrixFreeConstrainedRows;
+
+  /// Flag to store the element stiffness matrices of the linear elastic models and reuse them in the next assemblies
+  integer m_cacheElementStiffness;
+
+  /// Whether the element stiffness matrices have been stored
+  bool m_elementStiffnessIsCached;
+
   SolidMechanicsLagrangianFEM();
 
 };
@@ -61,6 +61,32 @@ inline void velocityUpdate( arrayView2d< real64, nodes::ACCELERATION_USD > const
   } );
 }
 
+inline void velocityUpdate( arrayView2d< real64, nodes::ACCELERATION_USD > const & acceleration,
+                            arrayView2d< real64, nodes::VELOCITY_USD > const & velocity,
+                            real64 const dt,
+                            SortedArrayView< localIndex const > const & indices )
+{
+  GEOSX_MARK_FUNCTION;
+
+  forAll< parallelDevicePolicy<> >( indices.size(), [=] GEOSX_DEVICE ( localIndex const i )
+  {
+    localIndex const a = indices[ i ];
+    LvArray::tensorOps::scaledAdd< 3 >( velocity[ a ], acceleration[ a ], dt );
+    LvArray::tensorOps::fill< 3 >( acceleration[ a ], 0 );
+  } );
+}
+
+inline void accelerationReset( arrayView2d< real64, nodes::ACCELERATION_USD > const & acceleration,
+                               SortedArrayView< localIndex const > const & indices )
+{
+  GEOSX_MARK_FUNCTION;
+
+  forAll< parallelDevicePolicy<> >( indices.size(), [=] GEOSX_DEVICE ( localIndex const i )
+  {
+    LvArray::tensorOps::fill< 3 >( acceleration[ indices[ i ] ], 0 );
+  } );
+}
+
 inline void displacementUpdate( arrayView2d< real64 const, nodes::VELOCITY_USD > const & velocity,
                                 arrayView2d< real64, nodes::INCR_DISPLACEMENT_USD > const & uhat,
                                 arrayView2d< real64, nodes::TOTAL_DISPLACEMENT_USD > const & u,
@@ -89,7 +115,7 @@ struct ExplicitKernel
                              localIndex const numQuadraturePoints,
                              arrayView4d< real64 const > const & dNdX,
                              arrayView2d< real64 const > const & detJ,
-                             arrayView3d< real64 const, solid::STRESS_USD > const & stress,
+                             arrayView3d< solid::STATE_TYPE const, solid::STRESS_USD > const & stress,
                              R1Tensor & force )
   {
     GEOSX_MARK_FUNCTION;
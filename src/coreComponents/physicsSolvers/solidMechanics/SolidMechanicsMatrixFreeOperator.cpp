@@ -0,0 +1,148 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsMatrixFreeOperator.cpp
+ */
+
+#include "SolidMechanicsMatrixFreeOperator.hpp"
+#include "SolidMechanicsSmallStrainMatrixFreeKernel.hpp"
+#include "SolidMechanicsSmallStrainCachedStiffnessKernel.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "constitutive/solid/SolidBase.hpp"
+#include "linearAlgebra/DofManager.hpp"
+#include "managers/DomainPartition.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+SolidMechanicsMatrixFreeOperator::SolidMechanicsMatrixFreeOperator( DomainPartition & domain,
+                                                                    DofManager const & dofManager,
+                                                                    arrayView1d< string const > const & targetRegions,
+                                                                    string const & discretizationName,
+                                                                    arrayView1d< string const > const & solidMaterialNames,
+                                                                    string const & inputFieldName,
+                                                                    string const & outputFieldName,
+                                                                    string const & elementStiffnessName ):
+  LinearOperator< ParallelVector >(),
+  m_domain( domain ),
+  m_dofManager( dofManager ),
+  m_targetRegions( targetRegions ),
+  m_discretizationName( discretizationName ),
+  m_solidMaterialNames( solidMaterialNames ),
+  m_inputFieldName( inputFieldName ),
+  m_outputFieldName( outputFieldName ),
+  m_elementStiffnessName( elementStiffnessName ),
+  m_syncPlan(),
+  m_diagonal(),
+  m_constrainedRows()
+{
+  std::map< string, string_array > fieldNames;
+  fieldNames["node"].emplace_back( m_inputFieldName );
+
+  m_syncPlan = std::make_unique< SynchronizationPlan >( fieldNames,
+                                                        *domain.getMeshBody( 0 )->getMeshLevel( 0 ),
+                                                        domain.getNeighbors(),
+                                                        true );
+}
+
+void SolidMechanicsMatrixFreeOperator::setDiagonal( ParallelMatrix const & diagonalMatrix,
+                                                    arrayView1d< integer const > const & constrainedRows )
+{
+  GEOSX_ERROR_IF_NE( diagonalMatrix.numLocalRows(), constrainedRows.size() );
+
+  ParallelVector diagonal;
+  diagonal.createWithLocalSize( diagonalMatrix.numLocalRows(), diagonalMatrix.getComm() );
+  diagonalMatrix.extractDiagonal( diagonal );
+
+  m_diagonal.resize( diagonal.localSize() );
+  diagonal.extract( m_diagonal );
+  m_constrainedRows = constrainedRows;
+}
+
+void SolidMechanicsMatrixFreeOperator::apply( ParallelVector const & src, ParallelVector & dst ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshLevel & mesh = *m_domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  NodeManager & nodeManager = *mesh.getNodeManager();
+
+  // scatter the owned values of the input, then fetch the ghosts
+  m_dofManager.copyVectorToField( src, keys::TotalDisplacement, m_inputFieldName, 1.0 );
+  m_syncPlan->execute();
+
+  arrayView2d< real64 const > const input = nodeManager.getReference< array2d< real64 > >( m_inputFieldName );
+  arrayView2d< real64 > const output = nodeManager.getReference< array2d< real64 > >( m_outputFieldName );
+  output.setValues< parallelDevicePolicy<> >( 0.0 );
+
+  if( m_elementStiffnessName.empty() )
+  {
+    finiteElement::
+      regionBasedKernelApplication< parallelDevicePolicy< 32 >,
+                                    constitutive::SolidBase,
+                                    CellElementSubRegion,
+                                    SolidMechanicsLagrangianFEMKernels::QuasiStaticApply >( mesh,
+                                                                                            m_targetRegions,
+                                                                                            m_discretizationName,
+                                                                                            m_solidMaterialNames,
+                                                                                            input,
+                                                                                            output );
+  }
+  else
+  {
+    finiteElement::
+      regionBasedKernelApplication< parallelDevicePolicy< 32 >,
+                                    constitutive::SolidBase,
+                                    CellElementSubRegion,
+                                    SolidMechanicsLagrangianFEMKernels::QuasiStaticCachedApply >( mesh,
+                                                                                                  m_targetRegions,
+                                                                                                  m_discretizationName,
+                                                                                                  m_solidMaterialNames,
+                                                                                                  input,
+                                                                                                  output,
+                                                                                                  m_elementStiffnessName );
+  }
+
+  m_dofManager.copyFieldToVector( dst, m_outputFieldName, keys::TotalDisplacement, 1.0 );
+
+  // the constrained rows only keep their diagonal entry
+  arrayView1d< real64 const > const diagonal = m_diagonal;
+  arrayView1d< integer const > const constrainedRows = m_constrainedRows;
+  real64 const * const srcValues = src.extractLocalVector();
+  real64 * const dstValues = dst.extractLocalVector();
+
+  forAll< parallelHostPolicy >( dst.localSize(), [=]( localIndex const i )
+  {
+    if( constrainedRows[i] )
+    {
+      dstValues[i] = diagonal[i] * srcValues[i];
+    }
+  } );
+}
+
+globalIndex SolidMechanicsMatrixFreeOperator::numGlobalRows() const
+{
+  return m_dofManager.numGlobalDofs();
+}
+
+globalIndex SolidMechanicsMatrixFreeOperator::numGlobalCols() const
+{
+  return m_dofManager.numGlobalDofs();
+}
+
+} /* namespace geosx */
@@ -0,0 +1,121 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsMatrixFreeOperator.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
+#define GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_
+
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/interfaces/LinearOperator.hpp"
+#include "mpiCommunications/SynchronizationPlan.hpp"
+
+namespace geosx
+{
+
+class DofManager;
+class DomainPartition;
+
+/**
+ * @class SolidMechanicsMatrixFreeOperator
+ *
+ * Applies the quasi-static small strain stiffness of SolidMechanicsLagrangianFEM without assembling it.
+ *
+ * Each application scatters the input vector to a nodal work field, synchronizes its ghost values, computes the
+ * element contributions on the fly with the SolidMechanicsLagrangianFEMKernels::QuasiStaticApply kernel and
+ * gathers the owned values of the output work field. When the element stiffness matrices are cached by the solver,
+ * the SolidMechanicsLagrangianFEMKernels::QuasiStaticCachedApply kernel multiplies them instead. The rows constrained by a Dirichlet boundary condition
+ * reduce to their diagonal entry, as in the assembled system.
+ */
+class SolidMechanicsMatrixFreeOperator : public LinearOperator< ParallelVector >
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param domain the domain the stiffness is computed on
+   * @param dofManager the DofManager of the displacement field
+   * @param targetRegions the regions the stiffness is computed on
+   * @param discretizationName the name of the finite element discretization
+   * @param solidMaterialNames the names of the solid models of the @p targetRegions
+   * @param inputFieldName the name of the nodal work field the input vector is scattered to
+   * @param outputFieldName the name of the nodal work field the output vector is gathered from
+   * @param elementStiffnessName the name of the element stiffness cache, empty to compute the element contributions
+   */
+  SolidMechanicsMatrixFreeOperator( DomainPartition & domain,
+                                    DofManager const & dofManager,
+                                    arrayView1d< string const > const & targetRegions,
+                                    string const & discretizationName,
+                                    arrayView1d< string const > const & solidMaterialNames,
+                                    string const & inputFieldName,
+                                    string const & outputFieldName,
+                                    string const & elementStiffnessName );
+
+  virtual ~SolidMechanicsMatrixFreeOperator() override = default;
+
+  /**
+   * @brief Set the diagonal of the operator and the rows constrained by a Dirichlet boundary condition.
+   * @param diagonalMatrix a matrix holding the diagonal of the operator, with the boundary conditions applied
+   * @param constrainedRows for each local row, whether it is constrained
+   */
+  void setDiagonal( ParallelMatrix const & diagonalMatrix,
+                    arrayView1d< integer const > const & constrainedRows );
+
+  virtual void apply( ParallelVector const & src, ParallelVector & dst ) const override;
+
+  virtual globalIndex numGlobalRows() const override;
+
+  virtual globalIndex numGlobalCols() const override;
+
+private:
+
+  /// The domain the stiffness is computed on
+  DomainPartition & m_domain;
+
+  /// The DofManager of the displacement field
+  DofManager const & m_dofManager;
+
+  /// The regions the stiffness is computed on
+  arrayView1d< string const > const m_targetRegions;
+
+  /// The name of the finite element discretization
+  string const m_discretizationName;
+
+  /// The names of the solid models
+  arrayView1d< string const > const m_solidMaterialNames;
+
+  /// The name of the nodal work field of the input
+  string const m_inputFieldName;
+
+  /// The name of the nodal work field of the output
+  string const m_outputFieldName;
+
+  /// The name of the element stiffness cache, empty if the element contributions are computed on the fly
+  string const m_elementStiffnessName;
+
+  /// Halo exchange of the input work field, reused by every application
+  std::unique_ptr< SynchronizationPlan > m_syncPlan;
+
+  /// The local values of the diagonal of the operator
+  array1d< real64 > m_diagonal;
+
+  /// For each local row, whether it is constrained by a Dirichlet boundary condition
+  arrayView1d< integer const > m_constrainedRows;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSMATRIXFREEOPERATOR_HPP_ */
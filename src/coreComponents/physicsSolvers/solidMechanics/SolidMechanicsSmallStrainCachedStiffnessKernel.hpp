@@ -0,0 +1,402 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsSmallStrainCachedStiffnessKernel.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINCACHEDSTIFFNESSKERNEL_HPP_
+#define GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINCACHEDSTIFFNESSKERNEL_HPP_
+
+#include "SolidMechanicsSmallStrainQuasiStaticKernel.hpp"
+
+namespace geosx
+{
+
+namespace SolidMechanicsLagrangianFEMKernels
+{
+
+/**
+ * @brief Implements the quasi-static assembly with a cache of the element
+ *   stiffness matrices.
+ * @copydoc geosx::SolidMechanicsLagrangianFEMKernels::QuasiStatic
+ *
+ * ### QuasiStaticCachedStiffness Description
+ * Same as QuasiStatic, for the linear elastic models only: their stiffness
+ * does not depend on the state, and the reference geometry of the small strain
+ * formulation does not change, so the element stiffness matrices are constant.
+ * They are integrated and stored in the cache the first time, then read back
+ * from it, which leaves the residual as the only quadrature work.
+ * The assembly into the global matrix can be restricted to the diagonal, for
+ * the matrix-free solves.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class QuasiStaticCachedStiffness : public QuasiStatic< SUBREGION_TYPE,
+                                                       CONSTITUTIVE_TYPE,
+                                                       FE_TYPE >
+{
+public:
+  /// Alias for the base class;
+  using Base = QuasiStatic< SUBREGION_TYPE,
+                            CONSTITUTIVE_TYPE,
+                            FE_TYPE >;
+
+  using Base::numNodesPerElem;
+  using Base::numDofPerTestSupportPoint;
+  using Base::numDofPerTrialSupportPoint;
+  using Base::m_dofRankOffset;
+  using Base::m_matrix;
+  using Base::m_rhs;
+  using Base::m_constitutiveUpdate;
+  using Base::m_finiteElementSpace;
+  using Base::m_gravityVector;
+  using Base::m_density;
+
+  /// The number of degrees of freedom of an element.
+  static constexpr int numDofPerElem = numNodesPerElem * numDofPerTestSupportPoint;
+
+  /**
+   * @brief Constructor
+   * @copydoc geosx::SolidMechanicsLagrangianFEMKernels::QuasiStatic::QuasiStatic
+   * @param elementStiffnessName The name of the element stiffness cache of the subregion.
+   * @param reuseElementStiffness Flag to read the element stiffness from the cache
+   *   instead of integrating and storing it.
+   * @param diagonalOnly Flag to only assemble the diagonal of the element stiffness.
+   */
+  QuasiStaticCachedStiffness( NodeManager const & nodeManager,
+                              EdgeManager const & edgeManager,
+                              FaceManager const & faceManager,
+                              SUBREGION_TYPE const & elementSubRegion,
+                              FE_TYPE const & finiteElementSpace,
+                              CONSTITUTIVE_TYPE * const inputConstitutiveType,
+                              arrayView1d< globalIndex const > const & inputDofNumber,
+                              globalIndex const rankOffset,
+                              CRSMatrixView< real64, globalIndex const > const & inputMatrix,
+                              arrayView1d< real64 > const & inputRhs,
+                              real64 const (&inputGravityVector)[3],
+                              string const & elementStiffnessName,
+                              integer const reuseElementStiffness,
+                              integer const diagonalOnly ):
+    Base( nodeManager,
+          edgeManager,
+          faceManager,
+          elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType,
+          inputDofNumber,
+          rankOffset,
+          inputMatrix,
+          inputRhs,
+          inputGravityVector ),
+    m_elementStiffness( elementSubRegion.template getReference< array3d< real64 > >( elementStiffnessName ).toView() ),
+    m_reuseElementStiffness( reuseElementStiffness ),
+    m_diagonalOnly( diagonalOnly )
+  {
+    GEOSX_ERROR_IF( m_elementStiffness.size( 1 ) != numDofPerElem || m_elementStiffness.size( 2 ) != numDofPerElem,
+                    "The element stiffness cache " << elementStiffnessName << " of " << elementSubRegion.getName() <<
+                    " is not sized for the elements of the discretization" );
+  }
+
+  /**
+   * @copydoc geosx::SolidMechanicsLagrangianFEMKernels::QuasiStatic::quadraturePointKernel
+   *
+   * The element stiffness is only integrated when it is not read from the cache.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              typename Base::StackVariables & stack ) const
+  {
+    real64 dNdX[ numNodesPerElem ][ 3 ];
+    real64 const detJ = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, dNdX );
+
+    real64 strainInc[6] = {0};
+    FE_TYPE::symmetricGradient( dNdX, stack.uhat_local, strainInc );
+
+    m_constitutiveUpdate.SmallStrain( k, q, strainInc );
+
+    if( !m_reuseElementStiffness )
+    {
+      typename CONSTITUTIVE_TYPE::KernelWrapper::DiscretizationOps stiffnessHelper;
+      m_constitutiveUpdate.setDiscretizationOps( k, q, stiffnessHelper );
+
+      stiffnessHelper.template upperBTDB< numNodesPerElem >( dNdX, -detJ, stack.localJacobian );
+    }
+
+    real64 stress[6];
+    m_constitutiveUpdate.getStress( k, q, stress );
+
+    real64 const gravityForce[3] = { m_gravityVector[0] * m_density( k, q )* detJ,
+                                     m_gravityVector[1] * m_density( k, q )* detJ,
+                                     m_gravityVector[2] * m_density( k, q )* detJ };
+
+    for( localIndex i=0; i<6; ++i )
+    {
+      stress[i] *= -detJ;
+    }
+
+    real64 N[numNodesPerElem];
+    FE_TYPE::calcN( q, N );
+    FE_TYPE::plus_gradNajAij_plus_NaFi( dNdX,
+                                        stress,
+                                        N,
+                                        gravityForce,
+                                        reinterpret_cast< real64 (&)[numNodesPerElem][3] >(stack.localResidual) );
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::ImplicitKernelBase::complete
+   *
+   * The integrated element stiffness is stored in the cache, and the cached one
+   * is assembled.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   typename Base::StackVariables & stack ) const
+  {
+    real64 maxForce = 0;
+
+    if( !m_reuseElementStiffness )
+    {
+      CONSTITUTIVE_TYPE::KernelWrapper::DiscretizationOps::template fillLowerBTDB< numNodesPerElem >( stack.localJacobian );
+      for( int i = 0; i < numDofPerElem; ++i )
+      {
+        for( int j = 0; j < numDofPerElem; ++j )
+        {
+          m_elementStiffness( k, i, j ) = stack.localJacobian[ i ][ j ];
+        }
+      }
+    }
+
+    for( int i = 0; i < numDofPerElem; ++i )
+    {
+      localIndex const dof = LvArray::integerConversion< localIndex >( stack.localRowDofIndex[ i ] - m_dofRankOffset );
+      if( dof < 0 || dof >= m_matrix.numRows() ) continue;
+
+      if( m_diagonalOnly )
+      {
+        m_matrix.template addToRow< parallelDeviceAtomic >( dof, &stack.localRowDofIndex[ i ], &m_elementStiffness( k, i, i ), 1 );
+      }
+      else
+      {
+        m_matrix.template addToRowBinarySearchUnsorted< parallelDeviceAtomic >( dof,
+                                                                                stack.localRowDofIndex,
+                                                                                &m_elementStiffness( k, i, 0 ),
+                                                                                numNodesPerElem * numDofPerTrialSupportPoint );
+      }
+
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], stack.localResidual[ i ] );
+      maxForce = fmax( maxForce, fabs( stack.localResidual[ i ] ) );
+    }
+
+    return maxForce;
+  }
+
+protected:
+  /// The element stiffness cache.
+  arrayView3d< real64 > const m_elementStiffness;
+
+  /// Flag to read the element stiffness from the cache.
+  integer const m_reuseElementStiffness;
+
+  /// Flag to only assemble the diagonal of the element stiffness.
+  integer const m_diagonalOnly;
+};
+
+/**
+ * @brief Implements the application of the cached element stiffness matrices
+ *   to a nodal field.
+ * @copydoc geosx::finiteElement::KernelBase
+ *
+ * ### QuasiStaticCachedApply Description
+ * Computes the same product as QuasiStaticApply, from the element stiffness
+ * matrices stored by QuasiStaticCachedStiffness: the input field is gathered
+ * to the element, multiplied by its stiffness and scattered to the output
+ * field. There is no quadrature, so the product is limited by the streaming
+ * of the cache.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class QuasiStaticCachedApply :
+  public finiteElement::KernelBase< SUBREGION_TYPE,
+                                    CONSTITUTIVE_TYPE,
+                                    FE_TYPE,
+                                    3,
+                                    3 >
+{
+public:
+  /// Alias for the base class;
+  using Base = finiteElement::KernelBase< SUBREGION_TYPE,
+                                          CONSTITUTIVE_TYPE,
+                                          FE_TYPE,
+                                          3,
+                                          3 >;
+
+  /// Number of nodes per element.
+  static constexpr int numNodesPerElem = Base::numTestSupportPointsPerElem;
+
+  /// The number of degrees of freedom of an element.
+  static constexpr int numDofPerElem = numNodesPerElem * 3;
+
+  /// The cached element stiffness is applied without quadrature.
+  static constexpr int numQuadraturePointsPerElem = 1;
+
+  using Base::m_elemsToNodes;
+
+  /**
+   * @brief Constructor
+   * @copydoc geosx::finiteElement::KernelBase::KernelBase
+   * @param nodeManager Reference to the NodeManager object.
+   * @param edgeManager Reference to the EdgeManager object.
+   * @param faceManager Reference to the FaceManager object.
+   * @param inputField The nodal field the operator is applied to.
+   * @param outputField The nodal field the result is added to.
+   * @param elementStiffnessName The name of the element stiffness cache of the subregion.
+   */
+  QuasiStaticCachedApply( NodeManager const & nodeManager,
+                          EdgeManager const & edgeManager,
+                          FaceManager const & faceManager,
+                          SUBREGION_TYPE const & elementSubRegion,
+                          FE_TYPE const & finiteElementSpace,
+                          CONSTITUTIVE_TYPE * const inputConstitutiveType,
+                          arrayView2d< real64 const > const & inputField,
+                          arrayView2d< real64 > const & outputField,
+                          string const & elementStiffnessName ):
+    Base( elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType ),
+    m_input( inputField ),
+    m_output( outputField ),
+    m_elementStiffness( elementSubRegion.template getReference< array3d< real64 > >( elementStiffnessName ).toViewConst() )
+  {
+    GEOSX_UNUSED_VAR( nodeManager );
+    GEOSX_UNUSED_VAR( edgeManager );
+    GEOSX_UNUSED_VAR( faceManager );
+    GEOSX_ERROR_IF( m_elementStiffness.size( 1 ) != numDofPerElem || m_elementStiffness.size( 2 ) != numDofPerElem,
+                    "The element stiffness cache " << elementStiffnessName << " of " << elementSubRegion.getName() <<
+                    " is not sized for the elements of the discretization" );
+  }
+
+  //*****************************************************************************
+  /**
+   * @class StackVariables
+   * @copydoc geosx::finiteElement::KernelBase::StackVariables
+   *
+   * Adds stack arrays for the element local input and output fields.
+   */
+  struct StackVariables : public Base::StackVariables
+  {
+public:
+
+    /// Constructor.
+    GEOSX_HOST_DEVICE
+    StackVariables():
+      Base::StackVariables(),
+            inputLocal(),
+            outputLocal{ 0.0 }
+    {}
+
+    /// Stack storage for the element local input field.
+    real64 inputLocal[ numDofPerElem ];
+
+    /// Stack storage for the element local output field.
+    real64 outputLocal[ numDofPerElem ];
+  };
+  //*****************************************************************************
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::setup
+   *
+   * The input field is gathered into element local stack storage.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void setup( localIndex const k,
+              StackVariables & stack ) const
+  {
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      localIndex const localNodeIndex = m_elemsToNodes( k, a );
+      for( int i=0; i<3; ++i )
+      {
+        stack.inputLocal[ a*3+i ] = m_input[ localNodeIndex ][ i ];
+      }
+    }
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::quadraturePointKernel
+   *
+   * Multiplies the input by the cached element stiffness.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    GEOSX_UNUSED_VAR( q );
+    for( int i=0; i<numDofPerElem; ++i )
+    {
+      real64 value = 0;
+      for( int j=0; j<numDofPerElem; ++j )
+      {
+        value += m_elementStiffness( k, i, j ) * stack.inputLocal[ j ];
+      }
+      stack.outputLocal[ i ] += value;
+    }
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::complete
+   *
+   * The element contribution is scattered to the output field.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      localIndex const localNodeIndex = m_elemsToNodes( k, a );
+      for( int i=0; i<3; ++i )
+      {
+        RAJA::atomicAdd< parallelDeviceAtomic >( &m_output[ localNodeIndex ][ i ], stack.outputLocal[ a*3+i ] );
+      }
+    }
+    return 0;
+  }
+
+protected:
+  /// The nodal field the operator is applied to.
+  arrayView2d< real64 const > const m_input;
+
+  /// The nodal field the result is added to.
+  arrayView2d< real64 > const m_output;
+
+  /// The element stiffness cache.
+  arrayView3d< real64 const > const m_elementStiffness;
+};
+
+} // namespace SolidMechanicsLagrangianFEMKernels
+
+} // namespace geosx
+
+#endif // GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINCACHEDSTIFFNESSKERNEL_HPP_
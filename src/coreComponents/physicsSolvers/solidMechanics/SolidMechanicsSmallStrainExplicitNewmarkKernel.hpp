@@ -20,6 +20,7 @@
 #define GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINEXPLICITNEWMARK_HPP_
 
 #include "finiteElement/kernelInterface/KernelBase.hpp"
+#include "mesh/CellElementSubRegion.hpp"
 
 
 namespace geosx
@@ -29,6 +30,27 @@ namespace geosx
 namespace SolidMechanicsLagrangianFEMKernels
 {
 
+/**
+ * @brief Name of the color-sorted copy of an element list.
+ * @param elementListName The name of the element list.
+ * @return The name of the entry holding the elements of the list grouped by color.
+ */
+inline string coloredElementListName( string const & elementListName )
+{
+  return elementListName + "ByColor";
+}
+
+/**
+ * @brief Name of the color offsets of an element list.
+ * @param elementListName The name of the element list.
+ * @return The name of the entry holding the offset of each color in the color-sorted list,
+ *   which is empty when the nodal forces are assembled with atomics.
+ */
+inline string elementListColorOffsetsName( string const & elementListName )
+{
+  return elementListName + "ColorOffsets";
+}
+
 /// If UPDATE_STRESS is undef, uses total displacement and stress is not
 /// updated at all.
 /// If UPDATE_STRESS 1, uses total displacement to and adds material stress
@@ -83,6 +105,10 @@ public:
   using Base::m_elemGhostRank;
   using Base::m_constitutiveUpdate;
   using Base::m_finiteElementSpace;
+  using Base::calcShapeGradientsInKernel;
+
+  /// The elements are processed from the element list, possibly color by color.
+  static constexpr bool fusibleLaunch = false;
 
 //*****************************************************************************
   /**
@@ -93,7 +119,10 @@ public:
    * @param faceManager Reference to the FaceManager object.
    * @param dt The time interval for the step.
    * @param elementListName The name of the entry that holds the list of
-   *   elements to be processed during this kernel launch.
+   *   elements to be processed during this kernel launch. If its color
+   *   offsets (see elementListColorOffsetsName()) are not empty, the elements
+   *   are processed color by color and the nodal forces are assembled without
+   *   atomics.
    */
   ExplicitSmallStrain( NodeManager & nodeManager,
                        EdgeManager const & edgeManager,
@@ -111,7 +140,9 @@ public:
     m_vel( nodeManager.velocity()),
     m_acc( nodeManager.acceleration() ),
     m_dt( dt ),
-    m_elementList( elementSubRegion.template getReference< SortedArray< localIndex > >( elementListName ).toViewConst() )
+    m_elementList( elementSubRegion.template getReference< SortedArray< localIndex > >( elementListName ).toViewConst() ),
+    m_coloredElementList( elementSubRegion.template getReference< array1d< localIndex > >( coloredElementListName( elementListName ) ).toViewConst() ),
+    m_colorOffsets( elementSubRegion.template getReference< array1d< localIndex > >( elementListColorOffsetsName( elementListName ) ).toViewConst() )
   {
     GEOSX_UNUSED_VAR( edgeManager );
     GEOSX_UNUSED_VAR( faceManager );
@@ -130,8 +161,7 @@ public:
     GEOSX_HOST_DEVICE
     StackVariables():
       fLocal{ { 0.0} },
-      varLocal{ {0.0} },
-      xLocal()
+      varLocal{ {0.0} }
     {}
 
     /// C-array stack storage for the element local force
@@ -140,13 +170,9 @@ public:
     /// C-array stack storage for element local primary variable values.
     real64 varLocal[ numNodesPerElem ][ numDofPerTestSupportPoint ];
 
-#if !defined(CALC_FEM_SHAPE_IN_KERNEL)
-    /// Dummy
-    int xLocal;
-#else
-    /// C-array stack storage for element local the nodal positions.
+    /// C-array stack storage for element local the nodal positions, only gathered when
+    /// the shape function gradients are computed in the kernel.
     real64 xLocal[ numNodesPerElem ][ 3 ];
-#endif
   };
   //***************************************************************************
 
@@ -166,9 +192,10 @@ public:
       localIndex const nodeIndex = m_elemsToNodes( k, a );
       for( int i=0; i<numDofPerTrialSupportPoint; ++i )
       {
-#if defined(CALC_FEM_SHAPE_IN_KERNEL)
-        stack.xLocal[ a ][ i ] = m_X[ nodeIndex ][ i ];
-#endif
+        if( calcShapeGradientsInKernel )
+        {
+          stack.xLocal[ a ][ i ] = m_X[ nodeIndex ][ i ];
+        }
 
 #if UPDATE_STRESS==2
         stack.varLocal[ a ][ i ] = m_vel[ nodeIndex ][ i ] * m_dt;
@@ -186,7 +213,9 @@ public:
    * Calculates the shape function derivatives, and the strain tensor. Then
    * calls the constitutive update, and also performs the integration of
    * the stress divergence, rather than using the dedicated component function
-   * to allow for some variable reuse.
+   * to allow for some variable reuse. The updated stress returned by the
+   * constitutive update stays on the stack for the integration, the stress
+   * state array is only read and written once by the update.
    */
   GEOSX_HOST_DEVICE
   GEOSX_FORCE_INLINE
@@ -204,7 +233,7 @@ public:
 
     real64 stressLocal[ 6 ] = {0};
 #if UPDATE_STRESS == 2
-    m_constitutiveUpdate.SmallStrain( k, q, strain );
+    m_constitutiveUpdate.SmallStrain( k, q, strain, stressLocal );
 #else
     m_constitutiveUpdate.SmallStrainNoState( k, strain, stressLocal );
 #endif
@@ -212,7 +241,7 @@ public:
     for( localIndex c = 0; c < 6; ++c )
     {
 #if UPDATE_STRESS == 2
-      stressLocal[ c ] =  -m_constitutiveUpdate.m_stress( k, q, c ) * detJ;
+      stressLocal[ c ] *= -detJ;
 #elif UPDATE_STRESS == 1
       stressLocal[ c ] = -( stressLocal[ c ] + m_constitutiveUpdate.m_stress( k, q, c ) ) * detJ;
 #else
@@ -231,7 +260,7 @@ public:
 
     real64 stressLocal[ 6 ] = {0};
 #if UPDATE_STRESS == 2
-    m_constitutiveUpdate.SmallStrain( k, q, strain );
+    m_constitutiveUpdate.SmallStrain( k, q, strain, stressLocal );
 #else
     m_constitutiveUpdate.SmallStrainNoState( k, strain, stressLocal );
 #endif
@@ -239,7 +268,7 @@ public:
     for( localIndex c = 0; c < 6; ++c )
     {
 #if UPDATE_STRESS == 2
-      stressLocal[ c ] =  m_constitutiveUpdate.m_stress( k, q, c ) * detJ;
+      stressLocal[ c ] *= detJ;
 #elif UPDATE_STRESS == 1
       stressLocal[ c ] = ( stressLocal[ c ] + m_constitutiveUpdate.m_stress( k, q, c ) ) * DETJ;
 #else
@@ -255,19 +284,28 @@ public:
    * @copydoc geosx::finiteElement::KernelBase::complete
    *
    * ### ExplicitSmallStrain Description
-   * Performs the distribution of the nodal force out to the rank local arrays.
+   * Performs the distribution of the nodal force out to the rank local arrays,
+   * with plain additions when the elements are processed color by color.
    */
   GEOSX_HOST_DEVICE
   GEOSX_FORCE_INLINE
   real64 complete( localIndex const k,
                    StackVariables const & stack ) const
   {
+    bool const colored = !m_colorOffsets.empty();
     for( localIndex a = 0; a < numNodesPerElem; ++a )
     {
       localIndex const nodeIndex = m_elemsToNodes( k, a );
       for( int b = 0; b < numDofPerTestSupportPoint; ++b )
       {
-        RAJA::atomicAdd< parallelDeviceAtomic >( &m_acc( nodeIndex, b ), stack.fLocal[ a ][ b ] );
+        if( colored )
+        {
+          m_acc( nodeIndex, b ) += stack.fLocal[ a ][ b ];
+        }
+        else
+        {
+          RAJA::atomicAdd< parallelDeviceAtomic >( &m_acc( nodeIndex, b ), stack.fLocal[ a ][ b ] );
+        }
       }
     }
     return 0;
@@ -277,36 +315,16 @@ public:
    * @copydoc geosx::finiteElement::KernelBase::kernelLaunch
    *
    * ### ExplicitSmallStrain Description
-   * Copy of the KernelBase::kernelLaunch function without the exclusion of ghost
-   * elements.
+   * Same as the KernelBase::kernelLaunch function, on the elements of the element list.
+   * When the list is colored, one launch is made per color: the elements of a
+   * color do not share nodes, and the nodal forces are summed in the same order
+   * from run to run.
    */
   template< typename POLICY,
             typename KERNEL_TYPE >
   static real64
   kernelLaunch( localIndex const numElems,
-                KERNEL_TYPE const & kernelComponent )
-  {
-    GEOSX_MARK_FUNCTION;
-
-    GEOSX_UNUSED_VAR( numElems );
-
-    localIndex const numProcElems = kernelComponent.m_elementList.size();
-    forAll< POLICY >( numProcElems,
-                      [=] GEOSX_DEVICE ( localIndex const index )
-    {
-      localIndex const k = kernelComponent.m_elementList[ index ];
-
-      typename KERNEL_TYPE::StackVariables stack;
-
-      kernelComponent.setup( k, stack );
-      for( integer q=0; q<KERNEL_TYPE::numQuadraturePointsPerElem; ++q )
-      {
-        kernelComponent.quadraturePointKernel( k, q, stack );
-      }
-      kernelComponent.complete( k, stack );
-    } );
-    return 0;
-  }
+                KERNEL_TYPE const & kernelComponent );
 
 
 protected:
@@ -329,10 +347,107 @@ protected:
   /// The list of elements to process for the kernel launch.
   SortedArrayView< localIndex const > const m_elementList;
 
+  /// The elements of the element list grouped by color.
+  arrayView1d< localIndex const > const m_coloredElementList;
+
+  /// The offset of each color in m_coloredElementList, empty if the nodal
+  /// forces are assembled with atomics.
+  arrayView1d< localIndex const > const m_colorOffsets;
+
 
 };
 #undef UPDATE_STRESS
 
+// Defined out of the class so that it is not implicitly inline, and the explicit
+// instantiation declarations below keep the including units from instantiating it.
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+template< typename POLICY,
+          typename KERNEL_TYPE >
+real64
+ExplicitSmallStrain< SUBREGION_TYPE, CONSTITUTIVE_TYPE, FE_TYPE >::kernelLaunch( localIndex const numElems,
+                                                                                 KERNEL_TYPE const & kernelComponent )
+{
+  GEOSX_MARK_FUNCTION;
+
+  GEOSX_UNUSED_VAR( numElems );
+
+  arrayView1d< localIndex const > const colorOffsets = kernelComponent.m_colorOffsets;
+  if( colorOffsets.empty() )
+  {
+    SortedArrayView< localIndex const > const elementList = kernelComponent.m_elementList;
+    return finiteElement::launchElementLoop< POLICY >( elementList.size(),
+                                                       kernelComponent,
+                                                       [elementList] GEOSX_HOST_DEVICE ( localIndex const index )
+    {
+      return elementList[ index ];
+    } );
+  }
+
+  real64 maxResidual = 0;
+  arrayView1d< localIndex const > const coloredElementList = kernelComponent.m_coloredElementList;
+  for( localIndex color = 0; color < colorOffsets.size() - 1; ++color )
+  {
+    localIndex const colorOffset = colorOffsets[ color ];
+    real64 const colorResidual =
+      finiteElement::launchElementLoop< POLICY >( colorOffsets[ color + 1 ] - colorOffset,
+                                                  kernelComponent,
+                                                  [coloredElementList, colorOffset] GEOSX_HOST_DEVICE ( localIndex const index )
+    {
+      return coloredElementList[ colorOffset + index ];
+    } );
+    maxResidual = std::max( maxResidual, colorResidual );
+  }
+  return maxResidual;
+}
+
+/**
+ * @brief Declare or define the instantiation of ExplicitSmallStrain::kernelLaunch for one policy.
+ * @param PREFIX empty to define the instantiation, extern to declare it
+ * @param CONSTITUTIVE_TYPE the constitutive model of the kernel
+ * @param FE_TYPE the formulation of the kernel
+ * @param POLICY the launch policy
+ */
+#define GEOSX_EXPLICIT_SMALL_STRAIN_LAUNCH( PREFIX, CONSTITUTIVE_TYPE, FE_TYPE, POLICY ) \
+  PREFIX template real64 \
+  ExplicitSmallStrain< CellElementSubRegion, CONSTITUTIVE_TYPE, FE_TYPE >:: \
+  kernelLaunch< POLICY, ExplicitSmallStrain< CellElementSubRegion, CONSTITUTIVE_TYPE, FE_TYPE > > \
+    ( localIndex const, ExplicitSmallStrain< CellElementSubRegion, CONSTITUTIVE_TYPE, FE_TYPE > const & );
+
+/**
+ * @brief Declare or define the instantiations of ExplicitSmallStrain::kernelLaunch for the
+ *   policies a launch may take, the candidates of the LaunchTuner on the device.
+ * @param PREFIX empty to define the instantiations, extern to declare them
+ * @param CONSTITUTIVE_TYPE the constitutive model of the kernel
+ * @param FE_TYPE the formulation of the kernel
+ */
+#if defined( GEOSX_USE_DEVICE )
+#define GEOSX_EXPLICIT_SMALL_STRAIN_LAUNCHES( PREFIX, CONSTITUTIVE_TYPE, FE_TYPE ) \
+  GEOSX_EXPLICIT_SMALL_STRAIN_LAUNCH( PREFIX, CONSTITUTIVE_TYPE, FE_TYPE, parallelDevicePolicy< LaunchTuner::candidateBlockSize( 0 ) > ) \
+  GEOSX_EXPLICIT_SMALL_STRAIN_LAUNCH( PREFIX, CONSTITUTIVE_TYPE, FE_TYPE, parallelDevicePolicy< LaunchTuner::candidateBlockSize( 1 ) > ) \
+  GEOSX_EXPLICIT_SMALL_STRAIN_LAUNCH( PREFIX, CONSTITUTIVE_TYPE, FE_TYPE, parallelDevicePolicy< LaunchTuner::candidateBlockSize( 2 ) > ) \
+  GEOSX_EXPLICIT_SMALL_STRAIN_LAUNCH( PREFIX, CONSTITUTIVE_TYPE, FE_TYPE, parallelDevicePolicy< LaunchTuner::candidateBlockSize( 3 ) > )
+#else
+#define GEOSX_EXPLICIT_SMALL_STRAIN_LAUNCHES( PREFIX, CONSTITUTIVE_TYPE, FE_TYPE ) \
+  GEOSX_EXPLICIT_SMALL_STRAIN_LAUNCH( PREFIX, CONSTITUTIVE_TYPE, FE_TYPE, parallelHostPolicy )
+#endif
+
+/// Declare the instantiations of a model and a formulation.
+#define GEOSX_EXPLICIT_SMALL_STRAIN_EXTERN( CONSTITUTIVE_TYPE, FE_TYPE ) \
+  GEOSX_EXPLICIT_SMALL_STRAIN_LAUNCHES( extern, CONSTITUTIVE_TYPE, FE_TYPE )
+
+/// Declare the instantiations of a model and every formulation.
+#define GEOSX_EXPLICIT_SMALL_STRAIN_EXTERN_MODEL( CONSTITUTIVE_TYPE ) \
+  GEOSX_FOR_EACH_FE_3D_TYPE( GEOSX_EXPLICIT_SMALL_STRAIN_EXTERN, CONSTITUTIVE_TYPE )
+
+// The launches of each model and formulation of the dispatch lists are compiled in their own
+// unit, generated from SolidMechanicsSmallStrainExplicitNewmarkKernel.cpp.in.
+GEOSX_FOR_EACH_SOLID_TYPE( GEOSX_EXPLICIT_SMALL_STRAIN_EXTERN_MODEL )
+
+#undef GEOSX_EXPLICIT_SMALL_STRAIN_EXTERN_MODEL
+#undef GEOSX_EXPLICIT_SMALL_STRAIN_EXTERN
+
 } // namespace SolidMechanicsLagrangianFEMKernels
 
 } // namespace geosx
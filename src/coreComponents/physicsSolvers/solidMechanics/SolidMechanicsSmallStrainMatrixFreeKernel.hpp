@@ -0,0 +1,347 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SolidMechanicsSmallStrainMatrixFreeKernel.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINMATRIXFREEKERNEL_HPP_
+#define GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINMATRIXFREEKERNEL_HPP_
+
+#include "SolidMechanicsSmallStrainQuasiStaticKernel.hpp"
+
+namespace geosx
+{
+
+namespace SolidMechanicsLagrangianFEMKernels
+{
+
+/**
+ * @brief Implements the residual and diagonal assembly of the quasi-static
+ *   equilibrium for the matrix-free solves.
+ * @copydoc geosx::SolidMechanicsLagrangianFEMKernels::QuasiStatic
+ *
+ * ### QuasiStaticDiagonal Description
+ * Same as QuasiStatic, except that only the diagonal of the element stiffness
+ * is computed. The global matrix is expected to hold a single nonzero per row,
+ * on the diagonal.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class QuasiStaticDiagonal : public QuasiStatic< SUBREGION_TYPE,
+                                                CONSTITUTIVE_TYPE,
+                                                FE_TYPE >
+{
+public:
+  /// Alias for the base class;
+  using Base = QuasiStatic< SUBREGION_TYPE,
+                            CONSTITUTIVE_TYPE,
+                            FE_TYPE >;
+
+  using Base::numNodesPerElem;
+  using Base::numDofPerTestSupportPoint;
+  using Base::m_dofRankOffset;
+  using Base::m_matrix;
+  using Base::m_rhs;
+  using Base::m_constitutiveUpdate;
+  using Base::m_finiteElementSpace;
+  using Base::m_gravityVector;
+  using Base::m_density;
+
+  /**
+   * @copydoc geosx::SolidMechanicsLagrangianFEMKernels::QuasiStatic::QuasiStatic
+   */
+  using Base::Base;
+
+  //*****************************************************************************
+  /**
+   * @class StackVariables
+   * @copydoc geosx::SolidMechanicsLagrangianFEMKernels::QuasiStatic::StackVariables
+   *
+   * Adds a stack array for the diagonal of the element stiffness.
+   */
+  struct StackVariables : public Base::StackVariables
+  {
+public:
+
+    /// Constructor.
+    GEOSX_HOST_DEVICE
+    StackVariables():
+      Base::StackVariables(),
+            localDiagonal{ 0.0 }
+    {}
+
+    /// Stack storage for the diagonal of the element stiffness.
+    real64 localDiagonal[ numNodesPerElem * 3 ];
+  };
+  //*****************************************************************************
+
+  /**
+   * @copydoc geosx::SolidMechanicsLagrangianFEMKernels::QuasiStatic::quadraturePointKernel
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    real64 dNdX[ numNodesPerElem ][ 3 ];
+    real64 const detJ = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, dNdX );
+
+    real64 strainInc[6] = {0};
+    FE_TYPE::symmetricGradient( dNdX, stack.uhat_local, strainInc );
+
+    m_constitutiveUpdate.SmallStrain( k, q, strainInc );
+
+    typename CONSTITUTIVE_TYPE::KernelWrapper::DiscretizationOps stiffnessHelper;
+    m_constitutiveUpdate.setDiscretizationOps( k, q, stiffnessHelper );
+
+    stiffnessHelper.template diagBTDB< numNodesPerElem >( dNdX, -detJ, stack.localDiagonal );
+
+    real64 stress[6];
+    m_constitutiveUpdate.getStress( k, q, stress );
+
+    real64 const gravityForce[3] = { m_gravityVector[0] * m_density( k, q )* detJ,
+                                     m_gravityVector[1] * m_density( k, q )* detJ,
+                                     m_gravityVector[2] * m_density( k, q )* detJ };
+
+    for( localIndex i=0; i<6; ++i )
+    {
+      stress[i] *= -detJ;
+    }
+
+    real64 N[numNodesPerElem];
+    FE_TYPE::calcN( q, N );
+    FE_TYPE::plus_gradNajAij_plus_NaFi( dNdX,
+                                        stress,
+                                        N,
+                                        gravityForce,
+                                        reinterpret_cast< real64 (&)[numNodesPerElem][3] >(stack.localResidual) );
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::ImplicitKernelBase::complete
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    GEOSX_UNUSED_VAR( k );
+    real64 maxForce = 0;
+
+    for( int i = 0; i < numNodesPerElem * numDofPerTestSupportPoint; ++i )
+    {
+      globalIndex const globalDof = stack.localRowDofIndex[ i ];
+      localIndex const dof = LvArray::integerConversion< localIndex >( globalDof - m_dofRankOffset );
+      if( dof < 0 || dof >= m_matrix.numRows() ) continue;
+      m_matrix.template addToRow< parallelDeviceAtomic >( dof, &globalDof, &stack.localDiagonal[ i ], 1 );
+
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_rhs[ dof ], stack.localResidual[ i ] );
+      maxForce = fmax( maxForce, fabs( stack.localResidual[ i ] ) );
+    }
+
+    return maxForce;
+  }
+};
+
+/**
+ * @brief Implements the matrix-free application of the quasi-static stiffness
+ *   to a nodal field.
+ * @copydoc geosx::finiteElement::KernelBase
+ *
+ * ### QuasiStaticApply Description
+ * Computes the action of the same operator as the one assembled by
+ * QuasiStatic, without forming it: the strain of the input field is computed
+ * at each quadrature point, mapped to a stress through the constitutive
+ * stiffness, and its divergence is accumulated in the output field. The
+ * constitutive state is not updated.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class QuasiStaticApply :
+  public finiteElement::KernelBase< SUBREGION_TYPE,
+                                    CONSTITUTIVE_TYPE,
+                                    FE_TYPE,
+                                    3,
+                                    3 >
+{
+public:
+  /// Alias for the base class;
+  using Base = finiteElement::KernelBase< SUBREGION_TYPE,
+                                          CONSTITUTIVE_TYPE,
+                                          FE_TYPE,
+                                          3,
+                                          3 >;
+
+  /// Number of nodes per element.
+  static constexpr int numNodesPerElem = Base::numTestSupportPointsPerElem;
+  using Base::m_elemsToNodes;
+  using Base::m_constitutiveUpdate;
+  using Base::m_finiteElementSpace;
+  using Base::calcShapeGradientsInKernel;
+
+  /**
+   * @brief Constructor
+   * @copydoc geosx::finiteElement::KernelBase::KernelBase
+   * @param nodeManager Reference to the NodeManager object.
+   * @param edgeManager Reference to the EdgeManager object.
+   * @param faceManager Reference to the FaceManager object.
+   * @param inputField The nodal field the operator is applied to.
+   * @param outputField The nodal field the result is added to.
+   */
+  QuasiStaticApply( NodeManager const & nodeManager,
+                    EdgeManager const & edgeManager,
+                    FaceManager const & faceManager,
+                    SUBREGION_TYPE const & elementSubRegion,
+                    FE_TYPE const & finiteElementSpace,
+                    CONSTITUTIVE_TYPE * const inputConstitutiveType,
+                    arrayView2d< real64 const > const & inputField,
+                    arrayView2d< real64 > const & outputField ):
+    Base( elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType ),
+    m_X( nodeManager.referencePosition()),
+    m_input( inputField ),
+    m_output( outputField )
+  {
+    GEOSX_UNUSED_VAR( edgeManager );
+    GEOSX_UNUSED_VAR( faceManager );
+  }
+
+  //*****************************************************************************
+  /**
+   * @class StackVariables
+   * @copydoc geosx::finiteElement::KernelBase::StackVariables
+   *
+   * Adds stack arrays for the element local input and output fields.
+   */
+  struct StackVariables : public Base::StackVariables
+  {
+public:
+
+    /// Constructor.
+    GEOSX_HOST_DEVICE
+    StackVariables():
+      Base::StackVariables(),
+            inputLocal(),
+            outputLocal{ { 0.0 } }
+    {}
+
+    /// C-array stack storage for element local the nodal positions, only gathered when
+    /// the shape function gradients are computed in the kernel.
+    real64 xLocal[ numNodesPerElem ][ 3 ];
+
+    /// Stack storage for the element local input field.
+    real64 inputLocal[ numNodesPerElem ][ 3 ];
+
+    /// Stack storage for the element local output field.
+    real64 outputLocal[ numNodesPerElem ][ 3 ];
+  };
+  //*****************************************************************************
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::setup
+   *
+   * The input field is gathered into element local stack storage.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void setup( localIndex const k,
+              StackVariables & stack ) const
+  {
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      localIndex const localNodeIndex = m_elemsToNodes( k, a );
+      for( int i=0; i<3; ++i )
+      {
+        if( calcShapeGradientsInKernel )
+        {
+          stack.xLocal[ a ][ i ] = m_X[ localNodeIndex ][ i ];
+        }
+        stack.inputLocal[ a ][ i ] = m_input[ localNodeIndex ][ i ];
+      }
+    }
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::quadraturePointKernel
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    real64 dNdX[ numNodesPerElem ][ 3 ];
+    real64 const detJ = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, dNdX );
+
+    real64 strain[6] = {0};
+    FE_TYPE::symmetricGradient( dNdX, stack.inputLocal, strain );
+
+    real64 c[6][6];
+    m_constitutiveUpdate.GetStiffness( k, q, c );
+
+    real64 stress[6] = {0};
+    for( int i=0; i<6; ++i )
+    {
+      for( int j=0; j<6; ++j )
+      {
+        stress[i] += c[i][j] * strain[j];
+      }
+      stress[i] *= -detJ;
+    }
+
+    FE_TYPE::plus_gradNajAij( dNdX, stress, stack.outputLocal );
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::complete
+   *
+   * The element contribution is scattered to the output field.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      localIndex const localNodeIndex = m_elemsToNodes( k, a );
+      for( int i=0; i<3; ++i )
+      {
+        RAJA::atomicAdd< parallelDeviceAtomic >( &m_output[ localNodeIndex ][ i ], stack.outputLocal[ a ][ i ] );
+      }
+    }
+    return 0;
+  }
+
+protected:
+  /// The array containing the nodal position array.
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const m_X;
+
+  /// The nodal field the operator is applied to.
+  arrayView2d< real64 const > const m_input;
+
+  /// The nodal field the result is added to.
+  arrayView2d< real64 > const m_output;
+};
+
+} // namespace SolidMechanicsLagrangianFEMKernels
+
+} // namespace geosx
+
+#endif // GEOSX_PHYSICSSOLVERS_SOLIDMECHANICS_SOLIDMECHANICSSMALLSTRAINMATRIXFREEKERNEL_HPP_
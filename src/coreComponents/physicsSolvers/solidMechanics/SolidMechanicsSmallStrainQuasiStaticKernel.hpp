@@ -81,6 +81,7 @@ public:
   using Base::m_elemsToNodes;
   using Base::m_constitutiveUpdate;
   using Base::m_finiteElementSpace;
+  using Base::calcShapeGradientsInKernel;
 
 
   /**
@@ -133,19 +134,14 @@ public:
     GEOSX_HOST_DEVICE
     StackVariables():
       Base::StackVariables(),
-                                       xLocal(),
                                        u_local(),
                                        uhat_local(),
                                        constitutiveStiffness()
     {}
 
-#if !defined(CALC_FEM_SHAPE_IN_KERNEL)
-    /// Dummy
-    int xLocal;
-#else
-    /// C-array stack storage for element local the nodal positions.
+    /// C-array stack storage for element local the nodal positions, only gathered when
+    /// the shape function gradients are computed in the kernel.
     real64 xLocal[ numNodesPerElem ][ 3 ];
-#endif
 
     /// Stack storage for the element local nodal displacement
     real64 u_local[numNodesPerElem][numDofPerTrialSupportPoint];
@@ -177,9 +173,10 @@ public:
 
       for( int i=0; i<3; ++i )
       {
-#if defined(CALC_FEM_SHAPE_IN_KERNEL)
-        stack.xLocal[ a ][ i ] = m_X[ localNodeIndex ][ i ];
-#endif
+        if( calcShapeGradientsInKernel )
+        {
+          stack.xLocal[ a ][ i ] = m_X[ localNodeIndex ][ i ];
+        }
         stack.u_local[ a ][i] = m_disp[ localNodeIndex ][i];
         stack.uhat_local[ a ][i] = m_uhat[ localNodeIndex ][i];
         stack.localRowDofIndex[a*3+i] = m_dofNumber[localNodeIndex]+i;
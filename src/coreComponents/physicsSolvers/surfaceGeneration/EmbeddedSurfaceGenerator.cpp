@@ -18,6 +18,7 @@
 
 #include "EmbeddedSurfaceGenerator.hpp"
 
+#include "common/TimingMacros.hpp"
 #include "mpiCommunications/CommunicationTools.hpp"
 #include "mpiCommunications/NeighborCommunicator.hpp"
 #include "mpiCommunications/SpatialPartition.hpp"
@@ -27,6 +28,7 @@
 #include "managers/NumericalMethodsManager.hpp"
 #include "mesh/SurfaceElementRegion.hpp"
 #include "mesh/ExtrinsicMeshData.hpp"
+#include "meshUtilities/BoundingVolumeHierarchy.hpp"
 #include "meshUtilities/ComputationalGeometry.hpp"
 #include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEMKernels.hpp"
 #include "meshUtilities/SimpleGeometricObjects/GeometricObjectManager.hpp"
@@ -35,6 +37,8 @@
 #ifdef USE_GEOSX_PTP
 #include "physicsSolvers/GEOSX_PTP/ParallelTopologyChange.hpp"
 #endif
+#include <algorithm>
+#include <limits>
 #include <set>
 
 namespace geosx
@@ -67,6 +71,8 @@ void EmbeddedSurfaceGenerator::RegisterDataOnMesh( Group * const GEOSX_UNUSED_PA
 
 void EmbeddedSurfaceGenerator::InitializePostSubGroups( Group * const problemManager )
 {
+  GEOSX_MARK_FUNCTION;
+
   /*
    * Here we generate embedded elements for fractures (or faults) that already exist in the domain and
    * were specified in the input file.
@@ -94,63 +100,146 @@ void EmbeddedSurfaceGenerator::InitializePostSubGroups( Group * const problemMan
   EmbeddedSurfaceSubRegion * const embeddedSurfaceSubRegion =
     embeddedSurfaceRegion->GetSubRegion< EmbeddedSurfaceSubRegion >( 0 );
 
+  // Number the cell elements over the sub-regions, and index them by their bounding box, so that each fracture
+  // is only tested against the cells in its vicinity instead of against all the cells.
+  localIndex maxSubRegions = 0;
+  for( localIndex er = 0; er < elemManager->numRegions(); ++er )
+  {
+    maxSubRegions = std::max( maxSubRegions, elemManager->GetRegion( er )->numSubRegions() );
+  }
+  array2d< localIndex > subRegionOffsets( elemManager->numRegions(), maxSubRegions );
+  localIndex_array cellRegion;
+  localIndex_array cellSubRegion;
+  elemManager->forElementSubRegionsComplete< CellElementSubRegion >(
+    [&]( localIndex const er, localIndex const esr, ElementRegionBase &, CellElementSubRegion & subRegion )
+  {
+    subRegionOffsets( er, esr ) = cellRegion.size();
+    for( localIndex cellIndex = 0; cellIndex < subRegion.size(); ++cellIndex )
+    {
+      cellRegion.emplace_back( er );
+      cellSubRegion.emplace_back( esr );
+    }
+  } );
+
+  auto getCellSubRegion = [&]( localIndex const cell ) -> CellElementSubRegion &
+  {
+    return *elemManager->GetRegion( cellRegion[cell] )->GetSubRegion< CellElementSubRegion >( cellSubRegion[cell] );
+  };
+
+  BoundingVolumeHierarchy const cellHierarchy( cellRegion.size(),
+                                                [&]( localIndex const cell, real64 (& min)[3], real64 (& max)[3] )
+  {
+    CellElementSubRegion const & subRegion = getCellSubRegion( cell );
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const cellToNodes = subRegion.nodeList();
+    localIndex const cellIndex = cell - subRegionOffsets( cellRegion[cell], cellSubRegion[cell] );
+    for( int d = 0; d < 3; ++d )
+    {
+      min[d] = std::numeric_limits< real64 >::max();
+      max[d] = std::numeric_limits< real64 >::lowest();
+    }
+    for( localIndex kn = 0; kn < subRegion.numNodesPerElement(); ++kn )
+    {
+      for( int d = 0; d < 3; ++d )
+      {
+        min[d] = std::min( min[d], nodesCoord[ cellToNodes[cellIndex][kn] ][d] );
+        max[d] = std::max( max[d], nodesCoord[ cellToNodes[cellIndex][kn] ][d] );
+      }
+    }
+  } );
+
+  std::vector< localIndex > candidateCells;
+  std::vector< integer > isCut;
+
   // Loop over all the fracture planes
   geometricObjManager->forSubGroups< BoundedPlane >( [&]( BoundedPlane & fracture )
   {
     /* 1. Find out if an element is cut by the fracture or not.
-     * Loop over all the elements and for each one of them loop over the nodes and compute the
-     * dot product between the distance between the plane center and the node and the normal
-     * vector defining the plane. If two scalar products have different signs the plane cuts the
-     * cell. If a nodes gives a 0 dot product it has to be neglected or the method won't work.
+     * Only the cells whose bounding box overlaps the one of the fracture can have all their intersection points in the
+     * fracture. For each one of them we loop over the nodes and compute the dot product between the distance between
+     * the plane center and the node and the normal vector defining the plane. If two scalar products have different
+     * signs the plane cuts the cell. If a nodes gives a 0 dot product it has to be neglected or the method won't work.
+     * The cut cells are then checked concurrently and added in the order of the cells.
      */
     R1Tensor planeCenter  = fracture.getCenter();
     R1Tensor normalVector = fracture.getNormal();
-    // Initialize variables
-    globalIndex nodeIndex;
-    integer isPositive, isNegative;
-    R1Tensor distVec;
 
-    elemManager->forElementSubRegionsComplete< CellElementSubRegion >(
-      [&]( localIndex const er, localIndex const esr, ElementRegionBase &, CellElementSubRegion & subRegion )
+    // the box is slightly enlarged, the extra cells are rejected by the exact check
+    real64 planeMin[3], planeMax[3];
+    fracture.getBoundingBox( planeMin, planeMax );
+    real64 tolerance = 0.0;
+    for( int d = 0; d < 3; ++d )
+    {
+      tolerance = std::max( tolerance, 1e-8 * ( planeMax[d] - planeMin[d] ) );
+    }
+    for( int d = 0; d < 3; ++d )
     {
+      planeMin[d] -= tolerance;
+      planeMax[d] += tolerance;
+    }
+
+    candidateCells.clear();
+    cellHierarchy.forEachIntersecting( planeMin, planeMax, [&]( localIndex const cell )
+    {
+      candidateCells.emplace_back( cell );
+    } );
+    std::sort( candidateCells.begin(), candidateCells.end() );
+
+    isCut.resize( candidateCells.size() );
+    localIndex const numCandidates = LvArray::integerConversion< localIndex >( candidateCells.size() );
+    forAll< parallelHostPolicy >( numCandidates, [&]( localIndex const k )
+    {
+      localIndex const cell = candidateCells[k];
+      CellElementSubRegion const & subRegion = getCellSubRegion( cell );
       arrayView2d< localIndex const, cells::NODE_MAP_USD > const cellToNodes = subRegion.nodeList();
-      FixedOneToManyRelation const & cellToEdges = subRegion.edgeList();
-      for( localIndex cellIndex =0; cellIndex<subRegion.size(); cellIndex++ )
+      localIndex const cellIndex = cell - subRegionOffsets( cellRegion[cell], cellSubRegion[cell] );
+
+      integer isPositive = 0;
+      integer isNegative = 0;
+      for( localIndex kn =0; kn<subRegion.numNodesPerElement(); kn++ )
       {
-        isPositive = 0;
-        isNegative = 0;
-        for( localIndex kn =0; kn<subRegion.numNodesPerElement(); kn++ )
+        R1Tensor distVec = nodesCoord[ cellToNodes[cellIndex][kn] ];
+        distVec -= planeCenter;
+        // check if the dot product is zero
+        if( Dot( distVec, normalVector ) > 0 )
         {
-          nodeIndex = cellToNodes[cellIndex][kn];
-          distVec  = nodesCoord[nodeIndex];
-          distVec -= planeCenter;
-          // check if the dot product is zero
-          if( Dot( distVec, normalVector ) > 0 )
-          {
-            isPositive = 1;
-          }
-          else if( Dot( distVec, normalVector ) < 0 )
-          {
-            isNegative = 1;
-          }
-        } // end loop over nodes
-        if( isPositive * isNegative == 1 )
+          isPositive = 1;
+        }
+        else if( Dot( distVec, normalVector ) < 0 )
         {
+          isNegative = 1;
+        }
+      } // end loop over nodes
 
-          bool added = embeddedSurfaceSubRegion->AddNewEmbeddedSurface( cellIndex,
-                                                                        esr,
-                                                                        er,
-                                                                        *nodeManager,
-                                                                        *edgeManager,
-                                                                        cellToEdges,
-                                                                        &fracture );
-          if( added )
-          {
-            GEOSX_LOG_LEVEL_RANK_0( 2, "Element " << cellIndex << " is fractured" );
-          }
+      isCut[k] = isPositive * isNegative == 1 &&
+                 EmbeddedSurfaceSubRegion::IsCutByFracture( cellIndex,
+                                                            nodesCoord,
+                                                            edgeManager->nodeList(),
+                                                            subRegion.edgeList(),
+                                                            fracture );
+    } );
+
+    for( std::size_t k = 0; k < candidateCells.size(); ++k )
+    {
+      if( isCut[k] )
+      {
+        localIndex const cell = candidateCells[k];
+        localIndex const er = cellRegion[cell];
+        localIndex const esr = cellSubRegion[cell];
+        localIndex const cellIndex = cell - subRegionOffsets( er, esr );
+
+        bool added = embeddedSurfaceSubRegion->AddNewEmbeddedSurface( cellIndex,
+                                                                      esr,
+                                                                      er,
+                                                                      *nodeManager,
+                                                                      *edgeManager,
+                                                                      getCellSubRegion( cell ).edgeList(),
+                                                                      &fracture );
+        if( added )
+        {
+          GEOSX_LOG_LEVEL_RANK_0( 2, "Element " << cellIndex << " is fractured" );
         }
-      } // end loop over cells
-    } );// end loop over subregions
+      }
+    } // end loop over cells
   } );// end loop over thick planes
 
   ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > const & cellElemGhostRank =
@@ -211,6 +300,8 @@ real64 EmbeddedSurfaceGenerator::SolverStep( real64 const & GEOSX_UNUSED_PARAM(
 
 void EmbeddedSurfaceGenerator::addToFractureStencil( DomainPartition & domain )
 {
+  GEOSX_MARK_FUNCTION;
+
   // Add embedded elements to the fracture Stencil
   NumericalMethodsManager & numericalMethodManager = domain.getNumericalMethodManager();
 
@@ -89,6 +89,12 @@ public:
 
   /**@}*/
 
+  /// The embedded surfaces are cut along the edges of the cells they cross.
+  virtual bool requiresCellToEdgeMaps() const override { return true; }
+
+  /// New embedded surface elements are created during the simulation.
+  virtual bool changesMeshTopology() const override { return true; }
+
 protected:
 
   /**
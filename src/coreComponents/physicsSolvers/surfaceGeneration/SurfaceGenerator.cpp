@@ -18,6 +18,7 @@
 
 #include "SurfaceGenerator.hpp"
 
+#include "mpiCommunications/CommunicationStatistics.hpp"
 #include "mpiCommunications/CommunicationTools.hpp"
 #include "mpiCommunications/NeighborCommunicator.hpp"
 #include "mpiCommunications/SpatialPartition.hpp"
@@ -28,6 +29,7 @@
 #include "mesh/SurfaceElementRegion.hpp"
 #include "mesh/ExtrinsicMeshData.hpp"
 #include "meshUtilities/ComputationalGeometry.hpp"
+#include "constitutive/solid/LinearElasticIsotropic.hpp"
 #include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEMKernels.hpp"
 #include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
 
@@ -81,21 +83,22 @@ void ModifiedObjectLists::insert( ModifiedObjectLists const & modifiedObjects )
   for( auto & iter : modifiedObjects.newElements )
   {
     std::pair< localIndex, localIndex > const & key = iter.first;
-    std::set< localIndex > const & values = iter.second;
+    FlatSet< localIndex > const & values = iter.second;
     newElements[key].insert( values.begin(), values.end() );
   }
 
   for( auto & iter : modifiedObjects.modifiedElements )
   {
     std::pair< localIndex, localIndex > const & key = iter.first;
-    std::set< localIndex > const & values = iter.second;
+    FlatSet< localIndex > const & values = iter.second;
     modifiedElements[key].insert( values.begin(), values.end() );
   }
 
 }
 
-static localIndex GetOtherFaceEdge( const map< localIndex, std::pair< localIndex, localIndex > > & localFacesToEdges,
-                                    const localIndex thisFace, const localIndex thisEdge )
+static localIndex GetOtherFaceEdge( const FlatMap< localIndex, std::pair< localIndex, localIndex > > & localFacesToEdges,
+                                    const localIndex thisFace, const localIndex thisEdge,
+                                    string & error )
 {
   localIndex nextEdge = LOCALINDEX_MAX;
 
@@ -110,16 +113,37 @@ static localIndex GetOtherFaceEdge( const map< localIndex, std::pair< localIndex
   }
   else
   {
-    GEOSX_ERROR( "SurfaceGenerator::Couldn't find thisEdge in localFacesToEdges[thisFace]" );
+    error = "SurfaceGenerator::Couldn't find thisEdge in localFacesToEdges[thisFace]";
   }
   return nextEdge;
 }
 
+/**
+ * @brief FNV-1a hash of a list of indices, to detect that a ghost list changed between two synchronizations.
+ * @param indices the list
+ * @return the hash
+ */
+static std::uint64_t HashIndexList( arrayView1d< localIndex const > const & indices )
+{
+  std::uint64_t hash = 14695981039346656037ULL;
+  for( localIndex const index : indices )
+  {
+    unsigned char const * const bytes = reinterpret_cast< unsigned char const * >( &index );
+    for( std::size_t i = 0; i < sizeof( localIndex ); ++i )
+    {
+      hash ^= bytes[i];
+      hash *= 1099511628211ULL;
+    }
+  }
+  return hash;
+}
+
 static void CheckForAndRemoveDeadEndPath( const localIndex edgeIndex,
                                           arrayView1d< integer const > const & isEdgeExternal,
-                                          map< localIndex, std::set< localIndex > > & edgesToRuptureReadyFaces,
-                                          map< localIndex, std::pair< localIndex, localIndex > > & localVFacesToVEdges,
-                                          std::set< localIndex > & nodeToRuptureReadyFaces )
+                                          FlatMap< localIndex, FlatSet< localIndex > > & edgesToRuptureReadyFaces,
+                                          FlatMap< localIndex, std::pair< localIndex, localIndex > > & localVFacesToVEdges,
+                                          FlatSet< localIndex > & nodeToRuptureReadyFaces,
+                                          string & error )
 {
 
 
@@ -129,14 +153,13 @@ static void CheckForAndRemoveDeadEndPath( const localIndex edgeIndex,
   while( isEdgeExternal[thisEdge]!=1 )
   {
 
-    //    std::set<localIndex>& edgeToRuptureReadyFaces = stlMapLookup(edgesToRuptureReadyFaces,thisEdge);
-    std::set< localIndex > & edgeToRuptureReadyFaces = edgesToRuptureReadyFaces[thisEdge];
+    FlatMap< localIndex, FlatSet< localIndex > >::iterator const iterThisEdge = edgesToRuptureReadyFaces.find( thisEdge );
 
-    if( edgeToRuptureReadyFaces.size()!=1 )
+    if( iterThisEdge == edgesToRuptureReadyFaces.end() || iterThisEdge->second.size()!=1 )
       break;
 
     // then the index for the face that is a "dead end"
-    localIndex deadEndFace = *(edgeToRuptureReadyFaces.begin());
+    localIndex deadEndFace = *(iterThisEdge->second.begin());
 
 
     std::pair< localIndex, localIndex > & localVFaceToVEdges = stlMapLookup( localVFacesToVEdges, deadEndFace );
@@ -149,19 +172,24 @@ static void CheckForAndRemoveDeadEndPath( const localIndex edgeIndex,
       nextEdge = localVFaceToVEdges.first;
     else
     {
-      GEOSX_ERROR( "SurfaceGenerator::FindFracturePlanes: Could not find the next edge when removing dead end faces." );
+      error = "SurfaceGenerator::FindFracturePlanes: Could not find the next edge when removing dead end faces.";
+      break;
     }
 
-    // delete the face from the working arrays
-    edgeToRuptureReadyFaces.erase( deadEndFace );
-    edgesToRuptureReadyFaces[nextEdge].erase( deadEndFace );
-    nodeToRuptureReadyFaces.erase( deadEndFace );
-
-    // if all the faces have been deleted, then go ahead and delete the top level entry
-    if( edgeToRuptureReadyFaces.empty() )
+    // delete the face from the working arrays, and the top level entries whose faces have all been deleted.
+    // The entries are erased one at a time since erasing one invalidates the iterators to the others.
+    iterThisEdge->second.erase( deadEndFace );
+    if( iterThisEdge->second.empty() )
       edgesToRuptureReadyFaces.erase( thisEdge );
-    if( edgesToRuptureReadyFaces[nextEdge].empty() )
-      edgesToRuptureReadyFaces.erase( nextEdge );
+
+    FlatMap< localIndex, FlatSet< localIndex > >::iterator const iterNextEdge = edgesToRuptureReadyFaces.find( nextEdge );
+    if( iterNextEdge != edgesToRuptureReadyFaces.end() )
+    {
+      iterNextEdge->second.erase( deadEndFace );
+      if( iterNextEdge->second.empty() )
+        edgesToRuptureReadyFaces.erase( nextEdge );
+    }
+    nodeToRuptureReadyFaces.erase( deadEndFace );
 
     // now increment the "thisEdge" to point to the other edge on the face that was just deleted
     thisEdge = nextEdge;
@@ -177,7 +205,8 @@ SurfaceGenerator::SurfaceGenerator( const std::string & name,
 //  m_maxTurnAngle(91.0),
   m_nodeBasedSIF( 0 ),
   m_rockToughness( 1.0e99 ),
-  m_mpiCommOrder( 0 )
+  m_mpiCommOrder( 0 ),
+  m_concurrentNodeSeparation( 0 )
 {
   this->registerWrapper( viewKeyStruct::failCriterionString, &this->m_failCriterion );
 
@@ -197,6 +226,11 @@ SurfaceGenerator::SurfaceGenerator( const std::string & name,
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Flag to enable MPI consistent communication ordering" );
 
+  registerWrapper( viewKeyStruct::concurrentNodeSeparationString, &m_concurrentNodeSeparation )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to split concurrently the nodes of a rank that have no element in common" );
+
   registerWrapper( viewKeyStruct::fractureRegionNameString, &m_fractureRegionName )->
     setInputFlag( dataRepository::InputFlags::OPTIONAL )->
     setApplyDefaultValue( "Fracture" );
@@ -491,6 +525,18 @@ real64 SurfaceGenerator::SolverStep( real64 const & time_n,
           fractureRegion->GetSubRegion< FaceElementSubRegion >( 0 )->m_newFaceElements.clear();
         }
       }
+
+      if( getLogLevel() )
+      {
+        // The ranks owning the fracture do the extra work of the propagation, report how it is spread.
+        localIndex const numOwnedFaceElems = fractureRegion->GetSubRegion< FaceElementSubRegion >( 0 )->GetNumberOfLocalIndices();
+        localIndex const maxOwnedFaceElems = MpiWrapper::Max( numOwnedFaceElems );
+        globalIndex const numFaceElems = MpiWrapper::Sum( globalIndex( numOwnedFaceElems ) );
+        real64 const meanOwnedFaceElems = real64( numFaceElems ) / MpiWrapper::Comm_size();
+        GEOSX_LOG_RANK_0( "Fracture elements: " << numFaceElems << ", max per rank = " << maxOwnedFaceElems
+                                                << ", imbalance (max / mean) = "
+                                                << ( meanOwnedFaceElems > 0 ? maxOwnedFaceElems / meanOwnedFaceElems : 1.0 ) );
+      }
     }
   }
 
@@ -500,6 +546,72 @@ real64 SurfaceGenerator::SolverStep( real64 const & time_n,
 
 
 
+void SurfaceGenerator::SynchronizeRuptureState( MeshLevel & mesh,
+                                                std::vector< NeighborCommunicator > & neighbors )
+{
+  GEOSX_MARK_FUNCTION;
+
+  FaceManager & faceManager = *mesh.getFaceManager();
+  arrayView1d< integer > const & ruptureState = faceManager.getExtrinsicData< extrinsicMeshData::RuptureState >();
+  arrayView1d< integer const > const & faceGhostRank = faceManager.ghostRank();
+
+  map< string, string_array > fieldNames;
+  fieldNames["face"].emplace_back( string( extrinsicMeshData::RuptureState::key ) );
+
+  // the messages only carry the changes if both ranks of each pair share the same faces as last time
+  array1d< std::uint64_t > faceGhostSignatures( 5 * neighbors.size() );
+  for( std::size_t neighborIndex = 0; neighborIndex < neighbors.size(); ++neighborIndex )
+  {
+    int const neighborRank = neighbors[neighborIndex].NeighborRank();
+    NeighborData const & neighborData = faceManager.getNeighborData( neighborRank );
+    faceGhostSignatures[5 * neighborIndex] = neighborRank;
+    faceGhostSignatures[5 * neighborIndex + 1] = neighborData.ghostsToSend().size();
+    faceGhostSignatures[5 * neighborIndex + 2] = HashIndexList( neighborData.ghostsToSend() );
+    faceGhostSignatures[5 * neighborIndex + 3] = neighborData.ghostsToReceive().size();
+    faceGhostSignatures[5 * neighborIndex + 4] = HashIndexList( neighborData.ghostsToReceive() );
+  }
+
+  bool const sameGhosts = m_syncedRuptureState.size() > 0 &&
+                          faceGhostSignatures.size() == m_syncedFaceGhostSignatures.size() &&
+                          std::equal( faceGhostSignatures.begin(),
+                                      faceGhostSignatures.end(),
+                                      m_syncedFaceGhostSignatures.begin() );
+
+  if( MpiWrapper::Min( sameGhosts ? 1 : 0 ) == 0 )
+  {
+    CommunicationTools::SynchronizeFields( fieldNames, &mesh, neighbors );
+  }
+  else
+  {
+    localIndex const numSyncedFaces = m_syncedRuptureState.size();
+    m_ruptureStateChangedFaces.clear();
+    for( localIndex kf = 0; kf < faceManager.size(); ++kf )
+    {
+      if( kf < numSyncedFaces && ruptureState[kf] == m_syncedRuptureState[kf] )
+      {
+        continue;
+      }
+
+      if( faceGhostRank[kf] < 0 )
+      {
+        m_ruptureStateChangedFaces.insert( kf );
+      }
+      else if( kf < numSyncedFaces )
+      {
+        ruptureState[kf] = m_syncedRuptureState[kf];
+      }
+    }
+
+    std::map< string, SortedArrayView< localIndex const > > modifiedObjects;
+    modifiedObjects.emplace( "face", m_ruptureStateChangedFaces.toViewConst() );
+    CommunicationTools::SynchronizeModifiedFields( fieldNames, modifiedObjects, mesh, neighbors );
+  }
+
+  m_syncedRuptureState.resize( ruptureState.size() );
+  std::copy( ruptureState.begin(), ruptureState.end(), m_syncedRuptureState.begin() );
+  m_syncedFaceGhostSignatures = faceGhostSignatures;
+}
+
 int SurfaceGenerator::SeparationDriver( DomainPartition & domain,
                                         MeshLevel & mesh,
                                         std::vector< NeighborCommunicator > & neighbors,
@@ -509,6 +621,7 @@ int SurfaceGenerator::SeparationDriver( DomainPartition & domain,
                                         real64 const time_np1 )
 {
   GEOSX_MARK_FUNCTION;
+  CommunicationStatistics::ScopedPurpose const commPurpose( CommunicationStatistics::Purpose::FractureUpdate );
 
   m_faceElemsRupturedThisSolve.clear();
   NodeManager & nodeManager = *mesh.getNodeManager();
@@ -516,16 +629,16 @@ int SurfaceGenerator::SeparationDriver( DomainPartition & domain,
   FaceManager & faceManager = *mesh.getFaceManager();
   ElementRegionManager & elementManager = *mesh.getElemManager();
 
-  std::vector< std::set< localIndex > > nodesToRupturedFaces;
-  std::vector< std::set< localIndex > > edgesToRupturedFaces;
+  std::vector< FlatSet< localIndex > > & nodesToRupturedFaces = m_separationScratch.nodesToRupturedFaces;
+  std::vector< FlatSet< localIndex > > & edgesToRupturedFaces = m_separationScratch.edgesToRupturedFaces;
 
   ArrayOfArrays< localIndex > const & nodeToElementMap = nodeManager.elementList();
 
   map< string, string_array > fieldNames;
-  fieldNames["face"].emplace_back( string( extrinsicMeshData::RuptureState::key ) );
   fieldNames["node"].emplace_back( string( SolidMechanicsLagrangianFEM::viewKeyStruct::forceExternal ) );
 
   CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain.getNeighbors() );
+  SynchronizeRuptureState( mesh, domain.getNeighbors() );
 
   elementManager.forElementSubRegions< CellElementSubRegion >( [] ( auto & elemSubRegion )
   {
@@ -574,7 +687,18 @@ int SurfaceGenerator::SeparationDriver( DomainPartition & domain,
   for( int color=0; color<numTileColors; ++color )
   {
     ModifiedObjectLists modifiedObjects;
-    if( color==tileColor )
+    if( color==tileColor && m_concurrentNodeSeparation )
+    {
+      rval += ProcessNodesConcurrently( time_np1,
+                                        nodeManager,
+                                        edgeManager,
+                                        faceManager,
+                                        elementManager,
+                                        nodesToRupturedFaces,
+                                        edgesToRupturedFaces,
+                                        modifiedObjects );
+    }
+    else if( color==tileColor )
     {
       for( localIndex a=0; a<nodeManager.size(); ++a )
       {
@@ -603,29 +727,33 @@ int SurfaceGenerator::SeparationDriver( DomainPartition & domain,
 
 #ifdef USE_GEOSX_PTP
 
-    modifiedObjects.clearNewFromModified();
+    {
+      // timed on its own to separate the communication from the splitting in the benchmarks
+      GEOSX_MARK_SCOPE( SynchronizeTopologyChange );
 
-    // 1) Assign new global indices to the new objects
-    CommunicationTools::AssignNewGlobalIndices( nodeManager, modifiedObjects.newNodes );
-    CommunicationTools::AssignNewGlobalIndices( edgeManager, modifiedObjects.newEdges );
-    CommunicationTools::AssignNewGlobalIndices( faceManager, modifiedObjects.newFaces );
-//    CommunicationTools::AssignNewGlobalIndices( elementManager, modifiedObjects.newElements );
+      modifiedObjects.clearNewFromModified();
 
-    ModifiedObjectLists receivedObjects;
+      // 1) Assign new global indices to the new objects
+      CommunicationTools::AssignNewGlobalIndices( nodeManager, modifiedObjects.newNodes );
+      CommunicationTools::AssignNewGlobalIndices( edgeManager, modifiedObjects.newEdges );
+      CommunicationTools::AssignNewGlobalIndices( faceManager, modifiedObjects.newFaces );
+//    CommunicationTools::AssignNewGlobalIndices( elementManager, modifiedObjects.newElements );
 
-    /// Nodes to edges in process node is not being set on rank 2. need to check that the new node->edge map is properly
-    /// communicated
-    ParallelTopologyChange::SynchronizeTopologyChange( &mesh,
-                                                       neighbors,
-                                                       modifiedObjects,
-                                                       receivedObjects,
-                                                       m_mpiCommOrder );
+      ModifiedObjectLists receivedObjects;
 
-    SynchronizeTipSets( faceManager,
-                        edgeManager,
-                        nodeManager,
-                        receivedObjects );
+      /// Nodes to edges in process node is not being set on rank 2. need to check that the new node->edge map is properly
+      /// communicated
+      ParallelTopologyChange::SynchronizeTopologyChange( &mesh,
+                                                         neighbors,
+                                                         modifiedObjects,
+                                                         receivedObjects,
+                                                         m_mpiCommOrder );
 
+      SynchronizeTipSets( faceManager,
+                          edgeManager,
+                          nodeManager,
+                          receivedObjects );
+    }
 
 #else
 
@@ -643,7 +771,7 @@ int SurfaceGenerator::SeparationDriver( DomainPartition & domain,
                                                                               ElementRegionBase &,
                                                                               FaceElementSubRegion & subRegion )
     {
-      std::set< localIndex > & newFaceElems = modifiedObjects.newElements[{er, esr}];
+      FlatSet< localIndex > & newFaceElems = modifiedObjects.newElements[{er, esr}];
       for( localIndex const newFaceElemIndex : newFaceElems )
       {
         subRegion.m_newFaceElements.insert( newFaceElemIndex );
@@ -715,6 +843,12 @@ int SurfaceGenerator::SeparationDriver( DomainPartition & domain,
 
   }
 
+  if( rval > 0 )
+  {
+    // the solvers must rebuild the sparsity pattern of their matrices
+    mesh.incrementTopologyVersion();
+  }
+
   return rval;
 }
 
@@ -866,8 +1000,8 @@ bool SurfaceGenerator::ProcessNode( const localIndex nodeID,
                                     EdgeManager & edgeManager,
                                     FaceManager & faceManager,
                                     ElementRegionManager & elemManager,
-                                    std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                                    std::vector< std::set< localIndex > > & edgesToRupturedFaces,
+                                    std::vector< FlatSet< localIndex > > & nodesToRupturedFaces,
+                                    std::vector< FlatSet< localIndex > > & edgesToRupturedFaces,
                                     ElementRegionManager & elementManager,
                                     ModifiedObjectLists & modifiedObjects,
                                     const bool GEOSX_UNUSED_PARAM( prefrac ) )
@@ -876,12 +1010,7 @@ bool SurfaceGenerator::ProcessNode( const localIndex nodeID,
   bool fracturePlaneFlag = true;
 
   {
-    std::set< localIndex > facialRupturePath;
-    map< localIndex, int > edgeLocations;
-    map< localIndex, int > faceLocations;
-    map< std::pair< CellElementSubRegion *, localIndex >, int > elemLocations;
-
-
+    NodeSeparation & separation = m_separationScratch.node;
     fracturePlaneFlag = FindFracturePlanes( nodeID,
                                             nodeManager,
                                             edgeManager,
@@ -889,10 +1018,13 @@ bool SurfaceGenerator::ProcessNode( const localIndex nodeID,
                                             elemManager,
                                             nodesToRupturedFaces,
                                             edgesToRupturedFaces,
-                                            facialRupturePath,
-                                            edgeLocations,
-                                            faceLocations,
-                                            elemLocations );
+                                            separation );
+    GEOSX_ERROR_IF( !separation.error.empty(), separation.error );
+
+    FlatSet< localIndex > const & facialRupturePath = separation.separationPathFaces;
+    FlatMap< localIndex, int > const & edgeLocations = separation.edgeLocations;
+    FlatMap< localIndex, int > const & faceLocations = separation.faceLocations;
+    FlatMap< std::pair< CellElementSubRegion *, localIndex >, int > const & elemLocations = separation.elemLocations;
     if( fracturePlaneFlag )
     {
       MapConsistencyCheck( nodeID, nodeManager, edgeManager, faceManager, elementManager, elemLocations );
@@ -919,6 +1051,184 @@ bool SurfaceGenerator::ProcessNode( const localIndex nodeID,
   return didSplit;
 }
 
+int SurfaceGenerator::ProcessNodesConcurrently( real64 const time_np1,
+                                                NodeManager & nodeManager,
+                                                EdgeManager & edgeManager,
+                                                FaceManager & faceManager,
+                                                ElementRegionManager & elementManager,
+                                                std::vector< FlatSet< localIndex > > & nodesToRupturedFaces,
+                                                std::vector< FlatSet< localIndex > > & edgesToRupturedFaces,
+                                                ModifiedObjectLists & modifiedObjects )
+{
+  GEOSX_MARK_FUNCTION;
+
+  // the references to the arrays stay valid when the splits resize them
+  array1d< integer > const & isNodeGhost = nodeManager.ghostRank();
+  ArrayOfArrays< localIndex > const & nodeToRegionMap = nodeManager.elementRegionList();
+  ArrayOfArrays< localIndex > const & nodeToSubRegionMap = nodeManager.elementSubRegionList();
+  ArrayOfArrays< localIndex > const & nodeToElementMap = nodeManager.elementList();
+
+  std::vector< localIndex > & pendingNodes = m_separationScratch.pendingNodes;
+  std::vector< localIndex > & roundNodes = m_separationScratch.roundNodes;
+  std::vector< localIndex > & deferredNodes = m_separationScratch.deferredNodes;
+  std::vector< localIndex > & batchNodes = m_separationScratch.batchNodes;
+  std::vector< localIndex > & elementBatch = m_separationScratch.elementBatch;
+  std::vector< NodeSeparation > & separations = m_separationScratch.concurrentNodes;
+
+  // the nodes attached to a single element cannot be split
+  auto isSplittable = [&]( localIndex const a )
+  {
+    return isNodeGhost[a] < 0 && nodeToElementMap.sizeOfArray( a ) > 1;
+  };
+
+  // the cell elements, the only ones attached to the nodes, are numbered over all the sub-regions
+  localIndex maxSubRegions = 0;
+  for( localIndex er = 0; er < elementManager.numRegions(); ++er )
+  {
+    maxSubRegions = std::max( maxSubRegions, elementManager.GetRegion( er )->numSubRegions() );
+  }
+  array2d< localIndex > subRegionOffsets( elementManager.numRegions(), maxSubRegions );
+  localIndex numElements = 0;
+  elementManager.forElementSubRegionsComplete< CellElementSubRegion >( [&]( localIndex const er,
+                                                                            localIndex const esr,
+                                                                            ElementRegionBase &,
+                                                                            CellElementSubRegion & subRegion )
+  {
+    subRegionOffsets( er, esr ) = numElements;
+    numElements += subRegion.size();
+  } );
+
+  auto elementNumber = [&]( localIndex const a, localIndex const i )
+  {
+    return subRegionOffsets( nodeToRegionMap( a, i ), nodeToSubRegionMap( a, i ) ) + nodeToElementMap( a, i );
+  };
+
+  pendingNodes.clear();
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    if( isSplittable( a ) )
+    {
+      pendingNodes.emplace_back( a );
+    }
+  }
+
+  int numSplits = 0;
+  while( !pendingNodes.empty() )
+  {
+    roundNodes.swap( pendingNodes );
+    pendingNodes.clear();
+
+    // the splits do not create cell elements, so the numbering holds for the whole separation
+    elementBatch.assign( numElements, -1 );
+    localIndex batchIndex = 0;
+
+    while( !roundNodes.empty() )
+    {
+      // greedily take, in increasing order, the nodes without elements in common with the nodes already in the
+      // batch. The other ones are deferred to the next batches of the round.
+      batchNodes.clear();
+      deferredNodes.clear();
+      for( localIndex const a : roundNodes )
+      {
+        // the splits of the previous batches may have left the node with a single element
+        if( !isSplittable( a ) )
+        {
+          continue;
+        }
+
+        bool independent = true;
+        for( localIndex i = 0; i < nodeToElementMap.sizeOfArray( a ); ++i )
+        {
+          independent = independent && elementBatch[ elementNumber( a, i ) ] != batchIndex;
+        }
+
+        if( independent )
+        {
+          for( localIndex i = 0; i < nodeToElementMap.sizeOfArray( a ); ++i )
+          {
+            elementBatch[ elementNumber( a, i ) ] = batchIndex;
+          }
+          batchNodes.emplace_back( a );
+        }
+        else
+        {
+          deferredNodes.emplace_back( a );
+        }
+      }
+      roundNodes.swap( deferredNodes );
+      ++batchIndex;
+
+      // the separation paths of the nodes of a batch only read the objects attached to their own elements
+      localIndex const numBatchNodes = LvArray::integerConversion< localIndex >( batchNodes.size() );
+      if( LvArray::integerConversion< localIndex >( separations.size() ) < numBatchNodes )
+      {
+        separations.resize( numBatchNodes );
+      }
+      forAll< parallelHostPolicy >( numBatchNodes, [&]( localIndex const k )
+      {
+        separations[k].found = FindFracturePlanes( batchNodes[k],
+                                                   nodeManager,
+                                                   edgeManager,
+                                                   faceManager,
+                                                   elementManager,
+                                                   nodesToRupturedFaces,
+                                                   edgesToRupturedFaces,
+                                                   separations[k] );
+      } );
+
+      // the errors of the search are reported from the main thread, in the order of the nodes
+      for( localIndex k = 0; k < numBatchNodes; ++k )
+      {
+        GEOSX_ERROR_IF( !separations[k].error.empty(), separations[k].error );
+      }
+
+      // the splits create the new objects, they are performed in the order of the nodes
+      for( localIndex k = 0; k < numBatchNodes; ++k )
+      {
+        NodeSeparation const & separation = separations[k];
+        if( !separation.found )
+        {
+          continue;
+        }
+
+        localIndex const nodeID = batchNodes[k];
+        localIndex const numNodesBefore = nodeManager.size();
+
+        MapConsistencyCheck( nodeID, nodeManager, edgeManager, faceManager, elementManager, separation.elemLocations );
+        PerformFracture( nodeID,
+                         time_np1,
+                         nodeManager,
+                         edgeManager,
+                         faceManager,
+                         elementManager,
+                         modifiedObjects,
+                         nodesToRupturedFaces,
+                         edgesToRupturedFaces,
+                         separation.separationPathFaces,
+                         separation.edgeLocations,
+                         separation.faceLocations,
+                         separation.elemLocations );
+        MapConsistencyCheck( nodeID, nodeManager, edgeManager, faceManager, elementManager, separation.elemLocations );
+        ++numSplits;
+
+        // the node may have other separation paths, and the new node is checked like the other nodes
+        pendingNodes.emplace_back( nodeID );
+        for( localIndex a = numNodesBefore; a < nodeManager.size(); ++a )
+        {
+          if( isSplittable( a ) )
+          {
+            pendingNodes.emplace_back( a );
+          }
+        }
+      }
+    }
+
+    std::sort( pendingNodes.begin(), pendingNodes.end() );
+  }
+
+  return numSplits;
+}
+
 //**********************************************************************************************************************
 //**********************************************************************************************************************
 //**********************************************************************************************************************
@@ -927,13 +1237,21 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
                                            const EdgeManager & edgeManager,
                                            const FaceManager & faceManager,
                                            ElementRegionManager & elemManager,
-                                           const std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                                           const std::vector< std::set< localIndex > > & edgesToRupturedFaces,
-                                           std::set< localIndex > & separationPathFaces,
-                                           map< localIndex, int > & edgeLocations,
-                                           map< localIndex, int > & faceLocations,
-                                           map< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations )
+                                           const std::vector< FlatSet< localIndex > > & nodesToRupturedFaces,
+                                           const std::vector< FlatSet< localIndex > > & edgesToRupturedFaces,
+                                           NodeSeparation & separation )
 {
+  FlatSet< localIndex > & separationPathFaces = separation.separationPathFaces;
+  FlatMap< localIndex, int > & edgeLocations = separation.edgeLocations;
+  FlatMap< localIndex, int > & faceLocations = separation.faceLocations;
+  FlatMap< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations = separation.elemLocations;
+  string & error = separation.error;
+  separationPathFaces.clear();
+  edgeLocations.clear();
+  faceLocations.clear();
+  elemLocations.clear();
+  error.clear();
+
   arrayView1d< localIndex const > const & parentNodeIndices = nodeManager.getExtrinsicData< extrinsicMeshData::ParentIndex >();
 
   localIndex const parentNodeIndex = ObjectManagerBase::GetParentRecusive( parentNodeIndices, nodeID );
@@ -941,7 +1259,7 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
   arrayView1d< localIndex const > const & parentFaceIndices = faceManager.getExtrinsicData< extrinsicMeshData::ParentIndex >();
   arrayView1d< localIndex const > const & childFaceIndices = faceManager.getExtrinsicData< extrinsicMeshData::ChildIndex >();
 
-  std::set< localIndex > const & vNodeToRupturedFaces = nodesToRupturedFaces[parentNodeIndex];
+  FlatSet< localIndex > const & vNodeToRupturedFaces = nodesToRupturedFaces[parentNodeIndex];
 
   ArrayOfSetsView< localIndex const > const & nodeToEdgeMap = nodeManager.edgeList().toViewConst();
   ArrayOfSetsView< localIndex const > const & nodeToFaceMap = nodeManager.faceList().toViewConst();
@@ -957,7 +1275,8 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
   arraySlice1d< localIndex const > const & nodeToElementMap = nodeManager.elementList()[nodeID];
 
   // ***** BACKWARDS COMPATIBLITY HACK
-  std::set< std::pair< CellElementSubRegion *, localIndex > > nodeToElementMaps;
+  FlatSet< std::pair< CellElementSubRegion *, localIndex > > & nodeToElementMaps = separation.nodeToElements;
+  nodeToElementMaps.clear();
 
 
   for( localIndex k=0; k<nodeManager.elementRegionList().sizeOfArray( nodeID ); ++k )
@@ -980,7 +1299,8 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
   // array to hold the faces ready for rupture. It is filled with the intersection of the virtual parent faces
   // associated
   // with all faces attached to the node, and all ruptured virtual faces attached to the virtual parent node.
-  std::set< localIndex > nodeToRuptureReadyFaces;
+  FlatSet< localIndex > & nodeToRuptureReadyFaces = separation.nodeToRuptureReadyFaces;
+  nodeToRuptureReadyFaces.clear();
   for( localIndex const i : nodeToFaceMap[ nodeID ] )
   {
     const localIndex parentFaceIndex = ( parentFaceIndices[i] == -1 ) ? i : parentFaceIndices[i];
@@ -993,7 +1313,8 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
 
 
   // local map to hold the edgesToRuptureReadyFaces
-  map< localIndex, std::set< localIndex > > edgesToRuptureReadyFaces;
+  FlatMap< localIndex, FlatSet< localIndex > > & edgesToRuptureReadyFaces = separation.edgesToRuptureReadyFaces;
+  edgesToRuptureReadyFaces.clear();
   for( localIndex const edgeIndex : m_originalNodetoEdges[ parentNodeIndex ] )
   {
     if( !(edgesToRupturedFaces[edgeIndex].empty()) )
@@ -1002,7 +1323,8 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
 
 
   // need a map from faces to edges that are attached to the node
-  map< localIndex, std::pair< localIndex, localIndex > > nodeLocalFacesToEdges;
+  FlatMap< localIndex, std::pair< localIndex, localIndex > > & nodeLocalFacesToEdges = separation.nodeLocalFacesToEdges;
+  nodeLocalFacesToEdges.clear();
   for( localIndex const kf : m_originalNodetoFaces[ parentNodeIndex ] )
   {
     localIndex edge[2] = { INT_MAX, INT_MAX };
@@ -1017,7 +1339,8 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
 
     if( edge[0] == INT_MAX || edge[1] == INT_MAX )
     {
-      GEOSX_ERROR( "SurfaceGenerator::FindFracturePlanes: invalid edge." );
+      error = "SurfaceGenerator::FindFracturePlanes: invalid edge.";
+      return false;
     }
 
 
@@ -1039,8 +1362,12 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
                                   isEdgeExternal,
                                   edgesToRuptureReadyFaces,
                                   nodeLocalFacesToEdges,
-                                  nodeToRuptureReadyFaces );
-
+                                  nodeToRuptureReadyFaces,
+                                  error );
+    if( !error.empty() )
+    {
+      return false;
+    }
   }
 
   // if there are no ruptured faces attached to the node, then we are done.
@@ -1059,7 +1386,7 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
   localIndex startingFace = INT_MAX;
   bool startingEdgeExternal = false;
 
-  for( std::set< localIndex >::const_iterator i=nodeToRuptureReadyFaces.begin(); i!=nodeToRuptureReadyFaces.end(); ++i )
+  for( FlatSet< localIndex >::const_iterator i=nodeToRuptureReadyFaces.begin(); i!=nodeToRuptureReadyFaces.end(); ++i )
   {
     // check to see if this face has been used to split this node as part of a previously used path
     if( m_usedFacesForNode[nodeID].count( *i )==0 )
@@ -1122,8 +1449,10 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
     //localIndex lastFace = INT_MAX;
 
     // the seprationPath is used to hold combinations of edge and face
-    map< localIndex, int > facesInPath;
-    map< localIndex, int > edgesInPath;
+    FlatMap< localIndex, int > & facesInPath = separation.facesInPath;
+    FlatMap< localIndex, int > & edgesInPath = separation.edgesInPath;
+    facesInPath.clear();
+    edgesInPath.clear();
 
     int numFacesInPath = 0;
     edgesInPath[thisEdge] = numFacesInPath;
@@ -1144,7 +1473,11 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
       // get the next edge in the path...it is on the other side of "thisFace", so assign the other edge on the face as
       // the next edge
 
-      nextEdge = GetOtherFaceEdge( nodeLocalFacesToEdges, thisFace, thisEdge );
+      nextEdge = GetOtherFaceEdge( nodeLocalFacesToEdges, thisFace, thisEdge, error );
+      if( !error.empty() )
+      {
+        return false;
+      }
 
 
       // if the nextEdge has already been used in the path, and the nextEdge is not the starting edge, then we have
@@ -1162,19 +1495,18 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
         // NOT be included in the path!!!
         if( nextEdge!=startingEdge && !(isEdgeExternal[nextEdge]==1 && startingEdgeExternal ) )
         {
-          std::cout<<std::endl;
-
-
-          std::cout<<"  NodeID, ParentID = "<<nodeID<<", "<<parentNodeIndex<<std::endl;
-          std::cout<<"  Starting Edge/Face = "<<startingEdge<<", "<<startingFace<<std::endl;
-          std::cout<<"  Face Separation Path = " << facePath << std::endl;
-          std::cout<<"  Edge Separation Path = " << facePath << std::endl;
-
-          GEOSX_ERROR( "crap" );
+          std::ostringstream message;
+          message << "SurfaceGenerator::FindFracturePlanes: the separation path does not close" << std::endl;
+          message << "  NodeID, ParentID = " << nodeID << ", " << parentNodeIndex << std::endl;
+          message << "  Starting Edge/Face = " << startingEdge << ", " << startingFace << std::endl;
+          message << "  Face Separation Path = " << facePath << std::endl;
+          message << "  Edge Separation Path = " << edgePath;
+          error = message.str();
+          return false;
         }
 
         // add faces in the path to separationPathFaces
-        for( map< localIndex, int >::const_iterator kf=facesInPath.begin(); kf!=facesInPath.end(); ++kf )
+        for( FlatMap< localIndex, int >::const_iterator kf=facesInPath.begin(); kf!=facesInPath.end(); ++kf )
         {
           separationPathFaces.insert( kf->first );
         }
@@ -1226,7 +1558,7 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
             //
             int nextFaceQuality = -1;
 
-            for( std::set< localIndex >::const_iterator iter_edgeToFace = edgesToRuptureReadyFaces[nextEdge].begin();
+            for( FlatSet< localIndex >::const_iterator iter_edgeToFace = edgesToRuptureReadyFaces[nextEdge].begin();
                  iter_edgeToFace!=edgesToRuptureReadyFaces[nextEdge].end(); ++iter_edgeToFace )
             {
               if( *iter_edgeToFace != thisFace )
@@ -1239,7 +1571,11 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
                 int candidateFaceQuality = 0;
 
 
-                localIndex candidateEdgeIndex = GetOtherFaceEdge( nodeLocalFacesToEdges, candidateFaceIndex, nextEdge );
+                localIndex candidateEdgeIndex = GetOtherFaceEdge( nodeLocalFacesToEdges, candidateFaceIndex, nextEdge, error );
+                if( !error.empty() )
+                {
+                  return false;
+                }
                 if( candidateEdgeIndex == startingEdge )
                 {
                   nextFace = candidateFaceIndex;
@@ -1282,7 +1618,8 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
             }
             if( pathFound == false )
             {
-              GEOSX_ERROR( "SurfaceGenerator::FindFracturePlanes: couldn't find the next face in the rupture path" );
+              error = "SurfaceGenerator::FindFracturePlanes: couldn't find the next face in the rupture path";
+              return false;
             }
           }
 
@@ -1301,7 +1638,8 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
         }
         else
         {
-          GEOSX_ERROR( "SurfaceGenerator::next edge in separation path is apparently  connected to less than 2 ruptured face" );
+          error = "SurfaceGenerator::next edge in separation path is apparently  connected to less than 2 ruptured face";
+          return false;
         }
 
       }
@@ -1314,7 +1652,8 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
 
 
   // need a map from faces to edges that are attached to the node
-  map< localIndex, std::pair< localIndex, localIndex > > localFacesToEdges;
+  FlatMap< localIndex, std::pair< localIndex, localIndex > > & localFacesToEdges = separation.localFacesToEdges;
+  localFacesToEdges.clear();
   for( localIndex const kf : nodeToFaceMap[ nodeID ] )
   {
     localIndex edge[2] = { INT_MAX, INT_MAX };
@@ -1329,7 +1668,8 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
 
     if( edge[0] == INT_MAX || edge[1] == INT_MAX )
     {
-      GEOSX_ERROR( "SurfaceGenerator::FindFracturePlanes: invalid edge." );
+      error = "SurfaceGenerator::FindFracturePlanes: invalid edge.";
+      return false;
     }
 
 
@@ -1360,7 +1700,7 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
     edgeLocations[edgeID] = INT_MIN;
   }
 
-  for( std::set< std::pair< CellElementSubRegion *, localIndex > >::const_iterator k=nodeToElementMaps.begin(); k!=nodeToElementMaps.end(); ++k )
+  for( FlatSet< std::pair< CellElementSubRegion *, localIndex > >::const_iterator k=nodeToElementMaps.begin(); k!=nodeToElementMaps.end(); ++k )
   {
     elemLocations[*k] = INT_MIN;
   }
@@ -1442,14 +1782,14 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
 //**********************************************************************************************************************
 //**********************************************************************************************************************
 //**********************************************************************************************************************
-bool SurfaceGenerator::SetLocations( const std::set< localIndex > & separationPathFaces,
+bool SurfaceGenerator::SetLocations( const FlatSet< localIndex > & separationPathFaces,
                                      ElementRegionManager & elemManager,
                                      const FaceManager & faceManager,
-                                     const std::set< std::pair< CellElementSubRegion *, localIndex > > & nodeToElementMaps,
-                                     const map< localIndex, std::pair< localIndex, localIndex > > & localFacesToEdges,
-                                     map< localIndex, int > & edgeLocations,
-                                     map< localIndex, int > & faceLocations,
-                                     map< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations )
+                                     const FlatSet< std::pair< CellElementSubRegion *, localIndex > > & nodeToElementMaps,
+                                     const FlatMap< localIndex, std::pair< localIndex, localIndex > > & localFacesToEdges,
+                                     FlatMap< localIndex, int > & edgeLocations,
+                                     FlatMap< localIndex, int > & faceLocations,
+                                     FlatMap< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations )
 {
   bool rval = true;
   //  const localIndex separationFace = *(separationPathFaces.begin());
@@ -1480,14 +1820,14 @@ bool SurfaceGenerator::SetLocations( const std::set< localIndex > & separationPa
 //**********************************************************************************************************************
 bool SurfaceGenerator::SetElemLocations( const int location,
                                          const std::pair< CellElementSubRegion *, localIndex > & k,
-                                         const std::set< localIndex > & separationPathFaces,
+                                         const FlatSet< localIndex > & separationPathFaces,
                                          ElementRegionManager & elemManager,
                                          const FaceManager & faceManager,
-                                         const std::set< std::pair< CellElementSubRegion *, localIndex > > & nodeToElementMaps,
-                                         const map< localIndex, std::pair< localIndex, localIndex > > & localFacesToEdges,
-                                         map< localIndex, int > & edgeLocations,
-                                         map< localIndex, int > & faceLocations,
-                                         map< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations )
+                                         const FlatSet< std::pair< CellElementSubRegion *, localIndex > > & nodeToElementMaps,
+                                         const FlatMap< localIndex, std::pair< localIndex, localIndex > > & localFacesToEdges,
+                                         FlatMap< localIndex, int > & edgeLocations,
+                                         FlatMap< localIndex, int > & faceLocations,
+                                         FlatMap< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations )
 {
   arrayView1d< localIndex const > const & parentFaceIndices = faceManager.getExtrinsicData< extrinsicMeshData::ParentIndex >();
 
@@ -1506,7 +1846,7 @@ bool SurfaceGenerator::SetElemLocations( const int location,
                                         faceIndex : parentFaceIndices[faceIndex];
 
     // see if we can find the face in the faceLocations array.
-    map< localIndex, int >::iterator iterFace = faceLocations.find( faceIndex );
+    FlatMap< localIndex, int >::iterator iterFace = faceLocations.find( faceIndex );
     // if we can find the face in the faceLocations array, then we must process the face, otherwise it is not
     // connected to the node, so we do nothing.
     if( iterFace != faceLocations.end() )
@@ -1517,7 +1857,7 @@ bool SurfaceGenerator::SetElemLocations( const int location,
       else if( faceLocations[faceIndex] == INT_MIN )
         faceLocations[faceIndex] = location;
 
-      map< localIndex, std::pair< localIndex, localIndex > >::const_iterator iterF2E = localFacesToEdges.find( faceIndex );
+      FlatMap< localIndex, std::pair< localIndex, localIndex > >::const_iterator iterF2E = localFacesToEdges.find( faceIndex );
 
       if( iterF2E != localFacesToEdges.end() )
       {
@@ -1597,12 +1937,12 @@ void SurfaceGenerator::PerformFracture( const localIndex nodeID,
                                         FaceManager & faceManager,
                                         ElementRegionManager & elementManager,
                                         ModifiedObjectLists & modifiedObjects,
-                                        std::vector< std::set< localIndex > > & GEOSX_UNUSED_PARAM( nodesToRupturedFaces ),
-                                        std::vector< std::set< localIndex > > & GEOSX_UNUSED_PARAM( edgesToRupturedFaces ),
-                                        const std::set< localIndex > & separationPathFaces,
-                                        const map< localIndex, int > & edgeLocations,
-                                        const map< localIndex, int > & faceLocations,
-                                        const map< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations )
+                                        std::vector< FlatSet< localIndex > > & GEOSX_UNUSED_PARAM( nodesToRupturedFaces ),
+                                        std::vector< FlatSet< localIndex > > & GEOSX_UNUSED_PARAM( edgesToRupturedFaces ),
+                                        const FlatSet< localIndex > & separationPathFaces,
+                                        const FlatMap< localIndex, int > & edgeLocations,
+                                        const FlatMap< localIndex, int > & faceLocations,
+                                        const FlatMap< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations )
 {
   int const rank = MpiWrapper::Comm_rank( MPI_COMM_WORLD );
 
@@ -1651,7 +1991,7 @@ void SurfaceGenerator::PerformFracture( const localIndex nodeID,
   {
     GEOSX_LOG_RANK( "" );
     std::cout<<"Splitting node "<<nodeID<<" along separation plane faces: ";
-    for( std::set< localIndex >::const_iterator i=separationPathFaces.begin(); i!=separationPathFaces.end(); ++i )
+    for( FlatSet< localIndex >::const_iterator i=separationPathFaces.begin(); i!=separationPathFaces.end(); ++i )
     {
       std::cout<<*i<<", ";
     }
@@ -1683,12 +2023,9 @@ void SurfaceGenerator::PerformFracture( const localIndex nodeID,
 //  (*nodeManager.m_mass)[nodeID] = newMass;
 //  (*nodeManager.m_mass)[newNodeIndex] = newMass;
 
-  //TODO Either change m_usedFacesForNode to array<std::set> or add insert with iterator to SortedArray
-  for( auto const val : separationPathFaces )
-  {
-    m_usedFacesForNode[nodeID].insert( val );
-    m_usedFacesForNode[newNodeIndex].insert( val );
-  }
+  // the separation path faces are sorted and unique, which the sorted arrays insert in a single pass
+  m_usedFacesForNode[nodeID].insert( separationPathFaces.begin(), separationPathFaces.end() );
+  m_usedFacesForNode[newNodeIndex].insert( separationPathFaces.begin(), separationPathFaces.end() );
 
 //  SortedArray<localIndex>& usedFacesNew = nodeManager.getReference< array1d<SortedArray<localIndex>>
 // >("usedFaces")[newNodeIndex];
@@ -1699,9 +2036,10 @@ void SurfaceGenerator::PerformFracture( const localIndex nodeID,
     std::cout<<"Done splitting node "<<nodeID<<" into nodes "<<nodeID<<" and "<<newNodeIndex<<std::endl;
 
   // split edges
-  map< localIndex, localIndex > splitEdges;
+  FlatMap< localIndex, localIndex > & splitEdges = m_separationScratch.splitEdges;
+  splitEdges.clear();
   // loop over all edges connected to the node
-  for( map< localIndex, int >::const_iterator iter_edge=edgeLocations.begin(); iter_edge!=edgeLocations.end(); ++iter_edge )
+  for( FlatMap< localIndex, int >::const_iterator iter_edge=edgeLocations.begin(); iter_edge!=edgeLocations.end(); ++iter_edge )
   {
     const localIndex & parentEdgeIndex = iter_edge->first;
     const int & location = iter_edge->second;
@@ -1758,13 +2096,14 @@ void SurfaceGenerator::PerformFracture( const localIndex nodeID,
 
   // split the faces
   array1d< integer > const & ruptureState = faceManager.getExtrinsicData< extrinsicMeshData::RuptureState >();
-  map< localIndex, localIndex > splitFaces;
+  FlatMap< localIndex, localIndex > & splitFaces = m_separationScratch.splitFaces;
+  splitFaces.clear();
 
 
   SortedArray< localIndex > & externalFaces = faceManager.externalSet();
 
   // loop over all faces attached to the nodeID
-  for( map< localIndex, int >::const_iterator iter_face=faceLocations.begin(); iter_face!=faceLocations.end(); ++iter_face )
+  for( FlatMap< localIndex, int >::const_iterator iter_face=faceLocations.begin(); iter_face!=faceLocations.end(); ++iter_face )
   {
     const localIndex faceIndex = iter_face->first;
 //    localIndex const parentFaceIndex = parentFaceIndices[faceIndex]==faceIndex ? faceIndex :
@@ -1902,7 +2241,7 @@ void SurfaceGenerator::PerformFracture( const localIndex nodeID,
   array1d< localIndex > const & childFaceIndex = faceManager.getExtrinsicData< extrinsicMeshData::ChildIndex >();
 
   // 1) loop over all elements attached to the nodeID
-  for( map< std::pair< CellElementSubRegion *, localIndex >, int >::const_iterator iter_elem =
+  for( FlatMap< std::pair< CellElementSubRegion *, localIndex >, int >::const_iterator iter_elem =
          elemLocations.begin(); iter_elem != elemLocations.end(); ++iter_elem )
   {
     const int & location = iter_elem->second;
@@ -2239,7 +2578,7 @@ void SurfaceGenerator::MapConsistencyCheck( localIndex const GEOSX_UNUSED_PARAM(
                                             EdgeManager const & edgeManager,
                                             FaceManager const & faceManager,
                                             ElementRegionManager const & elementManager,
-                                            map< std::pair< CellElementSubRegion *, localIndex >, int > const & elemLocations )
+                                            FlatMap< std::pair< CellElementSubRegion *, localIndex >, int > const & elemLocations )
 {
   //**************************************************************************
   // THIS IS ALL JUST CONSISTENCY CHECKING
@@ -2267,7 +2606,7 @@ void SurfaceGenerator::MapConsistencyCheck( localIndex const GEOSX_UNUSED_PARAM(
   {
     std::cout<<"CONSISTENCY CHECKING OF THE MAPS"<<std::endl;
 
-    for( map< std::pair< CellElementSubRegion *, localIndex >, int >::const_iterator iter_elem=elemLocations.begin();
+    for( FlatMap< std::pair< CellElementSubRegion *, localIndex >, int >::const_iterator iter_elem=elemLocations.begin();
          iter_elem!=elemLocations.end(); ++iter_elem )
     {
       const std::pair< CellElementSubRegion *, localIndex > & elem = iter_elem->first;
@@ -2683,11 +3022,11 @@ void SurfaceGenerator::CalculateKinkAngles ( FaceManager & faceManager,
   }
   else
   {
-    for( std::set< localIndex >::const_iterator i=modifiedObjects.newEdges.begin(); i!=modifiedObjects.newEdges.end(); ++i )
+    for( FlatSet< localIndex >::const_iterator i=modifiedObjects.newEdges.begin(); i!=modifiedObjects.newEdges.end(); ++i )
     {
       kinkAngle[*i] = CalculateKinkAngle( *i, nodeManager, edgeManager, faceManager );
     }
-    for( std::set< localIndex >::const_iterator i=modifiedObjects.modifiedEdges.begin(); i!=modifiedObjects.modifiedEdges.end(); ++i )
+    for( FlatSet< localIndex >::const_iterator i=modifiedObjects.modifiedEdges.begin(); i!=modifiedObjects.modifiedEdges.end(); ++i )
     {
       kinkAngle[*i] = CalculateKinkAngle( *i, nodeManager, edgeManager, faceManager );
     }
@@ -2712,53 +3051,80 @@ void SurfaceGenerator::IdentifyRupturedFaces( DomainPartition & domain,
 
   if( !m_nodeBasedSIF )
   {
+    // The splitability of the edges only depends on the topology, which does not change until the separation, so the
+    // criterion is evaluated for all the candidate edges before any face is marked.
+    ArrayOfSetsView< localIndex const > const & edgeToFaceMap = edgeManager.faceList().toViewConst();
+    ArrayOfArraysView< localIndex const > const & faceToNodeMap = faceManager.nodeList().toViewConst();
+    arrayView1d< integer const > const & faceIsExternal = faceManager.isExternal();
+
+    std::vector< localIndex > candidateEdges;
+    std::vector< int > edgeModes;
+    std::vector< localIndex > candidateNodes;
+    for( localIndex iEdge = 0; iEdge != edgeManager.size(); ++iEdge )
     {
-//      for( int color=0 ; color<partition.NumColor() ; ++color )
+      if( isEdgeGhost[iEdge] < 0 )
       {
-        ModifiedObjectLists modifiedObjects;
-//        if( partition.Color() == color )
-        {
-          for( localIndex iEdge = 0; iEdge != edgeManager.size(); ++iEdge )
-          {
-
-            if( isEdgeGhost[iEdge] < 0 )
-            {
-              int edgeMode = CheckEdgeSplitability( iEdge,
-                                                    nodeManager,
-                                                    faceManager,
-                                                    edgeManager,
-                                                    prefrac );
-              if( edgeMode == 0 || edgeMode == 1 ) // We need to calculate SIF
-              {
-                R1Tensor vecTipNorm, vecTip, vecEdge, direction;
-                localIndex trailFaceID = 0;
-                realT SIF = CalculateEdgeSIF( domain, iEdge, trailFaceID,
+        int edgeMode = CheckEdgeSplitability( iEdge,
                                               nodeManager,
-                                              edgeManager,
                                               faceManager,
-                                              elementManager,
-                                              vecTipNorm,
-                                              vecTip );
+                                              edgeManager,
+                                              prefrac );
+        if( edgeMode == 0 || edgeMode == 1 ) // We need to calculate SIF
+        {
+          candidateEdges.emplace_back( iEdge );
+          edgeModes.emplace_back( edgeMode );
 
-                if( SIF >  MinimumToughnessOnEdge( iEdge, nodeManager, edgeManager, faceManager ) * 0.5 ) // && edgeMode
-                                                                                                          // == 1)
-                {
-                  MarkRuptureFaceFromEdge( iEdge, trailFaceID,
-                                           nodeManager,
-                                           edgeManager,
-                                           faceManager,
-                                           elementManager,
-                                           vecTipNorm,
-                                           vecTip,
-                                           modifiedObjects,
-                                           edgeMode );
-                }
-              }
+          // the forces are gathered on the nodes of the edge and on the trailing nodes of its fracture faces
+          for( localIndex const iface : edgeToFaceMap[ iEdge ] )
+          {
+            if( faceIsExternal[iface] >= 1 )
+            {
+              candidateNodes.insert( candidateNodes.end(), faceToNodeMap[ iface ].begin(), faceToNodeMap[ iface ].end() );
             }
           }
         }
       }
     }
+
+    std::sort( candidateNodes.begin(), candidateNodes.end() );
+    candidateNodes.erase( std::unique( candidateNodes.begin(), candidateNodes.end() ), candidateNodes.end() );
+    ComputeElementNodalForces( domain, nodeManager, elementManager, candidateNodes );
+
+    localIndex const numCandidateEdges = LvArray::integerConversion< localIndex >( candidateEdges.size() );
+    std::vector< realT > edgeSIF( numCandidateEdges );
+    std::vector< localIndex > trailFaceIDs( numCandidateEdges );
+    std::vector< R1Tensor > vecTipNorms( numCandidateEdges );
+    std::vector< R1Tensor > vecTips( numCandidateEdges );
+
+    forAll< parallelHostPolicy >( numCandidateEdges, [&]( localIndex const k )
+    {
+      edgeSIF[k] = CalculateEdgeSIF( domain, candidateEdges[k], trailFaceIDs[k],
+                                     nodeManager,
+                                     edgeManager,
+                                     faceManager,
+                                     elementManager,
+                                     vecTipNorms[k],
+                                     vecTips[k] );
+    } );
+
+    ModifiedObjectLists modifiedObjects;
+    for( localIndex k = 0; k < numCandidateEdges; ++k )
+    {
+      localIndex const iEdge = candidateEdges[k];
+      if( edgeSIF[k] >  MinimumToughnessOnEdge( iEdge, nodeManager, edgeManager, faceManager ) * 0.5 ) // && edgeMode
+                                                                                                       // == 1)
+      {
+        MarkRuptureFaceFromEdge( iEdge, trailFaceIDs[k],
+                                 nodeManager,
+                                 edgeManager,
+                                 faceManager,
+                                 elementManager,
+                                 vecTipNorms[k],
+                                 vecTips[k],
+                                 modifiedObjects,
+                                 edgeModes[k] );
+      }
+    }
   }
   else
   {
@@ -2826,45 +3192,22 @@ void SurfaceGenerator::CalculateNodeAndFaceSIF( DomainPartition & domain,
   arrayView1d< localIndex const > const & childNodeIndices = nodeManager.getExtrinsicData< extrinsicMeshData::ChildIndex >();
   arrayView1d< localIndex > const & parentNodeIndices = nodeManager.getExtrinsicData< extrinsicMeshData::ParentIndex >();
 
-  ConstitutiveManager const * const cm = domain.getConstitutiveManager();
-  ConstitutiveBase const * const solid  = cm->GetConstitutiveRelation< ConstitutiveBase >( m_solidMaterialNames[0] );
-  GEOSX_ERROR_IF( solid == nullptr, "constitutive model " + m_solidMaterialNames[0] + " not found" );
-  m_solidMaterialFullIndex = solid->getIndexInParent();
-
-  ConstitutiveManager * const constitutiveManager =
-    domain.GetGroup< ConstitutiveManager >( keys::ConstitutiveManager );
-
-  ElementRegionManager::MaterialViewAccessor< arrayView1d< real64 const > > const shearModulus =
-    elementManager.ConstructFullMaterialViewAccessor< array1d< real64 >, arrayView1d< real64 const > >( "ShearModulus", constitutiveManager );
-
-  ElementRegionManager::MaterialViewAccessor< arrayView1d< real64 const > > const bulkModulus =
-    elementManager.ConstructFullMaterialViewAccessor< array1d< real64 >, arrayView1d< real64 const > >( "BulkModulus", constitutiveManager );
-
-  ElementRegionManager::MaterialViewAccessor< arrayView3d< real64 const, solid::STRESS_USD > > const
-  stress = elementManager.ConstructFullMaterialViewAccessor< array3d< real64, solid::STRESS_PERMUTATION >,
-                                                             arrayView3d< real64 const, solid::STRESS_USD > >( SolidBase::viewKeyStruct::stressString,
-                                                                                                               constitutiveManager );
-
-
-  ElementRegionManager::ElementViewAccessor< arrayView4d< real64 const > > const
-  dNdX = elementManager.ConstructViewAccessor< array4d< real64 >, arrayView4d< real64 const > >( keys::dNdX );
-
-  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const
-  detJ = elementManager.ConstructViewAccessor< array2d< real64 >, arrayView2d< real64 const > >( keys::detJ );
-
-
-
   nodeManager.totalDisplacement().move( LvArray::MemorySpace::CPU, false );
-  elementManager.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+  displacement.move( LvArray::MemorySpace::CPU, false );
+
+  // the forces of the elements around the tip nodes are computed once, then gathered for each trailing face
+  std::vector< localIndex > ownedTipNodes;
+  for( localIndex const nodeIndex : m_tipNodes )
   {
-    for( localIndex mat=0; mat<m_solidMaterialNames.size(); ++mat )
+    if( isNodeGhost[nodeIndex] < 0 )
     {
-      subRegion.getConstitutiveModel( m_solidMaterialNames[mat] )->
-        getReference< array3d< real64, solid::STRESS_PERMUTATION > >( SolidBase::viewKeyStruct::stressString ).move( LvArray::MemorySpace::CPU,
-                                                                                                                     false );
+      ownedTipNodes.emplace_back( nodeIndex );
     }
-  } );
-  displacement.move( LvArray::MemorySpace::CPU, false );
+  }
+  ComputeElementNodalForces( domain, nodeManager, elementManager, ownedTipNodes );
+
+  ElementRegionManager::MaterialViewAccessor< arrayView1d< real64 const > > const & shearModulus = m_elementNodalForces.shearModulus;
+  ElementRegionManager::MaterialViewAccessor< arrayView1d< real64 const > > const & bulkModulus = m_elementNodalForces.bulkModulus;
 
 
   for( localIndex const trailingFaceIndex : m_trailingFaces )
@@ -2922,12 +3265,6 @@ void SurfaceGenerator::CalculateNodeAndFaceSIF( DomainPartition & domain,
 
             arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elementsToNodes = elementSubRegion->nodeList();
             arrayView2d< real64 const > const & elementCenter = elementSubRegion->getElementCenter().toViewConst();
-            realT K = bulkModulus[er][esr][m_solidMaterialFullIndex][ei];
-            realT G = shearModulus[er][esr][m_solidMaterialFullIndex][ei];
-            realT youngsModulus = 9 * K * G / ( 3 * K + G );
-            realT poissonRatio = ( 3 * K - 2 * G ) / ( 2 * ( 3 * K + G ) );
-
-            localIndex const numQuadraturePoints = detJ[er][esr].size( 1 );
 
             for( localIndex n=0; n<elementsToNodes.size( 1 ); ++n )
             {
@@ -2936,18 +3273,7 @@ void SurfaceGenerator::CalculateNodeAndFaceSIF( DomainPartition & domain,
                 R1Tensor temp;
                 R1Tensor xEle = elementCenter[ei];
 
-                SolidMechanicsLagrangianFEMKernels::ExplicitKernel::
-                  CalculateSingleNodalForce( ei,
-                                             n,
-                                             numQuadraturePoints,
-                                             dNdX[er][esr],
-                                             detJ[er][esr],
-                                             stress[er][esr][m_solidMaterialFullIndex],
-                                             temp );
-
-                //wu40: the nodal force need to be weighted by Young's modulus and possion's ratio.
-                temp *= youngsModulus;
-                temp /= (1 - poissonRatio * poissonRatio);
+                GetElementNodalForce( er, esr, ei, n, temp );
 
                 xEle -= nodePosition;
                 if( Dot( xEle, faceNormalVector ) > 0 ) //TODO: check the sign.
@@ -3627,7 +3953,7 @@ realT SurfaceGenerator::CalculateEdgeSIF( DomainPartition & domain,
 }
 
 
-int SurfaceGenerator::CalculateElementForcesOnEdge( DomainPartition & domain,
+int SurfaceGenerator::CalculateElementForcesOnEdge( DomainPartition & GEOSX_UNUSED_PARAM( domain ),
                                                     const localIndex edgeID,
                                                     realT edgeLength,
                                                     localIndex_array & nodeIndices,
@@ -3648,33 +3974,10 @@ int SurfaceGenerator::CalculateElementForcesOnEdge( DomainPartition & domain,
 
   arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & X = nodeManager.referencePosition();
 
-  ConstitutiveManager const * const cm = domain.getConstitutiveManager();
-  ConstitutiveBase const * const solid  = cm->GetConstitutiveRelation< ConstitutiveBase >( m_solidMaterialNames[0] );
-  GEOSX_ERROR_IF( solid == nullptr, "constitutive model " + m_solidMaterialNames[0] + " not found" );
-  m_solidMaterialFullIndex = solid->getIndexInParent();
-
-  ConstitutiveManager * const constitutiveManager =
-    domain.GetGroup< ConstitutiveManager >( keys::ConstitutiveManager );
-
-  ElementRegionManager::MaterialViewAccessor< arrayView1d< real64 const > > const shearModulus =
-    elementManager.ConstructFullMaterialViewAccessor< array1d< real64 >, arrayView1d< real64 const > >( "ShearModulus", constitutiveManager );
-
-  ElementRegionManager::MaterialViewAccessor< arrayView1d< real64 const > > const bulkModulus =
-    elementManager.ConstructFullMaterialViewAccessor< array1d< real64 >, arrayView1d< real64 const > >( "BulkModulus", constitutiveManager );
-
-  ElementRegionManager::MaterialViewAccessor< arrayView3d< real64 const, solid::STRESS_USD > > const
-  stress = elementManager.ConstructFullMaterialViewAccessor< array3d< real64, solid::STRESS_PERMUTATION >,
-                                                             arrayView3d< real64 const, solid::STRESS_USD > >( SolidBase::viewKeyStruct::stressString,
-                                                                                                               constitutiveManager );
-
-  ElementRegionManager::ElementViewAccessor< arrayView4d< real64 const > > const
-  dNdX = elementManager.ConstructViewAccessor< array4d< real64 >, arrayView4d< real64 const > >( keys::dNdX );
-
-  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const
-  detJ = elementManager.ConstructViewAccessor< array2d< real64 >, arrayView2d< real64 const > >( keys::detJ );
-
-  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const elemCenter =
-    elementManager.ConstructViewAccessor< array2d< real64 >, arrayView2d< real64 const > >( ElementSubRegionBase::viewKeyStruct::elementCenterString );
+  // the accessors and the element forces are set up by ComputeElementNodalForces
+  ElementRegionManager::MaterialViewAccessor< arrayView1d< real64 const > > const & shearModulus = m_elementNodalForces.shearModulus;
+  ElementRegionManager::MaterialViewAccessor< arrayView1d< real64 const > > const & bulkModulus = m_elementNodalForces.bulkModulus;
+  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > const & elemCenter = m_elementNodalForces.elemCenter;
 
   localIndex nElemEachSide[2];
   nElemEachSide[0] = 0;
@@ -3713,14 +4016,10 @@ int SurfaceGenerator::CalculateElementForcesOnEdge( DomainPartition & domain,
       x0_xEle -= X[edgeToNodeMap[edgeID][1]];
       udist = Dot( x0_x1, x0_xEle );
 
-      localIndex const numQuadraturePoints = detJ[er][esr].size( 1 );
-
-
       if(( udist <= edgeLength && udist > 0.0 ) || threeNodesPinched )
       {
         realT K = bulkModulus[er][esr][m_solidMaterialFullIndex][ei];
         realT G = shearModulus[er][esr][m_solidMaterialFullIndex][ei];
-        realT youngsModulus = 9 * K * G / ( 3 * K + G );
         realT poissonRatio = ( 3 * K - 2 * G ) / ( 2 * ( 3 * K + G ) );
 
         arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elementsToNodes = elementSubRegion->nodeList();
@@ -3733,18 +4032,7 @@ int SurfaceGenerator::CalculateElementForcesOnEdge( DomainPartition & domain,
                                             // repeated indices and the following may run multiple
                                             // times for the same element.
 
-            //wu40: the nodal force need to be weighted by Young's modulus and possion's ratio.
-            SolidMechanicsLagrangianFEMKernels::ExplicitKernel::
-              CalculateSingleNodalForce( ei,
-                                         n,
-                                         numQuadraturePoints,
-                                         dNdX[er][esr],
-                                         detJ[er][esr],
-                                         stress[er][esr][m_solidMaterialFullIndex],
-                                         temp );
-
-            temp *= youngsModulus;
-            temp /= (1 - poissonRatio * poissonRatio);
+            GetElementNodalForce( er, esr, ei, n, temp );
 
             if( !calculatef_u )
             {
@@ -3815,6 +4103,198 @@ int SurfaceGenerator::CalculateElementForcesOnEdge( DomainPartition & domain,
   return 0;
 }
 
+/**
+ * @brief compute the nodal force of a cell element from its stress, weighted by E / ( 1 - nu^2 )
+ * @param ei the index of the element
+ * @param n the index of the node in the element
+ * @param dNdX the shape function derivatives of the sub-region
+ * @param detJ the jacobian determinants of the sub-region
+ * @param stress the stress of the sub-region
+ * @param K the bulk modulus of the element
+ * @param G the shear modulus of the element
+ * @param force the nodal force
+ */
+static void CalculateWeightedNodalForce( localIndex const ei,
+                                         localIndex const n,
+                                         arrayView4d< real64 const > const & dNdX,
+                                         arrayView2d< real64 const > const & detJ,
+                                         arrayView3d< solid::STATE_TYPE const, solid::STRESS_USD > const & stress,
+                                         real64 const K,
+                                         real64 const G,
+                                         R1Tensor & force )
+{
+  real64 const youngsModulus = 9 * K * G / ( 3 * K + G );
+  real64 const poissonRatio = ( 3 * K - 2 * G ) / ( 2 * ( 3 * K + G ) );
+
+  force = 0.0;
+  SolidMechanicsLagrangianFEMKernels::ExplicitKernel::
+    CalculateSingleNodalForce( ei, n, detJ.size( 1 ), dNdX, detJ, stress, force );
+
+  //wu40: the nodal force need to be weighted by Young's modulus and possion's ratio.
+  force *= youngsModulus;
+  force /= (1 - poissonRatio * poissonRatio);
+}
+
+void SurfaceGenerator::ComputeElementNodalForces( DomainPartition & domain,
+                                                  NodeManager & nodeManager,
+                                                  ElementRegionManager & elementManager,
+                                                  std::vector< localIndex > const & nodes )
+{
+  GEOSX_MARK_FUNCTION;
+
+  ConstitutiveManager const * const cm = domain.getConstitutiveManager();
+  ConstitutiveBase const * const solid  = cm->GetConstitutiveRelation< ConstitutiveBase >( m_solidMaterialNames[0] );
+  GEOSX_ERROR_IF( solid == nullptr, "constitutive model " + m_solidMaterialNames[0] + " not found" );
+  LinearElasticIsotropic const * const elasticSolid = dynamicCast< LinearElasticIsotropic const * >( solid );
+  GEOSX_ERROR_IF( elasticSolid != nullptr && elasticSolid->hasMaterialTable(),
+                  "constitutive model " + m_solidMaterialNames[0] + " must store its moduli per element" );
+  m_solidMaterialFullIndex = solid->getIndexInParent();
+
+  ConstitutiveManager * const constitutiveManager =
+    domain.GetGroup< ConstitutiveManager >( keys::ConstitutiveManager );
+
+  elementManager.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+  {
+    for( localIndex mat=0; mat<m_solidMaterialNames.size(); ++mat )
+    {
+      subRegion.getConstitutiveModel( m_solidMaterialNames[mat] )->
+        getReference< array3d< solid::STATE_TYPE, solid::STRESS_PERMUTATION > >( SolidBase::viewKeyStruct::stressString ).move( LvArray::MemorySpace::CPU,
+                                                                                                                     false );
+    }
+  } );
+
+  ElementNodalForces & elementForces = m_elementNodalForces;
+
+  elementForces.shearModulus =
+    elementManager.ConstructFullMaterialViewAccessor< array1d< real64 >, arrayView1d< real64 const > >( "ShearModulus", constitutiveManager );
+
+  elementForces.bulkModulus =
+    elementManager.ConstructFullMaterialViewAccessor< array1d< real64 >, arrayView1d< real64 const > >( "BulkModulus", constitutiveManager );
+
+  elementForces.stress =
+    elementManager.ConstructFullMaterialViewAccessor< array3d< solid::STATE_TYPE, solid::STRESS_PERMUTATION >,
+                                                      arrayView3d< solid::STATE_TYPE const, solid::STRESS_USD > >( SolidBase::viewKeyStruct::stressString,
+                                                                                                        constitutiveManager );
+
+  elementForces.dNdX = elementManager.ConstructViewAccessor< array4d< real64 >, arrayView4d< real64 const > >( keys::dNdX );
+
+  elementForces.detJ = elementManager.ConstructViewAccessor< array2d< real64 >, arrayView2d< real64 const > >( keys::detJ );
+
+  elementForces.elemCenter =
+    elementManager.ConstructViewAccessor< array2d< real64 >, arrayView2d< real64 const > >( ElementSubRegionBase::viewKeyStruct::elementCenterString );
+
+  ArrayOfArraysView< localIndex const > const & nodeToRegionMap = nodeManager.elementRegionList().toViewConst();
+  ArrayOfArraysView< localIndex const > const & nodeToSubRegionMap = nodeManager.elementSubRegionList().toViewConst();
+  ArrayOfArraysView< localIndex const > const & nodeToElementMap = nodeManager.elementList().toViewConst();
+
+  // give a slot to each element attached to the nodes
+  localIndex maxSubRegions = 0;
+  elementForces.slot.resize( elementManager.numRegions() );
+  elementForces.forces.resize( elementManager.numRegions() );
+  for( localIndex er = 0; er < elementManager.numRegions(); ++er )
+  {
+    localIndex const numSubRegions = elementManager.GetRegion( er )->numSubRegions();
+    maxSubRegions = std::max( maxSubRegions, numSubRegions );
+    elementForces.slot[er].resize( numSubRegions );
+    elementForces.forces[er].resize( numSubRegions );
+  }
+  array2d< localIndex > numSlots( elementManager.numRegions(), maxSubRegions );
+
+  elementManager.forElementSubRegionsComplete< CellElementSubRegion >( [&]( localIndex const er,
+                                                                            localIndex const esr,
+                                                                            ElementRegionBase &,
+                                                                            CellElementSubRegion & subRegion )
+  {
+    elementForces.slot[er][esr].resize( subRegion.size() );
+    elementForces.slot[er][esr].setValues< serialPolicy >( -1 );
+  } );
+
+  localIndex_array slotRegion;
+  localIndex_array slotSubRegion;
+  localIndex_array slotElement;
+  for( localIndex const nodeIndex : nodes )
+  {
+    for( localIndex k=0; k<nodeToRegionMap.sizeOfArray( nodeIndex ); ++k )
+    {
+      localIndex const er  = nodeToRegionMap[nodeIndex][k];
+      localIndex const esr = nodeToSubRegionMap[nodeIndex][k];
+      localIndex const ei  = nodeToElementMap[nodeIndex][k];
+
+      localIndex & slot = elementForces.slot[er][esr][ei];
+      if( slot < 0 )
+      {
+        slot = numSlots( er, esr )++;
+        slotRegion.emplace_back( er );
+        slotSubRegion.emplace_back( esr );
+        slotElement.emplace_back( ei );
+      }
+    }
+  }
+
+  elementManager.forElementSubRegionsComplete< CellElementSubRegion >( [&]( localIndex const er,
+                                                                            localIndex const esr,
+                                                                            ElementRegionBase &,
+                                                                            CellElementSubRegion & subRegion )
+  {
+    elementForces.forces[er][esr].resize( numSlots( er, esr ), subRegion.nodeList().size( 1 ), 3 );
+  } );
+
+  // compute the forces of the elements concurrently
+  forAll< parallelHostPolicy >( slotElement.size(), [&]( localIndex const k )
+  {
+    localIndex const er  = slotRegion[k];
+    localIndex const esr = slotSubRegion[k];
+    localIndex const ei  = slotElement[k];
+    localIndex const slot = elementForces.slot[er][esr][ei];
+
+    array3d< real64 > & forces = elementForces.forces[er][esr];
+    for( localIndex n = 0; n < forces.size( 1 ); ++n )
+    {
+      R1Tensor force;
+      CalculateWeightedNodalForce( ei,
+                                   n,
+                                   elementForces.dNdX[er][esr],
+                                   elementForces.detJ[er][esr],
+                                   elementForces.stress[er][esr][m_solidMaterialFullIndex],
+                                   elementForces.bulkModulus[er][esr][m_solidMaterialFullIndex][ei],
+                                   elementForces.shearModulus[er][esr][m_solidMaterialFullIndex][ei],
+                                   force );
+      for( int d = 0; d < 3; ++d )
+      {
+        forces( slot, n, d ) = force[d];
+      }
+    }
+  } );
+}
+
+void SurfaceGenerator::GetElementNodalForce( localIndex const er,
+                                             localIndex const esr,
+                                             localIndex const ei,
+                                             localIndex const n,
+                                             R1Tensor & force ) const
+{
+  ElementNodalForces const & elementForces = m_elementNodalForces;
+  localIndex const slot = elementForces.slot[er][esr][ei];
+  if( slot >= 0 )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      force[d] = elementForces.forces[er][esr]( slot, n, d );
+    }
+    return;
+  }
+
+  // the elements away from the nodes given to ComputeElementNodalForces are rarely needed
+  CalculateWeightedNodalForce( ei,
+                               n,
+                               elementForces.dNdX[er][esr],
+                               elementForces.detJ[er][esr],
+                               elementForces.stress[er][esr][m_solidMaterialFullIndex],
+                               elementForces.bulkModulus[er][esr][m_solidMaterialFullIndex][ei],
+                               elementForces.shearModulus[er][esr][m_solidMaterialFullIndex][ei],
+                               force );
+}
+
 int SurfaceGenerator::CheckOrphanElement ( ElementRegionManager & elementManager,
                                            FaceManager & faceManager,
                                            localIndex iFace )
@@ -4209,11 +4689,20 @@ void SurfaceGenerator::PostUpdateRuptureStates( NodeManager & nodeManager,
                                                 EdgeManager & edgeManager,
                                                 FaceManager & faceManager,
                                                 ElementRegionManager & GEOSX_UNUSED_PARAM( elementManager ),
-                                                std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                                                std::vector< std::set< localIndex > > & edgesToRupturedFaces )
+                                                std::vector< FlatSet< localIndex > > & nodesToRupturedFaces,
+                                                std::vector< FlatSet< localIndex > > & edgesToRupturedFaces )
 {
   ArrayOfArraysView< localIndex const > const & faceToNodeMap = faceManager.nodeList().toViewConst();
   ArrayOfArraysView< localIndex const > const & faceToEdgeMap = faceManager.edgeList().toViewConst();
+  // the sets are emptied rather than destroyed, to reuse their memory from the previous separation pass
+  for( FlatSet< localIndex > & rupturedFaces : nodesToRupturedFaces )
+  {
+    rupturedFaces.clear();
+  }
+  for( FlatSet< localIndex > & rupturedFaces : edgesToRupturedFaces )
+  {
+    rupturedFaces.clear();
+  }
   nodesToRupturedFaces.resize( nodeManager.size() );
   edgesToRupturedFaces.resize( edgeManager.size() );
 
@@ -4406,16 +4895,16 @@ realT SurfaceGenerator::MinimumToughnessOnNode( const localIndex nodeID,
 }
 
 void SurfaceGenerator::AssignNewGlobalIndicesSerial( ObjectManagerBase & object,
-                                                     std::set< localIndex > const & indexList )
+                                                     FlatSet< localIndex > const & indexList )
 {
-  // in serial, we can simply loop over the indexList and assign new global indices based on
-  // the value of the maxGlobalIndex() + 1;
+  // in serial, we can simply loop over the indexList and assign consecutive new global indices
+  // starting from the value of the maxGlobalIndex() + 1, since maxGlobalIndex() is only updated
+  // by SetMaxGlobalIndex().
   arrayView1d< globalIndex > const & localToGlobal = object.localToGlobalMap();
+  globalIndex newGlobalIndex = object.maxGlobalIndex() + 1;
   for( localIndex const newLocalIndex : indexList )
   {
-    globalIndex const newGlobalIndex = object.maxGlobalIndex() + 1;
-
-    localToGlobal[newLocalIndex] = newGlobalIndex;
+    localToGlobal[newLocalIndex] = newGlobalIndex++;
     object.updateGlobalToLocalMap( newLocalIndex );
   }
 
@@ -4424,17 +4913,18 @@ void SurfaceGenerator::AssignNewGlobalIndicesSerial( ObjectManagerBase & object,
 
 void SurfaceGenerator::
   AssignNewGlobalIndicesSerial( ElementRegionManager & elementManager,
-                                map< std::pair< localIndex, localIndex >, std::set< localIndex > > const & newElems )
+                                map< std::pair< localIndex, localIndex >, FlatSet< localIndex > > const & newElems )
 {
-  // in serial, we can simply iterate over the entries in newElems and assign new global indices based on
-  // the value of the maxGlobalIndex() + 1 for the ElementRegionManager.
+  // in serial, we can simply iterate over the entries in newElems and assign consecutive new global indices
+  // starting from the value of the maxGlobalIndex() + 1 for the ElementRegionManager.
+  globalIndex newGlobalIndex = elementManager.maxGlobalIndex() + 1;
 
   // loop over entries of newElems, which gives elementRegion/subRegion local indices
   for( auto const & iter : newElems )
   {
     localIndex const er = iter.first.first;
     localIndex const esr = iter.first.second;
-    std::set< localIndex > const & indexList = iter.second;
+    FlatSet< localIndex > const & indexList = iter.second;
 
     ElementSubRegionBase * const subRegion = elementManager.GetRegion( er )->GetSubRegion( esr );
     arrayView1d< globalIndex > const & localToGlobal = subRegion->localToGlobalMap();
@@ -4442,9 +4932,7 @@ void SurfaceGenerator::
     // loop over the new elems in the subRegion
     for( localIndex const newLocalIndex : indexList )
     {
-      globalIndex const newGlobalIndex = elementManager.maxGlobalIndex() + 1;
-
-      localToGlobal[newLocalIndex] = newGlobalIndex;
+      localToGlobal[newLocalIndex] = newGlobalIndex++;
       subRegion->updateGlobalToLocalMap( newLocalIndex );
     }
   }
@@ -21,20 +21,21 @@
 #include "mpiCommunications/NeighborCommunicator.hpp"
 #include "physicsSolvers/SolverBase.hpp"
 #include "managers/DomainPartition.hpp"
+#include "common/FlatContainers.hpp"
 
 namespace geosx
 {
 
 struct ModifiedObjectLists
 {
-  std::set< localIndex > newNodes;
-  std::set< localIndex > newEdges;
-  std::set< localIndex > newFaces;
-  std::set< localIndex > modifiedNodes;
-  std::set< localIndex > modifiedEdges;
-  std::set< localIndex > modifiedFaces;
-  map< std::pair< localIndex, localIndex >, std::set< localIndex > > newElements;
-  map< std::pair< localIndex, localIndex >, std::set< localIndex > > modifiedElements;
+  FlatSet< localIndex > newNodes;
+  FlatSet< localIndex > newEdges;
+  FlatSet< localIndex > newFaces;
+  FlatSet< localIndex > modifiedNodes;
+  FlatSet< localIndex > modifiedEdges;
+  FlatSet< localIndex > modifiedFaces;
+  map< std::pair< localIndex, localIndex >, FlatSet< localIndex > > newElements;
+  map< std::pair< localIndex, localIndex >, FlatSet< localIndex > > modifiedElements;
 
   void clearNewFromModified();
 
@@ -93,6 +94,9 @@ public:
 
   /**@}*/
 
+  /// The faces are split and new nodes and edges are created during the simulation.
+  virtual bool changesMeshTopology() const override { return true; }
+
 
   int SeparationDriver( DomainPartition & domain,
                         MeshLevel & mesh,
@@ -108,7 +112,7 @@ public:
    * @param[in] indexList the list of local indices that need new global indices
    */
   void AssignNewGlobalIndicesSerial( ObjectManagerBase & object,
-                                     std::set< localIndex > const & indexList );
+                                     FlatSet< localIndex > const & indexList );
 
 
   /**
@@ -118,12 +122,26 @@ public:
    */
   void
   AssignNewGlobalIndicesSerial( ElementRegionManager & elementManager,
-                                map< std::pair< localIndex, localIndex >, std::set< localIndex > > const & indexList );
+                                map< std::pair< localIndex, localIndex >, FlatSet< localIndex > > const & indexList );
 
   // SortedArray< localIndex > & getSurfaceElementsRupturedThisSolve() { return m_faceElemsRupturedThisSolve; }
 
   inline string const getFractureRegionName() const { return m_fractureRegionName; }
 
+  /**
+   * @brief synchronize the rupture state of the ghost faces, only sending the faces changed since the last call
+   * @param mesh
+   * @param neighbors
+   *
+   * The owned faces whose rupture state differs from the last synchronized one are sent to the neighbors ghosting
+   * them, and the ghost faces written to by this rank since the last synchronization are reset to the value last
+   * received from their owner, so that the ghosts end up with the same values as with a full synchronization.
+   * The full synchronization is done at the first call, and when the ghost lists of the faces changed, which is
+   * detected from the neighbor ranks and the sizes and hashes of the lists.
+   */
+  void SynchronizeRuptureState( MeshLevel & mesh,
+                                std::vector< NeighborCommunicator > & neighbors );
+
 protected:
 
   virtual void InitializePostInitialConditions_PreSubGroups( Group * const problemManager ) override final;
@@ -211,6 +229,34 @@ private:
                                      bool threeNodesPinched,
                                      bool calculatef_u );
 
+  /**
+   * @brief compute the nodal forces of the cell elements attached to a set of nodes
+   * @param domain
+   * @param nodeManager
+   * @param elementManager
+   * @param nodes the nodes whose elements have their forces computed, concurrently
+   *
+   * The forces of the other elements are computed when they are requested by GetElementNodalForce.
+   */
+  void ComputeElementNodalForces( DomainPartition & domain,
+                                  NodeManager & nodeManager,
+                                  ElementRegionManager & elementManager,
+                                  std::vector< localIndex > const & nodes );
+
+  /**
+   * @brief get the nodal force of a cell element, computed from its stress and weighted by E / ( 1 - nu^2 )
+   * @param er the region of the element
+   * @param esr the sub-region of the element
+   * @param ei the index of the element
+   * @param n the index of the node in the element
+   * @param force the nodal force
+   */
+  void GetElementNodalForce( localIndex const er,
+                             localIndex const esr,
+                             localIndex const ei,
+                             localIndex const n,
+                             R1Tensor & force ) const;
+
   /**
    * @brief
    * @param edgeID
@@ -262,8 +308,8 @@ private:
                                 EdgeManager & edgeManager,
                                 FaceManager & faceManager,
                                 ElementRegionManager & elementManager,
-                                std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                                std::vector< std::set< localIndex > > & edgesToRupturedFaces );
+                                std::vector< FlatSet< localIndex > > & nodesToRupturedFaces,
+                                std::vector< FlatSet< localIndex > > & edgesToRupturedFaces );
 
   /**
    *
@@ -293,6 +339,43 @@ private:
 
 //  void UpdatePathCheckingArrays();
 
+  /**
+   * @struct NodeSeparation
+   * @brief Separation path of a node and its working containers, filled by FindFracturePlanes().
+   */
+  struct NodeSeparation
+  {
+    /// whether a separation path was found, when the node is processed concurrently
+    bool found = false;
+
+    /// the error met by the search of the path, reported by the caller since the search may run on a worker thread
+    string error;
+
+    /// faces of the separation path of the node
+    FlatSet< localIndex > separationPathFaces;
+    /// side of the separation path of the edges attached to the node
+    FlatMap< localIndex, int > edgeLocations;
+    /// side of the separation path of the faces attached to the node
+    FlatMap< localIndex, int > faceLocations;
+    /// side of the separation path of the elements attached to the node
+    FlatMap< std::pair< CellElementSubRegion *, localIndex >, int > elemLocations;
+
+    /// elements attached to the node
+    FlatSet< std::pair< CellElementSubRegion *, localIndex > > nodeToElements;
+    /// ruptured faces attached to the node that can be part of the separation path
+    FlatSet< localIndex > nodeToRuptureReadyFaces;
+    /// ruptured faces attached to the edges of the node that can be part of the separation path
+    FlatMap< localIndex, FlatSet< localIndex > > edgesToRuptureReadyFaces;
+    /// edges of the original faces of the node attached to the node
+    FlatMap< localIndex, std::pair< localIndex, localIndex > > nodeLocalFacesToEdges;
+    /// edges of the current faces of the node attached to the node
+    FlatMap< localIndex, std::pair< localIndex, localIndex > > localFacesToEdges;
+    /// position of the faces in the separation path
+    FlatMap< localIndex, int > facesInPath;
+    /// position of the edges in the separation path
+    FlatMap< localIndex, int > edgesInPath;
+  };
+
   /**
    * @brief check and split node in mesh
    * @param nodeID
@@ -313,8 +396,8 @@ private:
                     EdgeManager & edgeManager,
                     FaceManager & faceManager,
                     ElementRegionManager & elemManager,
-                    std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                    std::vector< std::set< localIndex > > & edgesToRupturedFaces,
+                    std::vector< FlatSet< localIndex > > & nodesToRupturedFaces,
+                    std::vector< FlatSet< localIndex > > & edgesToRupturedFaces,
                     ElementRegionManager & elementManager,
                     ModifiedObjectLists & modifiedObjects,
                     const bool prefrac );
@@ -328,23 +411,45 @@ private:
    * @param elemManager
    * @param nodesToRupturedFaces
    * @param edgesToRupturedFaces
-   * @param separationPathFaces
-   * @param edgeLocations
-   * @param faceLocations
-   * @param elemLocations
+   * @param separation the separation path and the locations of the objects attached to the node
    * @return
+   *
+   * The mesh is only read, so that the nodes without common elements can be processed concurrently.
    */
   bool FindFracturePlanes( const localIndex nodeID,
                            const NodeManager & nodeManager,
                            const EdgeManager & edgeManager,
                            const FaceManager & faceManager,
                            ElementRegionManager & elemManager,
-                           const std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                           const std::vector< std::set< localIndex > > & edgesToRupturedFaces,
-                           std::set< localIndex > & separationPathFaces,
-                           map< localIndex, int > & edgeLocations,
-                           map< localIndex, int > & faceLocations,
-                           map< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations );
+                           const std::vector< FlatSet< localIndex > > & nodesToRupturedFaces,
+                           const std::vector< FlatSet< localIndex > > & edgesToRupturedFaces,
+                           NodeSeparation & separation );
+
+  /**
+   * @brief check and split all the nodes of the rank, processing concurrently the nodes without common elements
+   * @param time_np1
+   * @param nodeManager
+   * @param edgeManager
+   * @param faceManager
+   * @param elementManager
+   * @param nodesToRupturedFaces
+   * @param edgesToRupturedFaces
+   * @param modifiedObjects
+   * @return the number of splits
+   *
+   * The nodes are processed in rounds. Each round is split into batches of nodes without common elements, whose
+   * separation paths are independent: they are found concurrently, then the splits are performed in increasing
+   * order of the nodes, so that the new objects are numbered independently of the number of threads. The nodes
+   * split in a round, and the new nodes, are processed again in the next round.
+   */
+  int ProcessNodesConcurrently( real64 const time_np1,
+                                NodeManager & nodeManager,
+                                EdgeManager & edgeManager,
+                                FaceManager & faceManager,
+                                ElementRegionManager & elementManager,
+                                std::vector< FlatSet< localIndex > > & nodesToRupturedFaces,
+                                std::vector< FlatSet< localIndex > > & edgesToRupturedFaces,
+                                ModifiedObjectLists & modifiedObjects );
 
 
   /**
@@ -369,19 +474,19 @@ private:
                         FaceManager & faceManager,
                         ElementRegionManager & elementManager,
                         ModifiedObjectLists & modifiedObjects,
-                        std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                        std::vector< std::set< localIndex > > & edgesToRupturedFaces,
-                        const std::set< localIndex > & separationPathFaces,
-                        const map< localIndex, int > & edgeLocations,
-                        const map< localIndex, int > & faceLocations,
-                        const map< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations );
+                        std::vector< FlatSet< localIndex > > & nodesToRupturedFaces,
+                        std::vector< FlatSet< localIndex > > & edgesToRupturedFaces,
+                        const FlatSet< localIndex > & separationPathFaces,
+                        const FlatMap< localIndex, int > & edgeLocations,
+                        const FlatMap< localIndex, int > & faceLocations,
+                        const FlatMap< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations );
 
   void MapConsistencyCheck( const localIndex nodeID,
                             NodeManager const & nodeManager,
                             EdgeManager const & edgeManager,
                             FaceManager const & faceManager,
                             ElementRegionManager const & elementManager,
-                            const map< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations );
+                            const FlatMap< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations );
 
   /**
    * @brief function to set which side of the fracture plane all objects are on
@@ -395,14 +500,14 @@ private:
    * @param elemLocations
    * @return
    */
-  bool SetLocations( const std::set< localIndex > & separationPathFaces,
+  bool SetLocations( const FlatSet< localIndex > & separationPathFaces,
                      ElementRegionManager & elemManager,
                      const FaceManager & faceManager,
-                     const std::set< std::pair< CellElementSubRegion *, localIndex > > & nodesToElements,
-                     const map< localIndex, std::pair< localIndex, localIndex > > & localFacesToEdges,
-                     map< localIndex, int > & edgeLocations,
-                     map< localIndex, int > & faceLocations,
-                     map< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations );
+                     const FlatSet< std::pair< CellElementSubRegion *, localIndex > > & nodesToElements,
+                     const FlatMap< localIndex, std::pair< localIndex, localIndex > > & localFacesToEdges,
+                     FlatMap< localIndex, int > & edgeLocations,
+                     FlatMap< localIndex, int > & faceLocations,
+                     FlatMap< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations );
 
   /**
    * @brief function to set which side of the fracture plane all objects are on
@@ -420,14 +525,14 @@ private:
    */
   bool SetElemLocations( const int side,
                          const std::pair< CellElementSubRegion *, localIndex > & elem,
-                         const std::set< localIndex > & separationPathFaces,
+                         const FlatSet< localIndex > & separationPathFaces,
                          ElementRegionManager & elemManager,
                          const FaceManager & faceManager,
-                         const std::set< std::pair< CellElementSubRegion *, localIndex > > & nodesToElements,
-                         const map< localIndex, std::pair< localIndex, localIndex > > & localFacesToEdges,
-                         map< localIndex, int > & edgeLocations,
-                         map< localIndex, int > & faceLocations,
-                         map< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations );
+                         const FlatSet< std::pair< CellElementSubRegion *, localIndex > > & nodesToElements,
+                         const FlatMap< localIndex, std::pair< localIndex, localIndex > > & localFacesToEdges,
+                         FlatMap< localIndex, int > & edgeLocations,
+                         FlatMap< localIndex, int > & faceLocations,
+                         FlatMap< std::pair< CellElementSubRegion *, localIndex >, int > & elemLocations );
 
   /**
    *
@@ -513,6 +618,7 @@ private:
     constexpr static auto trailingFacesString = "trailingFaces";
     constexpr static auto fractureRegionNameString = "fractureRegion";
     constexpr static auto mpiCommOrderString = "mpiCommOrder";
+    constexpr static auto concurrentNodeSeparationString = "concurrentNodeSeparation";
 
     //TODO: rock toughness should be a material parameter, and we need to make rock toughness to KIC a constitutive
     // relation.
@@ -543,6 +649,9 @@ private:
   // Flag for consistent communication ordering
   int m_mpiCommOrder;
 
+  /// Flag to process concurrently the nodes of the rank without common elements
+  integer m_concurrentNodeSeparation;
+
   /// set of separable faces
   SortedArray< localIndex > m_separableFaceSet;
 
@@ -580,6 +689,84 @@ private:
 
   SortedArray< localIndex > m_faceElemsRupturedThisSolve;
 
+  /// rupture state of the faces at the last synchronization
+  array1d< integer > m_syncedRuptureState;
+
+  /// rank, then size and hash of the face send and receive lists, of each neighbor at the last synchronization
+  array1d< std::uint64_t > m_syncedFaceGhostSignatures;
+
+  /// owned faces whose rupture state changed since the last synchronization
+  SortedArray< localIndex > m_ruptureStateChangedFaces;
+
+  /**
+   * @struct SeparationScratch
+   * @brief Working containers of the separation driver.
+   *
+   * They are cleared before each use instead of being rebuilt, so that they keep their capacity
+   * from one node to the next and the separation driver does not allocate once they have grown.
+   */
+  struct SeparationScratch
+  {
+    /// ruptured faces attached to each node, rebuilt at each separation pass
+    std::vector< FlatSet< localIndex > > nodesToRupturedFaces;
+    /// ruptured faces attached to each edge, rebuilt at each separation pass
+    std::vector< FlatSet< localIndex > > edgesToRupturedFaces;
+
+    /// separation of the node processed alone
+    NodeSeparation node;
+    /// separations of the nodes processed concurrently
+    std::vector< NodeSeparation > concurrentNodes;
+
+    /// new edge of each split edge
+    FlatMap< localIndex, localIndex > splitEdges;
+    /// new face of each split face
+    FlatMap< localIndex, localIndex > splitFaces;
+
+    /// nodes to process in the next round of the concurrent separation
+    std::vector< localIndex > pendingNodes;
+    /// nodes left to process in the current round of the concurrent separation
+    std::vector< localIndex > roundNodes;
+    /// nodes deferred to the next batches of the current round
+    std::vector< localIndex > deferredNodes;
+    /// nodes processed concurrently, without common element
+    std::vector< localIndex > batchNodes;
+    /// last batch of the round with a node attached to each cell element, numbered over the sub-regions
+    std::vector< localIndex > elementBatch;
+  };
+
+  /// working containers of the separation driver
+  SeparationScratch m_separationScratch;
+
+  /**
+   * @struct ElementNodalForces
+   * @brief Nodal forces of the cell elements, shared by the rupture criteria of the edges and nodes.
+   *
+   * The neighboring edges and nodes share elements, so the forces of each element are computed once per evaluation
+   * of the rupture criterion, instead of once per edge or node.
+   */
+  struct ElementNodalForces
+  {
+    /// shear modulus of the elements
+    ElementRegionManager::MaterialViewAccessor< arrayView1d< real64 const > > shearModulus;
+    /// bulk modulus of the elements
+    ElementRegionManager::MaterialViewAccessor< arrayView1d< real64 const > > bulkModulus;
+    /// stress at the quadrature points of the elements
+    ElementRegionManager::MaterialViewAccessor< arrayView3d< solid::STATE_TYPE const, solid::STRESS_USD > > stress;
+    /// shape function derivatives at the quadrature points of the elements
+    ElementRegionManager::ElementViewAccessor< arrayView4d< real64 const > > dNdX;
+    /// jacobian determinant at the quadrature points of the elements
+    ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > detJ;
+    /// center of the elements
+    ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > > elemCenter;
+    /// position of each element in the computed forces of its sub-region, -1 if they are not computed
+    array1d< array1d< array1d< localIndex > > > slot;
+    /// computed forces of each sub-region, indexed by the slot of the element, its local node and the direction
+    array1d< array1d< array3d< real64 > > > forces;
+  };
+
+  /// nodal forces of the cell elements for the evaluation of the rupture criterion
+  ElementNodalForces m_elementNodalForces;
+
 };
 
 } /* namespace geosx */
@@ -0,0 +1,168 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "codingUtilities/UnitTestUtilities.hpp"
+#include "managers/initialization.hpp"
+#include "managers/ProblemManager.hpp"
+#include "mesh/ExtrinsicMeshData.hpp"
+#include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/unitTests/testCompFlowUtils.hpp"
+#include "physicsSolvers/surfaceGeneration/SurfaceGenerator.hpp"
+
+#include <algorithm>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Solvers gravityVector=\"0.0, 0.0, 0.0\">\n"
+  "    <SolidMechanicsLagrangianSSLE name=\"lagsolve\"\n"
+  "                                  timeIntegrationOption=\"QuasiStatic\"\n"
+  "                                  discretization=\"FE1\"\n"
+  "                                  targetRegions=\"{ Domain }\"\n"
+  "                                  solidMaterialNames=\"{ rock }\"/>\n"
+  "    <SurfaceGenerator name=\"SurfaceGen\"\n"
+  "                      fractureRegion=\"Fracture\"\n"
+  "                      targetRegions=\"{ Domain }\"\n"
+  "                      solidMaterialNames=\"{ rock }\"\n"
+  "                      rockToughness=\"1e99\"/>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh1\"\n"
+  "                  elementTypes=\"{ C3D8 }\"\n"
+  "                  xCoords=\"{ -2, 2 }\"\n"
+  "                  yCoords=\"{ 0, 4 }\"\n"
+  "                  zCoords=\"{ 0, 2 }\"\n"
+  "                  nx=\"{ 4 }\"\n"
+  "                  ny=\"{ 4 }\"\n"
+  "                  nz=\"{ 2 }\"\n"
+  "                  cellBlockNames=\"{ cb1 }\"/>\n"
+  "  </Mesh>\n"
+  "  <Events maxTime=\"1.0\">\n"
+  "    <SoloEvent name=\"preFracture\"\n"
+  "               target=\"/Solvers/SurfaceGen\"/>\n"
+  "  </Events>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteElements>\n"
+  "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+  "    </FiniteElements>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"Domain\" cellBlocks=\"{ cb1 }\" materialList=\"{ rock }\"/>\n"
+  "    <SurfaceElementRegion name=\"Fracture\" defaultAperture=\"0.02e-3\" materialList=\"{ rock }\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <LinearElasticIsotropic name=\"rock\"\n"
+  "                            defaultDensity=\"2700\"\n"
+  "                            defaultBulkModulus=\"20.0e9\"\n"
+  "                            defaultShearModulus=\"12.0e9\"/>\n"
+  "  </Constitutive>\n"
+  "</Problem>";
+
+class RuptureStateSyncTest : public ::testing::Test
+{
+public:
+
+  RuptureStateSyncTest()
+    : problemManager( std::make_unique< ProblemManager >( "Problem", nullptr ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( *problemManager, xmlInput );
+    surfaceGenerator = problemManager->GetPhysicsSolverManager().GetGroup< SurfaceGenerator >( "SurfaceGen" );
+  }
+
+  std::unique_ptr< ProblemManager > problemManager;
+  SurfaceGenerator * surfaceGenerator;
+};
+
+TEST_F( RuptureStateSyncTest, incrementalMatchesFullSync )
+{
+  SKIP_TEST_IN_SERIAL( "the faces are only ghosted in parallel" );
+
+  DomainPartition & domain = *problemManager->getDomainPartition();
+  std::vector< NeighborCommunicator > & neighbors = domain.getNeighbors();
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  FaceManager & faceManager = *mesh.getFaceManager();
+
+  arrayView1d< integer > const & ruptureState = faceManager.getExtrinsicData< extrinsicMeshData::RuptureState >();
+  arrayView1d< integer const > const & faceGhostRank = faceManager.ghostRank();
+  arrayView1d< globalIndex const > const & localToGlobal = faceManager.localToGlobalMap();
+
+  localIndex numGhostFaces = 0;
+  for( localIndex kf = 0; kf < faceManager.size(); ++kf )
+  {
+    numGhostFaces += faceGhostRank[kf] >= 0 ? 1 : 0;
+  }
+  ASSERT_GT( MpiWrapper::Min( numGhostFaces ), 0 );
+
+  map< string, string_array > fieldNames;
+  fieldNames["face"].emplace_back( string( extrinsicMeshData::RuptureState::key ) );
+
+  // the first call is a full synchronization, the next ones only send the changes
+  surfaceGenerator->SynchronizeRuptureState( mesh, neighbors );
+
+  array1d< integer > incrementalState( faceManager.size() );
+  for( integer round = 1; round <= 4; ++round )
+  {
+    // the lists keep their sizes but change order, the next synchronization has to notice it
+    if( round == 3 )
+    {
+      for( NeighborCommunicator const & neighbor : neighbors )
+      {
+        NeighborData & neighborData = faceManager.getNeighborData( neighbor.NeighborRank() );
+        std::reverse( neighborData.ghostsToSend().begin(), neighborData.ghostsToSend().end() );
+        std::reverse( neighborData.ghostsToReceive().begin(), neighborData.ghostsToReceive().end() );
+      }
+    }
+
+    // a part of the owned faces ruptures, and the rank also writes to some of its ghosts as the separation does
+    for( localIndex kf = 0; kf < faceManager.size(); ++kf )
+    {
+      if( faceGhostRank[kf] < 0 && ( localToGlobal[kf] + round ) % 3 == 0 )
+      {
+        ruptureState[kf] = round;
+      }
+      else if( faceGhostRank[kf] >= 0 && kf % 2 == 0 )
+      {
+        ruptureState[kf] = -round;
+      }
+    }
+
+    surfaceGenerator->SynchronizeRuptureState( mesh, neighbors );
+    std::copy( ruptureState.begin(), ruptureState.end(), incrementalState.begin() );
+
+    CommunicationTools::SynchronizeFields( fieldNames, &mesh, neighbors );
+
+    for( localIndex kf = 0; kf < faceManager.size(); ++kf )
+    {
+      EXPECT_EQ( incrementalState[kf], ruptureState[kf] ) << "round " << round << ", face " << localToGlobal[kf];
+    }
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -0,0 +1,206 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "managers/initialization.hpp"
+#include "managers/ProblemManager.hpp"
+#include "mesh/ExtrinsicMeshData.hpp"
+#include "mesh/SurfaceElementRegion.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/unitTests/testCompFlowUtils.hpp"
+#include "physicsSolvers/surfaceGeneration/SurfaceGenerator.hpp"
+
+#if defined( GEOSX_USE_OPENMP )
+#include <omp.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+
+using namespace geosx;
+using namespace geosx::testing;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Solvers gravityVector=\"0.0, 0.0, 0.0\">\n"
+  "    <SolidMechanicsLagrangianSSLE name=\"lagsolve\"\n"
+  "                                  timeIntegrationOption=\"QuasiStatic\"\n"
+  "                                  discretization=\"FE1\"\n"
+  "                                  targetRegions=\"{ Domain }\"\n"
+  "                                  solidMaterialNames=\"{ rock }\"/>\n"
+  "    <SurfaceGenerator name=\"SurfaceGen\"\n"
+  "                      fractureRegion=\"Fracture\"\n"
+  "                      targetRegions=\"{ Domain }\"\n"
+  "                      solidMaterialNames=\"{ rock }\"\n"
+  "                      rockToughness=\"1e99\"/>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh1\"\n"
+  "                  elementTypes=\"{ C3D8 }\"\n"
+  "                  xCoords=\"{ -2, 2 }\"\n"
+  "                  yCoords=\"{ 0, 4 }\"\n"
+  "                  zCoords=\"{ 0, 2 }\"\n"
+  "                  nx=\"{ 4 }\"\n"
+  "                  ny=\"{ 4 }\"\n"
+  "                  nz=\"{ 2 }\"\n"
+  "                  cellBlockNames=\"{ cb1 }\"/>\n"
+  "  </Mesh>\n"
+  "  <Geometry>\n"
+  "    <Box name=\"fracture\" xMin=\"-0.01, -0.01, -0.01\" xMax=\" 0.01, 3.01, 2.01\"/>\n"
+  "    <Box name=\"core\" xMin=\"-0.01, -0.01, -0.01\" xMax=\" 0.01, 4.01, 2.01\"/>\n"
+  "  </Geometry>\n"
+  "  <Events maxTime=\"1.0\">\n"
+  "    <SoloEvent name=\"preFracture\"\n"
+  "               target=\"/Solvers/SurfaceGen\"/>\n"
+  "  </Events>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteElements>\n"
+  "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+  "    </FiniteElements>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"Domain\" cellBlocks=\"{ cb1 }\" materialList=\"{ rock }\"/>\n"
+  "    <SurfaceElementRegion name=\"Fracture\" defaultAperture=\"0.02e-3\" materialList=\"{ rock }\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <LinearElasticIsotropic name=\"rock\"\n"
+  "                            defaultDensity=\"2700\"\n"
+  "                            defaultBulkModulus=\"20.0e9\"\n"
+  "                            defaultShearModulus=\"12.0e9\"/>\n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification name=\"separableFace\" initialCondition=\"1\" setNames=\"{ core }\"\n"
+  "                        objectPath=\"faceManager\" fieldName=\"isFaceSeparable\" scale=\"1\"/>\n"
+  "    <FieldSpecification name=\"frac\" initialCondition=\"1\" setNames=\"{ fracture }\"\n"
+  "                        objectPath=\"faceManager\" fieldName=\"ruptureState\" scale=\"1\"/>\n"
+  "  </FieldSpecifications>\n"
+  "</Problem>";
+
+/**
+ * @brief What the separation leaves in the mesh, independent of the numbering of the new objects.
+ */
+struct SeparationResult
+{
+  real64 numSplits = 0;
+  localIndex numNodes = 0;
+  localIndex numFaces = 0;
+  /// the centers of the face elements, sorted
+  std::vector< std::array< real64, 3 > > faceElementCenters;
+  /// the centers of the ruptured faces, sorted
+  std::vector< std::array< real64, 3 > > rupturedFaceCenters;
+};
+
+/**
+ * @brief Parse the deck and split its initial fracture.
+ * @param concurrent whether the nodes are split with ProcessNodesConcurrently
+ * @param numThreads the number of threads of the concurrent search, 0 for the default
+ */
+SeparationResult separate( bool const concurrent, int const numThreads )
+{
+  ProblemManager problemManager( "Problem", nullptr );
+  setupProblemFromXML( problemManager, xmlInput );
+
+  SurfaceGenerator & surfaceGenerator =
+    *problemManager.GetPhysicsSolverManager().GetGroup< SurfaceGenerator >( "SurfaceGen" );
+  surfaceGenerator.getReference< integer >( "concurrentNodeSeparation" ) = concurrent;
+
+  DomainPartition & domain = *problemManager.getDomainPartition();
+
+#if defined( GEOSX_USE_OPENMP )
+  int const defaultNumThreads = omp_get_max_threads();
+  if( numThreads > 0 )
+  {
+    omp_set_num_threads( numThreads );
+  }
+#else
+  GEOSX_UNUSED_VAR( numThreads );
+#endif
+
+  SeparationResult result;
+  result.numSplits = surfaceGenerator.SolverStep( 0.0, 0.0, 0, domain );
+
+#if defined( GEOSX_USE_OPENMP )
+  omp_set_num_threads( defaultNumThreads );
+#endif
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  FaceManager & faceManager = *mesh.getFaceManager();
+  arrayView2d< real64 const > const & faceCenter = faceManager.faceCenter();
+  arrayView1d< integer const > const & ruptureState = faceManager.getExtrinsicData< extrinsicMeshData::RuptureState >();
+
+  result.numNodes = mesh.getNodeManager()->size();
+  result.numFaces = faceManager.size();
+
+  auto center = [&]( localIndex const kf )
+  {
+    return std::array< real64, 3 >{ { faceCenter( kf, 0 ), faceCenter( kf, 1 ), faceCenter( kf, 2 ) } };
+  };
+
+  FaceElementSubRegion const & fractureSubRegion =
+    *mesh.getElemManager()->GetRegion< SurfaceElementRegion >( "Fracture" )->GetSubRegion< FaceElementSubRegion >( 0 );
+  FaceElementSubRegion::FaceMapType const & faceList = fractureSubRegion.faceList();
+  for( localIndex kfe = 0; kfe < fractureSubRegion.size(); ++kfe )
+  {
+    result.faceElementCenters.emplace_back( center( faceList( kfe, 0 ) ) );
+  }
+  for( localIndex kf = 0; kf < faceManager.size(); ++kf )
+  {
+    if( ruptureState[kf] > 0 )
+    {
+      result.rupturedFaceCenters.emplace_back( center( kf ) );
+    }
+  }
+  std::sort( result.faceElementCenters.begin(), result.faceElementCenters.end() );
+  std::sort( result.rupturedFaceCenters.begin(), result.rupturedFaceCenters.end() );
+
+  return result;
+}
+
+void compareSeparations( SeparationResult const & result, SeparationResult const & reference )
+{
+  EXPECT_EQ( result.numSplits, reference.numSplits );
+  EXPECT_EQ( result.numNodes, reference.numNodes );
+  EXPECT_EQ( result.numFaces, reference.numFaces );
+  EXPECT_EQ( result.faceElementCenters, reference.faceElementCenters );
+  EXPECT_EQ( result.rupturedFaceCenters, reference.rupturedFaceCenters );
+}
+
+TEST( SurfaceGenerator, concurrentMatchesSerialSeparation )
+{
+  SeparationResult const serial = separate( false, 0 );
+
+  // the 3 x 2 ruptured faces of the initial fracture are each split into a face element
+  ASSERT_GT( serial.numSplits, 0 );
+  EXPECT_EQ( serial.faceElementCenters.size(), std::size_t( 6 ) );
+
+  compareSeparations( separate( true, 0 ), serial );
+}
+
+TEST( SurfaceGenerator, concurrentSeparationIndependentOfThreads )
+{
+  SeparationResult const oneThread = separate( true, 1 );
+  ASSERT_GT( oneThread.numSplits, 0 );
+
+  compareSeparations( separate( true, 0 ), oneThread );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
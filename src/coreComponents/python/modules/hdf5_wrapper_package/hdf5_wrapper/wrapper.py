@@ -4,17 +4,123 @@ import numpy as np
 from numpy.core.defchararray import encode, decode
 
 
+class lazy_dataset():
+  """
+  @brief a read-only view of an hdf5 dataset, which behaves similar to a numpy memmap
+  """
+
+  def __init__(self, target):
+    """
+    @brief initialize the lazy_dataset class
+    @param target the handle of an existing hdf5 dataset
+
+    @details Nothing is read until the dataset is sliced, and only the chunks holding
+             the slice are read then (and kept in the chunk cache of the file).
+    """
+    self.target = target
+
+  @property
+  def shape(self):
+    """
+    @brief the shape of the dataset
+    """
+    return self.target.shape
+
+  @property
+  def dtype(self):
+    """
+    @brief the type of the values of the dataset
+    """
+    return self.target.dtype
+
+  @property
+  def ndim(self):
+    """
+    @brief the number of dimensions of the dataset
+    """
+    return self.target.ndim
+
+  @property
+  def size(self):
+    """
+    @brief the number of values of the dataset
+    """
+    return self.target.size
+
+  @property
+  def chunks(self):
+    """
+    @brief the shape of the chunks of the dataset, None if it is contiguous
+    """
+    return self.target.chunks
+
+  def __len__(self):
+    """
+    @brief the length of the first dimension of the dataset
+    """
+    return len(self.target)
+
+  def __getitem__(self, k):
+    """
+    @brief read a slice of the dataset
+    @param k a numpy-style slice, the indices along one dimension may also be a list
+    @return the slice as a numpy ndarray, or a native type for a single value
+    """
+    # h5py only supports increasing, unique index lists
+    if isinstance(k, tuple):
+      for d, x in enumerate(k):
+        if isinstance(x, (list, np.ndarray)) and np.ndim(x) == 1 and np.asarray(x).dtype.kind in ['i', 'u']:
+          unique, inverse = np.unique(np.asarray(x), return_inverse=True)
+          if len(unique) != len(x) or np.any(unique != np.asarray(x)):
+            tmp = self[k[:d] + (list(unique),) + k[d + 1:]]
+            axis = sum(not isinstance(y, (int, np.integer)) for y in k[:d])
+            return np.take(tmp, inverse, axis=axis)
+
+    tmp = self.target[k]
+    if isinstance(tmp, np.ndarray) and (tmp.dtype.kind in ['S', 'U', 'O']):
+      tmp = decode(tmp)
+    return tmp
+
+  def __array__(self, dtype=None):
+    """
+    @brief read the whole dataset
+    @param dtype the type to convert the values to
+    @return a numpy ndarray
+    """
+    tmp = self[()]
+    return np.asarray(tmp, dtype=dtype)
+
+  def iter_chunks(self, axis=0, size=None):
+    """
+    @brief iterate over the dataset by blocks along one dimension
+    @param axis the dimension to split the dataset along
+    @param size the length of the blocks, which defaults to the chunk length of the dataset
+    @return yields tuples of (start index, block as a numpy ndarray)
+    """
+    if size is None:
+      # about a million values per block for the contiguous datasets
+      size = self.chunks[axis] if self.chunks else max(1, (1 << 20) * self.shape[axis] // max(1, self.size))
+    for start in range(0, self.shape[axis], size):
+      k = [slice(None)] * self.ndim
+      k[axis] = slice(start, min(start + size, self.shape[axis]))
+      yield start, self[tuple(k)]
+
+
 class hdf5_wrapper():
   """
   @brief a class for reading/writing hdf5 files, which behaves similar to a native dict
   """
 
-  def __init__(self, fname='', target='', mode='r'):
+  def __init__(self, fname='', target='', mode='r', lazy=False, cache_size=None, driver=None, comm=None):
     """
     @brief initialize the hdf5_wrapper class
     @param fname the filename of a new or existing hdf5 database
     @param target the handle of an existing hdf5 dataset
     @param mode the read/write behavior of the database (default='r')
+    @param lazy if True, the arrays are returned as lazy_dataset objects, only read when sliced (default=False)
+    @param cache_size the size in bytes of the chunk cache of each dataset, h5py's default if None
+    @param driver the hdf5 file driver, e.g. 'mpio' to open the file collectively (needs comm)
+    @param comm the mpi4py communicator of the 'mpio' driver
 
     @details If the fname is supplied (either by a positional or keyword argument),
              the wrapper will open a hdf5 database from the filesystem.  The reccomended
@@ -24,12 +130,23 @@ class hdf5_wrapper():
 
              If the target is supplied, then a new instance of the wrapper will
              be created using an existing database handle.
+
+             Large files, e.g. the time history of long runs, should be opened lazily:
+             slicing a lazy_dataset only reads the chunks holding the slice.
     """
 
     self.mode = mode
     self.target = target
+    self.lazy = lazy
     if fname:
-      self.target = h5py.File(fname, self.mode)
+      kwargs = {}
+      if cache_size is not None:
+        kwargs['rdcc_nbytes'] = int(cache_size)
+      if driver is not None:
+        kwargs['driver'] = driver
+        if comm is not None:
+          kwargs['comm'] = comm
+      self.target = h5py.File(fname, self.mode, **kwargs)
 
   def __getitem__(self, k):
     """
@@ -38,7 +155,8 @@ class hdf5_wrapper():
 
     @return the returned value depends on the type of the target:
               - An existing hdf5 group will return an instance of hdf5_wrapper
-              - An existing array will return an numpy ndarray
+              - An existing array will return an numpy ndarray, or a lazy_dataset
+                if the database is lazy
               - If the target is not present in the datastructure and the
                 database is open in read/write mode, the wrapper will create a
                 new group and return an hdf5_wrapper
@@ -53,8 +171,11 @@ class hdf5_wrapper():
     tmp = self.target[k]
 
     if isinstance(tmp, h5py._hl.group.Group):
-      return hdf5_wrapper(target=tmp, mode=self.mode)
+      return hdf5_wrapper(target=tmp, mode=self.mode, lazy=self.lazy)
     elif isinstance(tmp, h5py._hl.dataset.Dataset):
+      if self.lazy and tmp.shape:
+        return lazy_dataset(tmp)
+
       tmp = np.array(tmp)
 
       # Decode any string types
@@ -1,3 +1,3 @@
 
-from .plot_time_history import getHistorySeries
+from .plot_time_history import getHistorySeries, getHistorySeriesFromFiles
 from wrapper import hdf5_wrapper
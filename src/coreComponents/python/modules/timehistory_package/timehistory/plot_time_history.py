@@ -80,7 +80,42 @@ def getHistorySeries( database, variable, setname, indices = None, components =
     else:
         components = range(data_series.shape[2])
 
-    return [ (time_series[:,0], data_series[:,idx,comp], idx, comp) for idx in indices for comp in components ]
+    # one read of the times and of each index, which only touches the chunks holding them with a lazy database
+    times = time_series[:,0]
+    series = [ ]
+    for idx in indices:
+        block = data_series[:,idx,:]
+        series.extend( (times, block[:,comp], idx, comp) for comp in components )
+    return series
+
+
+def getHistorySeriesFromFiles( filenames, variable, setname, indices = None, components = None, comm = None, cache_size = None ):
+    """
+    @brief retrieve the time-series of a variable from several time history files, optionally reading them in parallel
+    @param filenames the time history files, e.g. the outputs of the successive restarts or of the ensemble members of a run
+    @param variable the name of the time history variable for which to retrieve time-series data
+    @param setname the name of the index set as specified in the geosx input xml for which to query time-series data
+    @param indices the indices in the named set to query for, if None, defaults to all
+    @param components the components in the flattened data types to retrieve, defaults to all
+    @param comm an mpi4py communicator: the files are distributed over its ranks, and the series gathered on all the ranks
+    @param cache_size the size in bytes of the chunk cache of the datasets, h5py's default if None
+    @return a list holding the list of timeseries tuples of each file (see getHistorySeries), None for the files that failed
+    """
+    rank = comm.Get_rank( ) if comm is not None else 0
+    size = comm.Get_size( ) if comm is not None else 1
+
+    local = { }
+    for ii in range( rank, len(filenames), size ):
+        with h5w( filenames[ii], mode='r', lazy=True, cache_size=cache_size ) as database:
+            local[ii] = getHistorySeries( database, variable, setname, indices, components )
+
+    if comm is not None:
+        gathered = { }
+        for part in comm.allgather( local ):
+            gathered.update( part )
+        local = gathered
+
+    return [ local[ii] for ii in range( len(filenames) ) ]
 
 
 def commandLinePlotGen():
@@ -117,6 +152,12 @@ def commandLinePlotGen():
                         nargs="+", 
                         help="An optional list of specific variable components")
 
+    parser.add_argument("--cache-size",
+                        metavar="bytes",
+                        type=int,
+                        default=None,
+                        help="An optional size of the chunk cache of the datasets, which are only read as far as the plots need them.")
+
     args = parser.parse_args()
     result = 0
 
@@ -124,7 +165,7 @@ def commandLinePlotGen():
         print(f"Error: file '{args.filename}' not found.")
         result = -1
     else:
-        with h5w( args.filename, mode='r' ) as database:
+        with h5w( args.filename, mode='r', lazy=True, cache_size=args.cache_size ) as database:
             for setname in args.sets:
                 ds = getHistorySeries( database, args.variable, setname, args.indices, args.components )
                 if ds is None:
@@ -17,10 +17,14 @@
 
 // Source includes
 #include "common/DataTypes.hpp"
+#include "common/TimingMacros.hpp"
 
 // TPL includes
 #include <RAJA/RAJA.hpp>
 
+// System includes
+#include <vector>
+
 namespace geosx
 {
 
@@ -43,17 +47,51 @@ using parallelHostAtomic = serialAtomic;
 
 #endif
 
+#if defined(GEOSX_USE_HIP)
+/// The number of threads of a wavefront, executing in lockstep on the device.
+constexpr unsigned long deviceWarpSize = 64;
+#else
+/// The number of threads of a warp, executing in lockstep on the device.
+constexpr unsigned long deviceWarpSize = 32;
+#endif
+
+/**
+ * @brief Round a block size up to a whole number of warps.
+ * @param blockSize the block size
+ * @return the smallest multiple of deviceWarpSize not less than @p blockSize
+ */
+constexpr unsigned long roundUpToWarpSize( unsigned long const blockSize )
+{
+  return ( ( blockSize + deviceWarpSize - 1 ) / deviceWarpSize ) * deviceWarpSize;
+}
+
 #if defined(GEOSX_USE_CUDA)
 
 template< unsigned long BLOCK_SIZE = 256 >
 using parallelDevicePolicy = RAJA::cuda_exec< BLOCK_SIZE >;
+template< unsigned long BLOCK_SIZE = 256 >
+using parallelDeviceAsyncPolicy = RAJA::cuda_exec_async< BLOCK_SIZE >;
 using parallelDeviceReduce = RAJA::cuda_reduce;
 using parallelDeviceAtomic = RAJA::cuda_atomic;
+using parallelDeviceResource = RAJA::resources::Cuda;
+
+#elif defined(GEOSX_USE_HIP)
+
+// the block sizes chosen for the 32-wide warps of CUDA are widened to whole 64-wide wavefronts
+template< unsigned long BLOCK_SIZE = 256 >
+using parallelDevicePolicy = RAJA::hip_exec< roundUpToWarpSize( BLOCK_SIZE ) >;
+template< unsigned long BLOCK_SIZE = 256 >
+using parallelDeviceAsyncPolicy = RAJA::hip_exec_async< roundUpToWarpSize( BLOCK_SIZE ) >;
+using parallelDeviceReduce = RAJA::hip_reduce;
+using parallelDeviceAtomic = RAJA::hip_atomic;
+using parallelDeviceResource = RAJA::resources::Hip;
 
 #else
 
 template< unsigned long BLOCK_SIZE = 0 >
 using parallelDevicePolicy = parallelHostPolicy;
+template< unsigned long BLOCK_SIZE = 0 >
+using parallelDeviceAsyncPolicy = parallelHostPolicy;
 using parallelDeviceReduce = parallelHostReduce;
 using parallelDeviceAtomic = parallelHostAtomic;
 
@@ -87,6 +125,53 @@ struct PolicyMap< RAJA::cuda_exec< BLOCK_SIZE > >
   using atomic = RAJA::cuda_atomic;
   using reduce = RAJA::cuda_reduce;
 };
+
+template< unsigned long BLOCK_SIZE >
+struct PolicyMap< RAJA::cuda_exec_async< BLOCK_SIZE > >
+{
+  using atomic = RAJA::cuda_atomic;
+  using reduce = RAJA::cuda_reduce;
+};
+#endif
+
+#if defined(GEOSX_USE_HIP)
+template< unsigned long BLOCK_SIZE >
+struct PolicyMap< RAJA::hip_exec< BLOCK_SIZE > >
+{
+  using atomic = RAJA::hip_atomic;
+  using reduce = RAJA::hip_reduce;
+};
+
+template< unsigned long BLOCK_SIZE >
+struct PolicyMap< RAJA::hip_exec_async< BLOCK_SIZE > >
+{
+  using atomic = RAJA::hip_atomic;
+  using reduce = RAJA::hip_reduce;
+};
+#endif
+
+template< typename >
+struct IsDevicePolicy : std::false_type
+{};
+
+#if defined(GEOSX_USE_CUDA)
+template< unsigned long BLOCK_SIZE >
+struct IsDevicePolicy< RAJA::cuda_exec< BLOCK_SIZE > > : std::true_type
+{};
+
+template< unsigned long BLOCK_SIZE >
+struct IsDevicePolicy< RAJA::cuda_exec_async< BLOCK_SIZE > > : std::true_type
+{};
+#endif
+
+#if defined(GEOSX_USE_HIP)
+template< unsigned long BLOCK_SIZE >
+struct IsDevicePolicy< RAJA::hip_exec< BLOCK_SIZE > > : std::true_type
+{};
+
+template< unsigned long BLOCK_SIZE >
+struct IsDevicePolicy< RAJA::hip_exec_async< BLOCK_SIZE > > : std::true_type
+{};
 #endif
 }
 
@@ -97,14 +182,132 @@ using ReducePolicy = typename internalRajaInterface::PolicyMap< POLICY >::reduce
 template< typename POLICY >
 using AtomicPolicy = typename internalRajaInterface::PolicyMap< POLICY >::atomic;
 
+/// Whether POLICY executes on the device
+template< typename POLICY >
+constexpr bool isDevicePolicy = internalRajaInterface::IsDevicePolicy< POLICY >::value;
+
 
 
 template< typename POLICY, typename LAMBDA >
 RAJA_INLINE void forAll( const localIndex end, LAMBDA && body )
 {
+  // the loops are named after the function defining their body, unless they run within a marked kernel
+  GEOSX_MARK_LOOP( LAMBDA, end );
   RAJA::forall< POLICY >( RAJA::TypedRangeSegment< localIndex >( 0, end ), std::forward< LAMBDA >( body ) );
 }
 
+#if defined(GEOSX_USE_DEVICE)
+template< typename POLICY, typename LAMBDA >
+RAJA_INLINE RAJA::resources::EventProxy< parallelDeviceResource >
+forAll( parallelDeviceResource & resource, const localIndex end, LAMBDA && body )
+{
+  GEOSX_MARK_LOOP( LAMBDA, end );
+  return RAJA::forall< POLICY >( resource, RAJA::TypedRangeSegment< localIndex >( 0, end ), std::forward< LAMBDA >( body ) );
+}
+#endif
+
+/**
+ * @class ConcurrentLaunches
+ * @brief Launch independent loops, for instance over different subregions, on a rotating set of streams.
+ *
+ * The loops launched through the same object may run concurrently on the device, and do not block the host.
+ * The small subregions (wells, fractures) that cannot fill the device alone then overlap. Before the results
+ * are read on the host, by a reduction or a synchronization, wait() must be called. sync() makes the loops
+ * launched afterwards on the default stream wait for them through events, without blocking the host. The
+ * destructor waits for the loops. Without a device, the loops simply run one after the other.
+ */
+class ConcurrentLaunches
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param numStreams the number of streams the loops are spread on
+   */
+  explicit ConcurrentLaunches( localIndex const numStreams = 4 )
+  {
+#if defined(GEOSX_USE_DEVICE)
+    m_resources.resize( numStreams );
+    m_used.resize( numStreams, false );
+#else
+    GEOSX_UNUSED_VAR( numStreams );
+#endif
+  }
+
+  ConcurrentLaunches( ConcurrentLaunches const & ) = delete;
+  ConcurrentLaunches & operator=( ConcurrentLaunches const & ) = delete;
+
+  /// Destructor, waits for the loops launched.
+  ~ConcurrentLaunches()
+  { wait(); }
+
+  /**
+   * @brief Launch a loop on the next stream.
+   * @tparam POLICY the asynchronous policy of the loop
+   * @tparam LAMBDA the type of the loop body
+   * @param end the number of iterations
+   * @param body the loop body
+   */
+  template< typename POLICY = parallelDeviceAsyncPolicy<>, typename LAMBDA >
+  void forAll( localIndex const end, LAMBDA && body )
+  {
+#if defined(GEOSX_USE_DEVICE)
+    localIndex const stream = m_next;
+    m_next = ( m_next + 1 ) % static_cast< localIndex >( m_resources.size() );
+    m_used[ stream ] = true;
+    geosx::forAll< POLICY >( m_resources[ stream ], end, std::forward< LAMBDA >( body ) );
+#else
+    geosx::forAll< POLICY >( end, std::forward< LAMBDA >( body ) );
+#endif
+  }
+
+  /**
+   * @brief Block the host until the loops launched are complete.
+   */
+  void wait()
+  {
+#if defined(GEOSX_USE_DEVICE)
+    for( std::size_t stream = 0; stream < m_resources.size(); ++stream )
+    {
+      if( m_used[ stream ] )
+      {
+        m_resources[ stream ].wait();
+        m_used[ stream ] = false;
+      }
+    }
+#endif
+  }
+
+  /**
+   * @brief Make the default stream wait for the loops launched, without blocking the host.
+   */
+  void sync()
+  {
+#if defined(GEOSX_USE_DEVICE)
+    parallelDeviceResource defaultResource = parallelDeviceResource::get_default();
+    for( std::size_t stream = 0; stream < m_resources.size(); ++stream )
+    {
+      if( m_used[ stream ] )
+      {
+        RAJA::resources::Event event = m_resources[ stream ].get_event();
+        defaultResource.wait_for( &event );
+      }
+    }
+#endif
+  }
+
+private:
+
+#if defined(GEOSX_USE_DEVICE)
+  /// The resources of the streams
+  std::vector< parallelDeviceResource > m_resources;
+  /// Whether a loop was launched on each stream since the last wait
+  std::vector< bool > m_used;
+  /// The stream of the next loop
+  localIndex m_next = 0;
+#endif
+};
+
 } // namespace geosx
 
 #endif // GEOSX_RAJAINTERFACE_RAJAINTERFACE_HPP
@@ -0,0 +1,202 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file KernelBenchmarkUtilities.hpp
+ *
+ * Synthetic problems and throughput reports shared by the kernel benchmarks.
+ */
+
+#ifndef GEOSX_UNITTESTS_KERNELBENCHMARKS_KERNELBENCHMARKUTILITIES_HPP_
+#define GEOSX_UNITTESTS_KERNELBENCHMARKS_KERNELBENCHMARKUTILITIES_HPP_
+
+#include "constitutive/ConstitutiveManager.hpp"
+#include "managers/DomainPartition.hpp"
+#include "managers/ProblemManager.hpp"
+#include "meshUtilities/MeshManager.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <initializer_list>
+#include <memory>
+
+namespace geosx
+{
+
+namespace benchmarking
+{
+
+/// The element types of the synthetic meshes, selected by the second argument of the benchmarks
+constexpr char const * elementTypes[] = { "C3D8", "C3D4", "C3D6" };
+
+/**
+ * @brief Get the element type selected by the second argument of a benchmark.
+ * @param state the benchmark state
+ * @return the element type
+ */
+inline string elementType( benchmark::State const & state )
+{
+  return elementTypes[ state.range( 1 ) ];
+}
+
+/**
+ * @brief Register the arguments of a benchmark: the number of cells in each direction of the cube
+ *        (8 to 64) and the element type.
+ * @param bench the benchmark
+ *
+ * A single size or element type is run with the filter, --benchmark_filter=QuasiStatic/n:32/elementType:0
+ * runs QuasiStatic on the 32x32x32 hexahedra.
+ */
+inline void meshArguments( benchmark::internal::Benchmark * const bench )
+{
+  for( int t = 0; t < static_cast< int >( sizeof( elementTypes ) / sizeof( elementTypes[0] ) ); ++t )
+  {
+    for( int n = 8; n <= 64; n *= 2 )
+    {
+      bench->Args( { n, t } );
+    }
+  }
+  bench->ArgNames( { "n", "elementType" } )->Unit( benchmark::kMillisecond );
+}
+
+/**
+ * @brief Get the internal mesh of a cube of n x n x n cells.
+ * @param n the number of cells in each direction
+ * @param elementType the element type
+ * @return the Mesh block of the input
+ */
+inline string meshInput( localIndex const n, string const & elementType )
+{
+  string const cells = std::to_string( n );
+  return "  <Mesh>\n"
+         "    <InternalMesh name=\"mesh\" elementTypes=\"{" + elementType + "}\"\n"
+         "                  xCoords=\"{0, 1}\" yCoords=\"{0, 1}\" zCoords=\"{0, 1}\"\n"
+         "                  nx=\"{" + cells + "}\" ny=\"{" + cells + "}\" nz=\"{" + cells + "}\"\n"
+         "                  cellBlockNames=\"{cb}\"/>\n"
+         "  </Mesh>\n";
+}
+
+/**
+ * @brief Setup a problem from its input, as the unit tests do.
+ * @param problemManager the problem manager
+ * @param xmlInput the input
+ */
+inline void setupProblemFromXML( ProblemManager & problemManager, string const & xmlInput )
+{
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlWrapper::xmlResult const xmlResult = xmlDocument.load_buffer( xmlInput.c_str(), xmlInput.size() );
+  GEOSX_ERROR_IF( !xmlResult, "XML parsed with errors: " << xmlResult.description() << " at offset " << xmlResult.offset );
+
+  int const mpiSize = MpiWrapper::Comm_size( MPI_COMM_GEOSX );
+  dataRepository::Group * commandLine =
+    problemManager.GetGroup< dataRepository::Group >( problemManager.groupKeys.commandLine );
+  commandLine->registerWrapper< integer >( problemManager.viewKeys.xPartitionsOverride.Key() )->
+    setApplyDefaultValue( mpiSize );
+
+  xmlWrapper::xmlNode xmlProblemNode = xmlDocument.child( "Problem" );
+  problemManager.InitializePythonInterpreter();
+  problemManager.ProcessInputFileRecursive( xmlProblemNode );
+
+  DomainPartition & domain = *problemManager.getDomainPartition();
+
+  constitutive::ConstitutiveManager & constitutiveManager = *domain.getConstitutiveManager();
+  xmlWrapper::xmlNode topLevelNode = xmlProblemNode.child( constitutiveManager.getName().c_str() );
+  constitutiveManager.ProcessInputFileRecursive( topLevelNode );
+
+  MeshManager & meshManager = *problemManager.GetGroup< MeshManager >( problemManager.groupKeys.meshManager );
+  meshManager.GenerateMeshLevels( &domain );
+
+  ElementRegionManager & elementManager = *domain.getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
+  topLevelNode = xmlProblemNode.child( elementManager.getName().c_str() );
+  elementManager.ProcessInputFileRecursive( topLevelNode );
+
+  problemManager.ProblemSetup();
+}
+
+/**
+ * @brief Get the problem of an input, built once for all the benchmarks and sizes using it.
+ * @param xmlInput the input
+ * @return the problem manager
+ *
+ * A single problem is kept: the problem manager registers singletons (the field specifications,
+ * the functions) that cannot be shared by two problems.
+ */
+inline ProblemManager & getProblem( string const & xmlInput )
+{
+  static std::unique_ptr< ProblemManager > problemManager;
+  static string problemInput;
+  if( !problemManager || problemInput != xmlInput )
+  {
+    problemManager.reset();
+    problemManager = std::make_unique< ProblemManager >( "Problem", nullptr );
+    setupProblemFromXML( *problemManager, xmlInput );
+    problemInput = xmlInput;
+  }
+  return *problemManager;
+}
+
+/**
+ * @brief Get the number of bytes of some wrappers of a group.
+ * @param group the group
+ * @param names the names of the wrappers, the missing ones are skipped
+ * @return the number of bytes
+ */
+inline localIndex wrapperBytes( dataRepository::Group const & group, std::initializer_list< string > const names )
+{
+  localIndex bytes = 0;
+  for( string const & name : names )
+  {
+    dataRepository::WrapperBase const * const wrapper = group.getWrapperBase( name );
+    bytes += ( wrapper != nullptr ) ? wrapper->bytesAllocated() : 0;
+  }
+  return bytes;
+}
+
+/**
+ * @brief Get the number of bytes of all the wrappers of a group.
+ * @param group the group
+ * @return the number of bytes
+ */
+inline localIndex groupBytes( dataRepository::Group const & group )
+{
+  localIndex bytes = 0;
+  group.forWrappers( [&]( dataRepository::WrapperBase const & wrapper )
+  {
+    bytes += wrapper.bytesAllocated();
+  } );
+  return bytes;
+}
+
+/**
+ * @brief Report the throughput of a benchmark, in elements/s and bytes/s.
+ * @param state the benchmark state
+ * @param numElems the number of elements processed by each iteration
+ * @param bytes the number of bytes read and written by each iteration, counting each array once
+ *
+ * The bytes are those of the arrays the kernel reads or writes, a lower bound of its memory traffic,
+ * so that the reported bandwidth is the effective one.
+ */
+inline void setThroughput( benchmark::State & state, localIndex const numElems, localIndex const bytes )
+{
+  state.SetItemsProcessed( static_cast< int64_t >( state.iterations() ) * numElems );
+  state.SetBytesProcessed( static_cast< int64_t >( state.iterations() ) * bytes );
+  state.SetLabel( elementType( state ) );
+}
+
+} // namespace benchmarking
+
+} // namespace geosx
+
+#endif // GEOSX_UNITTESTS_KERNELBENCHMARKS_KERNELBENCHMARKUTILITIES_HPP_
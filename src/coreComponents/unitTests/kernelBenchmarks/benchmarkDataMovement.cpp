@@ -0,0 +1,116 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file benchmarkDataMovement.cpp
+ *
+ * Throughput of the kernels moving data without computations: the application of a field
+ * specification to all the nodes (FieldSpecificationApply) and the packing and unpacking of
+ * the nodal fields exchanged by the synchronizations (BufferOpsPackUnpack).
+ */
+
+#include "KernelBenchmarkUtilities.hpp"
+
+#include "managers/FieldSpecification/FieldSpecificationManager.hpp"
+
+using namespace geosx;
+using namespace geosx::benchmarking;
+using namespace geosx::dataRepository;
+
+namespace
+{
+
+/**
+ * @brief Get the input of an explicit solid mechanics cube, with a displacement applied to all the nodes.
+ * @param n the number of cells in each direction
+ * @param elementType the element type
+ * @return the input
+ */
+string dataMovementInput( localIndex const n, string const & elementType )
+{
+  return "<Problem>\n"
+         "  <Solvers>\n"
+         "    <SolidMechanics_LagrangianFEM name=\"solidSolver\" timeIntegrationOption=\"ExplicitDynamic\"\n"
+         "                                  discretization=\"FE1\" targetRegions=\"{Region}\" solidMaterialNames=\"{shale}\"/>\n"
+         "  </Solvers>\n"
+         + meshInput( n, elementType ) +
+         "  <NumericalMethods>\n"
+         "    <FiniteElements>\n"
+         "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+         "    </FiniteElements>\n"
+         "  </NumericalMethods>\n"
+         "  <ElementRegions>\n"
+         "    <CellElementRegion name=\"Region\" cellBlocks=\"{cb}\" materialList=\"{shale}\"/>\n"
+         "  </ElementRegions>\n"
+         "  <Constitutive>\n"
+         "    <LinearElasticIsotropic name=\"shale\" defaultDensity=\"2700\" defaultBulkModulus=\"5.5556e9\" defaultShearModulus=\"4.16667e9\"/>\n"
+         "  </Constitutive>\n"
+         "  <FieldSpecifications>\n"
+         "    <FieldSpecification name=\"displacement\" objectPath=\"nodeManager\" fieldName=\"TotalDisplacement\"\n"
+         "                        component=\"0\" scale=\"1.0e-3\" setNames=\"{all}\"/>\n"
+         "  </FieldSpecifications>\n"
+         "</Problem>";
+}
+
+void FieldSpecificationApply( benchmark::State & state )
+{
+  ProblemManager & problemManager = getProblem( dataMovementInput( state.range( 0 ), elementType( state ) ) );
+  DomainPartition & domain = *problemManager.getDomainPartition();
+  NodeManager const & nodeManager = *domain.getMeshBody( 0 )->getMeshLevel( 0 )->getNodeManager();
+
+  for( auto _ : state )
+  {
+    FieldSpecificationManager::get().ApplyFieldValue( 0.0, &domain, "nodeManager", keys::TotalDisplacement );
+  }
+
+  // the index of the node in the set is read and one component of the displacement is written
+  setThroughput( state, nodeManager.size(), nodeManager.size() * ( sizeof( localIndex ) + sizeof( real64 ) ) );
+}
+
+void BufferOpsPackUnpack( benchmark::State & state )
+{
+  ProblemManager & problemManager = getProblem( dataMovementInput( state.range( 0 ), elementType( state ) ) );
+  DomainPartition & domain = *problemManager.getDomainPartition();
+  NodeManager & nodeManager = *domain.getMeshBody( 0 )->getMeshLevel( 0 )->getNodeManager();
+
+  string_array wrapperNames;
+  wrapperNames.emplace_back( keys::TotalDisplacement );
+  wrapperNames.emplace_back( keys::Velocity );
+
+  array1d< localIndex > packList( nodeManager.size() );
+  forAll< serialPolicy >( nodeManager.size(), [packList = packList.toView()]( localIndex const a )
+  {
+    packList[a] = a;
+  } );
+
+  array1d< buffer_unit_type > buffer( nodeManager.PackSize( wrapperNames, packList, 0 ) );
+  arrayView1d< localIndex > packListView = packList.toView();
+
+  for( auto _ : state )
+  {
+    buffer_unit_type * sendBuffer = buffer.data();
+    nodeManager.Pack( sendBuffer, wrapperNames, packList, 0 );
+
+    buffer_unit_type const * receiveBuffer = buffer.data();
+    nodeManager.Unpack( receiveBuffer, packListView, 0 );
+  }
+
+  // the buffer is written by the packing and read by the unpacking
+  setThroughput( state, nodeManager.size(), 2 * buffer.size() );
+}
+
+}
+
+BENCHMARK( FieldSpecificationApply )->Apply( meshArguments );
+BENCHMARK( BufferOpsPackUnpack )->Apply( meshArguments );
@@ -0,0 +1,235 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file benchmarkFlow.cpp
+ *
+ * Throughput of the flow kernels: the assembly of the two-point flux approximation of SinglePhaseFVM
+ * (FluxKernel) and the update of the compositional properties of CompositionalMultiphaseFlow, from the
+ * component fractions to the phase mobilities through the flash (CompositionalUpdateState).
+ */
+
+#include "KernelBenchmarkUtilities.hpp"
+
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseFlow.hpp"
+#include "physicsSolvers/fluidFlow/SinglePhaseFVM.hpp"
+
+using namespace geosx;
+using namespace geosx::benchmarking;
+
+namespace
+{
+
+/**
+ * @brief Get the initial conditions of the permeability and the porosity of the cube.
+ * @return the field specifications of the input
+ */
+string rockPropertiesInput()
+{
+  string input;
+  for( int component = 0; component < 3; ++component )
+  {
+    input += "    <FieldSpecification name=\"perm" + std::to_string( component ) + "\" initialCondition=\"1\" setNames=\"{all}\"\n"
+             "                        objectPath=\"ElementRegions/Region/cb\" fieldName=\"permeability\"\n"
+             "                        component=\"" + std::to_string( component ) + "\" scale=\"1.0e-13\"/>\n";
+  }
+  input += "    <FieldSpecification name=\"referencePorosity\" initialCondition=\"1\" setNames=\"{all}\"\n"
+           "                        objectPath=\"ElementRegions/Region/cb\" fieldName=\"referencePorosity\" scale=\"0.2\"/>\n";
+  return input;
+}
+
+/**
+ * @brief Get the input of a single phase cube.
+ * @param n the number of cells in each direction
+ * @param elementType the element type
+ * @return the input
+ */
+string singlePhaseInput( localIndex const n, string const & elementType )
+{
+  return "<Problem>\n"
+         "  <Solvers gravityVector=\"0.0, 0.0, -9.81\">\n"
+         "    <SinglePhaseFVM name=\"flowSolver\" discretization=\"fluidTPFA\" targetRegions=\"{Region}\"\n"
+         "                    fluidNames=\"{water}\" solidNames=\"{rock}\"/>\n"
+         "  </Solvers>\n"
+         + meshInput( n, elementType ) +
+         "  <NumericalMethods>\n"
+         "    <FiniteVolume>\n"
+         "      <TwoPointFluxApproximation name=\"fluidTPFA\" fieldName=\"pressure\" coefficientName=\"permeability\"/>\n"
+         "    </FiniteVolume>\n"
+         "  </NumericalMethods>\n"
+         "  <ElementRegions>\n"
+         "    <CellElementRegion name=\"Region\" cellBlocks=\"{cb}\" materialList=\"{water, rock}\"/>\n"
+         "  </ElementRegions>\n"
+         "  <Constitutive>\n"
+         "    <CompressibleSinglePhaseFluid name=\"water\" defaultDensity=\"1000\" defaultViscosity=\"0.001\"\n"
+         "                                  referencePressure=\"0.0\" referenceDensity=\"1000\" compressibility=\"5e-10\"\n"
+         "                                  referenceViscosity=\"0.001\" viscosibility=\"0.0\"/>\n"
+         "    <PoreVolumeCompressibleSolid name=\"rock\" referencePressure=\"0.0\" compressibility=\"1e-9\"/>\n"
+         "  </Constitutive>\n"
+         "  <FieldSpecifications>\n"
+         + rockPropertiesInput() +
+         "    <FieldSpecification name=\"initialPressure\" initialCondition=\"1\" setNames=\"{all}\"\n"
+         "                        objectPath=\"ElementRegions/Region/cb\" fieldName=\"pressure\" scale=\"1e7\"/>\n"
+         "  </FieldSpecifications>\n"
+         "</Problem>";
+}
+
+/**
+ * @brief Get the input of a compositional cube, with the four components of the unit tests.
+ * @param n the number of cells in each direction
+ * @param elementType the element type
+ * @return the input
+ */
+string compositionalInput( localIndex const n, string const & elementType )
+{
+  string const compositions[] = { "0.099", "0.3", "0.6", "0.001" };
+  string initialComposition;
+  for( int component = 0; component < 4; ++component )
+  {
+    initialComposition += "    <FieldSpecification name=\"initialComposition" + std::to_string( component ) + "\" initialCondition=\"1\"\n"
+                          "                        setNames=\"{all}\" objectPath=\"ElementRegions/Region/cb\" fieldName=\"globalCompFraction\"\n"
+                          "                        component=\"" + std::to_string( component ) + "\" scale=\"" + compositions[component] + "\"/>\n";
+  }
+
+  return "<Problem>\n"
+         "  <Solvers gravityVector=\"0.0, 0.0, -9.81\">\n"
+         "    <CompositionalMultiphaseFlow name=\"flowSolver\" discretization=\"fluidTPFA\" targetRegions=\"{Region}\"\n"
+         "                                 fluidNames=\"{fluid}\" solidNames=\"{rock}\" relPermNames=\"{relperm}\"\n"
+         "                                 capPressureNames=\"{cappressure}\" temperature=\"297.15\" useMass=\"1\"/>\n"
+         "  </Solvers>\n"
+         + meshInput( n, elementType ) +
+         "  <NumericalMethods>\n"
+         "    <FiniteVolume>\n"
+         "      <TwoPointFluxApproximation name=\"fluidTPFA\" fieldName=\"pressure\" coefficientName=\"permeability\"/>\n"
+         "    </FiniteVolume>\n"
+         "  </NumericalMethods>\n"
+         "  <ElementRegions>\n"
+         "    <CellElementRegion name=\"Region\" cellBlocks=\"{cb}\" materialList=\"{fluid, rock, relperm, cappressure}\"/>\n"
+         "  </ElementRegions>\n"
+         "  <Constitutive>\n"
+         "    <CompositionalMultiphaseFluid name=\"fluid\" phaseNames=\"{oil, gas}\" equationsOfState=\"{PR, PR}\"\n"
+         "                                  componentNames=\"{N2, C10, C20, H2O}\"\n"
+         "                                  componentCriticalPressure=\"{34e5, 25.3e5, 14.6e5, 220.5e5}\"\n"
+         "                                  componentCriticalTemperature=\"{126.2, 622.0, 782.0, 647.0}\"\n"
+         "                                  componentAcentricFactor=\"{0.04, 0.443, 0.816, 0.344}\"\n"
+         "                                  componentMolarWeight=\"{28e-3, 134e-3, 275e-3, 18e-3}\"\n"
+         "                                  componentVolumeShift=\"{0, 0, 0, 0}\"\n"
+         "                                  componentBinaryCoeff=\"{ {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 0, 0} }\"/>\n"
+         "    <PoreVolumeCompressibleSolid name=\"rock\" referencePressure=\"0.0\" compressibility=\"1e-9\"/>\n"
+         "    <BrooksCoreyRelativePermeability name=\"relperm\" phaseNames=\"{oil, gas}\" phaseMinVolumeFraction=\"{0.1, 0.15}\"\n"
+         "                                     phaseRelPermExponent=\"{2.0, 2.0}\" phaseRelPermMaxValue=\"{0.8, 0.9}\"/>\n"
+         "    <BrooksCoreyCapillaryPressure name=\"cappressure\" phaseNames=\"{oil, gas}\" phaseMinVolumeFraction=\"{0.2, 0.05}\"\n"
+         "                                  phaseCapPressureExponentInv=\"{4.25, 3.5}\" phaseEntryPressure=\"{0., 1e8}\"\n"
+         "                                  capPressureEpsilon=\"0.0\"/>\n"
+         "  </Constitutive>\n"
+         "  <FieldSpecifications>\n"
+         + rockPropertiesInput() +
+         "    <FieldSpecification name=\"initialPressure\" initialCondition=\"1\" setNames=\"{all}\"\n"
+         "                        objectPath=\"ElementRegions/Region/cb\" fieldName=\"pressure\" scale=\"5e6\"/>\n"
+         + initialComposition +
+         "  </FieldSpecifications>\n"
+         "</Problem>";
+}
+
+/**
+ * @brief Setup the linear system of a solver before its assembly is timed.
+ * @param solver the solver
+ * @param domain the domain
+ */
+void setupSystem( SolverBase & solver, DomainPartition & domain )
+{
+  solver.SetupSystem( domain,
+                      solver.getDofManager(),
+                      solver.getLocalMatrix(),
+                      solver.getLocalRhs(),
+                      solver.getLocalSolution() );
+  solver.ImplicitStepSetup( 0.0, 1.0e4, domain );
+}
+
+void FluxKernel( benchmark::State & state )
+{
+  ProblemManager & problemManager = getProblem( singlePhaseInput( state.range( 0 ), elementType( state ) ) );
+  DomainPartition & domain = *problemManager.getDomainPartition();
+  SinglePhaseFVM< SinglePhaseBase > & solver =
+    *problemManager.GetPhysicsSolverManager().GetGroup< SinglePhaseFVM< SinglePhaseBase > >( "flowSolver" );
+  MeshLevel const & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
+  setupSystem( solver, domain );
+  CRSMatrix< real64, globalIndex > & localMatrix = solver.getLocalMatrix();
+  array1d< real64 > & localRhs = solver.getLocalRhs();
+
+  // the fluxes are added to the matrix at each iteration, which is not zeroed to only time the kernel
+  for( auto _ : state )
+  {
+    solver.AssembleFluxTerms( 0.0, 1.0e4, domain, solver.getDofManager(), localMatrix.toViewConstSizes(), localRhs.toView() );
+  }
+
+  localIndex bytes = localMatrix.numNonZeros() * ( sizeof( real64 ) + sizeof( globalIndex ) ) + localRhs.size() * sizeof( real64 );
+  solver.forTargetSubRegions( mesh, [&]( localIndex const, ElementSubRegionBase const & subRegion )
+  {
+    bytes += wrapperBytes( subRegion, { FlowSolverBase::viewKeyStruct::pressureString,
+                                        FlowSolverBase::viewKeyStruct::deltaPressureString,
+                                        FlowSolverBase::viewKeyStruct::gravityCoefString,
+                                        SinglePhaseBase::viewKeyStruct::mobilityString,
+                                        SinglePhaseBase::viewKeyStruct::dMobility_dPressureString } );
+    bytes += wrapperBytes( *subRegion.GetConstitutiveModels()->GetGroup( "water" ), { "density", "dDensity_dPressure", "viscosity", "dViscosity_dPressure" } );
+  } );
+  setThroughput( state, mesh.getElemManager()->getNumberOfElements(), bytes );
+}
+
+void CompositionalUpdateState( benchmark::State & state )
+{
+  ProblemManager & problemManager = getProblem( compositionalInput( state.range( 0 ), elementType( state ) ) );
+  DomainPartition & domain = *problemManager.getDomainPartition();
+  CompositionalMultiphaseFlow & solver =
+    *problemManager.GetPhysicsSolverManager().GetGroup< CompositionalMultiphaseFlow >( "flowSolver" );
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
+  setupSystem( solver, domain );
+
+  for( auto _ : state )
+  {
+    solver.forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
+    {
+      solver.UpdateState( subRegion, targetIndex );
+    } );
+  }
+
+  // all the properties of the constitutive models are written, from the primary variables of the cells
+  localIndex bytes = 0;
+  solver.forTargetSubRegions( mesh, [&]( localIndex const, ElementSubRegionBase const & subRegion )
+  {
+    using keys = CompositionalMultiphaseFlow::viewKeyStruct;
+    bytes += wrapperBytes( subRegion, { keys::pressureString,
+                                        keys::deltaPressureString,
+                                        keys::globalCompDensityString,
+                                        keys::deltaGlobalCompDensityString,
+                                        keys::globalCompFractionString,
+                                        keys::dGlobalCompFraction_dGlobalCompDensityString,
+                                        keys::phaseVolumeFractionString,
+                                        keys::dPhaseVolumeFraction_dPressureString,
+                                        keys::dPhaseVolumeFraction_dGlobalCompDensityString } );
+    subRegion.GetConstitutiveModels()->forSubGroups( [&]( dataRepository::Group const & model )
+    {
+      bytes += groupBytes( model );
+    } );
+  } );
+  setThroughput( state, mesh.getElemManager()->getNumberOfElements(), bytes );
+}
+
+}
+
+BENCHMARK( FluxKernel )->Apply( meshArguments );
+BENCHMARK( CompositionalUpdateState )->Apply( meshArguments );
@@ -0,0 +1,134 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file benchmarkSolidMechanics.cpp
+ *
+ * Throughput of the small strain kernels of SolidMechanicsLagrangianFEM: the explicit step
+ * (ExplicitSmallStrain) and the assembly of the quasi-static system (QuasiStatic).
+ */
+
+#include "KernelBenchmarkUtilities.hpp"
+
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/solidMechanics/SolidMechanicsLagrangianFEM.hpp"
+
+using namespace geosx;
+using namespace geosx::benchmarking;
+using namespace geosx::dataRepository;
+
+namespace
+{
+
+/**
+ * @brief Get the input of a linear elastic cube.
+ * @param n the number of cells in each direction
+ * @param elementType the element type
+ * @param timeIntegrationOption the time integration of the solver
+ * @return the input
+ */
+string solidMechanicsInput( localIndex const n, string const & elementType, string const & timeIntegrationOption )
+{
+  return "<Problem>\n"
+         "  <Solvers>\n"
+         "    <SolidMechanics_LagrangianFEM name=\"solidSolver\" timeIntegrationOption=\"" + timeIntegrationOption + "\"\n"
+         "                                  discretization=\"FE1\" targetRegions=\"{Region}\" solidMaterialNames=\"{shale}\"/>\n"
+         "  </Solvers>\n"
+         + meshInput( n, elementType ) +
+         "  <NumericalMethods>\n"
+         "    <FiniteElements>\n"
+         "      <FiniteElementSpace name=\"FE1\" order=\"1\"/>\n"
+         "    </FiniteElements>\n"
+         "  </NumericalMethods>\n"
+         "  <ElementRegions>\n"
+         "    <CellElementRegion name=\"Region\" cellBlocks=\"{cb}\" materialList=\"{shale}\"/>\n"
+         "  </ElementRegions>\n"
+         "  <Constitutive>\n"
+         "    <LinearElasticIsotropic name=\"shale\" defaultDensity=\"2700\" defaultBulkModulus=\"5.5556e9\" defaultShearModulus=\"4.16667e9\"/>\n"
+         "  </Constitutive>\n"
+         "</Problem>";
+}
+
+/**
+ * @brief Get the number of bytes of the nodal fields, the connectivity and the stress.
+ * @param mesh the mesh
+ * @param nodalFields the names of the nodal fields
+ * @return the number of bytes
+ */
+localIndex solidMechanicsBytes( MeshLevel const & mesh, std::initializer_list< string > const nodalFields )
+{
+  localIndex bytes = wrapperBytes( *mesh.getNodeManager(), nodalFields );
+  mesh.getElemManager()->forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    bytes += wrapperBytes( subRegion, { CellElementSubRegion::viewKeyStruct::nodeListString } );
+    bytes += wrapperBytes( *subRegion.GetConstitutiveModels()->GetGroup( "shale" ), { "stress" } );
+  } );
+  return bytes;
+}
+
+void ExplicitSmallStrain( benchmark::State & state )
+{
+  ProblemManager & problemManager = getProblem( solidMechanicsInput( state.range( 0 ), elementType( state ), "ExplicitDynamic" ) );
+  DomainPartition & domain = *problemManager.getDomainPartition();
+  SolidMechanicsLagrangianFEM & solver =
+    *problemManager.GetPhysicsSolverManager().GetGroup< SolidMechanicsLagrangianFEM >( "solidSolver" );
+  MeshLevel const & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
+  integer cycle = 0;
+  for( auto _ : state )
+  {
+    solver.ExplicitStep( 0.0, 1.0e-6, cycle++, domain );
+  }
+
+  setThroughput( state,
+                 mesh.getElemManager()->getNumberOfElements(),
+                 solidMechanicsBytes( mesh, { keys::referencePositionString, keys::TotalDisplacement, keys::IncrementalDisplacement,
+                                              keys::Velocity, keys::Acceleration, keys::Mass } ) );
+}
+
+void QuasiStatic( benchmark::State & state )
+{
+  ProblemManager & problemManager = getProblem( solidMechanicsInput( state.range( 0 ), elementType( state ), "QuasiStatic" ) );
+  DomainPartition & domain = *problemManager.getDomainPartition();
+  SolidMechanicsLagrangianFEM & solver =
+    *problemManager.GetPhysicsSolverManager().GetGroup< SolidMechanicsLagrangianFEM >( "solidSolver" );
+  MeshLevel const & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
+  solver.SetupSystem( domain,
+                      solver.getDofManager(),
+                      solver.getLocalMatrix(),
+                      solver.getLocalRhs(),
+                      solver.getLocalSolution() );
+  solver.ImplicitStepSetup( 0.0, 1.0, domain );
+
+  CRSMatrix< real64, globalIndex > & localMatrix = solver.getLocalMatrix();
+  array1d< real64 > & localRhs = solver.getLocalRhs();
+
+  // the contributions are added to the matrix at each iteration, which is not zeroed to only time the kernel
+  for( auto _ : state )
+  {
+    solver.AssembleSystem( 0.0, 1.0, domain, solver.getDofManager(), localMatrix.toViewConstSizes(), localRhs.toView() );
+  }
+
+  localIndex const matrixBytes = localMatrix.numNonZeros() * ( sizeof( real64 ) + sizeof( globalIndex ) ) +
+                                 localRhs.size() * sizeof( real64 );
+  localIndex const fieldBytes =
+    solidMechanicsBytes( mesh, { keys::referencePositionString, keys::TotalDisplacement, keys::IncrementalDisplacement } );
+  setThroughput( state, mesh.getElemManager()->getNumberOfElements(), fieldBytes + matrixBytes );
+}
+
+}
+
+BENCHMARK( ExplicitSmallStrain )->Apply( meshArguments );
+BENCHMARK( QuasiStatic )->Apply( meshArguments );
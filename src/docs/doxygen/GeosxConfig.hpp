@@ -41,6 +41,14 @@
 /// Enables use of CUDA (CMake option ENABLE_CUDA)
 #define GEOSX_USE_CUDA
 
+/// Enables use of HIP (CMake option ENABLE_HIP)
+/* #undef GEOSX_USE_HIP */
+
+#if defined( GEOSX_USE_CUDA ) || defined( GEOSX_USE_HIP )
+/// Macro defined when the device kernels run on a GPU, through CUDA or HIP
+#define GEOSX_USE_DEVICE
+#endif
+
 /// Enables use of Python (CMake option ENABLE_PYTHON)
 #define GEOSX_USE_PYTHON
 
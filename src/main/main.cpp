@@ -77,13 +77,22 @@ int main( int argc, char *argv[] )
         problemManager.ReadRestartOverwrite();
       }
 
+      logger::FlushRankMessages();
       MpiWrapper::Barrier( MPI_COMM_GEOSX );
       GEOSX_LOG_RANK_0( "Running simulation" );
 
       gettimeofday( &tim, nullptr );
       const real64 t_initialize = tim.tv_sec + ( tim.tv_usec / 1000000.0 );
 
-      problemManager.RunSimulation();
+      std::string const & ensembleFileName = getCommandLineOptions().ensembleFileName;
+      if( ensembleFileName.empty() )
+      {
+        problemManager.RunSimulation();
+      }
+      else
+      {
+        problemManager.RunEnsemble( ensembleFileName );
+      }
 
       gettimeofday( &tim, nullptr );
       const real64 t_run = tim.tv_sec + ( tim.tv_usec / 1000000.0 );